@@ -897,6 +897,7 @@ typedef enum
 #define BLDR_CTRL_REG                   RTC_BKP_DR10
 #define BLDR_STAT_REG                   RTC_BKP_DR11
 #define BLDR_CNT_REG                    RTC_BKP_DR12
+#define FWBOOT_BKP_REG                  RTC_BKP_DR13        // verified boot record, FWBOOT_RECORD_WORDS registers DR13..DR18
 #define APPL_EXEC_ERR                   ('E')
 #define APP_FW_INFO_ERR                 ('A')
 #define NEW_FW_INFO_ERR                 ('V')
@@ -0,0 +1,143 @@
+/**
+ ******************************************************************************
+ * File Name          : fw_boot_cache.c
+ * Description        : verified firmware boot record
+ ******************************************************************************
+ *
+ * Fast boot is allowed only if record is valid, header of running image is
+ * equal to verified one, no update is pending, no failure is reported and
+ * less than FWBOOT_FULL_CHECK_PERIOD fast boots passed since last full check.
+ * Record is protected with own crc32, so erased or partly written storage
+ * always results in full check.
+ *
+ ******************************************************************************
+ */
+/* Includes ------------------------------------------------------------------*/
+#include "fw_boot_cache.h"
+#include <string.h>
+/* Private Function Prototype ------------------------------------------------*/
+static uint32_t FwBoot_Check(const uint32_t *words, uint32_t cnt);
+/* Program Code  -------------------------------------------------------------*/
+/**
+ * @brief  decide between fast boot and full image check
+ * @param  rec: last verified boot record
+ * @param  size: running image size from header
+ * @param  crc32: running image crc32 from header
+ * @param  version: running image version from header
+ * @param  events: FWBOOT_EVT_xxx collected in this boot
+ * @retval FWBOOT_FAST or reason for full check FWBOOT_FULL_xxx
+ */
+uint8_t FwBoot_Decide(const FwBootRecTypeDef *rec, uint32_t size, uint32_t crc32, uint32_t version, uint8_t events)
+{
+    if (rec->magic != FWBOOT_MAGIC) return (FWBOOT_FULL_NO_RECORD);
+    if (events & FWBOOT_EVT_HDR_INVALID) return (FWBOOT_FULL_HDR_INVALID);
+    if ((events & FWBOOT_EVT_FAIL) || (rec->flags & FWBOOT_FLAG_FAIL)) return (FWBOOT_FULL_FAIL);
+    if (events & FWBOOT_EVT_NEW_IMAGE) return (FWBOOT_FULL_NEW_IMAGE);
+    if ((rec->size != size) || (rec->crc32 != crc32) || (rec->version != version)) return (FWBOOT_FULL_HDR_CHANGED);
+    if (rec->fast_cnt >= FWBOOT_FULL_CHECK_PERIOD) return (FWBOOT_FULL_PERIODIC);
+    return (FWBOOT_FAST);
+}
+/**
+ * @brief  write record for image that passed full check
+ * @param  rec: record to write
+ * @param  size: verified image size
+ * @param  crc32: verified image crc32
+ * @param  version: verified image version
+ * @retval None
+ */
+void FwBoot_Record(FwBootRecTypeDef *rec, uint32_t size, uint32_t crc32, uint32_t version)
+{
+    rec->magic = FWBOOT_MAGIC;
+    rec->size = size;
+    rec->crc32 = crc32;
+    rec->version = version;
+    rec->fast_cnt = 0U;
+    rec->flags = 0U;
+}
+/**
+ * @brief  count one fast boot
+ * @param  rec: valid record
+ * @retval None
+ */
+void FwBoot_CountFast(FwBootRecTypeDef *rec)
+{
+    if (rec->fast_cnt < 0xFFFFU) ++rec->fast_cnt;
+}
+/**
+ * @brief  mark failure in record, every boot does full check until
+ *         FwBoot_Record is called for image that passed it
+ * @param  rec: record
+ * @retval None
+ */
+void FwBoot_Fail(FwBootRecTypeDef *rec)
+{
+    rec->flags |= FWBOOT_FLAG_FAIL;
+}
+/**
+ * @brief  clear record, next boot will do full check
+ * @param  rec: record to clear
+ * @retval None
+ */
+void FwBoot_Invalidate(FwBootRecTypeDef *rec)
+{
+    memset(rec, 0, sizeof(FwBootRecTypeDef));
+}
+/**
+ * @brief  pack record into FWBOOT_RECORD_WORDS words for persistent storage
+ * @param  rec: record
+ * @param  words: output buffer
+ * @retval None
+ */
+void FwBoot_Pack(const FwBootRecTypeDef *rec, uint32_t *words)
+{
+    words[0] = rec->magic;
+    words[1] = rec->size;
+    words[2] = rec->crc32;
+    words[3] = rec->version;
+    words[4] = ((uint32_t)rec->flags << 16) | rec->fast_cnt;
+    words[5] = FwBoot_Check(words, FWBOOT_RECORD_WORDS - 1U);
+}
+/**
+ * @brief  unpack record read from persistent storage
+ * @param  rec: output record, cleared if stored data are not valid
+ * @param  words: FWBOOT_RECORD_WORDS words read from storage
+ * @retval 0 if record valid, 1 if record cleared
+ */
+uint8_t FwBoot_Unpack(FwBootRecTypeDef *rec, const uint32_t *words)
+{
+    if ((words[0] != FWBOOT_MAGIC) || (words[5] != FwBoot_Check(words, FWBOOT_RECORD_WORDS - 1U)))
+    {
+        FwBoot_Invalidate(rec);
+        return (1U);
+    }
+    rec->magic = words[0];
+    rec->size = words[1];
+    rec->crc32 = words[2];
+    rec->version = words[3];
+    rec->fast_cnt = (uint16_t)(words[4] & 0xFFFFU);
+    rec->flags = (uint16_t)(words[4] >> 16);
+    return (0U);
+}
+/**
+ * @brief  bitwise crc32 (poly 0x04C11DB7, init 0xFFFFFFFF) over record words,
+ *         same result as stm32 crc unit, without using it
+ * @param  words: data
+ * @param  cnt: number of words
+ * @retval crc32
+ */
+static uint32_t FwBoot_Check(const uint32_t *words, uint32_t cnt)
+{
+    uint32_t crc = 0xFFFFFFFFU;
+    uint8_t  bit;
+
+    while (cnt--)
+    {
+        crc ^= *words++;
+        for (bit = 0U; bit < 32U; bit++)
+        {
+            crc = (crc & 0x80000000U) ? ((crc << 1) ^ 0x04C11DB7U) : (crc << 1);
+        }
+    }
+    return (crc);
+}
+/************************ (C) COPYRIGHT JUBERA D.O.O Sarajevo ************************/
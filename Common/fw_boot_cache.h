@@ -0,0 +1,56 @@
+/**
+ ******************************************************************************
+ * File Name          : fw_boot_cache.h
+ * Description        : verified firmware boot record header file
+ ******************************************************************************
+ *
+ * Bootloader keeps metadata of last image that passed full CRC32 check in
+ * persistent record. On next power up image header is compared with record
+ * and unchanged image is started without reading whole image again. Module
+ * only decides, record storage and CRC calculation are done by caller, so
+ * the decision can be compiled and checked on host computer.
+ *
+ ******************************************************************************
+ */
+#ifndef __FW_BOOT_CACHE_H__
+#define __FW_BOOT_CACHE_H__
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+/* Exported Define -----------------------------------------------------------*/
+#define FWBOOT_MAGIC                            0x42565246U // "FRVB" verified boot record marker
+#define FWBOOT_RECORD_WORDS                     6U          // packed record size in 32 bit words, last one is check word
+#define FWBOOT_FULL_CHECK_PERIOD                32U         // full image check after this number of fast boots
+/* record flags */
+#define FWBOOT_FLAG_FAIL                        0x0001U     // failure seen, full check until new record is written
+/* boot events collected by caller before decision */
+#define FWBOOT_EVT_HDR_INVALID                  0x01U       // running image header failed quick check
+#define FWBOOT_EVT_NEW_IMAGE                    0x02U       // valid update image waiting in staging area
+#define FWBOOT_EVT_FAIL                         0x04U       // watchdog reset or other failure since last boot
+/* decision result */
+#define FWBOOT_FAST                             0x0U        // header equal to record, start image without crc
+#define FWBOOT_FULL_NO_RECORD                   0x1U        // record missing or corrupted
+#define FWBOOT_FULL_HDR_INVALID                 0x2U        // running image header invalid
+#define FWBOOT_FULL_HDR_CHANGED                 0x3U        // running image differs from verified one
+#define FWBOOT_FULL_NEW_IMAGE                   0x4U        // update pending
+#define FWBOOT_FULL_FAIL                        0x5U        // failure flag or event
+#define FWBOOT_FULL_PERIODIC                    0x6U        // periodic full check
+/* Exported Type -------------------------------------------------------------*/
+typedef struct
+{
+    uint32_t magic;                 // FWBOOT_MAGIC if record written by bootloader
+    uint32_t size;                  // verified image size
+    uint32_t crc32;                 // verified image crc32 from image header
+    uint32_t version;               // verified image version
+    uint16_t fast_cnt;              // fast boots since last full check
+    uint16_t flags;                 // FWBOOT_FLAG_xxx
+} FwBootRecTypeDef;
+/* Exported Function  ------------------------------------------------------- */
+uint8_t FwBoot_Decide       (const FwBootRecTypeDef *rec, uint32_t size, uint32_t crc32, uint32_t version, uint8_t events);
+void    FwBoot_Record       (FwBootRecTypeDef *rec, uint32_t size, uint32_t crc32, uint32_t version);
+void    FwBoot_CountFast    (FwBootRecTypeDef *rec);
+void    FwBoot_Fail         (FwBootRecTypeDef *rec);
+void    FwBoot_Invalidate   (FwBootRecTypeDef *rec);
+void    FwBoot_Pack         (const FwBootRecTypeDef *rec, uint32_t *words);
+uint8_t FwBoot_Unpack       (FwBootRecTypeDef *rec, const uint32_t *words);
+#endif
+/************************ (C) COPYRIGHT JUBERA D.O.O Sarajevo ************************/
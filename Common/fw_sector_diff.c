@@ -0,0 +1,110 @@
+/**
+ ******************************************************************************
+ * File Name          : fw_sector_diff.c
+ * Description        : per sector firmware copy planner
+ ******************************************************************************
+ *
+ * Sector is left untouched only if image part of the sector is equal to the
+ * new image and the rest of the sector is erased, so final memory content is
+ * the same as after full erase and program of the whole image region.
+ *
+ ******************************************************************************
+ */
+/* Includes ------------------------------------------------------------------*/
+#include "fw_sector_diff.h"
+#include <string.h>
+/* Program Code  -------------------------------------------------------------*/
+/**
+ * @brief  build map of equal size sectors covering address range
+ * @param  map: output sector map
+ * @param  max: map capacity
+ * @param  addr: range start address, rounded down to sector start
+ * @param  size: range size in bytes
+ * @param  sector_size: sector size in bytes, power of two
+ * @retval number of sectors in map, 0 if range does not fit
+ */
+uint8_t FwDiff_UniformMap(FwSectorTypeDef *map, uint8_t max, uint32_t addr, uint32_t size, uint32_t sector_size)
+{
+    uint8_t  cnt = 0U;
+    uint32_t sect = addr & ~(sector_size - 1U);
+
+    if ((size == 0U) || (sector_size == 0U)) return (0U);
+    while (sect < (addr + size))
+    {
+        if (cnt >= max) return (0U);
+        map[cnt].addr = sect;
+        map[cnt].size = sector_size;
+        sect += sector_size;
+        ++cnt;
+    }
+    return (cnt);
+}
+/**
+ * @brief  check is buffer in erased state
+ * @param  buf: pointer to data
+ * @param  size: data size in bytes
+ * @retval 1 if all bytes are erased, else 0
+ */
+uint8_t FwDiff_IsErased(const uint8_t *buf, uint32_t size)
+{
+    while (size--)
+    {
+        if (*buf++ != FWDIFF_ERASED_BYTE) return (0U);
+    }
+    return (1U);
+}
+/**
+ * @brief  compare new image with destination memory and mark sectors to update
+ * @param  map: destination memory sector map, sorted by address
+ * @param  cnt: number of sectors in map
+ * @param  dst_addr: image destination address
+ * @param  dst: pointer to current destination content at dst_addr, readable
+ *         for complete sectors touched by image
+ * @param  src: pointer to new image
+ * @param  size: image size in bytes
+ * @param  unit: programming unit in bytes (4 for word programming, 256 for qspi page)
+ * @param  plan: output plan
+ * @retval 0 if plan is valid, 1 if image does not fit in sector map
+ */
+uint8_t FwDiff_Plan(const FwSectorTypeDef *map, uint8_t cnt, uint32_t dst_addr, const uint8_t *dst,
+                    const uint8_t *src, uint32_t size, uint32_t unit, FwDiffPlanTypeDef *plan)
+{
+    uint8_t  i;
+    uint32_t end = dst_addr + size;
+    uint32_t img_start, img_end, pos, len;
+    const uint8_t *sect;
+
+    memset(plan, 0, sizeof(FwDiffPlanTypeDef));
+    if ((size == 0U) || (unit == 0U) || (cnt == 0U)) return (1U);
+    /* find first and last sector touched by image */
+    for (i = 0U; (i < cnt) && ((map[i].addr + map[i].size) <= dst_addr); i++);
+    if ((i == cnt) || (map[i].addr > dst_addr)) return (1U);
+    plan->first = i;
+    for (; (i < cnt) && ((map[i].addr + map[i].size) < end); i++);
+    if (i == cnt) return (1U);
+    plan->last = i;
+    if ((uint32_t)(plan->last - plan->first) >= FWDIFF_MAX_SECTORS) return (1U);
+
+    for (i = plan->first; i <= plan->last; i++)
+    {
+        img_start = (map[i].addr > dst_addr) ? map[i].addr : dst_addr;
+        img_end = ((map[i].addr + map[i].size) < end) ? (map[i].addr + map[i].size) : end;
+        sect = dst + (int32_t)(map[i].addr - dst_addr); // first sector may start below dst_addr
+        /* sector is clean if image part is equal and the rest is erased */
+        if ((memcmp(&dst[img_start - dst_addr], &src[img_start - dst_addr], img_end - img_start) == 0)
+        &&  FwDiff_IsErased(sect, img_start - map[i].addr)
+        &&  FwDiff_IsErased(&sect[img_end - map[i].addr], (map[i].addr + map[i].size) - img_end)) continue;
+
+        plan->dirty |= (1U << (i - plan->first));
+        plan->erase_bytes += map[i].size;
+        ++plan->dirty_cnt;
+        /* after erase only units with at least one programmed bit have to be written */
+        for (pos = img_start; pos < img_end; pos += len)
+        {
+            len = ((img_end - pos) < unit) ? (img_end - pos) : unit;
+            if (!FwDiff_IsErased(&src[pos - dst_addr], len)) plan->prog_bytes += len;
+        }
+    }
+    return (0U);
+}
+/************************ (C) COPYRIGHT JUBERA D.O.O Sarajevo ************************/
@@ -0,0 +1,43 @@
+/**
+ ******************************************************************************
+ * File Name          : fw_sector_diff.h
+ * Description        : per sector firmware copy planner header file
+ ******************************************************************************
+ *
+ * Planner compares new image with current content of destination memory
+ * sector by sector and marks only sectors that must be erased and programmed.
+ * Module has no HAL dependency, so the same code is used by bootloader and
+ * can be compiled and checked on host computer with images loaded to RAM.
+ *
+ ******************************************************************************
+ */
+#ifndef __FW_SECTOR_DIFF_H__
+#define __FW_SECTOR_DIFF_H__
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+/* Exported Define -----------------------------------------------------------*/
+#define FWDIFF_MAX_SECTORS                      32U         // maximum number of sectors in one memory map (dirty mask width)
+#define FWDIFF_ERASED_BYTE                      0xFFU       // nor flash erased state
+/* Exported Type -------------------------------------------------------------*/
+typedef struct
+{
+    uint32_t addr;                  // sector start address
+    uint32_t size;                  // sector size in bytes
+} FwSectorTypeDef;
+
+typedef struct
+{
+    uint32_t dirty;                 // bit n set: sector first + n has to be erased and programmed
+    uint32_t erase_bytes;           // total size of dirty sectors
+    uint32_t prog_bytes;            // bytes programmed into dirty sectors (erased program units are skipped)
+    uint8_t  first;                 // index of first sector in map touched by image
+    uint8_t  last;                  // index of last sector in map touched by image
+    uint8_t  dirty_cnt;             // number of dirty sectors
+} FwDiffPlanTypeDef;
+/* Exported Function  ------------------------------------------------------- */
+uint8_t FwDiff_UniformMap   (FwSectorTypeDef *map, uint8_t max, uint32_t addr, uint32_t size, uint32_t sector_size);
+uint8_t FwDiff_Plan         (const FwSectorTypeDef *map, uint8_t cnt, uint32_t dst_addr, const uint8_t *dst,
+                             const uint8_t *src, uint32_t size, uint32_t unit, FwDiffPlanTypeDef *plan);
+uint8_t FwDiff_IsErased     (const uint8_t *buf, uint32_t size);
+#endif
+/************************ (C) COPYRIGHT JUBERA D.O.O Sarajevo ************************/
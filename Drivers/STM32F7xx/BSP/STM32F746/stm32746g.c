@@ -170,14 +170,7 @@ static HAL_StatusTypeDef I2Cx_ReadMultiple(I2C_HandleTypeDef *hi2c,uint8_t Addr,
     {
         /* Re-Initiaize the I2C Bus */
         if      (hi2c->Instance == I2C4) I2Cx_Error();
-        else if (hi2c->Instance == I2C3)  
-        {
-            __HAL_RCC_I2C3_CLK_DISABLE();
-            HAL_GPIO_DeInit(GPIOA, GPIO_PIN_8);
-            HAL_GPIO_DeInit(GPIOC, GPIO_PIN_9);
-            HAL_I2C_DeInit(&hi2c3);
-            TS_IO_Init();
-        }
+        else if (hi2c->Instance == I2C3) TS_IO_Error();
     }
     return status;    
 }
@@ -203,14 +196,7 @@ static HAL_StatusTypeDef I2Cx_WriteMultiple(I2C_HandleTypeDef *hi2c,uint8_t Addr
     {
         /* Re-Initiaize the I2C Bus */
         if      (hi2c->Instance == I2C4) I2Cx_Error();
-        else if (hi2c->Instance == I2C3)  
-        {
-            __HAL_RCC_I2C3_CLK_DISABLE();
-            HAL_GPIO_DeInit(GPIOA, GPIO_PIN_8);
-            HAL_GPIO_DeInit(GPIOC, GPIO_PIN_9);
-            HAL_I2C_DeInit(&hi2c3);
-            TS_IO_Init();
-        }
+        else if (hi2c->Instance == I2C3) TS_IO_Error();
     }
     return status;
 }
@@ -352,9 +338,28 @@ void TS_IO_Init(void)
         __HAL_RCC_I2C3_RELEASE_RESET();
         
         HAL_I2C_Init(&hi2c3);
+
+        /* Touch data is read in interrupt mode (TS_IO_ReadMultipleIT) */
+        HAL_NVIC_SetPriority(I2C3_EV_IRQn, 0x0F, 0);
+        HAL_NVIC_EnableIRQ(I2C3_EV_IRQn);
+        HAL_NVIC_SetPriority(I2C3_ER_IRQn, 0x0F, 0);
+        HAL_NVIC_EnableIRQ(I2C3_ER_IRQn);
     }
 }
 
+/**
+  * @brief  Re-initializes the touchscreen I2C bus after an error.
+  * @retval None
+  */
+void TS_IO_Error(void)
+{
+    __HAL_RCC_I2C3_CLK_DISABLE();
+    HAL_GPIO_DeInit(GPIOA, GPIO_PIN_8);
+    HAL_GPIO_DeInit(GPIOC, GPIO_PIN_9);
+    HAL_I2C_DeInit(&hi2c3);
+    TS_IO_Init();
+}
+
 /**
   * @brief  Writes a single data.
   * @param  Addr: I2C address
@@ -381,6 +386,21 @@ uint8_t TS_IO_Read(uint8_t Addr, uint8_t Reg)
     return read_value;
 }
 
+/**
+  * @brief  Starts a non-blocking read of consecutive registers.
+  * @note   Completion is signalled by HAL_I2C_MemRxCpltCallback or
+  *         HAL_I2C_ErrorCallback for hi2c3.
+  * @param  Addr: I2C address
+  * @param  Reg: First register address
+  * @param  Buffer: Pointer to data buffer, valid until the transfer ends
+  * @param  Length: Number of registers to read
+  * @retval HAL status
+  */
+HAL_StatusTypeDef TS_IO_ReadMultipleIT(uint8_t Addr, uint8_t Reg, uint8_t *Buffer, uint16_t Length)
+{
+    return HAL_I2C_Mem_Read_IT(&hi2c3, Addr, Reg, I2C_MEMADD_SIZE_8BIT, Buffer, Length);
+}
+
 /**
   * @brief  TS delay
   * @param  Delay: Delay in ms
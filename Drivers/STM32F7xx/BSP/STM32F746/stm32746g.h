@@ -74,6 +74,8 @@ void            TS_IO_Init(void);
 void            TS_IO_Write(uint8_t Addr, uint8_t Reg, uint8_t Value);
 uint8_t         TS_IO_Read(uint8_t Addr, uint8_t Reg);
 void            TS_IO_Delay(uint32_t Delay);
+void            TS_IO_Error(void);
+HAL_StatusTypeDef TS_IO_ReadMultipleIT(uint8_t Addr, uint8_t Reg, uint8_t *Buffer, uint16_t Length);
 
 /* I2C EEPROM IO function */
 void                EE_IO_Init(void);
@@ -54,6 +54,7 @@
 #define EE_TFIFA			                0x04	// 1 bajt:  Adresa uredaja na RS485 busu (TinyFrame).
 #define EE_SYSID			                0x05	// 2 bajta: Jedinstveni ID sistema.
 #define EE_SYSTEM_PIN                       0x08    // 5 bajtova: Sistemski PIN kod (npr. "1234\0")
+#define EE_REMOTE_VIEW                      0x10    // 1 bajt:  Dozvola daljinskog pregleda ekrana (0x5A = dozvoljen).
 /**
  * @brief  Sekcija 2: Struktuirani Blokovi Podataka
  * @note   Ovo je glavni dio konfiguracije. Svaki modul ima svoj blok podataka
@@ -82,6 +83,7 @@
  */
 #define EE_QR_CODE1                         0x400       // Rezervisano 64 bajta za WiFi QR kod.
 #define EE_QR_CODE2                         0x440       // Rezervisano 64 bajta za App QR kod.
+#define EE_FW_RESUME                        0x500       // Rezervisano 512 bajta za stanje prekinutog FW transfera.
 
 
 /* Link function for I2C EEPROM peripheral */
@@ -77,6 +77,7 @@ EndDependencies */
 #include "main.h"
 #include "stm32746g.h"
 #include "stm32746g_qspi.h"
+#include "fw_sector_diff.h"
 /* Private variables ---------------------------------------------------------*/
 /** @defgroup STM32746G_DISCOVERY_QSPI_Private_Variables STM32746G_DISCOVERY QSPI Private Variables
   * @{
@@ -84,6 +85,19 @@ EndDependencies */
 static QSPI_CommandTypeDef sCommand;
 static QSPI_AutoPollingTypeDef sConfig;
 static uint8_t MemMapModeState;
+/* internal flash sector map used by per sector image copy */
+static const FwSectorTypeDef FlashSectorMap[] =
+{
+    {RT_ADDR_FLSECT_0, RT_ADDR_FLSECT_1 - RT_ADDR_FLSECT_0},
+    {RT_ADDR_FLSECT_1, RT_ADDR_FLSECT_2 - RT_ADDR_FLSECT_1},
+    {RT_ADDR_FLSECT_2, RT_ADDR_FLSECT_3 - RT_ADDR_FLSECT_2},
+    {RT_ADDR_FLSECT_3, RT_ADDR_FLSECT_4 - RT_ADDR_FLSECT_3},
+    {RT_ADDR_FLSECT_4, RT_ADDR_FLSECT_5 - RT_ADDR_FLSECT_4},
+    {RT_ADDR_FLSECT_5, RT_ADDR_FLSECT_6 - RT_ADDR_FLSECT_5},
+    {RT_ADDR_FLSECT_6, RT_ADDR_FLSECT_7 - RT_ADDR_FLSECT_6},
+    {RT_ADDR_FLSECT_7, FLASH_END_ADDR   - RT_ADDR_FLSECT_7},
+};
+#define FLASH_SECTOR_MAP_SIZE   (sizeof(FlashSectorMap) / sizeof(FlashSectorMap[0]))
 
 
 /* Private functions ---------------------------------------------------------*/
@@ -97,6 +111,7 @@ static uint8_t FLASH_GetSector      (uint32_t addr);
 static uint8_t QSPI_EraseSector     (uint32_t staddr);
 static uint8_t QSPI_AutoPollMemRdy  (uint32_t Timeout);
 static uint8_t QSPI_WritePage       (uint32_t addr, uint32_t size, uint8_t *buff);
+static void QSPI_InvalidateDCache   (uint32_t addr, uint32_t size);
 
 
 /** @defgroup STM32746G_DISCOVERY_QSPI_Exported_Functions STM32746G_DISCOVERY QSPI Exported Functions
@@ -375,29 +390,46 @@ uint8_t QSPI_MemMapMode(void)
 }
 /**
   * @} if this function fail, qspi interface will stay in indirect mode
+  *    qspi flash has to be in memory mapped mode when function is called, so
+  *    old content of destination can be compared with source. only 64kB 
+  *    sectors that differ are erased and only pages that are not blank written
   */
 uint8_t FLASH2QSPI_Copy (uint32_t rdaddr, uint32_t wraddr, uint32_t size)
 {
     uint8_t  buff[QSPI_PAGE_SIZE];
-    uint32_t bcnt           = 0U;
-    uint32_t scnt           = size;
-    uint32_t FirstLoadAddr  = rdaddr;
-    uint32_t FirstWriteAddr = wraddr;
-    uint32_t LastWriteAddr  = wraddr + size;
+    uint8_t  sect, scnt;
+    uint32_t bcnt, pos, end;
+    FwSectorTypeDef map[FWDIFF_MAX_SECTORS];
+    FwDiffPlanTypeDef plan;
+    
+    scnt = FwDiff_UniformMap(map, FWDIFF_MAX_SECTORS, wraddr, size, N25Q128A_SECTOR_SIZE);
+    QSPI_InvalidateDCache(wraddr, size); // planner reads destination, drop lines cached before last indirect write
+    if (FwDiff_Plan(map, scnt, wraddr, (uint8_t*)wraddr, (uint8_t*)rdaddr, size, QSPI_PAGE_SIZE, &plan) != 0x0U) return (QSPI_ERROR);
     MX_QSPI_Init(); // set qspi interface for indirect r/w access
-	if (QSPI_Erase(FirstWriteAddr, LastWriteAddr) != QSPI_OK) return (QSPI_ERROR); 
-	while(scnt)                                             // erase space for new file
-	{                                                       // copy data from mcu flash external qspi flash
-		if (scnt >= QSPI_PAGE_SIZE) bcnt = QSPI_PAGE_SIZE;  // set page size to maximum 256 bytes for single page write
-		else bcnt = scnt;                                   // or set to last buffer remaing size to finish last cycle 
-        memcpy(buff, (uint8_t*)FirstLoadAddr, bcnt);        // copy from mcu flash data source to temp buffer for exchange
-        if (QSPI_Write (buff, FirstWriteAddr, bcnt) != QSPI_OK) return (QSPI_ERROR); // and write from temp buffer to qspi flash
-        FirstWriteAddr += bcnt; // increase addresse for read and write data 
-        FirstLoadAddr += bcnt;  // counters to prepare next cycle
-        scnt -= bcnt;   // and decrease for total data counter
-	}                   // till now everything ok!  
+    for (sect = plan.first; sect <= plan.last; sect++)
+    {
+        if ((plan.dirty & (1UL << (sect - plan.first))) == 0x0U) continue; // sector already holds same data
+        if (QSPI_EraseSector(map[sect].addr) != QSPI_OK) return (QSPI_ERROR);
+        pos = (map[sect].addr > wraddr) ? map[sect].addr : wraddr;          // copy only image part of sector
+        end = ((map[sect].addr + map[sect].size) < (wraddr + size)) ? (map[sect].addr + map[sect].size) : (wraddr + size);
+        while (pos < end)
+        {
+            bcnt = ((end - pos) >= QSPI_PAGE_SIZE) ? QSPI_PAGE_SIZE : (end - pos);
+            memcpy(buff, (uint8_t*)(rdaddr + (pos - wraddr)), bcnt);        // copy from mcu flash data source to temp buffer
+            if (!FwDiff_IsErased(buff, bcnt))                               // blank page is already erased, skip write
+            {
+                if (QSPI_Write (buff, pos, bcnt) != QSPI_OK) return (QSPI_ERROR);
+            }
+            pos += bcnt;
+        }
+        QSPI_InvalidateDCache(map[sect].addr, map[sect].size);              // erased and programmed behind the cache
+#ifdef	USE_WATCHDOG
+        HAL_IWDG_Refresh(&hiwdg);
+#endif  
+    }
     MX_QSPI_Init();     // after write process succesfully finished set qspi 
     QSPI_MemMapMode();  // flash to memory mapped fast read mode and perform data check
+    QSPI_InvalidateDCache(wraddr, size);
     scnt = memcmp((uint8_t*)rdaddr, (uint8_t*)wraddr, size); // use trusty c function for comparision
     if (scnt != 0x00U) return (QSPI_ERROR); // if there is data difference send error to calling process
     return (QSPI_OK);   // to try again or to select different source, also return copy success flag
@@ -427,31 +459,54 @@ uint8_t QSPI2QSPI_Copy  (uint32_t rdaddr, uint32_t wraddr, uint32_t size)
 	}                   // till now everything ok!  
     MX_QSPI_Init();     // after write process succesfully finished set qspi flash to memory mapped 
     QSPI_MemMapMode();  // mode for fast read to perform data check with another c libraries old timer
+    QSPI_InvalidateDCache(wraddr, size);
     scnt = memcmp((uint8_t*)rdaddr, (uint8_t*)wraddr, size); // use trusty c function for comparision
     if (scnt != 0x00U) return (QSPI_ERROR); // if there is data difference send error to calling process
     return (QSPI_OK);   // to try again or to select different source, also return copy success flag
 }
 /**
-  * @}
+  * @}  qspi flash has to be in memory mapped mode. only internal flash sectors
+  *     that differ from new image are erased, and only words that are not
+  *     blank are programmed. word programming (x32) is the widest parallelism
+  *     available with voltage range 3 and without external vpp
   */
 uint8_t QSPI2FLASH_Copy (uint32_t rdaddr, uint32_t wraddr, uint32_t size)
 {
-    uint32_t bcnt               = 0U;
+    uint8_t  sect;
+    uint32_t bcnt, end, data;
     uint32_t stat               = 0U;
+    FwDiffPlanTypeDef             plan;
     FLASH_EraseInitTypeDef        FLASH_EraseInit;
+    
+    QSPI_InvalidateDCache(rdaddr, size); // source may be just written in indirect mode
+    QSPI_InvalidateDCache(wraddr, size); // and planner reads destination through the cache
+    if (FwDiff_Plan(FlashSectorMap, FLASH_SECTOR_MAP_SIZE, wraddr, (uint8_t*)wraddr, (uint8_t*)rdaddr, size, 4U, &plan) != 0x0U) return (QSPI_ERROR);
     FLASH_EraseInit.TypeErase   = FLASH_TYPEERASE_SECTORS;
     FLASH_EraseInit.VoltageRange= FLASH_VOLTAGE_RANGE_3;
-    FLASH_EraseInit.Sector      = FLASH_GetSector(wraddr);
-    FLASH_EraseInit.NbSectors   = FLASH_GetSector(wraddr + size) - FLASH_EraseInit.Sector + 1U;  
+    FLASH_EraseInit.NbSectors   = 1U;
     /* Unlock the Flash to enable the flash control register access *************/
-    HAL_FLASH_Unlock(); // unlock flash conotroll register for access and erase memory space for data write to follow. if error occured
-    if (HAL_FLASHEx_Erase (&FLASH_EraseInit, &stat) != HAL_OK) return (uint8_t)(stat & 0xFFU); // durring errase, return sector number
-    while (bcnt < size) // if errase process passed ok, copy 32 bit word data from qspi flas to mcu flash one by one 
-    {   // and if process fail send error flag to caller function. Error during bootloader update need recovery action to involve  
-        if(HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD,(wraddr+bcnt),*(__IO uint32_t*)(rdaddr+bcnt))!=HAL_OK)return(QSPI_ERROR);
-        bcnt += 4U; // address is increased by 4 because of 32 bit = 4 byte data access
+    HAL_FLASH_Unlock(); // unlock flash conotroll register for access and erase only sectors with changed data
+    for (sect = plan.first; sect <= plan.last; sect++)
+    {
+        if ((plan.dirty & (1UL << (sect - plan.first))) == 0x0U) continue; // sector already holds same data
+        FLASH_EraseInit.Sector = FLASH_GetSector(FlashSectorMap[sect].addr);
+        if (HAL_FLASHEx_Erase (&FLASH_EraseInit, &stat) != HAL_OK) return (uint8_t)(stat & 0xFFU); // durring errase, return sector number
+        bcnt = (FlashSectorMap[sect].addr > wraddr) ? (FlashSectorMap[sect].addr - wraddr) : 0U;
+        end  = (FlashSectorMap[sect].addr + FlashSectorMap[sect].size) - wraddr;
+        if (end > size) end = size;
+        while (bcnt < end) // copy 32 bit word data from qspi flash to mcu flash one by one, blank words stay erased
+        {   // and if process fail send error flag to caller function. Error during bootloader update need recovery action to involve  
+            data = *(__IO uint32_t*)(rdaddr + bcnt);
+            if ((data != 0xFFFFFFFFU) && (HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, (wraddr + bcnt), data) != HAL_OK)) return (QSPI_ERROR);
+            bcnt += 4U; // address is increased by 4 because of 32 bit = 4 byte data access
+        }
+        QSPI_InvalidateDCache(FlashSectorMap[sect].addr, FlashSectorMap[sect].size); // erased and programmed behind the cache
+#ifdef	USE_WATCHDOG
+        HAL_IWDG_Refresh(&hiwdg);
+#endif  
     } // After copy loop succesfully finished, lock the Flash to disable the flash control register access
     HAL_FLASH_Lock(); // to protect the FLASH memory against possible unwanted operation)
+    QSPI_InvalidateDCache(wraddr, size);
     stat = memcmp((uint8_t*)rdaddr, (uint8_t*)wraddr, size); // finaly, compare two memory data for possible error
     if (stat != 0x0U) return (QSPI_ERROR); // if there is data difference send error to calling process
     return (QSPI_OK); // to try again or to select different source, also return copy success flag
@@ -846,12 +901,48 @@ static uint8_t FLASH_GetSector(uint32_t addr)
     else if ((addr < FLASH_END_ADDR)   && (addr >= RT_ADDR_FLSECT_7)) return (uint8_t)(FLASH_SECTOR_7 & 0xFFU);
     return  (0xFFU);
 }
+/**
+  * @brief  Invalidates D-cache lines of a flash range erased or programmed
+  *         through the controller, so the next CPU read comes from memory.
+  *         Range is widened to whole 32 byte lines; flash lines are never
+  *         dirty, so nothing is lost.
+  * @param  addr: start address of the range
+  * @param  size: range size in bytes
+  * @retval None
+  */
+static void QSPI_InvalidateDCache(uint32_t addr, uint32_t size)
+{
+    uint32_t start = addr & ~0x1FU;
+    SCB_InvalidateDCache_by_Addr((uint32_t*)start, (int32_t)((addr + size) - start));
+}
 /**
   * @brief  Erases the specified block of the QSPI memory. 
   * @param  BlockAddress: Block address to erase  
   * @retval QSPI memory status
   */
 static uint8_t QSPI_EraseSector (uint32_t staddr)
+{
+    if (QSPI_EraseSectorStart(staddr) != QSPI_OK)
+    {
+        return QSPI_ERROR;
+    }
+
+    /* Configure automatic polling mode to wait for end of erase */  
+    if (QSPI_AutoPollMemRdy(N25Q128A_SECTOR_ERASE_MAX_TIME) != QSPI_OK)
+    {
+        return QSPI_ERROR;
+    }
+
+    return QSPI_OK;
+}
+/**
+  * @brief  Starts the erase of the specified block and returns without waiting
+  *         for the end of erase. Completion is polled with QSPI_GetStatus(),
+  *         which returns QSPI_BUSY while the erase is in progress.
+  * @param  staddr: Block address to erase
+  * @retval QSPI memory status
+  */
+uint8_t QSPI_EraseSectorStart(uint32_t staddr)
 {
     QSPI_CommandTypeDef s_command;
 
@@ -880,12 +971,6 @@ static uint8_t QSPI_EraseSector (uint32_t staddr)
         return QSPI_ERROR;
     }
 
-    /* Configure automatic polling mode to wait for end of erase */  
-    if (QSPI_AutoPollMemRdy(N25Q128A_SECTOR_ERASE_MAX_TIME) != QSPI_OK)
-    {
-        return QSPI_ERROR;
-    }
-
     return QSPI_OK;
 }
 /**
@@ -101,6 +101,7 @@ uint8_t QSPI_MemMapMode (void);
 uint8_t QSPI_GetStatus  (void);
 uint8_t QSPI_EraseChip  (uint32_t staddr);
 uint8_t QSPI_Erase      (uint32_t staddr, uint32_t enaddr);
+uint8_t QSPI_EraseSectorStart(uint32_t staddr);
 uint8_t QSPI_Read       (uint8_t   *pbuf, uint32_t rdaddr, uint32_t size);
 uint8_t QSPI_Write      (uint8_t   *pbuf, uint32_t wraddr, uint32_t size);
 uint8_t FLASH2QSPI_Copy (uint32_t rdaddr, uint32_t wraddr, uint32_t size);
@@ -166,21 +166,24 @@ uint8_t TS_Init(void)
 		return(TS_DEVICE_NOT_FOUND);
 	}
 
-//	GPIO_InitTypeDef gpio_init_structure;
+#if (TS_INT_ENABLED == 1)
+	GPIO_InitTypeDef gpio_init_structure;
 
-//	/* Configure Interrupt mode for SD detection pin */
-//	gpio_init_structure.Pin = TS_INT_PIN;
-//	gpio_init_structure.Pull = GPIO_PULLUP;
-//	gpio_init_structure.Speed = GPIO_SPEED_FREQ_LOW;
-//	gpio_init_structure.Mode = GPIO_MODE_IT_FALLING;
-//	HAL_GPIO_Init(TS_INT_GPIO_PORT, &gpio_init_structure);
+	/* Configure Interrupt mode for touch controller INT pin */
+	TS_INT_GPIO_CLK_ENABLE();
+	gpio_init_structure.Pin = TS_INT_PIN;
+	gpio_init_structure.Pull = GPIO_PULLUP;
+	gpio_init_structure.Speed = GPIO_SPEED_FREQ_LOW;
+	gpio_init_structure.Mode = GPIO_MODE_IT_FALLING;
+	HAL_GPIO_Init(TS_INT_GPIO_PORT, &gpio_init_structure);
 
-//	/* Enable and set Touch screen EXTI Interrupt to the lowest priority */
-//	HAL_NVIC_SetPriority((IRQn_Type)(TS_INT_EXTI_IRQn), 0x0F, 0x00);
-//	HAL_NVIC_EnableIRQ((IRQn_Type)(TS_INT_EXTI_IRQn));
+	/* Enable and set Touch screen EXTI Interrupt to the lowest priority */
+	HAL_NVIC_SetPriority((IRQn_Type)(TS_INT_EXTI_IRQn), 0x0F, 0x00);
+	HAL_NVIC_EnableIRQ((IRQn_Type)(TS_INT_EXTI_IRQn));
 
-//	/* Enable the TS ITs */
-//	tsDriver->EnableIT(I2cAddress);
+	/* Enable the TS ITs: INT pulses once per report while touched */
+	tsDriver->EnableIT(I2cAddress);
+#endif
 
 	return TS_OK;  
 }
@@ -197,6 +200,19 @@ uint8_t BSP_TS_DeInit(void)
 
 
 
+/**
+  * @brief  Starts a non-blocking read of the touch status and first
+  *         touch coordinates, starting at TS_REGS_FIRST.
+  * @param  Regs: Destination buffer, valid until the transfer ends
+  * @param  Count: Number of registers to read
+  * @retval TS_OK if the transfer started, TS_ERROR otherwise.
+  */
+uint8_t BSP_TS_ReadRegsIT(uint8_t *Regs, uint16_t Count)
+{
+  if (tsDriver == NULL) return TS_ERROR;
+  return (TS_IO_ReadMultipleIT(I2cAddress, TS_REGS_FIRST, Regs, Count) == HAL_OK) ? TS_OK : TS_ERROR;
+}
+
 /**
   * @brief  Gets the touch screen interrupt status.
   * @retval TS_OK if all initializations are OK. Other value if error.
@@ -75,6 +75,26 @@
 #define TS_SWAP_Y                       ((uint8_t) 0x04)
 #define TS_SWAP_XY                      ((uint8_t) 0x08)
 
+/** @brief Reads are started by the FT5336 INT line (1) or polled by the
+  *        application (0). The INT pin below is not confirmed against the
+  *        board schematic yet; keep polling until it is.
+  */
+#ifndef TS_INT_ENABLED
+#define TS_INT_ENABLED                    0
+#endif
+
+/** @brief Touch controller interrupt line (FT5336 INT, active low)
+  */
+#define TS_INT_PIN                        GPIO_PIN_13
+#define TS_INT_GPIO_PORT                  GPIOG
+#define TS_INT_GPIO_CLK_ENABLE()          __HAL_RCC_GPIOG_CLK_ENABLE()
+#define TS_INT_EXTI_IRQn                  EXTI15_10_IRQn
+#define TS_IntIRQHandler()                HAL_GPIO_EXTI_IRQHandler(TS_INT_PIN)
+
+/** @brief First register of the block read by BSP_TS_ReadRegsIT (TD_STAT)
+  */
+#define TS_REGS_FIRST                     FT5336_TD_STAT_REG
+
 /**
   * @}
   */
@@ -177,6 +197,7 @@ extern char * ts_gesture_id_string_tab[GEST_ID_NB_MAX];
 uint8_t TS_Init(void);
 uint8_t BSP_TS_DeInit(void);
 uint8_t BSP_TS_GetState(TS_StateTypeDef *TS_State);
+uint8_t BSP_TS_ReadRegsIT(uint8_t *Regs, uint16_t Count);
 
 #if (TS_MULTI_TOUCH_SUPPORTED == 1)
 uint8_t BSP_TS_Get_GestureId(TS_StateTypeDef *TS_State);
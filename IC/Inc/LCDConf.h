@@ -63,7 +63,33 @@ typedef struct
 }
 LCD_LayerPropTypedef;
 
+/* Draw method of compact icons (pData points to IconImage_t, see icon_codec.h) */
+extern const GUI_BITMAP_METHODS LCD_IconMethods;
+#define GUI_DRAW_ICON   &LCD_IconMethods
+/* Opacity of compact icons drawn after the call (0xFF = icon alpha only) */
+void LCD_SetIconAlpha(U8 Alpha);
+
 void LCD_LL_DeInit(void);
+void LCD_DMA2D_IRQHandler(void);
+/* Vsync pacing of GUI_Exec: line events since start, buffer waiting for the next one */
+U32 LCD_GetVsyncCount(void);
+int LCD_IsBufferPending(void);
+/* Frame profiling: buffer flips and their DWT time, DWT cycles with DMA2D busy, DMA2D jobs ended by error */
+U32 LCD_GetFlipCount(void);
+U32 LCD_GetFlipTime(void);
+U32 LCD_GetDma2dBusyCycles(void);
+U32 LCD_GetDma2dErrors(void);
+/* Bytes copied per frame by partial multibuffer synchronisation, one line per layer */
+U32 LCD_GetBufferSyncReport(char * pBuf, U32 Size);
+/* Glyph cache of the GUI_FONTTYPE_PROP_AAx_CACHED fonts (see Resource.h) */
+U32 LCD_GlyphPreload(const GUI_FONT * pFont, const char * sText);
+U32 LCD_GetGlyphCacheReport(char * pBuf, U32 Size);
+/* SDRAM areas for the memory budget report (mem_budget.h): base address, size in *pSize */
+U32 LCD_GetFrameBufferArea(U32 * pSize);
+U32 LCD_GetGlyphPoolArea(U32 * pSize);
+U32 GUIConf_GetHeapArea(U32 * pSize);   /* GUIConf.c */
+/* Address of the buffer of a layer currently shown by the LTDC (remote view) */
+U32 LCD_GetShownBuffer(int LayerIndex);
 
 #endif /* LCDCONF_H */
 
@@ -10,38 +10,36 @@ Content     : Main resource header file of weather forecast demo
 
 #include <stdlib.h>
 #include "GUI.h"
+#include "anim_codec.h"
 
 #ifndef GUI_CONST_STORAGE
   #define GUI_CONST_STORAGE const
 #endif
+
+/* Antialiased fonts drawn through the SDRAM glyph cache (LCDConf.c) */
+void LCD_GlyphDispChar(U16 c);
+#define GUI_FONTTYPE_PROP_AA2_CACHED  \
+  LCD_GlyphDispChar,                  \
+  GUIPROP_AA2_GetCharDistX,           \
+  GUIPROP_AA2_GetFontInfo,            \
+  GUIPROP_AA2_IsInFont,               \
+  (GUI_GETCHARINFO *)0,               \
+  (tGUI_ENC_APIList*)0
+#define GUI_FONTTYPE_PROP_AA4_CACHED  \
+  LCD_GlyphDispChar,                  \
+  GUIPROP_AA4_GetCharDistX,           \
+  GUIPROP_AA4_GetFontInfo,            \
+  GUIPROP_AA4_IsInFont,               \
+  (GUI_GETCHARINFO *)0,               \
+  (tGUI_ENC_APIList*)0
+
 extern GUI_CONST_STORAGE GUI_FONT GUI_FontVerdana16_LAT;
 extern GUI_CONST_STORAGE GUI_FONT GUI_FontVerdana20_LAT;
 extern GUI_CONST_STORAGE GUI_FONT GUI_FontVerdana32_LAT;
   
-extern GUI_CONST_STORAGE GUI_BITMAP bmanimation_candle_frame_1;
-extern GUI_CONST_STORAGE GUI_BITMAP bmanimation_candle_frame_2;
-extern GUI_CONST_STORAGE GUI_BITMAP bmanimation_candle_frame_3;
-extern GUI_CONST_STORAGE GUI_BITMAP bmanimation_candle_frame_4;
-extern GUI_CONST_STORAGE GUI_BITMAP bmanimation_welcome_frame_05;
-extern GUI_CONST_STORAGE GUI_BITMAP bmanimation_welcome_frame_10;
-extern GUI_CONST_STORAGE GUI_BITMAP bmanimation_welcome_frame_15;
-extern GUI_CONST_STORAGE GUI_BITMAP bmanimation_welcome_frame_20;
-extern GUI_CONST_STORAGE GUI_BITMAP bmanimation_welcome_frame_25;
-extern GUI_CONST_STORAGE GUI_BITMAP bmanimation_welcome_frame_30;
-extern GUI_CONST_STORAGE GUI_BITMAP bmanimation_welcome_frame_35;
-extern GUI_CONST_STORAGE GUI_BITMAP bmanimation_welcome_frame_40;
-extern GUI_CONST_STORAGE GUI_BITMAP bmanimation_welcome_frame_45;
-extern GUI_CONST_STORAGE GUI_BITMAP bmanimation_welcome_frame_50;
-extern GUI_CONST_STORAGE GUI_BITMAP bmanimation_welcome_frame_55;
-extern GUI_CONST_STORAGE GUI_BITMAP bmanimation_welcome_frame_60;
-extern GUI_CONST_STORAGE GUI_BITMAP bmanimation_welcome_frame_65;
-extern GUI_CONST_STORAGE GUI_BITMAP bmanimation_welcome_frame_70;
-extern GUI_CONST_STORAGE GUI_BITMAP bmanimation_welcome_frame_75;
-extern GUI_CONST_STORAGE GUI_BITMAP bmanimation_welcome_frame_80;
-extern GUI_CONST_STORAGE GUI_BITMAP bmanimation_welcome_frame_85;
-extern GUI_CONST_STORAGE GUI_BITMAP bmanimation_welcome_frame_90;
-extern GUI_CONST_STORAGE GUI_BITMAP bmanimation_welcome_frame_95;
-extern GUI_CONST_STORAGE GUI_BITMAP bmanimation_welcome_frame_100;
+/* Clips generated by Tools/animconv from IC/Src/Display/animation_*_frame_*.c */
+extern GUI_CONST_STORAGE AnimClip_t anim_welcome;
+extern GUI_CONST_STORAGE AnimClip_t anim_candle;
 extern GUI_CONST_STORAGE GUI_BITMAP bmanimation_welcome_frame_final;
     
 extern GUI_CONST_STORAGE GUI_BITMAP bmicons_lights_ceiling_led_fixture_off;
@@ -0,0 +1,154 @@
+/**
+ ******************************************************************************
+ * @file    anim_codec.h
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Animacije kao ključni frejm + promijenjeni pravougaonici.
+ *
+ * @note    Animacija dobrodošlice je bila 20 nezavisnih ARGB8888 slika
+ * 300x114 (po 137 KB u QSPI-ju), a plamen svijeće još 4, i svaki frejm
+ * se crtao cijeli. Alat `Tools/animconv` od niza frejmova pravi klip:
+ * - ključni frejm (prvi frejm, cijeli),
+ * - po frejmu listu pravougaonika (`AnimPatch_t`) u kojima se razlikuje
+ *   od prethodnog; frejm 0 nosi razliku zadnji -> prvi, za ponavljanje.
+ * Pikseli pravougaonika su `IconImage_t` (icon_codec.h), pa se crtaju
+ * postojećom `GUI_DRAW_ICON` metodom direktno iz QSPI-ja. Pravougaonik
+ * nosi cijele piksele frejma, pa ga pozivalac crta preko pozadine klipa,
+ * isto kao i cijeli frejm.
+ *
+ * Pravougaonik čiji pikseli imaju istu alfu čuva se kao neprovidna slika
+ * ("sprite") i providnost pravougaonika (`alpha`), a iste slike dijele svi
+ * pravougaonici. Tako je cijela animacija dobrodošlice (ista slika sa
+ * alfom 5%..100%) jedna slika i 20 vrijednosti providnosti. Alfa piksela
+ * pri crtanju je `(a * alpha + 127) / 255`, što je za neprovidne piksele
+ * tačno `alpha`; DMA2D to radi množenjem alfe (`LCD_SetIconAlpha()`).
+ *
+ * `AnimPlayer_t` pušta klip fiksnim tempom bez čekanja: `AnimPlayer_Step()`
+ * iscrta frejmove koji su na redu po vremenu i odmah se vraća. Dekodiranje
+ * u ARGB8888 platno (`AnimCodec_ApplyFrame()`) koristi konverter na hostu
+ * za provjeru da je svaki frejm tačan do piksela.
+ ******************************************************************************
+ */
+
+#ifndef __ANIM_CODEC_H__
+#define __ANIM_CODEC_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "icon_codec.h"
+
+/*============================================================================*/
+/* JAVNE DEFINICIJE I STRUKTURE                                               */
+/*============================================================================*/
+
+/**
+ * @brief Promijenjeni pravougaonik frejma.
+ */
+typedef struct
+{
+    uint16_t           x;       /**< Položaj u klipu. */
+    uint16_t           y;
+    uint8_t            alpha;   /**< Providnost pravougaonika (0xFF = alfa piksela). */
+    const IconImage_t *image;   /**< Pikseli frejma unutar pravougaonika. */
+} AnimPatch_t;
+
+/**
+ * @brief Pravougaonici jednog frejma u `AnimClip_t::patches`.
+ */
+typedef struct
+{
+    uint16_t first;             /**< Indeks prvog pravougaonika. */
+    uint16_t count;             /**< Broj pravougaonika (0 = frejm isti kao prethodni). */
+} AnimFrame_t;
+
+/**
+ * @brief Klip animacije.
+ */
+typedef struct
+{
+    uint16_t           width;       /**< Širina klipa. */
+    uint16_t           height;      /**< Visina klipa. */
+    uint16_t           frame_count; /**< Broj frejmova. */
+    uint16_t           frame_ms;    /**< Trajanje frejma u ms. */
+    AnimPatch_t        keyframe;    /**< Prvi frejm, cijeli. */
+    const AnimFrame_t *frames;      /**< Razlika prema prethodnom frejmu; `frames[0]`: zadnji -> prvi. */
+    const AnimPatch_t *patches;     /**< Svi pravougaonici, redom po frejmovima. */
+    uint16_t           patch_count; /**< Broj pravougaonika. */
+} AnimClip_t;
+
+/**
+ * @brief Crtanje pravougaonika na ekranu.
+ * @note  `draw` obriše pozadinu pravougaonika `image` na (x, y) i nacrta ga
+ * sa providnošću `alpha`; `x`/`y` su koordinate ekrana (položaj klipa +
+ * položaj pravougaonika).
+ * `frame` se poziva nakon svih pravougaonika jednog koraka (npr. kraj
+ * višestrukog baferovanja).
+ */
+typedef struct
+{
+    void (*draw)(const IconImage_t *image, int16_t x, int16_t y, uint8_t alpha);
+    void (*frame)(void);
+} AnimPlayerOps_t;
+
+/**
+ * @brief Stanje puštanja klipa.
+ */
+typedef struct
+{
+    const AnimClip_t      *clip;        /**< Klip koji se pušta. */
+    const AnimPlayerOps_t *ops;         /**< Crtanje. */
+    int16_t                x;           /**< Položaj klipa na ekranu. */
+    int16_t                y;
+    uint16_t               frame;       /**< Prikazani frejm. */
+    uint32_t               shown;       /**< Prikazano frejmova od starta (ključni = 0). */
+    uint32_t               total;       /**< Ukupno frejmova za prikaz (sa ponavljanjima). */
+    uint32_t               start_ms;    /**< Vrijeme prikaza ključnog frejma. */
+    uint32_t               patches;     /**< Iscrtano pravougaonika. */
+    uint32_t               late;        /**< Frejmovi iscrtani zajedno sa sljedećim (kašnjenje). */
+    bool                   running;     /**< Klip još nije završen. */
+} AnimPlayer_t;
+
+/*============================================================================*/
+/* JAVNE FUNKCIJE                                                             */
+/*============================================================================*/
+
+/**
+ * @brief  Primjenjuje providnost pravougaonika na ARGB8888 piksele.
+ * @note   Providni rezultat se svodi na 0x00000000, kao u icon_codec.h.
+ */
+void AnimCodec_ScaleAlpha(uint32_t *pixels, uint32_t count, uint8_t alpha);
+
+/**
+ * @brief  Dekodira ključni frejm u platno (`width * height` ARGB8888 piksela).
+ * @retval bool `false` ako su podaci oštećeni.
+ */
+bool AnimCodec_DecodeKeyframe(const AnimClip_t *clip, uint32_t *canvas);
+
+/**
+ * @brief  Primjenjuje razliku frejma `frame` na platno koje drži prethodni
+ *         frejm (za `frame` 0: zadnji frejm).
+ * @retval bool `false` ako su podaci oštećeni ili pravougaonik izlazi iz klipa.
+ */
+bool AnimCodec_ApplyFrame(const AnimClip_t *clip, uint16_t frame, uint32_t *canvas);
+
+/**
+ * @brief  Iscrtava ključni frejm i počinje puštanje.
+ * @param  repeats Koliko puta se klip pušta (najmanje 1).
+ */
+void AnimPlayer_Start(AnimPlayer_t *player, const AnimPlayerOps_t *ops, const AnimClip_t *clip,
+                      int16_t x, int16_t y, uint16_t repeats, uint32_t now_ms);
+
+/**
+ * @brief  Iscrtava frejmove koji su na redu do `now_ms`.
+ * @note   Tempo je vezan za vrijeme starta, pa se kašnjenje ne sabira: ako
+ *         je prošlo više frejmova, njihove razlike se iscrtaju u istom
+ *         koraku i prikazuje se samo zadnji.
+ * @retval bool `false` kad je klip završen.
+ */
+bool AnimPlayer_Step(AnimPlayer_t *player, uint32_t now_ms);
+
+/**
+ * @brief  Vraća vrijeme (ms) do sljedećeg frejma, 0 ako je na redu.
+ */
+uint32_t AnimPlayer_Wait(const AnimPlayer_t *player, uint32_t now_ms);
+
+#endif // __ANIM_CODEC_H__
@@ -0,0 +1,136 @@
+/**
+ ******************************************************************************
+ * @file    clock_face.h
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Javni API za sat na screensaver-u koji crta samo promijenjene cifre.
+ *
+ * @note    Sat na screensaver-u je svake sekunde brisao pojas 480x112 i
+ * ponovo crtao cijelo vrijeme i datum, iako se obično promijeni samo
+ * dvotačka (treptanje) ili jedna cifra minuta. Modul dijeli vrijeme na
+ * ćelije fiksne širine (sve cifre dobiju širinu najšire cifre, pa se
+ * raspored ne pomjera) i pamti prikazani znak svake ćelije:
+ *  - crta se samo ćelija čiji se znak promijenio,
+ *  - cifre, dvotačka i razmak se jednom iscrtaju u keš (memorijski
+ *    uređaj po znaku) i poslije samo kopiraju (blit),
+ *  - datum se crta samo kad se promijeni tekst, a briše se unija starog
+ *    i novog okvira,
+ *  - kad se ništa nije promijenilo, ne poziva se nijedna GUI funkcija
+ *    (ni `begin`/`end`, pa ni zamjena bafera).
+ * Crtanje ide preko `ClockFaceOps_t`, pa se modul provjerava na hostu.
+ ******************************************************************************
+ */
+
+#ifndef __CLOCK_FACE_H__
+#define __CLOCK_FACE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gui_dirty.h"
+
+/*============================================================================*/
+/* JAVNE DEFINICIJE I STRUKTURE                                               */
+/*============================================================================*/
+
+#define CLOCK_FACE_MAX_CELLS        8U      /**< Najviše znakova vremena ("HH:MM"). */
+#define CLOCK_FACE_GLYPHS           12U     /**< Keširani znakovi: '0'..'9', ':', ' '. */
+#define CLOCK_FACE_DATE_SIZE        64U     /**< Najduži tekst datuma sa nulom. */
+#define CLOCK_FACE_BYTES_PER_PIXEL  4U      /**< Keš je ARGB8888 (sloj 1). */
+
+/**
+ * @brief Crtanje sata (display.c).
+ */
+typedef struct
+{
+    int16_t  (*char_width)(char c);                                     /**< Širina znaka u fontu vremena. */
+    uint32_t (*render)(char c, int16_t width, int16_t height, uint32_t color); /**< Znak u novi uređaj, 0 ako nema memorije. */
+    void     (*release)(uint32_t glyph);                                /**< Briše uređaj znaka. */
+    void     (*begin)(void);                                            /**< Početak crtanja (sloj, multibuf). */
+    void     (*blit)(uint32_t glyph, int16_t x, int16_t y);             /**< Kopira uređaj znaka (zamjenjuje ćeliju). */
+    void     (*draw)(char c, const GuiRect_t *cell, uint32_t color);    /**< Briše ćeliju i crta znak direktno. */
+    int16_t  (*text_width)(const char *text);                           /**< Širina teksta u fontu datuma. */
+    void     (*draw_date)(const char *text, const GuiRect_t *clear, uint32_t color); /**< Briše `clear`, crta datum. */
+    void     (*end)(void);                                              /**< Kraj crtanja. */
+} ClockFaceOps_t;
+
+/**
+ * @brief Stanje sata, keš znakova i statistika iscrtavanja.
+ * @note  "Minuta" je period između dvije promjene cifre: površina minute
+ * uključuje i treptanje dvotačke u njoj.
+ */
+typedef struct
+{
+    const ClockFaceOps_t *ops;
+    uint8_t   cell_count;
+    GuiRect_t cells[CLOCK_FACE_MAX_CELLS];      /**< Okviri ćelija vremena. */
+    char      shown[CLOCK_FACE_MAX_CELLS];      /**< Prikazani znak ćelije, 0 = nepoznat. */
+    bool      digit[CLOCK_FACE_MAX_CELLS];      /**< Ćelija je cifra (širina najšire cifre). */
+    uint32_t  glyphs[CLOCK_FACE_GLYPHS];        /**< Uređaji znakova, 0 = nije iscrtan. */
+    uint32_t  color;                            /**< Boja sata. */
+    int16_t   date_x;                           /**< Centar datuma. */
+    int16_t   date_y0;                          /**< Vrh datuma. */
+    int16_t   date_height;
+    GuiRect_t date_rect;                        /**< Okvir prikazanog datuma (prazan: x1 < x0). */
+    char      date[CLOCK_FACE_DATE_SIZE];       /**< Prikazani datum, "" = nepoznat. */
+    uint32_t  glyph_bytes;                      /**< Memorija keša znakova. */
+    uint32_t  time_pixels;                      /**< Površina svih ćelija vremena. */
+    uint32_t  full_pixels;                      /**< Površina vremena i datuma (cijelo iscrtavanje). */
+    uint32_t  idle;                             /**< Pozivi bez promjene. */
+    uint32_t  ticks;                            /**< Pozivi u kojima su se promijenile samo ne-cifre. */
+    uint64_t  tick_pixels;                      /**< Zbir površina treptaja. */
+    uint32_t  minutes;                          /**< Pozivi u kojima se promijenila cifra. */
+    uint32_t  minute_acc;                       /**< Površina od zadnje promjene cifre. */
+    uint32_t  last_minute_pixels;
+    uint32_t  max_minute_pixels;
+    uint64_t  sum_minute_pixels;                /**< Zbir površina minuta. */
+    uint32_t  dates;                            /**< Iscrtavanja datuma. */
+    uint32_t  last_date_pixels;
+    uint32_t  blits;                            /**< Ćelije kopirane iz keša. */
+    uint32_t  misses;                           /**< Znakovi iscrtani u keš. */
+    uint32_t  direct;                           /**< Ćelije iscrtane bez keša. */
+} ClockFace_t;
+
+/*============================================================================*/
+/* JAVNE FUNKCIJE                                                             */
+/*============================================================================*/
+
+/**
+ * @brief  Raspoređuje ćelije vremena po uzorku i postavlja položaj datuma.
+ * @param  pattern Uzorak vremena, npr. "00:00": cifra je ćelija širine
+ *         najšire cifre, ostali znakovi svoje širine.
+ * @param  cx,cy Centar vremena; `height` je visina fonta vremena.
+ * @param  date_x,date_y Centar datuma; `date_height` je visina fonta datuma.
+ */
+void ClockFace_Init(ClockFace_t *cf, const ClockFaceOps_t *ops, const char *pattern, int16_t cx, int16_t cy,
+                    int16_t height, int16_t date_x, int16_t date_y, int16_t date_height, uint32_t color);
+
+/**
+ * @brief  Mijenja boju; keš znakova se briše i sve se crta ponovo.
+ */
+void ClockFace_SetColor(ClockFace_t *cf, uint32_t color);
+
+/**
+ * @brief  Zaboravlja prikazano (ekran je obrisan); sljedeći poziv crta sve.
+ */
+void ClockFace_Invalidate(ClockFace_t *cf);
+
+/**
+ * @brief  Briše keš znakova (nedostatak memorije); znakovi se ponovo
+ *         iscrtaju u keš kad zatrebaju.
+ */
+void ClockFace_Release(ClockFace_t *cf);
+
+/**
+ * @brief  Crta promijenjene ćelije vremena i datum ako se promijenio.
+ * @param  time Tekst vremena po uzorku (kraći tekst se dopuni razmacima).
+ * @param  date Tekst datuma ili NULL (datum se ne crta).
+ * @retval uint32_t Iscrtana površina u pikselima (0: bez GUI poziva).
+ */
+uint32_t ClockFace_Update(ClockFace_t *cf, const char *time, const char *date);
+
+/**
+ * @brief  Ispisuje keš i površine iscrtavanja po minuti, treptaju i datumu.
+ * @retval uint32_t Broj upisanih znakova (bez završne nule).
+ */
+uint32_t ClockFace_Report(const ClockFace_t *cf, char *buf, uint32_t size);
+
+#endif // __CLOCK_FACE_H__
@@ -424,7 +424,8 @@ typedef enum{
     SCREEN_LANGUAGE_SELECT,         // << NOVO
     SCREEN_THEME_SELECT,            // << NOVO
     SCREEN_OUTDOOR_TIMER,           // << NOVO
-    SCREEN_OUTDOOR_SETTINGS         // << NOVO (za adrese vanjske rasvjete)
+    SCREEN_OUTDOOR_SETTINGS,        // << NOVO (za adrese vanjske rasvjete)
+    SCREEN_DIAGNOSTICS              /**< Skriveni ekran: mjerenje iscrtavanja (gui_prof.h). */
 }eScreen;
 
 typedef enum{
@@ -537,6 +538,26 @@ const char* lng(uint8_t t);
 void DISPResetScrnsvr(void);
 void DISP_UpdateLog(const char *pbuf);
 void DISP_SignalDynamicIconUpdate(void);
+void DISP_InvalidateRect(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+void DISP_InvalidateLight(uint8_t index);
+void DISP_InvalidateGate(uint8_t index);
+void DISP_InvalidateStaticLayers(void);
+void DISP_InvalidateLabels(void);
+const char* DISP_GetStaticLayerReport(void);
+const char* DISP_GetWidgetTreeReport(void);
+const char* DISP_GetScreenReport(void);
+void DISP_NotifyInput(void);
+const char* DISP_GetFrameReport(void);
+const char* DISP_GetProfReport(void);
+void DISP_ResetProf(void);
+const char* DISP_GetMemReport(void);
+bool DISP_RemoteViewStart(void);
+void DISP_RemoteViewStop(void);
+void DISP_RemoteViewKeyframe(void);
+bool DISP_RemoteViewActive(void);
+int32_t DISP_RemoteViewRead(uint32_t pos, uint8_t *buf, uint16_t max);
+const char* DISP_GetRemoteViewReport(void);
+const char* DISP_GetClockReport(void);
 uint8_t DISP_GetThermostatMenuState(void);
 uint8_t* QR_Code_Get(const uint8_t qrCodeID);
 bool QR_Code_willDataFit(const uint8_t *data);
@@ -0,0 +1,125 @@
+/**
+ ******************************************************************************
+ * @file    dma2d_queue.h
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Javni API za ograničeni red (queue) DMA2D poslova.
+ *
+ * @note    Svaki DMA2D posao je opisan kopijom registara (`Dma2dJob_t`).
+ * Poslovi se stavljaju u red i pokreću jedan za drugim iz prekida
+ * "transfer complete", bez čekanja CPU-a između njih. `Submit` vraća
+ * broj ograde (fence); `Wait` blokira samo dok se ne završi posao sa
+ * tom ogradom, pa CPU može pripremati sljedeći posao dok se pikseli
+ * prenose. Sam pristup hardveru radi "backend": na ploči `LCDConf.c`
+ * (registri DMA2D), a na hostu softverski backend iz `dma2d_soft.c`.
+ * Modul ne zavisi od HAL-a.
+ ******************************************************************************
+ */
+
+#ifndef __DMA2D_QUEUE_H__
+#define __DMA2D_QUEUE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*============================================================================*/
+/* JAVNE DEFINICIJE I STRUKTURE                                               */
+/*============================================================================*/
+
+/** @brief Kapacitet reda. Kad je red pun, `Submit` čeka da se oslobodi mjesto. */
+#define DMA2D_QUEUE_SIZE            8U
+
+/* Način rada (CR[17:16]) */
+#define DMA2D_JOB_M2M               0x00000000UL    /**< Memorija -> memorija. */
+#define DMA2D_JOB_M2M_PFC           0x00010000UL    /**< Memorija -> memorija sa konverzijom formata. */
+#define DMA2D_JOB_M2M_BLEND         0x00020000UL    /**< Miješanje FG i BG. */
+#define DMA2D_JOB_R2M               0x00030000UL    /**< Popunjavanje bojom iz registra. */
+#define DMA2D_JOB_MODE_MASK         0x00030000UL
+
+/**
+ * @brief Jedan DMA2D posao: vrijednosti registara koje backend upisuje prije START.
+ * @note  Adrese su `uintptr_t` da bi isti posao mogao izvršiti i softverski
+ * backend na 64-bitnom hostu. Na ploči je to isto što i `uint32_t`.
+ */
+typedef struct
+{
+    uint32_t  cr;           /**< Način rada (DMA2D_JOB_xxx). */
+    uintptr_t fgmar;        /**< Adresa FG izvora. */
+    uint32_t  fgor;         /**< Offset linije FG izvora (u pikselima). */
+    uint32_t  fgpfccr;      /**< Format, alpha mod i alpha FG izvora. */
+    uint32_t  fgcolr;       /**< Boja FG izvora za A8/A4 formate. */
+    uintptr_t bgmar;        /**< Adresa BG izvora (samo BLEND). */
+    uint32_t  bgor;         /**< Offset linije BG izvora. */
+    uint32_t  bgpfccr;      /**< Format, alpha mod i alpha BG izvora. */
+    uintptr_t omar;         /**< Adresa odredišta. */
+    uint32_t  oor;          /**< Offset linije odredišta. */
+    uint32_t  opfccr;       /**< Format odredišta. */
+    uint32_t  ocolr;        /**< Boja za R2M. */
+    uint32_t  nlr;          /**< (piksela_po_liniji << 16) | broj_linija. */
+} Dma2dJob_t;
+
+/**
+ * @brief Funkcije backend-a.
+ * @note  `start` se poziva iz glavne petlje (unutar `lock`/`unlock`) ili iz
+ * prekida, i ne smije čekati kraj prenosa. Kad prenos završi, backend
+ * (prekid) poziva `Dma2dQueue_Complete()`.
+ */
+typedef struct
+{
+    void (*start)(const Dma2dJob_t *job);   /**< Upis registara i START. */
+    void (*idle)(void);                     /**< Čekanje u ogradi (npr. __WFI). */
+    void (*lock)(void);                     /**< Zabrana prekida "transfer complete". */
+    void (*unlock)(void);                   /**< Ponovna dozvola prekida. */
+} Dma2dBackend_t;
+
+/**
+ * @brief Stanje reda poslova.
+ */
+typedef struct
+{
+    Dma2dJob_t jobs[DMA2D_QUEUE_SIZE];      /**< Kružni bafer; `jobs[head]` je posao u toku. */
+    volatile uint8_t  head;                 /**< Indeks posla u toku. */
+    volatile uint8_t  count;                /**< Broj poslova u redu (uključujući onaj u toku). */
+    volatile uint32_t submitted;            /**< Ograda zadnjeg predatog posla. */
+    volatile uint32_t completed;            /**< Ograda zadnjeg završenog posla. */
+    uint8_t  max_depth;                     /**< Najveća zabilježena dubina reda. */
+    uint32_t full_waits;                    /**< Koliko puta je `Submit` čekao na mjesto. */
+    const Dma2dBackend_t *backend;          /**< Izvršilac poslova. */
+} Dma2dQueue_t;
+
+/*============================================================================*/
+/* JAVNE FUNKCIJE                                                             */
+/*============================================================================*/
+
+/**
+ * @brief  Inicijalizuje prazan red sa zadanim backend-om.
+ */
+void Dma2dQueue_Init(Dma2dQueue_t *queue, const Dma2dBackend_t *backend);
+
+/**
+ * @brief  Stavlja posao u red i pokreće ga ako je DMA2D slobodan.
+ * @note   Posao se kopira, pa pozivalac može odmah ponovo koristiti strukturu.
+ * @retval uint32_t Ograda za `Dma2dQueue_Wait()`.
+ */
+uint32_t Dma2dQueue_Submit(Dma2dQueue_t *queue, const Dma2dJob_t *job);
+
+/**
+ * @brief  Javlja kraj posla u toku i pokreće sljedeći. Poziva se iz prekida.
+ */
+void Dma2dQueue_Complete(Dma2dQueue_t *queue);
+
+/**
+ * @brief  Provjerava da li je posao sa zadanom ogradom završen.
+ */
+bool Dma2dQueue_IsDone(const Dma2dQueue_t *queue, uint32_t fence);
+
+/**
+ * @brief  Čeka dok se ne završi posao sa zadanom ogradom (i svi prije njega).
+ */
+void Dma2dQueue_Wait(Dma2dQueue_t *queue, uint32_t fence);
+
+/**
+ * @brief  Čeka dok se red potpuno ne isprazni.
+ */
+void Dma2dQueue_Sync(Dma2dQueue_t *queue);
+
+#endif // __DMA2D_QUEUE_H__
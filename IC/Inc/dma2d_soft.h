@@ -0,0 +1,57 @@
+/**
+ ******************************************************************************
+ * @file    dma2d_soft.h
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Softverski DMA2D backend za red poslova (samo za host).
+ *
+ * @note    Izvršava `Dma2dJob_t` poslove u C-u nad običnom memorijom, sa istim
+ * značenjem registara kao DMA2D (R2M, M2M, M2M_PFC, M2M_BLEND i alpha
+ * modovi FG/BG). Poslovi se ne izvršavaju odmah u `start`, nego tek u
+ * `idle` ili `Dma2dSoft_Step()`, pa testovi na hostu vide isti
+ * redoslijed i iste ograde kao na ploči, gdje posao teče u pozadini.
+ * Fajl nije dio Keil projekta.
+ ******************************************************************************
+ */
+
+#ifndef __DMA2D_SOFT_H__
+#define __DMA2D_SOFT_H__
+
+#include "dma2d_queue.h"
+
+/*============================================================================*/
+/* JAVNE DEFINICIJE I STRUKTURE                                               */
+/*============================================================================*/
+
+/* Formati piksela (CM polje PFCCR registara, isto kao LTDC_PIXEL_FORMAT_xxx) */
+#define DMA2D_SOFT_ARGB8888         0U
+#define DMA2D_SOFT_RGB888           1U
+#define DMA2D_SOFT_RGB565           2U
+#define DMA2D_SOFT_L8               5U
+#define DMA2D_SOFT_A8               9U
+
+/** @brief Backend koji se predaje `Dma2dQueue_Init()`. */
+extern const Dma2dBackend_t Dma2dSoft_Backend;
+
+/*============================================================================*/
+/* JAVNE FUNKCIJE                                                             */
+/*============================================================================*/
+
+/**
+ * @brief  Povezuje backend sa redom kojem javlja kraj posla.
+ * @param  clut Paleta za L8 izvor (ARGB8888, 256 boja) ili NULL.
+ * @param  trace Poziva se za svaki izvršeni posao ili NULL.
+ */
+void Dma2dSoft_Attach(Dma2dQueue_t *queue, const uint32_t *clut, void (*trace)(const Dma2dJob_t *job));
+
+/**
+ * @brief  Izvršava posao u toku (ako postoji), kao da je stigao prekid.
+ * @retval bool `true` ako je posao izvršen.
+ */
+bool Dma2dSoft_Step(void);
+
+/**
+ * @brief  Vraća broj poslova sa formatom koji backend ne podržava.
+ */
+uint32_t Dma2dSoft_Unsupported(void);
+
+#endif // __DMA2D_SOFT_H__
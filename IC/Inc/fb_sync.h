@@ -0,0 +1,91 @@
+/**
+ ******************************************************************************
+ * @file    fb_sync.h
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Javni API za djelimičnu sinhronizaciju bafera višestrukog baferovanja.
+ *
+ * @note    Svaki `GUI_MULTIBUF_BeginEx()` kopira prednji bafer u novi zadnji
+ * bafer. Do sada je to uvijek bio cijeli ekran 480x272 (255 KB za RGB565
+ * sloj, 510 KB za ARGB8888 sloj), iako se između dva frejma obično
+ * promijeni samo nekoliko ikonica ili labela. Modul za svaki bafer vodi
+ * regiju u kojoj se on razlikuje od najnovijeg sadržaja, pa se kopira
+ * samo ta regija. Crtanje prijavljuje `LCDConf.c` (uređaj koji bilježi
+ * svaki pravougaonik poslan drajveru). Regije su `GuiDirty_t` liste,
+ * pa se preveliko oštećenje svodi na kopiranje cijelog bafera.
+ * Modul ne zavisi od emWin-a ni HAL-a.
+ ******************************************************************************
+ */
+
+#ifndef __FB_SYNC_H__
+#define __FB_SYNC_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gui_dirty.h"
+
+/*============================================================================*/
+/* JAVNE DEFINICIJE I STRUKTURE                                               */
+/*============================================================================*/
+
+/** @brief Najveći broj bafera po sloju (emWin `NUM_BUFFERS`). */
+#define FB_SYNC_MAX_BUFFERS         3U
+
+/**
+ * @brief Stanje sinhronizacije bafera jednog LCD sloja.
+ */
+typedef struct
+{
+    GuiDirty_t stale[FB_SYNC_MAX_BUFFERS];  /**< Regija u kojoj bafer zaostaje za najnovijim sadržajem. */
+    GuiDirty_t frame;                       /**< Crtanje u bafer `draw` od zadnjeg `FbSync_Begin()`. */
+    GuiDirty_t copy;                        /**< Regija koju treba kopirati u tekućem `FbSync_Begin()`. */
+    uint8_t    buffers;                     /**< Broj bafera. */
+    uint8_t    draw;                        /**< Bafer u koji se trenutno crta. */
+    uint8_t    bytes_per_pixel;             /**< Veličina piksela u bajtima. */
+    uint32_t   frames;                      /**< Broj sinhronizacija. */
+    uint32_t   full_copies;                 /**< Broj sinhronizacija koje su kopirale cijeli bafer. */
+    uint32_t   last_bytes;                  /**< Bajtova kopirano u zadnjoj sinhronizaciji. */
+    uint64_t   total_bytes;                 /**< Ukupno kopirano bajtova. */
+} FbSync_t;
+
+/*============================================================================*/
+/* JAVNE FUNKCIJE                                                             */
+/*============================================================================*/
+
+/**
+ * @brief  Inicijalizuje praćenje za sloj sa `buffers` bafera.
+ * @note   Sadržaj svih bafera osim `front` je nepoznat, pa prva
+ *         sinhronizacija svakog od njih kopira cijeli bafer.
+ */
+void FbSync_Init(FbSync_t *sync, int16_t width, int16_t height, uint8_t bytes_per_pixel, uint8_t buffers, uint8_t front);
+
+/**
+ * @brief  Proglašava sve bafere osim onog u koji se crta zastarjelim.
+ * @note   Za izmjene memorije mimo drajvera (npr. pomjeranje sloja).
+ */
+void FbSync_InvalidateAll(FbSync_t *sync);
+
+/**
+ * @brief  Bilježi da je pravougaonik [x0..x1] x [y0..y1] iscrtan u bafer `draw`.
+ */
+void FbSync_Damage(FbSync_t *sync, int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+
+/**
+ * @brief  Priprema bafer `dst` za crtanje kopiranjem iz bafera `src`.
+ * @note   Crtanje od prethodnog poziva se prvo proglasi zastarjelim u svim
+ *         ostalim baferima, a zatim se vrati regija koju treba kopirati iz
+ *         `src` u `dst`. Nakon poziva se crta u `dst`, a njegova regija
+ *         postaje regija izvora (ako ni `src` nije bio ažuran).
+ * @retval const GuiDirty_t* Regija za kopiranje (može biti prazna), ili
+ *         NULL za neispravan indeks bafera - tada treba kopirati sve.
+ */
+const GuiDirty_t *FbSync_Begin(FbSync_t *sync, uint8_t src, uint8_t dst);
+
+/**
+ * @brief  Ispisuje prosječan i zadnji broj kopiranih bajta po frejmu.
+ * @note   Jedna linija: sloj, prosjek, zadnji frejm, broj potpunih kopija i
+ *         ušteda u odnosu na kopiranje cijelog bafera svaki put.
+ * @retval uint32_t Broj upisanih znakova (bez završne nule).
+ */
+uint32_t FbSync_Report(const FbSync_t *sync, uint8_t layer, char *buf, uint32_t size);
+
+#endif // __FB_SYNC_H__
@@ -31,7 +31,8 @@ void FwUpdateAgent_Init(void);
  * @brief Glavna servisna funkcija (drajver) za Agent.
  * @note  Ovu funkciju je potrebno pozivati periodično iz glavne `while(1)` petlje u main.c.
  * Odgovorna je za upravljanje internim tajmerima, kao što je timeout
- * zbog neaktivnosti servera tokom transfera.
+ * zbog neaktivnosti servera tokom transfera, te za sav rad sa QSPI
+ * memorijom (brisanje ispred upisa i upis primljenih paketa).
  * @param None
  * @retval None
  */
@@ -41,7 +42,8 @@ void FwUpdateAgent_Service(void);
  * @brief Prosljeđuje dolaznu TinyFrame poruku Agentu na obradu.
  * @note  Ovo je glavna ulazna tačka za sve komande vezane za update. Poziva se
  * iz `FIRMWARE_UPDATE_Listener`-a u `rs485.c`. Agent će obraditi poruku
- * u zavisnosti od svog trenutnog stanja.
+ * u zavisnosti od svog trenutnog stanja. Multicast poruke (adresirane na
+ * sve panele) i tuđi multicast NACK-ovi se takođe prosljeđuju Agentu.
  * @param tf    Pokazivač na TinyFrame instancu.
  * @param msg   Pokazivač na primljenu TF_Msg poruku.
  * @retval None
@@ -57,4 +59,13 @@ void FwUpdateAgent_ProcessMessage(TinyFrame *tf, TF_Msg *msg);
  */
 bool FwUpdateAgent_IsActive(void);
 
+/**
+ * @brief Provjerava da li je QSPI memorija trenutno zauzeta brisanjem sektora.
+ * @note  Dok brisanje traje, QSPI nije u memory-mapped modu, pa `display.c`
+ * tada preskače `GUI_Exec()` kako ne bi čitao slike i fontove iz nje.
+ * @param None
+ * @retval bool `true` ako je brisanje sektora u toku, inače `false`.
+ */
+bool FwUpdateAgent_IsFlashBusy(void);
+
 #endif // __FIRMWARE_UPDATE_AGENT_H__
@@ -0,0 +1,106 @@
+/**
+ ******************************************************************************
+ * @file    frame_pacer.h
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Javni API za tempiranje `GUI_Exec()` po vsync-u LTDC-a.
+ *
+ * @note    `DISP_Service` je pozivao `GUI_Exec()` svakih `GUI_REFRESH_TIME`
+ * ms, bez obzira na to da li ima išta za iscrtati i gdje je LTDC u
+ * prikazu frejma. Sada se odluka donosi jednom po vsync-u (prekid linije
+ * u `HAL_LTDC_LineEvenCallback`), a frejm se crta samo ako:
+ *  - ima novog ulaza (dodir) ili nevažećih prozora,
+ *  - nijedan bafer ne čeka prikaz (višestruko baferovanje),
+ *  - je isteklo vrijeme koje je prethodni frejm potrošio preko budžeta.
+ * Frejm bez novog ulaza ima nizak prioritet: dok čeka rad na busu ili
+ * upravljanje (`busy`), odgađa se najviše `max_defer` vsync-ova.
+ * Sve ulaze daje `display.c` preko `FramePacerOps_t`, pa se odluke mogu
+ * provjeriti na hostu sa simuliranim vsync-om.
+ ******************************************************************************
+ */
+
+#ifndef __FRAME_PACER_H__
+#define __FRAME_PACER_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*============================================================================*/
+/* JAVNE DEFINICIJE I STRUKTURE                                               */
+/*============================================================================*/
+
+/**
+ * @brief Ako se brojač vsync-a ne promijeni ovoliko ms (LTDC ugašen ili
+ * prekid izgubljen), odluka se donosi kao da je stigao vsync.
+ */
+#define FRAME_PACER_STALL_MS        100U
+
+/**
+ * @brief Izvori stanja za odluku o frejmu.
+ */
+typedef struct
+{
+    uint32_t (*vsync)(void);            /**< Brojač vsync-ova (prekid LTDC-a). */
+    uint32_t (*ms)(void);               /**< Vrijeme u ms. */
+    bool     (*buffer_pending)(void);   /**< Neki bafer čeka prikaz na sljedećem vsync-u. */
+    bool     (*input)(void);            /**< Novi ulaz od zadnjeg frejma (briše se čitanjem). */
+    bool     (*invalid)(void);          /**< Ima nevažećih prozora. */
+    bool     (*busy)(void);             /**< Čeka rad na busu ili upravljanje. */
+} FramePacerOps_t;
+
+/**
+ * @brief Stanje i statistika.
+ */
+typedef struct
+{
+    const FramePacerOps_t *ops;
+    uint32_t budget_us;         /**< Budžet frejma (period vsync-a). */
+    uint8_t  max_defer;         /**< Najviše vsync-ova odgađanja frejma niskog prioriteta. */
+    uint32_t vsync;             /**< Vsync zadnje odluke. */
+    uint32_t vsync_ms;          /**< Vrijeme zadnje odluke. */
+    uint32_t next_vsync;        /**< Najraniji vsync za sljedeći frejm. */
+    uint8_t  deferred;          /**< Vsync-ova odgađanja tekućeg frejma. */
+    bool     input;             /**< Ulaz pročitan, a frejm još nije iscrtan. */
+    uint32_t frames;            /**< Iscrtani frejmovi. */
+    uint32_t input_frames;      /**< Od toga sa novim ulazom. */
+    uint32_t idle;              /**< Vsync-ovi bez ičega za iscrtati. */
+    uint32_t buffer_waits;      /**< Vsync-ovi na kojima je bafer čekao prikaz. */
+    uint32_t budget_waits;      /**< Vsync-ovi preskočeni jer je frejm prešao budžet. */
+    uint32_t deferrals;         /**< Vsync-ovi odgađanja zbog rada na busu. */
+    uint32_t forced;            /**< Frejmovi iscrtani nakon `max_defer` odgađanja. */
+    uint32_t stalls;            /**< Odluke bez vsync-a (`FRAME_PACER_STALL_MS`). */
+    uint32_t over_budget;       /**< Frejmovi duži od budžeta. */
+    uint32_t last_us;           /**< Trajanje zadnjeg frejma. */
+    uint32_t max_us;            /**< Najduži frejm. */
+} FramePacer_t;
+
+/*============================================================================*/
+/* JAVNE FUNKCIJE                                                             */
+/*============================================================================*/
+
+/**
+ * @brief  Inicijalizuje tempiranje; prvi frejm je moguć na sljedećem vsync-u.
+ * @param  budget_us Budžet frejma u µs (period vsync-a).
+ * @param  max_defer Najviše vsync-ova odgađanja frejma niskog prioriteta.
+ */
+void FramePacer_Init(FramePacer_t *pacer, const FramePacerOps_t *ops, uint32_t budget_us, uint8_t max_defer);
+
+/**
+ * @brief  Odlučuje da li se u ovom prolazu crta frejm.
+ * @note   Odluka se donosi jednom po vsync-u; ostali pozivi vraćaju `false`.
+ *         Nakon `true` pozivalac izvrši `GUI_Exec()` i pozove `FramePacer_Done()`.
+ */
+bool FramePacer_Poll(FramePacer_t *pacer);
+
+/**
+ * @brief  Bilježi trajanje frejma; frejm duži od budžeta odgađa sljedeći za
+ *         onoliko vsync-ova koliko je budžeta potrošio.
+ */
+void FramePacer_Done(FramePacer_t *pacer, uint32_t exec_us);
+
+/**
+ * @brief  Ispisuje statistiku tempiranja.
+ * @retval uint32_t Broj upisanih znakova (bez završne nule).
+ */
+uint32_t FramePacer_Report(const FramePacer_t *pacer, char *buf, uint32_t size);
+
+#endif // __FRAME_PACER_H__
@@ -0,0 +1,128 @@
+/**
+ ******************************************************************************
+ * @file    fw_block_map.h
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Javni API za bitmapu primljenih blokova firmvera.
+ *
+ * @note    Modul vodi evidenciju o tome koji su blokovi slike firmvera već
+ * upisani u "staging" QSPI zonu. Koristi ga Firmware Update Agent za
+ * multicast prijem (blokovi stižu bilo kojim redoslijedom) i za
+ * generisanje liste nedostajućih opsega u NACK fazi.
+ * Modul namjerno ne zavisi od HAL-a niti od ostatka sistema, kako bi se
+ * ista logika mogla prevesti i izvršavati i na host računaru.
+ ******************************************************************************
+ */
+
+#ifndef __FW_BLOCK_MAP_H__
+#define __FW_BLOCK_MAP_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*============================================================================*/
+/* JAVNE DEFINICIJE I STRUKTURE                                               */
+/*============================================================================*/
+
+/** @brief Najveća podržana veličina slike firmvera (RT_APPL_SIZE, 960kB). */
+#define FWMAP_MAX_IMAGE_SIZE        0x000F0000U
+/** @brief Najmanja dozvoljena veličina bloka; određuje veličinu bitmape. */
+#define FWMAP_MIN_BLOCK_SIZE        256U
+/** @brief Najveći broj blokova koje bitmapa može pratiti. */
+#define FWMAP_MAX_BLOCKS            (FWMAP_MAX_IMAGE_SIZE / FWMAP_MIN_BLOCK_SIZE)
+/** @brief Veličina bitmape u bajtovima. */
+#define FWMAP_BITMAP_BYTES          ((FWMAP_MAX_BLOCKS + 7U) / 8U)
+
+/**
+ * @brief Opis jednog neprekinutog opsega blokova.
+ */
+typedef struct
+{
+    uint32_t first;     /**< Indeks prvog bloka u opsegu. */
+    uint16_t count;     /**< Broj uzastopnih blokova u opsegu. */
+} FwBlockRange_t;
+
+/**
+ * @brief Bitmapa primljenih blokova jedne slike firmvera.
+ */
+typedef struct
+{
+    uint32_t image_size;                    /**< Ukupna veličina slike u bajtovima. */
+    uint32_t total_blocks;                  /**< Ukupan broj blokova u slici. */
+    uint32_t received_blocks;               /**< Broj do sada primljenih blokova. */
+    uint16_t block_size;                    /**< Veličina jednog bloka u bajtovima. */
+    uint8_t  bits[FWMAP_BITMAP_BYTES];      /**< Bit = 1 znači da je blok upisan. */
+} FwBlockMap_t;
+
+/*============================================================================*/
+/* JAVNE FUNKCIJE                                                             */
+/*============================================================================*/
+
+/**
+ * @brief  Inicijalizuje praznu bitmapu za sliku zadate veličine.
+ * @param  map         Pokazivač na bitmapu.
+ * @param  image_size  Veličina slike u bajtovima.
+ * @param  block_size  Veličina bloka u bajtovima (>= FWMAP_MIN_BLOCK_SIZE).
+ * @retval bool `true` ako su parametri validni, inače `false`.
+ */
+bool FwBlockMap_Init(FwBlockMap_t *map, uint32_t image_size, uint16_t block_size);
+
+/**
+ * @brief  Provjerava da li je blok sa zadatim indeksom već primljen.
+ */
+bool FwBlockMap_Test(const FwBlockMap_t *map, uint32_t index);
+
+/**
+ * @brief  Označava blok kao primljen.
+ * @retval bool `true` ako blok ranije nije bio označen (novi podatak).
+ */
+bool FwBlockMap_Set(FwBlockMap_t *map, uint32_t index);
+
+/**
+ * @brief  Vraća očekivanu dužinu bloka (zadnji blok može biti kraći).
+ */
+uint16_t FwBlockMap_BlockLength(const FwBlockMap_t *map, uint32_t index);
+
+/**
+ * @brief  Ponovo prebrojava primljene blokove iz sadržaja bitmape.
+ * @note   Koristi se nakon učitavanja bitmape iz trajne memorije; bitovi iza
+ * zadnjeg bloka slike se brišu.
+ */
+void FwBlockMap_Recount(FwBlockMap_t *map);
+
+/**
+ * @brief  Provjerava da li su primljeni svi blokovi slike.
+ */
+bool FwBlockMap_IsComplete(const FwBlockMap_t *map);
+
+/**
+ * @brief  Vraća indeks prvog nedostajućeg bloka počevši od `from`.
+ * @retval uint32_t Indeks bloka ili `total_blocks` ako nijedan ne nedostaje.
+ */
+uint32_t FwBlockMap_FirstMissing(const FwBlockMap_t *map, uint32_t from);
+
+/**
+ * @brief  Popunjava listu opsega nedostajućih blokova.
+ * @param  map     Pokazivač na bitmapu.
+ * @param  ranges  Izlazni niz opsega.
+ * @param  max     Kapacitet izlaznog niza.
+ * @retval uint8_t Broj upisanih opsega.
+ */
+uint8_t FwBlockMap_GetMissingRanges(const FwBlockMap_t *map, FwBlockRange_t *ranges, uint8_t max);
+
+/**
+ * @brief  Uklanja iz vlastite liste blokove koje je već zatražio drugi uređaj.
+ * @note   Koristi se za potiskivanje NACK poruka: pošiljalac će "načute"
+ * blokove ionako ponovo poslati svima, pa se oni oduzimaju od vlastitih
+ * opsega. Djelimično pokriven opseg se skraćuje ili dijeli na dva. Dijelovi
+ * koji ne stanu u `max` se izostavljaju i traže se u sljedećem krugu.
+ * @param  mine        Vlastita lista opsega (mijenja se na mjestu).
+ * @param  mine_count  Broj opsega u vlastitoj listi.
+ * @param  max         Kapacitet vlastite liste.
+ * @param  heard       Lista opsega iz tuđeg NACK-a.
+ * @param  heard_count Broj opsega u tuđoj listi.
+ * @retval uint8_t Broj preostalih vlastitih opsega.
+ */
+uint8_t FwBlockMap_SuppressRanges(FwBlockRange_t *mine, uint8_t mine_count, uint8_t max,
+                                  const FwBlockRange_t *heard, uint8_t heard_count);
+
+#endif // __FW_BLOCK_MAP_H__
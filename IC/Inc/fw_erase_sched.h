@@ -0,0 +1,95 @@
+/**
+ ******************************************************************************
+ * @file    fw_erase_sched.h
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Javni API za raspoređivač brisanja "staging" zone ispred upisa.
+ *
+ * @note    Umjesto da se cijela staging zona obriše sinhrono na START poruci,
+ * sektori se brišu jedan po jedan, neposredno ispred pokazivača upisa,
+ * dok paneli istovremeno primaju podatke. Modul samo odlučuje KOJI
+ * sektor i KADA treba obrisati i vodi granicu do koje je zona obrisana;
+ * sam QSPI pristup obavlja Firmware Update Agent.
+ * Kao i `fw_block_map`, modul ne zavisi od HAL-a, pa se ista logika može
+ * provjeriti i na host računaru sa modelom vremena NOR flash memorije.
+ ******************************************************************************
+ */
+
+#ifndef __FW_ERASE_SCHED_H__
+#define __FW_ERASE_SCHED_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*============================================================================*/
+/* JAVNE DEFINICIJE I STRUKTURE                                               */
+/*============================================================================*/
+
+/**
+ * @brief Stanje raspoređivača brisanja jedne staging zone.
+ */
+typedef struct
+{
+    uint32_t base;          /**< Početak prvog sektora zone (poravnat na sektor). */
+    uint32_t end;           /**< Kraj zone (prvi bajt iza slike). */
+    uint32_t sector_size;   /**< Veličina sektora koji se briše jednom komandom. */
+    uint32_t lookahead;     /**< Koliko bajtova ispred upisa zona mora biti obrisana. */
+    uint32_t erased_to;     /**< Sve u [base, erased_to) je obrisano. */
+    bool     busy;          /**< Brisanje sektora na `erased_to` je u toku. */
+} FwEraseSched_t;
+
+/*============================================================================*/
+/* JAVNE FUNKCIJE                                                             */
+/*============================================================================*/
+
+/**
+ * @brief  Inicijalizuje raspoređivač za novu, još neobrisanu zonu.
+ * @param  sched             Pokazivač na raspoređivač.
+ * @param  start             Početna adresa slike (staging adresa).
+ * @param  size              Veličina slike u bajtovima.
+ * @param  sector_size       Veličina sektora (stepen dvojke).
+ * @param  lookahead_sectors Broj sektora koji se drže obrisanim ispred upisa.
+ * @retval bool `false` ako su parametri neispravni.
+ */
+bool FwEraseSched_Init(FwEraseSched_t *sched, uint32_t start, uint32_t size,
+                       uint32_t sector_size, uint8_t lookahead_sectors);
+
+/**
+ * @brief  Postavlja granicu obrisanog dijela (nastavak prekinutog transfera).
+ * @param  sched   Pokazivač na raspoređivač.
+ * @param  offset  Broj bajtova od `base` koji su već obrisani; zaokružuje se
+ * naniže na cijeli sektor.
+ */
+void FwEraseSched_Restore(FwEraseSched_t *sched, uint32_t offset);
+
+/**
+ * @brief  Provjerava da li je opseg [addr, addr + len) spreman za upis.
+ */
+bool FwEraseSched_IsErased(const FwEraseSched_t *sched, uint32_t addr, uint32_t len);
+
+/**
+ * @brief  Odlučuje da li sada treba pokrenuti brisanje sljedećeg sektora.
+ * @note   Ako vrati `true`, raspoređivač prelazi u stanje `busy` i ne predlaže
+ * novo brisanje dok se ne pozove `FwEraseSched_Done()`.
+ * @param  sched        Pokazivač na raspoređivač.
+ * @param  write_ptr    Najveća adresa do koje su podaci primljeni (ili traženi).
+ * @param  sector_addr  Izlaz: adresa sektora koji treba obrisati.
+ * @retval bool `true` ako treba pokrenuti brisanje.
+ */
+bool FwEraseSched_Next(FwEraseSched_t *sched, uint32_t write_ptr, uint32_t *sector_addr);
+
+/**
+ * @brief  Javlja da je brisanje sektora započetog sa `FwEraseSched_Next()` završeno.
+ */
+void FwEraseSched_Done(FwEraseSched_t *sched);
+
+/**
+ * @brief  Vraća broj bajtova od `base` koji su obrisani (za trajni zapis).
+ */
+uint32_t FwEraseSched_ErasedOffset(const FwEraseSched_t *sched);
+
+/**
+ * @brief  Provjerava da li je obrisana kompletna zona.
+ */
+bool FwEraseSched_IsComplete(const FwEraseSched_t *sched);
+
+#endif // __FW_ERASE_SCHED_H__
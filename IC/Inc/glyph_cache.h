@@ -0,0 +1,153 @@
+/**
+ ******************************************************************************
+ * @file    glyph_cache.h
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Javni API keša rasterizovanih glifova (A8) u SDRAM-u.
+ *
+ * @note    Verdana fontovi su emWin tabele u QSPI (`.flash_rom`) sa 2 ili 4
+ * bita alfe po pikselu. Za svaki znak emWin prolazi lanac `GUI_FONT_PROP`
+ * opsega, čita `GUI_CHARINFO` i dekodira piksele, i to pri svakom
+ * iscrtavanju. Keš čuva već dekodiran glif kao A8 (bajt alfe po pikselu),
+ * koji DMA2D direktno miješa u frame bafer. Digiti sata i česti znakovi
+ * se mogu unaprijed učitati (`GlyphCache_Preload`) i tada ostaju trajno
+ * u kešu. Memorija je ograničena bazenom i brojem zapisa. Modul ne zavisi
+ * od emWin-a ni HAL-a: glif iz fonta čita funkcija `GlyphFetch_t`.
+ ******************************************************************************
+ */
+
+#ifndef __GLYPH_CACHE_H__
+#define __GLYPH_CACHE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*============================================================================*/
+/* JAVNE DEFINICIJE I STRUKTURE                                               */
+/*============================================================================*/
+
+/** @brief Maksimalan broj glifova u kešu istovremeno. */
+#define GLYPH_CACHE_MAX_ENTRIES     512U
+
+/** @brief Broj lanaca hash tabele (stepen broja 2). */
+#define GLYPH_CACHE_BUCKETS         128U
+
+/** @brief Poravnanje glifova u bazenu. */
+#define GLYPH_CACHE_ALIGN           4U
+
+/** @brief Oznaka "nema zapisa" u lancima i listama. */
+#define GLYPH_CACHE_NONE            0xFFFFU
+
+/**
+ * @brief Glif kako je zapisan u fontu.
+ * @note  Pikseli su spakovani od najvišeg bita, linija po liniju, sa
+ * `bytes_per_line` bajta po liniji (format emWin PROP/AA2/AA4 fontova).
+ */
+typedef struct
+{
+    const uint8_t *data;            /**< Pikseli glifa u fontu. */
+    uint8_t        width;           /**< Širina bitmape (XSize). */
+    uint8_t        height;          /**< Visina bitmape (YSize fonta). */
+    uint8_t        xdist;           /**< Pomak kursora poslije znaka (XDist). */
+    uint8_t        bpp;             /**< Bita po pikselu: 1, 2, 4 ili 8. */
+    uint8_t        bytes_per_line;  /**< Bajta po liniji u fontu. */
+} GlyphSource_t;
+
+/**
+ * @brief Čitanje glifa iz fonta.
+ * @retval bool `false` ako znak nije u fontu.
+ */
+typedef bool (*GlyphFetch_t)(const void *font, uint16_t code, GlyphSource_t *out);
+
+/**
+ * @brief Jedan glif u kešu.
+ */
+typedef struct
+{
+    const void *font;       /**< Font (ključ, zajedno sa `code`). */
+    uint8_t    *alpha;      /**< A8 pikseli u bazenu, `width * height` bajta. */
+    uint32_t    offset;     /**< Pozicija u bazenu. */
+    uint16_t    size;       /**< Zauzeto bajta u bazenu (poravnato). */
+    uint16_t    code;       /**< Unicode znaka. */
+    uint16_t    next;       /**< Sljedeći zapis u lancu hash tabele. */
+    uint8_t     width;      /**< Širina glifa. */
+    uint8_t     height;     /**< Visina glifa. */
+    uint8_t     xdist;      /**< Pomak kursora poslije znaka. */
+    bool        pinned;     /**< Unaprijed učitan, ne izbacuje se. */
+} GlyphCacheEntry_t;
+
+/**
+ * @brief Stanje keša i statistika.
+ * @note  Bazen ima dva dijela: trajni (`[0, pinned_end)`) za unaprijed
+ * učitane glifove i prsten iza njega za ostale. Glifovi u prstenu se
+ * dodaju redom i izbacuju najstariji prvi (FIFO), pa je i dodavanje i
+ * izbacivanje O(1) bez fragmentacije. `fifo` drži zapise prstena po redu
+ * dodavanja.
+ */
+typedef struct
+{
+    uint8_t           *pool;                                /**< Bazen u SDRAM-u. */
+    uint32_t           budget;                              /**< Veličina bazena u bajtima. */
+    GlyphFetch_t       fetch;                               /**< Čitanje glifa iz fonta. */
+    GlyphCacheEntry_t  entries[GLYPH_CACHE_MAX_ENTRIES];    /**< Zapisi. */
+    uint16_t           buckets[GLYPH_CACHE_BUCKETS];        /**< Početak lanca po hash vrijednosti. */
+    uint16_t           fifo[GLYPH_CACHE_MAX_ENTRIES];       /**< Zapisi prstena po redu dodavanja. */
+    uint16_t           fifo_first;                          /**< Najstariji zapis u `fifo`. */
+    uint16_t           fifo_count;                          /**< Broj zapisa u prstenu. */
+    uint16_t           free_first;                          /**< Prvi slobodan zapis (lanac kroz `next`). */
+    uint16_t           pinned;                              /**< Broj trajnih glifova. */
+    uint32_t           pinned_end;                          /**< Kraj trajnog dijela bazena. */
+    uint32_t           ring_head;                           /**< Sljedeća slobodna pozicija u prstenu. */
+    uint32_t           lookups;                             /**< Broj upita. */
+    uint32_t           hits;                                /**< Upiti odgovoreni iz keša (ušteđena čitanja fonta). */
+    uint32_t           fetches;                             /**< Glifovi pročitani iz fonta. */
+    uint32_t           fetch_bytes;                         /**< Bajta pročitano iz fonta. */
+    uint32_t           evictions;                           /**< Izbačeni glifovi. */
+    uint32_t           uncached;                            /**< Znakovi koji nisu u fontu ili ne staju u bazen. */
+} GlyphCache_t;
+
+/*============================================================================*/
+/* JAVNE FUNKCIJE                                                             */
+/*============================================================================*/
+
+/**
+ * @brief  Inicijalizuje prazan keš nad zadanim bazenom.
+ * @param  pool Početak bazena (poravnat na GLYPH_CACHE_ALIGN).
+ * @param  budget Koliko bajta bazena keš smije zauzeti.
+ */
+void GlyphCache_Init(GlyphCache_t *cache, uint8_t *pool, uint32_t budget, GlyphFetch_t fetch);
+
+/**
+ * @brief  Vraća glif iz keša, a ako ga nema čita ga iz fonta i dodaje.
+ * @retval const GlyphCacheEntry_t* Glif, ili NULL ako znak nije u fontu
+ *         ili ne može stati u bazen (tada ga crta emWin).
+ * @note   Pokazivač važi do sljedećeg poziva koji može izbaciti glif.
+ */
+const GlyphCacheEntry_t *GlyphCache_Get(GlyphCache_t *cache, const void *font, uint16_t code);
+
+/**
+ * @brief  Trajno učitava znakove fonta (npr. digite sata).
+ * @note   Prsten se prazni jer trajni dio raste preko njegovog početka;
+ *         poziva se pri inicijalizaciji ili ulasku na ekran.
+ * @retval uint16_t Broj znakova koji su trajno u kešu nakon poziva.
+ */
+uint16_t GlyphCache_Preload(GlyphCache_t *cache, const void *font, const uint16_t *codes, uint16_t count);
+
+/**
+ * @brief  Prazni keš, uključujući trajne glifove. Statistika ostaje.
+ */
+void GlyphCache_Flush(GlyphCache_t *cache);
+
+/**
+ * @brief  Vraća udio pogodaka u promilima (0..1000).
+ */
+uint16_t GlyphCache_HitRate(const GlyphCache_t *cache);
+
+/**
+ * @brief  Ispisuje statistiku keša u jednoj liniji.
+ * @note   Upiti, ušteđena čitanja fonta (pogoci), čitanja fonta i bajti,
+ *         izbacivanja, broj trajnih glifova i zauzeće trajnog dijela.
+ * @retval uint32_t Broj upisanih znakova (bez završne nule).
+ */
+uint32_t GlyphCache_Report(const GlyphCache_t *cache, char *buf, uint32_t size);
+
+#endif // __GLYPH_CACHE_H__
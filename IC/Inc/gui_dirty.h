@@ -0,0 +1,120 @@
+/**
+ ******************************************************************************
+ * @file    gui_dirty.h
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Javni API za praćenje "prljavih" (dirty) pravougaonika ekrana.
+ *
+ * @note    Umjesto da svaka promjena stanja postavi `shouldDrawScreen` i time
+ * izazove `GUI_Clear()` i ponovno iscrtavanje cijelog ekrana 480x272,
+ * moduli označe samo pravougaonik pogođene ikonice, pločice ili
+ * labele. Ekran zatim iscrtava samo uniju označenih pravougaonika.
+ * Modul ne zavisi od emWin-a ni HAL-a; `GuiRect_t` ima isti raspored
+ * kao `GUI_RECT`, pa `display.c` može direktno predati koordinate
+ * funkcijama `GUI_SetClipRect()` i `GUI_ClearRectEx()`.
+ ******************************************************************************
+ */
+
+#ifndef __GUI_DIRTY_H__
+#define __GUI_DIRTY_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*============================================================================*/
+/* JAVNE DEFINICIJE I STRUKTURE                                               */
+/*============================================================================*/
+
+/** @brief Maksimalan broj odvojenih pravougaonika prije prisilnog spajanja. */
+#define GUI_DIRTY_MAX_RECTS         8U
+
+/**
+ * @brief Ako unija pokrije ovoliki dio ekrana (u procentima), iscrtava se
+ * cijeli ekran - jedan veliki prolaz je tada jeftiniji od više malih.
+ */
+#define GUI_DIRTY_FULL_PERCENT      75U
+
+/**
+ * @brief Pravougaonik sa uključivim koordinatama (isto kao `GUI_RECT`).
+ */
+typedef struct
+{
+    int16_t x0;
+    int16_t y0;
+    int16_t x1;
+    int16_t y1;
+} GuiRect_t;
+
+/**
+ * @brief Lista prljavih pravougaonika jednog ekrana i statistika iscrtavanja.
+ * @note  Pravougaonici u listi se nikad ne preklapaju, pa je zbir njihovih
+ * površina tačan broj piksela koji će biti ponovo iscrtani.
+ */
+typedef struct
+{
+    GuiRect_t rects[GUI_DIRTY_MAX_RECTS];   /**< Odvojeni prljavi pravougaonici. */
+    uint8_t   count;                        /**< Broj važećih pravougaonika. */
+    bool      full;                         /**< Cijeli ekran je prljav. */
+    int16_t   width;                        /**< Širina ekrana u pikselima. */
+    int16_t   height;                       /**< Visina ekrana u pikselima. */
+    uint32_t  last_pixels;                  /**< Pikseli iscrtani u zadnjem prolazu. */
+    uint32_t  total_pixels;                 /**< Ukupno iscrtanih piksela. */
+    uint32_t  redraws;                      /**< Broj prolaza iscrtavanja. */
+} GuiDirty_t;
+
+/*============================================================================*/
+/* JAVNE FUNKCIJE                                                             */
+/*============================================================================*/
+
+/**
+ * @brief  Inicijalizuje praznu listu za ekran zadanih dimenzija.
+ */
+void GuiDirty_Init(GuiDirty_t *dirty, int16_t width, int16_t height);
+
+/**
+ * @brief  Označava pravougaonik [x0..x1] x [y0..y1] kao prljav.
+ * @note   Pravougaonik se odsijeca na granice ekrana i spaja sa postojećim
+ * ako se preklapaju ili ako bi njihov zajednički okvir bio manji od
+ * zbira površina. Kada je lista puna, spaja se par koji najmanje
+ * povećava površinu.
+ */
+void GuiDirty_Invalidate(GuiDirty_t *dirty, int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+
+/**
+ * @brief  Označava cijeli ekran kao prljav (ekvivalent `shouldDrawScreen = 1`).
+ */
+void GuiDirty_InvalidateAll(GuiDirty_t *dirty);
+
+/**
+ * @brief  Provjerava da li ima išta za iscrtati.
+ */
+bool GuiDirty_IsEmpty(const GuiDirty_t *dirty);
+
+/**
+ * @brief  Vraća broj pravougaonika koje treba iscrtati (1 ako je `full`).
+ */
+uint8_t GuiDirty_Count(const GuiDirty_t *dirty);
+
+/**
+ * @brief  Vraća i-ti pravougaonik za iscrtavanje.
+ * @retval bool `false` ako je indeks van opsega.
+ */
+bool GuiDirty_Get(const GuiDirty_t *dirty, uint8_t index, GuiRect_t *rect);
+
+/**
+ * @brief  Provjerava da li se pravougaonik siječe sa nekim prljavim.
+ * @note   Služi ekranima da preskoče elemente koji ne trebaju ponovno crtanje.
+ */
+bool GuiDirty_Intersects(const GuiDirty_t *dirty, const GuiRect_t *rect);
+
+/**
+ * @brief  Vraća broj piksela koji će biti iscrtani.
+ */
+uint32_t GuiDirty_Pixels(const GuiDirty_t *dirty);
+
+/**
+ * @brief  Zatvara prolaz iscrtavanja: ažurira statistiku i prazni listu.
+ * @retval uint32_t Broj iscrtanih piksela u ovom prolazu.
+ */
+uint32_t GuiDirty_Commit(GuiDirty_t *dirty);
+
+#endif // __GUI_DIRTY_H__
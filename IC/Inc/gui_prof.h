@@ -0,0 +1,155 @@
+/**
+ ******************************************************************************
+ * @file    gui_prof.h
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Javni API za mjerenje trajanja iscrtavanja brojačem ciklusa.
+ *
+ * @note    Mjeri se, u µs:
+ *  - trajanje `Service_*` funkcije aktivnog ekrana (histogram po ekranu),
+ *  - trajanje `GUI_Exec()` prolaza,
+ *  - kašnjenje od dodira (`TS_Service`) do prikaza prvog bafera iscrtanog
+ *    nakon njega (zamjena bafera u prekidu LTDC-a),
+ * i zauzeće DMA2D-a u procentima po prozoru od `GUI_PROF_WINDOW_US`.
+ *
+ * Histogram ima logaritamske korpe (`GuiHist_t`), pa se p50/p95 čitaju kao
+ * gornja granica korpe (tačnost faktor 2) bez čuvanja uzoraka.
+ *
+ * Vrijeme provedeno u samom mjerenju se broji po prozoru. Ako pređe budžet
+ * (`budget_permille`), mjeri se samo svaki n-ti prolaz glavne petlje (n se
+ * udvostručava do `GUI_PROF_MAX_DECIMATION`); ispod pola budžeta n se
+ * prepolovi. Na mjerenom prolazu se čitaju i brojači DMA2D-a i zamjena
+ * bafera, pa preskočen prolaz košta samo brojanje. `GUI_Exec()` i dodir su
+ * ograničeni vsync-om, odnosno kontrolerom dodira, pa se mjere uvijek.
+ * Sve ulaze daje `display.c` preko `GuiProfOps_t`, pa se modul provjerava
+ * na hostu.
+ ******************************************************************************
+ */
+
+#ifndef __GUI_PROF_H__
+#define __GUI_PROF_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*============================================================================*/
+/* JAVNE DEFINICIJE I STRUKTURE                                               */
+/*============================================================================*/
+
+#define GUI_PROF_BINS               18U         /**< Korpa 0: < 2 µs, korpa i: [2^i, 2^(i+1)) µs, zadnja: >= 131 ms. */
+#define GUI_PROF_MAX_SCREENS        64U         /**< Histogrami po eScreen. */
+#define GUI_PROF_MAX_DECIMATION     64U         /**< Najrjeđe mjerenje servisa ekrana (1/n prolaza). */
+#define GUI_PROF_WINDOW_US          1000000U    /**< Prozor za zauzeće DMA2D-a i cijenu mjerenja. */
+#define GUI_PROF_TOUCH_TIMEOUT_US   500000U     /**< Dodir bez prikaza novog bafera u ovom roku se ne mjeri. */
+
+/**
+ * @brief Histogram trajanja u µs.
+ * @note  Kad se korpa napuni, sve korpe se prepolove; `count`, `sum_us` i
+ * `max_us` ostaju tačni.
+ */
+typedef struct
+{
+    uint32_t count;                 /**< Broj uzoraka. */
+    uint64_t sum_us;                /**< Zbir uzoraka. */
+    uint32_t last_us;               /**< Zadnji uzorak. */
+    uint32_t max_us;                /**< Najduži uzorak. */
+    uint16_t bins[GUI_PROF_BINS];   /**< Relativan broj uzoraka po korpi. */
+} GuiHist_t;
+
+/**
+ * @brief Izvori stanja.
+ * @note  Brojače zauzeća DMA2D-a i zamjena bafera vodi LCDConf.c u prekidima.
+ */
+typedef struct
+{
+    uint32_t (*now)(void);              /**< Brojač ciklusa (DWT->CYCCNT). */
+    uint32_t (*dma_busy)(void);         /**< Ukupni ciklusi zauzeća DMA2D-a (prelijeva se). */
+    uint32_t (*flips)(void);            /**< Broj zamjena prikazanog bafera. */
+    uint32_t (*flip_time)(void);        /**< Vrijeme zadnje zamjene (ciklusi). */
+    bool     (*buffer_pending)(void);   /**< Iscrtan bafer čeka zamjenu. */
+} GuiProfOps_t;
+
+/**
+ * @brief Stanje i statistika mjerenja.
+ */
+typedef struct
+{
+    const GuiProfOps_t *ops;
+    uint32_t  cycles_per_us;        /**< Takt jezgre u MHz. */
+    uint16_t  budget_permille;      /**< Najveća dozvoljena cijena mjerenja (promila vremena). */
+    uint32_t  probe_cycles;         /**< Cijena čitanja brojača pozivaoca (mjereno pri init-u). */
+    uint32_t  skip_cycles;          /**< Cijena preskočenog prolaza (mjereno pri init-u). */
+    GuiHist_t screen[GUI_PROF_MAX_SCREENS];
+    GuiHist_t exec;                 /**< `GUI_Exec()`. */
+    GuiHist_t touch;                /**< Dodir -> prikaz. */
+    uint8_t   decimation;           /**< Mjeri se 1 od `decimation` prolaza servisa ekrana. */
+    uint8_t   skipped;              /**< Preskočeni prolazi od zadnjeg mjerenja. */
+    uint32_t  window_start;         /**< Početak prozora (ciklusi). */
+    uint32_t  window_cost;          /**< Ciklusi mjerenja u prozoru. */
+    uint32_t  dma_last;             /**< Zadnje stanje brojača zauzeća DMA2D-a. */
+    uint32_t  dma_window;           /**< Ciklusi zauzeća DMA2D-a u prozoru. */
+    uint64_t  dma_total;            /**< Ukupni ciklusi zauzeća DMA2D-a. */
+    uint16_t  dma_permille;         /**< Zauzeće DMA2D-a u zadnjem prozoru. */
+    uint16_t  dma_max_permille;     /**< Najveće zauzeće DMA2D-a u prozoru. */
+    uint16_t  cost_permille;        /**< Cijena mjerenja u zadnjem prozoru. */
+    uint16_t  cost_max_permille;    /**< Najveća cijena mjerenja u prozoru. */
+    bool      touch_pending;        /**< Dodir čeka prikaz. */
+    uint32_t  touch_start;          /**< Vrijeme dodira (ciklusi). */
+    uint32_t  touch_flip;           /**< Redni broj zamjene bafera koja prikazuje odziv na dodir. */
+    uint32_t  touch_dropped;        /**< Dodiri bez novog bafera u `GUI_PROF_TOUCH_TIMEOUT_US`. */
+} GuiProf_t;
+
+/*============================================================================*/
+/* JAVNE FUNKCIJE                                                             */
+/*============================================================================*/
+
+/**
+ * @brief  Dodaje uzorak u histogram.
+ */
+void GuiHist_Add(GuiHist_t *hist, uint32_t us);
+
+/**
+ * @brief  Vraća gornju granicu korpe u kojoj je `pct` % uzoraka (najviše `max_us`).
+ * @retval uint32_t Trajanje u µs, 0 za prazan histogram.
+ */
+uint32_t GuiHist_Percentile(const GuiHist_t *hist, uint8_t pct);
+
+/**
+ * @brief  Inicijalizuje mjerenje.
+ * @param  cycles_per_us   Takt brojača ciklusa u MHz.
+ * @param  budget_permille Najveća cijena mjerenja u promilima vremena.
+ */
+void GuiProf_Init(GuiProf_t *prof, const GuiProfOps_t *ops, uint32_t cycles_per_us, uint16_t budget_permille);
+
+/**
+ * @brief  Bilježi prolaz servisa ekrana `screen` započet u `start` (ciklusi).
+ * @note   Pozivalac čita `start` sa `ops->now()` prije servisa. Na mjerenom
+ *         prolazu se obrađuju i prozor, zauzeće DMA2D-a i prikaz nakon dodira;
+ *         kašnjenje dodira je zato tačno do razmaka mjerenih prolaza, a ako je
+ *         između njih bilo više zamjena, uzima se vrijeme zadnje.
+ */
+void GuiProf_Pass(GuiProf_t *prof, uint8_t screen, uint32_t start);
+
+/**
+ * @brief  Bilježi trajanje `GUI_Exec()` prolaza.
+ */
+void GuiProf_Exec(GuiProf_t *prof, uint32_t exec_us);
+
+/**
+ * @brief  Bilježi dodir; mjeri se samo ako prethodni ne čeka prikaz.
+ * @note   Odziv je u prvom baferu iscrtanom nakon dodira: ako bafer već
+ *         čeka zamjenu, to je druga sljedeća zamjena.
+ */
+void GuiProf_Touch(GuiProf_t *prof);
+
+/**
+ * @brief  Briše histograme i brojače (budžet i takt ostaju).
+ */
+void GuiProf_Reset(GuiProf_t *prof);
+
+/**
+ * @brief  Ispisuje statistiku: GUI_Exec, dodir, DMA2D, cijena, pa ekrani.
+ * @retval uint32_t Broj upisanih znakova (bez završne nule).
+ */
+uint32_t GuiProf_Report(const GuiProf_t *prof, char *buf, uint32_t size);
+
+#endif // __GUI_PROF_H__
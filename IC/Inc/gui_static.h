@@ -0,0 +1,170 @@
+/**
+ ******************************************************************************
+ * @file    gui_static.h
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Javni API za keširanje statičkog sloja ekrana u memorijskom uređaju.
+ *
+ * @note    Pozadina, okviri, labele i hamburger meni se ne mijenjaju između
+ * dva osvježavanja ekrana, a ipak su se crtali iznova svaki put. Statički
+ * dio ekrana se sada iscrta jednom u emWin memorijski uređaj (hip je u
+ * SDRAM-u), a svako sljedeće osvježavanje je samo kopiranje (blit) plus
+ * dinamički elementi. Sadržaj zastarijeva promjenom jezika, teme ili
+ * konfiguracije (`GuiStatic_InvalidateAll()`).
+ * Modul vodi samo evidenciju: koji ekran drži koji uređaj, da li je
+ * sadržaj važeći i koliko traje iscrtavanje. Uređaje pravi
+ * `display.c` preko `GuiStaticOps_t`, pa modul ne zavisi od emWin-a ni
+ * HAL-a.
+ ******************************************************************************
+ */
+
+#ifndef __GUI_STATIC_H__
+#define __GUI_STATIC_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*============================================================================*/
+/* JAVNE DEFINICIJE I STRUKTURE                                               */
+/*============================================================================*/
+
+/**
+ * @brief Broj memorijskih uređaja. Jedan uređaj 480x272 ARGB8888 zauzima
+ * ~510 KB od 2 MB emWin hipa, ostatak ostaje za widgete.
+ */
+#define GUI_STATIC_MAX_SLOTS        2U
+
+/** @brief `GuiStatic_Release()`: ne zadržava uređaj nijednog ekrana. */
+#define GUI_STATIC_RELEASE_ALL      0xFFU
+
+/** @brief Broj ekrana za koje se vodi statistika vremena. */
+#define GUI_STATIC_MAX_SCREENS      8U
+
+/**
+ * @brief Šta ekran treba uraditi sa statičkim slojem.
+ */
+typedef enum
+{
+    GUI_STATIC_BLIT = 0,    /**< Sadržaj je važeći, dovoljno ga je kopirati. */
+    GUI_STATIC_RENDER,      /**< Uređaj postoji, ali statički dio treba iscrtati u njega. */
+    GUI_STATIC_DIRECT       /**< Nema memorije, statički dio se crta direktno na ekran. */
+} GuiStaticState_t;
+
+/**
+ * @brief Vrste mjerenja vremena.
+ */
+typedef enum
+{
+    GUI_STATIC_TIME_RENDER = 0, /**< Iscrtavanje statičkog dijela u uređaj. */
+    GUI_STATIC_TIME_BLIT,       /**< Kopiranje uređaja na ekran. */
+    GUI_STATIC_TIME_DIRECT,     /**< Iscrtavanje statičkog dijela bez keša. */
+    GUI_STATIC_TIME_DYNAMIC,    /**< Iscrtavanje dinamičkih elemenata. */
+    GUI_STATIC_TIME_COUNT
+} GuiStaticTime_t;
+
+/**
+ * @brief Pravljenje i brisanje memorijskog uređaja veličine ekrana.
+ * @note  Uređaj ima format piksela LCD sloja (`layer`), da bi kopiranje na
+ * ekran bilo bez konverzije. `create` vraća 0 kad u hipu nema mjesta.
+ */
+typedef struct
+{
+    uint32_t (*create)(uint8_t layer);
+    void     (*destroy)(uint32_t handle);
+} GuiStaticOps_t;
+
+/**
+ * @brief Jedan memorijski uređaj i ekran kojem trenutno pripada.
+ */
+typedef struct
+{
+    uint32_t handle;        /**< Handle uređaja, 0 ako nije napravljen. */
+    uint8_t  screen;        /**< Vlasnik (eScreen). */
+    uint8_t  layer;         /**< LCD sloj čiji format uređaj ima. */
+    uint32_t generation;    /**< Generacija sadržaja; važeći ako je jednaka trenutnoj. */
+    uint32_t last_use;      /**< Vrijeme zadnjeg korištenja (LRU). */
+} GuiStaticSlot_t;
+
+/**
+ * @brief Statistika jednog ekrana.
+ */
+typedef struct
+{
+    uint8_t  screen;                            /**< eScreen, 0 ako je zapis slobodan. */
+    uint32_t count[GUI_STATIC_TIME_COUNT];      /**< Broj mjerenja po vrsti. */
+    uint32_t total_us[GUI_STATIC_TIME_COUNT];   /**< Zbir vremena po vrsti u µs. */
+    uint32_t last_us[GUI_STATIC_TIME_COUNT];    /**< Zadnje vrijeme po vrsti u µs. */
+} GuiStaticStats_t;
+
+/**
+ * @brief Stanje keša statičkih slojeva.
+ */
+typedef struct
+{
+    GuiStaticSlot_t       slots[GUI_STATIC_MAX_SLOTS];    /**< Memorijski uređaji. */
+    GuiStaticStats_t      stats[GUI_STATIC_MAX_SCREENS];  /**< Statistika po ekranu. */
+    const GuiStaticOps_t *ops;                            /**< Pravljenje/brisanje uređaja. */
+    uint32_t              generation;                     /**< Trenutna generacija sadržaja. */
+    uint32_t              clock;                          /**< Brojač korištenja za LRU. */
+    uint32_t              create_failures;                /**< Koliko puta hip nije imao mjesta. */
+    uint32_t              releases;                       /**< Uređaji obrisani zbog nedostatka memorije. */
+} GuiStaticCache_t;
+
+/*============================================================================*/
+/* JAVNE FUNKCIJE                                                             */
+/*============================================================================*/
+
+/**
+ * @brief  Inicijalizuje prazan keš. Uređaji se prave tek kad zatrebaju.
+ */
+void GuiStatic_Init(GuiStaticCache_t *cache, const GuiStaticOps_t *ops);
+
+/**
+ * @brief  Proglašava sve statičke slojeve zastarjelim (jezik, tema, konfiguracija).
+ * @note   Uređaji ostaju alocirani i ponovo se koriste.
+ */
+void GuiStatic_InvalidateAll(GuiStaticCache_t *cache);
+
+/**
+ * @brief  Proglašava statički sloj jednog ekrana zastarjelim.
+ */
+void GuiStatic_InvalidateScreen(GuiStaticCache_t *cache, uint8_t screen);
+
+/**
+ * @brief  Vraća uređaj ekrana i šta treba uraditi s njim.
+ * @note   Ekran bez uređaja dobija slobodan uređaj, a ako ga nema, najdavnije
+ *         korišteni uređaj drugog ekrana. Uređaj istog sloja se samo preuzima
+ *         (isti format i veličina), a uređaj drugog sloja se briše i pravi novi.
+ * @param  layer LCD sloj na koji ekran crta statički dio.
+ * @param  handle Izlaz: handle uređaja (0 za GUI_STATIC_DIRECT).
+ */
+GuiStaticState_t GuiStatic_Acquire(GuiStaticCache_t *cache, uint8_t screen, uint8_t layer, uint32_t *handle);
+
+/**
+ * @brief  Briše uređaje svih ekrana osim `keep_screen` da se oslobodi hip.
+ * @note   Ekran čiji je uređaj obrisan dobija novi pri sljedećem
+ *         `GuiStatic_Acquire()` (ili crta direktno ako mjesta i dalje nema).
+ * @param  keep_screen Ekran čiji uređaj ostaje, `GUI_STATIC_RELEASE_ALL` za nijedan.
+ * @retval uint8_t Broj obrisanih uređaja.
+ */
+uint8_t GuiStatic_Release(GuiStaticCache_t *cache, uint8_t keep_screen);
+
+/**
+ * @brief  Javlja da je statički dio ekrana upravo iscrtan u njegov uređaj.
+ */
+void GuiStatic_Rendered(GuiStaticCache_t *cache, uint8_t screen);
+
+/**
+ * @brief  Bilježi jedno mjerenje vremena za ekran.
+ */
+void GuiStatic_Record(GuiStaticCache_t *cache, uint8_t screen, GuiStaticTime_t kind, uint32_t us);
+
+/**
+ * @brief  Ispisuje izvještaj o vremenima po ekranu.
+ * @note   Po liniji: ekran, prosjek iscrtavanja statičkog dijela, prosjek
+ *         kopiranja, prosjek dinamičkog dijela i ubrzanje osvježavanja
+ *         ((statički + dinamički) / (kopiranje + dinamički)).
+ * @retval uint32_t Broj upisanih znakova (bez završne nule).
+ */
+uint32_t GuiStatic_Report(const GuiStaticCache_t *cache, char *buf, uint32_t size);
+
+#endif // __GUI_STATIC_H__
@@ -0,0 +1,134 @@
+/**
+ ******************************************************************************
+ * @file    gui_tree.h
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Javni API vlasništva nad widgetima: jedno stablo po ekranu.
+ *
+ * @note    Ekrani prave widgete direktno na desktopu, a `DSP_Kill*` funkcije
+ * ih brišu jedan po jedan. Svaki propušteni widget je ostajao kao "duh",
+ * pa je glavna petlja periodično brisala sve poznate ID-jeve. Sada svaki
+ * ekran ima korijenski prozor po LCD sloju: widgeti koje ekran napravi
+ * se pri sljedećem `GuiTree_Sync()` premještaju pod njegov korijen. Pri
+ * izlasku sa ekrana korijen se briše zajedno sa svim što je ostalo ispod
+ * njega, a korijen trajnog ekrana (`GuiTree_SetPersistent()`) se samo
+ * sakrije i pri povratku ponovo prikaže, bez pravljenja widgeta.
+ * Modul vodi evidenciju i mjeri prelaz između ekrana i zauzeće GUI hipa;
+ * prozore pravi `display.c` preko `GuiTreeOps_t`, pa modul ne zavisi od
+ * emWin-a ni HAL-a.
+ ******************************************************************************
+ */
+
+#ifndef __GUI_TREE_H__
+#define __GUI_TREE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*============================================================================*/
+/* JAVNE DEFINICIJE I STRUKTURE                                               */
+/*============================================================================*/
+
+/** @brief Broj ekrana (eScreen) za koje se vodi stablo. */
+#define GUI_TREE_MAX_SCREENS        64U
+
+/** @brief Broj LCD slojeva. */
+#define GUI_TREE_LAYERS             2U
+
+/**
+ * @brief Operacije nad prozorima i mjerenje vremena.
+ * @note  `adopt` premješta pod `root` sve widgete sa desktopa sloja `layer`
+ * koji nisu korijeni i vraća njihov broj; sa `root` 0 ih samo prebroji.
+ * `destroy` briše korijen sa svom djecom i vraća broj djece koja su još
+ * postojala (widgeti koje `DSP_Kill*` nije obrisao).
+ */
+typedef struct
+{
+    uint32_t (*create_root)(uint8_t layer);
+    uint16_t (*destroy)(uint32_t root);
+    void     (*show)(uint32_t root, bool visible);
+    uint16_t (*adopt)(uint8_t layer, uint32_t root);
+    uint32_t (*heap_used)(void);
+    uint32_t (*now)(void);
+    uint32_t (*elapsed_us)(uint32_t start);
+} GuiTreeOps_t;
+
+/**
+ * @brief Stablo i statistika jednog ekrana.
+ */
+typedef struct
+{
+    uint32_t root[GUI_TREE_LAYERS];     /**< Korijen po sloju, 0 ako nije napravljen. */
+    bool     persistent;                /**< Stablo se pri izlasku skriva umjesto briše. */
+    bool     shown;                     /**< Korijeni su vidljivi. */
+    uint16_t widgets;                   /**< Broj widgeta u stablu. */
+    uint32_t enters;                    /**< Broj ulazaka na ekran. */
+    uint32_t builds;                    /**< Ulasci na kojima su widgeti pravljeni. */
+    uint32_t reuses;                    /**< Ulasci na kojima je postojeće stablo samo prikazano. */
+    uint32_t transition_last_us;        /**< Trajanje zadnjeg prelaza na ekran u µs. */
+    uint32_t transition_max_us;         /**< Najduži prelaz na ekran u µs. */
+    uint32_t heap_peak;                 /**< Najveće zauzeće GUI hipa dok je ekran aktivan. */
+} GuiTreeScreen_t;
+
+/**
+ * @brief Stanje svih stabala i statistika.
+ */
+typedef struct
+{
+    GuiTreeScreen_t     screens[GUI_TREE_MAX_SCREENS];  /**< Stabla po ekranu. */
+    const GuiTreeOps_t *ops;                            /**< Operacije nad prozorima. */
+    uint8_t             current;                        /**< Ekran čije je stablo aktivno. */
+    bool                started;                        /**< `current` je važeći. */
+    bool                measuring;                      /**< Prelaz na `current` je u toku. */
+    bool                built;                          /**< U toku prelaza su pravljeni widgeti. */
+    uint32_t            transition_start;               /**< Početak prelaza (`ops->now`). */
+    uint32_t            last_sync;                      /**< Vrijeme prethodnog `GuiTree_Sync()`. */
+    uint32_t            adopted;                        /**< Ukupno preuzetih widgeta. */
+    uint32_t            leaked;                         /**< Widgeti obrisani tek sa korijenom. */
+    uint32_t            heap_peak;                      /**< Najveće izmjereno zauzeće GUI hipa. */
+} GuiTree_t;
+
+/*============================================================================*/
+/* JAVNE FUNKCIJE                                                             */
+/*============================================================================*/
+
+/**
+ * @brief  Inicijalizuje evidenciju bez stabala. Korijeni se prave tek kad
+ *         ekran napravi prvi widget.
+ */
+void GuiTree_Init(GuiTree_t *tree, const GuiTreeOps_t *ops);
+
+/**
+ * @brief  Označava ekran čije stablo preživljava izlazak sa ekrana.
+ */
+void GuiTree_SetPersistent(GuiTree_t *tree, uint8_t screen);
+
+/**
+ * @brief  Usklađuje stabla sa aktivnim ekranom.
+ * @note   Poziva se u svakom prolazu glavne petlje prije `GUI_Exec()`, i iz
+ *         `Init` funkcije ekrana nakon pravljenja widgeta. Pri promjeni
+ *         ekrana napušta stablo prethodnog (skriva trajno, briše ostala) i
+ *         prikazuje stablo novog ekrana. Zatim premješta nove widgete sa
+ *         desktopa pod korijen aktivnog ekrana. Prelaz se mjeri od
+ *         prethodnog poziva do prvog poziva (nakon onog koji je primijetio
+ *         promjenu) u kojem više nema novih widgeta.
+ */
+void GuiTree_Sync(GuiTree_t *tree, uint8_t screen);
+
+/**
+ * @brief  Skriva stablo trajnog ekrana.
+ * @note   Za `DSP_Kill*` funkcije trajnih ekrana; sljedeći `GuiTree_Sync()`
+ *         dok je ekran aktivan ga ponovo prikazuje.
+ */
+void GuiTree_Hide(GuiTree_t *tree, uint8_t screen);
+
+/**
+ * @brief  Ispisuje izvještaj o stablima i prelazima po ekranu.
+ * @note   Prva linija: ukupno preuzetih widgeta, widgeta obrisanih tek sa
+ *         korijenom i najveće zauzeće hipa. Zatim po posjećenom ekranu: broj
+ *         ulazaka, pravljenja i ponovnih prikaza, broj widgeta, zadnji i
+ *         najduži prelaz i najveće zauzeće hipa.
+ * @retval uint32_t Broj upisanih znakova (bez završne nule).
+ */
+uint32_t GuiTree_Report(const GuiTree_t *tree, char *buf, uint32_t size);
+
+#endif // __GUI_TREE_H__
@@ -0,0 +1,128 @@
+/**
+ ******************************************************************************
+ * @file    icon_cache.h
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Javni API za keš ikonica u SDRAM-u sa LRU izbacivanjem.
+ *
+ * @note    Bitmape ikonica su u `.flash_rom` sekciji na QSPI flešu i svako
+ * iscrtavanje ih čita preko QSPI sabirnice (4 bajta po pikselu za
+ * ARGB8888). Keš kopira često crtane bitmape u dio SDRAM-a koji nije
+ * zauzet frame baferima ni `.gui_ram` hipom i vraća pokazivač na kopiju.
+ * Ikonica ulazi u keš tek kad je nacrtana `ICON_CACHE_PROMOTE_DRAWS`
+ * puta (jednokratne bitmape ne izbacuju korisne), ili odmah preko
+ * `IconCache_Preload()` kad se ulazi na ekran. Kad budžet nije dovoljan,
+ * izbacuje se najdavnije korištena ikonica. Modul ne zavisi od emWin-a
+ * ni HAL-a; ključ je adresa izvorne bitmape.
+ ******************************************************************************
+ */
+
+#ifndef __ICON_CACHE_H__
+#define __ICON_CACHE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*============================================================================*/
+/* JAVNE DEFINICIJE I STRUKTURE                                               */
+/*============================================================================*/
+
+/** @brief Maksimalan broj ikonica u kešu istovremeno. */
+#define ICON_CACHE_MAX_ENTRIES      64U
+
+/** @brief Broj promašaja koje keš pamti dok ne odluči o promociji. */
+#define ICON_CACHE_MAX_CANDIDATES   16U
+
+/** @brief Broj iscrtavanja nakon kojeg se ikonica kopira u SDRAM. */
+#define ICON_CACHE_PROMOTE_DRAWS    2U
+
+/** @brief Poravnanje kopija u bazenu (DMA2D čita 32-bitne riječi). */
+#define ICON_CACHE_ALIGN            4U
+
+/**
+ * @brief Funkcija kopiranja izvora u keš.
+ * @note  Na ploči `memcpy` uz održavanje D-keša, na hostu samo `memcpy`.
+ */
+typedef void (*IconCacheCopy_t)(void *dst, const void *src, uint32_t size);
+
+/**
+ * @brief Jedna ikonica u kešu.
+ */
+typedef struct
+{
+    const void *key;        /**< Adresa izvorne bitmape. */
+    uint32_t    offset;     /**< Pozicija kopije u bazenu. */
+    uint32_t    size;       /**< Veličina kopije u bajtima (poravnata). */
+    uint32_t    last_use;   /**< Vrijeme zadnjeg korištenja (LRU). */
+} IconCacheEntry_t;
+
+/**
+ * @brief Kandidat za promociju (ikonica koja još nije u kešu).
+ */
+typedef struct
+{
+    const void *key;        /**< Adresa izvorne bitmape. */
+    uint32_t    last_use;   /**< Vrijeme zadnjeg iscrtavanja. */
+    uint8_t     draws;      /**< Broj iscrtavanja bez keša. */
+} IconCacheCandidate_t;
+
+/**
+ * @brief Stanje keša i statistika.
+ * @note  `entries` su sortirani po `offset`, pa se slobodan prostor traži
+ * prolaskom kroz rupe između susjednih kopija.
+ */
+typedef struct
+{
+    uint8_t             *pool;                                  /**< Bazen u SDRAM-u. */
+    uint32_t             budget;                                /**< Veličina bazena u bajtima. */
+    uint32_t             used;                                  /**< Zauzeto bajta. */
+    IconCacheCopy_t      copy;                                  /**< Kopiranje u bazen. */
+    IconCacheEntry_t     entries[ICON_CACHE_MAX_ENTRIES];       /**< Ikonice u kešu. */
+    uint8_t              count;                                 /**< Broj ikonica u kešu. */
+    IconCacheCandidate_t candidates[ICON_CACHE_MAX_CANDIDATES]; /**< Kandidati za promociju. */
+    uint32_t             clock;                                 /**< Brojač korištenja za LRU. */
+    uint32_t             hits;                                  /**< Iscrtavanja iz keša. */
+    uint32_t             misses;                                /**< Iscrtavanja iz izvora. */
+    uint32_t             promotions;                            /**< Kopiranja u keš. */
+    uint32_t             evictions;                             /**< Izbačene ikonice. */
+    uint32_t             source_bytes;                          /**< Bajta pročitano iz izvora (QSPI). */
+    uint32_t             cache_bytes;                           /**< Bajta pročitano iz keša (SDRAM). */
+} IconCache_t;
+
+/*============================================================================*/
+/* JAVNE FUNKCIJE                                                             */
+/*============================================================================*/
+
+/**
+ * @brief  Inicijalizuje prazan keš nad zadanim bazenom.
+ * @param  pool Početak bazena (poravnat na ICON_CACHE_ALIGN).
+ * @param  budget Koliko bajta bazena keš smije zauzeti.
+ */
+void IconCache_Init(IconCache_t *cache, uint8_t *pool, uint32_t budget, IconCacheCopy_t copy);
+
+/**
+ * @brief  Vraća podatke bitmape za iscrtavanje.
+ * @param  key Adresa izvorne bitmape (ključ).
+ * @param  src Podaci bitmape u izvoru.
+ * @param  size Veličina podataka u bajtima.
+ * @retval const void* Kopija u SDRAM-u ako je ikonica u kešu ili je upravo
+ *         promovisana, inače `src`.
+ */
+const void *IconCache_Get(IconCache_t *cache, const void *key, const void *src, uint32_t size);
+
+/**
+ * @brief  Kopira bitmapu u keš bez čekanja na promociju (ulazak na ekran).
+ * @retval bool `true` ako je bitmapa u kešu nakon poziva.
+ */
+bool IconCache_Preload(IconCache_t *cache, const void *key, const void *src, uint32_t size);
+
+/**
+ * @brief  Prazni keš. Statistika ostaje.
+ */
+void IconCache_Flush(IconCache_t *cache);
+
+/**
+ * @brief  Vraća udio pogodaka u promilima (0..1000).
+ */
+uint16_t IconCache_HitRate(const IconCache_t *cache);
+
+#endif // __ICON_CACHE_H__
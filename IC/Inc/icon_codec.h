@@ -0,0 +1,118 @@
+/**
+ ******************************************************************************
+ * @file    icon_codec.h
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Kompaktni formati ikonica i njihovo dekodiranje.
+ *
+ * @note    Ikonice iz emWin Bitmap Convertera su ARGB8888 (4 bajta po
+ * pikselu), iako je većina jednobojna sa alfom ili ima malo boja.
+ * Alat `Tools/iconconv` za svaku ikonicu bira najmanji format bez
+ * gubitaka, a ovaj modul ih čita:
+ * - A8:       alfa po pikselu + jedna boja (DMA2D FG format A8 + FGCOLR),
+ * - L8:       indeks po pikselu + paleta do 256 ARGB boja (DMA2D CLUT),
+ * - RLE8:     L8 indeksi komprimovani po linijama,
+ * - RLE32:    ARGB8888 pikseli komprimovani po linijama,
+ * - ARGB8888: nekomprimovano, kada ništa drugo nije manje.
+ * Boje su u DMA2D formatu (alfa 0xFF = neprovidno), a ne u emWin formatu
+ * sa obrnutom alfom. Providni pikseli se uvijek svode na 0x00000000, jer
+ * im boja ne utiče na iscrtavanje. Modul ne zavisi od emWin-a ni HAL-a,
+ * pa ga koristi i konverter na hostu za provjeru dekodiranja.
+ *
+ * RLE linija je niz blokova sa kontrolnim bajtom `c`:
+ * c < 0x80  -> slijedi c+1 piksela doslovno,
+ * c >= 0x80 -> slijedi jedan piksel ponovljen (c - 0x7E) puta (2..129).
+ * Blokovi nikad ne prelaze kraj linije.
+ ******************************************************************************
+ */
+
+#ifndef __ICON_CODEC_H__
+#define __ICON_CODEC_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*============================================================================*/
+/* JAVNE DEFINICIJE I STRUKTURE                                               */
+/*============================================================================*/
+
+/**
+ * @brief Format podataka ikonice.
+ */
+typedef enum
+{
+    ICON_FMT_ARGB8888 = 0,  /**< 4 bajta po pikselu. */
+    ICON_FMT_A8,            /**< 1 bajt alfe po pikselu, boja u `color`. */
+    ICON_FMT_L8,            /**< 1 bajt indeksa po pikselu, paleta u `clut`. */
+    ICON_FMT_RLE8,          /**< RLE nad L8 indeksima. */
+    ICON_FMT_RLE32,         /**< RLE nad ARGB8888 pikselima. */
+    ICON_FMT_COUNT
+} IconFormat_t;
+
+/** @brief Najveći broj boja u paleti (L8/RLE8). */
+#define ICON_CODEC_MAX_COLORS       256U
+
+/**
+ * @brief Opis jedne kompaktne ikonice.
+ * @note  U `GUI_BITMAP` strukturi `pData` pokazuje na ovu strukturu, a
+ * `pMethods` na `GUI_DRAW_ICON` (vidi `LCDConf.h`).
+ */
+typedef struct
+{
+    uint16_t        format;     /**< IconFormat_t. */
+    uint16_t        colors;     /**< Broj boja u paleti (L8/RLE8). */
+    uint16_t        width;      /**< Širina u pikselima. */
+    uint16_t        height;     /**< Visina u pikselima. */
+    uint32_t        color;      /**< Boja za A8 (0x00RRGGBB). */
+    const uint32_t *clut;       /**< Paleta za L8/RLE8 (ARGB8888, DMA2D format). */
+    const uint8_t  *data;       /**< Podaci piksela. */
+    uint32_t        size;       /**< Veličina `data` u bajtima. */
+} IconImage_t;
+
+/**
+ * @brief Stanje čitanja ikonice linija po liniju.
+ */
+typedef struct
+{
+    const IconImage_t *image;   /**< Ikonica koja se čita. */
+    const uint8_t     *next;    /**< Početak sljedeće linije u `data`. */
+    uint16_t           line;    /**< Indeks sljedeće linije. */
+} IconCursor_t;
+
+/*============================================================================*/
+/* JAVNE FUNKCIJE                                                             */
+/*============================================================================*/
+
+/**
+ * @brief  Vraća broj bajta po pikselu koje `IconCodec_ReadLine()` upisuje
+ *         u "nativnom" načinu (1 za A8/L8/RLE8, 4 za ARGB8888/RLE32).
+ */
+uint8_t IconCodec_NativeBytes(const IconImage_t *image);
+
+/**
+ * @brief  Postavlja kursor na prvu liniju.
+ */
+void IconCodec_Begin(IconCursor_t *cursor, const IconImage_t *image);
+
+/**
+ * @brief  Preskače `count` linija.
+ * @note   Nekomprimovani formati skaču direktno, RLE linije se prolaze.
+ */
+void IconCodec_SkipLines(IconCursor_t *cursor, uint16_t count);
+
+/**
+ * @brief  Čita sljedeću liniju.
+ * @param  out Izlaz: `width` piksela.
+ * @param  argb `false`: nativni format (alfa za A8, indeksi za L8/RLE8, ARGB za ostale),
+ *              `true`: uvijek ARGB8888 u DMA2D formatu.
+ * @retval bool `false` ako su podaci oštećeni ili nema više linija.
+ */
+bool IconCodec_ReadLine(IconCursor_t *cursor, void *out, bool argb);
+
+/**
+ * @brief  Dekodira cijelu ikonicu u ARGB8888 (DMA2D format).
+ * @param  out Izlaz: `width * height` piksela.
+ * @retval bool `false` ako su podaci oštećeni.
+ */
+bool IconCodec_Decode(const IconImage_t *image, uint32_t *out);
+
+#endif // __ICON_CODEC_H__
@@ -0,0 +1,92 @@
+/**
+ ******************************************************************************
+ * @file    lang_pack.h
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Javni API za paket stringova aktivnog jezika u RAM-u.
+ *
+ * @note    Tabela `language_strings[TEXT_COUNT][LANGUAGE_COUNT]` drži svih
+ * 11 jezika isprepletenih po redovima, pa su stringovi jednog jezika
+ * razbacani po cijeloj tabeli. Pri promjeni jezika se stringovi aktivnog
+ * jezika kopiraju u kompaktan, neprekidan bazen sa indeksom (ofset po
+ * TXT_xxx ID-u), a `lng()` dalje čita samo iz tog bazena. Isti stringovi
+ * se u bazenu čuvaju jednom. Modul ne zavisi od HAL-a ni od `display.h`,
+ * pa ga koristi i alat `Tools/langpack` za provjeru tabele na hostu.
+ ******************************************************************************
+ */
+
+#ifndef __LANG_PACK_H__
+#define __LANG_PACK_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*============================================================================*/
+/* JAVNE DEFINICIJE I STRUKTURE                                               */
+/*============================================================================*/
+
+/**
+ * @brief Veličina bazena u bajtima. Najveći jezik (ukrajinski, UTF-8
+ * ćirilica) zauzima oko 3.9 KB; `Tools/langpack` javlja ako ne staje.
+ */
+#define LANG_PACK_POOL_SIZE         5120U
+
+/**
+ * @brief Rezultat pakovanja jezika.
+ */
+typedef enum
+{
+    LANG_PACK_OK = 0,       /**< Paket je napravljen. */
+    LANG_PACK_ERR_ARG,      /**< Neispravan jezik ili veličine. */
+    LANG_PACK_ERR_NULL,     /**< Tekst u tabeli je NULL. */
+    LANG_PACK_ERR_UTF8,     /**< Tekst nije ispravan UTF-8. */
+    LANG_PACK_ERR_SIZE      /**< Tekstovi ne staju u bazen (ili ofset u 16 bita). */
+} LangPackStatus_t;
+
+/**
+ * @brief Paket stringova jednog jezika.
+ * @note  Bazen i indeks daje pozivalac, da bi mogli biti u internom RAM-u
+ * ili SDRAM-u po izboru.
+ */
+typedef struct
+{
+    char     *pool;         /**< Bazen stringova (sa završnim nulama). */
+    uint32_t  pool_size;    /**< Veličina bazena. */
+    uint32_t  used;         /**< Zauzeto bajta u bazenu. */
+    uint16_t *index;        /**< Ofset stringa u bazenu po TXT_xxx ID-u. */
+    uint16_t  count;        /**< Broj tekstova (TEXT_COUNT). */
+    uint8_t   language;     /**< Jezik u paketu. */
+    bool      valid;        /**< Paket je napravljen bez greške. */
+    uint16_t  error_text;   /**< ID teksta zbog kojeg pakovanje nije uspjelo. */
+    uint16_t  duplicates;   /**< Broj tekstova koji dijele string sa ranijim. */
+} LangPack_t;
+
+/*============================================================================*/
+/* JAVNE FUNKCIJE                                                             */
+/*============================================================================*/
+
+/**
+ * @brief  Povezuje paket sa bazenom i indeksom. Paket ostaje nevažeći do
+ *         prvog uspješnog `LangPack_Build()`.
+ */
+void LangPack_Init(LangPack_t *pack, char *pool, uint32_t pool_size, uint16_t *index, uint16_t count);
+
+/**
+ * @brief  Pakuje jezik `language` iz tabele u bazen.
+ * @param  table Tabela `[count][language_count]` kao niz pokazivača.
+ * @note   Pri grešci paket postaje nevažeći, a `error_text` pokazuje na
+ *         tekst koji nije prošao provjeru.
+ */
+LangPackStatus_t LangPack_Build(LangPack_t *pack, const char *const *table, uint8_t language_count, uint8_t language);
+
+/**
+ * @brief  Vraća string po ID-u; nepoznat ID daje string ID-a 0.
+ * @note   Paket mora biti važeći.
+ */
+const char *LangPack_Get(const LangPack_t *pack, uint16_t id);
+
+/**
+ * @brief  Provjerava da li je string ispravan UTF-8 (bez "overlong" i surogata).
+ */
+bool LangPack_IsValidUtf8(const char *text);
+
+#endif // __LANG_PACK_H__
@@ -0,0 +1,179 @@
+/**
+ ******************************************************************************
+ * @file    mem_budget.h
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Javni API za praćenje GUI hipa i korisnika SDRAM-a.
+ *
+ * @note    emWin dobija 2 MB u `.gui_ram` (GUIConf.c) i ekrani iz njega
+ * prave memorijske uređaje, widgete i QR objekte. Nestanak memorije ili
+ * fragmentacija se do sada vidjeli tek kao greška na terenu. Modul prati:
+ *  - slobodne bajte, najveći slobodan blok i fragmentaciju hipa,
+ *  - po ekranu: broj ulazaka, najveći rast hipa iznad nivoa pri ulasku,
+ *    broj novih blokova (uzorkovano, donja granica) i velike alokacije
+ *    najavljene preko `MemBudget_Reserve()`,
+ *  - budžet rasta po ekranu (`MemBudget_SetBudget()`),
+ *  - mapu SDRAM-a (`MemRegion_t`): frame baferi, keševi i hip, sa
+ *    provjerom preklapanja regija.
+ *
+ * Upozorenje prije nego alokacija ne uspije: kad slobodnih bajta ili
+ * najvećeg bloka padne ispod praga, nivo prelazi u `MEM_LEVEL_WARN`
+ * odnosno `MEM_LEVEL_CRITICAL` i poziva se `ops->pressure()` da pozivalac
+ * oslobodi keševe (memorijske uređaje drugih ekrana). Velika alokacija se
+ * najavljuje sa `MemBudget_Reserve()`, koja je odbija ako bi iza nje ostalo
+ * manje od `critical_block` za widgete.
+ * Hip se čita samo preko `MemBudgetOps_t`, pa se modul provjerava na hostu
+ * sa simuliranim alokatorom.
+ ******************************************************************************
+ */
+
+#ifndef __MEM_BUDGET_H__
+#define __MEM_BUDGET_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*============================================================================*/
+/* JAVNE DEFINICIJE I STRUKTURE                                               */
+/*============================================================================*/
+
+/** @brief Broj ekrana (eScreen) za koje se vodi statistika. */
+#define MEM_BUDGET_MAX_SCREENS      64U
+
+/** @brief Najviše regija u mapi SDRAM-a. */
+#define MEM_BUDGET_MAX_REGIONS      8U
+
+/**
+ * @brief Period čitanja najvećeg slobodnog bloka (prolazi kroz listu
+ * slobodnih blokova emWin-a, pa se ne čita u svakom prolazu).
+ */
+#define MEM_BUDGET_LARGEST_MS       100U
+
+/**
+ * @brief Nivo zauzeća hipa.
+ */
+typedef enum
+{
+    MEM_LEVEL_OK = 0,       /**< Iznad pragova. */
+    MEM_LEVEL_WARN,         /**< Malo slobodnog ili nema bloka za memorijski uređaj. */
+    MEM_LEVEL_CRITICAL      /**< Najveći blok manji od rezerve za widgete. */
+} MemLevel_t;
+
+/**
+ * @brief Jedan korisnik SDRAM-a.
+ */
+typedef struct
+{
+    const char *name;               /**< Kratak naziv za izvještaj. */
+    uint32_t    base;               /**< Početna adresa. */
+    uint32_t    size;               /**< Veličina u bajtima. */
+    uint32_t  (*used)(void);        /**< Zauzeto bajta (NULL = cijela regija). */
+} MemRegion_t;
+
+/**
+ * @brief Stanje hipa i reakcija na nedostatak memorije.
+ */
+typedef struct
+{
+    uint32_t (*free_bytes)(void);       /**< Slobodno bajta u hipu. */
+    uint32_t (*largest_free)(void);     /**< Najveći blok koji se može alocirati. */
+    uint32_t (*used_blocks)(void);      /**< Broj zauzetih blokova. */
+    uint32_t (*ms)(void);               /**< Vrijeme u ms. */
+    void     (*pressure)(MemLevel_t level);  /**< Oslobodi keševe (opciono). */
+} MemBudgetOps_t;
+
+/**
+ * @brief Pragovi nivoa, u bajtima.
+ */
+typedef struct
+{
+    uint32_t warn_free;             /**< WARN ispod ovoliko slobodnih bajta. */
+    uint32_t warn_block;            /**< WARN ako nema bloka ove veličine (memorijski uređaj). */
+    uint32_t critical_block;        /**< CRITICAL ako nema bloka ove veličine (rezerva za widgete). */
+} MemBudgetLimits_t;
+
+/**
+ * @brief Statistika jednog ekrana.
+ */
+typedef struct
+{
+    uint32_t budget;                /**< Dozvoljeni rast hipa iznad nivoa pri ulasku (0 = bez budžeta). */
+    uint32_t entries;               /**< Broj ulazaka. */
+    uint32_t peak;                  /**< Najveći rast hipa iznad nivoa pri ulasku. */
+    uint32_t peak_used;             /**< Najveće zauzeće hipa dok je ekran aktivan. */
+    uint32_t allocs;                /**< Novi blokovi između uzoraka (donja granica). */
+    uint32_t reserves;              /**< Odobrene velike alokacije. */
+    uint32_t denied;                /**< Odbijene velike alokacije. */
+    uint32_t over_budget;           /**< Ulasci na kojima je rast prešao budžet. */
+} MemScreen_t;
+
+/**
+ * @brief Stanje i statistika.
+ */
+typedef struct
+{
+    const MemBudgetOps_t *ops;
+    MemBudgetLimits_t     limits;
+    uint32_t              heap_size;        /**< Veličina hipa. */
+    const MemRegion_t    *regions;          /**< Mapa SDRAM-a. */
+    uint8_t               region_count;
+    uint8_t               overlaps;         /**< Bit i: regija i se preklapa sa nekom drugom. */
+    MemScreen_t           screens[MEM_BUDGET_MAX_SCREENS];
+    bool                  started;          /**< Prvi uzorak je uzet. */
+    bool                  over;             /**< Rast na ovom ulasku je već prešao budžet. */
+    bool                  pending;          /**< Odbijena alokacija: `pressure` na sljedećem uzorku. */
+    uint8_t               screen;           /**< Aktivni ekran. */
+    uint32_t              entry_used;       /**< Zauzeće pri ulasku na aktivni ekran. */
+    uint32_t              used;             /**< Zadnje zauzeće. */
+    uint32_t              free;             /**< Zadnje slobodno. */
+    uint32_t              blocks;           /**< Zadnji broj zauzetih blokova. */
+    uint32_t              largest;          /**< Zadnji najveći slobodan blok. */
+    uint32_t              largest_ms;       /**< Vrijeme čitanja `largest`. */
+    uint32_t              peak_used;        /**< Najveće zauzeće. */
+    uint32_t              min_largest;      /**< Najmanji najveći slobodan blok. */
+    uint16_t              frag_permille;    /**< Fragmentacija: 1 - najveći blok / slobodno. */
+    uint16_t              max_frag_permille;
+    MemLevel_t            level;            /**< Trenutni nivo. */
+    uint32_t              warnings;         /**< Prelazi u WARN. */
+    uint32_t              criticals;        /**< Prelazi u CRITICAL. */
+    uint32_t              pressures;        /**< Pozivi `ops->pressure()`. */
+} MemBudget_t;
+
+/*============================================================================*/
+/* JAVNE FUNKCIJE                                                             */
+/*============================================================================*/
+
+/**
+ * @brief  Inicijalizuje praćenje i provjerava da se regije ne preklapaju.
+ * @param  regions Mapa SDRAM-a (može biti NULL), najviše `MEM_BUDGET_MAX_REGIONS`.
+ */
+void MemBudget_Init(MemBudget_t *mb, const MemBudgetOps_t *ops, uint32_t heap_size, const MemBudgetLimits_t *limits,
+                    const MemRegion_t *regions, uint8_t region_count);
+
+/**
+ * @brief  Postavlja budžet rasta hipa za ekran (bajta iznad nivoa pri ulasku).
+ */
+void MemBudget_SetBudget(MemBudget_t *mb, uint8_t screen, uint32_t bytes);
+
+/**
+ * @brief  Uzima uzorak hipa za aktivni ekran; poziva se u svakom prolazu.
+ * @note   Pri promjeni nivoa na gore (ili nakon odbijene alokacije) poziva
+ *         `ops->pressure()` i odmah ponovo čita hip.
+ * @retval MemLevel_t Trenutni nivo.
+ */
+MemLevel_t MemBudget_Sample(MemBudget_t *mb, uint8_t screen);
+
+/**
+ * @brief  Najavljuje alokaciju `size` bajta na aktivnom ekranu.
+ * @note   Ne poziva `pressure` (pozivalac je možda usred rada sa kešom);
+ *         odbijanje se obrađuje na sljedećem uzorku.
+ * @retval bool `true` ako iza alokacije ostaje bar `critical_block`.
+ */
+bool MemBudget_Reserve(MemBudget_t *mb, uint32_t size);
+
+/**
+ * @brief  Ispisuje hip, nivo, mapu SDRAM-a i statistiku po ekranu.
+ * @retval uint32_t Broj upisanih znakova (bez završne nule).
+ */
+uint32_t MemBudget_Report(const MemBudget_t *mb, char *buf, uint32_t size);
+
+#endif // __MEM_BUDGET_H__
@@ -0,0 +1,116 @@
+/**
+ ******************************************************************************
+ * @file    qr_cache.h
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Javni API keša QR kodova kao 1-bpp matrica modula.
+ *
+ * @note    QR ekran je pri svakom iscrtavanju kodirao tekst (`GUI_QR_Create`)
+ * i alocirao bitmapu na GUI hipu. Keš čuva matricu modula svakog
+ * sačuvanog koda (1 bit po modulu) zajedno sa kopijom teksta iz kojeg
+ * je napravljena. Matrica se pravi samo kad se tekst promijeni (pri
+ * startu i nakon `QR_Code_Set`, u glavnoj petlji jer QR_REQUEST stiže u
+ * prekidu), a iscrtavanje samo čita bite. `QrCache_Get` poredi tekst,
+ * pa i izmjena mimo `QR_Code_Set` ne daje zastario kod. Kodiranje radi funkcija `QrEncode_t` (emWin u
+ * `display.c`), pa modul ne zavisi od emWin-a ni HAL-a.
+ ******************************************************************************
+ */
+
+#ifndef __QR_CACHE_H__
+#define __QR_CACHE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*============================================================================*/
+/* JAVNE DEFINICIJE I STRUKTURE                                               */
+/*============================================================================*/
+
+/** @brief Broj kodova u kešu (WiFi i App). */
+#define QR_CACHE_SLOTS              2U
+
+/** @brief Najveća dužina teksta sa završnom nulom. */
+#define QR_CACHE_TEXT_MAX           64U
+
+/** @brief Najveća stranica matrice u modulima (verzija 10 sa okvirom). */
+#define QR_CACHE_MAX_SIZE           72U
+
+/** @brief Bajta po liniji matrice. */
+#define QR_CACHE_LINE_BYTES         ((QR_CACHE_MAX_SIZE + 7U) / 8U)
+
+/**
+ * @brief Kodiranje teksta u matricu.
+ * @param bits Matrica, `QR_CACHE_LINE_BYTES` po liniji, bit 7 je prvi
+ *        modul; tamni modul je 1. Pozivalac je prethodno obriše.
+ * @param size Stranica matrice u modulima (izlaz).
+ * @retval bool `false` ako tekst nije kodiran ili matrica ne staje.
+ */
+typedef bool (*QrEncode_t)(const char *text, uint8_t *bits, uint16_t max_size, uint16_t *size);
+
+/**
+ * @brief Jedan kod u kešu.
+ */
+typedef struct
+{
+    char     text[QR_CACHE_TEXT_MAX];                           /**< Tekst iz kojeg je matrica napravljena. */
+    uint8_t  bits[QR_CACHE_MAX_SIZE * QR_CACHE_LINE_BYTES];     /**< Matrica modula. */
+    uint16_t size;                                              /**< Stranica matrice u modulima. */
+    bool     valid;                                             /**< Matrica odgovara tekstu. */
+    bool     failed;                                            /**< Kodiranje teksta nije uspjelo. */
+} QrCacheEntry_t;
+
+/**
+ * @brief Stanje keša i statistika.
+ */
+typedef struct
+{
+    QrCacheEntry_t entries[QR_CACHE_SLOTS];     /**< Kodovi. */
+    QrEncode_t     encode;                      /**< Kodiranje teksta. */
+    uint32_t       encodes;                     /**< Broj kodiranja. */
+    uint32_t       hits;                        /**< `QrCache_Get` bez kodiranja. */
+    uint32_t       failures;                    /**< Neuspjela kodiranja. */
+} QrCache_t;
+
+/*============================================================================*/
+/* JAVNE FUNKCIJE                                                             */
+/*============================================================================*/
+
+/**
+ * @brief  Inicijalizuje prazan keš; svi kodovi su nevažeći.
+ */
+void QrCache_Init(QrCache_t *cache, QrEncode_t encode);
+
+/**
+ * @brief  Pravi matricu za `text` ako se razlikuje od zapamćenog teksta.
+ * @note   Poziva se pri startu i periodično iz glavne petlje; kodira samo
+ *         kad se tekst promijeni. Neuspjelo kodiranje se pamti i ne
+ *         ponavlja za isti tekst dok se kod ne proglasi nevažećim.
+ * @retval bool `true` ako je kod važeći nakon poziva.
+ */
+bool QrCache_Update(QrCache_t *cache, uint8_t slot, const char *text);
+
+/**
+ * @brief  Vraća matricu za `text`; kodira samo ako je zastarjela.
+ * @retval const QrCacheEntry_t* Kod, ili NULL ako kodiranje nije uspjelo.
+ */
+const QrCacheEntry_t *QrCache_Get(QrCache_t *cache, uint8_t slot, const char *text);
+
+/**
+ * @brief  Proglašava kod nevažećim, pa ga sljedeći `QrCache_Update` ili
+ *         `QrCache_Get` ponovo kodira.
+ * @note   Samo briše flegove, pa se smije pozvati i iz prekida.
+ */
+void QrCache_Invalidate(QrCache_t *cache, uint8_t slot);
+
+/**
+ * @brief  Vraća `true` za tamni modul (x, y).
+ */
+bool QrCache_Module(const QrCacheEntry_t *entry, uint16_t x, uint16_t y);
+
+/**
+ * @brief  Nalazi sljedeći niz tamnih modula u liniji `y`, od `*x` nadalje.
+ * @note   Iscrtavanje puni jedan pravougaonik po nizu umjesto po modulu.
+ * @retval bool `false` kad u liniji više nema tamnih modula.
+ */
+bool QrCache_NextRun(const QrCacheEntry_t *entry, uint16_t y, uint16_t *x, uint16_t *len);
+
+#endif // __QR_CACHE_H__
@@ -0,0 +1,179 @@
+/**
+ ******************************************************************************
+ * @file    remote_view.h
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Javni API za daljinski pregled ekrana preko RS485 (podrška).
+ *
+ * @note    Podrška na terenu ne vidi šta panel prikazuje. Modul pravi tok
+ * podataka sa slikom ekrana koji preglednik (`Tools/rview`) čita preko
+ * busa i sastavlja:
+ *  - ekran se dijeli na pločice `REMOTE_VIEW_TILE` x `REMOTE_VIEW_TILE`,
+ *  - za svaku pločicu se računa hash prikazanih bafera oba LCD sloja; šalju
+ *    se samo pločice čiji se hash promijenio (prvi frejm: sve),
+ *  - promijenjena pločica se složi (sloj 1 preko sloja 0) u RGB565 i sažme
+ *    RLE-om (`RemoteView_EncodeTile()`),
+ *  - frejm bez promjena ne šalje ništa.
+ * Tok ide u prsten od `REMOTE_VIEW_RING_SIZE` bajta. Preglednik ga čita po
+ * poziciji (`RemoteView_Read()`), pa je ponovljeni upit isto što i ponovno
+ * slanje izgubljenog odgovora; sve ispod tražene pozicije je potvrđeno.
+ * Čitanje je ograničeno na `rate` bajta u sekundi (token bucket), a frejm
+ * se pravi najčešće svakih `interval_ms`, pa pregled ne zauzima bus ni
+ * procesor više od toga.
+ *
+ * Zapisi u toku (brojevi MSB prvi):
+ *  - `REMOTE_VIEW_REC_FRAME`: seq (2), zastavice (1), širina (2), visina (2), pločica (1)
+ *  - `REMOTE_VIEW_REC_TILE`:  indeks pločice (2), dužina (2), RLE podaci
+ *  - `REMOTE_VIEW_REC_END`:   seq (2); preglednik tada prikazuje frejm
+ * RLE radi nad RGB565 pikselima pločice red po red: bajt `c` sa bitom 7
+ * znači `(c & 0x7F) + 1` ponavljanja sljedećeg piksela, inače slijedi
+ * `c + 1` piksela doslovno.
+ ******************************************************************************
+ */
+
+#ifndef __REMOTE_VIEW_H__
+#define __REMOTE_VIEW_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*============================================================================*/
+/* JAVNE DEFINICIJE I STRUKTURE                                               */
+/*============================================================================*/
+
+#define REMOTE_VIEW_TILE            16U         /**< Stranica pločice u pikselima. */
+#define REMOTE_VIEW_MAX_TILES       512U        /**< 480x272 = 30 x 17 pločica. */
+#define REMOTE_VIEW_RING_SIZE       4096U       /**< Prsten toka, stepen broja 2. */
+#define REMOTE_VIEW_IDLE_MS         10000U      /**< Pregled staje ako ga preglednik ovoliko ne čita. */
+
+#define REMOTE_VIEW_REC_FRAME       0xA5U       /**< Početak frejma. */
+#define REMOTE_VIEW_REC_TILE        0x5AU       /**< Pločica. */
+#define REMOTE_VIEW_REC_END         0xE7U       /**< Kraj frejma. */
+#define REMOTE_VIEW_FLAG_KEY        0x01U       /**< Frejm sadrži sve pločice. */
+
+#define REMOTE_VIEW_FRAME_BYTES     9U          /**< Dužina zapisa FRAME. */
+#define REMOTE_VIEW_TILE_HEADER     5U          /**< Zaglavlje zapisa TILE. */
+#define REMOTE_VIEW_END_BYTES       3U          /**< Dužina zapisa END. */
+/** @brief Najduži RLE pločice: svi pikseli doslovno, bajt dužine na 128 piksela. */
+#define REMOTE_VIEW_TILE_MAX_RLE    ((REMOTE_VIEW_TILE * REMOTE_VIEW_TILE * 2U) + \
+                                     ((REMOTE_VIEW_TILE * REMOTE_VIEW_TILE + 127U) / 128U))
+
+/**
+ * @brief Prikazani baferi i vrijeme.
+ * @note  Baferi su oni koje LTDC trenutno prikazuje (ne oni u koje emWin
+ * crta), sa `width` piksela po redu.
+ */
+typedef struct
+{
+    const uint16_t *(*base)(void);      /**< Sloj 0, RGB565. */
+    const uint32_t *(*overlay)(void);   /**< Sloj 1, ARGB8888 (0xFF = neprovidno), NULL ako ga nema. */
+    uint32_t        (*flips)(void);     /**< Broj zamjena prikazanog bafera. */
+    uint32_t        (*ms)(void);        /**< Vrijeme u ms. */
+} RemoteViewOps_t;
+
+/**
+ * @brief Stanje pregleda i statistika.
+ * @note  `RemoteView_Read()`, `RemoteView_Start()` i `RemoteView_Stop()` se
+ * zovu iz prekida (RS485), `RemoteView_Service()` iz glavne petlje; prekid
+ * mijenja samo `tail`, `tokens` i zahtjeve, a petlja sve ostalo.
+ */
+typedef struct
+{
+    const RemoteViewOps_t *ops;
+    uint16_t          width;                /**< Širina ekrana (i red bafera) u pikselima. */
+    uint16_t          height;
+    uint8_t           tiles_x;
+    uint8_t           tiles_y;
+    uint16_t          tile_count;
+    uint16_t          interval_ms;          /**< Najkraći razmak početaka frejmova. */
+    uint32_t          rate;                 /**< Najviše bajta u sekundi prema pregledniku. */
+    volatile bool     active;               /**< Pregled je uključen. */
+    volatile bool     restart;              /**< Zahtjev: novi tok od pozicije 0 sa punim frejmom. */
+    volatile bool     key_request;          /**< Zahtjev: sljedeći frejm pun. */
+    bool              key;                  /**< Frejm u toku je pun. */
+    bool              in_frame;             /**< Frejm u toku (pločice se obilaze). */
+    bool              frame_open;           /**< Zapis FRAME je upisan za ovaj frejm. */
+    uint16_t          next_tile;            /**< Sljedeća pločica frejma. */
+    uint16_t          seq;                  /**< Redni broj frejma. */
+    uint32_t          frame_ms;             /**< Početak zadnjeg frejma. */
+    volatile uint32_t read_ms;              /**< Zadnje čitanje preglednika. */
+    volatile uint32_t head;                 /**< Ukupno upisanih bajta toka. */
+    volatile uint32_t tail;                 /**< Bajti toka potvrđeni od preglednika. */
+    uint32_t          tokens;               /**< Dozvoljeni bajti x 1000 (token bucket). */
+    uint32_t          token_ms;             /**< Zadnje punjenje `tokens`. */
+    uint32_t          frame_start;          /**< `head` na početku frejma. */
+    uint32_t          frames;               /**< Frejmovi sa promjenama. */
+    uint32_t          tiles;                /**< Poslane pločice. */
+    uint32_t          torn;                 /**< Pločice pročitane tokom zamjene bafera (šalju se ponovo). */
+    uint32_t          stalls;               /**< Prolazi bez mjesta u prstenu. */
+    uint32_t          throttled;            /**< Čitanja skraćena zbog ograničenja brzine. */
+    uint32_t          last_frame_bytes;
+    uint32_t          max_frame_bytes;
+    uint32_t          hash[REMOTE_VIEW_MAX_TILES];                  /**< Hash pločice u zadnjem frejmu. */
+    uint16_t          pixels[REMOTE_VIEW_TILE * REMOTE_VIEW_TILE];  /**< Složena pločica. */
+    uint8_t           rle[REMOTE_VIEW_TILE_HEADER + REMOTE_VIEW_TILE_MAX_RLE];
+    uint8_t           ring[REMOTE_VIEW_RING_SIZE];
+} RemoteView_t;
+
+/*============================================================================*/
+/* JAVNE FUNKCIJE                                                             */
+/*============================================================================*/
+
+/**
+ * @brief  Inicijalizuje isključen pregled ekrana `width` x `height`.
+ * @param  interval_ms Najkraći razmak frejmova (npr. 250 ms = 4 frejma/s).
+ * @param  rate Najviše bajta u sekundi koje `RemoteView_Read()` daje.
+ */
+void RemoteView_Init(RemoteView_t *rv, const RemoteViewOps_t *ops, uint16_t width, uint16_t height,
+                     uint16_t interval_ms, uint32_t rate);
+
+/**
+ * @brief  Uključuje pregled: novi tok od pozicije 0, prvi frejm pun.
+ */
+void RemoteView_Start(RemoteView_t *rv);
+
+/**
+ * @brief  Isključuje pregled.
+ */
+void RemoteView_Stop(RemoteView_t *rv);
+
+/**
+ * @brief  Traži pun frejm (npr. preglednik je izgubio sliku).
+ */
+void RemoteView_Keyframe(RemoteView_t *rv);
+
+/**
+ * @brief  Obilazi do `max_tiles` pločica frejma i upisuje promijenjene u tok.
+ * @note   Poziva se iz glavne petlje; frejm se proteže kroz više poziva.
+ *         Pregled se sam isključi ako ga preglednik ne čita `REMOTE_VIEW_IDLE_MS`.
+ * @retval uint16_t Broj obiđenih pločica.
+ */
+uint16_t RemoteView_Service(RemoteView_t *rv, uint16_t max_tiles);
+
+/**
+ * @brief  Potvrđuje tok do `pos` i kopira najviše `max` bajta od `pos`.
+ * @note   Broj bajta je ograničen i tokenima (`rate`).
+ * @retval int32_t Broj kopiranih bajta, -1 ako pregled nije uključen ili
+ *         `pos` nije u nepotvrđenom dijelu toka (preglednik treba `Start`).
+ */
+int32_t RemoteView_Read(RemoteView_t *rv, uint32_t pos, uint8_t *buf, uint16_t max);
+
+/**
+ * @brief  Sažima `count` RGB565 piksela RLE-om.
+ * @param  out Najmanje `REMOTE_VIEW_TILE_MAX_RLE` bajta za pločicu.
+ * @retval uint32_t Broj upisanih bajta.
+ */
+uint32_t RemoteView_EncodeTile(const uint16_t *px, uint16_t count, uint8_t *out);
+
+/**
+ * @brief  Raspakuje RLE u `count` piksela (preglednik, testovi).
+ * @retval uint32_t Broj pročitanih bajta, 0 ako podaci nisu ispravni.
+ */
+uint32_t RemoteView_DecodeTile(const uint8_t *in, uint32_t len, uint16_t *px, uint16_t count);
+
+/**
+ * @brief  Ispisuje stanje i statistiku pregleda.
+ * @retval uint32_t Broj upisanih znakova (bez završne nule).
+ */
+uint32_t RemoteView_Report(const RemoteView_t *rv, char *buf, uint32_t size);
+
+#endif // __REMOTE_VIEW_H__
@@ -0,0 +1,136 @@
+/**
+ ******************************************************************************
+ * @file    screen_mgr.h
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Javni API registra ekrana: servis, manifest resursa i prefetch.
+ *
+ * @note    `DISP_Service` je biranje servisne funkcije radio preko velikog
+ * `switch`-a, a ikonice ekrana su se kopirale u SDRAM tek pri ulasku na
+ * ekran. Sada `display.c` opisuje ekrane tabelom `ScreenDesc_t` (servis,
+ * manifest resursa, izlazak i vjerovatni sljedeći ekrani), a modul:
+ *  - poziva servis aktivnog ekrana,
+ *  - pri promjeni ekrana poziva izlazak prethodnog i manifest novog (ako
+ *    već nije učitan unaprijed), broji prelaze po paru ekrana i mjeri ih,
+ *  - kad je ekran miran `idle_us`, učitava manifeste najvjerovatnijih
+ *    sljedećih ekrana: prvo naučenih iz stvarnih prelaza, pa navedenih u
+ *    tabeli. Jedan manifest po pozivu `ScreenMgr_Idle()`.
+ * Vrijeme i resurse daje `display.c` preko `ScreenMgrOps_t` i funkcija u
+ * tabeli, pa modul ne zavisi od emWin-a ni HAL-a.
+ ******************************************************************************
+ */
+
+#ifndef __SCREEN_MGR_H__
+#define __SCREEN_MGR_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*============================================================================*/
+/* JAVNE DEFINICIJE I STRUKTURE                                               */
+/*============================================================================*/
+
+/** @brief Broj ekrana (eScreen) koje registar može opisati. */
+#define SCREEN_MGR_MAX_SCREENS      64U
+
+/** @brief Broj naučenih sljedećih ekrana po ekranu. */
+#define SCREEN_MGR_MAX_NEXT         4U
+
+/** @brief Najviše ekrana učitanih unaprijed po ulasku (da ne istisnu ikonice aktivnog iz keša). */
+#define SCREEN_MGR_PREFETCH_DEPTH   3U
+
+/** @brief Bit ekrana u maski `ScreenDesc_t::hints`. */
+#define SCREEN_MGR_BIT(scr)         (1ULL << (scr))
+
+/**
+ * @brief Opis jednog ekrana.
+ * @note  `prefetch` je manifest resursa: kopira ikonice ekrana u keš i
+ * pripremi fontove/labele. Vraća `false` ako trenutno ne može (npr. QSPI
+ * se briše), pa se pokušava ponovo. `leave` je opcioni izlazak sa ekrana.
+ */
+typedef struct
+{
+    uint8_t  id;                    /**< eScreen. */
+    void   (*service)(void);        /**< Servis ekrana, u svakom prolazu petlje. */
+    bool   (*prefetch)(void);       /**< Manifest resursa (opciono). */
+    void   (*leave)(void);          /**< Izlazak sa ekrana (opciono). */
+    uint64_t hints;                 /**< Vjerovatni sljedeći ekrani (`SCREEN_MGR_BIT`). */
+    uint16_t heap_kb;               /**< Budžet rasta GUI hipa na ekranu u KB (mem_budget.h), 0 = bez budžeta. */
+} ScreenDesc_t;
+
+/**
+ * @brief Mjerenje vremena.
+ */
+typedef struct
+{
+    uint32_t (*now)(void);
+    uint32_t (*elapsed_us)(uint32_t start);
+} ScreenMgrOps_t;
+
+/**
+ * @brief Naučeni prelaz sa ekrana na `to` i njegovo trajanje.
+ */
+typedef struct
+{
+    uint8_t  to;            /**< Odredišni ekran. */
+    uint16_t count;         /**< Broj prelaza. */
+    uint32_t last_us;       /**< Zadnje trajanje u µs. */
+    uint32_t max_us;        /**< Najduže trajanje u µs. */
+} ScreenMgrEdge_t;
+
+/**
+ * @brief Stanje registra i statistika.
+ */
+typedef struct
+{
+    const ScreenDesc_t   *desc[SCREEN_MGR_MAX_SCREENS];                         /**< Opis po eScreen. */
+    ScreenMgrEdge_t       next[SCREEN_MGR_MAX_SCREENS][SCREEN_MGR_MAX_NEXT];    /**< Naučeni prelazi. */
+    const ScreenMgrOps_t *ops;                                                  /**< Mjerenje vremena. */
+    uint32_t              idle_us;          /**< Mirovanje prije učitavanja sljedećih ekrana. */
+    uint8_t               current;          /**< Aktivni ekran. */
+    uint8_t               from;             /**< Ekran sa kojeg se prelazi (dok traje mjerenje). */
+    bool                  started;          /**< `current` je važeći. */
+    bool                  measuring;        /**< Prvi servis novog ekrana još nije završen. */
+    uint32_t              pass_start;       /**< Početak prethodnog prolaza (`ops->now`). */
+    uint32_t              transition_start; /**< Početak prelaza. */
+    uint32_t              entered;          /**< Trenutak ulaska na aktivni ekran. */
+    uint64_t              prefetched;       /**< Ekrani čiji je manifest učitan od ulaska. */
+    uint64_t              tried;            /**< Ekrani čiji je manifest pokušan od ulaska. */
+    uint32_t              prefetches;       /**< Manifesti učitani unaprijed. */
+    uint32_t              prefetch_hits;    /**< Ulasci na unaprijed učitan ekran. */
+    uint32_t              cold_enters;      /**< Ulasci na ekran čiji manifest nije bio učitan. */
+} ScreenMgr_t;
+
+/*============================================================================*/
+/* JAVNE FUNKCIJE                                                             */
+/*============================================================================*/
+
+/**
+ * @brief  Inicijalizuje registar iz tabele opisa.
+ * @param  idle_us Koliko ekran mora biti miran prije učitavanja sljedećih.
+ */
+void ScreenMgr_Init(ScreenMgr_t *mgr, const ScreenMgrOps_t *ops, const ScreenDesc_t *table, uint8_t count, uint32_t idle_us);
+
+/**
+ * @brief  Poziva servis ekrana `screen` i prati promjene ekrana.
+ * @retval bool `false` ako ekran nije u registru (pozivalac radi podrazumijevano).
+ */
+bool ScreenMgr_Service(ScreenMgr_t *mgr, uint8_t screen);
+
+/**
+ * @brief  Učitava manifest jednog vjerovatnog sljedećeg ekrana ako je
+ *         aktivni ekran dovoljno dugo miran.
+ * @note   Poziva se na kraju prolaza glavne petlje.
+ * @retval bool `true` ako je manifest učitan u ovom pozivu.
+ */
+bool ScreenMgr_Idle(ScreenMgr_t *mgr);
+
+/**
+ * @brief  Ispisuje izvještaj o prelazima po paru ekrana.
+ * @note   Prva linija: manifesti učitani unaprijed, ulasci na unaprijed
+ *         učitan ekran i ulasci bez toga. Zatim po prelazu: ekrani, broj
+ *         prelaza, zadnje i najduže trajanje.
+ * @retval uint32_t Broj upisanih znakova (bez završne nule).
+ */
+uint32_t ScreenMgr_Report(const ScreenMgr_t *mgr, char *buf, uint32_t size);
+
+#endif // __SCREEN_MGR_H__
@@ -0,0 +1,139 @@
+/**
+ ******************************************************************************
+ * @file    settings_model.h
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Javni API modela postavki za ekrane podešavanja.
+ *
+ * @note    `Service_SettingsScreen_*` funkcije su u svakom prolazu glavne
+ * petlje čitale sve widgete (`SPINBOX_GetValue`, `RADIO_GetValue`, ...) i
+ * poredile ih sa vrijednostima u modulima. Sada ekran pri inicijalizaciji
+ * veže tabelu polja (`SettingsField_t`: ID widgeta, ključ postavke, opseg)
+ * za model, a emWin notifikacija o promjeni widgeta poziva
+ * `SettingsModel_Set()`: vrijednost se odmah upisuje u modul, model pamti
+ * potvrđenu vrijednost i bilježi događaj promjene, koji ekran preuzima sa
+ * `SettingsModel_Next()` kad treba nešto da iscrta. Bez dodira ekran
+ * podešavanja ne radi ništa. Čitanje i upis postavki radi `display.c`
+ * preko `SettingsModelOps_t`, pa modul ne zavisi od emWin-a ni HAL-a.
+ ******************************************************************************
+ */
+
+#ifndef __SETTINGS_MODEL_H__
+#define __SETTINGS_MODEL_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*============================================================================*/
+/* JAVNE DEFINICIJE I STRUKTURE                                               */
+/*============================================================================*/
+
+/** @brief Najveći broj polja na jednom ekranu (bit po polju u `pending`). */
+#define SETTINGS_MODEL_MAX_FIELDS   32U
+
+/**
+ * @brief Vrsta widgeta polja; određuje kako `display.c` čita i postavlja vrijednost.
+ */
+typedef enum
+{
+    SETTINGS_WIDGET_SPINBOX = 0,
+    SETTINGS_WIDGET_RADIO,
+    SETTINGS_WIDGET_CHECKBOX,
+    SETTINGS_WIDGET_DROPDOWN
+} SettingsWidget_t;
+
+/**
+ * @brief Rezultat upisa vrijednosti.
+ */
+typedef enum
+{
+    SETTINGS_UNCHANGED = 0,     /**< Vrijednost je ista kao u modelu, ništa nije upisano. */
+    SETTINGS_APPLIED,           /**< Vrijednost je upisana u modul. */
+    SETTINGS_CORRECTED          /**< Upisana, ali modul (ili opseg) je promijenio vrijednost; widget treba ažurirati. */
+} SettingsResult_t;
+
+/**
+ * @brief Jedno polje ekrana podešavanja.
+ */
+typedef struct
+{
+    uint16_t id;        /**< ID widgeta. */
+    uint8_t  key;       /**< Ključ postavke za `SettingsModelOps_t`. */
+    uint8_t  widget;    /**< SettingsWidget_t. */
+    int32_t  min;       /**< Najmanja dozvoljena vrijednost. */
+    int32_t  max;       /**< Najveća dozvoljena vrijednost. */
+} SettingsField_t;
+
+/**
+ * @brief Čitanje i upis postavke po ključu.
+ * @note  `write` poziva setter modula (koji smije ispraviti vrijednost) i
+ * označava šta treba snimiti; `read` vraća vrijednost koju modul drži.
+ */
+typedef struct
+{
+    int32_t (*read)(uint8_t key);
+    void    (*write)(uint8_t key, int32_t value);
+} SettingsModelOps_t;
+
+/**
+ * @brief Stanje modela i statistika.
+ */
+typedef struct
+{
+    const SettingsModelOps_t *ops;                          /**< Čitanje/upis postavki. */
+    const SettingsField_t    *fields;                       /**< Polja vezanog ekrana. */
+    uint8_t                   count;                        /**< Broj polja. */
+    uint8_t                   owner;                        /**< Ekran (eScreen) čija su polja vezana, 0 ako nijedan. */
+    int32_t                   values[SETTINGS_MODEL_MAX_FIELDS]; /**< Potvrđene vrijednosti. */
+    uint32_t                  pending;                      /**< Događaji promjene koji čekaju, bit po polju. */
+    uint32_t                  edits;                        /**< Broj upisa. */
+    uint32_t                  corrections;                  /**< Upisi koje je modul ili opseg ispravio. */
+} SettingsModel_t;
+
+/*============================================================================*/
+/* JAVNE FUNKCIJE                                                             */
+/*============================================================================*/
+
+/**
+ * @brief  Inicijalizuje model bez vezanog ekrana.
+ */
+void SettingsModel_Init(SettingsModel_t *model, const SettingsModelOps_t *ops);
+
+/**
+ * @brief  Veže polja ekrana `owner` i učitava njihove vrijednosti iz modula.
+ * @note   Poziva se iz `DSP_InitSet*Scrn`; prethodno vezani ekran i njegovi
+ *         neobrađeni događaji se odbacuju.
+ * @retval bool `false` ako ekran ima više od `SETTINGS_MODEL_MAX_FIELDS` polja.
+ */
+bool SettingsModel_Bind(SettingsModel_t *model, uint8_t owner, const SettingsField_t *fields, uint8_t count);
+
+/**
+ * @brief  Odvezuje ekran (`DSP_KillSet*Scrn`).
+ */
+void SettingsModel_Unbind(SettingsModel_t *model);
+
+/**
+ * @brief  Vraća indeks polja sa ID-jem widgeta `id` na ekranu `owner`.
+ * @retval int16_t Indeks, ili -1 ako ekran nije vezan ili polje ne postoji.
+ */
+int16_t SettingsModel_Find(const SettingsModel_t *model, uint8_t owner, uint16_t id);
+
+/**
+ * @brief  Upisuje novu vrijednost polja.
+ * @note   Vrijednost se ograniči na opseg polja; ako se razlikuje od
+ *         potvrđene, upisuje se u modul, čita nazad i bilježi kao događaj.
+ * @param  applied Izlaz: potvrđena vrijednost nakon upisa.
+ */
+SettingsResult_t SettingsModel_Set(SettingsModel_t *model, int16_t index, int32_t value, int32_t *applied);
+
+/**
+ * @brief  Preuzima sljedeći događaj promjene.
+ * @retval bool `false` kad nema događaja.
+ */
+bool SettingsModel_Next(SettingsModel_t *model, uint8_t *key, int32_t *value);
+
+/**
+ * @brief  Vraća potvrđenu vrijednost polja.
+ */
+int32_t SettingsModel_Value(const SettingsModel_t *model, int16_t index);
+
+#endif // __SETTINGS_MODEL_H__
@@ -63,6 +63,8 @@ void LTDC_IRQHandler(void);
 void TIM3_IRQHandler(void);
 void EXTI3_IRQHandler(void);
 void EXTI15_10_IRQHandler(void);
+void I2C3_EV_IRQHandler(void);
+void I2C3_ER_IRQHandler(void);
 void QUADSPI_IRQHandler(void);
 void AUDIO_IN_SAIx_DMAx_IRQHandler(void);
 void AUDIO_OUT_SAIx_DMAx_IRQHandler(void);
@@ -0,0 +1,140 @@
+/**
+ ******************************************************************************
+ * @file    text_layout.h
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Javni API keša širina i rasporeda prevedenih labela.
+ *
+ * @note    Ekrani sa ikonicama (svjetla, kapije) pri svakom iscrtavanju
+ * mjere sve labele (`GUI_GetStringDistX(lng(...))`) da bi odlučili da li
+ * staju u Verdana20 ili treba preći na Verdana16, a `lng()` svaki put
+ * čita pokazivač iz tabele u QSPI. Rezultat se mijenja samo promjenom
+ * jezika, konfiguracije ili korisničke labele, pa ga keš pamti:
+ * pokazivač na tekst, izmjerenu širinu, prelome linija i odabrani font.
+ * Ključ je (tekst, jezik, font); tekst je `TXT_xxx` ID ili korisnička
+ * labela (`TEXT_LAYOUT_LABEL_KEY`). Tekst i mjerenje daje `display.c`
+ * preko `TextLayoutOps_t`, pa modul ne zavisi od emWin-a ni HAL-a.
+ ******************************************************************************
+ */
+
+#ifndef __TEXT_LAYOUT_H__
+#define __TEXT_LAYOUT_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*============================================================================*/
+/* JAVNE DEFINICIJE I STRUKTURE                                               */
+/*============================================================================*/
+
+/** @brief Broj zapisa u kešu (ekran sa 6 svjetala koristi 12 labela po fontu). */
+#define TEXT_LAYOUT_MAX_ENTRIES     48U
+
+/** @brief Najveći broj linija jednog teksta; zadnja linija dobija ostatak. */
+#define TEXT_LAYOUT_MAX_LINES       4U
+
+/** @brief Broj zapamćenih odluka o fontu (jedna po ekranu). */
+#define TEXT_LAYOUT_MAX_CHOICES     4U
+
+/** @brief Ključevi od ove vrijednosti naviše su korisničke labele. */
+#define TEXT_LAYOUT_LABEL_BASE      0x8000U
+
+/** @brief Ključ korisničke labele: vrsta uređaja (0..127) i indeks instance. */
+#define TEXT_LAYOUT_LABEL_KEY(kind, index)  ((uint16_t)(TEXT_LAYOUT_LABEL_BASE | ((uint16_t)(kind) << 8) | (uint8_t)(index)))
+
+/**
+ * @brief Pristup tekstovima i metrici fonta.
+ * @note  `text` vraća tekst ključa na zadanom jeziku (nikad NULL), a
+ * `width` širinu prvih `len` bajta teksta u pikselima.
+ */
+typedef struct
+{
+    const char *(*text)(uint16_t key, uint8_t language);
+    int16_t     (*width)(uint8_t font, const char *text, uint16_t len);
+} TextLayoutOps_t;
+
+/**
+ * @brief Izmjeren raspored jednog teksta u jednom fontu.
+ */
+typedef struct
+{
+    const char *text;                               /**< Tekst (QSPI tabela ili RAM labela). */
+    uint16_t    key;                                /**< TXT_xxx ili TEXT_LAYOUT_LABEL_KEY. */
+    uint8_t     language;                           /**< Jezik teksta. */
+    uint8_t     font;                               /**< Indeks fonta (značenje određuje `display.c`). */
+    int16_t     width;                              /**< Širina najšire linije. */
+    int16_t     wrap_width;                         /**< Širina za koju su računati prelomi, 0 = samo '\n'. */
+    uint8_t     lines;                              /**< Broj linija. */
+    uint16_t    line_start[TEXT_LAYOUT_MAX_LINES];  /**< Početak linije u bajtima. */
+    uint16_t    line_len[TEXT_LAYOUT_MAX_LINES];    /**< Dužina linije u bajtima. */
+    uint32_t    last_use;                           /**< Vrijeme zadnjeg korištenja (LRU), 0 = slobodan. */
+} TextLayoutEntry_t;
+
+/**
+ * @brief Zapamćena odluka o fontu za skup tekstova.
+ */
+typedef struct
+{
+    uint16_t id;            /**< Identifikator odluke (npr. eScreen). */
+    bool     valid;         /**< Odluka je važeća. */
+    uint8_t  font;          /**< Odabrani font. */
+    uint32_t signature;     /**< Otisak ulaza (jezik, ključevi, širina, fontovi). */
+} TextLayoutChoice_t;
+
+/**
+ * @brief Stanje keša i brojači za mjerenje.
+ */
+typedef struct
+{
+    TextLayoutEntry_t      entries[TEXT_LAYOUT_MAX_ENTRIES];  /**< Zapisi. */
+    TextLayoutChoice_t     choices[TEXT_LAYOUT_MAX_CHOICES];  /**< Odluke o fontu. */
+    const TextLayoutOps_t *ops;                               /**< Tekstovi i metrika. */
+    uint32_t               clock;                             /**< Brojač korištenja za LRU. */
+    uint32_t               lookups;                           /**< Broj upita. */
+    uint32_t               hits;                              /**< Upiti odgovoreni iz keša. */
+    uint32_t               text_fetches;                      /**< Pozivi `ops->text`. */
+    uint32_t               measures;                          /**< Pozivi `ops->width`. */
+} TextLayoutCache_t;
+
+/*============================================================================*/
+/* JAVNE FUNKCIJE                                                             */
+/*============================================================================*/
+
+/**
+ * @brief  Inicijalizuje prazan keš.
+ */
+void TextLayout_Init(TextLayoutCache_t *cache, const TextLayoutOps_t *ops);
+
+/**
+ * @brief  Briše sve zapise i odluke (promjena jezika ili fontova).
+ */
+void TextLayout_InvalidateAll(TextLayoutCache_t *cache);
+
+/**
+ * @brief  Briše zapise korisničkih labela i sve odluke o fontu.
+ * @note   Poziva se kad se labela ili konfiguracija uređaja promijeni.
+ */
+void TextLayout_InvalidateLabels(TextLayoutCache_t *cache);
+
+/**
+ * @brief  Vraća raspored teksta; linije se lome samo na '\n'.
+ * @note   Pokazivač važi do sljedećeg poziva koji može izbaciti zapis.
+ */
+const TextLayoutEntry_t *TextLayout_Get(TextLayoutCache_t *cache, uint16_t key, uint8_t language, uint8_t font);
+
+/**
+ * @brief  Vraća raspored teksta prelomljen na riječi tako da linije staju u `max_width`.
+ * @note   Riječ šira od `max_width` ostaje sama u liniji. Ako linija ima više
+ *         od `TEXT_LAYOUT_MAX_LINES`, zadnja dobija ostatak teksta.
+ */
+const TextLayoutEntry_t *TextLayout_Wrap(TextLayoutCache_t *cache, uint16_t key, uint8_t language, uint8_t font, int16_t max_width);
+
+/**
+ * @brief  Bira prvi font iz `fonts` u kojem svi tekstovi staju u `max_width`.
+ * @note   Odluka se pamti pod `id` dok se ulazi ne promijene; ako nijedan
+ *         font nije dovoljno mali, vraća se zadnji.
+ * @retval uint8_t Odabrani font.
+ */
+uint8_t TextLayout_ChooseFont(TextLayoutCache_t *cache, uint16_t id, uint8_t language, const uint16_t *keys, uint8_t count,
+                              int16_t max_width, const uint8_t *fonts, uint8_t font_count);
+
+#endif // __TEXT_LAYOUT_H__
@@ -0,0 +1,86 @@
+/**
+ ******************************************************************************
+ * @file    touch_track.h
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Javni API praćenja kontakta na ekranu osjetljivom na dodir.
+ *
+ * @note    Dekodira blok registara FT5336 kontrolera (TD_STAT i koordinate
+ * prvog dodira) i odlučuje kada se novo stanje prijavljuje emWin-u:
+ * pri promjeni pritiska ili pomaku većem od praga (`TOUCH_TRACK_THRESHOLD_*`,
+ * zavisno od `g_high_precision_mode`). Modul ne zavisi od emWin-a ni HAL-a,
+ * pa se sa snimljenim nizovima očitanja može provjeriti i na računaru.
+ ******************************************************************************
+ */
+
+#ifndef __TOUCH_TRACK_H__
+#define __TOUCH_TRACK_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*============================================================================*/
+/* JAVNE DEFINICIJE I STRUKTURE                                               */
+/*============================================================================*/
+
+/** @brief Prag pomaka u pikselima za normalan rad. */
+#define TOUCH_TRACK_THRESHOLD_NORMAL        30U
+
+/** @brief Prag pomaka u pikselima za slajdere (visoka preciznost). */
+#define TOUCH_TRACK_THRESHOLD_PRECISE       2U
+
+/** @brief Broj registara koji se čitaju u jednom prenosu, od TD_STAT (0x02) do P1_YL (0x06). */
+#define TOUCH_TRACK_REG_COUNT               5U
+
+/** @brief Najveći broj dodira koji kontroler prijavljuje. */
+#define TOUCH_TRACK_MAX_TOUCH               5U
+
+/**
+ * @brief Jedno očitanje kontrolera (samo prvi dodir).
+ */
+typedef struct
+{
+    uint16_t x;         /**< X koordinata u pikselima. */
+    uint16_t y;         /**< Y koordinata u pikselima. */
+    bool     pressed;   /**< Ekran je dodirnut. */
+} TouchSample_t;
+
+/**
+ * @brief Stanje praćenja kontakta i statistika.
+ */
+typedef struct
+{
+    TouchSample_t last;         /**< Zadnje prijavljeno stanje. */
+    uint32_t      samples;      /**< Broj obrađenih očitanja. */
+    uint32_t      reports;      /**< Broj prijava emWin-u. */
+} TouchTrack_t;
+
+/*============================================================================*/
+/* JAVNE FUNKCIJE                                                             */
+/*============================================================================*/
+
+/**
+ * @brief  Inicijalizuje praćenje; ekran nije dodirnut.
+ */
+void TouchTrack_Init(TouchTrack_t *track);
+
+/**
+ * @brief  Vraća prag pomaka za zadani način rada.
+ */
+uint16_t TouchTrack_Threshold(bool high_precision);
+
+/**
+ * @brief  Dekodira `TOUCH_TRACK_REG_COUNT` registara kontrolera u očitanje.
+ * @note   Neispravan broj dodira ili koordinata van ekrana (`xsize`, `ysize`)
+ *         daje očitanje bez dodira, kao i ranije u `TS_Service`.
+ */
+void TouchTrack_Decode(const uint8_t *regs, uint16_t xsize, uint16_t ysize, TouchSample_t *sample);
+
+/**
+ * @brief  Obrađuje očitanje i odlučuje da li se prijavljuje.
+ * @param  report Stanje za `GUI_TOUCH_StoreStateEx` (izlaz). Pri otpuštanju
+ *         nosi zadnje koordinate pritiska.
+ * @retval bool `true` ako se stanje promijenilo i treba ga prijaviti.
+ */
+bool TouchTrack_Update(TouchTrack_t *track, const TouchSample_t *sample, uint16_t threshold, TouchSample_t *report);
+
+#endif // __TOUCH_TRACK_H__
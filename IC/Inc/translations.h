@@ -199,7 +199,7 @@ static const IconMapping_t gate_appearance_mapping_table[] = {
  * @note  ISPRAVLJENA VERZIJA: Dodan nedostajući red prevoda za TXT_GATE_SECURITY_DOOR
  * kako bi se svi TextID-jevi i stringovi ponovo uskladili.
  */
-static const char* language_strings[TEXT_COUNT][LANGUAGE_COUNT] = {
+static const char* const language_strings[TEXT_COUNT][LANGUAGE_COUNT] = {
     /* TXT_DUMMY */                     { "", "", "","", "", "", "", "", "", "", "" },
     /* TXT_LIGHTS */                    { "SVJETLA", "LIGHTS", "LICHTER", "LUMIÈRES", "LUCI", "LUCES", "СВЕТ", "СВІТЛО", "ŚWIATŁA", "SVĚTLA", "SVETLÁ" },
     /* TXT_THERMOSTAT */                { "TERMOSTAT", "THERMOSTAT", "THERMOSTAT", "THERMOSTAT", "TERMOSTATO", "TERMOSTATO", "ТЕРМОСТАТ", "ТЕРМОСТАТ", "TERMOSTAT", "TERMOSTAT", "TERMOSTAT" },
@@ -262,7 +262,7 @@ static const char* language_strings[TEXT_COUNT][LANGUAGE_COUNT] = {
     /* TXT_MONTH */                     { "Mjesec", "Month", "Monat", "Mois", "Mese", "Mes", "Месяц", "Місяць", "Miesiąc", "Měsíc", "Mesiac" },
     /* TXT_YEAR */                      { "Godina", "Year", "Jahr", "Année", "Anno", "Año", "Год", "Рік", "Rok", "Rok", "Rok" },
     /* TXT_HOUR */                      { "Sat", "Hour", "Stunde", "Heure", "Ora", "Hora", "Час", "Година", "Godzina", "Hodina", "Hodina" },
-    /* TXT_MINUTE */                    { "Minuta", "Minute", "Minute", "Minuto", "Minuto", "Минута", "Хвилина", "Minuta", "Minuta", "Minúta" },
+    /* TXT_MINUTE */                    { "Minuta", "Minute", "Minute", "Minute", "Minuto", "Minuto", "Минута", "Хвилина", "Minuta", "Minuta", "Minúta" },
     /* TXT_LUSTER */                    { "LUSTER", "CHANDELIER", "KRONLEUCHTER", "LUSTRE", "LAMPADARIO", "ARAÑA", "ЛЮСТРА", "ЛЮСТРА", "ŻYRANDOL", "LUSTR", "LUSTER" },
     /* TXT_SPOT */                      { "SPOT", "SPOT", "STRAHLER", "SPOT", "FARETTO", "FOCO", "ТОЧЕЧНЫЙ", "ТОЧКОВИЙ", "PUNKTOWE", "BODOVÉ", "BODOVÉ" },
     /* TXT_VISILICA */                  { "VISILICA", "PENDANT", "HÄNGELEUCHTE", "SUSPENSION", "SOSPENSIONE", "COLGANTE", "ПОДВЕС", "ПІДВІС", "WISZĄCA", "ZÁVĚSNÉ", "ZÁVESNÉ" },
@@ -18647,7 +18647,7 @@ GUI_CONST_STORAGE GUI_FONT_PROP GUI_FontVerdana16_LAT_Prop1 = {
 };
 
 GUI_CONST_STORAGE GUI_FONT GUI_FontVerdana16_LAT = {
-   GUI_FONTTYPE_PROP_AA4 /* type of font    */
+   GUI_FONTTYPE_PROP_AA4_CACHED /* type of font    */
   ,16 /* height of font  */
   ,16 /* space of font y */
   ,1 /* magnification x */
@@ -22219,7 +22219,7 @@ GUI_CONST_STORAGE GUI_FONT_PROP GUI_FontVerdana20_Prop1 = {
 };
 
 GUI_CONST_STORAGE GUI_FONT GUI_FontVerdana20_LAT = {
-    GUI_FONTTYPE_PROP_AA2 /* type of font    */
+    GUI_FONTTYPE_PROP_AA2_CACHED /* type of font    */
     ,20 /* height of font  */
     ,20 /* space of font y */
     ,1 /* magnification x */
@@ -32936,7 +32936,7 @@ GUI_CONST_STORAGE GUI_FONT_PROP GUI_FontVerdana32_Prop1 = {
 };
 
 GUI_CONST_STORAGE GUI_FONT GUI_FontVerdana32_LAT = {
-    GUI_FONTTYPE_PROP_AA4 /* type of font    */
+    GUI_FONTTYPE_PROP_AA4_CACHED /* type of font    */
     ,32 /* height of font  */
     ,32 /* space of font y */
     ,1 /* magnification x */
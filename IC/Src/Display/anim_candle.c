@@ -0,0 +1,361 @@
+/*********************************************************************
+* Generated by Tools/animconv, do not edit.
+* anim_candle.c: 4 frames 21x62, 100 ms per frame
+*********************************************************************/
+
+#include <stdlib.h>
+#include "Resource.h"
+#include "anim_codec.h"
+
+/* 21x62, RLE8, 1696 bytes */
+__attribute__((section(".flash_rom"), aligned(4)))
+static GUI_CONST_STORAGE unsigned char anim_candle_i0[] = {
+    0x93, 0x00, 0x93, 0x00, 0x86, 0x00, 0x03, 0x01, 0x02, 0x03, 0x01, 0x87, 0x00, 0x86, 0x00, 0x03, 0x01, 0x04, 0x05, 0x06, 0x87, 0x00, 0x85, 0x00,
+    0x06, 0x01, 0x07, 0x08, 0x09, 0x0A, 0x01, 0x01, 0x85, 0x00, 0x84, 0x00, 0x07, 0x01, 0x02, 0x0B, 0x0C, 0x0D, 0x0E, 0x06, 0x01, 0x85, 0x00, 0x84,
+    0x00, 0x08, 0x01, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x02, 0x01, 0x84, 0x00, 0x83, 0x00, 0x08, 0x01, 0x03, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+    0x06, 0x81, 0x01, 0x82, 0x00, 0x83, 0x00, 0x0B, 0x01, 0x06, 0x1A, 0x1B, 0x17, 0x1C, 0x1D, 0x1E, 0x07, 0x03, 0x01, 0x01, 0x82, 0x00, 0x81, 0x00,
+    0x0D, 0x01, 0x01, 0x02, 0x07, 0x1F, 0x20, 0x1C, 0x21, 0x17, 0x22, 0x23, 0x0F, 0x02, 0x01, 0x82, 0x00, 0x81, 0x00, 0x0E, 0x01, 0x01, 0x06, 0x24,
+    0x22, 0x25, 0x21, 0x21, 0x1C, 0x26, 0x27, 0x07, 0x02, 0x01, 0x01, 0x81, 0x00, 0x08, 0x00, 0x00, 0x01, 0x01, 0x02, 0x0F, 0x28, 0x29, 0x17, 0x81,
+    0x21, 0x08, 0x20, 0x1F, 0x28, 0x0F, 0x02, 0x01, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x01, 0x01, 0x03, 0x07, 0x2A, 0x26, 0x1C, 0x81, 0x21, 0x08,
+    0x17, 0x2B, 0x23, 0x07, 0x06, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x81, 0x01, 0x04, 0x06, 0x24, 0x2C, 0x2D, 0x1C, 0x81, 0x21, 0x04, 0x1C, 0x2E,
+    0x2F, 0x24, 0x06, 0x81, 0x01, 0x00, 0x00, 0x07, 0x00, 0x01, 0x01, 0x02, 0x0F, 0x30, 0x31, 0x32, 0x82, 0x21, 0x08, 0x1C, 0x33, 0x34, 0x28, 0x0F,
+    0x02, 0x01, 0x01, 0x00, 0x81, 0x01, 0x04, 0x03, 0x0F, 0x35, 0x36, 0x37, 0x82, 0x21, 0x08, 0x1C, 0x18, 0x38, 0x23, 0x07, 0x06, 0x02, 0x01, 0x01,
+    0x08, 0x01, 0x01, 0x02, 0x06, 0x07, 0x23, 0x39, 0x17, 0x1C, 0x82, 0x21, 0x07, 0x20, 0x3A, 0x3B, 0x07, 0x06, 0x03, 0x01, 0x01, 0x07, 0x01, 0x01,
+    0x02, 0x06, 0x3C, 0x3D, 0x3E, 0x17, 0x83, 0x21, 0x07, 0x1D, 0x10, 0x3D, 0x14, 0x0F, 0x03, 0x01, 0x01, 0x08, 0x01, 0x01, 0x03, 0x0F, 0x30, 0x3F,
+    0x13, 0x1C, 0x1C, 0x82, 0x21, 0x07, 0x37, 0x40, 0x41, 0x28, 0x0F, 0x06, 0x01, 0x01, 0x08, 0x01, 0x01, 0x06, 0x0F, 0x28, 0x42, 0x43, 0x1C, 0x1C,
+    0x82, 0x21, 0x07, 0x17, 0x22, 0x44, 0x23, 0x07, 0x06, 0x01, 0x01, 0x07, 0x01, 0x01, 0x06, 0x0F, 0x23, 0x45, 0x33, 0x1C, 0x83, 0x21, 0x07, 0x1C,
+    0x2E, 0x46, 0x23, 0x07, 0x06, 0x02, 0x01, 0x07, 0x01, 0x02, 0x06, 0x07, 0x23, 0x46, 0x47, 0x1C, 0x83, 0x21, 0x07, 0x1C, 0x29, 0x48, 0x3D, 0x24,
+    0x06, 0x02, 0x01, 0x07, 0x01, 0x02, 0x06, 0x3C, 0x23, 0x49, 0x18, 0x1C, 0x83, 0x21, 0x07, 0x1C, 0x4A, 0x4B, 0x3D, 0x30, 0x0F, 0x03, 0x01, 0x07,
+    0x01, 0x02, 0x06, 0x30, 0x3D, 0x38, 0x2D, 0x1C, 0x84, 0x21, 0x06, 0x4C, 0x4D, 0x3D, 0x28, 0x0F, 0x03, 0x01, 0x07, 0x01, 0x02, 0x06, 0x30, 0x3D,
+    0x4D, 0x1D, 0x1C, 0x83, 0x21, 0x07, 0x1C, 0x2D, 0x4E, 0x42, 0x28, 0x0F, 0x03, 0x01, 0x06, 0x01, 0x02, 0x06, 0x30, 0x3D, 0x3A, 0x32, 0x85, 0x21,
+    0x06, 0x20, 0x4F, 0x42, 0x28, 0x0F, 0x02, 0x01, 0x06, 0x01, 0x02, 0x06, 0x30, 0x2F, 0x1F, 0x25, 0x85, 0x21, 0x06, 0x1D, 0x50, 0x51, 0x28, 0x0F,
+    0x02, 0x01, 0x06, 0x01, 0x02, 0x06, 0x30, 0x2F, 0x10, 0x37, 0x85, 0x21, 0x06, 0x32, 0x52, 0x51, 0x28, 0x0F, 0x02, 0x01, 0x06, 0x01, 0x02, 0x06,
+    0x07, 0x3D, 0x53, 0x17, 0x85, 0x21, 0x06, 0x32, 0x52, 0x51, 0x28, 0x0F, 0x02, 0x01, 0x06, 0x01, 0x01, 0x06, 0x3C, 0x0A, 0x39, 0x17, 0x85, 0x21,
+    0x06, 0x25, 0x53, 0x42, 0x30, 0x0F, 0x02, 0x01, 0x06, 0x01, 0x01, 0x06, 0x3C, 0x0A, 0x2B, 0x1C, 0x85, 0x21, 0x06, 0x25, 0x54, 0x42, 0x30, 0x06,
+    0x02, 0x01, 0x06, 0x01, 0x01, 0x55, 0x07, 0x56, 0x3E, 0x1C, 0x85, 0x21, 0x06, 0x37, 0x39, 0x3D, 0x24, 0x06, 0x01, 0x01, 0x06, 0x00, 0x01, 0x02,
+    0x0F, 0x56, 0x13, 0x1C, 0x85, 0x21, 0x06, 0x37, 0x40, 0x3D, 0x24, 0x06, 0x01, 0x01, 0x06, 0x00, 0x01, 0x01, 0x06, 0x14, 0x13, 0x1C, 0x85, 0x21,
+    0x06, 0x37, 0x2B, 0x04, 0x07, 0x03, 0x01, 0x00, 0x06, 0x00, 0x01, 0x01, 0x06, 0x14, 0x2E, 0x1C, 0x85, 0x21, 0x06, 0x1C, 0x2B, 0x0A, 0x07, 0x02,
+    0x01, 0x00, 0x06, 0x00, 0x01, 0x01, 0x55, 0x3C, 0x43, 0x1C, 0x85, 0x21, 0x06, 0x1C, 0x3E, 0x56, 0x0F, 0x01, 0x01, 0x00, 0x08, 0x00, 0x00, 0x01,
+    0x02, 0x57, 0x29, 0x1C, 0x1C, 0x17, 0x81, 0x58, 0x08, 0x17, 0x21, 0x1C, 0x3E, 0x56, 0x0F, 0x01, 0x00, 0x00, 0x14, 0x00, 0x00, 0x01, 0x01, 0x59,
+    0x33, 0x1C, 0x17, 0x5A, 0x5A, 0x5B, 0x5B, 0x12, 0x17, 0x37, 0x3E, 0x5C, 0x06, 0x01, 0x00, 0x00, 0x81, 0x00, 0x05, 0x01, 0x59, 0x4A, 0x17, 0x12,
+    0x5D, 0x81, 0x5E, 0x08, 0x5D, 0x16, 0x58, 0x3E, 0x59, 0x02, 0x01, 0x00, 0x00, 0x81, 0x00, 0x11, 0x01, 0x59, 0x4A, 0x5A, 0x5D, 0x5F, 0x60, 0x61,
+    0x60, 0x5F, 0x5B, 0x12, 0x22, 0x59, 0x02, 0x01, 0x00, 0x00, 0x81, 0x00, 0x05, 0x01, 0x62, 0x63, 0x5D, 0x60, 0x64, 0x81, 0x65, 0x05, 0x64, 0x5E,
+    0x5B, 0x22, 0x3C, 0x01, 0x81, 0x00, 0x81, 0x00, 0x0E, 0x01, 0x62, 0x66, 0x60, 0x65, 0x67, 0x68, 0x68, 0x69, 0x6A, 0x61, 0x5E, 0x22, 0x3C, 0x01,
+    0x81, 0x00, 0x82, 0x00, 0x03, 0x62, 0x0C, 0x6B, 0x68, 0x82, 0x6C, 0x05, 0x6D, 0x65, 0x5F, 0x6E, 0x3C, 0x01, 0x81, 0x00, 0x82, 0x00, 0x0C, 0x6F,
+    0x70, 0x69, 0x71, 0x72, 0x73, 0x74, 0x74, 0x71, 0x6D, 0x6B, 0x75, 0x76, 0x82, 0x00, 0x82, 0x00, 0x03, 0x6F, 0x77, 0x78, 0x73, 0x81, 0x79, 0x05,
+    0x7A, 0x73, 0x71, 0x67, 0x7B, 0x06, 0x82, 0x00, 0x82, 0x00, 0x0C, 0x62, 0x7C, 0x7D, 0x7E, 0x7F, 0x80, 0x81, 0x82, 0x7A, 0x73, 0x83, 0x84, 0x55,
+    0x82, 0x00, 0x82, 0x00, 0x0C, 0x57, 0x85, 0x7E, 0x80, 0x86, 0x87, 0x48, 0x87, 0x88, 0x79, 0x89, 0x0E, 0x55, 0x82, 0x00, 0x82, 0x00, 0x0C, 0x57,
+    0x8A, 0x8B, 0x8C, 0x8D, 0x48, 0x8E, 0x8D, 0x86, 0x7F, 0x8F, 0x90, 0x01, 0x82, 0x00, 0x82, 0x00, 0x0C, 0x76, 0x90, 0x8C, 0x46, 0x45, 0x05, 0x3D,
+    0x46, 0x8D, 0x91, 0x92, 0x93, 0x01, 0x82, 0x00, 0x82, 0x00, 0x0B, 0x94, 0x2C, 0x46, 0x05, 0x04, 0x56, 0x23, 0x05, 0x45, 0x8D, 0x95, 0x96, 0x83,
+    0x00, 0x82, 0x00, 0x0B, 0x01, 0x97, 0x0B, 0x98, 0x5C, 0x07, 0x14, 0x99, 0x9A, 0x34, 0x9B, 0x98, 0x83, 0x00, 0x83, 0x00, 0x0A, 0x9C, 0x98, 0x59,
+    0x3C, 0x06, 0x0F, 0x57, 0x5C, 0x04, 0x1A, 0x9D, 0x83, 0x00, 0x83, 0x00, 0x0A, 0x9E, 0x9C, 0x9F, 0x94, 0x01, 0x55, 0x0F, 0x76, 0x57, 0xA0, 0x9F,
+    0x83, 0x00, 0x83, 0x00, 0x0A, 0xA1, 0x9F, 0xA1, 0xA2, 0x01, 0x01, 0x94, 0x94, 0xA1, 0x9F, 0xA2, 0x83, 0x00, 0x83, 0x00, 0x03, 0xA3, 0xA1, 0xA4,
+    0xA4, 0x81, 0x00, 0x03, 0xA4, 0xA4, 0xA2, 0xA4, 0x83, 0x00, 0x84, 0x00, 0x01, 0xA4, 0xA3, 0x83, 0x00, 0x02, 0xA3, 0xA4, 0xA3, 0x83, 0x00, 0x84,
+    0x00, 0x00, 0xA3, 0x85, 0x00, 0x00, 0xA3, 0x84, 0x00, 0x84, 0x00, 0x00, 0xA3, 0x81, 0x00, 0x01, 0x01, 0x01, 0x87, 0x00, 0x88, 0x00, 0x01, 0x02,
+    0x55, 0x87, 0x00, 0x87, 0x00, 0x02, 0x01, 0x07, 0x0F, 0x87, 0x00, 0x87, 0x00, 0x02, 0x0F, 0x56, 0x14, 0x87, 0x00, 0x87, 0x00, 0x03, 0x3C, 0x42,
+    0x04, 0x01, 0x86, 0x00,
+};
+
+__attribute__((section(".flash_rom")))
+static GUI_CONST_STORAGE uint32_t anim_candle_i0_clut[] = {
+    0xFF050206, 0xFF040517, 0xFF040A1B, 0xFF040624, 0xFF122C52, 0xFF1B3464, 0xFF050A26, 0xFF041134,
+    0xFF4F75B0, 0xFF5784C4, 0xFF112751, 0xFF273861, 0xFF94CBE7, 0xFFA1D3F5, 0xFF49678C, 0xFF060F2A,
+    0xFF5C769B, 0xFFCBE9FC, 0xFFD9F5FC, 0xFF95ABC2, 0xFF0A1B41, 0xFF8AACC4, 0xFFE0FBFB, 0xFFEBFBFC,
+    0xFFC5DBEB, 0xFF243F5C, 0xFF2B4064, 0xFFA9CDE9, 0xFFFBFFFC, 0xFFDBEDFC, 0xFF546C8C, 0xFF506F91,
+    0xFFD4ECF4, 0xFFFCFEFD, 0xFF84A0BD, 0xFF092451, 0xFF03143F, 0xFFE8F5FC, 0xFFBBD4E8, 0xFF25426B,
+    0xFF071C42, 0xFFACC4D9, 0xFF1B3254, 0xFF7E93AB, 0xFF344A6A, 0xFFCEE4F1, 0xFF9CB4CB, 0xFF152D5F,
+    0xFF061640, 0xFF435A7B, 0xFFE2F4FB, 0xFFB5C7DA, 0xFF1F3B69, 0xFF061A4C, 0xFF5D7394, 0xFFECF6FC,
+    0xFF31507B, 0xFF7088A5, 0xFF436389, 0xFF062057, 0xFF0D1832, 0xFF0A2B60, 0xFF869EB2, 0xFF132E62,
+    0xFF728FA9, 0xFF0C2B6C, 0xFF103469, 0xFFA4BCD4, 0xFF143A6C, 0xFF1D3D75, 0xFF204379, 0xFFBDD3E4,
+    0xFF204885, 0xFF244A79, 0xFFB5CCE0, 0xFF2E5089, 0xFFC4D5E6, 0xFF375788, 0xFF3F6298, 0xFF446A99,
+    0xFF52749C, 0xFF16346C, 0xFF5B7B9B, 0xFF657D9C, 0xFF6585A6, 0xFF060A1B, 0xFF0E224C, 0xFF131E33,
+    0xFFE9FBFD, 0xFF151F3D, 0xFFD1FAFD, 0xFFCAF5FD, 0xFF122343, 0xFFBDF8FC, 0xFFB9F8FC, 0xFFA9F5FD,
+    0xFFA6EDFC, 0xFF9AECFC, 0xFF1C2742, 0xFFAED3E6, 0xFF94E4FC, 0xFF88DCFB, 0xFFA3D5EA, 0xFF7BCCF9,
+    0xFF75C4FC, 0xFF76CCFC, 0xFF7ED4FC, 0xFF93E4FA, 0xFF61B4F4, 0xFF6CC4FC, 0xFF7BA2C0, 0xFF142A44,
+    0xFF84B8E1, 0xFF5CACF6, 0xFF519EF4, 0xFF4A94E7, 0xFF4F9CEB, 0xFF7096B9, 0xFF141226, 0xFF74ADE4,
+    0xFF65B0F3, 0xFF4183D2, 0xFF367BCE, 0xFF6084AC, 0xFF6B9CD2, 0xFF4E8FE0, 0xFF3E77C6, 0xFF3670BC,
+    0xFF3166B0, 0xFF215CAD, 0xFF2268B5, 0xFF6DBCF4, 0xFF4F71A1, 0xFF5780B6, 0xFF285BA3, 0xFF295A9A,
+    0xFF2F6DBD, 0xFF5AA0EB, 0xFF4D71A1, 0xFF3665A5, 0xFF285294, 0xFF234E89, 0xFF0C3779, 0xFF5793DB,
+    0xFF3C5C87, 0xFF315FA4, 0xFF4C7DC4, 0xFF2E4A77, 0xFF0E0F1B, 0xFF416AA4, 0xFF2F3D5B, 0xFF283451,
+    0xFF1D2D50, 0xFF1C254C, 0xFF19335C, 0xFF305589, 0xFF1F253D, 0xFF1D2333, 0xFF1D1E2F, 0xFF191824,
+    0xFF212B42, 0xFF19161B, 0xFF160F13, 0xFF120B0C, 0xFF130A0D,
+};
+
+static GUI_CONST_STORAGE IconImage_t anim_candle_i0_image = {
+    ICON_FMT_RLE8, 165, 21, 62, 0x000000,
+    anim_candle_i0_clut,
+    anim_candle_i0, sizeof(anim_candle_i0)
+};
+
+/* 20x62, RLE8, 1669 bytes */
+__attribute__((section(".flash_rom"), aligned(4)))
+static GUI_CONST_STORAGE unsigned char anim_candle_i1[] = {
+    0x92, 0x00, 0x92, 0x00, 0x85, 0x00, 0x03, 0x01, 0x02, 0x03, 0x01, 0x87, 0x00, 0x85, 0x00, 0x03, 0x01, 0x04, 0x05, 0x06, 0x87, 0x00, 0x84, 0x00,
+    0x06, 0x01, 0x07, 0x08, 0x09, 0x0A, 0x01, 0x01, 0x85, 0x00, 0x83, 0x00, 0x07, 0x01, 0x02, 0x0B, 0x0C, 0x0D, 0x0E, 0x06, 0x01, 0x85, 0x00, 0x83,
+    0x00, 0x08, 0x01, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x02, 0x01, 0x84, 0x00, 0x82, 0x00, 0x08, 0x01, 0x03, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+    0x06, 0x81, 0x01, 0x82, 0x00, 0x82, 0x00, 0x0B, 0x01, 0x06, 0x1A, 0x1B, 0x17, 0x1C, 0x1D, 0x1E, 0x07, 0x03, 0x01, 0x01, 0x82, 0x00, 0x0F, 0x00,
+    0x00, 0x01, 0x01, 0x02, 0x07, 0x1F, 0x20, 0x1C, 0x21, 0x17, 0x22, 0x23, 0x0F, 0x02, 0x01, 0x82, 0x00, 0x10, 0x00, 0x00, 0x01, 0x01, 0x06, 0x24,
+    0x22, 0x25, 0x21, 0x21, 0x1C, 0x26, 0x27, 0x07, 0x02, 0x01, 0x01, 0x81, 0x00, 0x07, 0x00, 0x01, 0x01, 0x02, 0x0F, 0x28, 0x29, 0x17, 0x81, 0x21,
+    0x08, 0x20, 0x1F, 0x28, 0x0F, 0x02, 0x01, 0x01, 0x00, 0x00, 0x07, 0x00, 0x01, 0x01, 0x03, 0x07, 0x2A, 0x26, 0x1C, 0x81, 0x21, 0x08, 0x17, 0x2B,
+    0x23, 0x07, 0x06, 0x01, 0x01, 0x00, 0x00, 0x81, 0x01, 0x04, 0x06, 0x24, 0x2C, 0x2D, 0x1C, 0x81, 0x21, 0x04, 0x1C, 0x2E, 0x2F, 0x24, 0x06, 0x81,
+    0x01, 0x00, 0x00, 0x06, 0x01, 0x01, 0x02, 0x0F, 0x30, 0x31, 0x32, 0x82, 0x21, 0x08, 0x1C, 0x33, 0x34, 0x28, 0x0F, 0x02, 0x01, 0x01, 0x00, 0x06,
+    0x01, 0x01, 0x03, 0x0F, 0x35, 0x36, 0x37, 0x82, 0x21, 0x08, 0x1C, 0x18, 0x38, 0x23, 0x07, 0x06, 0x02, 0x01, 0x01, 0x07, 0x01, 0x02, 0x06, 0x07,
+    0x23, 0x39, 0x17, 0x1C, 0x82, 0x21, 0x07, 0x20, 0x3A, 0x3B, 0x07, 0x06, 0x03, 0x01, 0x01, 0x06, 0x01, 0x02, 0x06, 0x3C, 0x3D, 0x3E, 0x17, 0x83,
+    0x21, 0x07, 0x1D, 0x10, 0x3D, 0x14, 0x0F, 0x03, 0x01, 0x01, 0x07, 0x01, 0x03, 0x0F, 0x30, 0x3F, 0x13, 0x1C, 0x1C, 0x82, 0x21, 0x07, 0x37, 0x40,
+    0x41, 0x28, 0x0F, 0x06, 0x01, 0x01, 0x07, 0x01, 0x06, 0x0F, 0x28, 0x42, 0x43, 0x1C, 0x1C, 0x82, 0x21, 0x07, 0x17, 0x22, 0x44, 0x23, 0x07, 0x06,
+    0x01, 0x01, 0x06, 0x01, 0x06, 0x0F, 0x23, 0x45, 0x33, 0x1C, 0x83, 0x21, 0x07, 0x1C, 0x2E, 0x46, 0x23, 0x07, 0x06, 0x02, 0x01, 0x06, 0x02, 0x06,
+    0x07, 0x23, 0x46, 0x47, 0x1C, 0x83, 0x21, 0x07, 0x1C, 0x29, 0x48, 0x3D, 0x24, 0x06, 0x02, 0x01, 0x06, 0x02, 0x06, 0x3C, 0x23, 0x49, 0x18, 0x1C,
+    0x83, 0x21, 0x07, 0x1C, 0x4A, 0x4B, 0x3D, 0x30, 0x0F, 0x03, 0x01, 0x06, 0x02, 0x06, 0x30, 0x3D, 0x38, 0x2D, 0x1C, 0x84, 0x21, 0x06, 0x4C, 0x4D,
+    0x3D, 0x28, 0x0F, 0x03, 0x01, 0x06, 0x02, 0x06, 0x30, 0x3D, 0x4D, 0x1D, 0x1C, 0x83, 0x21, 0x07, 0x1C, 0x2D, 0x4E, 0x42, 0x28, 0x0F, 0x03, 0x01,
+    0x05, 0x02, 0x06, 0x30, 0x3D, 0x3A, 0x32, 0x85, 0x21, 0x06, 0x20, 0x4F, 0x42, 0x28, 0x0F, 0x02, 0x01, 0x05, 0x02, 0x06, 0x30, 0x2F, 0x1F, 0x25,
+    0x85, 0x21, 0x06, 0x1D, 0x50, 0x51, 0x28, 0x0F, 0x02, 0x01, 0x05, 0x02, 0x06, 0x30, 0x2F, 0x10, 0x37, 0x85, 0x21, 0x06, 0x32, 0x52, 0x51, 0x28,
+    0x0F, 0x02, 0x01, 0x05, 0x02, 0x06, 0x07, 0x3D, 0x53, 0x17, 0x85, 0x21, 0x06, 0x32, 0x52, 0x51, 0x28, 0x0F, 0x02, 0x01, 0x05, 0x01, 0x06, 0x3C,
+    0x0A, 0x39, 0x17, 0x85, 0x21, 0x06, 0x25, 0x53, 0x42, 0x30, 0x0F, 0x02, 0x01, 0x05, 0x01, 0x06, 0x3C, 0x0A, 0x2B, 0x1C, 0x85, 0x21, 0x06, 0x25,
+    0x54, 0x42, 0x30, 0x06, 0x02, 0x01, 0x05, 0x01, 0x55, 0x07, 0x56, 0x3E, 0x1C, 0x85, 0x21, 0x06, 0x37, 0x39, 0x3D, 0x24, 0x06, 0x01, 0x01, 0x05,
+    0x01, 0x02, 0x0F, 0x56, 0x13, 0x1C, 0x85, 0x21, 0x06, 0x37, 0x40, 0x3D, 0x24, 0x06, 0x01, 0x01, 0x05, 0x01, 0x01, 0x06, 0x14, 0x13, 0x1C, 0x85,
+    0x21, 0x06, 0x37, 0x2B, 0x04, 0x07, 0x03, 0x01, 0x00, 0x05, 0x01, 0x01, 0x06, 0x14, 0x2E, 0x1C, 0x85, 0x21, 0x06, 0x1C, 0x2B, 0x0A, 0x07, 0x02,
+    0x01, 0x00, 0x05, 0x01, 0x01, 0x55, 0x3C, 0x43, 0x1C, 0x85, 0x21, 0x06, 0x1C, 0x3E, 0x56, 0x0F, 0x01, 0x01, 0x00, 0x07, 0x00, 0x01, 0x02, 0x57,
+    0x29, 0x1C, 0x1C, 0x17, 0x81, 0x58, 0x08, 0x17, 0x21, 0x1C, 0x3E, 0x56, 0x0F, 0x01, 0x00, 0x00, 0x13, 0x00, 0x01, 0x01, 0x59, 0x33, 0x1C, 0x17,
+    0x5A, 0x5A, 0x5B, 0x5B, 0x12, 0x17, 0x37, 0x3E, 0x5C, 0x06, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x59, 0x4A, 0x17, 0x12, 0x5D, 0x81, 0x5E,
+    0x08, 0x5D, 0x16, 0x58, 0x3E, 0x59, 0x02, 0x01, 0x00, 0x00, 0x13, 0x00, 0x00, 0x01, 0x59, 0x4A, 0x5A, 0x5D, 0x5F, 0x60, 0x61, 0x60, 0x5F, 0x5B,
+    0x12, 0x22, 0x59, 0x02, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x62, 0x63, 0x5D, 0x60, 0x64, 0x81, 0x65, 0x05, 0x64, 0x5E, 0x5B, 0x22, 0x3C,
+    0x01, 0x81, 0x00, 0x10, 0x00, 0x00, 0x01, 0x62, 0x66, 0x60, 0x65, 0x67, 0x68, 0x68, 0x69, 0x6A, 0x61, 0x5E, 0x22, 0x3C, 0x01, 0x81, 0x00, 0x81,
+    0x00, 0x03, 0x62, 0x0C, 0x6B, 0x68, 0x82, 0x6C, 0x05, 0x6D, 0x65, 0x5F, 0x6E, 0x3C, 0x01, 0x81, 0x00, 0x81, 0x00, 0x0C, 0x6F, 0x70, 0x69, 0x71,
+    0x72, 0x73, 0x74, 0x74, 0x71, 0x6D, 0x6B, 0x75, 0x76, 0x82, 0x00, 0x81, 0x00, 0x03, 0x6F, 0x77, 0x78, 0x73, 0x81, 0x79, 0x05, 0x7A, 0x73, 0x71,
+    0x67, 0x7B, 0x06, 0x82, 0x00, 0x81, 0x00, 0x0C, 0x62, 0x7C, 0x7D, 0x7E, 0x7F, 0x80, 0x81, 0x82, 0x7A, 0x73, 0x83, 0x84, 0x55, 0x82, 0x00, 0x81,
+    0x00, 0x0C, 0x57, 0x85, 0x7E, 0x80, 0x86, 0x87, 0x48, 0x87, 0x88, 0x79, 0x89, 0x0E, 0x55, 0x82, 0x00, 0x81, 0x00, 0x0C, 0x57, 0x8A, 0x8B, 0x8C,
+    0x8D, 0x48, 0x8E, 0x8D, 0x86, 0x7F, 0x8F, 0x90, 0x01, 0x82, 0x00, 0x81, 0x00, 0x0C, 0x76, 0x90, 0x8C, 0x46, 0x45, 0x05, 0x3D, 0x46, 0x8D, 0x91,
+    0x92, 0x93, 0x01, 0x82, 0x00, 0x81, 0x00, 0x0B, 0x94, 0x2C, 0x46, 0x05, 0x04, 0x56, 0x23, 0x05, 0x45, 0x8D, 0x95, 0x96, 0x83, 0x00, 0x81, 0x00,
+    0x0B, 0x01, 0x97, 0x0B, 0x98, 0x5C, 0x07, 0x14, 0x99, 0x9A, 0x34, 0x9B, 0x98, 0x83, 0x00, 0x82, 0x00, 0x0A, 0x9C, 0x98, 0x59, 0x3C, 0x06, 0x0F,
+    0x57, 0x5C, 0x04, 0x1A, 0x9D, 0x83, 0x00, 0x82, 0x00, 0x0A, 0x9E, 0x9C, 0x9F, 0x94, 0x01, 0x55, 0x0F, 0x76, 0x57, 0xA0, 0x9F, 0x83, 0x00, 0x82,
+    0x00, 0x0A, 0xA1, 0x9F, 0xA1, 0xA2, 0x01, 0x01, 0x94, 0x94, 0xA1, 0x9F, 0xA2, 0x83, 0x00, 0x82, 0x00, 0x03, 0xA3, 0xA1, 0xA4, 0xA4, 0x81, 0x00,
+    0x03, 0xA4, 0xA4, 0xA2, 0xA4, 0x83, 0x00, 0x83, 0x00, 0x01, 0xA4, 0xA3, 0x83, 0x00, 0x02, 0xA3, 0xA4, 0xA3, 0x83, 0x00, 0x83, 0x00, 0x00, 0xA3,
+    0x85, 0x00, 0x00, 0xA3, 0x84, 0x00, 0x83, 0x00, 0x00, 0xA3, 0x81, 0x00, 0x01, 0x01, 0x01, 0x87, 0x00, 0x87, 0x00, 0x01, 0x02, 0x55, 0x87, 0x00,
+    0x86, 0x00, 0x02, 0x01, 0x07, 0x0F, 0x87, 0x00, 0x86, 0x00, 0x02, 0x0F, 0x56, 0x14, 0x87, 0x00, 0x86, 0x00, 0x03, 0x3C, 0x42, 0x04, 0x01, 0x86,
+    0x00,
+};
+
+__attribute__((section(".flash_rom")))
+static GUI_CONST_STORAGE uint32_t anim_candle_i1_clut[] = {
+    0xFF050206, 0xFF040517, 0xFF040A1B, 0xFF040624, 0xFF122C52, 0xFF1B3464, 0xFF050A26, 0xFF041134,
+    0xFF4F75B0, 0xFF5784C4, 0xFF112751, 0xFF273861, 0xFF94CBE7, 0xFFA1D3F5, 0xFF49678C, 0xFF060F2A,
+    0xFF5C769B, 0xFFCBE9FC, 0xFFD9F5FC, 0xFF95ABC2, 0xFF0A1B41, 0xFF8AACC4, 0xFFE0FBFB, 0xFFEBFBFC,
+    0xFFC5DBEB, 0xFF243F5C, 0xFF2B4064, 0xFFA9CDE9, 0xFFFBFFFC, 0xFFDBEDFC, 0xFF546C8C, 0xFF506F91,
+    0xFFD4ECF4, 0xFFFCFEFD, 0xFF84A0BD, 0xFF092451, 0xFF03143F, 0xFFE8F5FC, 0xFFBBD4E8, 0xFF25426B,
+    0xFF071C42, 0xFFACC4D9, 0xFF1B3254, 0xFF7E93AB, 0xFF344A6A, 0xFFCEE4F1, 0xFF9CB4CB, 0xFF152D5F,
+    0xFF061640, 0xFF435A7B, 0xFFE2F4FB, 0xFFB5C7DA, 0xFF1F3B69, 0xFF061A4C, 0xFF5D7394, 0xFFECF6FC,
+    0xFF31507B, 0xFF7088A5, 0xFF436389, 0xFF062057, 0xFF0D1832, 0xFF0A2B60, 0xFF869EB2, 0xFF132E62,
+    0xFF728FA9, 0xFF0C2B6C, 0xFF103469, 0xFFA4BCD4, 0xFF143A6C, 0xFF1D3D75, 0xFF204379, 0xFFBDD3E4,
+    0xFF204885, 0xFF244A79, 0xFFB5CCE0, 0xFF2E5089, 0xFFC4D5E6, 0xFF375788, 0xFF3F6298, 0xFF446A99,
+    0xFF52749C, 0xFF16346C, 0xFF5B7B9B, 0xFF657D9C, 0xFF6585A6, 0xFF060A1B, 0xFF0E224C, 0xFF131E33,
+    0xFFE9FBFD, 0xFF151F3D, 0xFFD1FAFD, 0xFFCAF5FD, 0xFF122343, 0xFFBDF8FC, 0xFFB9F8FC, 0xFFA9F5FD,
+    0xFFA6EDFC, 0xFF9AECFC, 0xFF1C2742, 0xFFAED3E6, 0xFF94E4FC, 0xFF88DCFB, 0xFFA3D5EA, 0xFF7BCCF9,
+    0xFF75C4FC, 0xFF76CCFC, 0xFF7ED4FC, 0xFF93E4FA, 0xFF61B4F4, 0xFF6CC4FC, 0xFF7BA2C0, 0xFF142A44,
+    0xFF84B8E1, 0xFF5CACF6, 0xFF519EF4, 0xFF4A94E7, 0xFF4F9CEB, 0xFF7096B9, 0xFF141226, 0xFF74ADE4,
+    0xFF65B0F3, 0xFF4183D2, 0xFF367BCE, 0xFF6084AC, 0xFF6B9CD2, 0xFF4E8FE0, 0xFF3E77C6, 0xFF3670BC,
+    0xFF3166B0, 0xFF215CAD, 0xFF2268B5, 0xFF6DBCF4, 0xFF4F71A1, 0xFF5780B6, 0xFF285BA3, 0xFF295A9A,
+    0xFF2F6DBD, 0xFF5AA0EB, 0xFF4D71A1, 0xFF3665A5, 0xFF285294, 0xFF234E89, 0xFF0C3779, 0xFF5793DB,
+    0xFF3C5C87, 0xFF315FA4, 0xFF4C7DC4, 0xFF2E4A77, 0xFF0E0F1B, 0xFF416AA4, 0xFF2F3D5B, 0xFF283451,
+    0xFF1D2D50, 0xFF1C254C, 0xFF19335C, 0xFF305589, 0xFF1F253D, 0xFF1D2333, 0xFF1D1E2F, 0xFF191824,
+    0xFF212B42, 0xFF19161B, 0xFF160F13, 0xFF120B0C, 0xFF130A0D,
+};
+
+static GUI_CONST_STORAGE IconImage_t anim_candle_i1_image = {
+    ICON_FMT_RLE8, 165, 20, 62, 0x000000,
+    anim_candle_i1_clut,
+    anim_candle_i1, sizeof(anim_candle_i1)
+};
+
+/* 19x46, RLE8, 1343 bytes */
+__attribute__((section(".flash_rom"), aligned(4)))
+static GUI_CONST_STORAGE unsigned char anim_candle_i2[] = {
+    0x86, 0x00, 0x02, 0x01, 0x02, 0x03, 0x86, 0x00, 0x85, 0x00, 0x03, 0x01, 0x04, 0x05, 0x06, 0x86, 0x00, 0x84, 0x00, 0x06, 0x03, 0x07, 0x08, 0x09,
+    0x0A, 0x03, 0x03, 0x84, 0x00, 0x83, 0x00, 0x07, 0x03, 0x01, 0x0B, 0x0C, 0x0D, 0x0E, 0x06, 0x03, 0x84, 0x00, 0x83, 0x00, 0x08, 0x03, 0x0F, 0x10,
+    0x11, 0x12, 0x13, 0x14, 0x01, 0x03, 0x83, 0x00, 0x82, 0x00, 0x08, 0x03, 0x02, 0x15, 0x16, 0x17, 0x18, 0x19, 0x0B, 0x0F, 0x81, 0x03, 0x81, 0x00,
+    0x82, 0x00, 0x0B, 0x03, 0x06, 0x1A, 0x1B, 0x18, 0x1C, 0x1D, 0x1E, 0x07, 0x02, 0x03, 0x03, 0x81, 0x00, 0x12, 0x00, 0x00, 0x03, 0x03, 0x01, 0x07,
+    0x1F, 0x11, 0x1C, 0x20, 0x18, 0x21, 0x22, 0x0F, 0x01, 0x03, 0x03, 0x00, 0x00, 0x12, 0x00, 0x00, 0x03, 0x03, 0x06, 0x23, 0x21, 0x24, 0x20, 0x20,
+    0x1C, 0x25, 0x26, 0x07, 0x01, 0x03, 0x03, 0x00, 0x00, 0x07, 0x00, 0x03, 0x03, 0x01, 0x0F, 0x15, 0x27, 0x18, 0x81, 0x20, 0x07, 0x28, 0x1E, 0x15,
+    0x0F, 0x01, 0x03, 0x03, 0x00, 0x07, 0x00, 0x03, 0x03, 0x01, 0x07, 0x29, 0x25, 0x1C, 0x81, 0x20, 0x04, 0x18, 0x2A, 0x22, 0x07, 0x06, 0x81, 0x03,
+    0x81, 0x03, 0x04, 0x06, 0x23, 0x2B, 0x2C, 0x1C, 0x81, 0x20, 0x04, 0x1C, 0x2D, 0x2E, 0x2F, 0x06, 0x81, 0x03, 0x06, 0x03, 0x03, 0x01, 0x0F, 0x15,
+    0x30, 0x24, 0x82, 0x20, 0x07, 0x1C, 0x31, 0x32, 0x33, 0x0F, 0x01, 0x03, 0x03, 0x06, 0x03, 0x03, 0x06, 0x0F, 0x33, 0x34, 0x35, 0x82, 0x20, 0x07,
+    0x1C, 0x19, 0x36, 0x22, 0x07, 0x06, 0x01, 0x03, 0x07, 0x03, 0x01, 0x06, 0x07, 0x22, 0x37, 0x18, 0x1C, 0x82, 0x20, 0x06, 0x28, 0x38, 0x39, 0x07,
+    0x06, 0x02, 0x03, 0x06, 0x03, 0x01, 0x0F, 0x3A, 0x3B, 0x3C, 0x18, 0x83, 0x20, 0x06, 0x24, 0x3D, 0x3B, 0x14, 0x0F, 0x02, 0x03, 0x06, 0x03, 0x02,
+    0x0F, 0x2F, 0x3E, 0x13, 0x1C, 0x83, 0x20, 0x06, 0x35, 0x3F, 0x40, 0x15, 0x0F, 0x06, 0x03, 0x06, 0x03, 0x06, 0x0F, 0x33, 0x40, 0x41, 0x1C, 0x83,
+    0x20, 0x06, 0x18, 0x21, 0x42, 0x22, 0x07, 0x06, 0x03, 0x06, 0x03, 0x06, 0x0F, 0x22, 0x43, 0x31, 0x1C, 0x83, 0x20, 0x06, 0x1C, 0x2D, 0x44, 0x22,
+    0x07, 0x06, 0x01, 0x06, 0x01, 0x06, 0x07, 0x22, 0x45, 0x46, 0x1C, 0x83, 0x20, 0x06, 0x1C, 0x27, 0x47, 0x3B, 0x23, 0x06, 0x01, 0x06, 0x01, 0x06,
+    0x3A, 0x22, 0x48, 0x19, 0x1C, 0x84, 0x20, 0x05, 0x49, 0x4A, 0x3B, 0x2F, 0x0F, 0x02, 0x06, 0x01, 0x06, 0x2F, 0x3B, 0x36, 0x2C, 0x1C, 0x84, 0x20,
+    0x05, 0x4B, 0x4C, 0x3B, 0x15, 0x0F, 0x02, 0x06, 0x01, 0x06, 0x2F, 0x3B, 0x4D, 0x1D, 0x1C, 0x84, 0x20, 0x05, 0x2C, 0x4E, 0x3E, 0x15, 0x0F, 0x02,
+    0x05, 0x01, 0x06, 0x2F, 0x3B, 0x38, 0x24, 0x85, 0x20, 0x05, 0x28, 0x4F, 0x40, 0x15, 0x0F, 0x02, 0x05, 0x01, 0x06, 0x2F, 0x2E, 0x1F, 0x50, 0x85,
+    0x20, 0x05, 0x1D, 0x51, 0x52, 0x15, 0x0F, 0x01, 0x05, 0x01, 0x06, 0x2F, 0x3B, 0x3D, 0x35, 0x85, 0x20, 0x05, 0x24, 0x3D, 0x52, 0x15, 0x0F, 0x01,
+    0x05, 0x01, 0x06, 0x07, 0x3B, 0x53, 0x18, 0x85, 0x20, 0x05, 0x24, 0x10, 0x52, 0x15, 0x0F, 0x01, 0x05, 0x03, 0x06, 0x3A, 0x0A, 0x37, 0x1C, 0x85,
+    0x20, 0x05, 0x50, 0x53, 0x52, 0x2F, 0x0F, 0x01, 0x05, 0x03, 0x06, 0x3A, 0x0A, 0x2A, 0x1C, 0x85, 0x20, 0x05, 0x50, 0x54, 0x40, 0x2F, 0x06, 0x01,
+    0x05, 0x03, 0x01, 0x3A, 0x55, 0x3C, 0x1C, 0x85, 0x20, 0x05, 0x35, 0x37, 0x3B, 0x23, 0x06, 0x03, 0x05, 0x03, 0x01, 0x0F, 0x56, 0x13, 0x1C, 0x85,
+    0x20, 0x05, 0x35, 0x3F, 0x3B, 0x07, 0x06, 0x03, 0x05, 0x03, 0x03, 0x06, 0x14, 0x13, 0x1C, 0x85, 0x20, 0x05, 0x35, 0x2A, 0x04, 0x07, 0x02, 0x03,
+    0x05, 0x03, 0x03, 0x06, 0x14, 0x2D, 0x1C, 0x85, 0x20, 0x05, 0x1C, 0x2A, 0x0A, 0x07, 0x01, 0x03, 0x05, 0x03, 0x03, 0x57, 0x14, 0x41, 0x1C, 0x85,
+    0x20, 0x05, 0x1C, 0x3C, 0x55, 0x0F, 0x03, 0x03, 0x07, 0x03, 0x03, 0x01, 0x58, 0x27, 0x1C, 0x1C, 0x18, 0x81, 0x59, 0x07, 0x18, 0x20, 0x1C, 0x3C,
+    0x55, 0x06, 0x03, 0x00, 0x12, 0x00, 0x03, 0x03, 0x58, 0x31, 0x20, 0x18, 0x5A, 0x5A, 0x5B, 0x5A, 0x12, 0x18, 0x35, 0x3C, 0x56, 0x06, 0x03, 0x00,
+    0x07, 0x00, 0x00, 0x03, 0x5C, 0x49, 0x18, 0x12, 0x5D, 0x81, 0x5E, 0x07, 0x5D, 0x17, 0x18, 0x3C, 0x5C, 0x01, 0x03, 0x00, 0x12, 0x00, 0x00, 0x03,
+    0x5C, 0x49, 0x5A, 0x5D, 0x5F, 0x60, 0x61, 0x60, 0x5F, 0x5B, 0x12, 0x3C, 0x5C, 0x01, 0x03, 0x00, 0x07, 0x00, 0x00, 0x03, 0x62, 0x1B, 0x5D, 0x60,
+    0x63, 0x81, 0x64, 0x07, 0x63, 0x5E, 0x5B, 0x21, 0x3A, 0x03, 0x00, 0x00, 0x12, 0x00, 0x00, 0x03, 0x62, 0x65, 0x5F, 0x64, 0x66, 0x67, 0x67, 0x66,
+    0x68, 0x61, 0x5E, 0x21, 0x3A, 0x03, 0x00, 0x00, 0x81, 0x00, 0x03, 0x62, 0x0C, 0x69, 0x67, 0x82, 0x6A, 0x07, 0x6B, 0x64, 0x5F, 0x6C, 0x3A, 0x03,
+    0x00, 0x00, 0x81, 0x00, 0x03, 0x62, 0x6D, 0x66, 0x6E, 0x82, 0x6F, 0x04, 0x6E, 0x6B, 0x69, 0x70, 0x71, 0x81, 0x00, 0x81, 0x00, 0x03, 0x72, 0x73,
+    0x74, 0x75, 0x81, 0x76, 0x05, 0x77, 0x75, 0x6E, 0x78, 0x79, 0x06, 0x81, 0x00, 0x81, 0x00, 0x0C, 0x62, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x7F, 0x7E,
+    0x77, 0x75, 0x80, 0x81, 0x57, 0x81, 0x00, 0x81, 0x00, 0x0C, 0x58, 0x82, 0x7C, 0x7E, 0x83, 0x84, 0x47, 0x84, 0x7D, 0x76, 0x85, 0x0E, 0x03, 0x81,
+    0x00, 0x81, 0x00, 0x0C, 0x58, 0x86, 0x87, 0x88, 0x89, 0x45, 0x42, 0x89, 0x83, 0x7D, 0x8A, 0x4D, 0x03, 0x81, 0x00,
+};
+
+__attribute__((section(".flash_rom")))
+static GUI_CONST_STORAGE uint32_t anim_candle_i2_clut[] = {
+    0xFF050206, 0xFF040A1B, 0xFF040624, 0xFF040517, 0xFF122C52, 0xFF19335C, 0xFF050A26, 0xFF041134,
+    0xFF4F75B0, 0xFF5784C4, 0xFF112751, 0xFF243F5C, 0xFF94CBE7, 0xFFA1D3F5, 0xFF49678C, 0xFF060F2A,
+    0xFF5B7B9B, 0xFFCBE9FC, 0xFFD9F5FC, 0xFF95ABC2, 0xFF0A1B41, 0xFF071C42, 0xFF8AACC4, 0xFFE0FBFB,
+    0xFFEBFBFC, 0xFFC5DBEB, 0xFF2B4064, 0xFFAED3E6, 0xFFFBFFFC, 0xFFDBEDFC, 0xFF546C8C, 0xFF506F91,
+    0xFFFCFEFD, 0xFF84A0BD, 0xFF092451, 0xFF03143F, 0xFFE2F4FB, 0xFFBBD4E8, 0xFF25426B, 0xFFACC4D9,
+    0xFFD4ECF4, 0xFF1B3254, 0xFF7E93AB, 0xFF344A6A, 0xFFCEE4F1, 0xFF9CB4CB, 0xFF152D5F, 0xFF061640,
+    0xFF435A7B, 0xFFB5C7DA, 0xFF20406A, 0xFF061A4C, 0xFF5D7394, 0xFFECF6FC, 0xFF31507B, 0xFF7088A5,
+    0xFF436389, 0xFF062057, 0xFF0D1832, 0xFF0A2B60, 0xFF869EB2, 0xFF5C769B, 0xFF132E62, 0xFF728FA9,
+    0xFF103469, 0xFFA4BCD4, 0xFF143A6C, 0xFF1D3D75, 0xFF1E3E76, 0xFF204379, 0xFFBDD3E4, 0xFF204885,
+    0xFF244A79, 0xFFB5CCE0, 0xFF2E5089, 0xFFC4D5E6, 0xFF375788, 0xFF3C5C87, 0xFF3F6298, 0xFF446A99,
+    0xFFE8F5FC, 0xFF52749C, 0xFF16346C, 0xFF657D9C, 0xFF6585A6, 0xFF0E224C, 0xFF122343, 0xFF060A1B,
+    0xFF131E33, 0xFFE9FBFD, 0xFFD1FAFD, 0xFFCAF5FD, 0xFF151F3D, 0xFFBDF8FC, 0xFFB9F8FC, 0xFFA9F5FD,
+    0xFFA6EDFC, 0xFF9AECFC, 0xFF1C2742, 0xFF94E4FC, 0xFF88DCFB, 0xFFA3D5EA, 0xFF76CCFC, 0xFF75C4FC,
+    0xFF7ED4FC, 0xFF93E4FA, 0xFF61B4F4, 0xFF6CC4FC, 0xFF7BA2C0, 0xFF84B8E1, 0xFF5CACF6, 0xFF4F9CEB,
+    0xFF7096B9, 0xFF141226, 0xFF142A44, 0xFF74ADE4, 0xFF65B0F3, 0xFF4A94E7, 0xFF4183D2, 0xFF367BCE,
+    0xFF7BCCF9, 0xFF6084AC, 0xFF6B9CD2, 0xFF4E8FE0, 0xFF3E77C6, 0xFF3670BC, 0xFF3166B0, 0xFF215CAD,
+    0xFF6DBCF4, 0xFF4F71A1, 0xFF5780B6, 0xFF285BA3, 0xFF295A9A, 0xFF5AA0EB, 0xFF4D71A1, 0xFF3665A5,
+    0xFF285294, 0xFF234E89, 0xFF5793DB,
+};
+
+static GUI_CONST_STORAGE IconImage_t anim_candle_i2_image = {
+    ICON_FMT_RLE8, 139, 19, 46, 0x000000,
+    anim_candle_i2_clut,
+    anim_candle_i2, sizeof(anim_candle_i2)
+};
+
+/* 10x14, RLE8, 314 bytes */
+__attribute__((section(".flash_rom"), aligned(4)))
+static GUI_CONST_STORAGE unsigned char anim_candle_i3[] = {
+    0x09, 0x00, 0x01, 0x02, 0x03, 0x04, 0x01, 0x05, 0x06, 0x07, 0x08, 0x09, 0x01, 0x09, 0x0A, 0x0B, 0x0B, 0x09, 0x02, 0x05, 0x0C, 0x0D, 0x09, 0x0E,
+    0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x0F, 0x09, 0x0F, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x10, 0x1C, 0x1D, 0x1E, 0x09, 0x1F, 0x20, 0x21,
+    0x22, 0x23, 0x1A, 0x24, 0x1B, 0x25, 0x20, 0x09, 0x20, 0x26, 0x27, 0x22, 0x22, 0x21, 0x21, 0x26, 0x20, 0x27, 0x02, 0x27, 0x28, 0x28, 0x81, 0x29,
+    0x03, 0x28, 0x28, 0x27, 0x2A, 0x01, 0x28, 0x2A, 0x83, 0x29, 0x02, 0x2A, 0x28, 0x2A, 0x00, 0x28, 0x85, 0x29, 0x01, 0x2A, 0x29, 0x00, 0x2A, 0x81,
+    0x29, 0x01, 0x22, 0x22, 0x82, 0x29, 0x82, 0x29, 0x01, 0x2B, 0x23, 0x82, 0x29, 0x81, 0x29, 0x02, 0x22, 0x11, 0x1A, 0x82, 0x29, 0x81, 0x29, 0x02,
+    0x1A, 0x0B, 0x12, 0x82, 0x29, 0x81, 0x29, 0x03, 0x18, 0x2C, 0x1C, 0x22, 0x81, 0x29,
+};
+
+__attribute__((section(".flash_rom")))
+static GUI_CONST_STORAGE uint32_t anim_candle_i3_clut[] = {
+    0xFF285294, 0xFF204379, 0xFF1D3D75, 0xFF103469, 0xFF0A2B60, 0xFF234E89, 0xFF315FA4, 0xFF4C7DC4,
+    0xFF2E4A77, 0xFF1B3464, 0xFF152D5F, 0xFF0E224C, 0xFF416AA4, 0xFF2F3D5B, 0xFF273861, 0xFF1D2D50,
+    0xFF122343, 0xFF041134, 0xFF0A1B41, 0xFF1C254C, 0xFF19335C, 0xFF20406A, 0xFF305589, 0xFF151F3D,
+    0xFF0D1832, 0xFF050A26, 0xFF060F2A, 0xFF131E33, 0xFF122C52, 0xFF2B4064, 0xFF1D2333, 0xFF1F253D,
+    0xFF191824, 0xFF0E0F1B, 0xFF040517, 0xFF060A1B, 0xFF141226, 0xFF212B42, 0xFF19161B, 0xFF160F13,
+    0xFF130A0D, 0xFF050206, 0xFF120B0C, 0xFF040A1B, 0xFF132E62,
+};
+
+static GUI_CONST_STORAGE IconImage_t anim_candle_i3_image = {
+    ICON_FMT_RLE8, 45, 10, 14, 0x000000,
+    anim_candle_i3_clut,
+    anim_candle_i3, sizeof(anim_candle_i3)
+};
+
+/* 20x62, RLE8, 1614 bytes */
+__attribute__((section(".flash_rom"), aligned(4)))
+static GUI_CONST_STORAGE unsigned char anim_candle_i4[] = {
+    0x86, 0x00, 0x01, 0x01, 0x02, 0x88, 0x00, 0x85, 0x00, 0x03, 0x01, 0x03, 0x04, 0x05, 0x87, 0x00, 0x84, 0x00, 0x05, 0x01, 0x05, 0x06, 0x07, 0x08,
+    0x01, 0x86, 0x00, 0x83, 0x00, 0x07, 0x01, 0x01, 0x09, 0x0A, 0x0B, 0x0C, 0x05, 0x01, 0x85, 0x00, 0x83, 0x00, 0x08, 0x01, 0x0D, 0x0E, 0x0F, 0x10,
+    0x11, 0x12, 0x01, 0x01, 0x84, 0x00, 0x83, 0x00, 0x08, 0x01, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x0D, 0x01, 0x84, 0x00, 0x83, 0x00, 0x08, 0x02,
+    0x19, 0x1A, 0x1B, 0x16, 0x1C, 0x1D, 0x1E, 0x01, 0x84, 0x00, 0x82, 0x00, 0x08, 0x01, 0x0D, 0x1F, 0x0F, 0x16, 0x16, 0x1B, 0x20, 0x21, 0x81, 0x01,
+    0x82, 0x00, 0x82, 0x00, 0x03, 0x01, 0x1E, 0x22, 0x10, 0x81, 0x16, 0x04, 0x23, 0x18, 0x05, 0x01, 0x01, 0x82, 0x00, 0x81, 0x00, 0x04, 0x01, 0x01,
+    0x24, 0x11, 0x1B, 0x81, 0x16, 0x04, 0x25, 0x0C, 0x13, 0x01, 0x01, 0x82, 0x00, 0x07, 0x00, 0x00, 0x01, 0x01, 0x05, 0x26, 0x27, 0x1B, 0x81, 0x16,
+    0x03, 0x1B, 0x28, 0x21, 0x02, 0x81, 0x01, 0x01, 0x00, 0x00, 0x06, 0x00, 0x01, 0x01, 0x02, 0x29, 0x2A, 0x17, 0x83, 0x16, 0x02, 0x11, 0x2B, 0x05,
+    0x82, 0x01, 0x00, 0x00, 0x06, 0x00, 0x01, 0x01, 0x02, 0x13, 0x2C, 0x25, 0x83, 0x16, 0x03, 0x2D, 0x2E, 0x13, 0x0D, 0x81, 0x01, 0x00, 0x00, 0x81,
+    0x01, 0x03, 0x05, 0x2F, 0x1F, 0x1C, 0x83, 0x16, 0x03, 0x30, 0x31, 0x2F, 0x05, 0x81, 0x01, 0x00, 0x00, 0x06, 0x01, 0x01, 0x02, 0x05, 0x24, 0x1D,
+    0x32, 0x83, 0x16, 0x04, 0x33, 0x34, 0x24, 0x1E, 0x02, 0x81, 0x01, 0x06, 0x01, 0x01, 0x0D, 0x1E, 0x35, 0x36, 0x1B, 0x83, 0x16, 0x07, 0x37, 0x0C,
+    0x35, 0x13, 0x0D, 0x02, 0x01, 0x01, 0x06, 0x01, 0x02, 0x05, 0x13, 0x38, 0x28, 0x32, 0x83, 0x16, 0x07, 0x32, 0x39, 0x38, 0x13, 0x05, 0x0D, 0x01,
+    0x01, 0x05, 0x01, 0x02, 0x05, 0x13, 0x2B, 0x3A, 0x84, 0x16, 0x07, 0x1B, 0x28, 0x04, 0x24, 0x1E, 0x0D, 0x01, 0x01, 0x05, 0x01, 0x0D, 0x1E, 0x24,
+    0x04, 0x11, 0x85, 0x16, 0x06, 0x3B, 0x3C, 0x3D, 0x1E, 0x05, 0x01, 0x01, 0x05, 0x01, 0x0D, 0x1E, 0x35, 0x3E, 0x2D, 0x85, 0x16, 0x06, 0x11, 0x3F,
+    0x35, 0x13, 0x05, 0x01, 0x01, 0x05, 0x01, 0x05, 0x1E, 0x35, 0x40, 0x27, 0x85, 0x16, 0x06, 0x41, 0x42, 0x38, 0x13, 0x05, 0x01, 0x01, 0x05, 0x01,
+    0x05, 0x13, 0x03, 0x43, 0x30, 0x85, 0x16, 0x06, 0x2D, 0x44, 0x2B, 0x13, 0x05, 0x02, 0x01, 0x05, 0x02, 0x05, 0x13, 0x38, 0x45, 0x33, 0x85, 0x16,
+    0x06, 0x27, 0x46, 0x04, 0x24, 0x05, 0x02, 0x01, 0x05, 0x02, 0x05, 0x13, 0x38, 0x47, 0x25, 0x85, 0x16, 0x06, 0x17, 0x47, 0x48, 0x24, 0x1E, 0x02,
+    0x01, 0x05, 0x02, 0x05, 0x13, 0x2B, 0x49, 0x25, 0x85, 0x16, 0x06, 0x33, 0x0E, 0x48, 0x21, 0x1E, 0x02, 0x01, 0x05, 0x02, 0x05, 0x13, 0x4A, 0x4B,
+    0x1C, 0x85, 0x16, 0x06, 0x25, 0x4C, 0x3E, 0x21, 0x1E, 0x02, 0x01, 0x05, 0x02, 0x05, 0x13, 0x4A, 0x4D, 0x1C, 0x85, 0x16, 0x06, 0x4E, 0x4F, 0x3F,
+    0x21, 0x1E, 0x02, 0x01, 0x05, 0x01, 0x05, 0x13, 0x4A, 0x50, 0x32, 0x85, 0x16, 0x06, 0x1C, 0x51, 0x3F, 0x24, 0x1E, 0x02, 0x01, 0x05, 0x01, 0x05,
+    0x13, 0x2B, 0x39, 0x1B, 0x85, 0x16, 0x06, 0x1C, 0x39, 0x48, 0x24, 0x1E, 0x02, 0x01, 0x05, 0x01, 0x05, 0x52, 0x2B, 0x36, 0x1B, 0x85, 0x16, 0x06,
+    0x53, 0x39, 0x48, 0x24, 0x05, 0x01, 0x01, 0x05, 0x01, 0x0D, 0x1E, 0x2B, 0x28, 0x1B, 0x85, 0x16, 0x06, 0x53, 0x39, 0x48, 0x24, 0x05, 0x01, 0x01,
+    0x05, 0x01, 0x02, 0x1E, 0x03, 0x54, 0x1B, 0x85, 0x16, 0x06, 0x32, 0x36, 0x04, 0x24, 0x05, 0x01, 0x01, 0x04, 0x01, 0x01, 0x1E, 0x26, 0x54, 0x86,
+    0x16, 0x06, 0x32, 0x22, 0x4A, 0x13, 0x0D, 0x01, 0x01, 0x04, 0x01, 0x01, 0x05, 0x26, 0x3A, 0x87, 0x16, 0x05, 0x28, 0x2B, 0x13, 0x0D, 0x01, 0x00,
+    0x04, 0x01, 0x01, 0x55, 0x12, 0x11, 0x87, 0x16, 0x05, 0x54, 0x2B, 0x1E, 0x01, 0x01, 0x00, 0x04, 0x01, 0x01, 0x55, 0x52, 0x41, 0x87, 0x16, 0x05,
+    0x54, 0x03, 0x1E, 0x01, 0x01, 0x00, 0x07, 0x00, 0x01, 0x02, 0x12, 0x2D, 0x16, 0x16, 0x1B, 0x81, 0x56, 0x08, 0x1B, 0x16, 0x16, 0x54, 0x26, 0x05,
+    0x01, 0x00, 0x00, 0x07, 0x00, 0x01, 0x01, 0x12, 0x57, 0x16, 0x1B, 0x10, 0x81, 0x58, 0x08, 0x15, 0x1B, 0x16, 0x54, 0x21, 0x05, 0x01, 0x00, 0x00,
+    0x07, 0x00, 0x00, 0x01, 0x12, 0x57, 0x1B, 0x10, 0x59, 0x81, 0x5A, 0x08, 0x59, 0x15, 0x56, 0x54, 0x12, 0x02, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00,
+    0x01, 0x12, 0x27, 0x58, 0x59, 0x5B, 0x81, 0x5C, 0x05, 0x5B, 0x5D, 0x10, 0x54, 0x5E, 0x02, 0x81, 0x00, 0x07, 0x00, 0x00, 0x01, 0x5F, 0x60, 0x59,
+    0x5B, 0x61, 0x81, 0x62, 0x05, 0x63, 0x5A, 0x5D, 0x3B, 0x5E, 0x01, 0x81, 0x00, 0x10, 0x00, 0x00, 0x01, 0x64, 0x65, 0x5B, 0x62, 0x66, 0x67, 0x67,
+    0x66, 0x68, 0x5C, 0x5A, 0x3B, 0x52, 0x01, 0x81, 0x00, 0x81, 0x00, 0x04, 0x64, 0x69, 0x61, 0x66, 0x6A, 0x81, 0x6B, 0x05, 0x67, 0x62, 0x5B, 0x6C,
+    0x52, 0x01, 0x81, 0x00, 0x81, 0x00, 0x04, 0x64, 0x0A, 0x66, 0x6B, 0x6D, 0x81, 0x6E, 0x04, 0x6F, 0x67, 0x70, 0x14, 0x1E, 0x82, 0x00, 0x81, 0x00,
+    0x0C, 0x5F, 0x71, 0x6B, 0x72, 0x73, 0x74, 0x74, 0x75, 0x72, 0x6B, 0x76, 0x77, 0x05, 0x82, 0x00, 0x81, 0x00, 0x0C, 0x78, 0x79, 0x72, 0x7A, 0x7B,
+    0x7C, 0x7D, 0x7E, 0x7A, 0x72, 0x6A, 0x4F, 0x55, 0x82, 0x00, 0x81, 0x00, 0x0C, 0x5E, 0x7F, 0x7A, 0x80, 0x81, 0x82, 0x83, 0x82, 0x7C, 0x74, 0x84,
+    0x4B, 0x55, 0x82, 0x00, 0x81, 0x00, 0x0C, 0x5E, 0x4C, 0x80, 0x46, 0x85, 0x86, 0x3F, 0x83, 0x81, 0x7B, 0x87, 0x49, 0x01, 0x82, 0x00, 0x81, 0x00,
+    0x0B, 0x88, 0x34, 0x46, 0x86, 0x89, 0x3E, 0x8A, 0x42, 0x8B, 0x81, 0x8C, 0x2C, 0x83, 0x00, 0x81, 0x00, 0x0B, 0x8D, 0x8E, 0x43, 0x8F, 0x4A, 0x03,
+    0x03, 0x3E, 0x40, 0x8B, 0x06, 0x90, 0x83, 0x00, 0x81, 0x00, 0x0B, 0x01, 0x91, 0x90, 0x92, 0x21, 0x13, 0x21, 0x92, 0x19, 0x93, 0x45, 0x64, 0x83,
+    0x00, 0x82, 0x00, 0x0A, 0x78, 0x09, 0x5E, 0x52, 0x05, 0x1E, 0x52, 0x12, 0x09, 0x90, 0x94, 0x83, 0x00, 0x82, 0x00, 0x0A, 0x95, 0x94, 0x88, 0x8D,
+    0x01, 0x55, 0x8D, 0x88, 0x5E, 0x78, 0x96, 0x83, 0x00, 0x82, 0x00, 0x0A, 0x97, 0x96, 0x8D, 0x97, 0x00, 0x01, 0x55, 0x8D, 0x98, 0x96, 0x97, 0x83,
+    0x00, 0x82, 0x00, 0x03, 0x99, 0x97, 0x9A, 0x99, 0x81, 0x00, 0x03, 0x9A, 0x9A, 0x97, 0x99, 0x83, 0x00, 0x83, 0x00, 0x02, 0x9A, 0x99, 0x99, 0x82,
+    0x00, 0x01, 0x99, 0x99, 0x84, 0x00, 0x83, 0x00, 0x00, 0x99, 0x85, 0x00, 0x00, 0x99, 0x84, 0x00, 0x83, 0x00, 0x00, 0x99, 0x81, 0x00, 0x00, 0x01,
+    0x88, 0x00, 0x87, 0x00, 0x01, 0x55, 0x01, 0x87, 0x00, 0x86, 0x00, 0x02, 0x01, 0x29, 0x1E, 0x87, 0x00, 0x86, 0x00, 0x02, 0x05, 0x03, 0x21, 0x87,
+    0x00, 0x86, 0x00, 0x03, 0x52, 0x04, 0x2B, 0x01, 0x86, 0x00,
+};
+
+__attribute__((section(".flash_rom")))
+static GUI_CONST_STORAGE uint32_t anim_candle_i4_clut[] = {
+    0xFF050206, 0xFF040517, 0xFF040A1B, 0xFF0E224C, 0xFF152D5F, 0xFF050A26, 0xFF3F6298, 0xFF5780B6,
+    0xFF112B51, 0xFF1D2D50, 0xFF89BAD7, 0xFFABE5F8, 0xFF546C8C, 0xFF040624, 0xFF436389, 0xFFC1E4F1,
+    0xFFD9F5FC, 0xFF9CB4CB, 0xFF151F3D, 0xFF041134, 0xFF7096B9, 0xFFE0FBFB, 0xFFFBFFFC, 0xFFC5DBEB,
+    0xFF2B4064, 0xFF1B3254, 0xFF9FC0DF, 0xFFEBFBFC, 0xFFE2F4FB, 0xFF5D7394, 0xFF060F2A, 0xFF435A7B,
+    0xFF8BA6C4, 0xFF0A1B41, 0xFF728FA9, 0xFFBDD3E4, 0xFF061640, 0xFFD4ECF4, 0xFF122343, 0xFFB5CCE0,
+    0xFF7E93AB, 0xFF050B34, 0xFF243455, 0xFF112751, 0xFF344A6A, 0xFFACC4D9, 0xFF19335C, 0xFF04113E,
+    0xFFC4D5E6, 0xFF25426B, 0xFFECF6FC, 0xFFCEE4F1, 0xFF40557C, 0xFF061A4C, 0xFF7088A5, 0xFFE1E6ED,
+    0xFF092451, 0xFF657D9C, 0xFF95ABC2, 0xFF84A0BD, 0xFF103469, 0xFF071C42, 0xFF1B3464, 0xFF16346C,
+    0xFF20406A, 0xFFA4BCD4, 0xFF1E3E76, 0xFF2D4576, 0xFF244A79, 0xFF31507B, 0xFF2E5089, 0xFF375788,
+    0xFF132E62, 0xFF3C5C87, 0xFF122C52, 0xFF49678C, 0xFF4C6A98, 0xFF506F91, 0xFFDBEDFC, 0xFF52749C,
+    0xFF5C769B, 0xFF5B7B9B, 0xFF0D1832, 0xFFE8F5FC, 0xFF869EB2, 0xFF060A1B, 0xFFE9FBFD, 0xFFB5C7DA,
+    0xFFD1FAFD, 0xFFBDF8FC, 0xFFB9F8FC, 0xFFA9F5FD, 0xFFA6EDFC, 0xFFCAF5FD, 0xFF131E33, 0xFF1C2742,
+    0xFFAED3E6, 0xFF93E4FA, 0xFF88DCFB, 0xFF9AECFC, 0xFF212B42, 0xFFA3D5EA, 0xFF7BCCF9, 0xFF75C4F6,
+    0xFF83D4FB, 0xFF9EC1D9, 0xFF6EB4F2, 0xFF65B0F3, 0xFF7BA2C0, 0xFF5AA0EB, 0xFF5C9BE4, 0xFF5CACF6,
+    0xFF99DCF9, 0xFF7AA9CE, 0xFF4E8FE0, 0xFF4A88D3, 0xFF4183D2, 0xFF3F7BC5, 0xFF85C9F6, 0xFF6084AC,
+    0xFF1F253D, 0xFF608CC3, 0xFF3E77C6, 0xFF3E71BA, 0xFF396AB1, 0xFF285BA3, 0xFF3166B0, 0xFF5D7CAF,
+    0xFF3665A5, 0xFF315FA4, 0xFF295A9A, 0xFF204885, 0xFF69A2E0, 0xFF2C4984, 0xFF204379, 0xFF5F90CF,
+    0xFF141226, 0xFF1F3B69, 0xFF0A2B60, 0xFF234E89, 0xFF4B72B3, 0xFF0E0F1B, 0xFF30456A, 0xFF1C2E5D,
+    0xFF27395C, 0xFF283451, 0xFF1C254C, 0xFF1C3969, 0xFF1D2333, 0xFF1D1E2F, 0xFF191824, 0xFF160F13,
+    0xFF19161B, 0xFF120B0C, 0xFF130A0D,
+};
+
+static GUI_CONST_STORAGE IconImage_t anim_candle_i4_image = {
+    ICON_FMT_RLE8, 155, 20, 62, 0x000000,
+    anim_candle_i4_clut,
+    anim_candle_i4, sizeof(anim_candle_i4)
+};
+
+static GUI_CONST_STORAGE AnimPatch_t anim_candle_patches[] = {
+    { 1, 0, 0xFF, &anim_candle_i1_image },
+    { 1, 2, 0xFF, &anim_candle_i2_image },
+    { 6, 48, 0xFF, &anim_candle_i3_image },
+    { 1, 0, 0xFF, &anim_candle_i4_image },
+};
+
+static GUI_CONST_STORAGE AnimFrame_t anim_candle_frames[] = {
+    { 0, 1 },
+    { 1, 0 },
+    { 1, 2 },
+    { 3, 1 },
+};
+
+GUI_CONST_STORAGE AnimClip_t anim_candle = {
+    21, 62, 4, 100,
+    { 0, 0, 0xFF, &anim_candle_i0_image },
+    anim_candle_frames,
+    anim_candle_patches,
+    4
+};
+
+/*************************** End of file ****************************/
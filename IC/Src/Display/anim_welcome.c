@@ -0,0 +1,4823 @@
+/*********************************************************************
+* Generated by Tools/animconv, do not edit.
+* anim_welcome.c: 20 frames 300x114, 10 ms per frame
+*********************************************************************/
+
+#include <stdlib.h>
+#include "Resource.h"
+#include "anim_codec.h"
+
+/* 300x114, RLE32, 113936 bytes */
+__attribute__((section(".flash_rom"), aligned(4)))
+static GUI_CONST_STORAGE unsigned char anim_welcome_i0[] = {
+    0x94, 0x00, 0x00, 0x00, 0xFF, 0x02, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x98, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x01, 0x00, 0xFF, 0x88, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x9E, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x91, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x00, 0xFF, 0x85, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00,
+    0x00, 0xFF, 0x88, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x90, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x00, 0xFF, 0x85, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x8A, 0x00, 0x00, 0x00, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x01, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x91, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x83, 0x00, 0x00,
+    0x00, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x95, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01,
+    0x00, 0x00, 0xFF, 0x9C, 0x00, 0x00, 0x00, 0xFF, 0x02, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x84, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x87, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x8A, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01,
+    0x00, 0x00, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x98, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x84,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x83, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x90, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x01, 0xFF, 0x85, 0x00, 0x00, 0x00, 0xFF, 0x02, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x8D,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x85, 0x00, 0x00, 0x00, 0xFF, 0x02, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01,
+    0x00, 0x00, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x9B, 0x00, 0x00, 0x00, 0xFF, 0x02, 0x01, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x95, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01,
+    0x00, 0x01, 0xFF, 0x85, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x82, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x01, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x90, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF,
+    0x03, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x98, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x01,
+    0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00,
+    0xFF, 0x85, 0x00, 0x00, 0x00, 0xFF, 0x0B, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x81, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x01, 0x00, 0x00, 0xFF, 0x94, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00,
+    0xFF, 0x87, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x91, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01,
+    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x01, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x91, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01,
+    0x00, 0x00, 0xFF, 0x97, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x87,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF, 0x98, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x82, 0x01, 0x00, 0x00, 0xFF, 0x91, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x83, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF, 0x86, 0x00, 0x00, 0x00, 0xFF, 0x08, 0x01, 0x00,
+    0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x82, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01,
+    0xFF, 0x06, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00,
+    0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x81,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x97, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x9B, 0x00, 0x00, 0x00, 0xFF,
+    0x01, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF,
+    0x82, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x8D, 0x00, 0x00, 0x00, 0xFF, 0x02, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x81, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x02, 0x01, 0x00, 0x01, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x97, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x84, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x01, 0x00, 0x00, 0xFF, 0x91, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x83, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF,
+    0x84, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0xA1, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00,
+    0xFF, 0x8E, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x00, 0xFF, 0x89, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x84, 0x00, 0x00, 0x00, 0xFF, 0x83, 0x01, 0x00, 0x00, 0xFF, 0x08, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00,
+    0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x04, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF,
+    0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x81, 0x01, 0x00, 0x01, 0xFF, 0x81, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x83,
+    0x01, 0x00, 0x00, 0xFF, 0x84, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0xBC, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x01, 0x00, 0xFF, 0x87, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF,
+    0x9A, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x06, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0xFF, 0x01, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00,
+    0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x85, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF, 0xA7, 0x00, 0x00, 0x00, 0xFF, 0xB2, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01,
+    0x00, 0xFF, 0x88, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x84, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x01,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00,
+    0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xFF,
+    0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x0D, 0x01,
+    0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01,
+    0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01,
+    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF, 0xAB, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x9E, 0x00,
+    0x00, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x8D,
+    0x00, 0x00, 0x00, 0xFF, 0x03, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0xFF, 0x01, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x03, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x08, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01,
+    0x00, 0x01, 0xFF, 0x83, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x84, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80,
+    0x01, 0x00, 0x00, 0xFF, 0x97, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x88, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x9B, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0xFF, 0x82, 0x01, 0x00, 0x00, 0xFF, 0x94, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x82, 0x01, 0x00, 0x01,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x81, 0x01, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF,
+    0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF, 0x07, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00,
+    0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x01,
+    0x00, 0x01, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x02, 0x01, 0x00,
+    0x00, 0xFF, 0x02, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF,
+    0x80, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF, 0x04, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x01, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x02, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x01,
+    0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF, 0x02, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF,
+    0x81, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x9B, 0x00, 0x00, 0x00,
+    0xFF, 0x81, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x83, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00,
+    0x00, 0xFF, 0x8E, 0x00, 0x00, 0x00, 0xFF, 0x02, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x82, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x86, 0x00, 0x00, 0x00, 0xFF, 0x02, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x02, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x01, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF, 0x06, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF, 0x07, 0x01, 0x01, 0x01, 0xFF,
+    0x01, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF,
+    0x01, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x04, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x0B, 0x01, 0x00,
+    0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00,
+    0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01,
+    0x00, 0x01, 0xFF, 0x01, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF, 0x03, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x8B, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x00,
+    0xFF, 0x03, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x89, 0x00, 0x00, 0x00, 0xFF, 0x95,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0xFF, 0x0C, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01,
+    0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF,
+    0x0F, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01,
+    0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x81, 0x01, 0x00, 0x00, 0xFF, 0x03, 0x01,
+    0x01, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x02, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x83, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x00, 0x00,
+    0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x02, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF,
+    0x80, 0x01, 0x00, 0x01, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x9A, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x99, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x85, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x01, 0xFF, 0x86, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x83, 0x00, 0x00, 0x00, 0xFF, 0x10, 0x01, 0x00, 0x01, 0xFF,
+    0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF,
+    0x01, 0x00, 0x00, 0xFF, 0x02, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x83, 0x01, 0x01, 0x01, 0xFF, 0x02, 0x01, 0x00,
+    0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x02, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x01, 0x01, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x04, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF, 0x05, 0x00, 0x00,
+    0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x81, 0x01,
+    0x00, 0x00, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF,
+    0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x90, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x8C, 0x00,
+    0x00, 0x00, 0xFF, 0xAC, 0x00, 0x00, 0x00, 0xFF, 0x05, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x00, 0xFF, 0x04, 0x01, 0x00, 0x01, 0xFF,
+    0x01, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x00,
+    0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x08, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF,
+    0x81, 0x01, 0x00, 0x00, 0xFF, 0x0B, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00,
+    0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x01,
+    0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x05, 0x00, 0x00,
+    0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x00,
+    0x00, 0x01, 0xFF, 0x03, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0xA8, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x01, 0x00, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x00, 0xFF, 0x9B, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x01, 0x00,
+    0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF,
+    0x05, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x02, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF,
+    0x0B, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01,
+    0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x00,
+    0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x08, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF,
+    0x82, 0x00, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x01,
+    0xFF, 0x9A, 0x00, 0x00, 0x00, 0xFF, 0x9D, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x00,
+    0x00, 0xFF, 0x84, 0x00, 0x00, 0x00, 0xFF, 0x0B, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x10, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x00,
+    0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x01,
+    0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x81, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0x01, 0xFF, 0x83, 0x01, 0x01, 0x01,
+    0xFF, 0x0B, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00,
+    0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x02, 0x00,
+    0x01, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x81, 0x01, 0x01, 0x01, 0xFF, 0x07, 0x00,
+    0x01, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x00,
+    0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x01, 0x01, 0x00, 0xFF, 0x02, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01,
+    0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF, 0x04, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0x82, 0x01, 0x00, 0x01, 0xFF, 0x04, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x01, 0x00, 0x00, 0xFF, 0x92, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x87, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00,
+    0xFF, 0x99, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x02, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x00, 0x01,
+    0xFF, 0x01, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0x00,
+    0xFF, 0x84, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x84, 0x01, 0x01, 0x01, 0xFF, 0x06, 0x01, 0x01, 0x02, 0xFF, 0x01, 0x01, 0x01,
+    0xFF, 0x02, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x83, 0x01, 0x01,
+    0x01, 0xFF, 0x0B, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x01, 0x00, 0x01, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0x81, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x02, 0x01, 0x00, 0x01, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x8E, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF, 0x85, 0x00, 0x00, 0x00, 0xFF, 0x90, 0x00,
+    0x00, 0x00, 0xFF, 0x06, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00,
+    0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x8B, 0x00,
+    0x00, 0x00, 0xFF, 0x05, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x84, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF, 0x0C,
+    0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF,
+    0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF,
+    0x01, 0x01, 0x00, 0xFF, 0x82, 0x01, 0x01, 0x01, 0xFF, 0x07, 0x01, 0x01, 0x02, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01,
+    0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x05,
+    0x01, 0x00, 0x02, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF,
+    0x86, 0x01, 0x01, 0x01, 0xFF, 0x02, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x83, 0x01, 0x01, 0x01, 0xFF, 0x02,
+    0x01, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00,
+    0x01, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x82, 0x01, 0x00, 0x01, 0xFF, 0x03, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00,
+    0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF, 0x92, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00,
+    0xFF, 0x91, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x00, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x06, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF,
+    0x01, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x00,
+    0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x84, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01,
+    0x00, 0xFF, 0x02, 0x01, 0x02, 0xFF, 0x82, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x02, 0x01, 0x01, 0xFF, 0x89, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x06, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00,
+    0x00, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x82, 0x00, 0x00,
+    0x00, 0xFF, 0x04, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80,
+    0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x95, 0x00, 0x00, 0x00, 0xFF, 0x90, 0x00, 0x00, 0x00, 0xFF, 0x04,
+    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0xFF, 0x02, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF,
+    0x04, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x83, 0x00, 0x00,
+    0x00, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x81, 0x01, 0x00, 0x01, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80,
+    0x01, 0x00, 0x01, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01,
+    0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01,
+    0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x81, 0x01, 0x01, 0x01, 0xFF, 0x02, 0x01, 0x01, 0x02, 0xFF, 0x01,
+    0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x09, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00,
+    0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x01,
+    0xFF, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x06, 0x00, 0x01, 0x01,
+    0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x02,
+    0xFF, 0x81, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01,
+    0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x83, 0x01, 0x00, 0x01, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x02, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x01, 0x00, 0x00, 0xFF, 0x92, 0x00, 0x00, 0x00, 0xFF, 0x02, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x87,
+    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0x00, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x00, 0xFF, 0x90, 0x00, 0x00, 0x00, 0xFF,
+    0x01, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x86, 0x00, 0x00, 0x00, 0xFF, 0x0E, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00,
+    0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01,
+    0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x01, 0xFF, 0x09, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01,
+    0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x01,
+    0xFF, 0x84, 0x00, 0x00, 0x01, 0xFF, 0x02, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF,
+    0x06, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01,
+    0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x00, 0x01,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01,
+    0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00,
+    0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x81, 0x00, 0x00, 0x01, 0xFF, 0x92, 0x00,
+    0x00, 0x00, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x00, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0x00, 0xFF, 0x01,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x85, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF,
+    0x85, 0x00, 0x00, 0x00, 0xFF, 0x0A, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00,
+    0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x11, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF,
+    0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF,
+    0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x01,
+    0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x07, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01,
+    0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x81, 0x00,
+    0x00, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x04, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01,
+    0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x02, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x02, 0x01, 0xFF, 0x80,
+    0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x03, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00,
+    0x01, 0x00, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x81, 0x01, 0x01, 0x01, 0xFF, 0x81, 0x01, 0x00, 0x01, 0xFF, 0x0C, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00,
+    0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00,
+    0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x00,
+    0x00, 0x00, 0xFF, 0x06, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x98, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x01, 0x00, 0xFF, 0x8E, 0x00, 0x00, 0x00, 0xFF, 0x08, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x81, 0x00,
+    0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0x00, 0xFF, 0x05, 0x01, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01,
+    0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x12, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01,
+    0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF,
+    0x04, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x01,
+    0x01, 0xFF, 0x02, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x04, 0x01, 0x01, 0x01,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01,
+    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x88, 0x00, 0x00, 0x00, 0xFF, 0x02, 0x00, 0x01, 0x00, 0xFF, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x00, 0xFF, 0x09, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x01, 0x00, 0x00, 0xFF, 0x8E, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x00, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x82, 0x00, 0x00, 0x00,
+    0xFF, 0x81, 0x00, 0x01, 0x00, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF,
+    0x81, 0x01, 0x00, 0x01, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00,
+    0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x81, 0x00, 0x01, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x0D, 0x00, 0x01, 0x00, 0xFF, 0x01,
+    0x00, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00,
+    0x01, 0x00, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00,
+    0x01, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x06, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01,
+    0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x81, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0x01, 0xFF, 0x81,
+    0x01, 0x01, 0x01, 0xFF, 0x04, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00,
+    0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0x01,
+    0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x06, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01,
+    0x01, 0x02, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x03, 0x01, 0x00, 0x01,
+    0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x10,
+    0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF,
+    0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF,
+    0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0xFF, 0x01, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x90, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x01, 0x00, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x83, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00,
+    0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x09, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF,
+    0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF,
+    0x00, 0x01, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x07, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01,
+    0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x01,
+    0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x82, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x0D,
+    0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF,
+    0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x02, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x81, 0x01, 0x00, 0x01, 0xFF, 0x07, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00,
+    0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00,
+    0x01, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x02, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x00,
+    0xFF, 0x10, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x00,
+    0x00, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF, 0x87, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x00, 0xFF, 0x83, 0x00, 0x00, 0x00, 0xFF, 0x8B,
+    0x00, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01,
+    0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x04,
+    0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x82, 0x00, 0x00, 0x00,
+    0xFF, 0x04, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x83, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x02, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00,
+    0x00, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x81, 0x01, 0x00, 0x01, 0xFF, 0x06, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00,
+    0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
+    0x00, 0x00, 0xFF, 0x04, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF,
+    0x81, 0x00, 0x00, 0x00, 0xFF, 0x0E, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01,
+    0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01,
+    0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x81, 0x01, 0x01, 0x01, 0xFF, 0x02,
+    0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x01,
+    0x01, 0xFF, 0x80, 0x00, 0x01, 0x00, 0xFF, 0x07, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF,
+    0x01, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x83, 0x01, 0x01, 0x01, 0xFF, 0x0D, 0x00, 0x00,
+    0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01,
+    0x01, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00,
+    0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x01, 0x01, 0x00, 0xFF, 0x02, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF,
+    0x80, 0x01, 0x01, 0x00, 0xFF, 0x06, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01,
+    0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x02, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF,
+    0x01, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x06, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x83, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x00, 0xFF,
+    0x85, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x00, 0xFF, 0x85, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x00,
+    0xFF, 0x02, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x04, 0x00, 0x00, 0x01, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01,
+    0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x09, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF,
+    0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF,
+    0x00, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00,
+    0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x04, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x13,
+    0x01, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF,
+    0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x03,
+    0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x81, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x00,
+    0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x8D, 0x00, 0x00, 0x00, 0xFF, 0x8A, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0xFF, 0x04, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0xFF, 0x08, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x02, 0x01,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x0A, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x02, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x83, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x02, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x04, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01,
+    0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0x00, 0xFF, 0x80,
+    0x01, 0x01, 0x01, 0xFF, 0x03, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x01, 0x01,
+    0x01, 0xFF, 0x02, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0x01,
+    0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x0A, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00,
+    0x01, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01,
+    0x01, 0x01, 0xFF, 0x81, 0x00, 0x01, 0x01, 0xFF, 0x0F, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00,
+    0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x01, 0x01, 0x01,
+    0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00,
+    0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x04, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x00,
+    0x01, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x0E, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x01,
+    0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x85, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x93, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x16, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00,
+    0xFF, 0x01, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x02,
+    0xFF, 0x00, 0x01, 0x00, 0xFF, 0x81, 0x00, 0x00, 0x01, 0xFF, 0x09, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00,
+    0x00, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x03, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01,
+    0xFF, 0x80, 0x00, 0x01, 0x00, 0xFF, 0x03, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x01, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF,
+    0x01, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x85, 0x00, 0x00, 0x00, 0xFF,
+    0x01, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x09, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01,
+    0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01,
+    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x86, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x00, 0xFF, 0x83, 0x00, 0x00, 0x00, 0xFF, 0x82, 0x00,
+    0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x83, 0x00, 0x01, 0x00, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01,
+    0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x04, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x04, 0x01, 0x01, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0x00, 0xFF,
+    0x00, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x00, 0xFF, 0x05, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01,
+    0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x00, 0xFF, 0x06, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF,
+    0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x82, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x83, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01,
+    0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x0C, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x02, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF,
+    0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x01, 0x02, 0x01, 0xFF, 0x00, 0x02, 0x01, 0xFF,
+    0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x07, 0x01, 0x00,
+    0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01,
+    0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x82, 0x01, 0x01, 0x01, 0xFF, 0x06, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x02, 0x00, 0xFF,
+    0x01, 0x02, 0x01, 0xFF, 0x00, 0x02, 0x01, 0xFF, 0x01, 0x02, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x81, 0x01, 0x01, 0x01, 0xFF, 0x09, 0x00, 0x02,
+    0x01, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00,
+    0x02, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x06, 0x00, 0x01, 0x01, 0xFF,
+    0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF,
+    0x83, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x02, 0x00, 0xFF, 0x80, 0x01, 0x02, 0x01, 0xFF, 0x02, 0x00, 0x02, 0x01, 0xFF, 0x01, 0x02, 0x02, 0xFF,
+    0x01, 0x02, 0x01, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x03, 0x01, 0x02, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x02, 0x01, 0xFF, 0x00, 0x01,
+    0x00, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x03, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF,
+    0x80, 0x00, 0x00, 0x01, 0xFF, 0x08, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x85, 0x00, 0x01, 0x00, 0xFF, 0x03,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01,
+    0x00, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x82, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0xFF, 0x02, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x00, 0xFF, 0x09, 0x01, 0x01, 0x01,
+    0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x02, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x02, 0x00,
+    0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x02, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x82, 0x00, 0x01, 0x01, 0xFF, 0x08, 0x01, 0x01, 0x01, 0xFF, 0x00,
+    0x02, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01,
+    0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x82, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01,
+    0x01, 0xFF, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x81, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x02, 0x01, 0xFF, 0x00, 0x00,
+    0x01, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x0D, 0x01, 0x02, 0x00, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x02, 0x01, 0xFF, 0x00, 0x02, 0x02,
+    0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x01,
+    0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
+    0x00, 0x00, 0xFF, 0x06, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF,
+    0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x81, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x02, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x01,
+    0x01, 0x01, 0xFF, 0x07, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x02, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF,
+    0x00, 0x02, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x06, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00,
+    0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x82, 0x00,
+    0x00, 0x00, 0xFF, 0x02, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x8C, 0x00, 0x01, 0x00, 0xFF, 0x04, 0x00, 0x01,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x83, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x01, 0x00, 0x01, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x02, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x81, 0x01,
+    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x17, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x01,
+    0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x01,
+    0xFF, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x01,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01,
+    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x82,
+    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x01, 0x01, 0xFF, 0x04, 0x00, 0x01, 0x00, 0xFF,
+    0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x01, 0x01,
+    0x01, 0xFF, 0x04, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x81,
+    0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0x01, 0xFF, 0x81, 0x01, 0x01, 0x01, 0xFF,
+    0x06, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01,
+    0xFF, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x02, 0x01, 0xFF, 0x09, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x02, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01,
+    0x01, 0x02, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01,
+    0x00, 0x02, 0xFF, 0x84, 0x01, 0x01, 0x01, 0xFF, 0x08, 0x00, 0x01, 0x00, 0xFF, 0x02, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x02,
+    0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x01,
+    0x01, 0xFF, 0x04, 0x00, 0x02, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x02, 0x01, 0xFF, 0x82,
+    0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80,
+    0x01, 0x00, 0x00, 0xFF, 0x09, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x01, 0x00, 0xFF, 0x86, 0x00, 0x00, 0x00, 0xFF, 0x04, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x10, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01,
+    0x00, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00,
+    0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x07, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01,
+    0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00,
+    0xFF, 0x81, 0x00, 0x00, 0x01, 0xFF, 0x0A, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01,
+    0x00, 0x02, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01,
+    0x01, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x0E, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x02, 0x01, 0xFF, 0x00, 0x01, 0x01,
+    0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x02, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01,
+    0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x02, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x01,
+    0x01, 0xFF, 0x11, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01,
+    0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00,
+    0x01, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01,
+    0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x02, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x01,
+    0x01, 0xFF, 0x0D, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01,
+    0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00,
+    0x00, 0xFF, 0x02, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x02, 0x00,
+    0xFF, 0x80, 0x00, 0x01, 0x00, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x00, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x85, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x00,
+    0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x0C, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00,
+    0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00,
+    0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x8A, 0x00, 0x00, 0x00, 0xFF, 0x01,
+    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x81, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00,
+    0x01, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x8E, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x0D, 0x00, 0x01, 0x01, 0xFF, 0x01,
+    0x01, 0x01, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01,
+    0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01,
+    0x01, 0x01, 0xFF, 0x81, 0x00, 0x01, 0x01, 0xFF, 0x04, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x01,
+    0xFF, 0x00, 0x02, 0x01, 0xFF, 0x83, 0x00, 0x01, 0x01, 0xFF, 0x04, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00,
+    0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x81, 0x00, 0x01, 0x01, 0xFF, 0x81, 0x01, 0x01, 0x01, 0xFF, 0x02, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00,
+    0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0x00, 0xFF, 0x81, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x01,
+    0x00, 0xFF, 0x04, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80,
+    0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x00, 0xFF, 0x06,
+    0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x01, 0x00, 0x00, 0xFF, 0x82, 0x01, 0x01, 0x00, 0xFF, 0x04, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01,
+    0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x81, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x84, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01,
+    0x00, 0x01, 0xFF, 0x82, 0x01, 0x00, 0x00, 0xFF, 0x06, 0x01, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00,
+    0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x00, 0xFF, 0x09, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0x01, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0xFF, 0x04, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x81,
+    0x00, 0x00, 0x01, 0xFF, 0x06, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x04, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00,
+    0x01, 0x01, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x81, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01,
+    0x02, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x07, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x02, 0xFF,
+    0x00, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x00,
+    0x01, 0x00, 0xFF, 0x02, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x09, 0x01, 0x01,
+    0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0xFF, 0x02, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80,
+    0x01, 0x00, 0x00, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x80, 0x00, 0x01, 0x00, 0xFF, 0x02, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x84, 0x00, 0x00, 0x00, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01,
+    0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x02, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x00,
+    0xFF, 0x05, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01,
+    0x00, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0xFF, 0x09, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x84, 0x00,
+    0x00, 0x00, 0xFF, 0x04, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF,
+    0x83, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x84, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x82, 0x00, 0x01, 0x01, 0xFF, 0x02, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x02, 0xFF,
+    0x80, 0x00, 0x01, 0x01, 0xFF, 0x06, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x02, 0x01, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01,
+    0x01, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x81, 0x01, 0x01, 0x01, 0xFF, 0x0B, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF,
+    0x01, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x02, 0xFF,
+    0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01,
+    0x02, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x07, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF,
+    0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x01,
+    0xFF, 0x02, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF,
+    0x80, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x05, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF,
+    0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x08, 0x00, 0x00,
+    0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01,
+    0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x06, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF,
+    0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x01, 0x01,
+    0xFF, 0x80, 0x01, 0x01, 0x00, 0xFF, 0x05, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x01,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x81, 0x01, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x00, 0xFF, 0x04, 0x00,
+    0x00, 0x00, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x00, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x00,
+    0xFF, 0x80, 0x01, 0x01, 0x00, 0xFF, 0x07, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01,
+    0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x00, 0xFF, 0x80, 0x00, 0x01, 0x00,
+    0xFF, 0x05, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x01,
+    0x01, 0xFF, 0x80, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x04, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x01, 0x01, 0xFF, 0x07, 0x01, 0x01, 0x02, 0xFF,
+    0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF,
+    0x00, 0x01, 0x02, 0xFF, 0x82, 0x00, 0x01, 0x01, 0xFF, 0x05, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x02, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01,
+    0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF,
+    0x80, 0x01, 0x01, 0x01, 0xFF, 0x08, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x01, 0x01,
+    0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x80,
+    0x00, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x05, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x05, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF,
+    0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x03, 0x01, 0x01,
+    0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x81, 0x00, 0x00, 0x01, 0xFF, 0x02, 0x01, 0x00, 0x01, 0xFF,
+    0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x00, 0xFF, 0x07, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00,
+    0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x81, 0x00,
+    0x00, 0x00, 0xFF, 0x03, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x82, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x80, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0x00, 0xFF, 0x07, 0x01,
+    0x00, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00,
+    0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01,
+    0xFF, 0x01, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x80, 0x00, 0x01,
+    0x00, 0xFF, 0x02, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x84, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0x02,
+    0xFF, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x87, 0x00, 0x00, 0x01, 0xFF,
+    0x83, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x02, 0x00, 0xFF, 0x01, 0x02, 0x01, 0xFF, 0x80, 0x00, 0x02, 0x01, 0xFF, 0x03, 0x00, 0x01, 0x02, 0xFF,
+    0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x02, 0xFF, 0x01, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01,
+    0x02, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x08, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x01, 0x01, 0x01, 0xFF,
+    0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x81, 0x01, 0x01, 0x01,
+    0xFF, 0x0E, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x02, 0x01, 0xFF, 0x00, 0x02, 0x01, 0xFF, 0x01, 0x02, 0x01, 0xFF, 0x00, 0x02,
+    0x01, 0xFF, 0x01, 0x02, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x02, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01,
+    0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x81, 0x00, 0x01, 0x01, 0xFF, 0x04, 0x00, 0x01, 0x00, 0xFF,
+    0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x01,
+    0x01, 0xFF, 0x02, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x82, 0x01, 0x01, 0x01, 0xFF, 0x05, 0x00, 0x02, 0x01,
+    0xFF, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x02, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x01,
+    0x01, 0xFF, 0x06, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01,
+    0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x82, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x81, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x01,
+    0x01, 0x00, 0xFF, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x83, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x02, 0x00, 0xFF, 0x80, 0x01,
+    0x01, 0x00, 0xFF, 0x00, 0x01, 0x02, 0x00, 0xFF, 0x82, 0x01, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x02, 0x00, 0xFF, 0x81, 0x01, 0x01, 0x00, 0xFF, 0x00,
+    0x01, 0x01, 0x01, 0xFF, 0x80, 0x01, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x06, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00,
+    0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF,
+    0x09, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x02, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01,
+    0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x02, 0x01, 0xFF, 0x00, 0x02, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x81, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00,
+    0x01, 0x00, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x06, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x01,
+    0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFF, 0x01,
+    0x01, 0x02, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x04, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x01, 0x01, 0x01,
+    0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x87, 0x01, 0x02, 0x02, 0xFF, 0x01, 0x00, 0x02, 0x02, 0xFF, 0x01, 0x02, 0x02, 0xFF, 0x80,
+    0x01, 0x01, 0x02, 0xFF, 0x08, 0x00, 0x01, 0x02, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01,
+    0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x0A, 0x01,
+    0x00, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00,
+    0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF,
+    0x80, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x81, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF,
+    0x08, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00,
+    0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0x00, 0xFF, 0x0A, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01,
+    0x00, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x02, 0x00, 0xFF, 0x01, 0x01,
+    0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x00, 0xFF, 0x02, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0xFF, 0x81, 0x00, 0x01, 0x00, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x0A, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00,
+    0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x00,
+    0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x01, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x01, 0x00, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x0C, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01,
+    0x00, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00,
+    0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF,
+    0x81, 0x00, 0x00, 0x01, 0xFF, 0x05, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01,
+    0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x02, 0xFF, 0x02, 0x00, 0x00,
+    0x02, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0x03,
+    0xFF, 0x81, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x84, 0x00, 0x01, 0x02, 0xFF, 0x03, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x02,
+    0xFF, 0x00, 0x02, 0x01, 0xFF, 0x01, 0x02, 0x02, 0xFF, 0x80, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x02, 0x01, 0xFF,
+    0x00, 0x00, 0x02, 0x02, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x80, 0x01, 0x01, 0x02, 0xFF,
+    0x80, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0x02, 0xFF, 0x80, 0x00, 0x01, 0x02,
+    0xFF, 0x03, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x01,
+    0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x81, 0x00,
+    0x01, 0x01, 0xFF, 0x81, 0x01, 0x01, 0x01, 0xFF, 0x07, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x02, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01,
+    0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x05, 0x01,
+    0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80,
+    0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x01, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x86,
+    0x01, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x02, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x00, 0xFF,
+    0x01, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x81, 0x01, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x84, 0x01, 0x01, 0x00, 0xFF,
+    0x82, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x12, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF,
+    0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x02, 0x01, 0xFF,
+    0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF,
+    0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x01,
+    0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x09, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01,
+    0x01, 0x02, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x03, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x01, 0x01, 0x03, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x80,
+    0x01, 0x02, 0x03, 0xFF, 0x11, 0x01, 0x01, 0x03, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x01, 0x01, 0x03, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x00, 0x02, 0x04,
+    0xFF, 0x01, 0x02, 0x03, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x00, 0x02, 0x03, 0xFF, 0x01, 0x01, 0x03, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x00, 0x02, 0x03,
+    0xFF, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x01, 0x01, 0x03, 0xFF, 0x00, 0x01, 0x02,
+    0xFF, 0x01, 0x01, 0x03, 0xFF, 0x80, 0x00, 0x01, 0x02, 0xFF, 0x05, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00,
+    0x01, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x01,
+    0x01, 0xFF, 0x16, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01,
+    0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80,
+    0x00, 0x00, 0x01, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01,
+    0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x00,
+    0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x02, 0x00, 0xFF, 0x82, 0x01, 0x01, 0x00, 0xFF, 0x03, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x00, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x01, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x05, 0x01, 0x00, 0x01, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x01, 0x00, 0x01, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x83, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00,
+    0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x01, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x02, 0xFF, 0x01, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x83, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x01, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
+    0x03, 0xFF, 0x81, 0x00, 0x00, 0x02, 0xFF, 0x01, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x82, 0x00, 0x00,
+    0x03, 0xFF, 0x03, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x04, 0xFF,
+    0x0E, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x04,
+    0xFF, 0x00, 0x00, 0x03, 0xFF, 0x01, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x00, 0x03,
+    0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x81, 0x00, 0x01, 0x03, 0xFF, 0x02, 0x01, 0x01, 0x03, 0xFF, 0x00,
+    0x01, 0x03, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x03, 0xFF, 0x03, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x04,
+    0xFF, 0x01, 0x01, 0x03, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x01, 0x03, 0xFF, 0x82, 0x01, 0x01, 0x04, 0xFF, 0x02, 0x01, 0x01, 0x03,
+    0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x82, 0x01, 0x01, 0x03, 0xFF, 0x06, 0x00, 0x01, 0x02, 0xFF, 0x01, 0x01, 0x03, 0xFF, 0x00,
+    0x01, 0x02, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x81, 0x00, 0x01, 0x01, 0xFF,
+    0x03, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x05, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x80,
+    0x00, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x04,
+    0x01, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x01,
+    0xFF, 0x06, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01,
+    0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x81, 0x01, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x00, 0xFF, 0x09, 0x00, 0x01,
+    0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01,
+    0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x14, 0x01, 0x00, 0x01, 0xFF,
+    0x01, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF,
+    0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x84, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x80,
+    0x00, 0x01, 0x02, 0xFF, 0x80, 0x00, 0x01, 0x03, 0xFF, 0x80, 0x01, 0x01, 0x03, 0xFF, 0x05, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00,
+    0x01, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x02, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x01, 0x05,
+    0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x05, 0x01, 0x02, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00,
+    0x01, 0x05, 0xFF, 0x00, 0x02, 0x05, 0xFF, 0x80, 0x01, 0x01, 0x05, 0xFF, 0x04, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04,
+    0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x01, 0x01, 0x04, 0xFF, 0x07, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x03, 0xFF, 0x00,
+    0x01, 0x02, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x80,
+    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x0E, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00,
+    0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x02, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x01, 0x01, 0x00,
+    0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x81, 0x01, 0x01, 0x00, 0xFF, 0x03, 0x01, 0x00, 0x00, 0xFF, 0x01,
+    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x06, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x00,
+    0x01, 0xFF, 0x08, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00,
+    0x01, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0xFF, 0x01, 0x00, 0x01, 0xFF, 0x84, 0x00, 0x00, 0x00, 0xFF, 0x04, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0x00, 0x02, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0x02, 0xFF, 0x82, 0x00, 0x00, 0x02, 0xFF, 0x01, 0x00,
+    0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x81, 0x00, 0x00, 0x02, 0xFF, 0x01, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
+    0x02, 0xFF, 0x82, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0x04, 0xFF, 0x81, 0x00, 0x00, 0x03, 0xFF, 0x04, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x00,
+    0x04, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x81, 0x00, 0x01, 0x04, 0xFF, 0x05, 0x00, 0x01, 0x05, 0xFF,
+    0x00, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x05,
+    0xFF, 0x09, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01,
+    0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x82, 0x00, 0x01, 0x04, 0xFF, 0x00,
+    0x00, 0x01, 0x03, 0xFF, 0x81, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x82, 0x00, 0x01, 0x04, 0xFF, 0x01,
+    0x01, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x02, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01,
+    0x05, 0xFF, 0x81, 0x01, 0x01, 0x04, 0xFF, 0x04, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF,
+    0x00, 0x01, 0x04, 0xFF, 0x80, 0x01, 0x01, 0x03, 0xFF, 0x01, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x03, 0xFF, 0x80, 0x00, 0x01, 0x02, 0xFF, 0x01,
+    0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x83, 0x00, 0x01, 0x01, 0xFF, 0x04, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01,
+    0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0x01,
+    0xFF, 0x01, 0x00, 0x01, 0xFF, 0x82, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x81, 0x00, 0x01, 0x01, 0xFF,
+    0x00, 0x01, 0x01, 0x02, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x16, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00,
+    0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01,
+    0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x01,
+    0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x01,
+    0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x10, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01,
+    0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x80,
+    0x01, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x81, 0x00, 0x01, 0x02, 0xFF, 0x80, 0x00, 0x01, 0x03, 0xFF,
+    0x80, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x01, 0x03, 0xFF, 0x8A, 0x00, 0x01, 0x04, 0xFF, 0x02, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x05, 0xFF,
+    0x00, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x05, 0xFF, 0x05, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01,
+    0x04, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x04, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF,
+    0x00, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x00,
+    0x03, 0xFF, 0x80, 0x00, 0x01, 0x02, 0xFF, 0x01, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01,
+    0x01, 0xFF, 0x82, 0x00, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x00,
+    0x01, 0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01,
+    0x00, 0x01, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF,
+    0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF,
+    0x01, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01,
+    0x01, 0xFF, 0x81, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x01, 0x01, 0x00, 0xFF, 0x03, 0x01, 0x01,
+    0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0x00, 0xFF, 0x80, 0x00, 0x01, 0x00, 0xFF,
+    0x00, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x00, 0xFF, 0x03, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00,
+    0x01, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x10, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01,
+    0xFF, 0x01, 0x01, 0x00, 0xFF, 0x81, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF,
+    0x04, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00,
+    0x02, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x83, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x01, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00,
+    0x03, 0xFF, 0x84, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x02, 0x04, 0xFF, 0x80, 0x01, 0x02, 0x04, 0xFF, 0x01, 0x00, 0x02,
+    0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x02, 0x04, 0xFF, 0x05, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF,
+    0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x80, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x81, 0x00,
+    0x01, 0x04, 0xFF, 0x02, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x81, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x01, 0x01,
+    0x03, 0xFF, 0x0A, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x02, 0x03, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x00,
+    0x02, 0x04, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x00, 0x02, 0x04, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x80,
+    0x01, 0x02, 0x04, 0xFF, 0x81, 0x01, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x01, 0x04, 0xFF, 0x81, 0x00, 0x01, 0x04, 0xFF,
+    0x00, 0x00, 0x00, 0x04, 0xFF, 0x81, 0x00, 0x01, 0x04, 0xFF, 0x13, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00,
+    0x01, 0x03, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x01, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x02, 0x03, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x00,
+    0x02, 0x03, 0xFF, 0x01, 0x02, 0x02, 0xFF, 0x00, 0x02, 0x02, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x02, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00,
+    0x01, 0x00, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF,
+    0x0F, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01,
+    0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x82, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00,
+    0x02, 0x01, 0xFF, 0x01, 0x02, 0x01, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x03, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x02, 0x01, 0xFF, 0x01, 0x01, 0x01,
+    0xFF, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x07, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00,
+    0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF,
+    0x80, 0x00, 0x01, 0x01, 0xFF, 0x04, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01,
+    0x01, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x02, 0x00, 0xFF, 0x00, 0x01,
+    0x00, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x03, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x02, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF,
+    0x81, 0x01, 0x01, 0x01, 0xFF, 0x03, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x80, 0x00,
+    0x01, 0x03, 0xFF, 0x81, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x01, 0x04, 0xFF, 0x85, 0x00, 0x01, 0x04, 0xFF, 0x82, 0x00, 0x02, 0x04, 0xFF, 0x0A,
+    0x00, 0x01, 0x03, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x00, 0x02, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x02, 0x04, 0xFF, 0x01, 0x02, 0x04, 0xFF,
+    0x01, 0x02, 0x05, 0xFF, 0x00, 0x02, 0x04, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x81, 0x01, 0x01, 0x05,
+    0xFF, 0x0F, 0x01, 0x01, 0x04, 0xFF, 0x02, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01,
+    0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01,
+    0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x03, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x02,
+    0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x01, 0x02, 0x01, 0xFF, 0x81, 0x00, 0x01, 0x01, 0xFF, 0x03, 0x00, 0x02, 0x01, 0xFF, 0x00, 0x01,
+    0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0xFF, 0x82, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x82, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x01,
+    0x01, 0xFF, 0x11, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01,
+    0x01, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x02, 0x01, 0xFF, 0x01, 0x02, 0x00, 0xFF, 0x00,
+    0x02, 0x01, 0xFF, 0x01, 0x02, 0x01, 0xFF, 0x00, 0x02, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01,
+    0x00, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x00, 0xFF, 0x02, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0xFF, 0x03, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF,
+    0x04, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x09, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01,
+    0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01,
+    0xFF, 0x01, 0x00, 0x02, 0xFF, 0x82, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF,
+    0x03, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
+    0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x01, 0x05, 0xFF, 0x83, 0x00, 0x01, 0x04, 0xFF, 0x00,
+    0x00, 0x01, 0x03, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x01, 0x03, 0xFF, 0x8B, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x01, 0x05, 0xFF,
+    0x80, 0x00, 0x01, 0x04, 0xFF, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x02,
+    0x00, 0x01, 0x03, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x81, 0x01, 0x01, 0x03, 0xFF, 0x02, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x02,
+    0x04, 0xFF, 0x01, 0x01, 0x03, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x04, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF,
+    0x01, 0x02, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x81, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x01, 0x04, 0xFF, 0x82, 0x01, 0x01, 0x04, 0xFF, 0x80,
+    0x00, 0x01, 0x04, 0xFF, 0x81, 0x01, 0x01, 0x04, 0xFF, 0x07, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01,
+    0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x81, 0x00, 0x01, 0x04, 0xFF, 0x01,
+    0x00, 0x01, 0x03, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x81, 0x00, 0x01, 0x03, 0xFF, 0x04, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00,
+    0x02, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01,
+    0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x03, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01,
+    0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF,
+    0x80, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0x02, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x02, 0x00, 0x01, 0x02,
+    0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x05, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x01,
+    0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x04, 0x00, 0x00, 0x01,
+    0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x81, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
+    0x01, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x04, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x00,
+    0xFF, 0x00, 0x01, 0x00, 0xFF, 0x82, 0x00, 0x01, 0x01, 0xFF, 0x04, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x01,
+    0x01, 0x03, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x80, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x01, 0x03, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x80, 0x00, 0x01,
+    0x04, 0xFF, 0x80, 0x00, 0x00, 0x04, 0xFF, 0x02, 0x00, 0x00, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x03,
+    0xFF, 0x84, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x01, 0x03, 0xFF, 0x83, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x01, 0x05, 0xFF, 0x82, 0x00, 0x01,
+    0x04, 0xFF, 0x01, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x05,
+    0xFF, 0x82, 0x01, 0x01, 0x05, 0xFF, 0x04, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x01,
+    0x01, 0x03, 0xFF, 0x84, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x81, 0x00, 0x01, 0x01, 0xFF, 0x03, 0x00,
+    0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x06, 0x00, 0x00, 0x02,
+    0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02,
+    0xFF, 0x84, 0x00, 0x00, 0x01, 0xFF, 0x03, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x81,
+    0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x06, 0x01, 0x00, 0x01, 0xFF, 0x00,
+    0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80,
+    0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x80, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x00, 0x01, 0xFF, 0x01,
+    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x01,
+    0x00, 0x01, 0xFF, 0x06, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x83, 0x00, 0x00, 0x00, 0xFF, 0x04, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00,
+    0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x82, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x01, 0x00, 0x00, 0x01,
+    0xFF, 0x01, 0x00, 0x03, 0xFF, 0x83, 0x00, 0x00, 0x02, 0xFF, 0x03, 0x01, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x01, 0x00, 0x03, 0xFF, 0x01,
+    0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x81, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x01, 0x05, 0xFF, 0x80, 0x00, 0x00, 0x04, 0xFF, 0x01,
+    0x00, 0x01, 0x05, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x85, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x81, 0x00,
+    0x01, 0x05, 0xFF, 0x00, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x05, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x05, 0xFF, 0x07,
+    0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x06, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x06, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF,
+    0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x81, 0x00, 0x01, 0x05, 0xFF, 0x81, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x00, 0x01, 0x05, 0xFF, 0x01,
+    0x01, 0x05, 0xFF, 0x84, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x02, 0x05, 0xFF, 0x81, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01,
+    0x01, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x84, 0x01, 0x01, 0x05, 0xFF, 0x04, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x01, 0x01, 0x05,
+    0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x80, 0x01, 0x01, 0x04, 0xFF, 0x09, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01,
+    0x01, 0x05, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01,
+    0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x01, 0x01, 0x04, 0xFF, 0x02, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x01, 0x04,
+    0xFF, 0x80, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x00, 0x01, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x0C, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01,
+    0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x81, 0x00, 0x00,
+    0x01, 0xFF, 0x06, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00,
+    0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0x02, 0xFF, 0x82, 0x00, 0x00, 0x02, 0xFF, 0x03, 0x01,
+    0x01, 0x02, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x81, 0x00, 0x00, 0x02, 0xFF, 0x03, 0x01, 0x01, 0x01,
+    0xFF, 0x01, 0x00, 0x02, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x81, 0x00, 0x00, 0x02, 0xFF, 0x01, 0x00, 0x01, 0x01, 0xFF, 0x01,
+    0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x83, 0x00, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x01, 0x01, 0xFF, 0x07, 0x01, 0x00, 0x01, 0xFF, 0x00,
+    0x00, 0x01, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x01, 0x01, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00,
+    0x01, 0x04, 0xFF, 0x81, 0x01, 0x01, 0x04, 0xFF, 0x07, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05,
+    0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x80, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x00,
+    0x01, 0x04, 0xFF, 0x00, 0x02, 0x05, 0xFF, 0x80, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x02, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x80, 0x01, 0x01,
+    0x05, 0xFF, 0x02, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x81, 0x01, 0x02, 0x06, 0xFF, 0x00, 0x01, 0x01, 0x05,
+    0xFF, 0x80, 0x01, 0x02, 0x05, 0xFF, 0x00, 0x01, 0x01, 0x06, 0xFF, 0x80, 0x01, 0x02, 0x06, 0xFF, 0x00, 0x01, 0x01, 0x05, 0xFF, 0x81, 0x01, 0x01,
+    0x06, 0xFF, 0x00, 0x02, 0x01, 0x06, 0xFF, 0x81, 0x01, 0x01, 0x05, 0xFF, 0x04, 0x02, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x03,
+    0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x81, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x01, 0x02, 0x03, 0xFF, 0x80, 0x00, 0x01, 0x03, 0xFF,
+    0x02, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x81, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x82,
+    0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0x02, 0xFF, 0x83, 0x00, 0x00, 0x01, 0xFF, 0x06, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01,
+    0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x81, 0x00, 0x00, 0x01, 0xFF,
+    0x00, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x02, 0xFF,
+    0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x04, 0x01, 0x00, 0x03, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x01,
+    0x01, 0x01, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x03, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x80, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x02, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x02, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x84, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
+    0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x09, 0x01, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x01,
+    0x05, 0xFF, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x01, 0x01,
+    0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x83, 0x00, 0x01, 0x05, 0xFF, 0x02, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF,
+    0x81, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x06, 0xFF, 0x80, 0x01, 0x01, 0x05, 0xFF, 0x80, 0x00, 0x01, 0x05, 0xFF,
+    0x80, 0x01, 0x01, 0x05, 0xFF, 0x02, 0x00, 0x01, 0x06, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x83, 0x01, 0x01, 0x05, 0xFF, 0x05,
+    0x02, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x02, 0x05, 0xFF,
+    0x85, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x06, 0xFF, 0x80, 0x00, 0x01, 0x05, 0xFF, 0x02, 0x01, 0x01, 0x05, 0xFF,
+    0x01, 0x01, 0x06, 0xFF, 0x00, 0x01, 0x06, 0xFF, 0x80, 0x01, 0x01, 0x05, 0xFF, 0x03, 0x01, 0x01, 0x06, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x01,
+    0x06, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x81, 0x01, 0x01, 0x06, 0xFF, 0x80, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x01, 0x06, 0xFF, 0x81, 0x01, 0x01,
+    0x05, 0xFF, 0x05, 0x00, 0x02, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01,
+    0x01, 0x05, 0xFF, 0x80, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x81, 0x00, 0x01, 0x04, 0xFF, 0x03, 0x01,
+    0x01, 0x05, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x0C, 0x00, 0x01, 0x02,
+    0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01,
+    0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01,
+    0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x00,
+    0xFF, 0x01, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x82, 0x00, 0x00, 0x01, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF,
+    0x00, 0x00, 0x02, 0xFF, 0x84, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF,
+    0x0B, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00,
+    0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01,
+    0xFF, 0x81, 0x00, 0x01, 0x02, 0xFF, 0x01, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x01, 0x01, 0x04, 0xFF, 0x81, 0x00, 0x01, 0x04,
+    0xFF, 0x80, 0x00, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x05, 0xFF, 0x0C, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF,
+    0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x06, 0xFF, 0x01, 0x01, 0x06, 0xFF,
+    0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x00, 0x01, 0x06, 0xFF, 0x82, 0x01, 0x01, 0x06, 0xFF, 0x00, 0x01, 0x02,
+    0x06, 0xFF, 0x84, 0x01, 0x01, 0x06, 0xFF, 0x09, 0x00, 0x01, 0x06, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x00, 0x01, 0x06, 0xFF, 0x01, 0x01, 0x07, 0xFF,
+    0x01, 0x02, 0x06, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x01, 0x01, 0x07, 0xFF, 0x02, 0x01, 0x07, 0xFF, 0x01, 0x01, 0x07, 0xFF, 0x01, 0x02, 0x07, 0xFF,
+    0x80, 0x01, 0x01, 0x06, 0xFF, 0x80, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF,
+    0x00, 0x00, 0x02, 0x03, 0xFF, 0x80, 0x00, 0x01, 0x03, 0xFF, 0x81, 0x00, 0x01, 0x04, 0xFF, 0x05, 0x00, 0x00, 0x03, 0xFF, 0x01, 0x01, 0x03, 0xFF,
+    0x00, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01,
+    0x02, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0x02, 0xFF, 0x82, 0x00, 0x00, 0x02, 0xFF, 0x82, 0x00, 0x00, 0x01, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x81, 0x00, 0x00, 0x01, 0xFF, 0x03, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x02,
+    0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x81, 0x00, 0x00, 0x02, 0xFF, 0x09, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00,
+    0x00, 0x02, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x01,
+    0x01, 0x01, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x02, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x00,
+    0xFF, 0x01, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF,
+    0x80, 0x01, 0x00, 0x01, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x06,
+    0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x01, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x02, 0x01, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01,
+    0x01, 0xFF, 0x81, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x84, 0x00, 0x00, 0x02, 0xFF, 0x82, 0x00, 0x00, 0x04, 0xFF, 0x02, 0x01,
+    0x00, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x00, 0x05, 0xFF, 0x80, 0x00, 0x00, 0x04, 0xFF, 0x01, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04,
+    0xFF, 0x82, 0x00, 0x01, 0x05, 0xFF, 0x05, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00,
+    0x01, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x80, 0x00, 0x02, 0x05, 0xFF, 0x80, 0x00, 0x01, 0x05, 0xFF, 0x05, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01,
+    0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x80, 0x01, 0x01, 0x05, 0xFF, 0x80,
+    0x00, 0x01, 0x05, 0xFF, 0x81, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x00, 0x05, 0xFF, 0x80, 0x00, 0x01, 0x05, 0xFF, 0x80, 0x01, 0x01, 0x05, 0xFF,
+    0x00, 0x00, 0x01, 0x05, 0xFF, 0x82, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x02, 0x05, 0xFF, 0x04, 0x00, 0x01, 0x05,
+    0xFF, 0x00, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x80, 0x00, 0x02, 0x05, 0xFF, 0x01, 0x01,
+    0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x80, 0x00, 0x01, 0x05, 0xFF, 0x03, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x06, 0xFF, 0x00, 0x01, 0x05,
+    0xFF, 0x01, 0x01, 0x05, 0xFF, 0x81, 0x00, 0x01, 0x05, 0xFF, 0x02, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x80,
+    0x01, 0x01, 0x05, 0xFF, 0x83, 0x00, 0x01, 0x05, 0xFF, 0x0B, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x02, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x02,
+    0x04, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x00, 0x01,
+    0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x01, 0x01, 0x04, 0xFF, 0x0C, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF,
+    0x00, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x03, 0xFF,
+    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x01,
+    0xFF, 0x03, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0x01, 0x01, 0x01, 0xFF, 0x81, 0x00, 0x01, 0x01, 0xFF, 0x06, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00,
+    0x01, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x8C, 0x00, 0x00, 0x01, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xFF,
+    0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x02, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01,
+    0x01, 0xFF, 0x00, 0x02, 0x01, 0xFF, 0x82, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0x02, 0xFF, 0x81, 0x00, 0x01, 0x03, 0xFF, 0x03, 0x00, 0x01,
+    0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x81, 0x00, 0x01, 0x03, 0xFF, 0x08, 0x00, 0x01, 0x04, 0xFF,
+    0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x01, 0x00, 0x05, 0xFF, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF,
+    0x00, 0x01, 0x06, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x80, 0x01, 0x02, 0x06, 0xFF, 0x00, 0x02, 0x02, 0x05, 0xFF, 0x81, 0x01, 0x02, 0x06, 0xFF, 0x00,
+    0x00, 0x02, 0x06, 0xFF, 0x81, 0x01, 0x02, 0x06, 0xFF, 0x06, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x00, 0x02,
+    0x06, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x00, 0x02, 0x06, 0xFF, 0x81, 0x01, 0x02, 0x06, 0xFF, 0x04, 0x00, 0x02, 0x06, 0xFF,
+    0x01, 0x02, 0x06, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x80, 0x01, 0x01, 0x07, 0xFF, 0x80, 0x01, 0x02,
+    0x07, 0xFF, 0x03, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x83, 0x00, 0x01, 0x05, 0xFF,
+    0x80, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x01, 0x05, 0xFF, 0x81, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x03, 0xFF,
+    0x80, 0x00, 0x01, 0x04, 0xFF, 0x81, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0x02, 0xFF, 0x83, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0x02,
+    0xFF, 0x81, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x03, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x04, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00,
+    0x01, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x03, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x02,
+    0xFF, 0x01, 0x00, 0x02, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x02, 0xFF, 0x06, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x01,
+    0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x02, 0x01, 0x00, 0x01, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0x01, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x01, 0xFF, 0x04, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x01,
+    0xFF, 0x03, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80,
+    0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x05, 0xFF, 0x00,
+    0x01, 0x05, 0xFF, 0x80, 0x01, 0x00, 0x05, 0xFF, 0x04, 0x01, 0x00, 0x04, 0xFF, 0x01, 0x00, 0x05, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x00, 0x04,
+    0xFF, 0x00, 0x01, 0x03, 0xFF, 0x84, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x05, 0xFF,
+    0x02, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x02, 0x04, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x84, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x01, 0x05, 0xFF, 0x80,
+    0x00, 0x01, 0x04, 0xFF, 0x03, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x82, 0x00, 0x01,
+    0x04, 0xFF, 0x80, 0x00, 0x01, 0x05, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x01, 0x05, 0xFF, 0x81, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01,
+    0x01, 0x04, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x83, 0x00, 0x01, 0x04, 0xFF, 0x04, 0x00, 0x02, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x02, 0x04,
+    0xFF, 0x00, 0x02, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x81, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF,
+    0x01, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x01, 0x01, 0x05, 0xFF, 0x05, 0x00, 0x01, 0x04, 0xFF,
+    0x01, 0x02, 0x05, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x00, 0x02, 0x04, 0xFF, 0x81, 0x01, 0x01, 0x04,
+    0xFF, 0x00, 0x01, 0x02, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x02, 0x01, 0x02, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF,
+    0x81, 0x01, 0x01, 0x04, 0xFF, 0x04, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01,
+    0x03, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x83, 0x00, 0x00, 0x04, 0xFF, 0x07, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x01, 0x00, 0x03,
+    0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01,
+    0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x05, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01,
+    0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x85, 0x00, 0x00, 0x01, 0xFF, 0x86,
+    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x02, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x01, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x02, 0xFF, 0x03, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x03,
+    0xFF, 0x80, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x82, 0x00, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x01,
+    0x04, 0xFF, 0x04, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x80,
+    0x00, 0x01, 0x05, 0xFF, 0x05, 0x01, 0x01, 0x06, 0xFF, 0x00, 0x02, 0x06, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x01, 0x02, 0x06,
+    0xFF, 0x01, 0x01, 0x05, 0xFF, 0x80, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x80, 0x01, 0x02, 0x06, 0xFF,
+    0x01, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x81, 0x01, 0x03, 0x06, 0xFF, 0x88, 0x01, 0x02, 0x06, 0xFF, 0x80, 0x01, 0x02, 0x07, 0xFF,
+    0x00, 0x01, 0x01, 0x06, 0xFF, 0x80, 0x01, 0x02, 0x06, 0xFF, 0x80, 0x01, 0x02, 0x05, 0xFF, 0x05, 0x01, 0x02, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF,
+    0x01, 0x02, 0x06, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x82, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x00, 0x01,
+    0x03, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x02, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x04, 0xFF,
+    0x80, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x01, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF,
+    0x80, 0x00, 0x00, 0x02, 0xFF, 0x85, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x01, 0x00, 0xFF, 0x81, 0x00, 0x01, 0x01, 0xFF, 0x83, 0x00, 0x00, 0x01, 0xFF, 0x05, 0x00, 0x00, 0x02, 0xFF, 0x01, 0x00, 0x02, 0xFF,
+    0x00, 0x00, 0x02, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x81, 0x01, 0x00, 0x02, 0xFF, 0x80, 0x01, 0x00,
+    0x01, 0xFF, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x00,
+    0x01, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x04, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01,
+    0xFF, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF,
+    0x05, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x01, 0x00, 0x02,
+    0xFF, 0x82, 0x00, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0x02, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x08, 0x01, 0x01,
+    0x04, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x00, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x01,
+    0x05, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x01, 0x04, 0xFF, 0x82, 0x00, 0x01, 0x04,
+    0xFF, 0x00, 0x01, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x00, 0x02, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x80, 0x01, 0x02, 0x05,
+    0xFF, 0x00, 0x01, 0x02, 0x04, 0xFF, 0x80, 0x01, 0x02, 0x05, 0xFF, 0x00, 0x01, 0x02, 0x04, 0xFF, 0x80, 0x01, 0x02, 0x05, 0xFF, 0x80, 0x01, 0x01,
+    0x05, 0xFF, 0x09, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x01,
+    0x02, 0x04, 0xFF, 0x02, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x81, 0x01, 0x02, 0x04, 0xFF,
+    0x00, 0x01, 0x02, 0x05, 0xFF, 0x80, 0x01, 0x02, 0x04, 0xFF, 0x01, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x83, 0x01, 0x02, 0x04, 0xFF,
+    0x00, 0x00, 0x02, 0x04, 0xFF, 0x84, 0x01, 0x02, 0x04, 0xFF, 0x02, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x81,
+    0x01, 0x01, 0x05, 0xFF, 0x80, 0x02, 0x02, 0x05, 0xFF, 0x80, 0x01, 0x02, 0x05, 0xFF, 0x80, 0x02, 0x02, 0x05, 0xFF, 0x80, 0x01, 0x02, 0x05, 0xFF,
+    0x80, 0x02, 0x02, 0x05, 0xFF, 0x84, 0x01, 0x02, 0x05, 0xFF, 0x08, 0x00, 0x02, 0x04, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x01,
+    0x02, 0x05, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x80,
+    0x01, 0x02, 0x05, 0xFF, 0x80, 0x01, 0x01, 0x04, 0xFF, 0x04, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
+    0x04, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x81, 0x00, 0x00, 0x04, 0xFF, 0x81, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x01, 0x03, 0xFF, 0x80, 0x00, 0x01,
+    0x02, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x82, 0x00, 0x00, 0x01, 0xFF, 0x02, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00,
+    0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x82, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0x01, 0xFF, 0x82, 0x00, 0x00,
+    0x01, 0xFF, 0x81, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x81, 0x01, 0x00, 0x01, 0xFF, 0x03, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01,
+    0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x02,
+    0xFF, 0x02, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x02, 0x03, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x03, 0xFF, 0x81, 0x00, 0x01, 0x04, 0xFF,
+    0x08, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05,
+    0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x80, 0x01, 0x01, 0x05, 0xFF, 0x03, 0x02, 0x01, 0x05, 0xFF, 0x01,
+    0x01, 0x05, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x80, 0x01, 0x02, 0x05, 0xFF, 0x83, 0x01, 0x02, 0x06, 0xFF, 0x85, 0x01, 0x03,
+    0x07, 0xFF, 0x02, 0x01, 0x03, 0x08, 0xFF, 0x02, 0x03, 0x07, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x80, 0x01, 0x03, 0x08, 0xFF, 0x06, 0x01, 0x03, 0x07,
+    0xFF, 0x02, 0x03, 0x08, 0xFF, 0x02, 0x02, 0x08, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x02, 0x02, 0x07, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x02, 0x03, 0x07,
+    0xFF, 0x80, 0x02, 0x02, 0x07, 0xFF, 0x03, 0x01, 0x02, 0x06, 0xFF, 0x02, 0x02, 0x06, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x80,
+    0x01, 0x02, 0x05, 0xFF, 0x00, 0x00, 0x01, 0x05, 0xFF, 0x81, 0x01, 0x02, 0x05, 0xFF, 0x80, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x00, 0x01, 0x05, 0xFF,
+    0x01, 0x01, 0x05, 0xFF, 0x80, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x01, 0x01, 0x04, 0xFF, 0x80, 0x01, 0x01, 0x05, 0xFF,
+    0x03, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x81, 0x00,
+    0x00, 0x01, 0xFF, 0x02, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01,
+    0x01, 0xFF, 0x82, 0x00, 0x00, 0x01, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x83, 0x00, 0x00, 0x00,
+    0xFF, 0x09, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x01,
+    0x01, 0xFF, 0x01, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x02, 0xFF, 0x80,
+    0x01, 0x01, 0x02, 0xFF, 0x01, 0x01, 0x00, 0x02, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x0C, 0x01, 0x00, 0x01, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x05, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00,
+    0x01, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x02, 0x00, 0x00, 0x03,
+    0xFF, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x05, 0xFF,
+    0x00, 0x00, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x06, 0x00, 0x00, 0x05, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x00, 0x05, 0xFF, 0x00,
+    0x00, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x80, 0x01, 0x01, 0x05, 0xFF, 0x80, 0x01, 0x01, 0x04,
+    0xFF, 0x04, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x83, 0x01,
+    0x02, 0x05, 0xFF, 0x02, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x80, 0x01, 0x02, 0x05, 0xFF, 0x80, 0x01, 0x01,
+    0x06, 0xFF, 0x03, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x81, 0x01, 0x02, 0x05, 0xFF,
+    0x00, 0x01, 0x02, 0x06, 0xFF, 0x80, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x01, 0x03, 0x05, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x80, 0x01, 0x02, 0x05, 0xFF,
+    0x80, 0x01, 0x01, 0x05, 0xFF, 0x03, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x80, 0x01,
+    0x02, 0x05, 0xFF, 0x09, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x01, 0x02, 0x05, 0xFF,
+    0x00, 0x02, 0x06, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x81, 0x01, 0x02, 0x06,
+    0xFF, 0x00, 0x01, 0x02, 0x07, 0xFF, 0x83, 0x01, 0x02, 0x06, 0xFF, 0x80, 0x01, 0x01, 0x06, 0xFF, 0x80, 0x01, 0x02, 0x06, 0xFF, 0x03, 0x01, 0x02,
+    0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x00, 0x02, 0x06, 0xFF, 0x81, 0x01, 0x02, 0x06, 0xFF, 0x0A, 0x01, 0x02, 0x05, 0xFF,
+    0x01, 0x02, 0x06, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x02, 0x06, 0xFF,
+    0x00, 0x02, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x80, 0x01, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x01,
+    0x04, 0xFF, 0x04, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x00, 0x04, 0xFF, 0x80,
+    0x00, 0x00, 0x04, 0xFF, 0x82, 0x00, 0x00, 0x03, 0xFF, 0x09, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x00,
+    0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01,
+    0x02, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x02, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x86, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x80, 0x00, 0x01, 0x01,
+    0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x02, 0xFF, 0x03, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFF,
+    0x00, 0x01, 0x03, 0xFF, 0x81, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x00,
+    0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x01, 0x01, 0x04, 0xFF, 0x81, 0x01, 0x01, 0x05, 0xFF, 0x80, 0x00, 0x01, 0x05, 0xFF,
+    0x81, 0x01, 0x01, 0x06, 0xFF, 0x01, 0x00, 0x01, 0x06, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x81, 0x01, 0x02, 0x06, 0xFF, 0x80, 0x01, 0x02, 0x07, 0xFF,
+    0x00, 0x01, 0x02, 0x08, 0xFF, 0x80, 0x01, 0x03, 0x08, 0xFF, 0x01, 0x01, 0x02, 0x08, 0xFF, 0x01, 0x04, 0x09, 0xFF, 0x81, 0x01, 0x03, 0x09, 0xFF,
+    0x02, 0x01, 0x03, 0x0A, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x01, 0x04, 0x0A, 0xFF, 0x80, 0x02, 0x03, 0x0A, 0xFF, 0x81, 0x01, 0x03, 0x09, 0xFF, 0x05,
+    0x01, 0x02, 0x09, 0xFF, 0x01, 0x03, 0x08, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x02, 0x02, 0x09, 0xFF, 0x01, 0x02, 0x08, 0xFF,
+    0x80, 0x02, 0x02, 0x08, 0xFF, 0x03, 0x02, 0x03, 0x08, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x02, 0x02, 0x07, 0xFF, 0x02, 0x02, 0x06, 0xFF, 0x80, 0x01,
+    0x02, 0x06, 0xFF, 0x84, 0x01, 0x02, 0x05, 0xFF, 0x05, 0x01, 0x01, 0x06, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x04,
+    0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x01, 0x05, 0xFF, 0x81, 0x00, 0x01, 0x05, 0xFF,
+    0x05, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02,
+    0xFF, 0x83, 0x00, 0x00, 0x01, 0xFF, 0x03, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x82,
+    0x00, 0x00, 0x01, 0xFF, 0x83, 0x00, 0x00, 0x00, 0xFF, 0x81, 0x00, 0x00, 0x01, 0xFF, 0x03, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x01,
+    0x01, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x82, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x00, 0x03, 0xFF, 0x80, 0x01, 0x00, 0x02, 0xFF, 0x01, 0x00,
+    0x00, 0x01, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0xFF, 0x01, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x05, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01,
+    0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
+    0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x01, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x01, 0x00, 0x05, 0xFF, 0x01, 0x00,
+    0x00, 0x04, 0xFF, 0x00, 0x00, 0x05, 0xFF, 0x80, 0x00, 0x00, 0x04, 0xFF, 0x05, 0x01, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x05,
+    0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x80, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x01, 0x05, 0xFF, 0x00,
+    0x01, 0x05, 0xFF, 0x80, 0x00, 0x01, 0x06, 0xFF, 0x00, 0x00, 0x01, 0x05, 0xFF, 0x80, 0x00, 0x01, 0x06, 0xFF, 0x01, 0x00, 0x01, 0x05, 0xFF, 0x00,
+    0x01, 0x06, 0xFF, 0x81, 0x01, 0x02, 0x05, 0xFF, 0x05, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x00, 0x01, 0x06, 0xFF, 0x01, 0x02, 0x06,
+    0xFF, 0x00, 0x02, 0x06, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x8A, 0x01, 0x01, 0x06, 0xFF, 0x00, 0x01, 0x01, 0x05, 0xFF, 0x80, 0x01, 0x01, 0x06, 0xFF,
+    0x06, 0x01, 0x02, 0x05, 0xFF, 0x00, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x01, 0x06,
+    0xFF, 0x00, 0x01, 0x06, 0xFF, 0x81, 0x01, 0x02, 0x05, 0xFF, 0x80, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF,
+    0x80, 0x01, 0x01, 0x06, 0xFF, 0x01, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x80, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x00, 0x05, 0xFF,
+    0x01, 0x01, 0x06, 0xFF, 0x81, 0x01, 0x01, 0x05, 0xFF, 0x82, 0x01, 0x01, 0x06, 0xFF, 0x83, 0x01, 0x02, 0x06, 0xFF, 0x02, 0x01, 0x02, 0x05, 0xFF,
+    0x02, 0x02, 0x06, 0xFF, 0x02, 0x02, 0x05, 0xFF, 0x80, 0x01, 0x02, 0x05, 0xFF, 0x80, 0x01, 0x02, 0x06, 0xFF, 0x00, 0x01, 0x02, 0x05, 0xFF, 0x82,
+    0x01, 0x02, 0x06, 0xFF, 0x0A, 0x01, 0x02, 0x04, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x04,
+    0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x01, 0x00, 0x05, 0xFF, 0x01, 0x00, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04,
+    0xFF, 0x80, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x81, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00,
+    0x03, 0xFF, 0x00, 0x00, 0x01, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x83, 0x00, 0x01, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x02, 0x00,
+    0x01, 0x03, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x01, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x00, 0x03,
+    0xFF, 0x81, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x00, 0x02, 0xFF, 0x83, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
+    0x02, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x01, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x01, 0x00, 0x01,
+    0x03, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x03, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x00,
+    0x03, 0xFF, 0x01, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x01, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x04, 0xFF, 0x04, 0x00, 0x01,
+    0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x80, 0x00, 0x01, 0x05, 0xFF, 0x80,
+    0x01, 0x01, 0x05, 0xFF, 0x00, 0x00, 0x01, 0x05, 0xFF, 0x80, 0x01, 0x01, 0x06, 0xFF, 0x06, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x00,
+    0x02, 0x07, 0xFF, 0x01, 0x02, 0x08, 0xFF, 0x01, 0x03, 0x08, 0xFF, 0x01, 0x03, 0x09, 0xFF, 0x01, 0x03, 0x08, 0xFF, 0x81, 0x01, 0x03, 0x09, 0xFF,
+    0x09, 0x01, 0x03, 0x0A, 0xFF, 0x01, 0x04, 0x0A, 0xFF, 0x02, 0x03, 0x0A, 0xFF, 0x01, 0x03, 0x0A, 0xFF, 0x02, 0x03, 0x0A, 0xFF, 0x01, 0x03, 0x0A,
+    0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x01, 0x03, 0x0A, 0xFF, 0x01, 0x02, 0x0A, 0xFF, 0x02, 0x03, 0x0A, 0xFF, 0x80, 0x01, 0x02, 0x0A, 0xFF, 0x01, 0x02,
+    0x03, 0x0A, 0xFF, 0x01, 0x03, 0x09, 0xFF, 0x84, 0x01, 0x02, 0x09, 0xFF, 0x00, 0x01, 0x03, 0x09, 0xFF, 0x81, 0x01, 0x02, 0x08, 0xFF, 0x00, 0x02,
+    0x03, 0x08, 0xFF, 0x80, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x81, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x01,
+    0x01, 0x06, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x81, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x00, 0x05, 0xFF, 0x81, 0x01, 0x00,
+    0x04, 0xFF, 0x81, 0x00, 0x00, 0x04, 0xFF, 0x04, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x03, 0xFF,
+    0x00, 0x00, 0x02, 0xFF, 0x86, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x02, 0xFF, 0x02,
+    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x81, 0x00, 0x00, 0x01, 0xFF, 0x04, 0x00, 0x00, 0x02, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x02,
+    0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x02, 0xFF, 0x02, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x02,
+    0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x81, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x01,
+    0x00, 0x01, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01,
+    0x00, 0x02, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x03, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x03,
+    0xFF, 0x80, 0x01, 0x01, 0x04, 0xFF, 0x16, 0x01, 0x00, 0x04, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x01, 0x00, 0x05, 0xFF, 0x01,
+    0x00, 0x04, 0xFF, 0x01, 0x00, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x02, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01,
+    0x01, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01,
+    0x02, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x00,
+    0x01, 0x05, 0xFF, 0x81, 0x01, 0x02, 0x06, 0xFF, 0x80, 0x01, 0x01, 0x06, 0xFF, 0x01, 0x01, 0x02, 0x07, 0xFF, 0x00, 0x02, 0x06, 0xFF, 0x80, 0x01,
+    0x02, 0x07, 0xFF, 0x80, 0x01, 0x01, 0x06, 0xFF, 0x00, 0x01, 0x02, 0x07, 0xFF, 0x80, 0x01, 0x01, 0x06, 0xFF, 0x00, 0x02, 0x02, 0x06, 0xFF, 0x80,
+    0x01, 0x01, 0x06, 0xFF, 0x00, 0x01, 0x02, 0x06, 0xFF, 0x80, 0x02, 0x02, 0x06, 0xFF, 0x80, 0x01, 0x02, 0x06, 0xFF, 0x03, 0x01, 0x01, 0x06, 0xFF,
+    0x01, 0x02, 0x06, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x82, 0x01, 0x02, 0x05, 0xFF, 0x00, 0x01, 0x01, 0x04, 0xFF, 0x81, 0x01,
+    0x02, 0x05, 0xFF, 0x80, 0x01, 0x02, 0x06, 0xFF, 0x80, 0x01, 0x02, 0x05, 0xFF, 0x09, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x01, 0x01,
+    0x05, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x02, 0x01, 0x05, 0xFF, 0x02, 0x01,
+    0x06, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x80, 0x01, 0x02, 0x06, 0xFF, 0x00, 0x02, 0x02, 0x06, 0xFF, 0x80, 0x01, 0x02, 0x06, 0xFF, 0x80, 0x02, 0x02,
+    0x06, 0xFF, 0x00, 0x01, 0x02, 0x06, 0xFF, 0x80, 0x02, 0x03, 0x07, 0xFF, 0x80, 0x01, 0x02, 0x06, 0xFF, 0x02, 0x02, 0x02, 0x06, 0xFF, 0x01, 0x02,
+    0x06, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x80, 0x02, 0x03, 0x06, 0xFF, 0x01, 0x01, 0x03, 0x06, 0xFF, 0x02, 0x03, 0x06, 0xFF, 0x80, 0x01, 0x02, 0x05,
+    0xFF, 0x81, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x80, 0x02, 0x01, 0x05, 0xFF, 0x02, 0x00, 0x01, 0x04,
+    0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x80, 0x01, 0x01, 0x05, 0xFF, 0x82, 0x01, 0x01, 0x04, 0xFF, 0x04, 0x00, 0x00, 0x04, 0xFF,
+    0x00, 0x01, 0x03, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x0A, 0x00, 0x01,
+    0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x00,
+    0x03, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x03, 0xFF, 0x80,
+    0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x01, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x07, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00,
+    0x00, 0x02, 0xFF, 0x01, 0x01, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x01, 0x01, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x80,
+    0x00, 0x00, 0x03, 0xFF, 0x81, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x01, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x04, 0xFF,
+    0x80, 0x00, 0x00, 0x03, 0xFF, 0x08, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x01,
+    0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x05, 0xFF, 0x80,
+    0x01, 0x01, 0x05, 0xFF, 0x04, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x01, 0x02, 0x05,
+    0xFF, 0x80, 0x01, 0x01, 0x06, 0xFF, 0x82, 0x01, 0x02, 0x06, 0xFF, 0x03, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x02, 0x08, 0xFF, 0x00, 0x02, 0x07, 0xFF,
+    0x01, 0x03, 0x08, 0xFF, 0x80, 0x01, 0x03, 0x09, 0xFF, 0x04, 0x02, 0x04, 0x0A, 0xFF, 0x01, 0x04, 0x0A, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x02, 0x04,
+    0x0B, 0xFF, 0x01, 0x04, 0x0B, 0xFF, 0x82, 0x02, 0x04, 0x0B, 0xFF, 0x02, 0x02, 0x03, 0x0B, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x02, 0x03, 0x0B, 0xFF,
+    0x82, 0x02, 0x04, 0x0B, 0xFF, 0x00, 0x02, 0x03, 0x0B, 0xFF, 0x81, 0x02, 0x04, 0x0A, 0xFF, 0x03, 0x02, 0x03, 0x0A, 0xFF, 0x02, 0x04, 0x0A, 0xFF,
+    0x01, 0x04, 0x09, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x80, 0x01, 0x03, 0x08, 0xFF, 0x00, 0x02, 0x03, 0x09, 0xFF, 0x81, 0x01, 0x03, 0x08, 0xFF, 0x81,
+    0x01, 0x02, 0x07, 0xFF, 0x81, 0x01, 0x02, 0x06, 0xFF, 0x06, 0x01, 0x01, 0x06, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x02, 0x01, 0x06, 0xFF, 0x01, 0x01,
+    0x06, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x00, 0x05, 0xFF, 0x80, 0x01, 0x01, 0x05, 0xFF, 0x06, 0x00, 0x00, 0x05, 0xFF,
+    0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x01, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x00, 0x04, 0xFF,
+    0x80, 0x00, 0x00, 0x03, 0xFF, 0x02, 0x00, 0x00, 0x02, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x85, 0x00, 0x00, 0x01, 0xFF, 0x80,
+    0x00, 0x00, 0x02, 0xFF, 0x82, 0x00, 0x00, 0x01, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x02, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00,
+    0x02, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x02, 0xFF, 0x03, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF,
+    0x01, 0x00, 0x02, 0xFF, 0x08, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01,
+    0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x02, 0x00,
+    0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0x00, 0xFF, 0x81, 0x00, 0x01,
+    0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x03, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF,
+    0x80, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x01, 0x01, 0x05, 0xFF, 0x80, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x00, 0x05, 0xFF, 0x01, 0x00, 0x04, 0xFF,
+    0x80, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x00, 0x01, 0x06, 0xFF, 0x80, 0x00, 0x01, 0x05, 0xFF, 0x09, 0x02, 0x02, 0x04, 0xFF, 0x01, 0x02, 0x05, 0xFF,
+    0x00, 0x00, 0x05, 0xFF, 0x00, 0x02, 0x06, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x06, 0xFF,
+    0x00, 0x02, 0x06, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x80, 0x00, 0x02, 0x06, 0xFF, 0x80, 0x01, 0x02, 0x07, 0xFF, 0x08, 0x00, 0x02, 0x07, 0xFF, 0x00,
+    0x02, 0x08, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x00, 0x02, 0x07, 0xFF, 0x01, 0x02, 0x08, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x02, 0x08, 0xFF, 0x00,
+    0x02, 0x08, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x81, 0x01, 0x02, 0x08, 0xFF, 0x00, 0x02, 0x02, 0x08, 0xFF, 0x80, 0x01, 0x02, 0x07, 0xFF, 0x00, 0x01,
+    0x03, 0x08, 0xFF, 0x80, 0x01, 0x02, 0x07, 0xFF, 0x00, 0x01, 0x02, 0x08, 0xFF, 0x81, 0x01, 0x02, 0x07, 0xFF, 0x83, 0x01, 0x02, 0x06, 0xFF, 0x81,
+    0x01, 0x02, 0x05, 0xFF, 0x00, 0x01, 0x02, 0x06, 0xFF, 0x80, 0x00, 0x02, 0x05, 0xFF, 0x84, 0x01, 0x02, 0x05, 0xFF, 0x05, 0x01, 0x02, 0x06, 0xFF,
+    0x01, 0x02, 0x05, 0xFF, 0x02, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x02, 0x02, 0x06, 0xFF, 0x80, 0x01, 0x02, 0x06,
+    0xFF, 0x80, 0x01, 0x03, 0x06, 0xFF, 0x02, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x80, 0x01, 0x02, 0x07, 0xFF,
+    0x80, 0x02, 0x03, 0x07, 0xFF, 0x80, 0x01, 0x03, 0x07, 0xFF, 0x01, 0x02, 0x03, 0x07, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x81, 0x01, 0x03, 0x07, 0xFF,
+    0x81, 0x01, 0x03, 0x06, 0xFF, 0x02, 0x02, 0x03, 0x06, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x80, 0x01, 0x02, 0x06, 0xFF, 0x00,
+    0x01, 0x02, 0x05, 0xFF, 0x80, 0x01, 0x02, 0x06, 0xFF, 0x03, 0x02, 0x02, 0x06, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x01,
+    0x04, 0xFF, 0x81, 0x01, 0x01, 0x05, 0xFF, 0x02, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x05,
+    0xFF, 0x00, 0x01, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x01, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x01, 0x00, 0x01,
+    0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x81, 0x00, 0x00, 0x03,
+    0xFF, 0x00, 0x00, 0x01, 0x03, 0xFF, 0x84, 0x00, 0x00, 0x03, 0xFF, 0x01, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x03, 0xFF, 0x82, 0x00, 0x00, 0x03,
+    0xFF, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x04, 0x00, 0x01, 0x03, 0xFF,
+    0x00, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01,
+    0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x80, 0x00, 0x00,
+    0x03, 0xFF, 0x02, 0x01, 0x00, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x00, 0x05, 0xFF, 0x80, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x01, 0x05,
+    0xFF, 0x02, 0x01, 0x04, 0xFF, 0x82, 0x01, 0x01, 0x05, 0xFF, 0x02, 0x01, 0x01, 0x06, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x81,
+    0x01, 0x02, 0x07, 0xFF, 0x04, 0x01, 0x02, 0x08, 0xFF, 0x01, 0x03, 0x09, 0xFF, 0x00, 0x03, 0x08, 0xFF, 0x01, 0x03, 0x09, 0xFF, 0x01, 0x04, 0x09,
+    0xFF, 0x80, 0x01, 0x04, 0x0A, 0xFF, 0x01, 0x01, 0x04, 0x0B, 0xFF, 0x02, 0x05, 0x0B, 0xFF, 0x81, 0x02, 0x05, 0x0C, 0xFF, 0x80, 0x02, 0x05, 0x0D,
+    0xFF, 0x01, 0x03, 0x05, 0x0D, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x80, 0x03, 0x05, 0x0D, 0xFF, 0x02, 0x03, 0x05, 0x0C, 0xFF, 0x02, 0x05, 0x0D, 0xFF,
+    0x02, 0x05, 0x0C, 0xFF, 0x80, 0x02, 0x04, 0x0C, 0xFF, 0x00, 0x02, 0x05, 0x0C, 0xFF, 0x80, 0x02, 0x04, 0x0C, 0xFF, 0x00, 0x02, 0x05, 0x0C, 0xFF,
+    0x82, 0x02, 0x04, 0x0B, 0xFF, 0x05, 0x01, 0x03, 0x0B, 0xFF, 0x01, 0x04, 0x0A, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x02, 0x03,
+    0x08, 0xFF, 0x01, 0x03, 0x09, 0xFF, 0x80, 0x01, 0x03, 0x08, 0xFF, 0x80, 0x01, 0x02, 0x07, 0xFF, 0x03, 0x02, 0x03, 0x07, 0xFF, 0x01, 0x02, 0x06,
+    0xFF, 0x01, 0x01, 0x06, 0xFF, 0x00, 0x01, 0x06, 0xFF, 0x80, 0x01, 0x01, 0x06, 0xFF, 0x05, 0x02, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x00,
+    0x01, 0x06, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x80, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x01, 0x03,
+    0xFF, 0x82, 0x00, 0x00, 0x04, 0xFF, 0x01, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x02,
+    0xFF, 0x88, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x81, 0x00, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x00,
+    0xFF, 0x03, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x81, 0x01, 0x00, 0x02, 0xFF, 0x00,
+    0x00, 0x00, 0x02, 0xFF, 0x81, 0x01, 0x00, 0x02, 0xFF, 0x01, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x00,
+    0x00, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x0C, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x01, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x81, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF,
+    0x09, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x02, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05,
+    0xFF, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x82, 0x01, 0x01, 0x05, 0xFF, 0x02, 0x02,
+    0x01, 0x06, 0xFF, 0x00, 0x02, 0x06, 0xFF, 0x01, 0x01, 0x07, 0xFF, 0x80, 0x01, 0x02, 0x06, 0xFF, 0x00, 0x01, 0x02, 0x08, 0xFF, 0x80, 0x00, 0x02,
+    0x07, 0xFF, 0x81, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x01, 0x02, 0x08, 0xFF, 0x00, 0x02, 0x07, 0xFF, 0x80, 0x01, 0x02, 0x07, 0xFF, 0x02, 0x01, 0x02,
+    0x08, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x03, 0x08, 0xFF, 0x80, 0x01, 0x02, 0x08, 0xFF, 0x03, 0x01, 0x03, 0x08, 0xFF, 0x01, 0x02, 0x07, 0xFF,
+    0x01, 0x02, 0x08, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x80, 0x02, 0x02, 0x08, 0xFF, 0x80, 0x01, 0x02, 0x08, 0xFF, 0x04, 0x02, 0x02, 0x08, 0xFF, 0x01,
+    0x02, 0x07, 0xFF, 0x02, 0x02, 0x07, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x03, 0x08, 0xFF, 0x80, 0x01, 0x02, 0x07, 0xFF, 0x05, 0x02, 0x02, 0x07,
+    0xFF, 0x01, 0x02, 0x06, 0xFF, 0x02, 0x02, 0x07, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x02, 0x02, 0x06, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x80, 0x01, 0x02,
+    0x06, 0xFF, 0x01, 0x01, 0x02, 0x05, 0xFF, 0x02, 0x02, 0x06, 0xFF, 0x82, 0x01, 0x02, 0x06, 0xFF, 0x80, 0x01, 0x02, 0x05, 0xFF, 0x81, 0x01, 0x02,
+    0x06, 0xFF, 0x00, 0x01, 0x02, 0x05, 0xFF, 0x81, 0x01, 0x02, 0x06, 0xFF, 0x0D, 0x01, 0x01, 0x06, 0xFF, 0x02, 0x01, 0x06, 0xFF, 0x01, 0x01, 0x06,
+    0xFF, 0x02, 0x03, 0x06, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x02, 0x08, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x02, 0x03, 0x08,
+    0xFF, 0x01, 0x03, 0x08, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x01, 0x02, 0x08, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x81, 0x02, 0x03,
+    0x08, 0xFF, 0x81, 0x02, 0x03, 0x07, 0xFF, 0x00, 0x01, 0x03, 0x06, 0xFF, 0x81, 0x02, 0x03, 0x07, 0xFF, 0x01, 0x01, 0x03, 0x06, 0xFF, 0x02, 0x02,
+    0x06, 0xFF, 0x80, 0x01, 0x02, 0x06, 0xFF, 0x12, 0x02, 0x02, 0x06, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x02, 0x02, 0x06, 0xFF, 0x01, 0x01, 0x06, 0xFF,
+    0x02, 0x01, 0x06, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF,
+    0x01, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF,
+    0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x81, 0x00, 0x01, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
+    0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0x03, 0xFF, 0x84, 0x00, 0x00, 0x03, 0xFF, 0x02, 0x01, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x01,
+    0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x01, 0x00, 0x03, 0xFF, 0x83, 0x00,
+    0x00, 0x03, 0xFF, 0x04, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x03, 0xFF,
+    0x81, 0x00, 0x01, 0x03, 0xFF, 0x0F, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x00,
+    0x02, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x00, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01,
+    0x05, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x00, 0x05, 0xFF, 0x81, 0x00,
+    0x01, 0x06, 0xFF, 0x04, 0x00, 0x02, 0x07, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x02, 0x08, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x02, 0x08, 0xFF,
+    0x80, 0x01, 0x02, 0x09, 0xFF, 0x08, 0x02, 0x03, 0x09, 0xFF, 0x01, 0x03, 0x0A, 0xFF, 0x01, 0x04, 0x0A, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x02, 0x04,
+    0x0B, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x02, 0x05, 0x0C, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x02, 0x05, 0x0D, 0xFF, 0x80, 0x03, 0x06, 0x0D, 0xFF, 0x02,
+    0x04, 0x05, 0x0F, 0xFF, 0x03, 0x06, 0x0E, 0xFF, 0x04, 0x06, 0x0E, 0xFF, 0x80, 0x03, 0x06, 0x0E, 0xFF, 0x00, 0x04, 0x05, 0x0E, 0xFF, 0x81, 0x03,
+    0x05, 0x0E, 0xFF, 0x83, 0x03, 0x05, 0x0D, 0xFF, 0x82, 0x02, 0x05, 0x0D, 0xFF, 0x80, 0x02, 0x05, 0x0C, 0xFF, 0x80, 0x02, 0x04, 0x0C, 0xFF, 0x03,
+    0x02, 0x04, 0x0B, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x01, 0x04, 0x0A, 0xFF, 0x01, 0x04, 0x09, 0xFF, 0x80, 0x01, 0x03, 0x08, 0xFF, 0x02, 0x02, 0x03,
+    0x08, 0xFF, 0x01, 0x02, 0x08, 0xFF, 0x02, 0x02, 0x07, 0xFF, 0x80, 0x01, 0x02, 0x07, 0xFF, 0x00, 0x02, 0x02, 0x06, 0xFF, 0x80, 0x01, 0x01, 0x06,
+    0xFF, 0x06, 0x01, 0x00, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x00, 0x04, 0xFF, 0x01, 0x01,
+    0x04, 0xFF, 0x01, 0x01, 0x03, 0xFF, 0x80, 0x00, 0x01, 0x03, 0xFF, 0x03, 0x01, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x04, 0xFF,
+    0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x01, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x83,
+    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x02, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0x00, 0x02, 0xFF, 0x81, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x80,
+    0x00, 0x00, 0x01, 0xFF, 0x05, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x02,
+    0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x0D, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x00, 0xFF,
+    0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF,
+    0x80, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0x02, 0xFF, 0x80, 0x00, 0x01, 0x04,
+    0xFF, 0x0D, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x00,
+    0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x01, 0x01,
+    0x05, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x80, 0x01, 0x02, 0x06, 0xFF, 0x03, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x03, 0x07, 0xFF,
+    0x01, 0x02, 0x07, 0xFF, 0x01, 0x02, 0x08, 0xFF, 0x80, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x01, 0x02, 0x08, 0xFF, 0x00, 0x02, 0x08, 0xFF, 0x80, 0x01,
+    0x02, 0x08, 0xFF, 0x00, 0x00, 0x02, 0x08, 0xFF, 0x80, 0x01, 0x02, 0x08, 0xFF, 0x02, 0x01, 0x03, 0x09, 0xFF, 0x01, 0x02, 0x09, 0xFF, 0x01, 0x02,
+    0x08, 0xFF, 0x80, 0x01, 0x02, 0x09, 0xFF, 0x00, 0x01, 0x03, 0x09, 0xFF, 0x80, 0x01, 0x02, 0x08, 0xFF, 0x00, 0x01, 0x02, 0x09, 0xFF, 0x80, 0x01,
+    0x02, 0x08, 0xFF, 0x00, 0x01, 0x02, 0x09, 0xFF, 0x80, 0x01, 0x02, 0x08, 0xFF, 0x05, 0x02, 0x02, 0x08, 0xFF, 0x01, 0x02, 0x08, 0xFF, 0x02, 0x02,
+    0x08, 0xFF, 0x01, 0x02, 0x08, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x02, 0x08, 0xFF, 0x81, 0x01, 0x02, 0x07, 0xFF, 0x00, 0x02, 0x02, 0x07, 0xFF,
+    0x80, 0x01, 0x02, 0x07, 0xFF, 0x81, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x80, 0x01, 0x02, 0x07, 0xFF,
+    0x07, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x00, 0x02, 0x07, 0xFF, 0x01, 0x01, 0x07,
+    0xFF, 0x01, 0x01, 0x06, 0xFF, 0x01, 0x01, 0x07, 0xFF, 0x80, 0x01, 0x01, 0x06, 0xFF, 0x01, 0x01, 0x01, 0x07, 0xFF, 0x02, 0x02, 0x08, 0xFF, 0x81,
+    0x01, 0x02, 0x08, 0xFF, 0x80, 0x01, 0x03, 0x09, 0xFF, 0x00, 0x02, 0x03, 0x08, 0xFF, 0x80, 0x02, 0x03, 0x09, 0xFF, 0x03, 0x02, 0x03, 0x08, 0xFF,
+    0x02, 0x03, 0x09, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x01, 0x03, 0x09, 0xFF, 0x82, 0x02, 0x03, 0x09, 0xFF, 0x02, 0x02, 0x04, 0x09, 0xFF, 0x02, 0x03,
+    0x09, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x81, 0x01, 0x03, 0x08, 0xFF, 0x80, 0x01, 0x02, 0x07, 0xFF, 0x00, 0x02, 0x02, 0x07, 0xFF, 0x80, 0x01, 0x01,
+    0x06, 0xFF, 0x03, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x80, 0x01, 0x01, 0x05, 0xFF,
+    0x05, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x00, 0x04,
+    0xFF, 0x80, 0x00, 0x01, 0x05, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x01, 0x05, 0xFF, 0x82, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x00,
+    0x04, 0xFF, 0x84, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x96, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x00,
+    0x00, 0x03, 0xFF, 0x80, 0x00, 0x01, 0x03, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x0A, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x01,
+    0x06, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x00, 0x05, 0xFF, 0x01, 0x00, 0x05, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x00, 0x00, 0x06, 0xFF, 0x01, 0x01,
+    0x05, 0xFF, 0x00, 0x01, 0x06, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x80, 0x01, 0x02, 0x07, 0xFF, 0x80, 0x01, 0x02, 0x08, 0xFF, 0x01, 0x00, 0x02, 0x07,
+    0xFF, 0x01, 0x03, 0x08, 0xFF, 0x80, 0x02, 0x03, 0x09, 0xFF, 0x01, 0x02, 0x04, 0x0A, 0xFF, 0x02, 0x05, 0x0A, 0xFF, 0x80, 0x02, 0x04, 0x0B, 0xFF,
+    0x06, 0x02, 0x06, 0x0C, 0xFF, 0x03, 0x05, 0x0E, 0xFF, 0x04, 0x05, 0x0E, 0xFF, 0x04, 0x06, 0x0E, 0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x03, 0x05, 0x0F,
+    0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x80, 0x04, 0x06, 0x10, 0xFF, 0x00, 0x04, 0x06, 0x0F, 0xFF, 0x83, 0x04, 0x06, 0x10, 0xFF, 0x00, 0x04, 0x05, 0x10,
+    0xFF, 0x80, 0x04, 0x06, 0x0F, 0xFF, 0x0C, 0x04, 0x05, 0x0F, 0xFF, 0x04, 0x06, 0x0E, 0xFF, 0x03, 0x05, 0x0E, 0xFF, 0x03, 0x06, 0x0E, 0xFF, 0x04,
+    0x06, 0x0E, 0xFF, 0x03, 0x06, 0x0D, 0xFF, 0x03, 0x05, 0x0E, 0xFF, 0x02, 0x05, 0x0D, 0xFF, 0x03, 0x06, 0x0D, 0xFF, 0x02, 0x05, 0x0C, 0xFF, 0x03,
+    0x05, 0x0C, 0xFF, 0x02, 0x05, 0x0C, 0xFF, 0x02, 0x04, 0x0C, 0xFF, 0x80, 0x02, 0x04, 0x0B, 0xFF, 0x02, 0x02, 0x04, 0x0A, 0xFF, 0x02, 0x03, 0x0A,
+    0xFF, 0x01, 0x02, 0x09, 0xFF, 0x80, 0x01, 0x02, 0x08, 0xFF, 0x02, 0x01, 0x02, 0x07, 0xFF, 0x02, 0x02, 0x07, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x80,
+    0x01, 0x01, 0x06, 0xFF, 0x80, 0x01, 0x00, 0x05, 0xFF, 0x06, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x00,
+    0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x04, 0xFF,
+    0x80, 0x00, 0x01, 0x04, 0xFF, 0x81, 0x00, 0x00, 0x04, 0xFF, 0x02, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x81,
+    0x00, 0x00, 0x02, 0xFF, 0x81, 0x00, 0x00, 0x01, 0xFF, 0x83, 0x00, 0x00, 0x02, 0xFF, 0x81, 0x00, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF,
+    0x07, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01,
+    0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x81, 0x01, 0x00, 0x01, 0xFF, 0x04, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00,
+    0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x19, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01,
+    0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01,
+    0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x04,
+    0xFF, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x05,
+    0xFF, 0x01, 0x01, 0x05, 0xFF, 0x02, 0x01, 0x06, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x01, 0x02, 0x06,
+    0xFF, 0x80, 0x01, 0x02, 0x07, 0xFF, 0x81, 0x01, 0x03, 0x07, 0xFF, 0x84, 0x01, 0x03, 0x08, 0xFF, 0x84, 0x01, 0x03, 0x09, 0xFF, 0x81, 0x01, 0x03,
+    0x0A, 0xFF, 0x03, 0x01, 0x03, 0x09, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x01, 0x02, 0x09, 0xFF, 0x01, 0x03, 0x09, 0xFF, 0x80, 0x01, 0x02, 0x09, 0xFF,
+    0x03, 0x01, 0x03, 0x0A, 0xFF, 0x02, 0x03, 0x0A, 0xFF, 0x02, 0x02, 0x09, 0xFF, 0x02, 0x02, 0x0A, 0xFF, 0x80, 0x02, 0x03, 0x0A, 0xFF, 0x02, 0x02,
+    0x02, 0x0A, 0xFF, 0x01, 0x02, 0x0A, 0xFF, 0x01, 0x03, 0x0A, 0xFF, 0x83, 0x01, 0x03, 0x09, 0xFF, 0x00, 0x01, 0x03, 0x08, 0xFF, 0x81, 0x01, 0x02,
+    0x08, 0xFF, 0x01, 0x01, 0x02, 0x07, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x81, 0x01, 0x02, 0x08, 0xFF, 0x83, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x01, 0x02,
+    0x08, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x80, 0x01, 0x02, 0x08, 0xFF, 0x00, 0x01, 0x02, 0x07, 0xFF, 0x83, 0x01, 0x02, 0x08, 0xFF, 0x01, 0x01, 0x03,
+    0x09, 0xFF, 0x01, 0x03, 0x08, 0xFF, 0x82, 0x02, 0x03, 0x09, 0xFF, 0x05, 0x02, 0x03, 0x0A, 0xFF, 0x03, 0x03, 0x0B, 0xFF, 0x02, 0x04, 0x0A, 0xFF,
+    0x02, 0x03, 0x0B, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x80, 0x02, 0x04, 0x0B, 0xFF, 0x80, 0x02, 0x04, 0x0A, 0xFF, 0x02, 0x02,
+    0x03, 0x0A, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x02, 0x03, 0x0A, 0xFF, 0x81, 0x02, 0x03, 0x09, 0xFF, 0x80, 0x01, 0x02, 0x08, 0xFF, 0x0C, 0x02, 0x02,
+    0x08, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x02, 0x02, 0x06, 0xFF, 0x02, 0x02, 0x05, 0xFF, 0x02, 0x01, 0x05, 0xFF, 0x01, 0x01,
+    0x06, 0xFF, 0x02, 0x02, 0x06, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01,
+    0x04, 0xFF, 0x80, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x82, 0x00, 0x01, 0x04, 0xFF, 0x83, 0x00, 0x01,
+    0x05, 0xFF, 0x02, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x01, 0x03, 0xFF, 0x80, 0x00, 0x01, 0x04,
+    0xFF, 0x80, 0x00, 0x00, 0x04, 0xFF, 0x83, 0x00, 0x00, 0x03, 0xFF, 0x01, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x88, 0x00, 0x00, 0x03,
+    0xFF, 0x00, 0x00, 0x01, 0x04, 0xFF, 0x81, 0x00, 0x01, 0x03, 0xFF, 0x82, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x00, 0x01,
+    0x04, 0xFF, 0x80, 0x01, 0x01, 0x04, 0xFF, 0x02, 0x01, 0x00, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x80, 0x00, 0x01, 0x06,
+    0xFF, 0x80, 0x01, 0x01, 0x06, 0xFF, 0x00, 0x02, 0x02, 0x05, 0xFF, 0x80, 0x01, 0x01, 0x07, 0xFF, 0x01, 0x01, 0x02, 0x06, 0xFF, 0x00, 0x02, 0x07,
+    0xFF, 0x80, 0x01, 0x02, 0x08, 0xFF, 0x80, 0x01, 0x03, 0x09, 0xFF, 0x01, 0x01, 0x03, 0x0A, 0xFF, 0x01, 0x04, 0x0B, 0xFF, 0x80, 0x02, 0x05, 0x0C,
+    0xFF, 0x03, 0x03, 0x06, 0x0D, 0xFF, 0x03, 0x05, 0x0E, 0xFF, 0x03, 0x06, 0x0F, 0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x80, 0x04, 0x07, 0x10, 0xFF, 0x03,
+    0x05, 0x07, 0x11, 0xFF, 0x05, 0x07, 0x10, 0xFF, 0x05, 0x06, 0x11, 0xFF, 0x06, 0x07, 0x12, 0xFF, 0x80, 0x05, 0x07, 0x11, 0xFF, 0x03, 0x04, 0x07,
+    0x11, 0xFF, 0x05, 0x07, 0x11, 0xFF, 0x05, 0x07, 0x12, 0xFF, 0x05, 0x07, 0x11, 0xFF, 0x81, 0x05, 0x07, 0x12, 0xFF, 0x05, 0x04, 0x07, 0x12, 0xFF,
+    0x04, 0x07, 0x11, 0xFF, 0x05, 0x07, 0x11, 0xFF, 0x04, 0x07, 0x10, 0xFF, 0x05, 0x07, 0x10, 0xFF, 0x04, 0x07, 0x10, 0xFF, 0x82, 0x04, 0x07, 0x0F,
+    0xFF, 0x80, 0x03, 0x06, 0x0E, 0xFF, 0x00, 0x02, 0x06, 0x0D, 0xFF, 0x80, 0x03, 0x05, 0x0C, 0xFF, 0x00, 0x02, 0x05, 0x0C, 0xFF, 0x80, 0x02, 0x04,
+    0x0B, 0xFF, 0x05, 0x01, 0x03, 0x0A, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x02, 0x02, 0x08, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x01,
+    0x02, 0x07, 0xFF, 0x80, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x01, 0x00, 0x05, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x80, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x00,
+    0x01, 0x06, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x80, 0x01, 0x01, 0x05, 0xFF, 0x80, 0x00, 0x01, 0x05, 0xFF, 0x04, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x00,
+    0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x01, 0x05, 0xFF,
+    0x80, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x00, 0x00, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF,
+    0x80, 0x00, 0x00, 0x01, 0xFF, 0x85, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0xFF, 0x05, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x81, 0x01, 0x01, 0x01, 0xFF, 0x06, 0x01, 0x00, 0x02,
+    0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x07, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00,
+    0x01, 0x01, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x83, 0x01, 0x01, 0x04, 0xFF, 0x80, 0x01, 0x01, 0x05,
+    0xFF, 0x00, 0x00, 0x02, 0x05, 0xFF, 0x80, 0x01, 0x01, 0x05, 0xFF, 0x04, 0x01, 0x01, 0x06, 0xFF, 0x01, 0x01, 0x07, 0xFF, 0x01, 0x03, 0x06, 0xFF,
+    0x01, 0x03, 0x07, 0xFF, 0x01, 0x02, 0x08, 0xFF, 0x80, 0x01, 0x03, 0x08, 0xFF, 0x0C, 0x02, 0x03, 0x09, 0xFF, 0x01, 0x04, 0x09, 0xFF, 0x01, 0x03,
+    0x0A, 0xFF, 0x01, 0x03, 0x09, 0xFF, 0x01, 0x04, 0x0A, 0xFF, 0x01, 0x03, 0x0A, 0xFF, 0x01, 0x03, 0x09, 0xFF, 0x01, 0x03, 0x0A, 0xFF, 0x01, 0x04,
+    0x0A, 0xFF, 0x01, 0x03, 0x0A, 0xFF, 0x02, 0x03, 0x0A, 0xFF, 0x01, 0x04, 0x0A, 0xFF, 0x01, 0x03, 0x0A, 0xFF, 0x80, 0x02, 0x03, 0x0A, 0xFF, 0x80,
+    0x01, 0x03, 0x0A, 0xFF, 0x00, 0x02, 0x04, 0x0A, 0xFF, 0x81, 0x02, 0x03, 0x0A, 0xFF, 0x81, 0x02, 0x03, 0x0B, 0xFF, 0x04, 0x03, 0x03, 0x0B, 0xFF,
+    0x02, 0x04, 0x0A, 0xFF, 0x02, 0x03, 0x0B, 0xFF, 0x03, 0x04, 0x0B, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x80, 0x02, 0x03, 0x0B, 0xFF, 0x03, 0x02, 0x03,
+    0x0A, 0xFF, 0x01, 0x04, 0x0A, 0xFF, 0x01, 0x03, 0x0A, 0xFF, 0x02, 0x03, 0x0A, 0xFF, 0x80, 0x02, 0x03, 0x09, 0xFF, 0x04, 0x01, 0x03, 0x09, 0xFF,
+    0x01, 0x03, 0x08, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x01, 0x03, 0x08, 0xFF, 0x01, 0x02, 0x08, 0xFF, 0x81, 0x01, 0x03, 0x08, 0xFF, 0x00, 0x01, 0x02,
+    0x08, 0xFF, 0x80, 0x01, 0x02, 0x07, 0xFF, 0x12, 0x01, 0x02, 0x08, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x01, 0x08, 0xFF, 0x01, 0x02, 0x08, 0xFF,
+    0x01, 0x02, 0x07, 0xFF, 0x02, 0x02, 0x08, 0xFF, 0x01, 0x02, 0x08, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x01, 0x02, 0x09, 0xFF, 0x01, 0x03, 0x09, 0xFF,
+    0x02, 0x03, 0x09, 0xFF, 0x01, 0x03, 0x09, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x02, 0x03, 0x0A, 0xFF, 0x02, 0x02, 0x0A, 0xFF, 0x02, 0x04, 0x0A, 0xFF,
+    0x02, 0x04, 0x0B, 0xFF, 0x02, 0x03, 0x0B, 0xFF, 0x03, 0x03, 0x0B, 0xFF, 0x80, 0x03, 0x04, 0x0B, 0xFF, 0x09, 0x02, 0x04, 0x0B, 0xFF, 0x03, 0x04,
+    0x0C, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x03, 0x04, 0x0B, 0xFF, 0x02, 0x04, 0x0C, 0xFF, 0x03, 0x05, 0x0B, 0xFF, 0x03, 0x04, 0x0C, 0xFF, 0x03, 0x03,
+    0x0C, 0xFF, 0x03, 0x04, 0x0B, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x80, 0x03, 0x04, 0x0A, 0xFF, 0x80, 0x02, 0x03, 0x0A, 0xFF, 0x05, 0x02, 0x03, 0x09,
+    0xFF, 0x02, 0x02, 0x08, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x02, 0x02, 0x07, 0xFF, 0x02, 0x02, 0x06, 0xFF, 0x02, 0x02, 0x07, 0xFF, 0x80, 0x02, 0x02,
+    0x06, 0xFF, 0x08, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x02, 0x02, 0x06, 0xFF, 0x01,
+    0x02, 0x05, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x02, 0x02, 0x04, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x04, 0x00, 0x01, 0x03,
+    0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01,
+    0x01, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x01, 0x01, 0x03, 0xFF, 0x04, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x03,
+    0xFF, 0x00, 0x02, 0x04, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x81, 0x01, 0x01, 0x03, 0xFF, 0x08, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x01,
+    0x01, 0x03, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x01, 0x01, 0x03, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00,
+    0x00, 0x02, 0xFF, 0x80, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x85, 0x00, 0x01, 0x03, 0xFF, 0x02, 0x01, 0x01, 0x03, 0xFF, 0x01,
+    0x02, 0x03, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x02, 0x04, 0xFF, 0x11, 0x00,
+    0x01, 0x04, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x00,
+    0x02, 0x06, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x02, 0x09, 0xFF, 0x00,
+    0x02, 0x08, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x02, 0x08, 0xFF, 0x01, 0x03, 0x09, 0xFF, 0x01, 0x03, 0x0A, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x80,
+    0x02, 0x04, 0x0C, 0xFF, 0x09, 0x02, 0x05, 0x0D, 0xFF, 0x03, 0x06, 0x0E, 0xFF, 0x03, 0x06, 0x0F, 0xFF, 0x04, 0x06, 0x10, 0xFF, 0x04, 0x07, 0x11,
+    0xFF, 0x05, 0x07, 0x11, 0xFF, 0x05, 0x08, 0x12, 0xFF, 0x06, 0x09, 0x12, 0xFF, 0x05, 0x08, 0x13, 0xFF, 0x06, 0x09, 0x13, 0xFF, 0x81, 0x06, 0x09,
+    0x14, 0xFF, 0x80, 0x07, 0x09, 0x14, 0xFF, 0x04, 0x07, 0x08, 0x15, 0xFF, 0x07, 0x0A, 0x14, 0xFF, 0x06, 0x09, 0x13, 0xFF, 0x07, 0x09, 0x14, 0xFF,
+    0x06, 0x09, 0x14, 0xFF, 0x80, 0x06, 0x08, 0x14, 0xFF, 0x03, 0x05, 0x08, 0x14, 0xFF, 0x06, 0x08, 0x13, 0xFF, 0x06, 0x09, 0x13, 0xFF, 0x05, 0x08,
+    0x13, 0xFF, 0x80, 0x05, 0x08, 0x12, 0xFF, 0x03, 0x06, 0x08, 0x12, 0xFF, 0x04, 0x09, 0x12, 0xFF, 0x04, 0x08, 0x12, 0xFF, 0x04, 0x08, 0x11, 0xFF,
+    0x80, 0x04, 0x07, 0x10, 0xFF, 0x03, 0x04, 0x06, 0x0F, 0xFF, 0x03, 0x06, 0x0E, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x02, 0x05, 0x0C, 0xFF, 0x80, 0x02,
+    0x04, 0x0B, 0xFF, 0x02, 0x02, 0x03, 0x0A, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x02, 0x02, 0x08, 0xFF, 0x80, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x01, 0x02,
+    0x06, 0xFF, 0x02, 0x02, 0x06, 0xFF, 0x80, 0x01, 0x01, 0x06, 0xFF, 0x00, 0x00, 0x01, 0x05, 0xFF, 0x81, 0x01, 0x01, 0x06, 0xFF, 0x01, 0x01, 0x01,
+    0x05, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x83, 0x00, 0x01, 0x05, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x05, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x04,
+    0xFF, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x04, 0xFF, 0x80, 0x00,
+    0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x01, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x03, 0x00,
+    0x01, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x81, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0x01,
+    0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF, 0x04, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00,
+    0x01, 0x01, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x11, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00,
+    0x00, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x01, 0x01, 0x03, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x01, 0x01, 0x04, 0xFF,
+    0x08, 0x01, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x02, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x01, 0x05,
+    0xFF, 0x02, 0x02, 0x06, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x02, 0x08, 0xFF, 0x81, 0x01, 0x03, 0x08, 0xFF, 0x80, 0x01, 0x03, 0x09, 0xFF, 0x00,
+    0x02, 0x04, 0x09, 0xFF, 0x80, 0x02, 0x04, 0x0A, 0xFF, 0x02, 0x02, 0x03, 0x0A, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x01, 0x04, 0x0A, 0xFF, 0x80, 0x02,
+    0x04, 0x0A, 0xFF, 0x04, 0x01, 0x04, 0x0A, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x01, 0x04, 0x0A, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x02, 0x03, 0x0A, 0xFF,
+    0x80, 0x02, 0x04, 0x0A, 0xFF, 0x00, 0x01, 0x04, 0x0A, 0xFF, 0x81, 0x02, 0x04, 0x0B, 0xFF, 0x00, 0x02, 0x03, 0x0B, 0xFF, 0x80, 0x02, 0x04, 0x0C,
+    0xFF, 0x80, 0x02, 0x04, 0x0B, 0xFF, 0x03, 0x03, 0x03, 0x0B, 0xFF, 0x02, 0x04, 0x0C, 0xFF, 0x03, 0x04, 0x0B, 0xFF, 0x03, 0x04, 0x0C, 0xFF, 0x80,
+    0x02, 0x04, 0x0B, 0xFF, 0x00, 0x02, 0x04, 0x0C, 0xFF, 0x81, 0x02, 0x04, 0x0B, 0xFF, 0x00, 0x02, 0x03, 0x0A, 0xFF, 0x81, 0x02, 0x03, 0x09, 0xFF,
+    0x05, 0x01, 0x03, 0x09, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x01, 0x02, 0x08, 0xFF, 0x01, 0x03, 0x08, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x01, 0x02, 0x08,
+    0xFF, 0x83, 0x01, 0x02, 0x07, 0xFF, 0x02, 0x02, 0x02, 0x07, 0xFF, 0x01, 0x01, 0x07, 0xFF, 0x02, 0x02, 0x08, 0xFF, 0x80, 0x01, 0x02, 0x08, 0xFF,
+    0x05, 0x01, 0x02, 0x09, 0xFF, 0x02, 0x02, 0x09, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x03, 0x03, 0x0A, 0xFF, 0x02, 0x03, 0x09,
+    0xFF, 0x81, 0x02, 0x04, 0x0A, 0xFF, 0x80, 0x02, 0x04, 0x0B, 0xFF, 0x80, 0x03, 0x04, 0x0B, 0xFF, 0x04, 0x03, 0x04, 0x0C, 0xFF, 0x03, 0x05, 0x0C,
+    0xFF, 0x03, 0x04, 0x0C, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x03, 0x04, 0x0C, 0xFF, 0x80, 0x03, 0x05, 0x0D, 0xFF, 0x80, 0x03, 0x05, 0x0C, 0xFF, 0x08,
+    0x03, 0x04, 0x0C, 0xFF, 0x02, 0x04, 0x0C, 0xFF, 0x03, 0x04, 0x0C, 0xFF, 0x02, 0x04, 0x0C, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x03, 0x04, 0x0B, 0xFF,
+    0x02, 0x04, 0x0B, 0xFF, 0x02, 0x03, 0x0A, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x80, 0x02, 0x03, 0x08, 0xFF, 0x04, 0x02, 0x02, 0x07, 0xFF, 0x02, 0x03,
+    0x07, 0xFF, 0x02, 0x02, 0x07, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x02, 0x02, 0x07, 0xFF, 0x81, 0x01, 0x02, 0x05, 0xFF, 0x80, 0x01, 0x02, 0x06, 0xFF,
+    0x00, 0x01, 0x02, 0x05, 0xFF, 0x83, 0x01, 0x01, 0x04, 0xFF, 0x02, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x80,
+    0x00, 0x01, 0x03, 0xFF, 0x80, 0x01, 0x01, 0x04, 0xFF, 0x82, 0x00, 0x01, 0x04, 0xFF, 0x86, 0x01, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF,
+    0x01, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x84, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x82, 0x00, 0x01, 0x03, 0xFF,
+    0x00, 0x01, 0x01, 0x03, 0xFF, 0x80, 0x00, 0x01, 0x03, 0xFF, 0x85, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x01, 0x01, 0x04, 0xFF, 0x02, 0x01, 0x01, 0x05,
+    0xFF, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x06, 0xFF, 0x80, 0x00, 0x01, 0x07, 0xFF, 0x01, 0x01, 0x01, 0x06, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x80,
+    0x00, 0x02, 0x07, 0xFF, 0x80, 0x01, 0x02, 0x08, 0xFF, 0x0C, 0x00, 0x02, 0x08, 0xFF, 0x01, 0x03, 0x08, 0xFF, 0x01, 0x03, 0x09, 0xFF, 0x01, 0x03,
+    0x0A, 0xFF, 0x01, 0x04, 0x0B, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x02, 0x04, 0x0C, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x03, 0x06, 0x0E, 0xFF, 0x04, 0x06,
+    0x0F, 0xFF, 0x04, 0x07, 0x10, 0xFF, 0x05, 0x08, 0x11, 0xFF, 0x05, 0x08, 0x12, 0xFF, 0x80, 0x06, 0x09, 0x14, 0xFF, 0x01, 0x07, 0x0A, 0x15, 0xFF,
+    0x07, 0x0B, 0x15, 0xFF, 0x80, 0x08, 0x0B, 0x16, 0xFF, 0x00, 0x08, 0x0B, 0x17, 0xFF, 0x80, 0x07, 0x0A, 0x17, 0xFF, 0x81, 0x08, 0x0A, 0x17, 0xFF,
+    0x80, 0x08, 0x0A, 0x16, 0xFF, 0x02, 0x07, 0x09, 0x16, 0xFF, 0x07, 0x09, 0x15, 0xFF, 0x07, 0x09, 0x16, 0xFF, 0x80, 0x07, 0x09, 0x15, 0xFF, 0x17,
+    0x07, 0x0A, 0x15, 0xFF, 0x06, 0x09, 0x15, 0xFF, 0x06, 0x0A, 0x15, 0xFF, 0x07, 0x09, 0x15, 0xFF, 0x06, 0x09, 0x15, 0xFF, 0x06, 0x0A, 0x15, 0xFF,
+    0x06, 0x0A, 0x14, 0xFF, 0x05, 0x09, 0x13, 0xFF, 0x05, 0x09, 0x12, 0xFF, 0x05, 0x08, 0x12, 0xFF, 0x04, 0x08, 0x11, 0xFF, 0x04, 0x07, 0x0F, 0xFF,
+    0x04, 0x06, 0x0F, 0xFF, 0x03, 0x05, 0x0E, 0xFF, 0x02, 0x04, 0x0C, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x01, 0x04, 0x0B, 0xFF, 0x01, 0x04, 0x0A, 0xFF,
+    0x01, 0x03, 0x08, 0xFF, 0x02, 0x02, 0x07, 0xFF, 0x02, 0x02, 0x08, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x02, 0x02, 0x06, 0xFF,
+    0x81, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x01, 0x00, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x81, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x00, 0x01, 0x04, 0xFF,
+    0x00, 0x01, 0x05, 0xFF, 0x83, 0x00, 0x01, 0x04, 0xFF, 0x02, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x80, 0x00,
+    0x00, 0x04, 0xFF, 0x01, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x81, 0x00,
+    0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x02, 0xFF, 0x06, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
+    0x01, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x01,
+    0x00, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x80,
+    0x00, 0x00, 0x01, 0xFF, 0x0D, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x02,
+    0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x01, 0x01, 0x03, 0xFF, 0x80, 0x01, 0x01, 0x04, 0xFF, 0x05, 0x00, 0x01, 0x04, 0xFF, 0x00,
+    0x00, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x00, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x80, 0x01, 0x01, 0x05, 0xFF,
+    0x06, 0x00, 0x02, 0x06, 0xFF, 0x00, 0x01, 0x08, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x02, 0x08, 0xFF, 0x01, 0x03, 0x09, 0xFF, 0x02, 0x03, 0x0A,
+    0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x81, 0x02, 0x05, 0x0B, 0xFF, 0x80, 0x02, 0x06, 0x0B, 0xFF, 0x80, 0x02, 0x05, 0x0B, 0xFF, 0x01, 0x01, 0x05, 0x0A,
+    0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x80, 0x02, 0x04, 0x0A, 0xFF, 0x01, 0x02, 0x05, 0x0A, 0xFF, 0x03, 0x04, 0x0B, 0xFF, 0x80, 0x02, 0x04, 0x0A, 0xFF,
+    0x05, 0x02, 0x04, 0x0B, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x02, 0x05, 0x0B, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x02, 0x03, 0x0B,
+    0xFF, 0x80, 0x02, 0x04, 0x0B, 0xFF, 0x02, 0x03, 0x04, 0x0B, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x02, 0x04, 0x0C, 0xFF, 0x80, 0x03, 0x03, 0x0B, 0xFF,
+    0x03, 0x02, 0x04, 0x0C, 0xFF, 0x02, 0x03, 0x0B, 0xFF, 0x03, 0x03, 0x0B, 0xFF, 0x03, 0x04, 0x0B, 0xFF, 0x80, 0x02, 0x04, 0x0B, 0xFF, 0x01, 0x03,
+    0x04, 0x0B, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x80, 0x02, 0x04, 0x0A, 0xFF, 0x00, 0x03, 0x04, 0x0A, 0xFF, 0x80, 0x02, 0x04, 0x0A, 0xFF, 0x0A, 0x02,
+    0x04, 0x09, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x01, 0x02, 0x08, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x01,
+    0x03, 0x08, 0xFF, 0x01, 0x02, 0x08, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x02, 0x02, 0x07, 0xFF, 0x01, 0x01, 0x08, 0xFF, 0x81, 0x01, 0x02, 0x08, 0xFF,
+    0x02, 0x02, 0x02, 0x09, 0xFF, 0x01, 0x01, 0x08, 0xFF, 0x01, 0x02, 0x09, 0xFF, 0x81, 0x02, 0x02, 0x0A, 0xFF, 0x00, 0x02, 0x03, 0x0B, 0xFF, 0x80,
+    0x02, 0x04, 0x0B, 0xFF, 0x80, 0x03, 0x04, 0x0C, 0xFF, 0x03, 0x03, 0x05, 0x0C, 0xFF, 0x04, 0x05, 0x0C, 0xFF, 0x03, 0x06, 0x0D, 0xFF, 0x04, 0x06,
+    0x0D, 0xFF, 0x80, 0x03, 0x06, 0x0D, 0xFF, 0x02, 0x04, 0x05, 0x0D, 0xFF, 0x04, 0x06, 0x0D, 0xFF, 0x03, 0x06, 0x0D, 0xFF, 0x80, 0x04, 0x05, 0x0D,
+    0xFF, 0x01, 0x03, 0x06, 0x0C, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x80, 0x03, 0x05, 0x0C, 0xFF, 0x03, 0x03, 0x04, 0x0C, 0xFF, 0x03, 0x05, 0x0B, 0xFF,
+    0x03, 0x04, 0x0B, 0xFF, 0x03, 0x03, 0x0A, 0xFF, 0x80, 0x02, 0x03, 0x0A, 0xFF, 0x05, 0x02, 0x03, 0x09, 0xFF, 0x02, 0x02, 0x08, 0xFF, 0x02, 0x02,
+    0x07, 0xFF, 0x02, 0x01, 0x07, 0xFF, 0x01, 0x01, 0x07, 0xFF, 0x02, 0x02, 0x07, 0xFF, 0x81, 0x01, 0x02, 0x06, 0xFF, 0x07, 0x01, 0x02, 0x05, 0xFF,
+    0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF,
+    0x01, 0x02, 0x05, 0xFF, 0x81, 0x00, 0x01, 0x05, 0xFF, 0x04, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x06, 0xFF, 0x00, 0x01,
+    0x05, 0xFF, 0x00, 0x00, 0x05, 0xFF, 0x80, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x05, 0xFF, 0x0F, 0x01, 0x01,
+    0x05, 0xFF, 0x01, 0x00, 0x05, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x01, 0x00, 0x04, 0xFF, 0x01, 0x00,
+    0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01,
+    0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x81, 0x00, 0x01, 0x04, 0xFF, 0x06, 0x01, 0x02, 0x04, 0xFF,
+    0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x02, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF,
+    0x82, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x80, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x01, 0x06, 0xFF, 0x80, 0x00, 0x01, 0x05,
+    0xFF, 0x02, 0x01, 0x01, 0x06, 0xFF, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x01, 0x07, 0xFF, 0x80, 0x01, 0x01, 0x07, 0xFF, 0x01, 0x01, 0x02, 0x07, 0xFF,
+    0x01, 0x01, 0x07, 0xFF, 0x80, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x01, 0x03, 0x09, 0xFF, 0x01, 0x03, 0x0A, 0xFF, 0x80, 0x01, 0x04, 0x0B, 0xFF, 0x07,
+    0x03, 0x05, 0x0C, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x03, 0x06, 0x0E, 0xFF, 0x03, 0x07, 0x10, 0xFF, 0x05, 0x07, 0x11, 0xFF, 0x05, 0x09, 0x12, 0xFF,
+    0x06, 0x09, 0x14, 0xFF, 0x06, 0x0A, 0x16, 0xFF, 0x80, 0x07, 0x0B, 0x17, 0xFF, 0x01, 0x08, 0x0C, 0x18, 0xFF, 0x08, 0x0B, 0x19, 0xFF, 0x80, 0x09,
+    0x0C, 0x19, 0xFF, 0x03, 0x0A, 0x0C, 0x19, 0xFF, 0x09, 0x0C, 0x1A, 0xFF, 0x09, 0x0B, 0x19, 0xFF, 0x09, 0x0C, 0x19, 0xFF, 0x80, 0x08, 0x0B, 0x19,
+    0xFF, 0x80, 0x08, 0x0B, 0x18, 0xFF, 0x01, 0x08, 0x0A, 0x18, 0xFF, 0x08, 0x0B, 0x17, 0xFF, 0x80, 0x08, 0x0B, 0x18, 0xFF, 0x07, 0x08, 0x0B, 0x17,
+    0xFF, 0x08, 0x0B, 0x18, 0xFF, 0x08, 0x0C, 0x18, 0xFF, 0x07, 0x0C, 0x18, 0xFF, 0x07, 0x0B, 0x19, 0xFF, 0x07, 0x0C, 0x18, 0xFF, 0x08, 0x0C, 0x17,
+    0xFF, 0x07, 0x0B, 0x16, 0xFF, 0x80, 0x06, 0x0A, 0x15, 0xFF, 0x0A, 0x06, 0x0A, 0x14, 0xFF, 0x06, 0x09, 0x13, 0xFF, 0x04, 0x08, 0x11, 0xFF, 0x04,
+    0x07, 0x10, 0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x03, 0x06, 0x0D, 0xFF, 0x02, 0x04, 0x0C, 0xFF, 0x01, 0x04, 0x0B, 0xFF, 0x01, 0x03, 0x0A, 0xFF, 0x01,
+    0x03, 0x09, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x80, 0x02, 0x02, 0x08, 0xFF, 0x06, 0x01, 0x02, 0x07, 0xFF, 0x02, 0x01, 0x06, 0xFF, 0x01, 0x02, 0x06,
+    0xFF, 0x01, 0x01, 0x06, 0xFF, 0x01, 0x00, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x00, 0x05, 0xFF, 0x80, 0x01, 0x00, 0x04, 0xFF, 0x04, 0x01,
+    0x00, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x05, 0xFF,
+    0x02, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x00, 0x01, 0x04, 0xFF, 0x81,
+    0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x04, 0xFF, 0x81, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF,
+    0x87, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00,
+    0x01, 0x00, 0xFF, 0x06, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF,
+    0x01, 0x01, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x02, 0xFF, 0x04, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF,
+    0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x84, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x80, 0x01,
+    0x02, 0x06, 0xFF, 0x0F, 0x00, 0x03, 0x07, 0xFF, 0x01, 0x02, 0x08, 0xFF, 0x01, 0x03, 0x08, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x02, 0x04, 0x0A, 0xFF,
+    0x02, 0x05, 0x0B, 0xFF, 0x02, 0x05, 0x0C, 0xFF, 0x03, 0x06, 0x0D, 0xFF, 0x02, 0x06, 0x0C, 0xFF, 0x03, 0x07, 0x0D, 0xFF, 0x03, 0x06, 0x0D, 0xFF,
+    0x02, 0x07, 0x0D, 0xFF, 0x03, 0x07, 0x0D, 0xFF, 0x03, 0x06, 0x0D, 0xFF, 0x02, 0x06, 0x0D, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x80, 0x02, 0x06, 0x0C,
+    0xFF, 0x01, 0x02, 0x05, 0x0C, 0xFF, 0x02, 0x05, 0x0B, 0xFF, 0x80, 0x02, 0x05, 0x0C, 0xFF, 0x00, 0x03, 0x04, 0x0B, 0xFF, 0x80, 0x03, 0x05, 0x0B,
+    0xFF, 0x80, 0x03, 0x05, 0x0C, 0xFF, 0x0B, 0x03, 0x04, 0x0B, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x03, 0x04, 0x0C, 0xFF, 0x04, 0x06, 0x0C, 0xFF, 0x03,
+    0x06, 0x0C, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x04, 0x05, 0x0C, 0xFF, 0x04, 0x06, 0x0D, 0xFF, 0x03, 0x06, 0x0D, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x03,
+    0x06, 0x0C, 0xFF, 0x03, 0x06, 0x0D, 0xFF, 0x80, 0x03, 0x05, 0x0C, 0xFF, 0x03, 0x02, 0x05, 0x0C, 0xFF, 0x03, 0x05, 0x0B, 0xFF, 0x03, 0x05, 0x0C,
+    0xFF, 0x03, 0x04, 0x0B, 0xFF, 0x82, 0x02, 0x04, 0x0B, 0xFF, 0x05, 0x02, 0x04, 0x0A, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x02, 0x03, 0x0A, 0xFF, 0x01,
+    0x03, 0x09, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x01, 0x02, 0x09, 0xFF, 0x80, 0x01, 0x03, 0x09, 0xFF, 0x02, 0x01, 0x02, 0x08, 0xFF, 0x01, 0x02, 0x09,
+    0xFF, 0x01, 0x03, 0x0A, 0xFF, 0x81, 0x01, 0x02, 0x09, 0xFF, 0x00, 0x02, 0x02, 0x0A, 0xFF, 0x80, 0x02, 0x03, 0x0A, 0xFF, 0x04, 0x02, 0x03, 0x0B,
+    0xFF, 0x03, 0x03, 0x0B, 0xFF, 0x03, 0x04, 0x0B, 0xFF, 0x03, 0x04, 0x0C, 0xFF, 0x02, 0x04, 0x0C, 0xFF, 0x80, 0x03, 0x05, 0x0D, 0xFF, 0x00, 0x03,
+    0x05, 0x0E, 0xFF, 0x81, 0x04, 0x06, 0x0E, 0xFF, 0x08, 0x04, 0x07, 0x0F, 0xFF, 0x03, 0x07, 0x0F, 0xFF, 0x04, 0x07, 0x0F, 0xFF, 0x04, 0x06, 0x0E,
+    0xFF, 0x04, 0x07, 0x0E, 0xFF, 0x05, 0x07, 0x0F, 0xFF, 0x04, 0x07, 0x0F, 0xFF, 0x04, 0x06, 0x0E, 0xFF, 0x04, 0x07, 0x0E, 0xFF, 0x80, 0x04, 0x06,
+    0x0E, 0xFF, 0x00, 0x03, 0x06, 0x0D, 0xFF, 0x80, 0x03, 0x05, 0x0D, 0xFF, 0x00, 0x03, 0x04, 0x0C, 0xFF, 0x81, 0x03, 0x04, 0x0B, 0xFF, 0x00, 0x03,
+    0x03, 0x0A, 0xFF, 0x80, 0x02, 0x03, 0x09, 0xFF, 0x02, 0x02, 0x03, 0x08, 0xFF, 0x02, 0x03, 0x07, 0xFF, 0x02, 0x02, 0x07, 0xFF, 0x80, 0x01, 0x02,
+    0x07, 0xFF, 0x00, 0x02, 0x02, 0x07, 0xFF, 0x80, 0x01, 0x02, 0x06, 0xFF, 0x00, 0x01, 0x02, 0x05, 0xFF, 0x80, 0x00, 0x02, 0x06, 0xFF, 0x00, 0x00,
+    0x01, 0x05, 0xFF, 0x80, 0x00, 0x01, 0x06, 0xFF, 0x02, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x06, 0xFF, 0x80, 0x01, 0x01,
+    0x05, 0xFF, 0x01, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x06, 0xFF, 0x87, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x83, 0x00, 0x01,
+    0x05, 0xFF, 0x01, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x81, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x01, 0x05, 0xFF, 0x86, 0x00, 0x01,
+    0x04, 0xFF, 0x81, 0x00, 0x01, 0x05, 0xFF, 0x80, 0x00, 0x01, 0x06, 0xFF, 0x80, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01,
+    0x05, 0xFF, 0x80, 0x00, 0x01, 0x06, 0xFF, 0x01, 0x00, 0x00, 0x06, 0xFF, 0x01, 0x01, 0x07, 0xFF, 0x80, 0x01, 0x01, 0x06, 0xFF, 0x01, 0x00, 0x01,
+    0x07, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x80, 0x01, 0x01, 0x07, 0xFF, 0x00, 0x01, 0x02, 0x08, 0xFF, 0x80, 0x01, 0x03, 0x09, 0xFF, 0x0F, 0x01, 0x03,
+    0x0A, 0xFF, 0x01, 0x03, 0x0B, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x02, 0x04, 0x0C, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x03, 0x05, 0x0E, 0xFF, 0x04, 0x07,
+    0x10, 0xFF, 0x04, 0x08, 0x12, 0xFF, 0x05, 0x09, 0x13, 0xFF, 0x06, 0x09, 0x15, 0xFF, 0x08, 0x0A, 0x17, 0xFF, 0x07, 0x0C, 0x18, 0xFF, 0x08, 0x0D,
+    0x1A, 0xFF, 0x09, 0x0D, 0x1B, 0xFF, 0x0A, 0x0E, 0x1B, 0xFF, 0x0A, 0x0F, 0x1D, 0xFF, 0x80, 0x0A, 0x0E, 0x1D, 0xFF, 0x01, 0x0B, 0x0F, 0x1D, 0xFF,
+    0x0A, 0x0E, 0x1E, 0xFF, 0x80, 0x0A, 0x0E, 0x1D, 0xFF, 0x0B, 0x09, 0x0D, 0x1C, 0xFF, 0x0A, 0x0D, 0x1B, 0xFF, 0x09, 0x0D, 0x1B, 0xFF, 0x09, 0x0C,
+    0x1B, 0xFF, 0x08, 0x0C, 0x1A, 0xFF, 0x09, 0x0C, 0x1A, 0xFF, 0x09, 0x0D, 0x1B, 0xFF, 0x08, 0x0E, 0x1B, 0xFF, 0x09, 0x0E, 0x1C, 0xFF, 0x0A, 0x0E,
+    0x1C, 0xFF, 0x09, 0x0E, 0x1C, 0xFF, 0x0A, 0x0E, 0x1C, 0xFF, 0x80, 0x09, 0x0E, 0x1C, 0xFF, 0x09, 0x09, 0x0E, 0x1B, 0xFF, 0x08, 0x0E, 0x1A, 0xFF,
+    0x09, 0x0D, 0x1A, 0xFF, 0x08, 0x0C, 0x19, 0xFF, 0x07, 0x0B, 0x18, 0xFF, 0x07, 0x0A, 0x16, 0xFF, 0x06, 0x09, 0x14, 0xFF, 0x05, 0x08, 0x12, 0xFF,
+    0x04, 0x08, 0x10, 0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x80, 0x02, 0x05, 0x0D, 0xFF, 0x04, 0x02, 0x04, 0x0B, 0xFF, 0x01, 0x04, 0x0A, 0xFF, 0x01, 0x03,
+    0x0A, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x82, 0x01, 0x02, 0x07, 0xFF, 0x00, 0x01, 0x02, 0x06, 0xFF, 0x80, 0x01, 0x01, 0x06,
+    0xFF, 0x00, 0x01, 0x01, 0x05, 0xFF, 0x83, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x00, 0x01, 0x06, 0xFF, 0x84, 0x00, 0x01, 0x05, 0xFF, 0x02, 0x00, 0x01,
+    0x04, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x05, 0xFF, 0x07, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF,
+    0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x01, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF,
+    0x85, 0x00, 0x00, 0x01, 0xFF, 0x04, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01,
+    0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x04, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF,
+    0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x0D, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01,
+    0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x80, 0x01, 0x01, 0x04, 0xFF, 0x02,
+    0x02, 0x02, 0x04, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x80, 0x01, 0x01, 0x05, 0xFF, 0x09, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x03,
+    0x07, 0xFF, 0x01, 0x03, 0x08, 0xFF, 0x01, 0x03, 0x09, 0xFF, 0x01, 0x04, 0x0A, 0xFF, 0x02, 0x05, 0x0B, 0xFF, 0x02, 0x05, 0x0C, 0xFF, 0x02, 0x06,
+    0x0D, 0xFF, 0x03, 0x07, 0x0F, 0xFF, 0x03, 0x08, 0x0F, 0xFF, 0x80, 0x04, 0x08, 0x0F, 0xFF, 0x07, 0x04, 0x08, 0x10, 0xFF, 0x03, 0x08, 0x0F, 0xFF,
+    0x04, 0x08, 0x0F, 0xFF, 0x03, 0x07, 0x0F, 0xFF, 0x03, 0x06, 0x0E, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x03, 0x06, 0x0D, 0xFF, 0x02, 0x06, 0x0D, 0xFF,
+    0x80, 0x03, 0x05, 0x0C, 0xFF, 0x00, 0x03, 0x06, 0x0C, 0xFF, 0x80, 0x03, 0x05, 0x0C, 0xFF, 0x00, 0x02, 0x05, 0x0D, 0xFF, 0x81, 0x03, 0x05, 0x0D,
+    0xFF, 0x04, 0x03, 0x06, 0x0D, 0xFF, 0x03, 0x06, 0x0E, 0xFF, 0x03, 0x05, 0x0E, 0xFF, 0x04, 0x06, 0x0E, 0xFF, 0x03, 0x06, 0x0E, 0xFF, 0x84, 0x04,
+    0x06, 0x0E, 0xFF, 0x04, 0x03, 0x06, 0x0E, 0xFF, 0x04, 0x06, 0x0E, 0xFF, 0x03, 0x06, 0x0E, 0xFF, 0x03, 0x05, 0x0E, 0xFF, 0x03, 0x06, 0x0D, 0xFF,
+    0x80, 0x03, 0x05, 0x0D, 0xFF, 0x80, 0x03, 0x05, 0x0C, 0xFF, 0x03, 0x02, 0x04, 0x0B, 0xFF, 0x03, 0x05, 0x0B, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x02,
+    0x03, 0x0A, 0xFF, 0x80, 0x02, 0x04, 0x0A, 0xFF, 0x05, 0x02, 0x03, 0x0A, 0xFF, 0x01, 0x03, 0x0A, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x01, 0x02, 0x09,
+    0xFF, 0x01, 0x03, 0x09, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x81, 0x02, 0x02, 0x09, 0xFF, 0x00, 0x02, 0x02, 0x0A, 0xFF, 0x81, 0x02, 0x03, 0x0B, 0xFF,
+    0x02, 0x02, 0x04, 0x0C, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x03, 0x04, 0x0C, 0xFF, 0x81, 0x03, 0x05, 0x0D, 0xFF, 0x00, 0x04, 0x06, 0x0E, 0xFF, 0x81,
+    0x04, 0x07, 0x0F, 0xFF, 0x09, 0x05, 0x07, 0x10, 0xFF, 0x04, 0x08, 0x10, 0xFF, 0x05, 0x07, 0x10, 0xFF, 0x05, 0x08, 0x10, 0xFF, 0x04, 0x08, 0x10,
+    0xFF, 0x05, 0x08, 0x10, 0xFF, 0x05, 0x07, 0x10, 0xFF, 0x04, 0x07, 0x10, 0xFF, 0x04, 0x08, 0x10, 0xFF, 0x04, 0x07, 0x10, 0xFF, 0x81, 0x04, 0x07,
+    0x0F, 0xFF, 0x02, 0x04, 0x06, 0x0E, 0xFF, 0x04, 0x05, 0x0E, 0xFF, 0x04, 0x05, 0x0D, 0xFF, 0x80, 0x03, 0x05, 0x0C, 0xFF, 0x80, 0x03, 0x04, 0x0B,
+    0xFF, 0x00, 0x03, 0x03, 0x09, 0xFF, 0x80, 0x02, 0x03, 0x09, 0xFF, 0x80, 0x02, 0x03, 0x08, 0xFF, 0x03, 0x02, 0x02, 0x07, 0xFF, 0x02, 0x02, 0x06,
+    0xFF, 0x01, 0x02, 0x06, 0xFF, 0x02, 0x02, 0x06, 0xFF, 0x80, 0x01, 0x02, 0x06, 0xFF, 0x00, 0x02, 0x03, 0x06, 0xFF, 0x80, 0x01, 0x02, 0x06, 0xFF,
+    0x00, 0x00, 0x02, 0x05, 0xFF, 0x80, 0x01, 0x01, 0x05, 0xFF, 0x02, 0x00, 0x02, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x81,
+    0x00, 0x01, 0x05, 0xFF, 0x02, 0x00, 0x01, 0x06, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x84, 0x00, 0x01, 0x05, 0xFF, 0x04, 0x01,
+    0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x01, 0x01, 0x04, 0xFF,
+    0x80, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x01, 0x05, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x01, 0x05, 0xFF, 0x83, 0x00, 0x01, 0x04,
+    0xFF, 0x83, 0x00, 0x01, 0x05, 0xFF, 0x80, 0x00, 0x01, 0x06, 0xFF, 0x00, 0x01, 0x01, 0x06, 0xFF, 0x82, 0x00, 0x01, 0x06, 0xFF, 0x03, 0x01, 0x01,
+    0x06, 0xFF, 0x01, 0x01, 0x07, 0xFF, 0x00, 0x01, 0x07, 0xFF, 0x00, 0x02, 0x08, 0xFF, 0x80, 0x01, 0x02, 0x07, 0xFF, 0x03, 0x01, 0x02, 0x08, 0xFF,
+    0x01, 0x01, 0x07, 0xFF, 0x01, 0x02, 0x08, 0xFF, 0x00, 0x03, 0x08, 0xFF, 0x80, 0x01, 0x03, 0x09, 0xFF, 0x0E, 0x01, 0x03, 0x0A, 0xFF, 0x02, 0x04,
+    0x0B, 0xFF, 0x02, 0x04, 0x0C, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x03, 0x06, 0x0F, 0xFF, 0x03, 0x07, 0x10, 0xFF, 0x05, 0x07, 0x11, 0xFF, 0x05, 0x09,
+    0x13, 0xFF, 0x06, 0x0A, 0x15, 0xFF, 0x07, 0x0B, 0x18, 0xFF, 0x09, 0x0C, 0x19, 0xFF, 0x08, 0x0E, 0x1C, 0xFF, 0x09, 0x0E, 0x1D, 0xFF, 0x0A, 0x0F,
+    0x1D, 0xFF, 0x0B, 0x10, 0x1E, 0xFF, 0x80, 0x0B, 0x11, 0x20, 0xFF, 0x80, 0x0C, 0x11, 0x20, 0xFF, 0x01, 0x0C, 0x11, 0x21, 0xFF, 0x0B, 0x10, 0x21,
+    0xFF, 0x80, 0x0B, 0x10, 0x1F, 0xFF, 0x07, 0x0B, 0x0F, 0x1E, 0xFF, 0x0A, 0x0E, 0x1D, 0xFF, 0x0A, 0x0E, 0x1C, 0xFF, 0x09, 0x0E, 0x1C, 0xFF, 0x0A,
+    0x0E, 0x1C, 0xFF, 0x0A, 0x0D, 0x1C, 0xFF, 0x09, 0x0F, 0x1D, 0xFF, 0x0A, 0x0F, 0x1E, 0xFF, 0x80, 0x0A, 0x10, 0x1F, 0xFF, 0x00, 0x0B, 0x12, 0x20,
+    0xFF, 0x80, 0x0B, 0x11, 0x1F, 0xFF, 0x12, 0x0A, 0x10, 0x1F, 0xFF, 0x0A, 0x10, 0x1E, 0xFF, 0x0B, 0x10, 0x1E, 0xFF, 0x0A, 0x0F, 0x1D, 0xFF, 0x09,
+    0x0D, 0x1C, 0xFF, 0x08, 0x0C, 0x19, 0xFF, 0x07, 0x0B, 0x17, 0xFF, 0x06, 0x0A, 0x15, 0xFF, 0x06, 0x08, 0x13, 0xFF, 0x04, 0x07, 0x11, 0xFF, 0x02,
+    0x06, 0x0F, 0xFF, 0x03, 0x06, 0x0E, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x01, 0x04, 0x0A, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x02,
+    0x03, 0x08, 0xFF, 0x01, 0x03, 0x08, 0xFF, 0x02, 0x03, 0x07, 0xFF, 0x80, 0x01, 0x02, 0x07, 0xFF, 0x05, 0x02, 0x03, 0x07, 0xFF, 0x01, 0x02, 0x07,
+    0xFF, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x01, 0x07, 0xFF, 0x00, 0x02, 0x07, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x82, 0x00, 0x01, 0x05, 0xFF, 0x04, 0x00,
+    0x01, 0x06, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x02, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x06, 0xFF, 0x82, 0x00, 0x01, 0x05, 0xFF,
+    0x04, 0x00, 0x00, 0x05, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x05, 0xFF, 0x80, 0x00, 0x01,
+    0x05, 0xFF, 0x03, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF,
+    0x03, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x04, 0x00,
+    0x01, 0x01, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0x01, 0xFF,
+    0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF,
+    0x81, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x81, 0x00, 0x01, 0x02, 0xFF, 0x01, 0x00, 0x00, 0x02, 0xFF,
+    0x01, 0x01, 0x03, 0xFF, 0x82, 0x01, 0x01, 0x04, 0xFF, 0x06, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01,
+    0x05, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x00, 0x01, 0x06, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x80, 0x01, 0x04, 0x09, 0xFF, 0x08, 0x01, 0x05, 0x0A, 0xFF,
+    0x02, 0x06, 0x0D, 0xFF, 0x02, 0x06, 0x0E, 0xFF, 0x03, 0x07, 0x0E, 0xFF, 0x04, 0x08, 0x11, 0xFF, 0x03, 0x09, 0x14, 0xFF, 0x05, 0x0B, 0x14, 0xFF,
+    0x05, 0x0A, 0x14, 0xFF, 0x04, 0x0A, 0x13, 0xFF, 0x80, 0x04, 0x09, 0x11, 0xFF, 0x05, 0x04, 0x07, 0x0F, 0xFF, 0x04, 0x07, 0x0E, 0xFF, 0x03, 0x07,
+    0x0D, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x04, 0x05, 0x0E, 0xFF, 0x03, 0x06, 0x0D, 0xFF, 0x80, 0x03, 0x06, 0x0E, 0xFF, 0x02, 0x03, 0x05, 0x0D, 0xFF,
+    0x03, 0x06, 0x0D, 0xFF, 0x03, 0x06, 0x0E, 0xFF, 0x80, 0x04, 0x06, 0x0E, 0xFF, 0x01, 0x03, 0x06, 0x0E, 0xFF, 0x03, 0x06, 0x0F, 0xFF, 0x80, 0x04,
+    0x07, 0x0E, 0xFF, 0x80, 0x04, 0x06, 0x0F, 0xFF, 0x01, 0x04, 0x07, 0x0F, 0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x80, 0x05, 0x07, 0x10, 0xFF, 0x03, 0x04,
+    0x07, 0x0F, 0xFF, 0x05, 0x07, 0x10, 0xFF, 0x05, 0x07, 0x0F, 0xFF, 0x04, 0x06, 0x10, 0xFF, 0x80, 0x04, 0x07, 0x0F, 0xFF, 0x09, 0x04, 0x06, 0x0F,
+    0xFF, 0x03, 0x06, 0x0E, 0xFF, 0x03, 0x05, 0x0E, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x03, 0x06, 0x0C, 0xFF, 0x03, 0x05, 0x0C,
+    0xFF, 0x03, 0x04, 0x0B, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x02, 0x03, 0x0A, 0xFF, 0x81, 0x02, 0x03, 0x09, 0xFF, 0x00, 0x02, 0x02, 0x09, 0xFF, 0x82,
+    0x02, 0x03, 0x09, 0xFF, 0x01, 0x02, 0x04, 0x0A, 0xFF, 0x01, 0x03, 0x0A, 0xFF, 0x80, 0x02, 0x03, 0x0A, 0xFF, 0x00, 0x02, 0x04, 0x0A, 0xFF, 0x80,
+    0x02, 0x04, 0x0B, 0xFF, 0x03, 0x02, 0x04, 0x0C, 0xFF, 0x02, 0x05, 0x0D, 0xFF, 0x03, 0x06, 0x0E, 0xFF, 0x04, 0x06, 0x0E, 0xFF, 0x80, 0x04, 0x07,
+    0x0F, 0xFF, 0x80, 0x04, 0x08, 0x11, 0xFF, 0x02, 0x05, 0x08, 0x12, 0xFF, 0x05, 0x09, 0x12, 0xFF, 0x06, 0x09, 0x11, 0xFF, 0x80, 0x06, 0x09, 0x12,
+    0xFF, 0x00, 0x07, 0x09, 0x13, 0xFF, 0x80, 0x06, 0x09, 0x13, 0xFF, 0x80, 0x07, 0x08, 0x12, 0xFF, 0x06, 0x06, 0x08, 0x12, 0xFF, 0x06, 0x08, 0x11,
+    0xFF, 0x06, 0x08, 0x10, 0xFF, 0x05, 0x08, 0x11, 0xFF, 0x04, 0x06, 0x10, 0xFF, 0x04, 0x07, 0x0F, 0xFF, 0x04, 0x06, 0x0E, 0xFF, 0x80, 0x03, 0x05,
+    0x0D, 0xFF, 0x04, 0x03, 0x04, 0x0C, 0xFF, 0x03, 0x04, 0x0B, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x03, 0x03, 0x0A, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x81,
+    0x02, 0x03, 0x08, 0xFF, 0x00, 0x01, 0x02, 0x07, 0xFF, 0x84, 0x01, 0x02, 0x06, 0xFF, 0x83, 0x01, 0x02, 0x05, 0xFF, 0x03, 0x00, 0x01, 0x04, 0xFF,
+    0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x01, 0x01, 0x05, 0xFF, 0x02, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x01,
+    0x05, 0xFF, 0x00, 0x01, 0x06, 0xFF, 0x81, 0x01, 0x01, 0x05, 0xFF, 0x03, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF,
+    0x01, 0x01, 0x05, 0xFF, 0x80, 0x01, 0x01, 0x04, 0xFF, 0x04, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01,
+    0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x81, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x01, 0x05, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x82, 0x00, 0x01,
+    0x05, 0xFF, 0x00, 0x00, 0x01, 0x06, 0xFF, 0x82, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x00, 0x01, 0x06, 0xFF, 0x80, 0x01, 0x01, 0x05, 0xFF, 0x04, 0x01,
+    0x01, 0x06, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x06, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x00, 0x02, 0x07, 0xFF, 0x83, 0x01, 0x02, 0x07, 0xFF,
+    0x01, 0x01, 0x02, 0x08, 0xFF, 0x01, 0x02, 0x09, 0xFF, 0x81, 0x01, 0x03, 0x09, 0xFF, 0x10, 0x01, 0x03, 0x0B, 0xFF, 0x02, 0x03, 0x0B, 0xFF, 0x02,
+    0x05, 0x0D, 0xFF, 0x02, 0x05, 0x0E, 0xFF, 0x04, 0x06, 0x10, 0xFF, 0x04, 0x07, 0x11, 0xFF, 0x05, 0x08, 0x13, 0xFF, 0x06, 0x0A, 0x15, 0xFF, 0x08,
+    0x0B, 0x17, 0xFF, 0x08, 0x0D, 0x1A, 0xFF, 0x09, 0x0D, 0x1B, 0xFF, 0x0B, 0x0F, 0x1E, 0xFF, 0x0B, 0x11, 0x1F, 0xFF, 0x0C, 0x12, 0x20, 0xFF, 0x0D,
+    0x13, 0x22, 0xFF, 0x0D, 0x13, 0x24, 0xFF, 0x0E, 0x14, 0x24, 0xFF, 0x80, 0x0D, 0x13, 0x25, 0xFF, 0x02, 0x0E, 0x14, 0x24, 0xFF, 0x0D, 0x13, 0x23,
+    0xFF, 0x0B, 0x12, 0x22, 0xFF, 0x80, 0x0B, 0x11, 0x20, 0xFF, 0x80, 0x0A, 0x10, 0x1E, 0xFF, 0x80, 0x0B, 0x10, 0x1E, 0xFF, 0x04, 0x0A, 0x0F, 0x1E,
+    0xFF, 0x0B, 0x10, 0x1F, 0xFF, 0x0B, 0x12, 0x20, 0xFF, 0x0C, 0x12, 0x21, 0xFF, 0x0C, 0x13, 0x22, 0xFF, 0x80, 0x0E, 0x14, 0x25, 0xFF, 0x11, 0x0E,
+    0x14, 0x24, 0xFF, 0x0D, 0x12, 0x22, 0xFF, 0x0D, 0x13, 0x22, 0xFF, 0x0C, 0x12, 0x22, 0xFF, 0x0C, 0x11, 0x21, 0xFF, 0x0B, 0x0F, 0x1F, 0xFF, 0x08,
+    0x0E, 0x1C, 0xFF, 0x07, 0x0C, 0x1A, 0xFF, 0x08, 0x0A, 0x17, 0xFF, 0x07, 0x09, 0x15, 0xFF, 0x04, 0x08, 0x13, 0xFF, 0x04, 0x07, 0x10, 0xFF, 0x03,
+    0x06, 0x0F, 0xFF, 0x03, 0x05, 0x0E, 0xFF, 0x02, 0x05, 0x0C, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x02, 0x03, 0x0A, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x80,
+    0x02, 0x03, 0x08, 0xFF, 0x80, 0x01, 0x02, 0x07, 0xFF, 0x83, 0x01, 0x02, 0x06, 0xFF, 0x02, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01,
+    0x02, 0x05, 0xFF, 0x82, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x00, 0x01, 0x04, 0xFF, 0x83, 0x00, 0x01, 0x05, 0xFF, 0x00,
+    0x01, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x01, 0x03, 0xFF, 0x82, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x04, 0xFF,
+    0x80, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x03, 0x00, 0x00, 0x01, 0xFF,
+    0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x81, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x02, 0x01,
+    0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x09, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x01,
+    0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x02, 0x01,
+    0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x81, 0x00, 0x01, 0x02, 0xFF, 0x01, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x80,
+    0x01, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x02, 0x04, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x80, 0x01, 0x01, 0x05, 0xFF, 0x08, 0x01, 0x02, 0x06, 0xFF, 0x00,
+    0x02, 0x06, 0xFF, 0x00, 0x01, 0x07, 0xFF, 0x01, 0x03, 0x08, 0xFF, 0x01, 0x04, 0x08, 0xFF, 0x01, 0x05, 0x0A, 0xFF, 0x02, 0x07, 0x0B, 0xFF, 0x03,
+    0x07, 0x0E, 0xFF, 0x02, 0x08, 0x10, 0xFF, 0x80, 0x04, 0x08, 0x10, 0xFF, 0x07, 0x05, 0x0A, 0x13, 0xFF, 0x08, 0x0D, 0x17, 0xFF, 0x08, 0x0D, 0x1A,
+    0xFF, 0x06, 0x0C, 0x18, 0xFF, 0x05, 0x0C, 0x14, 0xFF, 0x04, 0x0A, 0x12, 0xFF, 0x04, 0x09, 0x10, 0xFF, 0x04, 0x07, 0x0F, 0xFF, 0x80, 0x04, 0x08,
+    0x0F, 0xFF, 0x00, 0x04, 0x07, 0x0E, 0xFF, 0x80, 0x03, 0x06, 0x0F, 0xFF, 0x02, 0x04, 0x06, 0x10, 0xFF, 0x05, 0x06, 0x0F, 0xFF, 0x04, 0x06, 0x0F,
+    0xFF, 0x80, 0x04, 0x07, 0x11, 0xFF, 0x02, 0x04, 0x07, 0x10, 0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x04, 0x07, 0x11, 0xFF, 0x81, 0x04, 0x07, 0x10, 0xFF,
+    0x02, 0x04, 0x06, 0x11, 0xFF, 0x05, 0x07, 0x10, 0xFF, 0x06, 0x07, 0x10, 0xFF, 0x80, 0x05, 0x07, 0x11, 0xFF, 0x01, 0x05, 0x08, 0x11, 0xFF, 0x05,
+    0x08, 0x12, 0xFF, 0x80, 0x05, 0x08, 0x11, 0xFF, 0x06, 0x04, 0x07, 0x11, 0xFF, 0x05, 0x08, 0x10, 0xFF, 0x05, 0x07, 0x10, 0xFF, 0x04, 0x08, 0x10,
+    0xFF, 0x04, 0x07, 0x0F, 0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x04, 0x07, 0x0E, 0xFF, 0x80, 0x04, 0x06, 0x0D, 0xFF, 0x02, 0x03, 0x05, 0x0C, 0xFF, 0x03,
+    0x05, 0x0B, 0xFF, 0x03, 0x04, 0x0B, 0xFF, 0x80, 0x02, 0x04, 0x0A, 0xFF, 0x05, 0x02, 0x03, 0x09, 0xFF, 0x02, 0x03, 0x0A, 0xFF, 0x02, 0x03, 0x09,
+    0xFF, 0x01, 0x03, 0x09, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x01, 0x03, 0x09, 0xFF, 0x80, 0x02, 0x03, 0x09, 0xFF, 0x80, 0x02, 0x03, 0x0A, 0xFF, 0x23,
+    0x02, 0x03, 0x0B, 0xFF, 0x02, 0x05, 0x0C, 0xFF, 0x02, 0x04, 0x0C, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x03, 0x06, 0x0E, 0xFF, 0x04, 0x07, 0x0F, 0xFF,
+    0x05, 0x07, 0x10, 0xFF, 0x05, 0x08, 0x11, 0xFF, 0x06, 0x09, 0x12, 0xFF, 0x05, 0x09, 0x13, 0xFF, 0x05, 0x09, 0x14, 0xFF, 0x06, 0x0A, 0x14, 0xFF,
+    0x07, 0x0A, 0x14, 0xFF, 0x06, 0x0A, 0x14, 0xFF, 0x07, 0x0B, 0x15, 0xFF, 0x06, 0x0A, 0x15, 0xFF, 0x07, 0x0A, 0x15, 0xFF, 0x06, 0x0A, 0x16, 0xFF,
+    0x07, 0x0B, 0x16, 0xFF, 0x07, 0x0B, 0x15, 0xFF, 0x06, 0x0B, 0x15, 0xFF, 0x07, 0x0A, 0x15, 0xFF, 0x06, 0x09, 0x14, 0xFF, 0x06, 0x0A, 0x13, 0xFF,
+    0x06, 0x09, 0x13, 0xFF, 0x05, 0x08, 0x12, 0xFF, 0x05, 0x07, 0x11, 0xFF, 0x05, 0x07, 0x10, 0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x03, 0x06, 0x0E, 0xFF,
+    0x03, 0x05, 0x0E, 0xFF, 0x04, 0x05, 0x0C, 0xFF, 0x03, 0x04, 0x0B, 0xFF, 0x03, 0x05, 0x0B, 0xFF, 0x03, 0x04, 0x0A, 0xFF, 0x02, 0x03, 0x09, 0xFF,
+    0x81, 0x02, 0x03, 0x08, 0xFF, 0x80, 0x01, 0x03, 0x07, 0xFF, 0x07, 0x02, 0x02, 0x07, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x01,
+    0x03, 0x05, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x80, 0x01, 0x02, 0x05, 0xFF,
+    0x80, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x01, 0x01, 0x06, 0xFF, 0x01, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF,
+    0x81, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x00, 0x01, 0x06, 0xFF, 0x80, 0x00, 0x01, 0x05, 0xFF, 0x87, 0x01, 0x01, 0x05, 0xFF, 0x03, 0x00, 0x01, 0x05,
+    0xFF, 0x01, 0x01, 0x06, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x80, 0x00, 0x01, 0x05, 0xFF, 0x03, 0x00, 0x02, 0x05, 0xFF, 0x01,
+    0x01, 0x06, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x80, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x00, 0x01, 0x06, 0xFF, 0x84, 0x01, 0x01,
+    0x06, 0xFF, 0x00, 0x01, 0x01, 0x07, 0xFF, 0x81, 0x00, 0x01, 0x07, 0xFF, 0x80, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x02, 0x02, 0x07, 0xFF, 0x01, 0x02,
+    0x07, 0xFF, 0x80, 0x01, 0x02, 0x08, 0xFF, 0x00, 0x01, 0x03, 0x09, 0xFF, 0x80, 0x01, 0x03, 0x0A, 0xFF, 0x3A, 0x01, 0x03, 0x0B, 0xFF, 0x01, 0x04,
+    0x0C, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x02, 0x05, 0x0D, 0xFF, 0x03, 0x06, 0x0F, 0xFF, 0x04, 0x07, 0x11, 0xFF, 0x05, 0x08, 0x13, 0xFF, 0x06, 0x0A,
+    0x15, 0xFF, 0x07, 0x0B, 0x17, 0xFF, 0x08, 0x0D, 0x1B, 0xFF, 0x09, 0x0F, 0x1D, 0xFF, 0x0A, 0x10, 0x20, 0xFF, 0x0B, 0x12, 0x22, 0xFF, 0x0C, 0x13,
+    0x24, 0xFF, 0x0E, 0x14, 0x25, 0xFF, 0x0F, 0x16, 0x27, 0xFF, 0x10, 0x17, 0x29, 0xFF, 0x10, 0x18, 0x2B, 0xFF, 0x11, 0x19, 0x2B, 0xFF, 0x11, 0x18,
+    0x2B, 0xFF, 0x10, 0x17, 0x2A, 0xFF, 0x0E, 0x15, 0x28, 0xFF, 0x0E, 0x14, 0x25, 0xFF, 0x0D, 0x12, 0x23, 0xFF, 0x0C, 0x13, 0x22, 0xFF, 0x0C, 0x12,
+    0x22, 0xFF, 0x0C, 0x11, 0x20, 0xFF, 0x0C, 0x10, 0x21, 0xFF, 0x0C, 0x11, 0x21, 0xFF, 0x0C, 0x12, 0x21, 0xFF, 0x0C, 0x12, 0x23, 0xFF, 0x0C, 0x14,
+    0x23, 0xFF, 0x0D, 0x14, 0x25, 0xFF, 0x0F, 0x16, 0x27, 0xFF, 0x11, 0x17, 0x29, 0xFF, 0x12, 0x18, 0x2A, 0xFF, 0x11, 0x17, 0x29, 0xFF, 0x0E, 0x14,
+    0x24, 0xFF, 0x0E, 0x14, 0x25, 0xFF, 0x10, 0x15, 0x28, 0xFF, 0x0F, 0x14, 0x28, 0xFF, 0x0C, 0x12, 0x23, 0xFF, 0x0A, 0x10, 0x1F, 0xFF, 0x09, 0x0F,
+    0x1C, 0xFF, 0x08, 0x0B, 0x19, 0xFF, 0x07, 0x0A, 0x16, 0xFF, 0x05, 0x08, 0x14, 0xFF, 0x04, 0x07, 0x12, 0xFF, 0x03, 0x06, 0x10, 0xFF, 0x03, 0x06,
+    0x0D, 0xFF, 0x02, 0x04, 0x0D, 0xFF, 0x02, 0x04, 0x0C, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x02, 0x03, 0x0A, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x02, 0x03,
+    0x08, 0xFF, 0x01, 0x03, 0x08, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x81, 0x01, 0x02, 0x06, 0xFF, 0x00, 0x01, 0x02, 0x05, 0xFF,
+    0x80, 0x01, 0x02, 0x06, 0xFF, 0x02, 0x01, 0x03, 0x05, 0xFF, 0x02, 0x03, 0x05, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x80, 0x00, 0x02, 0x05, 0xFF, 0x06,
+    0x01, 0x01, 0x05, 0xFF, 0x00, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x00, 0x02, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF,
+    0x01, 0x01, 0x05, 0xFF, 0x81, 0x00, 0x01, 0x04, 0xFF, 0x04, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01,
+    0x04, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x81, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x02, 0x00, 0x00,
+    0x02, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x83, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0x00,
+    0xFF, 0x01, 0x01, 0x01, 0xFF, 0x83, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x01, 0x00,
+    0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x82, 0x00, 0x01, 0x02, 0xFF, 0x82, 0x01, 0x01, 0x04, 0xFF, 0x80,
+    0x01, 0x02, 0x04, 0xFF, 0x3E, 0x01, 0x01, 0x04, 0xFF, 0x02, 0x01, 0x05, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x00, 0x03, 0x06, 0xFF, 0x01, 0x03, 0x07,
+    0xFF, 0x01, 0x04, 0x09, 0xFF, 0x01, 0x04, 0x0B, 0xFF, 0x02, 0x07, 0x0E, 0xFF, 0x03, 0x08, 0x0E, 0xFF, 0x02, 0x06, 0x0A, 0xFF, 0x02, 0x04, 0x08,
+    0xFF, 0x04, 0x06, 0x09, 0xFF, 0x28, 0x2B, 0x2E, 0xFF, 0x28, 0x2B, 0x2D, 0xFF, 0x0A, 0x0E, 0x11, 0xFF, 0x05, 0x0A, 0x0F, 0xFF, 0x07, 0x0B, 0x13,
+    0xFF, 0x09, 0x0D, 0x17, 0xFF, 0x06, 0x0B, 0x14, 0xFF, 0x05, 0x09, 0x11, 0xFF, 0x04, 0x09, 0x12, 0xFF, 0x05, 0x08, 0x12, 0xFF, 0x05, 0x09, 0x11,
+    0xFF, 0x04, 0x08, 0x10, 0xFF, 0x05, 0x08, 0x10, 0xFF, 0x04, 0x07, 0x11, 0xFF, 0x05, 0x07, 0x11, 0xFF, 0x05, 0x07, 0x12, 0xFF, 0x05, 0x08, 0x11,
+    0xFF, 0x04, 0x07, 0x11, 0xFF, 0x04, 0x08, 0x12, 0xFF, 0x04, 0x07, 0x12, 0xFF, 0x05, 0x07, 0x11, 0xFF, 0x05, 0x07, 0x12, 0xFF, 0x05, 0x07, 0x13,
+    0xFF, 0x06, 0x07, 0x12, 0xFF, 0x06, 0x08, 0x12, 0xFF, 0x05, 0x08, 0x13, 0xFF, 0x06, 0x08, 0x13, 0xFF, 0x06, 0x08, 0x12, 0xFF, 0x05, 0x08, 0x13,
+    0xFF, 0x05, 0x09, 0x13, 0xFF, 0x06, 0x09, 0x13, 0xFF, 0x06, 0x0A, 0x13, 0xFF, 0x06, 0x09, 0x14, 0xFF, 0x06, 0x0A, 0x13, 0xFF, 0x06, 0x09, 0x13,
+    0xFF, 0x05, 0x09, 0x12, 0xFF, 0x06, 0x09, 0x12, 0xFF, 0x05, 0x08, 0x12, 0xFF, 0x05, 0x08, 0x11, 0xFF, 0x04, 0x08, 0x11, 0xFF, 0x04, 0x07, 0x10,
+    0xFF, 0x04, 0x07, 0x0F, 0xFF, 0x04, 0x07, 0x0E, 0xFF, 0x03, 0x06, 0x0E, 0xFF, 0x03, 0x04, 0x0D, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x02, 0x04, 0x0C,
+    0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x02, 0x03, 0x0B, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x80, 0x02, 0x03, 0x0A, 0xFF, 0x05, 0x02,
+    0x04, 0x0A, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x02, 0x03, 0x0B, 0xFF, 0x01, 0x04, 0x0C, 0xFF, 0x02, 0x04, 0x0C, 0xFF, 0x02, 0x04, 0x0D, 0xFF, 0x80,
+    0x02, 0x05, 0x0D, 0xFF, 0x0A, 0x03, 0x06, 0x0E, 0xFF, 0x04, 0x07, 0x10, 0xFF, 0x04, 0x07, 0x11, 0xFF, 0x05, 0x08, 0x12, 0xFF, 0x06, 0x09, 0x13,
+    0xFF, 0x07, 0x0B, 0x15, 0xFF, 0x06, 0x0B, 0x16, 0xFF, 0x07, 0x0B, 0x16, 0xFF, 0x08, 0x0B, 0x16, 0xFF, 0x08, 0x0C, 0x17, 0xFF, 0x07, 0x0C, 0x17,
+    0xFF, 0x80, 0x08, 0x0C, 0x17, 0xFF, 0x0F, 0x07, 0x0D, 0x18, 0xFF, 0x08, 0x0C, 0x19, 0xFF, 0x09, 0x0D, 0x17, 0xFF, 0x08, 0x0D, 0x18, 0xFF, 0x07,
+    0x0C, 0x18, 0xFF, 0x08, 0x0B, 0x17, 0xFF, 0x08, 0x0C, 0x16, 0xFF, 0x07, 0x0B, 0x16, 0xFF, 0x07, 0x0A, 0x15, 0xFF, 0x07, 0x09, 0x14, 0xFF, 0x07,
+    0x09, 0x13, 0xFF, 0x06, 0x09, 0x12, 0xFF, 0x05, 0x08, 0x11, 0xFF, 0x05, 0x07, 0x10, 0xFF, 0x04, 0x07, 0x0F, 0xFF, 0x04, 0x05, 0x0E, 0xFF, 0x80,
+    0x03, 0x05, 0x0C, 0xFF, 0x0F, 0x03, 0x04, 0x0B, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x01, 0x03, 0x08,
+    0xFF, 0x02, 0x03, 0x08, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x02, 0x03, 0x07, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x00, 0x02, 0x06,
+    0xFF, 0x01, 0x02, 0x07, 0xFF, 0x00, 0x02, 0x07, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x00, 0x02, 0x06, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x81, 0x01, 0x02,
+    0x07, 0xFF, 0x03, 0x01, 0x01, 0x06, 0xFF, 0x01, 0x01, 0x07, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x02, 0x01, 0x06, 0xFF, 0x80, 0x01, 0x01, 0x05, 0xFF,
+    0x01, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x83, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x00, 0x01, 0x06, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x80,
+    0x00, 0x02, 0x06, 0xFF, 0x01, 0x00, 0x01, 0x06, 0xFF, 0x00, 0x02, 0x05, 0xFF, 0x81, 0x00, 0x01, 0x06, 0xFF, 0x80, 0x00, 0x02, 0x06, 0xFF, 0x80,
+    0x00, 0x01, 0x06, 0xFF, 0x00, 0x00, 0x02, 0x06, 0xFF, 0x84, 0x00, 0x01, 0x06, 0xFF, 0x0A, 0x00, 0x01, 0x07, 0xFF, 0x00, 0x01, 0x06, 0xFF, 0x00,
+    0x02, 0x06, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x01, 0x07, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x01, 0x07, 0xFF, 0x01, 0x02, 0x08, 0xFF, 0x01,
+    0x01, 0x07, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x80, 0x01, 0x02, 0x08, 0xFF, 0x00, 0x01, 0x02, 0x09, 0xFF, 0x81, 0x01, 0x03,
+    0x09, 0xFF, 0x38, 0x01, 0x03, 0x0A, 0xFF, 0x01, 0x04, 0x0B, 0xFF, 0x02, 0x03, 0x0B, 0xFF, 0x02, 0x04, 0x0C, 0xFF, 0x02, 0x05, 0x0E, 0xFF, 0x03,
+    0x05, 0x0F, 0xFF, 0x04, 0x06, 0x10, 0xFF, 0x04, 0x07, 0x12, 0xFF, 0x05, 0x09, 0x14, 0xFF, 0x07, 0x0B, 0x17, 0xFF, 0x08, 0x0D, 0x1A, 0xFF, 0x0A,
+    0x0F, 0x1F, 0xFF, 0x0B, 0x12, 0x23, 0xFF, 0x0D, 0x14, 0x25, 0xFF, 0x0F, 0x15, 0x28, 0xFF, 0x10, 0x17, 0x2A, 0xFF, 0x11, 0x18, 0x2B, 0xFF, 0x13,
+    0x1B, 0x2F, 0xFF, 0x15, 0x1E, 0x33, 0xFF, 0x16, 0x20, 0x36, 0xFF, 0x18, 0x21, 0x37, 0xFF, 0x18, 0x20, 0x37, 0xFF, 0x17, 0x1E, 0x34, 0xFF, 0x14,
+    0x1B, 0x30, 0xFF, 0x12, 0x18, 0x2B, 0xFF, 0x11, 0x15, 0x27, 0xFF, 0x0E, 0x14, 0x24, 0xFF, 0x0D, 0x14, 0x24, 0xFF, 0x0D, 0x13, 0x23, 0xFF, 0x0D,
+    0x13, 0x24, 0xFF, 0x0E, 0x14, 0x24, 0xFF, 0x0E, 0x14, 0x25, 0xFF, 0x0D, 0x15, 0x26, 0xFF, 0x0E, 0x16, 0x27, 0xFF, 0x11, 0x18, 0x29, 0xFF, 0x14,
+    0x1B, 0x2E, 0xFF, 0x12, 0x19, 0x2C, 0xFF, 0x0B, 0x10, 0x22, 0xFF, 0x06, 0x0C, 0x1B, 0xFF, 0x0F, 0x13, 0x22, 0xFF, 0x08, 0x0E, 0x1C, 0xFF, 0x0A,
+    0x0F, 0x1D, 0xFF, 0x09, 0x0D, 0x1B, 0xFF, 0x0C, 0x10, 0x20, 0xFF, 0x0E, 0x14, 0x26, 0xFF, 0x0B, 0x11, 0x20, 0xFF, 0x09, 0x0E, 0x1B, 0xFF, 0x07,
+    0x0C, 0x18, 0xFF, 0x06, 0x0A, 0x14, 0xFF, 0x05, 0x09, 0x13, 0xFF, 0x04, 0x07, 0x11, 0xFF, 0x04, 0x05, 0x0E, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x02,
+    0x05, 0x0D, 0xFF, 0x02, 0x04, 0x0C, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x01, 0x03, 0x0A, 0xFF, 0x80, 0x01, 0x03, 0x09, 0xFF, 0x80, 0x01, 0x03, 0x08,
+    0xFF, 0x04, 0x01, 0x02, 0x08, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x00, 0x02, 0x06, 0xFF, 0x80, 0x01,
+    0x03, 0x06, 0xFF, 0x02, 0x00, 0x03, 0x06, 0xFF, 0x00, 0x02, 0x06, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x80, 0x01, 0x02, 0x05, 0xFF, 0x00, 0x01, 0x02,
+    0x06, 0xFF, 0x81, 0x00, 0x01, 0x05, 0xFF, 0x82, 0x00, 0x01, 0x06, 0xFF, 0x80, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x01, 0x05, 0xFF, 0x80, 0x00,
+    0x01, 0x04, 0xFF, 0x06, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF,
+    0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x81, 0x00, 0x01, 0x03, 0xFF, 0x80, 0x00, 0x01, 0x02, 0xFF, 0x82, 0x00, 0x01, 0x01, 0xFF, 0x00,
+    0x00, 0x01, 0x02, 0xFF, 0x07, 0x01, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01,
+    0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0x00, 0xFF, 0x00,
+    0x01, 0x02, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x04, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x03,
+    0xFF, 0x01, 0x02, 0x03, 0xFF, 0x80, 0x01, 0x01, 0x04, 0xFF, 0x80, 0x01, 0x02, 0x04, 0xFF, 0x01, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF,
+    0x80, 0x01, 0x02, 0x05, 0xFF, 0x1D, 0x01, 0x03, 0x07, 0xFF, 0x00, 0x04, 0x07, 0xFF, 0x01, 0x04, 0x0A, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x03, 0x06,
+    0x0E, 0xFF, 0x05, 0x08, 0x0E, 0xFF, 0x4D, 0x53, 0x5C, 0xFF, 0x77, 0x7D, 0x87, 0xFF, 0x85, 0x8B, 0x93, 0xFF, 0x93, 0x9B, 0xA2, 0xFF, 0x93, 0x9C,
+    0xA2, 0xFF, 0x8B, 0x93, 0x96, 0xFF, 0x81, 0x8A, 0x8B, 0xFF, 0x40, 0x46, 0x49, 0xFF, 0x02, 0x04, 0x07, 0xFF, 0x04, 0x07, 0x0D, 0xFF, 0x07, 0x0B,
+    0x13, 0xFF, 0x07, 0x0B, 0x15, 0xFF, 0x06, 0x0B, 0x15, 0xFF, 0x06, 0x0A, 0x14, 0xFF, 0x05, 0x0A, 0x13, 0xFF, 0x06, 0x09, 0x13, 0xFF, 0x06, 0x08,
+    0x13, 0xFF, 0x06, 0x0A, 0x14, 0xFF, 0x06, 0x09, 0x14, 0xFF, 0x05, 0x08, 0x14, 0xFF, 0x05, 0x09, 0x13, 0xFF, 0x06, 0x09, 0x13, 0xFF, 0x06, 0x08,
+    0x14, 0xFF, 0x05, 0x08, 0x13, 0xFF, 0x80, 0x06, 0x09, 0x14, 0xFF, 0x00, 0x06, 0x09, 0x13, 0xFF, 0x81, 0x06, 0x09, 0x14, 0xFF, 0x00, 0x07, 0x0A,
+    0x14, 0xFF, 0x80, 0x06, 0x0A, 0x14, 0xFF, 0x80, 0x07, 0x0A, 0x14, 0xFF, 0x04, 0x07, 0x0B, 0x15, 0xFF, 0x06, 0x0B, 0x15, 0xFF, 0x06, 0x0B, 0x14,
+    0xFF, 0x06, 0x0A, 0x15, 0xFF, 0x06, 0x0A, 0x14, 0xFF, 0x80, 0x06, 0x09, 0x14, 0xFF, 0x04, 0x06, 0x08, 0x13, 0xFF, 0x05, 0x08, 0x11, 0xFF, 0x05,
+    0x07, 0x11, 0xFF, 0x04, 0x07, 0x0F, 0xFF, 0x04, 0x06, 0x0E, 0xFF, 0x80, 0x03, 0x05, 0x0D, 0xFF, 0x01, 0x03, 0x04, 0x0C, 0xFF, 0x03, 0x04, 0x0B,
+    0xFF, 0x80, 0x02, 0x04, 0x0B, 0xFF, 0x00, 0x01, 0x03, 0x0B, 0xFF, 0x80, 0x02, 0x04, 0x0B, 0xFF, 0x11, 0x02, 0x04, 0x0C, 0xFF, 0x02, 0x04, 0x0B,
+    0xFF, 0x01, 0x04, 0x0C, 0xFF, 0x03, 0x04, 0x0C, 0xFF, 0x02, 0x04, 0x0C, 0xFF, 0x03, 0x04, 0x0C, 0xFF, 0x03, 0x06, 0x0D, 0xFF, 0x03, 0x06, 0x0E,
+    0xFF, 0x03, 0x06, 0x10, 0xFF, 0x05, 0x08, 0x11, 0xFF, 0x05, 0x08, 0x12, 0xFF, 0x06, 0x0A, 0x14, 0xFF, 0x07, 0x0B, 0x15, 0xFF, 0x07, 0x0B, 0x17,
+    0xFF, 0x08, 0x0C, 0x18, 0xFF, 0x08, 0x0C, 0x19, 0xFF, 0x08, 0x0D, 0x18, 0xFF, 0x09, 0x0D, 0x18, 0xFF, 0x80, 0x09, 0x0E, 0x1A, 0xFF, 0x00, 0x09,
+    0x0E, 0x1B, 0xFF, 0x82, 0x09, 0x0E, 0x1A, 0xFF, 0x11, 0x09, 0x0D, 0x1A, 0xFF, 0x09, 0x0E, 0x1A, 0xFF, 0x09, 0x0D, 0x1A, 0xFF, 0x08, 0x0D, 0x18,
+    0xFF, 0x08, 0x0C, 0x18, 0xFF, 0x08, 0x0B, 0x17, 0xFF, 0x08, 0x0B, 0x16, 0xFF, 0x07, 0x0A, 0x15, 0xFF, 0x06, 0x0A, 0x14, 0xFF, 0x06, 0x09, 0x12,
+    0xFF, 0x05, 0x08, 0x11, 0xFF, 0x04, 0x07, 0x0F, 0xFF, 0x03, 0x06, 0x0E, 0xFF, 0x03, 0x06, 0x0C, 0xFF, 0x03, 0x05, 0x0B, 0xFF, 0x02, 0x04, 0x0B,
+    0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x81, 0x01, 0x03, 0x08, 0xFF, 0x03, 0x02, 0x03, 0x08, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x01,
+    0x03, 0x06, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x80, 0x01, 0x02, 0x07, 0xFF, 0x82, 0x01, 0x02, 0x06, 0xFF, 0x03, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x02,
+    0x06, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x00, 0x02, 0x06, 0xFF, 0x81, 0x01, 0x02, 0x06, 0xFF, 0x03, 0x00, 0x02, 0x06, 0xFF, 0x00, 0x02, 0x07, 0xFF,
+    0x01, 0x01, 0x06, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x80, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x02, 0x06, 0xFF, 0x80, 0x01, 0x01, 0x05, 0xFF, 0x81,
+    0x01, 0x02, 0x05, 0xFF, 0x80, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x80, 0x00, 0x01, 0x05, 0xFF, 0x05,
+    0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x00, 0x02, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF,
+    0x80, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x80, 0x01, 0x02, 0x07, 0xFF, 0x05, 0x01, 0x01, 0x07, 0xFF,
+    0x01, 0x02, 0x07, 0xFF, 0x01, 0x02, 0x08, 0xFF, 0x00, 0x01, 0x07, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x02, 0x08, 0xFF, 0x80, 0x01, 0x02, 0x07,
+    0xFF, 0x03, 0x01, 0x02, 0x08, 0xFF, 0x00, 0x02, 0x09, 0xFF, 0x01, 0x03, 0x09, 0xFF, 0x01, 0x02, 0x09, 0xFF, 0x81, 0x01, 0x03, 0x0A, 0xFF, 0x13,
+    0x02, 0x03, 0x0A, 0xFF, 0x01, 0x03, 0x0B, 0xFF, 0x02, 0x04, 0x0C, 0xFF, 0x02, 0x04, 0x0D, 0xFF, 0x03, 0x05, 0x0F, 0xFF, 0x03, 0x06, 0x0F, 0xFF,
+    0x04, 0x07, 0x11, 0xFF, 0x05, 0x08, 0x13, 0xFF, 0x06, 0x0A, 0x16, 0xFF, 0x08, 0x0D, 0x1A, 0xFF, 0x09, 0x0F, 0x1F, 0xFF, 0x0C, 0x12, 0x24, 0xFF,
+    0x0F, 0x16, 0x29, 0xFF, 0x0D, 0x13, 0x26, 0xFF, 0x05, 0x09, 0x16, 0xFF, 0x05, 0x08, 0x15, 0xFF, 0x04, 0x08, 0x16, 0xFF, 0x06, 0x0A, 0x19, 0xFF,
+    0x09, 0x0D, 0x1E, 0xFF, 0x0C, 0x11, 0x21, 0xFF, 0x80, 0x0C, 0x12, 0x22, 0xFF, 0x23, 0x0C, 0x10, 0x1F, 0xFF, 0x09, 0x0D, 0x1A, 0xFF, 0x07, 0x0B,
+    0x17, 0xFF, 0x06, 0x08, 0x14, 0xFF, 0x05, 0x0A, 0x16, 0xFF, 0x0B, 0x11, 0x20, 0xFF, 0x0F, 0x15, 0x26, 0xFF, 0x0F, 0x15, 0x25, 0xFF, 0x0E, 0x15,
+    0x26, 0xFF, 0x0E, 0x16, 0x27, 0xFF, 0x10, 0x17, 0x29, 0xFF, 0x12, 0x19, 0x2C, 0xFF, 0x15, 0x1D, 0x30, 0xFF, 0x0D, 0x14, 0x24, 0xFF, 0x23, 0x28,
+    0x37, 0xFF, 0x6B, 0x73, 0x7F, 0xFF, 0x85, 0x8A, 0x95, 0xFF, 0x93, 0x97, 0x9F, 0xFF, 0x97, 0x9B, 0xA2, 0xFF, 0x8D, 0x93, 0x9A, 0xFF, 0x6D, 0x73,
+    0x7D, 0xFF, 0x39, 0x3D, 0x4A, 0xFF, 0x08, 0x0B, 0x1A, 0xFF, 0x0D, 0x12, 0x23, 0xFF, 0x0B, 0x10, 0x20, 0xFF, 0x09, 0x0D, 0x1B, 0xFF, 0x07, 0x0B,
+    0x16, 0xFF, 0x06, 0x09, 0x13, 0xFF, 0x04, 0x07, 0x11, 0xFF, 0x03, 0x06, 0x0F, 0xFF, 0x03, 0x06, 0x0E, 0xFF, 0x03, 0x06, 0x0C, 0xFF, 0x03, 0x05,
+    0x0D, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x02, 0x03, 0x0A, 0xFF, 0x01, 0x03, 0x09, 0xFF, 0x81, 0x01, 0x03, 0x08, 0xFF, 0x80, 0x01, 0x03, 0x07, 0xFF,
+    0x80, 0x01, 0x02, 0x06, 0xFF, 0x12, 0x00, 0x03, 0x07, 0xFF, 0x01, 0x03, 0x05, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x00, 0x02, 0x05, 0xFF, 0x00, 0x03,
+    0x06, 0xFF, 0x00, 0x02, 0x06, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x00, 0x03, 0x07, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x01, 0x02,
+    0x06, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x06, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01,
+    0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x81, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x01, 0x05, 0xFF, 0x80, 0x01, 0x01, 0x04,
+    0xFF, 0x81, 0x00, 0x01, 0x04, 0xFF, 0x03, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x02, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x80,
+    0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x06, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x81,
+    0x00, 0x00, 0x00, 0xFF, 0x81, 0x00, 0x01, 0x01, 0xFF, 0x05, 0x01, 0x02, 0x02, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01,
+    0x03, 0xFF, 0x01, 0x01, 0x03, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x80, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x01, 0x01, 0x04,
+    0xFF, 0x80, 0x01, 0x02, 0x06, 0xFF, 0x16, 0x02, 0x03, 0x06, 0xFF, 0x02, 0x04, 0x07, 0xFF, 0x00, 0x05, 0x09, 0xFF, 0x02, 0x06, 0x0B, 0xFF, 0x02,
+    0x05, 0x0A, 0xFF, 0x09, 0x0D, 0x12, 0xFF, 0x4D, 0x51, 0x5C, 0xFF, 0x6D, 0x75, 0x81, 0xFF, 0x71, 0x79, 0x84, 0xFF, 0x75, 0x7A, 0x83, 0xFF, 0x78,
+    0x7E, 0x87, 0xFF, 0x7B, 0x83, 0x8C, 0xFF, 0x91, 0x99, 0x9F, 0xFF, 0x9F, 0xA8, 0xAF, 0xFF, 0xAD, 0xB6, 0xBB, 0xFF, 0x84, 0x8A, 0x8D, 0xFF, 0x23,
+    0x24, 0x2E, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x06, 0x09, 0x10, 0xFF, 0x08, 0x0C, 0x18, 0xFF, 0x06, 0x0C, 0x17, 0xFF, 0x06, 0x0B, 0x17, 0xFF, 0x07,
+    0x0B, 0x17, 0xFF, 0x80, 0x07, 0x0B, 0x16, 0xFF, 0x82, 0x07, 0x0A, 0x16, 0xFF, 0x02, 0x07, 0x09, 0x16, 0xFF, 0x06, 0x09, 0x16, 0xFF, 0x08, 0x0B,
+    0x15, 0xFF, 0x80, 0x06, 0x0B, 0x15, 0xFF, 0x05, 0x06, 0x0C, 0x15, 0xFF, 0x07, 0x0C, 0x15, 0xFF, 0x07, 0x0B, 0x16, 0xFF, 0x08, 0x0C, 0x16, 0xFF,
+    0x07, 0x0D, 0x16, 0xFF, 0x08, 0x0C, 0x15, 0xFF, 0x80, 0x07, 0x0C, 0x16, 0xFF, 0x12, 0x07, 0x0C, 0x15, 0xFF, 0x07, 0x0C, 0x16, 0xFF, 0x08, 0x0C,
+    0x16, 0xFF, 0x07, 0x0D, 0x18, 0xFF, 0x07, 0x0C, 0x18, 0xFF, 0x07, 0x0D, 0x18, 0xFF, 0x07, 0x0C, 0x17, 0xFF, 0x07, 0x0A, 0x15, 0xFF, 0x06, 0x0A,
+    0x14, 0xFF, 0x05, 0x09, 0x13, 0xFF, 0x05, 0x07, 0x11, 0xFF, 0x05, 0x06, 0x10, 0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x04, 0x06, 0x0E, 0xFF, 0x03, 0x05,
+    0x0E, 0xFF, 0x03, 0x04, 0x0C, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x02, 0x03, 0x0C, 0xFF, 0x03, 0x03, 0x0B, 0xFF, 0x80, 0x02, 0x04, 0x0B, 0xFF, 0x00,
+    0x02, 0x03, 0x0B, 0xFF, 0x80, 0x02, 0x04, 0x0C, 0xFF, 0x00, 0x03, 0x04, 0x0C, 0xFF, 0x80, 0x03, 0x05, 0x0D, 0xFF, 0x06, 0x03, 0x06, 0x0F, 0xFF,
+    0x04, 0x06, 0x10, 0xFF, 0x04, 0x07, 0x11, 0xFF, 0x05, 0x08, 0x13, 0xFF, 0x06, 0x0A, 0x15, 0xFF, 0x07, 0x0B, 0x17, 0xFF, 0x08, 0x0C, 0x18, 0xFF,
+    0x80, 0x09, 0x0E, 0x1A, 0xFF, 0x01, 0x0A, 0x0F, 0x1C, 0xFF, 0x09, 0x0F, 0x1C, 0xFF, 0x80, 0x0B, 0x10, 0x1C, 0xFF, 0x03, 0x0B, 0x10, 0x1D, 0xFF,
+    0x0A, 0x10, 0x1E, 0xFF, 0x0B, 0x10, 0x1D, 0xFF, 0x0C, 0x10, 0x1D, 0xFF, 0x81, 0x0B, 0x10, 0x1D, 0xFF, 0x02, 0x0B, 0x0F, 0x1C, 0xFF, 0x0B, 0x0E,
+    0x1B, 0xFF, 0x0A, 0x0E, 0x1B, 0xFF, 0x80, 0x09, 0x0E, 0x1A, 0xFF, 0x0C, 0x08, 0x0D, 0x19, 0xFF, 0x09, 0x0C, 0x18, 0xFF, 0x08, 0x0C, 0x17, 0xFF,
+    0x07, 0x0A, 0x15, 0xFF, 0x06, 0x09, 0x12, 0xFF, 0x05, 0x07, 0x10, 0xFF, 0x03, 0x07, 0x0E, 0xFF, 0x03, 0x06, 0x0E, 0xFF, 0x03, 0x05, 0x0C, 0xFF,
+    0x02, 0x05, 0x0B, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x80, 0x02, 0x03, 0x08, 0xFF, 0x00, 0x02, 0x03,
+    0x07, 0xFF, 0x80, 0x01, 0x03, 0x07, 0xFF, 0x00, 0x01, 0x02, 0x07, 0xFF, 0x80, 0x01, 0x03, 0x07, 0xFF, 0x01, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x03,
+    0x06, 0xFF, 0x80, 0x01, 0x02, 0x06, 0xFF, 0x00, 0x01, 0x02, 0x07, 0xFF, 0x81, 0x01, 0x02, 0x06, 0xFF, 0x04, 0x01, 0x01, 0x07, 0xFF, 0x01, 0x02,
+    0x06, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x81, 0x01, 0x02, 0x06, 0xFF, 0x81, 0x01, 0x02, 0x05, 0xFF,
+    0x80, 0x01, 0x02, 0x06, 0xFF, 0x80, 0x01, 0x02, 0x05, 0xFF, 0x00, 0x01, 0x02, 0x06, 0xFF, 0x80, 0x01, 0x02, 0x05, 0xFF, 0x82, 0x01, 0x02, 0x06,
+    0xFF, 0x00, 0x00, 0x01, 0x05, 0xFF, 0x86, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x81, 0x01, 0x02, 0x07,
+    0xFF, 0x00, 0x00, 0x02, 0x06, 0xFF, 0x80, 0x01, 0x02, 0x07, 0xFF, 0x80, 0x01, 0x02, 0x08, 0xFF, 0x00, 0x01, 0x03, 0x09, 0xFF, 0x80, 0x01, 0x02,
+    0x09, 0xFF, 0x80, 0x01, 0x03, 0x09, 0xFF, 0x3F, 0x01, 0x03, 0x0A, 0xFF, 0x01, 0x03, 0x0B, 0xFF, 0x02, 0x03, 0x0B, 0xFF, 0x02, 0x04, 0x0B, 0xFF,
+    0x02, 0x04, 0x0D, 0xFF, 0x02, 0x05, 0x0E, 0xFF, 0x03, 0x05, 0x0F, 0xFF, 0x04, 0x07, 0x10, 0xFF, 0x05, 0x08, 0x12, 0xFF, 0x07, 0x09, 0x15, 0xFF,
+    0x08, 0x0B, 0x18, 0xFF, 0x09, 0x0E, 0x1C, 0xFF, 0x0B, 0x10, 0x21, 0xFF, 0x0E, 0x15, 0x29, 0xFF, 0x0E, 0x16, 0x27, 0xFF, 0x2F, 0x32, 0x3D, 0xFF,
+    0x8D, 0x8B, 0x92, 0xFF, 0x97, 0x95, 0x9A, 0xFF, 0x96, 0x94, 0x9A, 0xFF, 0x98, 0x97, 0x9C, 0xFF, 0x9C, 0x9B, 0xA0, 0xFF, 0x9E, 0x9D, 0xA2, 0xFF,
+    0x9F, 0x9F, 0xA4, 0xFF, 0xA1, 0xA1, 0xA5, 0xFF, 0xA2, 0xA2, 0xA6, 0xFF, 0xA0, 0xA0, 0xA4, 0xFF, 0x9C, 0x9D, 0xA0, 0xFF, 0x91, 0x94, 0x99, 0xFF,
+    0x70, 0x74, 0x84, 0xFF, 0x1D, 0x22, 0x32, 0xFF, 0x0E, 0x14, 0x25, 0xFF, 0x10, 0x16, 0x28, 0xFF, 0x11, 0x17, 0x29, 0xFF, 0x11, 0x19, 0x2B, 0xFF,
+    0x15, 0x1B, 0x30, 0xFF, 0x13, 0x19, 0x2D, 0xFF, 0x15, 0x19, 0x29, 0xFF, 0x6B, 0x73, 0x80, 0xFF, 0xA5, 0xAB, 0xB1, 0xFF, 0xCE, 0xD2, 0xD5, 0xFF,
+    0xD5, 0xD8, 0xDC, 0xFF, 0xCF, 0xD2, 0xD5, 0xFF, 0xCE, 0xD1, 0xD4, 0xFF, 0xCF, 0xD2, 0xD5, 0xFF, 0xCB, 0xCE, 0xD2, 0xFF, 0xA7, 0xA9, 0xB0, 0xFF,
+    0x6A, 0x6D, 0x77, 0xFF, 0x16, 0x18, 0x25, 0xFF, 0x0C, 0x11, 0x20, 0xFF, 0x0A, 0x0F, 0x1E, 0xFF, 0x08, 0x0C, 0x19, 0xFF, 0x07, 0x0A, 0x15, 0xFF,
+    0x05, 0x08, 0x12, 0xFF, 0x04, 0x07, 0x10, 0xFF, 0x03, 0x06, 0x0F, 0xFF, 0x03, 0x06, 0x0D, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x02, 0x05, 0x0C, 0xFF,
+    0x02, 0x04, 0x0B, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x01, 0x04, 0x08, 0xFF, 0x01, 0x03, 0x08, 0xFF, 0x01, 0x02, 0x08, 0xFF, 0x00, 0x03, 0x07, 0xFF,
+    0x81, 0x01, 0x03, 0x07, 0xFF, 0x01, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x80, 0x01, 0x02, 0x06, 0xFF, 0x03, 0x01, 0x03, 0x06, 0xFF,
+    0x00, 0x03, 0x06, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x00, 0x02, 0x06, 0xFF, 0x81, 0x01, 0x02, 0x06, 0xFF, 0x03, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x02,
+    0x06, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x80, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x02, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x04,
+    0xFF, 0x04, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x81, 0x00,
+    0x01, 0x04, 0xFF, 0x00, 0x00, 0x01, 0x03, 0xFF, 0x82, 0x00, 0x01, 0x04, 0xFF, 0x04, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
+    0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x01, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x02, 0x01, 0xFF, 0x84, 0x00, 0x01, 0x01, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0xFF, 0x02, 0x00, 0x02, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x80, 0x00, 0x01, 0x02, 0xFF, 0x80,
+    0x01, 0x01, 0x03, 0xFF, 0x05, 0x01, 0x02, 0x03, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x00, 0x02, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x02, 0x04,
+    0xFF, 0x01, 0x01, 0x04, 0xFF, 0x80, 0x01, 0x02, 0x05, 0xFF, 0x00, 0x01, 0x02, 0x06, 0xFF, 0x80, 0x00, 0x04, 0x07, 0xFF, 0x12, 0x02, 0x06, 0x09,
+    0xFF, 0x02, 0x04, 0x08, 0xFF, 0x04, 0x08, 0x0E, 0xFF, 0x40, 0x48, 0x54, 0xFF, 0x57, 0x5E, 0x6B, 0xFF, 0x48, 0x4D, 0x5B, 0xFF, 0x33, 0x39, 0x49,
+    0xFF, 0x35, 0x3D, 0x4C, 0xFF, 0x3E, 0x44, 0x54, 0xFF, 0x42, 0x49, 0x5B, 0xFF, 0x40, 0x48, 0x5A, 0xFF, 0x48, 0x4F, 0x61, 0xFF, 0x89, 0x91, 0x9C,
+    0xFF, 0xBC, 0xC3, 0xC8, 0xFF, 0xAD, 0xB4, 0xBA, 0xFF, 0x71, 0x78, 0x7C, 0xFF, 0x03, 0x04, 0x0D, 0xFF, 0x03, 0x06, 0x0D, 0xFF, 0x0A, 0x0E, 0x1A,
+    0xFF, 0x80, 0x09, 0x0D, 0x1B, 0xFF, 0x26, 0x07, 0x0C, 0x1A, 0xFF, 0x07, 0x0C, 0x18, 0xFF, 0x08, 0x0C, 0x1A, 0xFF, 0x09, 0x0D, 0x1B, 0xFF, 0x08,
+    0x0C, 0x1A, 0xFF, 0x07, 0x0B, 0x19, 0xFF, 0x07, 0x0A, 0x18, 0xFF, 0x06, 0x0A, 0x17, 0xFF, 0x07, 0x0B, 0x17, 0xFF, 0x06, 0x0C, 0x18, 0xFF, 0x06,
+    0x0C, 0x19, 0xFF, 0x07, 0x0D, 0x19, 0xFF, 0x08, 0x0C, 0x19, 0xFF, 0x08, 0x0D, 0x19, 0xFF, 0x07, 0x0D, 0x19, 0xFF, 0x07, 0x0E, 0x19, 0xFF, 0x08,
+    0x0D, 0x18, 0xFF, 0x08, 0x0D, 0x19, 0xFF, 0x09, 0x0F, 0x1B, 0xFF, 0x08, 0x0F, 0x1B, 0xFF, 0x08, 0x0E, 0x1A, 0xFF, 0x09, 0x0E, 0x1A, 0xFF, 0x0A,
+    0x10, 0x1D, 0xFF, 0x0A, 0x11, 0x1E, 0xFF, 0x0A, 0x10, 0x1E, 0xFF, 0x09, 0x0F, 0x1C, 0xFF, 0x07, 0x0D, 0x19, 0xFF, 0x07, 0x0B, 0x17, 0xFF, 0x06,
+    0x0A, 0x14, 0xFF, 0x05, 0x09, 0x13, 0xFF, 0x05, 0x07, 0x12, 0xFF, 0x05, 0x06, 0x10, 0xFF, 0x04, 0x05, 0x0E, 0xFF, 0x03, 0x05, 0x0E, 0xFF, 0x03,
+    0x04, 0x0D, 0xFF, 0x03, 0x04, 0x0C, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x02, 0x03, 0x0C, 0xFF, 0x02, 0x03, 0x0B, 0xFF, 0x80, 0x02, 0x04, 0x0B, 0xFF,
+    0x0D, 0x02, 0x05, 0x0C, 0xFF, 0x02, 0x04, 0x0C, 0xFF, 0x02, 0x05, 0x0D, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x03, 0x06, 0x0D, 0xFF, 0x03, 0x08, 0x0F,
+    0xFF, 0x04, 0x08, 0x12, 0xFF, 0x06, 0x0A, 0x13, 0xFF, 0x07, 0x0B, 0x15, 0xFF, 0x08, 0x0D, 0x19, 0xFF, 0x09, 0x0E, 0x1B, 0xFF, 0x0A, 0x10, 0x1D,
+    0xFF, 0x0C, 0x11, 0x1F, 0xFF, 0x0C, 0x12, 0x21, 0xFF, 0x80, 0x0D, 0x11, 0x20, 0xFF, 0x81, 0x0D, 0x12, 0x21, 0xFF, 0x00, 0x0D, 0x13, 0x22, 0xFF,
+    0x80, 0x0D, 0x12, 0x21, 0xFF, 0x12, 0x0D, 0x12, 0x22, 0xFF, 0x0D, 0x12, 0x23, 0xFF, 0x0D, 0x12, 0x22, 0xFF, 0x0D, 0x12, 0x21, 0xFF, 0x0C, 0x11,
+    0x20, 0xFF, 0x0C, 0x10, 0x1F, 0xFF, 0x0B, 0x10, 0x1E, 0xFF, 0x0C, 0x11, 0x1F, 0xFF, 0x0B, 0x11, 0x20, 0xFF, 0x0B, 0x10, 0x1E, 0xFF, 0x0A, 0x0E,
+    0x1C, 0xFF, 0x08, 0x0D, 0x18, 0xFF, 0x07, 0x0A, 0x14, 0xFF, 0x05, 0x09, 0x12, 0xFF, 0x04, 0x08, 0x10, 0xFF, 0x03, 0x07, 0x0E, 0xFF, 0x03, 0x06,
+    0x0D, 0xFF, 0x03, 0x06, 0x0B, 0xFF, 0x02, 0x05, 0x0B, 0xFF, 0x80, 0x02, 0x05, 0x0A, 0xFF, 0x05, 0x02, 0x04, 0x0A, 0xFF, 0x02, 0x04, 0x09, 0xFF,
+    0x01, 0x04, 0x08, 0xFF, 0x01, 0x04, 0x09, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x01, 0x03, 0x08, 0xFF, 0x80, 0x01, 0x03, 0x07, 0xFF, 0x80, 0x01, 0x03,
+    0x08, 0xFF, 0x86, 0x01, 0x02, 0x07, 0xFF, 0x85, 0x01, 0x02, 0x06, 0xFF, 0x83, 0x01, 0x03, 0x06, 0xFF, 0x01, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x03,
+    0x06, 0xFF, 0x81, 0x01, 0x03, 0x07, 0xFF, 0x02, 0x01, 0x03, 0x06, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x80, 0x01, 0x02, 0x06,
+    0xFF, 0x80, 0x01, 0x03, 0x07, 0xFF, 0x00, 0x01, 0x02, 0x06, 0xFF, 0x80, 0x01, 0x02, 0x07, 0xFF, 0x00, 0x00, 0x02, 0x06, 0xFF, 0x80, 0x01, 0x02,
+    0x06, 0xFF, 0x00, 0x01, 0x01, 0x06, 0xFF, 0x80, 0x01, 0x02, 0x07, 0xFF, 0x00, 0x01, 0x02, 0x06, 0xFF, 0x81, 0x01, 0x02, 0x07, 0xFF, 0x04, 0x01,
+    0x02, 0x08, 0xFF, 0x01, 0x03, 0x08, 0xFF, 0x01, 0x03, 0x09, 0xFF, 0x01, 0x04, 0x09, 0xFF, 0x01, 0x03, 0x0A, 0xFF, 0x81, 0x01, 0x04, 0x0A, 0xFF,
+    0x37, 0x02, 0x04, 0x0B, 0xFF, 0x02, 0x05, 0x0C, 0xFF, 0x02, 0x05, 0x0D, 0xFF, 0x02, 0x05, 0x0E, 0xFF, 0x03, 0x06, 0x0E, 0xFF, 0x04, 0x07, 0x10,
+    0xFF, 0x05, 0x08, 0x12, 0xFF, 0x05, 0x08, 0x14, 0xFF, 0x07, 0x0A, 0x16, 0xFF, 0x08, 0x0C, 0x1A, 0xFF, 0x0B, 0x0F, 0x1F, 0xFF, 0x0E, 0x13, 0x24,
+    0xFF, 0x0F, 0x15, 0x29, 0xFF, 0x1D, 0x23, 0x31, 0xFF, 0x70, 0x76, 0x82, 0xFF, 0xDB, 0xDD, 0xE0, 0xFF, 0xCD, 0xCE, 0xD3, 0xFF, 0xC6, 0xC9, 0xCE,
+    0xFF, 0xC7, 0xCA, 0xCF, 0xFF, 0xCA, 0xCC, 0xD1, 0xFF, 0xCB, 0xCE, 0xD2, 0xFF, 0xCC, 0xCE, 0xD3, 0xFF, 0xCE, 0xD1, 0xD4, 0xFF, 0xD0, 0xD2, 0xD6,
+    0xFF, 0xCE, 0xD1, 0xD5, 0xFF, 0xCD, 0xCF, 0xD2, 0xFF, 0xCF, 0xD2, 0xD5, 0xFF, 0x9D, 0xA1, 0xAD, 0xFF, 0x26, 0x2C, 0x3C, 0xFF, 0x0D, 0x14, 0x24,
+    0xFF, 0x12, 0x1A, 0x2B, 0xFF, 0x13, 0x1B, 0x2E, 0xFF, 0x15, 0x1D, 0x31, 0xFF, 0x15, 0x1D, 0x32, 0xFF, 0x27, 0x2E, 0x3D, 0xFF, 0x79, 0x7F, 0x8B,
+    0xFF, 0xCC, 0xD1, 0xD6, 0xFF, 0xCE, 0xD1, 0xD5, 0xFF, 0xC2, 0xC5, 0xCB, 0xFF, 0xBD, 0xC1, 0xC8, 0xFF, 0xBC, 0xBF, 0xC6, 0xFF, 0xB9, 0xBD, 0xC3,
+    0xFF, 0xB7, 0xBB, 0xC1, 0xFF, 0xB7, 0xBC, 0xC2, 0xFF, 0xBB, 0xBF, 0xC6, 0xFF, 0xB5, 0xBA, 0xC1, 0xFF, 0x62, 0x66, 0x70, 0xFF, 0x10, 0x14, 0x1F,
+    0xFF, 0x0B, 0x0F, 0x1D, 0xFF, 0x09, 0x0E, 0x1B, 0xFF, 0x07, 0x0B, 0x16, 0xFF, 0x05, 0x09, 0x13, 0xFF, 0x05, 0x08, 0x10, 0xFF, 0x04, 0x07, 0x0F,
+    0xFF, 0x03, 0x06, 0x0F, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x80, 0x02, 0x05, 0x0C, 0xFF, 0x01, 0x02, 0x04, 0x0A, 0xFF, 0x01, 0x04, 0x09, 0xFF, 0x80,
+    0x01, 0x04, 0x08, 0xFF, 0x01, 0x00, 0x04, 0x08, 0xFF, 0x01, 0x04, 0x08, 0xFF, 0x80, 0x00, 0x04, 0x08, 0xFF, 0x01, 0x01, 0x04, 0x08, 0xFF, 0x00,
+    0x03, 0x08, 0xFF, 0x80, 0x01, 0x03, 0x07, 0xFF, 0x80, 0x01, 0x03, 0x06, 0xFF, 0x02, 0x00, 0x03, 0x06, 0xFF, 0x00, 0x03, 0x07, 0xFF, 0x00, 0x02,
+    0x06, 0xFF, 0x80, 0x01, 0x02, 0x06, 0xFF, 0x80, 0x00, 0x02, 0x06, 0xFF, 0x00, 0x01, 0x02, 0x06, 0xFF, 0x81, 0x00, 0x01, 0x05, 0xFF, 0x07, 0x00,
+    0x01, 0x04, 0xFF, 0x00, 0x02, 0x04, 0xFF, 0x00, 0x02, 0x05, 0xFF, 0x00, 0x02, 0x04, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x00,
+    0x01, 0x06, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x80, 0x00, 0x02, 0x05, 0xFF, 0x83, 0x00, 0x02, 0x04, 0xFF, 0x03, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x02,
+    0x04, 0xFF, 0x00, 0x02, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x80, 0x00, 0x01, 0x02, 0xFF, 0x02, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF,
+    0x00, 0x01, 0x00, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x0C, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x03, 0xFF, 0x00, 0x01,
+    0x02, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x00, 0x02, 0x03, 0xFF, 0x80, 0x01, 0x02, 0x04, 0xFF, 0x2F, 0x01, 0x01, 0x04, 0xFF,
+    0x01, 0x01, 0x05, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x00, 0x02, 0x04, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x01, 0x04, 0x07, 0xFF,
+    0x01, 0x05, 0x09, 0xFF, 0x02, 0x06, 0x09, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x1D, 0x24, 0x2C, 0xFF, 0x41, 0x48, 0x57, 0xFF, 0x29, 0x2F, 0x3C, 0xFF,
+    0x2E, 0x34, 0x42, 0xFF, 0x35, 0x3C, 0x4C, 0xFF, 0x38, 0x40, 0x50, 0xFF, 0x40, 0x46, 0x56, 0xFF, 0x44, 0x4B, 0x5E, 0xFF, 0x45, 0x4E, 0x61, 0xFF,
+    0x46, 0x4D, 0x60, 0xFF, 0x43, 0x4A, 0x5D, 0xFF, 0x63, 0x6A, 0x7A, 0xFF, 0xC5, 0xCD, 0xD1, 0xFF, 0xC6, 0xCC, 0xD1, 0xFF, 0xAC, 0xB3, 0xBB, 0xFF,
+    0x6E, 0x72, 0x79, 0xFF, 0x0B, 0x0C, 0x13, 0xFF, 0x0B, 0x10, 0x1D, 0xFF, 0x0A, 0x10, 0x1D, 0xFF, 0x0A, 0x0E, 0x1B, 0xFF, 0x09, 0x0F, 0x1D, 0xFF,
+    0x08, 0x0E, 0x1D, 0xFF, 0x06, 0x0B, 0x19, 0xFF, 0x04, 0x08, 0x17, 0xFF, 0x03, 0x07, 0x14, 0xFF, 0x03, 0x05, 0x11, 0xFF, 0x02, 0x04, 0x0F, 0xFF,
+    0x01, 0x05, 0x10, 0xFF, 0x02, 0x05, 0x11, 0xFF, 0x03, 0x06, 0x13, 0xFF, 0x03, 0x06, 0x14, 0xFF, 0x02, 0x06, 0x14, 0xFF, 0x02, 0x06, 0x12, 0xFF,
+    0x01, 0x06, 0x12, 0xFF, 0x01, 0x05, 0x11, 0xFF, 0x02, 0x06, 0x11, 0xFF, 0x02, 0x07, 0x13, 0xFF, 0x03, 0x08, 0x15, 0xFF, 0x80, 0x03, 0x09, 0x16,
+    0xFF, 0x0D, 0x02, 0x08, 0x13, 0xFF, 0x0A, 0x11, 0x1D, 0xFF, 0x0F, 0x16, 0x26, 0xFF, 0x0D, 0x14, 0x23, 0xFF, 0x0A, 0x11, 0x20, 0xFF, 0x09, 0x0E,
+    0x1D, 0xFF, 0x08, 0x0D, 0x1A, 0xFF, 0x07, 0x0B, 0x17, 0xFF, 0x06, 0x09, 0x14, 0xFF, 0x05, 0x08, 0x13, 0xFF, 0x05, 0x07, 0x11, 0xFF, 0x04, 0x06,
+    0x0F, 0xFF, 0x04, 0x05, 0x0E, 0xFF, 0x03, 0x05, 0x0E, 0xFF, 0x81, 0x03, 0x04, 0x0D, 0xFF, 0x00, 0x03, 0x03, 0x0C, 0xFF, 0x81, 0x03, 0x04, 0x0C,
+    0xFF, 0x11, 0x02, 0x04, 0x0D, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x04, 0x06, 0x0D, 0xFF, 0x04, 0x06, 0x0E, 0xFF, 0x04, 0x07, 0x10, 0xFF, 0x05, 0x08,
+    0x13, 0xFF, 0x06, 0x0A, 0x15, 0xFF, 0x07, 0x0C, 0x17, 0xFF, 0x08, 0x0D, 0x1A, 0xFF, 0x0A, 0x10, 0x1F, 0xFF, 0x0C, 0x12, 0x21, 0xFF, 0x07, 0x0D,
+    0x1D, 0xFF, 0x06, 0x0D, 0x20, 0xFF, 0x05, 0x0C, 0x1D, 0xFF, 0x06, 0x0D, 0x1E, 0xFF, 0x06, 0x0E, 0x1F, 0xFF, 0x07, 0x0E, 0x1F, 0xFF, 0x07, 0x0F,
+    0x20, 0xFF, 0x80, 0x07, 0x0E, 0x20, 0xFF, 0x15, 0x06, 0x0E, 0x1F, 0xFF, 0x07, 0x0E, 0x20, 0xFF, 0x07, 0x0E, 0x21, 0xFF, 0x08, 0x0F, 0x20, 0xFF,
+    0x07, 0x0E, 0x20, 0xFF, 0x07, 0x0E, 0x1F, 0xFF, 0x08, 0x0E, 0x1F, 0xFF, 0x07, 0x0E, 0x1F, 0xFF, 0x08, 0x0F, 0x1F, 0xFF, 0x07, 0x0E, 0x1E, 0xFF,
+    0x0B, 0x11, 0x20, 0xFF, 0x0D, 0x12, 0x22, 0xFF, 0x09, 0x0E, 0x1C, 0xFF, 0x08, 0x0B, 0x17, 0xFF, 0x06, 0x0A, 0x13, 0xFF, 0x05, 0x08, 0x11, 0xFF,
+    0x04, 0x08, 0x0F, 0xFF, 0x02, 0x06, 0x0E, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x03, 0x05, 0x0B, 0xFF, 0x02, 0x05, 0x0B, 0xFF, 0x02, 0x04, 0x0A, 0xFF,
+    0x81, 0x02, 0x04, 0x09, 0xFF, 0x0A, 0x01, 0x03, 0x08, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x02, 0x03, 0x07, 0xFF, 0x01, 0x03,
+    0x07, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x02, 0x03, 0x07, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x01, 0x03,
+    0x08, 0xFF, 0x86, 0x01, 0x02, 0x07, 0xFF, 0x04, 0x02, 0x02, 0x07, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x01, 0x03, 0x07, 0xFF,
+    0x01, 0x02, 0x06, 0xFF, 0x80, 0x01, 0x03, 0x06, 0xFF, 0x02, 0x00, 0x03, 0x06, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x02, 0x03, 0x07, 0xFF, 0x81, 0x01,
+    0x03, 0x06, 0xFF, 0x00, 0x01, 0x02, 0x06, 0xFF, 0x80, 0x01, 0x02, 0x07, 0xFF, 0x80, 0x01, 0x02, 0x06, 0xFF, 0x03, 0x01, 0x02, 0x07, 0xFF, 0x01,
+    0x03, 0x06, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x80, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x02, 0x06,
+    0xFF, 0x80, 0x01, 0x02, 0x07, 0xFF, 0x03, 0x01, 0x03, 0x07, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x02, 0x08, 0xFF, 0x01, 0x03, 0x08, 0xFF, 0x82,
+    0x01, 0x03, 0x09, 0xFF, 0x80, 0x01, 0x04, 0x0A, 0xFF, 0x1A, 0x02, 0x04, 0x0A, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x02, 0x05, 0x0B, 0xFF, 0x02, 0x04,
+    0x0C, 0xFF, 0x02, 0x04, 0x0D, 0xFF, 0x02, 0x05, 0x0E, 0xFF, 0x03, 0x05, 0x0E, 0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x04, 0x06, 0x11, 0xFF, 0x05, 0x08,
+    0x12, 0xFF, 0x06, 0x09, 0x14, 0xFF, 0x07, 0x0A, 0x17, 0xFF, 0x09, 0x0D, 0x1B, 0xFF, 0x0B, 0x10, 0x20, 0xFF, 0x0E, 0x13, 0x25, 0xFF, 0x15, 0x1B,
+    0x29, 0xFF, 0x6A, 0x70, 0x7D, 0xFF, 0xA6, 0xAA, 0xB2, 0xFF, 0xE1, 0xE4, 0xE5, 0xFF, 0xC7, 0xCA, 0xD0, 0xFF, 0xBE, 0xC2, 0xCA, 0xFF, 0xBE, 0xC2,
+    0xC9, 0xFF, 0xBE, 0xC3, 0xCA, 0xFF, 0xC0, 0xC4, 0xCB, 0xFF, 0xC0, 0xC4, 0xCA, 0xFF, 0xC1, 0xC5, 0xCB, 0xFF, 0xC2, 0xC6, 0xCC, 0xFF, 0x80, 0xC1,
+    0xC4, 0xCA, 0xFF, 0x0B, 0xC7, 0xCB, 0xCF, 0xFF, 0x99, 0x9F, 0xAA, 0xFF, 0x25, 0x2C, 0x3A, 0xFF, 0x0E, 0x16, 0x26, 0xFF, 0x15, 0x1C, 0x30, 0xFF,
+    0x17, 0x1F, 0x33, 0xFF, 0x15, 0x1D, 0x31, 0xFF, 0x1E, 0x25, 0x35, 0xFF, 0x91, 0x9A, 0xA6, 0xFF, 0xCA, 0xCF, 0xD5, 0xFF, 0xBF, 0xC4, 0xCA, 0xFF,
+    0xB8, 0xBD, 0xC4, 0xFF, 0x80, 0xB9, 0xBD, 0xC4, 0xFF, 0x0F, 0xB8, 0xBD, 0xC4, 0xFF, 0xB7, 0xBC, 0xC1, 0xFF, 0xB4, 0xB8, 0xBE, 0xFF, 0xB1, 0xB6,
+    0xBD, 0xFF, 0xAC, 0xB2, 0xBB, 0xFF, 0xAD, 0xB3, 0xBC, 0xFF, 0xAC, 0xB1, 0xB9, 0xFF, 0x58, 0x5C, 0x67, 0xFF, 0x05, 0x07, 0x11, 0xFF, 0x08, 0x0D,
+    0x1B, 0xFF, 0x07, 0x0B, 0x17, 0xFF, 0x06, 0x0A, 0x14, 0xFF, 0x05, 0x08, 0x11, 0xFF, 0x04, 0x07, 0x0F, 0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x03, 0x06,
+    0x0E, 0xFF, 0x80, 0x02, 0x05, 0x0C, 0xFF, 0x01, 0x01, 0x04, 0x0B, 0xFF, 0x01, 0x04, 0x0A, 0xFF, 0x80, 0x01, 0x04, 0x09, 0xFF, 0x04, 0x01, 0x04,
+    0x08, 0xFF, 0x01, 0x03, 0x08, 0xFF, 0x00, 0x03, 0x08, 0xFF, 0x01, 0x03, 0x08, 0xFF, 0x01, 0x04, 0x08, 0xFF, 0x81, 0x01, 0x03, 0x07, 0xFF, 0x02,
+    0x00, 0x03, 0x07, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x00, 0x03, 0x06, 0xFF, 0x80, 0x00, 0x02, 0x07, 0xFF, 0x01, 0x01, 0x03, 0x07, 0xFF, 0x00, 0x02,
+    0x07, 0xFF, 0x80, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x01, 0x02, 0x07, 0xFF, 0x00, 0x01, 0x06, 0xFF, 0x80, 0x01, 0x02, 0x06, 0xFF, 0x0D, 0x00, 0x02,
+    0x06, 0xFF, 0x00, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x00, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x01, 0x02,
+    0x06, 0xFF, 0x00, 0x02, 0x05, 0xFF, 0x00, 0x03, 0x05, 0xFF, 0x00, 0x02, 0x04, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x00, 0x02, 0x04, 0xFF, 0x01, 0x02,
+    0x04, 0xFF, 0x00, 0x02, 0x04, 0xFF, 0x80, 0x01, 0x02, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x00, 0x01,
+    0x02, 0xFF, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x82, 0x00, 0x00,
+    0x01, 0xFF, 0x00, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x02, 0xFF, 0x04, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02,
+    0xFF, 0x01, 0x01, 0x03, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x80, 0x01, 0x01, 0x04, 0xFF, 0x02, 0x01, 0x02, 0x03, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x01,
+    0x01, 0x04, 0xFF, 0x80, 0x01, 0x02, 0x05, 0xFF, 0x23, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x01, 0x04, 0x07, 0xFF, 0x02, 0x05, 0x0A,
+    0xFF, 0x01, 0x04, 0x08, 0xFF, 0x06, 0x0A, 0x0F, 0xFF, 0x32, 0x39, 0x48, 0xFF, 0x29, 0x30, 0x3A, 0xFF, 0x29, 0x2D, 0x3C, 0xFF, 0x2C, 0x31, 0x3F,
+    0xFF, 0x31, 0x36, 0x45, 0xFF, 0x32, 0x39, 0x47, 0xFF, 0x38, 0x3E, 0x4E, 0xFF, 0x3A, 0x41, 0x53, 0xFF, 0x40, 0x47, 0x5A, 0xFF, 0x42, 0x49, 0x5C,
+    0xFF, 0x3C, 0x43, 0x55, 0xFF, 0x38, 0x3F, 0x50, 0xFF, 0x95, 0x9C, 0xA5, 0xFF, 0xC8, 0xD0, 0xD4, 0xFF, 0xB9, 0xC1, 0xC8, 0xFF, 0xC6, 0xCC, 0xCF,
+    0xFF, 0x6E, 0x73, 0x7A, 0xFF, 0x1F, 0x21, 0x25, 0xFF, 0x0D, 0x11, 0x1F, 0xFF, 0x0B, 0x10, 0x1E, 0xFF, 0x0B, 0x10, 0x1F, 0xFF, 0x18, 0x1C, 0x29,
+    0xFF, 0x3F, 0x44, 0x53, 0xFF, 0x4C, 0x51, 0x5F, 0xFF, 0x50, 0x54, 0x62, 0xFF, 0x4F, 0x53, 0x61, 0xFF, 0x4E, 0x53, 0x60, 0xFF, 0x4F, 0x54, 0x61,
+    0xFF, 0x52, 0x58, 0x64, 0xFF, 0x55, 0x5A, 0x67, 0xFF, 0x80, 0x56, 0x5B, 0x68, 0xFF, 0x1A, 0x55, 0x5C, 0x68, 0xFF, 0x56, 0x5D, 0x69, 0xFF, 0x57,
+    0x5E, 0x6B, 0xFF, 0x59, 0x60, 0x6D, 0xFF, 0x5C, 0x63, 0x70, 0xFF, 0x60, 0x67, 0x74, 0xFF, 0x64, 0x68, 0x76, 0xFF, 0x67, 0x6B, 0x79, 0xFF, 0x67,
+    0x6B, 0x76, 0xFF, 0x3F, 0x42, 0x4B, 0xFF, 0x0A, 0x10, 0x1E, 0xFF, 0x11, 0x18, 0x2A, 0xFF, 0x0E, 0x14, 0x25, 0xFF, 0x0B, 0x11, 0x20, 0xFF, 0x09,
+    0x0E, 0x1C, 0xFF, 0x07, 0x0C, 0x19, 0xFF, 0x07, 0x0A, 0x16, 0xFF, 0x06, 0x08, 0x14, 0xFF, 0x05, 0x07, 0x12, 0xFF, 0x04, 0x06, 0x11, 0xFF, 0x05,
+    0x05, 0x10, 0xFF, 0x04, 0x05, 0x0F, 0xFF, 0x03, 0x04, 0x0E, 0xFF, 0x03, 0x05, 0x0F, 0xFF, 0x03, 0x04, 0x0E, 0xFF, 0x02, 0x04, 0x0D, 0xFF, 0x03,
+    0x04, 0x0E, 0xFF, 0x80, 0x03, 0x05, 0x0E, 0xFF, 0x10, 0x03, 0x04, 0x0D, 0xFF, 0x04, 0x05, 0x0E, 0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x04, 0x07, 0x10,
+    0xFF, 0x04, 0x08, 0x11, 0xFF, 0x06, 0x08, 0x13, 0xFF, 0x07, 0x0B, 0x15, 0xFF, 0x07, 0x0C, 0x19, 0xFF, 0x09, 0x0F, 0x1C, 0xFF, 0x0C, 0x11, 0x1F,
+    0xFF, 0x17, 0x1B, 0x27, 0xFF, 0x4C, 0x4F, 0x5E, 0xFF, 0x60, 0x63, 0x74, 0xFF, 0x5C, 0x60, 0x70, 0xFF, 0x5C, 0x60, 0x6F, 0xFF, 0x5C, 0x61, 0x70,
+    0xFF, 0x5C, 0x60, 0x71, 0xFF, 0x80, 0x5C, 0x61, 0x72, 0xFF, 0x14, 0x5D, 0x61, 0x72, 0xFF, 0x5E, 0x62, 0x73, 0xFF, 0x61, 0x66, 0x76, 0xFF, 0x63,
+    0x67, 0x78, 0xFF, 0x64, 0x69, 0x78, 0xFF, 0x65, 0x6A, 0x79, 0xFF, 0x66, 0x6B, 0x79, 0xFF, 0x67, 0x6D, 0x7B, 0xFF, 0x69, 0x6E, 0x7D, 0xFF, 0x6B,
+    0x6F, 0x7E, 0xFF, 0x5E, 0x63, 0x70, 0xFF, 0x32, 0x38, 0x45, 0xFF, 0x0E, 0x13, 0x23, 0xFF, 0x0B, 0x11, 0x1F, 0xFF, 0x09, 0x0D, 0x18, 0xFF, 0x07,
+    0x0B, 0x15, 0xFF, 0x05, 0x09, 0x12, 0xFF, 0x05, 0x07, 0x10, 0xFF, 0x03, 0x07, 0x0E, 0xFF, 0x03, 0x06, 0x0D, 0xFF, 0x03, 0x06, 0x0C, 0xFF, 0x80,
+    0x03, 0x05, 0x0B, 0xFF, 0x81, 0x02, 0x04, 0x0A, 0xFF, 0x03, 0x01, 0x03, 0x08, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x02, 0x03,
+    0x08, 0xFF, 0x80, 0x01, 0x03, 0x09, 0xFF, 0x01, 0x02, 0x03, 0x08, 0xFF, 0x01, 0x02, 0x08, 0xFF, 0x80, 0x01, 0x03, 0x08, 0xFF, 0x0B, 0x01, 0x02,
+    0x08, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x01, 0x03, 0x08, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x03, 0x08, 0xFF, 0x02, 0x03,
+    0x08, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x02, 0x08, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x02, 0x03, 0x07, 0xFF, 0x81, 0x01,
+    0x03, 0x07, 0xFF, 0x00, 0x01, 0x02, 0x07, 0xFF, 0x80, 0x01, 0x03, 0x07, 0xFF, 0x01, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x8C, 0x01,
+    0x02, 0x07, 0xFF, 0x83, 0x01, 0x02, 0x08, 0xFF, 0x08, 0x01, 0x03, 0x09, 0xFF, 0x01, 0x02, 0x09, 0xFF, 0x01, 0x03, 0x09, 0xFF, 0x01, 0x02, 0x09,
+    0xFF, 0x01, 0x03, 0x0A, 0xFF, 0x01, 0x04, 0x0A, 0xFF, 0x01, 0x03, 0x0A, 0xFF, 0x01, 0x04, 0x0B, 0xFF, 0x01, 0x03, 0x0B, 0xFF, 0x80, 0x02, 0x04,
+    0x0C, 0xFF, 0x13, 0x02, 0x05, 0x0D, 0xFF, 0x02, 0x05, 0x0E, 0xFF, 0x03, 0x05, 0x0E, 0xFF, 0x03, 0x05, 0x0F, 0xFF, 0x04, 0x07, 0x10, 0xFF, 0x05,
+    0x07, 0x12, 0xFF, 0x05, 0x08, 0x13, 0xFF, 0x06, 0x09, 0x14, 0xFF, 0x07, 0x0A, 0x18, 0xFF, 0x08, 0x0D, 0x1B, 0xFF, 0x0B, 0x10, 0x20, 0xFF, 0x08,
+    0x0D, 0x1B, 0xFF, 0x32, 0x39, 0x4B, 0xFF, 0x9B, 0xA0, 0xAB, 0xFF, 0xAF, 0xB2, 0xBB, 0xFF, 0xE0, 0xE1, 0xE3, 0xFF, 0xC7, 0xCA, 0xD0, 0xFF, 0xC0,
+    0xC3, 0xCB, 0xFF, 0xBE, 0xC3, 0xCA, 0xFF, 0xBE, 0xC2, 0xC9, 0xFF, 0x80, 0xBE, 0xC3, 0xCA, 0xFF, 0x01, 0xBD, 0xC2, 0xCA, 0xFF, 0xBE, 0xC2, 0xCA,
+    0xFF, 0x80, 0xBE, 0xC2, 0xC9, 0xFF, 0x21, 0xC2, 0xC6, 0xCC, 0xFF, 0x96, 0x9C, 0xA8, 0xFF, 0x26, 0x2D, 0x3C, 0xFF, 0x13, 0x1B, 0x2E, 0xFF, 0x19,
+    0x21, 0x36, 0xFF, 0x14, 0x1C, 0x30, 0xFF, 0x1D, 0x23, 0x33, 0xFF, 0x8D, 0x95, 0xA3, 0xFF, 0xD7, 0xDB, 0xE0, 0xFF, 0xBC, 0xC2, 0xC8, 0xFF, 0xAE,
+    0xB3, 0xBB, 0xFF, 0xB3, 0xB8, 0xBF, 0xFF, 0xB3, 0xB9, 0xC0, 0xFF, 0xB6, 0xBB, 0xC2, 0xFF, 0xB5, 0xBA, 0xC1, 0xFF, 0xB3, 0xB9, 0xC0, 0xFF, 0xB1,
+    0xB6, 0xBE, 0xFF, 0xAD, 0xB3, 0xBB, 0xFF, 0xA9, 0xAE, 0xB8, 0xFF, 0xA6, 0xAD, 0xB7, 0xFF, 0xAC, 0xB2, 0xBC, 0xFF, 0x89, 0x8E, 0x9C, 0xFF, 0x28,
+    0x2B, 0x35, 0xFF, 0x06, 0x0A, 0x17, 0xFF, 0x07, 0x0B, 0x17, 0xFF, 0x06, 0x09, 0x14, 0xFF, 0x05, 0x08, 0x13, 0xFF, 0x04, 0x07, 0x10, 0xFF, 0x04,
+    0x07, 0x0F, 0xFF, 0x03, 0x06, 0x0E, 0xFF, 0x03, 0x06, 0x0C, 0xFF, 0x02, 0x05, 0x0C, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x01, 0x04, 0x09, 0xFF, 0x80,
+    0x01, 0x04, 0x0A, 0xFF, 0x03, 0x01, 0x04, 0x09, 0xFF, 0x01, 0x04, 0x08, 0xFF, 0x01, 0x04, 0x09, 0xFF, 0x00, 0x03, 0x08, 0xFF, 0x83, 0x01, 0x03,
+    0x08, 0xFF, 0x02, 0x01, 0x02, 0x08, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x00, 0x03, 0x07, 0xFF, 0x80, 0x00, 0x02, 0x07, 0xFF, 0x80, 0x01, 0x02, 0x07,
+    0xFF, 0x81, 0x01, 0x02, 0x06, 0xFF, 0x03, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x00, 0x02, 0x06, 0xFF, 0x80,
+    0x01, 0x02, 0x05, 0xFF, 0x02, 0x01, 0x02, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x80, 0x00, 0x02, 0x04, 0xFF, 0x08, 0x00,
+    0x02, 0x05, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x00, 0x02, 0x05, 0xFF, 0x00, 0x02, 0x04, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00,
+    0x02, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x01, 0x03, 0xFF, 0x05, 0x00, 0x00,
+    0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0x00, 0xFF, 0x81, 0x00, 0x01, 0x01, 0xFF, 0x11, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x00,
+    0x02, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x02, 0x02, 0x05, 0xFF, 0x00, 0x02, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x01, 0x01,
+    0x04, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x02, 0x02, 0x05, 0xFF, 0x01, 0x03, 0x05, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x01, 0x04,
+    0x07, 0xFF, 0x01, 0x05, 0x09, 0xFF, 0x00, 0x05, 0x08, 0xFF, 0x13, 0x18, 0x1E, 0xFF, 0x80, 0x29, 0x2F, 0x3C, 0xFF, 0x16, 0x2B, 0x31, 0x40, 0xFF,
+    0x2C, 0x33, 0x41, 0xFF, 0x30, 0x35, 0x44, 0xFF, 0x30, 0x37, 0x45, 0xFF, 0x34, 0x39, 0x49, 0xFF, 0x34, 0x3C, 0x4C, 0xFF, 0x39, 0x41, 0x52, 0xFF,
+    0x3D, 0x45, 0x57, 0xFF, 0x3E, 0x46, 0x5A, 0xFF, 0x3F, 0x47, 0x59, 0xFF, 0x69, 0x71, 0x7E, 0xFF, 0xC6, 0xCE, 0xD3, 0xFF, 0xB6, 0xC0, 0xC7, 0xFF,
+    0xC4, 0xCA, 0xD1, 0xFF, 0xC8, 0xCE, 0xD3, 0xFF, 0x76, 0x7B, 0x81, 0xFF, 0x06, 0x07, 0x11, 0xFF, 0x0D, 0x13, 0x22, 0xFF, 0x08, 0x0D, 0x18, 0xFF,
+    0x3A, 0x40, 0x4F, 0xFF, 0x93, 0x9C, 0xAB, 0xFF, 0xA6, 0xAC, 0xB8, 0xFF, 0xAD, 0xB1, 0xBD, 0xFF, 0x80, 0xA9, 0xAE, 0xBB, 0xFF, 0x01, 0xAA, 0xAF,
+    0xBC, 0xFF, 0xAE, 0xB3, 0xBE, 0xFF, 0x80, 0xB1, 0xB5, 0xC0, 0xFF, 0x15, 0xB1, 0xB6, 0xC1, 0xFF, 0xB0, 0xB6, 0xC0, 0xFF, 0xB1, 0xB7, 0xC1, 0xFF,
+    0xB3, 0xB9, 0xC3, 0xFF, 0xB4, 0xBA, 0xC4, 0xFF, 0xB4, 0xBB, 0xC5, 0xFF, 0xB8, 0xBD, 0xC7, 0xFF, 0xBA, 0xBD, 0xC8, 0xFF, 0xBD, 0xC0, 0xCA, 0xFF,
+    0xDB, 0xDE, 0xE1, 0xFF, 0xCC, 0xD0, 0xD2, 0xFF, 0x49, 0x4B, 0x56, 0xFF, 0x16, 0x1C, 0x28, 0xFF, 0x0F, 0x15, 0x26, 0xFF, 0x0E, 0x14, 0x24, 0xFF,
+    0x0A, 0x10, 0x20, 0xFF, 0x08, 0x0D, 0x1C, 0xFF, 0x07, 0x0B, 0x18, 0xFF, 0x07, 0x09, 0x15, 0xFF, 0x06, 0x08, 0x13, 0xFF, 0x05, 0x06, 0x12, 0xFF,
+    0x05, 0x06, 0x11, 0xFF, 0x80, 0x04, 0x05, 0x0F, 0xFF, 0x80, 0x03, 0x05, 0x0F, 0xFF, 0x80, 0x03, 0x04, 0x0E, 0xFF, 0x00, 0x03, 0x04, 0x0F, 0xFF,
+    0x80, 0x03, 0x05, 0x0E, 0xFF, 0x28, 0x04, 0x06, 0x0F, 0xFF, 0x04, 0x05, 0x10, 0xFF, 0x05, 0x07, 0x10, 0xFF, 0x05, 0x08, 0x12, 0xFF, 0x06, 0x09,
+    0x14, 0xFF, 0x07, 0x0B, 0x17, 0xFF, 0x08, 0x0D, 0x1B, 0xFF, 0x0A, 0x10, 0x1F, 0xFF, 0x05, 0x09, 0x16, 0xFF, 0x53, 0x57, 0x60, 0xFF, 0xC3, 0xC6,
+    0xCB, 0xFF, 0xDC, 0xDD, 0xDF, 0xFF, 0xD8, 0xDB, 0xDD, 0xFF, 0xD7, 0xD9, 0xDC, 0xFF, 0xD5, 0xD8, 0xDC, 0xFF, 0xD5, 0xD7, 0xDC, 0xFF, 0xD4, 0xD7,
+    0xDC, 0xFF, 0xD3, 0xD6, 0xDB, 0xFF, 0xD4, 0xD6, 0xDA, 0xFF, 0xD3, 0xD5, 0xDA, 0xFF, 0xD3, 0xD6, 0xDA, 0xFF, 0xD3, 0xD6, 0xDB, 0xFF, 0xD4, 0xD7,
+    0xDB, 0xFF, 0xD3, 0xD7, 0xDB, 0xFF, 0xD5, 0xD8, 0xDC, 0xFF, 0xD7, 0xDA, 0xDE, 0xFF, 0xDA, 0xDC, 0xE0, 0xFF, 0xDE, 0xE0, 0xE2, 0xFF, 0xDE, 0xE1,
+    0xE4, 0xFF, 0x92, 0x98, 0xA0, 0xFF, 0x16, 0x1B, 0x27, 0xFF, 0x0A, 0x0F, 0x1C, 0xFF, 0x09, 0x0D, 0x1A, 0xFF, 0x07, 0x0B, 0x16, 0xFF, 0x06, 0x0A,
+    0x12, 0xFF, 0x05, 0x09, 0x11, 0xFF, 0x04, 0x07, 0x0F, 0xFF, 0x03, 0x06, 0x0E, 0xFF, 0x03, 0x06, 0x0D, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x02, 0x05,
+    0x0C, 0xFF, 0x81, 0x02, 0x04, 0x0B, 0xFF, 0x80, 0x02, 0x04, 0x0A, 0xFF, 0x81, 0x02, 0x03, 0x0A, 0xFF, 0x80, 0x02, 0x03, 0x09, 0xFF, 0x03, 0x01,
+    0x03, 0x09, 0xFF, 0x01, 0x03, 0x0A, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x01, 0x02, 0x09, 0xFF, 0x80, 0x01, 0x03, 0x09, 0xFF, 0x00, 0x02, 0x03, 0x09,
+    0xFF, 0x80, 0x01, 0x03, 0x09, 0xFF, 0x01, 0x01, 0x03, 0x08, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x80, 0x01, 0x03, 0x08, 0xFF, 0x03, 0x02, 0x03, 0x09,
+    0xFF, 0x02, 0x03, 0x08, 0xFF, 0x01, 0x03, 0x08, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x80, 0x01, 0x03, 0x08, 0xFF, 0x00, 0x01, 0x04, 0x09, 0xFF, 0x83,
+    0x01, 0x03, 0x08, 0xFF, 0x00, 0x01, 0x02, 0x08, 0xFF, 0x80, 0x01, 0x02, 0x07, 0xFF, 0x85, 0x01, 0x02, 0x08, 0xFF, 0x02, 0x00, 0x02, 0x08, 0xFF,
+    0x01, 0x02, 0x08, 0xFF, 0x01, 0x02, 0x09, 0xFF, 0x80, 0x01, 0x02, 0x08, 0xFF, 0x80, 0x01, 0x02, 0x09, 0xFF, 0x01, 0x01, 0x03, 0x09, 0xFF, 0x01,
+    0x03, 0x0A, 0xFF, 0x81, 0x02, 0x03, 0x0A, 0xFF, 0x81, 0x02, 0x04, 0x0B, 0xFF, 0x80, 0x02, 0x04, 0x0C, 0xFF, 0x13, 0x03, 0x05, 0x0D, 0xFF, 0x02,
+    0x04, 0x0D, 0xFF, 0x03, 0x05, 0x0E, 0xFF, 0x03, 0x06, 0x0F, 0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x04, 0x07, 0x11, 0xFF, 0x05, 0x07, 0x13, 0xFF, 0x06,
+    0x09, 0x14, 0xFF, 0x06, 0x0A, 0x16, 0xFF, 0x07, 0x0B, 0x18, 0xFF, 0x09, 0x0D, 0x1C, 0xFF, 0x0D, 0x11, 0x21, 0xFF, 0x07, 0x0A, 0x16, 0xFF, 0x33,
+    0x39, 0x49, 0xFF, 0x9B, 0x9E, 0xA8, 0xFF, 0xAA, 0xAE, 0xB8, 0xFF, 0xDE, 0xDF, 0xE2, 0xFF, 0xC5, 0xC8, 0xCE, 0xFF, 0xC0, 0xC3, 0xCA, 0xFF, 0xBE,
+    0xC2, 0xCA, 0xFF, 0x80, 0xBC, 0xC1, 0xC8, 0xFF, 0x23, 0xBC, 0xC0, 0xC7, 0xFF, 0xBA, 0xC0, 0xC7, 0xFF, 0xBA, 0xBF, 0xC7, 0xFF, 0xBB, 0xBF, 0xC7,
+    0xFF, 0xBB, 0xC0, 0xC8, 0xFF, 0xBE, 0xC4, 0xCA, 0xFF, 0x94, 0x9A, 0xA7, 0xFF, 0x27, 0x2E, 0x3D, 0xFF, 0x17, 0x20, 0x35, 0xFF, 0x1D, 0x26, 0x3B,
+    0xFF, 0x1E, 0x24, 0x35, 0xFF, 0x80, 0x88, 0x98, 0xFF, 0xCF, 0xD4, 0xDA, 0xFF, 0xD5, 0xDA, 0xDD, 0xFF, 0xB1, 0xB7, 0xBF, 0xFF, 0xAE, 0xB4, 0xBC,
+    0xFF, 0xB1, 0xB6, 0xBD, 0xFF, 0xB1, 0xB6, 0xBE, 0xFF, 0xB2, 0xB7, 0xBF, 0xFF, 0xB1, 0xB6, 0xBE, 0xFF, 0xAF, 0xB4, 0xBC, 0xFF, 0xAD, 0xB3, 0xBC,
+    0xFF, 0xAB, 0xB1, 0xBA, 0xFF, 0xA7, 0xAE, 0xB8, 0xFF, 0xA5, 0xAC, 0xB6, 0xFF, 0xA5, 0xAC, 0xB7, 0xFF, 0xA3, 0xA9, 0xB4, 0xFF, 0x45, 0x49, 0x54,
+    0xFF, 0x06, 0x08, 0x12, 0xFF, 0x07, 0x0B, 0x18, 0xFF, 0x06, 0x0A, 0x16, 0xFF, 0x05, 0x08, 0x14, 0xFF, 0x05, 0x08, 0x12, 0xFF, 0x04, 0x07, 0x10,
+    0xFF, 0x03, 0x06, 0x0F, 0xFF, 0x03, 0x06, 0x0D, 0xFF, 0x80, 0x02, 0x05, 0x0C, 0xFF, 0x80, 0x01, 0x05, 0x0B, 0xFF, 0x00, 0x01, 0x04, 0x0B, 0xFF,
+    0x80, 0x01, 0x04, 0x0A, 0xFF, 0x01, 0x01, 0x03, 0x0A, 0xFF, 0x01, 0x04, 0x09, 0xFF, 0x85, 0x01, 0x03, 0x09, 0xFF, 0x80, 0x01, 0x03, 0x08, 0xFF,
+    0x00, 0x00, 0x02, 0x08, 0xFF, 0x81, 0x01, 0x03, 0x08, 0xFF, 0x00, 0x01, 0x02, 0x08, 0xFF, 0x80, 0x01, 0x02, 0x07, 0xFF, 0x80, 0x01, 0x02, 0x06,
+    0xFF, 0x01, 0x01, 0x03, 0x07, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x82, 0x01, 0x02, 0x06, 0xFF, 0x03, 0x01, 0x02, 0x05, 0xFF, 0x00, 0x02, 0x04, 0xFF,
+    0x00, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x80, 0x00, 0x02, 0x05, 0xFF, 0x07, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x02, 0x05, 0xFF, 0x00, 0x02,
+    0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x00,
+    0x01, 0x00, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x81, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x06, 0x01, 0x01, 0x03, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x01, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x02,
+    0xFF, 0x01, 0x01, 0x04, 0xFF, 0x02, 0x02, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x83, 0x01, 0x02, 0x04, 0xFF, 0x0B, 0x02, 0x02, 0x06, 0xFF, 0x01,
+    0x03, 0x05, 0xFF, 0x01, 0x04, 0x07, 0xFF, 0x02, 0x05, 0x09, 0xFF, 0x01, 0x05, 0x09, 0xFF, 0x01, 0x07, 0x0A, 0xFF, 0x1D, 0x23, 0x2C, 0xFF, 0x29,
+    0x2E, 0x3B, 0xFF, 0x2A, 0x2F, 0x3D, 0xFF, 0x2B, 0x31, 0x3F, 0xFF, 0x2E, 0x34, 0x42, 0xFF, 0x2F, 0x36, 0x43, 0xFF, 0x80, 0x2E, 0x35, 0x43, 0xFF,
+    0x2C, 0x32, 0x39, 0x49, 0xFF, 0x38, 0x3F, 0x50, 0xFF, 0x3E, 0x46, 0x5A, 0xFF, 0x46, 0x4E, 0x64, 0xFF, 0x47, 0x4F, 0x64, 0xFF, 0x51, 0x59, 0x69,
+    0xFF, 0xC7, 0xCE, 0xD2, 0xFF, 0xB9, 0xC3, 0xCA, 0xFF, 0xA4, 0xAD, 0xBA, 0xFF, 0xCB, 0xD1, 0xD6, 0xFF, 0xB4, 0xB8, 0xBE, 0xFF, 0x2B, 0x2F, 0x35,
+    0xFF, 0x09, 0x0E, 0x19, 0xFF, 0x06, 0x09, 0x14, 0xFF, 0x25, 0x29, 0x36, 0xFF, 0x47, 0x50, 0x65, 0xFF, 0x42, 0x4B, 0x61, 0xFF, 0x47, 0x50, 0x66,
+    0xFF, 0x46, 0x4F, 0x65, 0xFF, 0x48, 0x50, 0x67, 0xFF, 0x49, 0x51, 0x68, 0xFF, 0x4A, 0x53, 0x6A, 0xFF, 0x4E, 0x57, 0x6E, 0xFF, 0x52, 0x5B, 0x72,
+    0xFF, 0x58, 0x61, 0x78, 0xFF, 0x5A, 0x62, 0x7A, 0xFF, 0x5D, 0x67, 0x7C, 0xFF, 0x60, 0x6A, 0x7E, 0xFF, 0x63, 0x6C, 0x81, 0xFF, 0x68, 0x71, 0x86,
+    0xFF, 0x6E, 0x78, 0x8D, 0xFF, 0x72, 0x7C, 0x90, 0xFF, 0x79, 0x84, 0x97, 0xFF, 0xB3, 0xBA, 0xC2, 0xFF, 0xEA, 0xED, 0xED, 0xFF, 0xCF, 0xD2, 0xD5,
+    0xFF, 0x9A, 0x9F, 0xA6, 0xFF, 0x2B, 0x2F, 0x3A, 0xFF, 0x10, 0x16, 0x27, 0xFF, 0x0D, 0x13, 0x23, 0xFF, 0x09, 0x0F, 0x1E, 0xFF, 0x08, 0x0C, 0x19,
+    0xFF, 0x06, 0x0A, 0x16, 0xFF, 0x06, 0x07, 0x14, 0xFF, 0x06, 0x07, 0x12, 0xFF, 0x80, 0x05, 0x06, 0x11, 0xFF, 0x81, 0x04, 0x05, 0x0F, 0xFF, 0x19,
+    0x04, 0x04, 0x0E, 0xFF, 0x04, 0x05, 0x0E, 0xFF, 0x04, 0x05, 0x0F, 0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x04, 0x05, 0x10, 0xFF, 0x04, 0x06, 0x10, 0xFF,
+    0x05, 0x06, 0x10, 0xFF, 0x05, 0x07, 0x11, 0xFF, 0x05, 0x0A, 0x13, 0xFF, 0x06, 0x0B, 0x15, 0xFF, 0x07, 0x0C, 0x18, 0xFF, 0x09, 0x0E, 0x1C, 0xFF,
+    0x0B, 0x11, 0x20, 0xFF, 0x0D, 0x11, 0x1A, 0xFF, 0x68, 0x6C, 0x76, 0xFF, 0xBC, 0xC0, 0xC8, 0xFF, 0xB6, 0xBA, 0xC2, 0xFF, 0xB4, 0xB9, 0xC1, 0xFF,
+    0xB5, 0xB8, 0xC1, 0xFF, 0xB5, 0xB9, 0xC1, 0xFF, 0xB4, 0xB7, 0xC1, 0xFF, 0xB3, 0xB7, 0xC0, 0xFF, 0xB3, 0xB7, 0xC1, 0xFF, 0xB2, 0xB7, 0xC1, 0xFF,
+    0xB2, 0xB5, 0xBF, 0xFF, 0xB3, 0xB7, 0xC1, 0xFF, 0x80, 0xB4, 0xB8, 0xC2, 0xFF, 0x13, 0xB5, 0xB9, 0xC3, 0xFF, 0xB8, 0xBC, 0xC5, 0xFF, 0xBA, 0xBE,
+    0xC7, 0xFF, 0xBC, 0xBF, 0xC8, 0xFF, 0xC0, 0xC3, 0xCB, 0xFF, 0xD7, 0xDA, 0xDF, 0xFF, 0xA1, 0xA6, 0xB0, 0xFF, 0x51, 0x56, 0x63, 0xFF, 0x04, 0x06,
+    0x10, 0xFF, 0x0A, 0x0E, 0x1B, 0xFF, 0x08, 0x0B, 0x17, 0xFF, 0x07, 0x0A, 0x14, 0xFF, 0x06, 0x09, 0x12, 0xFF, 0x05, 0x08, 0x11, 0xFF, 0x04, 0x07,
+    0x0F, 0xFF, 0x04, 0x06, 0x0E, 0xFF, 0x03, 0x06, 0x0D, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x02, 0x05, 0x0B, 0xFF, 0x82, 0x02,
+    0x04, 0x0B, 0xFF, 0x00, 0x01, 0x04, 0x0A, 0xFF, 0x82, 0x02, 0x04, 0x0A, 0xFF, 0x80, 0x01, 0x03, 0x0A, 0xFF, 0x09, 0x02, 0x03, 0x0A, 0xFF, 0x01,
+    0x03, 0x0A, 0xFF, 0x02, 0x03, 0x0A, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x01, 0x03, 0x09, 0xFF, 0x01, 0x04, 0x09, 0xFF, 0x00, 0x03, 0x09, 0xFF, 0x01,
+    0x03, 0x09, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x80, 0x02, 0x03, 0x09, 0xFF, 0x01, 0x02, 0x03, 0x08, 0xFF, 0x01, 0x03, 0x09,
+    0xFF, 0x80, 0x02, 0x04, 0x09, 0xFF, 0x01, 0x02, 0x03, 0x09, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x80, 0x02, 0x03, 0x09, 0xFF, 0x02, 0x02, 0x04, 0x09,
+    0xFF, 0x01, 0x03, 0x08, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x81, 0x01, 0x03, 0x09, 0xFF, 0x02, 0x01, 0x02, 0x08, 0xFF, 0x00, 0x02, 0x08, 0xFF, 0x01,
+    0x03, 0x09, 0xFF, 0x80, 0x01, 0x02, 0x08, 0xFF, 0x82, 0x01, 0x02, 0x09, 0xFF, 0x02, 0x01, 0x03, 0x09, 0xFF, 0x01, 0x03, 0x0A, 0xFF, 0x01, 0x02,
+    0x0A, 0xFF, 0x81, 0x02, 0x03, 0x0A, 0xFF, 0x00, 0x01, 0x03, 0x0A, 0xFF, 0x80, 0x02, 0x04, 0x0B, 0xFF, 0x80, 0x02, 0x05, 0x0C, 0xFF, 0x02, 0x02,
+    0x04, 0x0C, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x02, 0x05, 0x0D, 0xFF, 0x80, 0x03, 0x05, 0x0E, 0xFF, 0x00, 0x04, 0x06, 0x0F, 0xFF, 0x80, 0x04, 0x06,
+    0x10, 0xFF, 0x0E, 0x05, 0x07, 0x11, 0xFF, 0x05, 0x08, 0x14, 0xFF, 0x06, 0x09, 0x15, 0xFF, 0x06, 0x0A, 0x16, 0xFF, 0x08, 0x0C, 0x18, 0xFF, 0x0A,
+    0x0D, 0x1B, 0xFF, 0x0C, 0x0F, 0x21, 0xFF, 0x06, 0x09, 0x16, 0xFF, 0x33, 0x39, 0x49, 0xFF, 0x96, 0x9A, 0xA5, 0xFF, 0xA7, 0xAA, 0xB4, 0xFF, 0xDD,
+    0xDE, 0xE0, 0xFF, 0xC1, 0xC4, 0xCB, 0xFF, 0xBD, 0xC0, 0xC8, 0xFF, 0xBC, 0xC0, 0xC8, 0xFF, 0x80, 0xB9, 0xBE, 0xC6, 0xFF, 0x00, 0xB9, 0xBE, 0xC5,
+    0xFF, 0x80, 0xB8, 0xBE, 0xC6, 0xFF, 0x80, 0xB8, 0xBD, 0xC5, 0xFF, 0x1F, 0xBB, 0xC1, 0xC9, 0xFF, 0x90, 0x96, 0xA3, 0xFF, 0x27, 0x2E, 0x3D, 0xFF,
+    0x18, 0x21, 0x38, 0xFF, 0x17, 0x20, 0x35, 0xFF, 0x52, 0x59, 0x69, 0xFF, 0xB5, 0xBB, 0xC3, 0xFF, 0xCB, 0xD1, 0xD5, 0xFF, 0xC9, 0xCE, 0xD2, 0xFF,
+    0xAD, 0xB4, 0xBB, 0xFF, 0xB0, 0xB5, 0xBE, 0xFF, 0xAF, 0xB4, 0xBC, 0xFF, 0xAF, 0xB3, 0xBC, 0xFF, 0xAE, 0xB3, 0xBB, 0xFF, 0xAB, 0xB1, 0xBA, 0xFF,
+    0xA9, 0xAF, 0xB9, 0xFF, 0xA9, 0xAE, 0xB9, 0xFF, 0xA8, 0xAF, 0xB9, 0xFF, 0xA5, 0xAD, 0xB7, 0xFF, 0xA1, 0xA8, 0xB4, 0xFF, 0xA0, 0xA8, 0xB4, 0xFF,
+    0xA3, 0xA9, 0xB5, 0xFF, 0x54, 0x58, 0x66, 0xFF, 0x02, 0x05, 0x10, 0xFF, 0x07, 0x0C, 0x1A, 0xFF, 0x06, 0x0A, 0x18, 0xFF, 0x06, 0x09, 0x14, 0xFF,
+    0x05, 0x08, 0x13, 0xFF, 0x04, 0x08, 0x11, 0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x03, 0x06, 0x0E, 0xFF, 0x02, 0x06, 0x0D, 0xFF, 0x80, 0x02, 0x05, 0x0C,
+    0xFF, 0x00, 0x02, 0x05, 0x0B, 0xFF, 0x83, 0x01, 0x04, 0x0B, 0xFF, 0x80, 0x01, 0x03, 0x0A, 0xFF, 0x00, 0x01, 0x04, 0x0A, 0xFF, 0x81, 0x01, 0x03,
+    0x0A, 0xFF, 0x82, 0x01, 0x03, 0x09, 0xFF, 0x02, 0x01, 0x03, 0x08, 0xFF, 0x01, 0x02, 0x08, 0xFF, 0x00, 0x03, 0x08, 0xFF, 0x80, 0x01, 0x02, 0x08,
+    0xFF, 0x80, 0x01, 0x03, 0x08, 0xFF, 0x01, 0x01, 0x03, 0x07, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x80, 0x01, 0x03, 0x07, 0xFF, 0x04, 0x00, 0x02, 0x06,
+    0xFF, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x00, 0x02, 0x06, 0xFF, 0x80, 0x01, 0x03, 0x05, 0xFF, 0x83, 0x01,
+    0x02, 0x05, 0xFF, 0x04, 0x00, 0x02, 0x04, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x00, 0x01, 0x05, 0xFF,
+    0x81, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0x01, 0x00, 0xFF, 0x81, 0x00, 0x01, 0x02, 0xFF, 0x06, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x01,
+    0x02, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x80, 0x01, 0x02, 0x04, 0xFF, 0x0B, 0x02, 0x02, 0x06,
+    0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x00, 0x04, 0x06, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x01, 0x05, 0x08, 0xFF, 0x02, 0x06, 0x0A,
+    0xFF, 0x1C, 0x22, 0x2A, 0xFF, 0x25, 0x2B, 0x37, 0xFF, 0x28, 0x2E, 0x3C, 0xFF, 0x2B, 0x31, 0x3F, 0xFF, 0x2D, 0x32, 0x41, 0xFF, 0x80, 0x2C, 0x32,
+    0x40, 0xFF, 0x43, 0x2D, 0x34, 0x44, 0xFF, 0x32, 0x38, 0x49, 0xFF, 0x3A, 0x41, 0x53, 0xFF, 0x3E, 0x46, 0x5C, 0xFF, 0x44, 0x4C, 0x61, 0xFF, 0x45,
+    0x4E, 0x61, 0xFF, 0x46, 0x4D, 0x5D, 0xFF, 0xC2, 0xC6, 0xCB, 0xFF, 0xB7, 0xC0, 0xC8, 0xFF, 0x88, 0x91, 0xA3, 0xFF, 0xB2, 0xB9, 0xC4, 0xFF, 0xBF,
+    0xC3, 0xCA, 0xFF, 0x47, 0x4C, 0x54, 0xFF, 0x08, 0x0A, 0x12, 0xFF, 0x05, 0x07, 0x0F, 0xFF, 0x1F, 0x24, 0x2F, 0xFF, 0x49, 0x53, 0x68, 0xFF, 0x48,
+    0x52, 0x68, 0xFF, 0x50, 0x59, 0x6F, 0xFF, 0x4F, 0x58, 0x6E, 0xFF, 0x4F, 0x57, 0x6E, 0xFF, 0x4E, 0x57, 0x6E, 0xFF, 0x51, 0x5B, 0x72, 0xFF, 0x57,
+    0x61, 0x77, 0xFF, 0x5D, 0x67, 0x7C, 0xFF, 0x63, 0x6B, 0x80, 0xFF, 0x62, 0x6B, 0x80, 0xFF, 0x60, 0x6A, 0x7F, 0xFF, 0x61, 0x69, 0x7E, 0xFF, 0x63,
+    0x6B, 0x81, 0xFF, 0x69, 0x72, 0x87, 0xFF, 0x71, 0x7C, 0x90, 0xFF, 0x76, 0x82, 0x97, 0xFF, 0x7C, 0x8A, 0x9E, 0xFF, 0x98, 0xA2, 0xB1, 0xFF, 0xDF,
+    0xE2, 0xE4, 0xFF, 0xE1, 0xE3, 0xE6, 0xFF, 0xD3, 0xD5, 0xD9, 0xFF, 0x7D, 0x81, 0x8D, 0xFF, 0x1E, 0x22, 0x30, 0xFF, 0x0D, 0x13, 0x24, 0xFF, 0x0B,
+    0x10, 0x1F, 0xFF, 0x08, 0x0D, 0x1B, 0xFF, 0x06, 0x0A, 0x17, 0xFF, 0x06, 0x09, 0x15, 0xFF, 0x06, 0x08, 0x13, 0xFF, 0x05, 0x07, 0x12, 0xFF, 0x05,
+    0x06, 0x12, 0xFF, 0x04, 0x05, 0x11, 0xFF, 0x04, 0x05, 0x10, 0xFF, 0x04, 0x05, 0x0F, 0xFF, 0x03, 0x05, 0x0F, 0xFF, 0x04, 0x05, 0x0F, 0xFF, 0x04,
+    0x05, 0x0E, 0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x04, 0x06, 0x10, 0xFF, 0x05, 0x06, 0x10, 0xFF, 0x05, 0x07, 0x11, 0xFF, 0x05, 0x08, 0x11, 0xFF, 0x05,
+    0x09, 0x14, 0xFF, 0x06, 0x0B, 0x17, 0xFF, 0x07, 0x0D, 0x1A, 0xFF, 0x0A, 0x0E, 0x1D, 0xFF, 0x07, 0x0C, 0x18, 0xFF, 0x33, 0x37, 0x3F, 0xFF, 0x9F,
+    0xA5, 0xB0, 0xFF, 0xB4, 0xBA, 0xC4, 0xFF, 0xB2, 0xB7, 0xC1, 0xFF, 0x80, 0xB4, 0xB8, 0xC2, 0xFF, 0x18, 0xB5, 0xB8, 0xC2, 0xFF, 0xB5, 0xB9, 0xC2,
+    0xFF, 0xB5, 0xB9, 0xC3, 0xFF, 0xB4, 0xB8, 0xC2, 0xFF, 0xB3, 0xB7, 0xC2, 0xFF, 0xB1, 0xB6, 0xC1, 0xFF, 0xB1, 0xB5, 0xC1, 0xFF, 0xB3, 0xB6, 0xC1,
+    0xFF, 0xB3, 0xB7, 0xC2, 0xFF, 0xB4, 0xB9, 0xC3, 0xFF, 0xB6, 0xBA, 0xC4, 0xFF, 0xB9, 0xBC, 0xC6, 0xFF, 0xBA, 0xBE, 0xC7, 0xFF, 0xBD, 0xC1, 0xC9,
+    0xFF, 0xD1, 0xD5, 0xDB, 0xFF, 0x9F, 0xA4, 0xAF, 0xFF, 0x55, 0x59, 0x65, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x0B, 0x0F, 0x1C, 0xFF, 0x09, 0x0C, 0x18,
+    0xFF, 0x07, 0x0B, 0x15, 0xFF, 0x05, 0x09, 0x14, 0xFF, 0x05, 0x09, 0x12, 0xFF, 0x04, 0x07, 0x0F, 0xFF, 0x03, 0x05, 0x0E, 0xFF, 0x80, 0x03, 0x05,
+    0x0D, 0xFF, 0x00, 0x03, 0x05, 0x0C, 0xFF, 0x80, 0x03, 0x04, 0x0B, 0xFF, 0x80, 0x02, 0x04, 0x0B, 0xFF, 0x00, 0x03, 0x04, 0x0B, 0xFF, 0x8B, 0x02,
+    0x04, 0x0A, 0xFF, 0x02, 0x02, 0x04, 0x09, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x81, 0x02, 0x04, 0x0A, 0xFF, 0x80, 0x02, 0x04,
+    0x09, 0xFF, 0x80, 0x02, 0x04, 0x0A, 0xFF, 0x83, 0x02, 0x03, 0x09, 0xFF, 0x01, 0x01, 0x03, 0x09, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x80, 0x01, 0x03,
+    0x09, 0xFF, 0x05, 0x01, 0x02, 0x08, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x01, 0x02, 0x08, 0xFF, 0x02, 0x02, 0x08, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x02,
+    0x02, 0x08, 0xFF, 0x81, 0x01, 0x02, 0x09, 0xFF, 0x03, 0x02, 0x02, 0x09, 0xFF, 0x01, 0x02, 0x09, 0xFF, 0x02, 0x03, 0x0A, 0xFF, 0x02, 0x03, 0x09,
+    0xFF, 0x80, 0x02, 0x03, 0x0B, 0xFF, 0x00, 0x02, 0x04, 0x0A, 0xFF, 0x80, 0x02, 0x04, 0x0B, 0xFF, 0x00, 0x02, 0x04, 0x0C, 0xFF, 0x80, 0x02, 0x05,
+    0x0C, 0xFF, 0x80, 0x03, 0x05, 0x0D, 0xFF, 0x15, 0x03, 0x06, 0x0E, 0xFF, 0x03, 0x05, 0x0F, 0xFF, 0x03, 0x06, 0x0F, 0xFF, 0x04, 0x06, 0x0F, 0xFF,
+    0x04, 0x06, 0x10, 0xFF, 0x05, 0x07, 0x11, 0xFF, 0x05, 0x08, 0x12, 0xFF, 0x06, 0x09, 0x14, 0xFF, 0x06, 0x0A, 0x16, 0xFF, 0x06, 0x0A, 0x17, 0xFF,
+    0x08, 0x0B, 0x18, 0xFF, 0x0A, 0x0D, 0x1B, 0xFF, 0x0C, 0x0F, 0x20, 0xFF, 0x06, 0x09, 0x15, 0xFF, 0x34, 0x3B, 0x4C, 0xFF, 0x95, 0x9A, 0xA5, 0xFF,
+    0xA5, 0xA8, 0xB3, 0xFF, 0xDC, 0xDD, 0xE0, 0xFF, 0xBE, 0xC1, 0xC9, 0xFF, 0xB9, 0xBE, 0xC6, 0xFF, 0xB9, 0xBD, 0xC6, 0xFF, 0xB8, 0xBC, 0xC5, 0xFF,
+    0x80, 0xB5, 0xBB, 0xC4, 0xFF, 0x13, 0xB5, 0xBB, 0xC3, 0xFF, 0xB4, 0xBA, 0xC3, 0xFF, 0xB4, 0xB9, 0xC2, 0xFF, 0xB4, 0xB9, 0xC3, 0xFF, 0xB6, 0xBD,
+    0xC5, 0xFF, 0x89, 0x91, 0x9E, 0xFF, 0x25, 0x2C, 0x3B, 0xFF, 0x16, 0x1F, 0x37, 0xFF, 0x1A, 0x21, 0x34, 0xFF, 0x9A, 0xA1, 0xAB, 0xFF, 0xBE, 0xC2,
+    0xC8, 0xFF, 0xBB, 0xC1, 0xC9, 0xFF, 0xC2, 0xC8, 0xCD, 0xFF, 0xAB, 0xB1, 0xBA, 0xFF, 0xAC, 0xB2, 0xBB, 0xFF, 0xA9, 0xB0, 0xB9, 0xFF, 0xA8, 0xAE,
+    0xB9, 0xFF, 0xA6, 0xAC, 0xB8, 0xFF, 0xA4, 0xAB, 0xB7, 0xFF, 0xA3, 0xAA, 0xB6, 0xFF, 0x80, 0xA2, 0xA9, 0xB5, 0xFF, 0x0C, 0xA0, 0xA8, 0xB4, 0xFF,
+    0x9E, 0xA5, 0xB3, 0xFF, 0x9E, 0xA5, 0xB2, 0xFF, 0xA0, 0xA6, 0xB3, 0xFF, 0x60, 0x66, 0x77, 0xFF, 0x06, 0x0C, 0x1A, 0xFF, 0x07, 0x0C, 0x1A, 0xFF,
+    0x07, 0x0B, 0x19, 0xFF, 0x06, 0x09, 0x16, 0xFF, 0x05, 0x08, 0x13, 0xFF, 0x05, 0x08, 0x11, 0xFF, 0x04, 0x07, 0x0F, 0xFF, 0x03, 0x06, 0x0E, 0xFF,
+    0x80, 0x03, 0x05, 0x0D, 0xFF, 0x03, 0x02, 0x05, 0x0C, 0xFF, 0x01, 0x04, 0x0C, 0xFF, 0x02, 0x05, 0x0B, 0xFF, 0x01, 0x04, 0x0B, 0xFF, 0x81, 0x02,
+    0x04, 0x0B, 0xFF, 0x00, 0x01, 0x04, 0x0B, 0xFF, 0x82, 0x01, 0x04, 0x0A, 0xFF, 0x01, 0x01, 0x03, 0x0A, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x81, 0x01,
+    0x03, 0x0A, 0xFF, 0x00, 0x01, 0x03, 0x09, 0xFF, 0x85, 0x01, 0x03, 0x08, 0xFF, 0x00, 0x01, 0x03, 0x07, 0xFF, 0x80, 0x01, 0x03, 0x06, 0xFF, 0x80,
+    0x01, 0x03, 0x07, 0xFF, 0x0B, 0x01, 0x03, 0x06, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x00, 0x03, 0x05,
+    0xFF, 0x01, 0x02, 0x05, 0xFF, 0x00, 0x02, 0x05, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x04,
+    0xFF, 0x01, 0x02, 0x04, 0xFF, 0x80, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x01, 0x05, 0xFF, 0x06, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x02, 0xFF, 0x24, 0x01, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x03, 0xFF,
+    0x00, 0x01, 0x03, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x00, 0x02, 0x03, 0xFF, 0x02, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x01, 0x02, 0x05, 0xFF,
+    0x01, 0x02, 0x04, 0xFF, 0x02, 0x02, 0x05, 0xFF, 0x01, 0x03, 0x05, 0xFF, 0x02, 0x03, 0x07, 0xFF, 0x00, 0x04, 0x07, 0xFF, 0x02, 0x04, 0x07, 0xFF,
+    0x01, 0x04, 0x08, 0xFF, 0x03, 0x07, 0x0C, 0xFF, 0x1A, 0x20, 0x27, 0xFF, 0x21, 0x27, 0x31, 0xFF, 0x26, 0x2C, 0x39, 0xFF, 0x2C, 0x31, 0x40, 0xFF,
+    0x2C, 0x33, 0x41, 0xFF, 0x2B, 0x30, 0x3F, 0xFF, 0x2A, 0x30, 0x3F, 0xFF, 0x2D, 0x34, 0x44, 0xFF, 0x33, 0x3A, 0x4D, 0xFF, 0x38, 0x3F, 0x52, 0xFF,
+    0x3C, 0x43, 0x58, 0xFF, 0x42, 0x49, 0x5E, 0xFF, 0x41, 0x49, 0x5D, 0xFF, 0x47, 0x4D, 0x5D, 0xFF, 0xBD, 0xC2, 0xC8, 0xFF, 0xA8, 0xAF, 0xBB, 0xFF,
+    0x6D, 0x73, 0x8B, 0xFF, 0x97, 0x9D, 0xAF, 0xFF, 0xAF, 0xB4, 0xC1, 0xFF, 0x52, 0x56, 0x63, 0xFF, 0x80, 0x03, 0x05, 0x09, 0xFF, 0x23, 0x1C, 0x22,
+    0x2D, 0xFF, 0x47, 0x50, 0x63, 0xFF, 0x48, 0x52, 0x67, 0xFF, 0x4B, 0x54, 0x6A, 0xFF, 0x49, 0x52, 0x68, 0xFF, 0x48, 0x52, 0x69, 0xFF, 0x4C, 0x56,
+    0x6D, 0xFF, 0x50, 0x5A, 0x70, 0xFF, 0x55, 0x60, 0x75, 0xFF, 0x5D, 0x66, 0x7C, 0xFF, 0x62, 0x6B, 0x7E, 0xFF, 0x61, 0x6A, 0x7E, 0xFF, 0x5D, 0x66,
+    0x7C, 0xFF, 0x5B, 0x64, 0x7A, 0xFF, 0x5D, 0x66, 0x7D, 0xFF, 0x64, 0x6D, 0x83, 0xFF, 0x6C, 0x76, 0x8B, 0xFF, 0x75, 0x80, 0x94, 0xFF, 0x7C, 0x88,
+    0x9B, 0xFF, 0x81, 0x8C, 0x9F, 0xFF, 0xC0, 0xC4, 0xCC, 0xFF, 0xE8, 0xE9, 0xEA, 0xFF, 0xCF, 0xD1, 0xD6, 0xFF, 0xC6, 0xCA, 0xD0, 0xFF, 0x43, 0x49,
+    0x56, 0xFF, 0x08, 0x0D, 0x19, 0xFF, 0x0C, 0x10, 0x20, 0xFF, 0x08, 0x0C, 0x1B, 0xFF, 0x06, 0x0A, 0x18, 0xFF, 0x06, 0x0A, 0x16, 0xFF, 0x06, 0x08,
+    0x15, 0xFF, 0x06, 0x07, 0x13, 0xFF, 0x05, 0x06, 0x12, 0xFF, 0x05, 0x06, 0x11, 0xFF, 0x05, 0x05, 0x11, 0xFF, 0x05, 0x05, 0x10, 0xFF, 0x81, 0x04,
+    0x05, 0x10, 0xFF, 0x2D, 0x04, 0x06, 0x10, 0xFF, 0x04, 0x05, 0x10, 0xFF, 0x05, 0x06, 0x11, 0xFF, 0x05, 0x07, 0x12, 0xFF, 0x05, 0x08, 0x12, 0xFF,
+    0x06, 0x09, 0x14, 0xFF, 0x06, 0x0A, 0x17, 0xFF, 0x07, 0x0D, 0x1A, 0xFF, 0x0A, 0x0E, 0x1D, 0xFF, 0x04, 0x07, 0x0F, 0xFF, 0x4C, 0x50, 0x5A, 0xFF,
+    0xB3, 0xB7, 0xC2, 0xFF, 0xAE, 0xB3, 0xBE, 0xFF, 0xAE, 0xB3, 0xBF, 0xFF, 0xB1, 0xB5, 0xC1, 0xFF, 0xB2, 0xB6, 0xC1, 0xFF, 0xB2, 0xB6, 0xC2, 0xFF,
+    0xB3, 0xB7, 0xC2, 0xFF, 0xB4, 0xB8, 0xC2, 0xFF, 0xB3, 0xB7, 0xC2, 0xFF, 0xB1, 0xB5, 0xC1, 0xFF, 0xAF, 0xB4, 0xC0, 0xFF, 0xB0, 0xB4, 0xC0, 0xFF,
+    0xB0, 0xB5, 0xC0, 0xFF, 0xB2, 0xB7, 0xC1, 0xFF, 0xB3, 0xB8, 0xC3, 0xFF, 0xB5, 0xB9, 0xC4, 0xFF, 0xB6, 0xBA, 0xC4, 0xFF, 0xB7, 0xBB, 0xC5, 0xFF,
+    0xB8, 0xBC, 0xC6, 0xFF, 0xCC, 0xD0, 0xD7, 0xFF, 0x9C, 0xA1, 0xAD, 0xFF, 0x52, 0x56, 0x63, 0xFF, 0x03, 0x05, 0x0B, 0xFF, 0x0B, 0x0F, 0x1D, 0xFF,
+    0x09, 0x0D, 0x18, 0xFF, 0x06, 0x0B, 0x15, 0xFF, 0x05, 0x09, 0x13, 0xFF, 0x05, 0x08, 0x12, 0xFF, 0x04, 0x07, 0x10, 0xFF, 0x04, 0x06, 0x0E, 0xFF,
+    0x03, 0x06, 0x0E, 0xFF, 0x03, 0x06, 0x0D, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x02, 0x05, 0x0C, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x80, 0x02, 0x04, 0x0C,
+    0xFF, 0x09, 0x03, 0x04, 0x0B, 0xFF, 0x02, 0x03, 0x0B, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x03, 0x04, 0x0B, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x02, 0x03,
+    0x0B, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x03, 0x04, 0x0C, 0xFF, 0x03, 0x04, 0x0B, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x80, 0x03, 0x04, 0x0B, 0xFF, 0x80,
+    0x02, 0x04, 0x0B, 0xFF, 0x80, 0x03, 0x04, 0x0B, 0xFF, 0x80, 0x02, 0x04, 0x0B, 0xFF, 0x01, 0x02, 0x03, 0x0A, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x80,
+    0x02, 0x04, 0x0A, 0xFF, 0x02, 0x02, 0x03, 0x0A, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x02, 0x03, 0x0A, 0xFF, 0x80, 0x02, 0x04, 0x0A, 0xFF, 0x10, 0x02,
+    0x03, 0x0A, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x01, 0x03, 0x09, 0xFF, 0x01, 0x02, 0x09, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x02, 0x03, 0x0A, 0xFF, 0x02,
+    0x02, 0x09, 0xFF, 0x02, 0x03, 0x0A, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x02, 0x02, 0x09, 0xFF, 0x01, 0x03, 0x09, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x02,
+    0x03, 0x0A, 0xFF, 0x02, 0x02, 0x0A, 0xFF, 0x01, 0x03, 0x0A, 0xFF, 0x02, 0x03, 0x0A, 0xFF, 0x02, 0x03, 0x0B, 0xFF, 0x80, 0x02, 0x03, 0x0A, 0xFF,
+    0x00, 0x02, 0x03, 0x0B, 0xFF, 0x80, 0x02, 0x04, 0x0B, 0xFF, 0x81, 0x02, 0x04, 0x0C, 0xFF, 0x80, 0x03, 0x05, 0x0D, 0xFF, 0x4D, 0x02, 0x05, 0x0E,
+    0xFF, 0x03, 0x05, 0x0E, 0xFF, 0x04, 0x05, 0x0F, 0xFF, 0x03, 0x06, 0x0F, 0xFF, 0x03, 0x07, 0x10, 0xFF, 0x04, 0x06, 0x11, 0xFF, 0x04, 0x07, 0x11,
+    0xFF, 0x05, 0x07, 0x12, 0xFF, 0x06, 0x07, 0x13, 0xFF, 0x07, 0x09, 0x15, 0xFF, 0x07, 0x0A, 0x16, 0xFF, 0x08, 0x0B, 0x18, 0xFF, 0x09, 0x0C, 0x1A,
+    0xFF, 0x0A, 0x0D, 0x1C, 0xFF, 0x0D, 0x10, 0x20, 0xFF, 0x06, 0x09, 0x16, 0xFF, 0x34, 0x3B, 0x4C, 0xFF, 0x92, 0x96, 0xA3, 0xFF, 0xA2, 0xA6, 0xB2,
+    0xFF, 0xD9, 0xDB, 0xDE, 0xFF, 0xBB, 0xBE, 0xC7, 0xFF, 0xB8, 0xBC, 0xC6, 0xFF, 0xB7, 0xBC, 0xC5, 0xFF, 0xB5, 0xBA, 0xC4, 0xFF, 0xB2, 0xB7, 0xC2,
+    0xFF, 0xB0, 0xB6, 0xC2, 0xFF, 0xB1, 0xB6, 0xC2, 0xFF, 0xB1, 0xB6, 0xC1, 0xFF, 0xB0, 0xB6, 0xC1, 0xFF, 0xAF, 0xB6, 0xC1, 0xFF, 0xB1, 0xB8, 0xC2,
+    0xFF, 0x84, 0x8D, 0x9B, 0xFF, 0x24, 0x2B, 0x39, 0xFF, 0x14, 0x1A, 0x33, 0xFF, 0x2C, 0x30, 0x40, 0xFF, 0xAA, 0xAE, 0xB7, 0xFF, 0xB5, 0xBA, 0xC2,
+    0xFF, 0xB0, 0xB6, 0xC0, 0xFF, 0xC4, 0xCA, 0xD1, 0xFF, 0xAB, 0xB1, 0xBB, 0xFF, 0xA9, 0xAE, 0xBA, 0xFF, 0xA5, 0xAC, 0xB7, 0xFF, 0xA4, 0xAB, 0xB6,
+    0xFF, 0xA2, 0xA8, 0xB6, 0xFF, 0xA0, 0xA6, 0xB4, 0xFF, 0x9D, 0xA4, 0xB3, 0xFF, 0x9C, 0xA3, 0xB2, 0xFF, 0x9E, 0xA5, 0xB4, 0xFF, 0x9E, 0xA4, 0xB3,
+    0xFF, 0x9B, 0xA2, 0xB0, 0xFF, 0x9C, 0xA3, 0xB1, 0xFF, 0x9A, 0xA1, 0xAF, 0xFF, 0x55, 0x5C, 0x6F, 0xFF, 0x04, 0x09, 0x18, 0xFF, 0x07, 0x0C, 0x1C,
+    0xFF, 0x07, 0x0C, 0x19, 0xFF, 0x06, 0x09, 0x15, 0xFF, 0x05, 0x08, 0x13, 0xFF, 0x04, 0x07, 0x11, 0xFF, 0x04, 0x07, 0x10, 0xFF, 0x03, 0x06, 0x0F,
+    0xFF, 0x03, 0x06, 0x0E, 0xFF, 0x03, 0x05, 0x0E, 0xFF, 0x02, 0x04, 0x0D, 0xFF, 0x01, 0x05, 0x0C, 0xFF, 0x02, 0x05, 0x0C, 0xFF, 0x02, 0x04, 0x0C,
+    0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x02, 0x04, 0x0C, 0xFF, 0x02, 0x03, 0x0B, 0xFF, 0x01, 0x04, 0x0B, 0xFF, 0x01, 0x03, 0x0B, 0xFF, 0x02, 0x03, 0x0B,
+    0xFF, 0x01, 0x04, 0x0B, 0xFF, 0x01, 0x03, 0x0B, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x02, 0x03, 0x0A, 0xFF, 0x01, 0x03, 0x0A, 0xFF, 0x81, 0x01, 0x04,
+    0x0A, 0xFF, 0x00, 0x01, 0x04, 0x09, 0xFF, 0x80, 0x01, 0x03, 0x09, 0xFF, 0x80, 0x01, 0x04, 0x09, 0xFF, 0x03, 0x02, 0x04, 0x09, 0xFF, 0x01, 0x03,
+    0x08, 0xFF, 0x01, 0x04, 0x08, 0xFF, 0x01, 0x04, 0x07, 0xFF, 0x81, 0x01, 0x03, 0x07, 0xFF, 0x04, 0x01, 0x03, 0x06, 0xFF, 0x02, 0x03, 0x06, 0xFF,
+    0x01, 0x03, 0x07, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x03, 0x05, 0xFF, 0x80, 0x01, 0x02, 0x05, 0xFF, 0x80, 0x01, 0x01, 0x05, 0xFF, 0x80, 0x00,
+    0x01, 0x05, 0xFF, 0x00, 0x01, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x81,
+    0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x05, 0x00, 0x01, 0x01, 0xFF, 0x00,
+    0x01, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x80, 0x01, 0x02, 0x04, 0xFF,
+    0x80, 0x01, 0x01, 0x04, 0xFF, 0x42, 0x01, 0x02, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x03,
+    0x05, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x01, 0x04, 0x07, 0xFF, 0x01, 0x04, 0x08, 0xFF, 0x01, 0x04, 0x09, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x0F, 0x17,
+    0x1C, 0xFF, 0x1F, 0x26, 0x2E, 0xFF, 0x24, 0x2A, 0x36, 0xFF, 0x2A, 0x30, 0x3E, 0xFF, 0x2C, 0x31, 0x40, 0xFF, 0x2B, 0x2F, 0x3D, 0xFF, 0x27, 0x2D,
+    0x3B, 0xFF, 0x2C, 0x33, 0x41, 0xFF, 0x32, 0x39, 0x4A, 0xFF, 0x37, 0x3E, 0x4E, 0xFF, 0x38, 0x40, 0x53, 0xFF, 0x3E, 0x45, 0x58, 0xFF, 0x3E, 0x44,
+    0x57, 0xFF, 0x51, 0x58, 0x67, 0xFF, 0xBD, 0xC4, 0xCB, 0xFF, 0x86, 0x8E, 0xA0, 0xFF, 0x5A, 0x5E, 0x7A, 0xFF, 0x82, 0x87, 0x9E, 0xFF, 0xA0, 0xA4,
+    0xB6, 0xFF, 0x66, 0x69, 0x7A, 0xFF, 0x05, 0x05, 0x0D, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x1C, 0x21, 0x2C, 0xFF, 0x45, 0x4D, 0x61, 0xFF, 0x48, 0x51,
+    0x66, 0xFF, 0x49, 0x52, 0x68, 0xFF, 0x42, 0x4B, 0x61, 0xFF, 0x45, 0x4E, 0x64, 0xFF, 0x4A, 0x54, 0x6A, 0xFF, 0x4C, 0x56, 0x6D, 0xFF, 0x52, 0x5B,
+    0x71, 0xFF, 0x5A, 0x62, 0x78, 0xFF, 0x5E, 0x66, 0x7C, 0xFF, 0x5D, 0x65, 0x7B, 0xFF, 0x58, 0x61, 0x78, 0xFF, 0x55, 0x5F, 0x75, 0xFF, 0x58, 0x62,
+    0x78, 0xFF, 0x60, 0x6A, 0x81, 0xFF, 0x6A, 0x74, 0x8A, 0xFF, 0x71, 0x7C, 0x90, 0xFF, 0x77, 0x82, 0x95, 0xFF, 0x7F, 0x8A, 0x9D, 0xFF, 0xA2, 0xA8,
+    0xB8, 0xFF, 0xE5, 0xE8, 0xEA, 0xFF, 0xD3, 0xD5, 0xD9, 0xFF, 0xD6, 0xD8, 0xDC, 0xFF, 0x6A, 0x6F, 0x79, 0xFF, 0x07, 0x0A, 0x15, 0xFF, 0x0A, 0x10,
+    0x20, 0xFF, 0x08, 0x0D, 0x1A, 0xFF, 0x07, 0x0B, 0x18, 0xFF, 0x06, 0x09, 0x17, 0xFF, 0x06, 0x08, 0x15, 0xFF, 0x06, 0x08, 0x14, 0xFF, 0x06, 0x06,
+    0x12, 0xFF, 0x05, 0x06, 0x12, 0xFF, 0x05, 0x06, 0x11, 0xFF, 0x80, 0x05, 0x05, 0x11, 0xFF, 0x01, 0x04, 0x05, 0x11, 0xFF, 0x05, 0x05, 0x11, 0xFF,
+    0x80, 0x05, 0x06, 0x11, 0xFF, 0x25, 0x04, 0x07, 0x11, 0xFF, 0x05, 0x07, 0x12, 0xFF, 0x05, 0x09, 0x13, 0xFF, 0x06, 0x09, 0x14, 0xFF, 0x07, 0x0B,
+    0x17, 0xFF, 0x08, 0x0C, 0x1A, 0xFF, 0x09, 0x0C, 0x1A, 0xFF, 0x1A, 0x1C, 0x24, 0xFF, 0x75, 0x7B, 0x87, 0xFF, 0xAA, 0xB0, 0xBC, 0xFF, 0xA9, 0xAE,
+    0xBC, 0xFF, 0xAB, 0xB0, 0xBC, 0xFF, 0xAD, 0xB1, 0xBD, 0xFF, 0xAD, 0xB2, 0xBE, 0xFF, 0xAF, 0xB4, 0xBF, 0xFF, 0xB0, 0xB4, 0xC0, 0xFF, 0xB0, 0xB5,
+    0xBF, 0xFF, 0xB1, 0xB5, 0xBF, 0xFF, 0xAF, 0xB4, 0xBF, 0xFF, 0xAD, 0xB2, 0xBE, 0xFF, 0xAE, 0xB2, 0xBE, 0xFF, 0xAD, 0xB3, 0xBF, 0xFF, 0xAE, 0xB4,
+    0xBF, 0xFF, 0xB0, 0xB6, 0xC1, 0xFF, 0xB1, 0xB6, 0xC1, 0xFF, 0xB2, 0xB7, 0xC2, 0xFF, 0xB2, 0xB7, 0xC1, 0xFF, 0xB3, 0xB6, 0xC2, 0xFF, 0xC7, 0xCC,
+    0xD3, 0xFF, 0x98, 0x9E, 0xAB, 0xFF, 0x51, 0x56, 0x62, 0xFF, 0x04, 0x06, 0x0D, 0xFF, 0x0B, 0x10, 0x1E, 0xFF, 0x09, 0x0C, 0x19, 0xFF, 0x07, 0x0B,
+    0x16, 0xFF, 0x06, 0x0A, 0x14, 0xFF, 0x05, 0x08, 0x12, 0xFF, 0x05, 0x07, 0x10, 0xFF, 0x80, 0x04, 0x06, 0x0F, 0xFF, 0x02, 0x03, 0x06, 0x0E, 0xFF,
+    0x03, 0x05, 0x0D, 0xFF, 0x03, 0x05, 0x0E, 0xFF, 0x81, 0x03, 0x05, 0x0D, 0xFF, 0x01, 0x02, 0x04, 0x0C, 0xFF, 0x03, 0x04, 0x0D, 0xFF, 0x80, 0x03,
+    0x04, 0x0C, 0xFF, 0x80, 0x03, 0x05, 0x0C, 0xFF, 0x80, 0x03, 0x05, 0x0D, 0xFF, 0x82, 0x03, 0x05, 0x0C, 0xFF, 0x80, 0x03, 0x04, 0x0C, 0xFF, 0x80,
+    0x02, 0x05, 0x0C, 0xFF, 0x00, 0x03, 0x05, 0x0C, 0xFF, 0x80, 0x03, 0x05, 0x0B, 0xFF, 0x03, 0x03, 0x04, 0x0A, 0xFF, 0x03, 0x04, 0x0B, 0xFF, 0x02,
+    0x04, 0x0B, 0xFF, 0x03, 0x04, 0x0B, 0xFF, 0x81, 0x02, 0x04, 0x0B, 0xFF, 0x01, 0x02, 0x03, 0x0A, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x83, 0x02, 0x03,
+    0x0A, 0xFF, 0x02, 0x02, 0x02, 0x0A, 0xFF, 0x02, 0x03, 0x0A, 0xFF, 0x02, 0x03, 0x0B, 0xFF, 0x80, 0x02, 0x03, 0x0A, 0xFF, 0x00, 0x02, 0x03, 0x0B,
+    0xFF, 0x80, 0x02, 0x03, 0x0A, 0xFF, 0x80, 0x02, 0x03, 0x0B, 0xFF, 0x80, 0x02, 0x03, 0x0A, 0xFF, 0x00, 0x02, 0x03, 0x0B, 0xFF, 0x80, 0x02, 0x04,
+    0x0B, 0xFF, 0x01, 0x02, 0x04, 0x0C, 0xFF, 0x03, 0x04, 0x0D, 0xFF, 0x81, 0x03, 0x05, 0x0D, 0xFF, 0x01, 0x03, 0x05, 0x0E, 0xFF, 0x04, 0x05, 0x0E,
+    0xFF, 0x80, 0x04, 0x06, 0x0F, 0xFF, 0x00, 0x04, 0x06, 0x10, 0xFF, 0x80, 0x05, 0x07, 0x11, 0xFF, 0x38, 0x05, 0x08, 0x12, 0xFF, 0x05, 0x07, 0x12,
+    0xFF, 0x06, 0x08, 0x14, 0xFF, 0x07, 0x0A, 0x16, 0xFF, 0x07, 0x0B, 0x17, 0xFF, 0x08, 0x0B, 0x19, 0xFF, 0x09, 0x0C, 0x1A, 0xFF, 0x0B, 0x0E, 0x1E,
+    0xFF, 0x0D, 0x10, 0x21, 0xFF, 0x07, 0x0A, 0x18, 0xFF, 0x34, 0x3B, 0x4E, 0xFF, 0x90, 0x95, 0xA1, 0xFF, 0x9F, 0xA4, 0xB0, 0xFF, 0xD8, 0xDA, 0xDE,
+    0xFF, 0xB6, 0xBA, 0xC4, 0xFF, 0xB3, 0xB8, 0xC2, 0xFF, 0xB4, 0xB9, 0xC3, 0xFF, 0xB2, 0xB7, 0xC2, 0xFF, 0xB0, 0xB5, 0xC0, 0xFF, 0xAE, 0xB4, 0xC0,
+    0xFF, 0xAC, 0xB4, 0xC0, 0xFF, 0xAD, 0xB3, 0xBF, 0xFF, 0xAC, 0xB2, 0xBF, 0xFF, 0xAB, 0xB1, 0xBE, 0xFF, 0xAC, 0xB3, 0xBF, 0xFF, 0x80, 0x88, 0x98,
+    0xFF, 0x22, 0x28, 0x36, 0xFF, 0x12, 0x19, 0x31, 0xFF, 0x2C, 0x31, 0x42, 0xFF, 0xA1, 0xA6, 0xB1, 0xFF, 0xAF, 0xB5, 0xBE, 0xFF, 0x95, 0x9B, 0xAB,
+    0xFF, 0xBE, 0xC4, 0xCB, 0xFF, 0xAB, 0xB1, 0xBD, 0xFF, 0xA6, 0xAC, 0xB9, 0xFF, 0xA4, 0xAA, 0xB8, 0xFF, 0xA3, 0xA9, 0xB7, 0xFF, 0xA0, 0xA7, 0xB4,
+    0xFF, 0x9C, 0xA4, 0xB2, 0xFF, 0x98, 0xA0, 0xAF, 0xFF, 0x98, 0x9E, 0xAF, 0xFF, 0x98, 0x9F, 0xB0, 0xFF, 0x9A, 0xA0, 0xB0, 0xFF, 0x9A, 0xA0, 0xAF,
+    0xFF, 0x9C, 0xA2, 0xB2, 0xFF, 0x92, 0x98, 0xA8, 0xFF, 0x39, 0x40, 0x53, 0xFF, 0x07, 0x0B, 0x1B, 0xFF, 0x0A, 0x0F, 0x20, 0xFF, 0x07, 0x0B, 0x1A,
+    0xFF, 0x06, 0x09, 0x16, 0xFF, 0x06, 0x08, 0x13, 0xFF, 0x05, 0x07, 0x12, 0xFF, 0x04, 0x07, 0x11, 0xFF, 0x03, 0x06, 0x10, 0xFF, 0x03, 0x06, 0x0F,
+    0xFF, 0x03, 0x05, 0x0E, 0xFF, 0x80, 0x02, 0x05, 0x0E, 0xFF, 0x00, 0x02, 0x04, 0x0E, 0xFF, 0x80, 0x02, 0x04, 0x0D, 0xFF, 0x83, 0x02, 0x04, 0x0C,
+    0xFF, 0x00, 0x03, 0x04, 0x0C, 0xFF, 0x81, 0x02, 0x04, 0x0C, 0xFF, 0x06, 0x02, 0x04, 0x0B, 0xFF, 0x02, 0x03, 0x0B, 0xFF, 0x02, 0x04, 0x0B, 0xFF,
+    0x01, 0x04, 0x0B, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x01, 0x04, 0x0A, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x80, 0x02, 0x03, 0x0A, 0xFF, 0x01, 0x02, 0x04,
+    0x0A, 0xFF, 0x01, 0x04, 0x09, 0xFF, 0x80, 0x02, 0x04, 0x09, 0xFF, 0x00, 0x01, 0x04, 0x09, 0xFF, 0x81, 0x01, 0x03, 0x08, 0xFF, 0x80, 0x01, 0x03,
+    0x07, 0xFF, 0x01, 0x00, 0x03, 0x07, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x80, 0x01, 0x02, 0x06, 0xFF, 0x81, 0x01, 0x01, 0x05, 0xFF, 0x81, 0x01, 0x02,
+    0x05, 0xFF, 0x80, 0x01, 0x01, 0x05, 0xFF, 0x04, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x02, 0x01, 0xFF, 0x01, 0x01, 0x02, 0xFF,
+    0x00, 0x01, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x07, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01,
+    0x02, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x80, 0x01, 0x02, 0x04, 0xFF, 0x05,
+    0x01, 0x01, 0x04, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x02, 0x04, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x02, 0x02, 0x05, 0xFF,
+    0x80, 0x02, 0x03, 0x06, 0xFF, 0x23, 0x01, 0x04, 0x06, 0xFF, 0x01, 0x04, 0x07, 0xFF, 0x02, 0x05, 0x0A, 0xFF, 0x01, 0x04, 0x08, 0xFF, 0x08, 0x0F,
+    0x13, 0xFF, 0x20, 0x29, 0x31, 0xFF, 0x21, 0x28, 0x32, 0xFF, 0x26, 0x2C, 0x38, 0xFF, 0x29, 0x2E, 0x3C, 0xFF, 0x28, 0x2E, 0x3B, 0xFF, 0x28, 0x2F,
+    0x3B, 0xFF, 0x2D, 0x33, 0x40, 0xFF, 0x33, 0x39, 0x49, 0xFF, 0x38, 0x3E, 0x50, 0xFF, 0x3A, 0x40, 0x54, 0xFF, 0x39, 0x3F, 0x51, 0xFF, 0x3A, 0x3F,
+    0x50, 0xFF, 0x70, 0x78, 0x86, 0xFF, 0xA0, 0xA9, 0xB5, 0xFF, 0x55, 0x5B, 0x74, 0xFF, 0x4D, 0x51, 0x6C, 0xFF, 0x71, 0x76, 0x8F, 0xFF, 0x8A, 0x8F,
+    0xA4, 0xFF, 0x48, 0x4B, 0x5B, 0xFF, 0x03, 0x04, 0x0D, 0xFF, 0x03, 0x04, 0x0B, 0xFF, 0x1D, 0x22, 0x2D, 0xFF, 0x44, 0x4B, 0x60, 0xFF, 0x43, 0x4C,
+    0x61, 0xFF, 0x42, 0x4B, 0x60, 0xFF, 0x3D, 0x46, 0x5B, 0xFF, 0x40, 0x49, 0x60, 0xFF, 0x45, 0x4F, 0x65, 0xFF, 0x49, 0x52, 0x68, 0xFF, 0x4D, 0x56,
+    0x6B, 0xFF, 0x53, 0x5B, 0x72, 0xFF, 0x80, 0x57, 0x60, 0x76, 0xFF, 0x13, 0x54, 0x5D, 0x74, 0xFF, 0x53, 0x5C, 0x73, 0xFF, 0x58, 0x62, 0x78, 0xFF,
+    0x63, 0x6C, 0x81, 0xFF, 0x6A, 0x74, 0x8A, 0xFF, 0x6B, 0x76, 0x8B, 0xFF, 0x72, 0x7D, 0x91, 0xFF, 0x7A, 0x84, 0x98, 0xFF, 0x7A, 0x83, 0x96, 0xFF,
+    0xCB, 0xD1, 0xD6, 0xFF, 0xDD, 0xDF, 0xE3, 0xFF, 0xCD, 0xCE, 0xD4, 0xFF, 0xA0, 0xA4, 0xAE, 0xFF, 0x25, 0x29, 0x37, 0xFF, 0x07, 0x0C, 0x1A, 0xFF,
+    0x09, 0x0D, 0x1D, 0xFF, 0x07, 0x0B, 0x1A, 0xFF, 0x06, 0x09, 0x18, 0xFF, 0x06, 0x09, 0x15, 0xFF, 0x05, 0x08, 0x14, 0xFF, 0x81, 0x06, 0x07, 0x13,
+    0xFF, 0x80, 0x05, 0x06, 0x12, 0xFF, 0x81, 0x05, 0x06, 0x11, 0xFF, 0x17, 0x05, 0x06, 0x12, 0xFF, 0x05, 0x08, 0x12, 0xFF, 0x05, 0x09, 0x13, 0xFF,
+    0x05, 0x09, 0x15, 0xFF, 0x06, 0x0A, 0x15, 0xFF, 0x07, 0x0C, 0x17, 0xFF, 0x09, 0x0E, 0x1C, 0xFF, 0x06, 0x0A, 0x14, 0xFF, 0x33, 0x37, 0x40, 0xFF,
+    0xA0, 0xA6, 0xB3, 0xFF, 0xA3, 0xA9, 0xB7, 0xFF, 0xA4, 0xAA, 0xB9, 0xFF, 0xA6, 0xAC, 0xBA, 0xFF, 0xA8, 0xAD, 0xBA, 0xFF, 0xA9, 0xAD, 0xBB, 0xFF,
+    0xAA, 0xB0, 0xBC, 0xFF, 0xAB, 0xB0, 0xBC, 0xFF, 0xAC, 0xB1, 0xBD, 0xFF, 0xAD, 0xB2, 0xBD, 0xFF, 0xAC, 0xB0, 0xBD, 0xFF, 0xAB, 0xAF, 0xBC, 0xFF,
+    0xAB, 0xAF, 0xBB, 0xFF, 0xAB, 0xB0, 0xBD, 0xFF, 0xAC, 0xB1, 0xBE, 0xFF, 0x80, 0xAE, 0xB2, 0xBE, 0xFF, 0x12, 0xAD, 0xB2, 0xBE, 0xFF, 0xAC, 0xB1,
+    0xBD, 0xFF, 0xAC, 0xB2, 0xBE, 0xFF, 0xC4, 0xCA, 0xD1, 0xFF, 0x96, 0x9B, 0xAA, 0xFF, 0x51, 0x55, 0x63, 0xFF, 0x04, 0x07, 0x0E, 0xFF, 0x0C, 0x10,
+    0x1E, 0xFF, 0x09, 0x0D, 0x19, 0xFF, 0x07, 0x0B, 0x17, 0xFF, 0x07, 0x0B, 0x14, 0xFF, 0x06, 0x09, 0x13, 0xFF, 0x05, 0x09, 0x12, 0xFF, 0x05, 0x07,
+    0x11, 0xFF, 0x04, 0x07, 0x0F, 0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x04, 0x05, 0x0E, 0xFF, 0x04, 0x06, 0x0E, 0xFF, 0x04, 0x05, 0x0D, 0xFF, 0x80, 0x03,
+    0x05, 0x0D, 0xFF, 0x80, 0x03, 0x05, 0x0E, 0xFF, 0x00, 0x03, 0x04, 0x0D, 0xFF, 0x81, 0x03, 0x05, 0x0D, 0xFF, 0x00, 0x04, 0x05, 0x0D, 0xFF, 0x81,
+    0x03, 0x05, 0x0D, 0xFF, 0x00, 0x03, 0x06, 0x0D, 0xFF, 0x80, 0x03, 0x05, 0x0D, 0xFF, 0x03, 0x04, 0x06, 0x0C, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x03,
+    0x06, 0x0D, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x80, 0x03, 0x06, 0x0C, 0xFF, 0x01, 0x04, 0x05, 0x0C, 0xFF, 0x03, 0x06, 0x0C, 0xFF, 0x81, 0x03, 0x05,
+    0x0C, 0xFF, 0x80, 0x03, 0x05, 0x0B, 0xFF, 0x80, 0x03, 0x04, 0x0B, 0xFF, 0x80, 0x02, 0x04, 0x0B, 0xFF, 0x80, 0x02, 0x03, 0x0A, 0xFF, 0x00, 0x02,
+    0x03, 0x0B, 0xFF, 0x80, 0x02, 0x03, 0x0A, 0xFF, 0x80, 0x02, 0x03, 0x0B, 0xFF, 0x80, 0x02, 0x03, 0x0A, 0xFF, 0x01, 0x02, 0x03, 0x0B, 0xFF, 0x02,
+    0x03, 0x0A, 0xFF, 0x82, 0x02, 0x03, 0x0B, 0xFF, 0x02, 0x02, 0x04, 0x0C, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x03, 0x04, 0x0D, 0xFF, 0x80, 0x03, 0x05,
+    0x0D, 0xFF, 0x05, 0x03, 0x06, 0x0E, 0xFF, 0x04, 0x05, 0x0E, 0xFF, 0x04, 0x06, 0x0E, 0xFF, 0x04, 0x07, 0x0F, 0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x04,
+    0x07, 0x10, 0xFF, 0x80, 0x05, 0x07, 0x11, 0xFF, 0x37, 0x05, 0x07, 0x12, 0xFF, 0x05, 0x08, 0x13, 0xFF, 0x06, 0x08, 0x13, 0xFF, 0x06, 0x08, 0x14,
+    0xFF, 0x07, 0x08, 0x15, 0xFF, 0x06, 0x09, 0x16, 0xFF, 0x08, 0x0B, 0x18, 0xFF, 0x08, 0x0B, 0x1A, 0xFF, 0x0A, 0x0C, 0x1B, 0xFF, 0x0A, 0x0D, 0x1D,
+    0xFF, 0x0D, 0x11, 0x22, 0xFF, 0x08, 0x0C, 0x1A, 0xFF, 0x35, 0x3C, 0x4F, 0xFF, 0x8E, 0x93, 0xA0, 0xFF, 0x9C, 0xA0, 0xAE, 0xFF, 0xD5, 0xD7, 0xDC,
+    0xFF, 0xAF, 0xB4, 0xC0, 0xFF, 0xAE, 0xB4, 0xBF, 0xFF, 0xB0, 0xB5, 0xC0, 0xFF, 0xAE, 0xB4, 0xBF, 0xFF, 0xAD, 0xB2, 0xBE, 0xFF, 0xAB, 0xB0, 0xBC,
+    0xFF, 0xAA, 0xB1, 0xBC, 0xFF, 0xAA, 0xB2, 0xBD, 0xFF, 0xA8, 0xAF, 0xBD, 0xFF, 0xA7, 0xAF, 0xBB, 0xFF, 0xA7, 0xB0, 0xBB, 0xFF, 0x7D, 0x87, 0x96,
+    0xFF, 0x21, 0x28, 0x35, 0xFF, 0x12, 0x18, 0x32, 0xFF, 0x1D, 0x22, 0x36, 0xFF, 0x8F, 0x95, 0xA3, 0xFF, 0x9C, 0xA2, 0xB0, 0xFF, 0x6F, 0x75, 0x8A,
+    0xFF, 0xB0, 0xB6, 0xC0, 0xFF, 0xAF, 0xB5, 0xC1, 0xFF, 0xA3, 0xAA, 0xB6, 0xFF, 0xA3, 0xA9, 0xB8, 0xFF, 0xA1, 0xA7, 0xB6, 0xFF, 0x9E, 0xA4, 0xB4,
+    0xFF, 0x9B, 0xA3, 0xB3, 0xFF, 0x97, 0x9E, 0xAF, 0xFF, 0x94, 0x9B, 0xAC, 0xFF, 0x95, 0x9C, 0xAD, 0xFF, 0x96, 0x9D, 0xAE, 0xFF, 0x99, 0x9F, 0xAF,
+    0xFF, 0x9A, 0xA1, 0xAF, 0xFF, 0x7C, 0x82, 0x95, 0xFF, 0x23, 0x29, 0x3B, 0xFF, 0x08, 0x0D, 0x1D, 0xFF, 0x0B, 0x0F, 0x20, 0xFF, 0x07, 0x0B, 0x1A,
+    0xFF, 0x07, 0x0A, 0x17, 0xFF, 0x06, 0x09, 0x15, 0xFF, 0x05, 0x07, 0x14, 0xFF, 0x04, 0x07, 0x12, 0xFF, 0x80, 0x04, 0x06, 0x10, 0xFF, 0x80, 0x03,
+    0x06, 0x0F, 0xFF, 0x06, 0x03, 0x06, 0x0E, 0xFF, 0x03, 0x06, 0x0F, 0xFF, 0x03, 0x05, 0x0E, 0xFF, 0x03, 0x04, 0x0E, 0xFF, 0x03, 0x05, 0x0D, 0xFF,
+    0x02, 0x05, 0x0D, 0xFF, 0x03, 0x04, 0x0D, 0xFF, 0x80, 0x02, 0x05, 0x0D, 0xFF, 0x05, 0x03, 0x05, 0x0D, 0xFF, 0x02, 0x05, 0x0D, 0xFF, 0x02, 0x04,
+    0x0D, 0xFF, 0x02, 0x03, 0x0D, 0xFF, 0x02, 0x03, 0x0C, 0xFF, 0x02, 0x04, 0x0C, 0xFF, 0x81, 0x02, 0x04, 0x0B, 0xFF, 0x80, 0x01, 0x04, 0x0B, 0xFF,
+    0x07, 0x02, 0x04, 0x0B, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x01, 0x04, 0x0B, 0xFF, 0x01, 0x05, 0x0A, 0xFF, 0x01, 0x04, 0x0A, 0xFF, 0x02, 0x04, 0x0B,
+    0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x80, 0x01, 0x04, 0x09, 0xFF, 0x02, 0x02, 0x04, 0x08, 0xFF, 0x01, 0x03, 0x08, 0xFF, 0x01,
+    0x04, 0x08, 0xFF, 0x80, 0x01, 0x04, 0x07, 0xFF, 0x08, 0x01, 0x03, 0x07, 0xFF, 0x02, 0x03, 0x07, 0xFF, 0x02, 0x02, 0x06, 0xFF, 0x01, 0x01, 0x05,
+    0xFF, 0x02, 0x02, 0x06, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x06, 0x00, 0x00,
+    0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x05, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x03, 0xFF, 0x01, 0x01, 0x02, 0xFF,
+    0x00, 0x01, 0x02, 0xFF, 0x01, 0x01, 0x03, 0xFF, 0x80, 0x01, 0x02, 0x04, 0xFF, 0x02, 0x01, 0x01, 0x04, 0xFF, 0x02, 0x02, 0x05, 0xFF, 0x00, 0x02,
+    0x03, 0xFF, 0x80, 0x01, 0x02, 0x05, 0xFF, 0x0F, 0x01, 0x03, 0x04, 0xFF, 0x03, 0x03, 0x07, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x01, 0x03, 0x07, 0xFF,
+    0x01, 0x04, 0x08, 0xFF, 0x02, 0x05, 0x0A, 0xFF, 0x01, 0x04, 0x09, 0xFF, 0x02, 0x05, 0x09, 0xFF, 0x13, 0x1B, 0x20, 0xFF, 0x23, 0x2B, 0x33, 0xFF,
+    0x22, 0x29, 0x35, 0xFF, 0x25, 0x2B, 0x38, 0xFF, 0x28, 0x2E, 0x3B, 0xFF, 0x2A, 0x2F, 0x3E, 0xFF, 0x2E, 0x33, 0x43, 0xFF, 0x33, 0x3A, 0x4B, 0xFF,
+    0x80, 0x37, 0x3D, 0x51, 0xFF, 0x2D, 0x31, 0x36, 0x48, 0xFF, 0x42, 0x47, 0x58, 0xFF, 0x8C, 0x94, 0xA4, 0xFF, 0x63, 0x6D, 0x81, 0xFF, 0x31, 0x35,
+    0x50, 0xFF, 0x43, 0x44, 0x62, 0xFF, 0x66, 0x69, 0x86, 0xFF, 0x70, 0x74, 0x8E, 0xFF, 0x24, 0x26, 0x35, 0xFF, 0x05, 0x07, 0x11, 0xFF, 0x04, 0x05,
+    0x0E, 0xFF, 0x1E, 0x24, 0x2F, 0xFF, 0x43, 0x4C, 0x60, 0xFF, 0x3D, 0x46, 0x5B, 0xFF, 0x3F, 0x47, 0x5D, 0xFF, 0x3F, 0x48, 0x5D, 0xFF, 0x40, 0x49,
+    0x5E, 0xFF, 0x42, 0x4B, 0x62, 0xFF, 0x48, 0x50, 0x67, 0xFF, 0x4A, 0x52, 0x68, 0xFF, 0x49, 0x52, 0x6A, 0xFF, 0x4E, 0x55, 0x6C, 0xFF, 0x4E, 0x57,
+    0x6D, 0xFF, 0x50, 0x59, 0x6F, 0xFF, 0x53, 0x5C, 0x73, 0xFF, 0x59, 0x62, 0x79, 0xFF, 0x60, 0x6A, 0x7F, 0xFF, 0x64, 0x6D, 0x84, 0xFF, 0x65, 0x6F,
+    0x84, 0xFF, 0x6A, 0x76, 0x8B, 0xFF, 0x71, 0x7C, 0x90, 0xFF, 0x6A, 0x74, 0x89, 0xFF, 0xAA, 0xB1, 0xBE, 0xFF, 0xE2, 0xE5, 0xE9, 0xFF, 0xC5, 0xC7,
+    0xCC, 0xFF, 0xC2, 0xC5, 0xCD, 0xFF, 0x45, 0x48, 0x52, 0xFF, 0x06, 0x08, 0x14, 0xFF, 0x0B, 0x0E, 0x1E, 0xFF, 0x07, 0x0C, 0x1A, 0xFF, 0x07, 0x0A,
+    0x19, 0xFF, 0x06, 0x09, 0x16, 0xFF, 0x06, 0x08, 0x15, 0xFF, 0x06, 0x08, 0x14, 0xFF, 0x06, 0x07, 0x13, 0xFF, 0x06, 0x06, 0x13, 0xFF, 0x81, 0x05,
+    0x06, 0x12, 0xFF, 0x15, 0x06, 0x06, 0x12, 0xFF, 0x05, 0x07, 0x11, 0xFF, 0x05, 0x07, 0x13, 0xFF, 0x05, 0x08, 0x13, 0xFF, 0x06, 0x08, 0x13, 0xFF,
+    0x05, 0x0A, 0x15, 0xFF, 0x05, 0x0B, 0x17, 0xFF, 0x06, 0x0B, 0x19, 0xFF, 0x09, 0x0D, 0x1C, 0xFF, 0x09, 0x0B, 0x14, 0xFF, 0x4D, 0x52, 0x5B, 0xFF,
+    0xA0, 0xA5, 0xB3, 0xFF, 0x9F, 0xA4, 0xB4, 0xFF, 0xA1, 0xA7, 0xB7, 0xFF, 0xA2, 0xA8, 0xB7, 0xFF, 0xA3, 0xAA, 0xB7, 0xFF, 0xA4, 0xA9, 0xB8, 0xFF,
+    0xA5, 0xA9, 0xB8, 0xFF, 0xA8, 0xAB, 0xB9, 0xFF, 0xA9, 0xAE, 0xBA, 0xFF, 0xA9, 0xAD, 0xBB, 0xFF, 0xA8, 0xAD, 0xBA, 0xFF, 0x80, 0xA7, 0xAC, 0xB8,
+    0xFF, 0x12, 0xA9, 0xAE, 0xB9, 0xFF, 0xA9, 0xAF, 0xBB, 0xFF, 0xAB, 0xAF, 0xBC, 0xFF, 0xA9, 0xAF, 0xBC, 0xFF, 0xA8, 0xAC, 0xBA, 0xFF, 0xA9, 0xAE,
+    0xBA, 0xFF, 0xA9, 0xAF, 0xBB, 0xFF, 0xC2, 0xC7, 0xCF, 0xFF, 0x92, 0x98, 0xA7, 0xFF, 0x50, 0x54, 0x61, 0xFF, 0x04, 0x06, 0x0E, 0xFF, 0x0B, 0x10,
+    0x1F, 0xFF, 0x08, 0x0C, 0x19, 0xFF, 0x08, 0x0B, 0x17, 0xFF, 0x07, 0x09, 0x14, 0xFF, 0x06, 0x08, 0x13, 0xFF, 0x05, 0x08, 0x12, 0xFF, 0x05, 0x07,
+    0x11, 0xFF, 0x05, 0x06, 0x10, 0xFF, 0x80, 0x04, 0x06, 0x0F, 0xFF, 0x00, 0x04, 0x05, 0x0E, 0xFF, 0x81, 0x04, 0x06, 0x0E, 0xFF, 0x82, 0x04, 0x05,
+    0x0E, 0xFF, 0x03, 0x04, 0x05, 0x0F, 0xFF, 0x04, 0x05, 0x0E, 0xFF, 0x04, 0x06, 0x0E, 0xFF, 0x04, 0x05, 0x0F, 0xFF, 0x81, 0x04, 0x06, 0x0F, 0xFF,
+    0x02, 0x05, 0x06, 0x0E, 0xFF, 0x04, 0x06, 0x0E, 0xFF, 0x05, 0x06, 0x0E, 0xFF, 0x80, 0x04, 0x06, 0x0E, 0xFF, 0x05, 0x04, 0x05, 0x0D, 0xFF, 0x03,
+    0x06, 0x0E, 0xFF, 0x04, 0x05, 0x0D, 0xFF, 0x04, 0x06, 0x0D, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x03, 0x04, 0x0C, 0xFF, 0x80, 0x03, 0x05, 0x0C, 0xFF,
+    0x80, 0x03, 0x04, 0x0C, 0xFF, 0x00, 0x02, 0x04, 0x0C, 0xFF, 0x80, 0x03, 0x04, 0x0C, 0xFF, 0x00, 0x02, 0x04, 0x0C, 0xFF, 0x83, 0x02, 0x03, 0x0B,
+    0xFF, 0x81, 0x02, 0x03, 0x0A, 0xFF, 0x81, 0x02, 0x03, 0x0B, 0xFF, 0x02, 0x03, 0x04, 0x0B, 0xFF, 0x03, 0x03, 0x0B, 0xFF, 0x03, 0x04, 0x0B, 0xFF,
+    0x81, 0x03, 0x04, 0x0C, 0xFF, 0x01, 0x03, 0x04, 0x0D, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x80, 0x04, 0x05, 0x0E, 0xFF, 0x00, 0x04, 0x06, 0x0E, 0xFF,
+    0x80, 0x04, 0x06, 0x10, 0xFF, 0x02, 0x04, 0x07, 0x10, 0xFF, 0x04, 0x07, 0x11, 0xFF, 0x05, 0x07, 0x12, 0xFF, 0x80, 0x05, 0x07, 0x13, 0xFF, 0x36,
+    0x06, 0x08, 0x13, 0xFF, 0x06, 0x08, 0x14, 0xFF, 0x06, 0x09, 0x14, 0xFF, 0x06, 0x09, 0x16, 0xFF, 0x08, 0x0A, 0x18, 0xFF, 0x09, 0x0C, 0x18, 0xFF,
+    0x09, 0x0C, 0x1A, 0xFF, 0x0A, 0x0C, 0x1C, 0xFF, 0x0B, 0x0E, 0x1E, 0xFF, 0x0E, 0x13, 0x24, 0xFF, 0x08, 0x0D, 0x1C, 0xFF, 0x34, 0x3B, 0x4F, 0xFF,
+    0x8A, 0x8F, 0x9D, 0xFF, 0x97, 0x9C, 0xAA, 0xFF, 0xCF, 0xD1, 0xD7, 0xFF, 0xA8, 0xAD, 0xBA, 0xFF, 0xA7, 0xAD, 0xBB, 0xFF, 0xA9, 0xAF, 0xBC, 0xFF,
+    0xA8, 0xAD, 0xBA, 0xFF, 0xA6, 0xAC, 0xBA, 0xFF, 0xA7, 0xAC, 0xB9, 0xFF, 0xA8, 0xAE, 0xBB, 0xFF, 0xA9, 0xB0, 0xBC, 0xFF, 0xA8, 0xAF, 0xBC, 0xFF,
+    0xA6, 0xAE, 0xB9, 0xFF, 0xA4, 0xAC, 0xB8, 0xFF, 0x7D, 0x86, 0x97, 0xFF, 0x22, 0x28, 0x35, 0xFF, 0x11, 0x18, 0x32, 0xFF, 0x0F, 0x15, 0x2C, 0xFF,
+    0x5E, 0x65, 0x78, 0xFF, 0x81, 0x87, 0x9A, 0xFF, 0x65, 0x6A, 0x80, 0xFF, 0x77, 0x7C, 0x91, 0xFF, 0x9F, 0xA6, 0xB3, 0xFF, 0xA2, 0xA9, 0xB7, 0xFF,
+    0xA2, 0xA9, 0xB9, 0xFF, 0x9F, 0xA6, 0xB6, 0xFF, 0x9B, 0xA3, 0xB2, 0xFF, 0x99, 0xA1, 0xB2, 0xFF, 0x96, 0x9D, 0xAF, 0xFF, 0x93, 0x9A, 0xAB, 0xFF,
+    0x94, 0x9B, 0xAB, 0xFF, 0x95, 0x9C, 0xAD, 0xFF, 0x95, 0x9D, 0xAD, 0xFF, 0x89, 0x90, 0xA1, 0xFF, 0x48, 0x4F, 0x63, 0xFF, 0x10, 0x14, 0x27, 0xFF,
+    0x0A, 0x10, 0x22, 0xFF, 0x0A, 0x0E, 0x1E, 0xFF, 0x07, 0x0B, 0x1A, 0xFF, 0x06, 0x0A, 0x18, 0xFF, 0x06, 0x09, 0x15, 0xFF, 0x05, 0x08, 0x14, 0xFF,
+    0x04, 0x07, 0x12, 0xFF, 0x81, 0x04, 0x06, 0x10, 0xFF, 0x02, 0x03, 0x06, 0x0F, 0xFF, 0x03, 0x05, 0x0F, 0xFF, 0x04, 0x05, 0x0F, 0xFF, 0x80, 0x03,
+    0x05, 0x0E, 0xFF, 0x00, 0x04, 0x05, 0x0E, 0xFF, 0x82, 0x03, 0x05, 0x0E, 0xFF, 0x00, 0x03, 0x05, 0x0D, 0xFF, 0x80, 0x03, 0x04, 0x0D, 0xFF, 0x80,
+    0x03, 0x05, 0x0D, 0xFF, 0x00, 0x03, 0x05, 0x0C, 0xFF, 0x80, 0x03, 0x04, 0x0C, 0xFF, 0x01, 0x03, 0x05, 0x0C, 0xFF, 0x02, 0x04, 0x0C, 0xFF, 0x80,
+    0x03, 0x05, 0x0C, 0xFF, 0x00, 0x02, 0x05, 0x0B, 0xFF, 0x80, 0x02, 0x04, 0x0B, 0xFF, 0x00, 0x02, 0x05, 0x0A, 0xFF, 0x80, 0x02, 0x04, 0x0A, 0xFF,
+    0x08, 0x02, 0x04, 0x09, 0xFF, 0x01, 0x03, 0x0A, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x01, 0x04, 0x08, 0xFF, 0x02, 0x04, 0x08,
+    0xFF, 0x01, 0x03, 0x07, 0xFF, 0x02, 0x04, 0x06, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x81, 0x01, 0x02, 0x06, 0xFF, 0x04, 0x01, 0x02, 0x05, 0xFF, 0x01,
+    0x01, 0x05, 0xFF, 0x00, 0x02, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x09, 0x00, 0x01, 0x00,
+    0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0x03, 0xFF, 0x80,
+    0x01, 0x02, 0x04, 0xFF, 0x00, 0x01, 0x01, 0x04, 0xFF, 0x81, 0x01, 0x02, 0x04, 0xFF, 0x42, 0x00, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01,
+    0x02, 0x06, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x01, 0x05, 0x0A, 0xFF, 0x01, 0x05, 0x0B, 0xFF, 0x02,
+    0x05, 0x0A, 0xFF, 0x06, 0x0B, 0x11, 0xFF, 0x1C, 0x24, 0x2C, 0xFF, 0x22, 0x29, 0x35, 0xFF, 0x20, 0x25, 0x32, 0xFF, 0x26, 0x2B, 0x37, 0xFF, 0x29,
+    0x2F, 0x3C, 0xFF, 0x2B, 0x30, 0x3F, 0xFF, 0x2E, 0x35, 0x46, 0xFF, 0x31, 0x37, 0x49, 0xFF, 0x33, 0x39, 0x4C, 0xFF, 0x3B, 0x42, 0x53, 0xFF, 0x64,
+    0x6B, 0x7C, 0xFF, 0x68, 0x70, 0x83, 0xFF, 0x2C, 0x30, 0x48, 0xFF, 0x2E, 0x31, 0x4C, 0xFF, 0x42, 0x42, 0x61, 0xFF, 0x58, 0x5C, 0x79, 0xFF, 0x55,
+    0x57, 0x73, 0xFF, 0x14, 0x16, 0x23, 0xFF, 0x07, 0x0A, 0x17, 0xFF, 0x04, 0x06, 0x11, 0xFF, 0x1F, 0x24, 0x30, 0xFF, 0x41, 0x49, 0x5E, 0xFF, 0x3B,
+    0x43, 0x58, 0xFF, 0x40, 0x48, 0x5E, 0xFF, 0x42, 0x4B, 0x61, 0xFF, 0x44, 0x4C, 0x62, 0xFF, 0x45, 0x4D, 0x62, 0xFF, 0x48, 0x50, 0x66, 0xFF, 0x48,
+    0x51, 0x66, 0xFF, 0x46, 0x4F, 0x65, 0xFF, 0x48, 0x50, 0x67, 0xFF, 0x4B, 0x53, 0x6A, 0xFF, 0x4F, 0x57, 0x6E, 0xFF, 0x51, 0x5A, 0x71, 0xFF, 0x57,
+    0x60, 0x76, 0xFF, 0x5C, 0x65, 0x7B, 0xFF, 0x5F, 0x68, 0x7E, 0xFF, 0x61, 0x6B, 0x80, 0xFF, 0x64, 0x6F, 0x84, 0xFF, 0x6B, 0x76, 0x8A, 0xFF, 0x6E,
+    0x77, 0x8C, 0xFF, 0x7B, 0x83, 0x96, 0xFF, 0xD2, 0xD5, 0xDB, 0xFF, 0xCB, 0xCD, 0xD2, 0xFF, 0xC0, 0xC3, 0xC9, 0xFF, 0x70, 0x73, 0x7F, 0xFF, 0x0E,
+    0x0F, 0x1D, 0xFF, 0x09, 0x0D, 0x1C, 0xFF, 0x09, 0x0D, 0x1B, 0xFF, 0x08, 0x0B, 0x19, 0xFF, 0x07, 0x0A, 0x17, 0xFF, 0x06, 0x09, 0x16, 0xFF, 0x06,
+    0x08, 0x15, 0xFF, 0x06, 0x07, 0x14, 0xFF, 0x06, 0x07, 0x13, 0xFF, 0x06, 0x06, 0x13, 0xFF, 0x06, 0x06, 0x12, 0xFF, 0x80, 0x05, 0x06, 0x12, 0xFF,
+    0x11, 0x05, 0x07, 0x12, 0xFF, 0x05, 0x07, 0x13, 0xFF, 0x05, 0x08, 0x14, 0xFF, 0x06, 0x09, 0x14, 0xFF, 0x06, 0x0A, 0x16, 0xFF, 0x06, 0x0B, 0x18,
+    0xFF, 0x07, 0x0C, 0x1A, 0xFF, 0x07, 0x0B, 0x17, 0xFF, 0x1B, 0x1D, 0x25, 0xFF, 0x83, 0x88, 0x98, 0xFF, 0x98, 0x9E, 0xAE, 0xFF, 0x9B, 0x9F, 0xB1,
+    0xFF, 0x9D, 0xA3, 0xB3, 0xFF, 0x9E, 0xA4, 0xB4, 0xFF, 0xA0, 0xA4, 0xB4, 0xFF, 0x9F, 0xA5, 0xB4, 0xFF, 0xA1, 0xA5, 0xB4, 0xFF, 0xA2, 0xA7, 0xB6,
+    0xFF, 0x80, 0xA4, 0xA9, 0xB7, 0xFF, 0x14, 0xA5, 0xA9, 0xB8, 0xFF, 0xA4, 0xA8, 0xB6, 0xFF, 0xA2, 0xA8, 0xB5, 0xFF, 0xA4, 0xA9, 0xB6, 0xFF, 0xA6,
+    0xAA, 0xB8, 0xFF, 0xA6, 0xAC, 0xB9, 0xFF, 0xA5, 0xAB, 0xB8, 0xFF, 0xA4, 0xAA, 0xB7, 0xFF, 0xA6, 0xAC, 0xB8, 0xFF, 0xA7, 0xAC, 0xB9, 0xFF, 0xBF,
+    0xC5, 0xCD, 0xFF, 0x90, 0x97, 0xA5, 0xFF, 0x4F, 0x53, 0x61, 0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x0C, 0x10, 0x1E, 0xFF, 0x08, 0x0D, 0x19, 0xFF, 0x07,
+    0x0A, 0x17, 0xFF, 0x07, 0x0A, 0x15, 0xFF, 0x07, 0x09, 0x13, 0xFF, 0x06, 0x08, 0x11, 0xFF, 0x05, 0x08, 0x11, 0xFF, 0x80, 0x05, 0x06, 0x10, 0xFF,
+    0x80, 0x04, 0x06, 0x10, 0xFF, 0x01, 0x04, 0x06, 0x0F, 0xFF, 0x04, 0x06, 0x0E, 0xFF, 0x82, 0x04, 0x06, 0x0F, 0xFF, 0x80, 0x04, 0x06, 0x10, 0xFF,
+    0x02, 0x04, 0x07, 0x10, 0xFF, 0x05, 0x06, 0x11, 0xFF, 0x04, 0x06, 0x10, 0xFF, 0x80, 0x05, 0x07, 0x10, 0xFF, 0x80, 0x05, 0x07, 0x11, 0xFF, 0x04,
+    0x04, 0x07, 0x10, 0xFF, 0x04, 0x07, 0x11, 0xFF, 0x05, 0x07, 0x10, 0xFF, 0x04, 0x07, 0x10, 0xFF, 0x04, 0x06, 0x10, 0xFF, 0x81, 0x04, 0x06, 0x0F,
+    0xFF, 0x02, 0x03, 0x06, 0x0F, 0xFF, 0x03, 0x05, 0x0E, 0xFF, 0x03, 0x06, 0x0E, 0xFF, 0x80, 0x03, 0x05, 0x0E, 0xFF, 0x00, 0x03, 0x05, 0x0D, 0xFF,
+    0x82, 0x03, 0x04, 0x0C, 0xFF, 0x00, 0x03, 0x04, 0x0B, 0xFF, 0x82, 0x02, 0x03, 0x0B, 0xFF, 0x80, 0x03, 0x03, 0x0B, 0xFF, 0x80, 0x02, 0x03, 0x0B,
+    0xFF, 0x80, 0x03, 0x03, 0x0B, 0xFF, 0x07, 0x03, 0x04, 0x0B, 0xFF, 0x03, 0x04, 0x0C, 0xFF, 0x02, 0x04, 0x0C, 0xFF, 0x02, 0x04, 0x0D, 0xFF, 0x03,
+    0x05, 0x0D, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x03, 0x05, 0x0E, 0xFF, 0x03, 0x06, 0x0E, 0xFF, 0x80, 0x04, 0x06, 0x0F, 0xFF, 0x01, 0x04, 0x06, 0x10,
+    0xFF, 0x05, 0x06, 0x11, 0xFF, 0x80, 0x05, 0x07, 0x12, 0xFF, 0x01, 0x04, 0x07, 0x13, 0xFF, 0x06, 0x08, 0x13, 0xFF, 0x80, 0x06, 0x08, 0x14, 0xFF,
+    0x03, 0x06, 0x09, 0x15, 0xFF, 0x07, 0x09, 0x16, 0xFF, 0x07, 0x0A, 0x16, 0xFF, 0x07, 0x0A, 0x17, 0xFF, 0x80, 0x09, 0x0B, 0x19, 0xFF, 0x39, 0x09,
+    0x0C, 0x1C, 0xFF, 0x0A, 0x0E, 0x1F, 0xFF, 0x0C, 0x10, 0x21, 0xFF, 0x0F, 0x13, 0x26, 0xFF, 0x0A, 0x0E, 0x1D, 0xFF, 0x33, 0x3A, 0x4F, 0xFF, 0x87,
+    0x8C, 0x9A, 0xFF, 0x93, 0x98, 0xA7, 0xFF, 0xCB, 0xCE, 0xD5, 0xFF, 0xA2, 0xA7, 0xB5, 0xFF, 0xA2, 0xA7, 0xB6, 0xFF, 0xA4, 0xAA, 0xB8, 0xFF, 0xA2,
+    0xA9, 0xB7, 0xFF, 0xA2, 0xA8, 0xB7, 0xFF, 0xA2, 0xA9, 0xB8, 0xFF, 0xA3, 0xAB, 0xB8, 0xFF, 0xA4, 0xAC, 0xB9, 0xFF, 0xA5, 0xAC, 0xB9, 0xFF, 0xA3,
+    0xAB, 0xB8, 0xFF, 0xA2, 0xA9, 0xB6, 0xFF, 0x7F, 0x87, 0x98, 0xFF, 0x22, 0x28, 0x36, 0xFF, 0x0F, 0x15, 0x2E, 0xFF, 0x10, 0x15, 0x2D, 0xFF, 0x23,
+    0x29, 0x3D, 0xFF, 0x73, 0x78, 0x8D, 0xFF, 0x6D, 0x72, 0x88, 0xFF, 0x47, 0x4A, 0x64, 0xFF, 0x70, 0x78, 0x8E, 0xFF, 0x9B, 0xA1, 0xB3, 0xFF, 0x93,
+    0x9A, 0xAB, 0xFF, 0x99, 0xA0, 0xB0, 0xFF, 0x9B, 0xA2, 0xB2, 0xFF, 0x99, 0x9F, 0xAF, 0xFF, 0x95, 0x9D, 0xAC, 0xFF, 0x92, 0x99, 0xAA, 0xFF, 0x8F,
+    0x95, 0xA8, 0xFF, 0x8F, 0x97, 0xA8, 0xFF, 0x86, 0x8C, 0xA0, 0xFF, 0x56, 0x5C, 0x71, 0xFF, 0x15, 0x1A, 0x2B, 0xFF, 0x0A, 0x0E, 0x1F, 0xFF, 0x0C,
+    0x0F, 0x21, 0xFF, 0x09, 0x0D, 0x1E, 0xFF, 0x07, 0x0B, 0x1B, 0xFF, 0x07, 0x0A, 0x18, 0xFF, 0x06, 0x0A, 0x17, 0xFF, 0x06, 0x09, 0x14, 0xFF, 0x05,
+    0x08, 0x12, 0xFF, 0x04, 0x07, 0x12, 0xFF, 0x04, 0x07, 0x11, 0xFF, 0x04, 0x06, 0x11, 0xFF, 0x03, 0x06, 0x10, 0xFF, 0x04, 0x06, 0x10, 0xFF, 0x04,
+    0x06, 0x0F, 0xFF, 0x03, 0x06, 0x0F, 0xFF, 0x03, 0x05, 0x0F, 0xFF, 0x03, 0x06, 0x10, 0xFF, 0x80, 0x03, 0x05, 0x0F, 0xFF, 0x80, 0x04, 0x05, 0x0F,
+    0xFF, 0x00, 0x04, 0x05, 0x0E, 0xFF, 0x81, 0x03, 0x05, 0x0E, 0xFF, 0x00, 0x03, 0x04, 0x0E, 0xFF, 0x81, 0x03, 0x05, 0x0E, 0xFF, 0x80, 0x03, 0x05,
+    0x0D, 0xFF, 0x03, 0x03, 0x05, 0x0C, 0xFF, 0x03, 0x06, 0x0C, 0xFF, 0x02, 0x05, 0x0C, 0xFF, 0x02, 0x04, 0x0C, 0xFF, 0x81, 0x02, 0x05, 0x0C, 0xFF,
+    0x81, 0x02, 0x04, 0x0B, 0xFF, 0x04, 0x02, 0x04, 0x0A, 0xFF, 0x01, 0x03, 0x0A, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x01, 0x04, 0x08, 0xFF, 0x02, 0x04,
+    0x08, 0xFF, 0x80, 0x02, 0x03, 0x07, 0xFF, 0x04, 0x01, 0x03, 0x06, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x02, 0x05, 0xFF,
+    0x01, 0x02, 0x04, 0xFF, 0x81, 0x01, 0x02, 0x05, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x81, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF,
+    0x80, 0x00, 0x00, 0x01, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x01, 0x00, 0x03, 0xFF, 0x80, 0x00,
+    0x01, 0x03, 0xFF, 0x02, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x80, 0x01, 0x01, 0x03, 0xFF, 0x81, 0x01, 0x02,
+    0x04, 0xFF, 0x40, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x01, 0x03, 0x05, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x01, 0x04, 0x07, 0xFF, 0x02,
+    0x04, 0x09, 0xFF, 0x02, 0x05, 0x0A, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x02, 0x05, 0x0C, 0xFF, 0x01, 0x03, 0x0A, 0xFF, 0x05, 0x09, 0x0F, 0xFF, 0x1C,
+    0x22, 0x2B, 0xFF, 0x37, 0x3C, 0x48, 0xFF, 0x3B, 0x3E, 0x4C, 0xFF, 0x38, 0x3C, 0x4C, 0xFF, 0x3B, 0x3F, 0x4F, 0xFF, 0x3D, 0x42, 0x51, 0xFF, 0x43,
+    0x49, 0x59, 0xFF, 0x4D, 0x52, 0x64, 0xFF, 0x73, 0x79, 0x8C, 0xFF, 0x5C, 0x61, 0x72, 0xFF, 0x25, 0x27, 0x3A, 0xFF, 0x22, 0x24, 0x3B, 0xFF, 0x38,
+    0x39, 0x54, 0xFF, 0x47, 0x47, 0x65, 0xFF, 0x42, 0x44, 0x5F, 0xFF, 0x26, 0x28, 0x3B, 0xFF, 0x0B, 0x0D, 0x1C, 0xFF, 0x0A, 0x0C, 0x1A, 0xFF, 0x04,
+    0x07, 0x11, 0xFF, 0x1E, 0x23, 0x30, 0xFF, 0x3E, 0x45, 0x5B, 0xFF, 0x3A, 0x42, 0x56, 0xFF, 0x40, 0x48, 0x5E, 0xFF, 0x3F, 0x49, 0x5E, 0xFF, 0x41,
+    0x49, 0x5F, 0xFF, 0x42, 0x49, 0x5F, 0xFF, 0x40, 0x47, 0x5C, 0xFF, 0x42, 0x49, 0x60, 0xFF, 0x46, 0x4E, 0x64, 0xFF, 0x4B, 0x52, 0x6A, 0xFF, 0x4E,
+    0x57, 0x6E, 0xFF, 0x50, 0x58, 0x6F, 0xFF, 0x52, 0x5A, 0x71, 0xFF, 0x5A, 0x62, 0x77, 0xFF, 0x5C, 0x63, 0x79, 0xFF, 0x5D, 0x64, 0x7A, 0xFF, 0x60,
+    0x69, 0x7D, 0xFF, 0x60, 0x69, 0x80, 0xFF, 0x66, 0x6F, 0x85, 0xFF, 0x6C, 0x76, 0x8B, 0xFF, 0x69, 0x73, 0x89, 0xFF, 0xBA, 0xBE, 0xC9, 0xFF, 0xD6,
+    0xD7, 0xDD, 0xFF, 0xBA, 0xBE, 0xC4, 0xFF, 0xA8, 0xAB, 0xB8, 0xFF, 0x23, 0x26, 0x31, 0xFF, 0x06, 0x09, 0x16, 0xFF, 0x09, 0x0E, 0x1D, 0xFF, 0x08,
+    0x0C, 0x1B, 0xFF, 0x08, 0x0B, 0x18, 0xFF, 0x07, 0x0A, 0x17, 0xFF, 0x06, 0x08, 0x16, 0xFF, 0x06, 0x09, 0x15, 0xFF, 0x06, 0x07, 0x14, 0xFF, 0x80,
+    0x06, 0x06, 0x13, 0xFF, 0x80, 0x06, 0x07, 0x13, 0xFF, 0x18, 0x05, 0x07, 0x13, 0xFF, 0x06, 0x08, 0x13, 0xFF, 0x07, 0x08, 0x15, 0xFF, 0x06, 0x09,
+    0x16, 0xFF, 0x07, 0x0A, 0x17, 0xFF, 0x07, 0x0B, 0x18, 0xFF, 0x09, 0x0C, 0x1C, 0xFF, 0x07, 0x0A, 0x15, 0xFF, 0x2E, 0x31, 0x39, 0xFF, 0x94, 0x99,
+    0xAB, 0xFF, 0x94, 0x9B, 0xAC, 0xFF, 0x97, 0x9C, 0xAE, 0xFF, 0x99, 0x9F, 0xB0, 0xFF, 0x9A, 0x9F, 0xB1, 0xFF, 0x9C, 0xA1, 0xB0, 0xFF, 0x9B, 0xA1,
+    0xB0, 0xFF, 0x9B, 0xA0, 0xB0, 0xFF, 0x9D, 0xA1, 0xB2, 0xFF, 0xA0, 0xA4, 0xB4, 0xFF, 0xA1, 0xA6, 0xB4, 0xFF, 0xA0, 0xA6, 0xB4, 0xFF, 0xA0, 0xA5,
+    0xB3, 0xFF, 0x9F, 0xA4, 0xB2, 0xFF, 0xA0, 0xA5, 0xB3, 0xFF, 0xA2, 0xA6, 0xB5, 0xFF, 0x80, 0xA2, 0xA8, 0xB6, 0xFF, 0x15, 0xA3, 0xA8, 0xB7, 0xFF,
+    0xA3, 0xA9, 0xB6, 0xFF, 0xA2, 0xA8, 0xB5, 0xFF, 0xBC, 0xC3, 0xCB, 0xFF, 0x90, 0x96, 0xA5, 0xFF, 0x4E, 0x52, 0x60, 0xFF, 0x04, 0x06, 0x0F, 0xFF,
+    0x0C, 0x10, 0x1F, 0xFF, 0x09, 0x0C, 0x19, 0xFF, 0x08, 0x0A, 0x17, 0xFF, 0x07, 0x0A, 0x15, 0xFF, 0x06, 0x08, 0x14, 0xFF, 0x06, 0x07, 0x12, 0xFF,
+    0x06, 0x08, 0x12, 0xFF, 0x05, 0x08, 0x11, 0xFF, 0x05, 0x07, 0x11, 0xFF, 0x05, 0x06, 0x10, 0xFF, 0x04, 0x07, 0x10, 0xFF, 0x04, 0x07, 0x11, 0xFF,
+    0x05, 0x06, 0x10, 0xFF, 0x05, 0x07, 0x10, 0xFF, 0x04, 0x07, 0x11, 0xFF, 0x80, 0x05, 0x07, 0x11, 0xFF, 0x03, 0x05, 0x07, 0x12, 0xFF, 0x05, 0x08,
+    0x12, 0xFF, 0x05, 0x07, 0x11, 0xFF, 0x06, 0x08, 0x12, 0xFF, 0x80, 0x05, 0x08, 0x12, 0xFF, 0x00, 0x06, 0x08, 0x12, 0xFF, 0x83, 0x05, 0x08, 0x12,
+    0xFF, 0x0B, 0x05, 0x08, 0x11, 0xFF, 0x05, 0x07, 0x11, 0xFF, 0x05, 0x08, 0x10, 0xFF, 0x05, 0x08, 0x11, 0xFF, 0x04, 0x07, 0x11, 0xFF, 0x05, 0x07,
+    0x10, 0xFF, 0x04, 0x07, 0x10, 0xFF, 0x03, 0x06, 0x10, 0xFF, 0x03, 0x05, 0x0F, 0xFF, 0x03, 0x06, 0x0F, 0xFF, 0x04, 0x05, 0x0E, 0xFF, 0x04, 0x05,
+    0x0D, 0xFF, 0x82, 0x03, 0x04, 0x0D, 0xFF, 0x02, 0x03, 0x05, 0x0C, 0xFF, 0x03, 0x04, 0x0C, 0xFF, 0x03, 0x03, 0x0C, 0xFF, 0x81, 0x03, 0x04, 0x0C,
+    0xFF, 0x00, 0x02, 0x03, 0x0C, 0xFF, 0x80, 0x03, 0x04, 0x0C, 0xFF, 0x00, 0x03, 0x03, 0x0C, 0xFF, 0x80, 0x03, 0x04, 0x0D, 0xFF, 0x26, 0x02, 0x04,
+    0x0D, 0xFF, 0x03, 0x04, 0x0D, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x03, 0x05, 0x0E, 0xFF, 0x04, 0x05, 0x0E, 0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x04, 0x07,
+    0x10, 0xFF, 0x04, 0x06, 0x10, 0xFF, 0x05, 0x06, 0x10, 0xFF, 0x05, 0x07, 0x11, 0xFF, 0x05, 0x08, 0x14, 0xFF, 0x06, 0x08, 0x14, 0xFF, 0x06, 0x08,
+    0x15, 0xFF, 0x07, 0x09, 0x16, 0xFF, 0x07, 0x0A, 0x15, 0xFF, 0x07, 0x0A, 0x16, 0xFF, 0x08, 0x0A, 0x17, 0xFF, 0x07, 0x0A, 0x17, 0xFF, 0x08, 0x0A,
+    0x17, 0xFF, 0x08, 0x0B, 0x18, 0xFF, 0x09, 0x0C, 0x19, 0xFF, 0x0A, 0x0C, 0x1B, 0xFF, 0x0A, 0x0D, 0x1E, 0xFF, 0x0B, 0x0F, 0x21, 0xFF, 0x0D, 0x11,
+    0x23, 0xFF, 0x10, 0x15, 0x28, 0xFF, 0x09, 0x0E, 0x1E, 0xFF, 0x30, 0x38, 0x4D, 0xFF, 0x82, 0x88, 0x98, 0xFF, 0x90, 0x94, 0xA4, 0xFF, 0xC8, 0xCA,
+    0xD2, 0xFF, 0x9E, 0xA4, 0xB3, 0xFF, 0x9E, 0xA5, 0xB4, 0xFF, 0xA1, 0xA7, 0xB7, 0xFF, 0xA1, 0xA8, 0xB6, 0xFF, 0xA0, 0xA7, 0xB4, 0xFF, 0x9F, 0xA5,
+    0xB5, 0xFF, 0x9E, 0xA6, 0xB5, 0xFF, 0x9F, 0xA6, 0xB5, 0xFF, 0x80, 0xA0, 0xA7, 0xB5, 0xFF, 0x20, 0x9F, 0xA7, 0xB4, 0xFF, 0x80, 0x88, 0x98, 0xFF,
+    0x22, 0x28, 0x37, 0xFF, 0x0E, 0x13, 0x28, 0xFF, 0x10, 0x16, 0x2C, 0xFF, 0x0F, 0x11, 0x26, 0xFF, 0x3E, 0x44, 0x58, 0xFF, 0x66, 0x6D, 0x83, 0xFF,
+    0x63, 0x67, 0x80, 0xFF, 0x45, 0x48, 0x61, 0xFF, 0x66, 0x6D, 0x83, 0xFF, 0x85, 0x8C, 0xA1, 0xFF, 0x8E, 0x93, 0xA8, 0xFF, 0x90, 0x97, 0xA9, 0xFF,
+    0x8A, 0x90, 0xA3, 0xFF, 0x87, 0x8C, 0xA0, 0xFF, 0x87, 0x8D, 0xA2, 0xFF, 0x86, 0x8D, 0xA1, 0xFF, 0x6D, 0x74, 0x8A, 0xFF, 0x45, 0x49, 0x5D, 0xFF,
+    0x1B, 0x1F, 0x31, 0xFF, 0x08, 0x0D, 0x1B, 0xFF, 0x0A, 0x0E, 0x1F, 0xFF, 0x0A, 0x0D, 0x1E, 0xFF, 0x09, 0x0D, 0x1B, 0xFF, 0x08, 0x0B, 0x1A, 0xFF,
+    0x07, 0x09, 0x18, 0xFF, 0x07, 0x09, 0x16, 0xFF, 0x06, 0x09, 0x16, 0xFF, 0x06, 0x08, 0x14, 0xFF, 0x05, 0x07, 0x13, 0xFF, 0x04, 0x07, 0x12, 0xFF,
+    0x04, 0x07, 0x11, 0xFF, 0x80, 0x04, 0x06, 0x11, 0xFF, 0x00, 0x04, 0x07, 0x10, 0xFF, 0x81, 0x04, 0x06, 0x11, 0xFF, 0x03, 0x04, 0x07, 0x11, 0xFF,
+    0x05, 0x06, 0x11, 0xFF, 0x04, 0x06, 0x10, 0xFF, 0x05, 0x06, 0x10, 0xFF, 0x80, 0x04, 0x06, 0x10, 0xFF, 0x80, 0x04, 0x06, 0x0F, 0xFF, 0x00, 0x04,
+    0x05, 0x0E, 0xFF, 0x81, 0x04, 0x06, 0x0E, 0xFF, 0x04, 0x04, 0x05, 0x0E, 0xFF, 0x03, 0x05, 0x0E, 0xFF, 0x03, 0x06, 0x0E, 0xFF, 0x04, 0x06, 0x0E,
+    0xFF, 0x04, 0x05, 0x0D, 0xFF, 0x80, 0x03, 0x06, 0x0D, 0xFF, 0x0B, 0x02, 0x05, 0x0C, 0xFF, 0x02, 0x06, 0x0C, 0xFF, 0x02, 0x05, 0x0B, 0xFF, 0x03,
+    0x05, 0x0C, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x02, 0x05, 0x0B, 0xFF, 0x03, 0x04, 0x0B, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x01, 0x04, 0x09, 0xFF, 0x02,
+    0x04, 0x09, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x02, 0x03, 0x07, 0xFF, 0x81, 0x01, 0x03, 0x07, 0xFF, 0x00, 0x02, 0x03, 0x06, 0xFF, 0x80, 0x01, 0x02,
+    0x05, 0xFF, 0x01, 0x02, 0x01, 0x05, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x02, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x01, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x02, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFF,
+    0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x02, 0x01, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x80, 0x01,
+    0x01, 0x04, 0xFF, 0x43, 0x00, 0x02, 0x03, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x02, 0x03, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x03, 0x05, 0xFF,
+    0x01, 0x03, 0x06, 0xFF, 0x01, 0x04, 0x07, 0xFF, 0x01, 0x04, 0x09, 0xFF, 0x02, 0x05, 0x0B, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x02, 0x05, 0x0C, 0xFF,
+    0x02, 0x05, 0x0D, 0xFF, 0x01, 0x04, 0x0B, 0xFF, 0x02, 0x05, 0x0A, 0xFF, 0x20, 0x25, 0x30, 0xFF, 0x34, 0x38, 0x47, 0xFF, 0x4E, 0x53, 0x67, 0xFF,
+    0x59, 0x5F, 0x73, 0xFF, 0x5D, 0x62, 0x76, 0xFF, 0x5B, 0x60, 0x73, 0xFF, 0x4C, 0x4F, 0x64, 0xFF, 0x2F, 0x34, 0x45, 0xFF, 0x1D, 0x1E, 0x30, 0xFF,
+    0x21, 0x21, 0x37, 0xFF, 0x30, 0x30, 0x4A, 0xFF, 0x40, 0x40, 0x5D, 0xFF, 0x43, 0x43, 0x60, 0xFF, 0x25, 0x27, 0x39, 0xFF, 0x07, 0x0B, 0x14, 0xFF,
+    0x0B, 0x0E, 0x1A, 0xFF, 0x08, 0x0C, 0x18, 0xFF, 0x04, 0x05, 0x0D, 0xFF, 0x1E, 0x23, 0x2E, 0xFF, 0x3E, 0x44, 0x5A, 0xFF, 0x37, 0x3D, 0x52, 0xFF,
+    0x3C, 0x43, 0x5B, 0xFF, 0x3E, 0x46, 0x5C, 0xFF, 0x3D, 0x44, 0x5A, 0xFF, 0x3C, 0x41, 0x57, 0xFF, 0x39, 0x3F, 0x55, 0xFF, 0x3C, 0x44, 0x5B, 0xFF,
+    0x46, 0x4C, 0x64, 0xFF, 0x4C, 0x52, 0x6A, 0xFF, 0x4D, 0x56, 0x6C, 0xFF, 0x4F, 0x56, 0x6E, 0xFF, 0x53, 0x5A, 0x70, 0xFF, 0x59, 0x61, 0x77, 0xFF,
+    0x5A, 0x62, 0x78, 0xFF, 0x59, 0x61, 0x77, 0xFF, 0x5C, 0x63, 0x79, 0xFF, 0x59, 0x61, 0x77, 0xFF, 0x5C, 0x65, 0x7B, 0xFF, 0x63, 0x6D, 0x83, 0xFF,
+    0x61, 0x6B, 0x81, 0xFF, 0x8A, 0x92, 0xA3, 0xFF, 0xD4, 0xD8, 0xDD, 0xFF, 0xBF, 0xC2, 0xC9, 0xFF, 0xBC, 0xBF, 0xC6, 0xFF, 0x4E, 0x50, 0x5D, 0xFF,
+    0x06, 0x08, 0x14, 0xFF, 0x09, 0x0E, 0x1D, 0xFF, 0x09, 0x0C, 0x1C, 0xFF, 0x08, 0x0B, 0x1A, 0xFF, 0x07, 0x0A, 0x19, 0xFF, 0x07, 0x0A, 0x17, 0xFF,
+    0x06, 0x09, 0x17, 0xFF, 0x07, 0x08, 0x15, 0xFF, 0x06, 0x08, 0x14, 0xFF, 0x80, 0x06, 0x07, 0x13, 0xFF, 0x0C, 0x07, 0x08, 0x13, 0xFF, 0x06, 0x08,
+    0x13, 0xFF, 0x07, 0x08, 0x14, 0xFF, 0x07, 0x09, 0x16, 0xFF, 0x07, 0x0A, 0x17, 0xFF, 0x07, 0x0B, 0x19, 0xFF, 0x08, 0x0C, 0x1B, 0xFF, 0x08, 0x0C,
+    0x1C, 0xFF, 0x0B, 0x0E, 0x15, 0xFF, 0x6A, 0x6F, 0x7E, 0xFF, 0x90, 0x97, 0xA8, 0xFF, 0x91, 0x96, 0xAA, 0xFF, 0x94, 0x99, 0xAC, 0xFF, 0x80, 0x95,
+    0x9A, 0xAD, 0xFF, 0x03, 0x96, 0x9C, 0xAD, 0xFF, 0x97, 0x9C, 0xAD, 0xFF, 0x97, 0x9C, 0xAF, 0xFF, 0x99, 0x9E, 0xB0, 0xFF, 0x80, 0x9C, 0xA1, 0xB2,
+    0xFF, 0x00, 0x9C, 0xA1, 0xB0, 0xFF, 0x80, 0x9B, 0xA0, 0xB0, 0xFF, 0x0E, 0x9C, 0xA1, 0xAF, 0xFF, 0x9D, 0xA2, 0xB1, 0xFF, 0x9F, 0xA4, 0xB3, 0xFF,
+    0x9F, 0xA5, 0xB3, 0xFF, 0xA0, 0xA6, 0xB5, 0xFF, 0xA1, 0xA7, 0xB5, 0xFF, 0xA0, 0xA6, 0xB4, 0xFF, 0xBC, 0xC2, 0xCB, 0xFF, 0x90, 0x96, 0xA5, 0xFF,
+    0x4E, 0x52, 0x5F, 0xFF, 0x05, 0x06, 0x0F, 0xFF, 0x0C, 0x0F, 0x1E, 0xFF, 0x09, 0x0C, 0x1A, 0xFF, 0x08, 0x0B, 0x18, 0xFF, 0x07, 0x09, 0x15, 0xFF,
+    0x80, 0x06, 0x08, 0x13, 0xFF, 0x80, 0x05, 0x08, 0x12, 0xFF, 0x80, 0x05, 0x07, 0x11, 0xFF, 0x01, 0x04, 0x07, 0x12, 0xFF, 0x05, 0x07, 0x12, 0xFF,
+    0x80, 0x05, 0x07, 0x11, 0xFF, 0x08, 0x05, 0x07, 0x12, 0xFF, 0x06, 0x08, 0x12, 0xFF, 0x05, 0x08, 0x12, 0xFF, 0x06, 0x08, 0x13, 0xFF, 0x06, 0x09,
+    0x13, 0xFF, 0x06, 0x08, 0x12, 0xFF, 0x06, 0x09, 0x13, 0xFF, 0x07, 0x09, 0x14, 0xFF, 0x06, 0x09, 0x13, 0xFF, 0x80, 0x07, 0x09, 0x14, 0xFF, 0x02,
+    0x07, 0x09, 0x13, 0xFF, 0x06, 0x09, 0x13, 0xFF, 0x06, 0x0A, 0x13, 0xFF, 0x80, 0x06, 0x09, 0x13, 0xFF, 0x80, 0x06, 0x09, 0x12, 0xFF, 0x00, 0x06,
+    0x08, 0x12, 0xFF, 0x81, 0x05, 0x08, 0x11, 0xFF, 0x04, 0x04, 0x07, 0x11, 0xFF, 0x04, 0x06, 0x10, 0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x04, 0x06, 0x10,
+    0xFF, 0x04, 0x05, 0x0F, 0xFF, 0x80, 0x03, 0x05, 0x0E, 0xFF, 0x82, 0x03, 0x04, 0x0D, 0xFF, 0x01, 0x03, 0x04, 0x0C, 0xFF, 0x03, 0x03, 0x0C, 0xFF,
+    0x84, 0x03, 0x04, 0x0C, 0xFF, 0x07, 0x03, 0x05, 0x0D, 0xFF, 0x03, 0x04, 0x0D, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x04, 0x05, 0x0D, 0xFF, 0x03, 0x06,
+    0x0F, 0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x04, 0x07, 0x0F, 0xFF, 0x05, 0x07, 0x0F, 0xFF, 0x81, 0x05, 0x07, 0x11, 0xFF, 0x3F, 0x06, 0x07, 0x13, 0xFF,
+    0x06, 0x08, 0x15, 0xFF, 0x06, 0x09, 0x16, 0xFF, 0x07, 0x09, 0x17, 0xFF, 0x07, 0x0A, 0x18, 0xFF, 0x07, 0x0B, 0x18, 0xFF, 0x08, 0x0B, 0x18, 0xFF,
+    0x09, 0x0B, 0x19, 0xFF, 0x08, 0x0B, 0x18, 0xFF, 0x08, 0x0A, 0x18, 0xFF, 0x09, 0x0C, 0x19, 0xFF, 0x09, 0x0D, 0x1B, 0xFF, 0x0A, 0x0D, 0x1E, 0xFF,
+    0x0B, 0x0F, 0x20, 0xFF, 0x0C, 0x10, 0x23, 0xFF, 0x0E, 0x12, 0x26, 0xFF, 0x10, 0x15, 0x29, 0xFF, 0x09, 0x0F, 0x1D, 0xFF, 0x2F, 0x36, 0x4A, 0xFF,
+    0x80, 0x86, 0x97, 0xFF, 0x8E, 0x92, 0xA3, 0xFF, 0xC5, 0xC8, 0xD0, 0xFF, 0x9A, 0x9F, 0xB0, 0xFF, 0x9B, 0xA2, 0xB2, 0xFF, 0xA0, 0xA7, 0xB6, 0xFF,
+    0xA0, 0xA6, 0xB5, 0xFF, 0x9E, 0xA4, 0xB4, 0xFF, 0x9C, 0xA3, 0xB3, 0xFF, 0x9A, 0xA2, 0xB1, 0xFF, 0x9A, 0xA0, 0xB1, 0xFF, 0x9A, 0xA2, 0xB2, 0xFF,
+    0x9C, 0xA3, 0xB2, 0xFF, 0x9B, 0xA2, 0xB1, 0xFF, 0x7D, 0x85, 0x96, 0xFF, 0x21, 0x28, 0x35, 0xFF, 0x0C, 0x11, 0x24, 0xFF, 0x12, 0x15, 0x2A, 0xFF,
+    0x10, 0x13, 0x29, 0xFF, 0x10, 0x13, 0x26, 0xFF, 0x3F, 0x44, 0x5B, 0xFF, 0x68, 0x6D, 0x86, 0xFF, 0x60, 0x65, 0x7D, 0xFF, 0x4B, 0x4F, 0x67, 0xFF,
+    0x57, 0x5B, 0x71, 0xFF, 0x6A, 0x6E, 0x85, 0xFF, 0x76, 0x7A, 0x91, 0xFF, 0x7F, 0x85, 0x9C, 0xFF, 0x7F, 0x85, 0x9A, 0xFF, 0x72, 0x77, 0x8E, 0xFF,
+    0x5A, 0x60, 0x76, 0xFF, 0x38, 0x3D, 0x53, 0xFF, 0x0E, 0x11, 0x1E, 0xFF, 0x08, 0x0C, 0x19, 0xFF, 0x0B, 0x0F, 0x1E, 0xFF, 0x0B, 0x0D, 0x1D, 0xFF,
+    0x09, 0x0C, 0x1C, 0xFF, 0x08, 0x0C, 0x1A, 0xFF, 0x07, 0x0B, 0x19, 0xFF, 0x07, 0x0A, 0x18, 0xFF, 0x07, 0x09, 0x17, 0xFF, 0x08, 0x09, 0x16, 0xFF,
+    0x06, 0x09, 0x16, 0xFF, 0x06, 0x09, 0x14, 0xFF, 0x06, 0x08, 0x13, 0xFF, 0x80, 0x05, 0x07, 0x13, 0xFF, 0x04, 0x05, 0x06, 0x13, 0xFF, 0x05, 0x07,
+    0x13, 0xFF, 0x05, 0x08, 0x12, 0xFF, 0x05, 0x07, 0x12, 0xFF, 0x04, 0x07, 0x11, 0xFF, 0x80, 0x05, 0x07, 0x11, 0xFF, 0x00, 0x04, 0x06, 0x11, 0xFF,
+    0x80, 0x04, 0x07, 0x11, 0xFF, 0x80, 0x04, 0x07, 0x10, 0xFF, 0x16, 0x04, 0x06, 0x10, 0xFF, 0x03, 0x06, 0x10, 0xFF, 0x04, 0x06, 0x10, 0xFF, 0x04,
+    0x06, 0x11, 0xFF, 0x03, 0x06, 0x10, 0xFF, 0x03, 0x06, 0x0F, 0xFF, 0x04, 0x07, 0x0F, 0xFF, 0x03, 0x07, 0x0F, 0xFF, 0x04, 0x07, 0x0F, 0xFF, 0x04,
+    0x06, 0x0D, 0xFF, 0x04, 0x06, 0x0E, 0xFF, 0x03, 0x06, 0x0D, 0xFF, 0x02, 0x06, 0x0C, 0xFF, 0x03, 0x06, 0x0C, 0xFF, 0x03, 0x06, 0x0B, 0xFF, 0x02,
+    0x04, 0x0B, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x02, 0x05, 0x0B, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x03,
+    0x04, 0x0A, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x82, 0x02, 0x03, 0x07, 0xFF, 0x00, 0x02, 0x03, 0x06, 0xFF, 0x80, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x01,
+    0x01, 0x05, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x05, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x02, 0xFF,
+    0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x01, 0x02, 0xFF, 0x03, 0x00, 0x00, 0x02, 0xFF, 0x01,
+    0x00, 0x03, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x80, 0x01, 0x02, 0x03, 0xFF, 0x04, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x02, 0x05,
+    0xFF, 0x00, 0x02, 0x04, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x00, 0x02, 0x03, 0xFF, 0x81, 0x01, 0x02, 0x05, 0xFF, 0x02, 0x01, 0x03, 0x07, 0xFF, 0x01,
+    0x04, 0x07, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x80, 0x02, 0x04, 0x0A, 0xFF, 0x39, 0x02, 0x05, 0x0C, 0xFF, 0x03, 0x05, 0x0E, 0xFF, 0x03, 0x06, 0x0F,
+    0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x02, 0x04, 0x0C, 0xFF, 0x04, 0x06, 0x10, 0xFF, 0x1D, 0x1F, 0x2C, 0xFF, 0x31, 0x35, 0x43, 0xFF, 0x3C, 0x40, 0x52,
+    0xFF, 0x3A, 0x3D, 0x51, 0xFF, 0x34, 0x35, 0x4A, 0xFF, 0x36, 0x37, 0x4D, 0xFF, 0x3C, 0x3D, 0x55, 0xFF, 0x3E, 0x3F, 0x59, 0xFF, 0x42, 0x43, 0x5D,
+    0xFF, 0x35, 0x37, 0x4D, 0xFF, 0x1D, 0x20, 0x2F, 0xFF, 0x0A, 0x0B, 0x16, 0xFF, 0x0B, 0x0C, 0x19, 0xFF, 0x09, 0x0C, 0x18, 0xFF, 0x07, 0x09, 0x15,
+    0xFF, 0x03, 0x05, 0x0A, 0xFF, 0x1D, 0x21, 0x2D, 0xFF, 0x3B, 0x42, 0x57, 0xFF, 0x30, 0x37, 0x4B, 0xFF, 0x34, 0x3B, 0x50, 0xFF, 0x37, 0x3E, 0x53,
+    0xFF, 0x37, 0x3E, 0x52, 0xFF, 0x39, 0x3F, 0x54, 0xFF, 0x39, 0x40, 0x54, 0xFF, 0x3D, 0x45, 0x5B, 0xFF, 0x45, 0x4C, 0x64, 0xFF, 0x4A, 0x51, 0x69,
+    0xFF, 0x4C, 0x54, 0x6A, 0xFF, 0x52, 0x59, 0x6F, 0xFF, 0x54, 0x5A, 0x71, 0xFF, 0x56, 0x5D, 0x73, 0xFF, 0x53, 0x5A, 0x71, 0xFF, 0x53, 0x5B, 0x71,
+    0xFF, 0x56, 0x5D, 0x73, 0xFF, 0x53, 0x59, 0x71, 0xFF, 0x55, 0x5D, 0x75, 0xFF, 0x5C, 0x64, 0x7B, 0xFF, 0x5E, 0x66, 0x7C, 0xFF, 0x5E, 0x69, 0x7F,
+    0xFF, 0xC4, 0xCB, 0xD2, 0xFF, 0xC7, 0xC9, 0xCF, 0xFF, 0xBE, 0xC0, 0xC7, 0xFF, 0x94, 0x96, 0xA6, 0xFF, 0x11, 0x15, 0x1F, 0xFF, 0x09, 0x0C, 0x1A,
+    0xFF, 0x0A, 0x0D, 0x1E, 0xFF, 0x08, 0x0D, 0x1C, 0xFF, 0x09, 0x0B, 0x1A, 0xFF, 0x08, 0x0A, 0x19, 0xFF, 0x07, 0x09, 0x17, 0xFF, 0x07, 0x09, 0x15,
+    0xFF, 0x06, 0x08, 0x14, 0xFF, 0x80, 0x06, 0x07, 0x13, 0xFF, 0x2C, 0x06, 0x06, 0x13, 0xFF, 0x06, 0x09, 0x14, 0xFF, 0x07, 0x09, 0x15, 0xFF, 0x07,
+    0x08, 0x17, 0xFF, 0x07, 0x0A, 0x18, 0xFF, 0x07, 0x0C, 0x1A, 0xFF, 0x09, 0x0D, 0x1D, 0xFF, 0x09, 0x0C, 0x1B, 0xFF, 0x16, 0x17, 0x1F, 0xFF, 0x8C,
+    0x92, 0xA1, 0xFF, 0x8E, 0x94, 0xA8, 0xFF, 0x8C, 0x93, 0xA7, 0xFF, 0x8F, 0x94, 0xA9, 0xFF, 0x90, 0x95, 0xA9, 0xFF, 0x8F, 0x96, 0xA9, 0xFF, 0x8F,
+    0x95, 0xA9, 0xFF, 0x91, 0x97, 0xA9, 0xFF, 0x93, 0x98, 0xAB, 0xFF, 0x96, 0x9B, 0xAC, 0xFF, 0x98, 0x9E, 0xAE, 0xFF, 0x97, 0x9D, 0xAE, 0xFF, 0x97,
+    0x9C, 0xAC, 0xFF, 0x96, 0x9C, 0xAD, 0xFF, 0x97, 0x9C, 0xAD, 0xFF, 0x97, 0x9C, 0xAC, 0xFF, 0x99, 0x9E, 0xAD, 0xFF, 0x9B, 0xA0, 0xB0, 0xFF, 0x9C,
+    0xA2, 0xB2, 0xFF, 0x9E, 0xA5, 0xB4, 0xFF, 0x9F, 0xA5, 0xB3, 0xFF, 0x9F, 0xA5, 0xB4, 0xFF, 0xBB, 0xC2, 0xCB, 0xFF, 0x90, 0x95, 0xA5, 0xFF, 0x4E,
+    0x51, 0x5E, 0xFF, 0x05, 0x06, 0x10, 0xFF, 0x0C, 0x0F, 0x1F, 0xFF, 0x09, 0x0D, 0x1A, 0xFF, 0x07, 0x0B, 0x18, 0xFF, 0x07, 0x09, 0x16, 0xFF, 0x07,
+    0x08, 0x13, 0xFF, 0x05, 0x09, 0x13, 0xFF, 0x06, 0x08, 0x13, 0xFF, 0x06, 0x07, 0x12, 0xFF, 0x05, 0x08, 0x12, 0xFF, 0x06, 0x08, 0x12, 0xFF, 0x80,
+    0x07, 0x08, 0x12, 0xFF, 0x81, 0x06, 0x08, 0x12, 0xFF, 0x04, 0x06, 0x08, 0x13, 0xFF, 0x06, 0x09, 0x13, 0xFF, 0x07, 0x09, 0x14, 0xFF, 0x07, 0x09,
+    0x15, 0xFF, 0x08, 0x0A, 0x15, 0xFF, 0x80, 0x07, 0x0A, 0x16, 0xFF, 0x05, 0x08, 0x0B, 0x16, 0xFF, 0x08, 0x0B, 0x17, 0xFF, 0x08, 0x0A, 0x16, 0xFF,
+    0x08, 0x0A, 0x15, 0xFF, 0x07, 0x0A, 0x15, 0xFF, 0x07, 0x0A, 0x14, 0xFF, 0x80, 0x07, 0x09, 0x14, 0xFF, 0x11, 0x07, 0x0B, 0x15, 0xFF, 0x06, 0x0A,
+    0x14, 0xFF, 0x06, 0x09, 0x13, 0xFF, 0x06, 0x0A, 0x13, 0xFF, 0x05, 0x09, 0x12, 0xFF, 0x06, 0x08, 0x12, 0xFF, 0x05, 0x07, 0x12, 0xFF, 0x05, 0x07,
+    0x11, 0xFF, 0x05, 0x07, 0x10, 0xFF, 0x04, 0x06, 0x10, 0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x03, 0x05, 0x0F, 0xFF, 0x04, 0x05, 0x0F, 0xFF, 0x04, 0x05,
+    0x0E, 0xFF, 0x03, 0x04, 0x0D, 0xFF, 0x04, 0x04, 0x0D, 0xFF, 0x03, 0x04, 0x0D, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x80, 0x03, 0x04, 0x0D, 0xFF, 0x01,
+    0x03, 0x04, 0x0C, 0xFF, 0x03, 0x04, 0x0D, 0xFF, 0x81, 0x03, 0x04, 0x0C, 0xFF, 0x0D, 0x03, 0x05, 0x0D, 0xFF, 0x04, 0x05, 0x0D, 0xFF, 0x04, 0x06,
+    0x0D, 0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x04, 0x06, 0x10, 0xFF, 0x05, 0x07, 0x10, 0xFF, 0x04, 0x06, 0x10, 0xFF, 0x05, 0x07, 0x11, 0xFF, 0x06, 0x08,
+    0x12, 0xFF, 0x05, 0x08, 0x12, 0xFF, 0x05, 0x09, 0x12, 0xFF, 0x06, 0x08, 0x14, 0xFF, 0x07, 0x09, 0x16, 0xFF, 0x08, 0x0A, 0x18, 0xFF, 0x81, 0x09,
+    0x0B, 0x1A, 0xFF, 0x11, 0x09, 0x0C, 0x1B, 0xFF, 0x09, 0x0B, 0x1B, 0xFF, 0x09, 0x0B, 0x19, 0xFF, 0x09, 0x0B, 0x18, 0xFF, 0x09, 0x0B, 0x19, 0xFF,
+    0x0A, 0x0D, 0x1D, 0xFF, 0x0C, 0x0F, 0x20, 0xFF, 0x0D, 0x11, 0x22, 0xFF, 0x0E, 0x13, 0x25, 0xFF, 0x0F, 0x13, 0x26, 0xFF, 0x10, 0x15, 0x29, 0xFF,
+    0x07, 0x0E, 0x1D, 0xFF, 0x2D, 0x35, 0x47, 0xFF, 0x7F, 0x85, 0x95, 0xFF, 0x8D, 0x93, 0xA3, 0xFF, 0xC3, 0xC6, 0xCE, 0xFF, 0x95, 0x9B, 0xAC, 0xFF,
+    0x96, 0x9E, 0xAF, 0xFF, 0x80, 0x9C, 0xA3, 0xB2, 0xFF, 0x26, 0x99, 0xA0, 0xB0, 0xFF, 0x98, 0x9F, 0xB0, 0xFF, 0x97, 0x9F, 0xAF, 0xFF, 0x95, 0x9C,
+    0xAD, 0xFF, 0x93, 0x9C, 0xAD, 0xFF, 0x96, 0x9E, 0xAF, 0xFF, 0x96, 0x9D, 0xAE, 0xFF, 0x79, 0x81, 0x93, 0xFF, 0x20, 0x26, 0x34, 0xFF, 0x0E, 0x11,
+    0x24, 0xFF, 0x12, 0x17, 0x2A, 0xFF, 0x12, 0x15, 0x2B, 0xFF, 0x10, 0x14, 0x2A, 0xFF, 0x0F, 0x11, 0x25, 0xFF, 0x23, 0x29, 0x3C, 0xFF, 0x4E, 0x55,
+    0x6D, 0xFF, 0x65, 0x6C, 0x86, 0xFF, 0x5E, 0x65, 0x7E, 0xFF, 0x62, 0x67, 0x7F, 0xFF, 0x69, 0x6E, 0x86, 0xFF, 0x6A, 0x70, 0x85, 0xFF, 0x5A, 0x60,
+    0x73, 0xFF, 0x3B, 0x3E, 0x51, 0xFF, 0x0F, 0x11, 0x20, 0xFF, 0x05, 0x07, 0x12, 0xFF, 0x09, 0x0C, 0x1B, 0xFF, 0x0B, 0x0E, 0x1D, 0xFF, 0x0A, 0x0D,
+    0x1D, 0xFF, 0x09, 0x0D, 0x1C, 0xFF, 0x08, 0x0C, 0x1A, 0xFF, 0x07, 0x0C, 0x19, 0xFF, 0x08, 0x0B, 0x19, 0xFF, 0x07, 0x0B, 0x19, 0xFF, 0x07, 0x09,
+    0x18, 0xFF, 0x07, 0x09, 0x17, 0xFF, 0x06, 0x09, 0x16, 0xFF, 0x07, 0x09, 0x16, 0xFF, 0x06, 0x09, 0x15, 0xFF, 0x07, 0x08, 0x16, 0xFF, 0x80, 0x06,
+    0x08, 0x15, 0xFF, 0x01, 0x06, 0x09, 0x14, 0xFF, 0x05, 0x09, 0x13, 0xFF, 0x80, 0x05, 0x08, 0x13, 0xFF, 0x13, 0x04, 0x08, 0x12, 0xFF, 0x05, 0x07,
+    0x13, 0xFF, 0x04, 0x07, 0x12, 0xFF, 0x04, 0x08, 0x12, 0xFF, 0x05, 0x08, 0x12, 0xFF, 0x05, 0x08, 0x13, 0xFF, 0x06, 0x08, 0x14, 0xFF, 0x05, 0x08,
+    0x14, 0xFF, 0x05, 0x08, 0x13, 0xFF, 0x05, 0x08, 0x12, 0xFF, 0x04, 0x08, 0x12, 0xFF, 0x05, 0x08, 0x12, 0xFF, 0x04, 0x07, 0x11, 0xFF, 0x04, 0x08,
+    0x12, 0xFF, 0x04, 0x08, 0x11, 0xFF, 0x04, 0x08, 0x10, 0xFF, 0x04, 0x07, 0x0F, 0xFF, 0x04, 0x07, 0x0E, 0xFF, 0x04, 0x08, 0x0D, 0xFF, 0x03, 0x06,
+    0x0D, 0xFF, 0x80, 0x03, 0x06, 0x0C, 0xFF, 0x01, 0x02, 0x05, 0x0B, 0xFF, 0x03, 0x06, 0x0B, 0xFF, 0x80, 0x03, 0x06, 0x0C, 0xFF, 0x04, 0x03, 0x05,
+    0x0D, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x03, 0x05, 0x0B, 0xFF, 0x02, 0x05, 0x0A, 0xFF, 0x01, 0x04, 0x09, 0xFF, 0x80, 0x02, 0x03, 0x08, 0xFF, 0x05,
+    0x01, 0x02, 0x07, 0xFF, 0x02, 0x03, 0x07, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x02, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x02, 0x02, 0x05, 0xFF,
+    0x82, 0x00, 0x00, 0x01, 0xFF, 0x02, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x0A,
+    0x01, 0x01, 0x02, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x01, 0x01, 0x03, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x02, 0x03, 0xFF,
+    0x01, 0x02, 0x04, 0xFF, 0x00, 0x02, 0x03, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x02, 0x03, 0xFF, 0x80, 0x01, 0x02, 0x04,
+    0xFF, 0x04, 0x01, 0x03, 0x05, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x02, 0x02, 0x07, 0xFF, 0x01, 0x04, 0x07, 0xFF, 0x01, 0x04, 0x09, 0xFF, 0x80, 0x02,
+    0x04, 0x0B, 0xFF, 0x48, 0x03, 0x05, 0x0D, 0xFF, 0x03, 0x05, 0x0F, 0xFF, 0x05, 0x06, 0x11, 0xFF, 0x06, 0x08, 0x14, 0xFF, 0x06, 0x0A, 0x15, 0xFF,
+    0x07, 0x0B, 0x17, 0xFF, 0x0A, 0x0D, 0x19, 0xFF, 0x06, 0x08, 0x13, 0xFF, 0x07, 0x0A, 0x15, 0xFF, 0x1C, 0x20, 0x31, 0xFF, 0x30, 0x33, 0x49, 0xFF,
+    0x36, 0x38, 0x4E, 0xFF, 0x2D, 0x2F, 0x43, 0xFF, 0x22, 0x24, 0x36, 0xFF, 0x1E, 0x1F, 0x2E, 0xFF, 0x0C, 0x0D, 0x18, 0xFF, 0x06, 0x06, 0x0E, 0xFF,
+    0x08, 0x0B, 0x15, 0xFF, 0x08, 0x0B, 0x16, 0xFF, 0x08, 0x0A, 0x15, 0xFF, 0x07, 0x0A, 0x14, 0xFF, 0x04, 0x04, 0x0B, 0xFF, 0x1D, 0x22, 0x2D, 0xFF,
+    0x3B, 0x40, 0x57, 0xFF, 0x2E, 0x33, 0x48, 0xFF, 0x30, 0x36, 0x4A, 0xFF, 0x31, 0x37, 0x4C, 0xFF, 0x37, 0x3D, 0x51, 0xFF, 0x3A, 0x41, 0x56, 0xFF,
+    0x38, 0x40, 0x56, 0xFF, 0x3C, 0x43, 0x5A, 0xFF, 0x43, 0x4B, 0x63, 0xFF, 0x4A, 0x51, 0x69, 0xFF, 0x4E, 0x55, 0x6B, 0xFF, 0x55, 0x5B, 0x72, 0xFF,
+    0x55, 0x5C, 0x72, 0xFF, 0x55, 0x5B, 0x71, 0xFF, 0x51, 0x56, 0x6D, 0xFF, 0x4E, 0x55, 0x6C, 0xFF, 0x4F, 0x56, 0x6D, 0xFF, 0x4D, 0x55, 0x6C, 0xFF,
+    0x50, 0x58, 0x70, 0xFF, 0x54, 0x5B, 0x72, 0xFF, 0x55, 0x5E, 0x74, 0xFF, 0x51, 0x5B, 0x72, 0xFF, 0x9B, 0xA3, 0xB0, 0xFF, 0xD0, 0xD2, 0xD8, 0xFF,
+    0xBC, 0xBE, 0xC6, 0xFF, 0xB1, 0xB4, 0xBC, 0xFF, 0x30, 0x31, 0x3C, 0xFF, 0x08, 0x09, 0x17, 0xFF, 0x0C, 0x10, 0x20, 0xFF, 0x0A, 0x0E, 0x1E, 0xFF,
+    0x09, 0x0C, 0x1B, 0xFF, 0x08, 0x0B, 0x1A, 0xFF, 0x07, 0x0A, 0x18, 0xFF, 0x06, 0x0A, 0x16, 0xFF, 0x06, 0x08, 0x15, 0xFF, 0x07, 0x06, 0x13, 0xFF,
+    0x06, 0x06, 0x13, 0xFF, 0x06, 0x06, 0x14, 0xFF, 0x06, 0x08, 0x14, 0xFF, 0x06, 0x09, 0x15, 0xFF, 0x07, 0x0A, 0x18, 0xFF, 0x07, 0x0B, 0x1A, 0xFF,
+    0x08, 0x0C, 0x1C, 0xFF, 0x0A, 0x0E, 0x1E, 0xFF, 0x0A, 0x0B, 0x18, 0xFF, 0x50, 0x54, 0x61, 0xFF, 0x90, 0x96, 0xA4, 0xFF, 0x8A, 0x91, 0xA6, 0xFF,
+    0x89, 0x90, 0xA6, 0xFF, 0x8B, 0x91, 0xA6, 0xFF, 0x80, 0x8C, 0x92, 0xA6, 0xFF, 0x07, 0x8C, 0x92, 0xA5, 0xFF, 0x8C, 0x93, 0xA6, 0xFF, 0x8E, 0x94,
+    0xA7, 0xFF, 0x91, 0x96, 0xA9, 0xFF, 0x92, 0x98, 0xAA, 0xFF, 0x93, 0x98, 0xAA, 0xFF, 0x92, 0x98, 0xA9, 0xFF, 0x93, 0x98, 0xA9, 0xFF, 0x81, 0x93,
+    0x99, 0xA9, 0xFF, 0x0D, 0x95, 0x9B, 0xAB, 0xFF, 0x96, 0x9D, 0xAD, 0xFF, 0x99, 0x9F, 0xAF, 0xFF, 0x9A, 0xA0, 0xAF, 0xFF, 0x9B, 0xA0, 0xB0, 0xFF,
+    0xBA, 0xC0, 0xC9, 0xFF, 0x90, 0x95, 0xA5, 0xFF, 0x4E, 0x50, 0x5E, 0xFF, 0x05, 0x07, 0x10, 0xFF, 0x0C, 0x10, 0x1F, 0xFF, 0x09, 0x0B, 0x1A, 0xFF,
+    0x08, 0x0A, 0x17, 0xFF, 0x07, 0x0A, 0x15, 0xFF, 0x06, 0x09, 0x14, 0xFF, 0x80, 0x06, 0x08, 0x13, 0xFF, 0x80, 0x07, 0x08, 0x13, 0xFF, 0x05, 0x07,
+    0x07, 0x12, 0xFF, 0x07, 0x08, 0x13, 0xFF, 0x08, 0x09, 0x13, 0xFF, 0x07, 0x09, 0x14, 0xFF, 0x06, 0x09, 0x13, 0xFF, 0x07, 0x09, 0x14, 0xFF, 0x80,
+    0x08, 0x09, 0x15, 0xFF, 0x01, 0x09, 0x0B, 0x17, 0xFF, 0x0A, 0x0D, 0x1A, 0xFF, 0x80, 0x0A, 0x0D, 0x19, 0xFF, 0x81, 0x08, 0x0C, 0x18, 0xFF, 0x11,
+    0x07, 0x0B, 0x17, 0xFF, 0x06, 0x0A, 0x15, 0xFF, 0x06, 0x0A, 0x14, 0xFF, 0x06, 0x0A, 0x13, 0xFF, 0x05, 0x0A, 0x13, 0xFF, 0x06, 0x0A, 0x13, 0xFF,
+    0x08, 0x0B, 0x16, 0xFF, 0x09, 0x0D, 0x19, 0xFF, 0x08, 0x0B, 0x18, 0xFF, 0x08, 0x0B, 0x16, 0xFF, 0x07, 0x0A, 0x15, 0xFF, 0x07, 0x09, 0x14, 0xFF,
+    0x06, 0x08, 0x12, 0xFF, 0x05, 0x07, 0x12, 0xFF, 0x05, 0x06, 0x11, 0xFF, 0x04, 0x06, 0x11, 0xFF, 0x04, 0x07, 0x11, 0xFF, 0x04, 0x06, 0x10, 0xFF,
+    0x80, 0x03, 0x06, 0x10, 0xFF, 0x00, 0x03, 0x05, 0x0F, 0xFF, 0x80, 0x04, 0x05, 0x0F, 0xFF, 0x04, 0x04, 0x04, 0x0E, 0xFF, 0x04, 0x05, 0x0E, 0xFF,
+    0x03, 0x05, 0x0E, 0xFF, 0x03, 0x04, 0x0E, 0xFF, 0x03, 0x04, 0x0D, 0xFF, 0x81, 0x03, 0x05, 0x0E, 0xFF, 0x02, 0x04, 0x06, 0x0E, 0xFF, 0x04, 0x05,
+    0x0E, 0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x80, 0x05, 0x07, 0x11, 0xFF, 0x80, 0x05, 0x08, 0x12, 0xFF, 0x07, 0x05, 0x08, 0x13, 0xFF, 0x06, 0x09, 0x14,
+    0xFF, 0x06, 0x09, 0x15, 0xFF, 0x06, 0x09, 0x14, 0xFF, 0x06, 0x08, 0x14, 0xFF, 0x08, 0x09, 0x16, 0xFF, 0x08, 0x0B, 0x18, 0xFF, 0x08, 0x0B, 0x1A,
+    0xFF, 0x80, 0x09, 0x0C, 0x1A, 0xFF, 0x14, 0x08, 0x0B, 0x1A, 0xFF, 0x09, 0x0B, 0x1A, 0xFF, 0x07, 0x0A, 0x17, 0xFF, 0x08, 0x0A, 0x17, 0xFF, 0x09,
+    0x0C, 0x1A, 0xFF, 0x0C, 0x10, 0x1F, 0xFF, 0x0D, 0x11, 0x23, 0xFF, 0x0D, 0x12, 0x26, 0xFF, 0x0E, 0x13, 0x27, 0xFF, 0x0F, 0x13, 0x28, 0xFF, 0x10,
+    0x14, 0x28, 0xFF, 0x08, 0x0C, 0x1B, 0xFF, 0x2C, 0x34, 0x46, 0xFF, 0x7E, 0x83, 0x94, 0xFF, 0x8D, 0x92, 0xA3, 0xFF, 0xC1, 0xC5, 0xCE, 0xFF, 0x90,
+    0x97, 0xA9, 0xFF, 0x92, 0x9A, 0xAB, 0xFF, 0x96, 0x9D, 0xAF, 0xFF, 0x97, 0x9E, 0xAE, 0xFF, 0x94, 0x9C, 0xAC, 0xFF, 0x80, 0x93, 0x9B, 0xAC, 0xFF,
+    0x13, 0x93, 0x99, 0xAB, 0xFF, 0x91, 0x99, 0xAB, 0xFF, 0x93, 0x9B, 0xAC, 0xFF, 0x92, 0x9A, 0xAB, 0xFF, 0x77, 0x7E, 0x92, 0xFF, 0x21, 0x25, 0x33,
+    0xFF, 0x0E, 0x11, 0x22, 0xFF, 0x11, 0x16, 0x2A, 0xFF, 0x12, 0x15, 0x2C, 0xFF, 0x11, 0x15, 0x2B, 0xFF, 0x12, 0x15, 0x2B, 0xFF, 0x0D, 0x11, 0x25,
+    0xFF, 0x13, 0x17, 0x2A, 0xFF, 0x1D, 0x23, 0x35, 0xFF, 0x2D, 0x33, 0x47, 0xFF, 0x36, 0x3D, 0x51, 0xFF, 0x39, 0x3E, 0x51, 0xFF, 0x2A, 0x2E, 0x41,
+    0xFF, 0x14, 0x18, 0x28, 0xFF, 0x08, 0x0D, 0x1C, 0xFF, 0x80, 0x0C, 0x0F, 0x21, 0xFF, 0x06, 0x0C, 0x0E, 0x1E, 0xFF, 0x0A, 0x0D, 0x1D, 0xFF, 0x08,
+    0x0C, 0x1C, 0xFF, 0x08, 0x0C, 0x1A, 0xFF, 0x08, 0x0B, 0x19, 0xFF, 0x08, 0x0B, 0x18, 0xFF, 0x07, 0x0B, 0x19, 0xFF, 0x80, 0x07, 0x0A, 0x18, 0xFF,
+    0x06, 0x07, 0x0A, 0x19, 0xFF, 0x06, 0x0A, 0x17, 0xFF, 0x07, 0x0A, 0x18, 0xFF, 0x07, 0x0A, 0x19, 0xFF, 0x07, 0x0B, 0x18, 0xFF, 0x07, 0x0A, 0x18,
+    0xFF, 0x08, 0x0A, 0x17, 0xFF, 0x80, 0x07, 0x0A, 0x17, 0xFF, 0x0A, 0x06, 0x09, 0x16, 0xFF, 0x06, 0x0A, 0x17, 0xFF, 0x05, 0x0A, 0x16, 0xFF, 0x05,
+    0x09, 0x16, 0xFF, 0x05, 0x09, 0x15, 0xFF, 0x05, 0x09, 0x14, 0xFF, 0x05, 0x09, 0x13, 0xFF, 0x06, 0x09, 0x13, 0xFF, 0x06, 0x09, 0x14, 0xFF, 0x05,
+    0x09, 0x13, 0xFF, 0x05, 0x09, 0x12, 0xFF, 0x80, 0x06, 0x09, 0x11, 0xFF, 0x80, 0x06, 0x08, 0x10, 0xFF, 0x07, 0x06, 0x09, 0x12, 0xFF, 0x05, 0x09,
+    0x13, 0xFF, 0x06, 0x09, 0x13, 0xFF, 0x06, 0x09, 0x11, 0xFF, 0x05, 0x09, 0x11, 0xFF, 0x05, 0x08, 0x11, 0xFF, 0x04, 0x07, 0x10, 0xFF, 0x04, 0x06,
+    0x0D, 0xFF, 0x80, 0x03, 0x05, 0x0B, 0xFF, 0x0F, 0x03, 0x05, 0x0C, 0xFF, 0x03, 0x06, 0x0C, 0xFF, 0x04, 0x07, 0x0E, 0xFF, 0x04, 0x07, 0x0F, 0xFF,
+    0x04, 0x06, 0x10, 0xFF, 0x03, 0x07, 0x0F, 0xFF, 0x03, 0x06, 0x0D, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x03, 0x05, 0x0B, 0xFF, 0x02, 0x03, 0x0A, 0xFF,
+    0x02, 0x03, 0x09, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x02, 0x03, 0x07, 0xFF, 0x02, 0x03, 0x06, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x02, 0x05, 0xFF,
+    0x00, 0x00, 0x00, 0x02, 0xFF, 0x81, 0x00, 0x00, 0x01, 0xFF, 0x0E, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x01, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x01,
+    0x01, 0x02, 0xFF, 0x01, 0x01, 0x03, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x00, 0x02, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x02, 0x03, 0xFF, 0x80,
+    0x01, 0x02, 0x04, 0xFF, 0x4D, 0x00, 0x02, 0x04, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x02, 0x03, 0x08,
+    0xFF, 0x01, 0x04, 0x09, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x02, 0x05, 0x0D, 0xFF, 0x03, 0x06, 0x0F, 0xFF, 0x04, 0x07, 0x11, 0xFF, 0x04, 0x07, 0x10,
+    0xFF, 0x04, 0x07, 0x11, 0xFF, 0x05, 0x08, 0x13, 0xFF, 0x06, 0x0B, 0x18, 0xFF, 0x07, 0x0B, 0x1A, 0xFF, 0x06, 0x0A, 0x18, 0xFF, 0x05, 0x09, 0x17,
+    0xFF, 0x08, 0x0A, 0x17, 0xFF, 0x07, 0x0B, 0x15, 0xFF, 0x09, 0x0D, 0x17, 0xFF, 0x06, 0x07, 0x11, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x07, 0x09, 0x11,
+    0xFF, 0x08, 0x0B, 0x15, 0xFF, 0x08, 0x0A, 0x14, 0xFF, 0x09, 0x0B, 0x15, 0xFF, 0x08, 0x0A, 0x15, 0xFF, 0x07, 0x0B, 0x15, 0xFF, 0x07, 0x0A, 0x14,
+    0xFF, 0x05, 0x05, 0x0C, 0xFF, 0x1E, 0x22, 0x2E, 0xFF, 0x3B, 0x41, 0x56, 0xFF, 0x2C, 0x32, 0x45, 0xFF, 0x2F, 0x34, 0x49, 0xFF, 0x31, 0x38, 0x4C,
+    0xFF, 0x38, 0x3E, 0x54, 0xFF, 0x39, 0x40, 0x57, 0xFF, 0x38, 0x40, 0x56, 0xFF, 0x3C, 0x43, 0x5A, 0xFF, 0x43, 0x49, 0x61, 0xFF, 0x4A, 0x51, 0x67,
+    0xFF, 0x4E, 0x54, 0x6B, 0xFF, 0x50, 0x57, 0x6F, 0xFF, 0x4F, 0x56, 0x6D, 0xFF, 0x50, 0x56, 0x6D, 0xFF, 0x4D, 0x53, 0x6A, 0xFF, 0x4F, 0x56, 0x6C,
+    0xFF, 0x52, 0x59, 0x6F, 0xFF, 0x50, 0x58, 0x6F, 0xFF, 0x51, 0x58, 0x70, 0xFF, 0x52, 0x5A, 0x71, 0xFF, 0x55, 0x5E, 0x74, 0xFF, 0x58, 0x60, 0x77,
+    0xFF, 0x63, 0x6D, 0x81, 0xFF, 0xCC, 0xD1, 0xD7, 0xFF, 0xC2, 0xC5, 0xCB, 0xFF, 0xBA, 0xBD, 0xC5, 0xFF, 0x7F, 0x81, 0x90, 0xFF, 0x01, 0x03, 0x0E,
+    0xFF, 0x0C, 0x11, 0x23, 0xFF, 0x0B, 0x0F, 0x20, 0xFF, 0x09, 0x0C, 0x1C, 0xFF, 0x07, 0x0B, 0x1A, 0xFF, 0x07, 0x0A, 0x19, 0xFF, 0x07, 0x09, 0x17,
+    0xFF, 0x07, 0x07, 0x16, 0xFF, 0x07, 0x06, 0x14, 0xFF, 0x06, 0x07, 0x13, 0xFF, 0x06, 0x06, 0x13, 0xFF, 0x06, 0x08, 0x15, 0xFF, 0x07, 0x08, 0x15,
+    0xFF, 0x07, 0x0A, 0x18, 0xFF, 0x07, 0x0C, 0x1B, 0xFF, 0x09, 0x0D, 0x1E, 0xFF, 0x0B, 0x0E, 0x1E, 0xFF, 0x10, 0x11, 0x19, 0xFF, 0x83, 0x87, 0x98,
+    0xFF, 0x8D, 0x94, 0xA6, 0xFF, 0x80, 0x86, 0x8D, 0xA2, 0xFF, 0x08, 0x85, 0x8C, 0xA1, 0xFF, 0x86, 0x8D, 0xA1, 0xFF, 0x89, 0x8F, 0xA3, 0xFF, 0x8A,
+    0x8F, 0xA3, 0xFF, 0x8A, 0x8F, 0xA5, 0xFF, 0x8A, 0x91, 0xA5, 0xFF, 0x8C, 0x92, 0xA6, 0xFF, 0x8E, 0x94, 0xA6, 0xFF, 0x90, 0x96, 0xA7, 0xFF, 0x80,
+    0x90, 0x96, 0xA8, 0xFF, 0x00, 0x8F, 0x96, 0xA7, 0xFF, 0x80, 0x8F, 0x95, 0xA6, 0xFF, 0x14, 0x8F, 0x95, 0xA7, 0xFF, 0x90, 0x97, 0xA9, 0xFF, 0x92,
+    0x99, 0xAA, 0xFF, 0x94, 0x9A, 0xAB, 0xFF, 0x96, 0x9C, 0xAC, 0xFF, 0xB9, 0xBE, 0xC8, 0xFF, 0x8F, 0x95, 0xA5, 0xFF, 0x4E, 0x50, 0x5F, 0xFF, 0x05,
+    0x06, 0x10, 0xFF, 0x0C, 0x10, 0x1F, 0xFF, 0x09, 0x0C, 0x1A, 0xFF, 0x08, 0x0A, 0x19, 0xFF, 0x07, 0x0A, 0x15, 0xFF, 0x06, 0x0A, 0x14, 0xFF, 0x06,
+    0x09, 0x14, 0xFF, 0x06, 0x08, 0x13, 0xFF, 0x07, 0x08, 0x13, 0xFF, 0x07, 0x09, 0x14, 0xFF, 0x07, 0x09, 0x13, 0xFF, 0x07, 0x09, 0x14, 0xFF, 0x07,
+    0x0A, 0x15, 0xFF, 0x80, 0x08, 0x0A, 0x17, 0xFF, 0x1F, 0x08, 0x0A, 0x16, 0xFF, 0x09, 0x0B, 0x18, 0xFF, 0x07, 0x09, 0x16, 0xFF, 0x07, 0x09, 0x15,
+    0xFF, 0x07, 0x0A, 0x15, 0xFF, 0x05, 0x07, 0x10, 0xFF, 0x15, 0x16, 0x1B, 0xFF, 0x1F, 0x1F, 0x24, 0xFF, 0x21, 0x22, 0x27, 0xFF, 0x24, 0x24, 0x29,
+    0xFF, 0x26, 0x26, 0x2A, 0xFF, 0x24, 0x25, 0x28, 0xFF, 0x23, 0x24, 0x27, 0xFF, 0x21, 0x21, 0x25, 0xFF, 0x1E, 0x1F, 0x23, 0xFF, 0x1C, 0x1D, 0x20,
+    0xFF, 0x14, 0x15, 0x19, 0xFF, 0x0B, 0x0E, 0x14, 0xFF, 0x06, 0x09, 0x12, 0xFF, 0x07, 0x0A, 0x15, 0xFF, 0x09, 0x0C, 0x18, 0xFF, 0x08, 0x0A, 0x16,
+    0xFF, 0x07, 0x08, 0x13, 0xFF, 0x06, 0x08, 0x13, 0xFF, 0x06, 0x08, 0x12, 0xFF, 0x05, 0x07, 0x12, 0xFF, 0x05, 0x07, 0x13, 0xFF, 0x05, 0x07, 0x11,
+    0xFF, 0x05, 0x07, 0x10, 0xFF, 0x04, 0x06, 0x10, 0xFF, 0x04, 0x05, 0x10, 0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x82, 0x04, 0x05, 0x0F, 0xFF, 0x2A, 0x03,
+    0x05, 0x0E, 0xFF, 0x04, 0x04, 0x0E, 0xFF, 0x04, 0x05, 0x0F, 0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x04, 0x05, 0x0F, 0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x04,
+    0x06, 0x10, 0xFF, 0x05, 0x06, 0x10, 0xFF, 0x05, 0x07, 0x11, 0xFF, 0x06, 0x08, 0x12, 0xFF, 0x06, 0x09, 0x14, 0xFF, 0x06, 0x09, 0x15, 0xFF, 0x07,
+    0x0A, 0x16, 0xFF, 0x08, 0x0B, 0x17, 0xFF, 0x08, 0x0B, 0x19, 0xFF, 0x06, 0x09, 0x15, 0xFF, 0x02, 0x04, 0x0D, 0xFF, 0x05, 0x05, 0x0C, 0xFF, 0x17,
+    0x16, 0x1B, 0xFF, 0x21, 0x20, 0x26, 0xFF, 0x26, 0x24, 0x2A, 0xFF, 0x27, 0x27, 0x2C, 0xFF, 0x28, 0x28, 0x2E, 0xFF, 0x28, 0x28, 0x2D, 0xFF, 0x28,
+    0x27, 0x2B, 0xFF, 0x26, 0x26, 0x2A, 0xFF, 0x25, 0x24, 0x29, 0xFF, 0x1F, 0x20, 0x25, 0xFF, 0x12, 0x13, 0x1C, 0xFF, 0x0A, 0x0D, 0x1C, 0xFF, 0x0E,
+    0x12, 0x25, 0xFF, 0x0F, 0x13, 0x28, 0xFF, 0x10, 0x15, 0x2A, 0xFF, 0x08, 0x0C, 0x1A, 0xFF, 0x2E, 0x35, 0x47, 0xFF, 0x7E, 0x83, 0x95, 0xFF, 0x8E,
+    0x92, 0xA3, 0xFF, 0xC2, 0xC6, 0xCD, 0xFF, 0x8D, 0x93, 0xA6, 0xFF, 0x8E, 0x96, 0xA8, 0xFF, 0x92, 0x99, 0xAB, 0xFF, 0x93, 0x99, 0xAC, 0xFF, 0x90,
+    0x97, 0xA9, 0xFF, 0x80, 0x8E, 0x96, 0xA8, 0xFF, 0x1A, 0x8E, 0x95, 0xA8, 0xFF, 0x8E, 0x96, 0xA9, 0xFF, 0x90, 0x97, 0xAA, 0xFF, 0x8E, 0x96, 0xA8,
+    0xFF, 0x77, 0x7D, 0x91, 0xFF, 0x22, 0x26, 0x33, 0xFF, 0x0D, 0x11, 0x23, 0xFF, 0x11, 0x15, 0x29, 0xFF, 0x11, 0x15, 0x2B, 0xFF, 0x11, 0x16, 0x2C,
+    0xFF, 0x11, 0x16, 0x2B, 0xFF, 0x12, 0x18, 0x30, 0xFF, 0x14, 0x19, 0x32, 0xFF, 0x0D, 0x13, 0x28, 0xFF, 0x0D, 0x12, 0x29, 0xFF, 0x11, 0x15, 0x2E,
+    0xFF, 0x10, 0x15, 0x2B, 0xFF, 0x0F, 0x15, 0x2B, 0xFF, 0x11, 0x15, 0x2B, 0xFF, 0x10, 0x14, 0x28, 0xFF, 0x0E, 0x12, 0x23, 0xFF, 0x0C, 0x0E, 0x1E,
+    0xFF, 0x0B, 0x0E, 0x1D, 0xFF, 0x09, 0x0C, 0x1A, 0xFF, 0x08, 0x0B, 0x1A, 0xFF, 0x08, 0x0C, 0x1A, 0xFF, 0x08, 0x0B, 0x19, 0xFF, 0x80, 0x07, 0x0B,
+    0x18, 0xFF, 0x0A, 0x07, 0x0A, 0x18, 0xFF, 0x07, 0x0B, 0x19, 0xFF, 0x07, 0x0B, 0x1A, 0xFF, 0x07, 0x0B, 0x19, 0xFF, 0x08, 0x0A, 0x1A, 0xFF, 0x08,
+    0x0C, 0x1A, 0xFF, 0x09, 0x0C, 0x1B, 0xFF, 0x08, 0x0D, 0x1B, 0xFF, 0x09, 0x0D, 0x1C, 0xFF, 0x08, 0x0C, 0x1C, 0xFF, 0x08, 0x0C, 0x1B, 0xFF, 0x80,
+    0x08, 0x0B, 0x1A, 0xFF, 0x10, 0x08, 0x0C, 0x1A, 0xFF, 0x06, 0x0B, 0x18, 0xFF, 0x04, 0x08, 0x11, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x0D, 0x0B, 0x0F,
+    0xFF, 0x19, 0x17, 0x1A, 0xFF, 0x22, 0x21, 0x22, 0xFF, 0x27, 0x26, 0x27, 0xFF, 0x29, 0x28, 0x2A, 0xFF, 0x29, 0x27, 0x29, 0xFF, 0x27, 0x27, 0x28,
+    0xFF, 0x25, 0x24, 0x25, 0xFF, 0x21, 0x21, 0x22, 0xFF, 0x1C, 0x1C, 0x1E, 0xFF, 0x11, 0x12, 0x14, 0xFF, 0x05, 0x07, 0x0D, 0xFF, 0x07, 0x0A, 0x13,
+    0xFF, 0x80, 0x07, 0x0B, 0x15, 0xFF, 0x0E, 0x07, 0x0B, 0x14, 0xFF, 0x06, 0x09, 0x12, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x01,
+    0x03, 0x08, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x02, 0x04, 0x0C, 0xFF, 0x03, 0x06, 0x0E, 0xFF, 0x04, 0x07, 0x0F, 0xFF, 0x04, 0x08, 0x0E, 0xFF, 0x04,
+    0x07, 0x0E, 0xFF, 0x02, 0x05, 0x0B, 0xFF, 0x01, 0x04, 0x08, 0xFF, 0x02, 0x03, 0x07, 0xFF, 0x02, 0x02, 0x06, 0xFF, 0x80, 0x02, 0x03, 0x06, 0xFF,
+    0x02, 0x02, 0x03, 0x07, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x02, 0x02, 0x06, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x04, 0x00, 0x00, 0x01, 0xFF, 0x01,
+    0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x02,
+    0xFF, 0x01, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x01, 0x02, 0xFF, 0x01, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x02, 0x03, 0xFF,
+    0x81, 0x01, 0x02, 0x04, 0xFF, 0x07, 0x00, 0x02, 0x03, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x03, 0x05, 0xFF, 0x02, 0x02, 0x06, 0xFF, 0x01, 0x03,
+    0x08, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x02, 0x05, 0x0B, 0xFF, 0x80, 0x02, 0x06, 0x0D, 0xFF, 0x01, 0x03, 0x05, 0x0E, 0xFF,
+    0x05, 0x06, 0x10, 0xFF, 0x80, 0x06, 0x09, 0x13, 0xFF, 0x4C, 0x06, 0x0A, 0x15, 0xFF, 0x0A, 0x0D, 0x19, 0xFF, 0x0B, 0x0D, 0x19, 0xFF, 0x0A, 0x0D,
+    0x1A, 0xFF, 0x09, 0x0D, 0x19, 0xFF, 0x09, 0x0C, 0x17, 0xFF, 0x05, 0x08, 0x12, 0xFF, 0x03, 0x05, 0x0E, 0xFF, 0x01, 0x03, 0x09, 0xFF, 0x01, 0x03,
+    0x08, 0xFF, 0x05, 0x06, 0x0F, 0xFF, 0x08, 0x09, 0x13, 0xFF, 0x08, 0x0B, 0x14, 0xFF, 0x06, 0x09, 0x14, 0xFF, 0x08, 0x0B, 0x15, 0xFF, 0x08, 0x0A,
+    0x15, 0xFF, 0x05, 0x07, 0x0E, 0xFF, 0x1F, 0x23, 0x30, 0xFF, 0x3A, 0x42, 0x55, 0xFF, 0x2E, 0x35, 0x48, 0xFF, 0x33, 0x39, 0x4E, 0xFF, 0x34, 0x3A,
+    0x4F, 0xFF, 0x37, 0x3D, 0x53, 0xFF, 0x38, 0x3E, 0x55, 0xFF, 0x3A, 0x41, 0x55, 0xFF, 0x3D, 0x43, 0x5A, 0xFF, 0x41, 0x47, 0x5F, 0xFF, 0x46, 0x4C,
+    0x63, 0xFF, 0x49, 0x50, 0x66, 0xFF, 0x4C, 0x52, 0x69, 0xFF, 0x4D, 0x54, 0x6B, 0xFF, 0x4C, 0x52, 0x69, 0xFF, 0x4B, 0x51, 0x69, 0xFF, 0x4E, 0x54,
+    0x6B, 0xFF, 0x51, 0x58, 0x6F, 0xFF, 0x51, 0x57, 0x70, 0xFF, 0x50, 0x56, 0x6E, 0xFF, 0x51, 0x58, 0x70, 0xFF, 0x54, 0x5C, 0x75, 0xFF, 0x57, 0x5F,
+    0x76, 0xFF, 0x4F, 0x59, 0x6E, 0xFF, 0xAF, 0xB6, 0xC1, 0xFF, 0xCD, 0xD0, 0xD5, 0xFF, 0xBE, 0xC1, 0xC9, 0xFF, 0xA2, 0xA6, 0xAE, 0xFF, 0x14, 0x16,
+    0x23, 0xFF, 0x0D, 0x12, 0x23, 0xFF, 0x0C, 0x11, 0x22, 0xFF, 0x09, 0x0D, 0x1E, 0xFF, 0x08, 0x0B, 0x1B, 0xFF, 0x08, 0x0A, 0x19, 0xFF, 0x08, 0x09,
+    0x18, 0xFF, 0x08, 0x09, 0x16, 0xFF, 0x07, 0x07, 0x14, 0xFF, 0x06, 0x07, 0x12, 0xFF, 0x06, 0x07, 0x13, 0xFF, 0x06, 0x08, 0x14, 0xFF, 0x07, 0x09,
+    0x16, 0xFF, 0x07, 0x0A, 0x18, 0xFF, 0x08, 0x0C, 0x1A, 0xFF, 0x0A, 0x0D, 0x1E, 0xFF, 0x09, 0x0A, 0x19, 0xFF, 0x40, 0x43, 0x4D, 0xFF, 0x8C, 0x90,
+    0x9F, 0xFF, 0x8A, 0x8F, 0xA5, 0xFF, 0x83, 0x8A, 0xA0, 0xFF, 0x83, 0x89, 0x9F, 0xFF, 0x81, 0x88, 0x9D, 0xFF, 0x80, 0x87, 0x9E, 0xFF, 0x84, 0x8B,
+    0xA0, 0xFF, 0x85, 0x8C, 0xA1, 0xFF, 0x86, 0x8C, 0xA1, 0xFF, 0x86, 0x8C, 0xA2, 0xFF, 0x87, 0x8E, 0xA2, 0xFF, 0x88, 0x8F, 0xA3, 0xFF, 0x8A, 0x91,
+    0xA4, 0xFF, 0x8C, 0x92, 0xA4, 0xFF, 0x80, 0x8B, 0x92, 0xA4, 0xFF, 0x22, 0x8B, 0x91, 0xA4, 0xFF, 0x8A, 0x90, 0xA3, 0xFF, 0x8B, 0x91, 0xA3, 0xFF,
+    0x8D, 0x93, 0xA5, 0xFF, 0x90, 0x96, 0xA7, 0xFF, 0x91, 0x96, 0xA8, 0xFF, 0x94, 0x99, 0xAB, 0xFF, 0xB8, 0xBD, 0xC7, 0xFF, 0x91, 0x95, 0xA5, 0xFF,
+    0x4F, 0x51, 0x5F, 0xFF, 0x05, 0x07, 0x12, 0xFF, 0x0D, 0x10, 0x20, 0xFF, 0x0A, 0x0C, 0x1B, 0xFF, 0x08, 0x0B, 0x19, 0xFF, 0x08, 0x0A, 0x16, 0xFF,
+    0x06, 0x09, 0x15, 0xFF, 0x06, 0x08, 0x15, 0xFF, 0x07, 0x09, 0x13, 0xFF, 0x07, 0x08, 0x14, 0xFF, 0x07, 0x09, 0x14, 0xFF, 0x07, 0x08, 0x15, 0xFF,
+    0x07, 0x09, 0x15, 0xFF, 0x07, 0x09, 0x17, 0xFF, 0x08, 0x0B, 0x19, 0xFF, 0x0A, 0x0C, 0x1B, 0xFF, 0x06, 0x0A, 0x16, 0xFF, 0x04, 0x07, 0x12, 0xFF,
+    0x0C, 0x0D, 0x14, 0xFF, 0x36, 0x35, 0x39, 0xFF, 0x45, 0x45, 0x4B, 0xFF, 0x65, 0x65, 0x6A, 0xFF, 0xA1, 0xA0, 0xA4, 0xFF, 0xB2, 0xB0, 0xB3, 0xFF,
+    0xB7, 0xB7, 0xB7, 0xFF, 0xBC, 0xBC, 0xBC, 0xFF, 0x80, 0xC0, 0xBF, 0xBF, 0xFF, 0x0B, 0xBE, 0xBD, 0xBE, 0xFF, 0xBC, 0xBA, 0xBC, 0xFF, 0xB4, 0xB3,
+    0xB7, 0xFF, 0xAA, 0xAA, 0xAE, 0xFF, 0x9F, 0xA0, 0xA5, 0xFF, 0x75, 0x76, 0x7C, 0xFF, 0x3E, 0x3E, 0x42, 0xFF, 0x30, 0x30, 0x34, 0xFF, 0x13, 0x13,
+    0x17, 0xFF, 0x03, 0x04, 0x0B, 0xFF, 0x06, 0x09, 0x14, 0xFF, 0x08, 0x0A, 0x16, 0xFF, 0x80, 0x07, 0x09, 0x14, 0xFF, 0x01, 0x06, 0x08, 0x14, 0xFF,
+    0x06, 0x07, 0x13, 0xFF, 0x80, 0x05, 0x06, 0x11, 0xFF, 0x80, 0x04, 0x05, 0x10, 0xFF, 0x00, 0x05, 0x06, 0x10, 0xFF, 0x81, 0x04, 0x05, 0x0F, 0xFF,
+    0x80, 0x04, 0x05, 0x0E, 0xFF, 0x80, 0x04, 0x06, 0x0F, 0xFF, 0x11, 0x04, 0x07, 0x0F, 0xFF, 0x05, 0x06, 0x10, 0xFF, 0x05, 0x07, 0x10, 0xFF, 0x05,
+    0x08, 0x11, 0xFF, 0x05, 0x09, 0x13, 0xFF, 0x06, 0x08, 0x14, 0xFF, 0x07, 0x0A, 0x16, 0xFF, 0x08, 0x0C, 0x19, 0xFF, 0x09, 0x0C, 0x1A, 0xFF, 0x05,
+    0x08, 0x15, 0xFF, 0x02, 0x03, 0x0D, 0xFF, 0x2C, 0x2C, 0x2F, 0xFF, 0x41, 0x41, 0x46, 0xFF, 0x63, 0x62, 0x6B, 0xFF, 0x93, 0x92, 0x99, 0xFF, 0xAF,
+    0xAE, 0xB3, 0xFF, 0xB7, 0xB5, 0xB9, 0xFF, 0xBA, 0xB9, 0xBC, 0xFF, 0x81, 0xBC, 0xBB, 0xBE, 0xFF, 0x2D, 0xB8, 0xB8, 0xBB, 0xFF, 0xB5, 0xB5, 0xB9,
+    0xFF, 0xAE, 0xAF, 0xB4, 0xFF, 0x80, 0x81, 0x88, 0xFF, 0x4F, 0x51, 0x5A, 0xFF, 0x32, 0x33, 0x3C, 0xFF, 0x0D, 0x0E, 0x1B, 0xFF, 0x09, 0x0D, 0x1D,
+    0xFF, 0x09, 0x0B, 0x19, 0xFF, 0x2E, 0x35, 0x46, 0xFF, 0x80, 0x86, 0x97, 0xFF, 0x8E, 0x95, 0xA5, 0xFF, 0xC2, 0xC7, 0xCD, 0xFF, 0x8C, 0x92, 0xA5,
+    0xFF, 0x8D, 0x94, 0xA7, 0xFF, 0x91, 0x98, 0xAA, 0xFF, 0x90, 0x98, 0xA9, 0xFF, 0x8E, 0x96, 0xA8, 0xFF, 0x8B, 0x93, 0xA7, 0xFF, 0x8B, 0x93, 0xA6,
+    0xFF, 0x8B, 0x92, 0xA5, 0xFF, 0x8A, 0x92, 0xA7, 0xFF, 0x8B, 0x93, 0xA7, 0xFF, 0x8A, 0x91, 0xA5, 0xFF, 0x75, 0x7C, 0x90, 0xFF, 0x21, 0x25, 0x34,
+    0xFF, 0x0D, 0x10, 0x24, 0xFF, 0x11, 0x15, 0x2A, 0xFF, 0x11, 0x14, 0x2A, 0xFF, 0x10, 0x14, 0x29, 0xFF, 0x0F, 0x13, 0x29, 0xFF, 0x0D, 0x10, 0x23,
+    0xFF, 0x0A, 0x0E, 0x1F, 0xFF, 0x0C, 0x11, 0x24, 0xFF, 0x0B, 0x11, 0x27, 0xFF, 0x0E, 0x11, 0x2B, 0xFF, 0x0B, 0x11, 0x27, 0xFF, 0x0C, 0x10, 0x25,
+    0xFF, 0x0B, 0x0E, 0x23, 0xFF, 0x0B, 0x0E, 0x21, 0xFF, 0x07, 0x0A, 0x19, 0xFF, 0x06, 0x08, 0x15, 0xFF, 0x06, 0x07, 0x14, 0xFF, 0x02, 0x04, 0x0F,
+    0xFF, 0x03, 0x05, 0x0E, 0xFF, 0x07, 0x0A, 0x16, 0xFF, 0x80, 0x07, 0x0B, 0x18, 0xFF, 0x34, 0x08, 0x0A, 0x18, 0xFF, 0x07, 0x0A, 0x19, 0xFF, 0x08,
+    0x0B, 0x19, 0xFF, 0x08, 0x0B, 0x1A, 0xFF, 0x08, 0x0C, 0x1A, 0xFF, 0x09, 0x0C, 0x1B, 0xFF, 0x09, 0x0C, 0x1C, 0xFF, 0x09, 0x0E, 0x1E, 0xFF, 0x09,
+    0x0F, 0x1E, 0xFF, 0x0A, 0x0F, 0x20, 0xFF, 0x0B, 0x0E, 0x20, 0xFF, 0x0B, 0x0E, 0x1F, 0xFF, 0x09, 0x0D, 0x1F, 0xFF, 0x06, 0x09, 0x17, 0xFF, 0x03,
+    0x04, 0x0D, 0xFF, 0x1C, 0x1B, 0x1F, 0xFF, 0x34, 0x33, 0x39, 0xFF, 0x4C, 0x4C, 0x55, 0xFF, 0x71, 0x72, 0x7B, 0xFF, 0x8A, 0x8B, 0x93, 0xFF, 0x93,
+    0x96, 0x9C, 0xFF, 0x96, 0x98, 0xA0, 0xFF, 0x97, 0x98, 0xA1, 0xFF, 0x93, 0x96, 0x9E, 0xFF, 0x90, 0x94, 0x9D, 0xFF, 0x8E, 0x90, 0x98, 0xFF, 0x8A,
+    0x8D, 0x94, 0xFF, 0x87, 0x8A, 0x91, 0xFF, 0x6D, 0x6E, 0x73, 0xFF, 0x32, 0x34, 0x38, 0xFF, 0x2B, 0x2C, 0x2F, 0xFF, 0x15, 0x17, 0x19, 0xFF, 0x05,
+    0x09, 0x10, 0xFF, 0x09, 0x0D, 0x16, 0xFF, 0x07, 0x0B, 0x13, 0xFF, 0x02, 0x06, 0x09, 0xFF, 0x0F, 0x0F, 0x11, 0xFF, 0x37, 0x38, 0x3A, 0xFF, 0x35,
+    0x37, 0x37, 0xFF, 0x33, 0x33, 0x34, 0xFF, 0x35, 0x35, 0x35, 0xFF, 0x36, 0x36, 0x36, 0xFF, 0x37, 0x37, 0x37, 0xFF, 0x37, 0x38, 0x38, 0xFF, 0x36,
+    0x36, 0x36, 0xFF, 0x35, 0x35, 0x36, 0xFF, 0x33, 0x33, 0x34, 0xFF, 0x30, 0x30, 0x31, 0xFF, 0x2B, 0x2B, 0x2D, 0xFF, 0x19, 0x1A, 0x1D, 0xFF, 0x02,
+    0x02, 0x06, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x02, 0x02, 0x05, 0xFF, 0x01, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x01,
+    0xFF, 0x01, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x0D, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x02, 0xFF,
+    0x00, 0x00, 0x02, 0xFF, 0x01, 0x00, 0x03, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x01, 0x02, 0x03, 0xFF,
+    0x01, 0x01, 0x03, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x00, 0x02, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x02, 0x04, 0xFF,
+    0x80, 0x01, 0x02, 0x06, 0xFF, 0x80, 0x01, 0x03, 0x07, 0xFF, 0x52, 0x02, 0x03, 0x08, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x01, 0x05, 0x0A, 0xFF, 0x02,
+    0x04, 0x0B, 0xFF, 0x26, 0x2A, 0x33, 0xFF, 0x56, 0x5B, 0x66, 0xFF, 0x5A, 0x60, 0x6C, 0xFF, 0x5A, 0x5F, 0x6C, 0xFF, 0x60, 0x64, 0x72, 0xFF, 0x65,
+    0x68, 0x74, 0xFF, 0x65, 0x69, 0x75, 0xFF, 0x63, 0x68, 0x74, 0xFF, 0x62, 0x67, 0x73, 0xFF, 0x5F, 0x64, 0x6F, 0xFF, 0x5A, 0x60, 0x6C, 0xFF, 0x54,
+    0x59, 0x66, 0xFF, 0x55, 0x5B, 0x67, 0xFF, 0x44, 0x4B, 0x56, 0xFF, 0x0F, 0x12, 0x1D, 0xFF, 0x02, 0x02, 0x07, 0xFF, 0x03, 0x04, 0x0C, 0xFF, 0x06,
+    0x08, 0x12, 0xFF, 0x08, 0x0B, 0x14, 0xFF, 0x07, 0x0B, 0x14, 0xFF, 0x05, 0x08, 0x0F, 0xFF, 0x20, 0x25, 0x32, 0xFF, 0x3D, 0x44, 0x58, 0xFF, 0x34,
+    0x39, 0x4E, 0xFF, 0x38, 0x3D, 0x53, 0xFF, 0x35, 0x3C, 0x51, 0xFF, 0x35, 0x3C, 0x52, 0xFF, 0x37, 0x3D, 0x52, 0xFF, 0x38, 0x3E, 0x54, 0xFF, 0x3B,
+    0x42, 0x58, 0xFF, 0x3E, 0x45, 0x5B, 0xFF, 0x40, 0x47, 0x5D, 0xFF, 0x43, 0x49, 0x60, 0xFF, 0x49, 0x4E, 0x65, 0xFF, 0x4D, 0x53, 0x69, 0xFF, 0x4B,
+    0x51, 0x69, 0xFF, 0x4B, 0x50, 0x68, 0xFF, 0x4B, 0x51, 0x68, 0xFF, 0x4B, 0x53, 0x6A, 0xFF, 0x4C, 0x53, 0x6B, 0xFF, 0x4B, 0x52, 0x6A, 0xFF, 0x4C,
+    0x52, 0x6B, 0xFF, 0x4F, 0x57, 0x6F, 0xFF, 0x52, 0x5B, 0x72, 0xFF, 0x52, 0x5B, 0x71, 0xFF, 0x71, 0x7A, 0x8B, 0xFF, 0xD5, 0xD8, 0xDD, 0xFF, 0xC2,
+    0xC4, 0xCB, 0xFF, 0xB7, 0xBB, 0xC2, 0xFF, 0x5D, 0x5F, 0x6C, 0xFF, 0x0C, 0x10, 0x1F, 0xFF, 0x0C, 0x11, 0x24, 0xFF, 0x0A, 0x0E, 0x1F, 0xFF, 0x08,
+    0x0C, 0x1C, 0xFF, 0x07, 0x0B, 0x1A, 0xFF, 0x08, 0x0A, 0x18, 0xFF, 0x08, 0x08, 0x17, 0xFF, 0x08, 0x07, 0x14, 0xFF, 0x06, 0x07, 0x14, 0xFF, 0x06,
+    0x08, 0x14, 0xFF, 0x05, 0x09, 0x14, 0xFF, 0x07, 0x09, 0x15, 0xFF, 0x07, 0x0A, 0x18, 0xFF, 0x08, 0x0B, 0x1B, 0xFF, 0x0B, 0x0F, 0x1E, 0xFF, 0x08,
+    0x09, 0x13, 0xFF, 0x72, 0x75, 0x82, 0xFF, 0x8C, 0x91, 0xA1, 0xFF, 0x83, 0x89, 0x9F, 0xFF, 0x81, 0x87, 0x9D, 0xFF, 0x7F, 0x85, 0x9B, 0xFF, 0x7E,
+    0x84, 0x9A, 0xFF, 0x7D, 0x83, 0x99, 0xFF, 0x7E, 0x84, 0x9A, 0xFF, 0x7E, 0x85, 0x9B, 0xFF, 0x7F, 0x87, 0x9C, 0xFF, 0x82, 0x89, 0x9E, 0xFF, 0x83,
+    0x8A, 0x9F, 0xFF, 0x83, 0x8A, 0x9E, 0xFF, 0x80, 0x85, 0x8C, 0x9F, 0xFF, 0x12, 0x85, 0x8B, 0x9E, 0xFF, 0x85, 0x8B, 0x9F, 0xFF, 0x85, 0x8C, 0xA1,
+    0xFF, 0x85, 0x8C, 0xA0, 0xFF, 0x86, 0x8C, 0xA1, 0xFF, 0x88, 0x8F, 0xA2, 0xFF, 0x8C, 0x93, 0xA5, 0xFF, 0x8D, 0x93, 0xA5, 0xFF, 0x8F, 0x96, 0xA8,
+    0xFF, 0xB5, 0xBB, 0xC6, 0xFF, 0x91, 0x94, 0xA5, 0xFF, 0x4F, 0x52, 0x61, 0xFF, 0x05, 0x07, 0x12, 0xFF, 0x0D, 0x0F, 0x20, 0xFF, 0x0A, 0x0C, 0x1C,
+    0xFF, 0x09, 0x0B, 0x1A, 0xFF, 0x08, 0x0B, 0x18, 0xFF, 0x08, 0x0A, 0x15, 0xFF, 0x07, 0x09, 0x14, 0xFF, 0x81, 0x07, 0x09, 0x15, 0xFF, 0x22, 0x08,
+    0x0A, 0x17, 0xFF, 0x09, 0x0B, 0x19, 0xFF, 0x09, 0x0B, 0x1A, 0xFF, 0x09, 0x0C, 0x1B, 0xFF, 0x07, 0x0A, 0x16, 0xFF, 0x19, 0x1A, 0x20, 0xFF, 0x46,
+    0x47, 0x49, 0xFF, 0x6B, 0x6C, 0x6F, 0xFF, 0xAF, 0xAF, 0xB4, 0xFF, 0xBB, 0xBC, 0xC0, 0xFF, 0xB0, 0xB3, 0xBA, 0xFF, 0xA9, 0xAE, 0xB8, 0xFF, 0xA0,
+    0xA4, 0xAF, 0xFF, 0x9A, 0x9E, 0xAA, 0xFF, 0x95, 0x9A, 0xA7, 0xFF, 0x92, 0x97, 0xA5, 0xFF, 0x91, 0x97, 0xA4, 0xFF, 0x92, 0x98, 0xA5, 0xFF, 0x95,
+    0x9A, 0xA7, 0xFF, 0x9B, 0x9F, 0xAB, 0xFF, 0xA4, 0xA7, 0xB2, 0xFF, 0xB0, 0xB2, 0xBB, 0xFF, 0xB7, 0xBA, 0xC0, 0xFF, 0xBB, 0xBB, 0xC0, 0xFF, 0xAF,
+    0xB0, 0xB3, 0xFF, 0x75, 0x76, 0x78, 0xFF, 0x50, 0x52, 0x55, 0xFF, 0x20, 0x1F, 0x23, 0xFF, 0x03, 0x04, 0x0C, 0xFF, 0x07, 0x09, 0x15, 0xFF, 0x08,
+    0x0B, 0x18, 0xFF, 0x07, 0x0A, 0x17, 0xFF, 0x07, 0x09, 0x15, 0xFF, 0x06, 0x08, 0x12, 0xFF, 0x05, 0x08, 0x11, 0xFF, 0x80, 0x05, 0x07, 0x11, 0xFF,
+    0x80, 0x04, 0x06, 0x10, 0xFF, 0x00, 0x04, 0x06, 0x0F, 0xFF, 0x80, 0x04, 0x07, 0x0F, 0xFF, 0x00, 0x04, 0x06, 0x0F, 0xFF, 0x80, 0x04, 0x07, 0x10,
+    0xFF, 0x80, 0x05, 0x07, 0x10, 0xFF, 0x37, 0x05, 0x08, 0x11, 0xFF, 0x05, 0x09, 0x13, 0xFF, 0x06, 0x09, 0x14, 0xFF, 0x07, 0x0A, 0x15, 0xFF, 0x08,
+    0x0B, 0x18, 0xFF, 0x07, 0x0B, 0x19, 0xFF, 0x08, 0x0B, 0x15, 0xFF, 0x26, 0x28, 0x2F, 0xFF, 0x63, 0x66, 0x69, 0xFF, 0x9A, 0x9C, 0xA0, 0xFF, 0xB7,
+    0xB9, 0xC0, 0xFF, 0xB4, 0xB8, 0xBF, 0xFF, 0x9E, 0xA4, 0xB1, 0xFF, 0x97, 0x9C, 0xAA, 0xFF, 0x94, 0x98, 0xA7, 0xFF, 0x90, 0x95, 0xA5, 0xFF, 0x8F,
+    0x94, 0xA4, 0xFF, 0x90, 0x95, 0xA6, 0xFF, 0x92, 0x97, 0xA7, 0xFF, 0x97, 0x9C, 0xAA, 0xFF, 0x9E, 0xA1, 0xB0, 0xFF, 0xA7, 0xAA, 0xB6, 0xFF, 0xB6,
+    0xB9, 0xC0, 0xFF, 0xBD, 0xC0, 0xC5, 0xFF, 0x9C, 0x9E, 0xA6, 0xFF, 0x74, 0x75, 0x7C, 0xFF, 0x43, 0x45, 0x4A, 0xFF, 0x06, 0x07, 0x10, 0xFF, 0x2C,
+    0x33, 0x44, 0xFF, 0x82, 0x88, 0x99, 0xFF, 0x91, 0x97, 0xA8, 0xFF, 0xC4, 0xC7, 0xCE, 0xFF, 0x8A, 0x91, 0xA4, 0xFF, 0x89, 0x91, 0xA5, 0xFF, 0x8D,
+    0x94, 0xA8, 0xFF, 0x8C, 0x94, 0xA7, 0xFF, 0x8A, 0x91, 0xA6, 0xFF, 0x88, 0x91, 0xA5, 0xFF, 0x88, 0x90, 0xA3, 0xFF, 0x87, 0x8E, 0xA2, 0xFF, 0x86,
+    0x8E, 0xA4, 0xFF, 0x87, 0x8F, 0xA4, 0xFF, 0x86, 0x8E, 0xA2, 0xFF, 0x74, 0x7A, 0x90, 0xFF, 0x22, 0x27, 0x36, 0xFF, 0x0E, 0x13, 0x27, 0xFF, 0x12,
+    0x17, 0x2C, 0xFF, 0x12, 0x16, 0x2C, 0xFF, 0x10, 0x12, 0x27, 0xFF, 0x0E, 0x11, 0x20, 0xFF, 0x42, 0x45, 0x52, 0xFF, 0x58, 0x5C, 0x67, 0xFF, 0x5F,
+    0x63, 0x6F, 0xFF, 0x62, 0x68, 0x73, 0xFF, 0x62, 0x68, 0x74, 0xFF, 0x62, 0x67, 0x74, 0xFF, 0x80, 0x63, 0x68, 0x74, 0xFF, 0x08, 0x65, 0x69, 0x76,
+    0xFF, 0x63, 0x68, 0x74, 0xFF, 0x60, 0x65, 0x70, 0xFF, 0x62, 0x67, 0x73, 0xFF, 0x60, 0x66, 0x74, 0xFF, 0x33, 0x38, 0x48, 0xFF, 0x04, 0x05, 0x0E,
+    0xFF, 0x07, 0x0A, 0x17, 0xFF, 0x08, 0x0A, 0x19, 0xFF, 0x80, 0x07, 0x0A, 0x19, 0xFF, 0x06, 0x08, 0x0C, 0x1A, 0xFF, 0x09, 0x0D, 0x1B, 0xFF, 0x09,
+    0x0C, 0x1D, 0xFF, 0x09, 0x0E, 0x1D, 0xFF, 0x0A, 0x0F, 0x1F, 0xFF, 0x0A, 0x10, 0x21, 0xFF, 0x0B, 0x12, 0x23, 0xFF, 0x80, 0x0D, 0x11, 0x23, 0xFF,
+    0x29, 0x07, 0x0C, 0x1C, 0xFF, 0x03, 0x06, 0x11, 0xFF, 0x2F, 0x2F, 0x36, 0xFF, 0x65, 0x67, 0x6C, 0xFF, 0x88, 0x89, 0x92, 0xFF, 0xA1, 0xA2, 0xAE,
+    0xFF, 0x98, 0x9D, 0xA7, 0xFF, 0x87, 0x8F, 0x9D, 0xFF, 0x57, 0x61, 0x74, 0xFF, 0x3A, 0x42, 0x53, 0xFF, 0x26, 0x2D, 0x3B, 0xFF, 0x1D, 0x23, 0x2E,
+    0xFF, 0x1D, 0x21, 0x2C, 0xFF, 0x1C, 0x23, 0x2D, 0xFF, 0x22, 0x27, 0x32, 0xFF, 0x2E, 0x33, 0x40, 0xFF, 0x4F, 0x56, 0x64, 0xFF, 0x6D, 0x73, 0x80,
+    0xFF, 0x80, 0x86, 0x91, 0xFF, 0x7A, 0x7E, 0x86, 0xFF, 0x5E, 0x60, 0x64, 0xFF, 0x3A, 0x3D, 0x42, 0xFF, 0x18, 0x19, 0x1C, 0xFF, 0x1D, 0x1E, 0x23,
+    0xFF, 0x33, 0x35, 0x3B, 0xFF, 0x5E, 0x62, 0x6A, 0xFF, 0xA9, 0xB1, 0xBB, 0xFF, 0x8E, 0x96, 0x9F, 0xFF, 0x7E, 0x83, 0x8D, 0xFF, 0x81, 0x85, 0x8B,
+    0xFF, 0x7F, 0x83, 0x88, 0xFF, 0x7F, 0x82, 0x87, 0xFF, 0x7D, 0x81, 0x85, 0xFF, 0x7A, 0x7E, 0x82, 0xFF, 0x79, 0x7C, 0x81, 0xFF, 0x76, 0x7A, 0x7E,
+    0xFF, 0x72, 0x75, 0x7B, 0xFF, 0x68, 0x6A, 0x71, 0xFF, 0x45, 0x48, 0x4F, 0xFF, 0x05, 0x07, 0x0A, 0xFF, 0x02, 0x03, 0x05, 0xFF, 0x02, 0x02, 0x05,
+    0xFF, 0x02, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x02, 0x00, 0x00, 0x01, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0x02, 0xFF, 0x08, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
+    0x02, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x02, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x02, 0x03, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x02,
+    0x04, 0xFF, 0x81, 0x01, 0x02, 0x04, 0xFF, 0x40, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x02, 0x02, 0x07, 0xFF, 0x01, 0x03, 0x06, 0xFF,
+    0x02, 0x03, 0x07, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x01, 0x05, 0x0A, 0xFF, 0x07, 0x0A, 0x12, 0xFF, 0x37, 0x3D, 0x49, 0xFF, 0x67, 0x6F, 0x7B, 0xFF,
+    0x6E, 0x75, 0x80, 0xFF, 0x71, 0x76, 0x82, 0xFF, 0x74, 0x7B, 0x86, 0xFF, 0x77, 0x7D, 0x86, 0xFF, 0x79, 0x7E, 0x87, 0xFF, 0x79, 0x7E, 0x89, 0xFF,
+    0x78, 0x7D, 0x88, 0xFF, 0x76, 0x7B, 0x86, 0xFF, 0x72, 0x79, 0x86, 0xFF, 0x74, 0x7C, 0x8B, 0xFF, 0xA1, 0xA9, 0xB6, 0xFF, 0xA3, 0xAA, 0xB5, 0xFF,
+    0x45, 0x4C, 0x62, 0xFF, 0x3B, 0x3E, 0x51, 0xFF, 0x32, 0x35, 0x45, 0xFF, 0x19, 0x1A, 0x27, 0xFF, 0x07, 0x08, 0x11, 0xFF, 0x07, 0x09, 0x14, 0xFF,
+    0x05, 0x08, 0x11, 0xFF, 0x21, 0x27, 0x35, 0xFF, 0x3D, 0x45, 0x58, 0xFF, 0x31, 0x37, 0x4B, 0xFF, 0x35, 0x3B, 0x51, 0xFF, 0x34, 0x3B, 0x50, 0xFF,
+    0x35, 0x3A, 0x4F, 0xFF, 0x36, 0x3C, 0x50, 0xFF, 0x38, 0x3D, 0x51, 0xFF, 0x3B, 0x40, 0x55, 0xFF, 0x3C, 0x42, 0x58, 0xFF, 0x3A, 0x42, 0x57, 0xFF,
+    0x3D, 0x44, 0x59, 0xFF, 0x40, 0x46, 0x5D, 0xFF, 0x43, 0x49, 0x61, 0xFF, 0x45, 0x4C, 0x62, 0xFF, 0x46, 0x4C, 0x64, 0xFF, 0x46, 0x4D, 0x65, 0xFF,
+    0x45, 0x4C, 0x64, 0xFF, 0x48, 0x4F, 0x65, 0xFF, 0x48, 0x4F, 0x66, 0xFF, 0x49, 0x4F, 0x67, 0xFF, 0x4B, 0x51, 0x6A, 0xFF, 0x4E, 0x56, 0x6F, 0xFF,
+    0x52, 0x5B, 0x74, 0xFF, 0x51, 0x5B, 0x72, 0xFF, 0xC8, 0xCA, 0xD3, 0xFF, 0xCD, 0xCF, 0xD5, 0xFF, 0xBF, 0xC2, 0xC9, 0xFF, 0x9A, 0x9D, 0xA5, 0xFF,
+    0x11, 0x13, 0x1F, 0xFF, 0x0D, 0x10, 0x23, 0xFF, 0x0C, 0x0F, 0x21, 0xFF, 0x09, 0x0D, 0x1D, 0xFF, 0x07, 0x0C, 0x1A, 0xFF, 0x07, 0x0B, 0x18, 0xFF,
+    0x07, 0x09, 0x17, 0xFF, 0x80, 0x07, 0x08, 0x15, 0xFF, 0x80, 0x06, 0x09, 0x15, 0xFF, 0x0F, 0x07, 0x09, 0x15, 0xFF, 0x07, 0x0A, 0x17, 0xFF, 0x08,
+    0x0B, 0x1A, 0xFF, 0x09, 0x0D, 0x19, 0xFF, 0x21, 0x22, 0x2C, 0xFF, 0x7A, 0x7D, 0x8B, 0xFF, 0x85, 0x8A, 0x9E, 0xFF, 0x7F, 0x85, 0x9B, 0xFF, 0x7E,
+    0x84, 0x9A, 0xFF, 0x79, 0x7F, 0x97, 0xFF, 0x78, 0x7D, 0x95, 0xFF, 0x79, 0x7F, 0x95, 0xFF, 0x7A, 0x81, 0x97, 0xFF, 0x78, 0x7F, 0x97, 0xFF, 0x7A,
+    0x82, 0x99, 0xFF, 0x7E, 0x86, 0x9B, 0xFF, 0x80, 0x7F, 0x86, 0x9C, 0xFF, 0x14, 0x80, 0x86, 0x9C, 0xFF, 0x7D, 0x84, 0x9A, 0xFF, 0x7C, 0x84, 0x9A,
+    0xFF, 0x7F, 0x87, 0x9B, 0xFF, 0x81, 0x87, 0x9C, 0xFF, 0x82, 0x89, 0x9D, 0xFF, 0x83, 0x8B, 0x9F, 0xFF, 0x86, 0x8C, 0xA1, 0xFF, 0x88, 0x8F, 0xA2,
+    0xFF, 0x86, 0x8D, 0xA0, 0xFF, 0x89, 0x8F, 0xA1, 0xFF, 0xB1, 0xB6, 0xC2, 0xFF, 0x90, 0x94, 0xA5, 0xFF, 0x51, 0x53, 0x61, 0xFF, 0x06, 0x07, 0x13,
+    0xFF, 0x0E, 0x0F, 0x21, 0xFF, 0x0A, 0x0D, 0x1C, 0xFF, 0x09, 0x0C, 0x1B, 0xFF, 0x08, 0x0B, 0x19, 0xFF, 0x08, 0x0B, 0x16, 0xFF, 0x08, 0x0A, 0x15,
+    0xFF, 0x80, 0x07, 0x09, 0x16, 0xFF, 0x25, 0x07, 0x09, 0x17, 0xFF, 0x07, 0x0A, 0x17, 0xFF, 0x0A, 0x0C, 0x1B, 0xFF, 0x09, 0x0B, 0x18, 0xFF, 0x0D,
+    0x11, 0x1A, 0xFF, 0x3C, 0x40, 0x47, 0xFF, 0x8B, 0x8D, 0x92, 0xFF, 0xBB, 0xBC, 0xBE, 0xFF, 0xAA, 0xAD, 0xB5, 0xFF, 0x90, 0x96, 0xA3, 0xFF, 0x89,
+    0x8F, 0x9F, 0xFF, 0x86, 0x8D, 0x9E, 0xFF, 0x89, 0x90, 0xA0, 0xFF, 0x8C, 0x92, 0xA2, 0xFF, 0x8E, 0x94, 0xA3, 0xFF, 0x8D, 0x93, 0xA3, 0xFF, 0x8C,
+    0x92, 0xA3, 0xFF, 0x8E, 0x94, 0xA4, 0xFF, 0x8D, 0x93, 0xA3, 0xFF, 0x8E, 0x93, 0xA3, 0xFF, 0x8F, 0x97, 0xA7, 0xFF, 0x90, 0x96, 0xA7, 0xFF, 0x8C,
+    0x92, 0xA3, 0xFF, 0x87, 0x8E, 0xA0, 0xFF, 0x8A, 0x90, 0xA1, 0xFF, 0x8F, 0x95, 0xA2, 0xFF, 0xA1, 0xA6, 0xB0, 0xFF, 0xB0, 0xB4, 0xBC, 0xFF, 0x7F,
+    0x7F, 0x83, 0xFF, 0x56, 0x57, 0x5C, 0xFF, 0x15, 0x15, 0x1E, 0xFF, 0x08, 0x0B, 0x17, 0xFF, 0x0A, 0x0D, 0x1B, 0xFF, 0x08, 0x0B, 0x17, 0xFF, 0x07,
+    0x09, 0x14, 0xFF, 0x06, 0x09, 0x13, 0xFF, 0x06, 0x08, 0x13, 0xFF, 0x06, 0x08, 0x12, 0xFF, 0x80, 0x05, 0x08, 0x11, 0xFF, 0x00, 0x04, 0x07, 0x11,
+    0xFF, 0x80, 0x05, 0x07, 0x10, 0xFF, 0x80, 0x05, 0x07, 0x11, 0xFF, 0x24, 0x05, 0x08, 0x12, 0xFF, 0x06, 0x08, 0x12, 0xFF, 0x06, 0x09, 0x12, 0xFF,
+    0x06, 0x09, 0x13, 0xFF, 0x06, 0x0A, 0x15, 0xFF, 0x07, 0x0A, 0x16, 0xFF, 0x08, 0x0B, 0x17, 0xFF, 0x04, 0x07, 0x11, 0xFF, 0x13, 0x18, 0x20, 0xFF,
+    0x54, 0x59, 0x64, 0xFF, 0xA7, 0xAB, 0xAE, 0xFF, 0xC0, 0xC2, 0xC5, 0xFF, 0xA0, 0xA5, 0xB0, 0xFF, 0x89, 0x91, 0xA2, 0xFF, 0x8A, 0x90, 0xA1, 0xFF,
+    0x88, 0x8E, 0xA0, 0xFF, 0x85, 0x8B, 0x9E, 0xFF, 0x86, 0x8C, 0x9F, 0xFF, 0x86, 0x8C, 0xA0, 0xFF, 0x87, 0x8D, 0xA0, 0xFF, 0x89, 0x8F, 0xA1, 0xFF,
+    0x8C, 0x91, 0xA4, 0xFF, 0x8E, 0x94, 0xA4, 0xFF, 0x93, 0x97, 0xA8, 0xFF, 0x94, 0x99, 0xAA, 0xFF, 0x94, 0x9A, 0xAA, 0xFF, 0x92, 0x98, 0xA8, 0xFF,
+    0xA0, 0xA4, 0xB0, 0xFF, 0xBA, 0xBE, 0xC4, 0xFF, 0x97, 0x9A, 0xA4, 0xFF, 0x68, 0x6B, 0x75, 0xFF, 0x3A, 0x40, 0x4F, 0xFF, 0x84, 0x8B, 0x9C, 0xFF,
+    0x95, 0x9A, 0xA9, 0xFF, 0xC4, 0xC7, 0xCE, 0xFF, 0x88, 0x8F, 0xA2, 0xFF, 0x84, 0x8C, 0xA1, 0xFF, 0x80, 0x86, 0x8E, 0xA3, 0xFF, 0x1D, 0x84, 0x8C,
+    0xA2, 0xFF, 0x84, 0x8B, 0xA0, 0xFF, 0x82, 0x89, 0x9E, 0xFF, 0x82, 0x8A, 0x9E, 0xFF, 0x84, 0x8C, 0xA1, 0xFF, 0x85, 0x8D, 0xA2, 0xFF, 0x82, 0x8A,
+    0x9F, 0xFF, 0x72, 0x7A, 0x8F, 0xFF, 0x24, 0x29, 0x37, 0xFF, 0x10, 0x15, 0x2C, 0xFF, 0x11, 0x16, 0x2B, 0xFF, 0x16, 0x19, 0x2B, 0xFF, 0x31, 0x34,
+    0x46, 0xFF, 0x42, 0x46, 0x56, 0xFF, 0xA2, 0xA6, 0xB4, 0xFF, 0xBC, 0xC1, 0xCB, 0xFF, 0xAB, 0xB0, 0xBB, 0xFF, 0xAB, 0xB1, 0xBC, 0xFF, 0xAA, 0xB0,
+    0xBB, 0xFF, 0xA9, 0xAF, 0xB9, 0xFF, 0xA8, 0xAE, 0xB7, 0xFF, 0xA6, 0xAB, 0xB6, 0xFF, 0xA5, 0xAA, 0xB4, 0xFF, 0xA2, 0xA8, 0xB2, 0xFF, 0x9F, 0xA5,
+    0xAF, 0xFF, 0x9F, 0xA5, 0xB0, 0xFF, 0x9E, 0xA4, 0xB0, 0xFF, 0x66, 0x6D, 0x7F, 0xFF, 0x05, 0x08, 0x14, 0xFF, 0x06, 0x09, 0x15, 0xFF, 0x80, 0x07,
+    0x0B, 0x19, 0xFF, 0x33, 0x08, 0x0B, 0x19, 0xFF, 0x08, 0x0B, 0x1A, 0xFF, 0x08, 0x0C, 0x1C, 0xFF, 0x09, 0x0D, 0x1E, 0xFF, 0x0A, 0x0F, 0x1F, 0xFF,
+    0x0C, 0x11, 0x23, 0xFF, 0x0E, 0x13, 0x25, 0xFF, 0x10, 0x15, 0x29, 0xFF, 0x0B, 0x0E, 0x1F, 0xFF, 0x06, 0x08, 0x16, 0xFF, 0x48, 0x4B, 0x54, 0xFF,
+    0x7E, 0x82, 0x8C, 0xFF, 0xA5, 0xA9, 0xB2, 0xFF, 0xA9, 0xAF, 0xB8, 0xFF, 0x88, 0x8F, 0x9C, 0xFF, 0x47, 0x4F, 0x63, 0xFF, 0x2A, 0x31, 0x44, 0xFF,
+    0x2A, 0x33, 0x44, 0xFF, 0x32, 0x3A, 0x4D, 0xFF, 0x30, 0x39, 0x4A, 0xFF, 0x2D, 0x37, 0x48, 0xFF, 0x2C, 0x34, 0x45, 0xFF, 0x2D, 0x34, 0x43, 0xFF,
+    0x2A, 0x31, 0x40, 0xFF, 0x27, 0x2E, 0x3C, 0xFF, 0x27, 0x2D, 0x3B, 0xFF, 0x25, 0x2B, 0x3C, 0xFF, 0x1C, 0x22, 0x2F, 0xFF, 0x17, 0x1C, 0x26, 0xFF,
+    0x25, 0x29, 0x32, 0xFF, 0x69, 0x6E, 0x77, 0xFF, 0x6F, 0x74, 0x7F, 0xFF, 0x6B, 0x6F, 0x79, 0xFF, 0x86, 0x8C, 0x94, 0xFF, 0xA3, 0xA9, 0xB2, 0xFF,
+    0x97, 0x9D, 0xAB, 0xFF, 0xAD, 0xB6, 0xC6, 0xFF, 0x57, 0x60, 0x71, 0xFF, 0x20, 0x26, 0x32, 0xFF, 0x1F, 0x26, 0x31, 0xFF, 0x1D, 0x23, 0x2F, 0xFF,
+    0x1A, 0x20, 0x2B, 0xFF, 0x17, 0x1D, 0x28, 0xFF, 0x17, 0x1C, 0x25, 0xFF, 0x16, 0x1B, 0x24, 0xFF, 0x15, 0x1B, 0x24, 0xFF, 0x15, 0x1A, 0x23, 0xFF,
+    0x16, 0x1A, 0x22, 0xFF, 0x1C, 0x1F, 0x26, 0xFF, 0x02, 0x03, 0x04, 0xFF, 0x02, 0x02, 0x05, 0xFF, 0x02, 0x03, 0x06, 0xFF, 0x03, 0x00, 0x00, 0x01,
+    0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFF, 0x01,
+    0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x08, 0x00, 0x00, 0x03, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x02,
+    0xFF, 0x00, 0x02, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x01, 0x02, 0x03,
+    0xFF, 0x80, 0x01, 0x02, 0x04, 0xFF, 0x0F, 0x01, 0x02, 0x05, 0xFF, 0x00, 0x02, 0x05, 0xFF, 0x02, 0x03, 0x06, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x01,
+    0x03, 0x08, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x01, 0x03, 0x08, 0xFF, 0x09, 0x0D, 0x15, 0xFF, 0x1A, 0x1F, 0x2B, 0xFF, 0x0F, 0x11, 0x1A, 0xFF, 0x10,
+    0x12, 0x1A, 0xFF, 0x10, 0x13, 0x1B, 0xFF, 0x12, 0x14, 0x1E, 0xFF, 0x13, 0x16, 0x1F, 0xFF, 0x13, 0x16, 0x20, 0xFF, 0x13, 0x17, 0x20, 0xFF, 0x80,
+    0x13, 0x16, 0x1F, 0xFF, 0x59, 0x10, 0x13, 0x1E, 0xFF, 0x0D, 0x13, 0x1C, 0xFF, 0x8B, 0x92, 0xA0, 0xFF, 0xA7, 0xAD, 0xB7, 0xFF, 0x4B, 0x51, 0x67,
+    0xFF, 0x69, 0x6C, 0x86, 0xFF, 0x74, 0x75, 0x8F, 0xFF, 0x5B, 0x5A, 0x70, 0xFF, 0x14, 0x15, 0x1F, 0xFF, 0x07, 0x09, 0x16, 0xFF, 0x07, 0x09, 0x14,
+    0xFF, 0x23, 0x27, 0x35, 0xFF, 0x3C, 0x42, 0x58, 0xFF, 0x2C, 0x30, 0x43, 0xFF, 0x2E, 0x34, 0x48, 0xFF, 0x31, 0x38, 0x4C, 0xFF, 0x32, 0x38, 0x4B,
+    0xFF, 0x33, 0x38, 0x4B, 0xFF, 0x32, 0x38, 0x4B, 0xFF, 0x36, 0x3B, 0x4F, 0xFF, 0x38, 0x3D, 0x53, 0xFF, 0x37, 0x3D, 0x53, 0xFF, 0x39, 0x3F, 0x55,
+    0xFF, 0x3A, 0x40, 0x56, 0xFF, 0x41, 0x48, 0x5F, 0xFF, 0x4E, 0x56, 0x6D, 0xFF, 0x41, 0x48, 0x5F, 0xFF, 0x42, 0x49, 0x60, 0xFF, 0x43, 0x49, 0x5F,
+    0xFF, 0x46, 0x4C, 0x63, 0xFF, 0x49, 0x4E, 0x66, 0xFF, 0x49, 0x50, 0x67, 0xFF, 0x49, 0x50, 0x69, 0xFF, 0x4C, 0x55, 0x6D, 0xFF, 0x4F, 0x58, 0x6F,
+    0xFF, 0x4F, 0x57, 0x6F, 0xFF, 0x88, 0x8E, 0x9C, 0xFF, 0xD8, 0xDA, 0xDE, 0xFF, 0xBE, 0xC1, 0xC8, 0xFF, 0xAD, 0xB0, 0xB8, 0xFF, 0x37, 0x39, 0x47,
+    0xFF, 0x0D, 0x10, 0x20, 0xFF, 0x0D, 0x10, 0x23, 0xFF, 0x0A, 0x0D, 0x1E, 0xFF, 0x08, 0x0B, 0x1B, 0xFF, 0x08, 0x0A, 0x18, 0xFF, 0x08, 0x09, 0x17,
+    0xFF, 0x06, 0x08, 0x15, 0xFF, 0x07, 0x08, 0x14, 0xFF, 0x08, 0x08, 0x15, 0xFF, 0x07, 0x09, 0x15, 0xFF, 0x07, 0x09, 0x16, 0xFF, 0x07, 0x09, 0x17,
+    0xFF, 0x08, 0x0B, 0x19, 0xFF, 0x04, 0x06, 0x0D, 0xFF, 0x59, 0x5B, 0x6C, 0xFF, 0x85, 0x89, 0x9A, 0xFF, 0x7A, 0x80, 0x94, 0xFF, 0x7C, 0x82, 0x98,
+    0xFF, 0x7B, 0x80, 0x98, 0xFF, 0x77, 0x7D, 0x93, 0xFF, 0x74, 0x7A, 0x91, 0xFF, 0x75, 0x7B, 0x91, 0xFF, 0x76, 0x7D, 0x93, 0xFF, 0x74, 0x7B, 0x92,
+    0xFF, 0x75, 0x7D, 0x95, 0xFF, 0x79, 0x80, 0x99, 0xFF, 0x73, 0x7B, 0x92, 0xFF, 0x77, 0x7E, 0x97, 0xFF, 0x7A, 0x82, 0x99, 0xFF, 0x77, 0x80, 0x95,
+    0xFF, 0x78, 0x80, 0x96, 0xFF, 0x7B, 0x82, 0x98, 0xFF, 0x7D, 0x83, 0x99, 0xFF, 0x7D, 0x85, 0x9B, 0xFF, 0x80, 0x87, 0x9B, 0xFF, 0x82, 0x88, 0x9C,
+    0xFF, 0x82, 0x89, 0x9D, 0xFF, 0x80, 0x86, 0x9B, 0xFF, 0x83, 0x88, 0x9C, 0xFF, 0xAD, 0xB3, 0xBF, 0xFF, 0x8E, 0x93, 0xA4, 0xFF, 0x51, 0x53, 0x62,
+    0xFF, 0x06, 0x08, 0x13, 0xFF, 0x0E, 0x10, 0x22, 0xFF, 0x0B, 0x0D, 0x1E, 0xFF, 0x0A, 0x0C, 0x1C, 0xFF, 0x09, 0x0C, 0x1A, 0xFF, 0x09, 0x0A, 0x18,
+    0xFF, 0x08, 0x0A, 0x18, 0xFF, 0x80, 0x08, 0x0A, 0x17, 0xFF, 0x0C, 0x08, 0x0A, 0x18, 0xFF, 0x07, 0x0B, 0x18, 0xFF, 0x03, 0x07, 0x11, 0xFF, 0x21,
+    0x23, 0x29, 0xFF, 0x7C, 0x80, 0x86, 0xFF, 0xBB, 0xBE, 0xC1, 0xFF, 0x9C, 0xA1, 0xAB, 0xFF, 0x8A, 0x91, 0xA0, 0xFF, 0x87, 0x8E, 0xA0, 0xFF, 0x81,
+    0x88, 0x9B, 0xFF, 0x7E, 0x86, 0x99, 0xFF, 0x7E, 0x85, 0x98, 0xFF, 0x81, 0x88, 0x9B, 0xFF, 0x80, 0x84, 0x8B, 0x9D, 0xFF, 0x16, 0x85, 0x8C, 0x9D,
+    0xFF, 0x88, 0x8F, 0x9F, 0xFF, 0x8C, 0x93, 0xA3, 0xFF, 0x8D, 0x92, 0xA3, 0xFF, 0x8B, 0x91, 0xA2, 0xFF, 0x8A, 0x90, 0xA2, 0xFF, 0x86, 0x8D, 0x9F,
+    0xFF, 0x82, 0x88, 0x9B, 0xFF, 0x82, 0x89, 0x9B, 0xFF, 0x81, 0x89, 0x9C, 0xFF, 0x7F, 0x85, 0x98, 0xFF, 0x7F, 0x86, 0x9B, 0xFF, 0x84, 0x8B, 0x9B,
+    0xFF, 0xA3, 0xA6, 0xAF, 0xFF, 0xBD, 0xBE, 0xC2, 0xFF, 0x7C, 0x7C, 0x81, 0xFF, 0x2A, 0x2A, 0x31, 0xFF, 0x09, 0x0B, 0x16, 0xFF, 0x0B, 0x0D, 0x1B,
+    0xFF, 0x09, 0x0B, 0x18, 0xFF, 0x07, 0x0A, 0x15, 0xFF, 0x06, 0x09, 0x14, 0xFF, 0x06, 0x09, 0x13, 0xFF, 0x80, 0x05, 0x08, 0x13, 0xFF, 0x01, 0x05,
+    0x08, 0x12, 0xFF, 0x05, 0x07, 0x11, 0xFF, 0x80, 0x05, 0x07, 0x12, 0xFF, 0x80, 0x06, 0x08, 0x13, 0xFF, 0x02, 0x06, 0x09, 0x13, 0xFF, 0x06, 0x09,
+    0x14, 0xFF, 0x08, 0x0A, 0x17, 0xFF, 0x80, 0x08, 0x0B, 0x18, 0xFF, 0x07, 0x03, 0x06, 0x0E, 0xFF, 0x25, 0x28, 0x31, 0xFF, 0x8B, 0x91, 0x98, 0xFF,
+    0xAF, 0xB4, 0xBB, 0xFF, 0x8D, 0x93, 0xA0, 0xFF, 0x85, 0x8C, 0x9D, 0xFF, 0x84, 0x8A, 0x9F, 0xFF, 0x84, 0x8B, 0x9F, 0xFF, 0x81, 0x85, 0x8C, 0x9F,
+    0xFF, 0x33, 0x84, 0x8B, 0x9E, 0xFF, 0x81, 0x88, 0x9C, 0xFF, 0x82, 0x88, 0x9D, 0xFF, 0x85, 0x8B, 0x9E, 0xFF, 0x87, 0x8D, 0xA0, 0xFF, 0x8A, 0x90,
+    0xA2, 0xFF, 0x8D, 0x93, 0xA4, 0xFF, 0x8D, 0x94, 0xA6, 0xFF, 0x8B, 0x92, 0xA4, 0xFF, 0x87, 0x8E, 0xA0, 0xFF, 0x83, 0x8A, 0x9E, 0xFF, 0x81, 0x88,
+    0x9C, 0xFF, 0x93, 0x98, 0xA7, 0xFF, 0xBB, 0xBF, 0xC7, 0xFF, 0xAA, 0xAE, 0xB8, 0xFF, 0x94, 0x9A, 0xA9, 0xFF, 0x96, 0x9B, 0xAA, 0xFF, 0xC2, 0xC4,
+    0xCC, 0xFF, 0x84, 0x8B, 0x9E, 0xFF, 0x7F, 0x87, 0x9D, 0xFF, 0x82, 0x8A, 0x9F, 0xFF, 0x81, 0x89, 0xA0, 0xFF, 0x7F, 0x87, 0x9D, 0xFF, 0x7D, 0x85,
+    0x9B, 0xFF, 0x7A, 0x82, 0x98, 0xFF, 0x7A, 0x82, 0x99, 0xFF, 0x7D, 0x85, 0x9A, 0xFF, 0x81, 0x89, 0x9D, 0xFF, 0x80, 0x87, 0x9C, 0xFF, 0x70, 0x77,
+    0x8E, 0xFF, 0x24, 0x29, 0x37, 0xFF, 0x11, 0x15, 0x2C, 0xFF, 0x0F, 0x14, 0x29, 0xFF, 0x30, 0x33, 0x40, 0xFF, 0x78, 0x7B, 0x8C, 0xFF, 0x73, 0x76,
+    0x88, 0xFF, 0xA2, 0xA6, 0xB3, 0xFF, 0xAD, 0xB4, 0xC0, 0xFF, 0x6C, 0x75, 0x8A, 0xFF, 0x68, 0x71, 0x88, 0xFF, 0x69, 0x71, 0x87, 0xFF, 0x68, 0x70,
+    0x85, 0xFF, 0x66, 0x6D, 0x84, 0xFF, 0x64, 0x6B, 0x82, 0xFF, 0x63, 0x6A, 0x80, 0xFF, 0x60, 0x67, 0x7D, 0xFF, 0x5E, 0x65, 0x7C, 0xFF, 0x5B, 0x62,
+    0x78, 0xFF, 0x5C, 0x63, 0x7A, 0xFF, 0x43, 0x4B, 0x60, 0xFF, 0x0A, 0x0E, 0x1A, 0xFF, 0x06, 0x09, 0x15, 0xFF, 0x81, 0x08, 0x0C, 0x1A, 0xFF, 0x19,
+    0x08, 0x0D, 0x1B, 0xFF, 0x08, 0x0D, 0x1D, 0xFF, 0x09, 0x0F, 0x1F, 0xFF, 0x0C, 0x10, 0x23, 0xFF, 0x0E, 0x14, 0x28, 0xFF, 0x0D, 0x13, 0x27, 0xFF,
+    0x10, 0x14, 0x21, 0xFF, 0x47, 0x4C, 0x59, 0xFF, 0x95, 0x9A, 0xA2, 0xFF, 0xBD, 0xC1, 0xC7, 0xFF, 0xBC, 0xC1, 0xC9, 0xFF, 0x7D, 0x84, 0x95, 0xFF,
+    0x49, 0x53, 0x67, 0xFF, 0x37, 0x41, 0x57, 0xFF, 0x37, 0x3F, 0x53, 0xFF, 0x2E, 0x37, 0x48, 0xFF, 0x30, 0x38, 0x49, 0xFF, 0x33, 0x3A, 0x4B, 0xFF,
+    0x31, 0x39, 0x4A, 0xFF, 0x2F, 0x37, 0x48, 0xFF, 0x30, 0x36, 0x47, 0xFF, 0x2E, 0x34, 0x43, 0xFF, 0x2B, 0x31, 0x40, 0xFF, 0x27, 0x2E, 0x3C, 0xFF,
+    0x25, 0x2B, 0x38, 0xFF, 0x24, 0x2A, 0x38, 0xFF, 0x80, 0x22, 0x29, 0x37, 0xFF, 0x14, 0x21, 0x28, 0x37, 0xFF, 0x14, 0x18, 0x21, 0xFF, 0x22, 0x25,
+    0x2F, 0xFF, 0x68, 0x6F, 0x7A, 0xFF, 0x7A, 0x81, 0x91, 0xFF, 0x8D, 0x91, 0xA4, 0xFF, 0xAE, 0xB2, 0xBE, 0xFF, 0xAF, 0xB7, 0xC5, 0xFF, 0x51, 0x58,
+    0x68, 0xFF, 0x0D, 0x12, 0x19, 0xFF, 0x19, 0x1C, 0x28, 0xFF, 0x17, 0x1B, 0x26, 0xFF, 0x14, 0x19, 0x24, 0xFF, 0x13, 0x17, 0x22, 0xFF, 0x12, 0x16,
+    0x1F, 0xFF, 0x11, 0x14, 0x1E, 0xFF, 0x11, 0x15, 0x20, 0xFF, 0x11, 0x15, 0x1F, 0xFF, 0x0F, 0x13, 0x1A, 0xFF, 0x1D, 0x21, 0x26, 0xFF, 0x02, 0x03,
+    0x04, 0xFF, 0x80, 0x02, 0x02, 0x06, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x81, 0x00, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x01, 0x02, 0xFF, 0x15, 0x01, 0x01, 0x04, 0xFF, 0x00,
+    0x02, 0x03, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x02, 0x03, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x00, 0x02, 0x03, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01,
+    0x02, 0x04, 0xFF, 0x02, 0x02, 0x06, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x02, 0x02, 0x07, 0xFF, 0x02, 0x03, 0x06, 0xFF, 0x02, 0x03, 0x07, 0xFF, 0x03,
+    0x04, 0x09, 0xFF, 0x01, 0x03, 0x08, 0xFF, 0x0A, 0x0D, 0x14, 0xFF, 0x21, 0x25, 0x33, 0xFF, 0x1E, 0x21, 0x30, 0xFF, 0x1D, 0x21, 0x30, 0xFF, 0x1D,
+    0x20, 0x2F, 0xFF, 0x1D, 0x21, 0x30, 0xFF, 0x1F, 0x22, 0x31, 0xFF, 0x80, 0x1F, 0x23, 0x32, 0xFF, 0x23, 0x1F, 0x23, 0x31, 0xFF, 0x20, 0x24, 0x33,
+    0xFF, 0x1E, 0x22, 0x33, 0xFF, 0x0F, 0x14, 0x20, 0xFF, 0x8A, 0x91, 0x9E, 0xFF, 0xA5, 0xAB, 0xB4, 0xFF, 0x42, 0x49, 0x5D, 0xFF, 0x63, 0x66, 0x81,
+    0xFF, 0x70, 0x72, 0x8E, 0xFF, 0x67, 0x66, 0x7E, 0xFF, 0x1D, 0x1D, 0x27, 0xFF, 0x08, 0x0B, 0x17, 0xFF, 0x09, 0x0C, 0x18, 0xFF, 0x23, 0x28, 0x35,
+    0xFF, 0x3A, 0x41, 0x55, 0xFF, 0x27, 0x2B, 0x3E, 0xFF, 0x2A, 0x2E, 0x42, 0xFF, 0x2E, 0x33, 0x46, 0xFF, 0x2F, 0x35, 0x48, 0xFF, 0x30, 0x34, 0x48,
+    0xFF, 0x2E, 0x33, 0x47, 0xFF, 0x31, 0x35, 0x4A, 0xFF, 0x34, 0x39, 0x4D, 0xFF, 0x37, 0x3C, 0x51, 0xFF, 0x36, 0x3C, 0x53, 0xFF, 0x37, 0x3D, 0x52,
+    0xFF, 0x57, 0x5E, 0x74, 0xFF, 0x76, 0x7F, 0x94, 0xFF, 0x40, 0x48, 0x60, 0xFF, 0x3F, 0x47, 0x5E, 0xFF, 0x42, 0x48, 0x5E, 0xFF, 0x40, 0x47, 0x5F,
+    0xFF, 0x44, 0x4A, 0x62, 0xFF, 0x48, 0x4E, 0x66, 0xFF, 0x4A, 0x50, 0x68, 0xFF, 0x4C, 0x55, 0x6D, 0xFF, 0x80, 0x51, 0x59, 0x72, 0xFF, 0x0A, 0x58,
+    0x60, 0x75, 0xFF, 0xDB, 0xDE, 0xE1, 0xFF, 0xC7, 0xCA, 0xCF, 0xFF, 0xB9, 0xBB, 0xC3, 0xFF, 0x7E, 0x81, 0x8D, 0xFF, 0x0C, 0x0F, 0x1B, 0xFF, 0x0C,
+    0x11, 0x23, 0xFF, 0x0A, 0x0D, 0x1E, 0xFF, 0x08, 0x0A, 0x1B, 0xFF, 0x07, 0x09, 0x18, 0xFF, 0x07, 0x08, 0x16, 0xFF, 0x80, 0x07, 0x07, 0x15, 0xFF,
+    0x50, 0x07, 0x08, 0x14, 0xFF, 0x07, 0x09, 0x15, 0xFF, 0x07, 0x09, 0x16, 0xFF, 0x07, 0x08, 0x16, 0xFF, 0x06, 0x08, 0x16, 0xFF, 0x11, 0x12, 0x19,
+    0xFF, 0x65, 0x69, 0x77, 0xFF, 0x7D, 0x81, 0x96, 0xFF, 0x72, 0x77, 0x8E, 0xFF, 0x75, 0x7B, 0x92, 0xFF, 0x76, 0x7B, 0x92, 0xFF, 0x73, 0x79, 0x90,
+    0xFF, 0x72, 0x78, 0x8E, 0xFF, 0x73, 0x79, 0x90, 0xFF, 0x73, 0x7A, 0x92, 0xFF, 0x74, 0x7C, 0x92, 0xFF, 0x72, 0x79, 0x91, 0xFF, 0x72, 0x79, 0x92,
+    0xFF, 0x7B, 0x83, 0x9A, 0xFF, 0x74, 0x7B, 0x95, 0xFF, 0x73, 0x7B, 0x92, 0xFF, 0x73, 0x7A, 0x91, 0xFF, 0x74, 0x7B, 0x92, 0xFF, 0x77, 0x7E, 0x94,
+    0xFF, 0x79, 0x81, 0x96, 0xFF, 0x79, 0x80, 0x95, 0xFF, 0x7A, 0x81, 0x95, 0xFF, 0x7D, 0x84, 0x98, 0xFF, 0x7F, 0x85, 0x99, 0xFF, 0x7D, 0x83, 0x98,
+    0xFF, 0x7E, 0x84, 0x98, 0xFF, 0xAA, 0xB0, 0xBD, 0xFF, 0x8C, 0x91, 0xA2, 0xFF, 0x4F, 0x51, 0x61, 0xFF, 0x06, 0x08, 0x14, 0xFF, 0x0D, 0x11, 0x23,
+    0xFF, 0x0C, 0x0D, 0x1F, 0xFF, 0x0A, 0x0B, 0x1D, 0xFF, 0x0A, 0x0B, 0x1C, 0xFF, 0x09, 0x0B, 0x1B, 0xFF, 0x08, 0x0A, 0x19, 0xFF, 0x09, 0x0B, 0x19,
+    0xFF, 0x08, 0x09, 0x17, 0xFF, 0x06, 0x07, 0x13, 0xFF, 0x04, 0x05, 0x0D, 0xFF, 0x3A, 0x3D, 0x46, 0xFF, 0x99, 0x9B, 0xA1, 0xFF, 0xAA, 0xAE, 0xB6,
+    0xFF, 0x8D, 0x94, 0xA3, 0xFF, 0x85, 0x8B, 0x9E, 0xFF, 0x82, 0x8A, 0x9D, 0xFF, 0x82, 0x89, 0x9C, 0xFF, 0x80, 0x87, 0x9C, 0xFF, 0x7D, 0x85, 0x9A,
+    0xFF, 0x7B, 0x84, 0x97, 0xFF, 0x7E, 0x86, 0x99, 0xFF, 0x7E, 0x85, 0x9A, 0xFF, 0x7D, 0x85, 0x98, 0xFF, 0x7E, 0x86, 0x99, 0xFF, 0x82, 0x88, 0x9B,
+    0xFF, 0x85, 0x8C, 0x9E, 0xFF, 0x87, 0x8E, 0x9F, 0xFF, 0x84, 0x8B, 0x9E, 0xFF, 0x81, 0x89, 0x9B, 0xFF, 0x7E, 0x86, 0x99, 0xFF, 0x7C, 0x83, 0x96,
+    0xFF, 0x7D, 0x85, 0x97, 0xFF, 0x7F, 0x87, 0x9A, 0xFF, 0x7F, 0x86, 0x99, 0xFF, 0x7D, 0x85, 0x98, 0xFF, 0x81, 0x88, 0x99, 0xFF, 0x82, 0x89, 0x9B,
+    0xFF, 0x8A, 0x90, 0x9E, 0xFF, 0xAC, 0xAF, 0xB6, 0xFF, 0xA9, 0xAB, 0xB0, 0xFF, 0x50, 0x51, 0x57, 0xFF, 0x03, 0x06, 0x0E, 0xFF, 0x09, 0x0C, 0x1A,
+    0xFF, 0x08, 0x0B, 0x17, 0xFF, 0x07, 0x0A, 0x16, 0xFF, 0x06, 0x08, 0x15, 0xFF, 0x80, 0x06, 0x09, 0x15, 0xFF, 0x03, 0x05, 0x09, 0x15, 0xFF, 0x05,
+    0x08, 0x13, 0xFF, 0x06, 0x07, 0x13, 0xFF, 0x05, 0x08, 0x13, 0xFF, 0x80, 0x06, 0x09, 0x14, 0xFF, 0x01, 0x07, 0x0A, 0x15, 0xFF, 0x07, 0x0B, 0x17,
+    0xFF, 0x80, 0x09, 0x0C, 0x19, 0xFF, 0x15, 0x09, 0x0C, 0x14, 0xFF, 0x45, 0x49, 0x51, 0xFF, 0x9B, 0xA0, 0xA6, 0xFF, 0xA8, 0xAD, 0xB6, 0xFF, 0x80,
+    0x86, 0x98, 0xFF, 0x79, 0x7F, 0x93, 0xFF, 0x7E, 0x84, 0x98, 0xFF, 0x7F, 0x86, 0x9A, 0xFF, 0x81, 0x88, 0x9C, 0xFF, 0x83, 0x8B, 0x9E, 0xFF, 0x82,
+    0x89, 0x9D, 0xFF, 0x81, 0x88, 0x9C, 0xFF, 0x81, 0x87, 0x9B, 0xFF, 0x7E, 0x85, 0x9A, 0xFF, 0x7E, 0x85, 0x99, 0xFF, 0x7F, 0x86, 0x9A, 0xFF, 0x81,
+    0x88, 0x9B, 0xFF, 0x84, 0x8B, 0x9D, 0xFF, 0x85, 0x8D, 0x9F, 0xFF, 0x86, 0x8D, 0xA0, 0xFF, 0x84, 0x8B, 0x9E, 0xFF, 0x81, 0x89, 0x9C, 0xFF, 0x80,
+    0x7F, 0x87, 0x9B, 0xFF, 0x3A, 0x81, 0x88, 0x9D, 0xFF, 0x87, 0x8E, 0xA1, 0xFF, 0x9F, 0xA5, 0xB2, 0xFF, 0xB7, 0xBD, 0xC6, 0xFF, 0x9F, 0xA3, 0xB1,
+    0xFF, 0xBF, 0xC2, 0xC9, 0xFF, 0x7F, 0x85, 0x99, 0xFF, 0x7A, 0x82, 0x99, 0xFF, 0x7E, 0x86, 0x9D, 0xFF, 0x7E, 0x85, 0x9D, 0xFF, 0x7B, 0x82, 0x99,
+    0xFF, 0x77, 0x7F, 0x96, 0xFF, 0x75, 0x7E, 0x95, 0xFF, 0x74, 0x7C, 0x93, 0xFF, 0x75, 0x7D, 0x94, 0xFF, 0x7A, 0x81, 0x98, 0xFF, 0x7D, 0x84, 0x9A,
+    0xFF, 0x6D, 0x74, 0x8B, 0xFF, 0x25, 0x29, 0x37, 0xFF, 0x0F, 0x13, 0x2B, 0xFF, 0x0F, 0x14, 0x2A, 0xFF, 0x37, 0x38, 0x44, 0xFF, 0x83, 0x86, 0x96,
+    0xFF, 0x73, 0x76, 0x87, 0xFF, 0x9F, 0xA2, 0xAF, 0xFF, 0xAB, 0xB1, 0xBD, 0xFF, 0x6E, 0x76, 0x8B, 0xFF, 0x69, 0x72, 0x88, 0xFF, 0x6B, 0x73, 0x89,
+    0xFF, 0x6B, 0x73, 0x88, 0xFF, 0x69, 0x71, 0x87, 0xFF, 0x68, 0x71, 0x87, 0xFF, 0x67, 0x6F, 0x85, 0xFF, 0x64, 0x6D, 0x83, 0xFF, 0x63, 0x6C, 0x82,
+    0xFF, 0x61, 0x69, 0x80, 0xFF, 0x62, 0x6A, 0x81, 0xFF, 0x45, 0x4D, 0x63, 0xFF, 0x0B, 0x0F, 0x1C, 0xFF, 0x07, 0x0A, 0x18, 0xFF, 0x08, 0x0C, 0x1C,
+    0xFF, 0x09, 0x0B, 0x1C, 0xFF, 0x08, 0x0C, 0x1B, 0xFF, 0x08, 0x0D, 0x1B, 0xFF, 0x0A, 0x0D, 0x1E, 0xFF, 0x0B, 0x0F, 0x1F, 0xFF, 0x0D, 0x12, 0x24,
+    0xFF, 0x0A, 0x0E, 0x1F, 0xFF, 0x27, 0x29, 0x39, 0xFF, 0x8B, 0x8F, 0x9B, 0xFF, 0xBF, 0xC3, 0xCB, 0xFF, 0xCC, 0xD0, 0xD5, 0xFF, 0xA8, 0xAD, 0xB6,
+    0xFF, 0x57, 0x5F, 0x75, 0xFF, 0x44, 0x4F, 0x68, 0xFF, 0x3C, 0x45, 0x5B, 0xFF, 0x37, 0x40, 0x53, 0xFF, 0x35, 0x3D, 0x4E, 0xFF, 0x32, 0x38, 0x49,
+    0xFF, 0x80, 0x30, 0x37, 0x47, 0xFF, 0x20, 0x2E, 0x35, 0x45, 0xFF, 0x2D, 0x33, 0x43, 0xFF, 0x2C, 0x33, 0x42, 0xFF, 0x29, 0x30, 0x3F, 0xFF, 0x27,
+    0x2D, 0x3C, 0xFF, 0x24, 0x2A, 0x38, 0xFF, 0x21, 0x27, 0x34, 0xFF, 0x20, 0x25, 0x32, 0xFF, 0x22, 0x27, 0x33, 0xFF, 0x20, 0x26, 0x33, 0xFF, 0x1D,
+    0x23, 0x2F, 0xFF, 0x1C, 0x22, 0x2E, 0xFF, 0x1D, 0x22, 0x30, 0xFF, 0x17, 0x1B, 0x25, 0xFF, 0x43, 0x48, 0x52, 0xFF, 0x6C, 0x70, 0x80, 0xFF, 0xA9,
+    0xAF, 0xB8, 0xFF, 0xB0, 0xB7, 0xC4, 0xFF, 0x51, 0x56, 0x64, 0xFF, 0x0F, 0x14, 0x1C, 0xFF, 0x19, 0x1D, 0x28, 0xFF, 0x18, 0x1C, 0x27, 0xFF, 0x14,
+    0x18, 0x24, 0xFF, 0x15, 0x18, 0x23, 0xFF, 0x13, 0x16, 0x21, 0xFF, 0x11, 0x15, 0x1F, 0xFF, 0x14, 0x16, 0x21, 0xFF, 0x13, 0x16, 0x21, 0xFF, 0x10,
+    0x14, 0x1C, 0xFF, 0x1E, 0x21, 0x27, 0xFF, 0x02, 0x03, 0x05, 0xFF, 0x02, 0x02, 0x05, 0xFF, 0x02, 0x02, 0x06, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF,
+    0x80, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x81, 0x00, 0x00, 0x01, 0xFF,
+    0x80, 0x00, 0x00, 0x03, 0xFF, 0x4A, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01,
+    0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x02, 0x03, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x01, 0x02,
+    0x05, 0xFF, 0x02, 0x02, 0x05, 0xFF, 0x02, 0x02, 0x07, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x02, 0x04,
+    0x08, 0xFF, 0x0A, 0x0D, 0x14, 0xFF, 0x1F, 0x24, 0x30, 0xFF, 0x1B, 0x1E, 0x2B, 0xFF, 0x1C, 0x1E, 0x2B, 0xFF, 0x1B, 0x1E, 0x2B, 0xFF, 0x1A, 0x1E,
+    0x2A, 0xFF, 0x1B, 0x1E, 0x2B, 0xFF, 0x1C, 0x1F, 0x2E, 0xFF, 0x1C, 0x1F, 0x2D, 0xFF, 0x1C, 0x20, 0x2D, 0xFF, 0x1D, 0x21, 0x2E, 0xFF, 0x1C, 0x20,
+    0x2F, 0xFF, 0x0E, 0x13, 0x1F, 0xFF, 0x8A, 0x90, 0x9C, 0xFF, 0xA3, 0xA9, 0xB1, 0xFF, 0x40, 0x47, 0x5C, 0xFF, 0x61, 0x63, 0x7F, 0xFF, 0x70, 0x72,
+    0x8E, 0xFF, 0x68, 0x68, 0x7F, 0xFF, 0x1E, 0x1E, 0x27, 0xFF, 0x08, 0x0A, 0x15, 0xFF, 0x08, 0x0C, 0x17, 0xFF, 0x23, 0x28, 0x35, 0xFF, 0x3B, 0x40,
+    0x54, 0xFF, 0x27, 0x2B, 0x3D, 0xFF, 0x29, 0x2D, 0x41, 0xFF, 0x2A, 0x2F, 0x42, 0xFF, 0x2E, 0x32, 0x46, 0xFF, 0x32, 0x36, 0x4B, 0xFF, 0x33, 0x38,
+    0x4B, 0xFF, 0x32, 0x37, 0x4B, 0xFF, 0x32, 0x38, 0x4D, 0xFF, 0x35, 0x3A, 0x4F, 0xFF, 0x35, 0x39, 0x4F, 0xFF, 0x34, 0x39, 0x4D, 0xFF, 0x63, 0x69,
+    0x7E, 0xFF, 0x88, 0x92, 0xA6, 0xFF, 0x45, 0x4E, 0x66, 0xFF, 0x3C, 0x43, 0x59, 0xFF, 0x40, 0x46, 0x5D, 0xFF, 0x3E, 0x46, 0x5C, 0xFF, 0x42, 0x49,
+    0x60, 0xFF, 0x47, 0x4E, 0x64, 0xFF, 0x48, 0x50, 0x67, 0xFF, 0x49, 0x51, 0x6A, 0xFF, 0x4F, 0x57, 0x6F, 0xFF, 0x4F, 0x56, 0x6F, 0xFF, 0x4E, 0x56,
+    0x6C, 0xFF, 0xAB, 0xAF, 0xB7, 0xFF, 0xD8, 0xDA, 0xDD, 0xFF, 0xB6, 0xB9, 0xC0, 0xFF, 0x9F, 0xA2, 0xAC, 0xFF, 0x19, 0x1B, 0x26, 0xFF, 0x0B, 0x0F,
+    0x20, 0xFF, 0x0A, 0x0E, 0x1E, 0xFF, 0x07, 0x0A, 0x1A, 0xFF, 0x06, 0x09, 0x17, 0xFF, 0x07, 0x08, 0x16, 0xFF, 0x80, 0x07, 0x08, 0x15, 0xFF, 0x08,
+    0x06, 0x09, 0x16, 0xFF, 0x06, 0x09, 0x15, 0xFF, 0x07, 0x0A, 0x16, 0xFF, 0x07, 0x08, 0x15, 0xFF, 0x03, 0x04, 0x0C, 0xFF, 0x3C, 0x3F, 0x4B, 0xFF,
+    0x78, 0x7D, 0x8F, 0xFF, 0x6D, 0x72, 0x88, 0xFF, 0x6C, 0x71, 0x89, 0xFF, 0x80, 0x6E, 0x74, 0x8C, 0xFF, 0x25, 0x6C, 0x72, 0x8B, 0xFF, 0x6D, 0x73,
+    0x8B, 0xFF, 0x70, 0x76, 0x8D, 0xFF, 0x72, 0x78, 0x8F, 0xFF, 0x73, 0x7B, 0x91, 0xFF, 0x70, 0x77, 0x8E, 0xFF, 0x70, 0x79, 0x90, 0xFF, 0x88, 0x8F,
+    0xA5, 0xFF, 0x77, 0x80, 0x96, 0xFF, 0x6D, 0x75, 0x8C, 0xFF, 0x6F, 0x76, 0x8E, 0xFF, 0x70, 0x78, 0x8F, 0xFF, 0x74, 0x7B, 0x93, 0xFF, 0x75, 0x7D,
+    0x93, 0xFF, 0x75, 0x7C, 0x92, 0xFF, 0x74, 0x7C, 0x91, 0xFF, 0x75, 0x7C, 0x92, 0xFF, 0x79, 0x80, 0x95, 0xFF, 0x7A, 0x80, 0x95, 0xFF, 0x7A, 0x7F,
+    0x95, 0xFF, 0xA7, 0xAD, 0xBB, 0xFF, 0x8A, 0x8F, 0xA1, 0xFF, 0x4C, 0x4F, 0x5F, 0xFF, 0x06, 0x07, 0x15, 0xFF, 0x0E, 0x10, 0x24, 0xFF, 0x0C, 0x0E,
+    0x20, 0xFF, 0x0B, 0x0C, 0x1E, 0xFF, 0x0A, 0x0D, 0x1E, 0xFF, 0x0A, 0x0C, 0x1D, 0xFF, 0x0A, 0x0C, 0x1C, 0xFF, 0x0A, 0x0B, 0x1B, 0xFF, 0x08, 0x09,
+    0x16, 0xFF, 0x0A, 0x0B, 0x10, 0xFF, 0x5A, 0x5B, 0x5F, 0xFF, 0x9B, 0x9F, 0xA7, 0xFF, 0xA0, 0xA6, 0xB2, 0xFF, 0x7B, 0x82, 0x95, 0xFF, 0x79, 0x81,
+    0x95, 0xFF, 0x80, 0x7F, 0x86, 0x9A, 0xFF, 0x4D, 0x7D, 0x85, 0x98, 0xFF, 0x7A, 0x82, 0x96, 0xFF, 0x79, 0x81, 0x95, 0xFF, 0x7B, 0x83, 0x97, 0xFF,
+    0x7D, 0x84, 0x98, 0xFF, 0x7B, 0x83, 0x96, 0xFF, 0x7A, 0x82, 0x96, 0xFF, 0x7B, 0x83, 0x96, 0xFF, 0x7D, 0x85, 0x97, 0xFF, 0x7F, 0x86, 0x99, 0xFF,
+    0x80, 0x87, 0x99, 0xFF, 0x7F, 0x87, 0x99, 0xFF, 0x7D, 0x85, 0x98, 0xFF, 0x7A, 0x82, 0x96, 0xFF, 0x78, 0x80, 0x94, 0xFF, 0x77, 0x7F, 0x93, 0xFF,
+    0x78, 0x7F, 0x93, 0xFF, 0x7A, 0x81, 0x94, 0xFF, 0x7C, 0x83, 0x94, 0xFF, 0x80, 0x87, 0x99, 0xFF, 0x81, 0x87, 0x99, 0xFF, 0x7D, 0x84, 0x95, 0xFF,
+    0x7F, 0x86, 0x98, 0xFF, 0x97, 0x9D, 0xA8, 0xFF, 0x9C, 0x9F, 0xA6, 0xFF, 0x61, 0x62, 0x69, 0xFF, 0x07, 0x08, 0x11, 0xFF, 0x07, 0x0B, 0x17, 0xFF,
+    0x09, 0x0C, 0x18, 0xFF, 0x09, 0x0B, 0x18, 0xFF, 0x07, 0x0B, 0x17, 0xFF, 0x07, 0x0A, 0x16, 0xFF, 0x06, 0x09, 0x16, 0xFF, 0x06, 0x09, 0x15, 0xFF,
+    0x06, 0x08, 0x14, 0xFF, 0x06, 0x09, 0x14, 0xFF, 0x06, 0x09, 0x15, 0xFF, 0x07, 0x0A, 0x16, 0xFF, 0x08, 0x0C, 0x19, 0xFF, 0x09, 0x0D, 0x1A, 0xFF,
+    0x09, 0x0C, 0x19, 0xFF, 0x08, 0x0B, 0x14, 0xFF, 0x60, 0x65, 0x6C, 0xFF, 0xAC, 0xB1, 0xB7, 0xFF, 0xA0, 0xA4, 0xB0, 0xFF, 0x78, 0x7D, 0x92, 0xFF,
+    0x77, 0x7F, 0x93, 0xFF, 0x78, 0x7F, 0x93, 0xFF, 0x7A, 0x81, 0x95, 0xFF, 0x7C, 0x83, 0x97, 0xFF, 0x7D, 0x84, 0x98, 0xFF, 0x7D, 0x85, 0x99, 0xFF,
+    0x7F, 0x86, 0x9A, 0xFF, 0x7E, 0x85, 0x98, 0xFF, 0x7D, 0x85, 0x99, 0xFF, 0x7C, 0x85, 0x98, 0xFF, 0x7C, 0x84, 0x97, 0xFF, 0x7C, 0x84, 0x98, 0xFF,
+    0x7C, 0x83, 0x98, 0xFF, 0x7D, 0x84, 0x98, 0xFF, 0x7E, 0x86, 0x99, 0xFF, 0x7F, 0x87, 0x9A, 0xFF, 0x7D, 0x85, 0x99, 0xFF, 0x7C, 0x83, 0x98, 0xFF,
+    0x7D, 0x85, 0x98, 0xFF, 0x7F, 0x87, 0x9B, 0xFF, 0x80, 0x87, 0x9C, 0xFF, 0x7D, 0x86, 0x9A, 0xFF, 0x82, 0x89, 0x9D, 0xFF, 0xA3, 0xA9, 0xB5, 0xFF,
+    0xB9, 0xBD, 0xC6, 0xFF, 0xC3, 0xC6, 0xCD, 0xFF, 0x7B, 0x82, 0x97, 0xFF, 0x77, 0x7E, 0x96, 0xFF, 0x78, 0x80, 0x98, 0xFF, 0x77, 0x7F, 0x97, 0xFF,
+    0x73, 0x7B, 0x93, 0xFF, 0x72, 0x79, 0x91, 0xFF, 0x80, 0x72, 0x7A, 0x92, 0xFF, 0x0E, 0x73, 0x7B, 0x92, 0xFF, 0x77, 0x7E, 0x96, 0xFF, 0x78, 0x80,
+    0x96, 0xFF, 0x69, 0x71, 0x87, 0xFF, 0x25, 0x29, 0x37, 0xFF, 0x0E, 0x13, 0x29, 0xFF, 0x0E, 0x14, 0x2A, 0xFF, 0x38, 0x3A, 0x45, 0xFF, 0x85, 0x89,
+    0x98, 0xFF, 0x71, 0x75, 0x87, 0xFF, 0x9D, 0xA1, 0xAD, 0xFF, 0xAA, 0xAF, 0xBC, 0xFF, 0x6E, 0x76, 0x8B, 0xFF, 0x68, 0x70, 0x87, 0xFF, 0x68, 0x71,
+    0x87, 0xFF, 0x80, 0x66, 0x6E, 0x84, 0xFF, 0x28, 0x63, 0x6C, 0x82, 0xFF, 0x62, 0x6A, 0x80, 0xFF, 0x61, 0x69, 0x80, 0xFF, 0x60, 0x69, 0x7F, 0xFF,
+    0x5E, 0x66, 0x7D, 0xFF, 0x60, 0x68, 0x80, 0xFF, 0x45, 0x4C, 0x62, 0xFF, 0x0C, 0x10, 0x1D, 0xFF, 0x07, 0x0B, 0x18, 0xFF, 0x09, 0x0C, 0x1D, 0xFF,
+    0x0A, 0x0D, 0x1E, 0xFF, 0x09, 0x0D, 0x1E, 0xFF, 0x09, 0x0E, 0x1E, 0xFF, 0x0A, 0x0E, 0x1F, 0xFF, 0x09, 0x0E, 0x1E, 0xFF, 0x08, 0x0B, 0x19, 0xFF,
+    0x5E, 0x61, 0x6F, 0xFF, 0xA2, 0xA6, 0xB0, 0xFF, 0xCA, 0xCD, 0xD3, 0xFF, 0xC9, 0xCD, 0xD2, 0xFF, 0x8B, 0x90, 0x9F, 0xFF, 0x3E, 0x47, 0x5F, 0xFF,
+    0x3A, 0x42, 0x57, 0xFF, 0x3D, 0x45, 0x58, 0xFF, 0x3A, 0x42, 0x56, 0xFF, 0x36, 0x3E, 0x50, 0xFF, 0x30, 0x38, 0x49, 0xFF, 0x2E, 0x35, 0x44, 0xFF,
+    0x2D, 0x33, 0x43, 0xFF, 0x2C, 0x33, 0x43, 0xFF, 0x2C, 0x32, 0x41, 0xFF, 0x2A, 0x30, 0x3E, 0xFF, 0x28, 0x2E, 0x3C, 0xFF, 0x27, 0x2C, 0x3B, 0xFF,
+    0x26, 0x2C, 0x3A, 0xFF, 0x24, 0x2B, 0x38, 0xFF, 0x21, 0x26, 0x34, 0xFF, 0x1E, 0x24, 0x30, 0xFF, 0x1E, 0x23, 0x30, 0xFF, 0x1C, 0x21, 0x2D, 0xFF,
+    0x1C, 0x21, 0x2C, 0xFF, 0x80, 0x1E, 0x23, 0x2F, 0xFF, 0x13, 0x1D, 0x23, 0x2E, 0xFF, 0x13, 0x17, 0x21, 0xFF, 0x27, 0x2A, 0x33, 0xFF, 0x89, 0x90,
+    0x9C, 0xFF, 0xA9, 0xB1, 0xBC, 0xFF, 0x4C, 0x50, 0x5D, 0xFF, 0x13, 0x16, 0x20, 0xFF, 0x18, 0x1C, 0x27, 0xFF, 0x15, 0x18, 0x23, 0xFF, 0x14, 0x17,
+    0x21, 0xFF, 0x14, 0x18, 0x22, 0xFF, 0x15, 0x17, 0x22, 0xFF, 0x13, 0x17, 0x21, 0xFF, 0x14, 0x16, 0x20, 0xFF, 0x13, 0x15, 0x20, 0xFF, 0x10, 0x13,
+    0x1C, 0xFF, 0x1D, 0x22, 0x27, 0xFF, 0x02, 0x03, 0x05, 0xFF, 0x02, 0x03, 0x06, 0xFF, 0x02, 0x03, 0x07, 0xFF, 0x04, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x01,
+    0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x01, 0x02, 0xFF, 0x2D, 0x00, 0x02, 0x03, 0xFF, 0x01, 0x02, 0x04,
+    0xFF, 0x00, 0x02, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x02, 0x04, 0xFF, 0x00, 0x02, 0x03, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x00, 0x01, 0x04,
+    0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x02, 0x03, 0x07, 0xFF, 0x03, 0x03, 0x08, 0xFF, 0x02, 0x05, 0x0A,
+    0xFF, 0x01, 0x04, 0x08, 0xFF, 0x09, 0x0C, 0x13, 0xFF, 0x1D, 0x21, 0x2B, 0xFF, 0x19, 0x1B, 0x27, 0xFF, 0x19, 0x1B, 0x28, 0xFF, 0x18, 0x1B, 0x28,
+    0xFF, 0x19, 0x1C, 0x28, 0xFF, 0x1A, 0x1C, 0x28, 0xFF, 0x1B, 0x1E, 0x2B, 0xFF, 0x1A, 0x1E, 0x2B, 0xFF, 0x1A, 0x1E, 0x2A, 0xFF, 0x1A, 0x1F, 0x2C,
+    0xFF, 0x1B, 0x1F, 0x2C, 0xFF, 0x0E, 0x12, 0x1E, 0xFF, 0x88, 0x8F, 0x9B, 0xFF, 0xA3, 0xA9, 0xB1, 0xFF, 0x3D, 0x45, 0x5A, 0xFF, 0x5F, 0x63, 0x7F,
+    0xFF, 0x72, 0x74, 0x8F, 0xFF, 0x6A, 0x69, 0x80, 0xFF, 0x1E, 0x1E, 0x26, 0xFF, 0x08, 0x0A, 0x13, 0xFF, 0x08, 0x0B, 0x15, 0xFF, 0x23, 0x27, 0x34,
+    0xFF, 0x38, 0x3D, 0x51, 0xFF, 0x26, 0x2A, 0x3C, 0xFF, 0x29, 0x2D, 0x3F, 0xFF, 0x28, 0x2D, 0x40, 0xFF, 0x2B, 0x30, 0x43, 0xFF, 0x31, 0x35, 0x49,
+    0xFF, 0x33, 0x38, 0x4D, 0xFF, 0x33, 0x37, 0x4B, 0xFF, 0x80, 0x31, 0x37, 0x4B, 0xFF, 0x24, 0x2F, 0x35, 0x49, 0xFF, 0x33, 0x37, 0x4B, 0xFF, 0x68,
+    0x6E, 0x82, 0xFF, 0x8B, 0x94, 0xA8, 0xFF, 0x42, 0x4A, 0x62, 0xFF, 0x3A, 0x3E, 0x54, 0xFF, 0x3C, 0x41, 0x58, 0xFF, 0x3E, 0x45, 0x5B, 0xFF, 0x42,
+    0x49, 0x5F, 0xFF, 0x44, 0x4C, 0x62, 0xFF, 0x44, 0x4B, 0x61, 0xFF, 0x42, 0x48, 0x60, 0xFF, 0x47, 0x4E, 0x65, 0xFF, 0x4B, 0x51, 0x68, 0xFF, 0x4B,
+    0x54, 0x6B, 0xFF, 0x6D, 0x74, 0x87, 0xFF, 0xDE, 0xE0, 0xE3, 0xFF, 0xBC, 0xC0, 0xC7, 0xFF, 0xB2, 0xB6, 0xBE, 0xFF, 0x57, 0x5B, 0x67, 0xFF, 0x05,
+    0x05, 0x13, 0xFF, 0x08, 0x0B, 0x1B, 0xFF, 0x07, 0x0A, 0x19, 0xFF, 0x07, 0x0A, 0x17, 0xFF, 0x07, 0x09, 0x16, 0xFF, 0x07, 0x08, 0x15, 0xFF, 0x08,
+    0x08, 0x15, 0xFF, 0x08, 0x09, 0x17, 0xFF, 0x06, 0x09, 0x17, 0xFF, 0x07, 0x09, 0x16, 0xFF, 0x06, 0x08, 0x13, 0xFF, 0x04, 0x04, 0x0C, 0xFF, 0x4A,
+    0x4E, 0x5B, 0xFF, 0x76, 0x7A, 0x8F, 0xFF, 0x64, 0x6A, 0x83, 0xFF, 0x66, 0x6D, 0x85, 0xFF, 0x67, 0x6E, 0x85, 0xFF, 0x80, 0x68, 0x6F, 0x87, 0xFF,
+    0x0D, 0x6A, 0x6F, 0x86, 0xFF, 0x6C, 0x71, 0x88, 0xFF, 0x6F, 0x76, 0x8C, 0xFF, 0x70, 0x78, 0x8E, 0xFF, 0x6D, 0x75, 0x8B, 0xFF, 0x76, 0x7E, 0x94,
+    0xFF, 0x6B, 0x73, 0x89, 0xFF, 0x77, 0x7F, 0x93, 0xFF, 0x69, 0x70, 0x88, 0xFF, 0x6A, 0x72, 0x8B, 0xFF, 0x6B, 0x74, 0x8A, 0xFF, 0x6E, 0x76, 0x8C,
+    0xFF, 0x72, 0x79, 0x8F, 0xFF, 0x70, 0x78, 0x8F, 0xFF, 0x80, 0x6F, 0x76, 0x8D, 0xFF, 0x08, 0x73, 0x7A, 0x90, 0xFF, 0x74, 0x7B, 0x90, 0xFF, 0x76,
+    0x7C, 0x91, 0xFF, 0xA5, 0xAA, 0xB9, 0xFF, 0x89, 0x8E, 0xA0, 0xFF, 0x4B, 0x4D, 0x5E, 0xFF, 0x06, 0x07, 0x14, 0xFF, 0x0E, 0x11, 0x24, 0xFF, 0x0B,
+    0x0F, 0x21, 0xFF, 0x81, 0x0B, 0x0D, 0x1F, 0xFF, 0x19, 0x0B, 0x0E, 0x20, 0xFF, 0x0B, 0x0D, 0x1C, 0xFF, 0x0E, 0x10, 0x16, 0xFF, 0x59, 0x5D, 0x63,
+    0xFF, 0xA7, 0xAC, 0xB2, 0xFF, 0x87, 0x8C, 0x9D, 0xFF, 0x75, 0x7B, 0x8E, 0xFF, 0x76, 0x7C, 0x91, 0xFF, 0x78, 0x7F, 0x94, 0xFF, 0x78, 0x80, 0x94,
+    0xFF, 0x79, 0x80, 0x94, 0xFF, 0x77, 0x7F, 0x93, 0xFF, 0x75, 0x7E, 0x91, 0xFF, 0x76, 0x7E, 0x92, 0xFF, 0x79, 0x80, 0x94, 0xFF, 0x7A, 0x82, 0x96,
+    0xFF, 0x78, 0x7F, 0x93, 0xFF, 0x77, 0x7F, 0x92, 0xFF, 0x78, 0x80, 0x93, 0xFF, 0x79, 0x81, 0x94, 0xFF, 0x78, 0x80, 0x93, 0xFF, 0x78, 0x7E, 0x93,
+    0xFF, 0x7A, 0x82, 0x95, 0xFF, 0x7B, 0x83, 0x96, 0xFF, 0x78, 0x7F, 0x94, 0xFF, 0x76, 0x7E, 0x92, 0xFF, 0x80, 0x74, 0x7C, 0x90, 0xFF, 0x29, 0x76,
+    0x7D, 0x90, 0xFF, 0x79, 0x7F, 0x92, 0xFF, 0x80, 0x86, 0x98, 0xFF, 0x81, 0x88, 0x98, 0xFF, 0x7E, 0x85, 0x97, 0xFF, 0x7A, 0x82, 0x95, 0xFF, 0x73,
+    0x7C, 0x8F, 0xFF, 0x8D, 0x93, 0xA1, 0xFF, 0x9B, 0x9F, 0xA6, 0xFF, 0x5A, 0x5C, 0x63, 0xFF, 0x09, 0x0B, 0x14, 0xFF, 0x0A, 0x0D, 0x1C, 0xFF, 0x09,
+    0x0D, 0x1A, 0xFF, 0x09, 0x0C, 0x19, 0xFF, 0x08, 0x0B, 0x18, 0xFF, 0x07, 0x0A, 0x17, 0xFF, 0x07, 0x0A, 0x16, 0xFF, 0x07, 0x09, 0x15, 0xFF, 0x06,
+    0x09, 0x15, 0xFF, 0x07, 0x09, 0x15, 0xFF, 0x08, 0x0A, 0x17, 0xFF, 0x08, 0x0C, 0x1A, 0xFF, 0x09, 0x0E, 0x1C, 0xFF, 0x07, 0x09, 0x14, 0xFF, 0x5F,
+    0x61, 0x6A, 0xFF, 0xB6, 0xBC, 0xC0, 0xFF, 0x96, 0x9A, 0xA8, 0xFF, 0x7E, 0x85, 0x97, 0xFF, 0x79, 0x80, 0x93, 0xFF, 0x77, 0x7E, 0x92, 0xFF, 0x72,
+    0x7A, 0x8F, 0xFF, 0x73, 0x7B, 0x8F, 0xFF, 0x74, 0x7D, 0x91, 0xFF, 0x77, 0x7F, 0x93, 0xFF, 0x78, 0x80, 0x94, 0xFF, 0x7A, 0x81, 0x95, 0xFF, 0x79,
+    0x81, 0x95, 0xFF, 0x79, 0x81, 0x96, 0xFF, 0x7A, 0x82, 0x96, 0xFF, 0x7B, 0x83, 0x96, 0xFF, 0x7A, 0x83, 0x97, 0xFF, 0x79, 0x81, 0x95, 0xFF, 0x80,
+    0x77, 0x7F, 0x94, 0xFF, 0x13, 0x78, 0x81, 0x95, 0xFF, 0x75, 0x7E, 0x93, 0xFF, 0x74, 0x7D, 0x92, 0xFF, 0x76, 0x7F, 0x93, 0xFF, 0x79, 0x82, 0x96,
+    0xFF, 0x7A, 0x83, 0x96, 0xFF, 0x7A, 0x82, 0x96, 0xFF, 0x78, 0x81, 0x95, 0xFF, 0x7A, 0x82, 0x95, 0xFF, 0x9B, 0xA2, 0xAF, 0xFF, 0x98, 0x9E, 0xAC,
+    0xFF, 0x76, 0x7E, 0x94, 0xFF, 0x71, 0x79, 0x8F, 0xFF, 0x71, 0x79, 0x91, 0xFF, 0x6F, 0x77, 0x8F, 0xFF, 0x6B, 0x74, 0x8B, 0xFF, 0x6B, 0x73, 0x8B,
+    0xFF, 0x6E, 0x77, 0x8F, 0xFF, 0x72, 0x79, 0x91, 0xFF, 0x73, 0x7A, 0x91, 0xFF, 0x80, 0x73, 0x7C, 0x93, 0xFF, 0x0E, 0x66, 0x6F, 0x84, 0xFF, 0x24,
+    0x29, 0x36, 0xFF, 0x0F, 0x13, 0x28, 0xFF, 0x0E, 0x14, 0x29, 0xFF, 0x38, 0x3A, 0x45, 0xFF, 0x87, 0x8A, 0x99, 0xFF, 0x70, 0x73, 0x85, 0xFF, 0x9B,
+    0xA0, 0xAD, 0xFF, 0xA9, 0xAF, 0xBC, 0xFF, 0x6B, 0x72, 0x88, 0xFF, 0x64, 0x6C, 0x83, 0xFF, 0x62, 0x6A, 0x80, 0xFF, 0x5E, 0x66, 0x7C, 0xFF, 0x5F,
+    0x66, 0x7D, 0xFF, 0x5D, 0x66, 0x7C, 0xFF, 0x80, 0x5C, 0x64, 0x7A, 0xFF, 0x07, 0x5B, 0x63, 0x7A, 0xFF, 0x59, 0x61, 0x78, 0xFF, 0x5D, 0x66, 0x7C,
+    0xFF, 0x45, 0x4D, 0x62, 0xFF, 0x0C, 0x12, 0x1F, 0xFF, 0x08, 0x0B, 0x1A, 0xFF, 0x09, 0x0E, 0x1D, 0xFF, 0x09, 0x0E, 0x1F, 0xFF, 0x80, 0x0A, 0x0F,
+    0x1F, 0xFF, 0x12, 0x0B, 0x10, 0x1F, 0xFF, 0x15, 0x18, 0x22, 0xFF, 0x5F, 0x62, 0x71, 0xFF, 0xAF, 0xB3, 0xBF, 0xFF, 0xC8, 0xCB, 0xD3, 0xFF, 0xC8,
+    0xC9, 0xD1, 0xFF, 0x81, 0x85, 0x94, 0xFF, 0x3B, 0x46, 0x5A, 0xFF, 0x3A, 0x44, 0x59, 0xFF, 0x3A, 0x42, 0x56, 0xFF, 0x38, 0x3E, 0x50, 0xFF, 0x33,
+    0x39, 0x4B, 0xFF, 0x31, 0x37, 0x48, 0xFF, 0x2F, 0x35, 0x45, 0xFF, 0x2C, 0x32, 0x42, 0xFF, 0x2B, 0x31, 0x40, 0xFF, 0x29, 0x2E, 0x3E, 0xFF, 0x28,
+    0x2E, 0x3D, 0xFF, 0x26, 0x2B, 0x3A, 0xFF, 0x80, 0x22, 0x28, 0x37, 0xFF, 0x1C, 0x24, 0x2A, 0x38, 0xFF, 0x24, 0x29, 0x37, 0xFF, 0x23, 0x28, 0x35,
+    0xFF, 0x20, 0x26, 0x31, 0xFF, 0x1F, 0x24, 0x30, 0xFF, 0x1D, 0x22, 0x2F, 0xFF, 0x1C, 0x21, 0x2D, 0xFF, 0x1E, 0x23, 0x2E, 0xFF, 0x1F, 0x24, 0x30,
+    0xFF, 0x1F, 0x23, 0x30, 0xFF, 0x1C, 0x20, 0x2D, 0xFF, 0x12, 0x15, 0x1E, 0xFF, 0x55, 0x5A, 0x62, 0xFF, 0x8D, 0x94, 0x9F, 0xFF, 0x3A, 0x3E, 0x48,
+    0xFF, 0x14, 0x19, 0x23, 0xFF, 0x18, 0x1C, 0x26, 0xFF, 0x14, 0x18, 0x21, 0xFF, 0x14, 0x17, 0x21, 0xFF, 0x15, 0x18, 0x22, 0xFF, 0x16, 0x19, 0x22,
+    0xFF, 0x15, 0x19, 0x23, 0xFF, 0x14, 0x17, 0x20, 0xFF, 0x11, 0x14, 0x1C, 0xFF, 0x0F, 0x12, 0x19, 0xFF, 0x1D, 0x23, 0x27, 0xFF, 0x02, 0x03, 0x06,
+    0xFF, 0x02, 0x02, 0x05, 0xFF, 0x02, 0x03, 0x06, 0xFF, 0x00, 0x01, 0x00, 0x02, 0xFF, 0x81, 0x00, 0x00, 0x01, 0xFF, 0x02, 0x01, 0x00, 0x01, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x0C, 0x00, 0x00, 0x02, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x00,
+    0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x02,
+    0x04, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x00, 0x02, 0x03, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x80, 0x01, 0x02, 0x06, 0xFF, 0x23,
+    0x01, 0x03, 0x07, 0xFF, 0x02, 0x03, 0x07, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x03, 0x04, 0x09, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x08, 0x0C, 0x12, 0xFF,
+    0x1C, 0x20, 0x2B, 0xFF, 0x17, 0x1A, 0x25, 0xFF, 0x17, 0x19, 0x25, 0xFF, 0x17, 0x1A, 0x26, 0xFF, 0x19, 0x1B, 0x27, 0xFF, 0x1A, 0x1C, 0x28, 0xFF,
+    0x1A, 0x1C, 0x2A, 0xFF, 0x1A, 0x1D, 0x29, 0xFF, 0x1A, 0x1C, 0x29, 0xFF, 0x19, 0x1D, 0x2A, 0xFF, 0x1A, 0x1E, 0x2B, 0xFF, 0x0E, 0x11, 0x1E, 0xFF,
+    0x87, 0x8E, 0x9A, 0xFF, 0xA2, 0xA8, 0xB0, 0xFF, 0x3B, 0x42, 0x57, 0xFF, 0x60, 0x64, 0x7F, 0xFF, 0x74, 0x76, 0x90, 0xFF, 0x6A, 0x6A, 0x80, 0xFF,
+    0x1D, 0x1D, 0x25, 0xFF, 0x07, 0x09, 0x11, 0xFF, 0x06, 0x0A, 0x12, 0xFF, 0x21, 0x25, 0x32, 0xFF, 0x38, 0x3C, 0x51, 0xFF, 0x26, 0x2A, 0x3A, 0xFF,
+    0x28, 0x2B, 0x3D, 0xFF, 0x26, 0x2C, 0x3C, 0xFF, 0x27, 0x2D, 0x3F, 0xFF, 0x2C, 0x30, 0x44, 0xFF, 0x2E, 0x32, 0x45, 0xFF, 0x2D, 0x32, 0x45, 0xFF,
+    0x80, 0x2F, 0x34, 0x46, 0xFF, 0x16, 0x2D, 0x32, 0x45, 0xFF, 0x30, 0x34, 0x47, 0xFF, 0x67, 0x6F, 0x82, 0xFF, 0x88, 0x90, 0xA2, 0xFF, 0x36, 0x3F,
+    0x52, 0xFF, 0x43, 0x4B, 0x61, 0xFF, 0x35, 0x3A, 0x4F, 0xFF, 0x3A, 0x41, 0x57, 0xFF, 0x3D, 0x45, 0x5A, 0xFF, 0x3F, 0x47, 0x5D, 0xFF, 0x3F, 0x45,
+    0x5C, 0xFF, 0x3D, 0x45, 0x5A, 0xFF, 0x40, 0x48, 0x5C, 0xFF, 0x45, 0x4E, 0x64, 0xFF, 0x49, 0x52, 0x68, 0xFF, 0x56, 0x5C, 0x73, 0xFF, 0xB8, 0xBA,
+    0xC3, 0xFF, 0xD0, 0xD2, 0xD7, 0xFF, 0xB3, 0xB7, 0xBF, 0xFF, 0x94, 0x99, 0xA3, 0xFF, 0x06, 0x07, 0x12, 0xFF, 0x07, 0x0B, 0x18, 0xFF, 0x08, 0x0B,
+    0x19, 0xFF, 0x80, 0x07, 0x09, 0x17, 0xFF, 0x1B, 0x07, 0x09, 0x16, 0xFF, 0x08, 0x09, 0x17, 0xFF, 0x07, 0x09, 0x19, 0xFF, 0x07, 0x0A, 0x19, 0xFF,
+    0x07, 0x09, 0x17, 0xFF, 0x04, 0x06, 0x10, 0xFF, 0x25, 0x27, 0x31, 0xFF, 0x64, 0x69, 0x79, 0xFF, 0x63, 0x69, 0x7F, 0xFF, 0x61, 0x68, 0x81, 0xFF,
+    0x64, 0x6A, 0x83, 0xFF, 0x64, 0x6A, 0x82, 0xFF, 0x66, 0x6C, 0x84, 0xFF, 0x67, 0x6D, 0x84, 0xFF, 0x67, 0x6E, 0x83, 0xFF, 0x66, 0x6D, 0x84, 0xFF,
+    0x6C, 0x72, 0x89, 0xFF, 0x6D, 0x73, 0x8B, 0xFF, 0x6A, 0x73, 0x89, 0xFF, 0x85, 0x8C, 0xA1, 0xFF, 0x59, 0x61, 0x77, 0xFF, 0x78, 0x7E, 0x94, 0xFF,
+    0x68, 0x6F, 0x86, 0xFF, 0x66, 0x6E, 0x86, 0xFF, 0x68, 0x70, 0x88, 0xFF, 0x6A, 0x72, 0x89, 0xFF, 0x6D, 0x75, 0x8B, 0xFF, 0x6E, 0x76, 0x8C, 0xFF,
+    0x80, 0x6D, 0x75, 0x8B, 0xFF, 0x16, 0x6D, 0x74, 0x8B, 0xFF, 0x6E, 0x75, 0x8C, 0xFF, 0x71, 0x77, 0x8C, 0xFF, 0xA3, 0xA8, 0xB7, 0xFF, 0x89, 0x8D,
+    0x9F, 0xFF, 0x4C, 0x4E, 0x5E, 0xFF, 0x06, 0x07, 0x13, 0xFF, 0x0E, 0x11, 0x22, 0xFF, 0x0C, 0x0F, 0x20, 0xFF, 0x0B, 0x0E, 0x20, 0xFF, 0x0B, 0x0D,
+    0x20, 0xFF, 0x0C, 0x0F, 0x21, 0xFF, 0x0C, 0x10, 0x21, 0xFF, 0x0B, 0x0D, 0x16, 0xFF, 0x5B, 0x5E, 0x64, 0xFF, 0xA4, 0xAB, 0xB0, 0xFF, 0x7E, 0x84,
+    0x96, 0xFF, 0x70, 0x77, 0x8C, 0xFF, 0x71, 0x78, 0x8D, 0xFF, 0x71, 0x78, 0x8B, 0xFF, 0x75, 0x7C, 0x90, 0xFF, 0x75, 0x7D, 0x90, 0xFF, 0x74, 0x7B,
+    0x90, 0xFF, 0x80, 0x73, 0x7B, 0x8F, 0xFF, 0x60, 0x75, 0x7C, 0x91, 0xFF, 0x77, 0x7F, 0x92, 0xFF, 0x78, 0x7F, 0x93, 0xFF, 0x75, 0x7D, 0x92, 0xFF,
+    0x75, 0x7D, 0x91, 0xFF, 0x74, 0x7C, 0x91, 0xFF, 0x75, 0x7D, 0x92, 0xFF, 0x73, 0x7B, 0x8F, 0xFF, 0x72, 0x7A, 0x8E, 0xFF, 0x74, 0x7C, 0x91, 0xFF,
+    0x75, 0x7D, 0x92, 0xFF, 0x74, 0x7B, 0x91, 0xFF, 0x74, 0x7C, 0x90, 0xFF, 0x75, 0x7C, 0x90, 0xFF, 0x74, 0x7C, 0x8F, 0xFF, 0x76, 0x7C, 0x8F, 0xFF,
+    0x78, 0x7F, 0x91, 0xFF, 0x7D, 0x84, 0x96, 0xFF, 0x7C, 0x84, 0x96, 0xFF, 0x79, 0x81, 0x94, 0xFF, 0x76, 0x7E, 0x91, 0xFF, 0x70, 0x78, 0x8C, 0xFF,
+    0x6D, 0x77, 0x8A, 0xFF, 0x87, 0x8E, 0x9C, 0xFF, 0xA7, 0xAB, 0xB2, 0xFF, 0x57, 0x58, 0x5E, 0xFF, 0x08, 0x0B, 0x14, 0xFF, 0x0C, 0x0F, 0x1F, 0xFF,
+    0x09, 0x0D, 0x1C, 0xFF, 0x09, 0x0C, 0x1A, 0xFF, 0x08, 0x0B, 0x19, 0xFF, 0x08, 0x0A, 0x17, 0xFF, 0x07, 0x0B, 0x16, 0xFF, 0x07, 0x0A, 0x15, 0xFF,
+    0x07, 0x0A, 0x16, 0xFF, 0x08, 0x0B, 0x18, 0xFF, 0x0A, 0x0C, 0x1A, 0xFF, 0x04, 0x08, 0x12, 0xFF, 0x54, 0x57, 0x5F, 0xFF, 0xB3, 0xB6, 0xBB, 0xFF,
+    0x96, 0x9A, 0xA7, 0xFF, 0x71, 0x76, 0x8B, 0xFF, 0x76, 0x7E, 0x93, 0xFF, 0x76, 0x7E, 0x92, 0xFF, 0x71, 0x78, 0x8E, 0xFF, 0x6D, 0x74, 0x89, 0xFF,
+    0x6D, 0x75, 0x8A, 0xFF, 0x71, 0x78, 0x8E, 0xFF, 0x71, 0x7A, 0x8E, 0xFF, 0x72, 0x7A, 0x90, 0xFF, 0x72, 0x7A, 0x8F, 0xFF, 0x73, 0x7B, 0x8F, 0xFF,
+    0x73, 0x7C, 0x90, 0xFF, 0x74, 0x7C, 0x90, 0xFF, 0x77, 0x80, 0x93, 0xFF, 0x76, 0x7F, 0x94, 0xFF, 0x73, 0x7C, 0x91, 0xFF, 0x70, 0x78, 0x8F, 0xFF,
+    0x6E, 0x77, 0x8D, 0xFF, 0x70, 0x77, 0x8F, 0xFF, 0x6E, 0x77, 0x8D, 0xFF, 0x6D, 0x77, 0x8D, 0xFF, 0x6E, 0x77, 0x8E, 0xFF, 0x73, 0x7B, 0x90, 0xFF,
+    0x76, 0x7F, 0x93, 0xFF, 0x77, 0x7F, 0x92, 0xFF, 0x74, 0x7C, 0x90, 0xFF, 0x76, 0x7E, 0x92, 0xFF, 0x75, 0x7E, 0x91, 0xFF, 0x74, 0x7C, 0x91, 0xFF,
+    0x70, 0x78, 0x8D, 0xFF, 0x6E, 0x75, 0x8C, 0xFF, 0x6B, 0x72, 0x8A, 0xFF, 0x68, 0x70, 0x88, 0xFF, 0x65, 0x6E, 0x85, 0xFF, 0x67, 0x6F, 0x87, 0xFF,
+    0x6C, 0x74, 0x8A, 0xFF, 0x6E, 0x77, 0x8E, 0xFF, 0x6E, 0x77, 0x8F, 0xFF, 0x6E, 0x77, 0x8E, 0xFF, 0x6D, 0x76, 0x8D, 0xFF, 0x64, 0x6B, 0x82, 0xFF,
+    0x24, 0x28, 0x36, 0xFF, 0x0F, 0x12, 0x25, 0xFF, 0x0E, 0x13, 0x26, 0xFF, 0x37, 0x39, 0x45, 0xFF, 0x86, 0x89, 0x98, 0xFF, 0x6F, 0x72, 0x84, 0xFF,
+    0x9A, 0x9F, 0xAB, 0xFF, 0xA7, 0xAD, 0xBA, 0xFF, 0x68, 0x6F, 0x86, 0xFF, 0x60, 0x68, 0x7E, 0xFF, 0x5D, 0x64, 0x7B, 0xFF, 0x57, 0x5F, 0x76, 0xFF,
+    0x58, 0x5F, 0x76, 0xFF, 0x59, 0x61, 0x77, 0xFF, 0x58, 0x60, 0x77, 0xFF, 0x80, 0x57, 0x5F, 0x75, 0xFF, 0x14, 0x56, 0x5F, 0x75, 0xFF, 0x5A, 0x63,
+    0x7A, 0xFF, 0x45, 0x4D, 0x63, 0xFF, 0x0F, 0x15, 0x23, 0xFF, 0x08, 0x0D, 0x1D, 0xFF, 0x09, 0x0E, 0x1F, 0xFF, 0x0A, 0x0E, 0x20, 0xFF, 0x0B, 0x10,
+    0x21, 0xFF, 0x0B, 0x0F, 0x1E, 0xFF, 0x0F, 0x12, 0x1C, 0xFF, 0x62, 0x65, 0x76, 0xFF, 0xB5, 0xBA, 0xC4, 0xFF, 0xB4, 0xB7, 0xC3, 0xFF, 0xC9, 0xCB,
+    0xD2, 0xFF, 0x86, 0x89, 0x98, 0xFF, 0x35, 0x3F, 0x58, 0xFF, 0x35, 0x40, 0x56, 0xFF, 0x39, 0x41, 0x55, 0xFF, 0x36, 0x3D, 0x50, 0xFF, 0x32, 0x38,
+    0x49, 0xFF, 0x2E, 0x34, 0x45, 0xFF, 0x80, 0x2D, 0x33, 0x43, 0xFF, 0x23, 0x2B, 0x31, 0x42, 0xFF, 0x29, 0x2E, 0x3E, 0xFF, 0x27, 0x2D, 0x3C, 0xFF,
+    0x25, 0x2B, 0x3A, 0xFF, 0x23, 0x29, 0x37, 0xFF, 0x20, 0x25, 0x33, 0xFF, 0x21, 0x25, 0x34, 0xFF, 0x21, 0x27, 0x35, 0xFF, 0x22, 0x28, 0x36, 0xFF,
+    0x23, 0x29, 0x35, 0xFF, 0x21, 0x27, 0x34, 0xFF, 0x1F, 0x24, 0x31, 0xFF, 0x1F, 0x24, 0x30, 0xFF, 0x1E, 0x24, 0x31, 0xFF, 0x1D, 0x23, 0x2E, 0xFF,
+    0x1F, 0x23, 0x30, 0xFF, 0x1E, 0x23, 0x2F, 0xFF, 0x1B, 0x1F, 0x2B, 0xFF, 0x18, 0x1B, 0x26, 0xFF, 0x10, 0x13, 0x1A, 0xFF, 0x1A, 0x1D, 0x24, 0xFF,
+    0x18, 0x1B, 0x25, 0xFF, 0x16, 0x1B, 0x25, 0xFF, 0x19, 0x1D, 0x27, 0xFF, 0x17, 0x1A, 0x24, 0xFF, 0x14, 0x17, 0x21, 0xFF, 0x15, 0x18, 0x22, 0xFF,
+    0x16, 0x19, 0x22, 0xFF, 0x16, 0x1A, 0x22, 0xFF, 0x14, 0x18, 0x21, 0xFF, 0x10, 0x13, 0x1B, 0xFF, 0x0E, 0x11, 0x17, 0xFF, 0x1D, 0x22, 0x27, 0xFF,
+    0x02, 0x04, 0x06, 0xFF, 0x02, 0x02, 0x05, 0xFF, 0x02, 0x03, 0x06, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x80,
+    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x01, 0x02, 0xFF, 0x16, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00,
+    0x01, 0x03, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x02, 0x03, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01,
+    0x01, 0x06, 0xFF, 0x00, 0x02, 0x05, 0xFF, 0x02, 0x02, 0x07, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x02,
+    0x03, 0x07, 0xFF, 0x07, 0x0A, 0x11, 0xFF, 0x19, 0x1C, 0x27, 0xFF, 0x15, 0x17, 0x22, 0xFF, 0x16, 0x18, 0x23, 0xFF, 0x17, 0x1A, 0x26, 0xFF, 0x18,
+    0x1A, 0x26, 0xFF, 0x19, 0x1B, 0x27, 0xFF, 0x19, 0x1C, 0x28, 0xFF, 0x80, 0x18, 0x1B, 0x28, 0xFF, 0x45, 0x1A, 0x1E, 0x2A, 0xFF, 0x1A, 0x1E, 0x2C,
+    0xFF, 0x0F, 0x12, 0x1E, 0xFF, 0x8A, 0x8F, 0x9A, 0xFF, 0xA4, 0xAA, 0xB1, 0xFF, 0x39, 0x41, 0x56, 0xFF, 0x61, 0x65, 0x7F, 0xFF, 0x76, 0x78, 0x91,
+    0xFF, 0x6A, 0x6B, 0x80, 0xFF, 0x1B, 0x1C, 0x24, 0xFF, 0x06, 0x09, 0x0F, 0xFF, 0x06, 0x09, 0x12, 0xFF, 0x1F, 0x23, 0x31, 0xFF, 0x36, 0x39, 0x4E,
+    0xFF, 0x23, 0x26, 0x37, 0xFF, 0x25, 0x28, 0x3A, 0xFF, 0x24, 0x28, 0x39, 0xFF, 0x26, 0x2B, 0x3C, 0xFF, 0x29, 0x2C, 0x3E, 0xFF, 0x28, 0x2D, 0x3F,
+    0xFF, 0x28, 0x2D, 0x3E, 0xFF, 0x2A, 0x2E, 0x41, 0xFF, 0x2D, 0x31, 0x44, 0xFF, 0x2D, 0x32, 0x44, 0xFF, 0x2C, 0x31, 0x44, 0xFF, 0x64, 0x6C, 0x80,
+    0xFF, 0x83, 0x8A, 0x9C, 0xFF, 0x34, 0x3C, 0x4D, 0xFF, 0x49, 0x52, 0x69, 0xFF, 0x30, 0x35, 0x4A, 0xFF, 0x36, 0x3C, 0x52, 0xFF, 0x3A, 0x40, 0x57,
+    0xFF, 0x3F, 0x46, 0x5C, 0xFF, 0x3F, 0x46, 0x5B, 0xFF, 0x3E, 0x46, 0x5A, 0xFF, 0x3F, 0x46, 0x5A, 0xFF, 0x43, 0x4A, 0x60, 0xFF, 0x4A, 0x52, 0x68,
+    0xFF, 0x47, 0x51, 0x66, 0xFF, 0x7A, 0x7F, 0x8E, 0xFF, 0xD5, 0xD8, 0xDC, 0xFF, 0xAA, 0xAE, 0xB8, 0xFF, 0xAB, 0xAF, 0xB8, 0xFF, 0x29, 0x2B, 0x38,
+    0xFF, 0x06, 0x08, 0x14, 0xFF, 0x08, 0x0A, 0x19, 0xFF, 0x08, 0x0A, 0x18, 0xFF, 0x08, 0x09, 0x18, 0xFF, 0x07, 0x09, 0x18, 0xFF, 0x07, 0x09, 0x1A,
+    0xFF, 0x07, 0x0A, 0x1A, 0xFF, 0x07, 0x0B, 0x1A, 0xFF, 0x09, 0x09, 0x1A, 0xFF, 0x05, 0x06, 0x11, 0xFF, 0x35, 0x38, 0x44, 0xFF, 0x73, 0x77, 0x8A,
+    0xFF, 0x59, 0x60, 0x77, 0xFF, 0x5E, 0x64, 0x7D, 0xFF, 0x5F, 0x65, 0x7F, 0xFF, 0x5F, 0x66, 0x7E, 0xFF, 0x60, 0x67, 0x7E, 0xFF, 0x62, 0x68, 0x81,
+    0xFF, 0x63, 0x6A, 0x82, 0xFF, 0x64, 0x6C, 0x82, 0xFF, 0x68, 0x6F, 0x87, 0xFF, 0x69, 0x71, 0x88, 0xFF, 0x6A, 0x74, 0x89, 0xFF, 0x73, 0x7B, 0x91,
+    0xFF, 0x54, 0x5D, 0x73, 0xFF, 0x75, 0x7D, 0x92, 0xFF, 0x80, 0x64, 0x6C, 0x84, 0xFF, 0x33, 0x66, 0x6E, 0x84, 0xFF, 0x68, 0x6F, 0x86, 0xFF, 0x69,
+    0x71, 0x87, 0xFF, 0x68, 0x70, 0x86, 0xFF, 0x68, 0x6F, 0x86, 0xFF, 0x6A, 0x71, 0x88, 0xFF, 0x6A, 0x72, 0x88, 0xFF, 0x6B, 0x72, 0x88, 0xFF, 0x6D,
+    0x72, 0x88, 0xFF, 0xA2, 0xA6, 0xB5, 0xFF, 0x88, 0x8C, 0x9F, 0xFF, 0x4C, 0x4D, 0x5E, 0xFF, 0x05, 0x06, 0x11, 0xFF, 0x0D, 0x10, 0x21, 0xFF, 0x0C,
+    0x0E, 0x1F, 0xFF, 0x0A, 0x0D, 0x20, 0xFF, 0x0B, 0x0E, 0x21, 0xFF, 0x0D, 0x10, 0x23, 0xFF, 0x07, 0x0A, 0x17, 0xFF, 0x4B, 0x4D, 0x54, 0xFF, 0x9D,
+    0xA0, 0xA7, 0xFF, 0x87, 0x8C, 0x9C, 0xFF, 0x6E, 0x75, 0x8B, 0xFF, 0x6D, 0x75, 0x8A, 0xFF, 0x72, 0x79, 0x8E, 0xFF, 0x70, 0x77, 0x8C, 0xFF, 0x6F,
+    0x78, 0x8B, 0xFF, 0x70, 0x78, 0x8D, 0xFF, 0x71, 0x78, 0x8C, 0xFF, 0x6F, 0x76, 0x8A, 0xFF, 0x70, 0x78, 0x8C, 0xFF, 0x73, 0x7B, 0x8F, 0xFF, 0x76,
+    0x7E, 0x91, 0xFF, 0x76, 0x7E, 0x93, 0xFF, 0x75, 0x7D, 0x91, 0xFF, 0x73, 0x7B, 0x8F, 0xFF, 0x73, 0x7C, 0x90, 0xFF, 0x73, 0x7C, 0x8F, 0xFF, 0x70,
+    0x79, 0x8D, 0xFF, 0x70, 0x77, 0x8C, 0xFF, 0x71, 0x78, 0x8D, 0xFF, 0x72, 0x78, 0x8E, 0xFF, 0x71, 0x79, 0x8D, 0xFF, 0x73, 0x7B, 0x8F, 0xFF, 0x75,
+    0x7C, 0x90, 0xFF, 0x74, 0x7B, 0x8E, 0xFF, 0x74, 0x7B, 0x8F, 0xFF, 0x76, 0x7E, 0x90, 0xFF, 0x78, 0x80, 0x92, 0xFF, 0x75, 0x7C, 0x91, 0xFF, 0x70,
+    0x79, 0x8C, 0xFF, 0x6E, 0x76, 0x8B, 0xFF, 0x80, 0x69, 0x71, 0x86, 0xFF, 0x48, 0x6D, 0x77, 0x8B, 0xFF, 0x80, 0x87, 0x97, 0xFF, 0x9D, 0xA0, 0xA9,
+    0xFF, 0x48, 0x48, 0x51, 0xFF, 0x09, 0x0B, 0x18, 0xFF, 0x0B, 0x10, 0x1F, 0xFF, 0x09, 0x0E, 0x1B, 0xFF, 0x08, 0x0C, 0x1A, 0xFF, 0x08, 0x0B, 0x18,
+    0xFF, 0x08, 0x0C, 0x18, 0xFF, 0x08, 0x0B, 0x17, 0xFF, 0x07, 0x0B, 0x17, 0xFF, 0x08, 0x0B, 0x18, 0xFF, 0x06, 0x08, 0x13, 0xFF, 0x18, 0x1B, 0x25,
+    0xFF, 0x95, 0x9B, 0xA5, 0xFF, 0x9B, 0xA0, 0xAB, 0xFF, 0x73, 0x79, 0x8E, 0xFF, 0x72, 0x79, 0x8E, 0xFF, 0x74, 0x7B, 0x90, 0xFF, 0x72, 0x79, 0x8E,
+    0xFF, 0x6D, 0x74, 0x89, 0xFF, 0x69, 0x70, 0x86, 0xFF, 0x68, 0x70, 0x86, 0xFF, 0x6A, 0x72, 0x88, 0xFF, 0x6B, 0x74, 0x88, 0xFF, 0x6C, 0x74, 0x89,
+    0xFF, 0x6A, 0x71, 0x87, 0xFF, 0x6C, 0x73, 0x89, 0xFF, 0x6D, 0x75, 0x8B, 0xFF, 0x6C, 0x75, 0x89, 0xFF, 0x6E, 0x77, 0x8C, 0xFF, 0x70, 0x78, 0x8E,
+    0xFF, 0x6E, 0x77, 0x8D, 0xFF, 0x6A, 0x72, 0x89, 0xFF, 0x67, 0x71, 0x87, 0xFF, 0x68, 0x71, 0x89, 0xFF, 0x68, 0x71, 0x87, 0xFF, 0x6A, 0x73, 0x89,
+    0xFF, 0x6A, 0x74, 0x8A, 0xFF, 0x6E, 0x77, 0x8C, 0xFF, 0x6E, 0x78, 0x8C, 0xFF, 0x6E, 0x77, 0x8B, 0xFF, 0x6D, 0x75, 0x89, 0xFF, 0x6F, 0x78, 0x8D,
+    0xFF, 0x6E, 0x77, 0x8C, 0xFF, 0x6D, 0x76, 0x8B, 0xFF, 0x6A, 0x72, 0x88, 0xFF, 0x67, 0x70, 0x86, 0xFF, 0x64, 0x6D, 0x84, 0xFF, 0x62, 0x6B, 0x82,
+    0xFF, 0x5F, 0x67, 0x7F, 0xFF, 0x60, 0x69, 0x80, 0xFF, 0x66, 0x6D, 0x84, 0xFF, 0x68, 0x6F, 0x87, 0xFF, 0x67, 0x6F, 0x87, 0xFF, 0x68, 0x71, 0x89,
+    0xFF, 0x66, 0x6F, 0x87, 0xFF, 0x5F, 0x66, 0x7D, 0xFF, 0x23, 0x27, 0x35, 0xFF, 0x0D, 0x11, 0x24, 0xFF, 0x0D, 0x12, 0x25, 0xFF, 0x35, 0x38, 0x44,
+    0xFF, 0x86, 0x89, 0x9A, 0xFF, 0x6F, 0x72, 0x86, 0xFF, 0x99, 0x9D, 0xAA, 0xFF, 0xA2, 0xA9, 0xB6, 0xFF, 0x61, 0x69, 0x7F, 0xFF, 0x5B, 0x63, 0x79,
+    0xFF, 0x59, 0x61, 0x78, 0xFF, 0x55, 0x5D, 0x74, 0xFF, 0x55, 0x5C, 0x74, 0xFF, 0x55, 0x5E, 0x73, 0xFF, 0x82, 0x54, 0x5C, 0x72, 0xFF, 0x37, 0x59,
+    0x61, 0x78, 0xFF, 0x46, 0x4E, 0x63, 0xFF, 0x11, 0x17, 0x26, 0xFF, 0x08, 0x0D, 0x1E, 0xFF, 0x0A, 0x0F, 0x20, 0xFF, 0x0B, 0x0F, 0x21, 0xFF, 0x0A,
+    0x0F, 0x20, 0xFF, 0x0B, 0x0E, 0x18, 0xFF, 0x4E, 0x51, 0x61, 0xFF, 0xAD, 0xB3, 0xC0, 0xFF, 0xAB, 0xAF, 0xBD, 0xFF, 0xBE, 0xC2, 0xCC, 0xFF, 0x8E,
+    0x91, 0x9F, 0xFF, 0x32, 0x3A, 0x52, 0xFF, 0x31, 0x3C, 0x52, 0xFF, 0x37, 0x3F, 0x54, 0xFF, 0x35, 0x3C, 0x4F, 0xFF, 0x31, 0x37, 0x4A, 0xFF, 0x2F,
+    0x35, 0x46, 0xFF, 0x2C, 0x32, 0x43, 0xFF, 0x2D, 0x31, 0x42, 0xFF, 0x2D, 0x32, 0x43, 0xFF, 0x2C, 0x31, 0x41, 0xFF, 0x2B, 0x30, 0x3F, 0xFF, 0x27,
+    0x2D, 0x3C, 0xFF, 0x23, 0x2A, 0x37, 0xFF, 0x22, 0x27, 0x36, 0xFF, 0x1F, 0x24, 0x31, 0xFF, 0x1F, 0x25, 0x32, 0xFF, 0x20, 0x25, 0x33, 0xFF, 0x20,
+    0x25, 0x32, 0xFF, 0x21, 0x26, 0x33, 0xFF, 0x1F, 0x25, 0x32, 0xFF, 0x1F, 0x25, 0x31, 0xFF, 0x1F, 0x25, 0x32, 0xFF, 0x1E, 0x23, 0x30, 0xFF, 0x1B,
+    0x20, 0x2C, 0xFF, 0x1B, 0x1F, 0x2C, 0xFF, 0x19, 0x1E, 0x29, 0xFF, 0x18, 0x1B, 0x27, 0xFF, 0x15, 0x19, 0x23, 0xFF, 0x12, 0x14, 0x1E, 0xFF, 0x10,
+    0x13, 0x1B, 0xFF, 0x14, 0x18, 0x22, 0xFF, 0x17, 0x1A, 0x25, 0xFF, 0x17, 0x1B, 0x26, 0xFF, 0x17, 0x1A, 0x24, 0xFF, 0x15, 0x17, 0x21, 0xFF, 0x13,
+    0x16, 0x1F, 0xFF, 0x11, 0x15, 0x1E, 0xFF, 0x12, 0x16, 0x1E, 0xFF, 0x12, 0x14, 0x1D, 0xFF, 0x0E, 0x10, 0x19, 0xFF, 0x0C, 0x0F, 0x15, 0xFF, 0x1D,
+    0x21, 0x27, 0xFF, 0x03, 0x04, 0x06, 0xFF, 0x80, 0x02, 0x03, 0x06, 0xFF, 0x01, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
+    0x01, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x02, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x81, 0x00, 0x01, 0x02,
+    0xFF, 0x4A, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x00, 0x02,
+    0x03, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x02, 0x02, 0x06, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x03, 0x05, 0xFF, 0x02, 0x02,
+    0x06, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x02, 0x03, 0x06, 0xFF, 0x07, 0x0A, 0x11, 0xFF, 0x17, 0x1C, 0x26, 0xFF, 0x14, 0x17,
+    0x20, 0xFF, 0x16, 0x18, 0x22, 0xFF, 0x18, 0x1A, 0x26, 0xFF, 0x18, 0x1B, 0x27, 0xFF, 0x18, 0x1C, 0x27, 0xFF, 0x17, 0x1B, 0x27, 0xFF, 0x18, 0x1B,
+    0x27, 0xFF, 0x19, 0x1C, 0x28, 0xFF, 0x1A, 0x1D, 0x29, 0xFF, 0x1A, 0x1E, 0x2B, 0xFF, 0x0F, 0x13, 0x1F, 0xFF, 0x8A, 0x8F, 0x9B, 0xFF, 0xA4, 0xA9,
+    0xB1, 0xFF, 0x37, 0x3F, 0x56, 0xFF, 0x5F, 0x64, 0x7F, 0xFF, 0x76, 0x79, 0x90, 0xFF, 0x6B, 0x6B, 0x81, 0xFF, 0x1A, 0x1B, 0x25, 0xFF, 0x07, 0x09,
+    0x10, 0xFF, 0x07, 0x09, 0x12, 0xFF, 0x20, 0x23, 0x31, 0xFF, 0x35, 0x38, 0x4C, 0xFF, 0x1F, 0x23, 0x33, 0xFF, 0x21, 0x26, 0x36, 0xFF, 0x22, 0x26,
+    0x37, 0xFF, 0x24, 0x29, 0x39, 0xFF, 0x28, 0x2B, 0x3D, 0xFF, 0x28, 0x2C, 0x3F, 0xFF, 0x28, 0x2C, 0x3E, 0xFF, 0x27, 0x2B, 0x3D, 0xFF, 0x2B, 0x31,
+    0x43, 0xFF, 0x2E, 0x33, 0x46, 0xFF, 0x2D, 0x32, 0x44, 0xFF, 0x64, 0x6C, 0x80, 0xFF, 0x82, 0x8A, 0x9C, 0xFF, 0x28, 0x30, 0x41, 0xFF, 0x52, 0x5D,
+    0x75, 0xFF, 0x3C, 0x40, 0x57, 0xFF, 0x37, 0x3C, 0x52, 0xFF, 0x39, 0x40, 0x57, 0xFF, 0x3D, 0x45, 0x59, 0xFF, 0x3F, 0x47, 0x5B, 0xFF, 0x3D, 0x46,
+    0x5A, 0xFF, 0x3B, 0x44, 0x58, 0xFF, 0x40, 0x48, 0x5C, 0xFF, 0x45, 0x4C, 0x63, 0xFF, 0x47, 0x4F, 0x67, 0xFF, 0x5E, 0x64, 0x77, 0xFF, 0xC7, 0xCA,
+    0xD1, 0xFF, 0xB9, 0xBB, 0xC3, 0xFF, 0xB1, 0xB5, 0xBF, 0xFF, 0x62, 0x66, 0x76, 0xFF, 0x07, 0x0A, 0x14, 0xFF, 0x07, 0x0A, 0x16, 0xFF, 0x07, 0x0A,
+    0x18, 0xFF, 0x07, 0x09, 0x19, 0xFF, 0x07, 0x0A, 0x19, 0xFF, 0x08, 0x0B, 0x1B, 0xFF, 0x80, 0x08, 0x0B, 0x1C, 0xFF, 0x11, 0x08, 0x0B, 0x1B, 0xFF,
+    0x16, 0x18, 0x23, 0xFF, 0x4F, 0x55, 0x64, 0xFF, 0x60, 0x66, 0x7A, 0xFF, 0x54, 0x5B, 0x74, 0xFF, 0x58, 0x5F, 0x77, 0xFF, 0x59, 0x61, 0x79, 0xFF,
+    0x59, 0x61, 0x78, 0xFF, 0x5A, 0x61, 0x79, 0xFF, 0x5C, 0x64, 0x7B, 0xFF, 0x5F, 0x66, 0x7D, 0xFF, 0x61, 0x69, 0x7F, 0xFF, 0x64, 0x6B, 0x82, 0xFF,
+    0x65, 0x6D, 0x83, 0xFF, 0x7D, 0x83, 0x99, 0xFF, 0x42, 0x4A, 0x61, 0xFF, 0x60, 0x68, 0x7E, 0xFF, 0x73, 0x79, 0x8E, 0xFF, 0x80, 0x62, 0x6A, 0x81,
+    0xFF, 0x80, 0x60, 0x67, 0x7E, 0xFF, 0x24, 0x63, 0x6A, 0x81, 0xFF, 0x5F, 0x68, 0x7F, 0xFF, 0x60, 0x68, 0x7F, 0xFF, 0x65, 0x6C, 0x84, 0xFF, 0x69,
+    0x70, 0x87, 0xFF, 0x6A, 0x71, 0x87, 0xFF, 0x6D, 0x73, 0x87, 0xFF, 0xA2, 0xA6, 0xB5, 0xFF, 0x8A, 0x8E, 0x9F, 0xFF, 0x4C, 0x4F, 0x5F, 0xFF, 0x05,
+    0x06, 0x11, 0xFF, 0x0D, 0x10, 0x20, 0xFF, 0x0B, 0x0D, 0x1E, 0xFF, 0x0B, 0x0E, 0x1F, 0xFF, 0x0C, 0x0E, 0x20, 0xFF, 0x09, 0x0D, 0x1A, 0xFF, 0x20,
+    0x21, 0x26, 0xFF, 0x93, 0x99, 0x9F, 0xFF, 0x90, 0x95, 0xA4, 0xFF, 0x6C, 0x72, 0x8A, 0xFF, 0x6D, 0x74, 0x8B, 0xFF, 0x6F, 0x75, 0x8B, 0xFF, 0x6E,
+    0x75, 0x8A, 0xFF, 0x6D, 0x75, 0x8A, 0xFF, 0x6C, 0x75, 0x89, 0xFF, 0x6F, 0x76, 0x8B, 0xFF, 0x6F, 0x76, 0x8A, 0xFF, 0x6D, 0x74, 0x88, 0xFF, 0x6E,
+    0x75, 0x89, 0xFF, 0x73, 0x7A, 0x8E, 0xFF, 0x75, 0x7C, 0x8F, 0xFF, 0x74, 0x7C, 0x90, 0xFF, 0x73, 0x7B, 0x90, 0xFF, 0x6F, 0x76, 0x8B, 0xFF, 0x6B,
+    0x73, 0x88, 0xFF, 0x68, 0x70, 0x87, 0xFF, 0x6A, 0x70, 0x87, 0xFF, 0x80, 0x6A, 0x71, 0x87, 0xFF, 0x36, 0x68, 0x70, 0x85, 0xFF, 0x6E, 0x74, 0x89,
+    0xFF, 0x74, 0x7A, 0x8F, 0xFF, 0x73, 0x7A, 0x8C, 0xFF, 0x73, 0x7A, 0x8D, 0xFF, 0x73, 0x7B, 0x8E, 0xFF, 0x72, 0x7A, 0x8D, 0xFF, 0x72, 0x79, 0x8D,
+    0xFF, 0x70, 0x78, 0x8C, 0xFF, 0x6A, 0x73, 0x87, 0xFF, 0x68, 0x70, 0x85, 0xFF, 0x68, 0x70, 0x84, 0xFF, 0x69, 0x70, 0x85, 0xFF, 0x6B, 0x74, 0x87,
+    0xFF, 0x6B, 0x76, 0x8A, 0xFF, 0x90, 0x99, 0xA6, 0xFF, 0x99, 0x9D, 0xA3, 0xFF, 0x20, 0x22, 0x28, 0xFF, 0x08, 0x0D, 0x19, 0xFF, 0x0A, 0x0E, 0x1C,
+    0xFF, 0x09, 0x0D, 0x1A, 0xFF, 0x08, 0x0C, 0x19, 0xFF, 0x09, 0x0C, 0x19, 0xFF, 0x09, 0x0B, 0x19, 0xFF, 0x09, 0x0C, 0x19, 0xFF, 0x07, 0x0A, 0x15,
+    0xFF, 0x11, 0x14, 0x1B, 0xFF, 0x81, 0x85, 0x90, 0xFF, 0xA9, 0xAE, 0xB7, 0xFF, 0x6E, 0x74, 0x89, 0xFF, 0x6E, 0x75, 0x8A, 0xFF, 0x6F, 0x76, 0x8C,
+    0xFF, 0x6D, 0x75, 0x8A, 0xFF, 0x6D, 0x74, 0x89, 0xFF, 0x6A, 0x71, 0x86, 0xFF, 0x67, 0x6E, 0x84, 0xFF, 0x65, 0x6E, 0x83, 0xFF, 0x66, 0x6E, 0x84,
+    0xFF, 0x68, 0x70, 0x86, 0xFF, 0x69, 0x71, 0x86, 0xFF, 0x67, 0x6F, 0x85, 0xFF, 0x67, 0x6F, 0x84, 0xFF, 0x68, 0x70, 0x86, 0xFF, 0x67, 0x6F, 0x84,
+    0xFF, 0x68, 0x71, 0x86, 0xFF, 0x6B, 0x74, 0x89, 0xFF, 0x6A, 0x73, 0x89, 0xFF, 0x67, 0x6F, 0x86, 0xFF, 0x65, 0x6E, 0x85, 0xFF, 0x66, 0x6F, 0x86,
+    0xFF, 0x66, 0x6E, 0x86, 0xFF, 0x64, 0x6E, 0x83, 0xFF, 0x65, 0x6F, 0x84, 0xFF, 0x67, 0x70, 0x86, 0xFF, 0x68, 0x70, 0x87, 0xFF, 0x81, 0x67, 0x70,
+    0x85, 0xFF, 0x59, 0x68, 0x70, 0x86, 0xFF, 0x67, 0x70, 0x86, 0xFF, 0x65, 0x6D, 0x83, 0xFF, 0x64, 0x6C, 0x82, 0xFF, 0x5F, 0x68, 0x7F, 0xFF, 0x5E,
+    0x66, 0x7E, 0xFF, 0x5C, 0x64, 0x7C, 0xFF, 0x5C, 0x64, 0x7B, 0xFF, 0x5C, 0x64, 0x7C, 0xFF, 0x5E, 0x66, 0x7D, 0xFF, 0x60, 0x69, 0x81, 0xFF, 0x64,
+    0x6D, 0x84, 0xFF, 0x62, 0x6C, 0x83, 0xFF, 0x5B, 0x62, 0x79, 0xFF, 0x22, 0x26, 0x33, 0xFF, 0x0D, 0x10, 0x21, 0xFF, 0x0D, 0x12, 0x23, 0xFF, 0x34,
+    0x36, 0x43, 0xFF, 0x84, 0x88, 0x98, 0xFF, 0x6D, 0x72, 0x84, 0xFF, 0x96, 0x9B, 0xA9, 0xFF, 0xA0, 0xA6, 0xB4, 0xFF, 0x5D, 0x64, 0x7A, 0xFF, 0x57,
+    0x60, 0x76, 0xFF, 0x58, 0x60, 0x76, 0xFF, 0x55, 0x5C, 0x73, 0xFF, 0x54, 0x5C, 0x72, 0xFF, 0x52, 0x5B, 0x71, 0xFF, 0x52, 0x59, 0x70, 0xFF, 0x53,
+    0x5A, 0x71, 0xFF, 0x53, 0x5B, 0x71, 0xFF, 0x51, 0x59, 0x6F, 0xFF, 0x57, 0x5E, 0x75, 0xFF, 0x46, 0x4E, 0x63, 0xFF, 0x12, 0x17, 0x27, 0xFF, 0x09,
+    0x0D, 0x1E, 0xFF, 0x0B, 0x11, 0x22, 0xFF, 0x0C, 0x11, 0x23, 0xFF, 0x07, 0x0B, 0x15, 0xFF, 0x2F, 0x33, 0x3F, 0xFF, 0xA6, 0xAC, 0xBA, 0xFF, 0xB0,
+    0xB3, 0xC0, 0xFF, 0xB4, 0xB6, 0xC3, 0xFF, 0xA2, 0xA7, 0xB5, 0xFF, 0x37, 0x3F, 0x55, 0xFF, 0x28, 0x31, 0x44, 0xFF, 0x31, 0x3A, 0x4F, 0xFF, 0x32,
+    0x38, 0x4D, 0xFF, 0x31, 0x37, 0x48, 0xFF, 0x2E, 0x34, 0x45, 0xFF, 0x2C, 0x32, 0x43, 0xFF, 0x2B, 0x31, 0x42, 0xFF, 0x2C, 0x31, 0x41, 0xFF, 0x2B,
+    0x31, 0x42, 0xFF, 0x28, 0x2F, 0x3F, 0xFF, 0x27, 0x2D, 0x3C, 0xFF, 0x24, 0x2A, 0x38, 0xFF, 0x23, 0x28, 0x38, 0xFF, 0x22, 0x28, 0x35, 0xFF, 0x20,
+    0x25, 0x33, 0xFF, 0x1E, 0x23, 0x31, 0xFF, 0x1D, 0x22, 0x30, 0xFF, 0x1B, 0x21, 0x2E, 0xFF, 0x1B, 0x20, 0x2D, 0xFF, 0x1C, 0x21, 0x2D, 0xFF, 0x1C,
+    0x21, 0x2E, 0xFF, 0x1E, 0x23, 0x30, 0xFF, 0x1B, 0x21, 0x2E, 0xFF, 0x19, 0x1E, 0x2B, 0xFF, 0x19, 0x1E, 0x29, 0xFF, 0x19, 0x1D, 0x28, 0xFF, 0x16,
+    0x19, 0x23, 0xFF, 0x15, 0x19, 0x23, 0xFF, 0x15, 0x18, 0x22, 0xFF, 0x16, 0x19, 0x23, 0xFF, 0x15, 0x19, 0x24, 0xFF, 0x18, 0x1B, 0x26, 0xFF, 0x17,
+    0x1B, 0x24, 0xFF, 0x15, 0x19, 0x22, 0xFF, 0x15, 0x18, 0x21, 0xFF, 0x13, 0x17, 0x20, 0xFF, 0x11, 0x14, 0x1D, 0xFF, 0x10, 0x13, 0x1B, 0xFF, 0x0F,
+    0x12, 0x1A, 0xFF, 0x0E, 0x11, 0x19, 0xFF, 0x0D, 0x10, 0x16, 0xFF, 0x1C, 0x21, 0x26, 0xFF, 0x02, 0x04, 0x06, 0xFF, 0x02, 0x03, 0x05, 0xFF, 0x02,
+    0x03, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x02, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x82, 0x00, 0x00,
+    0x00, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x81, 0x00, 0x01, 0x02, 0xFF, 0x01, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x80, 0x01, 0x01,
+    0x04, 0xFF, 0x81, 0x01, 0x02, 0x04, 0xFF, 0x0D, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x02, 0x02, 0x07, 0xFF,
+    0x01, 0x03, 0x06, 0xFF, 0x02, 0x03, 0x07, 0xFF, 0x03, 0x04, 0x09, 0xFF, 0x02, 0x03, 0x06, 0xFF, 0x06, 0x0A, 0x0F, 0xFF, 0x16, 0x1B, 0x24, 0xFF,
+    0x13, 0x16, 0x20, 0xFF, 0x16, 0x18, 0x23, 0xFF, 0x17, 0x1A, 0x25, 0xFF, 0x17, 0x1B, 0x27, 0xFF, 0x80, 0x17, 0x1B, 0x26, 0xFF, 0x00, 0x18, 0x1B,
+    0x26, 0xFF, 0x80, 0x19, 0x1C, 0x28, 0xFF, 0x20, 0x19, 0x1C, 0x29, 0xFF, 0x0D, 0x12, 0x1F, 0xFF, 0x88, 0x8E, 0x99, 0xFF, 0xA4, 0xA8, 0xB0, 0xFF,
+    0x35, 0x3E, 0x54, 0xFF, 0x5D, 0x62, 0x7E, 0xFF, 0x76, 0x77, 0x90, 0xFF, 0x6A, 0x6A, 0x80, 0xFF, 0x1A, 0x1B, 0x24, 0xFF, 0x08, 0x09, 0x10, 0xFF,
+    0x06, 0x08, 0x11, 0xFF, 0x1E, 0x22, 0x2F, 0xFF, 0x32, 0x36, 0x4A, 0xFF, 0x1F, 0x23, 0x32, 0xFF, 0x23, 0x27, 0x38, 0xFF, 0x23, 0x27, 0x37, 0xFF,
+    0x22, 0x26, 0x38, 0xFF, 0x27, 0x2A, 0x3C, 0xFF, 0x29, 0x2D, 0x3E, 0xFF, 0x26, 0x2A, 0x3C, 0xFF, 0x25, 0x2A, 0x3B, 0xFF, 0x2C, 0x31, 0x43, 0xFF,
+    0x2E, 0x33, 0x47, 0xFF, 0x2C, 0x32, 0x44, 0xFF, 0x62, 0x69, 0x7D, 0xFF, 0x81, 0x89, 0x9C, 0xFF, 0x1F, 0x26, 0x38, 0xFF, 0x57, 0x60, 0x79, 0xFF,
+    0x44, 0x4A, 0x5F, 0xFF, 0x38, 0x3D, 0x51, 0xFF, 0x3A, 0x41, 0x56, 0xFF, 0x3A, 0x41, 0x55, 0xFF, 0x3B, 0x43, 0x56, 0xFF, 0x80, 0x39, 0x41, 0x55,
+    0xFF, 0x0B, 0x3D, 0x44, 0x57, 0xFF, 0x40, 0x48, 0x5C, 0xFF, 0x45, 0x4D, 0x65, 0xFF, 0x3D, 0x46, 0x5B, 0xFF, 0x8A, 0x8E, 0x9A, 0xFF, 0xCA, 0xCC,
+    0xD3, 0xFF, 0xA6, 0xAA, 0xB5, 0xFF, 0x9A, 0x9F, 0xAC, 0xFF, 0x25, 0x28, 0x31, 0xFF, 0x05, 0x08, 0x13, 0xFF, 0x08, 0x0B, 0x1A, 0xFF, 0x08, 0x0A,
+    0x1A, 0xFF, 0x80, 0x08, 0x0B, 0x1B, 0xFF, 0x23, 0x09, 0x0C, 0x1E, 0xFF, 0x0A, 0x0C, 0x1F, 0xFF, 0x08, 0x0B, 0x1A, 0xFF, 0x2D, 0x2F, 0x3C, 0xFF,
+    0x6E, 0x73, 0x86, 0xFF, 0x50, 0x58, 0x6D, 0xFF, 0x54, 0x5A, 0x74, 0xFF, 0x56, 0x5C, 0x75, 0xFF, 0x54, 0x5C, 0x74, 0xFF, 0x53, 0x5B, 0x73, 0xFF,
+    0x55, 0x5B, 0x73, 0xFF, 0x55, 0x5B, 0x75, 0xFF, 0x58, 0x60, 0x77, 0xFF, 0x5E, 0x65, 0x7C, 0xFF, 0x61, 0x68, 0x80, 0xFF, 0x62, 0x6B, 0x81, 0xFF,
+    0x7B, 0x80, 0x95, 0xFF, 0x31, 0x38, 0x4D, 0xFF, 0x69, 0x71, 0x87, 0xFF, 0x71, 0x78, 0x8C, 0xFF, 0x5F, 0x68, 0x7E, 0xFF, 0x62, 0x68, 0x7F, 0xFF,
+    0x5D, 0x64, 0x7B, 0xFF, 0x58, 0x61, 0x77, 0xFF, 0x5D, 0x64, 0x7C, 0xFF, 0x5A, 0x62, 0x7A, 0xFF, 0x59, 0x61, 0x79, 0xFF, 0x5D, 0x65, 0x7C, 0xFF,
+    0x63, 0x6B, 0x81, 0xFF, 0x66, 0x6E, 0x84, 0xFF, 0x6B, 0x72, 0x86, 0xFF, 0xA0, 0xA5, 0xB3, 0xFF, 0x8A, 0x8E, 0xA0, 0xFF, 0x4D, 0x4F, 0x5F, 0xFF,
+    0x05, 0x06, 0x11, 0xFF, 0x0C, 0x0F, 0x20, 0xFF, 0x80, 0x0B, 0x0D, 0x1D, 0xFF, 0x21, 0x08, 0x0B, 0x19, 0xFF, 0x1A, 0x1D, 0x23, 0xFF, 0x79, 0x7B,
+    0x83, 0xFF, 0x96, 0x9A, 0xA4, 0xFF, 0x6C, 0x72, 0x89, 0xFF, 0x6D, 0x74, 0x8A, 0xFF, 0x6C, 0x73, 0x89, 0xFF, 0x6D, 0x73, 0x89, 0xFF, 0x6B, 0x72,
+    0x88, 0xFF, 0x6A, 0x72, 0x86, 0xFF, 0x69, 0x71, 0x86, 0xFF, 0x6A, 0x72, 0x86, 0xFF, 0x6A, 0x72, 0x87, 0xFF, 0x6B, 0x73, 0x88, 0xFF, 0x6E, 0x75,
+    0x88, 0xFF, 0x70, 0x77, 0x8B, 0xFF, 0x71, 0x78, 0x8D, 0xFF, 0x67, 0x70, 0x84, 0xFF, 0x6D, 0x74, 0x89, 0xFF, 0x73, 0x79, 0x8E, 0xFF, 0x67, 0x6E,
+    0x84, 0xFF, 0x60, 0x68, 0x7F, 0xFF, 0x63, 0x6A, 0x81, 0xFF, 0x63, 0x6B, 0x81, 0xFF, 0x64, 0x6C, 0x82, 0xFF, 0x69, 0x6F, 0x85, 0xFF, 0x6D, 0x74,
+    0x89, 0xFF, 0x6A, 0x72, 0x85, 0xFF, 0x70, 0x77, 0x8B, 0xFF, 0x72, 0x7A, 0x8E, 0xFF, 0x73, 0x7A, 0x8E, 0xFF, 0x6F, 0x77, 0x8B, 0xFF, 0x6C, 0x75,
+    0x89, 0xFF, 0x6B, 0x73, 0x88, 0xFF, 0x80, 0x67, 0x6F, 0x84, 0xFF, 0x08, 0x69, 0x72, 0x87, 0xFF, 0x6A, 0x72, 0x87, 0xFF, 0x6A, 0x73, 0x87, 0xFF,
+    0x6A, 0x75, 0x88, 0xFF, 0x6E, 0x78, 0x8C, 0xFF, 0x9A, 0x9E, 0xA7, 0xFF, 0x6B, 0x6F, 0x77, 0xFF, 0x0D, 0x10, 0x1A, 0xFF, 0x09, 0x0E, 0x1A, 0xFF,
+    0x80, 0x0A, 0x0E, 0x1B, 0xFF, 0x00, 0x0A, 0x0E, 0x1A, 0xFF, 0x80, 0x0A, 0x0E, 0x1C, 0xFF, 0x04, 0x04, 0x06, 0x0F, 0xFF, 0x52, 0x54, 0x5E, 0xFF,
+    0xAB, 0xAF, 0xBA, 0xFF, 0x73, 0x7A, 0x8D, 0xFF, 0x69, 0x70, 0x86, 0xFF, 0x80, 0x6A, 0x71, 0x87, 0xFF, 0x80, 0x69, 0x70, 0x85, 0xFF, 0x1F, 0x68,
+    0x6F, 0x83, 0xFF, 0x64, 0x6B, 0x81, 0xFF, 0x62, 0x69, 0x7E, 0xFF, 0x61, 0x69, 0x7E, 0xFF, 0x61, 0x6A, 0x80, 0xFF, 0x63, 0x6B, 0x80, 0xFF, 0x65,
+    0x6D, 0x82, 0xFF, 0x67, 0x6F, 0x84, 0xFF, 0x65, 0x6D, 0x83, 0xFF, 0x61, 0x6A, 0x7F, 0xFF, 0x60, 0x69, 0x7F, 0xFF, 0x5F, 0x68, 0x7E, 0xFF, 0x5D,
+    0x65, 0x7D, 0xFF, 0x5A, 0x61, 0x7A, 0xFF, 0x56, 0x5E, 0x75, 0xFF, 0x54, 0x5D, 0x73, 0xFF, 0x5A, 0x62, 0x7A, 0xFF, 0x5F, 0x67, 0x7D, 0xFF, 0x63,
+    0x6D, 0x83, 0xFF, 0x65, 0x6E, 0x85, 0xFF, 0x64, 0x6D, 0x84, 0xFF, 0x63, 0x6B, 0x83, 0xFF, 0x5E, 0x68, 0x7E, 0xFF, 0x5F, 0x67, 0x7E, 0xFF, 0x5E,
+    0x67, 0x7D, 0xFF, 0x60, 0x69, 0x7E, 0xFF, 0x60, 0x68, 0x7F, 0xFF, 0x60, 0x68, 0x80, 0xFF, 0x5E, 0x66, 0x7D, 0xFF, 0x5C, 0x65, 0x7C, 0xFF, 0x5C,
+    0x64, 0x7B, 0xFF, 0x59, 0x61, 0x78, 0xFF, 0x80, 0x59, 0x61, 0x79, 0xFF, 0x29, 0x5C, 0x65, 0x7D, 0xFF, 0x61, 0x69, 0x81, 0xFF, 0x5F, 0x68, 0x7F,
+    0xFF, 0x59, 0x60, 0x77, 0xFF, 0x20, 0x24, 0x31, 0xFF, 0x0B, 0x0E, 0x1E, 0xFF, 0x0C, 0x10, 0x20, 0xFF, 0x32, 0x34, 0x40, 0xFF, 0x80, 0x83, 0x94,
+    0xFF, 0x6B, 0x70, 0x83, 0xFF, 0x94, 0x9B, 0xA8, 0xFF, 0x9F, 0xA5, 0xB3, 0xFF, 0x5C, 0x62, 0x79, 0xFF, 0x55, 0x5D, 0x74, 0xFF, 0x56, 0x5E, 0x74,
+    0xFF, 0x52, 0x5B, 0x71, 0xFF, 0x51, 0x59, 0x70, 0xFF, 0x50, 0x58, 0x6E, 0xFF, 0x4F, 0x57, 0x6D, 0xFF, 0x50, 0x58, 0x6E, 0xFF, 0x51, 0x58, 0x6E,
+    0xFF, 0x50, 0x57, 0x6E, 0xFF, 0x56, 0x5D, 0x74, 0xFF, 0x46, 0x4D, 0x62, 0xFF, 0x12, 0x19, 0x29, 0xFF, 0x09, 0x0E, 0x1E, 0xFF, 0x0C, 0x11, 0x23,
+    0xFF, 0x09, 0x0E, 0x1E, 0xFF, 0x1B, 0x1E, 0x26, 0xFF, 0x7F, 0x84, 0x93, 0xFF, 0xB4, 0xB8, 0xC6, 0xFF, 0xAA, 0xAC, 0xB9, 0xFF, 0xBD, 0xC1, 0xCD,
+    0xFF, 0x54, 0x5A, 0x6F, 0xFF, 0x24, 0x2D, 0x40, 0xFF, 0x2D, 0x35, 0x48, 0xFF, 0x2E, 0x35, 0x48, 0xFF, 0x2D, 0x33, 0x47, 0xFF, 0x2C, 0x32, 0x43,
+    0xFF, 0x2A, 0x30, 0x40, 0xFF, 0x29, 0x2F, 0x3E, 0xFF, 0x28, 0x2E, 0x3E, 0xFF, 0x80, 0x28, 0x2E, 0x3D, 0xFF, 0x23, 0x26, 0x2C, 0x3C, 0xFF, 0x26,
+    0x2B, 0x3B, 0xFF, 0x22, 0x28, 0x36, 0xFF, 0x22, 0x27, 0x37, 0xFF, 0x22, 0x27, 0x36, 0xFF, 0x1C, 0x21, 0x2E, 0xFF, 0x16, 0x1C, 0x29, 0xFF, 0x15,
+    0x19, 0x25, 0xFF, 0x14, 0x18, 0x24, 0xFF, 0x13, 0x17, 0x23, 0xFF, 0x12, 0x17, 0x21, 0xFF, 0x14, 0x1A, 0x24, 0xFF, 0x19, 0x1E, 0x2B, 0xFF, 0x17,
+    0x1E, 0x2A, 0xFF, 0x18, 0x1F, 0x2A, 0xFF, 0x18, 0x1E, 0x2A, 0xFF, 0x18, 0x1C, 0x28, 0xFF, 0x17, 0x1B, 0x26, 0xFF, 0x15, 0x1A, 0x23, 0xFF, 0x16,
+    0x1A, 0x23, 0xFF, 0x13, 0x19, 0x21, 0xFF, 0x14, 0x17, 0x22, 0xFF, 0x15, 0x18, 0x23, 0xFF, 0x15, 0x18, 0x21, 0xFF, 0x12, 0x16, 0x1E, 0xFF, 0x13,
+    0x17, 0x1F, 0xFF, 0x13, 0x18, 0x20, 0xFF, 0x13, 0x17, 0x1E, 0xFF, 0x11, 0x15, 0x1D, 0xFF, 0x0F, 0x14, 0x1B, 0xFF, 0x10, 0x14, 0x1B, 0xFF, 0x0E,
+    0x11, 0x17, 0xFF, 0x1C, 0x22, 0x26, 0xFF, 0x02, 0x04, 0x06, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x02, 0x04, 0x06, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x01, 0x02, 0xFF, 0x13, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x05,
+    0xFF, 0x00, 0x02, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05,
+    0xFF, 0x02, 0x02, 0x06, 0xFF, 0x01, 0x03, 0x05, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x02, 0x03, 0x07, 0xFF, 0x02, 0x04, 0x07, 0xFF, 0x02, 0x04, 0x08,
+    0xFF, 0x01, 0x03, 0x06, 0xFF, 0x06, 0x09, 0x0F, 0xFF, 0x16, 0x1B, 0x24, 0xFF, 0x12, 0x15, 0x1F, 0xFF, 0x13, 0x17, 0x20, 0xFF, 0x14, 0x18, 0x22,
+    0xFF, 0x80, 0x16, 0x19, 0x24, 0xFF, 0x4B, 0x17, 0x1A, 0x24, 0xFF, 0x16, 0x19, 0x25, 0xFF, 0x17, 0x1B, 0x28, 0xFF, 0x18, 0x1B, 0x29, 0xFF, 0x17,
+    0x1B, 0x28, 0xFF, 0x0C, 0x10, 0x1E, 0xFF, 0x86, 0x8B, 0x97, 0xFF, 0xA1, 0xA5, 0xAD, 0xFF, 0x33, 0x3A, 0x50, 0xFF, 0x5A, 0x5F, 0x7B, 0xFF, 0x73,
+    0x76, 0x90, 0xFF, 0x69, 0x69, 0x80, 0xFF, 0x1A, 0x1B, 0x24, 0xFF, 0x07, 0x09, 0x11, 0xFF, 0x06, 0x08, 0x10, 0xFF, 0x1D, 0x21, 0x2D, 0xFF, 0x30,
+    0x35, 0x49, 0xFF, 0x20, 0x23, 0x33, 0xFF, 0x25, 0x29, 0x3A, 0xFF, 0x24, 0x29, 0x3A, 0xFF, 0x23, 0x27, 0x37, 0xFF, 0x25, 0x29, 0x39, 0xFF, 0x24,
+    0x29, 0x3A, 0xFF, 0x23, 0x27, 0x38, 0xFF, 0x24, 0x29, 0x3A, 0xFF, 0x29, 0x2E, 0x40, 0xFF, 0x2C, 0x31, 0x43, 0xFF, 0x2B, 0x31, 0x43, 0xFF, 0x61,
+    0x69, 0x7E, 0xFF, 0x84, 0x8B, 0xA0, 0xFF, 0x1C, 0x23, 0x34, 0xFF, 0x57, 0x61, 0x78, 0xFF, 0x4E, 0x57, 0x6C, 0xFF, 0x36, 0x3A, 0x50, 0xFF, 0x38,
+    0x3F, 0x53, 0xFF, 0x34, 0x3C, 0x50, 0xFF, 0x33, 0x3B, 0x4E, 0xFF, 0x33, 0x3B, 0x4F, 0xFF, 0x35, 0x3D, 0x51, 0xFF, 0x39, 0x40, 0x54, 0xFF, 0x3D,
+    0x45, 0x58, 0xFF, 0x40, 0x48, 0x5E, 0xFF, 0x36, 0x3E, 0x54, 0xFF, 0x63, 0x69, 0x78, 0xFF, 0xCD, 0xCF, 0xD7, 0xFF, 0xAD, 0xAF, 0xB9, 0xFF, 0xA5,
+    0xAA, 0xB6, 0xFF, 0x3C, 0x3F, 0x49, 0xFF, 0x04, 0x04, 0x0D, 0xFF, 0x09, 0x0B, 0x1A, 0xFF, 0x08, 0x0C, 0x1B, 0xFF, 0x08, 0x0C, 0x1C, 0xFF, 0x09,
+    0x0C, 0x1D, 0xFF, 0x0A, 0x0D, 0x1F, 0xFF, 0x0B, 0x0D, 0x20, 0xFF, 0x0C, 0x0E, 0x1C, 0xFF, 0x3E, 0x43, 0x4F, 0xFF, 0x6B, 0x6F, 0x83, 0xFF, 0x4F,
+    0x55, 0x6D, 0xFF, 0x51, 0x58, 0x71, 0xFF, 0x53, 0x5A, 0x72, 0xFF, 0x52, 0x5A, 0x71, 0xFF, 0x50, 0x58, 0x71, 0xFF, 0x51, 0x58, 0x70, 0xFF, 0x52,
+    0x58, 0x70, 0xFF, 0x53, 0x5C, 0x72, 0xFF, 0x59, 0x60, 0x78, 0xFF, 0x5C, 0x65, 0x7B, 0xFF, 0x70, 0x78, 0x8D, 0xFF, 0x53, 0x5B, 0x71, 0xFF, 0x36,
+    0x3D, 0x54, 0xFF, 0x6F, 0x76, 0x8B, 0xFF, 0x74, 0x7A, 0x8C, 0xFF, 0x5F, 0x67, 0x7C, 0xFF, 0x5F, 0x66, 0x7D, 0xFF, 0x5B, 0x62, 0x7A, 0xFF, 0x80,
+    0x56, 0x5E, 0x74, 0xFF, 0x13, 0x55, 0x5C, 0x75, 0xFF, 0x53, 0x5B, 0x74, 0xFF, 0x56, 0x5E, 0x76, 0xFF, 0x5D, 0x65, 0x7C, 0xFF, 0x61, 0x68, 0x7F,
+    0xFF, 0x67, 0x6D, 0x83, 0xFF, 0x9F, 0xA3, 0xB2, 0xFF, 0x89, 0x8E, 0xA0, 0xFF, 0x4B, 0x4E, 0x5E, 0xFF, 0x05, 0x07, 0x12, 0xFF, 0x0C, 0x0F, 0x20,
+    0xFF, 0x0A, 0x0D, 0x1D, 0xFF, 0x0A, 0x0C, 0x1B, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x4E, 0x50, 0x56, 0xFF, 0x96, 0x9B, 0xA5, 0xFF, 0x6D, 0x72, 0x86,
+    0xFF, 0x65, 0x6D, 0x84, 0xFF, 0x67, 0x6F, 0x85, 0xFF, 0x64, 0x6C, 0x82, 0xFF, 0x80, 0x65, 0x6D, 0x82, 0xFF, 0x1B, 0x66, 0x6D, 0x82, 0xFF, 0x66,
+    0x6E, 0x82, 0xFF, 0x68, 0x70, 0x85, 0xFF, 0x67, 0x6F, 0x85, 0xFF, 0x68, 0x6F, 0x84, 0xFF, 0x69, 0x70, 0x84, 0xFF, 0x65, 0x6B, 0x80, 0xFF, 0x69,
+    0x70, 0x83, 0xFF, 0x74, 0x7A, 0x8E, 0xFF, 0x67, 0x6D, 0x82, 0xFF, 0x61, 0x68, 0x7C, 0xFF, 0x57, 0x5D, 0x73, 0xFF, 0x4F, 0x56, 0x6B, 0xFF, 0x4D,
+    0x54, 0x6A, 0xFF, 0x4F, 0x56, 0x6B, 0xFF, 0x54, 0x5A, 0x70, 0xFF, 0x5F, 0x64, 0x7B, 0xFF, 0x66, 0x6C, 0x7F, 0xFF, 0x6A, 0x71, 0x85, 0xFF, 0x70,
+    0x76, 0x8D, 0xFF, 0x66, 0x6E, 0x83, 0xFF, 0x6C, 0x74, 0x89, 0xFF, 0x6C, 0x75, 0x8A, 0xFF, 0x6A, 0x72, 0x87, 0xFF, 0x67, 0x6F, 0x85, 0xFF, 0x66,
+    0x6F, 0x84, 0xFF, 0x66, 0x70, 0x84, 0xFF, 0x66, 0x6F, 0x84, 0xFF, 0x80, 0x65, 0x6E, 0x83, 0xFF, 0x1E, 0x68, 0x71, 0x86, 0xFF, 0x67, 0x6F, 0x84,
+    0xFF, 0x76, 0x7F, 0x8F, 0xFF, 0xA2, 0xA8, 0xAF, 0xFF, 0x32, 0x34, 0x3D, 0xFF, 0x06, 0x09, 0x15, 0xFF, 0x09, 0x0D, 0x1B, 0xFF, 0x0A, 0x0F, 0x1D,
+    0xFF, 0x0B, 0x10, 0x1E, 0xFF, 0x0C, 0x11, 0x1F, 0xFF, 0x09, 0x0D, 0x18, 0xFF, 0x33, 0x37, 0x3E, 0xFF, 0x8B, 0x8F, 0x9B, 0xFF, 0x8D, 0x90, 0xA0,
+    0xFF, 0x64, 0x6C, 0x82, 0xFF, 0x64, 0x6D, 0x83, 0xFF, 0x63, 0x6A, 0x81, 0xFF, 0x64, 0x6B, 0x81, 0xFF, 0x67, 0x6E, 0x84, 0xFF, 0x68, 0x6E, 0x84,
+    0xFF, 0x66, 0x6D, 0x82, 0xFF, 0x63, 0x6A, 0x7F, 0xFF, 0x5D, 0x65, 0x7A, 0xFF, 0x5C, 0x62, 0x78, 0xFF, 0x5D, 0x65, 0x7B, 0xFF, 0x5F, 0x67, 0x7D,
+    0xFF, 0x62, 0x69, 0x7E, 0xFF, 0x62, 0x69, 0x7F, 0xFF, 0x59, 0x62, 0x76, 0xFF, 0x55, 0x5D, 0x72, 0xFF, 0x57, 0x5E, 0x74, 0xFF, 0x80, 0x54, 0x5B,
+    0x72, 0xFF, 0x12, 0x52, 0x5B, 0x72, 0xFF, 0x4F, 0x58, 0x6F, 0xFF, 0x52, 0x59, 0x71, 0xFF, 0x52, 0x5A, 0x71, 0xFF, 0x59, 0x62, 0x79, 0xFF, 0x5A,
+    0x62, 0x7A, 0xFF, 0x5B, 0x64, 0x79, 0xFF, 0x5F, 0x67, 0x80, 0xFF, 0x5B, 0x64, 0x7B, 0xFF, 0x59, 0x62, 0x79, 0xFF, 0x59, 0x61, 0x79, 0xFF, 0x54,
+    0x5E, 0x74, 0xFF, 0x56, 0x5E, 0x75, 0xFF, 0x59, 0x61, 0x77, 0xFF, 0x5B, 0x64, 0x7B, 0xFF, 0x5A, 0x62, 0x7A, 0xFF, 0x59, 0x61, 0x78, 0xFF, 0x5A,
+    0x63, 0x7A, 0xFF, 0x59, 0x61, 0x79, 0xFF, 0x80, 0x58, 0x60, 0x78, 0xFF, 0x0E, 0x59, 0x61, 0x79, 0xFF, 0x5C, 0x64, 0x7B, 0xFF, 0x5A, 0x64, 0x7B,
+    0xFF, 0x56, 0x5D, 0x74, 0xFF, 0x1F, 0x23, 0x30, 0xFF, 0x09, 0x0D, 0x1A, 0xFF, 0x0A, 0x0E, 0x1B, 0xFF, 0x2F, 0x32, 0x3E, 0xFF, 0x7C, 0x81, 0x92,
+    0xFF, 0x67, 0x6C, 0x7F, 0xFF, 0x91, 0x97, 0xA4, 0xFF, 0x9C, 0xA2, 0xB0, 0xFF, 0x5A, 0x60, 0x77, 0xFF, 0x52, 0x5A, 0x71, 0xFF, 0x51, 0x59, 0x6F,
+    0xFF, 0x80, 0x4D, 0x55, 0x6C, 0xFF, 0x3E, 0x4C, 0x54, 0x6A, 0xFF, 0x4B, 0x54, 0x69, 0xFF, 0x4E, 0x56, 0x6D, 0xFF, 0x4F, 0x56, 0x6D, 0xFF, 0x4E,
+    0x55, 0x6C, 0xFF, 0x54, 0x5B, 0x71, 0xFF, 0x46, 0x4D, 0x62, 0xFF, 0x14, 0x1B, 0x2B, 0xFF, 0x0A, 0x10, 0x1F, 0xFF, 0x0B, 0x10, 0x23, 0xFF, 0x0A,
+    0x0B, 0x15, 0xFF, 0x6A, 0x71, 0x7C, 0xFF, 0xAF, 0xB6, 0xC4, 0xFF, 0xA2, 0xA5, 0xB4, 0xFF, 0xBA, 0xBD, 0xCA, 0xFF, 0x86, 0x8F, 0xA0, 0xFF, 0x23,
+    0x2B, 0x40, 0xFF, 0x29, 0x32, 0x43, 0xFF, 0x2D, 0x33, 0x46, 0xFF, 0x2B, 0x32, 0x45, 0xFF, 0x2A, 0x30, 0x43, 0xFF, 0x29, 0x2E, 0x3E, 0xFF, 0x28,
+    0x2C, 0x3D, 0xFF, 0x28, 0x2C, 0x3C, 0xFF, 0x27, 0x2B, 0x3A, 0xFF, 0x25, 0x2A, 0x3A, 0xFF, 0x25, 0x2B, 0x3A, 0xFF, 0x24, 0x2B, 0x39, 0xFF, 0x24,
+    0x2A, 0x3A, 0xFF, 0x25, 0x29, 0x39, 0xFF, 0x1F, 0x25, 0x33, 0xFF, 0x20, 0x24, 0x34, 0xFF, 0x22, 0x27, 0x36, 0xFF, 0x28, 0x2C, 0x3C, 0xFF, 0x2C,
+    0x30, 0x40, 0xFF, 0x30, 0x34, 0x43, 0xFF, 0x31, 0x35, 0x45, 0xFF, 0x31, 0x34, 0x45, 0xFF, 0x2F, 0x34, 0x43, 0xFF, 0x24, 0x2A, 0x38, 0xFF, 0x18,
+    0x1E, 0x2A, 0xFF, 0x17, 0x1B, 0x29, 0xFF, 0x12, 0x19, 0x24, 0xFF, 0x15, 0x1B, 0x26, 0xFF, 0x16, 0x1C, 0x26, 0xFF, 0x15, 0x1A, 0x23, 0xFF, 0x15,
+    0x19, 0x22, 0xFF, 0x11, 0x16, 0x1E, 0xFF, 0x10, 0x14, 0x1B, 0xFF, 0x10, 0x15, 0x1C, 0xFF, 0x0F, 0x13, 0x1C, 0xFF, 0x10, 0x14, 0x1C, 0xFF, 0x11,
+    0x15, 0x1C, 0xFF, 0x10, 0x14, 0x1C, 0xFF, 0x10, 0x15, 0x1C, 0xFF, 0x10, 0x14, 0x1C, 0xFF, 0x11, 0x14, 0x1C, 0xFF, 0x10, 0x14, 0x1C, 0xFF, 0x0D,
+    0x12, 0x18, 0xFF, 0x1C, 0x21, 0x26, 0xFF, 0x02, 0x04, 0x07, 0xFF, 0x01, 0x03, 0x05, 0xFF, 0x02, 0x03, 0x06, 0xFF, 0x07, 0x00, 0x00, 0x01, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x82, 0x00, 0x01, 0x02, 0xFF, 0x48, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x01,
+    0x01, 0x04, 0xFF, 0x01, 0x01, 0x03, 0xFF, 0x00, 0x02, 0x04, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x02, 0x01, 0x05, 0xFF, 0x00, 0x02, 0x04, 0xFF, 0x01,
+    0x02, 0x06, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x02, 0x03, 0x06, 0xFF, 0x01, 0x03, 0x05, 0xFF, 0x02, 0x03, 0x07, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x02,
+    0x03, 0x06, 0xFF, 0x07, 0x0A, 0x0F, 0xFF, 0x16, 0x1A, 0x24, 0xFF, 0x10, 0x13, 0x1C, 0xFF, 0x12, 0x14, 0x1E, 0xFF, 0x13, 0x16, 0x20, 0xFF, 0x15,
+    0x17, 0x1F, 0xFF, 0x14, 0x16, 0x20, 0xFF, 0x14, 0x17, 0x22, 0xFF, 0x15, 0x18, 0x23, 0xFF, 0x16, 0x18, 0x24, 0xFF, 0x15, 0x19, 0x26, 0xFF, 0x16,
+    0x19, 0x26, 0xFF, 0x0B, 0x10, 0x1D, 0xFF, 0x85, 0x8A, 0x95, 0xFF, 0x9E, 0xA3, 0xAB, 0xFF, 0x2F, 0x37, 0x4D, 0xFF, 0x58, 0x5C, 0x79, 0xFF, 0x71,
+    0x73, 0x8E, 0xFF, 0x67, 0x67, 0x7E, 0xFF, 0x19, 0x1A, 0x24, 0xFF, 0x07, 0x09, 0x11, 0xFF, 0x05, 0x07, 0x0E, 0xFF, 0x1C, 0x20, 0x2B, 0xFF, 0x31,
+    0x35, 0x48, 0xFF, 0x1F, 0x22, 0x32, 0xFF, 0x24, 0x27, 0x38, 0xFF, 0x25, 0x2A, 0x3A, 0xFF, 0x25, 0x29, 0x3A, 0xFF, 0x24, 0x27, 0x38, 0xFF, 0x22,
+    0x26, 0x37, 0xFF, 0x23, 0x27, 0x37, 0xFF, 0x25, 0x29, 0x3B, 0xFF, 0x25, 0x2A, 0x3C, 0xFF, 0x27, 0x2C, 0x3E, 0xFF, 0x28, 0x2D, 0x3F, 0xFF, 0x60,
+    0x67, 0x7D, 0xFF, 0x87, 0x90, 0xA3, 0xFF, 0x1F, 0x26, 0x38, 0xFF, 0x5B, 0x64, 0x7B, 0xFF, 0x61, 0x69, 0x80, 0xFF, 0x3F, 0x44, 0x57, 0xFF, 0x35,
+    0x3B, 0x4F, 0xFF, 0x32, 0x38, 0x4D, 0xFF, 0x31, 0x38, 0x4A, 0xFF, 0x33, 0x3A, 0x4D, 0xFF, 0x35, 0x3D, 0x51, 0xFF, 0x36, 0x3F, 0x52, 0xFF, 0x38,
+    0x40, 0x54, 0xFF, 0x38, 0x41, 0x56, 0xFF, 0x37, 0x40, 0x57, 0xFF, 0x3F, 0x47, 0x5E, 0xFF, 0xA5, 0xA9, 0xB1, 0xFF, 0xC2, 0xC3, 0xCB, 0xFF, 0xA1,
+    0xA6, 0xB2, 0xFF, 0x71, 0x75, 0x85, 0xFF, 0x16, 0x17, 0x23, 0xFF, 0x09, 0x0B, 0x1A, 0xFF, 0x0A, 0x0D, 0x1F, 0xFF, 0x80, 0x09, 0x0D, 0x20, 0xFF,
+    0x07, 0x0B, 0x0D, 0x22, 0xFF, 0x09, 0x0C, 0x1F, 0xFF, 0x19, 0x1D, 0x28, 0xFF, 0x66, 0x6C, 0x7E, 0xFF, 0x52, 0x57, 0x6A, 0xFF, 0x4C, 0x52, 0x6C,
+    0xFF, 0x4E, 0x55, 0x6D, 0xFF, 0x4F, 0x56, 0x6F, 0xFF, 0x80, 0x4E, 0x56, 0x6E, 0xFF, 0x4A, 0x4F, 0x56, 0x6F, 0xFF, 0x4E, 0x57, 0x6E, 0xFF, 0x4F,
+    0x59, 0x6F, 0xFF, 0x53, 0x5B, 0x73, 0xFF, 0x54, 0x5D, 0x72, 0xFF, 0x78, 0x7F, 0x93, 0xFF, 0x33, 0x3B, 0x4D, 0xFF, 0x50, 0x58, 0x73, 0xFF, 0x67,
+    0x70, 0x82, 0xFF, 0x73, 0x79, 0x8B, 0xFF, 0x5F, 0x65, 0x7C, 0xFF, 0x5C, 0x64, 0x7B, 0xFF, 0x5A, 0x61, 0x77, 0xFF, 0x59, 0x5F, 0x76, 0xFF, 0x56,
+    0x5C, 0x72, 0xFF, 0x51, 0x58, 0x71, 0xFF, 0x51, 0x57, 0x70, 0xFF, 0x53, 0x5A, 0x72, 0xFF, 0x5B, 0x62, 0x7A, 0xFF, 0x5C, 0x63, 0x7C, 0xFF, 0x61,
+    0x66, 0x7E, 0xFF, 0x9B, 0xA0, 0xB0, 0xFF, 0x89, 0x8E, 0xA1, 0xFF, 0x4C, 0x4F, 0x60, 0xFF, 0x06, 0x09, 0x14, 0xFF, 0x0D, 0x11, 0x23, 0xFF, 0x0B,
+    0x0D, 0x1D, 0xFF, 0x07, 0x09, 0x15, 0xFF, 0x1B, 0x1E, 0x24, 0xFF, 0x71, 0x76, 0x80, 0xFF, 0x7D, 0x82, 0x90, 0xFF, 0x61, 0x68, 0x7F, 0xFF, 0x63,
+    0x6B, 0x81, 0xFF, 0x62, 0x6A, 0x80, 0xFF, 0x60, 0x68, 0x7D, 0xFF, 0x61, 0x69, 0x7E, 0xFF, 0x64, 0x6C, 0x81, 0xFF, 0x64, 0x6C, 0x80, 0xFF, 0x63,
+    0x6B, 0x7F, 0xFF, 0x66, 0x6D, 0x83, 0xFF, 0x64, 0x6C, 0x82, 0xFF, 0x61, 0x68, 0x7D, 0xFF, 0x5E, 0x66, 0x7C, 0xFF, 0x69, 0x6F, 0x83, 0xFF, 0x6D,
+    0x73, 0x87, 0xFF, 0x54, 0x5B, 0x70, 0xFF, 0x44, 0x4B, 0x63, 0xFF, 0x25, 0x2D, 0x44, 0xFF, 0x12, 0x18, 0x28, 0xFF, 0x10, 0x14, 0x22, 0xFF, 0x0F,
+    0x13, 0x21, 0xFF, 0x10, 0x13, 0x21, 0xFF, 0x11, 0x15, 0x24, 0xFF, 0x16, 0x1A, 0x2C, 0xFF, 0x2E, 0x33, 0x49, 0xFF, 0x4A, 0x50, 0x66, 0xFF, 0x61,
+    0x68, 0x7B, 0xFF, 0x6B, 0x72, 0x88, 0xFF, 0x60, 0x68, 0x7F, 0xFF, 0x63, 0x6C, 0x81, 0xFF, 0x66, 0x6E, 0x83, 0xFF, 0x63, 0x6C, 0x81, 0xFF, 0x61,
+    0x6B, 0x80, 0xFF, 0x64, 0x6D, 0x81, 0xFF, 0x64, 0x6C, 0x81, 0xFF, 0x62, 0x6C, 0x7F, 0xFF, 0x61, 0x6B, 0x7E, 0xFF, 0x62, 0x6B, 0x7F, 0xFF, 0x63,
+    0x6C, 0x81, 0xFF, 0x63, 0x6D, 0x82, 0xFF, 0x8E, 0x95, 0x9F, 0xFF, 0x70, 0x74, 0x7C, 0xFF, 0x19, 0x1B, 0x24, 0xFF, 0x08, 0x0D, 0x1A, 0xFF, 0x0B,
+    0x10, 0x1E, 0xFF, 0x80, 0x0C, 0x11, 0x21, 0xFF, 0x54, 0x06, 0x09, 0x15, 0xFF, 0x65, 0x69, 0x72, 0xFF, 0xAF, 0xB3, 0xBD, 0xFF, 0x60, 0x67, 0x7C,
+    0xFF, 0x63, 0x6A, 0x80, 0xFF, 0x62, 0x69, 0x80, 0xFF, 0x5E, 0x66, 0x7D, 0xFF, 0x5F, 0x67, 0x7D, 0xFF, 0x62, 0x6B, 0x81, 0xFF, 0x63, 0x6B, 0x80,
+    0xFF, 0x61, 0x69, 0x7E, 0xFF, 0x5F, 0x66, 0x7A, 0xFF, 0x59, 0x60, 0x75, 0xFF, 0x57, 0x5D, 0x73, 0xFF, 0x5B, 0x61, 0x77, 0xFF, 0x5F, 0x66, 0x7D,
+    0xFF, 0x5B, 0x63, 0x79, 0xFF, 0x51, 0x59, 0x6C, 0xFF, 0x49, 0x4F, 0x64, 0xFF, 0x46, 0x4C, 0x61, 0xFF, 0x34, 0x3B, 0x4A, 0xFF, 0x36, 0x3B, 0x4C,
+    0xFF, 0x34, 0x3A, 0x4B, 0xFF, 0x37, 0x3E, 0x50, 0xFF, 0x3C, 0x43, 0x56, 0xFF, 0x3F, 0x45, 0x5A, 0xFF, 0x46, 0x4D, 0x61, 0xFF, 0x45, 0x4D, 0x60,
+    0xFF, 0x51, 0x58, 0x6E, 0xFF, 0x5A, 0x62, 0x7A, 0xFF, 0x51, 0x59, 0x6E, 0xFF, 0x50, 0x58, 0x70, 0xFF, 0x53, 0x5A, 0x74, 0xFF, 0x51, 0x59, 0x71,
+    0xFF, 0x4E, 0x57, 0x6E, 0xFF, 0x51, 0x5A, 0x71, 0xFF, 0x57, 0x5F, 0x76, 0xFF, 0x56, 0x5E, 0x75, 0xFF, 0x54, 0x5C, 0x74, 0xFF, 0x55, 0x5C, 0x74,
+    0xFF, 0x58, 0x5F, 0x77, 0xFF, 0x58, 0x60, 0x77, 0xFF, 0x57, 0x60, 0x77, 0xFF, 0x57, 0x60, 0x78, 0xFF, 0x57, 0x5F, 0x76, 0xFF, 0x59, 0x61, 0x78,
+    0xFF, 0x58, 0x60, 0x78, 0xFF, 0x52, 0x59, 0x70, 0xFF, 0x1D, 0x21, 0x2D, 0xFF, 0x08, 0x0C, 0x16, 0xFF, 0x08, 0x0C, 0x18, 0xFF, 0x2D, 0x30, 0x3B,
+    0xFF, 0x76, 0x7A, 0x8D, 0xFF, 0x62, 0x66, 0x7A, 0xFF, 0x8D, 0x94, 0xA2, 0xFF, 0x99, 0xA0, 0xAE, 0xFF, 0x57, 0x5F, 0x75, 0xFF, 0x4F, 0x57, 0x6E,
+    0xFF, 0x4E, 0x56, 0x6C, 0xFF, 0x4B, 0x52, 0x69, 0xFF, 0x49, 0x51, 0x68, 0xFF, 0x49, 0x51, 0x67, 0xFF, 0x4A, 0x51, 0x68, 0xFF, 0x4B, 0x52, 0x68,
+    0xFF, 0x4B, 0x52, 0x69, 0xFF, 0x4A, 0x52, 0x69, 0xFF, 0x50, 0x57, 0x6F, 0xFF, 0x44, 0x4B, 0x61, 0xFF, 0x15, 0x1B, 0x2B, 0xFF, 0x0B, 0x11, 0x21,
+    0xFF, 0x0A, 0x0E, 0x1B, 0xFF, 0x2C, 0x2E, 0x37, 0xFF, 0x9C, 0xA3, 0xB2, 0xFF, 0xAC, 0xB2, 0xC0, 0xFF, 0xA6, 0xA8, 0xB7, 0xFF, 0xB8, 0xBF, 0xCD,
+    0xFF, 0x51, 0x59, 0x70, 0xFF, 0x20, 0x26, 0x35, 0xFF, 0x2B, 0x31, 0x43, 0xFF, 0x2A, 0x31, 0x43, 0xFF, 0x29, 0x30, 0x41, 0xFF, 0x29, 0x2E, 0x40,
+    0xFF, 0x27, 0x2C, 0x3D, 0xFF, 0x26, 0x2B, 0x3B, 0xFF, 0x24, 0x29, 0x39, 0xFF, 0x80, 0x23, 0x28, 0x37, 0xFF, 0x16, 0x24, 0x2A, 0x39, 0xFF, 0x25,
+    0x29, 0x39, 0xFF, 0x22, 0x27, 0x36, 0xFF, 0x24, 0x28, 0x38, 0xFF, 0x28, 0x2B, 0x3B, 0xFF, 0x2E, 0x32, 0x44, 0xFF, 0x37, 0x3B, 0x4E, 0xFF, 0x3A,
+    0x3E, 0x52, 0xFF, 0x3A, 0x3D, 0x52, 0xFF, 0x36, 0x3A, 0x4D, 0xFF, 0x34, 0x36, 0x49, 0xFF, 0x2F, 0x32, 0x45, 0xFF, 0x2D, 0x32, 0x44, 0xFF, 0x30,
+    0x35, 0x48, 0xFF, 0x33, 0x37, 0x4B, 0xFF, 0x24, 0x28, 0x38, 0xFF, 0x11, 0x17, 0x23, 0xFF, 0x12, 0x16, 0x23, 0xFF, 0x13, 0x19, 0x22, 0xFF, 0x13,
+    0x17, 0x1F, 0xFF, 0x12, 0x16, 0x1F, 0xFF, 0x11, 0x15, 0x1D, 0xFF, 0x0F, 0x13, 0x1A, 0xFF, 0x80, 0x0F, 0x13, 0x1B, 0xFF, 0x04, 0x10, 0x14, 0x1B,
+    0xFF, 0x0F, 0x13, 0x1A, 0xFF, 0x0D, 0x11, 0x17, 0xFF, 0x0D, 0x11, 0x18, 0xFF, 0x0F, 0x12, 0x19, 0xFF, 0x80, 0x0F, 0x13, 0x1A, 0xFF, 0x04, 0x0D,
+    0x12, 0x17, 0xFF, 0x1C, 0x22, 0x26, 0xFF, 0x03, 0x04, 0x07, 0xFF, 0x02, 0x03, 0x05, 0xFF, 0x02, 0x04, 0x07, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x01,
+    0x01, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x02, 0x03, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x02,
+    0x04, 0xFF, 0x80, 0x01, 0x01, 0x05, 0xFF, 0x0B, 0x02, 0x02, 0x06, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x02, 0x02, 0x06, 0xFF, 0x01, 0x03, 0x06, 0xFF,
+    0x02, 0x03, 0x07, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x02, 0x03, 0x06, 0xFF, 0x07, 0x0A, 0x10, 0xFF, 0x16, 0x1B, 0x25, 0xFF, 0x0F, 0x14, 0x1C, 0xFF,
+    0x13, 0x16, 0x1E, 0xFF, 0x13, 0x16, 0x1F, 0xFF, 0x80, 0x13, 0x16, 0x1E, 0xFF, 0x7F, 0x13, 0x16, 0x1F, 0xFF, 0x14, 0x17, 0x20, 0xFF, 0x14, 0x18,
+    0x22, 0xFF, 0x14, 0x19, 0x24, 0xFF, 0x16, 0x19, 0x25, 0xFF, 0x0C, 0x0F, 0x1C, 0xFF, 0x84, 0x88, 0x93, 0xFF, 0x9C, 0xA1, 0xA9, 0xFF, 0x29, 0x34,
+    0x4A, 0xFF, 0x54, 0x5A, 0x77, 0xFF, 0x6F, 0x71, 0x8B, 0xFF, 0x65, 0x65, 0x7C, 0xFF, 0x18, 0x1A, 0x23, 0xFF, 0x07, 0x08, 0x0F, 0xFF, 0x04, 0x06,
+    0x0C, 0xFF, 0x1B, 0x20, 0x2B, 0xFF, 0x30, 0x35, 0x47, 0xFF, 0x1F, 0x22, 0x31, 0xFF, 0x24, 0x27, 0x37, 0xFF, 0x24, 0x28, 0x38, 0xFF, 0x24, 0x28,
+    0x39, 0xFF, 0x23, 0x27, 0x37, 0xFF, 0x23, 0x26, 0x36, 0xFF, 0x22, 0x26, 0x37, 0xFF, 0x24, 0x29, 0x3B, 0xFF, 0x26, 0x2B, 0x3D, 0xFF, 0x28, 0x2D,
+    0x3D, 0xFF, 0x27, 0x2C, 0x3D, 0xFF, 0x60, 0x67, 0x7B, 0xFF, 0x8A, 0x93, 0xA7, 0xFF, 0x21, 0x28, 0x3B, 0xFF, 0x56, 0x5F, 0x76, 0xFF, 0x61, 0x6A,
+    0x81, 0xFF, 0x3F, 0x46, 0x5A, 0xFF, 0x2F, 0x35, 0x47, 0xFF, 0x33, 0x39, 0x4D, 0xFF, 0x30, 0x37, 0x4A, 0xFF, 0x32, 0x38, 0x4C, 0xFF, 0x35, 0x3D,
+    0x50, 0xFF, 0x35, 0x3D, 0x51, 0xFF, 0x36, 0x3D, 0x51, 0xFF, 0x36, 0x3F, 0x54, 0xFF, 0x38, 0x41, 0x57, 0xFF, 0x2A, 0x32, 0x48, 0xFF, 0x7C, 0x7F,
+    0x8E, 0xFF, 0xCA, 0xCC, 0xD4, 0xFF, 0xA3, 0xA6, 0xB3, 0xFF, 0x9E, 0xA2, 0xB3, 0xFF, 0x30, 0x32, 0x3E, 0xFF, 0x07, 0x09, 0x15, 0xFF, 0x0C, 0x0E,
+    0x22, 0xFF, 0x0A, 0x0E, 0x22, 0xFF, 0x09, 0x0E, 0x21, 0xFF, 0x0C, 0x0F, 0x26, 0xFF, 0x0C, 0x0E, 0x20, 0xFF, 0x26, 0x2A, 0x34, 0xFF, 0x6E, 0x73,
+    0x86, 0xFF, 0x48, 0x4F, 0x66, 0xFF, 0x4B, 0x51, 0x6B, 0xFF, 0x4A, 0x51, 0x68, 0xFF, 0x48, 0x51, 0x67, 0xFF, 0x49, 0x51, 0x67, 0xFF, 0x4B, 0x52,
+    0x69, 0xFF, 0x4E, 0x56, 0x6D, 0xFF, 0x4E, 0x57, 0x6E, 0xFF, 0x50, 0x57, 0x6F, 0xFF, 0x4A, 0x52, 0x6A, 0xFF, 0x5D, 0x65, 0x7B, 0xFF, 0x5E, 0x66,
+    0x7A, 0xFF, 0x2E, 0x34, 0x49, 0xFF, 0x4E, 0x57, 0x70, 0xFF, 0x5C, 0x63, 0x75, 0xFF, 0x71, 0x77, 0x89, 0xFF, 0x5C, 0x63, 0x78, 0xFF, 0x5A, 0x62,
+    0x78, 0xFF, 0x56, 0x5D, 0x73, 0xFF, 0x55, 0x5C, 0x72, 0xFF, 0x53, 0x59, 0x71, 0xFF, 0x4D, 0x54, 0x6B, 0xFF, 0x4D, 0x53, 0x6B, 0xFF, 0x50, 0x57,
+    0x6E, 0xFF, 0x53, 0x5A, 0x73, 0xFF, 0x55, 0x5B, 0x74, 0xFF, 0x5C, 0x61, 0x79, 0xFF, 0x98, 0x9D, 0xAE, 0xFF, 0x85, 0x8B, 0x9F, 0xFF, 0x4B, 0x4E,
+    0x5E, 0xFF, 0x08, 0x0A, 0x16, 0xFF, 0x0E, 0x12, 0x25, 0xFF, 0x0C, 0x10, 0x20, 0xFF, 0x05, 0x07, 0x10, 0xFF, 0x47, 0x4A, 0x52, 0xFF, 0x8F, 0x95,
+    0xA1, 0xFF, 0x5D, 0x62, 0x77, 0xFF, 0x5B, 0x63, 0x79, 0xFF, 0x5E, 0x65, 0x7B, 0xFF, 0x5D, 0x65, 0x7B, 0xFF, 0x5D, 0x64, 0x7A, 0xFF, 0x5E, 0x66,
+    0x7B, 0xFF, 0x61, 0x69, 0x7E, 0xFF, 0x63, 0x6A, 0x80, 0xFF, 0x63, 0x6A, 0x7F, 0xFF, 0x64, 0x6B, 0x81, 0xFF, 0x5F, 0x67, 0x7E, 0xFF, 0x57, 0x5E,
+    0x75, 0xFF, 0x67, 0x6F, 0x84, 0xFF, 0x63, 0x6B, 0x7E, 0xFF, 0x43, 0x4B, 0x61, 0xFF, 0x24, 0x2C, 0x43, 0xFF, 0x11, 0x18, 0x2A, 0xFF, 0x10, 0x16,
+    0x27, 0xFF, 0x0B, 0x0F, 0x1E, 0xFF, 0x0A, 0x0D, 0x1C, 0xFF, 0x0B, 0x0E, 0x1D, 0xFF, 0x0C, 0x0E, 0x1D, 0xFF, 0x0C, 0x10, 0x1E, 0xFF, 0x0E, 0x11,
+    0x22, 0xFF, 0x10, 0x14, 0x26, 0xFF, 0x12, 0x18, 0x2B, 0xFF, 0x2A, 0x2F, 0x46, 0xFF, 0x5A, 0x61, 0x76, 0xFF, 0x6C, 0x73, 0x88, 0xFF, 0x5B, 0x62,
+    0x78, 0xFF, 0x60, 0x68, 0x7D, 0xFF, 0x60, 0x69, 0x7E, 0xFF, 0x61, 0x6A, 0x7F, 0xFF, 0x61, 0x69, 0x7D, 0xFF, 0x60, 0x69, 0x7E, 0xFF, 0x3C, 0x5F,
+    0x68, 0x7D, 0xFF, 0x5C, 0x65, 0x7A, 0xFF, 0x5B, 0x63, 0x78, 0xFF, 0x5E, 0x68, 0x7D, 0xFF, 0x60, 0x69, 0x7F, 0xFF, 0x65, 0x6B, 0x7C, 0xFF, 0x8D,
+    0x95, 0x9C, 0xFF, 0x34, 0x37, 0x3F, 0xFF, 0x05, 0x09, 0x13, 0xFF, 0x0B, 0x10, 0x20, 0xFF, 0x0D, 0x13, 0x23, 0xFF, 0x0A, 0x10, 0x1F, 0xFF, 0x2A,
+    0x2D, 0x36, 0xFF, 0xA3, 0xA7, 0xAF, 0xFF, 0x95, 0x99, 0xA6, 0xFF, 0x5C, 0x64, 0x7A, 0xFF, 0x60, 0x68, 0x7E, 0xFF, 0x5C, 0x63, 0x7A, 0xFF, 0x58,
+    0x5F, 0x75, 0xFF, 0x58, 0x60, 0x76, 0xFF, 0x5B, 0x64, 0x7A, 0xFF, 0x5D, 0x65, 0x7B, 0xFF, 0x5B, 0x62, 0x78, 0xFF, 0x57, 0x5E, 0x73, 0xFF, 0x57,
+    0x5E, 0x74, 0xFF, 0x56, 0x5E, 0x73, 0xFF, 0x5C, 0x63, 0x78, 0xFF, 0x5A, 0x61, 0x77, 0xFF, 0x4E, 0x56, 0x6A, 0xFF, 0x44, 0x49, 0x5C, 0xFF, 0x1C,
+    0x20, 0x2E, 0xFF, 0x15, 0x19, 0x23, 0xFF, 0x09, 0x0A, 0x14, 0xFF, 0x06, 0x09, 0x12, 0xFF, 0x09, 0x0B, 0x16, 0xFF, 0x09, 0x0C, 0x17, 0xFF, 0x0B,
+    0x10, 0x1C, 0xFF, 0x13, 0x17, 0x25, 0xFF, 0x2C, 0x30, 0x44, 0xFF, 0x3F, 0x45, 0x5B, 0xFF, 0x3B, 0x41, 0x55, 0xFF, 0x41, 0x48, 0x5B, 0xFF, 0x56,
+    0x5C, 0x75, 0xFF, 0x4B, 0x51, 0x67, 0xFF, 0x48, 0x4E, 0x66, 0xFF, 0x4B, 0x53, 0x6A, 0xFF, 0x4A, 0x52, 0x69, 0xFF, 0x4F, 0x57, 0x6D, 0xFF, 0x53,
+    0x5A, 0x71, 0xFF, 0x51, 0x59, 0x70, 0xFF, 0x4D, 0x55, 0x6C, 0xFF, 0x4E, 0x55, 0x6C, 0xFF, 0x52, 0x5B, 0x71, 0xFF, 0x57, 0x5E, 0x76, 0xFF, 0x58,
+    0x5F, 0x76, 0xFF, 0x54, 0x5D, 0x73, 0xFF, 0x53, 0x5B, 0x73, 0xFF, 0x55, 0x5D, 0x74, 0xFF, 0x55, 0x5D, 0x73, 0xFF, 0x51, 0x59, 0x70, 0xFF, 0x1C,
+    0x20, 0x2C, 0xFF, 0x80, 0x07, 0x0B, 0x14, 0xFF, 0x48, 0x2B, 0x2E, 0x39, 0xFF, 0x72, 0x77, 0x8A, 0xFF, 0x5B, 0x61, 0x76, 0xFF, 0x8A, 0x91, 0x9F,
+    0xFF, 0x97, 0x9E, 0xAC, 0xFF, 0x54, 0x5C, 0x71, 0xFF, 0x4B, 0x53, 0x6A, 0xFF, 0x4C, 0x54, 0x6A, 0xFF, 0x4A, 0x52, 0x69, 0xFF, 0x49, 0x51, 0x68,
+    0xFF, 0x48, 0x4F, 0x66, 0xFF, 0x47, 0x4E, 0x65, 0xFF, 0x45, 0x4C, 0x63, 0xFF, 0x45, 0x4C, 0x62, 0xFF, 0x45, 0x4C, 0x63, 0xFF, 0x4D, 0x54, 0x6B,
+    0xFF, 0x43, 0x4A, 0x5F, 0xFF, 0x14, 0x1B, 0x2A, 0xFF, 0x0B, 0x11, 0x22, 0xFF, 0x0D, 0x10, 0x1A, 0xFF, 0x64, 0x67, 0x75, 0xFF, 0xB1, 0xB6, 0xC5,
+    0xFF, 0x9B, 0x9E, 0xAE, 0xFF, 0xB5, 0xB9, 0xC7, 0xFF, 0x8D, 0x96, 0xA7, 0xFF, 0x24, 0x30, 0x49, 0xFF, 0x28, 0x2F, 0x3F, 0xFF, 0x29, 0x2F, 0x40,
+    0xFF, 0x27, 0x2E, 0x3F, 0xFF, 0x27, 0x2D, 0x3D, 0xFF, 0x26, 0x2B, 0x3C, 0xFF, 0x24, 0x29, 0x3B, 0xFF, 0x23, 0x28, 0x38, 0xFF, 0x22, 0x27, 0x37,
+    0xFF, 0x22, 0x26, 0x37, 0xFF, 0x23, 0x28, 0x38, 0xFF, 0x22, 0x28, 0x37, 0xFF, 0x23, 0x27, 0x37, 0xFF, 0x24, 0x28, 0x37, 0xFF, 0x24, 0x2A, 0x38,
+    0xFF, 0x1B, 0x1F, 0x2D, 0xFF, 0x13, 0x16, 0x23, 0xFF, 0x12, 0x14, 0x20, 0xFF, 0x12, 0x13, 0x20, 0xFF, 0x14, 0x15, 0x24, 0xFF, 0x27, 0x28, 0x3C,
+    0xFF, 0x37, 0x38, 0x50, 0xFF, 0x38, 0x3C, 0x53, 0xFF, 0x2E, 0x31, 0x46, 0xFF, 0x22, 0x22, 0x37, 0xFF, 0x1F, 0x21, 0x34, 0xFF, 0x27, 0x2B, 0x3D,
+    0xFF, 0x29, 0x2D, 0x3F, 0xFF, 0x14, 0x19, 0x24, 0xFF, 0x0D, 0x11, 0x1A, 0xFF, 0x11, 0x15, 0x1D, 0xFF, 0x11, 0x14, 0x1D, 0xFF, 0x11, 0x14, 0x1C,
+    0xFF, 0x10, 0x13, 0x1C, 0xFF, 0x11, 0x15, 0x1D, 0xFF, 0x11, 0x15, 0x1C, 0xFF, 0x10, 0x14, 0x1B, 0xFF, 0x0D, 0x11, 0x18, 0xFF, 0x0C, 0x10, 0x16,
+    0xFF, 0x0D, 0x11, 0x17, 0xFF, 0x0E, 0x12, 0x18, 0xFF, 0x0F, 0x13, 0x1A, 0xFF, 0x0F, 0x13, 0x19, 0xFF, 0x0E, 0x12, 0x16, 0xFF, 0x1C, 0x22, 0x27,
+    0xFF, 0x03, 0x04, 0x07, 0xFF, 0x02, 0x04, 0x05, 0xFF, 0x02, 0x03, 0x06, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0x00, 0xFF, 0x00,
+    0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01,
+    0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x07, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00,
+    0x01, 0x03, 0xFF, 0x01, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x81, 0x01, 0x01, 0x05, 0xFF, 0x09, 0x01, 0x02, 0x06,
+    0xFF, 0x02, 0x02, 0x06, 0xFF, 0x02, 0x03, 0x06, 0xFF, 0x02, 0x03, 0x07, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x07, 0x09, 0x0F,
+    0xFF, 0x15, 0x1B, 0x24, 0xFF, 0x10, 0x14, 0x1D, 0xFF, 0x13, 0x16, 0x1F, 0xFF, 0x80, 0x13, 0x16, 0x1E, 0xFF, 0x16, 0x12, 0x16, 0x1F, 0xFF, 0x12,
+    0x15, 0x1F, 0xFF, 0x12, 0x16, 0x1F, 0xFF, 0x13, 0x17, 0x22, 0xFF, 0x15, 0x19, 0x25, 0xFF, 0x16, 0x1A, 0x26, 0xFF, 0x0D, 0x12, 0x1E, 0xFF, 0x84,
+    0x88, 0x92, 0xFF, 0x9B, 0x9F, 0xA6, 0xFF, 0x26, 0x30, 0x46, 0xFF, 0x51, 0x57, 0x74, 0xFF, 0x6B, 0x6E, 0x88, 0xFF, 0x62, 0x61, 0x78, 0xFF, 0x17,
+    0x18, 0x21, 0xFF, 0x05, 0x08, 0x0F, 0xFF, 0x04, 0x05, 0x0C, 0xFF, 0x1B, 0x20, 0x2B, 0xFF, 0x30, 0x34, 0x47, 0xFF, 0x1F, 0x22, 0x31, 0xFF, 0x23,
+    0x25, 0x37, 0xFF, 0x21, 0x25, 0x36, 0xFF, 0x23, 0x27, 0x38, 0xFF, 0x24, 0x28, 0x39, 0xFF, 0x80, 0x24, 0x28, 0x3A, 0xFF, 0x76, 0x26, 0x2A, 0x3B,
+    0xFF, 0x28, 0x2D, 0x3F, 0xFF, 0x28, 0x2E, 0x3F, 0xFF, 0x27, 0x2D, 0x3E, 0xFF, 0x60, 0x66, 0x7A, 0xFF, 0x8C, 0x94, 0xA8, 0xFF, 0x23, 0x29, 0x3D,
+    0xFF, 0x4C, 0x54, 0x6D, 0xFF, 0x59, 0x61, 0x78, 0xFF, 0x3F, 0x45, 0x59, 0xFF, 0x32, 0x35, 0x4A, 0xFF, 0x32, 0x38, 0x4C, 0xFF, 0x31, 0x39, 0x4B,
+    0xFF, 0x32, 0x39, 0x4C, 0xFF, 0x33, 0x3B, 0x4E, 0xFF, 0x33, 0x3A, 0x4E, 0xFF, 0x33, 0x3B, 0x4F, 0xFF, 0x35, 0x3E, 0x53, 0xFF, 0x37, 0x3F, 0x55,
+    0xFF, 0x30, 0x38, 0x4D, 0xFF, 0x4F, 0x58, 0x70, 0xFF, 0xB2, 0xB6, 0xBF, 0xFF, 0xAD, 0xAF, 0xBA, 0xFF, 0xA8, 0xAC, 0xB6, 0xFF, 0x5A, 0x5C, 0x6A,
+    0xFF, 0x07, 0x08, 0x14, 0xFF, 0x0B, 0x0F, 0x24, 0xFF, 0x0C, 0x0F, 0x25, 0xFF, 0x0A, 0x0E, 0x23, 0xFF, 0x0B, 0x0F, 0x24, 0xFF, 0x12, 0x14, 0x22,
+    0xFF, 0x57, 0x5C, 0x6B, 0xFF, 0x57, 0x5B, 0x6E, 0xFF, 0x45, 0x4C, 0x65, 0xFF, 0x46, 0x4E, 0x65, 0xFF, 0x45, 0x4D, 0x63, 0xFF, 0x46, 0x4D, 0x63,
+    0xFF, 0x47, 0x4F, 0x64, 0xFF, 0x48, 0x50, 0x67, 0xFF, 0x48, 0x50, 0x69, 0xFF, 0x4A, 0x53, 0x6A, 0xFF, 0x4D, 0x54, 0x6B, 0xFF, 0x41, 0x4A, 0x5E,
+    0xFF, 0x62, 0x68, 0x80, 0xFF, 0x3D, 0x43, 0x54, 0xFF, 0x38, 0x3E, 0x55, 0xFF, 0x4A, 0x52, 0x6C, 0xFF, 0x52, 0x59, 0x69, 0xFF, 0x6E, 0x74, 0x86,
+    0xFF, 0x57, 0x5F, 0x75, 0xFF, 0x55, 0x5C, 0x71, 0xFF, 0x53, 0x5A, 0x70, 0xFF, 0x50, 0x57, 0x6E, 0xFF, 0x4E, 0x53, 0x6C, 0xFF, 0x4B, 0x51, 0x69,
+    0xFF, 0x4C, 0x52, 0x6B, 0xFF, 0x4F, 0x55, 0x6E, 0xFF, 0x4F, 0x56, 0x6E, 0xFF, 0x50, 0x56, 0x6E, 0xFF, 0x56, 0x5B, 0x73, 0xFF, 0x94, 0x9A, 0xAB,
+    0xFF, 0x83, 0x88, 0x9C, 0xFF, 0x4B, 0x4E, 0x5E, 0xFF, 0x08, 0x0A, 0x16, 0xFF, 0x0F, 0x14, 0x27, 0xFF, 0x0C, 0x11, 0x21, 0xFF, 0x0E, 0x12, 0x19,
+    0xFF, 0x68, 0x6D, 0x75, 0xFF, 0x7F, 0x83, 0x8F, 0xFF, 0x55, 0x5A, 0x6F, 0xFF, 0x55, 0x5E, 0x72, 0xFF, 0x59, 0x61, 0x76, 0xFF, 0x5A, 0x61, 0x77,
+    0xFF, 0x58, 0x60, 0x75, 0xFF, 0x58, 0x60, 0x76, 0xFF, 0x5B, 0x64, 0x79, 0xFF, 0x5F, 0x68, 0x7C, 0xFF, 0x62, 0x6A, 0x7F, 0xFF, 0x5F, 0x67, 0x7C,
+    0xFF, 0x5B, 0x63, 0x78, 0xFF, 0x5F, 0x67, 0x7D, 0xFF, 0x54, 0x5C, 0x71, 0xFF, 0x34, 0x3A, 0x50, 0xFF, 0x1C, 0x23, 0x37, 0xFF, 0x0F, 0x14, 0x24,
+    0xFF, 0x0C, 0x12, 0x22, 0xFF, 0x0E, 0x12, 0x24, 0xFF, 0x0E, 0x12, 0x23, 0xFF, 0x0D, 0x11, 0x22, 0xFF, 0x0D, 0x12, 0x22, 0xFF, 0x0E, 0x12, 0x22,
+    0xFF, 0x0E, 0x13, 0x23, 0xFF, 0x0E, 0x13, 0x25, 0xFF, 0x0E, 0x12, 0x23, 0xFF, 0x0C, 0x0F, 0x1F, 0xFF, 0x0D, 0x0F, 0x1F, 0xFF, 0x1D, 0x21, 0x34,
+    0xFF, 0x52, 0x58, 0x6B, 0xFF, 0x62, 0x68, 0x7C, 0xFF, 0x58, 0x5F, 0x73, 0xFF, 0x5E, 0x67, 0x7B, 0xFF, 0x60, 0x6A, 0x7E, 0xFF, 0x5C, 0x66, 0x79,
+    0xFF, 0x5B, 0x64, 0x78, 0xFF, 0x59, 0x63, 0x77, 0xFF, 0x54, 0x5E, 0x73, 0xFF, 0x54, 0x5D, 0x72, 0xFF, 0x56, 0x5F, 0x74, 0xFF, 0x5B, 0x63, 0x78,
+    0xFF, 0x58, 0x60, 0x73, 0xFF, 0x7D, 0x84, 0x8E, 0xFF, 0x68, 0x6E, 0x78, 0xFF, 0x04, 0x06, 0x11, 0xFF, 0x0C, 0x10, 0x20, 0xFF, 0x0E, 0x13, 0x25,
+    0xFF, 0x08, 0x0C, 0x19, 0xFF, 0x50, 0x54, 0x61, 0xFF, 0xB5, 0xB9, 0xC1, 0xFF, 0x72, 0x77, 0x88, 0xFF, 0x80, 0x60, 0x68, 0x7E, 0xFF, 0x1F, 0x57,
+    0x5F, 0x76, 0xFF, 0x52, 0x5A, 0x70, 0xFF, 0x52, 0x5A, 0x6F, 0xFF, 0x56, 0x5E, 0x74, 0xFF, 0x57, 0x5F, 0x75, 0xFF, 0x56, 0x5D, 0x73, 0xFF, 0x54,
+    0x5B, 0x72, 0xFF, 0x57, 0x5E, 0x74, 0xFF, 0x58, 0x60, 0x74, 0xFF, 0x59, 0x61, 0x75, 0xFF, 0x52, 0x5A, 0x6E, 0xFF, 0x37, 0x3D, 0x4F, 0xFF, 0x10,
+    0x13, 0x1D, 0xFF, 0x07, 0x08, 0x13, 0xFF, 0x06, 0x09, 0x13, 0xFF, 0x07, 0x0A, 0x14, 0xFF, 0x08, 0x0B, 0x17, 0xFF, 0x09, 0x0C, 0x19, 0xFF, 0x09,
+    0x0D, 0x1B, 0xFF, 0x0A, 0x0E, 0x1D, 0xFF, 0x0B, 0x0E, 0x1F, 0xFF, 0x0E, 0x11, 0x22, 0xFF, 0x11, 0x15, 0x23, 0xFF, 0x2C, 0x31, 0x44, 0xFF, 0x3D,
+    0x42, 0x58, 0xFF, 0x30, 0x36, 0x47, 0xFF, 0x4F, 0x55, 0x6C, 0xFF, 0x46, 0x4F, 0x65, 0xFF, 0x46, 0x4D, 0x64, 0xFF, 0x4A, 0x51, 0x68, 0xFF, 0x4C,
+    0x54, 0x69, 0xFF, 0x4D, 0x55, 0x6C, 0xFF, 0x80, 0x4A, 0x52, 0x68, 0xFF, 0x36, 0x4C, 0x54, 0x6B, 0xFF, 0x4E, 0x56, 0x6D, 0xFF, 0x50, 0x58, 0x6F,
+    0xFF, 0x51, 0x59, 0x6E, 0xFF, 0x50, 0x57, 0x6E, 0xFF, 0x4F, 0x58, 0x6E, 0xFF, 0x51, 0x58, 0x6F, 0xFF, 0x50, 0x58, 0x6F, 0xFF, 0x4F, 0x56, 0x6E,
+    0xFF, 0x1B, 0x1F, 0x2B, 0xFF, 0x06, 0x0A, 0x13, 0xFF, 0x06, 0x09, 0x13, 0xFF, 0x2A, 0x2D, 0x37, 0xFF, 0x6F, 0x74, 0x87, 0xFF, 0x59, 0x5E, 0x72,
+    0xFF, 0x88, 0x8E, 0x9C, 0xFF, 0x92, 0x99, 0xA9, 0xFF, 0x4E, 0x56, 0x6B, 0xFF, 0x49, 0x50, 0x67, 0xFF, 0x4A, 0x52, 0x68, 0xFF, 0x4A, 0x51, 0x67,
+    0xFF, 0x49, 0x51, 0x67, 0xFF, 0x47, 0x4F, 0x65, 0xFF, 0x43, 0x4B, 0x60, 0xFF, 0x43, 0x49, 0x60, 0xFF, 0x42, 0x48, 0x5F, 0xFF, 0x41, 0x48, 0x5F,
+    0xFF, 0x4B, 0x51, 0x69, 0xFF, 0x43, 0x4A, 0x60, 0xFF, 0x14, 0x1B, 0x2B, 0xFF, 0x09, 0x0F, 0x1E, 0xFF, 0x1A, 0x1C, 0x24, 0xFF, 0x9B, 0xA0, 0xB1,
+    0xFF, 0xA8, 0xAD, 0xBC, 0xFF, 0x93, 0x96, 0xA6, 0xFF, 0xBC, 0xC3, 0xD0, 0xFF, 0x5E, 0x68, 0x79, 0xFF, 0x1F, 0x26, 0x36, 0xFF, 0x2B, 0x31, 0x43,
+    0xFF, 0x28, 0x2F, 0x40, 0xFF, 0x25, 0x2A, 0x3C, 0xFF, 0x24, 0x29, 0x39, 0xFF, 0x24, 0x28, 0x38, 0xFF, 0x21, 0x27, 0x37, 0xFF, 0x1F, 0x24, 0x33,
+    0xFF, 0x1D, 0x23, 0x31, 0xFF, 0x21, 0x25, 0x34, 0xFF, 0x21, 0x26, 0x35, 0xFF, 0x1E, 0x24, 0x32, 0xFF, 0x22, 0x28, 0x35, 0xFF, 0x22, 0x28, 0x36,
+    0xFF, 0x14, 0x17, 0x23, 0xFF, 0x0A, 0x0D, 0x1A, 0xFF, 0x0A, 0x0C, 0x1A, 0xFF, 0x0A, 0x0C, 0x18, 0xFF, 0x80, 0x0A, 0x0C, 0x1A, 0xFF, 0x1B, 0x0A,
+    0x0B, 0x17, 0xFF, 0x10, 0x10, 0x1C, 0xFF, 0x2C, 0x2E, 0x41, 0xFF, 0x48, 0x49, 0x64, 0xFF, 0x31, 0x35, 0x4D, 0xFF, 0x1E, 0x1F, 0x35, 0xFF, 0x14,
+    0x16, 0x27, 0xFF, 0x1B, 0x1F, 0x2C, 0xFF, 0x28, 0x2B, 0x3A, 0xFF, 0x16, 0x1B, 0x26, 0xFF, 0x0C, 0x0F, 0x18, 0xFF, 0x0F, 0x12, 0x1A, 0xFF, 0x0E,
+    0x13, 0x1A, 0xFF, 0x0F, 0x14, 0x1B, 0xFF, 0x11, 0x15, 0x1D, 0xFF, 0x11, 0x15, 0x1C, 0xFF, 0x10, 0x14, 0x1B, 0xFF, 0x0E, 0x11, 0x17, 0xFF, 0x0C,
+    0x10, 0x16, 0xFF, 0x0D, 0x11, 0x17, 0xFF, 0x0E, 0x12, 0x18, 0xFF, 0x0F, 0x14, 0x1A, 0xFF, 0x0F, 0x13, 0x19, 0xFF, 0x0C, 0x10, 0x16, 0xFF, 0x1B,
+    0x21, 0x26, 0xFF, 0x02, 0x04, 0x06, 0xFF, 0x02, 0x03, 0x04, 0xFF, 0x01, 0x03, 0x05, 0xFF, 0x04, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x0B, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00,
+    0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01,
+    0x04, 0xFF, 0x00, 0x02, 0x03, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x02, 0x01, 0x05, 0xFF, 0x80, 0x01, 0x01, 0x05, 0xFF, 0x02,
+    0x02, 0x01, 0x06, 0xFF, 0x00, 0x02, 0x05, 0xFF, 0x02, 0x02, 0x07, 0xFF, 0x80, 0x01, 0x03, 0x06, 0xFF, 0x1A, 0x02, 0x03, 0x08, 0xFF, 0x02, 0x03,
+    0x06, 0xFF, 0x06, 0x0A, 0x0F, 0xFF, 0x14, 0x1A, 0x23, 0xFF, 0x11, 0x14, 0x1C, 0xFF, 0x13, 0x16, 0x1E, 0xFF, 0x12, 0x15, 0x1F, 0xFF, 0x12, 0x16,
+    0x1E, 0xFF, 0x11, 0x15, 0x1E, 0xFF, 0x11, 0x14, 0x1E, 0xFF, 0x12, 0x15, 0x1E, 0xFF, 0x13, 0x17, 0x22, 0xFF, 0x14, 0x19, 0x24, 0xFF, 0x15, 0x19,
+    0x25, 0xFF, 0x0D, 0x13, 0x1E, 0xFF, 0x83, 0x87, 0x91, 0xFF, 0x99, 0x9D, 0xA5, 0xFF, 0x21, 0x2D, 0x42, 0xFF, 0x4F, 0x55, 0x72, 0xFF, 0x69, 0x6C,
+    0x86, 0xFF, 0x5F, 0x5F, 0x76, 0xFF, 0x16, 0x17, 0x20, 0xFF, 0x05, 0x08, 0x0F, 0xFF, 0x03, 0x06, 0x0C, 0xFF, 0x1B, 0x1F, 0x2A, 0xFF, 0x2F, 0x33,
+    0x44, 0xFF, 0x1C, 0x1F, 0x2E, 0xFF, 0x80, 0x1F, 0x22, 0x32, 0xFF, 0x01, 0x22, 0x25, 0x36, 0xFF, 0x24, 0x29, 0x3A, 0xFF, 0x80, 0x26, 0x2B, 0x3C,
+    0xFF, 0x57, 0x28, 0x2C, 0x3D, 0xFF, 0x28, 0x2D, 0x3F, 0xFF, 0x27, 0x2E, 0x3E, 0xFF, 0x27, 0x2D, 0x3D, 0xFF, 0x5F, 0x65, 0x78, 0xFF, 0x8D, 0x94,
+    0xA8, 0xFF, 0x28, 0x30, 0x43, 0xFF, 0x51, 0x59, 0x71, 0xFF, 0x59, 0x61, 0x79, 0xFF, 0x3D, 0x42, 0x58, 0xFF, 0x30, 0x34, 0x47, 0xFF, 0x30, 0x36,
+    0x49, 0xFF, 0x34, 0x3A, 0x4E, 0xFF, 0x35, 0x3B, 0x4F, 0xFF, 0x32, 0x3B, 0x4D, 0xFF, 0x31, 0x39, 0x4C, 0xFF, 0x31, 0x39, 0x4D, 0xFF, 0x33, 0x3B,
+    0x50, 0xFF, 0x36, 0x3E, 0x52, 0xFF, 0x36, 0x3E, 0x54, 0xFF, 0x27, 0x31, 0x45, 0xFF, 0x89, 0x8F, 0x9A, 0xFF, 0xBC, 0xBF, 0xC9, 0xFF, 0xAA, 0xAF,
+    0xB8, 0xFF, 0x95, 0x98, 0xA5, 0xFF, 0x16, 0x18, 0x23, 0xFF, 0x0C, 0x0E, 0x22, 0xFF, 0x0D, 0x11, 0x27, 0xFF, 0x0B, 0x0F, 0x25, 0xFF, 0x0C, 0x0F,
+    0x24, 0xFF, 0x1D, 0x21, 0x2B, 0xFF, 0x6D, 0x72, 0x85, 0xFF, 0x43, 0x4B, 0x5F, 0xFF, 0x44, 0x4A, 0x64, 0xFF, 0x44, 0x4A, 0x62, 0xFF, 0x42, 0x4A,
+    0x5F, 0xFF, 0x41, 0x49, 0x5F, 0xFF, 0x43, 0x4D, 0x61, 0xFF, 0x44, 0x4D, 0x63, 0xFF, 0x46, 0x4F, 0x65, 0xFF, 0x48, 0x50, 0x65, 0xFF, 0x46, 0x4E,
+    0x65, 0xFF, 0x50, 0x58, 0x6E, 0xFF, 0x57, 0x5E, 0x72, 0xFF, 0x2C, 0x2F, 0x42, 0xFF, 0x39, 0x41, 0x56, 0xFF, 0x2E, 0x35, 0x4B, 0xFF, 0x4E, 0x54,
+    0x64, 0xFF, 0x6A, 0x71, 0x83, 0xFF, 0x55, 0x5C, 0x73, 0xFF, 0x54, 0x5A, 0x71, 0xFF, 0x54, 0x5A, 0x70, 0xFF, 0x50, 0x57, 0x6F, 0xFF, 0x4E, 0x55,
+    0x6B, 0xFF, 0x4A, 0x50, 0x68, 0xFF, 0x49, 0x51, 0x68, 0xFF, 0x4B, 0x51, 0x6A, 0xFF, 0x4D, 0x54, 0x6B, 0xFF, 0x4B, 0x51, 0x68, 0xFF, 0x51, 0x57,
+    0x6D, 0xFF, 0x91, 0x97, 0xA9, 0xFF, 0x7F, 0x85, 0x99, 0xFF, 0x49, 0x4C, 0x5B, 0xFF, 0x07, 0x09, 0x15, 0xFF, 0x10, 0x14, 0x27, 0xFF, 0x0C, 0x11,
+    0x1E, 0xFF, 0x1F, 0x23, 0x28, 0xFF, 0x8E, 0x93, 0x9C, 0xFF, 0x62, 0x68, 0x76, 0xFF, 0x50, 0x57, 0x6B, 0xFF, 0x55, 0x5D, 0x72, 0xFF, 0x59, 0x60,
+    0x77, 0xFF, 0x59, 0x60, 0x76, 0xFF, 0x54, 0x5C, 0x71, 0xFF, 0x51, 0x59, 0x6F, 0xFF, 0x53, 0x5B, 0x70, 0xFF, 0x59, 0x61, 0x76, 0xFF, 0x5D, 0x65,
+    0x7B, 0xFF, 0x5A, 0x61, 0x77, 0xFF, 0x66, 0x6D, 0x80, 0xFF, 0x64, 0x6D, 0x7E, 0xFF, 0x2D, 0x35, 0x4B, 0xFF, 0x20, 0x27, 0x3A, 0xFF, 0x0D, 0x11,
+    0x1D, 0xFF, 0x0D, 0x10, 0x1F, 0xFF, 0x0E, 0x13, 0x23, 0xFF, 0x0F, 0x14, 0x24, 0xFF, 0x0F, 0x13, 0x25, 0xFF, 0x80, 0x0E, 0x13, 0x24, 0xFF, 0x01,
+    0x0E, 0x14, 0x25, 0xFF, 0x10, 0x14, 0x24, 0xFF, 0x80, 0x0F, 0x14, 0x25, 0xFF, 0x51, 0x0E, 0x12, 0x23, 0xFF, 0x0C, 0x0F, 0x1D, 0xFF, 0x06, 0x0B,
+    0x16, 0xFF, 0x1C, 0x21, 0x2F, 0xFF, 0x61, 0x67, 0x7C, 0xFF, 0x5F, 0x66, 0x79, 0xFF, 0x5D, 0x65, 0x7A, 0xFF, 0x61, 0x6A, 0x7F, 0xFF, 0x5E, 0x67,
+    0x7B, 0xFF, 0x58, 0x62, 0x76, 0xFF, 0x56, 0x5E, 0x73, 0xFF, 0x51, 0x5A, 0x6F, 0xFF, 0x4E, 0x57, 0x6D, 0xFF, 0x50, 0x5A, 0x6F, 0xFF, 0x54, 0x5D,
+    0x73, 0xFF, 0x55, 0x5E, 0x71, 0xFF, 0x6F, 0x76, 0x84, 0xFF, 0x79, 0x80, 0x88, 0xFF, 0x10, 0x12, 0x1B, 0xFF, 0x09, 0x0D, 0x1A, 0xFF, 0x0C, 0x12,
+    0x21, 0xFF, 0x05, 0x08, 0x12, 0xFF, 0x82, 0x87, 0x93, 0xFF, 0xA7, 0xAC, 0xB6, 0xFF, 0x62, 0x69, 0x7D, 0xFF, 0x5D, 0x65, 0x7A, 0xFF, 0x5D, 0x64,
+    0x7B, 0xFF, 0x55, 0x5E, 0x73, 0xFF, 0x4F, 0x57, 0x6C, 0xFF, 0x50, 0x56, 0x6B, 0xFF, 0x50, 0x57, 0x6C, 0xFF, 0x52, 0x5A, 0x70, 0xFF, 0x53, 0x59,
+    0x71, 0xFF, 0x53, 0x5B, 0x71, 0xFF, 0x55, 0x5D, 0x72, 0xFF, 0x54, 0x5C, 0x70, 0xFF, 0x50, 0x58, 0x6D, 0xFF, 0x33, 0x3A, 0x4B, 0xFF, 0x11, 0x13,
+    0x20, 0xFF, 0x09, 0x0D, 0x1A, 0xFF, 0x0A, 0x0D, 0x19, 0xFF, 0x09, 0x0C, 0x18, 0xFF, 0x08, 0x0B, 0x17, 0xFF, 0x09, 0x0B, 0x17, 0xFF, 0x09, 0x0C,
+    0x19, 0xFF, 0x09, 0x0D, 0x1A, 0xFF, 0x0A, 0x0E, 0x1C, 0xFF, 0x0C, 0x0F, 0x20, 0xFF, 0x0D, 0x10, 0x20, 0xFF, 0x0A, 0x0E, 0x1C, 0xFF, 0x09, 0x0D,
+    0x19, 0xFF, 0x22, 0x26, 0x36, 0xFF, 0x35, 0x39, 0x4D, 0xFF, 0x2E, 0x33, 0x43, 0xFF, 0x4C, 0x53, 0x69, 0xFF, 0x44, 0x4C, 0x62, 0xFF, 0x44, 0x4B,
+    0x62, 0xFF, 0x48, 0x4F, 0x65, 0xFF, 0x4A, 0x51, 0x67, 0xFF, 0x46, 0x4D, 0x62, 0xFF, 0x47, 0x4E, 0x64, 0xFF, 0x4A, 0x51, 0x68, 0xFF, 0x4B, 0x53,
+    0x69, 0xFF, 0x4E, 0x55, 0x6C, 0xFF, 0x4F, 0x57, 0x6D, 0xFF, 0x4C, 0x53, 0x6B, 0xFF, 0x4C, 0x54, 0x6A, 0xFF, 0x4E, 0x56, 0x6B, 0xFF, 0x4E, 0x56,
+    0x6D, 0xFF, 0x4F, 0x56, 0x6C, 0xFF, 0x1C, 0x20, 0x2B, 0xFF, 0x06, 0x0A, 0x13, 0xFF, 0x06, 0x08, 0x12, 0xFF, 0x28, 0x2A, 0x36, 0xFF, 0x6D, 0x71,
+    0x84, 0xFF, 0x56, 0x5C, 0x70, 0xFF, 0x87, 0x8C, 0x9C, 0xFF, 0x90, 0x97, 0xA7, 0xFF, 0x4B, 0x52, 0x68, 0xFF, 0x46, 0x4D, 0x63, 0xFF, 0x47, 0x4E,
+    0x63, 0xFF, 0x45, 0x4D, 0x62, 0xFF, 0x80, 0x45, 0x4C, 0x62, 0xFF, 0x20, 0x42, 0x49, 0x5F, 0xFF, 0x41, 0x48, 0x5E, 0xFF, 0x40, 0x47, 0x5C, 0xFF,
+    0x3F, 0x45, 0x5C, 0xFF, 0x48, 0x4E, 0x65, 0xFF, 0x42, 0x48, 0x5E, 0xFF, 0x13, 0x1B, 0x2A, 0xFF, 0x09, 0x0E, 0x19, 0xFF, 0x38, 0x3A, 0x44, 0xFF,
+    0xA8, 0xAC, 0xBA, 0xFF, 0x93, 0x97, 0xA8, 0xFF, 0x96, 0x98, 0xA8, 0xFF, 0xAE, 0xB8, 0xC6, 0xFF, 0x48, 0x53, 0x6B, 0xFF, 0x24, 0x2B, 0x3B, 0xFF,
+    0x29, 0x30, 0x3F, 0xFF, 0x27, 0x2D, 0x3E, 0xFF, 0x24, 0x2A, 0x39, 0xFF, 0x22, 0x28, 0x35, 0xFF, 0x21, 0x26, 0x35, 0xFF, 0x21, 0x26, 0x34, 0xFF,
+    0x1E, 0x23, 0x31, 0xFF, 0x1C, 0x22, 0x2E, 0xFF, 0x1D, 0x23, 0x2F, 0xFF, 0x1D, 0x22, 0x2F, 0xFF, 0x1E, 0x22, 0x2E, 0xFF, 0x1D, 0x22, 0x30, 0xFF,
+    0x0C, 0x0F, 0x1B, 0xFF, 0x0B, 0x0D, 0x1B, 0xFF, 0x09, 0x0D, 0x1A, 0xFF, 0x09, 0x0C, 0x19, 0xFF, 0x08, 0x0B, 0x18, 0xFF, 0x08, 0x0C, 0x18, 0xFF,
+    0x80, 0x08, 0x0C, 0x19, 0xFF, 0x1A, 0x06, 0x0A, 0x16, 0xFF, 0x07, 0x07, 0x12, 0xFF, 0x29, 0x28, 0x3A, 0xFF, 0x43, 0x45, 0x60, 0xFF, 0x37, 0x37,
+    0x51, 0xFF, 0x1F, 0x1F, 0x33, 0xFF, 0x12, 0x13, 0x21, 0xFF, 0x16, 0x19, 0x26, 0xFF, 0x26, 0x2A, 0x38, 0xFF, 0x1A, 0x1D, 0x27, 0xFF, 0x0A, 0x0F,
+    0x16, 0xFF, 0x0F, 0x14, 0x1B, 0xFF, 0x10, 0x15, 0x1C, 0xFF, 0x11, 0x16, 0x1D, 0xFF, 0x11, 0x15, 0x1D, 0xFF, 0x10, 0x14, 0x1B, 0xFF, 0x0D, 0x11,
+    0x17, 0xFF, 0x0C, 0x10, 0x16, 0xFF, 0x0D, 0x11, 0x18, 0xFF, 0x0E, 0x12, 0x18, 0xFF, 0x0E, 0x13, 0x19, 0xFF, 0x0E, 0x12, 0x19, 0xFF, 0x0C, 0x10,
+    0x15, 0xFF, 0x1A, 0x20, 0x25, 0xFF, 0x03, 0x04, 0x07, 0xFF, 0x02, 0x03, 0x05, 0xFF, 0x02, 0x04, 0x06, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x03, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x02, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x02, 0xFF, 0x09, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x01,
+    0x01, 0x04, 0xFF, 0x01, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x02, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x02, 0x03, 0xFF, 0x01,
+    0x01, 0x05, 0xFF, 0x01, 0x00, 0x05, 0xFF, 0x80, 0x01, 0x01, 0x05, 0xFF, 0x09, 0x01, 0x03, 0x05, 0xFF, 0x02, 0x02, 0x07, 0xFF, 0x01, 0x03, 0x07,
+    0xFF, 0x02, 0x04, 0x08, 0xFF, 0x02, 0x03, 0x06, 0xFF, 0x06, 0x0A, 0x0F, 0xFF, 0x14, 0x1B, 0x23, 0xFF, 0x10, 0x15, 0x1C, 0xFF, 0x11, 0x16, 0x1D,
+    0xFF, 0x10, 0x15, 0x1C, 0xFF, 0x80, 0x10, 0x13, 0x1C, 0xFF, 0x3E, 0x0F, 0x14, 0x1C, 0xFF, 0x11, 0x15, 0x1E, 0xFF, 0x13, 0x17, 0x20, 0xFF, 0x14,
+    0x19, 0x24, 0xFF, 0x15, 0x19, 0x26, 0xFF, 0x0E, 0x13, 0x1D, 0xFF, 0x83, 0x87, 0x8F, 0xFF, 0x97, 0x9D, 0xA5, 0xFF, 0x1C, 0x2A, 0x40, 0xFF, 0x4E,
+    0x54, 0x70, 0xFF, 0x66, 0x68, 0x84, 0xFF, 0x5C, 0x5D, 0x74, 0xFF, 0x15, 0x16, 0x1F, 0xFF, 0x05, 0x08, 0x0E, 0xFF, 0x04, 0x06, 0x0C, 0xFF, 0x1B,
+    0x1F, 0x2A, 0xFF, 0x2D, 0x31, 0x42, 0xFF, 0x1B, 0x1D, 0x2D, 0xFF, 0x1D, 0x20, 0x30, 0xFF, 0x1E, 0x21, 0x31, 0xFF, 0x21, 0x24, 0x33, 0xFF, 0x23,
+    0x28, 0x37, 0xFF, 0x25, 0x29, 0x39, 0xFF, 0x27, 0x2B, 0x3A, 0xFF, 0x26, 0x2C, 0x3C, 0xFF, 0x26, 0x2B, 0x3C, 0xFF, 0x25, 0x2C, 0x3A, 0xFF, 0x27,
+    0x2D, 0x3D, 0xFF, 0x5D, 0x64, 0x76, 0xFF, 0x8E, 0x96, 0xA9, 0xFF, 0x2E, 0x35, 0x4B, 0xFF, 0x56, 0x60, 0x76, 0xFF, 0x5B, 0x63, 0x7B, 0xFF, 0x2A,
+    0x2F, 0x3F, 0xFF, 0x34, 0x3A, 0x4D, 0xFF, 0x2E, 0x34, 0x47, 0xFF, 0x32, 0x39, 0x4C, 0xFF, 0x32, 0x39, 0x4D, 0xFF, 0x30, 0x38, 0x4A, 0xFF, 0x30,
+    0x36, 0x49, 0xFF, 0x31, 0x38, 0x4B, 0xFF, 0x32, 0x3A, 0x4E, 0xFF, 0x35, 0x3D, 0x51, 0xFF, 0x38, 0x3F, 0x54, 0xFF, 0x2C, 0x33, 0x49, 0xFF, 0x65,
+    0x6D, 0x81, 0xFF, 0xC1, 0xC5, 0xCE, 0xFF, 0xB0, 0xB4, 0xBD, 0xFF, 0xAC, 0xB0, 0xB9, 0xFF, 0x35, 0x37, 0x45, 0xFF, 0x0B, 0x0C, 0x1F, 0xFF, 0x0D,
+    0x11, 0x29, 0xFF, 0x0B, 0x0F, 0x25, 0xFF, 0x0B, 0x0D, 0x20, 0xFF, 0x42, 0x48, 0x57, 0xFF, 0x5D, 0x63, 0x74, 0xFF, 0x41, 0x48, 0x5E, 0xFF, 0x42,
+    0x49, 0x5F, 0xFF, 0x40, 0x48, 0x5D, 0xFF, 0x3F, 0x48, 0x5C, 0xFF, 0x40, 0x48, 0x5C, 0xFF, 0x40, 0x48, 0x5D, 0xFF, 0x41, 0x4A, 0x5F, 0xFF, 0x80,
+    0x45, 0x4D, 0x63, 0xFF, 0x64, 0x3C, 0x45, 0x58, 0xFF, 0x55, 0x5C, 0x73, 0xFF, 0x43, 0x49, 0x5C, 0xFF, 0x2B, 0x2F, 0x40, 0xFF, 0x3C, 0x42, 0x5B,
+    0xFF, 0x13, 0x19, 0x28, 0xFF, 0x4B, 0x52, 0x62, 0xFF, 0x66, 0x6C, 0x7F, 0xFF, 0x54, 0x5C, 0x70, 0xFF, 0x53, 0x5A, 0x6F, 0xFF, 0x50, 0x56, 0x6D,
+    0xFF, 0x4E, 0x54, 0x6C, 0xFF, 0x4D, 0x54, 0x6A, 0xFF, 0x49, 0x4F, 0x66, 0xFF, 0x46, 0x4C, 0x64, 0xFF, 0x45, 0x4B, 0x63, 0xFF, 0x48, 0x4F, 0x66,
+    0xFF, 0x4C, 0x51, 0x69, 0xFF, 0x50, 0x56, 0x6C, 0xFF, 0x8E, 0x94, 0xA6, 0xFF, 0x79, 0x80, 0x95, 0xFF, 0x47, 0x4A, 0x59, 0xFF, 0x06, 0x08, 0x13,
+    0xFF, 0x0D, 0x12, 0x24, 0xFF, 0x08, 0x0D, 0x19, 0xFF, 0x3C, 0x3F, 0x44, 0xFF, 0x8B, 0x90, 0x97, 0xFF, 0x57, 0x5D, 0x6F, 0xFF, 0x4F, 0x57, 0x6A,
+    0xFF, 0x51, 0x5A, 0x6E, 0xFF, 0x53, 0x5B, 0x71, 0xFF, 0x54, 0x5D, 0x70, 0xFF, 0x52, 0x5A, 0x6F, 0xFF, 0x50, 0x57, 0x6D, 0xFF, 0x50, 0x58, 0x6D,
+    0xFF, 0x56, 0x5D, 0x73, 0xFF, 0x5A, 0x62, 0x77, 0xFF, 0x59, 0x60, 0x75, 0xFF, 0x72, 0x7A, 0x8A, 0xFF, 0x53, 0x5B, 0x6B, 0xFF, 0x25, 0x2D, 0x43,
+    0xFF, 0x0A, 0x10, 0x1B, 0xFF, 0x0D, 0x10, 0x20, 0xFF, 0x0E, 0x12, 0x22, 0xFF, 0x0F, 0x13, 0x24, 0xFF, 0x0F, 0x15, 0x26, 0xFF, 0x10, 0x15, 0x27,
+    0xFF, 0x10, 0x16, 0x27, 0xFF, 0x10, 0x16, 0x28, 0xFF, 0x10, 0x15, 0x27, 0xFF, 0x10, 0x15, 0x28, 0xFF, 0x0F, 0x15, 0x27, 0xFF, 0x0F, 0x14, 0x25,
+    0xFF, 0x0E, 0x13, 0x23, 0xFF, 0x0D, 0x11, 0x21, 0xFF, 0x09, 0x0E, 0x1C, 0xFF, 0x04, 0x0A, 0x16, 0xFF, 0x3C, 0x45, 0x56, 0xFF, 0x7C, 0x84, 0x96,
+    0xFF, 0x60, 0x69, 0x7B, 0xFF, 0x5D, 0x66, 0x7C, 0xFF, 0x5C, 0x66, 0x7B, 0xFF, 0x52, 0x5C, 0x71, 0xFF, 0x4D, 0x56, 0x6B, 0xFF, 0x4E, 0x57, 0x6C,
+    0xFF, 0x4E, 0x57, 0x6B, 0xFF, 0x4E, 0x58, 0x6D, 0xFF, 0x4F, 0x58, 0x6D, 0xFF, 0x55, 0x5F, 0x73, 0xFF, 0x60, 0x66, 0x76, 0xFF, 0x82, 0x88, 0x91,
+    0xFF, 0x4B, 0x4F, 0x55, 0xFF, 0x07, 0x09, 0x13, 0xFF, 0x0A, 0x0E, 0x1B, 0xFF, 0x2D, 0x31, 0x3C, 0xFF, 0x95, 0x98, 0xA6, 0xFF, 0x87, 0x8A, 0x99,
+    0xFF, 0x5E, 0x64, 0x7A, 0xFF, 0x56, 0x5E, 0x73, 0xFF, 0x55, 0x5D, 0x73, 0xFF, 0x54, 0x5C, 0x71, 0xFF, 0x4F, 0x55, 0x6B, 0xFF, 0x4C, 0x53, 0x67,
+    0xFF, 0x4B, 0x52, 0x66, 0xFF, 0x4D, 0x55, 0x6B, 0xFF, 0x50, 0x57, 0x6D, 0xFF, 0x51, 0x59, 0x6F, 0xFF, 0x52, 0x5B, 0x70, 0xFF, 0x4D, 0x55, 0x69,
+    0xFF, 0x3C, 0x43, 0x54, 0xFF, 0x18, 0x1D, 0x29, 0xFF, 0x09, 0x0C, 0x19, 0xFF, 0x0A, 0x0D, 0x1C, 0xFF, 0x09, 0x0D, 0x1A, 0xFF, 0x09, 0x0C, 0x18,
+    0xFF, 0x07, 0x0B, 0x16, 0xFF, 0x08, 0x0B, 0x16, 0xFF, 0x08, 0x0C, 0x18, 0xFF, 0x09, 0x0D, 0x19, 0xFF, 0x0A, 0x0D, 0x1B, 0xFF, 0x0B, 0x0E, 0x1C,
+    0xFF, 0x80, 0x0B, 0x0E, 0x1D, 0xFF, 0x1E, 0x0A, 0x0D, 0x1A, 0xFF, 0x07, 0x09, 0x15, 0xFF, 0x23, 0x29, 0x38, 0xFF, 0x33, 0x39, 0x4A, 0xFF, 0x26,
+    0x2B, 0x3B, 0xFF, 0x50, 0x56, 0x6C, 0xFF, 0x48, 0x4E, 0x63, 0xFF, 0x4A, 0x50, 0x66, 0xFF, 0x48, 0x4E, 0x63, 0xFF, 0x44, 0x4C, 0x61, 0xFF, 0x42,
+    0x4A, 0x5F, 0xFF, 0x45, 0x4C, 0x63, 0xFF, 0x47, 0x4E, 0x64, 0xFF, 0x49, 0x50, 0x66, 0xFF, 0x4A, 0x51, 0x67, 0xFF, 0x48, 0x50, 0x64, 0xFF, 0x49,
+    0x51, 0x66, 0xFF, 0x4B, 0x54, 0x69, 0xFF, 0x4C, 0x55, 0x6B, 0xFF, 0x4D, 0x55, 0x6B, 0xFF, 0x1B, 0x20, 0x2B, 0xFF, 0x06, 0x0B, 0x12, 0xFF, 0x05,
+    0x09, 0x11, 0xFF, 0x27, 0x2A, 0x34, 0xFF, 0x6B, 0x6F, 0x81, 0xFF, 0x52, 0x59, 0x6C, 0xFF, 0x86, 0x8C, 0x9A, 0xFF, 0x8E, 0x95, 0xA4, 0xFF, 0x49,
+    0x4F, 0x64, 0xFF, 0x44, 0x4B, 0x61, 0xFF, 0x44, 0x4B, 0x5F, 0xFF, 0x80, 0x41, 0x49, 0x5E, 0xFF, 0x1F, 0x41, 0x49, 0x5D, 0xFF, 0x41, 0x48, 0x5D,
+    0xFF, 0x41, 0x47, 0x5E, 0xFF, 0x41, 0x46, 0x5E, 0xFF, 0x3F, 0x45, 0x5D, 0xFF, 0x45, 0x4C, 0x62, 0xFF, 0x40, 0x46, 0x5A, 0xFF, 0x11, 0x18, 0x26,
+    0xFF, 0x04, 0x08, 0x12, 0xFF, 0x7C, 0x80, 0x92, 0xFF, 0xA5, 0xA9, 0xB9, 0xFF, 0x81, 0x83, 0x96, 0xFF, 0x9B, 0xA0, 0xAF, 0xFF, 0x8E, 0x99, 0xA8,
+    0xFF, 0x27, 0x32, 0x49, 0xFF, 0x29, 0x2F, 0x3F, 0xFF, 0x29, 0x2E, 0x3E, 0xFF, 0x25, 0x2C, 0x3C, 0xFF, 0x23, 0x2A, 0x38, 0xFF, 0x20, 0x26, 0x34,
+    0xFF, 0x1F, 0x25, 0x34, 0xFF, 0x20, 0x25, 0x33, 0xFF, 0x1F, 0x25, 0x33, 0xFF, 0x1C, 0x22, 0x30, 0xFF, 0x1A, 0x20, 0x2B, 0xFF, 0x1B, 0x1F, 0x2A,
+    0xFF, 0x19, 0x1F, 0x29, 0xFF, 0x0D, 0x0F, 0x1A, 0xFF, 0x08, 0x0A, 0x15, 0xFF, 0x09, 0x0C, 0x18, 0xFF, 0x09, 0x0B, 0x18, 0xFF, 0x07, 0x0B, 0x18,
+    0xFF, 0x81, 0x07, 0x0A, 0x16, 0xFF, 0x0B, 0x06, 0x0A, 0x17, 0xFF, 0x07, 0x0B, 0x18, 0xFF, 0x08, 0x0B, 0x1A, 0xFF, 0x0A, 0x0A, 0x15, 0xFF, 0x36,
+    0x34, 0x49, 0xFF, 0x46, 0x47, 0x64, 0xFF, 0x31, 0x32, 0x4B, 0xFF, 0x1B, 0x1B, 0x2E, 0xFF, 0x11, 0x11, 0x20, 0xFF, 0x22, 0x25, 0x31, 0xFF, 0x34,
+    0x39, 0x46, 0xFF, 0x14, 0x18, 0x24, 0xFF, 0x81, 0x0E, 0x13, 0x1A, 0xFF, 0x01, 0x0E, 0x14, 0x1A, 0xFF, 0x0E, 0x13, 0x19, 0xFF, 0x80, 0x0C, 0x11,
+    0x17, 0xFF, 0x01, 0x0D, 0x12, 0x18, 0xFF, 0x0D, 0x11, 0x17, 0xFF, 0x80, 0x0E, 0x12, 0x18, 0xFF, 0x04, 0x0C, 0x10, 0x15, 0xFF, 0x1B, 0x20, 0x26,
+    0xFF, 0x03, 0x05, 0x08, 0xFF, 0x02, 0x03, 0x05, 0xFF, 0x02, 0x04, 0x06, 0xFF, 0x03, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00,
+    0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x09, 0x01, 0x00,
+    0x02, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x01,
+    0x03, 0xFF, 0x00, 0x02, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x80, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x02, 0x05, 0xFF,
+    0x80, 0x01, 0x02, 0x06, 0xFF, 0x80, 0x01, 0x03, 0x06, 0xFF, 0x20, 0x01, 0x03, 0x07, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x06, 0x0A, 0x0F, 0xFF, 0x14,
+    0x1A, 0x22, 0xFF, 0x0F, 0x13, 0x1B, 0xFF, 0x11, 0x14, 0x1C, 0xFF, 0x0F, 0x13, 0x1A, 0xFF, 0x0F, 0x12, 0x19, 0xFF, 0x0F, 0x12, 0x1A, 0xFF, 0x0E,
+    0x13, 0x1C, 0xFF, 0x10, 0x14, 0x1D, 0xFF, 0x11, 0x14, 0x1E, 0xFF, 0x13, 0x17, 0x21, 0xFF, 0x14, 0x18, 0x25, 0xFF, 0x0D, 0x12, 0x1D, 0xFF, 0x80,
+    0x83, 0x8A, 0xFF, 0x94, 0x9A, 0xA0, 0xFF, 0x18, 0x24, 0x39, 0xFF, 0x4B, 0x52, 0x6E, 0xFF, 0x64, 0x66, 0x81, 0xFF, 0x5A, 0x5B, 0x71, 0xFF, 0x14,
+    0x15, 0x1E, 0xFF, 0x04, 0x07, 0x0D, 0xFF, 0x04, 0x06, 0x0B, 0xFF, 0x1B, 0x1E, 0x2A, 0xFF, 0x2D, 0x31, 0x43, 0xFF, 0x1C, 0x1F, 0x2E, 0xFF, 0x1F,
+    0x22, 0x32, 0xFF, 0x1E, 0x22, 0x31, 0xFF, 0x21, 0x24, 0x33, 0xFF, 0x22, 0x27, 0x36, 0xFF, 0x23, 0x27, 0x38, 0xFF, 0x24, 0x29, 0x39, 0xFF, 0x80,
+    0x25, 0x2A, 0x3A, 0xFF, 0x75, 0x25, 0x2C, 0x3B, 0xFF, 0x27, 0x2D, 0x3C, 0xFF, 0x5D, 0x63, 0x74, 0xFF, 0x8F, 0x96, 0xA8, 0xFF, 0x30, 0x37, 0x4E,
+    0xFF, 0x57, 0x60, 0x77, 0xFF, 0x58, 0x5F, 0x78, 0xFF, 0x1E, 0x22, 0x31, 0xFF, 0x2C, 0x30, 0x44, 0xFF, 0x2A, 0x31, 0x41, 0xFF, 0x2D, 0x32, 0x46,
+    0xFF, 0x2F, 0x35, 0x48, 0xFF, 0x2E, 0x35, 0x47, 0xFF, 0x2E, 0x35, 0x48, 0xFF, 0x30, 0x36, 0x49, 0xFF, 0x31, 0x37, 0x4B, 0xFF, 0x32, 0x3A, 0x4E,
+    0xFF, 0x36, 0x3D, 0x52, 0xFF, 0x37, 0x3D, 0x54, 0xFF, 0x30, 0x3A, 0x50, 0xFF, 0xAA, 0xAF, 0xB8, 0xFF, 0xBC, 0xC0, 0xC8, 0xFF, 0xB3, 0xB7, 0xC1,
+    0xFF, 0x90, 0x93, 0xA0, 0xFF, 0x0A, 0x0F, 0x1F, 0xFF, 0x0F, 0x14, 0x2A, 0xFF, 0x0C, 0x0F, 0x25, 0xFF, 0x0A, 0x0F, 0x1A, 0xFF, 0x5F, 0x65, 0x78,
+    0xFF, 0x41, 0x48, 0x5A, 0xFF, 0x3A, 0x41, 0x58, 0xFF, 0x3C, 0x43, 0x5A, 0xFF, 0x39, 0x42, 0x57, 0xFF, 0x3A, 0x42, 0x55, 0xFF, 0x3A, 0x43, 0x56,
+    0xFF, 0x3B, 0x44, 0x58, 0xFF, 0x3E, 0x46, 0x5A, 0xFF, 0x41, 0x49, 0x5E, 0xFF, 0x42, 0x4B, 0x60, 0xFF, 0x42, 0x49, 0x5E, 0xFF, 0x49, 0x50, 0x64,
+    0xFF, 0x28, 0x2D, 0x3C, 0xFF, 0x39, 0x3D, 0x54, 0xFF, 0x29, 0x2F, 0x41, 0xFF, 0x0A, 0x0E, 0x1A, 0xFF, 0x49, 0x4F, 0x60, 0xFF, 0x60, 0x65, 0x7A,
+    0xFF, 0x51, 0x57, 0x6C, 0xFF, 0x4E, 0x55, 0x6A, 0xFF, 0x49, 0x4F, 0x66, 0xFF, 0x46, 0x4D, 0x65, 0xFF, 0x49, 0x4F, 0x66, 0xFF, 0x4A, 0x4F, 0x66,
+    0xFF, 0x43, 0x4A, 0x61, 0xFF, 0x40, 0x48, 0x5D, 0xFF, 0x46, 0x4C, 0x63, 0xFF, 0x49, 0x4F, 0x67, 0xFF, 0x4E, 0x54, 0x69, 0xFF, 0x8B, 0x90, 0xA3,
+    0xFF, 0x75, 0x7C, 0x93, 0xFF, 0x45, 0x48, 0x58, 0xFF, 0x06, 0x08, 0x12, 0xFF, 0x0E, 0x13, 0x23, 0xFF, 0x06, 0x0B, 0x16, 0xFF, 0x7A, 0x7F, 0x88,
+    0xFF, 0x77, 0x7C, 0x86, 0xFF, 0x58, 0x5F, 0x72, 0xFF, 0x4F, 0x57, 0x6A, 0xFF, 0x4E, 0x56, 0x6B, 0xFF, 0x4D, 0x55, 0x6B, 0xFF, 0x4D, 0x56, 0x6B,
+    0xFF, 0x50, 0x58, 0x6D, 0xFF, 0x50, 0x57, 0x6D, 0xFF, 0x50, 0x58, 0x6E, 0xFF, 0x54, 0x5C, 0x72, 0xFF, 0x53, 0x5B, 0x6F, 0xFF, 0x6C, 0x72, 0x85,
+    0xFF, 0x69, 0x6F, 0x83, 0xFF, 0x46, 0x4D, 0x63, 0xFF, 0x13, 0x18, 0x2B, 0xFF, 0x07, 0x09, 0x13, 0xFF, 0x07, 0x09, 0x14, 0xFF, 0x08, 0x0A, 0x16,
+    0xFF, 0x08, 0x0B, 0x16, 0xFF, 0x0A, 0x0D, 0x19, 0xFF, 0x0A, 0x0E, 0x1A, 0xFF, 0x0B, 0x0E, 0x1A, 0xFF, 0x0C, 0x0D, 0x1A, 0xFF, 0x0B, 0x0D, 0x1A,
+    0xFF, 0x0A, 0x0D, 0x1A, 0xFF, 0x0A, 0x0D, 0x19, 0xFF, 0x09, 0x0C, 0x18, 0xFF, 0x07, 0x0A, 0x15, 0xFF, 0x05, 0x08, 0x12, 0xFF, 0x05, 0x08, 0x11,
+    0xFF, 0x05, 0x07, 0x10, 0xFF, 0x12, 0x17, 0x21, 0xFF, 0x6E, 0x74, 0x85, 0xFF, 0x6A, 0x70, 0x82, 0xFF, 0x55, 0x5F, 0x74, 0xFF, 0x55, 0x5E, 0x74,
+    0xFF, 0x4D, 0x56, 0x6B, 0xFF, 0x4B, 0x53, 0x69, 0xFF, 0x4D, 0x57, 0x6C, 0xFF, 0x4D, 0x55, 0x6B, 0xFF, 0x4B, 0x54, 0x69, 0xFF, 0x4C, 0x54, 0x69,
+    0xFF, 0x54, 0x5C, 0x72, 0xFF, 0x56, 0x5C, 0x6E, 0xFF, 0x82, 0x87, 0x90, 0xFF, 0x60, 0x65, 0x6A, 0xFF, 0x05, 0x07, 0x11, 0xFF, 0x06, 0x0A, 0x16,
+    0xFF, 0x4C, 0x50, 0x5C, 0xFF, 0xA5, 0xA9, 0xB4, 0xFF, 0x6C, 0x71, 0x80, 0xFF, 0x59, 0x60, 0x76, 0xFF, 0x54, 0x5C, 0x71, 0xFF, 0x80, 0x52, 0x5A,
+    0x6F, 0xFF, 0x11, 0x50, 0x56, 0x6B, 0xFF, 0x4C, 0x52, 0x67, 0xFF, 0x4A, 0x50, 0x66, 0xFF, 0x4D, 0x54, 0x6A, 0xFF, 0x4F, 0x56, 0x6B, 0xFF, 0x4D,
+    0x55, 0x6A, 0xFF, 0x4C, 0x54, 0x68, 0xFF, 0x49, 0x50, 0x62, 0xFF, 0x1C, 0x20, 0x2D, 0xFF, 0x09, 0x0C, 0x17, 0xFF, 0x0C, 0x0F, 0x1C, 0xFF, 0x0B,
+    0x0E, 0x1B, 0xFF, 0x09, 0x0C, 0x19, 0xFF, 0x08, 0x0C, 0x18, 0xFF, 0x07, 0x0B, 0x16, 0xFF, 0x09, 0x0B, 0x16, 0xFF, 0x08, 0x0B, 0x16, 0xFF, 0x08,
+    0x0A, 0x17, 0xFF, 0x80, 0x09, 0x0C, 0x19, 0xFF, 0x80, 0x09, 0x0C, 0x1A, 0xFF, 0x09, 0x0A, 0x0C, 0x19, 0xFF, 0x06, 0x09, 0x13, 0xFF, 0x0B, 0x0D,
+    0x17, 0xFF, 0x2C, 0x32, 0x43, 0xFF, 0x2B, 0x30, 0x42, 0xFF, 0x4A, 0x50, 0x62, 0xFF, 0x52, 0x59, 0x6F, 0xFF, 0x48, 0x4E, 0x65, 0xFF, 0x47, 0x4E,
+    0x65, 0xFF, 0x45, 0x4C, 0x63, 0xFF, 0x80, 0x42, 0x4A, 0x5F, 0xFF, 0x33, 0x44, 0x4C, 0x62, 0xFF, 0x45, 0x4D, 0x62, 0xFF, 0x48, 0x4F, 0x63, 0xFF,
+    0x48, 0x4E, 0x63, 0xFF, 0x49, 0x50, 0x65, 0xFF, 0x4B, 0x53, 0x67, 0xFF, 0x4B, 0x53, 0x68, 0xFF, 0x4D, 0x54, 0x6B, 0xFF, 0x1B, 0x20, 0x2C, 0xFF,
+    0x06, 0x0A, 0x12, 0xFF, 0x05, 0x08, 0x12, 0xFF, 0x24, 0x27, 0x32, 0xFF, 0x66, 0x6B, 0x7E, 0xFF, 0x4E, 0x54, 0x68, 0xFF, 0x84, 0x89, 0x99, 0xFF,
+    0x8B, 0x92, 0xA2, 0xFF, 0x45, 0x4C, 0x60, 0xFF, 0x42, 0x48, 0x5E, 0xFF, 0x40, 0x47, 0x5C, 0xFF, 0x3F, 0x45, 0x59, 0xFF, 0x3E, 0x44, 0x5A, 0xFF,
+    0x3D, 0x44, 0x5A, 0xFF, 0x3D, 0x45, 0x5B, 0xFF, 0x3D, 0x44, 0x5B, 0xFF, 0x3F, 0x44, 0x5B, 0xFF, 0x3C, 0x43, 0x59, 0xFF, 0x41, 0x48, 0x5D, 0xFF,
+    0x3D, 0x43, 0x58, 0xFF, 0x0F, 0x15, 0x22, 0xFF, 0x06, 0x09, 0x12, 0xFF, 0x89, 0x8E, 0xA1, 0xFF, 0x99, 0x9E, 0xB1, 0xFF, 0x75, 0x76, 0x88, 0xFF,
+    0xA7, 0xAF, 0xBC, 0xFF, 0x7C, 0x87, 0x97, 0xFF, 0x16, 0x1F, 0x2E, 0xFF, 0x28, 0x2E, 0x3E, 0xFF, 0x28, 0x2C, 0x3C, 0xFF, 0x23, 0x2A, 0x39, 0xFF,
+    0x1F, 0x27, 0x34, 0xFF, 0x1D, 0x24, 0x31, 0xFF, 0x1E, 0x24, 0x32, 0xFF, 0x1D, 0x23, 0x32, 0xFF, 0x1E, 0x23, 0x33, 0xFF, 0x1D, 0x22, 0x30, 0xFF,
+    0x19, 0x1D, 0x2A, 0xFF, 0x19, 0x1D, 0x28, 0xFF, 0x12, 0x15, 0x1F, 0xFF, 0x04, 0x05, 0x0D, 0xFF, 0x07, 0x09, 0x12, 0xFF, 0x08, 0x0A, 0x15, 0xFF,
+    0x08, 0x0A, 0x16, 0xFF, 0x80, 0x06, 0x0A, 0x16, 0xFF, 0x00, 0x08, 0x09, 0x16, 0xFF, 0x80, 0x06, 0x09, 0x15, 0xFF, 0x0E, 0x06, 0x0A, 0x15, 0xFF,
+    0x07, 0x09, 0x16, 0xFF, 0x04, 0x07, 0x12, 0xFF, 0x10, 0x0F, 0x1B, 0xFF, 0x39, 0x39, 0x51, 0xFF, 0x42, 0x44, 0x5F, 0xFF, 0x2C, 0x2D, 0x46, 0xFF,
+    0x19, 0x19, 0x2B, 0xFF, 0x13, 0x13, 0x1F, 0xFF, 0x30, 0x34, 0x41, 0xFF, 0x26, 0x2B, 0x3A, 0xFF, 0x0A, 0x0E, 0x15, 0xFF, 0x0C, 0x10, 0x17, 0xFF,
+    0x0D, 0x12, 0x19, 0xFF, 0x0D, 0x11, 0x18, 0xFF, 0x80, 0x0C, 0x10, 0x16, 0xFF, 0x02, 0x0C, 0x11, 0x17, 0xFF, 0x0D, 0x11, 0x17, 0xFF, 0x0D, 0x11,
+    0x16, 0xFF, 0x80, 0x0C, 0x11, 0x16, 0xFF, 0x04, 0x0A, 0x0F, 0x14, 0xFF, 0x1B, 0x1F, 0x25, 0xFF, 0x03, 0x05, 0x08, 0xFF, 0x01, 0x03, 0x05, 0xFF,
+    0x02, 0x04, 0x06, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x00,
+    0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x02, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0x02,
+    0xFF, 0x7F, 0x00, 0x00, 0x02, 0xFF, 0x01, 0x00, 0x03, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x00, 0x02,
+    0x03, 0xFF, 0x02, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x00, 0x02, 0x04, 0xFF, 0x02, 0x02,
+    0x08, 0xFF, 0x00, 0x03, 0x06, 0xFF, 0x02, 0x03, 0x07, 0xFF, 0x01, 0x03, 0x08, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x07, 0x0A, 0x0F, 0xFF, 0x15, 0x1A,
+    0x22, 0xFF, 0x0F, 0x12, 0x1A, 0xFF, 0x0F, 0x12, 0x1B, 0xFF, 0x0F, 0x12, 0x1A, 0xFF, 0x0F, 0x13, 0x1A, 0xFF, 0x0F, 0x12, 0x1B, 0xFF, 0x0F, 0x13,
+    0x1D, 0xFF, 0x11, 0x13, 0x1E, 0xFF, 0x11, 0x14, 0x1E, 0xFF, 0x12, 0x16, 0x1F, 0xFF, 0x13, 0x17, 0x23, 0xFF, 0x0D, 0x11, 0x1C, 0xFF, 0x7D, 0x80,
+    0x88, 0xFF, 0x92, 0x97, 0x9E, 0xFF, 0x13, 0x1F, 0x32, 0xFF, 0x48, 0x50, 0x6C, 0xFF, 0x61, 0x63, 0x7F, 0xFF, 0x58, 0x59, 0x70, 0xFF, 0x14, 0x14,
+    0x1D, 0xFF, 0x04, 0x06, 0x0C, 0xFF, 0x03, 0x05, 0x0A, 0xFF, 0x1A, 0x1E, 0x29, 0xFF, 0x2C, 0x30, 0x42, 0xFF, 0x1C, 0x1F, 0x2E, 0xFF, 0x20, 0x23,
+    0x33, 0xFF, 0x1F, 0x23, 0x31, 0xFF, 0x20, 0x23, 0x32, 0xFF, 0x21, 0x24, 0x34, 0xFF, 0x22, 0x26, 0x36, 0xFF, 0x23, 0x28, 0x37, 0xFF, 0x25, 0x29,
+    0x38, 0xFF, 0x26, 0x2B, 0x3A, 0xFF, 0x26, 0x2B, 0x3B, 0xFF, 0x27, 0x2D, 0x3C, 0xFF, 0x5C, 0x62, 0x73, 0xFF, 0x8F, 0x96, 0xA7, 0xFF, 0x30, 0x38,
+    0x4F, 0xFF, 0x57, 0x5F, 0x78, 0xFF, 0x56, 0x5D, 0x75, 0xFF, 0x1D, 0x21, 0x2F, 0xFF, 0x1A, 0x1E, 0x2A, 0xFF, 0x32, 0x35, 0x48, 0xFF, 0x2B, 0x30,
+    0x42, 0xFF, 0x2E, 0x35, 0x47, 0xFF, 0x30, 0x36, 0x48, 0xFF, 0x2E, 0x35, 0x47, 0xFF, 0x2E, 0x34, 0x46, 0xFF, 0x2E, 0x35, 0x48, 0xFF, 0x2F, 0x36,
+    0x4A, 0xFF, 0x34, 0x3B, 0x50, 0xFF, 0x38, 0x3F, 0x56, 0xFF, 0x26, 0x2D, 0x3F, 0xFF, 0x7D, 0x83, 0x92, 0xFF, 0xC6, 0xCA, 0xD1, 0xFF, 0xA7, 0xAC,
+    0xB7, 0xFF, 0xA0, 0xA4, 0xAF, 0xFF, 0x23, 0x27, 0x33, 0xFF, 0x0F, 0x13, 0x28, 0xFF, 0x0B, 0x0E, 0x21, 0xFF, 0x2F, 0x33, 0x41, 0xFF, 0x55, 0x5C,
+    0x6E, 0xFF, 0x37, 0x3E, 0x52, 0xFF, 0x34, 0x3B, 0x51, 0xFF, 0x35, 0x3D, 0x53, 0xFF, 0x35, 0x3D, 0x52, 0xFF, 0x35, 0x3E, 0x51, 0xFF, 0x37, 0x3F,
+    0x53, 0xFF, 0x3A, 0x42, 0x56, 0xFF, 0x3D, 0x45, 0x59, 0xFF, 0x41, 0x48, 0x5D, 0xFF, 0x3E, 0x47, 0x5A, 0xFF, 0x53, 0x58, 0x6E, 0xFF, 0x41, 0x48,
+    0x5B, 0xFF, 0x23, 0x27, 0x38, 0xFF, 0x36, 0x3D, 0x52, 0xFF, 0x1A, 0x1E, 0x2D, 0xFF, 0x06, 0x0B, 0x15, 0xFF, 0x48, 0x4D, 0x5E, 0xFF, 0x5B, 0x60,
+    0x75, 0xFF, 0x4D, 0x53, 0x68, 0xFF, 0x4B, 0x51, 0x67, 0xFF, 0x47, 0x4D, 0x64, 0xFF, 0x45, 0x4C, 0x63, 0xFF, 0x44, 0x4B, 0x61, 0xFF, 0x45, 0x4C,
+    0x63, 0xFF, 0x44, 0x49, 0x60, 0xFF, 0x41, 0x47, 0x5E, 0xFF, 0x42, 0x48, 0x60, 0xFF, 0x43, 0x49, 0x60, 0xFF, 0x4A, 0x50, 0x65, 0xFF, 0x89, 0x8E,
+    0xA1, 0xFF, 0x75, 0x7B, 0x90, 0xFF, 0x44, 0x48, 0x58, 0xFF, 0x05, 0x07, 0x11, 0xFF, 0x0C, 0x11, 0x21, 0xFF, 0x08, 0x0E, 0x17, 0xFF, 0x83, 0x87,
+    0x8F, 0xFF, 0x64, 0x68, 0x76, 0xFF, 0x59, 0x5F, 0x72, 0xFF, 0x51, 0x59, 0x6D, 0xFF, 0x4E, 0x56, 0x6A, 0xFF, 0x4B, 0x53, 0x68, 0xFF, 0x49, 0x52,
+    0x67, 0xFF, 0x4C, 0x53, 0x6A, 0xFF, 0x4D, 0x56, 0x6B, 0xFF, 0x4F, 0x56, 0x6C, 0xFF, 0x51, 0x58, 0x6F, 0xFF, 0x4A, 0x52, 0x67, 0xFF, 0x8D, 0x90,
+    0x9B, 0xFF, 0xAD, 0xB0, 0xB4, 0xFF, 0x96, 0x98, 0x9D, 0xFF, 0x24, 0x89, 0x89, 0x8D, 0xFF, 0x86, 0x85, 0x88, 0xFF, 0x86, 0x84, 0x88, 0xFF, 0x86,
+    0x85, 0x8A, 0xFF, 0x86, 0x85, 0x8B, 0xFF, 0x88, 0x88, 0x8C, 0xFF, 0x86, 0x85, 0x8A, 0xFF, 0x86, 0x85, 0x89, 0xFF, 0x86, 0x86, 0x89, 0xFF, 0x86,
+    0x87, 0x89, 0xFF, 0x86, 0x86, 0x88, 0xFF, 0x85, 0x86, 0x88, 0xFF, 0x84, 0x84, 0x86, 0xFF, 0x83, 0x82, 0x84, 0xFF, 0x81, 0x81, 0x84, 0xFF, 0x81,
+    0x80, 0x84, 0xFF, 0x7F, 0x7F, 0x82, 0xFF, 0x80, 0x80, 0x84, 0xFF, 0x97, 0x9A, 0xA2, 0xFF, 0x71, 0x77, 0x87, 0xFF, 0x50, 0x59, 0x6D, 0xFF, 0x50,
+    0x58, 0x6E, 0xFF, 0x4A, 0x53, 0x67, 0xFF, 0x4A, 0x53, 0x68, 0xFF, 0x4C, 0x55, 0x69, 0xFF, 0x4A, 0x53, 0x67, 0xFF, 0x48, 0x50, 0x66, 0xFF, 0x49,
+    0x52, 0x66, 0xFF, 0x50, 0x58, 0x6D, 0xFF, 0x53, 0x5A, 0x6D, 0xFF, 0x7B, 0x7F, 0x8A, 0xFF, 0x61, 0x65, 0x6C, 0xFF, 0x06, 0x09, 0x14, 0xFF, 0x03,
+    0x06, 0x12, 0xFF, 0x60, 0x63, 0x70, 0xFF, 0xA4, 0xA7, 0xB1, 0xFF, 0x5A, 0x5F, 0x71, 0xFF, 0x80, 0x51, 0x59, 0x6F, 0xFF, 0x17, 0x50, 0x58, 0x6D,
+    0xFF, 0x4F, 0x56, 0x6A, 0xFF, 0x50, 0x55, 0x6B, 0xFF, 0x4E, 0x55, 0x6A, 0xFF, 0x4D, 0x53, 0x68, 0xFF, 0x4B, 0x53, 0x68, 0xFF, 0x4B, 0x53, 0x67,
+    0xFF, 0x49, 0x51, 0x66, 0xFF, 0x45, 0x4D, 0x61, 0xFF, 0x37, 0x3D, 0x4F, 0xFF, 0x07, 0x0B, 0x14, 0xFF, 0x08, 0x0A, 0x17, 0xFF, 0x0A, 0x0D, 0x1B,
+    0xFF, 0x09, 0x0D, 0x1A, 0xFF, 0x08, 0x0C, 0x18, 0xFF, 0x07, 0x0B, 0x17, 0xFF, 0x07, 0x0B, 0x16, 0xFF, 0x08, 0x0B, 0x17, 0xFF, 0x08, 0x0A, 0x16,
+    0xFF, 0x07, 0x0B, 0x16, 0xFF, 0x08, 0x0B, 0x17, 0xFF, 0x08, 0x0B, 0x18, 0xFF, 0x08, 0x0C, 0x18, 0xFF, 0x07, 0x0C, 0x17, 0xFF, 0x80, 0x08, 0x0B,
+    0x17, 0xFF, 0x40, 0x03, 0x04, 0x0E, 0xFF, 0x21, 0x25, 0x34, 0xFF, 0x35, 0x39, 0x4D, 0xFF, 0x28, 0x2B, 0x39, 0xFF, 0x63, 0x6B, 0x81, 0xFF, 0x4F,
+    0x56, 0x6D, 0xFF, 0x42, 0x49, 0x60, 0xFF, 0x41, 0x48, 0x5E, 0xFF, 0x40, 0x47, 0x5D, 0xFF, 0x42, 0x49, 0x5E, 0xFF, 0x45, 0x4C, 0x60, 0xFF, 0x45,
+    0x4C, 0x61, 0xFF, 0x45, 0x4C, 0x60, 0xFF, 0x46, 0x4E, 0x63, 0xFF, 0x49, 0x50, 0x65, 0xFF, 0x4A, 0x51, 0x66, 0xFF, 0x4A, 0x52, 0x67, 0xFF, 0x4E,
+    0x54, 0x6A, 0xFF, 0x1D, 0x22, 0x2D, 0xFF, 0x07, 0x0B, 0x13, 0xFF, 0x05, 0x08, 0x12, 0xFF, 0x24, 0x26, 0x31, 0xFF, 0x63, 0x68, 0x7C, 0xFF, 0x4B,
+    0x51, 0x64, 0xFF, 0x81, 0x86, 0x96, 0xFF, 0x88, 0x8E, 0x9F, 0xFF, 0x41, 0x47, 0x5C, 0xFF, 0x3D, 0x43, 0x58, 0xFF, 0x3D, 0x44, 0x58, 0xFF, 0x3C,
+    0x43, 0x57, 0xFF, 0x3C, 0x42, 0x56, 0xFF, 0x3C, 0x42, 0x57, 0xFF, 0x3A, 0x41, 0x57, 0xFF, 0x38, 0x3F, 0x55, 0xFF, 0x39, 0x40, 0x55, 0xFF, 0x38,
+    0x3F, 0x55, 0xFF, 0x3C, 0x43, 0x58, 0xFF, 0x3B, 0x41, 0x54, 0xFF, 0x10, 0x14, 0x1F, 0xFF, 0x1D, 0x20, 0x2B, 0xFF, 0x89, 0x8F, 0xA2, 0xFF, 0x88,
+    0x8E, 0xA4, 0xFF, 0x6A, 0x6C, 0x7F, 0xFF, 0xAB, 0xB3, 0xC1, 0xFF, 0x68, 0x74, 0x84, 0xFF, 0x18, 0x21, 0x31, 0xFF, 0x28, 0x2D, 0x3D, 0xFF, 0x25,
+    0x2B, 0x3B, 0xFF, 0x22, 0x2A, 0x38, 0xFF, 0x1E, 0x26, 0x33, 0xFF, 0x1C, 0x23, 0x2F, 0xFF, 0x1C, 0x22, 0x2E, 0xFF, 0x1C, 0x21, 0x30, 0xFF, 0x1D,
+    0x22, 0x30, 0xFF, 0x1B, 0x20, 0x2D, 0xFF, 0x1A, 0x1E, 0x2A, 0xFF, 0x18, 0x1B, 0x26, 0xFF, 0x07, 0x09, 0x13, 0xFF, 0x05, 0x07, 0x0E, 0xFF, 0x06,
+    0x09, 0x12, 0xFF, 0x07, 0x09, 0x14, 0xFF, 0x07, 0x08, 0x14, 0xFF, 0x06, 0x09, 0x14, 0xFF, 0x05, 0x09, 0x14, 0xFF, 0x07, 0x09, 0x14, 0xFF, 0x80,
+    0x06, 0x09, 0x14, 0xFF, 0x0F, 0x05, 0x09, 0x15, 0xFF, 0x06, 0x09, 0x15, 0xFF, 0x07, 0x09, 0x15, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x2A, 0x27, 0x33,
+    0xFF, 0x4E, 0x4E, 0x68, 0xFF, 0x3A, 0x3D, 0x59, 0xFF, 0x24, 0x24, 0x3A, 0xFF, 0x15, 0x16, 0x24, 0xFF, 0x20, 0x23, 0x31, 0xFF, 0x38, 0x40, 0x4F,
+    0xFF, 0x13, 0x17, 0x23, 0xFF, 0x0C, 0x10, 0x18, 0xFF, 0x0C, 0x11, 0x19, 0xFF, 0x0C, 0x11, 0x17, 0xFF, 0x0B, 0x10, 0x16, 0xFF, 0x80, 0x0C, 0x11,
+    0x16, 0xFF, 0x08, 0x0C, 0x12, 0x17, 0xFF, 0x0D, 0x12, 0x17, 0xFF, 0x0B, 0x11, 0x17, 0xFF, 0x0B, 0x0F, 0x15, 0xFF, 0x09, 0x0E, 0x13, 0xFF, 0x1A,
+    0x1F, 0x24, 0xFF, 0x03, 0x04, 0x07, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x02, 0x04, 0x06, 0xFF, 0x04, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF,
+    0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x02, 0xFF, 0x01, 0x01, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x03, 0xFF,
+    0x80, 0x01, 0x01, 0x04, 0xFF, 0x02, 0x01, 0x02, 0x03, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x02, 0x03, 0xFF, 0x81, 0x01, 0x01, 0x05, 0xFF, 0x80,
+    0x01, 0x02, 0x06, 0xFF, 0x80, 0x01, 0x03, 0x06, 0xFF, 0x58, 0x02, 0x03, 0x07, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x07, 0x0B, 0x0F, 0xFF, 0x14, 0x1A,
+    0x22, 0xFF, 0x0E, 0x11, 0x19, 0xFF, 0x0F, 0x12, 0x1A, 0xFF, 0x0F, 0x12, 0x1B, 0xFF, 0x0F, 0x12, 0x1A, 0xFF, 0x0F, 0x12, 0x1B, 0xFF, 0x10, 0x13,
+    0x1D, 0xFF, 0x11, 0x15, 0x1E, 0xFF, 0x12, 0x15, 0x1F, 0xFF, 0x11, 0x16, 0x20, 0xFF, 0x12, 0x16, 0x21, 0xFF, 0x0C, 0x10, 0x19, 0xFF, 0x79, 0x7B,
+    0x84, 0xFF, 0x8F, 0x94, 0x9B, 0xFF, 0x10, 0x1B, 0x2D, 0xFF, 0x46, 0x4E, 0x6A, 0xFF, 0x5F, 0x62, 0x7D, 0xFF, 0x57, 0x57, 0x6F, 0xFF, 0x13, 0x14,
+    0x1C, 0xFF, 0x05, 0x06, 0x0C, 0xFF, 0x04, 0x05, 0x0A, 0xFF, 0x1A, 0x1E, 0x29, 0xFF, 0x2D, 0x30, 0x42, 0xFF, 0x1C, 0x20, 0x2E, 0xFF, 0x1F, 0x23,
+    0x32, 0xFF, 0x1F, 0x23, 0x31, 0xFF, 0x20, 0x24, 0x33, 0xFF, 0x21, 0x25, 0x34, 0xFF, 0x21, 0x26, 0x34, 0xFF, 0x22, 0x26, 0x35, 0xFF, 0x23, 0x28,
+    0x37, 0xFF, 0x25, 0x2C, 0x3C, 0xFF, 0x28, 0x2E, 0x3E, 0xFF, 0x29, 0x2F, 0x3F, 0xFF, 0x5B, 0x61, 0x72, 0xFF, 0x8E, 0x95, 0xA8, 0xFF, 0x32, 0x38,
+    0x50, 0xFF, 0x56, 0x5D, 0x77, 0xFF, 0x54, 0x5A, 0x73, 0xFF, 0x1B, 0x1F, 0x2D, 0xFF, 0x14, 0x15, 0x22, 0xFF, 0x2C, 0x30, 0x41, 0xFF, 0x27, 0x2D,
+    0x3B, 0xFF, 0x2D, 0x33, 0x46, 0xFF, 0x2E, 0x34, 0x47, 0xFF, 0x2C, 0x32, 0x43, 0xFF, 0x2C, 0x32, 0x44, 0xFF, 0x2B, 0x32, 0x44, 0xFF, 0x2D, 0x35,
+    0x47, 0xFF, 0x33, 0x3A, 0x4E, 0xFF, 0x39, 0x40, 0x55, 0xFF, 0x3B, 0x41, 0x5A, 0xFF, 0x46, 0x4E, 0x63, 0xFF, 0xC3, 0xC7, 0xCF, 0xFF, 0xB5, 0xB9,
+    0xC5, 0xFF, 0xB2, 0xB7, 0xC0, 0xFF, 0x72, 0x74, 0x81, 0xFF, 0x09, 0x0E, 0x21, 0xFF, 0x0B, 0x10, 0x20, 0xFF, 0x54, 0x59, 0x69, 0xFF, 0x50, 0x56,
+    0x68, 0xFF, 0x30, 0x38, 0x4D, 0xFF, 0x32, 0x38, 0x4E, 0xFF, 0x30, 0x38, 0x4D, 0xFF, 0x31, 0x38, 0x4D, 0xFF, 0x33, 0x3A, 0x4F, 0xFF, 0x36, 0x3D,
+    0x52, 0xFF, 0x36, 0x3E, 0x53, 0xFF, 0x3A, 0x43, 0x56, 0xFF, 0x3F, 0x46, 0x5B, 0xFF, 0x3B, 0x43, 0x58, 0xFF, 0x4E, 0x56, 0x6B, 0xFF, 0x32, 0x38,
+    0x4B, 0xFF, 0x33, 0x37, 0x4C, 0xFF, 0x36, 0x3A, 0x50, 0xFF, 0x09, 0x0E, 0x19, 0xFF, 0x09, 0x0E, 0x17, 0xFF, 0x44, 0x48, 0x5A, 0xFF, 0x55, 0x59,
+    0x6E, 0xFF, 0x49, 0x4F, 0x64, 0xFF, 0x4A, 0x51, 0x67, 0xFF, 0x49, 0x4E, 0x64, 0xFF, 0x46, 0x4C, 0x62, 0xFF, 0x44, 0x4A, 0x61, 0xFF, 0x42, 0x49,
+    0x60, 0xFF, 0x42, 0x48, 0x5F, 0xFF, 0x80, 0x41, 0x47, 0x5E, 0xFF, 0x1D, 0x43, 0x49, 0x5F, 0xFF, 0x4A, 0x4F, 0x64, 0xFF, 0x88, 0x8E, 0xA0, 0xFF,
+    0x74, 0x7A, 0x8F, 0xFF, 0x44, 0x47, 0x57, 0xFF, 0x06, 0x08, 0x12, 0xFF, 0x0D, 0x11, 0x21, 0xFF, 0x06, 0x0B, 0x15, 0xFF, 0x7B, 0x7F, 0x88, 0xFF,
+    0x5B, 0x61, 0x71, 0xFF, 0x53, 0x5A, 0x6D, 0xFF, 0x4F, 0x56, 0x6B, 0xFF, 0x4D, 0x56, 0x6A, 0xFF, 0x48, 0x50, 0x66, 0xFF, 0x46, 0x4E, 0x64, 0xFF,
+    0x48, 0x4F, 0x65, 0xFF, 0x48, 0x50, 0x66, 0xFF, 0x4D, 0x53, 0x69, 0xFF, 0x50, 0x57, 0x6E, 0xFF, 0x4C, 0x52, 0x69, 0xFF, 0x70, 0x74, 0x84, 0xFF,
+    0x8D, 0x8F, 0x97, 0xFF, 0x8E, 0x91, 0x99, 0xFF, 0x8D, 0x90, 0x99, 0xFF, 0x8E, 0x91, 0x9A, 0xFF, 0x8D, 0x8F, 0x9A, 0xFF, 0x8A, 0x8D, 0x99, 0xFF,
+    0x8A, 0x8D, 0x9B, 0xFF, 0x8A, 0x8D, 0x9C, 0xFF, 0x8A, 0x8D, 0x9B, 0xFF, 0x80, 0x89, 0x8D, 0x9A, 0xFF, 0x0D, 0x8A, 0x8E, 0x9B, 0xFF, 0x88, 0x8D,
+    0x99, 0xFF, 0x87, 0x8B, 0x98, 0xFF, 0x85, 0x89, 0x95, 0xFF, 0x82, 0x86, 0x92, 0xFF, 0x81, 0x85, 0x91, 0xFF, 0x81, 0x86, 0x92, 0xFF, 0x82, 0x86,
+    0x92, 0xFF, 0x85, 0x89, 0x93, 0xFF, 0x84, 0x8A, 0x96, 0xFF, 0x5F, 0x66, 0x79, 0xFF, 0x4E, 0x57, 0x6C, 0xFF, 0x4D, 0x56, 0x6C, 0xFF, 0x4B, 0x53,
+    0x69, 0xFF, 0x80, 0x49, 0x52, 0x66, 0xFF, 0x0F, 0x47, 0x4E, 0x63, 0xFF, 0x48, 0x50, 0x64, 0xFF, 0x4A, 0x52, 0x67, 0xFF, 0x4F, 0x58, 0x6C, 0xFF,
+    0x50, 0x58, 0x6B, 0xFF, 0x6D, 0x71, 0x7E, 0xFF, 0x65, 0x68, 0x72, 0xFF, 0x09, 0x0E, 0x1A, 0xFF, 0x04, 0x08, 0x16, 0xFF, 0x73, 0x75, 0x83, 0xFF,
+    0x9F, 0xA1, 0xAB, 0xFF, 0x52, 0x58, 0x6C, 0xFF, 0x4E, 0x56, 0x6B, 0xFF, 0x50, 0x58, 0x6D, 0xFF, 0x50, 0x57, 0x6B, 0xFF, 0x4D, 0x54, 0x68, 0xFF,
+    0x80, 0x4E, 0x55, 0x6A, 0xFF, 0x10, 0x4C, 0x54, 0x68, 0xFF, 0x4B, 0x53, 0x68, 0xFF, 0x49, 0x52, 0x67, 0xFF, 0x49, 0x51, 0x66, 0xFF, 0x44, 0x4A,
+    0x60, 0xFF, 0x1F, 0x25, 0x33, 0xFF, 0x08, 0x0B, 0x14, 0xFF, 0x09, 0x0C, 0x18, 0xFF, 0x09, 0x0B, 0x19, 0xFF, 0x08, 0x0C, 0x18, 0xFF, 0x08, 0x0B,
+    0x17, 0xFF, 0x07, 0x0A, 0x15, 0xFF, 0x07, 0x0B, 0x16, 0xFF, 0x07, 0x0A, 0x17, 0xFF, 0x07, 0x0B, 0x17, 0xFF, 0x06, 0x0A, 0x16, 0xFF, 0x07, 0x0A,
+    0x16, 0xFF, 0x80, 0x07, 0x0B, 0x17, 0xFF, 0x1E, 0x07, 0x0A, 0x17, 0xFF, 0x08, 0x0B, 0x17, 0xFF, 0x08, 0x0B, 0x16, 0xFF, 0x08, 0x0B, 0x17, 0xFF,
+    0x0D, 0x0E, 0x1A, 0xFF, 0x37, 0x3C, 0x4E, 0xFF, 0x3D, 0x42, 0x53, 0xFF, 0x64, 0x6B, 0x7F, 0xFF, 0x5D, 0x64, 0x7B, 0xFF, 0x3B, 0x42, 0x58, 0xFF,
+    0x3D, 0x44, 0x5A, 0xFF, 0x3D, 0x45, 0x5B, 0xFF, 0x41, 0x48, 0x5D, 0xFF, 0x44, 0x4B, 0x5F, 0xFF, 0x43, 0x4B, 0x60, 0xFF, 0x45, 0x4C, 0x60, 0xFF,
+    0x45, 0x4C, 0x61, 0xFF, 0x46, 0x4D, 0x62, 0xFF, 0x4A, 0x51, 0x64, 0xFF, 0x49, 0x51, 0x66, 0xFF, 0x4E, 0x54, 0x6B, 0xFF, 0x1D, 0x22, 0x2E, 0xFF,
+    0x07, 0x0B, 0x14, 0xFF, 0x06, 0x0A, 0x14, 0xFF, 0x23, 0x28, 0x32, 0xFF, 0x62, 0x68, 0x7B, 0xFF, 0x48, 0x4F, 0x63, 0xFF, 0x7E, 0x84, 0x94, 0xFF,
+    0x84, 0x8C, 0x9D, 0xFF, 0x3E, 0x44, 0x58, 0xFF, 0x3A, 0x40, 0x54, 0xFF, 0x80, 0x3A, 0x41, 0x55, 0xFF, 0x1C, 0x3A, 0x40, 0x55, 0xFF, 0x39, 0x3F,
+    0x54, 0xFF, 0x36, 0x3D, 0x52, 0xFF, 0x35, 0x3C, 0x51, 0xFF, 0x36, 0x3C, 0x52, 0xFF, 0x35, 0x3C, 0x51, 0xFF, 0x39, 0x40, 0x55, 0xFF, 0x39, 0x3F,
+    0x52, 0xFF, 0x10, 0x15, 0x1F, 0xFF, 0x42, 0x45, 0x55, 0xFF, 0x84, 0x8B, 0xA1, 0xFF, 0x70, 0x76, 0x8F, 0xFF, 0x66, 0x68, 0x7B, 0xFF, 0xAA, 0xB3,
+    0xC2, 0xFF, 0x56, 0x62, 0x74, 0xFF, 0x1B, 0x23, 0x33, 0xFF, 0x27, 0x2C, 0x3C, 0xFF, 0x25, 0x2B, 0x3A, 0xFF, 0x23, 0x2A, 0x38, 0xFF, 0x20, 0x27,
+    0x34, 0xFF, 0x1C, 0x24, 0x30, 0xFF, 0x1C, 0x21, 0x2E, 0xFF, 0x1A, 0x20, 0x2D, 0xFF, 0x1B, 0x20, 0x2D, 0xFF, 0x1A, 0x1F, 0x2B, 0xFF, 0x1A, 0x1E,
+    0x2A, 0xFF, 0x16, 0x1A, 0x23, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x05, 0x08, 0x11, 0xFF, 0x80, 0x06, 0x08, 0x12, 0xFF, 0x03, 0x06, 0x07, 0x13, 0xFF,
+    0x06, 0x08, 0x12, 0xFF, 0x06, 0x09, 0x13, 0xFF, 0x05, 0x08, 0x13, 0xFF, 0x80, 0x06, 0x09, 0x13, 0xFF, 0x0E, 0x05, 0x09, 0x14, 0xFF, 0x06, 0x08,
+    0x15, 0xFF, 0x05, 0x08, 0x14, 0xFF, 0x06, 0x08, 0x12, 0xFF, 0x17, 0x14, 0x1D, 0xFF, 0x4B, 0x4D, 0x60, 0xFF, 0x4D, 0x50, 0x6D, 0xFF, 0x30, 0x32,
+    0x4B, 0xFF, 0x1D, 0x1D, 0x31, 0xFF, 0x1A, 0x1B, 0x2B, 0xFF, 0x41, 0x48, 0x58, 0xFF, 0x29, 0x2F, 0x3D, 0xFF, 0x07, 0x0B, 0x14, 0xFF, 0x0D, 0x11,
+    0x19, 0xFF, 0x0D, 0x10, 0x17, 0xFF, 0x80, 0x0C, 0x10, 0x16, 0xFF, 0x09, 0x0D, 0x11, 0x17, 0xFF, 0x0C, 0x10, 0x17, 0xFF, 0x0C, 0x11, 0x16, 0xFF,
+    0x0B, 0x10, 0x15, 0xFF, 0x0B, 0x0F, 0x13, 0xFF, 0x09, 0x0D, 0x11, 0xFF, 0x19, 0x1E, 0x23, 0xFF, 0x03, 0x04, 0x07, 0xFF, 0x02, 0x03, 0x05, 0xFF,
+    0x02, 0x04, 0x06, 0xFF, 0x04, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x01,
+    0xFF, 0x80, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x01, 0xFF, 0x05, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02,
+    0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x80, 0x01, 0x01, 0x03, 0xFF, 0x04, 0x01,
+    0x01, 0x04, 0xFF, 0x00, 0x02, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x80, 0x01, 0x02, 0x05, 0xFF,
+    0x1F, 0x03, 0x03, 0x06, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x02, 0x04, 0x07, 0xFF, 0x06, 0x0A, 0x0F, 0xFF, 0x14, 0x19, 0x21,
+    0xFF, 0x0D, 0x11, 0x17, 0xFF, 0x0F, 0x12, 0x19, 0xFF, 0x0F, 0x13, 0x1A, 0xFF, 0x0F, 0x12, 0x1A, 0xFF, 0x0F, 0x13, 0x1B, 0xFF, 0x10, 0x14, 0x1C,
+    0xFF, 0x10, 0x14, 0x1D, 0xFF, 0x11, 0x15, 0x1E, 0xFF, 0x11, 0x15, 0x1F, 0xFF, 0x11, 0x14, 0x1F, 0xFF, 0x0B, 0x0E, 0x17, 0xFF, 0x75, 0x77, 0x80,
+    0xFF, 0x90, 0x93, 0x9A, 0xFF, 0x0D, 0x18, 0x2A, 0xFF, 0x44, 0x4B, 0x69, 0xFF, 0x5E, 0x60, 0x7B, 0xFF, 0x57, 0x56, 0x6E, 0xFF, 0x13, 0x14, 0x1C,
+    0xFF, 0x04, 0x06, 0x0B, 0xFF, 0x03, 0x04, 0x08, 0xFF, 0x19, 0x1D, 0x28, 0xFF, 0x2C, 0x30, 0x41, 0xFF, 0x1A, 0x1D, 0x2B, 0xFF, 0x1E, 0x21, 0x30,
+    0xFF, 0x1D, 0x22, 0x30, 0xFF, 0x20, 0x24, 0x33, 0xFF, 0x80, 0x22, 0x27, 0x35, 0xFF, 0x34, 0x23, 0x27, 0x36, 0xFF, 0x25, 0x29, 0x39, 0xFF, 0x27,
+    0x2C, 0x3C, 0xFF, 0x2A, 0x2F, 0x40, 0xFF, 0x2A, 0x30, 0x41, 0xFF, 0x5A, 0x61, 0x72, 0xFF, 0x8D, 0x95, 0xA8, 0xFF, 0x30, 0x38, 0x50, 0xFF, 0x53,
+    0x5A, 0x73, 0xFF, 0x4F, 0x56, 0x6F, 0xFF, 0x18, 0x1D, 0x2A, 0xFF, 0x0C, 0x0C, 0x17, 0xFF, 0x18, 0x1D, 0x27, 0xFF, 0x29, 0x2D, 0x3D, 0xFF, 0x28,
+    0x2D, 0x3F, 0xFF, 0x2B, 0x31, 0x42, 0xFF, 0x2A, 0x30, 0x44, 0xFF, 0x2A, 0x2F, 0x42, 0xFF, 0x2B, 0x2F, 0x41, 0xFF, 0x2D, 0x33, 0x46, 0xFF, 0x32,
+    0x39, 0x4C, 0xFF, 0x37, 0x3D, 0x51, 0xFF, 0x3B, 0x41, 0x58, 0xFF, 0x2C, 0x34, 0x49, 0xFF, 0xA1, 0xA6, 0xB4, 0xFF, 0xC7, 0xCA, 0xD3, 0xFF, 0xB4,
+    0xB7, 0xC0, 0xFF, 0x96, 0x99, 0xA4, 0xFF, 0x12, 0x16, 0x26, 0xFF, 0x1D, 0x22, 0x31, 0xFF, 0x4E, 0x53, 0x65, 0xFF, 0x3D, 0x42, 0x55, 0xFF, 0x2E,
+    0x36, 0x4C, 0xFF, 0x30, 0x38, 0x4E, 0xFF, 0x2E, 0x36, 0x4B, 0xFF, 0x30, 0x37, 0x4C, 0xFF, 0x34, 0x3B, 0x50, 0xFF, 0x36, 0x3E, 0x51, 0xFF, 0x36,
+    0x3F, 0x54, 0xFF, 0x3B, 0x42, 0x57, 0xFF, 0x3B, 0x43, 0x58, 0xFF, 0x48, 0x51, 0x66, 0xFF, 0x47, 0x50, 0x64, 0xFF, 0x22, 0x26, 0x39, 0xFF, 0x36,
+    0x3A, 0x51, 0xFF, 0x1F, 0x23, 0x34, 0xFF, 0x09, 0x0E, 0x1A, 0xFF, 0x09, 0x0E, 0x17, 0xFF, 0x43, 0x46, 0x58, 0xFF, 0x51, 0x54, 0x69, 0xFF, 0x45,
+    0x4B, 0x60, 0xFF, 0x48, 0x4E, 0x64, 0xFF, 0x46, 0x4C, 0x62, 0xFF, 0x81, 0x43, 0x49, 0x60, 0xFF, 0x16, 0x41, 0x47, 0x5D, 0xFF, 0x40, 0x46, 0x5D,
+    0xFF, 0x40, 0x47, 0x5D, 0xFF, 0x42, 0x48, 0x5E, 0xFF, 0x47, 0x4C, 0x61, 0xFF, 0x87, 0x8D, 0x9E, 0xFF, 0x74, 0x7A, 0x8E, 0xFF, 0x43, 0x47, 0x57,
+    0xFF, 0x07, 0x09, 0x12, 0xFF, 0x0B, 0x10, 0x1F, 0xFF, 0x14, 0x18, 0x22, 0xFF, 0x71, 0x75, 0x80, 0xFF, 0x55, 0x5B, 0x6B, 0xFF, 0x4F, 0x56, 0x6A,
+    0xFF, 0x4B, 0x54, 0x68, 0xFF, 0x4A, 0x53, 0x67, 0xFF, 0x47, 0x50, 0x64, 0xFF, 0x45, 0x4D, 0x61, 0xFF, 0x44, 0x4B, 0x5F, 0xFF, 0x44, 0x4B, 0x60,
+    0xFF, 0x48, 0x4F, 0x64, 0xFF, 0x4C, 0x53, 0x69, 0xFF, 0x4D, 0x55, 0x6A, 0xFF, 0x80, 0x4C, 0x54, 0x6A, 0xFF, 0x1C, 0x4E, 0x55, 0x6B, 0xFF, 0x4E,
+    0x55, 0x6A, 0xFF, 0x50, 0x57, 0x6D, 0xFF, 0x52, 0x59, 0x6F, 0xFF, 0x54, 0x5B, 0x70, 0xFF, 0x53, 0x5A, 0x6F, 0xFF, 0x51, 0x59, 0x6F, 0xFF, 0x53,
+    0x5A, 0x71, 0xFF, 0x51, 0x58, 0x6E, 0xFF, 0x50, 0x58, 0x6E, 0xFF, 0x4F, 0x57, 0x6D, 0xFF, 0x4C, 0x54, 0x6A, 0xFF, 0x4D, 0x55, 0x6A, 0xFF, 0x4D,
+    0x54, 0x69, 0xFF, 0x4B, 0x53, 0x68, 0xFF, 0x4C, 0x54, 0x6B, 0xFF, 0x4B, 0x54, 0x69, 0xFF, 0x4A, 0x53, 0x68, 0xFF, 0x4C, 0x54, 0x6B, 0xFF, 0x4C,
+    0x53, 0x6B, 0xFF, 0x4B, 0x54, 0x6A, 0xFF, 0x4A, 0x53, 0x68, 0xFF, 0x4C, 0x54, 0x6A, 0xFF, 0x4A, 0x52, 0x68, 0xFF, 0x45, 0x4D, 0x60, 0xFF, 0x44,
+    0x4C, 0x60, 0xFF, 0x43, 0x4C, 0x5F, 0xFF, 0x45, 0x4D, 0x61, 0xFF, 0x49, 0x51, 0x65, 0xFF, 0x80, 0x4D, 0x56, 0x69, 0xFF, 0x17, 0x60, 0x66, 0x75,
+    0xFF, 0x66, 0x6A, 0x76, 0xFF, 0x15, 0x19, 0x29, 0xFF, 0x0A, 0x0E, 0x1E, 0xFF, 0x7C, 0x7E, 0x8C, 0xFF, 0x94, 0x97, 0xA5, 0xFF, 0x55, 0x5B, 0x70,
+    0xFF, 0x4F, 0x57, 0x6C, 0xFF, 0x4F, 0x57, 0x6B, 0xFF, 0x4C, 0x54, 0x68, 0xFF, 0x4A, 0x52, 0x65, 0xFF, 0x4A, 0x51, 0x65, 0xFF, 0x4B, 0x51, 0x67,
+    0xFF, 0x4B, 0x52, 0x67, 0xFF, 0x49, 0x52, 0x67, 0xFF, 0x48, 0x51, 0x65, 0xFF, 0x47, 0x4F, 0x63, 0xFF, 0x41, 0x48, 0x5B, 0xFF, 0x15, 0x19, 0x25,
+    0xFF, 0x07, 0x09, 0x14, 0xFF, 0x09, 0x0B, 0x17, 0xFF, 0x08, 0x0B, 0x18, 0xFF, 0x08, 0x0B, 0x17, 0xFF, 0x08, 0x0B, 0x16, 0xFF, 0x80, 0x07, 0x0A,
+    0x16, 0xFF, 0x04, 0x07, 0x0B, 0x16, 0xFF, 0x07, 0x0A, 0x16, 0xFF, 0x07, 0x09, 0x15, 0xFF, 0x07, 0x0A, 0x15, 0xFF, 0x07, 0x0A, 0x16, 0xFF, 0x81,
+    0x08, 0x0A, 0x17, 0xFF, 0x3B, 0x09, 0x0C, 0x18, 0xFF, 0x09, 0x0C, 0x19, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x34, 0x38, 0x4A, 0xFF, 0x44, 0x4A, 0x5D,
+    0xFF, 0x53, 0x5A, 0x6E, 0xFF, 0x6F, 0x76, 0x8C, 0xFF, 0x39, 0x3F, 0x55, 0xFF, 0x3E, 0x45, 0x5C, 0xFF, 0x3E, 0x46, 0x5B, 0xFF, 0x40, 0x47, 0x5B,
+    0xFF, 0x41, 0x49, 0x5D, 0xFF, 0x41, 0x48, 0x5C, 0xFF, 0x40, 0x48, 0x5C, 0xFF, 0x41, 0x47, 0x5C, 0xFF, 0x43, 0x4A, 0x5F, 0xFF, 0x47, 0x4E, 0x62,
+    0xFF, 0x48, 0x50, 0x64, 0xFF, 0x4E, 0x55, 0x6A, 0xFF, 0x1D, 0x22, 0x2E, 0xFF, 0x08, 0x0C, 0x16, 0xFF, 0x07, 0x0C, 0x15, 0xFF, 0x24, 0x28, 0x32,
+    0xFF, 0x61, 0x66, 0x79, 0xFF, 0x46, 0x4B, 0x5E, 0xFF, 0x7C, 0x82, 0x92, 0xFF, 0x82, 0x89, 0x9A, 0xFF, 0x3C, 0x42, 0x55, 0xFF, 0x38, 0x3E, 0x51,
+    0xFF, 0x37, 0x3D, 0x51, 0xFF, 0x36, 0x3D, 0x50, 0xFF, 0x37, 0x3D, 0x52, 0xFF, 0x35, 0x3B, 0x50, 0xFF, 0x33, 0x39, 0x4E, 0xFF, 0x33, 0x3A, 0x4E,
+    0xFF, 0x34, 0x3B, 0x50, 0xFF, 0x35, 0x3B, 0x51, 0xFF, 0x38, 0x3E, 0x54, 0xFF, 0x38, 0x3D, 0x50, 0xFF, 0x0F, 0x13, 0x1D, 0xFF, 0x4E, 0x52, 0x62,
+    0xFF, 0x7A, 0x82, 0x9C, 0xFF, 0x60, 0x65, 0x7F, 0xFF, 0x66, 0x69, 0x7B, 0xFF, 0xA2, 0xAC, 0xBA, 0xFF, 0x4A, 0x54, 0x64, 0xFF, 0x1E, 0x26, 0x33,
+    0xFF, 0x26, 0x2B, 0x3A, 0xFF, 0x24, 0x2A, 0x39, 0xFF, 0x22, 0x29, 0x36, 0xFF, 0x1F, 0x27, 0x33, 0xFF, 0x1D, 0x23, 0x30, 0xFF, 0x1C, 0x21, 0x2F,
+    0xFF, 0x1C, 0x21, 0x2E, 0xFF, 0x1B, 0x21, 0x2D, 0xFF, 0x19, 0x1F, 0x2A, 0xFF, 0x19, 0x1E, 0x28, 0xFF, 0x11, 0x14, 0x1E, 0xFF, 0x04, 0x06, 0x0F,
+    0xFF, 0x06, 0x07, 0x11, 0xFF, 0x80, 0x05, 0x07, 0x10, 0xFF, 0x02, 0x05, 0x07, 0x11, 0xFF, 0x04, 0x07, 0x11, 0xFF, 0x05, 0x08, 0x12, 0xFF, 0x80,
+    0x05, 0x08, 0x13, 0xFF, 0x1B, 0x05, 0x07, 0x14, 0xFF, 0x05, 0x07, 0x13, 0xFF, 0x05, 0x08, 0x13, 0xFF, 0x05, 0x09, 0x14, 0xFF, 0x07, 0x09, 0x15,
+    0xFF, 0x01, 0x03, 0x08, 0xFF, 0x3F, 0x3D, 0x4B, 0xFF, 0x5B, 0x5D, 0x76, 0xFF, 0x3A, 0x3E, 0x56, 0xFF, 0x24, 0x25, 0x3D, 0xFF, 0x1A, 0x1A, 0x2B,
+    0xFF, 0x47, 0x4E, 0x5D, 0xFF, 0x40, 0x48, 0x54, 0xFF, 0x04, 0x06, 0x0C, 0xFF, 0x0D, 0x12, 0x19, 0xFF, 0x0D, 0x12, 0x18, 0xFF, 0x0D, 0x12, 0x17,
+    0xFF, 0x0D, 0x12, 0x18, 0xFF, 0x0D, 0x12, 0x17, 0xFF, 0x0C, 0x11, 0x16, 0xFF, 0x0C, 0x10, 0x15, 0xFF, 0x0B, 0x0F, 0x15, 0xFF, 0x0A, 0x0E, 0x13,
+    0xFF, 0x09, 0x0C, 0x10, 0xFF, 0x18, 0x1E, 0x22, 0xFF, 0x03, 0x04, 0x07, 0xFF, 0x02, 0x04, 0x06, 0xFF, 0x02, 0x03, 0x07, 0xFF, 0x02, 0x00, 0x01,
+    0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x01, 0x01, 0xFF, 0x04, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x08, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
+    0x01, 0xFF, 0x01, 0x00, 0x03, 0xFF, 0x00, 0x02, 0x03, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x02, 0x03, 0xFF, 0x01, 0x01,
+    0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x80, 0x01, 0x01, 0x05, 0xFF, 0x44, 0x01, 0x02, 0x04, 0xFF, 0x02, 0x02, 0x06, 0xFF, 0x02, 0x02, 0x05, 0xFF,
+    0x02, 0x04, 0x06, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x02, 0x04, 0x06, 0xFF, 0x06, 0x0A, 0x0F, 0xFF, 0x13, 0x19, 0x21, 0xFF, 0x0C, 0x10, 0x17, 0xFF,
+    0x0E, 0x11, 0x18, 0xFF, 0x0E, 0x12, 0x18, 0xFF, 0x0E, 0x12, 0x19, 0xFF, 0x0F, 0x13, 0x1A, 0xFF, 0x0F, 0x13, 0x1B, 0xFF, 0x0E, 0x13, 0x1C, 0xFF,
+    0x0F, 0x13, 0x1B, 0xFF, 0x0F, 0x13, 0x1C, 0xFF, 0x10, 0x13, 0x1C, 0xFF, 0x0A, 0x0D, 0x16, 0xFF, 0x71, 0x75, 0x7E, 0xFF, 0x8C, 0x90, 0x97, 0xFF,
+    0x0B, 0x16, 0x29, 0xFF, 0x42, 0x49, 0x67, 0xFF, 0x5D, 0x5D, 0x79, 0xFF, 0x56, 0x55, 0x6C, 0xFF, 0x14, 0x15, 0x1C, 0xFF, 0x04, 0x06, 0x0B, 0xFF,
+    0x03, 0x04, 0x08, 0xFF, 0x1A, 0x1E, 0x28, 0xFF, 0x2B, 0x2E, 0x40, 0xFF, 0x19, 0x1B, 0x29, 0xFF, 0x1D, 0x20, 0x2F, 0xFF, 0x1F, 0x22, 0x31, 0xFF,
+    0x21, 0x25, 0x33, 0xFF, 0x22, 0x27, 0x36, 0xFF, 0x23, 0x28, 0x37, 0xFF, 0x24, 0x29, 0x37, 0xFF, 0x26, 0x29, 0x39, 0xFF, 0x27, 0x2C, 0x3B, 0xFF,
+    0x28, 0x2E, 0x3E, 0xFF, 0x29, 0x2E, 0x3F, 0xFF, 0x57, 0x5D, 0x6E, 0xFF, 0x8A, 0x93, 0xA5, 0xFF, 0x2F, 0x36, 0x4F, 0xFF, 0x4E, 0x55, 0x6F, 0xFF,
+    0x4A, 0x51, 0x6A, 0xFF, 0x15, 0x1A, 0x26, 0xFF, 0x06, 0x07, 0x0F, 0xFF, 0x13, 0x15, 0x21, 0xFF, 0x2D, 0x30, 0x43, 0xFF, 0x25, 0x2C, 0x3A, 0xFF,
+    0x2A, 0x2F, 0x41, 0xFF, 0x27, 0x2E, 0x3F, 0xFF, 0x26, 0x2D, 0x3D, 0xFF, 0x29, 0x2E, 0x3F, 0xFF, 0x2D, 0x32, 0x44, 0xFF, 0x31, 0x37, 0x4A, 0xFF,
+    0x36, 0x3C, 0x50, 0xFF, 0x3A, 0x40, 0x56, 0xFF, 0x37, 0x3D, 0x55, 0xFF, 0x4F, 0x57, 0x67, 0xFF, 0xCA, 0xCC, 0xD3, 0xFF, 0xB0, 0xB1, 0xBD, 0xFF,
+    0xA1, 0xA5, 0xB1, 0xFF, 0x3C, 0x3F, 0x4C, 0xFF, 0x38, 0x3C, 0x4C, 0xFF, 0x5C, 0x5F, 0x72, 0xFF, 0x2B, 0x32, 0x44, 0xFF, 0x31, 0x38, 0x4E, 0xFF,
+    0x80, 0x32, 0x3A, 0x4F, 0xFF, 0x26, 0x33, 0x39, 0x4D, 0xFF, 0x35, 0x3C, 0x4F, 0xFF, 0x36, 0x3D, 0x52, 0xFF, 0x37, 0x3E, 0x52, 0xFF, 0x39, 0x40,
+    0x56, 0xFF, 0x35, 0x3D, 0x51, 0xFF, 0x4B, 0x52, 0x66, 0xFF, 0x3E, 0x45, 0x59, 0xFF, 0x25, 0x29, 0x3D, 0xFF, 0x3D, 0x40, 0x5A, 0xFF, 0x07, 0x0E,
+    0x19, 0xFF, 0x08, 0x0D, 0x1A, 0xFF, 0x0A, 0x0E, 0x19, 0xFF, 0x43, 0x46, 0x58, 0xFF, 0x4D, 0x51, 0x67, 0xFF, 0x42, 0x47, 0x5E, 0xFF, 0x45, 0x4A,
+    0x60, 0xFF, 0x43, 0x49, 0x60, 0xFF, 0x43, 0x49, 0x5F, 0xFF, 0x44, 0x48, 0x60, 0xFF, 0x43, 0x49, 0x60, 0xFF, 0x40, 0x47, 0x5D, 0xFF, 0x40, 0x46,
+    0x5C, 0xFF, 0x43, 0x48, 0x5F, 0xFF, 0x44, 0x4A, 0x60, 0xFF, 0x46, 0x4C, 0x60, 0xFF, 0x85, 0x8B, 0x9C, 0xFF, 0x73, 0x79, 0x8E, 0xFF, 0x43, 0x48,
+    0x58, 0xFF, 0x07, 0x09, 0x12, 0xFF, 0x0B, 0x0F, 0x1C, 0xFF, 0x2A, 0x2E, 0x3B, 0xFF, 0x69, 0x6C, 0x7A, 0xFF, 0x51, 0x56, 0x67, 0xFF, 0x4B, 0x53,
+    0x67, 0xFF, 0x49, 0x52, 0x66, 0xFF, 0x49, 0x50, 0x66, 0xFF, 0x47, 0x50, 0x64, 0xFF, 0x44, 0x4C, 0x60, 0xFF, 0x80, 0x42, 0x49, 0x5E, 0xFF, 0x05,
+    0x44, 0x4B, 0x60, 0xFF, 0x47, 0x4F, 0x64, 0xFF, 0x4A, 0x52, 0x68, 0xFF, 0x4C, 0x54, 0x6A, 0xFF, 0x4C, 0x53, 0x69, 0xFF, 0x4D, 0x54, 0x69, 0xFF,
+    0x80, 0x4E, 0x55, 0x6B, 0xFF, 0x29, 0x4D, 0x54, 0x68, 0xFF, 0x50, 0x58, 0x6C, 0xFF, 0x50, 0x56, 0x6B, 0xFF, 0x50, 0x57, 0x6B, 0xFF, 0x52, 0x5A,
+    0x6F, 0xFF, 0x50, 0x57, 0x6C, 0xFF, 0x4C, 0x54, 0x6A, 0xFF, 0x4A, 0x50, 0x66, 0xFF, 0x49, 0x50, 0x66, 0xFF, 0x4C, 0x55, 0x6A, 0xFF, 0x4B, 0x51,
+    0x67, 0xFF, 0x49, 0x52, 0x65, 0xFF, 0x4E, 0x55, 0x6B, 0xFF, 0x49, 0x51, 0x66, 0xFF, 0x49, 0x51, 0x65, 0xFF, 0x4B, 0x55, 0x69, 0xFF, 0x49, 0x53,
+    0x68, 0xFF, 0x49, 0x52, 0x67, 0xFF, 0x49, 0x53, 0x68, 0xFF, 0x49, 0x52, 0x68, 0xFF, 0x49, 0x51, 0x66, 0xFF, 0x44, 0x4C, 0x5F, 0xFF, 0x44, 0x4B,
+    0x60, 0xFF, 0x43, 0x4C, 0x60, 0xFF, 0x44, 0x4C, 0x61, 0xFF, 0x47, 0x4F, 0x63, 0xFF, 0x48, 0x51, 0x65, 0xFF, 0x4B, 0x52, 0x66, 0xFF, 0x5A, 0x5F,
+    0x6F, 0xFF, 0x66, 0x6A, 0x78, 0xFF, 0x21, 0x25, 0x37, 0xFF, 0x17, 0x1B, 0x2C, 0xFF, 0x7E, 0x81, 0x91, 0xFF, 0x88, 0x8C, 0x9C, 0xFF, 0x53, 0x5B,
+    0x6F, 0xFF, 0x4F, 0x57, 0x6D, 0xFF, 0x4E, 0x56, 0x6B, 0xFF, 0x4A, 0x52, 0x66, 0xFF, 0x47, 0x4E, 0x62, 0xFF, 0x45, 0x4C, 0x5F, 0xFF, 0x44, 0x4C,
+    0x60, 0xFF, 0x47, 0x4F, 0x63, 0xFF, 0x80, 0x4A, 0x52, 0x67, 0xFF, 0x03, 0x45, 0x4D, 0x61, 0xFF, 0x41, 0x48, 0x5D, 0xFF, 0x11, 0x15, 0x1F, 0xFF,
+    0x06, 0x09, 0x13, 0xFF, 0x80, 0x08, 0x0B, 0x17, 0xFF, 0x80, 0x07, 0x0A, 0x16, 0xFF, 0x01, 0x07, 0x0A, 0x15, 0xFF, 0x07, 0x09, 0x15, 0xFF, 0x80,
+    0x06, 0x09, 0x15, 0xFF, 0x01, 0x06, 0x09, 0x14, 0xFF, 0x07, 0x09, 0x15, 0xFF, 0x80, 0x07, 0x0A, 0x15, 0xFF, 0x22, 0x08, 0x0A, 0x17, 0xFF, 0x08,
+    0x0A, 0x19, 0xFF, 0x09, 0x0B, 0x1A, 0xFF, 0x09, 0x0C, 0x19, 0xFF, 0x04, 0x05, 0x0E, 0xFF, 0x27, 0x2C, 0x3C, 0xFF, 0x49, 0x50, 0x64, 0xFF, 0x46,
+    0x4D, 0x60, 0xFF, 0x7E, 0x86, 0x9A, 0xFF, 0x36, 0x3C, 0x51, 0xFF, 0x3D, 0x43, 0x59, 0xFF, 0x3D, 0x44, 0x59, 0xFF, 0x3C, 0x43, 0x58, 0xFF, 0x3C,
+    0x44, 0x58, 0xFF, 0x40, 0x47, 0x5B, 0xFF, 0x3E, 0x46, 0x5A, 0xFF, 0x3F, 0x46, 0x5B, 0xFF, 0x43, 0x4A, 0x5E, 0xFF, 0x45, 0x4D, 0x61, 0xFF, 0x46,
+    0x4E, 0x62, 0xFF, 0x4C, 0x54, 0x69, 0xFF, 0x1D, 0x22, 0x2F, 0xFF, 0x07, 0x0C, 0x16, 0xFF, 0x08, 0x0D, 0x17, 0xFF, 0x23, 0x28, 0x33, 0xFF, 0x5F,
+    0x65, 0x79, 0xFF, 0x43, 0x47, 0x5B, 0xFF, 0x79, 0x7F, 0x8E, 0xFF, 0x7E, 0x84, 0x96, 0xFF, 0x38, 0x3E, 0x52, 0xFF, 0x34, 0x3B, 0x4E, 0xFF, 0x35,
+    0x3A, 0x4E, 0xFF, 0x34, 0x3A, 0x4D, 0xFF, 0x33, 0x39, 0x4E, 0xFF, 0x32, 0x38, 0x4C, 0xFF, 0x80, 0x31, 0x37, 0x4C, 0xFF, 0x1A, 0x32, 0x38, 0x4D,
+    0xFF, 0x32, 0x37, 0x4D, 0xFF, 0x36, 0x3C, 0x51, 0xFF, 0x37, 0x3B, 0x4E, 0xFF, 0x0F, 0x11, 0x1A, 0xFF, 0x4F, 0x53, 0x65, 0xFF, 0x71, 0x79, 0x93,
+    0xFF, 0x57, 0x5D, 0x74, 0xFF, 0x61, 0x66, 0x78, 0xFF, 0x94, 0x9C, 0xAE, 0xFF, 0x3C, 0x44, 0x54, 0xFF, 0x1F, 0x26, 0x33, 0xFF, 0x23, 0x28, 0x37,
+    0xFF, 0x21, 0x28, 0x37, 0xFF, 0x21, 0x28, 0x34, 0xFF, 0x1F, 0x24, 0x31, 0xFF, 0x1B, 0x21, 0x2D, 0xFF, 0x1B, 0x20, 0x2D, 0xFF, 0x1B, 0x20, 0x2E,
+    0xFF, 0x1B, 0x1F, 0x2D, 0xFF, 0x1A, 0x1F, 0x2B, 0xFF, 0x1D, 0x21, 0x2B, 0xFF, 0x0C, 0x10, 0x1A, 0xFF, 0x06, 0x08, 0x12, 0xFF, 0x05, 0x07, 0x12,
+    0xFF, 0x05, 0x07, 0x10, 0xFF, 0x04, 0x07, 0x0F, 0xFF, 0x80, 0x04, 0x06, 0x0F, 0xFF, 0x16, 0x04, 0x06, 0x10, 0xFF, 0x04, 0x07, 0x10, 0xFF, 0x04,
+    0x07, 0x11, 0xFF, 0x05, 0x07, 0x12, 0xFF, 0x05, 0x07, 0x13, 0xFF, 0x05, 0x08, 0x14, 0xFF, 0x06, 0x08, 0x15, 0xFF, 0x06, 0x0A, 0x16, 0xFF, 0x02,
+    0x04, 0x0A, 0xFF, 0x37, 0x35, 0x3F, 0xFF, 0x64, 0x67, 0x7C, 0xFF, 0x46, 0x4A, 0x63, 0xFF, 0x30, 0x32, 0x4A, 0xFF, 0x20, 0x20, 0x32, 0xFF, 0x49,
+    0x51, 0x5F, 0xFF, 0x55, 0x5E, 0x6C, 0xFF, 0x04, 0x07, 0x0E, 0xFF, 0x0D, 0x13, 0x19, 0xFF, 0x0E, 0x13, 0x19, 0xFF, 0x0D, 0x12, 0x18, 0xFF, 0x0D,
+    0x11, 0x17, 0xFF, 0x0D, 0x12, 0x17, 0xFF, 0x0C, 0x11, 0x16, 0xFF, 0x80, 0x0B, 0x0F, 0x14, 0xFF, 0x05, 0x0A, 0x0F, 0x13, 0xFF, 0x09, 0x0C, 0x10,
+    0xFF, 0x18, 0x1D, 0x21, 0xFF, 0x03, 0x04, 0x07, 0xFF, 0x01, 0x03, 0x05, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01,
+    0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x82, 0x00, 0x00, 0x02, 0xFF, 0x13, 0x00, 0x01, 0x03, 0xFF,
+    0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x02, 0x03, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x06, 0xFF,
+    0x00, 0x01, 0x05, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x03, 0x05, 0xFF, 0x02, 0x02, 0x07, 0xFF, 0x02, 0x02, 0x06, 0xFF, 0x01, 0x03, 0x07, 0xFF,
+    0x01, 0x03, 0x05, 0xFF, 0x05, 0x09, 0x0E, 0xFF, 0x12, 0x18, 0x20, 0xFF, 0x0C, 0x0F, 0x16, 0xFF, 0x0C, 0x11, 0x17, 0xFF, 0x0E, 0x11, 0x18, 0xFF,
+    0x0E, 0x12, 0x18, 0xFF, 0x80, 0x0D, 0x11, 0x18, 0xFF, 0x60, 0x0D, 0x12, 0x18, 0xFF, 0x0E, 0x12, 0x1A, 0xFF, 0x0F, 0x13, 0x1B, 0xFF, 0x10, 0x12,
+    0x1D, 0xFF, 0x0A, 0x0C, 0x15, 0xFF, 0x6E, 0x71, 0x7B, 0xFF, 0x88, 0x8D, 0x96, 0xFF, 0x0A, 0x16, 0x29, 0xFF, 0x3F, 0x47, 0x65, 0xFF, 0x5A, 0x5C,
+    0x78, 0xFF, 0x56, 0x55, 0x6C, 0xFF, 0x14, 0x15, 0x1C, 0xFF, 0x03, 0x06, 0x0A, 0xFF, 0x03, 0x04, 0x08, 0xFF, 0x1A, 0x1E, 0x28, 0xFF, 0x2A, 0x2F,
+    0x3F, 0xFF, 0x19, 0x1C, 0x29, 0xFF, 0x1D, 0x20, 0x30, 0xFF, 0x1E, 0x22, 0x32, 0xFF, 0x20, 0x25, 0x33, 0xFF, 0x22, 0x28, 0x35, 0xFF, 0x23, 0x27,
+    0x36, 0xFF, 0x23, 0x29, 0x37, 0xFF, 0x23, 0x29, 0x38, 0xFF, 0x24, 0x2A, 0x39, 0xFF, 0x26, 0x2C, 0x3B, 0xFF, 0x27, 0x2C, 0x3D, 0xFF, 0x53, 0x59,
+    0x6B, 0xFF, 0x85, 0x8D, 0xA2, 0xFF, 0x2B, 0x32, 0x4A, 0xFF, 0x49, 0x4F, 0x6A, 0xFF, 0x45, 0x4B, 0x65, 0xFF, 0x12, 0x15, 0x21, 0xFF, 0x06, 0x08,
+    0x11, 0xFF, 0x09, 0x0B, 0x14, 0xFF, 0x1D, 0x21, 0x2E, 0xFF, 0x26, 0x2C, 0x3C, 0xFF, 0x27, 0x2C, 0x3D, 0xFF, 0x27, 0x2E, 0x3E, 0xFF, 0x28, 0x2E,
+    0x3F, 0xFF, 0x2B, 0x30, 0x41, 0xFF, 0x2D, 0x32, 0x43, 0xFF, 0x2F, 0x34, 0x47, 0xFF, 0x33, 0x39, 0x4D, 0xFF, 0x38, 0x3F, 0x54, 0xFF, 0x39, 0x3F,
+    0x55, 0xFF, 0x2E, 0x37, 0x4A, 0xFF, 0xC1, 0xC2, 0xCE, 0xFF, 0xB9, 0xBA, 0xC4, 0xFF, 0xAC, 0xAF, 0xBC, 0xFF, 0x6E, 0x71, 0x7F, 0xFF, 0x3D, 0x41,
+    0x53, 0xFF, 0x47, 0x4A, 0x5D, 0xFF, 0x2D, 0x35, 0x47, 0xFF, 0x33, 0x39, 0x4E, 0xFF, 0x31, 0x37, 0x4E, 0xFF, 0x30, 0x36, 0x4B, 0xFF, 0x31, 0x37,
+    0x4B, 0xFF, 0x33, 0x3B, 0x4F, 0xFF, 0x35, 0x3D, 0x51, 0xFF, 0x37, 0x3E, 0x52, 0xFF, 0x36, 0x3D, 0x51, 0xFF, 0x37, 0x3E, 0x53, 0xFF, 0x4B, 0x54,
+    0x68, 0xFF, 0x28, 0x2D, 0x41, 0xFF, 0x32, 0x37, 0x4E, 0xFF, 0x27, 0x2C, 0x3E, 0xFF, 0x09, 0x0D, 0x1C, 0xFF, 0x08, 0x0D, 0x1A, 0xFF, 0x0B, 0x0F,
+    0x1A, 0xFF, 0x42, 0x45, 0x57, 0xFF, 0x4B, 0x4F, 0x65, 0xFF, 0x40, 0x46, 0x5B, 0xFF, 0x40, 0x46, 0x5D, 0xFF, 0x41, 0x47, 0x5D, 0xFF, 0x3F, 0x46,
+    0x5C, 0xFF, 0x40, 0x46, 0x5D, 0xFF, 0x42, 0x48, 0x5F, 0xFF, 0x41, 0x47, 0x5E, 0xFF, 0x40, 0x46, 0x5C, 0xFF, 0x42, 0x48, 0x5D, 0xFF, 0x42, 0x48,
+    0x5E, 0xFF, 0x44, 0x49, 0x5E, 0xFF, 0x84, 0x89, 0x9C, 0xFF, 0x71, 0x77, 0x8C, 0xFF, 0x42, 0x47, 0x57, 0xFF, 0x06, 0x08, 0x12, 0xFF, 0x07, 0x0B,
+    0x19, 0xFF, 0x31, 0x35, 0x43, 0xFF, 0x61, 0x65, 0x75, 0xFF, 0x4A, 0x50, 0x62, 0xFF, 0x45, 0x4D, 0x61, 0xFF, 0x46, 0x4F, 0x63, 0xFF, 0x47, 0x50,
+    0x65, 0xFF, 0x48, 0x50, 0x64, 0xFF, 0x46, 0x4D, 0x62, 0xFF, 0x43, 0x4A, 0x5F, 0xFF, 0x80, 0x41, 0x48, 0x5D, 0xFF, 0x1E, 0x44, 0x4B, 0x61, 0xFF,
+    0x46, 0x4E, 0x64, 0xFF, 0x47, 0x4F, 0x63, 0xFF, 0x48, 0x4F, 0x65, 0xFF, 0x49, 0x51, 0x66, 0xFF, 0x4D, 0x54, 0x6A, 0xFF, 0x4D, 0x54, 0x69, 0xFF,
+    0x4C, 0x53, 0x67, 0xFF, 0x4D, 0x54, 0x68, 0xFF, 0x4D, 0x53, 0x67, 0xFF, 0x4E, 0x55, 0x69, 0xFF, 0x4F, 0x56, 0x6B, 0xFF, 0x4B, 0x53, 0x69, 0xFF,
+    0x49, 0x51, 0x67, 0xFF, 0x46, 0x4D, 0x63, 0xFF, 0x43, 0x4B, 0x5F, 0xFF, 0x49, 0x52, 0x66, 0xFF, 0x4B, 0x53, 0x68, 0xFF, 0x4C, 0x53, 0x68, 0xFF,
+    0x4E, 0x55, 0x6A, 0xFF, 0x47, 0x50, 0x63, 0xFF, 0x44, 0x4B, 0x60, 0xFF, 0x48, 0x51, 0x65, 0xFF, 0x4D, 0x55, 0x6A, 0xFF, 0x4A, 0x53, 0x67, 0xFF,
+    0x47, 0x50, 0x65, 0xFF, 0x45, 0x4F, 0x63, 0xFF, 0x46, 0x4E, 0x63, 0xFF, 0x45, 0x4E, 0x62, 0xFF, 0x46, 0x4E, 0x63, 0xFF, 0x44, 0x4B, 0x60, 0xFF,
+    0x80, 0x42, 0x4A, 0x5E, 0xFF, 0x17, 0x44, 0x4C, 0x61, 0xFF, 0x45, 0x4C, 0x60, 0xFF, 0x50, 0x55, 0x66, 0xFF, 0x5A, 0x5D, 0x6D, 0xFF, 0x25, 0x29,
+    0x3B, 0xFF, 0x23, 0x26, 0x38, 0xFF, 0x7D, 0x81, 0x93, 0xFF, 0x7D, 0x82, 0x93, 0xFF, 0x4F, 0x57, 0x6B, 0xFF, 0x4C, 0x55, 0x69, 0xFF, 0x4D, 0x55,
+    0x6A, 0xFF, 0x49, 0x52, 0x65, 0xFF, 0x45, 0x4D, 0x61, 0xFF, 0x41, 0x49, 0x5C, 0xFF, 0x43, 0x4A, 0x5E, 0xFF, 0x45, 0x4D, 0x61, 0xFF, 0x47, 0x4F,
+    0x63, 0xFF, 0x46, 0x4E, 0x61, 0xFF, 0x41, 0x4A, 0x5C, 0xFF, 0x42, 0x49, 0x5C, 0xFF, 0x12, 0x16, 0x1D, 0xFF, 0x06, 0x08, 0x12, 0xFF, 0x08, 0x0A,
+    0x16, 0xFF, 0x07, 0x0A, 0x16, 0xFF, 0x80, 0x07, 0x09, 0x15, 0xFF, 0x81, 0x06, 0x09, 0x15, 0xFF, 0x80, 0x06, 0x08, 0x14, 0xFF, 0x80, 0x07, 0x09,
+    0x15, 0xFF, 0x0B, 0x07, 0x09, 0x16, 0xFF, 0x08, 0x0A, 0x17, 0xFF, 0x08, 0x0A, 0x19, 0xFF, 0x09, 0x0B, 0x1A, 0xFF, 0x0A, 0x0D, 0x1B, 0xFF, 0x05,
+    0x07, 0x11, 0xFF, 0x28, 0x2D, 0x3B, 0xFF, 0x4F, 0x56, 0x6A, 0xFF, 0x37, 0x3E, 0x51, 0xFF, 0x84, 0x8C, 0x9E, 0xFF, 0x34, 0x3B, 0x4E, 0xFF, 0x39,
+    0x3F, 0x54, 0xFF, 0x80, 0x3A, 0x41, 0x56, 0xFF, 0x04, 0x3B, 0x42, 0x57, 0xFF, 0x40, 0x46, 0x5B, 0xFF, 0x3F, 0x46, 0x5B, 0xFF, 0x40, 0x47, 0x5B,
+    0xFF, 0x41, 0x49, 0x5E, 0xFF, 0x80, 0x43, 0x4A, 0x5F, 0xFF, 0x0D, 0x4A, 0x51, 0x67, 0xFF, 0x1D, 0x21, 0x2E, 0xFF, 0x07, 0x0D, 0x18, 0xFF, 0x09,
+    0x0E, 0x1A, 0xFF, 0x23, 0x28, 0x35, 0xFF, 0x5F, 0x65, 0x79, 0xFF, 0x43, 0x48, 0x5B, 0xFF, 0x78, 0x7E, 0x8D, 0xFF, 0x7A, 0x80, 0x92, 0xFF, 0x34,
+    0x3B, 0x4E, 0xFF, 0x32, 0x38, 0x4C, 0xFF, 0x33, 0x38, 0x4C, 0xFF, 0x32, 0x37, 0x4B, 0xFF, 0x31, 0x36, 0x4A, 0xFF, 0x80, 0x2E, 0x34, 0x48, 0xFF,
+    0x17, 0x2F, 0x34, 0x49, 0xFF, 0x2F, 0x34, 0x48, 0xFF, 0x30, 0x36, 0x4A, 0xFF, 0x35, 0x3B, 0x4F, 0xFF, 0x38, 0x3B, 0x4D, 0xFF, 0x0F, 0x12, 0x1B,
+    0xFF, 0x51, 0x54, 0x67, 0xFF, 0x6A, 0x72, 0x8C, 0xFF, 0x51, 0x57, 0x6D, 0xFF, 0x5B, 0x5F, 0x70, 0xFF, 0x86, 0x8E, 0xA0, 0xFF, 0x30, 0x3A, 0x48,
+    0xFF, 0x1D, 0x23, 0x30, 0xFF, 0x1F, 0x25, 0x32, 0xFF, 0x1F, 0x26, 0x33, 0xFF, 0x1F, 0x25, 0x33, 0xFF, 0x1E, 0x23, 0x30, 0xFF, 0x1B, 0x20, 0x2C,
+    0xFF, 0x1A, 0x1E, 0x2B, 0xFF, 0x19, 0x1E, 0x2C, 0xFF, 0x18, 0x1D, 0x2A, 0xFF, 0x18, 0x1E, 0x2A, 0xFF, 0x1D, 0x22, 0x2D, 0xFF, 0x08, 0x0D, 0x17,
+    0xFF, 0x80, 0x05, 0x07, 0x13, 0xFF, 0x01, 0x05, 0x07, 0x0F, 0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x80, 0x04, 0x05, 0x0F, 0xFF, 0x13, 0x03, 0x05, 0x0F,
+    0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x04, 0x06, 0x10, 0xFF, 0x05, 0x06, 0x11, 0xFF, 0x04, 0x07, 0x12, 0xFF, 0x05, 0x08, 0x13, 0xFF, 0x06, 0x09, 0x16,
+    0xFF, 0x06, 0x0B, 0x17, 0xFF, 0x03, 0x06, 0x0F, 0xFF, 0x3A, 0x36, 0x41, 0xFF, 0x6E, 0x70, 0x84, 0xFF, 0x56, 0x5B, 0x73, 0xFF, 0x3D, 0x40, 0x58,
+    0xFF, 0x27, 0x28, 0x3B, 0xFF, 0x4E, 0x53, 0x61, 0xFF, 0x66, 0x70, 0x7E, 0xFF, 0x07, 0x0C, 0x15, 0xFF, 0x0E, 0x14, 0x1A, 0xFF, 0x0E, 0x13, 0x19,
+    0xFF, 0x0D, 0x11, 0x17, 0xFF, 0x80, 0x0C, 0x10, 0x15, 0xFF, 0x81, 0x0C, 0x10, 0x16, 0xFF, 0x05, 0x0B, 0x10, 0x15, 0xFF, 0x09, 0x0C, 0x11, 0xFF,
+    0x18, 0x1C, 0x21, 0xFF, 0x03, 0x04, 0x07, 0xFF, 0x02, 0x03, 0x05, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x06, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0xFF, 0x16, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x03, 0xFF, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x01,
+    0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x01,
+    0x03, 0x06, 0xFF, 0x02, 0x03, 0x07, 0xFF, 0x01, 0x03, 0x05, 0xFF, 0x06, 0x09, 0x0E, 0xFF, 0x12, 0x17, 0x20, 0xFF, 0x0C, 0x0F, 0x16, 0xFF, 0x83,
+    0x0D, 0x10, 0x17, 0xFF, 0x4A, 0x0C, 0x10, 0x17, 0xFF, 0x0E, 0x12, 0x19, 0xFF, 0x0E, 0x13, 0x1B, 0xFF, 0x0F, 0x12, 0x1D, 0xFF, 0x0A, 0x0C, 0x14,
+    0xFF, 0x6B, 0x6D, 0x76, 0xFF, 0x85, 0x8B, 0x94, 0xFF, 0x08, 0x15, 0x28, 0xFF, 0x3E, 0x45, 0x63, 0xFF, 0x5A, 0x5B, 0x76, 0xFF, 0x54, 0x54, 0x6B,
+    0xFF, 0x14, 0x15, 0x1D, 0xFF, 0x04, 0x06, 0x0A, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x19, 0x1E, 0x28, 0xFF, 0x2A, 0x2E, 0x3F, 0xFF, 0x1A, 0x1D, 0x2C,
+    0xFF, 0x1E, 0x22, 0x31, 0xFF, 0x20, 0x23, 0x32, 0xFF, 0x20, 0x25, 0x34, 0xFF, 0x21, 0x26, 0x35, 0xFF, 0x22, 0x27, 0x35, 0xFF, 0x22, 0x27, 0x36,
+    0xFF, 0x22, 0x26, 0x35, 0xFF, 0x23, 0x28, 0x37, 0xFF, 0x23, 0x29, 0x3A, 0xFF, 0x25, 0x2B, 0x3A, 0xFF, 0x4F, 0x56, 0x67, 0xFF, 0x81, 0x8A, 0x9F,
+    0xFF, 0x28, 0x2E, 0x47, 0xFF, 0x46, 0x4C, 0x67, 0xFF, 0x44, 0x49, 0x62, 0xFF, 0x11, 0x13, 0x1F, 0xFF, 0x06, 0x08, 0x12, 0xFF, 0x04, 0x06, 0x0E,
+    0xFF, 0x14, 0x17, 0x23, 0xFF, 0x2F, 0x31, 0x45, 0xFF, 0x26, 0x2C, 0x3A, 0xFF, 0x2B, 0x30, 0x41, 0xFF, 0x2B, 0x30, 0x40, 0xFF, 0x2B, 0x30, 0x41,
+    0xFF, 0x2D, 0x32, 0x43, 0xFF, 0x2D, 0x32, 0x44, 0xFF, 0x2F, 0x35, 0x49, 0xFF, 0x34, 0x39, 0x4D, 0xFF, 0x38, 0x3D, 0x52, 0xFF, 0x31, 0x39, 0x50,
+    0xFF, 0x87, 0x8E, 0x9F, 0xFF, 0xC6, 0xC9, 0xD0, 0xFF, 0x9D, 0x9F, 0xAD, 0xFF, 0xA3, 0xA6, 0xB5, 0xFF, 0x4E, 0x51, 0x62, 0xFF, 0x28, 0x2F, 0x41,
+    0xFF, 0x31, 0x36, 0x4D, 0xFF, 0x30, 0x38, 0x4C, 0xFF, 0x30, 0x37, 0x4C, 0xFF, 0x2F, 0x35, 0x4A, 0xFF, 0x30, 0x36, 0x4C, 0xFF, 0x33, 0x3A, 0x4E,
+    0xFF, 0x34, 0x3B, 0x4F, 0xFF, 0x36, 0x3E, 0x51, 0xFF, 0x35, 0x3D, 0x51, 0xFF, 0x37, 0x3E, 0x50, 0xFF, 0x42, 0x48, 0x5E, 0xFF, 0x1B, 0x20, 0x2F,
+    0xFF, 0x36, 0x3B, 0x53, 0xFF, 0x13, 0x17, 0x26, 0xFF, 0x0B, 0x0E, 0x1C, 0xFF, 0x08, 0x0D, 0x1A, 0xFF, 0x0B, 0x0F, 0x1A, 0xFF, 0x41, 0x45, 0x58,
+    0xFF, 0x49, 0x4D, 0x64, 0xFF, 0x3E, 0x43, 0x5A, 0xFF, 0x3E, 0x44, 0x5A, 0xFF, 0x3E, 0x45, 0x5A, 0xFF, 0x80, 0x3F, 0x45, 0x5B, 0xFF, 0x80, 0x40,
+    0x46, 0x5D, 0xFF, 0x25, 0x3F, 0x45, 0x5C, 0xFF, 0x41, 0x47, 0x5D, 0xFF, 0x40, 0x45, 0x5C, 0xFF, 0x43, 0x47, 0x5C, 0xFF, 0x82, 0x88, 0x9A, 0xFF,
+    0x70, 0x75, 0x8B, 0xFF, 0x41, 0x45, 0x55, 0xFF, 0x04, 0x07, 0x10, 0xFF, 0x05, 0x08, 0x16, 0xFF, 0x31, 0x35, 0x43, 0xFF, 0x5E, 0x61, 0x70, 0xFF,
+    0x46, 0x4D, 0x5F, 0xFF, 0x44, 0x4B, 0x5F, 0xFF, 0x47, 0x4E, 0x63, 0xFF, 0x48, 0x50, 0x64, 0xFF, 0x47, 0x4F, 0x64, 0xFF, 0x46, 0x4E, 0x63, 0xFF,
+    0x45, 0x4C, 0x60, 0xFF, 0x42, 0x49, 0x5E, 0xFF, 0x42, 0x48, 0x5D, 0xFF, 0x43, 0x4B, 0x60, 0xFF, 0x45, 0x4C, 0x62, 0xFF, 0x44, 0x4B, 0x60, 0xFF,
+    0x47, 0x4D, 0x62, 0xFF, 0x47, 0x4E, 0x63, 0xFF, 0x48, 0x4F, 0x64, 0xFF, 0x47, 0x4F, 0x64, 0xFF, 0x47, 0x4E, 0x64, 0xFF, 0x49, 0x51, 0x64, 0xFF,
+    0x49, 0x51, 0x65, 0xFF, 0x49, 0x4F, 0x65, 0xFF, 0x47, 0x4D, 0x62, 0xFF, 0x45, 0x4C, 0x61, 0xFF, 0x45, 0x4D, 0x60, 0xFF, 0x44, 0x4B, 0x60, 0xFF,
+    0x41, 0x48, 0x5D, 0xFF, 0x46, 0x4E, 0x63, 0xFF, 0x49, 0x52, 0x66, 0xFF, 0x80, 0x4A, 0x52, 0x67, 0xFF, 0x23, 0x45, 0x4E, 0x62, 0xFF, 0x41, 0x49,
+    0x5E, 0xFF, 0x44, 0x4C, 0x61, 0xFF, 0x47, 0x50, 0x64, 0xFF, 0x47, 0x4E, 0x63, 0xFF, 0x42, 0x4B, 0x60, 0xFF, 0x40, 0x49, 0x5E, 0xFF, 0x42, 0x4A,
+    0x60, 0xFF, 0x43, 0x4B, 0x61, 0xFF, 0x44, 0x4D, 0x61, 0xFF, 0x42, 0x4B, 0x5E, 0xFF, 0x3F, 0x46, 0x5A, 0xFF, 0x3D, 0x44, 0x58, 0xFF, 0x3F, 0x47,
+    0x5C, 0xFF, 0x3F, 0x47, 0x5B, 0xFF, 0x49, 0x4E, 0x5E, 0xFF, 0x54, 0x57, 0x68, 0xFF, 0x24, 0x29, 0x3B, 0xFF, 0x27, 0x2B, 0x3E, 0xFF, 0x78, 0x7C,
+    0x8E, 0xFF, 0x77, 0x7C, 0x8E, 0xFF, 0x4E, 0x54, 0x6A, 0xFF, 0x4B, 0x53, 0x67, 0xFF, 0x49, 0x52, 0x65, 0xFF, 0x48, 0x50, 0x64, 0xFF, 0x46, 0x4D,
+    0x62, 0xFF, 0x42, 0x4A, 0x5D, 0xFF, 0x43, 0x4B, 0x5D, 0xFF, 0x44, 0x4B, 0x5F, 0xFF, 0x43, 0x4B, 0x5E, 0xFF, 0x43, 0x4A, 0x5D, 0xFF, 0x41, 0x47,
+    0x5A, 0xFF, 0x46, 0x4C, 0x5F, 0xFF, 0x17, 0x18, 0x21, 0xFF, 0x06, 0x08, 0x12, 0xFF, 0x07, 0x0A, 0x16, 0xFF, 0x80, 0x07, 0x09, 0x15, 0xFF, 0x00,
+    0x06, 0x09, 0x14, 0xFF, 0x80, 0x06, 0x09, 0x15, 0xFF, 0x04, 0x06, 0x08, 0x15, 0xFF, 0x06, 0x09, 0x15, 0xFF, 0x06, 0x08, 0x15, 0xFF, 0x07, 0x09,
+    0x15, 0xFF, 0x07, 0x09, 0x16, 0xFF, 0x80, 0x07, 0x09, 0x17, 0xFF, 0x0F, 0x08, 0x0A, 0x19, 0xFF, 0x0A, 0x0C, 0x1B, 0xFF, 0x0B, 0x0E, 0x1E, 0xFF,
+    0x06, 0x07, 0x14, 0xFF, 0x30, 0x34, 0x41, 0xFF, 0x50, 0x58, 0x6B, 0xFF, 0x3C, 0x41, 0x54, 0xFF, 0x8C, 0x92, 0xA3, 0xFF, 0x32, 0x3A, 0x4C, 0xFF,
+    0x37, 0x3D, 0x50, 0xFF, 0x39, 0x3F, 0x54, 0xFF, 0x38, 0x3F, 0x55, 0xFF, 0x3A, 0x41, 0x56, 0xFF, 0x3C, 0x44, 0x58, 0xFF, 0x3D, 0x45, 0x5A, 0xFF,
+    0x3F, 0x46, 0x5A, 0xFF, 0x81, 0x40, 0x47, 0x5C, 0xFF, 0x4C, 0x49, 0x4F, 0x65, 0xFF, 0x1D, 0x21, 0x2E, 0xFF, 0x07, 0x0D, 0x19, 0xFF, 0x09, 0x0E,
+    0x1B, 0xFF, 0x25, 0x29, 0x35, 0xFF, 0x60, 0x65, 0x78, 0xFF, 0x42, 0x48, 0x5B, 0xFF, 0x75, 0x7C, 0x8D, 0xFF, 0x76, 0x7B, 0x90, 0xFF, 0x32, 0x37,
+    0x4A, 0xFF, 0x30, 0x35, 0x49, 0xFF, 0x30, 0x35, 0x48, 0xFF, 0x2E, 0x33, 0x47, 0xFF, 0x2C, 0x31, 0x45, 0xFF, 0x2A, 0x2F, 0x43, 0xFF, 0x2B, 0x30,
+    0x44, 0xFF, 0x2E, 0x33, 0x47, 0xFF, 0x30, 0x34, 0x48, 0xFF, 0x2F, 0x36, 0x49, 0xFF, 0x35, 0x3B, 0x4E, 0xFF, 0x39, 0x3C, 0x4D, 0xFF, 0x10, 0x13,
+    0x1B, 0xFF, 0x51, 0x54, 0x66, 0xFF, 0x67, 0x6E, 0x88, 0xFF, 0x4C, 0x52, 0x69, 0xFF, 0x53, 0x57, 0x67, 0xFF, 0x7E, 0x85, 0x97, 0xFF, 0x2D, 0x36,
+    0x45, 0xFF, 0x19, 0x20, 0x2D, 0xFF, 0x1D, 0x22, 0x2E, 0xFF, 0x1D, 0x23, 0x2F, 0xFF, 0x1E, 0x23, 0x30, 0xFF, 0x1D, 0x23, 0x30, 0xFF, 0x1B, 0x20,
+    0x2D, 0xFF, 0x19, 0x1E, 0x2B, 0xFF, 0x17, 0x1C, 0x29, 0xFF, 0x17, 0x1C, 0x28, 0xFF, 0x18, 0x1E, 0x29, 0xFF, 0x1E, 0x22, 0x2D, 0xFF, 0x07, 0x0B,
+    0x16, 0xFF, 0x06, 0x07, 0x13, 0xFF, 0x06, 0x08, 0x13, 0xFF, 0x04, 0x07, 0x10, 0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x05, 0x06, 0x0F, 0xFF, 0x04, 0x06,
+    0x0F, 0xFF, 0x03, 0x06, 0x0F, 0xFF, 0x03, 0x05, 0x0F, 0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x04, 0x06, 0x10, 0xFF, 0x04, 0x06, 0x11, 0xFF, 0x05, 0x08,
+    0x12, 0xFF, 0x06, 0x09, 0x15, 0xFF, 0x07, 0x0A, 0x17, 0xFF, 0x04, 0x07, 0x10, 0xFF, 0x3C, 0x39, 0x42, 0xFF, 0x74, 0x78, 0x89, 0xFF, 0x65, 0x6B,
+    0x7F, 0xFF, 0x49, 0x4D, 0x63, 0xFF, 0x2F, 0x30, 0x44, 0xFF, 0x53, 0x57, 0x63, 0xFF, 0x75, 0x7E, 0x89, 0xFF, 0x0D, 0x13, 0x1B, 0xFF, 0x0E, 0x14,
+    0x1A, 0xFF, 0x0D, 0x12, 0x18, 0xFF, 0x0C, 0x11, 0x16, 0xFF, 0x0B, 0x0F, 0x14, 0xFF, 0x0B, 0x0E, 0x14, 0xFF, 0x0B, 0x0F, 0x15, 0xFF, 0x0C, 0x10,
+    0x15, 0xFF, 0x0B, 0x10, 0x15, 0xFF, 0x0B, 0x0E, 0x13, 0xFF, 0x09, 0x0C, 0x10, 0xFF, 0x17, 0x1C, 0x21, 0xFF, 0x03, 0x04, 0x07, 0xFF, 0x02, 0x03,
+    0x05, 0xFF, 0x02, 0x03, 0x06, 0xFF, 0x06, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01,
+    0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x04, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x03, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00,
+    0x01, 0x03, 0xFF, 0x80, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x02, 0x04, 0xFF, 0x01, 0x00, 0x06, 0xFF, 0x80, 0x01, 0x02, 0x05, 0xFF, 0x09, 0x01,
+    0x01, 0x05, 0xFF, 0x01, 0x03, 0x05, 0xFF, 0x01, 0x04, 0x06, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x01, 0x03, 0x05, 0xFF, 0x06, 0x0A, 0x0E, 0xFF, 0x13,
+    0x18, 0x20, 0xFF, 0x0C, 0x10, 0x16, 0xFF, 0x0D, 0x10, 0x17, 0xFF, 0x0D, 0x11, 0x17, 0xFF, 0x80, 0x0E, 0x12, 0x18, 0xFF, 0x21, 0x0D, 0x11, 0x17,
+    0xFF, 0x0C, 0x10, 0x17, 0xFF, 0x0E, 0x11, 0x19, 0xFF, 0x0F, 0x12, 0x1B, 0xFF, 0x0E, 0x11, 0x1D, 0xFF, 0x09, 0x0B, 0x12, 0xFF, 0x66, 0x68, 0x71,
+    0xFF, 0x80, 0x86, 0x8F, 0xFF, 0x08, 0x14, 0x26, 0xFF, 0x3C, 0x43, 0x60, 0xFF, 0x57, 0x58, 0x74, 0xFF, 0x53, 0x53, 0x6A, 0xFF, 0x13, 0x15, 0x1D,
+    0xFF, 0x04, 0x05, 0x0A, 0xFF, 0x03, 0x04, 0x08, 0xFF, 0x19, 0x1E, 0x28, 0xFF, 0x2B, 0x30, 0x40, 0xFF, 0x1C, 0x1E, 0x2D, 0xFF, 0x1F, 0x22, 0x32,
+    0xFF, 0x1F, 0x23, 0x31, 0xFF, 0x20, 0x24, 0x32, 0xFF, 0x20, 0x25, 0x33, 0xFF, 0x21, 0x26, 0x34, 0xFF, 0x20, 0x26, 0x34, 0xFF, 0x20, 0x25, 0x33,
+    0xFF, 0x23, 0x27, 0x35, 0xFF, 0x24, 0x2A, 0x38, 0xFF, 0x24, 0x2A, 0x39, 0xFF, 0x4B, 0x52, 0x63, 0xFF, 0x7D, 0x85, 0x9A, 0xFF, 0x24, 0x2C, 0x44,
+    0xFF, 0x44, 0x49, 0x63, 0xFF, 0x42, 0x46, 0x5E, 0xFF, 0x0F, 0x12, 0x1D, 0xFF, 0x80, 0x05, 0x08, 0x11, 0xFF, 0x12, 0x11, 0x12, 0x20, 0xFF, 0x28,
+    0x2B, 0x3C, 0xFF, 0x26, 0x2B, 0x39, 0xFF, 0x2C, 0x2F, 0x41, 0xFF, 0x2A, 0x2E, 0x3E, 0xFF, 0x2A, 0x2D, 0x3E, 0xFF, 0x2B, 0x2F, 0x3F, 0xFF, 0x2B,
+    0x2F, 0x40, 0xFF, 0x2D, 0x31, 0x43, 0xFF, 0x2F, 0x34, 0x47, 0xFF, 0x34, 0x38, 0x4D, 0xFF, 0x2C, 0x33, 0x47, 0xFF, 0x3E, 0x45, 0x56, 0xFF, 0xC3,
+    0xC7, 0xD1, 0xFF, 0x9E, 0xA1, 0xAF, 0xFF, 0xA1, 0xA6, 0xB4, 0xFF, 0x4D, 0x52, 0x64, 0xFF, 0x25, 0x2D, 0x3D, 0xFF, 0x32, 0x38, 0x4C, 0xFF, 0x80,
+    0x30, 0x37, 0x4C, 0xFF, 0x28, 0x31, 0x39, 0x4C, 0xFF, 0x32, 0x39, 0x4D, 0xFF, 0x32, 0x39, 0x4E, 0xFF, 0x34, 0x3C, 0x4F, 0xFF, 0x36, 0x3C, 0x50,
+    0xFF, 0x33, 0x3B, 0x4D, 0xFF, 0x49, 0x50, 0x65, 0xFF, 0x26, 0x2C, 0x3C, 0xFF, 0x2D, 0x30, 0x46, 0xFF, 0x2C, 0x2F, 0x43, 0xFF, 0x07, 0x0A, 0x16,
+    0xFF, 0x0A, 0x0D, 0x1B, 0xFF, 0x08, 0x0C, 0x19, 0xFF, 0x0B, 0x0F, 0x19, 0xFF, 0x41, 0x43, 0x57, 0xFF, 0x48, 0x4B, 0x62, 0xFF, 0x3D, 0x42, 0x59,
+    0xFF, 0x3C, 0x41, 0x58, 0xFF, 0x3B, 0x41, 0x57, 0xFF, 0x3D, 0x41, 0x57, 0xFF, 0x3E, 0x43, 0x59, 0xFF, 0x3E, 0x44, 0x5A, 0xFF, 0x3E, 0x44, 0x59,
+    0xFF, 0x40, 0x45, 0x5B, 0xFF, 0x42, 0x48, 0x5E, 0xFF, 0x41, 0x47, 0x5C, 0xFF, 0x43, 0x48, 0x5C, 0xFF, 0x82, 0x88, 0x99, 0xFF, 0x70, 0x76, 0x8A,
+    0xFF, 0x40, 0x44, 0x54, 0xFF, 0x05, 0x07, 0x0F, 0xFF, 0x05, 0x09, 0x14, 0xFF, 0x2F, 0x33, 0x40, 0xFF, 0x5C, 0x61, 0x70, 0xFF, 0x46, 0x4E, 0x5F,
+    0xFF, 0x45, 0x4C, 0x60, 0xFF, 0x46, 0x4F, 0x63, 0xFF, 0x47, 0x4F, 0x64, 0xFF, 0x45, 0x4E, 0x62, 0xFF, 0x45, 0x4D, 0x61, 0xFF, 0x45, 0x4C, 0x60,
+    0xFF, 0x80, 0x43, 0x4A, 0x5F, 0xFF, 0x00, 0x44, 0x4B, 0x60, 0xFF, 0x80, 0x45, 0x4C, 0x62, 0xFF, 0x00, 0x46, 0x4C, 0x61, 0xFF, 0x80, 0x45, 0x4B,
+    0x61, 0xFF, 0x30, 0x44, 0x4B, 0x5F, 0xFF, 0x44, 0x4A, 0x60, 0xFF, 0x46, 0x4C, 0x60, 0xFF, 0x46, 0x4D, 0x61, 0xFF, 0x44, 0x4A, 0x60, 0xFF, 0x42,
+    0x48, 0x5C, 0xFF, 0x40, 0x47, 0x5B, 0xFF, 0x3F, 0x46, 0x59, 0xFF, 0x40, 0x46, 0x5A, 0xFF, 0x41, 0x48, 0x5C, 0xFF, 0x44, 0x4C, 0x60, 0xFF, 0x46,
+    0x4E, 0x63, 0xFF, 0x48, 0x4F, 0x63, 0xFF, 0x48, 0x4F, 0x64, 0xFF, 0x45, 0x4D, 0x61, 0xFF, 0x43, 0x4B, 0x60, 0xFF, 0x44, 0x4C, 0x61, 0xFF, 0x44,
+    0x4C, 0x5F, 0xFF, 0x41, 0x48, 0x5D, 0xFF, 0x3F, 0x47, 0x5B, 0xFF, 0x40, 0x48, 0x5E, 0xFF, 0x40, 0x48, 0x5D, 0xFF, 0x42, 0x4A, 0x5E, 0xFF, 0x42,
+    0x4B, 0x5F, 0xFF, 0x40, 0x48, 0x5B, 0xFF, 0x3E, 0x45, 0x58, 0xFF, 0x3C, 0x43, 0x57, 0xFF, 0x3D, 0x44, 0x58, 0xFF, 0x3D, 0x43, 0x56, 0xFF, 0x44,
+    0x49, 0x5A, 0xFF, 0x4F, 0x51, 0x63, 0xFF, 0x1C, 0x1F, 0x2F, 0xFF, 0x21, 0x26, 0x39, 0xFF, 0x6E, 0x73, 0x86, 0xFF, 0x70, 0x76, 0x89, 0xFF, 0x47,
+    0x4E, 0x62, 0xFF, 0x47, 0x4F, 0x64, 0xFF, 0x46, 0x4F, 0x62, 0xFF, 0x47, 0x4F, 0x63, 0xFF, 0x46, 0x4D, 0x61, 0xFF, 0x41, 0x4A, 0x5C, 0xFF, 0x41,
+    0x48, 0x5B, 0xFF, 0x41, 0x48, 0x5A, 0xFF, 0x3F, 0x48, 0x59, 0xFF, 0x41, 0x48, 0x5A, 0xFF, 0x3D, 0x45, 0x56, 0xFF, 0x47, 0x4D, 0x60, 0xFF, 0x19,
+    0x1C, 0x23, 0xFF, 0x05, 0x08, 0x11, 0xFF, 0x80, 0x07, 0x0A, 0x16, 0xFF, 0x80, 0x07, 0x0A, 0x15, 0xFF, 0x80, 0x06, 0x09, 0x15, 0xFF, 0x4A, 0x06,
+    0x09, 0x14, 0xFF, 0x06, 0x09, 0x15, 0xFF, 0x06, 0x08, 0x14, 0xFF, 0x06, 0x08, 0x15, 0xFF, 0x07, 0x08, 0x15, 0xFF, 0x07, 0x09, 0x16, 0xFF, 0x07,
+    0x09, 0x17, 0xFF, 0x08, 0x0B, 0x19, 0xFF, 0x0A, 0x0C, 0x1B, 0xFF, 0x0B, 0x0D, 0x1E, 0xFF, 0x06, 0x07, 0x14, 0xFF, 0x30, 0x33, 0x41, 0xFF, 0x58,
+    0x5E, 0x71, 0xFF, 0x45, 0x4B, 0x5E, 0xFF, 0x97, 0x9D, 0xAC, 0xFF, 0x32, 0x39, 0x4C, 0xFF, 0x33, 0x3A, 0x4E, 0xFF, 0x37, 0x3D, 0x52, 0xFF, 0x36,
+    0x3E, 0x51, 0xFF, 0x37, 0x3E, 0x53, 0xFF, 0x37, 0x3F, 0x53, 0xFF, 0x39, 0x40, 0x54, 0xFF, 0x3C, 0x44, 0x57, 0xFF, 0x3E, 0x45, 0x59, 0xFF, 0x3E,
+    0x46, 0x59, 0xFF, 0x3E, 0x45, 0x59, 0xFF, 0x49, 0x4F, 0x63, 0xFF, 0x1D, 0x22, 0x2E, 0xFF, 0x08, 0x0E, 0x1A, 0xFF, 0x0A, 0x0F, 0x1C, 0xFF, 0x25,
+    0x29, 0x34, 0xFF, 0x5E, 0x64, 0x77, 0xFF, 0x43, 0x49, 0x5B, 0xFF, 0x76, 0x7D, 0x8E, 0xFF, 0x73, 0x7A, 0x8E, 0xFF, 0x30, 0x34, 0x48, 0xFF, 0x2D,
+    0x31, 0x44, 0xFF, 0x2B, 0x31, 0x45, 0xFF, 0x2B, 0x30, 0x44, 0xFF, 0x2A, 0x2F, 0x43, 0xFF, 0x28, 0x2E, 0x41, 0xFF, 0x29, 0x2E, 0x41, 0xFF, 0x2A,
+    0x30, 0x43, 0xFF, 0x2D, 0x32, 0x46, 0xFF, 0x2E, 0x34, 0x47, 0xFF, 0x33, 0x39, 0x4C, 0xFF, 0x37, 0x3A, 0x4B, 0xFF, 0x12, 0x15, 0x1C, 0xFF, 0x51,
+    0x54, 0x66, 0xFF, 0x65, 0x6D, 0x86, 0xFF, 0x44, 0x4C, 0x62, 0xFF, 0x48, 0x4D, 0x5D, 0xFF, 0x78, 0x7F, 0x92, 0xFF, 0x2B, 0x33, 0x40, 0xFF, 0x1A,
+    0x1F, 0x2A, 0xFF, 0x1B, 0x21, 0x2C, 0xFF, 0x1B, 0x21, 0x2D, 0xFF, 0x1C, 0x21, 0x2E, 0xFF, 0x1C, 0x21, 0x2D, 0xFF, 0x1B, 0x21, 0x2C, 0xFF, 0x19,
+    0x1E, 0x2A, 0xFF, 0x18, 0x1D, 0x28, 0xFF, 0x18, 0x1C, 0x27, 0xFF, 0x17, 0x1D, 0x29, 0xFF, 0x1C, 0x21, 0x2B, 0xFF, 0x08, 0x0B, 0x16, 0xFF, 0x06,
+    0x07, 0x13, 0xFF, 0x06, 0x08, 0x13, 0xFF, 0x05, 0x07, 0x11, 0xFF, 0x04, 0x06, 0x11, 0xFF, 0x04, 0x07, 0x11, 0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x03,
+    0x05, 0x0E, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x80, 0x04, 0x06, 0x10, 0xFF, 0x19, 0x05, 0x07, 0x11, 0xFF, 0x06, 0x08, 0x14,
+    0xFF, 0x06, 0x0A, 0x16, 0xFF, 0x03, 0x06, 0x0D, 0xFF, 0x3E, 0x3A, 0x43, 0xFF, 0x79, 0x7D, 0x8E, 0xFF, 0x70, 0x75, 0x8A, 0xFF, 0x56, 0x5A, 0x6F,
+    0xFF, 0x3B, 0x3D, 0x50, 0xFF, 0x60, 0x64, 0x6F, 0xFF, 0x7F, 0x87, 0x91, 0xFF, 0x0B, 0x10, 0x19, 0xFF, 0x0D, 0x12, 0x18, 0xFF, 0x0C, 0x12, 0x18,
+    0xFF, 0x0C, 0x11, 0x16, 0xFF, 0x0B, 0x0F, 0x14, 0xFF, 0x0B, 0x0E, 0x13, 0xFF, 0x0A, 0x0E, 0x13, 0xFF, 0x0B, 0x0E, 0x14, 0xFF, 0x0A, 0x0E, 0x13,
+    0xFF, 0x0A, 0x0D, 0x12, 0xFF, 0x08, 0x0B, 0x0F, 0xFF, 0x18, 0x1C, 0x20, 0xFF, 0x03, 0x04, 0x07, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x02, 0x03, 0x06,
+    0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0xFF, 0x0B, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
+    0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x01, 0x01, 0x03, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01,
+    0x03, 0xFF, 0x82, 0x01, 0x01, 0x05, 0xFF, 0x06, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x00, 0x03, 0x05, 0xFF, 0x00, 0x03, 0x07, 0xFF,
+    0x01, 0x03, 0x05, 0xFF, 0x05, 0x09, 0x0D, 0xFF, 0x13, 0x17, 0x1F, 0xFF, 0x80, 0x0C, 0x0F, 0x15, 0xFF, 0x02, 0x0C, 0x0F, 0x16, 0xFF, 0x0D, 0x11,
+    0x17, 0xFF, 0x0C, 0x10, 0x18, 0xFF, 0x80, 0x0D, 0x0F, 0x17, 0xFF, 0x35, 0x0C, 0x10, 0x18, 0xFF, 0x0D, 0x11, 0x1A, 0xFF, 0x0F, 0x11, 0x1C, 0xFF,
+    0x08, 0x0A, 0x11, 0xFF, 0x62, 0x65, 0x6F, 0xFF, 0x7F, 0x85, 0x8D, 0xFF, 0x07, 0x12, 0x22, 0xFF, 0x3B, 0x42, 0x5F, 0xFF, 0x55, 0x56, 0x73, 0xFF,
+    0x52, 0x50, 0x68, 0xFF, 0x14, 0x15, 0x1D, 0xFF, 0x03, 0x05, 0x0B, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x1A, 0x1E, 0x28, 0xFF, 0x2C, 0x31, 0x40, 0xFF,
+    0x1D, 0x1F, 0x2E, 0xFF, 0x1F, 0x22, 0x30, 0xFF, 0x1D, 0x23, 0x30, 0xFF, 0x1F, 0x23, 0x32, 0xFF, 0x1F, 0x24, 0x33, 0xFF, 0x1F, 0x24, 0x32, 0xFF,
+    0x1E, 0x22, 0x31, 0xFF, 0x1F, 0x23, 0x33, 0xFF, 0x21, 0x25, 0x34, 0xFF, 0x22, 0x28, 0x36, 0xFF, 0x22, 0x28, 0x37, 0xFF, 0x48, 0x4E, 0x60, 0xFF,
+    0x78, 0x80, 0x94, 0xFF, 0x21, 0x29, 0x41, 0xFF, 0x41, 0x47, 0x62, 0xFF, 0x41, 0x44, 0x5C, 0xFF, 0x0E, 0x11, 0x1B, 0xFF, 0x05, 0x07, 0x11, 0xFF,
+    0x06, 0x08, 0x13, 0xFF, 0x04, 0x05, 0x0E, 0xFF, 0x1D, 0x1F, 0x2D, 0xFF, 0x2D, 0x2D, 0x41, 0xFF, 0x26, 0x2A, 0x3A, 0xFF, 0x27, 0x2B, 0x3A, 0xFF,
+    0x29, 0x2D, 0x3C, 0xFF, 0x29, 0x2D, 0x3E, 0xFF, 0x28, 0x2D, 0x3D, 0xFF, 0x2B, 0x2F, 0x41, 0xFF, 0x2C, 0x30, 0x42, 0xFF, 0x30, 0x35, 0x48, 0xFF,
+    0x2E, 0x34, 0x49, 0xFF, 0x2D, 0x34, 0x48, 0xFF, 0x93, 0x99, 0xA7, 0xFF, 0xB5, 0xB7, 0xC0, 0xFF, 0x7D, 0x81, 0x90, 0xFF, 0x2B, 0x2F, 0x41, 0xFF,
+    0x2B, 0x32, 0x44, 0xFF, 0x2F, 0x36, 0x4A, 0xFF, 0x31, 0x37, 0x4C, 0xFF, 0x80, 0x31, 0x37, 0x4B, 0xFF, 0x36, 0x32, 0x39, 0x4C, 0xFF, 0x31, 0x39,
+    0x4C, 0xFF, 0x34, 0x3A, 0x4E, 0xFF, 0x34, 0x39, 0x4D, 0xFF, 0x2F, 0x35, 0x46, 0xFF, 0x46, 0x4B, 0x62, 0xFF, 0x1D, 0x21, 0x30, 0xFF, 0x2C, 0x31,
+    0x45, 0xFF, 0x1C, 0x1E, 0x2F, 0xFF, 0x05, 0x09, 0x14, 0xFF, 0x09, 0x0C, 0x1A, 0xFF, 0x07, 0x0C, 0x19, 0xFF, 0x0B, 0x0F, 0x1A, 0xFF, 0x3F, 0x41,
+    0x56, 0xFF, 0x45, 0x48, 0x5F, 0xFF, 0x3D, 0x42, 0x57, 0xFF, 0x3B, 0x40, 0x56, 0xFF, 0x38, 0x3D, 0x53, 0xFF, 0x39, 0x3D, 0x53, 0xFF, 0x3A, 0x3F,
+    0x56, 0xFF, 0x3A, 0x40, 0x55, 0xFF, 0x3C, 0x42, 0x56, 0xFF, 0x3F, 0x45, 0x59, 0xFF, 0x42, 0x48, 0x5D, 0xFF, 0x42, 0x46, 0x5C, 0xFF, 0x44, 0x49,
+    0x5E, 0xFF, 0x82, 0x87, 0x98, 0xFF, 0x70, 0x75, 0x8A, 0xFF, 0x3F, 0x42, 0x53, 0xFF, 0x04, 0x06, 0x0E, 0xFF, 0x05, 0x08, 0x14, 0xFF, 0x2A, 0x2E,
+    0x3A, 0xFF, 0x56, 0x5C, 0x6C, 0xFF, 0x44, 0x4B, 0x5D, 0xFF, 0x43, 0x4A, 0x5E, 0xFF, 0x43, 0x4B, 0x5F, 0xFF, 0x43, 0x4B, 0x61, 0xFF, 0x42, 0x4A,
+    0x5F, 0xFF, 0x43, 0x4A, 0x5D, 0xFF, 0x42, 0x49, 0x5D, 0xFF, 0x43, 0x49, 0x5E, 0xFF, 0x42, 0x49, 0x5E, 0xFF, 0x42, 0x4A, 0x5E, 0xFF, 0x44, 0x4B,
+    0x60, 0xFF, 0x44, 0x4B, 0x61, 0xFF, 0x45, 0x4B, 0x61, 0xFF, 0x42, 0x48, 0x5D, 0xFF, 0x41, 0x47, 0x5C, 0xFF, 0x44, 0x49, 0x5F, 0xFF, 0x44, 0x4B,
+    0x5E, 0xFF, 0x43, 0x4A, 0x5E, 0xFF, 0x42, 0x48, 0x5E, 0xFF, 0x42, 0x49, 0x5D, 0xFF, 0x44, 0x4B, 0x5E, 0xFF, 0x40, 0x45, 0x59, 0xFF, 0x80, 0x3C,
+    0x43, 0x56, 0xFF, 0x2C, 0x3E, 0x45, 0x59, 0xFF, 0x42, 0x49, 0x5D, 0xFF, 0x43, 0x4B, 0x5E, 0xFF, 0x45, 0x4D, 0x60, 0xFF, 0x44, 0x4B, 0x5F, 0xFF,
+    0x44, 0x4B, 0x60, 0xFF, 0x43, 0x4B, 0x5F, 0xFF, 0x42, 0x49, 0x5E, 0xFF, 0x40, 0x46, 0x5C, 0xFF, 0x3C, 0x42, 0x58, 0xFF, 0x3B, 0x42, 0x56, 0xFF,
+    0x3B, 0x44, 0x58, 0xFF, 0x3F, 0x46, 0x5B, 0xFF, 0x41, 0x49, 0x5D, 0xFF, 0x41, 0x48, 0x5F, 0xFF, 0x40, 0x47, 0x5C, 0xFF, 0x40, 0x47, 0x5A, 0xFF,
+    0x40, 0x47, 0x5B, 0xFF, 0x40, 0x46, 0x5A, 0xFF, 0x3E, 0x45, 0x57, 0xFF, 0x41, 0x47, 0x58, 0xFF, 0x4B, 0x4F, 0x60, 0xFF, 0x13, 0x16, 0x22, 0xFF,
+    0x17, 0x1D, 0x2C, 0xFF, 0x66, 0x6B, 0x7E, 0xFF, 0x6E, 0x73, 0x87, 0xFF, 0x43, 0x4A, 0x5C, 0xFF, 0x46, 0x4E, 0x62, 0xFF, 0x47, 0x4F, 0x62, 0xFF,
+    0x46, 0x4F, 0x61, 0xFF, 0x45, 0x4D, 0x60, 0xFF, 0x3F, 0x48, 0x5A, 0xFF, 0x3D, 0x45, 0x57, 0xFF, 0x3D, 0x44, 0x56, 0xFF, 0x3D, 0x45, 0x55, 0xFF,
+    0x40, 0x47, 0x5A, 0xFF, 0x3B, 0x43, 0x55, 0xFF, 0x4C, 0x53, 0x67, 0xFF, 0x1E, 0x21, 0x2B, 0xFF, 0x06, 0x07, 0x12, 0xFF, 0x08, 0x0A, 0x17, 0xFF,
+    0x07, 0x09, 0x16, 0xFF, 0x06, 0x09, 0x16, 0xFF, 0x06, 0x09, 0x15, 0xFF, 0x06, 0x08, 0x14, 0xFF, 0x82, 0x06, 0x08, 0x15, 0xFF, 0x0D, 0x07, 0x09,
+    0x15, 0xFF, 0x07, 0x09, 0x16, 0xFF, 0x07, 0x0A, 0x17, 0xFF, 0x08, 0x0A, 0x17, 0xFF, 0x08, 0x0A, 0x19, 0xFF, 0x09, 0x0C, 0x1C, 0xFF, 0x0B, 0x0D,
+    0x1F, 0xFF, 0x06, 0x07, 0x15, 0xFF, 0x31, 0x36, 0x46, 0xFF, 0x61, 0x67, 0x79, 0xFF, 0x5C, 0x61, 0x72, 0xFF, 0x9E, 0xA4, 0xB2, 0xFF, 0x2F, 0x36,
+    0x49, 0xFF, 0x32, 0x39, 0x4D, 0xFF, 0x80, 0x35, 0x3C, 0x50, 0xFF, 0x14, 0x34, 0x3C, 0x4F, 0xFF, 0x35, 0x3C, 0x50, 0xFF, 0x36, 0x3D, 0x51, 0xFF,
+    0x38, 0x3F, 0x53, 0xFF, 0x39, 0x41, 0x55, 0xFF, 0x3A, 0x42, 0x56, 0xFF, 0x3C, 0x43, 0x56, 0xFF, 0x48, 0x4E, 0x63, 0xFF, 0x1C, 0x22, 0x2F, 0xFF,
+    0x07, 0x0E, 0x1A, 0xFF, 0x0A, 0x0E, 0x1C, 0xFF, 0x23, 0x27, 0x34, 0xFF, 0x5B, 0x62, 0x75, 0xFF, 0x42, 0x48, 0x5A, 0xFF, 0x77, 0x7D, 0x8E, 0xFF,
+    0x73, 0x79, 0x8E, 0xFF, 0x2F, 0x34, 0x46, 0xFF, 0x2A, 0x2E, 0x42, 0xFF, 0x29, 0x2F, 0x43, 0xFF, 0x2B, 0x2F, 0x43, 0xFF, 0x2A, 0x2F, 0x41, 0xFF,
+    0x80, 0x28, 0x2D, 0x40, 0xFF, 0x0C, 0x28, 0x2E, 0x40, 0xFF, 0x2B, 0x31, 0x43, 0xFF, 0x2C, 0x32, 0x44, 0xFF, 0x31, 0x37, 0x4A, 0xFF, 0x36, 0x39,
+    0x4A, 0xFF, 0x12, 0x15, 0x1C, 0xFF, 0x4E, 0x51, 0x62, 0xFF, 0x63, 0x6B, 0x83, 0xFF, 0x42, 0x48, 0x5F, 0xFF, 0x3E, 0x42, 0x51, 0xFF, 0x75, 0x7B,
+    0x8F, 0xFF, 0x2A, 0x31, 0x40, 0xFF, 0x18, 0x1D, 0x27, 0xFF, 0x81, 0x1A, 0x1F, 0x2B, 0xFF, 0x07, 0x1A, 0x1E, 0x2A, 0xFF, 0x19, 0x1D, 0x2A, 0xFF,
+    0x1A, 0x1D, 0x2A, 0xFF, 0x19, 0x1D, 0x29, 0xFF, 0x18, 0x1C, 0x28, 0xFF, 0x18, 0x1D, 0x2A, 0xFF, 0x1C, 0x21, 0x2C, 0xFF, 0x0C, 0x0F, 0x1A, 0xFF,
+    0x80, 0x05, 0x08, 0x14, 0xFF, 0x06, 0x05, 0x08, 0x13, 0xFF, 0x04, 0x08, 0x12, 0xFF, 0x04, 0x07, 0x11, 0xFF, 0x04, 0x06, 0x10, 0xFF, 0x03, 0x05,
+    0x0E, 0xFF, 0x04, 0x06, 0x0D, 0xFF, 0x03, 0x05, 0x0F, 0xFF, 0x80, 0x04, 0x06, 0x11, 0xFF, 0x19, 0x05, 0x07, 0x12, 0xFF, 0x05, 0x08, 0x14, 0xFF,
+    0x06, 0x09, 0x16, 0xFF, 0x03, 0x05, 0x0E, 0xFF, 0x44, 0x3F, 0x48, 0xFF, 0x80, 0x85, 0x95, 0xFF, 0x78, 0x7E, 0x90, 0xFF, 0x5F, 0x64, 0x78, 0xFF,
+    0x45, 0x47, 0x5A, 0xFF, 0x72, 0x76, 0x81, 0xFF, 0x84, 0x8B, 0x94, 0xFF, 0x05, 0x08, 0x0F, 0xFF, 0x0B, 0x0F, 0x16, 0xFF, 0x0B, 0x10, 0x16, 0xFF,
+    0x0C, 0x10, 0x15, 0xFF, 0x0A, 0x0F, 0x15, 0xFF, 0x0A, 0x0D, 0x13, 0xFF, 0x09, 0x0D, 0x12, 0xFF, 0x0A, 0x0C, 0x12, 0xFF, 0x09, 0x0C, 0x12, 0xFF,
+    0x0A, 0x0C, 0x11, 0xFF, 0x08, 0x0B, 0x0E, 0xFF, 0x17, 0x1B, 0x20, 0xFF, 0x03, 0x04, 0x07, 0xFF, 0x02, 0x03, 0x05, 0xFF, 0x02, 0x03, 0x06, 0xFF,
+    0x0A, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x81, 0x00, 0x00,
+    0x02, 0xFF, 0x03, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF,
+    0x0D, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x00, 0x06, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x06,
+    0xFF, 0x00, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x03, 0x05, 0xFF, 0x05, 0x09, 0x0D, 0xFF, 0x12, 0x17, 0x1F, 0xFF, 0x0B, 0x0E, 0x14,
+    0xFF, 0x0C, 0x0E, 0x14, 0xFF, 0x0B, 0x0E, 0x15, 0xFF, 0x80, 0x0C, 0x0E, 0x15, 0xFF, 0x39, 0x0C, 0x0E, 0x16, 0xFF, 0x0D, 0x0F, 0x18, 0xFF, 0x0E,
+    0x10, 0x18, 0xFF, 0x0D, 0x10, 0x19, 0xFF, 0x0E, 0x10, 0x1A, 0xFF, 0x08, 0x09, 0x0F, 0xFF, 0x60, 0x62, 0x6C, 0xFF, 0x7B, 0x81, 0x8B, 0xFF, 0x06,
+    0x10, 0x21, 0xFF, 0x3B, 0x40, 0x5C, 0xFF, 0x53, 0x55, 0x71, 0xFF, 0x50, 0x50, 0x68, 0xFF, 0x14, 0x15, 0x1E, 0xFF, 0x04, 0x06, 0x0B, 0xFF, 0x03,
+    0x04, 0x09, 0xFF, 0x19, 0x1E, 0x27, 0xFF, 0x2C, 0x31, 0x40, 0xFF, 0x1B, 0x1E, 0x2C, 0xFF, 0x1D, 0x20, 0x2F, 0xFF, 0x1E, 0x20, 0x30, 0xFF, 0x1E,
+    0x22, 0x31, 0xFF, 0x1D, 0x24, 0x32, 0xFF, 0x1E, 0x23, 0x32, 0xFF, 0x1E, 0x22, 0x31, 0xFF, 0x20, 0x24, 0x33, 0xFF, 0x20, 0x25, 0x34, 0xFF, 0x22,
+    0x26, 0x36, 0xFF, 0x21, 0x26, 0x35, 0xFF, 0x46, 0x4C, 0x5D, 0xFF, 0x73, 0x7C, 0x90, 0xFF, 0x1E, 0x25, 0x3C, 0xFF, 0x3F, 0x43, 0x5E, 0xFF, 0x3D,
+    0x40, 0x58, 0xFF, 0x0D, 0x0F, 0x1A, 0xFF, 0x05, 0x07, 0x10, 0xFF, 0x06, 0x09, 0x14, 0xFF, 0x04, 0x06, 0x10, 0xFF, 0x1C, 0x1B, 0x2D, 0xFF, 0x27,
+    0x2B, 0x3B, 0xFF, 0x23, 0x27, 0x37, 0xFF, 0x26, 0x2A, 0x3A, 0xFF, 0x2A, 0x2E, 0x3F, 0xFF, 0x2A, 0x2F, 0x40, 0xFF, 0x29, 0x2E, 0x3E, 0xFF, 0x2C,
+    0x2F, 0x41, 0xFF, 0x2B, 0x30, 0x41, 0xFF, 0x2F, 0x34, 0x46, 0xFF, 0x30, 0x34, 0x4A, 0xFF, 0x22, 0x25, 0x37, 0xFF, 0x55, 0x5A, 0x65, 0xFF, 0xB9,
+    0xBE, 0xC6, 0xFF, 0x6F, 0x73, 0x81, 0xFF, 0x20, 0x26, 0x34, 0xFF, 0x2E, 0x34, 0x48, 0xFF, 0x2F, 0x36, 0x4B, 0xFF, 0x31, 0x38, 0x4C, 0xFF, 0x31,
+    0x37, 0x4B, 0xFF, 0x32, 0x37, 0x4C, 0xFF, 0x80, 0x32, 0x38, 0x4B, 0xFF, 0x07, 0x32, 0x38, 0x4C, 0xFF, 0x30, 0x35, 0x49, 0xFF, 0x3D, 0x43, 0x58,
+    0xFF, 0x2E, 0x34, 0x47, 0xFF, 0x26, 0x2A, 0x3D, 0xFF, 0x2D, 0x30, 0x44, 0xFF, 0x04, 0x08, 0x11, 0xFF, 0x07, 0x0A, 0x16, 0xFF, 0x80, 0x07, 0x0B,
+    0x16, 0xFF, 0x5B, 0x0C, 0x0E, 0x19, 0xFF, 0x3F, 0x40, 0x54, 0xFF, 0x43, 0x46, 0x5B, 0xFF, 0x3B, 0x41, 0x56, 0xFF, 0x3A, 0x3F, 0x55, 0xFF, 0x38,
+    0x3D, 0x53, 0xFF, 0x37, 0x3B, 0x51, 0xFF, 0x37, 0x3D, 0x52, 0xFF, 0x38, 0x3E, 0x52, 0xFF, 0x3A, 0x40, 0x55, 0xFF, 0x3D, 0x42, 0x57, 0xFF, 0x40,
+    0x45, 0x5A, 0xFF, 0x40, 0x44, 0x5B, 0xFF, 0x43, 0x48, 0x5D, 0xFF, 0x80, 0x85, 0x96, 0xFF, 0x6F, 0x73, 0x89, 0xFF, 0x3D, 0x40, 0x50, 0xFF, 0x02,
+    0x06, 0x0D, 0xFF, 0x07, 0x0B, 0x17, 0xFF, 0x20, 0x25, 0x2F, 0xFF, 0x52, 0x57, 0x68, 0xFF, 0x42, 0x48, 0x5B, 0xFF, 0x40, 0x47, 0x5B, 0xFF, 0x3F,
+    0x47, 0x5B, 0xFF, 0x3F, 0x47, 0x5C, 0xFF, 0x40, 0x47, 0x5D, 0xFF, 0x41, 0x46, 0x5D, 0xFF, 0x40, 0x46, 0x5B, 0xFF, 0x40, 0x47, 0x5C, 0xFF, 0x41,
+    0x48, 0x5D, 0xFF, 0x42, 0x49, 0x5E, 0xFF, 0x43, 0x49, 0x5F, 0xFF, 0x44, 0x49, 0x5F, 0xFF, 0x44, 0x4A, 0x60, 0xFF, 0x41, 0x46, 0x59, 0xFF, 0x40,
+    0x46, 0x5A, 0xFF, 0x43, 0x48, 0x5E, 0xFF, 0x42, 0x47, 0x5C, 0xFF, 0x42, 0x48, 0x5D, 0xFF, 0x3F, 0x46, 0x59, 0xFF, 0x3F, 0x45, 0x5A, 0xFF, 0x41,
+    0x47, 0x5A, 0xFF, 0x3F, 0x44, 0x58, 0xFF, 0x3E, 0x44, 0x58, 0xFF, 0x3F, 0x44, 0x58, 0xFF, 0x3D, 0x44, 0x57, 0xFF, 0x3F, 0x46, 0x5A, 0xFF, 0x41,
+    0x47, 0x5B, 0xFF, 0x42, 0x49, 0x5D, 0xFF, 0x41, 0x48, 0x5C, 0xFF, 0x40, 0x47, 0x5C, 0xFF, 0x40, 0x47, 0x5A, 0xFF, 0x3E, 0x45, 0x59, 0xFF, 0x3D,
+    0x43, 0x58, 0xFF, 0x3B, 0x41, 0x54, 0xFF, 0x38, 0x3F, 0x53, 0xFF, 0x3A, 0x41, 0x55, 0xFF, 0x3E, 0x44, 0x58, 0xFF, 0x3F, 0x46, 0x5B, 0xFF, 0x3F,
+    0x47, 0x5A, 0xFF, 0x40, 0x47, 0x5A, 0xFF, 0x41, 0x47, 0x5B, 0xFF, 0x42, 0x48, 0x5B, 0xFF, 0x41, 0x46, 0x59, 0xFF, 0x3E, 0x44, 0x56, 0xFF, 0x3F,
+    0x44, 0x54, 0xFF, 0x44, 0x48, 0x5A, 0xFF, 0x0A, 0x0D, 0x18, 0xFF, 0x10, 0x15, 0x22, 0xFF, 0x59, 0x5E, 0x72, 0xFF, 0x6E, 0x74, 0x88, 0xFF, 0x42,
+    0x48, 0x5A, 0xFF, 0x46, 0x4C, 0x5F, 0xFF, 0x46, 0x4E, 0x62, 0xFF, 0x45, 0x4E, 0x60, 0xFF, 0x45, 0x4C, 0x5F, 0xFF, 0x40, 0x47, 0x58, 0xFF, 0x3D,
+    0x44, 0x55, 0xFF, 0x3B, 0x41, 0x53, 0xFF, 0x3A, 0x40, 0x53, 0xFF, 0x3D, 0x43, 0x56, 0xFF, 0x3B, 0x42, 0x56, 0xFF, 0x50, 0x56, 0x6B, 0xFF, 0x26,
+    0x28, 0x35, 0xFF, 0x06, 0x08, 0x12, 0xFF, 0x08, 0x0A, 0x18, 0xFF, 0x07, 0x0A, 0x17, 0xFF, 0x07, 0x09, 0x16, 0xFF, 0x06, 0x08, 0x15, 0xFF, 0x06,
+    0x08, 0x14, 0xFF, 0x05, 0x07, 0x14, 0xFF, 0x05, 0x07, 0x15, 0xFF, 0x80, 0x06, 0x08, 0x14, 0xFF, 0x34, 0x06, 0x07, 0x15, 0xFF, 0x07, 0x0A, 0x16,
+    0xFF, 0x08, 0x09, 0x17, 0xFF, 0x08, 0x0A, 0x18, 0xFF, 0x09, 0x0B, 0x19, 0xFF, 0x0A, 0x0D, 0x1C, 0xFF, 0x0C, 0x0E, 0x20, 0xFF, 0x06, 0x07, 0x14,
+    0xFF, 0x3F, 0x43, 0x53, 0xFF, 0x66, 0x6D, 0x7F, 0xFF, 0x76, 0x7C, 0x8B, 0xFF, 0xA4, 0xA9, 0xB6, 0xFF, 0x2E, 0x35, 0x48, 0xFF, 0x33, 0x39, 0x4D,
+    0xFF, 0x35, 0x3C, 0x50, 0xFF, 0x35, 0x3B, 0x50, 0xFF, 0x35, 0x3C, 0x4F, 0xFF, 0x35, 0x3B, 0x4F, 0xFF, 0x36, 0x3D, 0x50, 0xFF, 0x36, 0x3D, 0x51,
+    0xFF, 0x38, 0x3F, 0x52, 0xFF, 0x3A, 0x40, 0x54, 0xFF, 0x3A, 0x40, 0x55, 0xFF, 0x46, 0x4B, 0x60, 0xFF, 0x1C, 0x21, 0x2E, 0xFF, 0x07, 0x0C, 0x1B,
+    0xFF, 0x0A, 0x0F, 0x1D, 0xFF, 0x23, 0x27, 0x34, 0xFF, 0x5B, 0x61, 0x74, 0xFF, 0x41, 0x46, 0x59, 0xFF, 0x78, 0x7E, 0x8F, 0xFF, 0x74, 0x7A, 0x8E,
+    0xFF, 0x2F, 0x34, 0x47, 0xFF, 0x2A, 0x2F, 0x42, 0xFF, 0x2B, 0x2F, 0x42, 0xFF, 0x2B, 0x2E, 0x42, 0xFF, 0x2A, 0x2E, 0x41, 0xFF, 0x29, 0x2E, 0x40,
+    0xFF, 0x29, 0x2D, 0x40, 0xFF, 0x29, 0x2F, 0x42, 0xFF, 0x2C, 0x31, 0x44, 0xFF, 0x2B, 0x31, 0x43, 0xFF, 0x30, 0x36, 0x48, 0xFF, 0x35, 0x37, 0x49,
+    0xFF, 0x11, 0x13, 0x1C, 0xFF, 0x4B, 0x4D, 0x5E, 0xFF, 0x62, 0x69, 0x81, 0xFF, 0x41, 0x47, 0x5E, 0xFF, 0x38, 0x3B, 0x4A, 0xFF, 0x74, 0x7A, 0x8D,
+    0xFF, 0x31, 0x38, 0x46, 0xFF, 0x15, 0x1A, 0x23, 0xFF, 0x18, 0x1D, 0x29, 0xFF, 0x80, 0x19, 0x1D, 0x29, 0xFF, 0x03, 0x18, 0x1C, 0x28, 0xFF, 0x17,
+    0x1B, 0x27, 0xFF, 0x18, 0x1B, 0x27, 0xFF, 0x16, 0x1A, 0x27, 0xFF, 0x80, 0x17, 0x1B, 0x27, 0xFF, 0x07, 0x1A, 0x1E, 0x2A, 0xFF, 0x16, 0x19, 0x24,
+    0xFF, 0x05, 0x07, 0x14, 0xFF, 0x06, 0x07, 0x14, 0xFF, 0x05, 0x07, 0x13, 0xFF, 0x04, 0x07, 0x13, 0xFF, 0x04, 0x07, 0x12, 0xFF, 0x04, 0x06, 0x10,
+    0xFF, 0x80, 0x04, 0x06, 0x0F, 0xFF, 0x0E, 0x04, 0x05, 0x10, 0xFF, 0x04, 0x06, 0x10, 0xFF, 0x04, 0x06, 0x11, 0xFF, 0x04, 0x07, 0x11, 0xFF, 0x05,
+    0x08, 0x12, 0xFF, 0x07, 0x09, 0x17, 0xFF, 0x03, 0x05, 0x0E, 0xFF, 0x4B, 0x46, 0x50, 0xFF, 0x87, 0x8E, 0x9D, 0xFF, 0x7B, 0x81, 0x94, 0xFF, 0x61,
+    0x66, 0x7A, 0xFF, 0x4C, 0x4F, 0x61, 0xFF, 0x8E, 0x95, 0x9E, 0xFF, 0x85, 0x8B, 0x93, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x80, 0x0C, 0x10, 0x16, 0xFF,
+    0x0B, 0x0C, 0x10, 0x15, 0xFF, 0x0B, 0x0E, 0x14, 0xFF, 0x0B, 0x0E, 0x13, 0xFF, 0x09, 0x0C, 0x12, 0xFF, 0x09, 0x0B, 0x10, 0xFF, 0x08, 0x0B, 0x11,
+    0xFF, 0x08, 0x0B, 0x10, 0xFF, 0x07, 0x0A, 0x0E, 0xFF, 0x16, 0x1B, 0x20, 0xFF, 0x03, 0x04, 0x07, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x02, 0x02, 0x06,
+    0xFF, 0x05, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00,
+    0x01, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x08, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF,
+    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x80, 0x01, 0x01, 0x04,
+    0xFF, 0x03, 0x00, 0x02, 0x04, 0xFF, 0x02, 0x00, 0x06, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x80, 0x00, 0x02, 0x05, 0xFF, 0x06,
+    0x01, 0x02, 0x06, 0xFF, 0x01, 0x03, 0x05, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x06, 0x08, 0x0D, 0xFF, 0x12, 0x17, 0x1F, 0xFF, 0x0B, 0x0E, 0x15, 0xFF,
+    0x0C, 0x0E, 0x14, 0xFF, 0x80, 0x0B, 0x0D, 0x14, 0xFF, 0x16, 0x0B, 0x0D, 0x15, 0xFF, 0x0C, 0x0E, 0x16, 0xFF, 0x0D, 0x0F, 0x17, 0xFF, 0x0D, 0x0F,
+    0x18, 0xFF, 0x0D, 0x10, 0x18, 0xFF, 0x0D, 0x10, 0x19, 0xFF, 0x07, 0x09, 0x0E, 0xFF, 0x62, 0x63, 0x6D, 0xFF, 0x7C, 0x81, 0x8A, 0xFF, 0x04, 0x0D,
+    0x1E, 0xFF, 0x38, 0x3E, 0x5A, 0xFF, 0x52, 0x54, 0x71, 0xFF, 0x52, 0x50, 0x6A, 0xFF, 0x15, 0x15, 0x1E, 0xFF, 0x04, 0x06, 0x0B, 0xFF, 0x04, 0x05,
+    0x0A, 0xFF, 0x1A, 0x1E, 0x28, 0xFF, 0x2C, 0x30, 0x3F, 0xFF, 0x1A, 0x1C, 0x2A, 0xFF, 0x1C, 0x1F, 0x2E, 0xFF, 0x1C, 0x20, 0x2F, 0xFF, 0x1E, 0x21,
+    0x30, 0xFF, 0x1D, 0x22, 0x31, 0xFF, 0x80, 0x1F, 0x23, 0x32, 0xFF, 0x10, 0x21, 0x25, 0x34, 0xFF, 0x21, 0x26, 0x35, 0xFF, 0x22, 0x26, 0x37, 0xFF,
+    0x21, 0x25, 0x35, 0xFF, 0x44, 0x4A, 0x5B, 0xFF, 0x6F, 0x77, 0x8C, 0xFF, 0x1D, 0x22, 0x38, 0xFF, 0x3E, 0x41, 0x5C, 0xFF, 0x3B, 0x3D, 0x55, 0xFF,
+    0x0C, 0x0F, 0x19, 0xFF, 0x05, 0x07, 0x12, 0xFF, 0x06, 0x0A, 0x16, 0xFF, 0x06, 0x09, 0x15, 0xFF, 0x09, 0x09, 0x15, 0xFF, 0x1F, 0x22, 0x2F, 0xFF,
+    0x2B, 0x2C, 0x3F, 0xFF, 0x27, 0x2B, 0x3C, 0xFF, 0x83, 0x2C, 0x30, 0x42, 0xFF, 0x80, 0x2F, 0x34, 0x47, 0xFF, 0x1B, 0x27, 0x2B, 0x3C, 0xFF, 0x2B,
+    0x2F, 0x3F, 0xFF, 0x56, 0x5B, 0x69, 0xFF, 0x38, 0x3C, 0x4D, 0xFF, 0x29, 0x2D, 0x3E, 0xFF, 0x2F, 0x34, 0x47, 0xFF, 0x30, 0x35, 0x49, 0xFF, 0x31,
+    0x36, 0x49, 0xFF, 0x31, 0x37, 0x4A, 0xFF, 0x32, 0x38, 0x4B, 0xFF, 0x31, 0x37, 0x4A, 0xFF, 0x32, 0x37, 0x4B, 0xFF, 0x30, 0x36, 0x4A, 0xFF, 0x2A,
+    0x30, 0x42, 0xFF, 0x47, 0x4D, 0x64, 0xFF, 0x1E, 0x24, 0x34, 0xFF, 0x2A, 0x2F, 0x42, 0xFF, 0x22, 0x25, 0x37, 0xFF, 0x02, 0x07, 0x0F, 0xFF, 0x07,
+    0x0A, 0x15, 0xFF, 0x06, 0x0A, 0x15, 0xFF, 0x06, 0x08, 0x11, 0xFF, 0x0B, 0x0D, 0x17, 0xFF, 0x3E, 0x3F, 0x52, 0xFF, 0x41, 0x43, 0x58, 0xFF, 0x3A,
+    0x3F, 0x53, 0xFF, 0x38, 0x3E, 0x52, 0xFF, 0x37, 0x3C, 0x51, 0xFF, 0x80, 0x36, 0x3B, 0x50, 0xFF, 0x11, 0x36, 0x3C, 0x50, 0xFF, 0x38, 0x3E, 0x52,
+    0xFF, 0x3C, 0x40, 0x56, 0xFF, 0x3C, 0x42, 0x56, 0xFF, 0x3B, 0x40, 0x56, 0xFF, 0x3F, 0x43, 0x58, 0xFF, 0x7C, 0x81, 0x93, 0xFF, 0x6D, 0x72, 0x88,
+    0xFF, 0x3A, 0x3C, 0x4D, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x07, 0x0C, 0x17, 0xFF, 0x0B, 0x0F, 0x17, 0xFF, 0x4A, 0x4F, 0x5F, 0xFF, 0x3E, 0x43, 0x56,
+    0xFF, 0x3D, 0x44, 0x58, 0xFF, 0x3E, 0x44, 0x5A, 0xFF, 0x3C, 0x44, 0x59, 0xFF, 0x3B, 0x44, 0x59, 0xFF, 0x80, 0x3E, 0x44, 0x59, 0xFF, 0x17, 0x3E,
+    0x45, 0x59, 0xFF, 0x41, 0x47, 0x5C, 0xFF, 0x41, 0x48, 0x5D, 0xFF, 0x41, 0x47, 0x5C, 0xFF, 0x44, 0x49, 0x5C, 0xFF, 0x48, 0x4E, 0x60, 0xFF, 0x51,
+    0x56, 0x6A, 0xFF, 0x50, 0x54, 0x69, 0xFF, 0x4D, 0x52, 0x66, 0xFF, 0x4C, 0x51, 0x65, 0xFF, 0x4C, 0x52, 0x66, 0xFF, 0x4C, 0x53, 0x66, 0xFF, 0x4E,
+    0x54, 0x68, 0xFF, 0x50, 0x56, 0x69, 0xFF, 0x51, 0x56, 0x6A, 0xFF, 0x52, 0x57, 0x6B, 0xFF, 0x55, 0x59, 0x6C, 0xFF, 0x52, 0x57, 0x6B, 0xFF, 0x50,
+    0x56, 0x6A, 0xFF, 0x52, 0x56, 0x6A, 0xFF, 0x4F, 0x55, 0x67, 0xFF, 0x4F, 0x55, 0x68, 0xFF, 0x4D, 0x53, 0x68, 0xFF, 0x4E, 0x54, 0x68, 0xFF, 0x80,
+    0x4D, 0x53, 0x66, 0xFF, 0x01, 0x4C, 0x52, 0x64, 0xFF, 0x4C, 0x51, 0x64, 0xFF, 0x80, 0x4B, 0x51, 0x64, 0xFF, 0x11, 0x4C, 0x51, 0x65, 0xFF, 0x4E,
+    0x54, 0x67, 0xFF, 0x4F, 0x56, 0x6B, 0xFF, 0x51, 0x56, 0x6C, 0xFF, 0x51, 0x56, 0x6B, 0xFF, 0x4E, 0x54, 0x69, 0xFF, 0x4C, 0x51, 0x67, 0xFF, 0x45,
+    0x4A, 0x5E, 0xFF, 0x30, 0x35, 0x44, 0xFF, 0x04, 0x05, 0x0F, 0xFF, 0x0A, 0x0C, 0x19, 0xFF, 0x4E, 0x54, 0x67, 0xFF, 0x72, 0x79, 0x8C, 0xFF, 0x3F,
+    0x46, 0x59, 0xFF, 0x42, 0x4A, 0x5C, 0xFF, 0x46, 0x4D, 0x60, 0xFF, 0x44, 0x4C, 0x5F, 0xFF, 0x41, 0x49, 0x5B, 0xFF, 0x80, 0x3E, 0x45, 0x57, 0xFF,
+    0x06, 0x3A, 0x40, 0x52, 0xFF, 0x36, 0x3C, 0x4C, 0xFF, 0x38, 0x3E, 0x4F, 0xFF, 0x3C, 0x42, 0x55, 0xFF, 0x56, 0x5C, 0x6F, 0xFF, 0x34, 0x38, 0x44,
+    0xFF, 0x06, 0x06, 0x10, 0xFF, 0x80, 0x08, 0x0A, 0x18, 0xFF, 0x01, 0x07, 0x08, 0x15, 0xFF, 0x06, 0x08, 0x15, 0xFF, 0x80, 0x05, 0x07, 0x13, 0xFF,
+    0x0F, 0x05, 0x08, 0x14, 0xFF, 0x06, 0x07, 0x14, 0xFF, 0x07, 0x08, 0x15, 0xFF, 0x07, 0x09, 0x16, 0xFF, 0x07, 0x0A, 0x17, 0xFF, 0x08, 0x0A, 0x18,
+    0xFF, 0x09, 0x0A, 0x19, 0xFF, 0x0A, 0x0B, 0x1A, 0xFF, 0x0B, 0x0D, 0x1D, 0xFF, 0x0C, 0x0E, 0x1E, 0xFF, 0x05, 0x05, 0x0F, 0xFF, 0x48, 0x4C, 0x5B,
+    0xFF, 0x70, 0x75, 0x86, 0xFF, 0x93, 0x99, 0xA5, 0xFF, 0x92, 0x98, 0xA6, 0xFF, 0x30, 0x37, 0x4B, 0xFF, 0x80, 0x35, 0x3B, 0x4F, 0xFF, 0x11, 0x34,
+    0x3A, 0x4E, 0xFF, 0x33, 0x3A, 0x4D, 0xFF, 0x33, 0x39, 0x4D, 0xFF, 0x34, 0x3B, 0x4E, 0xFF, 0x35, 0x3B, 0x4F, 0xFF, 0x36, 0x3D, 0x50, 0xFF, 0x38,
+    0x3E, 0x52, 0xFF, 0x37, 0x3E, 0x51, 0xFF, 0x44, 0x49, 0x5E, 0xFF, 0x1B, 0x1F, 0x2C, 0xFF, 0x06, 0x0C, 0x19, 0xFF, 0x09, 0x0E, 0x1C, 0xFF, 0x23,
+    0x27, 0x33, 0xFF, 0x5A, 0x5F, 0x73, 0xFF, 0x3F, 0x45, 0x58, 0xFF, 0x77, 0x7E, 0x8F, 0xFF, 0x74, 0x7B, 0x8F, 0xFF, 0x2F, 0x33, 0x46, 0xFF, 0x81,
+    0x29, 0x2D, 0x40, 0xFF, 0x14, 0x28, 0x2D, 0x40, 0xFF, 0x28, 0x2D, 0x3F, 0xFF, 0x29, 0x2C, 0x3F, 0xFF, 0x29, 0x2D, 0x40, 0xFF, 0x29, 0x2E, 0x41,
+    0xFF, 0x28, 0x2F, 0x41, 0xFF, 0x2E, 0x33, 0x45, 0xFF, 0x33, 0x36, 0x46, 0xFF, 0x11, 0x14, 0x1C, 0xFF, 0x42, 0x44, 0x55, 0xFF, 0x5D, 0x63, 0x7B,
+    0xFF, 0x43, 0x49, 0x61, 0xFF, 0x2F, 0x32, 0x42, 0xFF, 0x6D, 0x74, 0x86, 0xFF, 0x3A, 0x41, 0x4F, 0xFF, 0x12, 0x15, 0x1F, 0xFF, 0x18, 0x1C, 0x27,
+    0xFF, 0x18, 0x1C, 0x28, 0xFF, 0x18, 0x1C, 0x27, 0xFF, 0x18, 0x1C, 0x28, 0xFF, 0x17, 0x1B, 0x27, 0xFF, 0x80, 0x17, 0x1A, 0x26, 0xFF, 0x0B, 0x16,
+    0x19, 0x25, 0xFF, 0x16, 0x1A, 0x25, 0xFF, 0x19, 0x1E, 0x29, 0xFF, 0x1E, 0x23, 0x2E, 0xFF, 0x03, 0x06, 0x11, 0xFF, 0x05, 0x08, 0x14, 0xFF, 0x05,
+    0x08, 0x13, 0xFF, 0x06, 0x06, 0x12, 0xFF, 0x05, 0x07, 0x12, 0xFF, 0x04, 0x07, 0x11, 0xFF, 0x05, 0x07, 0x11, 0xFF, 0x05, 0x06, 0x10, 0xFF, 0x80,
+    0x04, 0x06, 0x10, 0xFF, 0x1A, 0x04, 0x06, 0x11, 0xFF, 0x04, 0x07, 0x10, 0xFF, 0x05, 0x07, 0x12, 0xFF, 0x07, 0x08, 0x15, 0xFF, 0x02, 0x02, 0x09,
+    0xFF, 0x55, 0x52, 0x5F, 0xFF, 0x8A, 0x91, 0xA1, 0xFF, 0x7D, 0x82, 0x94, 0xFF, 0x62, 0x67, 0x7B, 0xFF, 0x5D, 0x60, 0x70, 0xFF, 0xAC, 0xB4, 0xB9,
+    0xFF, 0x82, 0x89, 0x91, 0xFF, 0x04, 0x06, 0x0E, 0xFF, 0x0D, 0x11, 0x18, 0xFF, 0x0C, 0x11, 0x17, 0xFF, 0x0C, 0x10, 0x15, 0xFF, 0x0B, 0x0E, 0x14,
+    0xFF, 0x0B, 0x0E, 0x13, 0xFF, 0x0A, 0x0C, 0x12, 0xFF, 0x08, 0x0B, 0x10, 0xFF, 0x08, 0x0A, 0x10, 0xFF, 0x09, 0x0A, 0x10, 0xFF, 0x08, 0x0A, 0x0E,
+    0xFF, 0x16, 0x1B, 0x1F, 0xFF, 0x03, 0x04, 0x07, 0xFF, 0x03, 0x02, 0x05, 0xFF, 0x02, 0x02, 0x05, 0xFF, 0x05, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x01, 0x00, 0x00, 0xFF, 0x07,
+    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF,
+    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x01, 0x03, 0xFF, 0x24, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01,
+    0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x03,
+    0x05, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x05, 0x08, 0x0D, 0xFF, 0x12, 0x16, 0x1E, 0xFF, 0x0A, 0x0D, 0x13, 0xFF, 0x0C, 0x0D,
+    0x14, 0xFF, 0x0B, 0x0D, 0x14, 0xFF, 0x0B, 0x0C, 0x13, 0xFF, 0x0B, 0x0D, 0x14, 0xFF, 0x0C, 0x0D, 0x16, 0xFF, 0x0C, 0x0E, 0x17, 0xFF, 0x0D, 0x0E,
+    0x18, 0xFF, 0x0D, 0x0F, 0x19, 0xFF, 0x0D, 0x0F, 0x18, 0xFF, 0x07, 0x08, 0x0E, 0xFF, 0x60, 0x62, 0x6C, 0xFF, 0x7B, 0x7F, 0x89, 0xFF, 0x03, 0x0B,
+    0x1D, 0xFF, 0x34, 0x3B, 0x57, 0xFF, 0x51, 0x53, 0x6F, 0xFF, 0x52, 0x50, 0x69, 0xFF, 0x14, 0x15, 0x1D, 0xFF, 0x03, 0x06, 0x0B, 0xFF, 0x03, 0x05,
+    0x0B, 0xFF, 0x19, 0x1E, 0x28, 0xFF, 0x2A, 0x2F, 0x3D, 0xFF, 0x19, 0x1C, 0x2A, 0xFF, 0x1B, 0x1F, 0x2E, 0xFF, 0x80, 0x1C, 0x1F, 0x2E, 0xFF, 0x23,
+    0x1D, 0x22, 0x31, 0xFF, 0x1E, 0x22, 0x31, 0xFF, 0x1F, 0x23, 0x31, 0xFF, 0x1F, 0x24, 0x32, 0xFF, 0x20, 0x24, 0x33, 0xFF, 0x1F, 0x24, 0x33, 0xFF,
+    0x1E, 0x22, 0x31, 0xFF, 0x40, 0x46, 0x57, 0xFF, 0x6B, 0x73, 0x88, 0xFF, 0x1B, 0x21, 0x37, 0xFF, 0x3C, 0x40, 0x5A, 0xFF, 0x3B, 0x3D, 0x54, 0xFF,
+    0x0E, 0x0F, 0x1B, 0xFF, 0x05, 0x08, 0x14, 0xFF, 0x06, 0x0A, 0x17, 0xFF, 0x06, 0x08, 0x17, 0xFF, 0x05, 0x06, 0x11, 0xFF, 0x1C, 0x1D, 0x2E, 0xFF,
+    0x2B, 0x2E, 0x3F, 0xFF, 0x26, 0x2A, 0x3A, 0xFF, 0x2B, 0x2E, 0x40, 0xFF, 0x2B, 0x2F, 0x40, 0xFF, 0x2B, 0x30, 0x41, 0xFF, 0x2B, 0x2F, 0x41, 0xFF,
+    0x2D, 0x30, 0x43, 0xFF, 0x2D, 0x32, 0x44, 0xFF, 0x2D, 0x31, 0x42, 0xFF, 0x2B, 0x2F, 0x40, 0xFF, 0x27, 0x2C, 0x3E, 0xFF, 0x25, 0x2A, 0x3C, 0xFF,
+    0x28, 0x2D, 0x3F, 0xFF, 0x2E, 0x32, 0x46, 0xFF, 0x2E, 0x34, 0x45, 0xFF, 0x2E, 0x33, 0x46, 0xFF, 0x2F, 0x34, 0x46, 0xFF, 0x30, 0x35, 0x48, 0xFF,
+    0x80, 0x30, 0x36, 0x49, 0xFF, 0x2F, 0x31, 0x36, 0x49, 0xFF, 0x2E, 0x32, 0x47, 0xFF, 0x32, 0x37, 0x49, 0xFF, 0x36, 0x3C, 0x50, 0xFF, 0x23, 0x27,
+    0x38, 0xFF, 0x32, 0x36, 0x4B, 0xFF, 0x08, 0x0D, 0x18, 0xFF, 0x06, 0x07, 0x13, 0xFF, 0x06, 0x09, 0x14, 0xFF, 0x06, 0x09, 0x13, 0xFF, 0x04, 0x07,
+    0x0F, 0xFF, 0x0A, 0x0C, 0x14, 0xFF, 0x3C, 0x3E, 0x4F, 0xFF, 0x3E, 0x41, 0x55, 0xFF, 0x39, 0x3D, 0x51, 0xFF, 0x38, 0x3D, 0x51, 0xFF, 0x37, 0x3C,
+    0x50, 0xFF, 0x36, 0x3A, 0x4F, 0xFF, 0x35, 0x3A, 0x4D, 0xFF, 0x35, 0x3B, 0x4F, 0xFF, 0x37, 0x3C, 0x50, 0xFF, 0x39, 0x3D, 0x52, 0xFF, 0x38, 0x3D,
+    0x52, 0xFF, 0x38, 0x3E, 0x52, 0xFF, 0x3B, 0x40, 0x54, 0xFF, 0x75, 0x7C, 0x8E, 0xFF, 0x6B, 0x71, 0x86, 0xFF, 0x3A, 0x3D, 0x4E, 0xFF, 0x03, 0x06,
+    0x0B, 0xFF, 0x08, 0x0D, 0x18, 0xFF, 0x01, 0x03, 0x0C, 0xFF, 0x49, 0x4E, 0x60, 0xFF, 0x39, 0x3F, 0x51, 0xFF, 0x3B, 0x40, 0x54, 0xFF, 0x3A, 0x41,
+    0x54, 0xFF, 0x3A, 0x40, 0x54, 0xFF, 0x3B, 0x41, 0x56, 0xFF, 0x3C, 0x41, 0x56, 0xFF, 0x3B, 0x41, 0x55, 0xFF, 0x3C, 0x42, 0x57, 0xFF, 0x3D, 0x44,
+    0x57, 0xFF, 0x3E, 0x45, 0x5A, 0xFF, 0x3C, 0x41, 0x55, 0xFF, 0x69, 0x6E, 0x81, 0xFF, 0x57, 0x5D, 0x70, 0xFF, 0x3C, 0x41, 0x54, 0xFF, 0x37, 0x3C,
+    0x4F, 0xFF, 0x36, 0x3A, 0x4C, 0xFF, 0x80, 0x32, 0x36, 0x49, 0xFF, 0x01, 0x34, 0x38, 0x4A, 0xFF, 0x35, 0x39, 0x4B, 0xFF, 0x80, 0x36, 0x3A, 0x4B,
+    0xFF, 0x2D, 0x36, 0x3B, 0x4C, 0xFF, 0x37, 0x3B, 0x4C, 0xFF, 0x38, 0x3B, 0x4B, 0xFF, 0x36, 0x39, 0x4A, 0xFF, 0x32, 0x36, 0x47, 0xFF, 0x32, 0x36,
+    0x46, 0xFF, 0x32, 0x37, 0x47, 0xFF, 0x30, 0x34, 0x45, 0xFF, 0x30, 0x36, 0x45, 0xFF, 0x30, 0x36, 0x47, 0xFF, 0x31, 0x37, 0x48, 0xFF, 0x30, 0x35,
+    0x47, 0xFF, 0x33, 0x37, 0x49, 0xFF, 0x30, 0x33, 0x45, 0xFF, 0x2B, 0x2F, 0x40, 0xFF, 0x2D, 0x30, 0x42, 0xFF, 0x31, 0x35, 0x47, 0xFF, 0x32, 0x36,
+    0x48, 0xFF, 0x33, 0x37, 0x4A, 0xFF, 0x32, 0x37, 0x4A, 0xFF, 0x30, 0x35, 0x48, 0xFF, 0x2E, 0x33, 0x45, 0xFF, 0x2A, 0x2E, 0x40, 0xFF, 0x1B, 0x1E,
+    0x2E, 0xFF, 0x04, 0x04, 0x10, 0xFF, 0x06, 0x08, 0x16, 0xFF, 0x42, 0x49, 0x5A, 0xFF, 0x74, 0x7A, 0x8E, 0xFF, 0x3D, 0x44, 0x56, 0xFF, 0x40, 0x47,
+    0x5A, 0xFF, 0x41, 0x49, 0x5A, 0xFF, 0x40, 0x47, 0x59, 0xFF, 0x40, 0x46, 0x57, 0xFF, 0x3D, 0x45, 0x55, 0xFF, 0x3C, 0x43, 0x55, 0xFF, 0x3A, 0x40,
+    0x52, 0xFF, 0x37, 0x3D, 0x50, 0xFF, 0x3A, 0x40, 0x51, 0xFF, 0x3C, 0x43, 0x55, 0xFF, 0x48, 0x50, 0x61, 0xFF, 0x63, 0x69, 0x79, 0xFF, 0x1B, 0x1D,
+    0x24, 0xFF, 0x07, 0x09, 0x15, 0xFF, 0x07, 0x0A, 0x18, 0xFF, 0x06, 0x09, 0x15, 0xFF, 0x05, 0x07, 0x13, 0xFF, 0x80, 0x05, 0x07, 0x12, 0xFF, 0x24,
+    0x05, 0x07, 0x13, 0xFF, 0x06, 0x07, 0x15, 0xFF, 0x06, 0x08, 0x16, 0xFF, 0x07, 0x09, 0x18, 0xFF, 0x08, 0x09, 0x17, 0xFF, 0x08, 0x0A, 0x17, 0xFF,
+    0x09, 0x0B, 0x19, 0xFF, 0x0A, 0x0C, 0x1C, 0xFF, 0x0C, 0x0D, 0x1F, 0xFF, 0x0C, 0x0D, 0x1E, 0xFF, 0x05, 0x05, 0x0E, 0xFF, 0x55, 0x5A, 0x68, 0xFF,
+    0x77, 0x7E, 0x8D, 0xFF, 0xAE, 0xB4, 0xBF, 0xFF, 0x5C, 0x62, 0x74, 0xFF, 0x30, 0x37, 0x4B, 0xFF, 0x36, 0x3C, 0x50, 0xFF, 0x35, 0x3C, 0x4F, 0xFF,
+    0x34, 0x3A, 0x4E, 0xFF, 0x33, 0x39, 0x4D, 0xFF, 0x31, 0x38, 0x4B, 0xFF, 0x30, 0x37, 0x4A, 0xFF, 0x33, 0x38, 0x4C, 0xFF, 0x34, 0x3A, 0x4D, 0xFF,
+    0x35, 0x3B, 0x4F, 0xFF, 0x36, 0x3B, 0x4F, 0xFF, 0x42, 0x46, 0x5C, 0xFF, 0x1A, 0x1E, 0x2C, 0xFF, 0x06, 0x0B, 0x17, 0xFF, 0x08, 0x0C, 0x1A, 0xFF,
+    0x22, 0x26, 0x32, 0xFF, 0x59, 0x5E, 0x71, 0xFF, 0x3F, 0x43, 0x57, 0xFF, 0x76, 0x7D, 0x8E, 0xFF, 0x74, 0x7B, 0x8F, 0xFF, 0x2F, 0x32, 0x45, 0xFF,
+    0x28, 0x2C, 0x3F, 0xFF, 0x80, 0x27, 0x2A, 0x3D, 0xFF, 0x38, 0x25, 0x2A, 0x3C, 0xFF, 0x26, 0x2A, 0x3D, 0xFF, 0x27, 0x2B, 0x3E, 0xFF, 0x28, 0x2C,
+    0x3D, 0xFF, 0x28, 0x2C, 0x3F, 0xFF, 0x28, 0x2F, 0x40, 0xFF, 0x2D, 0x33, 0x45, 0xFF, 0x30, 0x33, 0x44, 0xFF, 0x11, 0x14, 0x1C, 0xFF, 0x2E, 0x30,
+    0x3E, 0xFF, 0x55, 0x5B, 0x72, 0xFF, 0x46, 0x4D, 0x64, 0xFF, 0x25, 0x29, 0x3A, 0xFF, 0x61, 0x68, 0x79, 0xFF, 0x3F, 0x46, 0x54, 0xFF, 0x0E, 0x12,
+    0x1A, 0xFF, 0x18, 0x1C, 0x27, 0xFF, 0x17, 0x1B, 0x27, 0xFF, 0x16, 0x1B, 0x26, 0xFF, 0x17, 0x1C, 0x27, 0xFF, 0x18, 0x1C, 0x27, 0xFF, 0x18, 0x1B,
+    0x26, 0xFF, 0x16, 0x1A, 0x25, 0xFF, 0x15, 0x19, 0x24, 0xFF, 0x16, 0x19, 0x25, 0xFF, 0x19, 0x1D, 0x28, 0xFF, 0x21, 0x25, 0x30, 0xFF, 0x05, 0x06,
+    0x10, 0xFF, 0x06, 0x07, 0x15, 0xFF, 0x05, 0x07, 0x14, 0xFF, 0x05, 0x06, 0x13, 0xFF, 0x05, 0x07, 0x13, 0xFF, 0x04, 0x06, 0x12, 0xFF, 0x05, 0x07,
+    0x12, 0xFF, 0x05, 0x06, 0x12, 0xFF, 0x05, 0x06, 0x10, 0xFF, 0x05, 0x07, 0x11, 0xFF, 0x04, 0x07, 0x11, 0xFF, 0x04, 0x06, 0x11, 0xFF, 0x06, 0x07,
+    0x13, 0xFF, 0x06, 0x07, 0x12, 0xFF, 0x06, 0x03, 0x05, 0xFF, 0x69, 0x68, 0x77, 0xFF, 0x8E, 0x97, 0xA9, 0xFF, 0x7C, 0x81, 0x92, 0xFF, 0x63, 0x66,
+    0x78, 0xFF, 0x7E, 0x82, 0x8F, 0xFF, 0xBC, 0xC5, 0xC8, 0xFF, 0x5C, 0x62, 0x6B, 0xFF, 0x0A, 0x0D, 0x17, 0xFF, 0x0F, 0x13, 0x1A, 0xFF, 0x0D, 0x10,
+    0x17, 0xFF, 0x0B, 0x0F, 0x15, 0xFF, 0x0B, 0x0E, 0x13, 0xFF, 0x0A, 0x0D, 0x12, 0xFF, 0x0A, 0x0C, 0x12, 0xFF, 0x09, 0x0C, 0x11, 0xFF, 0x80, 0x09,
+    0x0B, 0x10, 0xFF, 0x04, 0x07, 0x09, 0x0D, 0xFF, 0x16, 0x1A, 0x1E, 0xFF, 0x03, 0x03, 0x07, 0xFF, 0x02, 0x02, 0x05, 0xFF, 0x02, 0x03, 0x06, 0xFF,
+    0x01, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x83, 0x00, 0x00, 0x01, 0xFF,
+    0x00, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x02, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80,
+    0x00, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x80, 0x01, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x05, 0xFF, 0x01,
+    0x01, 0x00, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x80, 0x01, 0x02, 0x06, 0xFF, 0x14, 0x01, 0x02, 0x04, 0xFF, 0x05, 0x08, 0x0D, 0xFF, 0x12, 0x16,
+    0x1E, 0xFF, 0x0A, 0x0C, 0x12, 0xFF, 0x0B, 0x0D, 0x14, 0xFF, 0x0B, 0x0D, 0x13, 0xFF, 0x0B, 0x0C, 0x13, 0xFF, 0x0B, 0x0C, 0x14, 0xFF, 0x0C, 0x0D,
+    0x15, 0xFF, 0x0C, 0x0D, 0x17, 0xFF, 0x0E, 0x0E, 0x19, 0xFF, 0x0D, 0x0E, 0x17, 0xFF, 0x0C, 0x0E, 0x17, 0xFF, 0x07, 0x08, 0x0D, 0xFF, 0x5D, 0x60,
+    0x6A, 0xFF, 0x77, 0x7D, 0x87, 0xFF, 0x04, 0x0C, 0x1C, 0xFF, 0x34, 0x39, 0x55, 0xFF, 0x50, 0x51, 0x6F, 0xFF, 0x50, 0x4F, 0x69, 0xFF, 0x13, 0x15,
+    0x1D, 0xFF, 0x80, 0x03, 0x05, 0x0C, 0xFF, 0x22, 0x19, 0x1D, 0x27, 0xFF, 0x29, 0x2D, 0x3B, 0xFF, 0x18, 0x1A, 0x28, 0xFF, 0x1B, 0x1E, 0x2D, 0xFF,
+    0x1C, 0x1E, 0x2D, 0xFF, 0x1C, 0x1F, 0x2F, 0xFF, 0x1D, 0x21, 0x2F, 0xFF, 0x1E, 0x21, 0x2F, 0xFF, 0x1D, 0x20, 0x2F, 0xFF, 0x1D, 0x20, 0x2E, 0xFF,
+    0x1B, 0x1F, 0x2E, 0xFF, 0x1C, 0x20, 0x2F, 0xFF, 0x1B, 0x1E, 0x2C, 0xFF, 0x3C, 0x42, 0x53, 0xFF, 0x68, 0x70, 0x85, 0xFF, 0x1B, 0x20, 0x35, 0xFF,
+    0x3E, 0x41, 0x5C, 0xFF, 0x3F, 0x40, 0x58, 0xFF, 0x0F, 0x11, 0x1D, 0xFF, 0x06, 0x08, 0x15, 0xFF, 0x07, 0x0A, 0x18, 0xFF, 0x07, 0x09, 0x17, 0xFF,
+    0x08, 0x0A, 0x18, 0xFF, 0x0F, 0x0F, 0x1F, 0xFF, 0x24, 0x27, 0x35, 0xFF, 0x26, 0x28, 0x3B, 0xFF, 0x28, 0x2B, 0x3D, 0xFF, 0x2A, 0x2E, 0x3F, 0xFF,
+    0x29, 0x2E, 0x3F, 0xFF, 0x2A, 0x2E, 0x3F, 0xFF, 0x2B, 0x2F, 0x40, 0xFF, 0x2B, 0x2F, 0x41, 0xFF, 0x29, 0x2E, 0x3F, 0xFF, 0x28, 0x2D, 0x3E, 0xFF,
+    0x28, 0x2D, 0x3F, 0xFF, 0x80, 0x29, 0x2D, 0x41, 0xFF, 0x0E, 0x2B, 0x30, 0x42, 0xFF, 0x2B, 0x30, 0x43, 0xFF, 0x2B, 0x31, 0x44, 0xFF, 0x2C, 0x31,
+    0x44, 0xFF, 0x2E, 0x33, 0x45, 0xFF, 0x2E, 0x34, 0x46, 0xFF, 0x2F, 0x36, 0x48, 0xFF, 0x2F, 0x34, 0x48, 0xFF, 0x29, 0x2E, 0x3F, 0xFF, 0x45, 0x48,
+    0x60, 0xFF, 0x23, 0x28, 0x38, 0xFF, 0x29, 0x2C, 0x3F, 0xFF, 0x2D, 0x31, 0x45, 0xFF, 0x02, 0x05, 0x0E, 0xFF, 0x05, 0x07, 0x12, 0xFF, 0x80, 0x05,
+    0x08, 0x12, 0xFF, 0x24, 0x05, 0x06, 0x0E, 0xFF, 0x0A, 0x0C, 0x14, 0xFF, 0x3C, 0x3D, 0x4F, 0xFF, 0x3C, 0x3F, 0x54, 0xFF, 0x38, 0x3B, 0x50, 0xFF,
+    0x36, 0x3B, 0x4E, 0xFF, 0x35, 0x3A, 0x4E, 0xFF, 0x33, 0x38, 0x4C, 0xFF, 0x34, 0x38, 0x4C, 0xFF, 0x35, 0x39, 0x4E, 0xFF, 0x36, 0x3B, 0x4E, 0xFF,
+    0x37, 0x3C, 0x50, 0xFF, 0x36, 0x3B, 0x4F, 0xFF, 0x35, 0x3A, 0x4E, 0xFF, 0x37, 0x3D, 0x50, 0xFF, 0x71, 0x78, 0x8C, 0xFF, 0x69, 0x6F, 0x86, 0xFF,
+    0x3A, 0x3E, 0x4F, 0xFF, 0x04, 0x05, 0x0B, 0xFF, 0x0A, 0x0D, 0x19, 0xFF, 0x01, 0x03, 0x0C, 0xFF, 0x44, 0x4A, 0x5A, 0xFF, 0x36, 0x3B, 0x4D, 0xFF,
+    0x37, 0x3D, 0x51, 0xFF, 0x38, 0x3D, 0x51, 0xFF, 0x38, 0x3E, 0x52, 0xFF, 0x38, 0x3E, 0x53, 0xFF, 0x39, 0x3F, 0x54, 0xFF, 0x3A, 0x40, 0x54, 0xFF,
+    0x3B, 0x41, 0x54, 0xFF, 0x3C, 0x41, 0x55, 0xFF, 0x3D, 0x42, 0x56, 0xFF, 0x36, 0x3C, 0x4F, 0xFF, 0x6E, 0x73, 0x84, 0xFF, 0x7C, 0x81, 0x91, 0xFF,
+    0x21, 0x22, 0x2F, 0xFF, 0x0A, 0x0A, 0x14, 0xFF, 0x80, 0x07, 0x09, 0x13, 0xFF, 0x01, 0x07, 0x0A, 0x14, 0xFF, 0x08, 0x0B, 0x17, 0xFF, 0x80, 0x09,
+    0x0C, 0x18, 0xFF, 0x07, 0x09, 0x0E, 0x18, 0xFF, 0x09, 0x0D, 0x17, 0xFF, 0x08, 0x0C, 0x15, 0xFF, 0x09, 0x0D, 0x15, 0xFF, 0x08, 0x0D, 0x15, 0xFF,
+    0x08, 0x0C, 0x15, 0xFF, 0x09, 0x0B, 0x15, 0xFF, 0x08, 0x0A, 0x14, 0xFF, 0x80, 0x07, 0x09, 0x12, 0xFF, 0x6B, 0x07, 0x0A, 0x15, 0xFF, 0x09, 0x0B,
+    0x17, 0xFF, 0x08, 0x0B, 0x17, 0xFF, 0x09, 0x0B, 0x18, 0xFF, 0x09, 0x0C, 0x18, 0xFF, 0x09, 0x0C, 0x19, 0xFF, 0x08, 0x0C, 0x16, 0xFF, 0x0B, 0x0D,
+    0x17, 0xFF, 0x09, 0x0D, 0x17, 0xFF, 0x07, 0x0C, 0x16, 0xFF, 0x09, 0x0D, 0x17, 0xFF, 0x0A, 0x0C, 0x18, 0xFF, 0x08, 0x0B, 0x15, 0xFF, 0x09, 0x0B,
+    0x15, 0xFF, 0x09, 0x0A, 0x16, 0xFF, 0x0A, 0x0C, 0x1A, 0xFF, 0x0A, 0x0B, 0x1B, 0xFF, 0x38, 0x3E, 0x51, 0xFF, 0x6D, 0x74, 0x88, 0xFF, 0x38, 0x3F,
+    0x4F, 0xFF, 0x3D, 0x44, 0x56, 0xFF, 0x3E, 0x45, 0x57, 0xFF, 0x3B, 0x43, 0x54, 0xFF, 0x3C, 0x42, 0x55, 0xFF, 0x3A, 0x41, 0x52, 0xFF, 0x39, 0x3F,
+    0x50, 0xFF, 0x36, 0x3D, 0x4F, 0xFF, 0x36, 0x3D, 0x4E, 0xFF, 0x3B, 0x42, 0x53, 0xFF, 0x3B, 0x43, 0x56, 0xFF, 0x3B, 0x43, 0x54, 0xFF, 0x6B, 0x71,
+    0x83, 0xFF, 0x34, 0x38, 0x44, 0xFF, 0x05, 0x05, 0x0F, 0xFF, 0x07, 0x0A, 0x17, 0xFF, 0x06, 0x08, 0x14, 0xFF, 0x06, 0x07, 0x13, 0xFF, 0x05, 0x06,
+    0x12, 0xFF, 0x04, 0x07, 0x12, 0xFF, 0x05, 0x06, 0x12, 0xFF, 0x06, 0x06, 0x14, 0xFF, 0x06, 0x08, 0x15, 0xFF, 0x07, 0x08, 0x17, 0xFF, 0x08, 0x09,
+    0x17, 0xFF, 0x08, 0x0A, 0x18, 0xFF, 0x09, 0x0B, 0x1A, 0xFF, 0x0B, 0x0D, 0x1D, 0xFF, 0x0D, 0x0F, 0x20, 0xFF, 0x0B, 0x0C, 0x1A, 0xFF, 0x30, 0x34,
+    0x3F, 0xFF, 0x6D, 0x72, 0x82, 0xFF, 0x94, 0x99, 0xA5, 0xFF, 0xA3, 0xA9, 0xB3, 0xFF, 0x43, 0x49, 0x5C, 0xFF, 0x32, 0x38, 0x4C, 0xFF, 0x36, 0x3C,
+    0x50, 0xFF, 0x34, 0x3A, 0x4E, 0xFF, 0x33, 0x3A, 0x4D, 0xFF, 0x32, 0x39, 0x4B, 0xFF, 0x31, 0x37, 0x4A, 0xFF, 0x30, 0x36, 0x4A, 0xFF, 0x30, 0x35,
+    0x49, 0xFF, 0x31, 0x38, 0x4B, 0xFF, 0x34, 0x3A, 0x4D, 0xFF, 0x33, 0x39, 0x4C, 0xFF, 0x40, 0x44, 0x59, 0xFF, 0x19, 0x1C, 0x2A, 0xFF, 0x05, 0x0A,
+    0x15, 0xFF, 0x07, 0x0C, 0x18, 0xFF, 0x21, 0x25, 0x31, 0xFF, 0x57, 0x5D, 0x70, 0xFF, 0x3E, 0x42, 0x56, 0xFF, 0x77, 0x7D, 0x8D, 0xFF, 0x72, 0x78,
+    0x8C, 0xFF, 0x2D, 0x31, 0x44, 0xFF, 0x27, 0x2B, 0x3D, 0xFF, 0x25, 0x29, 0x3B, 0xFF, 0x26, 0x29, 0x3C, 0xFF, 0x25, 0x29, 0x3A, 0xFF, 0x25, 0x29,
+    0x3B, 0xFF, 0x25, 0x29, 0x3C, 0xFF, 0x25, 0x2A, 0x3C, 0xFF, 0x27, 0x2B, 0x3C, 0xFF, 0x26, 0x2D, 0x3C, 0xFF, 0x2A, 0x30, 0x41, 0xFF, 0x2D, 0x31,
+    0x41, 0xFF, 0x0E, 0x12, 0x1C, 0xFF, 0x11, 0x13, 0x1B, 0xFF, 0x4F, 0x55, 0x6C, 0xFF, 0x47, 0x4F, 0x67, 0xFF, 0x23, 0x28, 0x3A, 0xFF, 0x4B, 0x52,
+    0x63, 0xFF, 0x3C, 0x43, 0x51, 0xFF, 0x0D, 0x11, 0x18, 0xFF, 0x16, 0x1A, 0x24, 0xFF, 0x15, 0x19, 0x24, 0xFF, 0x16, 0x19, 0x24, 0xFF, 0x16, 0x1A,
+    0x25, 0xFF, 0x17, 0x1A, 0x25, 0xFF, 0x17, 0x1B, 0x26, 0xFF, 0x16, 0x1A, 0x25, 0xFF, 0x15, 0x19, 0x24, 0xFF, 0x16, 0x1A, 0x25, 0xFF, 0x17, 0x19,
+    0x25, 0xFF, 0x1F, 0x22, 0x2D, 0xFF, 0x1E, 0x21, 0x2B, 0xFF, 0x05, 0x06, 0x12, 0xFF, 0x05, 0x06, 0x14, 0xFF, 0x80, 0x05, 0x07, 0x13, 0xFF, 0x01,
+    0x05, 0x06, 0x13, 0xFF, 0x06, 0x07, 0x13, 0xFF, 0x80, 0x06, 0x08, 0x13, 0xFF, 0x11, 0x05, 0x07, 0x12, 0xFF, 0x05, 0x07, 0x13, 0xFF, 0x06, 0x08,
+    0x15, 0xFF, 0x07, 0x08, 0x14, 0xFF, 0x04, 0x05, 0x0E, 0xFF, 0x2F, 0x29, 0x2F, 0xFF, 0x8C, 0x8F, 0x9D, 0xFF, 0x8F, 0x98, 0xA9, 0xFF, 0x76, 0x7B,
+    0x8E, 0xFF, 0x68, 0x69, 0x7B, 0xFF, 0xB3, 0xBA, 0xC1, 0xFF, 0xAB, 0xB0, 0xB7, 0xFF, 0x11, 0x15, 0x1F, 0xFF, 0x0F, 0x13, 0x1B, 0xFF, 0x0E, 0x11,
+    0x19, 0xFF, 0x0B, 0x0F, 0x16, 0xFF, 0x0A, 0x0E, 0x14, 0xFF, 0x0A, 0x0D, 0x13, 0xFF, 0x80, 0x0A, 0x0C, 0x12, 0xFF, 0x07, 0x09, 0x0B, 0x11, 0xFF,
+    0x09, 0x0B, 0x10, 0xFF, 0x09, 0x0A, 0x10, 0xFF, 0x07, 0x09, 0x0D, 0xFF, 0x15, 0x1A, 0x1D, 0xFF, 0x03, 0x04, 0x07, 0xFF, 0x02, 0x02, 0x05, 0xFF,
+    0x01, 0x03, 0x05, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x01,
+    0xFF, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01,
+    0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x03, 0xFF, 0x80, 0x01, 0x01,
+    0x04, 0xFF, 0x05, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x02, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01,
+    0x02, 0x05, 0xFF, 0x80, 0x00, 0x02, 0x06, 0xFF, 0x08, 0x01, 0x02, 0x05, 0xFF, 0x05, 0x08, 0x0D, 0xFF, 0x11, 0x16, 0x1D, 0xFF, 0x0A, 0x0C, 0x11,
+    0xFF, 0x0B, 0x0D, 0x14, 0xFF, 0x0B, 0x0C, 0x14, 0xFF, 0x0C, 0x0D, 0x14, 0xFF, 0x0B, 0x0D, 0x14, 0xFF, 0x0B, 0x0E, 0x16, 0xFF, 0x80, 0x0D, 0x0E,
+    0x17, 0xFF, 0x29, 0x0D, 0x0F, 0x18, 0xFF, 0x0C, 0x0E, 0x17, 0xFF, 0x08, 0x08, 0x0E, 0xFF, 0x5D, 0x5E, 0x67, 0xFF, 0x76, 0x7D, 0x87, 0xFF, 0x04,
+    0x0D, 0x1D, 0xFF, 0x33, 0x39, 0x52, 0xFF, 0x4E, 0x50, 0x6C, 0xFF, 0x4D, 0x4D, 0x67, 0xFF, 0x14, 0x14, 0x1E, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x03,
+    0x05, 0x0D, 0xFF, 0x18, 0x1D, 0x27, 0xFF, 0x28, 0x2C, 0x3A, 0xFF, 0x18, 0x1A, 0x27, 0xFF, 0x1A, 0x1D, 0x2C, 0xFF, 0x19, 0x1D, 0x2C, 0xFF, 0x1B,
+    0x1E, 0x2D, 0xFF, 0x1B, 0x1F, 0x2D, 0xFF, 0x1B, 0x1E, 0x2C, 0xFF, 0x1B, 0x1E, 0x2B, 0xFF, 0x1A, 0x1E, 0x2C, 0xFF, 0x1A, 0x1E, 0x2B, 0xFF, 0x1A,
+    0x1D, 0x2C, 0xFF, 0x18, 0x1B, 0x28, 0xFF, 0x3B, 0x40, 0x51, 0xFF, 0x66, 0x6F, 0x84, 0xFF, 0x1C, 0x21, 0x35, 0xFF, 0x40, 0x42, 0x5C, 0xFF, 0x40,
+    0x40, 0x59, 0xFF, 0x0F, 0x12, 0x1E, 0xFF, 0x06, 0x08, 0x15, 0xFF, 0x07, 0x0A, 0x17, 0xFF, 0x08, 0x0A, 0x18, 0xFF, 0x09, 0x0B, 0x1A, 0xFF, 0x06,
+    0x09, 0x13, 0xFF, 0x22, 0x23, 0x35, 0xFF, 0x28, 0x2A, 0x3C, 0xFF, 0x26, 0x2A, 0x3A, 0xFF, 0x28, 0x2C, 0x3D, 0xFF, 0x27, 0x2B, 0x3C, 0xFF, 0x28,
+    0x2C, 0x3D, 0xFF, 0x80, 0x27, 0x2B, 0x3C, 0xFF, 0x05, 0x27, 0x2B, 0x3D, 0xFF, 0x26, 0x2B, 0x3D, 0xFF, 0x27, 0x2B, 0x3D, 0xFF, 0x26, 0x2B, 0x3D,
+    0xFF, 0x27, 0x2C, 0x3D, 0xFF, 0x29, 0x2D, 0x3F, 0xFF, 0x80, 0x29, 0x2E, 0x41, 0xFF, 0x0A, 0x2A, 0x2F, 0x41, 0xFF, 0x2C, 0x30, 0x44, 0xFF, 0x2B,
+    0x31, 0x43, 0xFF, 0x2D, 0x32, 0x44, 0xFF, 0x2B, 0x2F, 0x45, 0xFF, 0x30, 0x34, 0x47, 0xFF, 0x3E, 0x44, 0x58, 0xFF, 0x1F, 0x22, 0x35, 0xFF, 0x29,
+    0x2E, 0x40, 0xFF, 0x17, 0x1A, 0x2B, 0xFF, 0x04, 0x07, 0x12, 0xFF, 0x81, 0x05, 0x08, 0x12, 0xFF, 0x18, 0x04, 0x06, 0x0D, 0xFF, 0x0A, 0x0C, 0x15,
+    0xFF, 0x3B, 0x3C, 0x4E, 0xFF, 0x3B, 0x3D, 0x50, 0xFF, 0x36, 0x39, 0x4D, 0xFF, 0x34, 0x38, 0x4C, 0xFF, 0x33, 0x37, 0x4B, 0xFF, 0x32, 0x37, 0x4A,
+    0xFF, 0x34, 0x38, 0x4C, 0xFF, 0x34, 0x39, 0x4C, 0xFF, 0x36, 0x3A, 0x4E, 0xFF, 0x35, 0x3A, 0x4E, 0xFF, 0x34, 0x39, 0x4E, 0xFF, 0x33, 0x37, 0x4B,
+    0xFF, 0x35, 0x39, 0x4C, 0xFF, 0x71, 0x75, 0x8A, 0xFF, 0x69, 0x6F, 0x86, 0xFF, 0x3A, 0x3E, 0x50, 0xFF, 0x04, 0x05, 0x0B, 0xFF, 0x09, 0x0D, 0x18,
+    0xFF, 0x01, 0x03, 0x0A, 0xFF, 0x35, 0x39, 0x49, 0xFF, 0x33, 0x39, 0x49, 0xFF, 0x36, 0x3B, 0x4E, 0xFF, 0x37, 0x3B, 0x4F, 0xFF, 0x80, 0x36, 0x3C,
+    0x4F, 0xFF, 0x02, 0x38, 0x3D, 0x51, 0xFF, 0x3B, 0x3F, 0x54, 0xFF, 0x3A, 0x40, 0x54, 0xFF, 0x80, 0x3B, 0x41, 0x54, 0xFF, 0x1F, 0x39, 0x3D, 0x50,
+    0xFF, 0x50, 0x53, 0x68, 0xFF, 0x93, 0x98, 0xA1, 0xFF, 0x62, 0x64, 0x6E, 0xFF, 0x07, 0x08, 0x10, 0xFF, 0x0B, 0x0E, 0x1D, 0xFF, 0x0A, 0x0D, 0x1C,
+    0xFF, 0x09, 0x0E, 0x1C, 0xFF, 0x09, 0x0E, 0x1E, 0xFF, 0x0A, 0x0E, 0x1F, 0xFF, 0x09, 0x0E, 0x1E, 0xFF, 0x09, 0x0F, 0x1F, 0xFF, 0x0A, 0x0E, 0x1D,
+    0xFF, 0x09, 0x0D, 0x1B, 0xFF, 0x09, 0x0D, 0x1A, 0xFF, 0x09, 0x0D, 0x1B, 0xFF, 0x0A, 0x0D, 0x1B, 0xFF, 0x0A, 0x0C, 0x1B, 0xFF, 0x09, 0x0B, 0x1A,
+    0xFF, 0x07, 0x0A, 0x19, 0xFF, 0x07, 0x0A, 0x16, 0xFF, 0x07, 0x0A, 0x13, 0xFF, 0x2C, 0x2F, 0x37, 0xFF, 0x57, 0x59, 0x62, 0xFF, 0x4B, 0x4E, 0x58,
+    0xFF, 0x29, 0x2B, 0x34, 0xFF, 0x0C, 0x0D, 0x18, 0xFF, 0x0A, 0x0B, 0x18, 0xFF, 0x08, 0x0B, 0x16, 0xFF, 0x08, 0x09, 0x14, 0xFF, 0x09, 0x0A, 0x15,
+    0xFF, 0x08, 0x0A, 0x15, 0xFF, 0x80, 0x0A, 0x0C, 0x19, 0xFF, 0x0F, 0x0D, 0x0E, 0x1C, 0xFF, 0x0A, 0x0D, 0x1A, 0xFF, 0x0C, 0x0F, 0x1F, 0xFF, 0x0C,
+    0x0E, 0x1C, 0xFF, 0x29, 0x2D, 0x3F, 0xFF, 0x61, 0x68, 0x7D, 0xFF, 0x3F, 0x47, 0x5A, 0xFF, 0x37, 0x3E, 0x50, 0xFF, 0x39, 0x3F, 0x50, 0xFF, 0x37,
+    0x3E, 0x4F, 0xFF, 0x37, 0x3D, 0x4E, 0xFF, 0x35, 0x3B, 0x4C, 0xFF, 0x34, 0x3A, 0x4B, 0xFF, 0x34, 0x39, 0x4C, 0xFF, 0x34, 0x3A, 0x4B, 0xFF, 0x37,
+    0x3E, 0x4F, 0xFF, 0x80, 0x3B, 0x41, 0x54, 0xFF, 0x06, 0x53, 0x59, 0x6A, 0xFF, 0x74, 0x7B, 0x8C, 0xFF, 0x19, 0x1C, 0x28, 0xFF, 0x04, 0x05, 0x0F,
+    0xFF, 0x06, 0x08, 0x13, 0xFF, 0x06, 0x07, 0x12, 0xFF, 0x05, 0x07, 0x12, 0xFF, 0x80, 0x05, 0x06, 0x12, 0xFF, 0x0D, 0x05, 0x08, 0x13, 0xFF, 0x06,
+    0x07, 0x15, 0xFF, 0x07, 0x08, 0x17, 0xFF, 0x08, 0x0A, 0x18, 0xFF, 0x08, 0x0B, 0x19, 0xFF, 0x0A, 0x0C, 0x1B, 0xFF, 0x0C, 0x0E, 0x1F, 0xFF, 0x0D,
+    0x0F, 0x21, 0xFF, 0x07, 0x08, 0x14, 0xFF, 0x58, 0x5D, 0x6C, 0xFF, 0x91, 0x95, 0xA5, 0xFF, 0xB2, 0xB8, 0xC1, 0xFF, 0x77, 0x7D, 0x8C, 0xFF, 0x32,
+    0x39, 0x4D, 0xFF, 0x80, 0x36, 0x3B, 0x4F, 0xFF, 0x13, 0x33, 0x39, 0x4D, 0xFF, 0x31, 0x38, 0x4B, 0xFF, 0x31, 0x37, 0x4A, 0xFF, 0x31, 0x36, 0x49,
+    0xFF, 0x2F, 0x35, 0x47, 0xFF, 0x2E, 0x34, 0x47, 0xFF, 0x30, 0x35, 0x48, 0xFF, 0x31, 0x37, 0x4A, 0xFF, 0x31, 0x36, 0x49, 0xFF, 0x40, 0x43, 0x56,
+    0xFF, 0x19, 0x1B, 0x27, 0xFF, 0x04, 0x09, 0x14, 0xFF, 0x06, 0x0B, 0x17, 0xFF, 0x20, 0x23, 0x2F, 0xFF, 0x56, 0x5A, 0x6E, 0xFF, 0x3C, 0x41, 0x55,
+    0xFF, 0x77, 0x7E, 0x8E, 0xFF, 0x74, 0x79, 0x8D, 0xFF, 0x2D, 0x30, 0x43, 0xFF, 0x26, 0x2A, 0x3B, 0xFF, 0x80, 0x27, 0x2A, 0x3C, 0xFF, 0x21, 0x26,
+    0x29, 0x3B, 0xFF, 0x24, 0x27, 0x39, 0xFF, 0x23, 0x26, 0x38, 0xFF, 0x24, 0x29, 0x3A, 0xFF, 0x26, 0x2A, 0x3B, 0xFF, 0x25, 0x2B, 0x3B, 0xFF, 0x29,
+    0x2D, 0x3F, 0xFF, 0x2B, 0x2F, 0x3E, 0xFF, 0x0D, 0x11, 0x1A, 0xFF, 0x05, 0x07, 0x0D, 0xFF, 0x45, 0x49, 0x5F, 0xFF, 0x48, 0x4F, 0x68, 0xFF, 0x27,
+    0x2C, 0x3F, 0xFF, 0x35, 0x3B, 0x4A, 0xFF, 0x45, 0x4C, 0x5E, 0xFF, 0x17, 0x1B, 0x25, 0xFF, 0x14, 0x17, 0x21, 0xFF, 0x12, 0x17, 0x21, 0xFF, 0x13,
+    0x18, 0x22, 0xFF, 0x16, 0x19, 0x24, 0xFF, 0x16, 0x19, 0x25, 0xFF, 0x17, 0x1A, 0x25, 0xFF, 0x15, 0x17, 0x23, 0xFF, 0x13, 0x16, 0x22, 0xFF, 0x14,
+    0x17, 0x22, 0xFF, 0x15, 0x16, 0x23, 0xFF, 0x1A, 0x1D, 0x28, 0xFF, 0x28, 0x2B, 0x36, 0xFF, 0x08, 0x08, 0x12, 0xFF, 0x02, 0x03, 0x0E, 0xFF, 0x05,
+    0x06, 0x13, 0xFF, 0x04, 0x07, 0x12, 0xFF, 0x05, 0x07, 0x13, 0xFF, 0x06, 0x07, 0x14, 0xFF, 0x80, 0x06, 0x08, 0x14, 0xFF, 0x0F, 0x06, 0x08, 0x15,
+    0xFF, 0x06, 0x08, 0x16, 0xFF, 0x07, 0x0A, 0x17, 0xFF, 0x06, 0x09, 0x15, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x6E, 0x6C, 0x76, 0xFF, 0x9D, 0xA4, 0xB1,
+    0xFF, 0x88, 0x8E, 0xA1, 0xFF, 0x6D, 0x70, 0x83, 0xFF, 0x91, 0x95, 0xA0, 0xFF, 0xC7, 0xCD, 0xD2, 0xFF, 0x6D, 0x72, 0x7D, 0xFF, 0x07, 0x0A, 0x13,
+    0xFF, 0x10, 0x15, 0x1C, 0xFF, 0x0C, 0x10, 0x16, 0xFF, 0x0B, 0x0E, 0x15, 0xFF, 0x80, 0x0A, 0x0D, 0x13, 0xFF, 0x09, 0x0A, 0x0D, 0x12, 0xFF, 0x0A,
+    0x0C, 0x12, 0xFF, 0x09, 0x0C, 0x11, 0xFF, 0x09, 0x0B, 0x11, 0xFF, 0x09, 0x0A, 0x0F, 0xFF, 0x07, 0x09, 0x0D, 0xFF, 0x15, 0x1A, 0x1D, 0xFF, 0x03,
+    0x04, 0x07, 0xFF, 0x02, 0x02, 0x04, 0xFF, 0x02, 0x02, 0x06, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01,
+    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x4A, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01,
+    0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x05,
+    0xFF, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x00, 0x06, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x01, 0x02, 0x05,
+    0xFF, 0x05, 0x07, 0x0C, 0xFF, 0x11, 0x15, 0x1C, 0xFF, 0x0A, 0x0B, 0x11, 0xFF, 0x0B, 0x0C, 0x12, 0xFF, 0x0B, 0x0C, 0x14, 0xFF, 0x0B, 0x0D, 0x14,
+    0xFF, 0x0C, 0x0D, 0x15, 0xFF, 0x0C, 0x0E, 0x15, 0xFF, 0x0C, 0x0E, 0x16, 0xFF, 0x0C, 0x0E, 0x17, 0xFF, 0x0C, 0x0F, 0x17, 0xFF, 0x0C, 0x0E, 0x17,
+    0xFF, 0x08, 0x09, 0x0D, 0xFF, 0x5A, 0x5C, 0x65, 0xFF, 0x75, 0x7A, 0x85, 0xFF, 0x04, 0x0C, 0x1C, 0xFF, 0x32, 0x38, 0x52, 0xFF, 0x4D, 0x4E, 0x69,
+    0xFF, 0x4D, 0x4C, 0x65, 0xFF, 0x14, 0x14, 0x1E, 0xFF, 0x04, 0x06, 0x0D, 0xFF, 0x04, 0x05, 0x0D, 0xFF, 0x17, 0x1C, 0x26, 0xFF, 0x27, 0x2B, 0x39,
+    0xFF, 0x17, 0x19, 0x26, 0xFF, 0x19, 0x1B, 0x2A, 0xFF, 0x18, 0x1B, 0x2A, 0xFF, 0x1A, 0x1C, 0x2A, 0xFF, 0x1A, 0x1D, 0x2A, 0xFF, 0x1A, 0x1C, 0x2A,
+    0xFF, 0x1A, 0x1C, 0x29, 0xFF, 0x1A, 0x1D, 0x29, 0xFF, 0x1A, 0x1E, 0x2B, 0xFF, 0x1A, 0x1D, 0x2B, 0xFF, 0x17, 0x19, 0x26, 0xFF, 0x39, 0x3F, 0x4F,
+    0xFF, 0x64, 0x6D, 0x82, 0xFF, 0x1B, 0x20, 0x35, 0xFF, 0x40, 0x42, 0x5C, 0xFF, 0x3F, 0x40, 0x58, 0xFF, 0x0F, 0x13, 0x1E, 0xFF, 0x06, 0x08, 0x15,
+    0xFF, 0x07, 0x09, 0x16, 0xFF, 0x07, 0x0A, 0x17, 0xFF, 0x07, 0x0C, 0x18, 0xFF, 0x08, 0x0A, 0x16, 0xFF, 0x15, 0x15, 0x25, 0xFF, 0x23, 0x27, 0x35,
+    0xFF, 0x24, 0x28, 0x39, 0xFF, 0x25, 0x28, 0x39, 0xFF, 0x25, 0x29, 0x3A, 0xFF, 0x27, 0x2A, 0x3B, 0xFF, 0x26, 0x29, 0x3A, 0xFF, 0x24, 0x28, 0x39,
+    0xFF, 0x24, 0x29, 0x3A, 0xFF, 0x24, 0x28, 0x3A, 0xFF, 0x24, 0x29, 0x3A, 0xFF, 0x24, 0x29, 0x39, 0xFF, 0x26, 0x2A, 0x3A, 0xFF, 0x27, 0x2B, 0x3C,
+    0xFF, 0x80, 0x27, 0x2B, 0x3D, 0xFF, 0x2B, 0x28, 0x2D, 0x3F, 0xFF, 0x29, 0x2F, 0x40, 0xFF, 0x2A, 0x2F, 0x41, 0xFF, 0x2C, 0x31, 0x44, 0xFF, 0x25,
+    0x2B, 0x3C, 0xFF, 0x3F, 0x41, 0x5B, 0xFF, 0x2C, 0x30, 0x43, 0xFF, 0x24, 0x26, 0x3A, 0xFF, 0x2F, 0x32, 0x47, 0xFF, 0x02, 0x06, 0x0D, 0xFF, 0x06,
+    0x07, 0x13, 0xFF, 0x05, 0x08, 0x12, 0xFF, 0x05, 0x07, 0x11, 0xFF, 0x05, 0x08, 0x11, 0xFF, 0x03, 0x06, 0x0D, 0xFF, 0x0B, 0x0D, 0x15, 0xFF, 0x3A,
+    0x3B, 0x4D, 0xFF, 0x39, 0x3B, 0x4F, 0xFF, 0x34, 0x38, 0x4B, 0xFF, 0x32, 0x36, 0x4A, 0xFF, 0x33, 0x37, 0x4A, 0xFF, 0x31, 0x36, 0x49, 0xFF, 0x32,
+    0x36, 0x4A, 0xFF, 0x31, 0x36, 0x49, 0xFF, 0x33, 0x37, 0x4A, 0xFF, 0x32, 0x37, 0x4B, 0xFF, 0x32, 0x38, 0x4C, 0xFF, 0x32, 0x37, 0x4A, 0xFF, 0x33,
+    0x38, 0x4B, 0xFF, 0x70, 0x74, 0x88, 0xFF, 0x67, 0x6B, 0x83, 0xFF, 0x39, 0x3B, 0x4D, 0xFF, 0x03, 0x04, 0x0B, 0xFF, 0x07, 0x0B, 0x17, 0xFF, 0x02,
+    0x05, 0x0D, 0xFF, 0x12, 0x15, 0x1E, 0xFF, 0x37, 0x3C, 0x4D, 0xFF, 0x34, 0x39, 0x4B, 0xFF, 0x34, 0x38, 0x4B, 0xFF, 0x34, 0x39, 0x4C, 0xFF, 0x34,
+    0x3A, 0x4D, 0xFF, 0x37, 0x3C, 0x4F, 0xFF, 0x39, 0x3D, 0x51, 0xFF, 0x38, 0x3E, 0x51, 0xFF, 0x80, 0x3A, 0x3F, 0x52, 0xFF, 0x09, 0x3A, 0x3D, 0x51,
+    0xFF, 0x32, 0x36, 0x48, 0xFF, 0x76, 0x7B, 0x84, 0xFF, 0x9E, 0xA2, 0xAB, 0xFF, 0x26, 0x27, 0x30, 0xFF, 0x06, 0x09, 0x13, 0xFF, 0x0D, 0x11, 0x21,
+    0xFF, 0x0B, 0x10, 0x20, 0xFF, 0x0A, 0x10, 0x20, 0xFF, 0x09, 0x0F, 0x1F, 0xFF, 0x80, 0x09, 0x0E, 0x1E, 0xFF, 0x04, 0x08, 0x0D, 0x1C, 0xFF, 0x08,
+    0x0D, 0x1B, 0xFF, 0x09, 0x0D, 0x1B, 0xFF, 0x08, 0x0D, 0x1B, 0xFF, 0x0A, 0x0D, 0x1C, 0xFF, 0x80, 0x09, 0x0D, 0x1D, 0xFF, 0x3D, 0x0A, 0x0D, 0x1D,
+    0xFF, 0x06, 0x09, 0x14, 0xFF, 0x17, 0x19, 0x20, 0xFF, 0x7A, 0x7F, 0x8A, 0xFF, 0x8F, 0x93, 0xA1, 0xFF, 0x88, 0x8C, 0x9C, 0xFF, 0x81, 0x86, 0x96,
+    0xFF, 0x6B, 0x6D, 0x7A, 0xFF, 0x68, 0x69, 0x75, 0xFF, 0x40, 0x40, 0x4A, 0xFF, 0x05, 0x06, 0x0B, 0xFF, 0x02, 0x02, 0x07, 0xFF, 0x02, 0x03, 0x0B,
+    0xFF, 0x07, 0x09, 0x14, 0xFF, 0x0C, 0x0E, 0x1B, 0xFF, 0x0D, 0x0F, 0x1D, 0xFF, 0x0C, 0x0E, 0x1C, 0xFF, 0x0B, 0x0E, 0x1D, 0xFF, 0x08, 0x0C, 0x19,
+    0xFF, 0x16, 0x19, 0x28, 0xFF, 0x47, 0x4E, 0x61, 0xFF, 0x52, 0x59, 0x6E, 0xFF, 0x2F, 0x35, 0x45, 0xFF, 0x35, 0x3B, 0x4B, 0xFF, 0x33, 0x39, 0x4B,
+    0xFF, 0x33, 0x39, 0x49, 0xFF, 0x33, 0x38, 0x49, 0xFF, 0x33, 0x39, 0x4A, 0xFF, 0x33, 0x38, 0x49, 0xFF, 0x30, 0x37, 0x47, 0xFF, 0x33, 0x39, 0x4B,
+    0xFF, 0x37, 0x3E, 0x4F, 0xFF, 0x39, 0x3E, 0x51, 0xFF, 0x34, 0x3A, 0x4C, 0xFF, 0x7A, 0x82, 0x94, 0xFF, 0x6B, 0x70, 0x80, 0xFF, 0x18, 0x18, 0x21,
+    0xFF, 0x04, 0x04, 0x0B, 0xFF, 0x06, 0x07, 0x10, 0xFF, 0x06, 0x07, 0x11, 0xFF, 0x06, 0x07, 0x12, 0xFF, 0x06, 0x07, 0x13, 0xFF, 0x06, 0x08, 0x14,
+    0xFF, 0x06, 0x09, 0x14, 0xFF, 0x07, 0x09, 0x17, 0xFF, 0x08, 0x0A, 0x19, 0xFF, 0x09, 0x0B, 0x1B, 0xFF, 0x0B, 0x0D, 0x1D, 0xFF, 0x0C, 0x0F, 0x20,
+    0xFF, 0x08, 0x0B, 0x18, 0xFF, 0x31, 0x34, 0x41, 0xFF, 0x7F, 0x84, 0x94, 0xFF, 0xB6, 0xBC, 0xC5, 0xFF, 0x9B, 0xA2, 0xAD, 0xFF, 0x33, 0x38, 0x4D,
+    0xFF, 0x36, 0x3D, 0x50, 0xFF, 0x35, 0x3B, 0x4E, 0xFF, 0x34, 0x39, 0x4D, 0xFF, 0x32, 0x37, 0x4A, 0xFF, 0x30, 0x35, 0x49, 0xFF, 0x30, 0x35, 0x48,
+    0xFF, 0x2E, 0x34, 0x46, 0xFF, 0x80, 0x2D, 0x33, 0x46, 0xFF, 0x13, 0x2E, 0x33, 0x46, 0xFF, 0x2E, 0x33, 0x45, 0xFF, 0x2D, 0x31, 0x44, 0xFF, 0x3D,
+    0x40, 0x54, 0xFF, 0x17, 0x1A, 0x26, 0xFF, 0x04, 0x07, 0x11, 0xFF, 0x05, 0x09, 0x14, 0xFF, 0x1E, 0x21, 0x2C, 0xFF, 0x53, 0x58, 0x6B, 0xFF, 0x3B,
+    0x40, 0x53, 0xFF, 0x78, 0x7E, 0x8F, 0xFF, 0x76, 0x7C, 0x8F, 0xFF, 0x2D, 0x30, 0x42, 0xFF, 0x26, 0x29, 0x3B, 0xFF, 0x27, 0x2A, 0x3D, 0xFF, 0x26,
+    0x2A, 0x3B, 0xFF, 0x25, 0x29, 0x39, 0xFF, 0x24, 0x28, 0x38, 0xFF, 0x24, 0x27, 0x38, 0xFF, 0x22, 0x28, 0x37, 0xFF, 0x80, 0x23, 0x28, 0x38, 0xFF,
+    0x10, 0x26, 0x2A, 0x3B, 0xFF, 0x28, 0x2B, 0x3A, 0xFF, 0x0C, 0x10, 0x18, 0xFF, 0x05, 0x05, 0x0D, 0xFF, 0x31, 0x35, 0x45, 0xFF, 0x4C, 0x52, 0x6A,
+    0xFF, 0x27, 0x2C, 0x40, 0xFF, 0x28, 0x2D, 0x3B, 0xFF, 0x54, 0x5B, 0x6E, 0xFF, 0x26, 0x2A, 0x36, 0xFF, 0x11, 0x15, 0x1F, 0xFF, 0x13, 0x16, 0x21,
+    0xFF, 0x13, 0x17, 0x21, 0xFF, 0x14, 0x17, 0x22, 0xFF, 0x15, 0x18, 0x23, 0xFF, 0x15, 0x18, 0x24, 0xFF, 0x14, 0x17, 0x22, 0xFF, 0x80, 0x13, 0x16,
+    0x21, 0xFF, 0x08, 0x13, 0x15, 0x20, 0xFF, 0x11, 0x13, 0x1F, 0xFF, 0x23, 0x26, 0x30, 0xFF, 0x2A, 0x2C, 0x36, 0xFF, 0x05, 0x06, 0x0F, 0xFF, 0x02,
+    0x04, 0x0D, 0xFF, 0x05, 0x06, 0x11, 0xFF, 0x06, 0x07, 0x13, 0xFF, 0x05, 0x08, 0x15, 0xFF, 0x80, 0x06, 0x09, 0x16, 0xFF, 0x1B, 0x07, 0x0A, 0x18,
+    0xFF, 0x07, 0x0B, 0x19, 0xFF, 0x09, 0x0B, 0x1A, 0xFF, 0x06, 0x06, 0x0E, 0xFF, 0x3B, 0x3A, 0x42, 0xFF, 0x8E, 0x94, 0xA2, 0xFF, 0x95, 0x9D, 0xAD,
+    0xFF, 0x7A, 0x7D, 0x90, 0xFF, 0x85, 0x88, 0x97, 0xFF, 0xC5, 0xCB, 0xD1, 0xFF, 0x95, 0x9B, 0xA3, 0xFF, 0x0D, 0x0F, 0x19, 0xFF, 0x0D, 0x12, 0x1A,
+    0xFF, 0x0E, 0x12, 0x19, 0xFF, 0x0A, 0x0D, 0x14, 0xFF, 0x0A, 0x0C, 0x13, 0xFF, 0x0A, 0x0D, 0x13, 0xFF, 0x0B, 0x0D, 0x13, 0xFF, 0x0A, 0x0C, 0x11,
+    0xFF, 0x09, 0x0C, 0x11, 0xFF, 0x09, 0x0B, 0x11, 0xFF, 0x09, 0x0B, 0x10, 0xFF, 0x09, 0x0A, 0x0F, 0xFF, 0x07, 0x09, 0x0D, 0xFF, 0x14, 0x19, 0x1D,
+    0xFF, 0x03, 0x04, 0x07, 0xFF, 0x02, 0x01, 0x05, 0xFF, 0x02, 0x02, 0x05, 0xFF, 0x01, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x81, 0x00,
+    0x00, 0x01, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x84, 0x00, 0x00, 0x01, 0xFF, 0x06, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x03, 0xFF, 0x00, 0x01,
+    0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x82, 0x01, 0x01, 0x05, 0xFF, 0x09, 0x00, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x05, 0xFF,
+    0x05, 0x08, 0x0D, 0xFF, 0x11, 0x15, 0x1D, 0xFF, 0x09, 0x0A, 0x11, 0xFF, 0x0A, 0x0A, 0x11, 0xFF, 0x0A, 0x0A, 0x12, 0xFF, 0x0B, 0x0C, 0x13, 0xFF,
+    0x0B, 0x0C, 0x15, 0xFF, 0x0B, 0x0D, 0x15, 0xFF, 0x80, 0x0C, 0x0D, 0x16, 0xFF, 0x2B, 0x0C, 0x0C, 0x16, 0xFF, 0x0B, 0x0C, 0x16, 0xFF, 0x07, 0x08,
+    0x0E, 0xFF, 0x59, 0x5B, 0x65, 0xFF, 0x74, 0x79, 0x85, 0xFF, 0x04, 0x0C, 0x19, 0xFF, 0x31, 0x37, 0x50, 0xFF, 0x4B, 0x4D, 0x68, 0xFF, 0x4C, 0x4C,
+    0x64, 0xFF, 0x14, 0x15, 0x1D, 0xFF, 0x04, 0x05, 0x0C, 0xFF, 0x04, 0x06, 0x0E, 0xFF, 0x17, 0x1B, 0x25, 0xFF, 0x26, 0x2A, 0x38, 0xFF, 0x16, 0x18,
+    0x25, 0xFF, 0x19, 0x1B, 0x2A, 0xFF, 0x18, 0x1A, 0x29, 0xFF, 0x19, 0x1B, 0x29, 0xFF, 0x19, 0x1C, 0x29, 0xFF, 0x1A, 0x1B, 0x29, 0xFF, 0x19, 0x1C,
+    0x29, 0xFF, 0x19, 0x1C, 0x2A, 0xFF, 0x1A, 0x1D, 0x2A, 0xFF, 0x19, 0x1C, 0x29, 0xFF, 0x16, 0x18, 0x25, 0xFF, 0x39, 0x3D, 0x4E, 0xFF, 0x63, 0x6B,
+    0x80, 0xFF, 0x19, 0x1F, 0x34, 0xFF, 0x3F, 0x41, 0x5B, 0xFF, 0x3E, 0x3F, 0x57, 0xFF, 0x0E, 0x12, 0x1D, 0xFF, 0x05, 0x08, 0x15, 0xFF, 0x06, 0x09,
+    0x16, 0xFF, 0x07, 0x08, 0x16, 0xFF, 0x07, 0x09, 0x16, 0xFF, 0x08, 0x0A, 0x17, 0xFF, 0x06, 0x08, 0x11, 0xFF, 0x22, 0x23, 0x35, 0xFF, 0x24, 0x26,
+    0x36, 0xFF, 0x22, 0x25, 0x35, 0xFF, 0x25, 0x28, 0x39, 0xFF, 0x26, 0x29, 0x3A, 0xFF, 0x25, 0x29, 0x39, 0xFF, 0x23, 0x27, 0x38, 0xFF, 0x81, 0x23,
+    0x26, 0x37, 0xFF, 0x0E, 0x23, 0x27, 0x38, 0xFF, 0x24, 0x29, 0x39, 0xFF, 0x25, 0x29, 0x39, 0xFF, 0x26, 0x29, 0x3A, 0xFF, 0x27, 0x2B, 0x3C, 0xFF,
+    0x27, 0x2C, 0x3E, 0xFF, 0x28, 0x2D, 0x3E, 0xFF, 0x28, 0x2D, 0x3F, 0xFF, 0x29, 0x2C, 0x41, 0xFF, 0x29, 0x2D, 0x3F, 0xFF, 0x40, 0x44, 0x59, 0xFF,
+    0x24, 0x27, 0x3A, 0xFF, 0x27, 0x2A, 0x3D, 0xFF, 0x24, 0x25, 0x38, 0xFF, 0x04, 0x06, 0x10, 0xFF, 0x80, 0x06, 0x08, 0x12, 0xFF, 0x7F, 0x05, 0x06,
+    0x11, 0xFF, 0x04, 0x07, 0x11, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x0B, 0x0C, 0x14, 0xFF, 0x38, 0x39, 0x4B, 0xFF, 0x35, 0x38, 0x4B, 0xFF, 0x31, 0x35,
+    0x48, 0xFF, 0x31, 0x35, 0x49, 0xFF, 0x32, 0x35, 0x48, 0xFF, 0x30, 0x34, 0x48, 0xFF, 0x2F, 0x34, 0x46, 0xFF, 0x30, 0x33, 0x47, 0xFF, 0x2F, 0x33,
+    0x46, 0xFF, 0x30, 0x35, 0x48, 0xFF, 0x31, 0x36, 0x4A, 0xFF, 0x2F, 0x34, 0x48, 0xFF, 0x31, 0x36, 0x49, 0xFF, 0x6F, 0x73, 0x88, 0xFF, 0x66, 0x6B,
+    0x82, 0xFF, 0x35, 0x38, 0x4B, 0xFF, 0x03, 0x04, 0x09, 0xFF, 0x07, 0x0A, 0x15, 0xFF, 0x04, 0x06, 0x10, 0xFF, 0x03, 0x05, 0x0B, 0xFF, 0x33, 0x37,
+    0x47, 0xFF, 0x2D, 0x32, 0x42, 0xFF, 0x32, 0x36, 0x49, 0xFF, 0x34, 0x38, 0x4B, 0xFF, 0x33, 0x38, 0x4B, 0xFF, 0x34, 0x39, 0x4B, 0xFF, 0x36, 0x3A,
+    0x4D, 0xFF, 0x37, 0x3B, 0x4E, 0xFF, 0x37, 0x3C, 0x4F, 0xFF, 0x36, 0x3B, 0x4E, 0xFF, 0x36, 0x3B, 0x4D, 0xFF, 0x34, 0x37, 0x4A, 0xFF, 0x2D, 0x30,
+    0x43, 0xFF, 0x9A, 0x9D, 0xA6, 0xFF, 0x8E, 0x8F, 0x98, 0xFF, 0x15, 0x17, 0x20, 0xFF, 0x06, 0x0A, 0x14, 0xFF, 0x0C, 0x11, 0x20, 0xFF, 0x0C, 0x11,
+    0x22, 0xFF, 0x09, 0x0F, 0x1F, 0xFF, 0x08, 0x0E, 0x1C, 0xFF, 0x08, 0x0D, 0x1C, 0xFF, 0x08, 0x0D, 0x1B, 0xFF, 0x09, 0x0E, 0x1B, 0xFF, 0x09, 0x0D,
+    0x1C, 0xFF, 0x09, 0x0D, 0x1B, 0xFF, 0x0A, 0x0D, 0x1D, 0xFF, 0x09, 0x0D, 0x1E, 0xFF, 0x09, 0x0C, 0x1B, 0xFF, 0x06, 0x08, 0x13, 0xFF, 0x1D, 0x1F,
+    0x24, 0xFF, 0x75, 0x78, 0x84, 0xFF, 0x7E, 0x84, 0x91, 0xFF, 0x3D, 0x41, 0x50, 0xFF, 0x4D, 0x51, 0x64, 0xFF, 0x62, 0x67, 0x76, 0xFF, 0x7F, 0x82,
+    0x93, 0xFF, 0x8A, 0x8E, 0x9F, 0xFF, 0x88, 0x8A, 0x9A, 0xFF, 0x7F, 0x81, 0x8F, 0xFF, 0x7D, 0x7F, 0x8C, 0xFF, 0x5C, 0x5D, 0x6B, 0xFF, 0x2F, 0x30,
+    0x3B, 0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x08, 0x0A, 0x16, 0xFF, 0x09, 0x0B, 0x19, 0xFF, 0x0A, 0x0C, 0x1B, 0xFF, 0x06, 0x09, 0x15, 0xFF, 0x08, 0x0A,
+    0x16, 0xFF, 0x30, 0x36, 0x48, 0xFF, 0x55, 0x5C, 0x71, 0xFF, 0x25, 0x2B, 0x37, 0xFF, 0x30, 0x34, 0x46, 0xFF, 0x2F, 0x35, 0x45, 0xFF, 0x30, 0x36,
+    0x45, 0xFF, 0x33, 0x37, 0x49, 0xFF, 0x34, 0x39, 0x4A, 0xFF, 0x33, 0x38, 0x49, 0xFF, 0x31, 0x37, 0x48, 0xFF, 0x33, 0x37, 0x49, 0xFF, 0x35, 0x3A,
+    0x4B, 0xFF, 0x36, 0x3C, 0x4E, 0xFF, 0x35, 0x3A, 0x4C, 0xFF, 0x32, 0x36, 0x47, 0xFF, 0x6E, 0x73, 0x85, 0xFF, 0x69, 0x6D, 0x7E, 0xFF, 0x26, 0x27,
+    0x30, 0xFF, 0x04, 0x04, 0x0B, 0xFF, 0x06, 0x06, 0x10, 0xFF, 0x06, 0x06, 0x13, 0xFF, 0x06, 0x07, 0x14, 0xFF, 0x06, 0x07, 0x15, 0xFF, 0x06, 0x08,
+    0x15, 0xFF, 0x07, 0x09, 0x17, 0xFF, 0x08, 0x0B, 0x1A, 0xFF, 0x0A, 0x0E, 0x1E, 0xFF, 0x0C, 0x0F, 0x20, 0xFF, 0x07, 0x0B, 0x16, 0xFF, 0x26, 0x28,
+    0x35, 0xFF, 0x88, 0x8C, 0x9B, 0xFF, 0xB6, 0xBC, 0xC5, 0xFF, 0xA7, 0xAE, 0xB7, 0xFF, 0x4A, 0x4F, 0x62, 0xFF, 0x2F, 0x35, 0x48, 0xFF, 0x34, 0x3A,
+    0x4C, 0xFF, 0x34, 0x39, 0x4D, 0xFF, 0x31, 0x38, 0x4A, 0xFF, 0x30, 0x36, 0x48, 0xFF, 0x2F, 0x34, 0x46, 0xFF, 0x2E, 0x34, 0x45, 0xFF, 0x2D, 0x33,
+    0x44, 0xFF, 0x2D, 0x31, 0x44, 0xFF, 0x2C, 0x31, 0x44, 0xFF, 0x2A, 0x30, 0x42, 0xFF, 0x2A, 0x2F, 0x41, 0xFF, 0x29, 0x2C, 0x3F, 0xFF, 0x38, 0x3B,
+    0x4E, 0xFF, 0x15, 0x17, 0x22, 0xFF, 0x03, 0x05, 0x0E, 0xFF, 0x04, 0x07, 0x10, 0xFF, 0x1C, 0x1E, 0x29, 0xFF, 0x50, 0x54, 0x68, 0xFF, 0x3A, 0x3F,
+    0x52, 0xFF, 0x79, 0x7E, 0x8F, 0xFF, 0x04, 0x78, 0x7D, 0x8F, 0xFF, 0x2E, 0x31, 0x43, 0xFF, 0x28, 0x2A, 0x3B, 0xFF, 0x26, 0x28, 0x39, 0xFF, 0x24,
+    0x29, 0x38, 0xFF, 0x80, 0x24, 0x28, 0x38, 0xFF, 0x10, 0x23, 0x27, 0x38, 0xFF, 0x22, 0x27, 0x38, 0xFF, 0x22, 0x26, 0x36, 0xFF, 0x21, 0x25, 0x35,
+    0xFF, 0x23, 0x28, 0x38, 0xFF, 0x25, 0x28, 0x37, 0xFF, 0x0B, 0x0F, 0x16, 0xFF, 0x03, 0x03, 0x0A, 0xFF, 0x1B, 0x1E, 0x28, 0xFF, 0x48, 0x4D, 0x63,
+    0xFF, 0x2A, 0x2F, 0x43, 0xFF, 0x1B, 0x1F, 0x2E, 0xFF, 0x4B, 0x51, 0x65, 0xFF, 0x2D, 0x32, 0x3F, 0xFF, 0x0E, 0x12, 0x1B, 0xFF, 0x13, 0x15, 0x20,
+    0xFF, 0x13, 0x16, 0x20, 0xFF, 0x80, 0x14, 0x17, 0x22, 0xFF, 0x20, 0x13, 0x17, 0x21, 0xFF, 0x13, 0x16, 0x21, 0xFF, 0x12, 0x14, 0x21, 0xFF, 0x12,
+    0x14, 0x20, 0xFF, 0x11, 0x14, 0x1F, 0xFF, 0x11, 0x13, 0x1D, 0xFF, 0x10, 0x12, 0x1A, 0xFF, 0x29, 0x2C, 0x36, 0xFF, 0x32, 0x34, 0x3D, 0xFF, 0x0F,
+    0x0F, 0x18, 0xFF, 0x02, 0x02, 0x0A, 0xFF, 0x04, 0x05, 0x11, 0xFF, 0x06, 0x07, 0x16, 0xFF, 0x06, 0x09, 0x18, 0xFF, 0x07, 0x0A, 0x19, 0xFF, 0x09,
+    0x0D, 0x1D, 0xFF, 0x0B, 0x0D, 0x1D, 0xFF, 0x0A, 0x09, 0x14, 0xFF, 0x31, 0x30, 0x36, 0xFF, 0x8B, 0x90, 0x9C, 0xFF, 0xA6, 0xAE, 0xBC, 0xFF, 0x8A,
+    0x91, 0xA1, 0xFF, 0x88, 0x8D, 0x9C, 0xFF, 0xC1, 0xC7, 0xCF, 0xFF, 0xAA, 0xB1, 0xB9, 0xFF, 0x3A, 0x3D, 0x46, 0xFF, 0x06, 0x08, 0x0E, 0xFF, 0x0E,
+    0x10, 0x19, 0xFF, 0x0C, 0x0E, 0x17, 0xFF, 0x0A, 0x0D, 0x13, 0xFF, 0x0B, 0x0C, 0x13, 0xFF, 0x0B, 0x0D, 0x13, 0xFF, 0x0A, 0x0C, 0x12, 0xFF, 0x80,
+    0x09, 0x0A, 0x10, 0xFF, 0x07, 0x08, 0x09, 0x0F, 0xFF, 0x08, 0x0A, 0x0F, 0xFF, 0x09, 0x0A, 0x0F, 0xFF, 0x07, 0x08, 0x0D, 0xFF, 0x14, 0x19, 0x1D,
+    0xFF, 0x03, 0x03, 0x07, 0xFF, 0x02, 0x01, 0x05, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x0B, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00,
+    0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x83, 0x00, 0x00, 0x01, 0xFF, 0x0E, 0x00, 0x01, 0x02, 0xFF,
+    0x00, 0x02, 0x03, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF,
+    0x01, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x05, 0x07, 0x0C, 0xFF,
+    0x11, 0x14, 0x1C, 0xFF, 0x0A, 0x0B, 0x11, 0xFF, 0x80, 0x0B, 0x0B, 0x12, 0xFF, 0x01, 0x0B, 0x0B, 0x13, 0xFF, 0x0B, 0x0C, 0x14, 0xFF, 0x80, 0x0B,
+    0x0D, 0x15, 0xFF, 0x80, 0x0C, 0x0D, 0x16, 0xFF, 0x1E, 0x0B, 0x0E, 0x16, 0xFF, 0x07, 0x08, 0x0E, 0xFF, 0x58, 0x5A, 0x63, 0xFF, 0x72, 0x78, 0x84,
+    0xFF, 0x04, 0x0B, 0x19, 0xFF, 0x31, 0x37, 0x4F, 0xFF, 0x49, 0x4B, 0x67, 0xFF, 0x4A, 0x4B, 0x63, 0xFF, 0x13, 0x15, 0x1D, 0xFF, 0x04, 0x06, 0x0C,
+    0xFF, 0x03, 0x05, 0x0E, 0xFF, 0x16, 0x1B, 0x24, 0xFF, 0x25, 0x29, 0x36, 0xFF, 0x15, 0x17, 0x24, 0xFF, 0x18, 0x1A, 0x28, 0xFF, 0x18, 0x1A, 0x29,
+    0xFF, 0x18, 0x1A, 0x28, 0xFF, 0x18, 0x1A, 0x29, 0xFF, 0x18, 0x1B, 0x28, 0xFF, 0x19, 0x1B, 0x27, 0xFF, 0x19, 0x1B, 0x29, 0xFF, 0x18, 0x1C, 0x28,
+    0xFF, 0x18, 0x1A, 0x28, 0xFF, 0x16, 0x18, 0x26, 0xFF, 0x39, 0x3E, 0x4E, 0xFF, 0x62, 0x6A, 0x7E, 0xFF, 0x19, 0x1F, 0x33, 0xFF, 0x3E, 0x41, 0x5A,
+    0xFF, 0x3D, 0x3E, 0x55, 0xFF, 0x0D, 0x10, 0x1C, 0xFF, 0x06, 0x07, 0x13, 0xFF, 0x80, 0x06, 0x08, 0x15, 0xFF, 0x0B, 0x07, 0x09, 0x16, 0xFF, 0x07,
+    0x09, 0x14, 0xFF, 0x06, 0x08, 0x11, 0xFF, 0x16, 0x18, 0x27, 0xFF, 0x23, 0x26, 0x35, 0xFF, 0x20, 0x22, 0x32, 0xFF, 0x22, 0x25, 0x34, 0xFF, 0x22,
+    0x25, 0x35, 0xFF, 0x21, 0x25, 0x35, 0xFF, 0x22, 0x25, 0x35, 0xFF, 0x21, 0x24, 0x34, 0xFF, 0x20, 0x24, 0x33, 0xFF, 0x80, 0x21, 0x25, 0x35, 0xFF,
+    0x19, 0x22, 0x25, 0x35, 0xFF, 0x22, 0x26, 0x36, 0xFF, 0x24, 0x27, 0x38, 0xFF, 0x25, 0x29, 0x3A, 0xFF, 0x26, 0x2A, 0x3B, 0xFF, 0x26, 0x2A, 0x3C,
+    0xFF, 0x27, 0x2A, 0x3D, 0xFF, 0x21, 0x26, 0x36, 0xFF, 0x39, 0x3C, 0x53, 0xFF, 0x37, 0x3B, 0x4E, 0xFF, 0x21, 0x23, 0x36, 0xFF, 0x2F, 0x2F, 0x45,
+    0xFF, 0x0B, 0x0E, 0x19, 0xFF, 0x07, 0x08, 0x15, 0xFF, 0x06, 0x08, 0x13, 0xFF, 0x06, 0x08, 0x12, 0xFF, 0x04, 0x07, 0x11, 0xFF, 0x04, 0x06, 0x11,
+    0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x0B, 0x0C, 0x14, 0xFF, 0x37, 0x38, 0x49, 0xFF, 0x34, 0x36, 0x49, 0xFF, 0x2F, 0x34, 0x47, 0xFF, 0x30, 0x35, 0x48,
+    0xFF, 0x2F, 0x33, 0x46, 0xFF, 0x2F, 0x32, 0x45, 0xFF, 0x80, 0x2D, 0x32, 0x45, 0xFF, 0x00, 0x2E, 0x32, 0x45, 0xFF, 0x80, 0x2E, 0x33, 0x46, 0xFF,
+    0x0C, 0x2E, 0x33, 0x45, 0xFF, 0x30, 0x35, 0x47, 0xFF, 0x6D, 0x72, 0x87, 0xFF, 0x64, 0x68, 0x80, 0xFF, 0x32, 0x35, 0x47, 0xFF, 0x02, 0x03, 0x09,
+    0xFF, 0x07, 0x09, 0x14, 0xFF, 0x05, 0x08, 0x13, 0xFF, 0x03, 0x05, 0x0E, 0xFF, 0x1C, 0x1E, 0x29, 0xFF, 0x30, 0x34, 0x45, 0xFF, 0x31, 0x35, 0x48,
+    0xFF, 0x31, 0x36, 0x48, 0xFF, 0x80, 0x32, 0x36, 0x48, 0xFF, 0x02, 0x32, 0x36, 0x49, 0xFF, 0x33, 0x37, 0x4B, 0xFF, 0x34, 0x38, 0x4B, 0xFF, 0x80,
+    0x33, 0x39, 0x4B, 0xFF, 0x09, 0x34, 0x39, 0x4B, 0xFF, 0x2D, 0x31, 0x42, 0xFF, 0x50, 0x53, 0x61, 0xFF, 0x95, 0x98, 0xA4, 0xFF, 0x93, 0x96, 0x9E,
+    0xFF, 0x31, 0x32, 0x3C, 0xFF, 0x06, 0x09, 0x15, 0xFF, 0x09, 0x0E, 0x1A, 0xFF, 0x08, 0x0E, 0x1C, 0xFF, 0x08, 0x0C, 0x1B, 0xFF, 0x80, 0x08, 0x0C,
+    0x1A, 0xFF, 0x21, 0x09, 0x0D, 0x1B, 0xFF, 0x09, 0x0D, 0x1D, 0xFF, 0x0A, 0x0F, 0x1E, 0xFF, 0x09, 0x0E, 0x1D, 0xFF, 0x08, 0x0D, 0x1B, 0xFF, 0x05,
+    0x07, 0x12, 0xFF, 0x39, 0x3A, 0x40, 0xFF, 0x80, 0x84, 0x8F, 0xFF, 0x7B, 0x80, 0x8E, 0xFF, 0x37, 0x3B, 0x4A, 0xFF, 0x31, 0x35, 0x48, 0xFF, 0x31,
+    0x34, 0x45, 0xFF, 0x2B, 0x2E, 0x3D, 0xFF, 0x29, 0x2C, 0x3C, 0xFF, 0x2D, 0x31, 0x42, 0xFF, 0x4F, 0x53, 0x62, 0xFF, 0x59, 0x5B, 0x6A, 0xFF, 0x67,
+    0x69, 0x7A, 0xFF, 0x7F, 0x80, 0x93, 0xFF, 0x85, 0x88, 0x9A, 0xFF, 0x66, 0x6B, 0x7A, 0xFF, 0x2D, 0x2E, 0x3B, 0xFF, 0x04, 0x06, 0x10, 0xFF, 0x09,
+    0x0A, 0x16, 0xFF, 0x08, 0x0A, 0x15, 0xFF, 0x03, 0x06, 0x0D, 0xFF, 0x1C, 0x20, 0x2D, 0xFF, 0x44, 0x4B, 0x5C, 0xFF, 0x37, 0x3C, 0x4F, 0xFF, 0x2B,
+    0x2F, 0x3E, 0xFF, 0x2E, 0x32, 0x43, 0xFF, 0x2E, 0x34, 0x43, 0xFF, 0x30, 0x35, 0x47, 0xFF, 0x32, 0x38, 0x49, 0xFF, 0x80, 0x32, 0x37, 0x49, 0xFF,
+    0x0E, 0x31, 0x35, 0x48, 0xFF, 0x33, 0x37, 0x49, 0xFF, 0x34, 0x38, 0x4B, 0xFF, 0x34, 0x39, 0x4B, 0xFF, 0x32, 0x36, 0x49, 0xFF, 0x30, 0x34, 0x46,
+    0xFF, 0x70, 0x76, 0x89, 0xFF, 0x78, 0x7D, 0x8E, 0xFF, 0x39, 0x3B, 0x47, 0xFF, 0x0B, 0x0A, 0x13, 0xFF, 0x04, 0x04, 0x0D, 0xFF, 0x07, 0x07, 0x13,
+    0xFF, 0x06, 0x07, 0x12, 0xFF, 0x08, 0x09, 0x14, 0xFF, 0x07, 0x07, 0x13, 0xFF, 0x80, 0x06, 0x07, 0x12, 0xFF, 0x34, 0x05, 0x06, 0x0F, 0xFF, 0x3F,
+    0x41, 0x4E, 0xFF, 0x91, 0x95, 0xA2, 0xFF, 0xC2, 0xC5, 0xCE, 0xFF, 0xA7, 0xAD, 0xB8, 0xFF, 0x56, 0x5D, 0x70, 0xFF, 0x30, 0x35, 0x49, 0xFF, 0x34,
+    0x39, 0x4C, 0xFF, 0x33, 0x38, 0x4B, 0xFF, 0x30, 0x36, 0x49, 0xFF, 0x2F, 0x35, 0x47, 0xFF, 0x2E, 0x33, 0x45, 0xFF, 0x2C, 0x32, 0x44, 0xFF, 0x2C,
+    0x31, 0x43, 0xFF, 0x2B, 0x2F, 0x43, 0xFF, 0x2A, 0x2F, 0x41, 0xFF, 0x29, 0x2F, 0x40, 0xFF, 0x28, 0x2E, 0x40, 0xFF, 0x29, 0x2E, 0x40, 0xFF, 0x27,
+    0x2B, 0x3D, 0xFF, 0x36, 0x37, 0x4A, 0xFF, 0x13, 0x15, 0x1F, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x1B, 0x1D, 0x27, 0xFF, 0x4E,
+    0x53, 0x67, 0xFF, 0x39, 0x3E, 0x52, 0xFF, 0x78, 0x7F, 0x8E, 0xFF, 0x78, 0x7D, 0x8F, 0xFF, 0x2F, 0x32, 0x44, 0xFF, 0x28, 0x2A, 0x3B, 0xFF, 0x25,
+    0x28, 0x39, 0xFF, 0x24, 0x27, 0x37, 0xFF, 0x22, 0x25, 0x36, 0xFF, 0x21, 0x25, 0x35, 0xFF, 0x21, 0x26, 0x35, 0xFF, 0x20, 0x25, 0x35, 0xFF, 0x20,
+    0x24, 0x33, 0xFF, 0x1F, 0x23, 0x32, 0xFF, 0x21, 0x26, 0x35, 0xFF, 0x23, 0x27, 0x35, 0xFF, 0x0A, 0x0E, 0x16, 0xFF, 0x03, 0x03, 0x09, 0xFF, 0x06,
+    0x07, 0x0E, 0xFF, 0x39, 0x3D, 0x52, 0xFF, 0x36, 0x3B, 0x53, 0xFF, 0x1F, 0x22, 0x32, 0xFF, 0x35, 0x39, 0x4A, 0xFF, 0x35, 0x3B, 0x4C, 0xFF, 0x15,
+    0x18, 0x24, 0xFF, 0x11, 0x14, 0x1D, 0xFF, 0x12, 0x15, 0x1F, 0xFF, 0x14, 0x15, 0x21, 0xFF, 0x80, 0x13, 0x16, 0x21, 0xFF, 0x1B, 0x13, 0x15, 0x20,
+    0xFF, 0x13, 0x15, 0x1F, 0xFF, 0x11, 0x14, 0x1E, 0xFF, 0x10, 0x13, 0x1C, 0xFF, 0x10, 0x12, 0x1B, 0xFF, 0x0D, 0x0F, 0x18, 0xFF, 0x11, 0x12, 0x1A,
+    0xFF, 0x33, 0x36, 0x3F, 0xFF, 0x36, 0x38, 0x41, 0xFF, 0x0E, 0x0E, 0x17, 0xFF, 0x03, 0x04, 0x0D, 0xFF, 0x04, 0x05, 0x11, 0xFF, 0x06, 0x07, 0x14,
+    0xFF, 0x07, 0x09, 0x17, 0xFF, 0x09, 0x0A, 0x16, 0xFF, 0x0F, 0x0E, 0x15, 0xFF, 0x43, 0x44, 0x4C, 0xFF, 0x8F, 0x95, 0xA0, 0xFF, 0xA4, 0xAC, 0xBA,
+    0xFF, 0x90, 0x97, 0xA7, 0xFF, 0x98, 0x9E, 0xAA, 0xFF, 0xC2, 0xC9, 0xD0, 0xFF, 0xA5, 0xAD, 0xB8, 0xFF, 0x3A, 0x3F, 0x4C, 0xFF, 0x05, 0x06, 0x0A,
+    0xFF, 0x0C, 0x0D, 0x15, 0xFF, 0x0B, 0x0E, 0x16, 0xFF, 0x0A, 0x0E, 0x15, 0xFF, 0x80, 0x0B, 0x0D, 0x15, 0xFF, 0x0B, 0x0A, 0x0D, 0x13, 0xFF, 0x0A,
+    0x0C, 0x11, 0xFF, 0x0A, 0x0B, 0x10, 0xFF, 0x08, 0x0A, 0x0F, 0xFF, 0x08, 0x0A, 0x10, 0xFF, 0x09, 0x0B, 0x10, 0xFF, 0x0A, 0x0B, 0x0F, 0xFF, 0x07,
+    0x09, 0x0D, 0xFF, 0x14, 0x19, 0x1C, 0xFF, 0x03, 0x03, 0x06, 0xFF, 0x02, 0x01, 0x04, 0xFF, 0x02, 0x02, 0x05, 0xFF, 0x01, 0x01, 0x00, 0x00, 0xFF,
+    0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x03, 0x01, 0x00, 0x02, 0xFF,
+    0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x2D, 0x01, 0x00, 0x02, 0xFF, 0x00, 0x00,
+    0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x03, 0xFF, 0x00, 0x01,
+    0x03, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x00, 0x06, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01,
+    0x05, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x05, 0x07, 0x0C, 0xFF, 0x10, 0x14, 0x1B, 0xFF, 0x09, 0x0A, 0x10, 0xFF, 0x0B, 0x0B,
+    0x12, 0xFF, 0x0A, 0x0C, 0x12, 0xFF, 0x0B, 0x0B, 0x13, 0xFF, 0x0B, 0x0B, 0x14, 0xFF, 0x0A, 0x0C, 0x14, 0xFF, 0x0B, 0x0D, 0x15, 0xFF, 0x0B, 0x0C,
+    0x15, 0xFF, 0x0B, 0x0D, 0x15, 0xFF, 0x0B, 0x0D, 0x16, 0xFF, 0x07, 0x08, 0x0E, 0xFF, 0x59, 0x5A, 0x64, 0xFF, 0x74, 0x79, 0x84, 0xFF, 0x03, 0x0B,
+    0x19, 0xFF, 0x30, 0x35, 0x4E, 0xFF, 0x48, 0x4A, 0x64, 0xFF, 0x49, 0x49, 0x62, 0xFF, 0x12, 0x14, 0x1D, 0xFF, 0x04, 0x05, 0x0C, 0xFF, 0x03, 0x05,
+    0x0D, 0xFF, 0x15, 0x1A, 0x23, 0xFF, 0x23, 0x27, 0x34, 0xFF, 0x15, 0x16, 0x23, 0xFF, 0x17, 0x19, 0x27, 0xFF, 0x17, 0x1A, 0x27, 0xFF, 0x17, 0x19,
+    0x26, 0xFF, 0x16, 0x19, 0x25, 0xFF, 0x17, 0x19, 0x26, 0xFF, 0x80, 0x18, 0x1A, 0x26, 0xFF, 0x0A, 0x18, 0x19, 0x26, 0xFF, 0x17, 0x19, 0x27, 0xFF,
+    0x16, 0x17, 0x24, 0xFF, 0x39, 0x3F, 0x4F, 0xFF, 0x61, 0x6A, 0x7E, 0xFF, 0x19, 0x1E, 0x33, 0xFF, 0x3F, 0x40, 0x59, 0xFF, 0x3C, 0x3C, 0x54, 0xFF,
+    0x0D, 0x0F, 0x1B, 0xFF, 0x05, 0x07, 0x13, 0xFF, 0x05, 0x08, 0x14, 0xFF, 0x80, 0x06, 0x08, 0x14, 0xFF, 0x05, 0x07, 0x07, 0x13, 0xFF, 0x06, 0x07,
+    0x10, 0xFF, 0x04, 0x06, 0x0C, 0xFF, 0x24, 0x26, 0x39, 0xFF, 0x1E, 0x22, 0x31, 0xFF, 0x21, 0x24, 0x34, 0xFF, 0x82, 0x1F, 0x23, 0x32, 0xFF, 0x01,
+    0x20, 0x23, 0x34, 0xFF, 0x21, 0x24, 0x34, 0xFF, 0x80, 0x20, 0x23, 0x34, 0xFF, 0x0A, 0x21, 0x23, 0x35, 0xFF, 0x22, 0x26, 0x37, 0xFF, 0x23, 0x27,
+    0x38, 0xFF, 0x23, 0x27, 0x37, 0xFF, 0x23, 0x27, 0x38, 0xFF, 0x25, 0x27, 0x3A, 0xFF, 0x20, 0x23, 0x34, 0xFF, 0x39, 0x3E, 0x52, 0xFF, 0x2D, 0x31,
+    0x45, 0xFF, 0x23, 0x27, 0x38, 0xFF, 0x25, 0x26, 0x3A, 0xFF, 0x80, 0x06, 0x08, 0x12, 0xFF, 0x00, 0x05, 0x07, 0x12, 0xFF, 0x80, 0x05, 0x07, 0x11,
+    0xFF, 0x08, 0x04, 0x07, 0x12, 0xFF, 0x03, 0x05, 0x0E, 0xFF, 0x0B, 0x0D, 0x15, 0xFF, 0x36, 0x37, 0x48, 0xFF, 0x32, 0x34, 0x46, 0xFF, 0x2E, 0x31,
+    0x44, 0xFF, 0x2D, 0x31, 0x44, 0xFF, 0x2C, 0x30, 0x42, 0xFF, 0x2B, 0x30, 0x42, 0xFF, 0x81, 0x2D, 0x31, 0x43, 0xFF, 0x10, 0x2C, 0x30, 0x43, 0xFF,
+    0x2D, 0x31, 0x44, 0xFF, 0x2C, 0x31, 0x43, 0xFF, 0x2F, 0x34, 0x45, 0xFF, 0x6D, 0x72, 0x86, 0xFF, 0x63, 0x68, 0x7F, 0xFF, 0x32, 0x34, 0x45, 0xFF,
+    0x02, 0x02, 0x07, 0xFF, 0x07, 0x09, 0x13, 0xFF, 0x06, 0x09, 0x13, 0xFF, 0x05, 0x06, 0x11, 0xFF, 0x09, 0x0C, 0x15, 0xFF, 0x33, 0x36, 0x49, 0xFF,
+    0x2E, 0x32, 0x43, 0xFF, 0x2F, 0x34, 0x45, 0xFF, 0x31, 0x35, 0x47, 0xFF, 0x30, 0x34, 0x45, 0xFF, 0x80, 0x2F, 0x33, 0x45, 0xFF, 0x18, 0x30, 0x34,
+    0x45, 0xFF, 0x30, 0x35, 0x46, 0xFF, 0x30, 0x33, 0x46, 0xFF, 0x30, 0x34, 0x46, 0xFF, 0x32, 0x36, 0x48, 0xFF, 0x2D, 0x31, 0x42, 0xFF, 0x38, 0x3D,
+    0x4F, 0xFF, 0x8C, 0x91, 0x9D, 0xFF, 0xA3, 0xA6, 0xAF, 0xFF, 0x67, 0x67, 0x70, 0xFF, 0x1C, 0x1D, 0x26, 0xFF, 0x0B, 0x0B, 0x15, 0xFF, 0x05, 0x07,
+    0x12, 0xFF, 0x04, 0x06, 0x10, 0xFF, 0x06, 0x08, 0x12, 0xFF, 0x07, 0x0A, 0x15, 0xFF, 0x07, 0x0B, 0x16, 0xFF, 0x07, 0x0B, 0x17, 0xFF, 0x0F, 0x10,
+    0x19, 0xFF, 0x1F, 0x1F, 0x26, 0xFF, 0x5F, 0x62, 0x69, 0xFF, 0x8E, 0x91, 0x9C, 0xFF, 0x82, 0x86, 0x92, 0xFF, 0x3A, 0x3E, 0x4E, 0xFF, 0x2A, 0x2F,
+    0x3F, 0xFF, 0x80, 0x31, 0x34, 0x45, 0xFF, 0x15, 0x30, 0x33, 0x43, 0xFF, 0x31, 0x34, 0x45, 0xFF, 0x2E, 0x32, 0x43, 0xFF, 0x2C, 0x30, 0x42, 0xFF,
+    0x25, 0x2A, 0x39, 0xFF, 0x27, 0x29, 0x38, 0xFF, 0x4B, 0x4E, 0x59, 0xFF, 0x5C, 0x60, 0x6D, 0xFF, 0x6B, 0x73, 0x81, 0xFF, 0x1C, 0x1E, 0x2A, 0xFF,
+    0x03, 0x06, 0x0D, 0xFF, 0x05, 0x07, 0x11, 0xFF, 0x06, 0x09, 0x13, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x08, 0x0B, 0x14, 0xFF, 0x33, 0x38, 0x4A, 0xFF,
+    0x44, 0x4A, 0x60, 0xFF, 0x25, 0x29, 0x37, 0xFF, 0x2D, 0x32, 0x43, 0xFF, 0x2F, 0x33, 0x44, 0xFF, 0x2F, 0x34, 0x45, 0xFF, 0x30, 0x35, 0x46, 0xFF,
+    0x80, 0x31, 0x36, 0x47, 0xFF, 0x21, 0x2F, 0x34, 0x44, 0xFF, 0x2F, 0x33, 0x44, 0xFF, 0x2F, 0x33, 0x45, 0xFF, 0x30, 0x35, 0x46, 0xFF, 0x32, 0x36,
+    0x47, 0xFF, 0x2D, 0x31, 0x42, 0xFF, 0x23, 0x27, 0x34, 0xFF, 0x5C, 0x61, 0x71, 0xFF, 0x83, 0x89, 0x9B, 0xFF, 0x7D, 0x82, 0x90, 0xFF, 0x42, 0x43,
+    0x52, 0xFF, 0x26, 0x25, 0x30, 0xFF, 0x0D, 0x0E, 0x16, 0xFF, 0x0B, 0x0A, 0x11, 0xFF, 0x0F, 0x0F, 0x15, 0xFF, 0x23, 0x24, 0x2E, 0xFF, 0x4F, 0x51,
+    0x5E, 0xFF, 0x7A, 0x7E, 0x8E, 0xFF, 0xAF, 0xB4, 0xBE, 0xFF, 0xC0, 0xC6, 0xCE, 0xFF, 0x8F, 0x94, 0xA1, 0xFF, 0x3E, 0x42, 0x53, 0xFF, 0x35, 0x3B,
+    0x4E, 0xFF, 0x36, 0x3B, 0x4E, 0xFF, 0x32, 0x36, 0x49, 0xFF, 0x30, 0x35, 0x47, 0xFF, 0x2D, 0x32, 0x45, 0xFF, 0x2C, 0x31, 0x44, 0xFF, 0x2C, 0x31,
+    0x42, 0xFF, 0x2C, 0x31, 0x43, 0xFF, 0x2A, 0x2F, 0x40, 0xFF, 0x27, 0x2E, 0x3E, 0xFF, 0x27, 0x2C, 0x3F, 0xFF, 0x28, 0x2B, 0x3E, 0xFF, 0x80, 0x28,
+    0x2D, 0x3E, 0xFF, 0x20, 0x27, 0x2A, 0x3B, 0xFF, 0x34, 0x36, 0x48, 0xFF, 0x13, 0x15, 0x1F, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x03, 0x04, 0x09, 0xFF,
+    0x19, 0x1C, 0x26, 0xFF, 0x4C, 0x51, 0x65, 0xFF, 0x38, 0x3C, 0x4F, 0xFF, 0x77, 0x7D, 0x8E, 0xFF, 0x75, 0x7B, 0x8C, 0xFF, 0x2E, 0x31, 0x42, 0xFF,
+    0x25, 0x29, 0x3A, 0xFF, 0x24, 0x27, 0x39, 0xFF, 0x24, 0x26, 0x36, 0xFF, 0x22, 0x25, 0x34, 0xFF, 0x20, 0x25, 0x34, 0xFF, 0x20, 0x23, 0x34, 0xFF,
+    0x1F, 0x22, 0x33, 0xFF, 0x1F, 0x23, 0x32, 0xFF, 0x1E, 0x21, 0x31, 0xFF, 0x1F, 0x24, 0x33, 0xFF, 0x22, 0x25, 0x34, 0xFF, 0x0A, 0x0E, 0x17, 0xFF,
+    0x03, 0x04, 0x0A, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x29, 0x2B, 0x3C, 0xFF, 0x3D, 0x42, 0x5A, 0xFF, 0x26, 0x2A, 0x3D, 0xFF, 0x1F, 0x23, 0x31, 0xFF,
+    0x42, 0x47, 0x5B, 0xFF, 0x1E, 0x21, 0x2C, 0xFF, 0x0E, 0x11, 0x19, 0xFF, 0x11, 0x14, 0x1E, 0xFF, 0x80, 0x12, 0x15, 0x1F, 0xFF, 0x21, 0x12, 0x15,
+    0x20, 0xFF, 0x12, 0x15, 0x1F, 0xFF, 0x12, 0x14, 0x1E, 0xFF, 0x10, 0x12, 0x1C, 0xFF, 0x10, 0x12, 0x1B, 0xFF, 0x0F, 0x11, 0x1B, 0xFF, 0x0F, 0x12,
+    0x1A, 0xFF, 0x0C, 0x0F, 0x16, 0xFF, 0x08, 0x09, 0x11, 0xFF, 0x2C, 0x2F, 0x36, 0xFF, 0x4F, 0x54, 0x60, 0xFF, 0x42, 0x46, 0x50, 0xFF, 0x17, 0x18,
+    0x1E, 0xFF, 0x16, 0x15, 0x1A, 0xFF, 0x15, 0x15, 0x1C, 0xFF, 0x3C, 0x3B, 0x44, 0xFF, 0x65, 0x68, 0x76, 0xFF, 0x9B, 0xA1, 0xB0, 0xFF, 0xAC, 0xB4,
+    0xC1, 0xFF, 0xA2, 0xA8, 0xB6, 0xFF, 0xB1, 0xB8, 0xC1, 0xFF, 0xBB, 0xC1, 0xC9, 0xFF, 0x81, 0x86, 0x8F, 0xFF, 0x33, 0x35, 0x3C, 0xFF, 0x05, 0x06,
+    0x0A, 0xFF, 0x0B, 0x0C, 0x14, 0xFF, 0x0B, 0x0D, 0x15, 0xFF, 0x0A, 0x0C, 0x14, 0xFF, 0x0A, 0x0C, 0x13, 0xFF, 0x0A, 0x0C, 0x14, 0xFF, 0x0B, 0x0C,
+    0x14, 0xFF, 0x0B, 0x0C, 0x12, 0xFF, 0x0A, 0x0C, 0x12, 0xFF, 0x09, 0x0B, 0x11, 0xFF, 0x80, 0x09, 0x0B, 0x10, 0xFF, 0x06, 0x08, 0x0B, 0x10, 0xFF,
+    0x09, 0x0A, 0x0F, 0xFF, 0x07, 0x0A, 0x0D, 0xFF, 0x15, 0x19, 0x1C, 0xFF, 0x03, 0x03, 0x06, 0xFF, 0x02, 0x02, 0x04, 0xFF, 0x02, 0x02, 0x06, 0xFF,
+    0x03, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x0B, 0x01,
+    0x00, 0x02, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x80,
+    0x00, 0x01, 0x03, 0xFF, 0x00, 0x01, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x02, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00,
+    0x00, 0x05, 0xFF, 0x80, 0x01, 0x01, 0x05, 0xFF, 0x03, 0x01, 0x01, 0x04, 0xFF, 0x04, 0x07, 0x0B, 0xFF, 0x0F, 0x13, 0x1A, 0xFF, 0x09, 0x0A, 0x0F,
+    0xFF, 0x80, 0x0A, 0x0B, 0x11, 0xFF, 0x0E, 0x0A, 0x0B, 0x12, 0xFF, 0x0A, 0x0B, 0x13, 0xFF, 0x0A, 0x0C, 0x13, 0xFF, 0x0A, 0x0C, 0x14, 0xFF, 0x0B,
+    0x0C, 0x14, 0xFF, 0x0B, 0x0C, 0x15, 0xFF, 0x0B, 0x0D, 0x15, 0xFF, 0x07, 0x08, 0x0E, 0xFF, 0x58, 0x5A, 0x65, 0xFF, 0x74, 0x77, 0x83, 0xFF, 0x04,
+    0x0C, 0x19, 0xFF, 0x2E, 0x35, 0x4D, 0xFF, 0x45, 0x48, 0x62, 0xFF, 0x47, 0x47, 0x60, 0xFF, 0x11, 0x14, 0x1C, 0xFF, 0x80, 0x03, 0x05, 0x0C, 0xFF,
+    0x02, 0x14, 0x19, 0x23, 0xFF, 0x22, 0x26, 0x33, 0xFF, 0x14, 0x15, 0x22, 0xFF, 0x81, 0x15, 0x17, 0x24, 0xFF, 0x0D, 0x15, 0x16, 0x22, 0xFF, 0x15,
+    0x17, 0x23, 0xFF, 0x15, 0x17, 0x25, 0xFF, 0x17, 0x18, 0x24, 0xFF, 0x17, 0x19, 0x25, 0xFF, 0x17, 0x19, 0x27, 0xFF, 0x16, 0x18, 0x25, 0xFF, 0x3A,
+    0x3F, 0x4F, 0xFF, 0x61, 0x6A, 0x7F, 0xFF, 0x1A, 0x20, 0x35, 0xFF, 0x3F, 0x41, 0x59, 0xFF, 0x3C, 0x3E, 0x54, 0xFF, 0x0C, 0x0F, 0x1B, 0xFF, 0x05,
+    0x07, 0x12, 0xFF, 0x80, 0x06, 0x07, 0x13, 0xFF, 0x06, 0x05, 0x07, 0x12, 0xFF, 0x06, 0x07, 0x11, 0xFF, 0x06, 0x07, 0x0F, 0xFF, 0x04, 0x04, 0x0E,
+    0xFF, 0x16, 0x19, 0x27, 0xFF, 0x1F, 0x23, 0x31, 0xFF, 0x20, 0x22, 0x32, 0xFF, 0x80, 0x20, 0x23, 0x32, 0xFF, 0x21, 0x1E, 0x22, 0x31, 0xFF, 0x1F,
+    0x22, 0x32, 0xFF, 0x22, 0x24, 0x34, 0xFF, 0x21, 0x24, 0x34, 0xFF, 0x20, 0x25, 0x34, 0xFF, 0x20, 0x24, 0x34, 0xFF, 0x21, 0x23, 0x35, 0xFF, 0x21,
+    0x25, 0x36, 0xFF, 0x22, 0x26, 0x35, 0xFF, 0x22, 0x25, 0x36, 0xFF, 0x21, 0x24, 0x35, 0xFF, 0x1F, 0x22, 0x32, 0xFF, 0x31, 0x32, 0x46, 0xFF, 0x31,
+    0x35, 0x47, 0xFF, 0x1F, 0x21, 0x33, 0xFF, 0x2E, 0x2F, 0x46, 0xFF, 0x0F, 0x12, 0x1F, 0xFF, 0x06, 0x08, 0x13, 0xFF, 0x05, 0x08, 0x12, 0xFF, 0x05,
+    0x07, 0x12, 0xFF, 0x05, 0x08, 0x11, 0xFF, 0x05, 0x07, 0x11, 0xFF, 0x04, 0x07, 0x11, 0xFF, 0x04, 0x06, 0x0E, 0xFF, 0x0C, 0x0D, 0x16, 0xFF, 0x36,
+    0x36, 0x47, 0xFF, 0x30, 0x32, 0x44, 0xFF, 0x2D, 0x2F, 0x41, 0xFF, 0x2A, 0x2D, 0x3F, 0xFF, 0x27, 0x2B, 0x3D, 0xFF, 0x29, 0x2C, 0x3F, 0xFF, 0x2C,
+    0x2F, 0x42, 0xFF, 0x2B, 0x30, 0x41, 0xFF, 0x2C, 0x2F, 0x42, 0xFF, 0x80, 0x2A, 0x2F, 0x41, 0xFF, 0x47, 0x29, 0x2E, 0x40, 0xFF, 0x2D, 0x31, 0x43,
+    0xFF, 0x6B, 0x6F, 0x84, 0xFF, 0x63, 0x68, 0x7E, 0xFF, 0x34, 0x36, 0x47, 0xFF, 0x01, 0x01, 0x06, 0xFF, 0x07, 0x08, 0x13, 0xFF, 0x07, 0x09, 0x13,
+    0xFF, 0x07, 0x08, 0x14, 0xFF, 0x08, 0x0A, 0x16, 0xFF, 0x1D, 0x21, 0x2D, 0xFF, 0x2E, 0x32, 0x42, 0xFF, 0x2E, 0x31, 0x42, 0xFF, 0x2F, 0x33, 0x44,
+    0xFF, 0x2D, 0x31, 0x42, 0xFF, 0x2B, 0x2F, 0x40, 0xFF, 0x29, 0x2E, 0x3E, 0xFF, 0x2B, 0x2F, 0x40, 0xFF, 0x2D, 0x30, 0x41, 0xFF, 0x2D, 0x31, 0x41,
+    0xFF, 0x2D, 0x32, 0x42, 0xFF, 0x30, 0x33, 0x45, 0xFF, 0x32, 0x35, 0x47, 0xFF, 0x30, 0x34, 0x46, 0xFF, 0x35, 0x39, 0x4A, 0xFF, 0x5B, 0x5F, 0x6D,
+    0xFF, 0x9D, 0xA0, 0xAD, 0xFF, 0xA1, 0xA3, 0xA9, 0xFF, 0x7D, 0x7E, 0x86, 0xFF, 0x44, 0x43, 0x4B, 0xFF, 0x39, 0x38, 0x3E, 0xFF, 0x30, 0x2E, 0x33,
+    0xFF, 0x2A, 0x29, 0x2D, 0xFF, 0x32, 0x31, 0x36, 0xFF, 0x4E, 0x4D, 0x56, 0xFF, 0x7F, 0x7F, 0x86, 0xFF, 0x97, 0x98, 0x9E, 0xFF, 0x9A, 0x9E, 0xA7,
+    0xFF, 0x6C, 0x71, 0x80, 0xFF, 0x24, 0x27, 0x38, 0xFF, 0x2E, 0x32, 0x46, 0xFF, 0x2F, 0x31, 0x43, 0xFF, 0x2D, 0x30, 0x41, 0xFF, 0x2C, 0x30, 0x40,
+    0xFF, 0x2E, 0x31, 0x42, 0xFF, 0x2D, 0x31, 0x42, 0xFF, 0x2E, 0x31, 0x42, 0xFF, 0x2E, 0x32, 0x43, 0xFF, 0x2F, 0x32, 0x44, 0xFF, 0x2F, 0x33, 0x44,
+    0xFF, 0x2B, 0x2E, 0x3F, 0xFF, 0x28, 0x2A, 0x3A, 0xFF, 0x1A, 0x1E, 0x2B, 0xFF, 0x07, 0x09, 0x12, 0xFF, 0x05, 0x07, 0x11, 0xFF, 0x05, 0x08, 0x11,
+    0xFF, 0x04, 0x07, 0x11, 0xFF, 0x02, 0x05, 0x0C, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x17, 0x1B, 0x28, 0xFF, 0x37, 0x3C, 0x4E, 0xFF, 0x30, 0x35, 0x46,
+    0xFF, 0x2B, 0x2F, 0x3F, 0xFF, 0x2D, 0x32, 0x42, 0xFF, 0x2C, 0x31, 0x42, 0xFF, 0x2E, 0x33, 0x44, 0xFF, 0x2F, 0x33, 0x45, 0xFF, 0x2F, 0x33, 0x44,
+    0xFF, 0x2C, 0x31, 0x41, 0xFF, 0x2B, 0x2F, 0x3F, 0xFF, 0x2C, 0x30, 0x40, 0xFF, 0x2C, 0x31, 0x41, 0xFF, 0x80, 0x2E, 0x31, 0x41, 0xFF, 0x29, 0x2B,
+    0x2E, 0x3F, 0xFF, 0x2A, 0x2E, 0x3F, 0xFF, 0x32, 0x36, 0x46, 0xFF, 0x62, 0x68, 0x78, 0xFF, 0x8F, 0x94, 0xA5, 0xFF, 0x94, 0x99, 0xA9, 0xFF, 0x92,
+    0x98, 0xAA, 0xFF, 0x92, 0x97, 0xA8, 0xFF, 0x9C, 0x9F, 0xAF, 0xFF, 0x9D, 0xA1, 0xB1, 0xFF, 0xA8, 0xAB, 0xB9, 0xFF, 0xAD, 0xB2, 0xBE, 0xFF, 0x99,
+    0x9E, 0xAA, 0xFF, 0x5B, 0x60, 0x6D, 0xFF, 0x33, 0x3A, 0x4B, 0xFF, 0x36, 0x3B, 0x4F, 0xFF, 0x36, 0x3A, 0x4C, 0xFF, 0x34, 0x38, 0x4B, 0xFF, 0x2F,
+    0x34, 0x47, 0xFF, 0x2D, 0x32, 0x43, 0xFF, 0x2C, 0x31, 0x42, 0xFF, 0x2A, 0x2F, 0x40, 0xFF, 0x2B, 0x2F, 0x41, 0xFF, 0x2D, 0x30, 0x42, 0xFF, 0x29,
+    0x2E, 0x3F, 0xFF, 0x27, 0x2C, 0x3D, 0xFF, 0x27, 0x2A, 0x3C, 0xFF, 0x25, 0x29, 0x3A, 0xFF, 0x26, 0x2A, 0x3C, 0xFF, 0x27, 0x2C, 0x3D, 0xFF, 0x24,
+    0x28, 0x39, 0xFF, 0x33, 0x35, 0x47, 0xFF, 0x12, 0x15, 0x1E, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x02, 0x03, 0x07, 0xFF, 0x17, 0x1A, 0x24, 0xFF, 0x4A,
+    0x4E, 0x62, 0xFF, 0x37, 0x3B, 0x4D, 0xFF, 0x76, 0x7C, 0x8C, 0xFF, 0x73, 0x79, 0x8A, 0xFF, 0x2A, 0x2E, 0x3F, 0xFF, 0x24, 0x27, 0x37, 0xFF, 0x80,
+    0x24, 0x27, 0x36, 0xFF, 0x13, 0x22, 0x25, 0x35, 0xFF, 0x20, 0x24, 0x33, 0xFF, 0x1F, 0x22, 0x32, 0xFF, 0x1F, 0x23, 0x32, 0xFF, 0x1E, 0x22, 0x32,
+    0xFF, 0x1C, 0x20, 0x30, 0xFF, 0x1E, 0x22, 0x31, 0xFF, 0x21, 0x25, 0x32, 0xFF, 0x0A, 0x0F, 0x17, 0xFF, 0x01, 0x03, 0x0A, 0xFF, 0x03, 0x04, 0x0C,
+    0xFF, 0x0C, 0x0D, 0x16, 0xFF, 0x33, 0x37, 0x4D, 0xFF, 0x2C, 0x2F, 0x44, 0xFF, 0x1B, 0x1D, 0x2C, 0xFF, 0x2F, 0x33, 0x43, 0xFF, 0x28, 0x2C, 0x3A,
+    0xFF, 0x0D, 0x10, 0x1A, 0xFF, 0x11, 0x15, 0x1F, 0xFF, 0x12, 0x14, 0x1E, 0xFF, 0x80, 0x11, 0x14, 0x1E, 0xFF, 0x16, 0x10, 0x14, 0x1D, 0xFF, 0x10,
+    0x12, 0x1C, 0xFF, 0x0F, 0x12, 0x1A, 0xFF, 0x0F, 0x10, 0x1A, 0xFF, 0x0F, 0x11, 0x1A, 0xFF, 0x10, 0x11, 0x1A, 0xFF, 0x0E, 0x10, 0x19, 0xFF, 0x0B,
+    0x0E, 0x17, 0xFF, 0x0A, 0x0C, 0x12, 0xFF, 0x16, 0x18, 0x1E, 0xFF, 0x2F, 0x31, 0x38, 0xFF, 0x5C, 0x60, 0x6B, 0xFF, 0x6C, 0x71, 0x7C, 0xFF, 0x82,
+    0x86, 0x92, 0xFF, 0xA0, 0xA5, 0xB1, 0xFF, 0xBB, 0xC2, 0xCC, 0xFF, 0xBF, 0xC6, 0xD0, 0xFF, 0xC0, 0xC6, 0xCE, 0xFF, 0xB9, 0xBE, 0xC5, 0xFF, 0x9B,
+    0xA1, 0xA8, 0xFF, 0x60, 0x65, 0x6D, 0xFF, 0x0F, 0x10, 0x17, 0xFF, 0x09, 0x0A, 0x0F, 0xFF, 0x80, 0x0B, 0x0D, 0x14, 0xFF, 0x80, 0x0A, 0x0C, 0x13,
+    0xFF, 0x04, 0x0A, 0x0B, 0x13, 0xFF, 0x09, 0x0B, 0x12, 0xFF, 0x0A, 0x0C, 0x13, 0xFF, 0x09, 0x0B, 0x11, 0xFF, 0x09, 0x0B, 0x10, 0xFF, 0x80, 0x09,
+    0x0A, 0x10, 0xFF, 0x07, 0x09, 0x0A, 0x0E, 0xFF, 0x07, 0x0A, 0x0E, 0xFF, 0x08, 0x0A, 0x0E, 0xFF, 0x07, 0x09, 0x0C, 0xFF, 0x14, 0x19, 0x1C, 0xFF,
+    0x03, 0x04, 0x06, 0xFF, 0x02, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x04, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x01, 0xFF, 0x05, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01,
+    0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x82, 0x00, 0x00, 0x01, 0xFF, 0x02, 0x00, 0x01, 0x02,
+    0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x80, 0x01, 0x01, 0x04, 0xFF, 0x08, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x01,
+    0x00, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x04, 0x06, 0x0B, 0xFF, 0x0F, 0x12, 0x1A, 0xFF, 0x08,
+    0x09, 0x0E, 0xFF, 0x80, 0x09, 0x0A, 0x10, 0xFF, 0x02, 0x09, 0x09, 0x10, 0xFF, 0x09, 0x0A, 0x11, 0xFF, 0x09, 0x0B, 0x13, 0xFF, 0x80, 0x0A, 0x0B,
+    0x13, 0xFF, 0x80, 0x0A, 0x0C, 0x15, 0xFF, 0x0F, 0x07, 0x08, 0x0D, 0xFF, 0x58, 0x5B, 0x64, 0xFF, 0x72, 0x78, 0x84, 0xFF, 0x06, 0x0F, 0x1B, 0xFF,
+    0x2E, 0x34, 0x4D, 0xFF, 0x43, 0x46, 0x62, 0xFF, 0x45, 0x46, 0x5F, 0xFF, 0x11, 0x13, 0x1B, 0xFF, 0x03, 0x05, 0x09, 0xFF, 0x02, 0x05, 0x0B, 0xFF,
+    0x14, 0x18, 0x22, 0xFF, 0x22, 0x25, 0x32, 0xFF, 0x12, 0x14, 0x20, 0xFF, 0x15, 0x16, 0x23, 0xFF, 0x14, 0x16, 0x22, 0xFF, 0x13, 0x16, 0x21, 0xFF,
+    0x80, 0x13, 0x15, 0x21, 0xFF, 0x0C, 0x15, 0x16, 0x22, 0xFF, 0x15, 0x16, 0x24, 0xFF, 0x15, 0x18, 0x25, 0xFF, 0x16, 0x18, 0x25, 0xFF, 0x16, 0x18,
+    0x26, 0xFF, 0x3A, 0x3E, 0x50, 0xFF, 0x62, 0x6A, 0x7F, 0xFF, 0x1D, 0x21, 0x36, 0xFF, 0x3F, 0x40, 0x58, 0xFF, 0x3B, 0x3D, 0x54, 0xFF, 0x0B, 0x0F,
+    0x19, 0xFF, 0x04, 0x06, 0x10, 0xFF, 0x05, 0x07, 0x11, 0xFF, 0x80, 0x05, 0x06, 0x10, 0xFF, 0x0A, 0x05, 0x07, 0x10, 0xFF, 0x05, 0x06, 0x0F, 0xFF,
+    0x04, 0x04, 0x0D, 0xFF, 0x09, 0x0C, 0x14, 0xFF, 0x21, 0x21, 0x33, 0xFF, 0x19, 0x1D, 0x29, 0xFF, 0x1E, 0x21, 0x2F, 0xFF, 0x1F, 0x22, 0x30, 0xFF,
+    0x1F, 0x22, 0x31, 0xFF, 0x20, 0x24, 0x32, 0xFF, 0x20, 0x24, 0x33, 0xFF, 0x83, 0x21, 0x24, 0x34, 0xFF, 0x80, 0x20, 0x24, 0x33, 0xFF, 0x09, 0x20,
+    0x22, 0x33, 0xFF, 0x19, 0x1C, 0x2C, 0xFF, 0x35, 0x37, 0x4B, 0xFF, 0x2D, 0x30, 0x41, 0xFF, 0x1F, 0x20, 0x30, 0xFF, 0x29, 0x2A, 0x3D, 0xFF, 0x07,
+    0x09, 0x15, 0xFF, 0x05, 0x07, 0x11, 0xFF, 0x04, 0x07, 0x11, 0xFF, 0x04, 0x06, 0x11, 0xFF, 0x80, 0x04, 0x06, 0x10, 0xFF, 0x44, 0x05, 0x07, 0x11,
+    0xFF, 0x04, 0x07, 0x0F, 0xFF, 0x0D, 0x0F, 0x17, 0xFF, 0x37, 0x37, 0x47, 0xFF, 0x2F, 0x30, 0x42, 0xFF, 0x29, 0x2C, 0x3E, 0xFF, 0x26, 0x2A, 0x3B,
+    0xFF, 0x25, 0x29, 0x3B, 0xFF, 0x27, 0x2A, 0x3C, 0xFF, 0x2A, 0x2E, 0x40, 0xFF, 0x2B, 0x2F, 0x42, 0xFF, 0x2B, 0x2E, 0x41, 0xFF, 0x29, 0x2E, 0x3F,
+    0xFF, 0x29, 0x2D, 0x40, 0xFF, 0x29, 0x2D, 0x3E, 0xFF, 0x2B, 0x2F, 0x40, 0xFF, 0x68, 0x6C, 0x81, 0xFF, 0x63, 0x67, 0x7F, 0xFF, 0x35, 0x37, 0x48,
+    0xFF, 0x01, 0x01, 0x05, 0xFF, 0x06, 0x08, 0x12, 0xFF, 0x07, 0x09, 0x14, 0xFF, 0x07, 0x09, 0x16, 0xFF, 0x07, 0x0A, 0x17, 0xFF, 0x0A, 0x0C, 0x16,
+    0xFF, 0x2B, 0x2F, 0x40, 0xFF, 0x29, 0x2D, 0x3C, 0xFF, 0x2A, 0x2E, 0x3F, 0xFF, 0x2A, 0x2E, 0x3E, 0xFF, 0x29, 0x2C, 0x3C, 0xFF, 0x27, 0x2B, 0x3B,
+    0xFF, 0x28, 0x2C, 0x3C, 0xFF, 0x29, 0x2D, 0x3D, 0xFF, 0x2A, 0x2E, 0x3F, 0xFF, 0x2C, 0x30, 0x40, 0xFF, 0x2E, 0x32, 0x42, 0xFF, 0x30, 0x33, 0x44,
+    0xFF, 0x32, 0x35, 0x46, 0xFF, 0x30, 0x34, 0x45, 0xFF, 0x2B, 0x2F, 0x41, 0xFF, 0x2A, 0x2E, 0x40, 0xFF, 0x4E, 0x52, 0x63, 0xFF, 0x8B, 0x8E, 0x9B,
+    0xFF, 0x93, 0x94, 0x9F, 0xFF, 0x9D, 0x9D, 0xA8, 0xFF, 0x99, 0x9A, 0xA6, 0xFF, 0x96, 0x96, 0xA4, 0xFF, 0x95, 0x96, 0xA5, 0xFF, 0x94, 0x96, 0xA5,
+    0xFF, 0x87, 0x8C, 0x9D, 0xFF, 0x53, 0x58, 0x6E, 0xFF, 0x27, 0x2A, 0x38, 0xFF, 0x2D, 0x30, 0x43, 0xFF, 0x2F, 0x33, 0x45, 0xFF, 0x2F, 0x31, 0x43,
+    0xFF, 0x2E, 0x2F, 0x42, 0xFF, 0x2B, 0x2E, 0x3F, 0xFF, 0x2A, 0x2D, 0x3D, 0xFF, 0x2A, 0x2E, 0x3E, 0xFF, 0x2B, 0x2E, 0x3E, 0xFF, 0x2A, 0x2E, 0x3E,
+    0xFF, 0x2D, 0x30, 0x40, 0xFF, 0x2E, 0x30, 0x41, 0xFF, 0x2E, 0x31, 0x42, 0xFF, 0x2C, 0x2F, 0x40, 0xFF, 0x2C, 0x2F, 0x3F, 0xFF, 0x16, 0x18, 0x24,
+    0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x05, 0x07, 0x11, 0xFF, 0x80, 0x05, 0x08, 0x11, 0xFF, 0x06, 0x04, 0x06, 0x0E, 0xFF, 0x03, 0x06, 0x0E, 0xFF, 0x05,
+    0x08, 0x11, 0xFF, 0x2C, 0x30, 0x41, 0xFF, 0x39, 0x3E, 0x51, 0xFF, 0x24, 0x29, 0x37, 0xFF, 0x2D, 0x31, 0x42, 0xFF, 0x80, 0x2C, 0x30, 0x41, 0xFF,
+    0x06, 0x2C, 0x31, 0x42, 0xFF, 0x2B, 0x2F, 0x40, 0xFF, 0x29, 0x2C, 0x3E, 0xFF, 0x27, 0x2C, 0x3C, 0xFF, 0x2A, 0x2D, 0x3E, 0xFF, 0x2A, 0x2E, 0x3D,
+    0xFF, 0x2A, 0x2E, 0x3F, 0xFF, 0x80, 0x2D, 0x30, 0x41, 0xFF, 0x41, 0x2D, 0x31, 0x42, 0xFF, 0x2F, 0x32, 0x45, 0xFF, 0x2E, 0x32, 0x46, 0xFF, 0x22,
+    0x27, 0x38, 0xFF, 0x28, 0x2D, 0x3C, 0xFF, 0x45, 0x4A, 0x5F, 0xFF, 0x4B, 0x51, 0x67, 0xFF, 0x49, 0x4E, 0x62, 0xFF, 0x47, 0x4C, 0x5F, 0xFF, 0x30,
+    0x34, 0x43, 0xFF, 0x1C, 0x20, 0x29, 0xFF, 0x25, 0x2C, 0x3B, 0xFF, 0x2B, 0x2F, 0x41, 0xFF, 0x2E, 0x33, 0x46, 0xFF, 0x32, 0x37, 0x49, 0xFF, 0x32,
+    0x36, 0x48, 0xFF, 0x2F, 0x35, 0x47, 0xFF, 0x2C, 0x32, 0x44, 0xFF, 0x2B, 0x30, 0x41, 0xFF, 0x2A, 0x2F, 0x40, 0xFF, 0x2A, 0x2E, 0x40, 0xFF, 0x2B,
+    0x2F, 0x41, 0xFF, 0x2A, 0x2F, 0x3F, 0xFF, 0x29, 0x2C, 0x3E, 0xFF, 0x27, 0x2A, 0x3D, 0xFF, 0x24, 0x29, 0x39, 0xFF, 0x25, 0x29, 0x3A, 0xFF, 0x26,
+    0x2A, 0x3B, 0xFF, 0x23, 0x29, 0x3A, 0xFF, 0x22, 0x26, 0x37, 0xFF, 0x32, 0x33, 0x45, 0xFF, 0x12, 0x13, 0x1D, 0xFF, 0x02, 0x03, 0x05, 0xFF, 0x02,
+    0x03, 0x06, 0xFF, 0x16, 0x19, 0x23, 0xFF, 0x48, 0x4C, 0x61, 0xFF, 0x35, 0x39, 0x4C, 0xFF, 0x75, 0x7A, 0x8B, 0xFF, 0x70, 0x75, 0x87, 0xFF, 0x28,
+    0x2B, 0x3D, 0xFF, 0x22, 0x25, 0x35, 0xFF, 0x23, 0x26, 0x35, 0xFF, 0x22, 0x25, 0x35, 0xFF, 0x20, 0x24, 0x33, 0xFF, 0x1E, 0x22, 0x32, 0xFF, 0x1D,
+    0x22, 0x31, 0xFF, 0x1C, 0x21, 0x2F, 0xFF, 0x1C, 0x20, 0x2F, 0xFF, 0x1A, 0x1F, 0x2E, 0xFF, 0x1D, 0x21, 0x30, 0xFF, 0x20, 0x24, 0x31, 0xFF, 0x0A,
+    0x0E, 0x16, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x20, 0x23, 0x33, 0xFF, 0x34, 0x38, 0x4D, 0xFF, 0x23,
+    0x26, 0x38, 0xFF, 0x1C, 0x1E, 0x2D, 0xFF, 0x33, 0x36, 0x48, 0xFF, 0x19, 0x1C, 0x29, 0xFF, 0x10, 0x12, 0x1D, 0xFF, 0x11, 0x13, 0x1D, 0xFF, 0x10,
+    0x12, 0x1C, 0xFF, 0x10, 0x11, 0x1C, 0xFF, 0x0E, 0x12, 0x1B, 0xFF, 0x82, 0x0F, 0x10, 0x1A, 0xFF, 0x13, 0x0F, 0x11, 0x1A, 0xFF, 0x0E, 0x11, 0x18,
+    0xFF, 0x0D, 0x10, 0x18, 0xFF, 0x0C, 0x0F, 0x18, 0xFF, 0x0B, 0x0E, 0x16, 0xFF, 0x0D, 0x0F, 0x17, 0xFF, 0x0D, 0x10, 0x16, 0xFF, 0x13, 0x16, 0x1D,
+    0xFF, 0x26, 0x29, 0x31, 0xFF, 0x31, 0x34, 0x42, 0xFF, 0x46, 0x4C, 0x59, 0xFF, 0x39, 0x3C, 0x48, 0xFF, 0x1F, 0x21, 0x29, 0xFF, 0x18, 0x1B, 0x20,
+    0xFF, 0x0B, 0x0F, 0x14, 0xFF, 0x0C, 0x0E, 0x14, 0xFF, 0x0E, 0x11, 0x19, 0xFF, 0x0E, 0x10, 0x1A, 0xFF, 0x0C, 0x0F, 0x16, 0xFF, 0x0A, 0x0D, 0x15,
+    0xFF, 0x80, 0x0A, 0x0C, 0x13, 0xFF, 0x00, 0x09, 0x0B, 0x11, 0xFF, 0x80, 0x09, 0x0A, 0x11, 0xFF, 0x01, 0x08, 0x0A, 0x10, 0xFF, 0x08, 0x09, 0x0F,
+    0xFF, 0x80, 0x08, 0x0A, 0x0F, 0xFF, 0x00, 0x08, 0x08, 0x0E, 0xFF, 0x80, 0x07, 0x09, 0x0D, 0xFF, 0x04, 0x06, 0x08, 0x0C, 0xFF, 0x13, 0x19, 0x1C,
+    0xFF, 0x02, 0x03, 0x06, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x02,
+    0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x01, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x81, 0x00, 0x01, 0x04, 0xFF, 0x0C, 0x01, 0x00, 0x05, 0xFF, 0x00,
+    0x00, 0x03, 0xFF, 0x01, 0x00, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x04, 0x06, 0x0A, 0xFF, 0x0F, 0x13, 0x19, 0xFF, 0x08,
+    0x09, 0x0E, 0xFF, 0x0A, 0x0A, 0x0F, 0xFF, 0x09, 0x0A, 0x10, 0xFF, 0x09, 0x09, 0x10, 0xFF, 0x09, 0x0A, 0x11, 0xFF, 0x09, 0x0A, 0x12, 0xFF, 0x80,
+    0x0A, 0x0A, 0x12, 0xFF, 0x0F, 0x0A, 0x0C, 0x14, 0xFF, 0x0A, 0x0C, 0x15, 0xFF, 0x08, 0x09, 0x0C, 0xFF, 0x59, 0x5B, 0x63, 0xFF, 0x74, 0x79, 0x85,
+    0xFF, 0x08, 0x11, 0x1F, 0xFF, 0x2F, 0x35, 0x4D, 0xFF, 0x44, 0x47, 0x61, 0xFF, 0x43, 0x45, 0x5E, 0xFF, 0x10, 0x13, 0x1B, 0xFF, 0x02, 0x04, 0x07,
+    0xFF, 0x02, 0x04, 0x09, 0xFF, 0x12, 0x16, 0x1F, 0xFF, 0x20, 0x23, 0x2F, 0xFF, 0x11, 0x13, 0x1D, 0xFF, 0x14, 0x14, 0x21, 0xFF, 0x80, 0x13, 0x15,
+    0x20, 0xFF, 0x18, 0x13, 0x14, 0x20, 0xFF, 0x14, 0x14, 0x21, 0xFF, 0x14, 0x16, 0x22, 0xFF, 0x14, 0x15, 0x23, 0xFF, 0x14, 0x17, 0x24, 0xFF, 0x15,
+    0x17, 0x24, 0xFF, 0x16, 0x17, 0x24, 0xFF, 0x3B, 0x3F, 0x50, 0xFF, 0x62, 0x6A, 0x80, 0xFF, 0x1E, 0x23, 0x37, 0xFF, 0x3D, 0x3F, 0x56, 0xFF, 0x39,
+    0x3A, 0x50, 0xFF, 0x0B, 0x0E, 0x17, 0xFF, 0x03, 0x04, 0x0D, 0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x04, 0x05, 0x0E, 0xFF, 0x04, 0x05, 0x0D, 0xFF, 0x04,
+    0x06, 0x0F, 0xFF, 0x04, 0x05, 0x0E, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x07, 0x05, 0x10, 0xFF, 0x18, 0x19, 0x26, 0xFF, 0x1A, 0x1C, 0x2A, 0xFF, 0x1D,
+    0x1F, 0x2F, 0xFF, 0x1E, 0x21, 0x2F, 0xFF, 0x80, 0x1E, 0x21, 0x30, 0xFF, 0x0F, 0x1F, 0x21, 0x32, 0xFF, 0x1F, 0x22, 0x32, 0xFF, 0x21, 0x24, 0x33,
+    0xFF, 0x21, 0x25, 0x34, 0xFF, 0x21, 0x24, 0x33, 0xFF, 0x21, 0x24, 0x32, 0xFF, 0x1F, 0x23, 0x32, 0xFF, 0x1F, 0x23, 0x31, 0xFF, 0x1C, 0x1F, 0x2E,
+    0xFF, 0x24, 0x25, 0x36, 0xFF, 0x2F, 0x33, 0x45, 0xFF, 0x1C, 0x1E, 0x2D, 0xFF, 0x22, 0x23, 0x35, 0xFF, 0x18, 0x1A, 0x29, 0xFF, 0x04, 0x06, 0x10,
+    0xFF, 0x06, 0x07, 0x12, 0xFF, 0x80, 0x04, 0x07, 0x10, 0xFF, 0x0C, 0x04, 0x06, 0x10, 0xFF, 0x05, 0x06, 0x11, 0xFF, 0x04, 0x08, 0x11, 0xFF, 0x03,
+    0x07, 0x0F, 0xFF, 0x0E, 0x10, 0x18, 0xFF, 0x37, 0x38, 0x48, 0xFF, 0x2D, 0x2F, 0x42, 0xFF, 0x25, 0x29, 0x3A, 0xFF, 0x24, 0x27, 0x38, 0xFF, 0x26,
+    0x28, 0x3A, 0xFF, 0x26, 0x29, 0x3B, 0xFF, 0x28, 0x2C, 0x3D, 0xFF, 0x29, 0x2C, 0x40, 0xFF, 0x80, 0x28, 0x2C, 0x3D, 0xFF, 0x38, 0x28, 0x2C, 0x3E,
+    0xFF, 0x28, 0x2C, 0x3D, 0xFF, 0x2A, 0x2E, 0x3E, 0xFF, 0x68, 0x6C, 0x81, 0xFF, 0x63, 0x68, 0x80, 0xFF, 0x34, 0x37, 0x48, 0xFF, 0x01, 0x02, 0x05,
+    0xFF, 0x06, 0x08, 0x12, 0xFF, 0x06, 0x08, 0x14, 0xFF, 0x07, 0x08, 0x15, 0xFF, 0x07, 0x09, 0x16, 0xFF, 0x08, 0x09, 0x15, 0xFF, 0x15, 0x18, 0x24,
+    0xFF, 0x27, 0x2B, 0x39, 0xFF, 0x29, 0x2B, 0x3B, 0xFF, 0x28, 0x2B, 0x3B, 0xFF, 0x27, 0x2A, 0x3A, 0xFF, 0x28, 0x2A, 0x3B, 0xFF, 0x27, 0x2B, 0x3B,
+    0xFF, 0x28, 0x2C, 0x3C, 0xFF, 0x2A, 0x2E, 0x3D, 0xFF, 0x2B, 0x2F, 0x3F, 0xFF, 0x2C, 0x30, 0x40, 0xFF, 0x2D, 0x30, 0x40, 0xFF, 0x2D, 0x31, 0x41,
+    0xFF, 0x2E, 0x32, 0x42, 0xFF, 0x2E, 0x31, 0x43, 0xFF, 0x2A, 0x2D, 0x3F, 0xFF, 0x24, 0x28, 0x3C, 0xFF, 0x17, 0x1D, 0x30, 0xFF, 0x11, 0x15, 0x27,
+    0xFF, 0x1C, 0x20, 0x33, 0xFF, 0x21, 0x28, 0x3A, 0xFF, 0x27, 0x2C, 0x42, 0xFF, 0x1A, 0x20, 0x32, 0xFF, 0x13, 0x18, 0x26, 0xFF, 0x1C, 0x20, 0x32,
+    0xFF, 0x29, 0x2F, 0x44, 0xFF, 0x2D, 0x32, 0x45, 0xFF, 0x30, 0x33, 0x44, 0xFF, 0x2F, 0x31, 0x43, 0xFF, 0x2A, 0x2E, 0x3E, 0xFF, 0x2A, 0x2D, 0x3E,
+    0xFF, 0x29, 0x2D, 0x3C, 0xFF, 0x29, 0x2C, 0x3D, 0xFF, 0x28, 0x2C, 0x3B, 0xFF, 0x28, 0x2C, 0x3C, 0xFF, 0x29, 0x2C, 0x3B, 0xFF, 0x29, 0x2C, 0x3C,
+    0xFF, 0x2A, 0x2D, 0x3D, 0xFF, 0x2A, 0x2D, 0x3C, 0xFF, 0x2C, 0x2F, 0x3E, 0xFF, 0x1F, 0x22, 0x2F, 0xFF, 0x09, 0x0B, 0x15, 0xFF, 0x04, 0x06, 0x10,
+    0xFF, 0x05, 0x08, 0x12, 0xFF, 0x04, 0x07, 0x10, 0xFF, 0x80, 0x04, 0x07, 0x0F, 0xFF, 0x09, 0x03, 0x06, 0x0F, 0xFF, 0x03, 0x06, 0x0E, 0xFF, 0x10,
+    0x14, 0x20, 0xFF, 0x34, 0x38, 0x4C, 0xFF, 0x2F, 0x34, 0x45, 0xFF, 0x28, 0x2D, 0x3C, 0xFF, 0x29, 0x2E, 0x3F, 0xFF, 0x29, 0x2E, 0x3E, 0xFF, 0x29,
+    0x2D, 0x3E, 0xFF, 0x27, 0x2C, 0x3B, 0xFF, 0x80, 0x27, 0x2B, 0x3A, 0xFF, 0x80, 0x28, 0x2C, 0x3B, 0xFF, 0x09, 0x2A, 0x2E, 0x3D, 0xFF, 0x2C, 0x2F,
+    0x3E, 0xFF, 0x2C, 0x2F, 0x3F, 0xFF, 0x2D, 0x30, 0x40, 0xFF, 0x2D, 0x30, 0x41, 0xFF, 0x2F, 0x32, 0x43, 0xFF, 0x2F, 0x32, 0x44, 0xFF, 0x2C, 0x2F,
+    0x42, 0xFF, 0x2A, 0x2E, 0x3E, 0xFF, 0x29, 0x2D, 0x3E, 0xFF, 0x80, 0x27, 0x2B, 0x3B, 0xFF, 0x09, 0x24, 0x29, 0x38, 0xFF, 0x28, 0x2C, 0x3D, 0xFF,
+    0x2B, 0x2F, 0x41, 0xFF, 0x2B, 0x30, 0x42, 0xFF, 0x2C, 0x30, 0x42, 0xFF, 0x2C, 0x30, 0x41, 0xFF, 0x2D, 0x31, 0x43, 0xFF, 0x2C, 0x31, 0x42, 0xFF,
+    0x2B, 0x30, 0x41, 0xFF, 0x2A, 0x2F, 0x3F, 0xFF, 0x80, 0x29, 0x2D, 0x3F, 0xFF, 0x80, 0x28, 0x2C, 0x3D, 0xFF, 0x29, 0x27, 0x2B, 0x3C, 0xFF, 0x25,
+    0x2A, 0x3A, 0xFF, 0x26, 0x29, 0x3A, 0xFF, 0x26, 0x29, 0x3B, 0xFF, 0x24, 0x29, 0x3A, 0xFF, 0x22, 0x27, 0x37, 0xFF, 0x21, 0x24, 0x35, 0xFF, 0x30,
+    0x32, 0x44, 0xFF, 0x11, 0x13, 0x1C, 0xFF, 0x02, 0x03, 0x06, 0xFF, 0x03, 0x03, 0x07, 0xFF, 0x16, 0x19, 0x22, 0xFF, 0x46, 0x4B, 0x5E, 0xFF, 0x32,
+    0x37, 0x4A, 0xFF, 0x72, 0x78, 0x89, 0xFF, 0x6E, 0x73, 0x85, 0xFF, 0x26, 0x2A, 0x3B, 0xFF, 0x20, 0x24, 0x33, 0xFF, 0x21, 0x25, 0x33, 0xFF, 0x1F,
+    0x23, 0x31, 0xFF, 0x1E, 0x21, 0x31, 0xFF, 0x1D, 0x20, 0x30, 0xFF, 0x1B, 0x1F, 0x2E, 0xFF, 0x1B, 0x1F, 0x2D, 0xFF, 0x19, 0x1F, 0x2D, 0xFF, 0x18,
+    0x1C, 0x2B, 0xFF, 0x1B, 0x1F, 0x2D, 0xFF, 0x20, 0x23, 0x30, 0xFF, 0x0A, 0x0E, 0x15, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x04, 0x05, 0x10, 0xFF, 0x03,
+    0x05, 0x0F, 0xFF, 0x0B, 0x0D, 0x16, 0xFF, 0x30, 0x32, 0x46, 0xFF, 0x2D, 0x30, 0x45, 0xFF, 0x1B, 0x1C, 0x2B, 0xFF, 0x25, 0x29, 0x39, 0xFF, 0x29,
+    0x2C, 0x3C, 0xFF, 0x0C, 0x0E, 0x18, 0xFF, 0x10, 0x13, 0x1D, 0xFF, 0x0F, 0x12, 0x1C, 0xFF, 0x0F, 0x11, 0x1B, 0xFF, 0x80, 0x0E, 0x11, 0x19, 0xFF,
+    0x03, 0x0E, 0x11, 0x1A, 0xFF, 0x0E, 0x11, 0x19, 0xFF, 0x0F, 0x10, 0x19, 0xFF, 0x0E, 0x10, 0x19, 0xFF, 0x80, 0x0E, 0x10, 0x18, 0xFF, 0x00, 0x0D,
+    0x10, 0x17, 0xFF, 0x81, 0x0C, 0x0F, 0x18, 0xFF, 0x11, 0x0C, 0x0E, 0x17, 0xFF, 0x0C, 0x0E, 0x16, 0xFF, 0x08, 0x0C, 0x12, 0xFF, 0x07, 0x0B, 0x12,
+    0xFF, 0x09, 0x0D, 0x15, 0xFF, 0x0F, 0x12, 0x1B, 0xFF, 0x0F, 0x13, 0x1B, 0xFF, 0x10, 0x13, 0x1C, 0xFF, 0x11, 0x14, 0x1C, 0xFF, 0x0F, 0x12, 0x1B,
+    0xFF, 0x0E, 0x10, 0x19, 0xFF, 0x0C, 0x0F, 0x15, 0xFF, 0x0A, 0x0D, 0x14, 0xFF, 0x09, 0x0B, 0x14, 0xFF, 0x09, 0x0C, 0x13, 0xFF, 0x08, 0x0A, 0x11,
+    0xFF, 0x08, 0x09, 0x10, 0xFF, 0x08, 0x0A, 0x10, 0xFF, 0x81, 0x07, 0x09, 0x0E, 0xFF, 0x80, 0x08, 0x0A, 0x0E, 0xFF, 0x06, 0x07, 0x0A, 0x0E, 0xFF,
+    0x08, 0x09, 0x0D, 0xFF, 0x06, 0x08, 0x0C, 0xFF, 0x13, 0x18, 0x1A, 0xFF, 0x03, 0x04, 0x06, 0xFF, 0x02, 0x01, 0x05, 0xFF, 0x02, 0x02, 0x05, 0xFF,
+    0x80, 0x00, 0x00, 0x01, 0xFF, 0x04, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00,
+    0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x09, 0x00, 0x01, 0x01, 0xFF, 0x01, 0x00,
+    0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01,
+    0x02, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x00, 0x00, 0x04, 0xFF, 0x01, 0x00, 0x04, 0xFF,
+    0x81, 0x00, 0x01, 0x04, 0xFF, 0x07, 0x05, 0x07, 0x0B, 0xFF, 0x11, 0x13, 0x1A, 0xFF, 0x08, 0x09, 0x0E, 0xFF, 0x09, 0x0A, 0x10, 0xFF, 0x08, 0x09,
+    0x0F, 0xFF, 0x09, 0x08, 0x0F, 0xFF, 0x09, 0x09, 0x10, 0xFF, 0x09, 0x0A, 0x11, 0xFF, 0x80, 0x09, 0x0B, 0x12, 0xFF, 0x10, 0x0A, 0x0C, 0x13, 0xFF,
+    0x0A, 0x0C, 0x14, 0xFF, 0x07, 0x09, 0x0D, 0xFF, 0x59, 0x5A, 0x63, 0xFF, 0x73, 0x77, 0x83, 0xFF, 0x09, 0x12, 0x20, 0xFF, 0x2D, 0x34, 0x4E, 0xFF,
+    0x41, 0x46, 0x5F, 0xFF, 0x41, 0x44, 0x5C, 0xFF, 0x10, 0x12, 0x1B, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x01, 0x04, 0x07, 0xFF, 0x11, 0x15, 0x1D, 0xFF,
+    0x1F, 0x21, 0x2C, 0xFF, 0x11, 0x12, 0x1D, 0xFF, 0x13, 0x14, 0x1F, 0xFF, 0x13, 0x14, 0x20, 0xFF, 0x80, 0x13, 0x15, 0x20, 0xFF, 0x01, 0x15, 0x15,
+    0x21, 0xFF, 0x14, 0x15, 0x22, 0xFF, 0x80, 0x15, 0x16, 0x23, 0xFF, 0x0B, 0x15, 0x17, 0x23, 0xFF, 0x15, 0x17, 0x24, 0xFF, 0x3B, 0x40, 0x50, 0xFF,
+    0x62, 0x6A, 0x80, 0xFF, 0x1E, 0x23, 0x37, 0xFF, 0x3A, 0x3C, 0x52, 0xFF, 0x35, 0x37, 0x4B, 0xFF, 0x0A, 0x0D, 0x16, 0xFF, 0x03, 0x05, 0x0D, 0xFF,
+    0x03, 0x06, 0x0E, 0xFF, 0x04, 0x05, 0x0E, 0xFF, 0x04, 0x05, 0x0D, 0xFF, 0x80, 0x03, 0x06, 0x0E, 0xFF, 0x0B, 0x04, 0x05, 0x0E, 0xFF, 0x02, 0x03,
+    0x09, 0xFF, 0x0F, 0x10, 0x1B, 0xFF, 0x1F, 0x1F, 0x2F, 0xFF, 0x18, 0x1D, 0x28, 0xFF, 0x1B, 0x1F, 0x2D, 0xFF, 0x1D, 0x1F, 0x2E, 0xFF, 0x1B, 0x1E,
+    0x2D, 0xFF, 0x1D, 0x1F, 0x2F, 0xFF, 0x1F, 0x22, 0x30, 0xFF, 0x1F, 0x22, 0x32, 0xFF, 0x20, 0x24, 0x33, 0xFF, 0x80, 0x20, 0x24, 0x34, 0xFF, 0x17,
+    0x20, 0x23, 0x32, 0xFF, 0x1E, 0x20, 0x30, 0xFF, 0x17, 0x1B, 0x29, 0xFF, 0x29, 0x2C, 0x3C, 0xFF, 0x2D, 0x30, 0x40, 0xFF, 0x11, 0x12, 0x1F, 0xFF,
+    0x27, 0x28, 0x3B, 0xFF, 0x04, 0x07, 0x13, 0xFF, 0x03, 0x05, 0x0E, 0xFF, 0x05, 0x06, 0x0F, 0xFF, 0x04, 0x07, 0x0F, 0xFF, 0x03, 0x06, 0x0F, 0xFF,
+    0x04, 0x06, 0x0F, 0xFF, 0x05, 0x06, 0x10, 0xFF, 0x04, 0x07, 0x11, 0xFF, 0x03, 0x06, 0x0F, 0xFF, 0x0F, 0x10, 0x18, 0xFF, 0x36, 0x37, 0x48, 0xFF,
+    0x2C, 0x2E, 0x41, 0xFF, 0x24, 0x27, 0x38, 0xFF, 0x24, 0x27, 0x39, 0xFF, 0x25, 0x28, 0x39, 0xFF, 0x26, 0x29, 0x3A, 0xFF, 0x27, 0x2A, 0x3B, 0xFF,
+    0x80, 0x26, 0x2A, 0x3B, 0xFF, 0x16, 0x26, 0x29, 0x3A, 0xFF, 0x27, 0x2B, 0x3C, 0xFF, 0x26, 0x2A, 0x3B, 0xFF, 0x28, 0x2C, 0x3C, 0xFF, 0x66, 0x6A,
+    0x7E, 0xFF, 0x64, 0x68, 0x81, 0xFF, 0x35, 0x39, 0x4A, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x06, 0x09, 0x14, 0xFF, 0x05, 0x08, 0x13, 0xFF, 0x06, 0x08,
+    0x15, 0xFF, 0x07, 0x09, 0x15, 0xFF, 0x08, 0x09, 0x16, 0xFF, 0x05, 0x07, 0x11, 0xFF, 0x1D, 0x21, 0x2E, 0xFF, 0x28, 0x2B, 0x3A, 0xFF, 0x26, 0x29,
+    0x38, 0xFF, 0x26, 0x2A, 0x39, 0xFF, 0x27, 0x2A, 0x3A, 0xFF, 0x27, 0x2B, 0x3B, 0xFF, 0x27, 0x2C, 0x3B, 0xFF, 0x29, 0x2C, 0x3C, 0xFF, 0x2A, 0x2D,
+    0x3D, 0xFF, 0x81, 0x29, 0x2D, 0x3D, 0xFF, 0x01, 0x2A, 0x2E, 0x3E, 0xFF, 0x2B, 0x2E, 0x3E, 0xFF, 0x80, 0x2A, 0x2D, 0x3D, 0xFF, 0x0B, 0x29, 0x2C,
+    0x3D, 0xFF, 0x2A, 0x2D, 0x3E, 0xFF, 0x2C, 0x2D, 0x3E, 0xFF, 0x2A, 0x2E, 0x3C, 0xFF, 0x2C, 0x30, 0x40, 0xFF, 0x2C, 0x30, 0x3F, 0xFF, 0x2C, 0x2F,
+    0x3D, 0xFF, 0x2A, 0x2D, 0x3B, 0xFF, 0x2B, 0x2E, 0x3C, 0xFF, 0x2B, 0x2E, 0x3D, 0xFF, 0x2B, 0x2F, 0x3F, 0xFF, 0x2A, 0x2D, 0x3F, 0xFF, 0x81, 0x28,
+    0x2C, 0x3B, 0xFF, 0x17, 0x29, 0x2C, 0x3B, 0xFF, 0x28, 0x2B, 0x3A, 0xFF, 0x27, 0x2A, 0x3A, 0xFF, 0x27, 0x2A, 0x39, 0xFF, 0x27, 0x2A, 0x38, 0xFF,
+    0x27, 0x2A, 0x39, 0xFF, 0x28, 0x2B, 0x3A, 0xFF, 0x25, 0x28, 0x37, 0xFF, 0x0C, 0x10, 0x19, 0xFF, 0x04, 0x07, 0x10, 0xFF, 0x05, 0x07, 0x11, 0xFF,
+    0x05, 0x07, 0x10, 0xFF, 0x03, 0x07, 0x0E, 0xFF, 0x04, 0x07, 0x0E, 0xFF, 0x04, 0x08, 0x0F, 0xFF, 0x05, 0x08, 0x0F, 0xFF, 0x04, 0x08, 0x0F, 0xFF,
+    0x05, 0x07, 0x10, 0xFF, 0x1F, 0x22, 0x32, 0xFF, 0x2E, 0x33, 0x44, 0xFF, 0x28, 0x2C, 0x3C, 0xFF, 0x28, 0x2C, 0x3D, 0xFF, 0x29, 0x2D, 0x3D, 0xFF,
+    0x27, 0x2B, 0x3A, 0xFF, 0x80, 0x25, 0x29, 0x38, 0xFF, 0x15, 0x26, 0x2A, 0x38, 0xFF, 0x27, 0x2B, 0x3A, 0xFF, 0x28, 0x2B, 0x3A, 0xFF, 0x29, 0x2C,
+    0x3B, 0xFF, 0x2A, 0x2C, 0x3D, 0xFF, 0x2A, 0x2D, 0x3E, 0xFF, 0x2B, 0x2F, 0x3F, 0xFF, 0x2B, 0x30, 0x3F, 0xFF, 0x2B, 0x2F, 0x3F, 0xFF, 0x2C, 0x2F,
+    0x3F, 0xFF, 0x2B, 0x2F, 0x3F, 0xFF, 0x2B, 0x2E, 0x3F, 0xFF, 0x29, 0x2D, 0x3D, 0xFF, 0x28, 0x2B, 0x3C, 0xFF, 0x28, 0x2C, 0x3E, 0xFF, 0x27, 0x2B,
+    0x3C, 0xFF, 0x29, 0x2C, 0x3C, 0xFF, 0x29, 0x2C, 0x3E, 0xFF, 0x29, 0x2E, 0x3F, 0xFF, 0x28, 0x2D, 0x3E, 0xFF, 0x27, 0x2C, 0x3C, 0xFF, 0x28, 0x2D,
+    0x3E, 0xFF, 0x80, 0x2A, 0x2E, 0x3F, 0xFF, 0x15, 0x28, 0x2D, 0x3E, 0xFF, 0x28, 0x2D, 0x3F, 0xFF, 0x28, 0x2C, 0x3E, 0xFF, 0x27, 0x2B, 0x3C, 0xFF,
+    0x26, 0x2A, 0x3B, 0xFF, 0x25, 0x2A, 0x3A, 0xFF, 0x25, 0x29, 0x3A, 0xFF, 0x27, 0x29, 0x3A, 0xFF, 0x26, 0x29, 0x3A, 0xFF, 0x24, 0x28, 0x38, 0xFF,
+    0x21, 0x25, 0x35, 0xFF, 0x20, 0x23, 0x33, 0xFF, 0x2E, 0x31, 0x41, 0xFF, 0x10, 0x13, 0x1B, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x03, 0x04, 0x08, 0xFF,
+    0x16, 0x1A, 0x22, 0xFF, 0x44, 0x48, 0x5B, 0xFF, 0x2F, 0x33, 0x46, 0xFF, 0x6D, 0x74, 0x84, 0xFF, 0x6A, 0x70, 0x82, 0xFF, 0x24, 0x28, 0x38, 0xFF,
+    0x80, 0x1F, 0x22, 0x31, 0xFF, 0x35, 0x1E, 0x21, 0x30, 0xFF, 0x1D, 0x20, 0x2E, 0xFF, 0x1C, 0x20, 0x2E, 0xFF, 0x1A, 0x1E, 0x2D, 0xFF, 0x19, 0x1E,
+    0x2C, 0xFF, 0x18, 0x1C, 0x2B, 0xFF, 0x16, 0x1B, 0x29, 0xFF, 0x1A, 0x1E, 0x2C, 0xFF, 0x1E, 0x23, 0x2F, 0xFF, 0x0A, 0x0E, 0x16, 0xFF, 0x02, 0x04,
+    0x0B, 0xFF, 0x04, 0x06, 0x11, 0xFF, 0x06, 0x07, 0x14, 0xFF, 0x04, 0x06, 0x10, 0xFF, 0x1A, 0x1B, 0x2A, 0xFF, 0x2C, 0x2F, 0x42, 0xFF, 0x28, 0x2A,
+    0x3D, 0xFF, 0x14, 0x16, 0x24, 0xFF, 0x28, 0x2A, 0x3A, 0xFF, 0x19, 0x1B, 0x27, 0xFF, 0x0C, 0x0F, 0x19, 0xFF, 0x0F, 0x11, 0x1B, 0xFF, 0x0F, 0x11,
+    0x1A, 0xFF, 0x0E, 0x10, 0x19, 0xFF, 0x0D, 0x10, 0x18, 0xFF, 0x0D, 0x11, 0x18, 0xFF, 0x0E, 0x10, 0x18, 0xFF, 0x0E, 0x10, 0x19, 0xFF, 0x0E, 0x0F,
+    0x17, 0xFF, 0x0D, 0x10, 0x17, 0xFF, 0x0D, 0x0F, 0x17, 0xFF, 0x0C, 0x10, 0x17, 0xFF, 0x0C, 0x0F, 0x16, 0xFF, 0x0C, 0x0F, 0x17, 0xFF, 0x0C, 0x10,
+    0x18, 0xFF, 0x0D, 0x10, 0x18, 0xFF, 0x0E, 0x10, 0x18, 0xFF, 0x0C, 0x10, 0x18, 0xFF, 0x0D, 0x10, 0x18, 0xFF, 0x0D, 0x11, 0x19, 0xFF, 0x0F, 0x12,
+    0x1C, 0xFF, 0x10, 0x12, 0x1B, 0xFF, 0x0F, 0x11, 0x1A, 0xFF, 0x0D, 0x10, 0x17, 0xFF, 0x0D, 0x0F, 0x18, 0xFF, 0x0D, 0x0F, 0x17, 0xFF, 0x0B, 0x0E,
+    0x15, 0xFF, 0x0A, 0x0D, 0x14, 0xFF, 0x09, 0x0B, 0x12, 0xFF, 0x08, 0x0A, 0x11, 0xFF, 0x07, 0x0A, 0x10, 0xFF, 0x08, 0x0A, 0x10, 0xFF, 0x07, 0x09,
+    0x0F, 0xFF, 0x08, 0x09, 0x0E, 0xFF, 0x80, 0x07, 0x09, 0x0D, 0xFF, 0x08, 0x07, 0x09, 0x0E, 0xFF, 0x08, 0x0A, 0x0E, 0xFF, 0x07, 0x0A, 0x0E, 0xFF,
+    0x08, 0x0A, 0x0D, 0xFF, 0x06, 0x08, 0x0B, 0xFF, 0x13, 0x18, 0x1B, 0xFF, 0x02, 0x03, 0x06, 0xFF, 0x02, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x05, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x01, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x02, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x80, 0x01,
+    0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x04, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x22, 0x00, 0x01, 0x02, 0xFF,
+    0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF,
+    0x01, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x01, 0x01, 0x03, 0xFF, 0x05, 0x07, 0x0B, 0xFF, 0x10, 0x13, 0x19, 0xFF, 0x08, 0x09, 0x0E, 0xFF,
+    0x09, 0x0A, 0x0F, 0xFF, 0x08, 0x09, 0x0F, 0xFF, 0x07, 0x08, 0x0F, 0xFF, 0x08, 0x09, 0x0F, 0xFF, 0x08, 0x0A, 0x0F, 0xFF, 0x08, 0x0A, 0x10, 0xFF,
+    0x0A, 0x0B, 0x12, 0xFF, 0x0A, 0x0C, 0x14, 0xFF, 0x09, 0x0C, 0x13, 0xFF, 0x07, 0x0A, 0x0D, 0xFF, 0x57, 0x5A, 0x64, 0xFF, 0x73, 0x78, 0x85, 0xFF,
+    0x0B, 0x12, 0x1F, 0xFF, 0x2C, 0x33, 0x4B, 0xFF, 0x3E, 0x43, 0x5D, 0xFF, 0x3E, 0x40, 0x59, 0xFF, 0x10, 0x12, 0x1B, 0xFF, 0x00, 0x02, 0x05, 0xFF,
+    0x01, 0x02, 0x05, 0xFF, 0x10, 0x14, 0x1B, 0xFF, 0x1E, 0x21, 0x2B, 0xFF, 0x10, 0x11, 0x1B, 0xFF, 0x80, 0x12, 0x13, 0x1F, 0xFF, 0x11, 0x12, 0x14,
+    0x1F, 0xFF, 0x12, 0x16, 0x20, 0xFF, 0x13, 0x15, 0x21, 0xFF, 0x13, 0x15, 0x22, 0xFF, 0x14, 0x16, 0x22, 0xFF, 0x15, 0x15, 0x22, 0xFF, 0x15, 0x17,
+    0x22, 0xFF, 0x15, 0x17, 0x24, 0xFF, 0x3C, 0x41, 0x51, 0xFF, 0x62, 0x6A, 0x7F, 0xFF, 0x1D, 0x22, 0x35, 0xFF, 0x37, 0x39, 0x4F, 0xFF, 0x32, 0x34,
+    0x47, 0xFF, 0x0A, 0x0D, 0x15, 0xFF, 0x04, 0x05, 0x0D, 0xFF, 0x03, 0x06, 0x0E, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x80, 0x03,
+    0x05, 0x0E, 0xFF, 0x24, 0x04, 0x05, 0x0E, 0xFF, 0x02, 0x03, 0x0B, 0xFF, 0x0B, 0x0B, 0x17, 0xFF, 0x19, 0x1B, 0x28, 0xFF, 0x16, 0x1A, 0x27, 0xFF,
+    0x1B, 0x1E, 0x2C, 0xFF, 0x1B, 0x1E, 0x2D, 0xFF, 0x1A, 0x1D, 0x2C, 0xFF, 0x1C, 0x1F, 0x2D, 0xFF, 0x1C, 0x20, 0x2E, 0xFF, 0x1D, 0x20, 0x2E, 0xFF,
+    0x1D, 0x21, 0x30, 0xFF, 0x1D, 0x21, 0x31, 0xFF, 0x1D, 0x22, 0x30, 0xFF, 0x1E, 0x21, 0x30, 0xFF, 0x1C, 0x1E, 0x2D, 0xFF, 0x1B, 0x1D, 0x2C, 0xFF,
+    0x38, 0x3B, 0x4B, 0xFF, 0x20, 0x22, 0x2F, 0xFF, 0x19, 0x1A, 0x28, 0xFF, 0x18, 0x1B, 0x29, 0xFF, 0x02, 0x03, 0x0B, 0xFF, 0x04, 0x05, 0x0E, 0xFF,
+    0x04, 0x06, 0x0D, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x03, 0x05, 0x0E, 0xFF, 0x03, 0x06, 0x0E, 0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x04, 0x06, 0x11, 0xFF,
+    0x03, 0x06, 0x0F, 0xFF, 0x0E, 0x0F, 0x18, 0xFF, 0x34, 0x35, 0x46, 0xFF, 0x2A, 0x2B, 0x3D, 0xFF, 0x23, 0x25, 0x36, 0xFF, 0x24, 0x27, 0x38, 0xFF,
+    0x25, 0x28, 0x38, 0xFF, 0x26, 0x28, 0x3A, 0xFF, 0x81, 0x24, 0x28, 0x38, 0xFF, 0x08, 0x24, 0x28, 0x39, 0xFF, 0x25, 0x28, 0x39, 0xFF, 0x24, 0x28,
+    0x38, 0xFF, 0x25, 0x29, 0x38, 0xFF, 0x64, 0x68, 0x7C, 0xFF, 0x65, 0x69, 0x80, 0xFF, 0x37, 0x3B, 0x4C, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x06, 0x0A,
+    0x15, 0xFF, 0x80, 0x06, 0x08, 0x13, 0xFF, 0x08, 0x06, 0x08, 0x14, 0xFF, 0x06, 0x09, 0x15, 0xFF, 0x07, 0x08, 0x14, 0xFF, 0x08, 0x0A, 0x14, 0xFF,
+    0x18, 0x1D, 0x29, 0xFF, 0x22, 0x27, 0x35, 0xFF, 0x24, 0x27, 0x35, 0xFF, 0x25, 0x28, 0x37, 0xFF, 0x26, 0x29, 0x39, 0xFF, 0x80, 0x26, 0x2A, 0x3A,
+    0xFF, 0x09, 0x27, 0x2B, 0x3A, 0xFF, 0x28, 0x2A, 0x3A, 0xFF, 0x27, 0x2B, 0x3A, 0xFF, 0x26, 0x2B, 0x39, 0xFF, 0x26, 0x2A, 0x3A, 0xFF, 0x27, 0x2B,
+    0x3B, 0xFF, 0x28, 0x2C, 0x3B, 0xFF, 0x29, 0x2C, 0x3C, 0xFF, 0x29, 0x2D, 0x3C, 0xFF, 0x2A, 0x2E, 0x3D, 0xFF, 0x80, 0x2B, 0x2E, 0x3E, 0xFF, 0x09,
+    0x2B, 0x2E, 0x3D, 0xFF, 0x2A, 0x2F, 0x3E, 0xFF, 0x29, 0x2D, 0x3B, 0xFF, 0x27, 0x2B, 0x39, 0xFF, 0x25, 0x2A, 0x38, 0xFF, 0x26, 0x2A, 0x39, 0xFF,
+    0x26, 0x2A, 0x3A, 0xFF, 0x27, 0x2A, 0x3B, 0xFF, 0x26, 0x2A, 0x38, 0xFF, 0x27, 0x2A, 0x39, 0xFF, 0x81, 0x28, 0x2B, 0x3A, 0xFF, 0x0A, 0x27, 0x2A,
+    0x39, 0xFF, 0x27, 0x2A, 0x38, 0xFF, 0x24, 0x28, 0x35, 0xFF, 0x24, 0x27, 0x35, 0xFF, 0x25, 0x28, 0x36, 0xFF, 0x0F, 0x13, 0x1C, 0xFF, 0x04, 0x07,
+    0x0F, 0xFF, 0x04, 0x08, 0x0F, 0xFF, 0x04, 0x07, 0x10, 0xFF, 0x04, 0x07, 0x0E, 0xFF, 0x04, 0x06, 0x0E, 0xFF, 0x80, 0x03, 0x06, 0x0E, 0xFF, 0x12,
+    0x04, 0x07, 0x0F, 0xFF, 0x05, 0x08, 0x0F, 0xFF, 0x05, 0x07, 0x0F, 0xFF, 0x05, 0x08, 0x11, 0xFF, 0x1E, 0x22, 0x32, 0xFF, 0x29, 0x2D, 0x3E, 0xFF,
+    0x22, 0x26, 0x33, 0xFF, 0x26, 0x2A, 0x3B, 0xFF, 0x24, 0x28, 0x37, 0xFF, 0x23, 0x27, 0x36, 0xFF, 0x23, 0x28, 0x35, 0xFF, 0x24, 0x28, 0x36, 0xFF,
+    0x27, 0x2A, 0x39, 0xFF, 0x27, 0x2B, 0x39, 0xFF, 0x27, 0x2A, 0x39, 0xFF, 0x27, 0x2B, 0x3A, 0xFF, 0x28, 0x2C, 0x3B, 0xFF, 0x29, 0x2C, 0x3C, 0xFF,
+    0x29, 0x2D, 0x3C, 0xFF, 0x80, 0x28, 0x2D, 0x3C, 0xFF, 0x09, 0x29, 0x2D, 0x3C, 0xFF, 0x29, 0x2C, 0x3E, 0xFF, 0x28, 0x2B, 0x3C, 0xFF, 0x28, 0x2A,
+    0x3B, 0xFF, 0x26, 0x2A, 0x39, 0xFF, 0x25, 0x29, 0x3A, 0xFF, 0x24, 0x29, 0x3A, 0xFF, 0x24, 0x29, 0x39, 0xFF, 0x25, 0x2A, 0x39, 0xFF, 0x26, 0x2A,
+    0x3A, 0xFF, 0x80, 0x26, 0x29, 0x3B, 0xFF, 0x34, 0x25, 0x2A, 0x3A, 0xFF, 0x23, 0x29, 0x38, 0xFF, 0x22, 0x29, 0x38, 0xFF, 0x27, 0x2B, 0x3D, 0xFF,
+    0x27, 0x2A, 0x3C, 0xFF, 0x25, 0x29, 0x3B, 0xFF, 0x25, 0x29, 0x39, 0xFF, 0x25, 0x29, 0x3A, 0xFF, 0x24, 0x29, 0x39, 0xFF, 0x25, 0x29, 0x39, 0xFF,
+    0x25, 0x28, 0x38, 0xFF, 0x24, 0x27, 0x37, 0xFF, 0x21, 0x25, 0x35, 0xFF, 0x20, 0x24, 0x33, 0xFF, 0x2E, 0x30, 0x3F, 0xFF, 0x10, 0x13, 0x1B, 0xFF,
+    0x02, 0x04, 0x0A, 0xFF, 0x03, 0x05, 0x0A, 0xFF, 0x17, 0x1A, 0x24, 0xFF, 0x43, 0x48, 0x5A, 0xFF, 0x2C, 0x31, 0x42, 0xFF, 0x68, 0x6F, 0x80, 0xFF,
+    0x64, 0x6B, 0x7E, 0xFF, 0x21, 0x25, 0x35, 0xFF, 0x1C, 0x1F, 0x2E, 0xFF, 0x1D, 0x20, 0x2E, 0xFF, 0x1C, 0x20, 0x2E, 0xFF, 0x1B, 0x1E, 0x2D, 0xFF,
+    0x1B, 0x1F, 0x2C, 0xFF, 0x1A, 0x1E, 0x2C, 0xFF, 0x19, 0x1D, 0x2B, 0xFF, 0x19, 0x1B, 0x29, 0xFF, 0x16, 0x1A, 0x28, 0xFF, 0x19, 0x1D, 0x2B, 0xFF,
+    0x1E, 0x22, 0x2F, 0xFF, 0x09, 0x0E, 0x15, 0xFF, 0x02, 0x03, 0x0B, 0xFF, 0x03, 0x06, 0x10, 0xFF, 0x05, 0x07, 0x13, 0xFF, 0x04, 0x07, 0x14, 0xFF,
+    0x04, 0x06, 0x0F, 0xFF, 0x1F, 0x21, 0x31, 0xFF, 0x2A, 0x2D, 0x40, 0xFF, 0x1B, 0x1D, 0x2C, 0xFF, 0x17, 0x19, 0x24, 0xFF, 0x26, 0x28, 0x37, 0xFF,
+    0x13, 0x15, 0x1F, 0xFF, 0x0C, 0x0D, 0x15, 0xFF, 0x0F, 0x10, 0x19, 0xFF, 0x0D, 0x10, 0x18, 0xFF, 0x0D, 0x10, 0x17, 0xFF, 0x0E, 0x10, 0x18, 0xFF,
+    0x0E, 0x0F, 0x18, 0xFF, 0x81, 0x0D, 0x0F, 0x17, 0xFF, 0x04, 0x0C, 0x10, 0x17, 0xFF, 0x0C, 0x10, 0x16, 0xFF, 0x0B, 0x0E, 0x17, 0xFF, 0x0C, 0x0F,
+    0x17, 0xFF, 0x0D, 0x10, 0x18, 0xFF, 0x80, 0x0D, 0x0F, 0x18, 0xFF, 0x05, 0x0C, 0x0F, 0x17, 0xFF, 0x0C, 0x0E, 0x16, 0xFF, 0x0D, 0x0F, 0x17, 0xFF,
+    0x0C, 0x0F, 0x17, 0xFF, 0x0D, 0x10, 0x18, 0xFF, 0x0C, 0x10, 0x17, 0xFF, 0x80, 0x0C, 0x0E, 0x16, 0xFF, 0x80, 0x0C, 0x0F, 0x16, 0xFF, 0x11, 0x0A,
+    0x0C, 0x13, 0xFF, 0x06, 0x07, 0x0D, 0xFF, 0x02, 0x03, 0x05, 0xFF, 0x05, 0x05, 0x09, 0xFF, 0x08, 0x08, 0x0E, 0xFF, 0x08, 0x09, 0x0E, 0xFF, 0x08,
+    0x0A, 0x0E, 0xFF, 0x07, 0x09, 0x0D, 0xFF, 0x07, 0x09, 0x0C, 0xFF, 0x07, 0x09, 0x0D, 0xFF, 0x08, 0x09, 0x0D, 0xFF, 0x07, 0x0A, 0x0D, 0xFF, 0x07,
+    0x09, 0x0D, 0xFF, 0x06, 0x08, 0x0B, 0xFF, 0x12, 0x17, 0x1A, 0xFF, 0x02, 0x03, 0x06, 0xFF, 0x02, 0x02, 0x04, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x04,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x01,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00,
+    0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x01, 0x03, 0xFF,
+    0x1A, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x01, 0x00, 0x04,
+    0xFF, 0x00, 0x00, 0x03, 0xFF, 0x04, 0x06, 0x0B, 0xFF, 0x0F, 0x12, 0x19, 0xFF, 0x08, 0x08, 0x0D, 0xFF, 0x09, 0x09, 0x0F, 0xFF, 0x07, 0x08, 0x0F,
+    0xFF, 0x07, 0x08, 0x0E, 0xFF, 0x07, 0x07, 0x0E, 0xFF, 0x07, 0x08, 0x0E, 0xFF, 0x07, 0x08, 0x0F, 0xFF, 0x08, 0x09, 0x11, 0xFF, 0x08, 0x0B, 0x12,
+    0xFF, 0x08, 0x0C, 0x13, 0xFF, 0x07, 0x09, 0x0C, 0xFF, 0x53, 0x57, 0x60, 0xFF, 0x6E, 0x75, 0x82, 0xFF, 0x0A, 0x12, 0x1E, 0xFF, 0x2A, 0x31, 0x48,
+    0xFF, 0x3B, 0x41, 0x5A, 0xFF, 0x3A, 0x3E, 0x56, 0xFF, 0x0F, 0x11, 0x1A, 0xFF, 0x80, 0x01, 0x02, 0x04, 0xFF, 0x2F, 0x0F, 0x13, 0x1A, 0xFF, 0x1B,
+    0x1F, 0x29, 0xFF, 0x0F, 0x10, 0x1A, 0xFF, 0x11, 0x11, 0x1D, 0xFF, 0x12, 0x11, 0x1C, 0xFF, 0x12, 0x12, 0x1D, 0xFF, 0x11, 0x13, 0x1E, 0xFF, 0x13,
+    0x14, 0x1F, 0xFF, 0x13, 0x13, 0x20, 0xFF, 0x13, 0x14, 0x20, 0xFF, 0x13, 0x15, 0x22, 0xFF, 0x15, 0x16, 0x23, 0xFF, 0x15, 0x17, 0x24, 0xFF, 0x3A,
+    0x40, 0x51, 0xFF, 0x61, 0x68, 0x7E, 0xFF, 0x1C, 0x1F, 0x33, 0xFF, 0x35, 0x35, 0x4C, 0xFF, 0x30, 0x31, 0x45, 0xFF, 0x09, 0x0C, 0x15, 0xFF, 0x03,
+    0x04, 0x0C, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x03, 0x04, 0x0C, 0xFF, 0x03,
+    0x05, 0x0D, 0xFF, 0x04, 0x05, 0x0D, 0xFF, 0x03, 0x04, 0x0A, 0xFF, 0x10, 0x12, 0x1E, 0xFF, 0x1B, 0x1C, 0x2C, 0xFF, 0x18, 0x1B, 0x29, 0xFF, 0x19,
+    0x1D, 0x2B, 0xFF, 0x1B, 0x1E, 0x2C, 0xFF, 0x1C, 0x1E, 0x2D, 0xFF, 0x1C, 0x1F, 0x2D, 0xFF, 0x1C, 0x1E, 0x2D, 0xFF, 0x1B, 0x1E, 0x2D, 0xFF, 0x1A,
+    0x1E, 0x2D, 0xFF, 0x1B, 0x1E, 0x2D, 0xFF, 0x1D, 0x1F, 0x2F, 0xFF, 0x19, 0x1C, 0x2C, 0xFF, 0x19, 0x1C, 0x29, 0xFF, 0x38, 0x39, 0x4D, 0xFF, 0x0D,
+    0x10, 0x1A, 0xFF, 0x1F, 0x1F, 0x32, 0xFF, 0x0C, 0x0D, 0x19, 0xFF, 0x01, 0x02, 0x08, 0xFF, 0x03, 0x04, 0x0D, 0xFF, 0x81, 0x03, 0x05, 0x0C, 0xFF,
+    0x2C, 0x03, 0x06, 0x0D, 0xFF, 0x03, 0x07, 0x10, 0xFF, 0x04, 0x07, 0x10, 0xFF, 0x03, 0x06, 0x0F, 0xFF, 0x0E, 0x10, 0x17, 0xFF, 0x32, 0x33, 0x42,
+    0xFF, 0x27, 0x28, 0x39, 0xFF, 0x21, 0x24, 0x34, 0xFF, 0x24, 0x26, 0x36, 0xFF, 0x24, 0x27, 0x37, 0xFF, 0x24, 0x27, 0x36, 0xFF, 0x23, 0x27, 0x36,
+    0xFF, 0x22, 0x26, 0x36, 0xFF, 0x23, 0x26, 0x36, 0xFF, 0x22, 0x27, 0x36, 0xFF, 0x22, 0x26, 0x36, 0xFF, 0x21, 0x24, 0x34, 0xFF, 0x23, 0x27, 0x36,
+    0xFF, 0x62, 0x67, 0x7B, 0xFF, 0x65, 0x6A, 0x80, 0xFF, 0x36, 0x3B, 0x4C, 0xFF, 0x03, 0x04, 0x0B, 0xFF, 0x06, 0x09, 0x14, 0xFF, 0x05, 0x08, 0x13,
+    0xFF, 0x05, 0x07, 0x12, 0xFF, 0x05, 0x06, 0x12, 0xFF, 0x05, 0x07, 0x13, 0xFF, 0x05, 0x06, 0x11, 0xFF, 0x02, 0x04, 0x0E, 0xFF, 0x07, 0x08, 0x13,
+    0xFF, 0x19, 0x1D, 0x28, 0xFF, 0x22, 0x25, 0x33, 0xFF, 0x22, 0x25, 0x35, 0xFF, 0x23, 0x28, 0x36, 0xFF, 0x24, 0x29, 0x38, 0xFF, 0x26, 0x29, 0x39,
+    0xFF, 0x26, 0x29, 0x37, 0xFF, 0x24, 0x29, 0x36, 0xFF, 0x25, 0x29, 0x37, 0xFF, 0x25, 0x29, 0x36, 0xFF, 0x26, 0x29, 0x37, 0xFF, 0x26, 0x2A, 0x38,
+    0xFF, 0x27, 0x2A, 0x38, 0xFF, 0x27, 0x2B, 0x3A, 0xFF, 0x28, 0x2C, 0x3B, 0xFF, 0x80, 0x29, 0x2D, 0x3C, 0xFF, 0x17, 0x29, 0x2C, 0x3D, 0xFF, 0x28,
+    0x2C, 0x3B, 0xFF, 0x28, 0x2C, 0x3C, 0xFF, 0x26, 0x2A, 0x39, 0xFF, 0x24, 0x27, 0x36, 0xFF, 0x23, 0x26, 0x34, 0xFF, 0x24, 0x28, 0x36, 0xFF, 0x24,
+    0x27, 0x36, 0xFF, 0x25, 0x27, 0x37, 0xFF, 0x25, 0x28, 0x37, 0xFF, 0x26, 0x28, 0x38, 0xFF, 0x26, 0x29, 0x38, 0xFF, 0x26, 0x29, 0x39, 0xFF, 0x27,
+    0x29, 0x39, 0xFF, 0x24, 0x28, 0x35, 0xFF, 0x23, 0x26, 0x34, 0xFF, 0x24, 0x26, 0x35, 0xFF, 0x22, 0x26, 0x33, 0xFF, 0x14, 0x17, 0x20, 0xFF, 0x03,
+    0x05, 0x0B, 0xFF, 0x05, 0x07, 0x0E, 0xFF, 0x04, 0x07, 0x0F, 0xFF, 0x04, 0x06, 0x0E, 0xFF, 0x03, 0x06, 0x0D, 0xFF, 0x81, 0x04, 0x06, 0x0D, 0xFF,
+    0x0F, 0x03, 0x06, 0x0E, 0xFF, 0x03, 0x07, 0x0F, 0xFF, 0x04, 0x07, 0x0F, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x07, 0x0A, 0x14, 0xFF, 0x1E, 0x22, 0x30,
+    0xFF, 0x2C, 0x2F, 0x41, 0xFF, 0x1F, 0x23, 0x30, 0xFF, 0x24, 0x27, 0x37, 0xFF, 0x22, 0x25, 0x35, 0xFF, 0x23, 0x26, 0x35, 0xFF, 0x23, 0x27, 0x35,
+    0xFF, 0x25, 0x29, 0x38, 0xFF, 0x25, 0x28, 0x38, 0xFF, 0x25, 0x29, 0x38, 0xFF, 0x25, 0x28, 0x38, 0xFF, 0x81, 0x26, 0x29, 0x39, 0xFF, 0x04, 0x25,
+    0x2A, 0x39, 0xFF, 0x25, 0x29, 0x39, 0xFF, 0x26, 0x2A, 0x39, 0xFF, 0x26, 0x2A, 0x3A, 0xFF, 0x25, 0x2A, 0x39, 0xFF, 0x80, 0x24, 0x28, 0x37, 0xFF,
+    0x0D, 0x22, 0x27, 0x36, 0xFF, 0x21, 0x26, 0x35, 0xFF, 0x23, 0x28, 0x37, 0xFF, 0x23, 0x28, 0x38, 0xFF, 0x23, 0x29, 0x38, 0xFF, 0x22, 0x27, 0x36,
+    0xFF, 0x21, 0x26, 0x34, 0xFF, 0x1E, 0x23, 0x31, 0xFF, 0x20, 0x26, 0x35, 0xFF, 0x39, 0x3F, 0x52, 0xFF, 0x26, 0x2A, 0x3B, 0xFF, 0x24, 0x28, 0x39,
+    0xFF, 0x25, 0x28, 0x39, 0xFF, 0x23, 0x27, 0x38, 0xFF, 0x80, 0x23, 0x27, 0x37, 0xFF, 0x10, 0x24, 0x27, 0x37, 0xFF, 0x23, 0x27, 0x37, 0xFF, 0x22,
+    0x26, 0x36, 0xFF, 0x20, 0x25, 0x34, 0xFF, 0x20, 0x23, 0x34, 0xFF, 0x2D, 0x2E, 0x3F, 0xFF, 0x0F, 0x12, 0x1C, 0xFF, 0x02, 0x05, 0x0C, 0xFF, 0x03,
+    0x05, 0x0B, 0xFF, 0x15, 0x18, 0x22, 0xFF, 0x3E, 0x43, 0x55, 0xFF, 0x27, 0x2B, 0x3C, 0xFF, 0x63, 0x6A, 0x7B, 0xFF, 0x5F, 0x66, 0x79, 0xFF, 0x1E,
+    0x22, 0x31, 0xFF, 0x1A, 0x1D, 0x2A, 0xFF, 0x1B, 0x1E, 0x2B, 0xFF, 0x82, 0x19, 0x1D, 0x2B, 0xFF, 0x14, 0x17, 0x1C, 0x2A, 0xFF, 0x18, 0x1B, 0x29,
+    0xFF, 0x16, 0x1A, 0x27, 0xFF, 0x19, 0x1E, 0x2B, 0xFF, 0x1F, 0x22, 0x2F, 0xFF, 0x0B, 0x0E, 0x16, 0xFF, 0x02, 0x04, 0x0C, 0xFF, 0x03, 0x05, 0x10,
+    0xFF, 0x04, 0x06, 0x10, 0xFF, 0x04, 0x06, 0x12, 0xFF, 0x04, 0x05, 0x10, 0xFF, 0x05, 0x06, 0x0E, 0xFF, 0x1F, 0x20, 0x30, 0xFF, 0x23, 0x25, 0x36,
+    0xFF, 0x13, 0x15, 0x21, 0xFF, 0x16, 0x17, 0x23, 0xFF, 0x20, 0x21, 0x2F, 0xFF, 0x0E, 0x0F, 0x18, 0xFF, 0x0A, 0x0C, 0x14, 0xFF, 0x0D, 0x0F, 0x17,
+    0xFF, 0x0D, 0x0E, 0x16, 0xFF, 0x80, 0x0D, 0x0F, 0x16, 0xFF, 0x04, 0x0C, 0x0E, 0x17, 0xFF, 0x0C, 0x0E, 0x16, 0xFF, 0x0C, 0x0F, 0x16, 0xFF, 0x0C,
+    0x0F, 0x17, 0xFF, 0x0D, 0x0F, 0x17, 0xFF, 0x80, 0x0C, 0x0F, 0x17, 0xFF, 0x07, 0x0D, 0x0F, 0x17, 0xFF, 0x0C, 0x0F, 0x16, 0xFF, 0x0C, 0x0F, 0x17,
+    0xFF, 0x0B, 0x0F, 0x16, 0xFF, 0x0B, 0x0E, 0x15, 0xFF, 0x0B, 0x0F, 0x16, 0xFF, 0x0C, 0x0E, 0x16, 0xFF, 0x0C, 0x0E, 0x17, 0xFF, 0x80, 0x0C, 0x0E,
+    0x16, 0xFF, 0x14, 0x0C, 0x0E, 0x15, 0xFF, 0x0C, 0x0E, 0x16, 0xFF, 0x0B, 0x0D, 0x14, 0xFF, 0x08, 0x09, 0x10, 0xFF, 0x1A, 0x1B, 0x23, 0xFF, 0x3D,
+    0x41, 0x4D, 0xFF, 0x1E, 0x1F, 0x29, 0xFF, 0x04, 0x04, 0x08, 0xFF, 0x07, 0x08, 0x0E, 0xFF, 0x07, 0x09, 0x0E, 0xFF, 0x07, 0x09, 0x0D, 0xFF, 0x07,
+    0x08, 0x0C, 0xFF, 0x06, 0x08, 0x0C, 0xFF, 0x06, 0x07, 0x0C, 0xFF, 0x06, 0x08, 0x0C, 0xFF, 0x06, 0x08, 0x0B, 0xFF, 0x05, 0x07, 0x0A, 0xFF, 0x12,
+    0x17, 0x19, 0xFF, 0x02, 0x03, 0x05, 0xFF, 0x02, 0x02, 0x05, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x81, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x01, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x08, 0x00, 0x01, 0x00, 0xFF, 0x01,
+    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01,
+    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x0E, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x00, 0x03,
+    0xFF, 0x01, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x01, 0x00, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x03,
+    0xFF, 0x04, 0x06, 0x09, 0xFF, 0x0F, 0x12, 0x18, 0xFF, 0x08, 0x08, 0x0D, 0xFF, 0x08, 0x08, 0x0E, 0xFF, 0x08, 0x09, 0x0E, 0xFF, 0x08, 0x08, 0x0E,
+    0xFF, 0x80, 0x07, 0x08, 0x0D, 0xFF, 0x01, 0x07, 0x08, 0x0E, 0xFF, 0x07, 0x08, 0x10, 0xFF, 0x80, 0x07, 0x0A, 0x11, 0xFF, 0x0F, 0x06, 0x07, 0x0B,
+    0xFF, 0x51, 0x55, 0x5D, 0xFF, 0x6E, 0x75, 0x80, 0xFF, 0x06, 0x0F, 0x1B, 0xFF, 0x28, 0x2E, 0x44, 0xFF, 0x39, 0x3D, 0x56, 0xFF, 0x37, 0x3B, 0x54,
+    0xFF, 0x0D, 0x10, 0x1A, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x03, 0xFF, 0x0D, 0x10, 0x17, 0xFF, 0x18, 0x1B, 0x26, 0xFF, 0x0E, 0x0E, 0x17,
+    0xFF, 0x10, 0x10, 0x1A, 0xFF, 0x10, 0x10, 0x1B, 0xFF, 0x11, 0x10, 0x1B, 0xFF, 0x80, 0x11, 0x12, 0x1C, 0xFF, 0x0A, 0x12, 0x11, 0x1D, 0xFF, 0x13,
+    0x14, 0x1E, 0xFF, 0x13, 0x15, 0x21, 0xFF, 0x16, 0x16, 0x23, 0xFF, 0x14, 0x16, 0x23, 0xFF, 0x39, 0x3F, 0x4E, 0xFF, 0x5E, 0x66, 0x7B, 0xFF, 0x1C,
+    0x1F, 0x31, 0xFF, 0x35, 0x36, 0x4A, 0xFF, 0x30, 0x32, 0x45, 0xFF, 0x0A, 0x0D, 0x15, 0xFF, 0x80, 0x03, 0x04, 0x0C, 0xFF, 0x03, 0x03, 0x05, 0x0B,
+    0xFF, 0x03, 0x04, 0x0C, 0xFF, 0x02, 0x05, 0x0B, 0xFF, 0x02, 0x05, 0x0C, 0xFF, 0x80, 0x03, 0x05, 0x0C, 0xFF, 0x04, 0x02, 0x03, 0x08, 0xFF, 0x0E,
+    0x0E, 0x1A, 0xFF, 0x1A, 0x1C, 0x2A, 0xFF, 0x16, 0x18, 0x25, 0xFF, 0x19, 0x1C, 0x2A, 0xFF, 0x80, 0x19, 0x1D, 0x2B, 0xFF, 0x3D, 0x1A, 0x1E, 0x2B,
+    0xFF, 0x1A, 0x1D, 0x2B, 0xFF, 0x19, 0x1C, 0x2A, 0xFF, 0x19, 0x1C, 0x29, 0xFF, 0x19, 0x1B, 0x2A, 0xFF, 0x1A, 0x1D, 0x2B, 0xFF, 0x18, 0x1B, 0x2A,
+    0xFF, 0x2F, 0x33, 0x43, 0xFF, 0x25, 0x29, 0x37, 0xFF, 0x18, 0x17, 0x27, 0xFF, 0x15, 0x17, 0x23, 0xFF, 0x02, 0x03, 0x0B, 0xFF, 0x02, 0x03, 0x09,
+    0xFF, 0x02, 0x05, 0x0B, 0xFF, 0x03, 0x05, 0x0B, 0xFF, 0x02, 0x05, 0x0B, 0xFF, 0x02, 0x05, 0x0C, 0xFF, 0x02, 0x05, 0x0D, 0xFF, 0x03, 0x06, 0x0E,
+    0xFF, 0x03, 0x06, 0x0F, 0xFF, 0x03, 0x06, 0x0E, 0xFF, 0x0D, 0x0F, 0x16, 0xFF, 0x30, 0x30, 0x3F, 0xFF, 0x25, 0x26, 0x36, 0xFF, 0x20, 0x23, 0x32,
+    0xFF, 0x22, 0x25, 0x34, 0xFF, 0x22, 0x26, 0x35, 0xFF, 0x22, 0x25, 0x33, 0xFF, 0x21, 0x24, 0x34, 0xFF, 0x1E, 0x23, 0x32, 0xFF, 0x1E, 0x22, 0x31,
+    0xFF, 0x20, 0x24, 0x32, 0xFF, 0x22, 0x26, 0x35, 0xFF, 0x21, 0x24, 0x33, 0xFF, 0x23, 0x26, 0x35, 0xFF, 0x62, 0x66, 0x79, 0xFF, 0x65, 0x69, 0x7F,
+    0xFF, 0x36, 0x3B, 0x4B, 0xFF, 0x04, 0x06, 0x0C, 0xFF, 0x06, 0x09, 0x14, 0xFF, 0x05, 0x07, 0x12, 0xFF, 0x04, 0x07, 0x12, 0xFF, 0x04, 0x07, 0x11,
+    0xFF, 0x04, 0x06, 0x10, 0xFF, 0x04, 0x05, 0x10, 0xFF, 0x05, 0x07, 0x11, 0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x05, 0x07, 0x11, 0xFF, 0x17, 0x1C, 0x27,
+    0xFF, 0x20, 0x24, 0x30, 0xFF, 0x22, 0x25, 0x32, 0xFF, 0x25, 0x26, 0x35, 0xFF, 0x24, 0x27, 0x35, 0xFF, 0x23, 0x26, 0x34, 0xFF, 0x23, 0x26, 0x35,
+    0xFF, 0x23, 0x27, 0x35, 0xFF, 0x23, 0x27, 0x34, 0xFF, 0x24, 0x27, 0x35, 0xFF, 0x23, 0x27, 0x35, 0xFF, 0x25, 0x28, 0x35, 0xFF, 0x26, 0x29, 0x37,
+    0xFF, 0x26, 0x2A, 0x38, 0xFF, 0x80, 0x27, 0x2B, 0x3A, 0xFF, 0x09, 0x28, 0x2B, 0x3A, 0xFF, 0x26, 0x2A, 0x38, 0xFF, 0x26, 0x2A, 0x39, 0xFF, 0x24,
+    0x28, 0x36, 0xFF, 0x23, 0x26, 0x34, 0xFF, 0x22, 0x25, 0x33, 0xFF, 0x24, 0x26, 0x34, 0xFF, 0x23, 0x26, 0x33, 0xFF, 0x25, 0x27, 0x35, 0xFF, 0x24,
+    0x27, 0x34, 0xFF, 0x80, 0x24, 0x28, 0x36, 0xFF, 0x80, 0x25, 0x28, 0x37, 0xFF, 0x09, 0x22, 0x25, 0x33, 0xFF, 0x23, 0x25, 0x32, 0xFF, 0x22, 0x25,
+    0x33, 0xFF, 0x14, 0x17, 0x21, 0xFF, 0x03, 0x04, 0x0B, 0xFF, 0x04, 0x06, 0x0C, 0xFF, 0x04, 0x06, 0x0D, 0xFF, 0x03, 0x06, 0x0D, 0xFF, 0x03, 0x06,
+    0x0C, 0xFF, 0x04, 0x06, 0x0C, 0xFF, 0x80, 0x03, 0x05, 0x0D, 0xFF, 0x11, 0x03, 0x05, 0x0C, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x03, 0x06, 0x0E, 0xFF,
+    0x04, 0x06, 0x0F, 0xFF, 0x04, 0x06, 0x0E, 0xFF, 0x02, 0x05, 0x0C, 0xFF, 0x06, 0x09, 0x13, 0xFF, 0x1D, 0x20, 0x2E, 0xFF, 0x27, 0x2B, 0x3A, 0xFF,
+    0x20, 0x22, 0x31, 0xFF, 0x21, 0x23, 0x33, 0xFF, 0x21, 0x25, 0x32, 0xFF, 0x22, 0x26, 0x34, 0xFF, 0x24, 0x28, 0x36, 0xFF, 0x24, 0x27, 0x35, 0xFF,
+    0x25, 0x28, 0x37, 0xFF, 0x24, 0x27, 0x36, 0xFF, 0x23, 0x27, 0x36, 0xFF, 0x80, 0x24, 0x28, 0x37, 0xFF, 0x04, 0x23, 0x28, 0x36, 0xFF, 0x23, 0x26,
+    0x35, 0xFF, 0x24, 0x28, 0x37, 0xFF, 0x24, 0x29, 0x38, 0xFF, 0x24, 0x28, 0x36, 0xFF, 0x80, 0x23, 0x27, 0x35, 0xFF, 0x2B, 0x21, 0x25, 0x34, 0xFF,
+    0x20, 0x24, 0x33, 0xFF, 0x21, 0x26, 0x34, 0xFF, 0x22, 0x27, 0x37, 0xFF, 0x23, 0x27, 0x36, 0xFF, 0x1F, 0x24, 0x31, 0xFF, 0x1B, 0x1F, 0x2B, 0xFF,
+    0x22, 0x27, 0x35, 0xFF, 0x27, 0x2E, 0x3D, 0xFF, 0x59, 0x64, 0x78, 0xFF, 0x20, 0x25, 0x33, 0xFF, 0x23, 0x27, 0x37, 0xFF, 0x24, 0x28, 0x37, 0xFF,
+    0x24, 0x27, 0x38, 0xFF, 0x23, 0x27, 0x35, 0xFF, 0x22, 0x25, 0x35, 0xFF, 0x22, 0x26, 0x35, 0xFF, 0x22, 0x26, 0x36, 0xFF, 0x23, 0x26, 0x36, 0xFF,
+    0x21, 0x25, 0x34, 0xFF, 0x22, 0x25, 0x34, 0xFF, 0x2C, 0x2F, 0x3F, 0xFF, 0x10, 0x13, 0x1D, 0xFF, 0x03, 0x06, 0x0E, 0xFF, 0x03, 0x04, 0x0A, 0xFF,
+    0x15, 0x17, 0x20, 0xFF, 0x3C, 0x40, 0x51, 0xFF, 0x24, 0x28, 0x37, 0xFF, 0x60, 0x66, 0x76, 0xFF, 0x5B, 0x61, 0x73, 0xFF, 0x1B, 0x1F, 0x2D, 0xFF,
+    0x16, 0x1A, 0x27, 0xFF, 0x18, 0x1C, 0x29, 0xFF, 0x19, 0x1C, 0x29, 0xFF, 0x17, 0x1C, 0x28, 0xFF, 0x17, 0x1A, 0x27, 0xFF, 0x17, 0x1B, 0x28, 0xFF,
+    0x17, 0x1C, 0x29, 0xFF, 0x17, 0x1B, 0x29, 0xFF, 0x16, 0x19, 0x28, 0xFF, 0x1A, 0x1E, 0x2B, 0xFF, 0x20, 0x24, 0x30, 0xFF, 0x0C, 0x10, 0x18, 0xFF,
+    0x03, 0x04, 0x0D, 0xFF, 0x80, 0x03, 0x05, 0x0F, 0xFF, 0x0E, 0x03, 0x05, 0x10, 0xFF, 0x04, 0x05, 0x0F, 0xFF, 0x03, 0x04, 0x0C, 0xFF, 0x05, 0x06,
+    0x0E, 0xFF, 0x1A, 0x1D, 0x2A, 0xFF, 0x1F, 0x22, 0x2F, 0xFF, 0x0F, 0x11, 0x18, 0xFF, 0x16, 0x17, 0x21, 0xFF, 0x20, 0x22, 0x2F, 0xFF, 0x11, 0x13,
+    0x1B, 0xFF, 0x07, 0x09, 0x0F, 0xFF, 0x0C, 0x0D, 0x15, 0xFF, 0x0D, 0x0F, 0x16, 0xFF, 0x0C, 0x0F, 0x16, 0xFF, 0x0C, 0x0E, 0x16, 0xFF, 0x80, 0x0C,
+    0x0F, 0x16, 0xFF, 0x80, 0x0C, 0x0E, 0x17, 0xFF, 0x17, 0x0B, 0x10, 0x17, 0xFF, 0x0C, 0x0F, 0x17, 0xFF, 0x0C, 0x0F, 0x16, 0xFF, 0x0B, 0x0E, 0x16,
+    0xFF, 0x0B, 0x0F, 0x15, 0xFF, 0x0B, 0x0E, 0x15, 0xFF, 0x0B, 0x0D, 0x14, 0xFF, 0x0B, 0x0E, 0x14, 0xFF, 0x0A, 0x0D, 0x15, 0xFF, 0x0B, 0x0E, 0x16,
+    0xFF, 0x0C, 0x0E, 0x16, 0xFF, 0x0C, 0x0E, 0x15, 0xFF, 0x0C, 0x0E, 0x16, 0xFF, 0x0C, 0x0F, 0x16, 0xFF, 0x0A, 0x0C, 0x13, 0xFF, 0x08, 0x0A, 0x0F,
+    0xFF, 0x31, 0x35, 0x3E, 0xFF, 0x61, 0x68, 0x78, 0xFF, 0x31, 0x35, 0x40, 0xFF, 0x02, 0x03, 0x05, 0xFF, 0x07, 0x08, 0x0C, 0xFF, 0x07, 0x09, 0x0C,
+    0xFF, 0x06, 0x08, 0x0C, 0xFF, 0x06, 0x08, 0x0B, 0xFF, 0x80, 0x06, 0x08, 0x0C, 0xFF, 0x80, 0x06, 0x08, 0x0B, 0xFF, 0x04, 0x06, 0x07, 0x0A, 0xFF,
+    0x12, 0x16, 0x19, 0xFF, 0x02, 0x03, 0x05, 0xFF, 0x02, 0x02, 0x04, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x84, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00,
+    0x01, 0xFF, 0x81, 0x00, 0x00, 0x01, 0xFF, 0x82, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x01, 0x03, 0xFF, 0x1D, 0x00, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x01,
+    0x04, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x04, 0x05, 0x09, 0xFF, 0x0E, 0x11, 0x16, 0xFF, 0x07, 0x08, 0x0C, 0xFF, 0x07, 0x08,
+    0x0E, 0xFF, 0x08, 0x08, 0x0E, 0xFF, 0x08, 0x09, 0x0E, 0xFF, 0x07, 0x09, 0x0E, 0xFF, 0x07, 0x08, 0x0E, 0xFF, 0x07, 0x09, 0x0E, 0xFF, 0x07, 0x09,
+    0x0F, 0xFF, 0x08, 0x0A, 0x10, 0xFF, 0x08, 0x09, 0x10, 0xFF, 0x04, 0x06, 0x0A, 0xFF, 0x4B, 0x50, 0x59, 0xFF, 0x6A, 0x6F, 0x7A, 0xFF, 0x04, 0x0B,
+    0x16, 0xFF, 0x24, 0x2B, 0x40, 0xFF, 0x37, 0x3C, 0x53, 0xFF, 0x35, 0x3A, 0x51, 0xFF, 0x0D, 0x11, 0x1A, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x01,
+    0x02, 0xFF, 0x0B, 0x0F, 0x15, 0xFF, 0x16, 0x1A, 0x24, 0xFF, 0x0C, 0x0D, 0x16, 0xFF, 0x80, 0x10, 0x10, 0x19, 0xFF, 0x80, 0x10, 0x10, 0x1B, 0xFF,
+    0x11, 0x11, 0x12, 0x1C, 0xFF, 0x12, 0x13, 0x1E, 0xFF, 0x12, 0x13, 0x1F, 0xFF, 0x14, 0x14, 0x1F, 0xFF, 0x15, 0x15, 0x21, 0xFF, 0x13, 0x15, 0x20,
+    0xFF, 0x36, 0x3B, 0x49, 0xFF, 0x5B, 0x62, 0x75, 0xFF, 0x1A, 0x1E, 0x2F, 0xFF, 0x33, 0x34, 0x49, 0xFF, 0x2F, 0x30, 0x43, 0xFF, 0x09, 0x0C, 0x14,
+    0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x02, 0x05, 0x0C, 0xFF, 0x03, 0x05, 0x0B, 0xFF, 0x02, 0x05, 0x0B, 0xFF, 0x02, 0x05, 0x0C, 0xFF, 0x03, 0x04, 0x0C,
+    0xFF, 0x80, 0x03, 0x05, 0x0C, 0xFF, 0x04, 0x03, 0x04, 0x0C, 0xFF, 0x05, 0x06, 0x0E, 0xFF, 0x13, 0x16, 0x22, 0xFF, 0x1A, 0x1B, 0x29, 0xFF, 0x17,
+    0x1A, 0x28, 0xFF, 0x80, 0x18, 0x1C, 0x29, 0xFF, 0x80, 0x18, 0x1B, 0x29, 0xFF, 0x0D, 0x17, 0x1A, 0x28, 0xFF, 0x17, 0x1A, 0x26, 0xFF, 0x18, 0x1A,
+    0x28, 0xFF, 0x19, 0x1B, 0x29, 0xFF, 0x19, 0x1C, 0x29, 0xFF, 0x3E, 0x3F, 0x56, 0xFF, 0x13, 0x18, 0x22, 0xFF, 0x21, 0x20, 0x34, 0xFF, 0x11, 0x13,
+    0x20, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x02, 0x05, 0x0B, 0xFF, 0x80, 0x02,
+    0x05, 0x0C, 0xFF, 0x0A, 0x02, 0x05, 0x0D, 0xFF, 0x02, 0x06, 0x0D, 0xFF, 0x02, 0x05, 0x0D, 0xFF, 0x0C, 0x0D, 0x14, 0xFF, 0x2D, 0x2E, 0x3B, 0xFF,
+    0x23, 0x25, 0x34, 0xFF, 0x1E, 0x20, 0x2F, 0xFF, 0x1F, 0x21, 0x30, 0xFF, 0x20, 0x23, 0x32, 0xFF, 0x20, 0x23, 0x31, 0xFF, 0x1E, 0x22, 0x30, 0xFF,
+    0x80, 0x1E, 0x21, 0x30, 0xFF, 0x1A, 0x1E, 0x22, 0x31, 0xFF, 0x21, 0x25, 0x34, 0xFF, 0x21, 0x24, 0x34, 0xFF, 0x20, 0x25, 0x33, 0xFF, 0x60, 0x65,
+    0x78, 0xFF, 0x64, 0x6A, 0x7F, 0xFF, 0x36, 0x3A, 0x4A, 0xFF, 0x04, 0x05, 0x0C, 0xFF, 0x06, 0x08, 0x13, 0xFF, 0x05, 0x06, 0x11, 0xFF, 0x04, 0x06,
+    0x11, 0xFF, 0x04, 0x05, 0x0F, 0xFF, 0x04, 0x05, 0x0E, 0xFF, 0x03, 0x06, 0x0D, 0xFF, 0x05, 0x06, 0x0E, 0xFF, 0x05, 0x06, 0x0F, 0xFF, 0x03, 0x06,
+    0x0D, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x15, 0x1A, 0x23, 0xFF, 0x1F, 0x23, 0x2F, 0xFF, 0x1F, 0x23, 0x30, 0xFF, 0x1F, 0x23, 0x2F, 0xFF, 0x20, 0x24,
+    0x32, 0xFF, 0x22, 0x25, 0x34, 0xFF, 0x22, 0x26, 0x33, 0xFF, 0x22, 0x26, 0x32, 0xFF, 0x23, 0x26, 0x33, 0xFF, 0x80, 0x22, 0x26, 0x33, 0xFF, 0x09,
+    0x22, 0x27, 0x34, 0xFF, 0x24, 0x28, 0x36, 0xFF, 0x25, 0x29, 0x37, 0xFF, 0x26, 0x2A, 0x39, 0xFF, 0x26, 0x29, 0x39, 0xFF, 0x24, 0x28, 0x37, 0xFF,
+    0x23, 0x27, 0x37, 0xFF, 0x23, 0x27, 0x36, 0xFF, 0x24, 0x26, 0x34, 0xFF, 0x23, 0x26, 0x34, 0xFF, 0x80, 0x22, 0x25, 0x33, 0xFF, 0x09, 0x23, 0x26,
+    0x33, 0xFF, 0x22, 0x25, 0x33, 0xFF, 0x23, 0x26, 0x33, 0xFF, 0x23, 0x26, 0x34, 0xFF, 0x21, 0x25, 0x32, 0xFF, 0x20, 0x23, 0x30, 0xFF, 0x26, 0x29,
+    0x36, 0xFF, 0x1E, 0x22, 0x2D, 0xFF, 0x0E, 0x10, 0x1A, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x80, 0x03, 0x06, 0x0C, 0xFF, 0x02, 0x02, 0x05, 0x0B, 0xFF,
+    0x03, 0x05, 0x0C, 0xFF, 0x02, 0x05, 0x0C, 0xFF, 0x83, 0x03, 0x05, 0x0C, 0xFF, 0x28, 0x04, 0x05, 0x0C, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x03, 0x05,
+    0x0E, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x03, 0x04, 0x0C, 0xFF, 0x05, 0x07, 0x10, 0xFF, 0x15, 0x1A, 0x25, 0xFF, 0x25, 0x28, 0x37, 0xFF, 0x1E, 0x21,
+    0x2F, 0xFF, 0x1F, 0x22, 0x30, 0xFF, 0x23, 0x26, 0x36, 0xFF, 0x23, 0x27, 0x35, 0xFF, 0x23, 0x26, 0x35, 0xFF, 0x23, 0x26, 0x36, 0xFF, 0x22, 0x25,
+    0x35, 0xFF, 0x22, 0x25, 0x34, 0xFF, 0x23, 0x27, 0x35, 0xFF, 0x22, 0x27, 0x35, 0xFF, 0x23, 0x27, 0x34, 0xFF, 0x21, 0x25, 0x33, 0xFF, 0x22, 0x27,
+    0x36, 0xFF, 0x24, 0x27, 0x35, 0xFF, 0x23, 0x27, 0x34, 0xFF, 0x22, 0x27, 0x35, 0xFF, 0x21, 0x27, 0x35, 0xFF, 0x21, 0x25, 0x34, 0xFF, 0x20, 0x24,
+    0x33, 0xFF, 0x21, 0x24, 0x33, 0xFF, 0x21, 0x25, 0x33, 0xFF, 0x20, 0x24, 0x32, 0xFF, 0x18, 0x1E, 0x29, 0xFF, 0x1A, 0x1D, 0x2A, 0xFF, 0x31, 0x36,
+    0x48, 0xFF, 0x27, 0x2D, 0x3B, 0xFF, 0x62, 0x6C, 0x7E, 0xFF, 0x15, 0x1A, 0x26, 0xFF, 0x22, 0x24, 0x34, 0xFF, 0x24, 0x27, 0x36, 0xFF, 0x23, 0x26,
+    0x36, 0xFF, 0x21, 0x25, 0x33, 0xFF, 0x21, 0x24, 0x33, 0xFF, 0x82, 0x21, 0x25, 0x34, 0xFF, 0x27, 0x21, 0x25, 0x33, 0xFF, 0x2A, 0x2E, 0x3E, 0xFF,
+    0x10, 0x13, 0x1E, 0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x03, 0x04, 0x0A, 0xFF, 0x14, 0x17, 0x20, 0xFF, 0x3A, 0x3E, 0x4F, 0xFF, 0x20, 0x24, 0x32, 0xFF,
+    0x5B, 0x61, 0x72, 0xFF, 0x56, 0x5C, 0x6F, 0xFF, 0x19, 0x1C, 0x2A, 0xFF, 0x15, 0x18, 0x24, 0xFF, 0x18, 0x1C, 0x27, 0xFF, 0x17, 0x1B, 0x27, 0xFF,
+    0x16, 0x1A, 0x26, 0xFF, 0x16, 0x1A, 0x25, 0xFF, 0x15, 0x1A, 0x27, 0xFF, 0x16, 0x1A, 0x28, 0xFF, 0x17, 0x1A, 0x29, 0xFF, 0x16, 0x1A, 0x28, 0xFF,
+    0x1A, 0x1E, 0x2A, 0xFF, 0x1F, 0x23, 0x2F, 0xFF, 0x0B, 0x0F, 0x18, 0xFF, 0x03, 0x04, 0x0D, 0xFF, 0x04, 0x05, 0x0E, 0xFF, 0x03, 0x05, 0x0E, 0xFF,
+    0x02, 0x05, 0x0E, 0xFF, 0x03, 0x05, 0x0E, 0xFF, 0x04, 0x05, 0x0D, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x04, 0x06, 0x0D, 0xFF, 0x13, 0x15, 0x20, 0xFF,
+    0x1A, 0x1B, 0x27, 0xFF, 0x11, 0x11, 0x1A, 0xFF, 0x12, 0x14, 0x1D, 0xFF, 0x1F, 0x22, 0x2D, 0xFF, 0x10, 0x13, 0x1A, 0xFF, 0x0A, 0x0C, 0x13, 0xFF,
+    0x0D, 0x0F, 0x17, 0xFF, 0x0C, 0x0E, 0x16, 0xFF, 0x80, 0x0C, 0x0F, 0x16, 0xFF, 0x01, 0x0C, 0x0E, 0x16, 0xFF, 0x0C, 0x0F, 0x16, 0xFF, 0x80, 0x0C,
+    0x0E, 0x16, 0xFF, 0x00, 0x0C, 0x0F, 0x16, 0xFF, 0x80, 0x0B, 0x0E, 0x15, 0xFF, 0x02, 0x0A, 0x0D, 0x14, 0xFF, 0x0B, 0x0D, 0x14, 0xFF, 0x0A, 0x0D,
+    0x14, 0xFF, 0x81, 0x0A, 0x0C, 0x14, 0xFF, 0x09, 0x0A, 0x0D, 0x15, 0xFF, 0x0B, 0x0E, 0x15, 0xFF, 0x0C, 0x0F, 0x16, 0xFF, 0x0B, 0x0D, 0x14, 0xFF,
+    0x0C, 0x0D, 0x15, 0xFF, 0x2E, 0x2F, 0x3B, 0xFF, 0x37, 0x39, 0x44, 0xFF, 0x62, 0x69, 0x78, 0xFF, 0x30, 0x35, 0x3F, 0xFF, 0x02, 0x03, 0x04, 0xFF,
+    0x80, 0x07, 0x08, 0x0B, 0xFF, 0x01, 0x06, 0x08, 0x0B, 0xFF, 0x05, 0x08, 0x0B, 0xFF, 0x81, 0x06, 0x08, 0x0B, 0xFF, 0x05, 0x06, 0x07, 0x0A, 0xFF,
+    0x05, 0x06, 0x08, 0xFF, 0x10, 0x15, 0x17, 0xFF, 0x02, 0x03, 0x04, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x89, 0x00, 0x00, 0x00,
+    0xFF, 0x05, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0x82, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0x02, 0xFF, 0x80, 0x00, 0x01, 0x03, 0xFF, 0x21, 0x01, 0x00, 0x04, 0xFF, 0x01, 0x01,
+    0x04, 0xFF, 0x01, 0x00, 0x05, 0xFF, 0x00, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x03, 0x05, 0x08, 0xFF, 0x0D, 0x10, 0x16, 0xFF, 0x06, 0x08,
+    0x0B, 0xFF, 0x07, 0x08, 0x0C, 0xFF, 0x08, 0x08, 0x0E, 0xFF, 0x08, 0x0A, 0x0F, 0xFF, 0x07, 0x0A, 0x0F, 0xFF, 0x08, 0x09, 0x10, 0xFF, 0x07, 0x09,
+    0x0F, 0xFF, 0x07, 0x09, 0x0E, 0xFF, 0x07, 0x09, 0x10, 0xFF, 0x08, 0x09, 0x10, 0xFF, 0x03, 0x05, 0x08, 0xFF, 0x43, 0x4A, 0x55, 0xFF, 0x60, 0x66,
+    0x73, 0xFF, 0x04, 0x08, 0x14, 0xFF, 0x23, 0x29, 0x3B, 0xFF, 0x35, 0x39, 0x4F, 0xFF, 0x35, 0x39, 0x50, 0xFF, 0x0E, 0x11, 0x1B, 0xFF, 0x00, 0x02,
+    0x05, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x0B, 0x0E, 0x14, 0xFF, 0x16, 0x19, 0x21, 0xFF, 0x0C, 0x0D, 0x15, 0xFF, 0x0F, 0x0F, 0x18, 0xFF, 0x0F, 0x11,
+    0x19, 0xFF, 0x10, 0x11, 0x1A, 0xFF, 0x10, 0x11, 0x1B, 0xFF, 0x80, 0x11, 0x12, 0x1C, 0xFF, 0x0D, 0x12, 0x13, 0x1D, 0xFF, 0x13, 0x14, 0x1E, 0xFF,
+    0x13, 0x14, 0x1F, 0xFF, 0x11, 0x12, 0x1E, 0xFF, 0x32, 0x36, 0x44, 0xFF, 0x56, 0x5D, 0x70, 0xFF, 0x1B, 0x1E, 0x2E, 0xFF, 0x34, 0x35, 0x49, 0xFF,
+    0x2F, 0x2F, 0x42, 0xFF, 0x09, 0x0C, 0x14, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x03, 0x05, 0x0B, 0xFF, 0x03, 0x04, 0x0A, 0xFF, 0x02, 0x05, 0x0B, 0xFF,
+    0x80, 0x02, 0x04, 0x0B, 0xFF, 0x15, 0x02, 0x05, 0x0B, 0xFF, 0x02, 0x04, 0x0C, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x12, 0x14,
+    0x20, 0xFF, 0x1A, 0x1C, 0x2A, 0xFF, 0x16, 0x18, 0x24, 0xFF, 0x17, 0x1B, 0x27, 0xFF, 0x18, 0x1B, 0x28, 0xFF, 0x18, 0x1A, 0x27, 0xFF, 0x17, 0x1A,
+    0x27, 0xFF, 0x16, 0x19, 0x26, 0xFF, 0x17, 0x19, 0x25, 0xFF, 0x16, 0x1A, 0x26, 0xFF, 0x1A, 0x1C, 0x2B, 0xFF, 0x27, 0x2A, 0x39, 0xFF, 0x31, 0x33,
+    0x45, 0xFF, 0x16, 0x17, 0x26, 0xFF, 0x18, 0x1A, 0x28, 0xFF, 0x05, 0x07, 0x10, 0xFF, 0x02, 0x03, 0x07, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x81, 0x02,
+    0x04, 0x0A, 0xFF, 0x0C, 0x01, 0x04, 0x0A, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x02, 0x04, 0x0C, 0xFF, 0x02, 0x05, 0x0C, 0xFF, 0x03, 0x05, 0x0C, 0xFF,
+    0x0A, 0x0C, 0x12, 0xFF, 0x2A, 0x2C, 0x39, 0xFF, 0x22, 0x24, 0x32, 0xFF, 0x1D, 0x20, 0x2D, 0xFF, 0x1E, 0x21, 0x2E, 0xFF, 0x1F, 0x22, 0x2F, 0xFF,
+    0x20, 0x23, 0x31, 0xFF, 0x1F, 0x22, 0x2F, 0xFF, 0x80, 0x1E, 0x21, 0x2F, 0xFF, 0x0C, 0x1F, 0x22, 0x30, 0xFF, 0x21, 0x24, 0x32, 0xFF, 0x21, 0x24,
+    0x33, 0xFF, 0x21, 0x26, 0x35, 0xFF, 0x60, 0x65, 0x78, 0xFF, 0x63, 0x69, 0x7E, 0xFF, 0x35, 0x3A, 0x4A, 0xFF, 0x04, 0x05, 0x0B, 0xFF, 0x05, 0x08,
+    0x12, 0xFF, 0x04, 0x06, 0x0F, 0xFF, 0x03, 0x05, 0x0E, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x04, 0x05, 0x0D, 0xFF, 0x80, 0x03, 0x05, 0x0D, 0xFF, 0x00,
+    0x03, 0x06, 0x0E, 0xFF, 0x80, 0x03, 0x05, 0x0D, 0xFF, 0x12, 0x02, 0x03, 0x0B, 0xFF, 0x07, 0x09, 0x12, 0xFF, 0x18, 0x1B, 0x26, 0xFF, 0x22, 0x25,
+    0x31, 0xFF, 0x1E, 0x21, 0x2F, 0xFF, 0x1E, 0x21, 0x2E, 0xFF, 0x1F, 0x23, 0x30, 0xFF, 0x21, 0x25, 0x32, 0xFF, 0x22, 0x25, 0x31, 0xFF, 0x22, 0x25,
+    0x33, 0xFF, 0x21, 0x25, 0x32, 0xFF, 0x20, 0x25, 0x33, 0xFF, 0x22, 0x26, 0x34, 0xFF, 0x24, 0x27, 0x35, 0xFF, 0x25, 0x28, 0x38, 0xFF, 0x25, 0x29,
+    0x38, 0xFF, 0x23, 0x27, 0x36, 0xFF, 0x23, 0x26, 0x35, 0xFF, 0x22, 0x26, 0x34, 0xFF, 0x80, 0x23, 0x25, 0x33, 0xFF, 0x0B, 0x21, 0x24, 0x32, 0xFF,
+    0x22, 0x24, 0x32, 0xFF, 0x22, 0x24, 0x31, 0xFF, 0x21, 0x24, 0x30, 0xFF, 0x1F, 0x23, 0x2F, 0xFF, 0x1E, 0x22, 0x2E, 0xFF, 0x21, 0x24, 0x32, 0xFF,
+    0x21, 0x24, 0x30, 0xFF, 0x19, 0x1D, 0x26, 0xFF, 0x09, 0x0C, 0x14, 0xFF, 0x03, 0x05, 0x09, 0xFF, 0x04, 0x07, 0x0C, 0xFF, 0x80, 0x03, 0x06, 0x0C,
+    0xFF, 0x18, 0x03, 0x05, 0x0A, 0xFF, 0x03, 0x05, 0x0B, 0xFF, 0x02, 0x05, 0x0B, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x02, 0x05, 0x0C, 0xFF, 0x02, 0x05,
+    0x0B, 0xFF, 0x02, 0x05, 0x0C, 0xFF, 0x02, 0x05, 0x0B, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x03, 0x05,
+    0x0C, 0xFF, 0x02, 0x05, 0x0C, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x14, 0x17, 0x23, 0xFF, 0x1F, 0x24, 0x30, 0xFF, 0x22, 0x24,
+    0x35, 0xFF, 0x1E, 0x22, 0x2F, 0xFF, 0x1F, 0x22, 0x30, 0xFF, 0x22, 0x26, 0x35, 0xFF, 0x23, 0x27, 0x36, 0xFF, 0x23, 0x26, 0x35, 0xFF, 0x23, 0x25,
+    0x35, 0xFF, 0x23, 0x26, 0x34, 0xFF, 0x81, 0x22, 0x26, 0x34, 0xFF, 0x80, 0x23, 0x27, 0x35, 0xFF, 0x14, 0x23, 0x27, 0x34, 0xFF, 0x23, 0x26, 0x35,
+    0xFF, 0x22, 0x26, 0x35, 0xFF, 0x21, 0x26, 0x34, 0xFF, 0x21, 0x25, 0x33, 0xFF, 0x20, 0x25, 0x34, 0xFF, 0x20, 0x23, 0x32, 0xFF, 0x1C, 0x21, 0x2D,
+    0xFF, 0x1E, 0x21, 0x2E, 0xFF, 0x17, 0x1B, 0x28, 0xFF, 0x2B, 0x32, 0x43, 0xFF, 0x1E, 0x26, 0x32, 0xFF, 0x60, 0x69, 0x7B, 0xFF, 0x0F, 0x13, 0x1C,
+    0xFF, 0x1F, 0x22, 0x2F, 0xFF, 0x21, 0x24, 0x33, 0xFF, 0x20, 0x23, 0x32, 0xFF, 0x1F, 0x23, 0x31, 0xFF, 0x1F, 0x22, 0x31, 0xFF, 0x20, 0x24, 0x32,
+    0xFF, 0x20, 0x24, 0x33, 0xFF, 0x80, 0x20, 0x23, 0x32, 0xFF, 0x11, 0x20, 0x24, 0x33, 0xFF, 0x2B, 0x2E, 0x3D, 0xFF, 0x12, 0x16, 0x1F, 0xFF, 0x04,
+    0x07, 0x0F, 0xFF, 0x03, 0x05, 0x0A, 0xFF, 0x12, 0x16, 0x1F, 0xFF, 0x38, 0x3D, 0x4E, 0xFF, 0x1F, 0x24, 0x31, 0xFF, 0x59, 0x5F, 0x70, 0xFF, 0x52,
+    0x58, 0x6C, 0xFF, 0x17, 0x1A, 0x27, 0xFF, 0x15, 0x18, 0x22, 0xFF, 0x17, 0x1B, 0x27, 0xFF, 0x16, 0x1A, 0x26, 0xFF, 0x15, 0x18, 0x25, 0xFF, 0x16,
+    0x19, 0x25, 0xFF, 0x15, 0x19, 0x26, 0xFF, 0x15, 0x1A, 0x26, 0xFF, 0x80, 0x16, 0x1A, 0x27, 0xFF, 0x04, 0x19, 0x1D, 0x29, 0xFF, 0x1E, 0x22, 0x2D,
+    0xFF, 0x09, 0x0E, 0x16, 0xFF, 0x03, 0x05, 0x0E, 0xFF, 0x04, 0x05, 0x0E, 0xFF, 0x80, 0x03, 0x05, 0x0D, 0xFF, 0x00, 0x03, 0x04, 0x0D, 0xFF, 0x80,
+    0x03, 0x05, 0x0C, 0xFF, 0x0C, 0x02, 0x03, 0x0A, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x10, 0x11, 0x1C, 0xFF, 0x15, 0x18, 0x21, 0xFF, 0x13, 0x14, 0x1D,
+    0xFF, 0x0F, 0x12, 0x19, 0xFF, 0x1E, 0x20, 0x2B, 0xFF, 0x14, 0x17, 0x20, 0xFF, 0x0B, 0x0D, 0x15, 0xFF, 0x08, 0x0A, 0x11, 0xFF, 0x0B, 0x0E, 0x15,
+    0xFF, 0x0C, 0x0F, 0x17, 0xFF, 0x0C, 0x0E, 0x16, 0xFF, 0x81, 0x0B, 0x0E, 0x16, 0xFF, 0x12, 0x0B, 0x0E, 0x15, 0xFF, 0x0A, 0x0E, 0x15, 0xFF, 0x0A,
+    0x0E, 0x14, 0xFF, 0x0A, 0x0D, 0x14, 0xFF, 0x0B, 0x0D, 0x14, 0xFF, 0x0A, 0x0D, 0x14, 0xFF, 0x0A, 0x0C, 0x14, 0xFF, 0x0A, 0x0C, 0x13, 0xFF, 0x09,
+    0x0B, 0x13, 0xFF, 0x09, 0x0C, 0x13, 0xFF, 0x0C, 0x0E, 0x15, 0xFF, 0x0A, 0x0C, 0x14, 0xFF, 0x0E, 0x0F, 0x16, 0xFF, 0x26, 0x27, 0x31, 0xFF, 0x2F,
+    0x30, 0x3C, 0xFF, 0x33, 0x37, 0x40, 0xFF, 0x6B, 0x71, 0x81, 0xFF, 0x33, 0x37, 0x43, 0xFF, 0x02, 0x02, 0x03, 0xFF, 0x80, 0x06, 0x08, 0x0B, 0xFF,
+    0x0A, 0x06, 0x08, 0x0A, 0xFF, 0x05, 0x07, 0x0B, 0xFF, 0x06, 0x08, 0x0B, 0xFF, 0x06, 0x07, 0x0A, 0xFF, 0x05, 0x07, 0x0A, 0xFF, 0x05, 0x06, 0x09,
+    0xFF, 0x04, 0x05, 0x07, 0xFF, 0x0F, 0x14, 0x16, 0xFF, 0x02, 0x03, 0x05, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x01, 0x03, 0x04, 0xFF, 0x86, 0x00, 0x00,
+    0x00, 0xFF, 0x80, 0x00, 0x01, 0x00, 0xFF, 0x0D, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF,
+    0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x01, 0xFF,
+    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x01, 0x00, 0x04, 0xFF, 0x04, 0x01, 0x00,
+    0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x03, 0x04, 0x08, 0xFF, 0x0B, 0x0D, 0x13, 0xFF, 0x80, 0x03, 0x03, 0x06, 0xFF, 0x01,
+    0x03, 0x04, 0x08, 0xFF, 0x04, 0x05, 0x09, 0xFF, 0x80, 0x04, 0x06, 0x0A, 0xFF, 0x15, 0x04, 0x05, 0x0A, 0xFF, 0x03, 0x05, 0x0A, 0xFF, 0x03, 0x05,
+    0x09, 0xFF, 0x03, 0x04, 0x08, 0xFF, 0x02, 0x04, 0x06, 0xFF, 0x38, 0x40, 0x4B, 0xFF, 0x53, 0x5A, 0x68, 0xFF, 0x09, 0x0E, 0x19, 0xFF, 0x22, 0x27,
+    0x39, 0xFF, 0x32, 0x37, 0x4C, 0xFF, 0x33, 0x37, 0x4E, 0xFF, 0x0D, 0x11, 0x1C, 0xFF, 0x00, 0x03, 0x08, 0xFF, 0x00, 0x02, 0x05, 0xFF, 0x0A, 0x0D,
+    0x14, 0xFF, 0x13, 0x17, 0x1F, 0xFF, 0x07, 0x08, 0x0E, 0xFF, 0x09, 0x0A, 0x12, 0xFF, 0x0A, 0x0B, 0x14, 0xFF, 0x0B, 0x0C, 0x14, 0xFF, 0x0C, 0x0C,
+    0x15, 0xFF, 0x0C, 0x0D, 0x16, 0xFF, 0x80, 0x0D, 0x0D, 0x16, 0xFF, 0x31, 0x0D, 0x0E, 0x17, 0xFF, 0x0D, 0x0D, 0x17, 0xFF, 0x0C, 0x0E, 0x16, 0xFF,
+    0x2B, 0x31, 0x3E, 0xFF, 0x4C, 0x55, 0x6A, 0xFF, 0x1C, 0x21, 0x31, 0xFF, 0x33, 0x34, 0x49, 0xFF, 0x2D, 0x2E, 0x40, 0xFF, 0x0A, 0x0D, 0x14, 0xFF,
+    0x02, 0x04, 0x09, 0xFF, 0x02, 0x05, 0x09, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x02, 0x05, 0x0A, 0xFF, 0x02, 0x05, 0x0B, 0xFF,
+    0x02, 0x04, 0x0B, 0xFF, 0x03, 0x04, 0x0B, 0xFF, 0x03, 0x05, 0x0B, 0xFF, 0x03, 0x04, 0x0A, 0xFF, 0x0D, 0x0E, 0x19, 0xFF, 0x18, 0x1A, 0x26, 0xFF,
+    0x15, 0x17, 0x23, 0xFF, 0x12, 0x16, 0x22, 0xFF, 0x13, 0x16, 0x21, 0xFF, 0x13, 0x15, 0x21, 0xFF, 0x12, 0x14, 0x23, 0xFF, 0x13, 0x15, 0x23, 0xFF,
+    0x13, 0x14, 0x22, 0xFF, 0x12, 0x15, 0x20, 0xFF, 0x18, 0x1B, 0x27, 0xFF, 0x38, 0x39, 0x4C, 0xFF, 0x1A, 0x1E, 0x2A, 0xFF, 0x22, 0x22, 0x34, 0xFF,
+    0x12, 0x14, 0x20, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x03, 0x04, 0x09, 0xFF, 0x02, 0x03, 0x0A, 0xFF, 0x02, 0x05, 0x09, 0xFF, 0x02, 0x04, 0x0A, 0xFF,
+    0x01, 0x04, 0x0A, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x01, 0x04, 0x0A, 0xFF, 0x02, 0x05, 0x0A, 0xFF, 0x02, 0x05, 0x0B, 0xFF, 0x02, 0x05, 0x0A, 0xFF,
+    0x08, 0x0B, 0x11, 0xFF, 0x28, 0x29, 0x36, 0xFF, 0x1F, 0x21, 0x2E, 0xFF, 0x19, 0x1D, 0x2A, 0xFF, 0x1A, 0x1D, 0x2B, 0xFF, 0x80, 0x1B, 0x1D, 0x2B,
+    0xFF, 0x00, 0x1A, 0x1C, 0x2A, 0xFF, 0x81, 0x1A, 0x1D, 0x2B, 0xFF, 0x08, 0x1A, 0x1E, 0x2C, 0xFF, 0x1D, 0x1F, 0x2F, 0xFF, 0x1E, 0x23, 0x31, 0xFF,
+    0x59, 0x5F, 0x72, 0xFF, 0x61, 0x65, 0x7B, 0xFF, 0x33, 0x38, 0x48, 0xFF, 0x03, 0x05, 0x0B, 0xFF, 0x04, 0x07, 0x0F, 0xFF, 0x03, 0x05, 0x0D, 0xFF,
+    0x81, 0x03, 0x05, 0x0C, 0xFF, 0x00, 0x03, 0x04, 0x0C, 0xFF, 0x81, 0x03, 0x05, 0x0C, 0xFF, 0x0E, 0x03, 0x05, 0x0D, 0xFF, 0x02, 0x05, 0x0C, 0xFF,
+    0x02, 0x05, 0x0B, 0xFF, 0x06, 0x08, 0x0F, 0xFF, 0x0F, 0x12, 0x1A, 0xFF, 0x17, 0x1B, 0x25, 0xFF, 0x20, 0x23, 0x2F, 0xFF, 0x20, 0x23, 0x30, 0xFF,
+    0x1F, 0x22, 0x2E, 0xFF, 0x1E, 0x21, 0x2D, 0xFF, 0x21, 0x24, 0x32, 0xFF, 0x22, 0x25, 0x33, 0xFF, 0x21, 0x24, 0x32, 0xFF, 0x21, 0x25, 0x32, 0xFF,
+    0x21, 0x25, 0x33, 0xFF, 0x80, 0x23, 0x27, 0x35, 0xFF, 0x0E, 0x22, 0x25, 0x34, 0xFF, 0x22, 0x24, 0x33, 0xFF, 0x21, 0x24, 0x32, 0xFF, 0x21, 0x24,
+    0x33, 0xFF, 0x21, 0x24, 0x32, 0xFF, 0x20, 0x23, 0x31, 0xFF, 0x1E, 0x21, 0x2F, 0xFF, 0x1C, 0x1F, 0x2C, 0xFF, 0x1E, 0x21, 0x2C, 0xFF, 0x20, 0x23,
+    0x2F, 0xFF, 0x1F, 0x22, 0x2D, 0xFF, 0x1B, 0x1D, 0x29, 0xFF, 0x14, 0x18, 0x20, 0xFF, 0x04, 0x06, 0x0C, 0xFF, 0x03, 0x05, 0x0B, 0xFF, 0x80, 0x03,
+    0x06, 0x0C, 0xFF, 0x08, 0x03, 0x05, 0x0B, 0xFF, 0x02, 0x05, 0x0B, 0xFF, 0x03, 0x05, 0x0A, 0xFF, 0x02, 0x05, 0x0A, 0xFF, 0x03, 0x06, 0x0B, 0xFF,
+    0x02, 0x05, 0x0A, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x02, 0x05, 0x0B, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x80, 0x02, 0x04, 0x0B, 0xFF, 0x01, 0x03, 0x04,
+    0x0B, 0xFF, 0x03, 0x05, 0x0B, 0xFF, 0x80, 0x03, 0x05, 0x0C, 0xFF, 0x80, 0x03, 0x04, 0x0C, 0xFF, 0x06, 0x02, 0x04, 0x0A, 0xFF, 0x0C, 0x0E, 0x18,
+    0xFF, 0x1A, 0x1E, 0x2A, 0xFF, 0x21, 0x25, 0x32, 0xFF, 0x23, 0x26, 0x34, 0xFF, 0x20, 0x23, 0x32, 0xFF, 0x1F, 0x23, 0x32, 0xFF, 0x80, 0x21, 0x24,
+    0x33, 0xFF, 0x07, 0x20, 0x24, 0x33, 0xFF, 0x21, 0x24, 0x32, 0xFF, 0x21, 0x24, 0x33, 0xFF, 0x21, 0x25, 0x34, 0xFF, 0x21, 0x26, 0x34, 0xFF, 0x21,
+    0x26, 0x33, 0xFF, 0x20, 0x25, 0x33, 0xFF, 0x21, 0x26, 0x33, 0xFF, 0x80, 0x21, 0x26, 0x34, 0xFF, 0x0D, 0x1F, 0x24, 0x31, 0xFF, 0x1A, 0x1F, 0x2B,
+    0xFF, 0x1F, 0x23, 0x31, 0xFF, 0x1C, 0x21, 0x2D, 0xFF, 0x0F, 0x13, 0x1B, 0xFF, 0x0B, 0x0E, 0x15, 0xFF, 0x2A, 0x2F, 0x41, 0xFF, 0x1F, 0x25, 0x32,
+    0xFF, 0x5B, 0x63, 0x76, 0xFF, 0x0D, 0x10, 0x18, 0xFF, 0x17, 0x1B, 0x28, 0xFF, 0x1A, 0x1E, 0x2B, 0xFF, 0x1B, 0x1D, 0x2C, 0xFF, 0x1A, 0x1E, 0x2C,
+    0xFF, 0x82, 0x1A, 0x1D, 0x2C, 0xFF, 0x1C, 0x1A, 0x1D, 0x2B, 0xFF, 0x1A, 0x1E, 0x2C, 0xFF, 0x29, 0x2C, 0x3C, 0xFF, 0x14, 0x18, 0x21, 0xFF, 0x04,
+    0x07, 0x0F, 0xFF, 0x03, 0x04, 0x0A, 0xFF, 0x11, 0x15, 0x1D, 0xFF, 0x37, 0x3C, 0x4C, 0xFF, 0x1E, 0x23, 0x30, 0xFF, 0x58, 0x5F, 0x70, 0xFF, 0x4F,
+    0x55, 0x67, 0xFF, 0x13, 0x17, 0x23, 0xFF, 0x10, 0x13, 0x1E, 0xFF, 0x12, 0x15, 0x20, 0xFF, 0x12, 0x15, 0x21, 0xFF, 0x11, 0x15, 0x21, 0xFF, 0x11,
+    0x15, 0x20, 0xFF, 0x11, 0x14, 0x20, 0xFF, 0x11, 0x14, 0x21, 0xFF, 0x12, 0x15, 0x22, 0xFF, 0x12, 0x15, 0x21, 0xFF, 0x15, 0x19, 0x24, 0xFF, 0x1B,
+    0x1F, 0x2A, 0xFF, 0x09, 0x0D, 0x14, 0xFF, 0x02, 0x04, 0x0C, 0xFF, 0x03, 0x05, 0x0D, 0xFF, 0x03, 0x05, 0x0B, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x03,
+    0x04, 0x0A, 0xFF, 0x80, 0x02, 0x04, 0x0B, 0xFF, 0x12, 0x03, 0x04, 0x0B, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x07, 0x08, 0x0F,
+    0xFF, 0x10, 0x13, 0x1B, 0xFF, 0x13, 0x16, 0x1E, 0xFF, 0x12, 0x14, 0x1C, 0xFF, 0x1B, 0x1E, 0x28, 0xFF, 0x1F, 0x23, 0x2D, 0xFF, 0x17, 0x1A, 0x24,
+    0xFF, 0x11, 0x12, 0x1C, 0xFF, 0x09, 0x0D, 0x14, 0xFF, 0x0A, 0x0D, 0x15, 0xFF, 0x0C, 0x0F, 0x18, 0xFF, 0x0C, 0x10, 0x17, 0xFF, 0x0C, 0x0E, 0x17,
+    0xFF, 0x0B, 0x0E, 0x16, 0xFF, 0x0B, 0x0E, 0x15, 0xFF, 0x0A, 0x0E, 0x14, 0xFF, 0x80, 0x0A, 0x0D, 0x15, 0xFF, 0x0D, 0x0A, 0x0C, 0x14, 0xFF, 0x09,
+    0x0C, 0x13, 0xFF, 0x08, 0x0A, 0x11, 0xFF, 0x06, 0x09, 0x10, 0xFF, 0x07, 0x0A, 0x11, 0xFF, 0x10, 0x11, 0x19, 0xFF, 0x21, 0x23, 0x2D, 0xFF, 0x3C,
+    0x3E, 0x4A, 0xFF, 0x41, 0x43, 0x51, 0xFF, 0x27, 0x29, 0x37, 0xFF, 0x30, 0x35, 0x3F, 0xFF, 0x63, 0x6B, 0x79, 0xFF, 0x2A, 0x31, 0x3A, 0xFF, 0x01,
+    0x01, 0x02, 0xFF, 0x80, 0x03, 0x04, 0x06, 0xFF, 0x01, 0x03, 0x04, 0x05, 0xFF, 0x03, 0x03, 0x05, 0xFF, 0x82, 0x02, 0x03, 0x04, 0xFF, 0x04, 0x02,
+    0x04, 0x03, 0xFF, 0x0D, 0x11, 0x13, 0xFF, 0x02, 0x03, 0x05, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x00, 0x02, 0x04, 0xFF, 0x85, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x01, 0x00, 0xFF, 0x85, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0x81, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0x02, 0xFF, 0x80, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x01, 0x01, 0x04, 0xFF, 0x80,
+    0x00, 0x01, 0x04, 0xFF, 0x08, 0x00, 0x01, 0x03, 0xFF, 0x02, 0x03, 0x06, 0xFF, 0x0E, 0x12, 0x16, 0xFF, 0x14, 0x17, 0x1C, 0xFF, 0x17, 0x19, 0x1E,
+    0xFF, 0x17, 0x19, 0x20, 0xFF, 0x17, 0x1A, 0x21, 0xFF, 0x18, 0x1B, 0x22, 0xFF, 0x18, 0x1C, 0x23, 0xFF, 0x80, 0x17, 0x1B, 0x22, 0xFF, 0x10, 0x17,
+    0x1B, 0x21, 0xFF, 0x16, 0x19, 0x20, 0xFF, 0x14, 0x17, 0x1D, 0xFF, 0x2A, 0x2F, 0x38, 0xFF, 0x39, 0x40, 0x4D, 0xFF, 0x10, 0x13, 0x1E, 0xFF, 0x1B,
+    0x20, 0x30, 0xFF, 0x23, 0x28, 0x3A, 0xFF, 0x22, 0x27, 0x39, 0xFF, 0x08, 0x0C, 0x14, 0xFF, 0x00, 0x03, 0x06, 0xFF, 0x00, 0x02, 0x05, 0xFF, 0x0C,
+    0x0F, 0x16, 0xFF, 0x1A, 0x1E, 0x28, 0xFF, 0x17, 0x1A, 0x24, 0xFF, 0x19, 0x1B, 0x27, 0xFF, 0x19, 0x1C, 0x28, 0xFF, 0x80, 0x1B, 0x1E, 0x2B, 0xFF,
+    0x10, 0x1C, 0x1E, 0x2B, 0xFF, 0x1C, 0x1E, 0x2C, 0xFF, 0x1D, 0x1E, 0x2C, 0xFF, 0x1D, 0x1E, 0x2A, 0xFF, 0x1C, 0x1E, 0x2A, 0xFF, 0x19, 0x1B, 0x27,
+    0xFF, 0x2A, 0x2D, 0x39, 0xFF, 0x3E, 0x45, 0x57, 0xFF, 0x1C, 0x1F, 0x2E, 0xFF, 0x24, 0x26, 0x39, 0xFF, 0x1F, 0x21, 0x30, 0xFF, 0x07, 0x0A, 0x10,
+    0xFF, 0x02, 0x04, 0x08, 0xFF, 0x02, 0x05, 0x09, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x02, 0x05, 0x09, 0xFF, 0x80, 0x02, 0x04,
+    0x0A, 0xFF, 0x13, 0x02, 0x05, 0x0A, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x03, 0x05, 0x0B, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x14, 0x15, 0x21, 0xFF, 0x1F,
+    0x21, 0x2E, 0xFF, 0x20, 0x20, 0x2D, 0xFF, 0x20, 0x22, 0x2E, 0xFF, 0x20, 0x22, 0x2F, 0xFF, 0x21, 0x22, 0x30, 0xFF, 0x22, 0x23, 0x31, 0xFF, 0x21,
+    0x23, 0x32, 0xFF, 0x21, 0x22, 0x30, 0xFF, 0x28, 0x2A, 0x38, 0xFF, 0x34, 0x36, 0x46, 0xFF, 0x12, 0x15, 0x20, 0xFF, 0x17, 0x1A, 0x27, 0xFF, 0x05,
+    0x08, 0x11, 0xFF, 0x02, 0x03, 0x07, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x81, 0x02, 0x04, 0x09, 0xFF, 0x00, 0x02, 0x05, 0x09, 0xFF, 0x82, 0x02, 0x04,
+    0x09, 0xFF, 0x13, 0x01, 0x04, 0x08, 0xFF, 0x05, 0x07, 0x0D, 0xFF, 0x1F, 0x21, 0x2B, 0xFF, 0x25, 0x27, 0x33, 0xFF, 0x27, 0x28, 0x35, 0xFF, 0x25,
+    0x27, 0x35, 0xFF, 0x24, 0x26, 0x34, 0xFF, 0x25, 0x27, 0x34, 0xFF, 0x24, 0x26, 0x35, 0xFF, 0x24, 0x25, 0x34, 0xFF, 0x25, 0x27, 0x36, 0xFF, 0x26,
+    0x28, 0x37, 0xFF, 0x26, 0x28, 0x38, 0xFF, 0x25, 0x27, 0x36, 0xFF, 0x22, 0x25, 0x31, 0xFF, 0x43, 0x48, 0x59, 0xFF, 0x40, 0x46, 0x56, 0xFF, 0x20,
+    0x24, 0x30, 0xFF, 0x03, 0x04, 0x0A, 0xFF, 0x04, 0x06, 0x0C, 0xFF, 0x82, 0x03, 0x05, 0x0B, 0xFF, 0x80, 0x03, 0x04, 0x0B, 0xFF, 0x80, 0x02, 0x04,
+    0x0B, 0xFF, 0x1E, 0x03, 0x05, 0x0C, 0xFF, 0x03, 0x05, 0x0B, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x02, 0x05, 0x0A, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x08,
+    0x0B, 0x13, 0xFF, 0x11, 0x15, 0x1E, 0xFF, 0x17, 0x1B, 0x25, 0xFF, 0x1E, 0x20, 0x2B, 0xFF, 0x23, 0x25, 0x32, 0xFF, 0x24, 0x27, 0x34, 0xFF, 0x20,
+    0x23, 0x30, 0xFF, 0x1E, 0x21, 0x2E, 0xFF, 0x1E, 0x21, 0x2F, 0xFF, 0x1D, 0x20, 0x2E, 0xFF, 0x1D, 0x20, 0x2D, 0xFF, 0x1D, 0x20, 0x2E, 0xFF, 0x1D,
+    0x1F, 0x2D, 0xFF, 0x1D, 0x1F, 0x2C, 0xFF, 0x1C, 0x1F, 0x2D, 0xFF, 0x1C, 0x20, 0x2C, 0xFF, 0x1D, 0x20, 0x2D, 0xFF, 0x1F, 0x22, 0x2F, 0xFF, 0x22,
+    0x25, 0x31, 0xFF, 0x24, 0x26, 0x31, 0xFF, 0x20, 0x22, 0x2C, 0xFF, 0x1C, 0x1F, 0x29, 0xFF, 0x16, 0x19, 0x21, 0xFF, 0x05, 0x08, 0x0F, 0xFF, 0x01,
+    0x03, 0x0A, 0xFF, 0x02, 0x06, 0x0B, 0xFF, 0x80, 0x03, 0x06, 0x0C, 0xFF, 0x00, 0x02, 0x06, 0x0B, 0xFF, 0x81, 0x03, 0x05, 0x0A, 0xFF, 0x80, 0x02,
+    0x05, 0x0A, 0xFF, 0x00, 0x03, 0x04, 0x09, 0xFF, 0x80, 0x02, 0x04, 0x09, 0xFF, 0x00, 0x03, 0x04, 0x0A, 0xFF, 0x80, 0x02, 0x04, 0x09, 0xFF, 0x03,
+    0x03, 0x04, 0x0B, 0xFF, 0x02, 0x05, 0x0A, 0xFF, 0x03, 0x04, 0x0B, 0xFF, 0x03, 0x05, 0x0B, 0xFF, 0x81, 0x03, 0x05, 0x0C, 0xFF, 0x0B, 0x03, 0x04,
+    0x0B, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x11, 0x14, 0x1E, 0xFF, 0x1B, 0x1F, 0x2A, 0xFF, 0x1E, 0x23, 0x30, 0xFF, 0x21, 0x25, 0x34, 0xFF, 0x21, 0x24,
+    0x32, 0xFF, 0x1C, 0x20, 0x2D, 0xFF, 0x1D, 0x20, 0x2D, 0xFF, 0x1C, 0x20, 0x2D, 0xFF, 0x1D, 0x21, 0x2E, 0xFF, 0x1D, 0x20, 0x2D, 0xFF, 0x80, 0x1C,
+    0x20, 0x2D, 0xFF, 0x80, 0x1B, 0x1F, 0x2C, 0xFF, 0x30, 0x1D, 0x21, 0x2E, 0xFF, 0x24, 0x27, 0x36, 0xFF, 0x25, 0x29, 0x38, 0xFF, 0x21, 0x27, 0x34,
+    0xFF, 0x19, 0x1E, 0x29, 0xFF, 0x0D, 0x10, 0x19, 0xFF, 0x03, 0x05, 0x0A, 0xFF, 0x03, 0x04, 0x08, 0xFF, 0x17, 0x1B, 0x26, 0xFF, 0x16, 0x1A, 0x24,
+    0xFF, 0x4A, 0x51, 0x62, 0xFF, 0x1E, 0x21, 0x2A, 0xFF, 0x1D, 0x1E, 0x29, 0xFF, 0x1F, 0x22, 0x2E, 0xFF, 0x22, 0x25, 0x31, 0xFF, 0x24, 0x26, 0x33,
+    0xFF, 0x24, 0x27, 0x34, 0xFF, 0x24, 0x27, 0x35, 0xFF, 0x25, 0x27, 0x35, 0xFF, 0x24, 0x26, 0x35, 0xFF, 0x24, 0x26, 0x34, 0xFF, 0x22, 0x25, 0x33,
+    0xFF, 0x25, 0x28, 0x36, 0xFF, 0x10, 0x13, 0x1C, 0xFF, 0x04, 0x07, 0x0E, 0xFF, 0x03, 0x04, 0x0A, 0xFF, 0x0C, 0x0F, 0x17, 0xFF, 0x26, 0x2A, 0x37,
+    0xFF, 0x19, 0x1C, 0x26, 0xFF, 0x3E, 0x44, 0x53, 0xFF, 0x38, 0x3D, 0x4B, 0xFF, 0x1A, 0x1D, 0x27, 0xFF, 0x1A, 0x1C, 0x26, 0xFF, 0x1B, 0x1E, 0x29,
+    0xFF, 0x1E, 0x21, 0x2D, 0xFF, 0x1F, 0x22, 0x2F, 0xFF, 0x20, 0x24, 0x30, 0xFF, 0x22, 0x24, 0x32, 0xFF, 0x22, 0x24, 0x33, 0xFF, 0x22, 0x26, 0x34,
+    0xFF, 0x21, 0x24, 0x33, 0xFF, 0x20, 0x23, 0x30, 0xFF, 0x1C, 0x1F, 0x2A, 0xFF, 0x07, 0x0A, 0x11, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x02, 0x04, 0x0A,
+    0xFF, 0x02, 0x04, 0x08, 0xFF, 0x03, 0x04, 0x09, 0xFF, 0x03, 0x04, 0x08, 0xFF, 0x80, 0x02, 0x04, 0x0A, 0xFF, 0x00, 0x03, 0x04, 0x0B, 0xFF, 0x80,
+    0x02, 0x04, 0x0B, 0xFF, 0x0E, 0x02, 0x03, 0x09, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x08, 0x0A, 0x11, 0xFF, 0x0B, 0x0F, 0x15, 0xFF, 0x0D, 0x10, 0x18,
+    0xFF, 0x14, 0x18, 0x21, 0xFF, 0x1B, 0x1E, 0x29, 0xFF, 0x21, 0x24, 0x30, 0xFF, 0x1C, 0x1F, 0x2A, 0xFF, 0x17, 0x19, 0x24, 0xFF, 0x13, 0x16, 0x20,
+    0xFF, 0x0A, 0x0D, 0x15, 0xFF, 0x07, 0x0B, 0x11, 0xFF, 0x06, 0x09, 0x0F, 0xFF, 0x06, 0x08, 0x0E, 0xFF, 0x80, 0x06, 0x08, 0x0D, 0xFF, 0x80, 0x06,
+    0x08, 0x0E, 0xFF, 0x0C, 0x08, 0x09, 0x11, 0xFF, 0x11, 0x13, 0x1B, 0xFF, 0x19, 0x1B, 0x22, 0xFF, 0x14, 0x15, 0x1D, 0xFF, 0x13, 0x14, 0x1C, 0xFF,
+    0x2B, 0x2D, 0x38, 0xFF, 0x3A, 0x3D, 0x48, 0xFF, 0x2D, 0x30, 0x3C, 0xFF, 0x1E, 0x21, 0x2A, 0xFF, 0x29, 0x2D, 0x35, 0xFF, 0x4F, 0x55, 0x61, 0xFF,
+    0x2A, 0x2F, 0x37, 0xFF, 0x1A, 0x1E, 0x22, 0xFF, 0x80, 0x1C, 0x1F, 0x24, 0xFF, 0x0A, 0x1C, 0x20, 0x24, 0xFF, 0x1C, 0x1F, 0x23, 0xFF, 0x1B, 0x1F,
+    0x22, 0xFF, 0x19, 0x1E, 0x21, 0xFF, 0x19, 0x1D, 0x21, 0xFF, 0x19, 0x1D, 0x20, 0xFF, 0x17, 0x1C, 0x1E, 0xFF, 0x15, 0x1A, 0x1C, 0xFF, 0x02, 0x04,
+    0x05, 0xFF, 0x01, 0x03, 0x03, 0xFF, 0x01, 0x03, 0x04, 0xFF, 0x89, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x00, 0xFF, 0x82, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x81, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01,
+    0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x81, 0x00, 0x01, 0x04, 0xFF, 0x08, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x09, 0x0C, 0x11, 0xFF,
+    0x14, 0x17, 0x1C, 0xFF, 0x16, 0x19, 0x1E, 0xFF, 0x16, 0x19, 0x1F, 0xFF, 0x16, 0x1B, 0x20, 0xFF, 0x17, 0x1C, 0x22, 0xFF, 0x18, 0x1C, 0x23, 0xFF,
+    0x80, 0x17, 0x1C, 0x24, 0xFF, 0x1E, 0x16, 0x1B, 0x22, 0xFF, 0x15, 0x1A, 0x20, 0xFF, 0x13, 0x17, 0x1D, 0xFF, 0x12, 0x16, 0x1C, 0xFF, 0x13, 0x18,
+    0x1E, 0xFF, 0x04, 0x07, 0x0C, 0xFF, 0x07, 0x0A, 0x11, 0xFF, 0x09, 0x0C, 0x15, 0xFF, 0x08, 0x0C, 0x14, 0xFF, 0x02, 0x05, 0x0A, 0xFF, 0x01, 0x03,
+    0x08, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x04, 0x06, 0x0C, 0xFF, 0x13, 0x16, 0x20, 0xFF, 0x18, 0x1B, 0x25, 0xFF, 0x19, 0x1C, 0x27, 0xFF, 0x1A, 0x1C,
+    0x27, 0xFF, 0x1B, 0x1D, 0x29, 0xFF, 0x1B, 0x1D, 0x28, 0xFF, 0x1B, 0x1D, 0x29, 0xFF, 0x1C, 0x1E, 0x29, 0xFF, 0x1B, 0x1D, 0x28, 0xFF, 0x1A, 0x1C,
+    0x27, 0xFF, 0x1A, 0x1C, 0x26, 0xFF, 0x18, 0x1A, 0x24, 0xFF, 0x1A, 0x1C, 0x26, 0xFF, 0x1C, 0x20, 0x2C, 0xFF, 0x0A, 0x0D, 0x16, 0xFF, 0x0C, 0x0E,
+    0x17, 0xFF, 0x09, 0x0B, 0x13, 0xFF, 0x03, 0x05, 0x09, 0xFF, 0x81, 0x02, 0x04, 0x08, 0xFF, 0x1A, 0x01, 0x04, 0x09, 0xFF, 0x02, 0x05, 0x09, 0xFF,
+    0x03, 0x04, 0x09, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x03, 0x04, 0x0B, 0xFF, 0x03, 0x04, 0x0A, 0xFF,
+    0x0C, 0x0E, 0x15, 0xFF, 0x1A, 0x1C, 0x25, 0xFF, 0x1C, 0x1D, 0x26, 0xFF, 0x1C, 0x1D, 0x27, 0xFF, 0x1D, 0x1E, 0x28, 0xFF, 0x1F, 0x20, 0x2A, 0xFF,
+    0x20, 0x22, 0x2C, 0xFF, 0x1F, 0x22, 0x2D, 0xFF, 0x1F, 0x20, 0x2B, 0xFF, 0x1D, 0x1E, 0x29, 0xFF, 0x18, 0x1B, 0x25, 0xFF, 0x0A, 0x0D, 0x15, 0xFF,
+    0x07, 0x09, 0x12, 0xFF, 0x01, 0x04, 0x08, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x02, 0x05, 0x09, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x02, 0x04, 0x09, 0xFF,
+    0x01, 0x04, 0x08, 0xFF, 0x80, 0x02, 0x04, 0x08, 0xFF, 0x01, 0x01, 0x04, 0x08, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x81, 0x02, 0x04, 0x08, 0xFF, 0x05,
+    0x0F, 0x10, 0x17, 0xFF, 0x19, 0x1A, 0x22, 0xFF, 0x1B, 0x1D, 0x25, 0xFF, 0x1B, 0x1C, 0x25, 0xFF, 0x1B, 0x1D, 0x26, 0xFF, 0x1C, 0x1D, 0x27, 0xFF,
+    0x80, 0x1C, 0x1E, 0x28, 0xFF, 0x08, 0x1E, 0x20, 0x2A, 0xFF, 0x1F, 0x21, 0x2B, 0xFF, 0x1F, 0x20, 0x2B, 0xFF, 0x1E, 0x20, 0x2A, 0xFF, 0x1D, 0x1E,
+    0x26, 0xFF, 0x1D, 0x1F, 0x2A, 0xFF, 0x16, 0x19, 0x23, 0xFF, 0x07, 0x0A, 0x12, 0xFF, 0x03, 0x05, 0x0B, 0xFF, 0x80, 0x03, 0x05, 0x0A, 0xFF, 0x09,
+    0x02, 0x04, 0x0B, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x03, 0x04, 0x0B, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x03, 0x04, 0x0B, 0xFF,
+    0x02, 0x05, 0x0B, 0xFF, 0x02, 0x05, 0x0A, 0xFF, 0x02, 0x05, 0x0B, 0xFF, 0x03, 0x05, 0x0B, 0xFF, 0x80, 0x02, 0x05, 0x0C, 0xFF, 0x09, 0x01, 0x05,
+    0x0A, 0xFF, 0x01, 0x03, 0x08, 0xFF, 0x04, 0x08, 0x0F, 0xFF, 0x0B, 0x10, 0x18, 0xFF, 0x13, 0x16, 0x1F, 0xFF, 0x18, 0x1B, 0x25, 0xFF, 0x1F, 0x22,
+    0x2C, 0xFF, 0x22, 0x24, 0x30, 0xFF, 0x25, 0x26, 0x33, 0xFF, 0x25, 0x27, 0x34, 0xFF, 0x80, 0x25, 0x28, 0x34, 0xFF, 0x01, 0x25, 0x27, 0x34, 0xFF,
+    0x26, 0x28, 0x34, 0xFF, 0x80, 0x26, 0x28, 0x35, 0xFF, 0x09, 0x25, 0x27, 0x33, 0xFF, 0x20, 0x22, 0x2D, 0xFF, 0x1C, 0x1E, 0x27, 0xFF, 0x17, 0x1A,
+    0x22, 0xFF, 0x11, 0x13, 0x1A, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x01, 0x03, 0x08, 0xFF, 0x02, 0x05, 0x0A, 0xFF, 0x03, 0x06, 0x0C, 0xFF, 0x03, 0x06,
+    0x0B, 0xFF, 0x80, 0x02, 0x05, 0x0A, 0xFF, 0x05, 0x03, 0x05, 0x0B, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x02, 0x05, 0x09, 0xFF, 0x02, 0x05, 0x0A, 0xFF,
+    0x02, 0x04, 0x0A, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x84, 0x02, 0x04, 0x0A, 0xFF, 0x01, 0x02, 0x04, 0x09, 0xFF, 0x03, 0x04, 0x0B, 0xFF, 0x80, 0x02,
+    0x04, 0x0A, 0xFF, 0x01, 0x03, 0x04, 0x0B, 0xFF, 0x02, 0x05, 0x0B, 0xFF, 0x81, 0x03, 0x05, 0x0C, 0xFF, 0x05, 0x02, 0x05, 0x0B, 0xFF, 0x02, 0x04,
+    0x0A, 0xFF, 0x0D, 0x11, 0x1A, 0xFF, 0x13, 0x19, 0x22, 0xFF, 0x1A, 0x1D, 0x27, 0xFF, 0x1D, 0x21, 0x2C, 0xFF, 0x80, 0x23, 0x26, 0x32, 0xFF, 0x01,
+    0x24, 0x27, 0x34, 0xFF, 0x23, 0x27, 0x33, 0xFF, 0x80, 0x24, 0x28, 0x34, 0xFF, 0x0D, 0x23, 0x26, 0x34, 0xFF, 0x22, 0x25, 0x32, 0xFF, 0x1B, 0x1F,
+    0x2C, 0xFF, 0x18, 0x1C, 0x28, 0xFF, 0x13, 0x17, 0x20, 0xFF, 0x0A, 0x0E, 0x15, 0xFF, 0x08, 0x0A, 0x11, 0xFF, 0x05, 0x08, 0x0D, 0xFF, 0x04, 0x07,
+    0x0C, 0xFF, 0x03, 0x04, 0x08, 0xFF, 0x04, 0x05, 0x08, 0xFF, 0x08, 0x0A, 0x10, 0xFF, 0x1D, 0x1F, 0x28, 0xFF, 0x1C, 0x1D, 0x26, 0xFF, 0x80, 0x1A,
+    0x1C, 0x25, 0xFF, 0x23, 0x1D, 0x1E, 0x27, 0xFF, 0x1E, 0x20, 0x29, 0xFF, 0x1F, 0x21, 0x2B, 0xFF, 0x20, 0x22, 0x2C, 0xFF, 0x20, 0x23, 0x2D, 0xFF,
+    0x20, 0x22, 0x2C, 0xFF, 0x1F, 0x21, 0x2B, 0xFF, 0x1D, 0x1F, 0x29, 0xFF, 0x17, 0x1A, 0x24, 0xFF, 0x07, 0x0B, 0x12, 0xFF, 0x04, 0x06, 0x0E, 0xFF,
+    0x03, 0x05, 0x0C, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x09, 0x0C, 0x13, 0xFF, 0x09, 0x0A, 0x10, 0xFF, 0x0E, 0x11, 0x18, 0xFF, 0x17, 0x1A, 0x23, 0xFF,
+    0x18, 0x1B, 0x24, 0xFF, 0x1A, 0x1B, 0x24, 0xFF, 0x1A, 0x1C, 0x25, 0xFF, 0x1C, 0x1F, 0x28, 0xFF, 0x1E, 0x21, 0x2B, 0xFF, 0x20, 0x23, 0x2D, 0xFF,
+    0x22, 0x25, 0x2F, 0xFF, 0x22, 0x24, 0x2F, 0xFF, 0x22, 0x24, 0x30, 0xFF, 0x21, 0x23, 0x2F, 0xFF, 0x1D, 0x20, 0x2A, 0xFF, 0x13, 0x17, 0x1E, 0xFF,
+    0x03, 0x05, 0x0B, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x03, 0x03, 0x08, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x02, 0x04, 0x08, 0xFF,
+    0x02, 0x04, 0x09, 0xFF, 0x81, 0x02, 0x04, 0x0A, 0xFF, 0x00, 0x03, 0x05, 0x0B, 0xFF, 0x80, 0x02, 0x05, 0x0A, 0xFF, 0x2A, 0x02, 0x04, 0x09, 0xFF,
+    0x02, 0x05, 0x09, 0xFF, 0x06, 0x08, 0x0D, 0xFF, 0x06, 0x08, 0x10, 0xFF, 0x0A, 0x0D, 0x14, 0xFF, 0x11, 0x15, 0x1C, 0xFF, 0x16, 0x1A, 0x23, 0xFF,
+    0x1B, 0x1F, 0x2B, 0xFF, 0x1C, 0x22, 0x2A, 0xFF, 0x1F, 0x22, 0x2B, 0xFF, 0x1F, 0x22, 0x2A, 0xFF, 0x1F, 0x21, 0x29, 0xFF, 0x1E, 0x20, 0x28, 0xFF,
+    0x1E, 0x21, 0x28, 0xFF, 0x1E, 0x21, 0x29, 0xFF, 0x1F, 0x21, 0x29, 0xFF, 0x1D, 0x20, 0x28, 0xFF, 0x1B, 0x1E, 0x26, 0xFF, 0x18, 0x1C, 0x24, 0xFF,
+    0x1B, 0x1D, 0x25, 0xFF, 0x15, 0x15, 0x1D, 0xFF, 0x08, 0x09, 0x10, 0xFF, 0x07, 0x08, 0x10, 0xFF, 0x0B, 0x0F, 0x16, 0xFF, 0x09, 0x0D, 0x14, 0xFF,
+    0x09, 0x0C, 0x12, 0xFF, 0x0E, 0x12, 0x18, 0xFF, 0x1E, 0x22, 0x29, 0xFF, 0x1D, 0x21, 0x27, 0xFF, 0x1F, 0x23, 0x29, 0xFF, 0x21, 0x25, 0x2A, 0xFF,
+    0x20, 0x24, 0x2A, 0xFF, 0x20, 0x25, 0x29, 0xFF, 0x1E, 0x23, 0x27, 0xFF, 0x1E, 0x22, 0x26, 0xFF, 0x1D, 0x21, 0x25, 0xFF, 0x1B, 0x20, 0x24, 0xFF,
+    0x1A, 0x1F, 0x23, 0xFF, 0x19, 0x1D, 0x20, 0xFF, 0x11, 0x16, 0x17, 0xFF, 0x01, 0x03, 0x04, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x01, 0x02, 0x04, 0xFF,
+    0x8E, 0x00, 0x00, 0x00, 0xFF, 0x0A, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00,
+    0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x01,
+    0x04, 0xFF, 0x80, 0x00, 0x01, 0x04, 0xFF, 0x01, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x01, 0x02, 0xFF, 0x80, 0x00, 0x01,
+    0x03, 0xFF, 0x05, 0x01, 0x01, 0x03, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x02, 0x03, 0xFF, 0x01, 0x01, 0x03, 0xFF, 0x00, 0x02, 0x03, 0xFF, 0x01,
+    0x02, 0x03, 0xFF, 0x80, 0x01, 0x02, 0x04, 0xFF, 0x04, 0x01, 0x01, 0x03, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x01, 0x03, 0x05, 0xFF, 0x02, 0x04, 0x07,
+    0xFF, 0x02, 0x04, 0x08, 0xFF, 0x80, 0x01, 0x04, 0x09, 0xFF, 0x06, 0x01, 0x04, 0x08, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x00, 0x02, 0x04, 0xFF, 0x01,
+    0x02, 0x04, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x03, 0x05, 0xFF, 0x02, 0x03, 0x05, 0xFF, 0x81, 0x01, 0x02, 0x05, 0xFF, 0x84, 0x01, 0x02, 0x04,
+    0xFF, 0x02, 0x01, 0x03, 0x05, 0xFF, 0x02, 0x04, 0x07, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x80, 0x02, 0x04, 0x08, 0xFF, 0x80, 0x01, 0x04, 0x08, 0xFF,
+    0x0A, 0x02, 0x03, 0x07, 0xFF, 0x02, 0x04, 0x07, 0xFF, 0x01, 0x04, 0x08, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x02, 0x04, 0x09,
+    0xFF, 0x01, 0x04, 0x0A, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x80, 0x01, 0x01,
+    0x03, 0xFF, 0x00, 0x01, 0x02, 0x03, 0xFF, 0x81, 0x01, 0x02, 0x04, 0xFF, 0x0B, 0x02, 0x02, 0x06, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x01, 0x03, 0x08,
+    0xFF, 0x02, 0x04, 0x08, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x01, 0x04, 0x08, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x01, 0x04, 0x07,
+    0xFF, 0x02, 0x04, 0x09, 0xFF, 0x01, 0x04, 0x08, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x80, 0x02, 0x03, 0x08, 0xFF, 0x03, 0x01, 0x04, 0x07, 0xFF, 0x02,
+    0x04, 0x08, 0xFF, 0x02, 0x04, 0x07, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x80, 0x01, 0x03, 0x05, 0xFF, 0x00, 0x01, 0x02, 0x05, 0xFF, 0x81, 0x01, 0x03,
+    0x05, 0xFF, 0x00, 0x02, 0x03, 0x05, 0xFF, 0x80, 0x02, 0x03, 0x06, 0xFF, 0x01, 0x02, 0x04, 0x06, 0xFF, 0x02, 0x03, 0x06, 0xFF, 0x80, 0x02, 0x04,
+    0x06, 0xFF, 0x0A, 0x02, 0x04, 0x07, 0xFF, 0x03, 0x05, 0x0A, 0xFF, 0x03, 0x05, 0x0B, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x03, 0x04, 0x0A, 0xFF, 0x02,
+    0x04, 0x0A, 0xFF, 0x03, 0x04, 0x0A, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x01, 0x04, 0x0A, 0xFF, 0x80,
+    0x02, 0x04, 0x0A, 0xFF, 0x00, 0x02, 0x04, 0x0B, 0xFF, 0x80, 0x02, 0x04, 0x0A, 0xFF, 0x01, 0x02, 0x04, 0x0B, 0xFF, 0x02, 0x05, 0x0B, 0xFF, 0x80,
+    0x03, 0x05, 0x0B, 0xFF, 0x06, 0x01, 0x04, 0x09, 0xFF, 0x01, 0x03, 0x08, 0xFF, 0x03, 0x06, 0x0C, 0xFF, 0x0E, 0x12, 0x19, 0xFF, 0x11, 0x15, 0x1D,
+    0xFF, 0x13, 0x16, 0x1E, 0xFF, 0x15, 0x18, 0x20, 0xFF, 0x80, 0x16, 0x19, 0x21, 0xFF, 0x08, 0x16, 0x19, 0x22, 0xFF, 0x16, 0x19, 0x21, 0xFF, 0x15,
+    0x18, 0x20, 0xFF, 0x14, 0x17, 0x1F, 0xFF, 0x13, 0x16, 0x1E, 0xFF, 0x0F, 0x12, 0x19, 0xFF, 0x04, 0x06, 0x0C, 0xFF, 0x02, 0x03, 0x07, 0xFF, 0x02,
+    0x04, 0x08, 0xFF, 0x80, 0x03, 0x06, 0x0B, 0xFF, 0x01, 0x03, 0x05, 0x0B, 0xFF, 0x03, 0x05, 0x0A, 0xFF, 0x80, 0x02, 0x04, 0x0A, 0xFF, 0x00, 0x03,
+    0x04, 0x0A, 0xFF, 0x80, 0x02, 0x04, 0x09, 0xFF, 0x03, 0x02, 0x04, 0x0A, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x03, 0x04, 0x08, 0xFF, 0x03, 0x04, 0x09,
+    0xFF, 0x80, 0x02, 0x04, 0x0A, 0xFF, 0x80, 0x02, 0x03, 0x09, 0xFF, 0x06, 0x02, 0x04, 0x09, 0xFF, 0x03, 0x04, 0x09, 0xFF, 0x03, 0x03, 0x09, 0xFF,
+    0x01, 0x04, 0x08, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x02, 0x04, 0x0B, 0xFF, 0x80, 0x03, 0x05, 0x0B, 0xFF, 0x07, 0x02, 0x05,
+    0x0A, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x03, 0x06, 0x0B, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x03, 0x06,
+    0x0B, 0xFF, 0x0D, 0x11, 0x19, 0xFF, 0x80, 0x12, 0x15, 0x1D, 0xFF, 0x0F, 0x12, 0x16, 0x1D, 0xFF, 0x12, 0x15, 0x1D, 0xFF, 0x13, 0x17, 0x1E, 0xFF,
+    0x12, 0x16, 0x1E, 0xFF, 0x11, 0x15, 0x1D, 0xFF, 0x0F, 0x13, 0x1A, 0xFF, 0x0A, 0x0F, 0x15, 0xFF, 0x07, 0x0A, 0x10, 0xFF, 0x03, 0x05, 0x0C, 0xFF,
+    0x03, 0x05, 0x0B, 0xFF, 0x05, 0x07, 0x0C, 0xFF, 0x04, 0x07, 0x0B, 0xFF, 0x04, 0x06, 0x0B, 0xFF, 0x04, 0x06, 0x0A, 0xFF, 0x04, 0x05, 0x0A, 0xFF,
+    0x02, 0x04, 0x08, 0xFF, 0x82, 0x01, 0x02, 0x04, 0xFF, 0x05, 0x02, 0x03, 0x05, 0xFF, 0x02, 0x03, 0x06, 0xFF, 0x02, 0x04, 0x07, 0xFF, 0x03, 0x05,
+    0x09, 0xFF, 0x03, 0x06, 0x0A, 0xFF, 0x04, 0x05, 0x0A, 0xFF, 0x80, 0x04, 0x06, 0x0A, 0xFF, 0x07, 0x04, 0x06, 0x0E, 0xFF, 0x04, 0x07, 0x0F, 0xFF,
+    0x04, 0x07, 0x0D, 0xFF, 0x03, 0x06, 0x0C, 0xFF, 0x03, 0x05, 0x0B, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x01, 0x04, 0x07, 0xFF, 0x01, 0x03, 0x05, 0xFF,
+    0x80, 0x01, 0x02, 0x04, 0xFF, 0x07, 0x01, 0x02, 0x03, 0xFF, 0x00, 0x02, 0x03, 0xFF, 0x01, 0x03, 0x04, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x01, 0x03,
+    0x05, 0xFF, 0x01, 0x04, 0x05, 0xFF, 0x02, 0x03, 0x05, 0xFF, 0x02, 0x04, 0x06, 0xFF, 0x80, 0x01, 0x03, 0x04, 0xFF, 0x81, 0x02, 0x04, 0x08, 0xFF,
+    0x02, 0x03, 0x04, 0x09, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x02, 0x04, 0x07, 0xFF, 0x80, 0x02, 0x04, 0x08, 0xFF, 0x02, 0x02, 0x03, 0x0A, 0xFF, 0x03,
+    0x03, 0x0A, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x80, 0x03, 0x04, 0x0A, 0xFF, 0x00, 0x02, 0x04, 0x0B, 0xFF, 0x80, 0x02, 0x05, 0x0A, 0xFF, 0x02, 0x03,
+    0x05, 0x0A, 0xFF, 0x01, 0x04, 0x08, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x80, 0x01, 0x03, 0x06, 0xFF, 0x03, 0x03, 0x05, 0x0A, 0xFF, 0x0E, 0x12, 0x18,
+    0xFF, 0x15, 0x18, 0x20, 0xFF, 0x18, 0x1B, 0x22, 0xFF, 0x80, 0x19, 0x1C, 0x23, 0xFF, 0x07, 0x1A, 0x1C, 0x24, 0xFF, 0x18, 0x1A, 0x22, 0xFF, 0x17,
+    0x1A, 0x20, 0xFF, 0x14, 0x17, 0x1E, 0xFF, 0x11, 0x13, 0x1B, 0xFF, 0x0A, 0x0C, 0x14, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x80,
+    0x04, 0x05, 0x0A, 0xFF, 0x00, 0x02, 0x04, 0x07, 0xFF, 0x80, 0x02, 0x03, 0x08, 0xFF, 0x0B, 0x01, 0x03, 0x07, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x02,
+    0x03, 0x07, 0xFF, 0x02, 0x03, 0x06, 0xFF, 0x01, 0x03, 0x05, 0xFF, 0x02, 0x03, 0x04, 0xFF, 0x02, 0x03, 0x03, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x01,
+    0x02, 0x02, 0xFF, 0x01, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x80, 0x00, 0x02, 0x02, 0xFF, 0x81, 0x01, 0x02, 0x04,
+    0xFF, 0x89, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x83, 0x00, 0x00, 0x01, 0xFF, 0x03, 0x00, 0x01, 0x02, 0xFF, 0x00,
+    0x01, 0x03, 0xFF, 0x01, 0x01, 0x05, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x80, 0x00, 0x01, 0x03, 0xFF, 0x80, 0x00, 0x02, 0x03, 0xFF, 0x01, 0x01, 0x02,
+    0x04, 0xFF, 0x01, 0x03, 0x05, 0xFF, 0x80, 0x01, 0x03, 0x06, 0xFF, 0x0C, 0x01, 0x04, 0x05, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x02, 0x03, 0x06, 0xFF,
+    0x02, 0x04, 0x07, 0xFF, 0x01, 0x04, 0x07, 0xFF, 0x01, 0x04, 0x08, 0xFF, 0x01, 0x04, 0x07, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x01, 0x04, 0x06, 0xFF,
+    0x02, 0x03, 0x07, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x02, 0x03, 0x07, 0xFF, 0x83, 0x01, 0x03, 0x07, 0xFF, 0x05, 0x01, 0x03,
+    0x08, 0xFF, 0x01, 0x04, 0x08, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x01, 0x03, 0x08, 0xFF, 0x01, 0x04, 0x08, 0xFF, 0x01, 0x03, 0x09, 0xFF, 0x82, 0x01,
+    0x04, 0x08, 0xFF, 0x0D, 0x01, 0x05, 0x08, 0xFF, 0x02, 0x05, 0x08, 0xFF, 0x02, 0x05, 0x09, 0xFF, 0x03, 0x05, 0x09, 0xFF, 0x02, 0x05, 0x09, 0xFF,
+    0x02, 0x05, 0x08, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x02, 0x05, 0x08, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x02, 0x04, 0x07, 0xFF, 0x02, 0x05, 0x08, 0xFF,
+    0x01, 0x04, 0x09, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x03, 0x04, 0x09, 0xFF, 0x82, 0x02, 0x04, 0x09, 0xFF, 0x00, 0x02, 0x04, 0x08, 0xFF, 0x80, 0x02,
+    0x03, 0x08, 0xFF, 0x04, 0x01, 0x03, 0x07, 0xFF, 0x01, 0x03, 0x08, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x02, 0x04, 0x08, 0xFF,
+    0x80, 0x02, 0x04, 0x09, 0xFF, 0x0A, 0x03, 0x05, 0x09, 0xFF, 0x03, 0x04, 0x09, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x03, 0x05, 0x08, 0xFF, 0x02, 0x05,
+    0x08, 0xFF, 0x01, 0x04, 0x08, 0xFF, 0x03, 0x04, 0x08, 0xFF, 0x01, 0x04, 0x07, 0xFF, 0x01, 0x04, 0x08, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x02, 0x04,
+    0x07, 0xFF, 0x80, 0x02, 0x04, 0x08, 0xFF, 0x80, 0x02, 0x04, 0x07, 0xFF, 0x02, 0x02, 0x04, 0x08, 0xFF, 0x02, 0x05, 0x08, 0xFF, 0x01, 0x04, 0x08,
+    0xFF, 0x80, 0x02, 0x04, 0x09, 0xFF, 0x01, 0x01, 0x04, 0x09, 0xFF, 0x03, 0x04, 0x0A, 0xFF, 0x80, 0x02, 0x05, 0x0A, 0xFF, 0x10, 0x03, 0x05, 0x0A,
+    0xFF, 0x03, 0x05, 0x0B, 0xFF, 0x02, 0x05, 0x0A, 0xFF, 0x03, 0x05, 0x0B, 0xFF, 0x03, 0x05, 0x0A, 0xFF, 0x02, 0x05, 0x09, 0xFF, 0x03, 0x05, 0x09,
+    0xFF, 0x02, 0x05, 0x0A, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x01, 0x04, 0x09, 0xFF, 0x03, 0x04, 0x09, 0xFF, 0x02, 0x05, 0x08, 0xFF, 0x02, 0x04, 0x09,
+    0xFF, 0x03, 0x05, 0x09, 0xFF, 0x02, 0x05, 0x08, 0xFF, 0x03, 0x05, 0x09, 0xFF, 0x02, 0x05, 0x08, 0xFF, 0x80, 0x02, 0x04, 0x0A, 0xFF, 0x0B, 0x02,
+    0x05, 0x09, 0xFF, 0x03, 0x05, 0x0A, 0xFF, 0x02, 0x05, 0x09, 0xFF, 0x03, 0x05, 0x0B, 0xFF, 0x02, 0x05, 0x0C, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x03,
+    0x06, 0x0C, 0xFF, 0x03, 0x06, 0x0B, 0xFF, 0x03, 0x05, 0x0B, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x81,
+    0x02, 0x03, 0x07, 0xFF, 0x00, 0x02, 0x03, 0x08, 0xFF, 0x81, 0x02, 0x04, 0x08, 0xFF, 0x00, 0x02, 0x04, 0x09, 0xFF, 0x80, 0x03, 0x05, 0x0A, 0xFF,
+    0x00, 0x03, 0x06, 0x0A, 0xFF, 0x80, 0x03, 0x05, 0x0A, 0xFF, 0x06, 0x02, 0x06, 0x0A, 0xFF, 0x03, 0x05, 0x0A, 0xFF, 0x03, 0x05, 0x09, 0xFF, 0x02,
+    0x05, 0x09, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x02, 0x05, 0x08, 0xFF, 0x81, 0x02, 0x05, 0x09, 0xFF, 0x03, 0x03, 0x04, 0x09,
+    0xFF, 0x02, 0x04, 0x09, 0xFF, 0x03, 0x03, 0x09, 0xFF, 0x03, 0x04, 0x09, 0xFF, 0x83, 0x02, 0x03, 0x08, 0xFF, 0x02, 0x01, 0x03, 0x08, 0xFF, 0x03,
+    0x03, 0x09, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x80, 0x03, 0x04, 0x09, 0xFF, 0x02, 0x02, 0x04, 0x09, 0xFF, 0x03, 0x04, 0x0A, 0xFF, 0x02, 0x05, 0x09,
+    0xFF, 0x80, 0x03, 0x05, 0x0B, 0xFF, 0x07, 0x02, 0x05, 0x0A, 0xFF, 0x03, 0x06, 0x0B, 0xFF, 0x03, 0x06, 0x0A, 0xFF, 0x03, 0x06, 0x0B, 0xFF, 0x02,
+    0x05, 0x09, 0xFF, 0x03, 0x05, 0x09, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x02, 0x04, 0x07, 0xFF, 0x80, 0x02, 0x04, 0x08, 0xFF, 0x00, 0x02, 0x05, 0x09,
+    0xFF, 0x80, 0x03, 0x05, 0x0A, 0xFF, 0x03, 0x04, 0x06, 0x0C, 0xFF, 0x05, 0x07, 0x0D, 0xFF, 0x05, 0x06, 0x0D, 0xFF, 0x04, 0x06, 0x0C, 0xFF, 0x81,
+    0x04, 0x06, 0x0B, 0xFF, 0x0B, 0x04, 0x06, 0x0C, 0xFF, 0x03, 0x05, 0x0B, 0xFF, 0x03, 0x05, 0x09, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x03, 0x05, 0x0A,
+    0xFF, 0x02, 0x05, 0x0A, 0xFF, 0x03, 0x05, 0x0A, 0xFF, 0x03, 0x05, 0x0B, 0xFF, 0x02, 0x05, 0x0C, 0xFF, 0x03, 0x06, 0x0C, 0xFF, 0x04, 0x08, 0x0E,
+    0xFF, 0x03, 0x07, 0x0E, 0xFF, 0x80, 0x04, 0x07, 0x0E, 0xFF, 0x06, 0x03, 0x07, 0x0D, 0xFF, 0x04, 0x07, 0x0D, 0xFF, 0x04, 0x07, 0x0C, 0xFF, 0x03,
+    0x07, 0x0C, 0xFF, 0x03, 0x06, 0x0B, 0xFF, 0x02, 0x05, 0x0A, 0xFF, 0x02, 0x06, 0x0A, 0xFF, 0x81, 0x02, 0x05, 0x09, 0xFF, 0x00, 0x02, 0x05, 0x08,
+    0xFF, 0x81, 0x02, 0x05, 0x09, 0xFF, 0x07, 0x02, 0x05, 0x0A, 0xFF, 0x02, 0x06, 0x0B, 0xFF, 0x02, 0x05, 0x0A, 0xFF, 0x03, 0x06, 0x0B, 0xFF, 0x02,
+    0x05, 0x09, 0xFF, 0x03, 0x05, 0x09, 0xFF, 0x03, 0x04, 0x08, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x80, 0x02, 0x03, 0x08, 0xFF, 0x11, 0x02, 0x04, 0x09,
+    0xFF, 0x02, 0x03, 0x09, 0xFF, 0x01, 0x04, 0x05, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x03, 0x03, 0x09, 0xFF, 0x03, 0x04, 0x09,
+    0xFF, 0x02, 0x04, 0x09, 0xFF, 0x03, 0x04, 0x0A, 0xFF, 0x02, 0x05, 0x09, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x03, 0x05, 0x0A, 0xFF, 0x02, 0x05, 0x09,
+    0xFF, 0x02, 0x04, 0x09, 0xFF, 0x02, 0x05, 0x09, 0xFF, 0x02, 0x05, 0x08, 0xFF, 0x03, 0x05, 0x09, 0xFF, 0x02, 0x05, 0x08, 0xFF, 0x80, 0x02, 0x04,
+    0x07, 0xFF, 0x81, 0x02, 0x03, 0x06, 0xFF, 0x00, 0x02, 0x02, 0x06, 0xFF, 0x80, 0x01, 0x03, 0x07, 0xFF, 0x03, 0x02, 0x03, 0x07, 0xFF, 0x02, 0x02,
+    0x07, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x03, 0x04, 0x0A, 0xFF, 0x80, 0x03, 0x05, 0x0A, 0xFF, 0x0D, 0x03, 0x04, 0x0A, 0xFF, 0x03, 0x05, 0x09, 0xFF,
+    0x03, 0x04, 0x08, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x02, 0x05, 0x08, 0xFF, 0x02, 0x05, 0x09, 0xFF, 0x03, 0x05, 0x0A, 0xFF, 0x02, 0x05, 0x0A, 0xFF,
+    0x02, 0x05, 0x09, 0xFF, 0x02, 0x05, 0x08, 0xFF, 0x02, 0x05, 0x07, 0xFF, 0x01, 0x04, 0x06, 0xFF, 0x02, 0x04, 0x05, 0xFF, 0x01, 0x03, 0x04, 0xFF,
+    0x80, 0x01, 0x03, 0x03, 0xFF, 0x04, 0x01, 0x03, 0x04, 0xFF, 0x01, 0x03, 0x03, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x01, 0x02,
+    0x04, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x81, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x00,
+    0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x04,
+    0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x00, 0x01,
+    0xFF, 0x0E, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x02, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x01, 0x01, 0x04, 0xFF, 0x00, 0x01,
+    0x03, 0xFF, 0x01, 0x02, 0x03, 0xFF, 0x00, 0x01, 0x03, 0xFF, 0x00, 0x02, 0x03, 0xFF, 0x00, 0x02, 0x04, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x00, 0x03,
+    0x04, 0xFF, 0x01, 0x03, 0x05, 0xFF, 0x01, 0x02, 0x04, 0xFF, 0x01, 0x03, 0x04, 0xFF, 0x80, 0x01, 0x03, 0x05, 0xFF, 0x00, 0x02, 0x03, 0x05, 0xFF,
+    0x80, 0x01, 0x03, 0x06, 0xFF, 0x02, 0x01, 0x02, 0x05, 0xFF, 0x01, 0x03, 0x05, 0xFF, 0x01, 0x02, 0x05, 0xFF, 0x80, 0x01, 0x03, 0x06, 0xFF, 0x80,
+    0x01, 0x02, 0x06, 0xFF, 0x03, 0x01, 0x03, 0x06, 0xFF, 0x01, 0x02, 0x06, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x01, 0x02, 0x07, 0xFF, 0x81, 0x01, 0x03,
+    0x07, 0xFF, 0x00, 0x01, 0x03, 0x06, 0xFF, 0x80, 0x01, 0x03, 0x07, 0xFF, 0x05, 0x01, 0x03, 0x08, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x01, 0x03, 0x08,
+    0xFF, 0x01, 0x04, 0x07, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x01, 0x03, 0x07, 0xFF, 0x80, 0x01, 0x04, 0x07, 0xFF, 0x09, 0x02, 0x03, 0x07, 0xFF, 0x01,
+    0x04, 0x07, 0xFF, 0x02, 0x03, 0x06, 0xFF, 0x02, 0x04, 0x07, 0xFF, 0x01, 0x04, 0x06, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x02,
+    0x04, 0x07, 0xFF, 0x02, 0x03, 0x07, 0xFF, 0x01, 0x04, 0x07, 0xFF, 0x80, 0x02, 0x03, 0x08, 0xFF, 0x05, 0x02, 0x04, 0x08, 0xFF, 0x02, 0x04, 0x0A,
+    0xFF, 0x02, 0x04, 0x08, 0xFF, 0x01, 0x04, 0x08, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x02, 0x03, 0x07, 0xFF, 0x80, 0x01, 0x03, 0x07, 0xFF, 0x02, 0x02,
+    0x04, 0x08, 0xFF, 0x02, 0x04, 0x07, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x80, 0x02, 0x04, 0x09, 0xFF, 0x81, 0x02, 0x04, 0x07, 0xFF, 0x80, 0x01, 0x04,
+    0x07, 0xFF, 0x05, 0x02, 0x04, 0x07, 0xFF, 0x00, 0x04, 0x07, 0xFF, 0x01, 0x05, 0x07, 0xFF, 0x02, 0x04, 0x07, 0xFF, 0x01, 0x04, 0x07, 0xFF, 0x01,
+    0x04, 0x08, 0xFF, 0x80, 0x01, 0x03, 0x07, 0xFF, 0x0F, 0x02, 0x03, 0x09, 0xFF, 0x01, 0x04, 0x07, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x02, 0x04, 0x09,
+    0xFF, 0x02, 0x04, 0x08, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x03, 0x04, 0x08, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x02, 0x04, 0x0A,
+    0xFF, 0x02, 0x04, 0x09, 0xFF, 0x02, 0x05, 0x08, 0xFF, 0x03, 0x04, 0x0A, 0xFF, 0x03, 0x05, 0x0A, 0xFF, 0x02, 0x05, 0x0A, 0xFF, 0x02, 0x05, 0x09,
+    0xFF, 0x81, 0x02, 0x04, 0x08, 0xFF, 0x0E, 0x02, 0x03, 0x09, 0xFF, 0x02, 0x04, 0x07, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x02, 0x04, 0x07, 0xFF, 0x01,
+    0x05, 0x06, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x02, 0x05, 0x06, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x02, 0x04, 0x07, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x01,
+    0x05, 0x08, 0xFF, 0x02, 0x05, 0x08, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x03, 0x05, 0x0A, 0xFF, 0x03, 0x04, 0x0A, 0xFF, 0x80, 0x03, 0x05, 0x0B, 0xFF,
+    0x01, 0x03, 0x05, 0x0A, 0xFF, 0x03, 0x04, 0x0B, 0xFF, 0x80, 0x03, 0x05, 0x0B, 0xFF, 0x80, 0x03, 0x05, 0x0C, 0xFF, 0x00, 0x03, 0x06, 0x0C, 0xFF,
+    0x80, 0x03, 0x05, 0x0C, 0xFF, 0x01, 0x03, 0x06, 0x0B, 0xFF, 0x03, 0x05, 0x0B, 0xFF, 0x80, 0x03, 0x05, 0x0A, 0xFF, 0x80, 0x03, 0x05, 0x09, 0xFF,
+    0x80, 0x02, 0x04, 0x09, 0xFF, 0x00, 0x02, 0x05, 0x08, 0xFF, 0x80, 0x02, 0x05, 0x09, 0xFF, 0x1D, 0x02, 0x04, 0x09, 0xFF, 0x02, 0x04, 0x08, 0xFF,
+    0x01, 0x04, 0x08, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x03, 0x04, 0x08, 0xFF, 0x01, 0x04, 0x07, 0xFF, 0x03, 0x04, 0x08, 0xFF, 0x02, 0x04, 0x08, 0xFF,
+    0x02, 0x04, 0x07, 0xFF, 0x01, 0x03, 0x08, 0xFF, 0x02, 0x03, 0x09, 0xFF, 0x02, 0x03, 0x06, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x02, 0x04, 0x07, 0xFF,
+    0x03, 0x03, 0x07, 0xFF, 0x02, 0x04, 0x07, 0xFF, 0x01, 0x04, 0x06, 0xFF, 0x02, 0x04, 0x07, 0xFF, 0x02, 0x04, 0x06, 0xFF, 0x03, 0x04, 0x08, 0xFF,
+    0x02, 0x04, 0x07, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x02, 0x05, 0x08, 0xFF, 0x03, 0x04, 0x09, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x03, 0x04, 0x0B, 0xFF,
+    0x02, 0x05, 0x09, 0xFF, 0x03, 0x05, 0x0B, 0xFF, 0x03, 0x05, 0x0A, 0xFF, 0x03, 0x06, 0x0A, 0xFF, 0x80, 0x03, 0x06, 0x0B, 0xFF, 0x16, 0x03, 0x06,
+    0x0C, 0xFF, 0x03, 0x06, 0x0B, 0xFF, 0x03, 0x06, 0x0C, 0xFF, 0x02, 0x05, 0x0B, 0xFF, 0x03, 0x06, 0x0A, 0xFF, 0x03, 0x06, 0x0B, 0xFF, 0x03, 0x05,
+    0x0B, 0xFF, 0x03, 0x05, 0x0A, 0xFF, 0x04, 0x05, 0x0B, 0xFF, 0x03, 0x05, 0x0A, 0xFF, 0x03, 0x05, 0x0B, 0xFF, 0x04, 0x06, 0x0B, 0xFF, 0x03, 0x05,
+    0x0B, 0xFF, 0x04, 0x05, 0x0C, 0xFF, 0x03, 0x06, 0x0C, 0xFF, 0x04, 0x05, 0x0C, 0xFF, 0x04, 0x05, 0x0B, 0xFF, 0x03, 0x05, 0x0B, 0xFF, 0x02, 0x04,
+    0x0A, 0xFF, 0x03, 0x04, 0x0A, 0xFF, 0x02, 0x05, 0x09, 0xFF, 0x03, 0x05, 0x0B, 0xFF, 0x02, 0x05, 0x0A, 0xFF, 0x80, 0x03, 0x05, 0x0B, 0xFF, 0x08,
+    0x03, 0x06, 0x0B, 0xFF, 0x03, 0x06, 0x0C, 0xFF, 0x03, 0x05, 0x0B, 0xFF, 0x03, 0x05, 0x0A, 0xFF, 0x02, 0x05, 0x0A, 0xFF, 0x03, 0x06, 0x0A, 0xFF,
+    0x03, 0x05, 0x0B, 0xFF, 0x03, 0x05, 0x0C, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x80, 0x02, 0x05, 0x09, 0xFF, 0x09, 0x02, 0x05, 0x08, 0xFF, 0x02, 0x05,
+    0x0A, 0xFF, 0x02, 0x05, 0x09, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x01, 0x05, 0x08, 0xFF, 0x03, 0x04, 0x0A, 0xFF, 0x01, 0x04,
+    0x08, 0xFF, 0x03, 0x04, 0x0A, 0xFF, 0x02, 0x04, 0x0A, 0xFF, 0x80, 0x02, 0x04, 0x09, 0xFF, 0x10, 0x02, 0x04, 0x08, 0xFF, 0x02, 0x03, 0x06, 0xFF,
+    0x02, 0x03, 0x08, 0xFF, 0x02, 0x03, 0x07, 0xFF, 0x03, 0x03, 0x09, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x02, 0x04, 0x08, 0xFF,
+    0x02, 0x04, 0x05, 0xFF, 0x02, 0x04, 0x08, 0xFF, 0x02, 0x04, 0x07, 0xFF, 0x03, 0x04, 0x08, 0xFF, 0x03, 0x04, 0x0A, 0xFF, 0x02, 0x04, 0x08, 0xFF,
+    0x02, 0x03, 0x09, 0xFF, 0x02, 0x03, 0x08, 0xFF, 0x01, 0x04, 0x07, 0xFF, 0x80, 0x02, 0x04, 0x09, 0xFF, 0x00, 0x02, 0x05, 0x08, 0xFF, 0x80, 0x02,
+    0x04, 0x09, 0xFF, 0x03, 0x02, 0x04, 0x08, 0xFF, 0x03, 0x04, 0x09, 0xFF, 0x02, 0x05, 0x09, 0xFF, 0x03, 0x05, 0x0A, 0xFF, 0x81, 0x02, 0x04, 0x09,
+    0xFF, 0x01, 0x02, 0x04, 0x0A, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x80, 0x03, 0x04, 0x09, 0xFF, 0x07, 0x02, 0x03, 0x09, 0xFF, 0x02, 0x04, 0x09, 0xFF,
+    0x03, 0x04, 0x09, 0xFF, 0x02, 0x05, 0x09, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x03, 0x04, 0x09, 0xFF, 0x02, 0x04, 0x09, 0xFF, 0x02, 0x04, 0x08, 0xFF,
+    0x80, 0x02, 0x04, 0x09, 0xFF, 0x00, 0x02, 0x04, 0x07, 0xFF, 0x80, 0x02, 0x04, 0x08, 0xFF, 0x04, 0x02, 0x04, 0x07, 0xFF, 0x02, 0x04, 0x06, 0xFF,
+    0x01, 0x03, 0x05, 0xFF, 0x01, 0x03, 0x06, 0xFF, 0x01, 0x03, 0x03, 0xFF, 0x80, 0x01, 0x02, 0x04, 0xFF, 0x80, 0x01, 0x02, 0x03, 0xFF, 0x00, 0x00,
+    0x02, 0x03, 0xFF, 0x80, 0x01, 0x02, 0x04, 0xFF,
+};
+
+static GUI_CONST_STORAGE IconImage_t anim_welcome_i0_image = {
+    ICON_FMT_RLE32, 0, 300, 114, 0x000000,
+    NULL,
+    anim_welcome_i0, sizeof(anim_welcome_i0)
+};
+
+static GUI_CONST_STORAGE AnimPatch_t anim_welcome_patches[] = {
+    { 0, 0, 0x0D, &anim_welcome_i0_image },
+    { 0, 0, 0x1A, &anim_welcome_i0_image },
+    { 0, 0, 0x26, &anim_welcome_i0_image },
+    { 0, 0, 0x2B, &anim_welcome_i0_image },
+    { 0, 0, 0x40, &anim_welcome_i0_image },
+    { 0, 0, 0x4D, &anim_welcome_i0_image },
+    { 0, 0, 0x59, &anim_welcome_i0_image },
+    { 0, 0, 0x66, &anim_welcome_i0_image },
+    { 0, 0, 0x73, &anim_welcome_i0_image },
+    { 0, 0, 0x80, &anim_welcome_i0_image },
+    { 0, 0, 0x8C, &anim_welcome_i0_image },
+    { 0, 0, 0x99, &anim_welcome_i0_image },
+    { 0, 0, 0xA6, &anim_welcome_i0_image },
+    { 0, 0, 0xB3, &anim_welcome_i0_image },
+    { 0, 0, 0xBF, &anim_welcome_i0_image },
+    { 0, 0, 0xCC, &anim_welcome_i0_image },
+    { 0, 0, 0xD9, &anim_welcome_i0_image },
+    { 0, 0, 0xE6, &anim_welcome_i0_image },
+    { 0, 0, 0xF2, &anim_welcome_i0_image },
+    { 0, 0, 0xFF, &anim_welcome_i0_image },
+};
+
+static GUI_CONST_STORAGE AnimFrame_t anim_welcome_frames[] = {
+    { 0, 1 },
+    { 1, 1 },
+    { 2, 1 },
+    { 3, 1 },
+    { 4, 1 },
+    { 5, 1 },
+    { 6, 1 },
+    { 7, 1 },
+    { 8, 1 },
+    { 9, 1 },
+    { 10, 1 },
+    { 11, 1 },
+    { 12, 1 },
+    { 13, 1 },
+    { 14, 1 },
+    { 15, 1 },
+    { 16, 1 },
+    { 17, 1 },
+    { 18, 1 },
+    { 19, 1 },
+};
+
+GUI_CONST_STORAGE AnimClip_t anim_welcome = {
+    300, 114, 20, 10,
+    { 0, 0, 0x0D, &anim_welcome_i0_image },
+    anim_welcome_frames,
+    anim_welcome_patches,
+    20
+};
+
+/*************************** End of file ****************************/
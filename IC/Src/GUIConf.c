@@ -61,6 +61,14 @@ Purpose     : Display controller initialization
 */
 #define GUI_NUMBYTES (1024) * 2048 	// 2MB available for the GUI in external sdram
 
+/*********************************************************************
+*
+*       Static data
+*
+**********************************************************************
+*/
+static U32 aMemory[GUI_NUMBYTES / 4] __attribute__((section(".gui_ram")));	// 32 bit aligned memory area
+
 
 /*********************************************************************
 *
@@ -72,10 +80,22 @@ Purpose     : Display controller initialization
 */
 void GUI_X_Config(void)
 {
-    static U32 aMemory[GUI_NUMBYTES / 4] __attribute__((section(".gui_ram")));	// 32 bit aligned memory area
-
     GUI_ALLOC_AssignMemory(aMemory, GUI_NUMBYTES);	// Assign memory to STemWin
 }
 
+/*********************************************************************
+*
+*       GUIConf_GetHeapArea
+*
+* Purpose:
+*   Returns the address of the emWin heap in .gui_ram and writes its
+*   size to *pSize (memory budget report, see mem_budget.h).
+*/
+U32 GUIConf_GetHeapArea(U32 * pSize)
+{
+    *pSize = sizeof(aMemory);
+    return (U32)aMemory;
+}
+
 
 /************************ (C) COPYRIGHT JUBERA D.O.O Sarajevo ************************/
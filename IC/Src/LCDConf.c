@@ -17,6 +17,10 @@
 #include "GUIDRV_Lin.h"
 #include "LCDConf.h"
 #include "GUI.h"
+#include "dma2d_queue.h"
+#include "icon_codec.h"
+#include "fb_sync.h"
+#include "glyph_cache.h"
 /*********************************************************************
 *
 *       Supported orientation modes (not to be changed)
@@ -97,6 +101,11 @@
 // DMA2D Buffer Address
 //
 #define DMA2D_BUFFER_ADDR 	0x20000000
+//
+// Glyph cache, A8 glyphs in SDRAM section .glyph_cache (behind the frame buffers)
+//
+#define GLYPH_POOL_SIZE     0x00020000  // 128 KB
+#define GLYPH_PRELOAD_MAX   64          // Characters per LCD_GlyphPreload() call
 
 /*********************************************************************
 *
@@ -422,10 +431,18 @@ static const U32 _aAddr[GUI_NUM_LAYERS] = {
 };
 
 static int _aPendingBuffer[2] = { -1, -1};
+static volatile U32 _VsyncCount;  // Line events (one per LTDC frame), paces GUI_Exec
+static volatile U32 _FlipCount;   // Line events that showed a new buffer
+static volatile U32 _FlipTime;    // DWT cycle counter at the last buffer flip
 static int _aBufferIndex[GUI_NUM_LAYERS];
+static volatile int _aShownBuffer[GUI_NUM_LAYERS];  // Buffer scanned out by the LTDC
 static int _axSize[GUI_NUM_LAYERS];
 static int _aySize[GUI_NUM_LAYERS];
 static int _aBytesPerPixels[GUI_NUM_LAYERS];
+//
+// Regions in which each buffer differs from the newest content (see fb_sync.h)
+//
+static FbSync_t _aSync[GUI_NUM_LAYERS];
 
 //
 // Prototypes of DMA2D color conversion routines
@@ -450,6 +467,19 @@ static U32 * _pBuffer_FG    =  &_aBuffer[XSIZE_PHYS * sizeof(U32) * 1];
 static U32 * _pBuffer_BG    =  &_aBuffer[XSIZE_PHYS * sizeof(U32) * 2];
 static uint32_t	_CLUT[256];
 //
+// Line buffer for drawing compact icons into memory devices
+//
+static U32 _aIconLine[XSIZE_PHYS];
+//
+// Opacity applied to drawn compact icons (LCD_SetIconAlpha), 0xFF = none
+//
+static U8 _IconAlpha = 0xFF;
+//
+// Glyph cache of the Verdana fonts
+//
+static GlyphCache_t _GlyphCache;
+static U8 _aGlyphPool[GLYPH_POOL_SIZE] __attribute__((section(".glyph_cache"), aligned(GLYPH_CACHE_ALIGN)));
+//
 // Array of color conversions for each layer
 //
 static const LCD_API_COLOR_CONV * _apColorConvAPI[] = {
@@ -506,33 +536,172 @@ static U32 _GetPixelformat(int LayerIndex)
 
 /*********************************************************************
 *
-*       _DMA_ExecOperation
+*       DMA2D job queue
+*
+* Purpose:
+*   Jobs are started one after another from the transfer complete
+*   interrupt (LCD_DMA2D_IRQHandler). emWin draws with the CPU into the
+*   same frame buffer right after a device function returns, so every
+*   function called by emWin fences its jobs before returning. CPU work
+*   overlaps blitting inside the bulk routines, which split the work
+*   into chunks and prepare chunk n+1 while DMA2D processes chunk n.
+*   A job also ends on a transfer or configuration error interrupt, or
+*   when it runs longer than DMA2D_TIMEOUT_MS without any interrupt, so
+*   a fence can not wait forever.
+*/
+#define DMA2D_CHUNK_ITEMS   XSIZE_PHYS  // Items per pipelined chunk, two chunks fit into each of the _aBuffer parts
+#define DMA2D_TIMEOUT_MS    100U        // A full screen blend takes a few ms
+
+static void _DMA_Start (const Dma2dJob_t * pJob);
+static void _DMA_Idle  (void);
+static void _DMA_Lock  (void);
+static void _DMA_Unlock(void);
+
+static Dma2dQueue_t _Dma2dQueue;
+static U32 _Dma2dStart;           // DWT cycle counter when the running job was started
+static volatile U32 _Dma2dBusy;   // DWT cycles with a DMA2D job running (wraps)
+static volatile U32 _Dma2dErrors; // Jobs ended by error interrupt or timeout
+static const Dma2dBackend_t _Dma2dBackend = {
+    _DMA_Start,
+    _DMA_Idle,
+    _DMA_Lock,
+    _DMA_Unlock
+};
+
+/*********************************************************************
+*
+*       _DMA_Start
+*
+* Purpose:
+*   Writes the registers used by the job mode and starts the transfer.
+*   Called with DMA2D idle, from main loop or from DMA2D interrupt.
+*/
+static void _DMA_Start(const Dma2dJob_t * pJob)
+{
+    U32 Mode;
+
+    Mode = pJob->cr & DMA2D_JOB_MODE_MASK;
+    if (Mode == DMA2D_JOB_R2M)
+    {
+        DMA2D->OCOLR   = pJob->ocolr;                   // Output Color Register (Color to be used)
+    }
+    else
+    {
+        DMA2D->FGMAR   = (U32)pJob->fgmar;              // Foreground Memory Address Register (Source address)
+        DMA2D->FGOR    = pJob->fgor;                    // Foreground Offset Register (Source line offset)
+        DMA2D->FGPFCCR = pJob->fgpfccr;                 // Foreground PFC Control Register (Defines the input pixel format)
+        DMA2D->FGCOLR  = pJob->fgcolr;                  // Foreground Color Register (Color of A8/A4 input)
+    }
+    if (Mode == DMA2D_JOB_M2M_BLEND)
+    {
+        DMA2D->BGMAR   = (U32)pJob->bgmar;              // Background Memory Address Register
+        DMA2D->BGOR    = pJob->bgor;                    // Background Offset Register
+        DMA2D->BGPFCCR = pJob->bgpfccr;                 // Background PFC Control Register (Defines the BG pixel format)
+    }
+    if (Mode != DMA2D_JOB_M2M)
+    {
+        DMA2D->OPFCCR  = pJob->opfccr;                  // Output PFC Control Register (Defines the output pixel format)
+    }
+    DMA2D->OMAR    = (U32)pJob->omar;                   // Output Memory Address Register (Destination address)
+    DMA2D->OOR     = pJob->oor;                         // Output Offset Register (Destination line offset)
+    DMA2D->NLR     = pJob->nlr;                         // Number of Line Register (Size configuration of area to be transfered)
+    _Dma2dStart    = DWT->CYCCNT;                       // Busy time ends in LCD_DMA2D_IRQHandler
+    DMA2D->CR      = pJob->cr | DMA2D_CR_TCIE | DMA2D_CR_TEIE | DMA2D_CR_CEIE | DMA2D_CR_START; // Control Register (Mode, interrupts and start operation)
+}
+
+/*********************************************************************
+*
+*       _DMA_Idle
+*
+* Purpose:
+*   Sleeps until the next interrupt, SysTick wakes it at least every ms.
+*   A job that neither completed nor raised an error interrupt within
+*   DMA2D_TIMEOUT_MS is aborted and ended here, the queue goes on.
 */
-static void _DMA_ExecOperation(void)
+static void _DMA_Idle(void)
 {
-    DMA2D->CR |= DMA2D_CR_START;					// Control Register (Start operation)
-    while (DMA2D->CR & DMA2D_CR_START) 				// Wait until transfer is done
+    if ((DWT->CYCCNT - _Dma2dStart) > (SystemCoreClock / 1000U * DMA2D_TIMEOUT_MS))
     {
-        __WFI();									// Sleep until next interrupt
+        _DMA_Lock();
+        // Re-checked with the interrupt masked: a job that just ended is left to LCD_DMA2D_IRQHandler
+        if (_Dma2dQueue.count && ((DWT->CYCCNT - _Dma2dStart) > (SystemCoreClock / 1000U * DMA2D_TIMEOUT_MS))
+            && !(DMA2D->ISR & (DMA2D_ISR_TCIF | DMA2D_ISR_TEIF | DMA2D_ISR_CEIF)))
+        {
+            if (DMA2D->CR & DMA2D_CR_START)
+            {
+                DMA2D->CR |= DMA2D_CR_ABORT;
+                while (DMA2D->CR & DMA2D_CR_START);         // Abort ends within a few bus cycles
+            }
+            DMA2D->IFCR = DMA2D_ISR_TEIF | DMA2D_ISR_TCIF | DMA2D_ISR_TWIF | DMA2D_ISR_CAEIF | DMA2D_ISR_CTCIF | DMA2D_ISR_CEIF;
+            NVIC_ClearPendingIRQ(DMA2D_IRQn);
+            _Dma2dBusy += DWT->CYCCNT - _Dma2dStart;
+            _Dma2dErrors++;
+            Dma2dQueue_Complete(&_Dma2dQueue);              // Starts the next job
+        }
+        _DMA_Unlock();
+        return;
     }
+    __WFI();                                            // Sleep until next interrupt
+}
+
+/*********************************************************************
+*
+*       _DMA_Lock
+*/
+static void _DMA_Lock(void)
+{
+    NVIC_DisableIRQ(DMA2D_IRQn);
 }
+
+/*********************************************************************
+*
+*       _DMA_Unlock
+*/
+static void _DMA_Unlock(void)
+{
+    NVIC_EnableIRQ(DMA2D_IRQn);
+}
+
+/*********************************************************************
+*
+*       _DMA_PostOperation
+*
+* Purpose:
+*   Queues the job without waiting. Returns fence of the job.
+*/
+static U32 _DMA_PostOperation(const Dma2dJob_t * pJob)
+{
+    return Dma2dQueue_Submit(&_Dma2dQueue, pJob);
+}
+
+/*********************************************************************
+*
+*       _DMA_ExecOperation
+*
+* Purpose:
+*   Queues the job and waits until it is done.
+*/
+static void _DMA_ExecOperation(const Dma2dJob_t * pJob)
+{
+    Dma2dQueue_Wait(&_Dma2dQueue, _DMA_PostOperation(pJob));
+}
+
 /*********************************************************************
 *
 *       _DMA_Copy
 */
 static void _DMA_Copy(int LayerIndex, void * pSrc, void * pDst, int xSize, int ySize, int OffLineSrc, int OffLineDst)
 {
-    U32 PixelFormat;
-
-    PixelFormat = _GetPixelformat(LayerIndex);
-    DMA2D->CR      = 0x00000000UL | (1 << 9);		// Control Register (Memory to memory and TCIE)
-    DMA2D->FGMAR   = (U32)pSrc;						// Foreground Memory Address Register (Source address)
-    DMA2D->OMAR    = (U32)pDst;						// Output Memory Address Register (Destination address)
-    DMA2D->FGOR    = OffLineSrc;					// Foreground Offset Register (Source line offset)
-    DMA2D->OOR     = OffLineDst;					// Output Offset Register (Destination line offset)
-    DMA2D->FGPFCCR = PixelFormat;					// Foreground PFC Control Register (Defines the input pixel format)
-    DMA2D->NLR     = (U32)(xSize << 16) | (U16)ySize;// Number of Line Register (Size configuration of area to be transfered)
-    _DMA_ExecOperation();
+    Dma2dJob_t Job = { 0 };
+
+    Job.cr      = DMA2D_JOB_M2M;                      // Memory to memory
+    Job.fgmar   = (uintptr_t)pSrc;                    // Source address
+    Job.omar    = (uintptr_t)pDst;                    // Destination address
+    Job.fgor    = OffLineSrc;                         // Source line offset
+    Job.oor     = OffLineDst;                         // Destination line offset
+    Job.fgpfccr = _GetPixelformat(LayerIndex);        // Input pixel format
+    Job.nlr     = (U32)(xSize << 16) | (U16)ySize;    // Size configuration of area to be transfered
+    _DMA_ExecOperation(&Job);
 }
 
 /*********************************************************************
@@ -541,72 +710,38 @@ static void _DMA_Copy(int LayerIndex, void * pSrc, void * pDst, int xSize, int y
 */
 static void _DMA_Fill(int LayerIndex, void * pDst, int xSize, int ySize, int OffLine, U32 ColorIndex)
 {
-    U32 PixelFormat;
-
-    PixelFormat = _GetPixelformat(LayerIndex);
-    //
-    // Set up mode
-    //
-    DMA2D->CR      = 0x00030000UL | (1 << 9);         // Control Register (Register to memory and TCIE)
-    DMA2D->OCOLR   = ColorIndex;                      // Output Color Register (Color to be used)
-    //
-    // Set up pointers
-    //
-    DMA2D->OMAR    = (U32)pDst;                       // Output Memory Address Register (Destination address)
-    //
-    // Set up offsets
-    //
-    DMA2D->OOR     = OffLine;                         // Output Offset Register (Destination line offset)
-    //
-    // Set up pixel format
-    //
-    DMA2D->OPFCCR  = PixelFormat;                     // Output PFC Control Register (Defines the output pixel format)
-    //
-    // Set up size
-    //
-    DMA2D->NLR     = (U32)(xSize << 16) | (U16)ySize; // Number of Line Register (Size configuration of area to be transfered)
-    //
-    // Execute operation
-    //
-    _DMA_ExecOperation();
+    Dma2dJob_t Job = { 0 };
+
+    Job.cr      = DMA2D_JOB_R2M;                      // Register to memory
+    Job.ocolr   = ColorIndex;                         // Color to be used
+    Job.omar    = (uintptr_t)pDst;                    // Destination address
+    Job.oor     = OffLine;                            // Destination line offset
+    Job.opfccr  = _GetPixelformat(LayerIndex);        // Output pixel format
+    Job.nlr     = (U32)(xSize << 16) | (U16)ySize;    // Size configuration of area to be transfered
+    _DMA_ExecOperation(&Job);
 }
 
 /*********************************************************************
 *
 *       _DMA_AlphaBlendingBulk
+*
+* Purpose:
+*   Queues blending of NumItems colors (alpha already inverted) and
+*   returns the fence of the job.
 */
-static void _DMA_AlphaBlendingBulk(LCD_COLOR * pColorFG, LCD_COLOR * pColorBG, LCD_COLOR * pColorDst, U32 NumItems)
+static U32 _DMA_AlphaBlendingBulk(LCD_COLOR * pColorFG, LCD_COLOR * pColorBG, LCD_COLOR * pColorDst, U32 NumItems)
 {
-    //
-    // Set up mode
-    //
-    DMA2D->CR      = 0x00020000UL | (1 << 9);         // Control Register (Memory to memory with blending of FG and BG and TCIE)
-    //
-    // Set up pointers
-    //
-    DMA2D->FGMAR   = (U32)pColorFG;                   // Foreground Memory Address Register
-    DMA2D->BGMAR   = (U32)pColorBG;                   // Background Memory Address Register
-    DMA2D->OMAR    = (U32)pColorDst;                  // Output Memory Address Register (Destination address)
-    //
-    // Set up offsets
-    //
-    DMA2D->FGOR    = 0;                               // Foreground Offset Register
-    DMA2D->BGOR    = 0;                               // Background Offset Register
-    DMA2D->OOR     = 0;                               // Output Offset Register
-    //
-    // Set up pixel format
-    //
-    DMA2D->FGPFCCR = LTDC_PIXEL_FORMAT_ARGB8888;      // Foreground PFC Control Register (Defines the FG pixel format)
-    DMA2D->BGPFCCR = LTDC_PIXEL_FORMAT_ARGB8888;      // Background PFC Control Register (Defines the BG pixel format)
-    DMA2D->OPFCCR  = LTDC_PIXEL_FORMAT_ARGB8888;      // Output     PFC Control Register (Defines the output pixel format)
-    //
-    // Set up size
-    //
-    DMA2D->NLR     = (U32)(NumItems << 16) | 1;       // Number of Line Register (Size configuration of area to be transfered)
-    //
-    // Execute operation
-    //
-    _DMA_ExecOperation();
+    Dma2dJob_t Job = { 0 };
+
+    Job.cr      = DMA2D_JOB_M2M_BLEND;                // Memory to memory with blending of FG and BG
+    Job.fgmar   = (uintptr_t)pColorFG;                // Foreground address
+    Job.bgmar   = (uintptr_t)pColorBG;                // Background address
+    Job.omar    = (uintptr_t)pColorDst;               // Destination address
+    Job.fgpfccr = LTDC_PIXEL_FORMAT_ARGB8888;         // FG pixel format
+    Job.bgpfccr = LTDC_PIXEL_FORMAT_ARGB8888;         // BG pixel format
+    Job.opfccr  = LTDC_PIXEL_FORMAT_ARGB8888;         // Output pixel format
+    Job.nlr     = (U32)(NumItems << 16) | 1;          // Size configuration of area to be transfered
+    return _DMA_PostOperation(&Job);
 }
 
 /*********************************************************************
@@ -620,48 +755,26 @@ static void _DMA_AlphaBlendingBulk(LCD_COLOR * pColorFG, LCD_COLOR * pColorBG, L
 */
 static LCD_COLOR _DMA_MixColors(LCD_COLOR Color, LCD_COLOR BkColor, U8 Intens)
 {
+    Dma2dJob_t Job = { 0 };
 
     if ((BkColor & 0xFF000000) == 0xFF000000) {
         return Color;
     }
     *_pBuffer_FG = Color   ^ 0xFF000000;
     *_pBuffer_BG = BkColor ^ 0xFF000000;
-    //
-    // Set up mode
-    //
-    DMA2D->CR      = 0x00020000UL | (1 << 9);         // Control Register (Memory to memory with blending of FG and BG and TCIE)
-    //
-    // Set up pointers
-    //
-    DMA2D->FGMAR   = (U32)_pBuffer_FG;                // Foreground Memory Address Register
-    DMA2D->BGMAR   = (U32)_pBuffer_BG;                // Background Memory Address Register
-    DMA2D->OMAR    = (U32)_pBuffer_DMA2D;             // Output Memory Address Register (Destination address)
-    //
-    // Set up pixel format
-    //
-    DMA2D->FGPFCCR = LTDC_PIXEL_FORMAT_ARGB8888
-                     | (1UL << 16)
-                     | ((U32)Intens << 24);
-    DMA2D->BGPFCCR = LTDC_PIXEL_FORMAT_ARGB8888
-                     | (0UL << 16)
-                     | ((U32)(255 - Intens) << 24);
-    DMA2D->OPFCCR  = LTDC_PIXEL_FORMAT_ARGB8888;
-    //
-    // Set up size
-    //
-    DMA2D->NLR     = (U32)(1 << 16) | 1;              // Number of Line Register (Size configuration of area to be transfered)
-    //
-    // Execute operation
-    //
-
-    //_DMA_ExecOperation();
-    DMA2D->CR     |= DMA2D_CR_START;                  // Control Register (Start operation)
-    //
-    // Wait until transfer is done
-    //
-    while (DMA2D->CR & DMA2D_CR_START) {
-        __WFI();                                        // Sleep until next interrupt
-    }
+    Job.cr      = DMA2D_JOB_M2M_BLEND;                // Memory to memory with blending of FG and BG
+    Job.fgmar   = (uintptr_t)_pBuffer_FG;             // Foreground address
+    Job.bgmar   = (uintptr_t)_pBuffer_BG;             // Background address
+    Job.omar    = (uintptr_t)_pBuffer_DMA2D;          // Destination address
+    Job.fgpfccr = LTDC_PIXEL_FORMAT_ARGB8888
+                  | (1UL << 16)
+                  | ((U32)Intens << 24);
+    Job.bgpfccr = LTDC_PIXEL_FORMAT_ARGB8888
+                  | (0UL << 16)
+                  | ((U32)(255 - Intens) << 24);
+    Job.opfccr  = LTDC_PIXEL_FORMAT_ARGB8888;
+    Job.nlr     = (U32)(1 << 16) | 1;                 // Size configuration of area to be transfered
+    _DMA_ExecOperation(&Job);
 
     return _pBuffer_DMA2D[0] ^ 0xFF000000;
 }
@@ -669,72 +782,48 @@ static LCD_COLOR _DMA_MixColors(LCD_COLOR Color, LCD_COLOR BkColor, U8 Intens)
 /*********************************************************************
 *
 *       _DMA_MixColorsBulk
+*
+* Purpose:
+*   Queues mixing of NumItems colors with the given intensity and
+*   returns the fence of the job.
 */
-static void _DMA_MixColorsBulk(LCD_COLOR * pColorFG, LCD_COLOR * pColorBG, LCD_COLOR * pColorDst, U8 Intens, U32 NumItems)
+static U32 _DMA_MixColorsBulk(LCD_COLOR * pColorFG, LCD_COLOR * pColorBG, LCD_COLOR * pColorDst, U8 Intens, U32 NumItems)
 {
-    //
-    // Set up mode
-    //
-    DMA2D->CR      = 0x00020000UL | (1 << 9);         // Control Register (Memory to memory with blending of FG and BG and TCIE)
-    //
-    // Set up pointers
-    //
-    DMA2D->FGMAR   = (U32)pColorFG;                   // Foreground Memory Address Register
-    DMA2D->BGMAR   = (U32)pColorBG;                   // Background Memory Address Register
-    DMA2D->OMAR    = (U32)pColorDst;                  // Output Memory Address Register (Destination address)
-    //
-    // Set up pixel format
-    //
-    DMA2D->FGPFCCR = LTDC_PIXEL_FORMAT_ARGB8888
-                     | (1UL << 16)
-                     | ((U32)Intens << 24);
-    DMA2D->BGPFCCR = LTDC_PIXEL_FORMAT_ARGB8888
-                     | (0UL << 16)
-                     | ((U32)(255 - Intens) << 24);
-    DMA2D->OPFCCR  = LTDC_PIXEL_FORMAT_ARGB8888;
-    //
-    // Set up size
-    //
-    DMA2D->NLR     = (U32)(NumItems << 16) | 1;              // Number of Line Register (Size configuration of area to be transfered)
-    //
-    // Execute operation
-    //
-    _DMA_ExecOperation();
+    Dma2dJob_t Job = { 0 };
+
+    Job.cr      = DMA2D_JOB_M2M_BLEND;                // Memory to memory with blending of FG and BG
+    Job.fgmar   = (uintptr_t)pColorFG;                // Foreground address
+    Job.bgmar   = (uintptr_t)pColorBG;                // Background address
+    Job.omar    = (uintptr_t)pColorDst;               // Destination address
+    Job.fgpfccr = LTDC_PIXEL_FORMAT_ARGB8888
+                  | (1UL << 16)
+                  | ((U32)Intens << 24);
+    Job.bgpfccr = LTDC_PIXEL_FORMAT_ARGB8888
+                  | (0UL << 16)
+                  | ((U32)(255 - Intens) << 24);
+    Job.opfccr  = LTDC_PIXEL_FORMAT_ARGB8888;
+    Job.nlr     = (U32)(NumItems << 16) | 1;          // Size configuration of area to be transfered
+    return _DMA_PostOperation(&Job);
 }
 
 /*********************************************************************
 *
 *       _DMA_ConvertColor
+*
+* Purpose:
+*   Queues conversion of NumItems pixels and returns the fence of the job.
 */
-static void _DMA_ConvertColor(void * pSrc, void * pDst,  U32 PixelFormatSrc, U32 PixelFormatDst, U32 NumItems)
+static U32 _DMA_ConvertColor(void * pSrc, void * pDst,  U32 PixelFormatSrc, U32 PixelFormatDst, U32 NumItems)
 {
-    //
-    // Set up mode
-    //
-    DMA2D->CR      = 0x00010000UL | (1 << 9);         // Control Register (Memory to memory with pixel format conversion and TCIE)
-    //
-    // Set up pointers
-    //
-    DMA2D->FGMAR   = (U32)pSrc;                       // Foreground Memory Address Register (Source address)
-    DMA2D->OMAR    = (U32)pDst;                       // Output Memory Address Register (Destination address)
-    //
-    // Set up offsets
-    //
-    DMA2D->FGOR    = 0;                               // Foreground Offset Register (Source line offset)
-    DMA2D->OOR     = 0;                               // Output Offset Register (Destination line offset)
-    //
-    // Set up pixel format
-    //
-    DMA2D->FGPFCCR = PixelFormatSrc;                  // Foreground PFC Control Register (Defines the input pixel format)
-    DMA2D->OPFCCR  = PixelFormatDst;                  // Output PFC Control Register (Defines the output pixel format)
-    //
-    // Set up size
-    //
-    DMA2D->NLR     = (U32)(NumItems << 16) | 1;       // Number of Line Register (Size configuration of area to be transfered)
-    //
-    // Execute operation
-    //
-    _DMA_ExecOperation();
+    Dma2dJob_t Job = { 0 };
+
+    Job.cr      = DMA2D_JOB_M2M_PFC;                  // Memory to memory with pixel format conversion
+    Job.fgmar   = (uintptr_t)pSrc;                    // Source address
+    Job.omar    = (uintptr_t)pDst;                    // Destination address
+    Job.fgpfccr = PixelFormatSrc;                     // Input pixel format
+    Job.opfccr  = PixelFormatDst;                     // Output pixel format
+    Job.nlr     = (U32)(NumItems << 16) | 1;          // Size configuration of area to be transfered
+    return _DMA_PostOperation(&Job);
 }
 
 /*********************************************************************
@@ -743,33 +832,17 @@ static void _DMA_ConvertColor(void * pSrc, void * pDst,  U32 PixelFormatSrc, U32
 */
 static void _DMA_DrawBitmapL8(void * pSrc, void * pDst,  U32 OffSrc, U32 OffDst, U32 PixelFormatDst, U32 xSize, U32 ySize)
 {
-    //
-    // Set up mode
-    //
-    DMA2D->CR      = 0x00010000UL | (1 << 9);         // Control Register (Memory to memory with pixel format conversion and TCIE)
-    //
-    // Set up pointers
-    //
-    DMA2D->FGMAR   = (U32)pSrc;                       // Foreground Memory Address Register (Source address)
-    DMA2D->OMAR    = (U32)pDst;                       // Output Memory Address Register (Destination address)
-    //
-    // Set up offsets
-    //
-    DMA2D->FGOR    = OffSrc;                          // Foreground Offset Register (Source line offset)
-    DMA2D->OOR     = OffDst;                          // Output Offset Register (Destination line offset)
-    //
-    // Set up pixel format
-    //
-    DMA2D->FGPFCCR = LTDC_PIXEL_FORMAT_L8;            // Foreground PFC Control Register (Defines the input pixel format)
-    DMA2D->OPFCCR  = PixelFormatDst;                  // Output PFC Control Register (Defines the output pixel format)
-    //
-    // Set up size
-    //
-    DMA2D->NLR     = (U32)(xSize << 16) | ySize;      // Number of Line Register (Size configuration of area to be transfered)
-    //
-    // Execute operation
-    //
-    _DMA_ExecOperation();
+    Dma2dJob_t Job = { 0 };
+
+    Job.cr      = DMA2D_JOB_M2M_PFC;                  // Memory to memory with pixel format conversion
+    Job.fgmar   = (uintptr_t)pSrc;                    // Source address
+    Job.omar    = (uintptr_t)pDst;                    // Destination address
+    Job.fgor    = OffSrc;                             // Source line offset
+    Job.oor     = OffDst;                             // Destination line offset
+    Job.fgpfccr = LTDC_PIXEL_FORMAT_L8;               // Input pixel format
+    Job.opfccr  = PixelFormatDst;                     // Output pixel format
+    Job.nlr     = (U32)(xSize << 16) | ySize;         // Size configuration of area to be transfered
+    _DMA_ExecOperation(&Job);
 }
 
 /*********************************************************************
@@ -778,6 +851,7 @@ static void _DMA_DrawBitmapL8(void * pSrc, void * pDst,  U32 OffSrc, U32 OffDst,
 */
 static void _DMA_LoadLUT(LCD_COLOR * pColor, U32 NumItems)
 {
+    Dma2dQueue_Sync(&_Dma2dQueue);                      // CLUT must not change under a queued job
     DMA2D->FGCMAR  = (U32)pColor;                     	// Foreground CLUT Memory Address Register
     //
     // Foreground PFC Control Register
@@ -835,22 +909,47 @@ static void _InvertAlpha(LCD_COLOR * pColorSrc, LCD_COLOR * pColorDst, U32 NumIt
 /*********************************************************************
 *
 *       _DMA_AlphaBlending
+*
+* Purpose:
+*   Chunk n+1 is inverted by the CPU while DMA2D blends chunk n.
 */
 static void _DMA_AlphaBlending(LCD_COLOR * pColorFG, LCD_COLOR * pColorBG, LCD_COLOR * pColorDst, U32 NumItems)
 {
-    //
-    // Invert alpha values
-    //
-    _InvertAlpha(pColorFG, _pBuffer_FG, NumItems);
-    _InvertAlpha(pColorBG, _pBuffer_BG, NumItems);
-    //
-    // Use DMA2D for mixing
-    //
-    _DMA_AlphaBlendingBulk(_pBuffer_FG, _pBuffer_BG, _pBuffer_DMA2D, NumItems);
-    //
-    // Invert alpha values
-    //
-    _InvertAlpha(_pBuffer_DMA2D, pColorDst, NumItems);
+    U32 Fence, Num, NumPrev, Slot;
+
+    Fence = NumPrev = Slot = 0;
+    while (NumItems)
+    {
+        Num = (NumItems > DMA2D_CHUNK_ITEMS) ? DMA2D_CHUNK_ITEMS : NumItems;
+        //
+        // Invert alpha values
+        //
+        _InvertAlpha(pColorFG, _pBuffer_FG + Slot * DMA2D_CHUNK_ITEMS, Num);
+        _InvertAlpha(pColorBG, _pBuffer_BG + Slot * DMA2D_CHUNK_ITEMS, Num);
+        //
+        // Use DMA2D for mixing
+        //
+        Fence = _DMA_AlphaBlendingBulk(_pBuffer_FG + Slot * DMA2D_CHUNK_ITEMS, _pBuffer_BG + Slot * DMA2D_CHUNK_ITEMS, _pBuffer_DMA2D + Slot * DMA2D_CHUNK_ITEMS, Num);
+        //
+        // Invert alpha values of the previous chunk
+        //
+        if (NumPrev)
+        {
+            Dma2dQueue_Wait(&_Dma2dQueue, Fence - 1);
+            _InvertAlpha(_pBuffer_DMA2D + (Slot ^ 1) * DMA2D_CHUNK_ITEMS, pColorDst, NumPrev);
+            pColorDst += NumPrev;
+        }
+        pColorFG += Num;
+        pColorBG += Num;
+        NumItems -= Num;
+        NumPrev   = Num;
+        Slot     ^= 1;
+    }
+    if (NumPrev)
+    {
+        Dma2dQueue_Wait(&_Dma2dQueue, Fence);
+        _InvertAlpha(_pBuffer_DMA2D + (Slot ^ 1) * DMA2D_CHUNK_ITEMS, pColorDst, NumPrev);
+    }
 }
 
 /*********************************************************************
@@ -862,11 +961,35 @@ static void _DMA_AlphaBlending(LCD_COLOR * pColorFG, LCD_COLOR * pColorBG, LCD_C
 *   color conversion. It converts the given index values to 32 bit colors.
 *   Because emWin uses ABGR internally and 0x00 and 0xFF for opaque and fully
 *   transparent the color array needs to be converted after DMA2D has been used.
+*   DMA2D converts chunk n+1 while the CPU converts chunk n.
 */
 static void _DMA_Index2ColorBulk(void * pIndex, LCD_COLOR * pColor, U32 NumItems, U8 SizeOfIndex, U32 PixelFormat)
 {
-    _DMA_ConvertColor(pIndex, _pBuffer_DMA2D, PixelFormat, LTDC_PIXEL_FORMAT_ARGB8888, NumItems);	// Use DMA2D for the conversion
-    _InvertAlpha_SwapRB(_pBuffer_DMA2D, pColor, NumItems);											// Convert colors from ARGB to ABGR and invert alpha values
+    U32 Fence, Num, NumPrev, Slot;
+    U8 * pSrc;
+
+    pSrc  = (U8 *)pIndex;
+    Fence = NumPrev = Slot = 0;
+    while (NumItems)
+    {
+        Num = (NumItems > DMA2D_CHUNK_ITEMS) ? DMA2D_CHUNK_ITEMS : NumItems;
+        Fence = _DMA_ConvertColor(pSrc, _pBuffer_DMA2D + Slot * DMA2D_CHUNK_ITEMS, PixelFormat, LTDC_PIXEL_FORMAT_ARGB8888, Num);	// Use DMA2D for the conversion
+        if (NumPrev)
+        {
+            Dma2dQueue_Wait(&_Dma2dQueue, Fence - 1);
+            _InvertAlpha_SwapRB(_pBuffer_DMA2D + (Slot ^ 1) * DMA2D_CHUNK_ITEMS, pColor, NumPrev);						// Convert colors from ARGB to ABGR and invert alpha values
+            pColor += NumPrev;
+        }
+        pSrc     += Num * SizeOfIndex;
+        NumItems -= Num;
+        NumPrev   = Num;
+        Slot     ^= 1;
+    }
+    if (NumPrev)
+    {
+        Dma2dQueue_Wait(&_Dma2dQueue, Fence);
+        _InvertAlpha_SwapRB(_pBuffer_DMA2D + (Slot ^ 1) * DMA2D_CHUNK_ITEMS, pColor, NumPrev);
+    }
 }
 
 /*********************************************************************
@@ -878,33 +1001,74 @@ static void _DMA_Index2ColorBulk(void * pIndex, LCD_COLOR * pColor, U32 NumItems
 *   color conversion. It converts the given 32 bit color array to index values.
 *   Because emWin uses ABGR internally and 0x00 and 0xFF for opaque and fully
 *   transparent the given color array needs to be converted before DMA2D can be used.
+*   The CPU converts chunk n+1 while DMA2D converts chunk n.
 */
 static void _DMA_Color2IndexBulk(LCD_COLOR * pColor, void * pIndex, U32 NumItems, U8 SizeOfIndex, U32 PixelFormat)
 {
-    _InvertAlpha_SwapRB(pColor, _pBuffer_DMA2D, NumItems);											// Convert colors from ABGR to ARGB and invert alpha values
-    _DMA_ConvertColor(_pBuffer_DMA2D, pIndex, LTDC_PIXEL_FORMAT_ARGB8888, PixelFormat, NumItems);	// Use DMA2D for the conversion
+    U32 Fence, Num, NumPrev, Slot;
+    U8 * pDst;
+
+    pDst  = (U8 *)pIndex;
+    Fence = NumPrev = Slot = 0;
+    while (NumItems)
+    {
+        Num = (NumItems > DMA2D_CHUNK_ITEMS) ? DMA2D_CHUNK_ITEMS : NumItems;
+        if (NumPrev)
+        {
+            Dma2dQueue_Wait(&_Dma2dQueue, Fence - 1);                                                   // Slot used two chunks ago must be free
+        }
+        _InvertAlpha_SwapRB(pColor, _pBuffer_DMA2D + Slot * DMA2D_CHUNK_ITEMS, Num);					// Convert colors from ABGR to ARGB and invert alpha values
+        Fence = _DMA_ConvertColor(_pBuffer_DMA2D + Slot * DMA2D_CHUNK_ITEMS, pDst, LTDC_PIXEL_FORMAT_ARGB8888, PixelFormat, Num);	// Use DMA2D for the conversion
+        pColor   += Num;
+        pDst     += Num * SizeOfIndex;
+        NumItems -= Num;
+        NumPrev   = Num;
+        Slot     ^= 1;
+    }
+    if (NumPrev)
+    {
+        Dma2dQueue_Wait(&_Dma2dQueue, Fence);
+    }
 }
 
 /*********************************************************************
 *
 *       _LCD_MixColorsBulk
+*
+* Purpose:
+*   Line y+1 is inverted by the CPU while DMA2D mixes line y.
 */
 static void _LCD_MixColorsBulk(U32 * pFG, U32 * pBG, U32 * pDst, unsigned OffFG, unsigned OffBG, unsigned OffDest, unsigned xSize, unsigned ySize, U8 Intens)
 {
+    U32 Fence, Slot;
+    U32 * pDstPrev;
     int y;
 
     GUI_USE_PARA(OffFG);
     GUI_USE_PARA(OffDest);
 
+    Fence = Slot = 0;
+    pDstPrev = pDst;
     for (y = 0; y < ySize; y++)
     {
-        _InvertAlpha(pFG, _pBuffer_FG, xSize); // Invert alpha values
-        _InvertAlpha(pBG, _pBuffer_BG, xSize);
-        _DMA_MixColorsBulk(_pBuffer_FG, _pBuffer_BG, _pBuffer_DMA2D, Intens, xSize);
-        _InvertAlpha(_pBuffer_DMA2D, pDst, xSize);
+        _InvertAlpha(pFG, _pBuffer_FG + Slot * DMA2D_CHUNK_ITEMS, xSize); // Invert alpha values
+        _InvertAlpha(pBG, _pBuffer_BG + Slot * DMA2D_CHUNK_ITEMS, xSize);
+        Fence = _DMA_MixColorsBulk(_pBuffer_FG + Slot * DMA2D_CHUNK_ITEMS, _pBuffer_BG + Slot * DMA2D_CHUNK_ITEMS, _pBuffer_DMA2D + Slot * DMA2D_CHUNK_ITEMS, Intens, xSize);
+        if (y)
+        {
+            Dma2dQueue_Wait(&_Dma2dQueue, Fence - 1);
+            _InvertAlpha(_pBuffer_DMA2D + (Slot ^ 1) * DMA2D_CHUNK_ITEMS, pDstPrev, xSize);
+        }
+        pDstPrev = pDst;
         pFG  += xSize + OffFG;
         pBG  += xSize + OffBG;
         pDst += xSize + OffDest;
+        Slot ^= 1;
+    }
+    if (y)
+    {
+        Dma2dQueue_Wait(&_Dma2dQueue, Fence);
+        _InvertAlpha(_pBuffer_DMA2D + (Slot ^ 1) * DMA2D_CHUNK_ITEMS, pDstPrev, xSize);
     }
 }
 
@@ -944,18 +1108,134 @@ static U32 _GetBufferSize(int LayerIndex)
     return BufferSize;
 }
 
+/*********************************************************************
+*
+*       _Damage_xxx
+*
+* Purpose:
+*   Device linked on top of the display driver of each layer. Every
+*   drawing operation reports its rectangle to the buffer synchronisation
+*   and is then passed unchanged to the driver. Drawing into memory
+*   devices does not reach this device, only the final copy to the LCD.
+*/
+static void _Damage_DrawBitmap(GUI_DEVICE * pDevice, int x0, int y0, int xSize, int ySize, int BitsPerPixel, int BytesPerLine, const U8 * pData, int Diff, const LCD_PIXELINDEX * pTrans)
+{
+    FbSync_Damage(&_aSync[pDevice->LayerIndex], x0, y0, x0 + xSize - 1, y0 + ySize - 1);
+    pDevice->pNext->pDeviceAPI->pfDrawBitmap(pDevice->pNext, x0, y0, xSize, ySize, BitsPerPixel, BytesPerLine, pData, Diff, pTrans);
+}
+
+static void _Damage_DrawHLine(GUI_DEVICE * pDevice, int x0, int y, int x1)
+{
+    FbSync_Damage(&_aSync[pDevice->LayerIndex], x0, y, x1, y);
+    pDevice->pNext->pDeviceAPI->pfDrawHLine(pDevice->pNext, x0, y, x1);
+}
+
+static void _Damage_DrawVLine(GUI_DEVICE * pDevice, int x, int y0, int y1)
+{
+    FbSync_Damage(&_aSync[pDevice->LayerIndex], x, y0, x, y1);
+    pDevice->pNext->pDeviceAPI->pfDrawVLine(pDevice->pNext, x, y0, y1);
+}
+
+static void _Damage_FillRect(GUI_DEVICE * pDevice, int x0, int y0, int x1, int y1)
+{
+    FbSync_Damage(&_aSync[pDevice->LayerIndex], x0, y0, x1, y1);
+    pDevice->pNext->pDeviceAPI->pfFillRect(pDevice->pNext, x0, y0, x1, y1);
+}
+
+static LCD_PIXELINDEX _Damage_GetPixelIndex(GUI_DEVICE * pDevice, int x, int y)
+{
+    return pDevice->pNext->pDeviceAPI->pfGetPixelIndex(pDevice->pNext, x, y);
+}
+
+static void _Damage_SetPixelIndex(GUI_DEVICE * pDevice, int x, int y, LCD_PIXELINDEX ColorIndex)
+{
+    FbSync_Damage(&_aSync[pDevice->LayerIndex], x, y, x, y);
+    pDevice->pNext->pDeviceAPI->pfSetPixelIndex(pDevice->pNext, x, y, ColorIndex);
+}
+
+static void _Damage_XorPixel(GUI_DEVICE * pDevice, int x, int y)
+{
+    FbSync_Damage(&_aSync[pDevice->LayerIndex], x, y, x, y);
+    pDevice->pNext->pDeviceAPI->pfXorPixel(pDevice->pNext, x, y);
+}
+
+static void _Damage_SetOrg(GUI_DEVICE * pDevice, int x, int y)
+{
+    pDevice->pNext->pDeviceAPI->pfSetOrg(pDevice->pNext, x, y);
+}
+
+static void (* _Damage_GetDevFunc(GUI_DEVICE ** ppDevice, int Index))(void)
+{
+    *ppDevice = (*ppDevice)->pNext;
+    return (*ppDevice)->pDeviceAPI->pfGetDevFunc(ppDevice, Index);
+}
+
+static I32 _Damage_GetDevProp(GUI_DEVICE * pDevice, int Index)
+{
+    return pDevice->pNext->pDeviceAPI->pfGetDevProp(pDevice->pNext, Index);
+}
+
+static void * _Damage_GetDevData(GUI_DEVICE * pDevice, int Index)
+{
+    return pDevice->pNext->pDeviceAPI->pfGetDevData(pDevice->pNext, Index);
+}
+
+static void _Damage_GetRect(GUI_DEVICE * pDevice, LCD_RECT * pRect)
+{
+    pDevice->pNext->pDeviceAPI->pfGetRect(pDevice->pNext, pRect);
+}
+
+static const GUI_DEVICE_API _DamageAPI = {
+    DEVICE_CLASS_DRIVER_MODIFIER,
+    _Damage_DrawBitmap,
+    _Damage_DrawHLine,
+    _Damage_DrawVLine,
+    _Damage_FillRect,
+    _Damage_GetPixelIndex,
+    _Damage_SetPixelIndex,
+    _Damage_XorPixel,
+    _Damage_SetOrg,
+    _Damage_GetDevFunc,
+    _Damage_GetDevProp,
+    _Damage_GetDevData,
+    _Damage_GetRect,
+};
+
 /*********************************************************************
 *
 *       _LCD_CopyBuffer
+*
+* Purpose:
+*   Brings Buffer[IndexDst] up to date with Buffer[IndexSrc]. Only the
+*   regions drawn since Buffer[IndexDst] was last current are copied,
+*   the complete buffer only if the damage covers most of the screen.
 */
 static void _LCD_CopyBuffer(int LayerIndex, int IndexSrc, int IndexDst)
 {
-    U32 BufferSize, AddrSrc, AddrDst;
+    const GuiDirty_t * pRegion;
+    GuiRect_t Rect;
+    U32 BufferSize, AddrSrc, AddrDst, Offset;
+    int xSize, OffLine;
+    U8 i;
 
     BufferSize = _GetBufferSize(LayerIndex);
     AddrSrc    = _aAddr[LayerIndex] + BufferSize * IndexSrc;
     AddrDst    = _aAddr[LayerIndex] + BufferSize * IndexDst;
-    _DMA_Copy(LayerIndex, (void *)AddrSrc, (void *)AddrDst, _axSize[LayerIndex], _aySize[LayerIndex], 0, 0);
+    pRegion    = FbSync_Begin(&_aSync[LayerIndex], (U8)IndexSrc, (U8)IndexDst);
+    if (pRegion == NULL)
+    {
+        _DMA_Copy(LayerIndex, (void *)AddrSrc, (void *)AddrDst, _axSize[LayerIndex], _aySize[LayerIndex], 0, 0);
+    }
+    else
+    {
+        for (i = 0; GuiDirty_Get(pRegion, i, &Rect); i++)
+        {
+            xSize   = Rect.x1 - Rect.x0 + 1;
+            OffLine = _axSize[LayerIndex] - xSize;
+            Offset  = (Rect.y0 * _axSize[LayerIndex] + Rect.x0) * _aBytesPerPixels[LayerIndex];
+            _DMA_Copy(LayerIndex, (void *)(AddrSrc + Offset), (void *)(AddrDst + Offset), xSize, Rect.y1 - Rect.y0 + 1, OffLine, OffLine);
+        }
+    }
     _aBufferIndex[LayerIndex] = IndexDst; // After this function has been called all drawing operations are routed to Buffer[IndexDst]!
 }
 
@@ -973,6 +1253,7 @@ static void _LCD_CopyRect(int LayerIndex, int x0, int y0, int x1, int y1, int xS
     AddrDst = _aAddr[LayerIndex] + BufferSize * _aBufferIndex[LayerIndex] + (y1 * _axSize[LayerIndex] + x1) * _aBytesPerPixels[LayerIndex];
     OffLine = _axSize[LayerIndex] - xSize;
     _DMA_Copy(LayerIndex, (void *)AddrSrc, (void *)AddrDst, xSize, ySize, OffLine, OffLine);
+    FbSync_Damage(&_aSync[LayerIndex], x1, y1, x1 + xSize - 1, y1 + ySize - 1);
 }
 
 /*********************************************************************
@@ -1099,6 +1380,337 @@ static LCD_PIXELINDEX * _LCD_GetpPalConvTable(const LCD_LOGPALETTE GUI_UNI_PTR *
     return _pBuffer_DMA2D;									// Return something not NULL
 }
 
+/*********************************************************************
+*
+*       _LCD_DrawIconLines
+*
+* Purpose:
+*   Fallback for memory devices and magnification: every line is
+*   decoded to emWin ARGB8888 and drawn by the standard 8888 method.
+*/
+static void _LCD_DrawIconLines(int x0, int y0, const IconImage_t * pImage, int xMag, int yMag)
+{
+    IconCursor_t Cursor;
+    U32 i;
+    int y;
+
+    IconCodec_Begin(&Cursor, pImage);
+    for (y = 0; y < pImage->height; y++)
+    {
+        if (!IconCodec_ReadLine(&Cursor, _aIconLine, true)) return;
+        for (i = 0; i < pImage->width; i++)
+        {
+            if (_IconAlpha != 0xFF)
+            {
+                U32 a = ((_aIconLine[i] >> 24) * _IconAlpha + 127) / 255;
+                _aIconLine[i] = (a << 24) | (_aIconLine[i] & 0x00FFFFFF);
+            }
+            _aIconLine[i] ^= 0xFF000000;                // DMA2D alpha to emWin alpha
+        }
+        GUI_BitmapMethods8888.pfDraw(x0, y0 + y * yMag, pImage->width, 1, (const U8 *)_aIconLine, NULL, xMag, yMag);
+    }
+}
+
+/*********************************************************************
+*
+*       _LCD_DrawIcon
+*
+* Purpose:
+*   Draw method of compact icons (GUI_DRAW_ICON). pPixel points to the
+*   IconImage_t descriptor. A8, L8 and ARGB8888 data is blended by DMA2D
+*   directly from QSPI; RLE lines are decoded by the CPU into two line
+*   slots, so line n+1 is decoded while DMA2D blends line n.
+*/
+static void _LCD_DrawIcon(int x0, int y0, int xSize, int ySize, const U8 * pPixel, const LCD_LOGPALETTE * pLogPal, int xMag, int yMag)
+{
+    const IconImage_t * pImage;
+    IconCursor_t Cursor;
+    Dma2dJob_t Job = { 0 };
+    U32 BufferSize, AddrDst, PixelFormat, Bytes, Fence, Slot;
+    int LayerIndex, cx0, cy0, cx1, cy1, xClip, yClip, y;
+
+    GUI_USE_PARA(pLogPal);
+    pImage = (const IconImage_t *)pPixel;
+    if ((xMag != 1) || (yMag != 1) || GUI_pContext->hDevData || (pImage->format >= ICON_FMT_COUNT) || (pImage->width > DMA2D_CHUNK_ITEMS))
+    {
+        _LCD_DrawIconLines(x0, y0, pImage, xMag, yMag);
+        return;
+    }
+    //
+    // Clip against current clip rectangle
+    //
+    cx0 = GUI_MAX(x0, GUI_pContext->ClipRect.x0);
+    cy0 = GUI_MAX(y0, GUI_pContext->ClipRect.y0);
+    cx1 = GUI_MIN(x0 + xSize - 1, GUI_pContext->ClipRect.x1);
+    cy1 = GUI_MIN(y0 + ySize - 1, GUI_pContext->ClipRect.y1);
+    if ((cx1 < cx0) || (cy1 < cy0)) return;
+    xClip = cx1 - cx0 + 1;
+    yClip = cy1 - cy0 + 1;
+
+    LayerIndex  = GUI_pContext->SelLayer;
+    PixelFormat = _GetPixelformat(LayerIndex);
+    BufferSize  = _GetBufferSize(LayerIndex);
+    AddrDst     = _aAddr[LayerIndex] + BufferSize * _aBufferIndex[LayerIndex] + (cy0 * _axSize[LayerIndex] + cx0) * _aBytesPerPixels[LayerIndex];
+    Bytes       = IconCodec_NativeBytes(pImage);
+    FbSync_Damage(&_aSync[LayerIndex], cx0, cy0, cx1, cy1);
+
+    if ((pImage->format == ICON_FMT_L8) || (pImage->format == ICON_FMT_RLE8))
+    {
+        _DMA_LoadLUT((LCD_COLOR *)pImage->clut, pImage->colors);
+        Job.fgpfccr = LTDC_PIXEL_FORMAT_L8;
+    }
+    else if (pImage->format == ICON_FMT_A8)
+    {
+        Job.fgpfccr = DMA2D_INPUT_A8;
+        Job.fgcolr  = pImage->color;
+    }
+    else
+    {
+        Job.fgpfccr = LTDC_PIXEL_FORMAT_ARGB8888;
+    }
+    if (_IconAlpha != 0xFF)
+    {
+        Job.fgpfccr |= (2UL << 16) | ((U32)_IconAlpha << 24); // Alpha mode: multiply pixel alpha by _IconAlpha
+    }
+    Job.cr      = DMA2D_JOB_M2M_BLEND;                // Memory to memory with blending of FG and BG
+    Job.bgmar   = AddrDst;                            // Background is the frame buffer itself
+    Job.bgor    = _axSize[LayerIndex] - xClip;
+    Job.bgpfccr = PixelFormat;
+    Job.omar    = AddrDst;
+    Job.oor     = _axSize[LayerIndex] - xClip;
+    Job.opfccr  = PixelFormat;
+
+    if ((pImage->format != ICON_FMT_RLE8) && (pImage->format != ICON_FMT_RLE32))
+    {
+        if (((U32)(cy0 - y0 + yClip) * pImage->width * Bytes) > pImage->size) return;
+        Job.fgmar = (uintptr_t)(pImage->data + ((cy0 - y0) * pImage->width + (cx0 - x0)) * Bytes);
+        Job.fgor  = pImage->width - xClip;
+        Job.nlr   = (U32)(xClip << 16) | yClip;
+        _DMA_ExecOperation(&Job);
+        return;
+    }
+    //
+    // RLE: one job per line, alternating between two line slots
+    //
+    IconCodec_Begin(&Cursor, pImage);
+    IconCodec_SkipLines(&Cursor, cy0 - y0);
+    Job.nlr = (U32)(xClip << 16) | 1;
+    Fence = Slot = 0;
+    for (y = 0; y < yClip; y++)
+    {
+        if (y > 1) Dma2dQueue_Wait(&_Dma2dQueue, Fence - 1); // Slot is free when the job two lines back is done
+        if (!IconCodec_ReadLine(&Cursor, _pBuffer_FG + Slot * DMA2D_CHUNK_ITEMS, false)) break;
+        Job.fgmar = (uintptr_t)((U8 *)(_pBuffer_FG + Slot * DMA2D_CHUNK_ITEMS) + (cx0 - x0) * Bytes);
+        Fence = _DMA_PostOperation(&Job);
+        Job.bgmar += _axSize[LayerIndex] * _aBytesPerPixels[LayerIndex];
+        Job.omar   = Job.bgmar;
+        Slot ^= 1;
+    }
+    if (y) Dma2dQueue_Wait(&_Dma2dQueue, Fence);
+}
+
+/*********************************************************************
+*
+*       LCD_SetIconAlpha
+*
+* Purpose:
+*   Sets the opacity of compact icons drawn after the call, 0xFF draws
+*   them with their own alpha. Used for sprites with opacity of the
+*   animation clips (anim_codec.h).
+*/
+void LCD_SetIconAlpha(U8 Alpha)
+{
+    _IconAlpha = Alpha;
+}
+
+/*********************************************************************
+*
+*       _LCD_IndexIcon
+*
+* Purpose:
+*   Compact icons have no index based palette, colors are never
+*   requested by emWin for them.
+*/
+static GUI_COLOR _LCD_IndexIcon(LCD_PIXELINDEX Index)
+{
+    GUI_USE_PARA(Index);
+    return GUI_INVALID_COLOR;
+}
+
+/*********************************************************************
+*
+*       LCD_IconMethods
+*/
+const GUI_BITMAP_METHODS LCD_IconMethods = {
+    _LCD_DrawIcon,
+    _LCD_IndexIcon,
+    NULL,
+    NULL
+};
+
+/*********************************************************************
+*
+*       _GlyphBpp
+*
+* Purpose:
+*   Bits per pixel of a cached font type, 0 for other fonts.
+*/
+static U8 _GlyphBpp(const GUI_FONT * pFont)
+{
+    if (pFont->pfGetFontInfo == GUIPROP_AA2_GetFontInfo) return 2;
+    if (pFont->pfGetFontInfo == GUIPROP_AA4_GetFontInfo) return 4;
+    return 0;
+}
+
+/*********************************************************************
+*
+*       _GlyphFetch
+*
+* Purpose:
+*   GlyphFetch_t of the glyph cache: looks the character up in the
+*   GUI_FONT_PROP chain of the font, the same way emWin does.
+*/
+static bool _GlyphFetch(const void * pFont, U16 Code, GlyphSource_t * pSource)
+{
+    const GUI_FONT * pF = (const GUI_FONT *)pFont;
+    const GUI_FONT_PROP * pProp;
+    const GUI_CHARINFO * pInfo;
+
+    for (pProp = pF->p.pProp; pProp; pProp = pProp->pNext)
+    {
+        if ((Code >= pProp->First) && (Code <= pProp->Last))
+        {
+            pInfo = &pProp->paCharInfo[Code - pProp->First];
+            pSource->data           = pInfo->pData;
+            pSource->width          = pInfo->XSize;
+            pSource->height         = pF->YSize;
+            pSource->xdist          = pInfo->XDist;
+            pSource->bpp            = _GlyphBpp(pF);
+            pSource->bytes_per_line = pInfo->BytesPerLine;
+            return true;
+        }
+    }
+    return false;
+}
+
+/*********************************************************************
+*
+*       LCD_GlyphDispChar
+*
+* Purpose:
+*   pfDispChar of GUI_FONTTYPE_PROP_AA2_CACHED / _AA4_CACHED. Transparent
+*   text on a layer is drawn from the A8 glyph cache by the compact icon
+*   method (DMA2D A8 blending). Other text modes, memory devices,
+*   magnified fonts and glyphs which do not fit the cache are drawn by
+*   emWin as before. DispPosX/Y are screen coordinates at this point.
+*/
+void LCD_GlyphDispChar(U16 c)
+{
+    const GUI_FONT * pFont;
+    const GlyphCacheEntry_t * pGlyph;
+    IconImage_t Image;
+    GUI_COLOR Color;
+    U32 Fetches;
+    U8 Bpp;
+
+    pFont  = GUI_pContext->pAFont;
+    Bpp    = _GlyphBpp(pFont);
+    pGlyph = NULL;
+    if ((Bpp != 0) && (GUI_pContext->TextMode == GUI_TM_TRANS) && !GUI_pContext->hDevData && (pFont->XMag == 1) && (pFont->YMag == 1))
+    {
+        Fetches = _GlyphCache.fetches;
+        pGlyph  = GlyphCache_Get(&_GlyphCache, pFont, c);
+        if ((pGlyph != NULL) && (_GlyphCache.fetches != Fetches))
+        {
+            SCB_CleanDCache_by_Addr((uint32_t *)pGlyph->alpha, pGlyph->size); // Decoded by the CPU, read by DMA2D
+        }
+    }
+    if (pGlyph == NULL)
+    {
+        if (Bpp == 4) GUIPROP_AA4_DispChar(c);
+        else          GUIPROP_AA2_DispChar(c);
+        return;
+    }
+    if (pGlyph->width)
+    {
+        Color          = GUI_pContext->Color;                                   // emWin ABGR to DMA2D RGB888
+        Image.format   = ICON_FMT_A8;
+        Image.colors   = 0;
+        Image.width    = pGlyph->width;
+        Image.height   = pGlyph->height;
+        Image.color    = ((Color & 0xFF) << 16) | (Color & 0xFF00) | ((Color >> 16) & 0xFF);
+        Image.clut     = NULL;
+        Image.data     = pGlyph->alpha;
+        Image.size     = (U32)pGlyph->width * pGlyph->height;
+        _LCD_DrawIcon(GUI_pContext->DispPosX, GUI_pContext->DispPosY, Image.width, Image.height, (const U8 *)&Image, NULL, 1, 1);
+    }
+    GUI_pContext->DispPosX += pGlyph->xdist;
+}
+
+/*********************************************************************
+*
+*       LCD_GlyphPreload
+*
+* Purpose:
+*   Keeps the characters of the UTF-8 string sText permanently in the
+*   glyph cache. Returns the number of characters which are cached.
+*/
+U32 LCD_GlyphPreload(const GUI_FONT * pFont, const char * sText)
+{
+    U16 aCode[GLYPH_PRELOAD_MAX];
+    U16 NumChars;
+
+    NumChars = 0;
+    while (*sText && (NumChars < GLYPH_PRELOAD_MAX))
+    {
+        aCode[NumChars++] = GUI_UC_GetCharCode(sText);
+        sText += GUI_UC_GetCharSize(sText);
+    }
+    if (_GlyphBpp(pFont) == 0) return 0;
+    return GlyphCache_Preload(&_GlyphCache, pFont, aCode, NumChars);
+}
+
+/*********************************************************************
+*
+*       LCD_GetGlyphCacheReport
+*
+* Purpose:
+*   Writes one line of glyph cache statistics and returns the number of
+*   characters written.
+*/
+U32 LCD_GetGlyphCacheReport(char * pBuf, U32 Size)
+{
+    return GlyphCache_Report(&_GlyphCache, pBuf, Size);
+}
+
+/*********************************************************************
+*
+*       LCD_GetFrameBufferArea
+*
+* Purpose:
+*   Returns the base address of the frame buffers of all layers and
+*   writes their total size to *pSize.
+*/
+U32 LCD_GetFrameBufferArea(U32 * pSize)
+{
+    *pSize = VRAM_SIZE;
+    return VRAM_ADDR;
+}
+
+/*********************************************************************
+*
+*       LCD_GetGlyphPoolArea
+*
+* Purpose:
+*   Returns the address of the glyph cache pool in .glyph_cache and
+*   writes its size to *pSize.
+*/
+U32 LCD_GetGlyphPoolArea(U32 * pSize)
+{
+    *pSize = sizeof(_aGlyphPool);
+    return (U32)_aGlyphPool;
+}
+
 /*********************************************************************
 *
 *       _LCD_SetOrg
@@ -1228,24 +1840,141 @@ static void _LCD_SetChroma(int LayerIndex, LCD_COLOR ChromaMin, LCD_COLOR Chroma
 void HAL_LTDC_LineEvenCallback(LTDC_HandleTypeDef *hltdc)
 {
     U32 Addr;
+    int Flip;
     int i;
 
+    Flip = 0;
     for (i = 0; i < GUI_NUM_LAYERS; i++)
     {
         if (_aPendingBuffer[i] >= 0)
         {
+            Flip = 1;
             Addr = _aAddr[i] + _axSize[i] * _aySize[i] *
                    _aPendingBuffer[i] * _aBytesPerPixels[i];	// Calculate address of buffer to be used  as visible frame buffer
             HAL_LTDC_SetAddress(hltdc, Addr, i);				// Set address
             __HAL_LTDC_RELOAD_CONFIG(hltdc);					// Reload configuration
             GUI_MULTIBUF_ConfirmEx(i, _aPendingBuffer[i]);		// Tell emWin that buffer is used
+            _aShownBuffer[i] = _aPendingBuffer[i];
             _aPendingBuffer[i] = -1;							// Clear pending buffer flag of layer
         }
     }
+    if (Flip)
+    {
+        _FlipTime = DWT->CYCCNT;
+        _FlipCount++;
+    }
+    _VsyncCount++;
 
     HAL_LTDC_ProgramLineEvent(hltdc, 0);
 }
 
+/*********************************************************************
+*
+*       LCD_GetVsyncCount
+*
+* Purpose:
+*   Number of LTDC line events since start, one per displayed frame.
+*/
+U32 LCD_GetVsyncCount(void)
+{
+    return _VsyncCount;
+}
+
+/*********************************************************************
+*
+*       LCD_IsBufferPending
+*
+* Purpose:
+*   Returns 1 if a finished buffer of any layer waits to be shown on
+*   the next line event.
+*/
+int LCD_IsBufferPending(void)
+{
+    int i;
+
+    for (i = 0; i < GUI_NUM_LAYERS; i++)
+    {
+        if (_aPendingBuffer[i] >= 0) return 1;
+    }
+    return 0;
+}
+
+/*********************************************************************
+*
+*       LCD_GetFlipCount
+*
+* Purpose:
+*   Number of line events that showed a new buffer of any layer.
+*/
+U32 LCD_GetFlipCount(void)
+{
+    return _FlipCount;
+}
+
+/*********************************************************************
+*
+*       LCD_GetShownBuffer
+*
+* Purpose:
+*   Returns the address of the buffer of the given layer the LTDC
+*   scans out, 0 for an invalid layer. emWin draws into another buffer,
+*   so the content only changes with the next flip (LCD_GetFlipCount).
+*/
+U32 LCD_GetShownBuffer(int LayerIndex)
+{
+    if ((LayerIndex < 0) || (LayerIndex >= GUI_NUM_LAYERS)) return 0;
+    return _aAddr[LayerIndex] + _axSize[LayerIndex] * _aySize[LayerIndex] *
+           _aShownBuffer[LayerIndex] * _aBytesPerPixels[LayerIndex];
+}
+
+/*********************************************************************
+*
+*       LCD_GetFlipTime
+*
+* Purpose:
+*   DWT cycle counter at the last buffer flip. The count is read again
+*   so a flip between the two reads can not pair a new count with an
+*   old time.
+*/
+U32 LCD_GetFlipTime(void)
+{
+    U32 Count;
+    U32 Time;
+
+    do
+    {
+        Count = _FlipCount;
+        Time  = _FlipTime;
+    } while (Count != _FlipCount);
+    return Time;
+}
+
+/*********************************************************************
+*
+*       LCD_GetDma2dBusyCycles
+*
+* Purpose:
+*   DWT cycles spent with a DMA2D job running since start, wraps.
+*   Includes the time until the completion interrupt is served.
+*/
+U32 LCD_GetDma2dBusyCycles(void)
+{
+    return _Dma2dBusy;
+}
+
+/*********************************************************************
+*
+*       LCD_GetDma2dErrors
+*
+* Purpose:
+*   DMA2D jobs ended by a transfer or configuration error, or aborted
+*   after DMA2D_TIMEOUT_MS, since start.
+*/
+U32 LCD_GetDma2dErrors(void)
+{
+    return _Dma2dErrors;
+}
+
 
 /*********************************************************************
 *
@@ -1578,6 +2307,51 @@ int LCD_X_DisplayDriver(unsigned LayerIndex, unsigned Cmd, void * p)
     return r;
 }
 
+/*********************************************************************
+*
+*       LCD_DMA2D_IRQHandler
+*
+* Purpose:
+*   Called from DMA2D interrupt. Clears the flags and starts the next
+*   queued job. A transfer or configuration error also ends the job,
+*   so the queue can not stall waiting for it.
+*/
+void LCD_DMA2D_IRQHandler(void)
+{
+    U32 Flags;
+
+    Flags = DMA2D->ISR;
+    DMA2D->IFCR = Flags & (DMA2D_ISR_TEIF | DMA2D_ISR_TCIF | DMA2D_ISR_TWIF | DMA2D_ISR_CAEIF | DMA2D_ISR_CTCIF | DMA2D_ISR_CEIF);
+    if (Flags & (DMA2D_ISR_TCIF | DMA2D_ISR_TEIF | DMA2D_ISR_CEIF))
+    {
+        if (Flags & (DMA2D_ISR_TEIF | DMA2D_ISR_CEIF)) _Dma2dErrors++;
+        _Dma2dBusy += DWT->CYCCNT - _Dma2dStart;
+        Dma2dQueue_Complete(&_Dma2dQueue);
+    }
+}
+
+/*********************************************************************
+*
+*       LCD_GetBufferSyncReport
+*
+* Purpose:
+*   Writes one line per layer with the bytes copied per frame by
+*   _LCD_CopyBuffer() and returns the number of characters written.
+*/
+U32 LCD_GetBufferSyncReport(char * pBuf, U32 Size)
+{
+    U32 Len;
+    int i;
+
+    Len = 0;
+    if (Size) pBuf[0] = '\0';
+    for (i = 0; i < GUI_NUM_LAYERS; i++)
+    {
+        Len += FbSync_Report(&_aSync[i], (U8)i, &pBuf[Len], Size - Len);
+    }
+    return Len;
+}
+
 /*********************************************************************
 *
 *       LCD_X_Config
@@ -1618,6 +2392,7 @@ void LCD_X_Config(void)
     HAL_NVIC_SetPriority(LTDC_IRQn, 0xE, 0); 					// Set LTDC Interrupt to the lowest priority
     HAL_NVIC_EnableIRQ(LTDC_IRQn);								// Enable LTDC Interrupt
 
+    Dma2dQueue_Init(&_Dma2dQueue, &_Dma2dBackend);				// Empty DMA2D job queue
     HAL_NVIC_SetPriority(DMA2D_IRQn, 0xE, 0);					// Set DMA2DInterrupt to the lowest priority
     HAL_NVIC_EnableIRQ(DMA2D_IRQn);								// Enable DMA2D Interrupt
     HAL_GPIO_WritePin(GPIOE, GPIO_PIN_2, GPIO_PIN_SET);			// Display enable
@@ -1632,6 +2407,7 @@ void LCD_X_Config(void)
 #endif
 
     GUI_DEVICE_CreateAndLink(DSP_DRIVER_0, COLOR_CONVERSION_0, 0, 0);					// Set display driver and color conversion for 1st layer
+    GUI_DEVICE_CreateAndLink(&_DamageAPI, COLOR_CONVERSION_0, 0, 0);					// Record drawn areas of 1st layer for partial buffer copies
 
     if (LCD_GetSwapXYEx(0)) 																// Set size of 1st layer
     {
@@ -1649,6 +2425,7 @@ void LCD_X_Config(void)
 #if (GUI_NUM_LAYERS > 1)
 
     GUI_DEVICE_CreateAndLink(DSP_DRIVER_1, COLOR_CONVERSION_1, 0, 1);		// Set display driver and color conversion for 2nd layer
+    GUI_DEVICE_CreateAndLink(&_DamageAPI, COLOR_CONVERSION_1, 0, 1);		// Record drawn areas of 2nd layer for partial buffer copies
 
     if (LCD_GetSwapXYEx(1))														// Set size of 2nd layer
     {
@@ -1667,14 +2444,16 @@ void LCD_X_Config(void)
     {
         LCD_SetVRAMAddrEx(i, (void *)(_aAddr[i]));								// Setting up VRam address
         _aBytesPerPixels[i] = LCD_GetBitsPerPixelEx(i) >> 3;                  	// Remember pixel size
+        FbSync_Init(&_aSync[i], LCD_GetXSizeEx(i), LCD_GetYSizeEx(i), _aBytesPerPixels[i], NUM_BUFFERS, 0);	// Only buffer 0 is valid at start
+
+        LCD_SetDevFunc(i, LCD_DEVFUNC_COPYBUFFER, (void(*)(void))_LCD_CopyBuffer);			// Set custom function for copying changed areas of buffers (used by multiple buffering) using DMA2D
+        LCD_SetDevFunc(i, LCD_DEVFUNC_COPYRECT, (void(*)(void))_LCD_CopyRect);				// Set custom function for copy recxtangle areas (used by GUI_CopyRect()) using DMA2D
+        LCD_SetDevFunc(i, LCD_DEVFUNC_FILLRECT, (void(*)(void))_LCD_FillRect);				// Set custom function for filling operations using DMA2D
+        LCD_SetDevFunc(i, LCD_DEVFUNC_DRAWBMP_32BPP, (void(*)(void))_LCD_DrawBitmap32bpp);	// Set up drawing routine for 32bpp bitmap using DMA2D. Makes only sense with ARGB8888 */
+        LCD_SetDevFunc(i, LCD_DEVFUNC_DRAWBMP_16BPP, (void(*)(void))_LCD_DrawBitmap16bpp);	// Set up drawing routine for 16bpp bitmap using DMA2D. Makes only sense with RGB565
+        LCD_SetDevFunc(i, LCD_DEVFUNC_DRAWBMP_8BPP, (void(*)(void))_LCD_DrawBitmap8bpp);	// Set up custom drawing routine for index based bitmaps using DMA2D
     }
-
-    LCD_SetDevFunc(i, LCD_DEVFUNC_COPYBUFFER, (void(*)(void))_LCD_CopyBuffer);				// Set custom function for copying complete buffers (used by multiple buffering) using DMA2D
-    LCD_SetDevFunc(i, LCD_DEVFUNC_COPYRECT, (void(*)(void))_LCD_CopyRect);					// Set custom function for copy recxtangle areas (used by GUI_CopyRect()) using DMA2D
-    LCD_SetDevFunc(i, LCD_DEVFUNC_FILLRECT, (void(*)(void))_LCD_FillRect);					// Set custom function for filling operations using DMA2D
-    LCD_SetDevFunc(i, LCD_DEVFUNC_DRAWBMP_32BPP, (void(*)(void))_LCD_DrawBitmap32bpp);		// Set up drawing routine for 32bpp bitmap using DMA2D. Makes only sense with ARGB8888 */
-    LCD_SetDevFunc(i, LCD_DEVFUNC_DRAWBMP_16BPP, (void(*)(void))_LCD_DrawBitmap16bpp);		// Set up drawing routine for 16bpp bitmap using DMA2D. Makes only sense with RGB565
-    LCD_SetDevFunc(i, LCD_DEVFUNC_DRAWBMP_8BPP, (void(*)(void))_LCD_DrawBitmap8bpp);		// Set up custom drawing routine for index based bitmaps using DMA2D
+    GlyphCache_Init(&_GlyphCache, _aGlyphPool, sizeof(_aGlyphPool), _GlyphFetch);			// Glyph cache of the GUI_FONTTYPE_PROP_AAx_CACHED fonts
 
     /********************************************************************************************/
     /*		 			Set up custom color conversion using DMA2D, 							*/
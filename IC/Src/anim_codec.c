@@ -0,0 +1,149 @@
+/**
+ ******************************************************************************
+ * @file    anim_codec.c
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Dekodiranje i puštanje klipova animacije.
+ *
+ * @note    Frejm `s` od starta je `s % frame_count`, a prikazuje se u
+ * trenutku `start_ms + s * frame_ms`. Klip je završen kad istekne vrijeme
+ * zadnjeg frejma.
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* UKLJUCENI FAJLOVI (INCLUDES)                                               */
+/*============================================================================*/
+#include "anim_codec.h"
+#include <string.h>
+
+/*============================================================================*/
+/* PROTOTIPOVI PRIVATNIH FUNKCIJA                                             */
+/*============================================================================*/
+static bool Anim_Blit(const AnimClip_t *clip, const AnimPatch_t *patch, uint32_t *canvas);
+
+/*============================================================================*/
+/* IMPLEMENTACIJA JAVNIH FUNKCIJA                                             */
+/*============================================================================*/
+
+void AnimCodec_ScaleAlpha(uint32_t *pixels, uint32_t count, uint8_t alpha)
+{
+    if (alpha == 0xFFU) return;
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        uint32_t a = ((pixels[i] >> 24) * alpha + 127U) / 255U;
+        pixels[i] = (a == 0U) ? 0U : ((a << 24) | (pixels[i] & 0x00FFFFFFU));
+    }
+}
+
+bool AnimCodec_DecodeKeyframe(const AnimClip_t *clip, uint32_t *canvas)
+{
+    const AnimPatch_t *key = &clip->keyframe;
+
+    if ((key->image == NULL) || (key->x != 0U) || (key->y != 0U) ||
+        (key->image->width != clip->width) || (key->image->height != clip->height)) return false;
+    return Anim_Blit(clip, key, canvas);
+}
+
+bool AnimCodec_ApplyFrame(const AnimClip_t *clip, uint16_t frame, uint32_t *canvas)
+{
+    const AnimFrame_t *f;
+
+    if (frame >= clip->frame_count) return false;
+    f = &clip->frames[frame];
+    if (((uint32_t)f->first + f->count) > clip->patch_count) return false;
+
+    for (uint16_t i = 0U; i < f->count; i++)
+    {
+        if (!Anim_Blit(clip, &clip->patches[f->first + i], canvas)) return false;
+    }
+    return true;
+}
+
+void AnimPlayer_Start(AnimPlayer_t *player, const AnimPlayerOps_t *ops, const AnimClip_t *clip,
+                      int16_t x, int16_t y, uint16_t repeats, uint32_t now_ms)
+{
+    memset(player, 0, sizeof(AnimPlayer_t));
+    player->clip = clip;
+    player->ops = ops;
+    player->x = x;
+    player->y = y;
+    player->start_ms = now_ms;
+    if ((clip->frame_count == 0U) || (clip->frame_ms == 0U) || (clip->keyframe.image == NULL)) return;
+
+    player->total = (uint32_t)((repeats != 0U) ? repeats : 1U) * clip->frame_count - 1U;
+    player->running = true;
+    ops->draw(clip->keyframe.image, (int16_t)(x + clip->keyframe.x), (int16_t)(y + clip->keyframe.y), clip->keyframe.alpha);
+    if (ops->frame != NULL) ops->frame();
+}
+
+bool AnimPlayer_Step(AnimPlayer_t *player, uint32_t now_ms)
+{
+    const AnimClip_t *clip = player->clip;
+    uint32_t due;
+
+    if (!player->running) return false;
+
+    due = (now_ms - player->start_ms) / clip->frame_ms;
+    if (due > player->total)
+    {
+        // Vrijeme zadnjeg frejma je isteklo; nedostajući frejmovi se ipak
+        // iscrtaju da bi na ekranu ostao zadnji frejm klipa.
+        if (player->shown == player->total) { player->running = false; return false; }
+        due = player->total;
+    }
+    if (due <= player->shown) return true;
+
+    player->late += due - player->shown - 1U;
+    while (player->shown < due)
+    {
+        const AnimFrame_t *f;
+
+        player->shown++;
+        player->frame = (uint16_t)(player->shown % clip->frame_count);
+        f = &clip->frames[player->frame];
+        for (uint16_t i = 0U; (i < f->count) && (((uint32_t)f->first + i) < clip->patch_count); i++)
+        {
+            const AnimPatch_t *p = &clip->patches[f->first + i];
+            player->ops->draw(p->image, (int16_t)(player->x + p->x), (int16_t)(player->y + p->y), p->alpha);
+            player->patches++;
+        }
+    }
+    if (player->ops->frame != NULL) player->ops->frame();
+    return true;
+}
+
+uint32_t AnimPlayer_Wait(const AnimPlayer_t *player, uint32_t now_ms)
+{
+    uint32_t elapsed = now_ms - player->start_ms;
+    uint32_t next;
+
+    if (!player->running) return 0U;
+    next = (player->shown + 1U) * player->clip->frame_ms;
+    return (next > elapsed) ? (next - elapsed) : 0U;
+}
+
+/*============================================================================*/
+/* IMPLEMENTACIJA PRIVATNIH FUNKCIJA                                          */
+/*============================================================================*/
+
+/**
+ * @brief  Kopira pravougaonik (sa njegovom providnošću) u platno klipa.
+ */
+static bool Anim_Blit(const AnimClip_t *clip, const AnimPatch_t *patch, uint32_t *canvas)
+{
+    const IconImage_t *image = patch->image;
+    IconCursor_t cursor;
+
+    if ((image == NULL) || (((uint32_t)patch->x + image->width) > clip->width) ||
+        (((uint32_t)patch->y + image->height) > clip->height)) return false;
+
+    IconCodec_Begin(&cursor, image);
+    for (uint16_t row = 0U; row < image->height; row++)
+    {
+        uint32_t *line = &canvas[(uint32_t)(patch->y + row) * clip->width + patch->x];
+
+        if (!IconCodec_ReadLine(&cursor, line, true)) return false;
+        AnimCodec_ScaleAlpha(line, image->width, patch->alpha);
+    }
+    return true;
+}
@@ -0,0 +1,259 @@
+/**
+ ******************************************************************************
+ * @file    clock_face.c
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Implementacija sata koji crta samo promijenjene ćelije.
+ *
+ * @note    Znak se iscrta u keš tek kad se prvi put prikaže, pa sat koji
+ * radi od 22:00 do 07:00 ne drži uređaje za cifre koje ne vidi. Ćelija iz
+ * keša je cijela (providna pozadina i znak), pa je kopija ujedno i brisanje
+ * starog znaka.
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* UKLJUCENI FAJLOVI (INCLUDES)                                               */
+/*============================================================================*/
+#include "clock_face.h"
+#include <stdio.h>
+#include <string.h>
+
+/*============================================================================*/
+/* PROTOTIPOVI PRIVATNIH FUNKCIJA                                             */
+/*============================================================================*/
+static int8_t Glyph_Index(char c);
+static uint32_t Glyph_Get(ClockFace_t *cf, char c, const GuiRect_t *cell);
+static uint32_t Rect_Area(const GuiRect_t *r);
+
+/*============================================================================*/
+/* IMPLEMENTACIJA JAVNIH FUNKCIJA                                             */
+/*============================================================================*/
+
+void ClockFace_Init(ClockFace_t *cf, const ClockFaceOps_t *ops, const char *pattern, int16_t cx, int16_t cy,
+                    int16_t height, int16_t date_x, int16_t date_y, int16_t date_height, uint32_t color)
+{
+    int16_t digit_width = 0;
+    int16_t width = 0;
+    int16_t x;
+
+    memset(cf, 0, sizeof(ClockFace_t));
+    cf->ops = ops;
+    cf->color = color;
+    for (char c = '0'; c <= '9'; c++)
+    {
+        int16_t w = ops->char_width(c);
+        if (w > digit_width) digit_width = w;
+    }
+
+    while ((pattern[cf->cell_count] != '\0') && (cf->cell_count < CLOCK_FACE_MAX_CELLS))
+    {
+        char c = pattern[cf->cell_count];
+        cf->digit[cf->cell_count] = (c >= '0') && (c <= '9');
+        cf->cells[cf->cell_count].x1 = cf->digit[cf->cell_count] ? digit_width : ops->char_width(c);
+        width = (int16_t)(width + cf->cells[cf->cell_count].x1);
+        cf->cell_count++;
+    }
+
+    x = (int16_t)(cx - (width / 2));
+    for (uint8_t i = 0U; i < cf->cell_count; i++)
+    {
+        GuiRect_t *r = &cf->cells[i];
+        int16_t w = r->x1;
+
+        r->x0 = x;
+        r->x1 = (int16_t)(x + w - 1);
+        r->y0 = (int16_t)(cy - (height / 2));
+        r->y1 = (int16_t)(r->y0 + height - 1);
+        x = (int16_t)(x + w);
+        cf->time_pixels += Rect_Area(r);
+    }
+
+    cf->full_pixels = cf->time_pixels;
+    cf->date_x = date_x;
+    cf->date_y0 = (int16_t)(date_y - (date_height / 2));
+    cf->date_height = date_height;
+    cf->date_rect.x0 = 0;
+    cf->date_rect.x1 = -1;
+}
+
+void ClockFace_SetColor(ClockFace_t *cf, uint32_t color)
+{
+    if (color == cf->color) return;
+    cf->color = color;
+    ClockFace_Release(cf);
+    ClockFace_Invalidate(cf);
+}
+
+void ClockFace_Invalidate(ClockFace_t *cf)
+{
+    memset(cf->shown, 0, sizeof(cf->shown));
+    cf->date[0] = '\0';
+    // Obrisan ekran nema starog datuma koji bi trebalo brisati.
+    cf->date_rect.x0 = 0;
+    cf->date_rect.x1 = -1;
+}
+
+void ClockFace_Release(ClockFace_t *cf)
+{
+    for (uint8_t i = 0U; i < CLOCK_FACE_GLYPHS; i++)
+    {
+        if (cf->glyphs[i] != 0U) cf->ops->release(cf->glyphs[i]);
+        cf->glyphs[i] = 0U;
+    }
+    cf->glyph_bytes = 0U;
+}
+
+uint32_t ClockFace_Update(ClockFace_t *cf, const char *time, const char *date)
+{
+    const ClockFaceOps_t *ops = cf->ops;
+    uint8_t changed = 0U;
+    bool digit = false;
+    bool new_date = (date != NULL) && (strncmp(date, cf->date, sizeof(cf->date) - 1U) != 0);
+    uint32_t pixels = 0U;
+
+    for (uint8_t i = 0U; i < cf->cell_count; i++)
+    {
+        char c = (time[0] != '\0') ? *time++ : ' ';
+
+        if (c == cf->shown[i]) continue;
+        if (changed == 0U) ops->begin();
+        changed++;
+        if (cf->digit[i]) digit = true;
+        cf->shown[i] = c;
+        pixels += Rect_Area(&cf->cells[i]);
+
+        uint32_t glyph = Glyph_Get(cf, c, &cf->cells[i]);
+        if (glyph != 0U)
+        {
+            ops->blit(glyph, cf->cells[i].x0, cf->cells[i].y0);
+            cf->blits++;
+        }
+        else
+        {
+            ops->draw(c, &cf->cells[i], cf->color);
+            cf->direct++;
+        }
+    }
+
+    if (new_date)
+    {
+        GuiRect_t rect;
+        GuiRect_t clear;
+        int16_t w = ops->text_width(date);
+
+        if (changed == 0U) ops->begin();
+        changed++;
+        rect.x0 = (int16_t)(cf->date_x - (w / 2));
+        rect.x1 = (int16_t)(rect.x0 + w - 1);
+        rect.y0 = cf->date_y0;
+        rect.y1 = (int16_t)(cf->date_y0 + cf->date_height - 1);
+        clear = rect;
+        if (cf->date_rect.x1 >= cf->date_rect.x0)
+        {
+            // Kraći novi datum: briše se i ostatak starog.
+            if (cf->date_rect.x0 < clear.x0) clear.x0 = cf->date_rect.x0;
+            if (cf->date_rect.x1 > clear.x1) clear.x1 = cf->date_rect.x1;
+        }
+        ops->draw_date(date, &clear, cf->color);
+        strncpy(cf->date, date, sizeof(cf->date) - 1U);
+        cf->date[sizeof(cf->date) - 1U] = '\0';
+        cf->full_pixels = cf->time_pixels + Rect_Area(&rect);
+        cf->date_rect = rect;
+        cf->last_date_pixels = Rect_Area(&clear);
+        pixels += cf->last_date_pixels;
+        cf->dates++;
+    }
+
+    if (changed == 0U)
+    {
+        cf->idle++;
+        return 0U;
+    }
+    ops->end();
+
+    cf->minute_acc += pixels;
+    if (digit)
+    {
+        cf->minutes++;
+        cf->last_minute_pixels = cf->minute_acc;
+        if (cf->minute_acc > cf->max_minute_pixels) cf->max_minute_pixels = cf->minute_acc;
+        cf->sum_minute_pixels += cf->minute_acc;
+        cf->minute_acc = 0U;
+    }
+    else
+    {
+        cf->ticks++;
+        cf->tick_pixels += pixels;
+    }
+    return pixels;
+}
+
+uint32_t ClockFace_Report(const ClockFace_t *cf, char *buf, uint32_t size)
+{
+    uint8_t glyphs = 0U;
+    int n;
+
+    if (size == 0U) return 0U;
+    for (uint8_t i = 0U; i < CLOCK_FACE_GLYPHS; i++)
+    {
+        if (cf->glyphs[i] != 0U) glyphs++;
+    }
+    n = snprintf(buf, size,
+                 "clock: full %lu px, glyphs %u (%lu KB), blit %lu, miss %lu, direct %lu, idle %lu\n"
+                 "minute n %lu: last %lu, avg %lu, max %lu px; tick n %lu: avg %lu px; date n %lu: last %lu px\n",
+                 (unsigned long)cf->full_pixels, glyphs, (unsigned long)(cf->glyph_bytes / 1024U),
+                 (unsigned long)cf->blits, (unsigned long)cf->misses, (unsigned long)cf->direct,
+                 (unsigned long)cf->idle, (unsigned long)cf->minutes, (unsigned long)cf->last_minute_pixels,
+                 (unsigned long)((cf->minutes != 0U) ? (cf->sum_minute_pixels / cf->minutes) : 0U),
+                 (unsigned long)cf->max_minute_pixels, (unsigned long)cf->ticks,
+                 (unsigned long)((cf->ticks != 0U) ? (cf->tick_pixels / cf->ticks) : 0U),
+                 (unsigned long)cf->dates, (unsigned long)cf->last_date_pixels);
+    if ((n < 0) || ((uint32_t)n >= size))
+    {
+        buf[0] = '\0';
+        return 0U;
+    }
+    return (uint32_t)n;
+}
+
+/*============================================================================*/
+/* IMPLEMENTACIJA PRIVATNIH FUNKCIJA                                          */
+/*============================================================================*/
+
+/**
+ * @brief  Mjesto znaka u kešu, -1 ako se znak ne kešira.
+ */
+static int8_t Glyph_Index(char c)
+{
+    if ((c >= '0') && (c <= '9')) return (int8_t)(c - '0');
+    if (c == ':') return 10;
+    if (c == ' ') return 11;
+    return -1;
+}
+
+/**
+ * @brief  Uređaj znaka veličine ćelije; iscrta ga u keš ako ga nema.
+ * @retval uint32_t Uređaj ili 0 (znak se ne kešira ili nema memorije).
+ */
+static uint32_t Glyph_Get(ClockFace_t *cf, char c, const GuiRect_t *cell)
+{
+    int8_t index = Glyph_Index(c);
+    int16_t w = (int16_t)(cell->x1 - cell->x0 + 1);
+    int16_t h = (int16_t)(cell->y1 - cell->y0 + 1);
+
+    if (index < 0) return 0U;
+    if (cf->glyphs[index] == 0U)
+    {
+        // Sve ćelije cifara su iste širine, pa jedan uređaj služi svakoj.
+        cf->glyphs[index] = cf->ops->render(c, w, h, cf->color);
+        if (cf->glyphs[index] == 0U) return 0U;
+        cf->misses++;
+        cf->glyph_bytes += (uint32_t)w * (uint32_t)h * CLOCK_FACE_BYTES_PER_PIXEL;
+    }
+    return cf->glyphs[index];
+}
+
+static uint32_t Rect_Area(const GuiRect_t *r)
+{
+    return (uint32_t)(r->x1 - r->x0 + 1) * (uint32_t)(r->y1 - r->y0 + 1);
+}
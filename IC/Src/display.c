@@ -103,6 +103,22 @@
 #include "gate.h"
 #include "scene.h"
 #include "translations.h"
+#include "firmware_update_agent.h"
+#include "gui_dirty.h"
+#include "icon_cache.h"
+#include "gui_static.h"
+#include "gui_tree.h"
+#include "settings_model.h"
+#include "screen_mgr.h"
+#include "frame_pacer.h"
+#include "gui_prof.h"
+#include "mem_budget.h"
+#include "remote_view.h"
+#include "clock_face.h"
+#include "text_layout.h"
+#include "lang_pack.h"
+#include "LCDConf.h"
+#include "qr_cache.h"
 
 /*============================================================================*/
 /* PRIVATNE DEFINICIJE I MAKROI (INTERNI)                                     */
@@ -111,13 +127,17 @@
 /** @name Vremenske konstante za GUI
  * @{
  */
-#define GUI_REFRESH_TIME                50U     ///< Svrha: Period osvježavanja GUI-ja. Vrijednost: 100 milisekundi (10 puta u sekundi).
+#define GUI_FRAME_BUDGET_US             16600U  ///< Svrha: Budžet jednog `GUI_Exec()` = period vsync-a LTDC-a (9.5 MHz / 531x297 = 60 Hz).
+#define GUI_FRAME_MAX_DEFER             3U      ///< Svrha: Najviše vsync-ova odgađanja iscrtavanja bez dodira dok RS485 ima komandi u redu (~50 ms).
+#define GUI_FRAME_REPORT_SIZE           256U    ///< Svrha: Veličina bafera za izvještaj o tempiranju iscrtavanja.
+#define GUI_PROF_BUDGET_PERMILLE        10U     ///< Svrha: Najveća cijena mjerenja iscrtavanja (gui_prof.h). Vrijednost: 1% vremena procesora.
+#define GUI_PROF_REPORT_SIZE            1024U   ///< Svrha: Veličina bafera za izvještaj o mjerenju iscrtavanja.
+#define DIAG_REFRESH_TIME               1000U   ///< Svrha: Period osvježavanja skrivenog ekrana mjerenja (SCREEN_DIAGNOSTICS). Vrijednost: 1000 milisekundi.
 #define DATE_TIME_REFRESH_TIME          1000U   ///< Svrha: Period osvježavanja prikaza datuma i vremena. Vrijednost: 1000 milisekundi (svake sekunde).
 #define SETTINGS_MENU_ENABLE_TIME       3456U   ///< Svrha: Vrijeme držanja pritiska za ulazak u meni. Vrijednost: 3456 milisekundi (~3.5 sekunde).
 #define SETTINGS_MENU_TIMEOUT           59000U  ///< Svrha: Timeout za automatski izlazak iz menija. Vrijednost: 59000 milisekundi (59 sekundi).
 #define EVENT_ONOFF_TOUT                500     ///< Svrha: Maksimalno vrijeme za "kratak dodir". Vrijednost: 500 milisekundi.
 #define VALUE_STEP_TOUT                 15      ///< Svrha: Brzina promjene vrijednosti kod držanja dugmeta (npr. dimovanje). Vrijednost: 15 milisekundi.
-#define GHOST_WIDGET_SCAN_INTERVAL      2000    ///< Svrha: Period za skeniranje i brisanje "duhova" (zaostalih widgeta). Vrijednost: 2000 milisekundi.
 #define FW_UPDATE_BUS_TIMEOUT           15000U  ///< Svrha: Vrijeme (u ms) nakon kojeg smatramo da je FW update na busu završen ako nema novih paketa.
 #define LONG_PRESS_DURATION             1000    ///< Prag za dugi pritisak u ms (1 sekunda)
 /** @} */
@@ -129,10 +149,87 @@
 #define DISP_BRGHT_MIN                  5       ///< Svrha: Minimalna dozvoljena vrijednost za svjetlinu ekrana. Vrijednost: 5 (na skali 1-90).
 #define QR_CODE_COUNT                   2       ///< Svrha: Ukupan broj QR kodova koje sistem podržava. Vrijednost: 2 (jedan za WiFi, jedan za App).
 #define QR_CODE_LENGTH                  50      ///< Svrha: Maksimalna dužina stringa za QR kod. Vrijednost: 50 karaktera.
+#define QR_CODE_PIXEL_SIZE              8       ///< Svrha: Veličina jednog modula QR koda na ekranu. Vrijednost: 8x8 piksela.
 #define DRAWING_AREA_WIDTH              380     ///< Svrha: Širina glavnog područja za crtanje. Vrijednost: 380 piksela (cijeli ekran je 480px).
 #define COLOR_BSIZE                     28      ///< Svrha: Veličina `clk_clrs` niza. Vrijednost: 28, mora odgovarati broju boja u nizu.
 /** @} */
 
+/** @name Keš ikonica u SDRAM-u
+ * @{
+ */
+#define ICON_CACHE_POOL_SIZE            0x00200000U ///< Svrha: Veličina bazena u sekciji `.icon_cache` (SDRAM 0xC0400000, iza frame bafera). Vrijednost: 2 MB.
+#define ICON_CACHE_BUDGET               ICON_CACHE_POOL_SIZE ///< Svrha: Koliko bazena keš smije zauzeti. Vrijednost: cijeli bazen.
+#define ICON_CACHE_SRC_START            0x90000000U ///< Svrha: Početak QSPI regije (`.flash_rom`). Keširaju se samo bitmape iz nje.
+#define ICON_CACHE_SRC_END              0x90E00000U ///< Svrha: Kraj QSPI regije (LR_QSPI1 u scatter fajlu).
+#define ICON_CACHE_PRELOAD              1       ///< Svrha: Kopiranje ikonica ekrana u keš pri ulasku na ekran i unaprijed, iz manifesta ekrana. Vrijednost: 1 (uključeno).
+/** @} */
+
+/** @name Keš glifova Verdana fontova (LCDConf.c)
+ * @{
+ */
+#define GLYPH_PRELOAD_CHARS             "0123456789:.,-%° " ///< Svrha: Znakovi koji trajno ostaju u kešu glifova (datum, temperatura, tajmeri).
+/** @} */
+
+/** @name Statički sloj ekrana u memorijskom uređaju
+ * @{
+ */
+#define LIGHTS_DRAW_LABELS              0x01U   ///< Svrha: `DrawLightsScreen` crta labele svjetala (statički dio).
+#define LIGHTS_DRAW_ICONS               0x02U   ///< Svrha: `DrawLightsScreen` crta ikonice svjetala (dinamički dio).
+#define STATIC_LAYER_REPORT_SIZE        512U    ///< Svrha: Veličina bafera za izvještaj o vremenima iscrtavanja.
+/** @} */
+
+/** @name Stabla widgeta po ekranu
+ * @{
+ */
+#define WIDGET_TREE_REPORT_SIZE         2048U   ///< Svrha: Veličina bafera za izvještaj o stablima widgeta i prelazima između ekrana.
+/** @} */
+
+/** @name Registar ekrana
+ * @{
+ */
+#define SCREEN_PREFETCH_IDLE_US         300000U ///< Svrha: Koliko ekran mora biti miran prije učitavanja resursa sljedećih ekrana. Vrijednost: 300 ms (izvan animacije prelaza i prvog dodira).
+#define SCREEN_REPORT_SIZE              2048U   ///< Svrha: Veličina bafera za izvještaj o prelazima po paru ekrana.
+/** @} */
+
+/** @name Budžet GUI hipa i SDRAM-a (mem_budget.h)
+ * @{
+ */
+#define SCREEN_HEAP_KB                  64U     ///< Svrha: Budžet rasta GUI hipa na ekranu (widgeti, tekstovi). Vrijednost: 64 KB.
+#define SCREEN_HEAP_STATIC_KB           (SCREEN_HEAP_KB + 544U) ///< Svrha: Budžet ekrana sa statičkim slojem (jedan ARGB8888 memorijski uređaj 480x272 sa zaglavljem).
+#define GUI_HEAP_WARN_FREE              (768U * 1024U) ///< Svrha: Upozorenje kad u GUI hipu ostane manje slobodnih bajta.
+#define GUI_HEAP_WARN_BLOCK             (544U * 1024U) ///< Svrha: Upozorenje kad nema bloka za memorijski uređaj statičkog sloja.
+#define GUI_HEAP_CRITICAL_BLOCK         (64U * 1024U)  ///< Svrha: Rezerva hipa za widgete; veće alokacije se odbijaju ako bi je potrošile.
+#define GUI_MEM_REPORT_SIZE             2048U   ///< Svrha: Veličina bafera za izvještaj o hipu, SDRAM-u i budžetima ekrana.
+/** @} */
+
+/** @name Daljinski pregled ekrana (remote_view.h)
+ * @{
+ */
+#define REMOTE_VIEW_INTERVAL_MS         250U    ///< Svrha: Najkraći razmak frejmova pregleda. Vrijednost: 4 frejma/s.
+#define REMOTE_VIEW_RATE                2048U   ///< Svrha: Najviše bajta toka u sekundi; oko 18% RS485 busa na 115200 bauda.
+#define REMOTE_VIEW_TILES_PER_PASS      32U     ///< Svrha: Pločica po prolazu `DISP_Service()`; frejm 480x272 (510 pločica) se obiđe za 16 prolaza.
+#define REMOTE_VIEW_REPORT_SIZE         256U    ///< Svrha: Veličina bafera za izvještaj pregleda.
+#define REMOTE_VIEW_CONSENT             0x5AU   ///< Svrha: Vrijednost u `EE_REMOTE_VIEW` kad je pregled dozvoljen; prazan EEPROM (0xFF) znači nije.
+/** @} */
+
+/** @name Sat na screensaver-u (clock_face.h)
+ * @{
+ */
+#define SCRNSVR_CLK_PATTERN             "00:00" ///< Svrha: Uzorak vremena; svaka cifra dobije ćeliju širine najšire cifre fonta.
+#define SCRNSVR_CLK_BLINK               1       ///< Svrha: Dvotačka trepće svake sekunde (1) ili stoji (0); bez treptanja se između promjena minute ne crta ništa.
+#define CLOCK_REPORT_SIZE               256U    ///< Svrha: Veličina bafera za izvještaj sata.
+/** @} */
+
+/** @name Keš širina i rasporeda labela
+ * @{
+ */
+#define LABEL_FONT_VERDANA20            0U      ///< Svrha: Indeks fonta Verdana20 u `label_fonts` (ključ keša `text_layout`).
+#define LABEL_FONT_VERDANA16            1U      ///< Svrha: Indeks fonta Verdana16 u `label_fonts`.
+#define LABEL_KIND_LIGHT                0U      ///< Svrha: Vrsta uređaja u `TEXT_LAYOUT_LABEL_KEY` za korisničke labele svjetala.
+#define LABEL_KIND_GATE                 1U      ///< Svrha: Vrsta uređaja u `TEXT_LAYOUT_LABEL_KEY` za korisničke labele kapija.
+#define LABEL_GRID_MAX_TEXTS            (2U * LIGHTS_MODBUS_SIZE) ///< Svrha: Najviše labela u mreži ikonica (dvije po svjetlu ili kapiji).
+/** @} */
+
 /** @name Definicije za ikonice svjetala
  * @note Premješteno iz lights.h, privatno za display modul.
  * @{
@@ -1005,6 +1102,99 @@ settings_screen_3_layout =
     .line_select_control        = { 162, 200, 375 }
 };
 
+/**
+ * @brief Ključevi postavki koje ekrani podešavanja 1-3 mijenjaju preko `settings_model`.
+ * @note `Settings_Read()` i `Settings_Write()` za svaki ključ pozivaju getter i
+ * setter odgovarajućeg modula.
+ */
+typedef enum
+{
+    SETTING_THST_CONTROL = 0,
+    SETTING_THST_SP_MAX,
+    SETTING_THST_SP_MIN,
+    SETTING_FAN_CONTROL,
+    SETTING_FAN_DIFF,
+    SETTING_FAN_LOW_BAND,
+    SETTING_FAN_HI_BAND,
+    SETTING_THST_GROUP,
+    SETTING_THST_MASTER,
+    SETTING_HIGH_BRIGHTNESS,
+    SETTING_LOW_BRIGHTNESS,
+    SETTING_SCRNSVR_TIMEOUT,
+    SETTING_SCRNSVR_ENA_HOUR,
+    SETTING_SCRNSVR_DIS_HOUR,
+    SETTING_SCRNSVR_CLK_COLOUR,
+    SETTING_SCRNSVR_CLOCK,
+    SETTING_HOUR,
+    SETTING_MINUTE,
+    SETTING_DAY,
+    SETTING_MONTH,
+    SETTING_YEAR,
+    SETTING_WEEKDAY,
+    SETTING_DEFROSTER_CYCLE_TIME,
+    SETTING_DEFROSTER_ACTIVE_TIME,
+    SETTING_DEFROSTER_PIN,
+    SETTING_VENTILATOR_RELAY,
+    SETTING_VENTILATOR_DELAY_ON,
+    SETTING_VENTILATOR_DELAY_OFF,
+    SETTING_VENTILATOR_TRIGGER1,
+    SETTING_VENTILATOR_TRIGGER2,
+    SETTING_VENTILATOR_LOCAL_PIN
+} SettingKey_t;
+
+/**
+ * @brief Polja prvog ekrana podešavanja (termostat i ventilator termostata).
+ * @note Opsezi odgovaraju opsezima widgeta u `DSP_InitSet1Scrn`.
+ */
+static const SettingsField_t settings_screen_1_fields[] =
+{
+    { ID_ThstControl,   SETTING_THST_CONTROL,   SETTINGS_WIDGET_RADIO,    0,           2           },
+    { ID_MaxSetpoint,   SETTING_THST_SP_MAX,    SETTINGS_WIDGET_SPINBOX,  THST_SP_MIN, THST_SP_MAX },
+    { ID_MinSetpoint,   SETTING_THST_SP_MIN,    SETTINGS_WIDGET_SPINBOX,  THST_SP_MIN, THST_SP_MAX },
+    { ID_FanControl,    SETTING_FAN_CONTROL,    SETTINGS_WIDGET_RADIO,    0,           1           },
+    { ID_FanDiff,       SETTING_FAN_DIFF,       SETTINGS_WIDGET_SPINBOX,  0,           10          },
+    { ID_FanLowBand,    SETTING_FAN_LOW_BAND,   SETTINGS_WIDGET_SPINBOX,  0,           50          },
+    { ID_FanHiBand,     SETTING_FAN_HI_BAND,    SETTINGS_WIDGET_SPINBOX,  0,           100         },
+    { ID_THST_GROUP,    SETTING_THST_GROUP,     SETTINGS_WIDGET_SPINBOX,  0,           254         },
+    { ID_THST_MASTER,   SETTING_THST_MASTER,    SETTINGS_WIDGET_CHECKBOX, 0,           1           }
+};
+
+/**
+ * @brief Polja drugog ekrana podešavanja (vrijeme, datum, screensaver, svjetlina).
+ */
+static const SettingsField_t settings_screen_2_fields[] =
+{
+    { ID_DisplayHighBrightness, SETTING_HIGH_BRIGHTNESS,    SETTINGS_WIDGET_SPINBOX,  1,    90          },
+    { ID_DisplayLowBrightness,  SETTING_LOW_BRIGHTNESS,     SETTINGS_WIDGET_SPINBOX,  1,    90          },
+    { ID_ScrnsvrTimeout,        SETTING_SCRNSVR_TIMEOUT,    SETTINGS_WIDGET_SPINBOX,  1,    240         },
+    { ID_ScrnsvrEnableHour,     SETTING_SCRNSVR_ENA_HOUR,   SETTINGS_WIDGET_SPINBOX,  0,    23          },
+    { ID_ScrnsvrDisableHour,    SETTING_SCRNSVR_DIS_HOUR,   SETTINGS_WIDGET_SPINBOX,  0,    23          },
+    { ID_ScrnsvrClkColour,      SETTING_SCRNSVR_CLK_COLOUR, SETTINGS_WIDGET_SPINBOX,  1,    COLOR_BSIZE },
+    { ID_ScrnsvrClock,          SETTING_SCRNSVR_CLOCK,      SETTINGS_WIDGET_CHECKBOX, 0,    1           },
+    { ID_Hour,                  SETTING_HOUR,               SETTINGS_WIDGET_SPINBOX,  0,    23          },
+    { ID_Minute,                SETTING_MINUTE,             SETTINGS_WIDGET_SPINBOX,  0,    59          },
+    { ID_Day,                   SETTING_DAY,                SETTINGS_WIDGET_SPINBOX,  1,    31          },
+    { ID_Month,                 SETTING_MONTH,              SETTINGS_WIDGET_SPINBOX,  1,    12          },
+    { ID_Year,                  SETTING_YEAR,               SETTINGS_WIDGET_SPINBOX,  2000, 2099        },
+    { ID_WeekDay,               SETTING_WEEKDAY,            SETTINGS_WIDGET_DROPDOWN, 0,    6           }
+};
+
+/**
+ * @brief Polja trećeg ekrana podešavanja (odmrzivač i ventilator).
+ */
+static const SettingsField_t settings_screen_3_fields[] =
+{
+    { ID_DEFROSTER_CYCLE_TIME,      SETTING_DEFROSTER_CYCLE_TIME,   SETTINGS_WIDGET_SPINBOX, 0, 254 },
+    { ID_DEFROSTER_ACTIVE_TIME,     SETTING_DEFROSTER_ACTIVE_TIME,  SETTINGS_WIDGET_SPINBOX, 0, 254 },
+    { ID_DEFROSTER_PIN,             SETTING_DEFROSTER_PIN,          SETTINGS_WIDGET_SPINBOX, 0, 6   },
+    { ID_VentilatorRelay,           SETTING_VENTILATOR_RELAY,       SETTINGS_WIDGET_SPINBOX, 0, 512 },
+    { ID_VentilatorDelayOn,         SETTING_VENTILATOR_DELAY_ON,    SETTINGS_WIDGET_SPINBOX, 0, 255 },
+    { ID_VentilatorDelayOff,        SETTING_VENTILATOR_DELAY_OFF,   SETTINGS_WIDGET_SPINBOX, 0, 255 },
+    { ID_VentilatorTriggerSource1,  SETTING_VENTILATOR_TRIGGER1,    SETTINGS_WIDGET_SPINBOX, 0, 6   },
+    { ID_VentilatorTriggerSource2,  SETTING_VENTILATOR_TRIGGER2,    SETTINGS_WIDGET_SPINBOX, 0, 6   },
+    { ID_VentilatorLocalPin,        SETTING_VENTILATOR_LOCAL_PIN,   SETTINGS_WIDGET_SPINBOX, 0, 32  }
+};
+
 /**
  * @brief Struktura koja sadrži konstante za ISCRTAVANJE elemenata
  * na četvrtom ekranu za podešavanja (Roletne).
@@ -1423,22 +1613,6 @@ security_screen_layout =
     .y_spacing      = 60,
     .label_x_offset = 10
 };
-// =======================================================================
-// ===        Automatsko generisanje `const` niza za "Skener"          ===
-// =======================================================================
-// ULOGA: Ovaj blok koda koristi X-Macro tehniku da bi automatski
-// popunio `settings_static_widget_ids` niz sa ID-jevima iz `settings_widgets.def`.
-//
-static const uint16_t settings_static_widget_ids[] = 
-{
-    // 1. Privremeno redefinišemo makro WIDGET da vraća samo prvi argument (ID)
-#define WIDGET(id, val, comment) id,
-    // 2. Uključujemo našu glavnu listu
-#include "settings_widgets.def"
-    // 3. Odmah poništavamo našu privremenu definiciju da ne bi smetala ostatku koda
-#undef WIDGET
-};
-
 /**
  * @brief Niz sa pokazivačima na bitmape za ikonice svjetala.
  * @note  IZMIJENJENO: Redoslijed u ovom nizu sada MORA TAČNO ODGOVARATI
@@ -1651,6 +1825,7 @@ static BUTTON_Handle   hButtonRenameLight;                      /**< @brief Hand
 static CHECKBOX_Handle hCHKBX_ONLY_LEAVE_SCRNSVR_AFTER_TOUCH; /**< @brief Handle za CHECKBOX za promjenu ponašanja screensavera pri dodiru. */
 static CHECKBOX_Handle hCHKBX_LIGHT_NIGHT_TIMER;    /**< @brief Handle za CHECKBOX za omogućavanje noćnog tajmera za svjetla. */
 static CHECKBOX_Handle hCHKBX_EnableSecurity;       /**< @brief NOVO: Handle za CHECKBOX za omogućavanje security modula. */
+static CHECKBOX_Handle hCHKBX_RemoteView;           /**< @brief Handle za CHECKBOX za dozvolu daljinskog pregleda ekrana. */
 static DROPDOWN_Handle hSelectControl_1;            /**< @brief Handle za DROPDOWN za dinamičku ikonu na SelectScreen1. */
 static DROPDOWN_Handle hSelectControl_2;            /**< @brief Handle za DROPDOWN za dinamičku ikonu na SelectScreen2. */
 /** @} */
@@ -1761,6 +1936,120 @@ static uint8_t thermostatMenuState = 0;
  * ovaj fleg i, ako je postavljen, pokreće ponovno iscrtavanje dinamičke ikonice.
  */
 static bool dynamicIconUpdateFlag = false;
+/**
+ * @brief Lista "prljavih" pravougaonika aktivnog ekrana.
+ * @note Moduli je pune preko `DISP_InvalidateRect()`, `DISP_InvalidateLight()` i
+ * `DISP_InvalidateGate()`, a ekrani koji podržavaju djelimično iscrtavanje
+ * (`Service_LightsScreen` i `Service_GateScreen`) ponovo crtaju samo uniju
+ * označenih pravougaonika. Ostali ekrani se i dalje crtaju cijeli. `shouldDrawScreen = 1` i dalje znači cijeli ekran.
+ */
+static GuiDirty_t gui_dirty;
+/**
+ * @brief Keš ARGB8888 ikonica iz QSPI fleša u SDRAM-u.
+ * @note Sve ikonice se crtaju preko `DrawIcon()`, koja bitmapu iz QSPI-ja zamijeni
+ * kopijom iz keša. `icon_cache_bmp` je privremena kopija `GUI_BITMAP` strukture
+ * sa pokazivačem na podatke u kešu; dovoljna je jedna jer je `GUI_DrawBitmap` sinhron.
+ */
+static IconCache_t icon_cache;
+static GUI_BITMAP icon_cache_bmp;
+static uint8_t icon_cache_pool[ICON_CACHE_POOL_SIZE] __attribute__((section(".icon_cache"), aligned(ICON_CACHE_ALIGN)));
+/**
+ * @brief Statički slojevi ekrana (pozadina, labele, hamburger meni) u memorijskim uređajima.
+ * @note Ekran preko `StaticLayer_Draw()` kopira svoj statički sloj na ekran i
+ * crta samo dinamičke elemente. `static_layer_report` čuva zadnji izvještaj
+ * o vremenima (`DISP_GetStaticLayerReport()`), da bi bio vidljiv i u debageru.
+ */
+static GuiStaticCache_t static_layers;
+static char static_layer_report[STATIC_LAYER_REPORT_SIZE];
+/**
+ * @brief Stabla widgeta: svaki ekran drži svoje widgete pod korijenskim prozorom.
+ * @note `WidgetTree_Sync()` premješta nove widgete pod korijen aktivnog ekrana i
+ * pri izlasku sa ekrana briše korijen sa svim zaostalim widgetima, pa periodično
+ * brisanje "duhova" više nije potrebno. Numpad i tastatura su trajni ekrani.
+ */
+static GuiTree_t widget_trees;
+static char widget_tree_report[WIDGET_TREE_REPORT_SIZE];
+/**
+ * @brief Model postavki ekrana podešavanja koji je trenutno prikazan.
+ * @note Notifikacije widgeta stižu u `WidgetTree_RootCallback` i preko
+ * `Settings_OnNotify()` upisuju vrijednost u modul; `Service_SettingsScreen_*`
+ * ne čita widgete u petlji.
+ */
+static SettingsModel_t settings_model;
+/**
+ * @brief Registar ekrana: servis, manifest resursa i prelazi po paru ekrana.
+ * @note Tabela `screen_registry` zamjenjuje `switch (screen)` u `DISP_Service()`.
+ * `screen_report` čuva zadnji izvještaj (`DISP_GetScreenReport()`).
+ */
+static ScreenMgr_t screen_mgr;
+static char screen_report[SCREEN_REPORT_SIZE];
+/**
+ * @brief Tempiranje `GUI_Exec()` po vsync-u LTDC-a.
+ * @note `gui_input` postavlja `DISP_NotifyInput()` (dodir prijavljen emWin-u),
+ * a briše ga `FramePacer_Poll()` preko `Pacer_Input()`.
+ */
+static FramePacer_t frame_pacer;
+static volatile bool gui_input;
+static char frame_report[GUI_FRAME_REPORT_SIZE];
+/**
+ * @brief Mjerenje trajanja servisa ekrana, `GUI_Exec()`, zauzeća DMA2D-a i
+ * kašnjenja od dodira do prikaza (gui_prof.h).
+ * @note `diag_armed` je `true` kad je, nakon ulaska na `SCREEN_DIAGNOSTICS`,
+ * otpušten dodir kojim se ušlo; sljedeći dodir vraća na glavni ekran.
+ */
+static GuiProf_t gui_prof;
+static char gui_prof_report[GUI_PROF_REPORT_SIZE];
+static bool diag_armed;
+/**
+ * @brief Praćenje GUI hipa, budžeta ekrana i mape SDRAM-a (mem_budget.h).
+ * @note `mem_regions` se puni u `DISP_Init()`, jer su adrese keševa poznate
+ * tek pri povezivanju. Kad hipa ponestane, `Mem_Pressure()` briše
+ * memorijske uređaje statičkih slojeva.
+ */
+static MemBudget_t mem_budget;
+static MemRegion_t mem_regions[4];
+static char mem_report[GUI_MEM_REPORT_SIZE];
+/**
+ * @brief Daljinski pregled ekrana za podršku (remote_view.h).
+ * @note Tok čita RS485 (`REMOTE_VIEW` u rs485.c) iz prekida, a pločice se
+ * obilaze u `DISP_Service()` samo dok je pregled uključen.
+ */
+static RemoteView_t remote_view;
+static char remote_view_report[REMOTE_VIEW_REPORT_SIZE];
+/**
+ * @brief Dozvola daljinskog pregleda, uključuje se samo na panelu (ekran
+ * podešavanja alarma) i čuva u `EE_REMOTE_VIEW`; bez nje RS485 ne može
+ * pokrenuti pregled.
+ */
+static bool remote_view_allowed;
+/**
+ * @brief Sat na screensaver-u koji crta samo promijenjene cifre (clock_face.h).
+ * @note Keš znakova (memorijski uređaji u GUI hipu) se briše kad se izađe
+ * iz screensaver-a i kad `Mem_Pressure()` javi nedostatak memorije.
+ */
+static ClockFace_t clock_face;
+static char clock_report[CLOCK_REPORT_SIZE];
+/**
+ * @brief Puštanje klipova animacije (anim_codec.h) u `DISP_Animation()`.
+ * @note `anim_multibuf` je `true` dok je otvoren `GUI_MULTIBUF_Begin()`
+ * frejma koji se crta.
+ */
+static AnimPlayer_t anim_player;
+static bool anim_multibuf;
+/**
+ * @brief Keš tekstova, širina i odabranog fonta labela u mrežama ikonica.
+ * @note Indeks fonta u kešu je indeks u `label_fonts`.
+ */
+static TextLayoutCache_t text_layout;
+static const GUI_FONT* const label_fonts[] = { &GUI_FontVerdana20_LAT, &GUI_FontVerdana16_LAT };
+/**
+ * @brief Stringovi aktivnog jezika, neprekidno u internom RAM-u (vidi `lang_pack.h`).
+ * @note `lng()` ponovo pakuje kad primijeti da se `g_display_settings.language`
+ * promijenio; ako pakovanje ne uspije, čita se direktno iz `language_strings`.
+ */
+static LangPack_t lang_pack;
+static char lang_pack_pool[LANG_PACK_POOL_SIZE];
+static uint16_t lang_pack_index[TEXT_COUNT];
 /**
  * @brief Služi kao tajmer (čuvar `HAL_GetTick()` vrijednosti) za periodične akcije koje se dešavaju svake sekunde.
  * @note Koristi se u `Handle_PeriodicEvents` i `Service_ThermostatScreen` funkcijama za provjeru da li je
@@ -1913,6 +2202,16 @@ static uint8_t qr_codes[QR_CODE_COUNT][QR_CODE_LENGTH] = {0};
  * @note Vrijednost `1` je za WiFi, `2` za Aplikaciju. Postavlja se u `HandlePress_SelectScreenLast`.
  */
 static uint8_t qr_code_draw_id = 0;
+/**
+ * @brief Matrice modula sačuvanih QR kodova (vidi `qr_cache.h`).
+ * @note Prave se pri startu i u `Handle_PeriodicEvents` nakon promjene koda,
+ * a `Service_QrCodeScreen` ih samo iscrtava, bez kodiranja i alokacije na
+ * GUI hipu.
+ */
+static QrCache_t qr_cache;
+#if (QR_CODE_LENGTH > QR_CACHE_TEXT_MAX) || (QR_CODE_COUNT > QR_CACHE_SLOTS)
+#error QR kodovi ne staju u qr_cache!
+#endif
 /**
  * @brief Brojač za odbrojavanje na ekranu za čišćenje (`SCREEN_CLEAN`).
  * @note Inicijalizuje se na 60 i dekrementira svake sekunde u `Service_CleanScreen` funkciji.
@@ -2230,6 +2529,76 @@ static void Service_SettingsScreen_7(void);
 static void Service_SettingsScreen_8(void);
 static void Service_SettingsScreen_9(void);
 static void Service_LightsScreen(void);
+static void DrawLightsScreen(const GUI_RECT* area, uint8_t parts);
+static void LightsScreen_DrawStatic(void);
+static void ThermostatScreen_DrawStatic(void);
+static void StaticLayer_Draw(eScreen scr, void (*draw)(void), const GUI_RECT* area);
+static uint32_t StaticLayer_Create(uint8_t layer);
+static void StaticLayer_Destroy(uint32_t handle);
+static uint32_t StaticLayer_Now(void);
+static uint32_t StaticLayer_Us(uint32_t start);
+static void WidgetTree_Sync(void);
+static uint32_t Pacer_Vsync(void);
+static uint32_t Pacer_Ms(void);
+static bool Pacer_BufferPending(void);
+static bool Pacer_Input(void);
+static bool Pacer_Invalid(void);
+static bool Pacer_Busy(void);
+static uint32_t Prof_DmaBusy(void);
+static uint32_t Prof_Flips(void);
+static uint32_t Prof_FlipTime(void);
+static uint32_t Mem_FreeBytes(void);
+static uint32_t Mem_LargestFree(void);
+static uint32_t Mem_UsedBlocks(void);
+static uint32_t Mem_IconCacheUsed(void);
+static void Mem_Pressure(MemLevel_t level);
+static const uint16_t* View_Base(void);
+static const uint32_t* View_Overlay(void);
+static bool View_Private(void);
+static int16_t Clock_CharWidth(char c);
+static uint32_t Clock_Render(char c, int16_t width, int16_t height, uint32_t color);
+static void Clock_Release(uint32_t glyph);
+static void Clock_Begin(void);
+static void Clock_Blit(uint32_t glyph, int16_t x, int16_t y);
+static void Clock_Draw(char c, const GuiRect_t *cell, uint32_t color);
+static int16_t Clock_TextWidth(const char *text);
+static void Clock_DrawDate(const char *text, const GuiRect_t *clear, uint32_t color);
+static void Clock_End(void);
+static uint32_t WidgetTree_CreateRoot(uint8_t layer);
+static uint16_t WidgetTree_Destroy(uint32_t root);
+static void WidgetTree_Show(uint32_t root, bool visible);
+static uint16_t WidgetTree_Adopt(uint8_t layer, uint32_t root);
+static uint32_t WidgetTree_HeapUsed(void);
+static void WidgetTree_RootCallback(WM_MESSAGE* pMsg);
+static WM_HWIN Widget_Find(int id);
+static int32_t Settings_Read(uint8_t key);
+static void Settings_Write(uint8_t key, int32_t value);
+static void Settings_OnNotify(WM_HWIN hWin, int code);
+static const char* Labels_GetText(uint16_t key, uint8_t language);
+static int16_t Labels_Measure(uint8_t font, const char* text, uint16_t len);
+static const char* Labels_Text(uint16_t key, uint8_t font);
+static uint8_t LightsScreen_ChooseFont(void);
+static uint8_t GateScreen_ChooseFont(uint8_t gate_count);
+static uint8_t LightsScreen_GetLightsInRow(uint8_t row);
+static bool LightsScreen_GetTileRect(uint8_t index, GUI_RECT* rect);
+static uint8_t GateScreen_GetGatesInRow(uint8_t gate_count, uint8_t row);
+static bool GateScreen_GetTileRect(uint8_t index, GUI_RECT* rect);
+static void DrawGateScreen(const GUI_RECT* area);
+static void DrawIcon(const GUI_BITMAP* bitmap, int x, int y);
+static void Anim_Play(const AnimClip_t* clip, int x, int y, uint16_t repeats);
+static void Anim_DrawPatch(const IconImage_t* image, int16_t x, int16_t y, uint8_t alpha);
+static void Anim_EndFrame(void);
+static bool Icon_IsCacheable(const GUI_BITMAP* bitmap);
+static void Icon_Preload(const GUI_BITMAP* bitmap);
+static bool Screen_PrefetchSelect1(void);
+static bool Screen_PrefetchSelect2(void);
+static bool Screen_PrefetchLights(void);
+static bool Screen_PrefetchGate(void);
+static bool Screen_PrefetchScene(void);
+static void Screen_LeaveSettings(void);
+static void Icon_CopyToSdram(void* dst, const void* src, uint32_t size);
+static bool QR_Encode(const char* text, uint8_t* bits, uint16_t max_size, uint16_t* size);
+static uint8_t QR_Slot(uint8_t qrCodeID);
 static void Service_GateScreen(void);
 static void Service_TimerScreen(void);
 static void Service_SecurityScreen(void);
@@ -2248,6 +2617,7 @@ static void Service_SettingsTimerScreen(void);
 static void Service_AlarmActiveScreen(void);
 static void Service_GateSettingsScreen(void);
 static void Service_SettingsAlarmScreen(void);
+static void Service_DiagnosticsScreen(void);
 
 /** @} */
 
@@ -2354,11 +2724,6 @@ static uint8_t DISPMenuSettings(uint8_t btn);
  * @retval uint8_t 1 ako je ažuriranje aktivno, inače 0.
  */
 static uint8_t Service_HandleFirmwareUpdate(void);
-/**
- * @brief Forsirano uništava sve widgete sa ekrana za podešavanja.
- * @note Koristi se kao "fail-safe" mehanizam za čišćenje "duhova" sa ekrana.
- */
-static void ForceKillAllSettingsWidgets(void);
 /**
  * @brief Mapa koja povezuje indeks u DROPDOWN listi sa stvarnom ControlMode vrijednošću za Ikonu 1.
  */
@@ -2371,6 +2736,51 @@ static int8_t control_mode_map_2[MODE_COUNT];
 static bool IsBusFwUpdateActive(void);
 /** @} */
 
+/**
+ * @brief Registar ekrana za `DISP_Service()`.
+ * @note Po ekranu: servis, manifest resursa (ikonice u keš, font labela),
+ * izlazak i ekrani na koje se sa njega obično prelazi. Ekrani kojih nema u
+ * tabeli rade isto što je radila `default` grana `switch`-a.
+ */
+static const ScreenDesc_t screen_registry[] =
+{
+    { SCREEN_MAIN,              Service_MainScreen,             NULL,                   NULL,   SCREEN_MGR_BIT(SCREEN_SELECT_1), SCREEN_HEAP_KB },
+    { SCREEN_SELECT_1,          Service_SelectScreen1,          Screen_PrefetchSelect1, NULL,   SCREEN_MGR_BIT(SCREEN_LIGHTS) | SCREEN_MGR_BIT(SCREEN_SELECT_2), SCREEN_HEAP_KB },
+    { SCREEN_SELECT_2,          Service_SelectScreen2,          Screen_PrefetchSelect2, NULL,   SCREEN_MGR_BIT(SCREEN_GATE), SCREEN_HEAP_KB },
+    { SCREEN_SELECT_LAST,       Service_SelectScreenLast,       NULL,                   NULL,   SCREEN_MGR_BIT(SCREEN_SELECT_1), SCREEN_HEAP_KB },
+    { SCREEN_SCENE,             Service_SceneScreen,            Screen_PrefetchScene,   NULL,   0U, SCREEN_HEAP_KB },
+    { SCREEN_SCENE_EDIT,        Service_SceneEditScreen,        NULL,                   NULL,   SCREEN_MGR_BIT(SCREEN_SCENE), SCREEN_HEAP_KB },
+    { SCREEN_SCENE_APPEARANCE,  Service_SceneAppearanceScreen,  NULL,                   NULL,   SCREEN_MGR_BIT(SCREEN_SCENE), SCREEN_HEAP_KB },
+    { SCREEN_SCENE_WIZ_DEVICES, Service_SceneWizDevicesScreen,  NULL,                   NULL,   SCREEN_MGR_BIT(SCREEN_SCENE), SCREEN_HEAP_KB },
+    { SCREEN_THERMOSTAT,        Service_ThermostatScreen,       NULL,                   NULL,   SCREEN_MGR_BIT(SCREEN_SELECT_1), SCREEN_HEAP_STATIC_KB },
+    { SCREEN_ALARM_ACTIVE,      Service_AlarmActiveScreen,      NULL,                   NULL,   0U, SCREEN_HEAP_KB },
+    { SCREEN_RETURN_TO_FIRST,   Service_ReturnToFirst,          NULL,                   NULL,   0U, SCREEN_HEAP_KB },
+    { SCREEN_SETTINGS_1,        Service_SettingsScreen_1,       NULL,   Screen_LeaveSettings,   0U, SCREEN_HEAP_KB },
+    { SCREEN_SETTINGS_2,        Service_SettingsScreen_2,       NULL,   Screen_LeaveSettings,   0U, SCREEN_HEAP_KB },
+    { SCREEN_SETTINGS_3,        Service_SettingsScreen_3,       NULL,   Screen_LeaveSettings,   0U, SCREEN_HEAP_KB },
+    { SCREEN_SETTINGS_4,        Service_SettingsScreen_4,       NULL,                   NULL,   0U, SCREEN_HEAP_KB },
+    { SCREEN_SETTINGS_5,        Service_SettingsScreen_5,       NULL,                   NULL,   0U, SCREEN_HEAP_KB },
+    { SCREEN_SETTINGS_6,        Service_SettingsScreen_6,       NULL,                   NULL,   0U, SCREEN_HEAP_KB },
+    { SCREEN_SETTINGS_7,        Service_SettingsScreen_7,       NULL,                   NULL,   0U, SCREEN_HEAP_KB },
+    { SCREEN_SETTINGS_8,        Service_SettingsScreen_8,       NULL,                   NULL,   0U, SCREEN_HEAP_KB },
+    { SCREEN_SETTINGS_9,        Service_SettingsScreen_9,       NULL,                   NULL,   0U, SCREEN_HEAP_KB },
+    { SCREEN_SETTINGS_ALARM,    Service_SettingsAlarmScreen,    NULL,                   NULL,   0U, SCREEN_HEAP_KB },
+    { SCREEN_CLEAN,             Service_CleanScreen,            NULL,                   NULL,   0U, SCREEN_HEAP_KB },
+    { SCREEN_NUMPAD,            Service_NumpadScreen,           NULL,                   NULL,   0U, SCREEN_HEAP_KB },
+    { SCREEN_LIGHTS,            Service_LightsScreen,           Screen_PrefetchLights,  NULL,   SCREEN_MGR_BIT(SCREEN_SELECT_1), SCREEN_HEAP_STATIC_KB },
+    { SCREEN_CURTAINS,          Service_CurtainsScreen,         NULL,                   NULL,   SCREEN_MGR_BIT(SCREEN_SELECT_1), SCREEN_HEAP_KB },
+    { SCREEN_GATE,              Service_GateScreen,             Screen_PrefetchGate,    NULL,   SCREEN_MGR_BIT(SCREEN_SELECT_2), SCREEN_HEAP_KB },
+    { SCREEN_GATE_SETTINGS,     Service_GateSettingsScreen,     NULL,                   NULL,   SCREEN_MGR_BIT(SCREEN_GATE), SCREEN_HEAP_KB },
+    { SCREEN_SECURITY,          Service_SecurityScreen,         NULL,                   NULL,   SCREEN_MGR_BIT(SCREEN_SELECT_2), SCREEN_HEAP_KB },
+    { SCREEN_TIMER,             Service_TimerScreen,            NULL,                   NULL,   SCREEN_MGR_BIT(SCREEN_SELECT_2), SCREEN_HEAP_KB },
+    { SCREEN_SETTINGS_TIMER,    Service_SettingsTimerScreen,    NULL,                   NULL,   0U, SCREEN_HEAP_KB },
+    { SCREEN_SETTINGS_DATETIME, Service_SettingsDateTimeScreen, NULL,                   NULL,   0U, SCREEN_HEAP_KB },
+    { SCREEN_QR_CODE,           Service_QrCodeScreen,           NULL,                   NULL,   0U, SCREEN_HEAP_KB },
+    { SCREEN_LIGHT_SETTINGS,    Service_LightSettingsScreen,    NULL,                   NULL,   SCREEN_MGR_BIT(SCREEN_LIGHTS), SCREEN_HEAP_KB },
+    { SCREEN_RESET_MENU_SWITCHES, Service_MainScreenSwitch,     NULL,                   NULL,   0U, SCREEN_HEAP_KB },
+    { SCREEN_DIAGNOSTICS,       Service_DiagnosticsScreen,      NULL,                   NULL,   0U, SCREEN_HEAP_KB },
+};
+
 /*============================================================================*/
 /* IMPLEMENTACIJA JAVNIH FUNKCIJA (GRUPA 1/12)                                */
 /*============================================================================*/
@@ -2382,18 +2792,87 @@ static bool IsBusFwUpdateActive(void);
  */
 void DISP_Init(void)
 {
+    static const GuiStaticOps_t static_layer_ops = { StaticLayer_Create, StaticLayer_Destroy };
+    static const GuiTreeOps_t widget_tree_ops = {
+        WidgetTree_CreateRoot, WidgetTree_Destroy, WidgetTree_Show, WidgetTree_Adopt,
+        WidgetTree_HeapUsed, StaticLayer_Now, StaticLayer_Us
+    };
+    static const SettingsModelOps_t settings_model_ops = { Settings_Read, Settings_Write };
+    static const TextLayoutOps_t text_layout_ops = { Labels_GetText, Labels_Measure };
+    static const ScreenMgrOps_t screen_mgr_ops = { StaticLayer_Now, StaticLayer_Us };
+    static const FramePacerOps_t frame_pacer_ops = {
+        Pacer_Vsync, Pacer_Ms, Pacer_BufferPending, Pacer_Input, Pacer_Invalid, Pacer_Busy
+    };
+    static const GuiProfOps_t gui_prof_ops = {
+        StaticLayer_Now, Prof_DmaBusy, Prof_Flips, Prof_FlipTime, Pacer_BufferPending
+    };
+    static const MemBudgetOps_t mem_budget_ops = {
+        Mem_FreeBytes, Mem_LargestFree, Mem_UsedBlocks, Pacer_Ms, Mem_Pressure
+    };
+    static const MemBudgetLimits_t mem_limits = { GUI_HEAP_WARN_FREE, GUI_HEAP_WARN_BLOCK, GUI_HEAP_CRITICAL_BLOCK };
+    static const RemoteViewOps_t remote_view_ops = { View_Base, View_Overlay, Prof_Flips, Pacer_Ms };
+    static const ClockFaceOps_t clock_face_ops = {
+        Clock_CharWidth, Clock_Render, Clock_Release, Clock_Begin, Clock_Blit,
+        Clock_Draw, Clock_TextWidth, Clock_DrawDate, Clock_End
+    };
     uint8_t len;
 
     Display_InitSettings();
+    LangPack_Init(&lang_pack, lang_pack_pool, sizeof(lang_pack_pool), lang_pack_index, TEXT_COUNT);
+    LangPack_Build(&lang_pack, &language_strings[0][0], LANGUAGE_COUNT, g_display_settings.language);
 
     // Inicijalizacija STemWin grafičke biblioteke
     GUI_Init();
+    GuiDirty_Init(&gui_dirty, LCD_GetXSize(), LCD_GetYSize());
+    IconCache_Init(&icon_cache, icon_cache_pool, ICON_CACHE_BUDGET, Icon_CopyToSdram);
+    GuiStatic_Init(&static_layers, &static_layer_ops);
+    GuiTree_Init(&widget_trees, &widget_tree_ops);
+    GuiTree_SetPersistent(&widget_trees, SCREEN_NUMPAD);
+    GuiTree_SetPersistent(&widget_trees, SCREEN_KEYBOARD_ALPHA);
+    SettingsModel_Init(&settings_model, &settings_model_ops);
+    TextLayout_Init(&text_layout, &text_layout_ops);
+    ScreenMgr_Init(&screen_mgr, &screen_mgr_ops, screen_registry, (uint8_t)(sizeof(screen_registry) / sizeof(screen_registry[0])), SCREEN_PREFETCH_IDLE_US);
+    FramePacer_Init(&frame_pacer, &frame_pacer_ops, GUI_FRAME_BUDGET_US, GUI_FRAME_MAX_DEFER);
+    // DWT brojač ciklusa za mjerenje trajanja iscrtavanja (µs rezolucija).
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->LAR = 0xC5ACCE55U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    GuiProf_Init(&gui_prof, &gui_prof_ops, SystemCoreClock / 1000000U, GUI_PROF_BUDGET_PERMILLE);
+    // Mapa SDRAM-a: frame baferi, keševi glifova i ikonica, emWin hip.
+    mem_regions[0].name = "vram";
+    mem_regions[0].base = LCD_GetFrameBufferArea(&mem_regions[0].size);
+    mem_regions[1].name = "glyph";
+    mem_regions[1].base = LCD_GetGlyphPoolArea(&mem_regions[1].size);
+    mem_regions[2].name = "icons";
+    mem_regions[2].base = (uint32_t)icon_cache_pool;
+    mem_regions[2].size = sizeof(icon_cache_pool);
+    mem_regions[2].used = Mem_IconCacheUsed;
+    mem_regions[3].name = "gui";
+    mem_regions[3].base = GUIConf_GetHeapArea(&mem_regions[3].size);
+    mem_regions[3].used = WidgetTree_HeapUsed;
+    MemBudget_Init(&mem_budget, &mem_budget_ops, mem_regions[3].size, &mem_limits, mem_regions, (uint8_t)(sizeof(mem_regions) / sizeof(mem_regions[0])));
+    for (uint8_t i = 0; i < (uint8_t)(sizeof(screen_registry) / sizeof(screen_registry[0])); i++) {
+        MemBudget_SetBudget(&mem_budget, screen_registry[i].id, screen_registry[i].heap_kb * 1024U);
+    }
+    RemoteView_Init(&remote_view, &remote_view_ops, (uint16_t)LCD_GetXSize(), (uint16_t)LCD_GetYSize(),
+                    REMOTE_VIEW_INTERVAL_MS, REMOTE_VIEW_RATE);
+    uint8_t consent = 0;
+    EE_ReadBuffer(&consent, EE_REMOTE_VIEW, 1);
+    remote_view_allowed = (consent == REMOTE_VIEW_CONSENT);
+    ClockFace_Init(&clock_face, &clock_face_ops, SCRNSVR_CLK_PATTERN,
+                   main_screen_layout.time_pos_scrnsvr.x, main_screen_layout.time_pos_scrnsvr.y, GUI_GetYDistOfFont(GUI_FONT_D80),
+                   main_screen_layout.date_pos_scrnsvr.x, main_screen_layout.date_pos_scrnsvr.y, GUI_GetYDistOfFont(&GUI_FontVerdana32_LAT),
+                   clk_clrs[g_display_settings.scrnsvr_clk_clr]);
     // Povezivanje (hook) funkcije za obradu dodira sa GUI sistemom
     GUI_PID_SetHook(PID_Hook);
     // Omogućavanje višestrukog baferovanja za fluidnije iscrtavanje
     WM_MULTIBUF_Enable(1);
     // Postavljanje UTF-8 enkodiranja za podršku specijalnim karakterima
     GUI_UC_SetEncodeUTF8();
+    // Digiti i znakovi brojeva se učitavaju u keš glifova jednom, za sve fontove.
+    LCD_GlyphPreload(&GUI_FontVerdana16_LAT, GLYPH_PRELOAD_CHARS);
+    LCD_GlyphPreload(&GUI_FontVerdana20_LAT, GLYPH_PRELOAD_CHARS);
+    LCD_GlyphPreload(&GUI_FontVerdana32_LAT, GLYPH_PRELOAD_CHARS);
     // Odabir i čišćenje prvog sloja (layer 0)
     GUI_SelectLayer(0);
     GUI_Clear();
@@ -2417,6 +2896,12 @@ void DISP_Init(void)
         EE_ReadBuffer(&qr_codes[1][0], EE_QR_CODE2 + 1, len);
     }
 
+    // Matrice QR kodova se prave jednom, ne pri svakom iscrtavanju.
+    QrCache_Init(&qr_cache, QR_Encode);
+    for (uint8_t i = 0; i < QR_CODE_COUNT; i++) {
+        QrCache_Update(&qr_cache, i, (const char*)qr_codes[i]);
+    }
+
     // Pokretanje tajmera koji se okida svake minute
     everyMinuteTimerStart = HAL_GetTick();
 
@@ -2469,12 +2954,19 @@ void DISP_Init(void)
  */
 void DISP_Service(void)
 {
-    static uint32_t guitmr = 0;
+    // Novi widgeti prelaze u stablo aktivnog ekrana prije iscrtavanja.
+    WidgetTree_Sync();
 
-    // Ažuriranje GUI-ja i obrada TS-a u fiksnim intervalima
-    if ((HAL_GetTick() - guitmr) >= GUI_REFRESH_TIME) {
-        guitmr = HAL_GetTick();
+    // Ažuriranje GUI-ja i obrada TS-a jednom po vsync-u, samo kad ima dodira
+    // ili nevažećih prozora i kad je bafer slobodan (frame_pacer.h).
+    // Dok se briše sektor QSPI-ja, resursi iz nje nisu dostupni za čitanje.
+    if (!FwUpdateAgent_IsFlashBusy() && FramePacer_Poll(&frame_pacer)) {
+        uint32_t start = StaticLayer_Now();
+        uint32_t exec_us;
         GUI_Exec(); // Izvršava sve pending operacije iscrtavanja
+        exec_us = StaticLayer_Us(start);
+        FramePacer_Done(&frame_pacer, exec_us);
+        GuiProf_Exec(&gui_prof, exec_us);
     }
 
     // Provjera i prikaz poruke o ažuriranju firmvera
@@ -2482,126 +2974,51 @@ void DISP_Service(void)
         return; // Ako je ažuriranje u toku, prekini dalje izvršavanje GUI logike
     }
 
-    // Glavni switch za upravljanje stanjima (ekranima)
-    switch (screen) {
-    case SCREEN_MAIN:
-        Service_MainScreen();
-        break;
-    case SCREEN_SELECT_1:
-        Service_SelectScreen1();
-        break;
-    case SCREEN_SELECT_2:
-        Service_SelectScreen2();
-        break;
-    case SCREEN_SCENE:
-        Service_SceneScreen();
-        break;
-    case SCREEN_SCENE_EDIT:
-        Service_SceneEditScreen();
-        break;
-    case SCREEN_SCENE_APPEARANCE:
-        Service_SceneAppearanceScreen();
-        break;
-    case SCREEN_SCENE_WIZ_DEVICES:
-        Service_SceneWizDevicesScreen();
-        break;
-    case SCREEN_SELECT_LAST:
-        Service_SelectScreenLast();
-        break;
-    case SCREEN_THERMOSTAT:
-        Service_ThermostatScreen();
-        break;
-    case SCREEN_ALARM_ACTIVE:
-        Service_AlarmActiveScreen();
-        break;
-    case SCREEN_RETURN_TO_FIRST:
-        Service_ReturnToFirst();
-        break;
-    case SCREEN_SETTINGS_1:
-        Service_SettingsScreen_1();
-        break;
-    case SCREEN_SETTINGS_2:
-        Service_SettingsScreen_2();
-        break;
-    case SCREEN_SETTINGS_3:
-        Service_SettingsScreen_3();
-        break;
-    case SCREEN_SETTINGS_4:
-        Service_SettingsScreen_4();
-        break;
-    case SCREEN_SETTINGS_5:
-        Service_SettingsScreen_5();
-        break;
-    case SCREEN_SETTINGS_6:
-        Service_SettingsScreen_6();
-        break;
-    case SCREEN_SETTINGS_7:
-        Service_SettingsScreen_7();
-        break;
-    case SCREEN_SETTINGS_8:
-        Service_SettingsScreen_8();
-        break;
-    case SCREEN_SETTINGS_9:
-        Service_SettingsScreen_9();
-        break;
-    case SCREEN_SETTINGS_ALARM:
-        Service_SettingsAlarmScreen();
-        break;
-    case SCREEN_CLEAN:
-        Service_CleanScreen();
-        break;
-    case SCREEN_NUMPAD:
-        Service_NumpadScreen();
-        break;
-    case SCREEN_LIGHTS:
-        Service_LightsScreen();
-        break;
-    case SCREEN_CURTAINS:
-        Service_CurtainsScreen();
-        break;
-    case SCREEN_GATE:
-        Service_GateScreen();
-        break;
-    case SCREEN_GATE_SETTINGS:
-        Service_GateSettingsScreen();
-        break;
-    case SCREEN_SECURITY:
-        Service_SecurityScreen();
-        break;
-    case SCREEN_TIMER:
-        Service_TimerScreen();
-        break;
-    case SCREEN_SETTINGS_TIMER:
-        Service_SettingsTimerScreen();
-        break;
-    case SCREEN_SETTINGS_DATETIME:
-        Service_SettingsDateTimeScreen();
-        break;
-    case SCREEN_QR_CODE:
-        Service_QrCodeScreen();
-        break;
-    case SCREEN_LIGHT_SETTINGS:
-        Service_LightSettingsScreen();
-        break;
-    case SCREEN_RESET_MENU_SWITCHES:
-        Service_MainScreenSwitch();
-        break;
-    default:
+    // Servis aktivnog ekrana iz registra; pri ulasku na ekran se učitava
+    // njegov manifest (ikonice u SDRAM), ako nije učitan unaprijed.
+    // Trajanje se bilježi za ekran na kojem je servis počeo.
+    uint8_t active = (uint8_t)screen;
+    uint32_t service_start = StaticLayer_Now();
+    bool known = ScreenMgr_Service(&screen_mgr, active);
+    GuiProf_Pass(&gui_prof, active, service_start);
+    // Hip poslije servisa: rast na ekranu, fragmentacija, upozorenje prije nego alokacija ne uspije.
+    MemBudget_Sample(&mem_budget, active);
+    // Pregled ekrana za podršku: promijenjene pločice prikazanih bafera u tok.
+    // Ekran sa PIN-om ili šifrom ne ide u tok: pregled se gasi prije prve pločice.
+    if (remote_view.active || remote_view.restart) {
+        if (!remote_view_allowed || View_Private()) {
+            RemoteView_Stop(&remote_view);
+            remote_view.restart = false;
+        } else {
+            RemoteView_Service(&remote_view, REMOTE_VIEW_TILES_PER_PASS);
+        }
+    }
+    if (!known) {
         // U slučaju nepoznatog stanja, resetuj flegove menija
         menu_lc = 0;
         thermostatMenuState = 0;
-        break;
     }
 
     // Upravljanje periodičnim događajima i tajmerima (npr. screensaver)
     Handle_PeriodicEvents();
 
     // Provjera da li treba ući u meni za podešavanja (dugi pritisak)
-    if (DISPMenuSettings(btnset) && (screen < SCREEN_SETTINGS_1)) {
-        // Inicijalizuj prvi ekran podešavanja
-        DSP_InitSet1Scrn();
-        screen = SCREEN_SETTINGS_1;
+    if (DISPMenuSettings(btnset)) {
+        if (screen < SCREEN_SETTINGS_1) {
+            // Inicijalizuj prvi ekran podešavanja
+            DSP_InitSet1Scrn();
+            screen = SCREEN_SETTINGS_1;
+        } else if (screen == SCREEN_SETTINGS_1) {
+            // Pritisak traje još jednom toliko: skriveni ekran mjerenja iscrtavanja.
+            DSP_KillSet1Scrn();
+            diag_armed = false;
+            screen = SCREEN_DIAGNOSTICS;
+            shouldDrawScreen = 1;
+        }
     }
+
+    // Dok je ekran miran, učitavaju se resursi ekrana na koje se vjerovatno prelazi.
+    ScreenMgr_Idle(&screen_mgr);
 }
 /**
  * @brief Prikazuje zadanu temperaturu (Set Point) na ekranu termostata.
@@ -2690,6 +3107,24 @@ void PID_Hook(GUI_PID_STATE * pTS)
         return;
     }
 
+    // Skriveni ekran mjerenja: prvi dodir nakon otpuštanja onog kojim se
+    // ušlo vraća na glavni ekran.
+    if (screen == SCREEN_DIAGNOSTICS) {
+        if (pTS->Pressed == 0U) {
+            btnset = 0;
+            diag_armed = true;
+        } else if (diag_armed) {
+            diag_armed = false;
+            GUI_SelectLayer(0);
+            GUI_Clear();
+            GUI_SelectLayer(1);
+            GUI_Clear();
+            screen = SCREEN_MAIN;
+            shouldDrawScreen = 1;
+        }
+        return;
+    }
+
     // Provjera da li je dodir registrovan na početku s nulama, i resetuj btnset.
     // NOVO: Svaka linija je objašnjena
     if(pTS->x == 0 && pTS->y == 0 && pTS->Pressed == 0) { // Provjerava da li su koordinate nula i pritisak nula
@@ -2910,123 +3345,334 @@ void DISP_SignalDynamicIconUpdate(void)
 }
 
 /**
- * @brief Vraća pointer na odgovarajući string iz tabele prevoda.
- * @param t ID teksta koji treba učitati (iz TextID enum-a).
- * @return const char* Pointer na string u tabeli za trenutno odabrani jezik.
+ * @brief Označava dio ekrana koji treba ponovo iscrtati.
+ * @note Koordinate su uključive, kao kod `GUI_RECT`. Pravougaonik se spaja sa
+ * ranije označenim; ekran u sljedećem prolazu crta samo njihovu uniju.
+ * @param x0,y0 Gornji lijevi ugao.
+ * @param x1,y1 Donji desni ugao.
+ * @retval None
  */
-const char* lng(uint8_t t)
+void DISP_InvalidateRect(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
 {
-    // Provjera da li je ID u validnom opsegu
-    if (t > 0 && t < TEXT_COUNT) {
-        // Vrati direktan pointer na string iz tabele
-        return language_strings[t][g_display_settings.language];
+    GuiDirty_Invalidate(&gui_dirty, x0, y0, x1, y1);
+}
+
+/**
+ * @brief Označava pločicu jednog svjetla na ekranu `SCREEN_LIGHTS` za ponovno iscrtavanje.
+ * @note Poziva se iz `lights.c` pri promjeni stanja svjetla umjesto `shouldDrawScreen = 1`,
+ * tako da se ne crtaju ponovo sve ostale ikonice i labele. U "Scene Wizard" modu
+ * ekran ima drugačiji raspored, pa se crta cijeli.
+ * @param index Indeks svjetla (isti kao za `LIGHTS_GetInstance`).
+ * @retval None
+ */
+void DISP_InvalidateLight(uint8_t index)
+{
+    GUI_RECT rect;
+
+    if (screen != SCREEN_LIGHTS) return;
+
+    if (!is_in_scene_wizard_mode && LightsScreen_GetTileRect(index, &rect)) {
+        GuiDirty_Invalidate(&gui_dirty, rect.x0, rect.y0, rect.x1, rect.y1);
+    } else {
+        shouldDrawScreen = 1;
     }
-    // U slučaju nevalidnog ID-ja, vrati pointer na prazan string
-    return language_strings[0][0]; // Index 0 (TXT_DUMMY) je definisan kao prazan string
 }
+
 /**
- * @brief Provjerava da li je dužina podataka za QR kod validna.
- * @param dataLength Dužina podataka.
- * @return true ako je dužina manja od definisanog maksimuma, inače false.
+ * @brief Označava pločicu jedne kapije na ekranu `SCREEN_GATE` za ponovno iscrtavanje.
+ * @note Poziva se iz `gate.c` pri promjeni stanja kapije umjesto `shouldDrawScreen = 1`.
+ * Na ostalim ekranima (npr. kontrolni panel kapije) i dalje se crta cijeli ekran.
+ * @param index Indeks kapije (isti kao za `Gate_GetInstance`).
+ * @retval None
  */
-bool QR_Code_isDataLengthShortEnough(uint8_t dataLength)
+void DISP_InvalidateGate(uint8_t index)
 {
-    return dataLength < QR_CODE_LENGTH;
+    GUI_RECT rect;
+
+    if ((screen == SCREEN_GATE) && GateScreen_GetTileRect(index, &rect)) {
+        GuiDirty_Invalidate(&gui_dirty, rect.x0, rect.y0, rect.x1, rect.y1);
+    } else {
+        shouldDrawScreen = 1;
+    }
 }
 
 /**
- * @brief Provjerava da li će string stati u bafer za QR kod.
- * @param data Pointer na string sa podacima.
- * @return true ako podaci staju, inače false.
+ * @brief Proglašava statičke slojeve svih ekrana zastarjelim.
+ * @note Poziva se pri promjeni jezika, teme ili konfiguracije (npr. iz
+ * `LIGHTS_Save()`), jer tada labele i pozadine više ne odgovaraju kopiji
+ * u memorijskom uređaju. Sljedeće iscrtavanje ekrana ih obnavlja.
+ * @retval None
  */
-bool QR_Code_willDataFit(const uint8_t *data)
+void DISP_InvalidateStaticLayers(void)
 {
-    return QR_Code_isDataLengthShortEnough(strlen((char*)data));
+    GuiStatic_InvalidateAll(&static_layers);
 }
 
 /**
- * @brief Vraća pointer na podatke za specifični QR kod.
- * @param qrCodeID ID QR koda (1 za WiFi, 2 za App).
- * @return Pointer na string sa podacima.
+ * @brief Proglašava izmjerene korisničke labele i odabrane fontove zastarjelim.
+ * @note Poziva se pri promjeni korisničke labele svjetla ili kapije; prevedeni
+ * tekstovi ostaju u kešu.
+ * @retval None
  */
-uint8_t* QR_Code_Get(const uint8_t qrCodeID)
+void DISP_InvalidateLabels(void)
 {
-    // Provjera da li je ID validan
-    if (qrCodeID > 0 && qrCodeID <= QR_CODE_COUNT) {
-        return qr_codes[qrCodeID - 1]; // Vrati traženi QR kod
-    }
-    return qr_codes[0]; // Vrati prvi kao fallback u slučaju greške
+    TextLayout_InvalidateLabels(&text_layout);
 }
+
 /**
- * @brief Postavlja podatke za specifični QR kod.
- * @note  Funkcija provjerava da li podaci staju u predviđeni bafer prije kopiranja.
- * @param qrCodeID ID QR koda (1 za WiFi, 2 za App).
- * @param data Pointer na string sa podacima.
+ * @brief Vraća izvještaj o vremenima iscrtavanja ekrana sa statičkim slojem.
+ * @note Po ekranu: prosjek iscrtavanja statičkog dijela, kopiranja (blit) i
+ * dinamičkog dijela u µs, te ubrzanje osvježavanja u odnosu na puno iscrtavanje.
+ * @retval const char* Tekst izvještaja (važi do sljedećeg poziva).
  */
-void QR_Code_Set(const uint8_t qrCodeID, const uint8_t *data)
+const char* DISP_GetStaticLayerReport(void)
 {
-    // Provjeri da li je ID validan i da li će podaci stati u bafer
-    if(QR_Code_willDataFit(data) && qrCodeID > 0 && qrCodeID <= QR_CODE_COUNT)
-    {
-        // Sigurno kopiraj string u odgovarajući red 2D niza
-        sprintf((char*)(qr_codes[qrCodeID - 1]), "%s", (char*)data);
-    }
+    GuiStatic_Report(&static_layers, static_layer_report, sizeof(static_layer_report));
+    return static_layer_report;
 }
-/*============================================================================*/
-/* IMPLEMENTACIJA STATIČKIH (PRIVATNIH) FUNKCIJA                              */
-/*============================================================================*/
-static void DISP_Animation(void)
+
+/**
+ * @brief Vraća izvještaj o stablima widgeta i prelazima između ekrana.
+ * @note Po ekranu: broj ulazaka, pravljenja i ponovnih prikaza stabla, broj
+ * widgeta, zadnji i najduži prelaz u µs i najveće zauzeće GUI hipa.
+ * @retval const char* Tekst izvještaja (važi do sljedećeg poziva).
+ */
+const char* DISP_GetWidgetTreeReport(void)
 {
-    DISPSetBrightnes(20);
-    // Deklaracija niza pokazivača na sve frejmove animacije
-    GUI_CONST_STORAGE GUI_BITMAP* animation_frames[] = {
-        &bmanimation_welcome_frame_05,
-        &bmanimation_welcome_frame_10,
-        &bmanimation_welcome_frame_15,
-        &bmanimation_welcome_frame_20,
-        &bmanimation_welcome_frame_25,
-        &bmanimation_welcome_frame_30,
-        &bmanimation_welcome_frame_35,
-        &bmanimation_welcome_frame_40,
-        &bmanimation_welcome_frame_45,
-        &bmanimation_welcome_frame_50,
-        &bmanimation_welcome_frame_55,
-        &bmanimation_welcome_frame_60,
-        &bmanimation_welcome_frame_65,
-        &bmanimation_welcome_frame_70,
-        &bmanimation_welcome_frame_75,
-        &bmanimation_welcome_frame_80,
-        &bmanimation_welcome_frame_85,
-        &bmanimation_welcome_frame_90,
-        &bmanimation_welcome_frame_95,
-        &bmanimation_welcome_frame_100
-    };
+    GuiTree_Report(&widget_trees, widget_tree_report, sizeof(widget_tree_report));
+    return widget_tree_report;
+}
 
-    // Definirajte vrijeme zadržavanja svakog frejma u milisekundama
-    const uint32_t FRAME_DELAY_MS = 10; // 20ms za svaki frejm = 50 FPS
+/**
+ * @brief Javlja da je dodir prijavljen emWin-u (`GUI_TOUCH_StoreStateEx()`).
+ * @note Frejm sa novim ulazom se crta na prvom slobodnom vsync-u, bez
+ * odgađanja zbog rada na busu.
+ */
+void DISP_NotifyInput(void)
+{
+    gui_input = true;
+    GuiProf_Touch(&gui_prof);
+}
 
+/**
+ * @brief Vraća izvještaj o tempiranju iscrtavanja.
+ * @note Iscrtani frejmovi (od toga sa dodirom), vsync-ovi bez posla, sa
+ * baferom koji čeka prikaz, preskočeni zbog budžeta i odgođeni zbog busa,
+ * pa zadnje i najduže trajanje `GUI_Exec()` u µs.
+ * @retval const char* Tekst izvještaja (važi do sljedećeg poziva).
+ */
+const char* DISP_GetFrameReport(void)
+{
+    FramePacer_Report(&frame_pacer, frame_report, sizeof(frame_report));
+    return frame_report;
+}
 
-    // Prikaz svakog frejma u petlji
-    for (int i = 0; i < (sizeof(animation_frames) / sizeof(animation_frames[0])); i++)
-    {
-        GUI_MULTIBUF_Begin();
-        GUI_Clear();
-        // Crtanje bitmapa na centar ekrana
-        GUI_DrawBitmap(animation_frames[i], (LCD_GetXSize() - animation_frames[i]->XSize) / 2, (LCD_GetYSize() - animation_frames[i]->YSize) / 2);
-        GUI_MULTIBUF_End();
+/**
+ * @brief Vraća izvještaj o mjerenju iscrtavanja.
+ * @note Zauzeće DMA2D-a i cijena mjerenja u zadnjoj sekundi, pa za
+ * `GUI_Exec()`, dodir -> prikaz i servis svakog ekrana broj uzoraka,
+ * prosjek, p50, p95 i najduže trajanje u µs. Isti tekst prikazuje
+ * `SCREEN_DIAGNOSTICS` i šalje `DIAG_GET` na RS485.
+ * @retval const char* Tekst izvještaja (važi do sljedećeg poziva).
+ */
+const char* DISP_GetProfReport(void)
+{
+    GuiProf_Report(&gui_prof, gui_prof_report, sizeof(gui_prof_report));
+    return gui_prof_report;
+}
 
-        // Obavezno pozvati GUI_Exec() nakon svake operacije
-        GUI_Exec();
+/**
+ * @brief Briše histograme i brojače mjerenja iscrtavanja.
+ */
+void DISP_ResetProf(void)
+{
+    GuiProf_Reset(&gui_prof);
+}
 
-        // Čekanje prije prelaska na sljedeći frejm
-        HAL_Delay(FRAME_DELAY_MS);
-    }
+/**
+ * @brief Vraća izvještaj o GUI hipu i SDRAM-u.
+ * @note Zauzeće, najveći slobodan blok, fragmentacija i nivo hipa, mapa
+ * SDRAM-a (frame baferi, keševi, hip), pa po ekranu broj ulazaka, najveći
+ * rast hipa prema budžetu, novi blokovi, odobrene velike alokacije i broj
+ * ulazaka na kojima je budžet prekoračen.
+ * @retval const char* Tekst izvještaja (važi do sljedećeg poziva).
+ */
+const char* DISP_GetMemReport(void)
+{
+    MemBudget_Report(&mem_budget, mem_report, sizeof(mem_report));
+    return mem_report;
+}
 
-    HAL_Delay(1000);
+/**
+ * @brief Uključuje daljinski pregled ekrana: novi tok sa punim frejmom.
+ * @note Poziva se iz RS485 prekida; pregled se sam isključi ako ga
+ * preglednik ne čita `REMOTE_VIEW_IDLE_MS`.
+ * @retval bool false ako pregled nije dozvoljen na panelu ili je na
+ * ekranu unos PIN-a ili šifre.
+ */
+bool DISP_RemoteViewStart(void)
+{
+    if (!remote_view_allowed || View_Private()) return false;
+    RemoteView_Start(&remote_view);
+    return true;
+}
 
-    // =======================================================================
-    // === POČETAK NOVE LOGIKE ZA ISPIS TEKSTA NA DNU EKRANA ===
-    // =======================================================================
+void DISP_RemoteViewStop(void)
+{
+    RemoteView_Stop(&remote_view);
+}
+
+/**
+ * @brief Traži pun frejm pregleda (preglednik je izgubio sliku).
+ */
+void DISP_RemoteViewKeyframe(void)
+{
+    RemoteView_Keyframe(&remote_view);
+}
+
+bool DISP_RemoteViewActive(void)
+{
+    return remote_view.active;
+}
+
+/**
+ * @brief Potvrđuje tok pregleda do `pos` i kopira najviše `max` bajta od `pos`.
+ * @retval int32_t Broj bajta (ograničen brzinom `REMOTE_VIEW_RATE`), -1 ako
+ * pregled nije uključen ili `pos` nije u nepotvrđenom dijelu toka.
+ */
+int32_t DISP_RemoteViewRead(uint32_t pos, uint8_t *buf, uint16_t max)
+{
+    return RemoteView_Read(&remote_view, pos, buf, max);
+}
+
+/**
+ * @brief Vraća izvještaj daljinskog pregleda ekrana.
+ * @note Frejmovi i pločice, pročitane tokom zamjene bafera, zadnji i
+ * najveći frejm u bajtima, pozicija toka i potvrđeni dio, te prolazi bez
+ * mjesta u prstenu i čitanja skraćena ograničenjem brzine.
+ * @retval const char* Tekst izvještaja (važi do sljedećeg poziva).
+ */
+const char* DISP_GetRemoteViewReport(void)
+{
+    RemoteView_Report(&remote_view, remote_view_report, sizeof(remote_view_report));
+    return remote_view_report;
+}
+
+/**
+ * @brief Vraća izvještaj sata na screensaver-u.
+ * @note Površina cijelog vremena i datuma, keš znakova, te iscrtana
+ * površina po minuti (sa treptanjem dvotačke), po treptaju i po datumu.
+ * @retval const char* Tekst izvještaja (važi do sljedećeg poziva).
+ */
+const char* DISP_GetClockReport(void)
+{
+    ClockFace_Report(&clock_face, clock_report, sizeof(clock_report));
+    return clock_report;
+}
+
+/**
+ * @brief Vraća izvještaj registra ekrana.
+ * @note Broj ekrana učitanih unaprijed, ulazaka na unaprijed učitan ekran i
+ * ulazaka bez toga, pa po paru ekrana broj prelaza i zadnje i najduže
+ * trajanje prelaza u µs.
+ * @retval const char* Tekst izvještaja (važi do sljedećeg poziva).
+ */
+const char* DISP_GetScreenReport(void)
+{
+    ScreenMgr_Report(&screen_mgr, screen_report, sizeof(screen_report));
+    return screen_report;
+}
+
+/**
+ * @brief Vraća pointer na odgovarajući string iz tabele prevoda.
+ * @param t ID teksta koji treba učitati (iz TextID enum-a).
+ * @return const char* Pointer na string u tabeli za trenutno odabrani jezik.
+ */
+const char* lng(uint8_t t)
+{
+    // Jezik je promijenjen: stringovi novog jezika se pakuju u RAM jednom.
+    // Build pamti jezik i kad ne uspije, pa se neuspjelo pakovanje ne ponavlja.
+    if (lang_pack.language != g_display_settings.language) {
+        LangPack_Build(&lang_pack, &language_strings[0][0], LANGUAGE_COUNT, g_display_settings.language);
+    }
+    if (lang_pack.valid) {
+        return LangPack_Get(&lang_pack, (t < TEXT_COUNT) ? t : 0);
+    }
+    // Provjera da li je ID u validnom opsegu
+    if (t > 0 && t < TEXT_COUNT) {
+        // Vrati direktan pointer na string iz tabele
+        return language_strings[t][g_display_settings.language];
+    }
+    // U slučaju nevalidnog ID-ja, vrati pointer na prazan string
+    return language_strings[0][0]; // Index 0 (TXT_DUMMY) je definisan kao prazan string
+}
+/**
+ * @brief Provjerava da li je dužina podataka za QR kod validna.
+ * @param dataLength Dužina podataka.
+ * @return true ako je dužina manja od definisanog maksimuma, inače false.
+ */
+bool QR_Code_isDataLengthShortEnough(uint8_t dataLength)
+{
+    return dataLength < QR_CODE_LENGTH;
+}
+
+/**
+ * @brief Provjerava da li će string stati u bafer za QR kod.
+ * @param data Pointer na string sa podacima.
+ * @return true ako podaci staju, inače false.
+ */
+bool QR_Code_willDataFit(const uint8_t *data)
+{
+    return QR_Code_isDataLengthShortEnough(strlen((char*)data));
+}
+
+/**
+ * @brief Vraća pointer na podatke za specifični QR kod.
+ * @param qrCodeID ID QR koda (1 za WiFi, 2 za App).
+ * @return Pointer na string sa podacima.
+ */
+uint8_t* QR_Code_Get(const uint8_t qrCodeID)
+{
+    // Provjera da li je ID validan
+    if (qrCodeID > 0 && qrCodeID <= QR_CODE_COUNT) {
+        return qr_codes[qrCodeID - 1]; // Vrati traženi QR kod
+    }
+    return qr_codes[0]; // Vrati prvi kao fallback u slučaju greške
+}
+/**
+ * @brief Postavlja podatke za specifični QR kod.
+ * @note  Funkcija provjerava da li podaci staju u predviđeni bafer prije kopiranja.
+ * @param qrCodeID ID QR koda (1 za WiFi, 2 za App).
+ * @param data Pointer na string sa podacima.
+ */
+void QR_Code_Set(const uint8_t qrCodeID, const uint8_t *data)
+{
+    // Provjeri da li je ID validan i da li će podaci stati u bafer
+    if(QR_Code_willDataFit(data) && qrCodeID > 0 && qrCodeID <= QR_CODE_COUNT)
+    {
+        // Sigurno kopiraj string u odgovarajući red 2D niza
+        sprintf((char*)(qr_codes[qrCodeID - 1]), "%s", (char*)data);
+        // Poziva se iz RS485 prekida: matricu pravi Handle_PeriodicEvents, van prekida.
+        QrCache_Invalidate(&qr_cache, QR_Slot(qrCodeID));
+    }
+}
+/*============================================================================*/
+/* IMPLEMENTACIJA STATIČKIH (PRIVATNIH) FUNKCIJA                              */
+/*============================================================================*/
+static void DISP_Animation(void)
+{
+    DISPSetBrightnes(20);
+
+    // Animacija dobrodošlice: jedna slika koja se pojavljuje (providnost
+    // po frejmu), na centru ekrana, 10 ms po frejmu.
+    GUI_Clear();
+    Anim_Play(&anim_welcome, (LCD_GetXSize() - anim_welcome.width) / 2, (LCD_GetYSize() - anim_welcome.height) / 2, 1U);
+
+    HAL_Delay(1000);
+
+    // =======================================================================
+    // === POČETAK NOVE LOGIKE ZA ISPIS TEKSTA NA DNU EKRANA ===
+    // =======================================================================
 
     // Postavljanje fonta i boje za tekst
     GUI_SetFont(&GUI_Font20_ASCII);
@@ -3077,45 +3723,9 @@ static void DISP_Animation(void)
 
 #define ANIMATION_REPEATS 20 // Podesite broj ponavljanja animacije
 
-    GUI_CONST_STORAGE GUI_BITMAP* animation_flame[] = {
-        &bmanimation_candle_frame_1,
-        &bmanimation_candle_frame_2,
-        &bmanimation_candle_frame_3,
-        &bmanimation_candle_frame_4
-    };
-
-    // Definirajte vrijeme zadržavanja svakog frejma u milisekundama
-    const uint32_t FLAME_DELAY_MS = 100; // 100ms za svaki frejm
-
-    // Izračunavanje dimenzija za brisanje (koristimo dimenzije prvog frejma)
-    const int xPos = 118;
-    const int yPos = 80;
-    const int clearWidth = animation_flame[0]->XSize;
-    const int clearHeight = animation_flame[0]->YSize;
-
-    // Vanjska petlja za ponavljanje animacije
-    for (int repeat = 0; repeat < ANIMATION_REPEATS; repeat++)
-    {
-        // Unutrašnja petlja za prikaz svakog frejma
-        for (int i = 0; i < (sizeof(animation_flame) / sizeof(animation_flame[0])); i++)
-        {
-            GUI_MULTIBUF_Begin();
-
-            // Dinamičko čišćenje područja bitmape na njenoj poziciji
-            GUI_ClearRect(xPos, yPos, xPos + clearWidth, yPos + clearHeight);
-
-            // Crtanje bitmapa
-            GUI_DrawBitmap(animation_flame[i], xPos, yPos);
-            GUI_MULTIBUF_End();
-
-            // Obavezno pozvati GUI_Exec() nakon svake operacije
-            GUI_Exec();
-
-            // Čekanje prije prelaska na sljedeći frejm
-            HAL_Delay(FLAME_DELAY_MS);
-            DISPSetBrightnes(g_display_settings.high_bcklght);
-        }
-    }
+    // Plamen svijeće, 100 ms po frejmu; crtaju se samo promijenjeni dijelovi.
+    DISPSetBrightnes(g_display_settings.high_bcklght);
+    Anim_Play(&anim_candle, 118, 80, ANIMATION_REPEATS);
     GUI_Clear();
     HAL_Delay(1000);
     DISPSetBrightnes(g_display_settings.low_bcklght);
@@ -3248,6 +3858,9 @@ static void Display_Save(void)
     g_display_settings.crc = HAL_CRC_Calculate(&hcrc, (uint32_t*)&g_display_settings, sizeof(Display_EepromSettings_t));
     // Snimanje cijelog bloka podataka u EEPROM
     EE_WriteBuffer((uint8_t*)&g_display_settings, EE_DISPLAY_SETTINGS, sizeof(Display_EepromSettings_t));
+    // Jezik ili tema su se možda promijenili, statički slojevi i labele se obnavljaju.
+    GuiStatic_InvalidateAll(&static_layers);
+    TextLayout_InvalidateAll(&text_layout);
 }
 
 /**
@@ -3287,173 +3900,6 @@ static void Display_InitSettings(void)
     // Ovo omogućava da ostatak koda ne morate mijenjati odmah.
 }
 
-/**
-* @brief Očisti sve duhove sa ekrana
- * @note Ova funkcija provjerava postojanje widgeta iz liste svih definisanih u settings_widgets.def
- * kada je kontrola na glavnom ekranu i displej u modu screen savera i uklanja svaki "zivi" widget
- */
-static void ForceKillAllSettingsWidgets(void)
-{
-    WM_HWIN hWidget;
-    uint16_t id_to_check;
-
-    // --- 1. Uništavanje statičkih widgeta sa nove, pregledne liste ---
-    for (uint16_t i = 0; i < (sizeof(settings_static_widget_ids) / sizeof(settings_static_widget_ids[0])); i++) {
-        id_to_check = settings_static_widget_ids[i];
-        if ((hWidget = WM_GetDialogItem(WM_GetDesktopWindow(), id_to_check))) {
-            WM_DeleteWindow(hWidget);
-        }
-    }
-
-    // --- 2. Uništavanje dinamičkih widgeta (petlje ostaju) ---
-    // Zavjese
-    for (uint16_t i = 0; i < (CURTAINS_SIZE * 2); i++) {
-        id_to_check = ID_CurtainsRelay + i;
-        if ((hWidget = WM_GetDialogItem(WM_GetDesktopWindow(), id_to_check))) {
-            WM_DeleteWindow(hWidget);
-        }
-    }
-
-    // Svjetla
-    for (uint16_t i = 0; i < (LIGHTS_MODBUS_SIZE * 13); i++) {
-        id_to_check = ID_LightsModbusRelay + i;
-        if ((hWidget = WM_GetDialogItem(WM_GetDesktopWindow(), id_to_check))) {
-            WM_DeleteWindow(hWidget);
-        }
-    }
-
-    // --- 3. DOPUNJENO: Brisanje svih izostavljenih widgeta ---
-
-    // NumPad tastatura
-    for (int i = 0; i < 12; i++) {
-        if (WM_IsWindow(hKeypadButtons[i])) {
-            WM_DeleteWindow(hKeypadButtons[i]);
-            hKeypadButtons[i] = 0;
-        }
-    }
-    // Alfanumerička tastatura
-    for (int i = 0; i < (KEY_ROWS * KEYS_PER_ROW); i++) {
-        if (WM_IsWindow(hKeyboardButtons[i])) {
-            WM_DeleteWindow(hKeyboardButtons[i]);
-            hKeyboardButtons[i] = 0;
-        }
-    }
-    for (int i = 0; i < 5; i++) {
-        if (WM_IsWindow(hKeyboardSpecialButtons[i])) {
-            WM_DeleteWindow(hKeyboardSpecialButtons[i]);
-            hKeyboardSpecialButtons[i] = 0;
-        }
-    }
-    if (WM_IsWindow(hButtonRenameLight)) {
-        WM_DeleteWindow(hButtonRenameLight);
-        hButtonRenameLight = 0;
-    }
-
-    // Podešavanja kapija
-    if (WM_IsWindow(hGateSelect)) WM_DeleteWindow(hGateSelect);
-    if (WM_IsWindow(hGateType)) WM_DeleteWindow(hGateType);
-    for (int i = 0; i < 9; i++) {
-        if (WM_IsWindow(hGateControlButtons[i])) {
-            WM_DeleteWindow(hGateControlButtons[i]);
-            hGateControlButtons[i] = 0;
-        }
-    }
-
-    // Podešavanja scena
-    if (WM_IsWindow(hButtonChangeAppearance)) WM_DeleteWindow(hButtonChangeAppearance);
-    if (WM_IsWindow(hButtonDeleteScene)) WM_DeleteWindow(hButtonDeleteScene);
-    if (WM_IsWindow(hButtonDetailedSetup)) WM_DeleteWindow(hButtonDetailedSetup);
-    if (WM_IsWindow(hButtonWizCancel)) WM_DeleteWindow(hButtonWizCancel);
-    if (WM_IsWindow(hButtonWizBack)) WM_DeleteWindow(hButtonWizBack);
-    if (WM_IsWindow(hButtonWizNext)) WM_DeleteWindow(hButtonWizNext);
-
-    for (int i = 0; i < SCENE_MAX_TRIGGERS; i++) {
-        if (WM_IsWindow(hSPNBX_SceneTriggers[i])) {
-            WM_DeleteWindow(hSPNBX_SceneTriggers[i]);
-            hSPNBX_SceneTriggers[i] = 0;
-        }
-    }
-
-    // Podešavanja datuma i vremena
-    for (int i = 0; i < 5; i++) {
-        if (WM_IsWindow(hTextDateTimeValue[i])) WM_DeleteWindow(hTextDateTimeValue[i]);
-        if (WM_IsWindow(hButtonDateTimeUp[i])) WM_DeleteWindow(hButtonDateTimeUp[i]);
-        if (WM_IsWindow(hButtonDateTimeDown[i])) WM_DeleteWindow(hButtonDateTimeDown[i]);
-    }
-
-    // Podešavanja tajmera
-    if (WM_IsWindow(hButtonTimerHourUp)) WM_DeleteWindow(hButtonTimerHourUp);
-    if (WM_IsWindow(hButtonTimerHourDown)) WM_DeleteWindow(hButtonTimerHourDown);
-    if (WM_IsWindow(hButtonTimerMinuteUp)) WM_DeleteWindow(hButtonTimerMinuteUp);
-    if (WM_IsWindow(hButtonTimerMinuteDown)) WM_DeleteWindow(hButtonTimerMinuteDown);
-    for (int i = 0; i < 7; i++) {
-        if (WM_IsWindow(hButtonTimerDay[i])) WM_DeleteWindow(hButtonTimerDay[i]);
-    }
-    if (WM_IsWindow(hButtonTimerBuzzer)) WM_DeleteWindow(hButtonTimerBuzzer);
-    if (WM_IsWindow(hButtonTimerScene)) WM_DeleteWindow(hButtonTimerScene);
-    if (WM_IsWindow(hButtonTimerSceneSelect)) WM_DeleteWindow(hButtonTimerSceneSelect);
-    if (WM_IsWindow(hButtonTimerSave)) WM_DeleteWindow(hButtonTimerSave);
-    if (WM_IsWindow(hButtonTimerCancel)) WM_DeleteWindow(hButtonTimerCancel);
-
-    // Zajednički dugmići
-    if (WM_IsWindow(hBUTTON_Ok)) WM_DeleteWindow(hBUTTON_Ok);
-    if (WM_IsWindow(hBUTTON_Next)) WM_DeleteWindow(hBUTTON_Next);
-    if (WM_IsWindow(hBUTTON_SET_DEFAULTS)) WM_DeleteWindow(hBUTTON_SET_DEFAULTS);
-    if (WM_IsWindow(hBUTTON_SYSRESTART)) WM_DeleteWindow(hBUTTON_SYSRESTART);
-
-    // Ostali widgeti
-    if (WM_IsWindow(hThstControl)) WM_DeleteWindow(hThstControl);
-    if (WM_IsWindow(hFanControl)) WM_DeleteWindow(hFanControl);
-    if (WM_IsWindow(hThstMaxSetPoint)) WM_DeleteWindow(hThstMaxSetPoint);
-    if (WM_IsWindow(hThstMinSetPoint)) WM_DeleteWindow(hThstMinSetPoint);
-    if (WM_IsWindow(hFanDiff)) WM_DeleteWindow(hFanDiff);
-    if (WM_IsWindow(hFanLowBand)) WM_DeleteWindow(hFanLowBand);
-    if (WM_IsWindow(hFanHiBand)) WM_DeleteWindow(hFanHiBand);
-    if (WM_IsWindow(hThstGroup)) WM_DeleteWindow(hThstGroup);
-    if (WM_IsWindow(hThstMaster)) WM_DeleteWindow(hThstMaster);
-    if (WM_IsWindow(hSPNBX_DisplayHighBrightness)) WM_DeleteWindow(hSPNBX_DisplayHighBrightness);
-    if (WM_IsWindow(hSPNBX_DisplayLowBrightness)) WM_DeleteWindow(hSPNBX_DisplayLowBrightness);
-    if (WM_IsWindow(hSPNBX_ScrnsvrTimeout)) WM_DeleteWindow(hSPNBX_ScrnsvrTimeout);
-    if (WM_IsWindow(hSPNBX_ScrnsvrEnableHour)) WM_DeleteWindow(hSPNBX_ScrnsvrEnableHour);
-    if (WM_IsWindow(hSPNBX_ScrnsvrDisableHour)) WM_DeleteWindow(hSPNBX_ScrnsvrDisableHour);
-    if (WM_IsWindow(hSPNBX_ScrnsvrClockColour)) WM_DeleteWindow(hSPNBX_ScrnsvrClockColour);
-    if (WM_IsWindow(hCHKBX_ScrnsvrClock)) WM_DeleteWindow(hCHKBX_ScrnsvrClock);
-    if (WM_IsWindow(hDRPDN_WeekDay)) WM_DeleteWindow(hDRPDN_WeekDay);
-    if (WM_IsWindow(hVentilatorRelay)) WM_DeleteWindow(hVentilatorRelay);
-    if (WM_IsWindow(hVentilatorDelayOn)) WM_DeleteWindow(hVentilatorDelayOn);
-    if (WM_IsWindow(hVentilatorDelayOff)) WM_DeleteWindow(hVentilatorDelayOff);
-    if (WM_IsWindow(hVentilatorTriggerSource1)) WM_DeleteWindow(hVentilatorTriggerSource1);
-    if (WM_IsWindow(hVentilatorTriggerSource2)) WM_DeleteWindow(hVentilatorTriggerSource2);
-    if (WM_IsWindow(hVentilatorLocalPin)) WM_DeleteWindow(hVentilatorLocalPin);
-    if (WM_IsWindow(hCurtainsMoveTime)) WM_DeleteWindow(hCurtainsMoveTime);
-    if (WM_IsWindow(hDEV_ID)) WM_DeleteWindow(hDEV_ID);
-    if (WM_IsWindow(hCHKBX_ONLY_LEAVE_SCRNSVR_AFTER_TOUCH)) WM_DeleteWindow(hCHKBX_ONLY_LEAVE_SCRNSVR_AFTER_TOUCH);
-    if (WM_IsWindow(hCHKBX_LIGHT_NIGHT_TIMER)) WM_DeleteWindow(hCHKBX_LIGHT_NIGHT_TIMER);
-    if (WM_IsWindow(hCHKBX_EnableScenes)) WM_DeleteWindow(hCHKBX_EnableScenes);
-    if (WM_IsWindow(hDRPDN_Language)) WM_DeleteWindow(hDRPDN_Language);
-
-    // Zavjese
-    for (int i = 0; i < (CURTAINS_SIZE * 2); i++) {
-        if (WM_IsWindow(hCurtainsRelay[i])) WM_DeleteWindow(hCurtainsRelay[i]);
-    }
-
-    // Svjetla
-    for (int i = 0; i < LIGHTS_MODBUS_SIZE; i++) {
-        if (WM_IsWindow(lightsWidgets[i].relay)) WM_DeleteWindow(lightsWidgets[i].relay);
-        if (WM_IsWindow(lightsWidgets[i].iconID)) WM_DeleteWindow(lightsWidgets[i].iconID);
-        if (WM_IsWindow(lightsWidgets[i].controllerID_on)) WM_DeleteWindow(lightsWidgets[i].controllerID_on);
-        if (WM_IsWindow(lightsWidgets[i].controllerID_on_delay)) WM_DeleteWindow(lightsWidgets[i].controllerID_on_delay);
-        if (WM_IsWindow(lightsWidgets[i].on_hour)) WM_DeleteWindow(lightsWidgets[i].on_hour);
-        if (WM_IsWindow(lightsWidgets[i].on_minute)) WM_DeleteWindow(lightsWidgets[i].on_minute);
-        if (WM_IsWindow(lightsWidgets[i].offTime)) WM_DeleteWindow(lightsWidgets[i].offTime);
-        if (WM_IsWindow(lightsWidgets[i].communication_type)) WM_DeleteWindow(lightsWidgets[i].communication_type);
-        if (WM_IsWindow(lightsWidgets[i].local_pin)) WM_DeleteWindow(lightsWidgets[i].local_pin);
-        if (WM_IsWindow(lightsWidgets[i].sleep_time)) WM_DeleteWindow(lightsWidgets[i].sleep_time);
-        if (WM_IsWindow(lightsWidgets[i].button_external)) WM_DeleteWindow(lightsWidgets[i].button_external);
-        if (WM_IsWindow(lightsWidgets[i].tiedToMainLight)) WM_DeleteWindow(lightsWidgets[i].tiedToMainLight);
-        if (WM_IsWindow(lightsWidgets[i].rememberBrightness)) WM_DeleteWindow(lightsWidgets[i].rememberBrightness);
-    }
-}
 /**
  * @brief       Iscrtava "hamburger" meni ikonu na predefinisanoj poziciji.
  * @author      Gemini (po specifikaciji korisnika)
@@ -3501,27 +3947,13 @@ static void DrawHamburgerMenu(uint8_t position)
 /**
  * @brief Prikazuje datum i vrijeme na ekranu, i upravlja logikom screensavera.
  * @note Ažurira se svake sekunde i odgovorna je za aktivaciju/deaktivaciju
- * screensavera na osnovu postavljenih sati. Ova refaktorirana verzija koristi
- * GUI funkcije LCD_GetXSize() i LCD_GetYSize() za dinamičko određivanje
- * dimenzija ekrana, čime se uklanjaju fiksne numeričke vrijednosti ("magični brojevi")
- * i poboljšava prenosivost koda.
+ * screensavera na osnovu postavljenih sati. Sat crta `ClockFace_Update()`:
+ * samo cifre koje su se promijenile (iz keša znakova) i datum kad se
+ * promijeni, pa se između promjena minute crta najviše dvotačka.
  */
 static void DISPDateTime(void)
 {
-    /**
-     * @brief Konstante za dimenzioniranje područja za brisanje
-     * @note Ove konstante su sada definirane u odnosu na GUI.
-     */
-    const int16_t TIME_CLEAR_RECT_WIDTH = 100;
-    const int16_t TIME_CLEAR_RECT_HEIGHT = 50;
-
-    // Konstante za brisanje screensaver ekrana
-    const int16_t SCREENSAVER_TIME_Y_START = 80;
-    const int16_t SCREENSAVER_TIME_Y_END = 192;
-    const int16_t SCREENSAVER_DATE_Y_START = 220;
-    const int16_t SCREENSAVER_DATE_Y_END = 270;
-
-
+    char tbuf[8];
     char dbuf[64];
     static uint8_t old_day = 0;
 
@@ -3548,7 +3980,7 @@ static void DISPDateTime(void)
     }
 
     if (IsScrnsvrActiv() && IsScrnsvrEnabled() && IsScrnsvrClkActiv()) {
-        if (!IsScrnsvrInitActiv() || (old_day != rtcdt.WeekDay)) {
+        if (!IsScrnsvrInitActiv()) {
             ScrnsvrInitSet();
             GUI_MULTIBUF_BeginEx(0);
             GUI_SelectLayer(0);
@@ -3559,25 +3991,18 @@ static void DISPDateTime(void)
             GUI_SetBkColor(GUI_TRANSPARENT);
             GUI_Clear();
             old_min = 60U;
-            old_day = rtcdt.WeekDay;
             GUI_MULTIBUF_EndEx(1);
+            ClockFace_Invalidate(&clock_face);
         }
 
-        GUI_MULTIBUF_BeginEx(1);
-
-        // POPRAVAK: Brisanje ekrana za screensaver bez magičnih brojeva
-        GUI_ClearRect(0, SCREENSAVER_TIME_Y_START, LCD_GetXSize(), SCREENSAVER_TIME_Y_END);
-        GUI_ClearRect(0, SCREENSAVER_DATE_Y_START, TIME_CLEAR_RECT_WIDTH, SCREENSAVER_DATE_Y_END);
-
-        HEX2STR(dbuf, &rtctm.Hours);
-        if (rtctm.Seconds & 1) dbuf[2] = ':';
-        else dbuf[2] = ' ';
-        HEX2STR(&dbuf[3], &rtctm.Minutes);
-
-        GUI_SetColor(clk_clrs[g_display_settings.scrnsvr_clk_clr]);
-        GUI_SetFont(GUI_FONT_D80);
-        GUI_SetTextAlign(GUI_TA_HCENTER | GUI_TA_VCENTER);
-        GUI_DispStringAt(dbuf, main_screen_layout.time_pos_scrnsvr.x, main_screen_layout.time_pos_scrnsvr.y);
+        HEX2STR(tbuf, &rtctm.Hours);
+#if SCRNSVR_CLK_BLINK
+        if (rtctm.Seconds & 1) tbuf[2] = ':';
+        else tbuf[2] = ' ';
+#else
+        tbuf[2] = ':';
+#endif
+        HEX2STR(&tbuf[3], &rtctm.Minutes);
 
         /**
          * @brief Niz sa TextID-jevima za dane u sedmici.
@@ -3599,12 +4024,9 @@ static void DISPDateTime(void)
                 lng(months[Bcd2Dec(rtcdt.Month) - 1]),
                 Bcd2Dec(rtcdt.Year) + 2000);
 
-        GUI_SetFont(&GUI_FontVerdana32_LAT);
-        GUI_SetTextAlign(GUI_TA_HCENTER | GUI_TA_VCENTER);
-        GUI_DispStringAt(dbuf, main_screen_layout.date_pos_scrnsvr.x, main_screen_layout.date_pos_scrnsvr.y);
-
-        GUI_MULTIBUF_EndEx(1);
-
+        // Crtaju se samo ćelije koje su se promijenile i datum kad se promijeni dan.
+        ClockFace_SetColor(&clock_face, clk_clrs[g_display_settings.scrnsvr_clk_clr]);
+        ClockFace_Update(&clock_face, tbuf, dbuf);
     }
 
     if (old_day != rtcdt.WeekDay) {
@@ -3821,6 +4243,9 @@ static void DSP_InitSet1Scrn(void)
     GUI_DrawHLine(130, 5, 320);
 
     GUI_MULTIBUF_EndEx(1);
+
+    SettingsModel_Bind(&settings_model, SCREEN_SETTINGS_1, settings_screen_1_fields,
+                       sizeof(settings_screen_1_fields) / sizeof(settings_screen_1_fields[0]));
 }
 
 /**
@@ -3830,6 +4255,7 @@ static void DSP_InitSet1Scrn(void)
  */
 static void DSP_KillSet1Scrn(void)
 {
+    SettingsModel_Unbind(&settings_model);
     WM_DeleteWindow(hThstControl);
     WM_DeleteWindow(hFanControl);
     WM_DeleteWindow(hThstMaxSetPoint);
@@ -3987,6 +4413,9 @@ static void DSP_InitSet2Scrn(void)
     GUI_DispString("YEAR");
 
     GUI_MULTIBUF_EndEx(1);
+
+    SettingsModel_Bind(&settings_model, SCREEN_SETTINGS_2, settings_screen_2_fields,
+                       sizeof(settings_screen_2_fields) / sizeof(settings_screen_2_fields[0]));
 }
 /**
  * @brief Briše GUI widgete sa drugog ekrana podešavanja.
@@ -3995,6 +4424,7 @@ static void DSP_InitSet2Scrn(void)
  */
 static void DSP_KillSet2Scrn(void)
 {
+    SettingsModel_Unbind(&settings_model);
     WM_DeleteWindow(hSPNBX_DisplayHighBrightness);
     WM_DeleteWindow(hSPNBX_DisplayLowBrightness);
     WM_DeleteWindow(hSPNBX_ScrnsvrDisableHour);
@@ -4134,6 +4564,9 @@ static void DSP_InitSet3Scrn(void)
     GUI_DrawHLine(settings_screen_3_layout.line_select_control.y, settings_screen_3_layout.line_select_control.x0, settings_screen_3_layout.line_select_control.x1);
 
     GUI_MULTIBUF_EndEx(1);
+
+    SettingsModel_Bind(&settings_model, SCREEN_SETTINGS_3, settings_screen_3_fields,
+                       sizeof(settings_screen_3_fields) / sizeof(settings_screen_3_fields[0]));
 }
 /**
  * @brief Briše GUI widgete sa trećeg ekrana podešavanja.
@@ -4141,6 +4574,7 @@ static void DSP_InitSet3Scrn(void)
  */
 static void DSP_KillSet3Scrn(void)
 {
+    SettingsModel_Unbind(&settings_model);
     WM_DeleteWindow(defroster_settingWidgets.cycleTime);
     WM_DeleteWindow(defroster_settingWidgets.activeTime);
     WM_DeleteWindow(defroster_settingWidgets.pin);
@@ -4958,6 +5392,11 @@ static void DSP_InitSet9Scrn(void)
     CHECKBOX_SetText(hCHKBX_EnableSecurity, "Enable Security Module");
     CHECKBOX_SetState(hCHKBX_EnableSecurity, g_display_settings.security_module_enabled);
 
+    hCHKBX_RemoteView = CHECKBOX_CreateEx(col1_x, y_current + 24, 180, 20, 0, WM_CF_SHOW, 0, ID_REMOTE_VIEW);
+    CHECKBOX_SetTextColor(hCHKBX_RemoteView, GUI_GREEN);
+    CHECKBOX_SetText(hCHKBX_RemoteView, "Allow Remote View");
+    CHECKBOX_SetState(hCHKBX_RemoteView, remote_view_allowed);
+
     SPINBOX_Handle hPulse = SPINBOX_CreateEx(col2_x, y_current, spin_w, spin_h, 0, WM_CF_SHOW, ID_ALARM_PULSE_LENGTH, 0, 50);
     SPINBOX_SetEdge(hPulse, SPINBOX_EDGE_CENTER);
     SPINBOX_SetValue(hPulse, Security_GetPulseDuration() / 100);
@@ -4987,18 +5426,22 @@ static void DSP_KillSet9Scrn(void)
 {
     // Brisanje svih widgeta kreiranih u DSP_InitSet9Scrn
     for(int i = 0; i < SECURITY_PARTITION_COUNT; i++) {
-        WM_DeleteWindow(WM_GetDialogItem(WM_GetDesktopWindow(), ID_ALARM_RELAY_P1 + i));
-        WM_DeleteWindow(WM_GetDialogItem(WM_GetDesktopWindow(), ID_ALARM_FB_P1 + i));
+        WM_DeleteWindow(Widget_Find(ID_ALARM_RELAY_P1 + i));
+        WM_DeleteWindow(Widget_Find(ID_ALARM_FB_P1 + i));
     }
     
-    WM_DeleteWindow(WM_GetDialogItem(WM_GetDesktopWindow(), ID_ALARM_RELAY_SILENT));
-    WM_DeleteWindow(WM_GetDialogItem(WM_GetDesktopWindow(), ID_ALARM_FB_SYSTEM_STATUS));
-    WM_DeleteWindow(WM_GetDialogItem(WM_GetDesktopWindow(), ID_ALARM_PULSE_LENGTH));
+    WM_DeleteWindow(Widget_Find(ID_ALARM_RELAY_SILENT));
+    WM_DeleteWindow(Widget_Find(ID_ALARM_FB_SYSTEM_STATUS));
+    WM_DeleteWindow(Widget_Find(ID_ALARM_PULSE_LENGTH));
     
     if(WM_IsWindow(hCHKBX_EnableSecurity)) {
         WM_DeleteWindow(hCHKBX_EnableSecurity);
         hCHKBX_EnableSecurity = 0;
     }
+    if(WM_IsWindow(hCHKBX_RemoteView)) {
+        WM_DeleteWindow(hCHKBX_RemoteView);
+        hCHKBX_RemoteView = 0;
+    }
 
     WM_DeleteWindow(hBUTTON_Next);
     WM_DeleteWindow(hBUTTON_Ok);
@@ -5360,7 +5803,7 @@ static void DSP_InitSceneEditScreen(void)
         GUI_DispStringAt("Izgled i Naziv Scene:", 10, 10);
 
         const GUI_BITMAP* icon_to_draw = scene_icon_images[appearance->icon_id - ICON_SCENE_WIZZARD];
-        GUI_DrawBitmap(icon_to_draw, 15, 40);
+        DrawIcon(icon_to_draw, 15, 40);
 
         GUI_SetFont(&GUI_FontVerdana32_LAT);
         GUI_SetColor(GUI_ORANGE);
@@ -5386,7 +5829,7 @@ static void DSP_InitSceneEditScreen(void)
         if (scene_icon_index >= 0 && scene_icon_index < (sizeof(scene_icon_images) / sizeof(scene_icon_images[0])))
         {
             const GUI_BITMAP* icon_to_draw = scene_icon_images[scene_icon_index];
-            GUI_DrawBitmap(icon_to_draw, 15, 40);
+            DrawIcon(icon_to_draw, 15, 40);
         }
 
         GUI_SetFont(&GUI_FontVerdana32_LAT);
@@ -5480,7 +5923,7 @@ static void DSP_InitSceneAppearanceScreen(void)
                 if (scene_icon_index >= 0 && scene_icon_index < (sizeof(scene_icon_images) / sizeof(scene_icon_images[0])))
                 {
                     const GUI_BITMAP* icon_to_draw = scene_icon_images[scene_icon_index];
-                    GUI_DrawBitmap(icon_to_draw, x_center - (icon_to_draw->XSize / 2), y_center - (icon_to_draw->YSize / 2));
+                    DrawIcon(icon_to_draw, x_center - (icon_to_draw->XSize / 2), y_center - (icon_to_draw->YSize / 2));
                 }
 
                 GUI_SetFont(&GUI_FontVerdana16_LAT);
@@ -5541,7 +5984,7 @@ static void DSP_InitSceneAppearanceScreen(void)
             if (scene_icon_index >= 0 && scene_icon_index < (sizeof(scene_icon_images) / sizeof(scene_icon_images[0])))
             {
                 const GUI_BITMAP* icon_to_draw = scene_icon_images[scene_icon_index];
-                GUI_DrawBitmap(icon_to_draw, x_center - (icon_to_draw->XSize / 2), y_center - (icon_to_draw->YSize / 2));
+                DrawIcon(icon_to_draw, x_center - (icon_to_draw->XSize / 2), y_center - (icon_to_draw->YSize / 2));
             }
             GUI_SetFont(&GUI_FontVerdana16_LAT);
             GUI_SetColor(GUI_ORANGE);
@@ -5552,7 +5995,7 @@ static void DSP_InitSceneAppearanceScreen(void)
             const GUI_BITMAP* iconNext = &bmnext;
             int x_pos = select_screen2_drawing_layout.next_button_x_pos;
             int y_pos = select_screen2_drawing_layout.next_button_y_center - (iconNext->YSize / 2);
-            GUI_DrawBitmap(iconNext, x_pos, y_pos);
+            DrawIcon(iconNext, x_pos, y_pos);
         }
     }
 
@@ -5980,7 +6423,11 @@ static void DSP_KillGateScreen(void)
  */
 static void Handle_PeriodicEvents(void)
 {
-    
+    // Novi QR kod (QR_Code_Set iz prekida) se kodira jednom, ovdje.
+    for (uint8_t i = 0; i < QR_CODE_COUNT; i++) {
+        QrCache_Update(&qr_cache, i, (const char*)qr_codes[i]);
+    }
+
     if (scene_press_timer_start != 0 && (HAL_GetTick() - scene_press_timer_start) > LONG_PRESS_DURATION)
     {
         uint8_t configured_scenes_count = Scene_GetCount();
@@ -6066,16 +6513,6 @@ static void Handle_PeriodicEvents(void)
         }
         return; // Prekini dalje izvršavanje u ovoj funkciji
     }
-    // === "FAIL-SAFE" SKENER ZA DUHOVE (Ovaj dio ostaje nepromijenjen) ===
-    static uint32_t ghost_widget_scan_timer = 0;
-    if ((HAL_GetTick() - ghost_widget_scan_timer) >= GHOST_WIDGET_SCAN_INTERVAL) {
-        ghost_widget_scan_timer = HAL_GetTick();
-        // Ažurirano da koristi novi `SCREEN_SELECT_LAST`
-        if (screen == SCREEN_MAIN || screen == SCREEN_SELECT_1 || screen == SCREEN_SELECT_LAST) {
-            ForceKillAllSettingsWidgets();
-        }
-    }
-
     // === TAJMER ZA AUTOMATSKO PALJENJE SVJETALA (SVAKE MINUTE) ===
     if (IsRtcTimeValid() && (HAL_GetTick() - everyMinuteTimerStart) >= (60 * 1000)) {
         everyMinuteTimerStart = HAL_GetTick();
@@ -6212,6 +6649,8 @@ static void Handle_PeriodicEvents(void)
             refresh_tmr = 0;
             if (!IsScrnsvrActiv()) MVUpdateSet();
         }
+        // Keš znakova sata ne treba van screensaver-a.
+        if (!IsScrnsvrActiv() && (clock_face.glyph_bytes != 0U)) ClockFace_Release(&clock_face);
         // Poziv za iscrtavanje sata (logika će biti dorađena kako smo diskutovali)
         if (screen < SCREEN_SELECT_1) DISPDateTime();
     }
@@ -6426,8 +6865,8 @@ static void HandleTouchReleaseEvent(GUI_PID_STATE * pTS)
                     if (presumed_next_state != current_state) {
                         // 1. Odmah ažuriraj stanje u RAM-u radi trenutnog vizuelnog odziva.
                         Gate_SetState(handle, presumed_next_state);
-                        // 2. Zatraži ponovno iscrtavanje ekrana da se prikaže nova ikonica/stanje.
-                        shouldDrawScreen = 1;
+                        // 2. Zatraži ponovno iscrtavanje pločice da se prikaže nova ikonica/stanje.
+                        DISP_InvalidateGate((uint8_t)gate_pressed_index);
                     }
                 }
             }
@@ -6890,12 +7329,7 @@ static void HandlePress_LightsScreen(GUI_PID_STATE * pTS, uint8_t *click_flag)
 
     // Prolazimo kroz redove ikonica...
     for(uint8_t row = 0; row < LIGHTS_Rows_getCount(); ++row) {
-        uint8_t lightsInRow = LIGHTS_getCount();
-        if(LIGHTS_getCount() > 3) {
-            if(LIGHTS_getCount() == 4) lightsInRow = 2;
-            else if(LIGHTS_getCount() == 5) lightsInRow = (row > 0) ? 2 : 3;
-            else lightsInRow = 3;
-        }
+        uint8_t lightsInRow = LightsScreen_GetLightsInRow(row);
         uint8_t currentLightsMenuSpaceBetween = (400 - (80 * lightsInRow)) / (lightsInRow - 1 + 2);
 
         // ...i kroz ikonice u trenutnom redu.
@@ -7670,9 +8104,6 @@ static void HandlePress_TimerScreen(GUI_PID_STATE * pTS, uint8_t *click_flag)
  *****************************************************************************/
 static void DSP_InitNumpadScreen(void)
 {
-    // Sigurnosno brisanje eventualno zaostalih widgeta sa drugih ekrana.
-    ForceKillAllSettingsWidgets();
-
     GUI_MULTIBUF_BeginEx(1);
     GUI_Clear();
     DrawHamburgerMenu(1);
@@ -7712,17 +8143,22 @@ static void DSP_InitNumpadScreen(void)
     key_texts[10] = "0";
     key_texts[11] = g_numpad_context.allow_minus_one ? (char*)lng(TXT_OFF_SHORT) : (char*)lng(TXT_OK);
 
-    // Kreiranje dugmadi u petlji
+    // Dugmad se prave samo pri prvom prikazu; numpad je trajan ekran, pa
+    // pri svakom sljedećem ostaju u njegovom stablu i mijenja im se tekst.
     for (int i = 0; i < 12; i++) {
         int row = i / 3;
         int col = i % 3;
         int x_pos = x_start + col * (btn_w + x_gap);
         int y_pos = y_keypad_start + row * (btn_h + y_gap);
 
-        hKeypadButtons[i] = BUTTON_CreateEx(x_pos, y_pos, btn_w, btn_h, 0, WM_CF_SHOW, 0, key_ids[i]);
+        if (!WM_IsWindow(hKeypadButtons[i])) {
+            hKeypadButtons[i] = BUTTON_CreateEx(x_pos, y_pos, btn_w, btn_h, 0, WM_CF_SHOW, 0, key_ids[i]);
+            BUTTON_SetFont(hKeypadButtons[i], &GUI_FontVerdana20_LAT);
+        }
         BUTTON_SetText(hKeypadButtons[i], key_texts[i]);
-        BUTTON_SetFont(hKeypadButtons[i], &GUI_FontVerdana20_LAT);
+        WM_InvalidateWindow(hKeypadButtons[i]); // GUI_Clear je obrisao i postojeću dugmad
     }
+    WidgetTree_Sync();
 
     // Inicijalizacija i iscrtavanje početnog stanja
     pin_buffer_idx = 0;
@@ -7923,21 +8359,17 @@ static void Service_NumpadScreen(void)
     }
 }
 /******************************************************************************
- * @brief       Uništava sve GUI widgete kreirane za Numpad.
+ * @brief       Sakriva GUI widgete Numpad-a.
  * @author      Gemini (po specifikaciji korisnika)
  * @note        Adaptirana `DSP_KillPinpadScreen` funkcija. Poziva se prilikom
- * napuštanja `SCREEN_NUMPAD` ekrana kako bi se oslobodili resursi.
+ * napuštanja `SCREEN_NUMPAD` ekrana. Dugmad se ne brišu: stablo trajnog
+ * ekrana se samo sakrije i pri sljedećem prikazu ponovo koristi.
  * @param       None
  * @retval      None
  *****************************************************************************/
 static void DSP_KillNumpadScreen(void)
 {
-    for (int i = 0; i < 12; i++) {
-        if (WM_IsWindow(hKeypadButtons[i])) {
-            WM_DeleteWindow(hKeypadButtons[i]);
-            hKeypadButtons[i] = 0;
-        }
-    }
+    GuiTree_Hide(&widget_trees, SCREEN_NUMPAD);
 }
 
 /******************************************************************************
@@ -8052,9 +8484,6 @@ static void Display_ShowNumpad(const NumpadContext_t* context)
  *****************************************************************************/
 static void DSP_InitKeyboardScreen(void)
 {
-    // Sigurnosno brisanje widgeta sa prethodnih ekrana
-    ForceKillAllSettingsWidgets();
-
     GUI_MULTIBUF_BeginEx(1);
     GUI_Clear();
 
@@ -8074,40 +8503,54 @@ static void DSP_InitKeyboardScreen(void)
         layout = key_layouts[ENG][keyboard_shift_active];
     }
 
-    // === 3. Dinamičko kreiranje tastera sa karakterima ===
+    // === 3. Tasteri sa karakterima ===
+    // Tastatura je trajan ekran: taster se pravi samo ako još ne postoji, a
+    // promjena jezika ili shift-a samo mijenja tekst. Pozicija bez tastera u
+    // trenutnom rasporedu (kraći redovi) sakriva postojeći taster.
     for (int row = 0; row < KEY_ROWS; row++) {
         for (int col = 0; col < KEYS_PER_ROW; col++) {
-            // Preskoči ako za neku poziciju nije definisan taster (za kraće redove)
-            if (layout[row][col] == NULL || strlen(layout[row][col]) == 0) continue;
-
             int x_pos = x_start + col * (key_w + x_gap);
             int y_pos = y_start_keys + row * (key_h + y_gap);
             int index = row * KEYS_PER_ROW + col;
 
-            hKeyboardButtons[index] = BUTTON_CreateEx(x_pos, y_pos, key_w, key_h, 0, WM_CF_SHOW, 0, GUI_ID_USER + index);
+            if (layout[row][col] == NULL || strlen(layout[row][col]) == 0) {
+                if (WM_IsWindow(hKeyboardButtons[index])) WM_HideWindow(hKeyboardButtons[index]);
+                continue;
+            }
+
+            if (!WM_IsWindow(hKeyboardButtons[index])) {
+                hKeyboardButtons[index] = BUTTON_CreateEx(x_pos, y_pos, key_w, key_h, 0, WM_CF_SHOW, 0, GUI_ID_USER + index);
+                BUTTON_SetFont(hKeyboardButtons[index], &GUI_Font20_1);
+            }
             BUTTON_SetText(hKeyboardButtons[index], layout[row][col]);
-            BUTTON_SetFont(hKeyboardButtons[index], &GUI_Font20_1);
+            WM_ShowWindow(hKeyboardButtons[index]);
+            WM_InvalidateWindow(hKeyboardButtons[index]); // GUI_Clear je obrisao i postojeće tastere
         }
     }
 
-    // === 4. Kreiranje specijalnih tastera (Shift, Space, OK, itd.) ===
+    // === 4. Specijalni tasteri (Shift, Space, OK, itd.), samo pri prvom prikazu ===
     const int16_t y_special_row = y_start_keys + KEY_ROWS * (key_h + y_gap);
 
-    // SHIFT taster
-    hKeyboardSpecialButtons[0] = BUTTON_CreateEx(x_start, y_special_row, 60, key_h, 0, WM_CF_SHOW, 0, GUI_ID_SHIFT);
-    BUTTON_SetText(hKeyboardSpecialButtons[0], "Shift");
+    if (!WM_IsWindow(hKeyboardSpecialButtons[0])) {
+        // SHIFT taster
+        hKeyboardSpecialButtons[0] = BUTTON_CreateEx(x_start, y_special_row, 60, key_h, 0, WM_CF_SHOW, 0, GUI_ID_SHIFT);
+        BUTTON_SetText(hKeyboardSpecialButtons[0], "Shift");
 
-    // SPACE taster
-    hKeyboardSpecialButtons[1] = BUTTON_CreateEx(x_start + 60 + x_gap, y_special_row, 240, key_h, 0, WM_CF_SHOW, 0, GUI_ID_SPACE);
-    BUTTON_SetText(hKeyboardSpecialButtons[1], "Space");
+        // SPACE taster
+        hKeyboardSpecialButtons[1] = BUTTON_CreateEx(x_start + 60 + x_gap, y_special_row, 240, key_h, 0, WM_CF_SHOW, 0, GUI_ID_SPACE);
+        BUTTON_SetText(hKeyboardSpecialButtons[1], "Space");
 
-    // BACKSPACE taster
-    hKeyboardSpecialButtons[2] = BUTTON_CreateEx(x_start + 300 + 2*x_gap, y_special_row, 60, key_h, 0, WM_CF_SHOW, 0, GUI_ID_BACKSPACE);
-    BUTTON_SetText(hKeyboardSpecialButtons[2], "Del");
+        // BACKSPACE taster
+        hKeyboardSpecialButtons[2] = BUTTON_CreateEx(x_start + 300 + 2*x_gap, y_special_row, 60, key_h, 0, WM_CF_SHOW, 0, GUI_ID_BACKSPACE);
+        BUTTON_SetText(hKeyboardSpecialButtons[2], "Del");
 
-    // OK taster
-    hKeyboardSpecialButtons[3] = BUTTON_CreateEx(x_start + 360 + 3*x_gap, y_special_row, 60, key_h, 0, WM_CF_SHOW, 0, GUI_ID_OKAY);
-    BUTTON_SetText(hKeyboardSpecialButtons[3], "OK");
+        // OK taster
+        hKeyboardSpecialButtons[3] = BUTTON_CreateEx(x_start + 360 + 3*x_gap, y_special_row, 60, key_h, 0, WM_CF_SHOW, 0, GUI_ID_OKAY);
+        BUTTON_SetText(hKeyboardSpecialButtons[3], "OK");
+    } else {
+        for (int i = 0; i < 4; i++) WM_InvalidateWindow(hKeyboardSpecialButtons[i]);
+    }
+    WidgetTree_Sync();
 
     // === 5. Inicijalizacija bafera i iscrtavanje polja za unos ===
     memset(keyboard_buffer, 0, sizeof(keyboard_buffer));
@@ -8187,7 +8630,6 @@ static void Service_KeyboardScreen(void)
             switch(Id) {
             case GUI_ID_SHIFT:
                 keyboard_shift_active = !keyboard_shift_active;
-                DSP_KillKeyboardScreen();
                 DSP_InitKeyboardScreen();
                 return;
 
@@ -8252,29 +8694,18 @@ static void Service_KeyboardScreen(void)
 
 /**
  ******************************************************************************
- * @brief       Uništava sve GUI widgete kreirane za alfanumeričku tastaturu.
+ * @brief       Sakriva GUI widgete alfanumeričke tastature.
  * @author      Gemini (po specifikaciji korisnika)
  * @note        Poziva se prilikom napuštanja `SCREEN_KEYBOARD_ALPHA` ekrana.
+ * Tasteri se ne brišu: stablo trajnog ekrana se samo sakrije i pri
+ * sljedećem prikazu ponovo koristi.
  * @param       None
  * @retval      None
  ******************************************************************************
  */
 static void DSP_KillKeyboardScreen(void)
 {
-    // Brisanje tastera sa karakterima
-    for (int i = 0; i < (KEY_ROWS * KEYS_PER_ROW); i++) {
-        if (WM_IsWindow(hKeyboardButtons[i])) {
-            WM_DeleteWindow(hKeyboardButtons[i]);
-            hKeyboardButtons[i] = 0;
-        }
-    }
-    // Brisanje specijalnih tastera
-    for (int i = 0; i < 5; i++) {
-        if (WM_IsWindow(hKeyboardSpecialButtons[i])) {
-            WM_DeleteWindow(hKeyboardSpecialButtons[i]);
-            hKeyboardSpecialButtons[i] = 0;
-        }
-    }
+    GuiTree_Hide(&widget_trees, SCREEN_KEYBOARD_ALPHA);
 }
 /**
  ******************************************************************************
@@ -8406,7 +8837,7 @@ static void Service_MainScreen(void)
         // 1. Provjera i iscrtavanje ikonice alarma
         if (current_timer_active_state)
         {
-            GUI_DrawBitmap(&bmicons_alarm_20, x_icon_pos, y_icon_pos);
+            DrawIcon(&bmicons_alarm_20, x_icon_pos, y_icon_pos);
             x_icon_pos += 30; // Pomjeri "kursor" ulijevo za sljedeću ikonicu
         }
 
@@ -8420,7 +8851,7 @@ static void Service_MainScreen(void)
 
         if (thermostat_icon_to_draw != NULL)
         {
-            GUI_DrawBitmap(thermostat_icon_to_draw, x_icon_pos, y_icon_pos);
+            DrawIcon(thermostat_icon_to_draw, x_icon_pos, y_icon_pos);
             // Ovdje ne moramo pomjerati kursor jer je ovo posljednja ikonica u nizu
         }
 
@@ -8531,7 +8962,7 @@ static void Service_SelectScreen1(void)
             const DynamicMenuItem* item = &active_modules[0];
             int x_pos = (DRAWING_AREA_WIDTH / 2) - (item->icon->XSize / 2);
             int y_pos = (LCD_GetYSize() / 2) - (item->icon->YSize / 2) - 10;
-            GUI_DrawBitmap(item->icon, x_pos, y_pos);
+            DrawIcon(item->icon, x_pos, y_pos);
 
             // =======================================================================
             // === IZMJENA FONT-a ===
@@ -8554,7 +8985,7 @@ static void Service_SelectScreen1(void)
                 int x_center = (DRAWING_AREA_WIDTH / 4) * (i == 0 ? 1 : 3);
                 int x_pos = x_center - (item->icon->XSize / 2);
                 int y_pos = (LCD_GetYSize() / 2) - (item->icon->YSize / 2) - 10;
-                GUI_DrawBitmap(item->icon, x_pos, y_pos);
+                DrawIcon(item->icon, x_pos, y_pos);
 
                 // =======================================================================
                 // === IZMJENA FONT-a ===
@@ -8579,7 +9010,7 @@ static void Service_SelectScreen1(void)
                 int x_center = (DRAWING_AREA_WIDTH / 6) * (1 + 2 * i);
                 int x_pos = x_center - (item->icon->XSize / 2);
                 int y_pos = (LCD_GetYSize() / 2) - (item->icon->YSize / 2) - 10;
-                GUI_DrawBitmap(item->icon, x_pos, y_pos);
+                DrawIcon(item->icon, x_pos, y_pos);
 
                 // =======================================================================
                 // === IZMJENA FONT-a ===
@@ -8606,7 +9037,7 @@ static void Service_SelectScreen1(void)
                 int y_center = (LCD_GetYSize() / 4) * (i < 2 ? 1 : 3);
                 int x_pos = x_center - (item->icon->XSize / 2);
                 int y_pos = y_center - (item->icon->YSize / 2) - 10;
-                GUI_DrawBitmap(item->icon, x_pos, y_pos);
+                DrawIcon(item->icon, x_pos, y_pos);
 
                 // =======================================================================
                 // === IZMJENA FONT-a ===
@@ -8628,7 +9059,7 @@ static void Service_SelectScreen1(void)
             /**
             * @brief Iscrtavanje "NEXT" dugmeta.
             */
-            GUI_DrawBitmap(iconNext, select_screen1_drawing_layout.x_separator_pos + 5, select_screen1_drawing_layout.y_next_button_center - (iconNext->YSize / 2));
+            DrawIcon(iconNext, select_screen1_drawing_layout.x_separator_pos + 5, select_screen1_drawing_layout.y_next_button_center - (iconNext->YSize / 2));
         }
         GUI_MULTIBUF_EndEx(1);
     }
@@ -8756,7 +9187,7 @@ static void Service_SelectScreen2(void)
                 const DynamicMenuItem* item = &active_modules[0];
                 int x_pos = (DRAWING_AREA_WIDTH / 2) - (item->icon->XSize / 2);
                 int y_pos = (LCD_GetYSize() / 2) - (item->icon->YSize / 2) - 10;
-                GUI_DrawBitmap(item->icon, x_pos, y_pos);
+                DrawIcon(item->icon, x_pos, y_pos);
                 GUI_SetFont(&GUI_FontVerdana32_LAT);
                 GUI_SetColor(GUI_ORANGE);
                 GUI_SetTextMode(GUI_TM_TRANS);
@@ -8772,7 +9203,7 @@ static void Service_SelectScreen2(void)
                     int x_center = (DRAWING_AREA_WIDTH / 4) * (i == 0 ? 1 : 3);
                     int x_pos = x_center - (item->icon->XSize / 2);
                     int y_pos = (LCD_GetYSize() / 2) - (item->icon->YSize / 2) - 10;
-                    GUI_DrawBitmap(item->icon, x_pos, y_pos);
+                    DrawIcon(item->icon, x_pos, y_pos);
                     GUI_SetFont(&GUI_FontVerdana20_LAT);
                     GUI_SetColor(GUI_ORANGE);
                     GUI_SetTextMode(GUI_TM_TRANS);
@@ -8791,7 +9222,7 @@ static void Service_SelectScreen2(void)
                     int x_center = (DRAWING_AREA_WIDTH / 6) * (1 + 2 * i);
                     int x_pos = x_center - (item->icon->XSize / 2);
                     int y_pos = (LCD_GetYSize() / 2) - (item->icon->YSize / 2) - 10;
-                    GUI_DrawBitmap(item->icon, x_pos, y_pos);
+                    DrawIcon(item->icon, x_pos, y_pos);
                     GUI_SetFont(&GUI_FontVerdana20_LAT);
                     GUI_SetColor(GUI_ORANGE);
                     GUI_SetTextMode(GUI_TM_TRANS);
@@ -8812,7 +9243,7 @@ static void Service_SelectScreen2(void)
                     int y_center = (LCD_GetYSize() / 4) * (i < 2 ? 1 : 3);
                     int x_pos = x_center - (item->icon->XSize / 2);
                     int y_pos = y_center - (item->icon->YSize / 2) - 10;
-                    GUI_DrawBitmap(item->icon, x_pos, y_pos);
+                    DrawIcon(item->icon, x_pos, y_pos);
                     GUI_SetFont(&GUI_FontVerdana20_LAT);
                     GUI_SetColor(GUI_ORANGE);
                     GUI_SetTextMode(GUI_TM_TRANS);
@@ -8824,7 +9255,7 @@ static void Service_SelectScreen2(void)
         }
 
         const GUI_BITMAP* iconNext = &bmnext;
-        GUI_DrawBitmap(iconNext, select_screen1_drawing_layout.x_separator_pos + 5, select_screen1_drawing_layout.y_next_button_center - (iconNext->YSize / 2));
+        DrawIcon(iconNext, select_screen1_drawing_layout.x_separator_pos + 5, select_screen1_drawing_layout.y_next_button_center - (iconNext->YSize / 2));
         
         GUI_MULTIBUF_EndEx(1);
     }
@@ -8864,7 +9295,7 @@ static void Service_SelectScreenLast(void)
         for (int i = 0; i < 4; i++) {
             int x_pos = x_centers[i] - (icons[i]->XSize / 2);
             int y_pos = y_centers[i] - (icons[i]->YSize / 2) - select_screen2_drawing_layout.text_vertical_offset;
-            GUI_DrawBitmap(icons[i], x_pos, y_pos);
+            DrawIcon(icons[i], x_pos, y_pos);
 
             // =======================================================================
             // === IZMJENA FONT-a ===
@@ -8880,7 +9311,7 @@ static void Service_SelectScreenLast(void)
         const GUI_BITMAP* iconNext = &bmnext;
         int x_pos = select_screen2_drawing_layout.next_button_x_pos;
         int y_pos = select_screen2_drawing_layout.next_button_y_center - (iconNext->YSize / 2);
-        GUI_DrawBitmap(iconNext, x_pos, y_pos);
+        DrawIcon(iconNext, x_pos, y_pos);
 
         GUI_MULTIBUF_EndEx(1);
     }
@@ -9002,20 +9433,12 @@ static void Service_ThermostatScreen(void)
 
             GUI_MULTIBUF_BeginEx(0);
             GUI_SelectLayer(0);
-            GUI_SetColor(GUI_BLACK);
-            GUI_Clear();
-            // Iscrtavanje pozadinske bitmap slike termostata.
-            GUI_BMP_Draw(&thstat, 0, 0);
-            GUI_ClearRect(380, 0, 480, 100);
-            // Iscrtavanje hamburger meni ikonice u gornjem desnom uglu.
-            DrawHamburgerMenu(1);
-
-            // Čišćenje specifičnih dijelova ekrana za dinamičke vrijednosti.
-            GUI_ClearRect(350, 80, 480, 180);
-            GUI_ClearRect(310, 180, 420, 205);
+            // Pozadina se dekodira iz BMP-a samo kad statički sloj zastari.
+            StaticLayer_Draw(SCREEN_THERMOSTAT, ThermostatScreen_DrawStatic, NULL);
             GUI_MULTIBUF_EndEx(0);
 
             // Prebacivanje na drugi sloj za dinamičke elemente.
+            uint32_t start = StaticLayer_Now();
             GUI_SelectLayer(1);
             GUI_SetBkColor(GUI_TRANSPARENT);
             GUI_Clear();
@@ -9024,6 +9447,7 @@ static void Service_ThermostatScreen(void)
             DISPSetPoint();
             // Prikaz trenutnog vremena i datuma.
             DISPDateTime();
+            GuiStatic_Record(&static_layers, SCREEN_THERMOSTAT, GUI_STATIC_TIME_DYNAMIC, StaticLayer_Us(start));
             // Postavi flag da treba ažurirati trenutnu temperaturu.
             MVUpdateSet();
             menu_lc = 0;
@@ -9134,9 +9558,6 @@ static void Service_ThermostatScreen(void)
  */
 static void Service_ReturnToFirst(void)
 {
-    // === "FAIL-SAFE" MEHANIZAM ===
-    ForceKillAllSettingsWidgets();
-
     // Očisti oba grafička sloja.
     GUI_SelectLayer(0);
     GUI_Clear();
@@ -9147,8 +9568,10 @@ static void Service_ReturnToFirst(void)
     // NOVO: Svjetlina se ne mijenja automatski pri povratku na početni ekran.
     // DISPSetBrightnes(DISP_BRGHT_MIN); // Ova linija je uklonjena.
 
-    // Postavi aktivni ekran na glavni meni.
+    // Postavi aktivni ekran na glavni meni; stablo prethodnog ekrana se
+    // odmah briše zajedno sa widgetima koje njegov `Kill` nije obrisao.
     screen = SCREEN_MAIN;
+    WidgetTree_Sync();
 
     // Resetovanje svih flagova i brojača.
     thermostatMenuState = 0;
@@ -9221,7 +9644,7 @@ static void Service_SceneScreen(void)
             if (scene_icon_index >= 0 && scene_icon_index < (sizeof(scene_icon_images) / sizeof(scene_icon_images[0])))
             {
                 const GUI_BITMAP* icon_to_draw = scene_icon_images[scene_icon_index];
-                GUI_DrawBitmap(icon_to_draw, x_center - (icon_to_draw->XSize / 2), y_center - (icon_to_draw->YSize / 2));
+                DrawIcon(icon_to_draw, x_center - (icon_to_draw->XSize / 2), y_center - (icon_to_draw->YSize / 2));
             }
 
             GUI_SetFont(&GUI_FontVerdana16_LAT);
@@ -9238,7 +9661,7 @@ static void Service_SceneScreen(void)
             // Koristimo koordinate konzistentne sa "Next" dugmetom
             int x_pos = select_screen2_drawing_layout.next_button_x_pos;
             int y_pos = select_screen2_drawing_layout.next_button_y_center - (wizard_icon->YSize / 2);
-            GUI_DrawBitmap(wizard_icon, x_pos, y_pos);
+            DrawIcon(wizard_icon, x_pos, y_pos);
 
             // === DODATA LINIJA KODA ZA ISPIS TEKSTA ===
             GUI_SetFont(&GUI_FontVerdana16_LAT);
@@ -9277,39 +9700,8 @@ static void Service_SceneEditLightsScreen(void)
         BUTTON_SetBitmap(hButtonWizNext, BUTTON_CI_PRESSED, &bmnext);
 
         // Kompletan, neizmijenjen kod za iscrtavanje ikonica svjetala
-        const GUI_FONT* fontToUse = &GUI_FontVerdana20_LAT;
-        const int text_padding = 10;
-        bool downgrade_font = false;
-        for(uint8_t i = 0; i < LIGHTS_getCount(); ++i)
-        {
-            uint8_t lights_total = LIGHTS_getCount();
-            uint8_t lights_in_this_row = 0;
-            if (lights_total <= 3) lights_in_this_row = lights_total;
-            else if (lights_total == 4) lights_in_this_row = 2;
-            else if (lights_total == 5) lights_in_this_row = 3;
-            else lights_in_this_row = 3;
-
-            int max_width_per_icon = (DRAWING_AREA_WIDTH / lights_in_this_row) - text_padding;
-
-            LIGHT_Handle* handle = LIGHTS_GetInstance(i);
-            if (handle) {
-                uint16_t selection_index = LIGHT_GetIconID(handle);
-                if (selection_index < (sizeof(icon_mapping_table) / sizeof(IconMapping_t)))
-                {
-                    const IconMapping_t* mapping = &icon_mapping_table[selection_index];
-                    GUI_SetFont(&GUI_FontVerdana20_LAT);
-
-                    if (GUI_GetStringDistX(lng(mapping->primary_text_id)) > max_width_per_icon || GUI_GetStringDistX(lng(mapping->secondary_text_id)) > max_width_per_icon)
-                    {
-                        downgrade_font = true;
-                        break;
-                    }
-                }
-            }
-        }
-        if (downgrade_font) {
-            fontToUse = &GUI_FontVerdana16_LAT;
-        }
+        const uint8_t label_font = LightsScreen_ChooseFont();
+        const GUI_FONT* fontToUse = label_fonts[label_font];
         int y_row_start = (LIGHTS_Rows_getCount() > 1) ? 10 : 86;
         const int y_row_height = 130;
         uint8_t lightsInRowSum = 0;
@@ -9347,12 +9739,12 @@ static void Service_SceneEditLightsScreen(void)
                         GUI_SetTextMode(GUI_TM_TRANS);
                         GUI_SetTextAlign(GUI_TA_HCENTER);
                         GUI_SetColor(GUI_WHITE);
-                        GUI_DispStringAt(lng(mapping->primary_text_id), x_text_center, y_primary_text_pos);
-                        GUI_DrawBitmap(icon_to_draw, x_icon_pos, y_icon_pos);
+                        GUI_DispStringAt(Labels_Text(mapping->primary_text_id, label_font), x_text_center, y_primary_text_pos);
+                        DrawIcon(icon_to_draw, x_icon_pos, y_icon_pos);
                         GUI_SetTextMode(GUI_TM_TRANS);
                         GUI_SetTextAlign(GUI_TA_HCENTER);
                         GUI_SetColor(GUI_ORANGE);
-                        GUI_DispStringAt(lng(mapping->secondary_text_id), x_text_center, y_secondary_text_pos);
+                        GUI_DispStringAt(Labels_Text(mapping->secondary_text_id, label_font), x_text_center, y_secondary_text_pos);
                     }
                 }
             }
@@ -9406,123 +9798,1232 @@ static void Service_LightsScreen(void)
     {
         Service_SceneEditLightsScreen();
     }
-    else if(shouldDrawScreen)
+    else if(shouldDrawScreen || !GuiDirty_IsEmpty(&gui_dirty))
     {
+        // `shouldDrawScreen` traži cijeli ekran, inače se crtaju samo pločice
+        // svjetala koje je `DISP_InvalidateLight()` označio kao prljave.
+        if (shouldDrawScreen) GuiDirty_InvalidateAll(&gui_dirty);
         shouldDrawScreen = 0;
 
         GUI_MULTIBUF_BeginEx(1);
-        GUI_Clear();
-        DrawHamburgerMenu(1);
-
-        // =======================================================================
-        // === FAZA 1: PRE-KALKULACIJA I ODABIR FONTA ZA CIJELI EKRAN ===
-        // =======================================================================
-        const GUI_FONT* fontToUse = &GUI_FontVerdana20_LAT; // Početna pretpostavka: koristimo najveći font
-        const int text_padding = 10; // Sigurnosni razmak u pikselima između tekstova susjednih ikonica
-        bool downgrade_font = false;
-
-        // Petlja za PRE-KALKULACIJU (prolazimo kroz sve, ali ne iscrtavamo ništa)
-        for(uint8_t i = 0; i < LIGHTS_getCount(); ++i)
+        for (uint8_t i = 0; i < GuiDirty_Count(&gui_dirty); ++i)
         {
-            // Izračunaj maksimalnu dozvoljenu širinu teksta na osnovu rasporeda
-            uint8_t lights_total = LIGHTS_getCount();
-            uint8_t lights_in_this_row = 0;
-            if (lights_total <= 3) lights_in_this_row = lights_total;
-            else if (lights_total == 4) lights_in_this_row = 2;
-            else if (lights_total == 5) lights_in_this_row = 3; // Pretpostavka za prvi red
-            else lights_in_this_row = 3;
+            GuiRect_t dirty_rect;
+            GUI_RECT area;
+
+            GuiDirty_Get(&gui_dirty, i, &dirty_rect);
+            area.x0 = dirty_rect.x0;
+            area.y0 = dirty_rect.y0;
+            area.x1 = dirty_rect.x1;
+            area.y1 = dirty_rect.y1;
+
+            // Sve izvan `area` odsijeca emWin, pa ostatak ekrana ostaje netaknut.
+            // Pozadina, meni i labele dolaze iz statičkog sloja, ikonice se crtaju preko.
+            GUI_SetClipRect(&area);
+            StaticLayer_Draw(SCREEN_LIGHTS, LightsScreen_DrawStatic, &area);
+            uint32_t start = StaticLayer_Now();
+            DrawLightsScreen(&area, LIGHTS_DRAW_ICONS);
+            GuiStatic_Record(&static_layers, SCREEN_LIGHTS, GUI_STATIC_TIME_DYNAMIC, StaticLayer_Us(start));
+        }
+        GUI_SetClipRect(NULL);
+        GuiDirty_Commit(&gui_dirty);
+        GUI_MULTIBUF_EndEx(1);
+    }
+}
+
+/**
+ ******************************************************************************
+ * @brief       Iscrtava ikonice i labele svjetala koje se sijeku sa zadanim područjem.
+ * @author      Gemini & [Vaše Ime]
+ * @note        Odabir fonta uvijek uzima u obzir SVA svjetla, tako da djelimično
+ * iscrtana pločica ima isti font kao i ostatak ekrana.
+ * @param       area Područje koje se ponovo crta (clip je već postavljen).
+ * @param       parts `LIGHTS_DRAW_LABELS` (statički sloj) i/ili `LIGHTS_DRAW_ICONS`.
+ ******************************************************************************
+ */
+static void DrawLightsScreen(const GUI_RECT* area, uint8_t parts)
+{
+    // =======================================================================
+    // === FAZA 1: ODABIR FONTA ZA CIJELI EKRAN (iz keša `text_layout`) ===
+    // =======================================================================
+    const uint8_t label_font = LightsScreen_ChooseFont();
+    const GUI_FONT* fontToUse = label_fonts[label_font];
 
-            int max_width_per_icon = (DRAWING_AREA_WIDTH / lights_in_this_row) - text_padding;
+    // =======================================================================
+    // === FAZA 2: ISCRTAVANJE IKONICA SA KONAČNO ODABRANIM FONTOM ===
+    // =======================================================================
+    int y_row_start = (LIGHTS_Rows_getCount() > 1)
+                      ? lights_and_gates_grid_layout.y_start_pos_multi_row
+                      : lights_and_gates_grid_layout.y_start_pos_single_row;
 
-            LIGHT_Handle* handle = LIGHTS_GetInstance(i);
+    const int y_row_height = lights_and_gates_grid_layout.row_height;
+    uint8_t lightsInRowSum = 0;
+
+    for(uint8_t row = 0; row < LIGHTS_Rows_getCount(); ++row) {
+        uint8_t lightsInRow = LightsScreen_GetLightsInRow(row);
+        uint8_t currentLightsMenuSpaceBetween = (400 - (80 * lightsInRow)) / (lightsInRow - 1 + 2);
+
+        for(uint8_t idx_in_row = 0; idx_in_row < lightsInRow; ++idx_in_row) {
+            uint8_t absolute_light_index = lightsInRowSum + idx_in_row;
+            GUI_RECT tile;
+
+            // Pločice izvan područja se preskaču.
+            if (LightsScreen_GetTileRect(absolute_light_index, &tile) && !GUI_RectsIntersect(&tile, area)) continue;
+
+            LIGHT_Handle* handle = LIGHTS_GetInstance(absolute_light_index);
             if (handle) {
                 uint16_t selection_index = LIGHT_GetIconID(handle);
                 if (selection_index < (sizeof(icon_mapping_table) / sizeof(IconMapping_t)))
                 {
                     const IconMapping_t* mapping = &icon_mapping_table[selection_index];
-                    const char* primary_text = lng(mapping->primary_text_id);
-                    const char* secondary_text = lng(mapping->secondary_text_id);
+                    GUI_CONST_STORAGE GUI_BITMAP* icon_to_draw = light_modbus_images[(mapping->visual_icon_id * 2) + LIGHT_isActive(handle)];
+
+                    // Postavljamo KONAČNO ODABRANI FONT za iscrtavanje
+                    GUI_SetFont(fontToUse);
+                    const int font_height = GUI_GetFontDistY();
+                    const int icon_height = icon_to_draw->YSize;
+                    const int icon_width = icon_to_draw->XSize;
+                    const int padding = lights_and_gates_grid_layout.text_icon_padding;
+                    const int total_block_height = font_height + padding + icon_height + padding + font_height;
+                    const int y_slot_center = y_row_start + (y_row_height / 2);
+                    const int y_block_start = y_slot_center - (total_block_height / 2);
+                    const int x_slot_start = (currentLightsMenuSpaceBetween * (idx_in_row + 1)) + (80 * idx_in_row);
+                    const int x_text_center = x_slot_start + 40;
+
+                    const int y_primary_text_pos = y_block_start;
+                    const int y_icon_pos = y_primary_text_pos + font_height + padding;
+                    const int y_secondary_text_pos = y_icon_pos + icon_height + padding;
+
+                    if (parts & LIGHTS_DRAW_LABELS) {
+                        GUI_SetTextMode(GUI_TM_TRANS);
+                        GUI_SetTextAlign(GUI_TA_HCENTER);
 
-                    // Mjerenje širine sa velikim fontom
-                    GUI_SetFont(&GUI_FontVerdana20_LAT);
-                    if (GUI_GetStringDistX(primary_text) > max_width_per_icon || GUI_GetStringDistX(secondary_text) > max_width_per_icon)
-                    {
-                        downgrade_font = true; // Ako je BILO KOJI tekst predugačak...
-                        break; // ...odmah prekidamo provjeru, odluka je pala.
+                        GUI_SetColor(GUI_WHITE);
+                        GUI_DispStringAt(Labels_Text(mapping->primary_text_id, label_font), x_text_center, y_primary_text_pos);
+
+                        GUI_SetColor(GUI_ORANGE);
+                        GUI_DispStringAt(Labels_Text(mapping->secondary_text_id, label_font), x_text_center, y_secondary_text_pos);
+                    }
+
+                    if (parts & LIGHTS_DRAW_ICONS) {
+                        DrawIcon(icon_to_draw, x_text_center - (icon_width / 2), y_icon_pos);
                     }
                 }
             }
         }
+        lightsInRowSum += lightsInRow;
+        y_row_start += y_row_height;
+    }
+}
+
+/**
+ * @brief Vraća broj ikonica svjetala u zadanom redu ekrana `SCREEN_LIGHTS`.
+ * @note Isti raspored koriste `HandlePress_LightsScreen` i `DrawLightsScreen`.
+ */
+static uint8_t LightsScreen_GetLightsInRow(uint8_t row)
+{
+    uint8_t lightsInRow = LIGHTS_getCount();
+    if(LIGHTS_getCount() > 3) {
+        if(LIGHTS_getCount() == 4) lightsInRow = 2;
+        else if(LIGHTS_getCount() == 5) lightsInRow = (row > 0) ? 2 : 3;
+        else lightsInRow = 3;
+    }
+    return lightsInRow;
+}
 
-        if (downgrade_font) {
-            fontToUse = &GUI_FontVerdana16_LAT; // ...cijeli ekran će koristiti manji font.
+/**
+ * @brief Računa pločicu (ćeliju) jednog svjetla: ikonicu sa obje labele.
+ * @note Ćelija je širine `DRAWING_AREA_WIDTH / lightsInRow` i visine jednog reda,
+ * pa uvijek pokriva i najduži tekst koji FAZA 1 dozvoljava.
+ * @param index Indeks svjetla.
+ * @param rect Izlaz: pravougaonik pločice (uključive koordinate).
+ * @retval bool `false` ako svjetlo nije na ekranu.
+ */
+static bool LightsScreen_GetTileRect(uint8_t index, GUI_RECT* rect)
+{
+    int y_row_start = (LIGHTS_Rows_getCount() > 1)
+                      ? lights_and_gates_grid_layout.y_start_pos_multi_row
+                      : lights_and_gates_grid_layout.y_start_pos_single_row;
+    uint8_t lightsInRowSum = 0;
+
+    for(uint8_t row = 0; row < LIGHTS_Rows_getCount(); ++row) {
+        uint8_t lightsInRow = LightsScreen_GetLightsInRow(row);
+
+        if (index < (lightsInRowSum + lightsInRow)) {
+            uint8_t idx_in_row = index - lightsInRowSum;
+            uint8_t currentLightsMenuSpaceBetween = (400 - (80 * lightsInRow)) / (lightsInRow - 1 + 2);
+            int x_text_center = (currentLightsMenuSpaceBetween * (idx_in_row + 1)) + (80 * idx_in_row) + 40;
+            int half_cell = (DRAWING_AREA_WIDTH / lightsInRow) / 2;
+
+            rect->x0 = x_text_center - half_cell;
+            rect->x1 = x_text_center + half_cell - 1;
+            rect->y0 = y_row_start;
+            rect->y1 = y_row_start + lights_and_gates_grid_layout.row_height - 1;
+            return true;
         }
+        lightsInRowSum += lightsInRow;
+        y_row_start += lights_and_gates_grid_layout.row_height;
+    }
+    return false;
+}
 
-        // =======================================================================
-        // === FAZA 2: ISCRTAVANJE IKONICA SA KONAČNO ODABRANIM FONTOM ===
-        // =======================================================================
-        int y_row_start = (LIGHTS_Rows_getCount() > 1)
-                          ? lights_and_gates_grid_layout.y_start_pos_multi_row
-                          : lights_and_gates_grid_layout.y_start_pos_single_row;
+/**
+ * @brief Iscrtava statički sloj ekrana `SCREEN_LIGHTS`: pozadinu, meni i labele.
+ * @note Ikonice ovise o stanju svjetala, pa ih crta `Service_LightsScreen` preko sloja.
+ */
+static void LightsScreen_DrawStatic(void)
+{
+    GUI_RECT screen_rect = { 0, 0, LCD_GetXSize() - 1, LCD_GetYSize() - 1 };
 
-        const int y_row_height = lights_and_gates_grid_layout.row_height;
-        uint8_t lightsInRowSum = 0;
+    GUI_Clear();
+    DrawHamburgerMenu(1);
+    DrawLightsScreen(&screen_rect, LIGHTS_DRAW_LABELS);
+}
 
-        for(uint8_t row = 0; row < LIGHTS_Rows_getCount(); ++row) {
-            uint8_t lightsInRow = LIGHTS_getCount();
-            if(LIGHTS_getCount() > 3) {
-                if(LIGHTS_getCount() == 4) lightsInRow = 2;
-                else if(LIGHTS_getCount() == 5) lightsInRow = (row > 0) ? 2 : 3;
-                else lightsInRow = 3;
+/**
+ * @brief Iscrtava statički sloj ekrana `SCREEN_THERMOSTAT` (sloj 0): pozadinsku
+ * sliku, meni i očišćena polja za dinamičke vrijednosti.
+ */
+static void ThermostatScreen_DrawStatic(void)
+{
+    GUI_SetColor(GUI_BLACK);
+    GUI_Clear();
+    // Iscrtavanje pozadinske bitmap slike termostata.
+    GUI_BMP_Draw(&thstat, 0, 0);
+    GUI_ClearRect(380, 0, 480, 100);
+    // Iscrtavanje hamburger meni ikonice u gornjem desnom uglu.
+    DrawHamburgerMenu(1);
+
+    // Čišćenje specifičnih dijelova ekrana za dinamičke vrijednosti.
+    GUI_ClearRect(350, 80, 480, 180);
+    GUI_ClearRect(310, 180, 420, 205);
+}
+
+/**
+ * @brief Prenosi statički sloj ekrana na trenutno odabrani LCD sloj.
+ * @note Ako je kopija u memorijskom uređaju važeća, radi se samo blit (DMA2D).
+ * Inače se `draw` prvo izvrši u uređaj, a ako za uređaj nema memorije u
+ * emWin hipu, `draw` crta direktno na ekran kao ranije. `draw` mora
+ * crtati cijeli statički sloj i ne smije mijenjati odabrani sloj.
+ * @param scr Ekran (ključ keša i statistike).
+ * @param draw Funkcija koja crta statički dio.
+ * @param area Područje koje se kopira; NULL za cijeli ekran.
+ */
+static void StaticLayer_Draw(eScreen scr, void (*draw)(void), const GUI_RECT* area)
+{
+    uint32_t handle;
+    uint32_t start = StaticLayer_Now();
+    GuiStaticState_t state = GuiStatic_Acquire(&static_layers, scr, GUI_GetSelLayer(), &handle);
+
+    if (state == GUI_STATIC_DIRECT) {
+        draw();
+        GuiStatic_Record(&static_layers, scr, GUI_STATIC_TIME_DIRECT, StaticLayer_Us(start));
+        return;
+    }
+
+    if (state == GUI_STATIC_RENDER) {
+        GUI_MEMDEV_Handle prev = GUI_MEMDEV_Select((GUI_MEMDEV_Handle)handle);
+        GUI_SetClipRect(NULL);
+        draw();
+        GUI_MEMDEV_Select(prev);
+        GuiStatic_Rendered(&static_layers, scr);
+        GuiStatic_Record(&static_layers, scr, GUI_STATIC_TIME_RENDER, StaticLayer_Us(start));
+        start = StaticLayer_Now();
+    }
+
+    // Clip ograničava kopiranje na prljavo područje.
+    GUI_SetClipRect(area);
+    GUI_MEMDEV_CopyToLCD((GUI_MEMDEV_Handle)handle);
+    GuiStatic_Record(&static_layers, scr, GUI_STATIC_TIME_BLIT, StaticLayer_Us(start));
+}
+
+/**
+ * @brief Pravi memorijski uređaj veličine ekrana za statički sloj.
+ * @note Uređaj ima format LCD sloja (sloj 0 RGB565, sloj 1 ARGB8888, vidi
+ * `LCDConf.c`) i nema masku providnosti, pa se pri kopiranju prenose i
+ * providni pikseli sloja 1, a kopija ide bez konverzije preko DMA2D.
+ * @param layer LCD sloj.
+ * @retval uint32_t Handle uređaja ili 0 ako u emWin hipu nema mjesta
+ * (ili ga `MemBudget_Reserve()` nije odobrio).
+ */
+static uint32_t StaticLayer_Create(uint8_t layer)
+{
+    // Uređaj se ne pravi ako bi iza njega u hipu ostalo premalo za widgete.
+    if (!MemBudget_Reserve(&mem_budget, (uint32_t)LCD_GetXSize() * (uint32_t)LCD_GetYSize() * ((layer == 0) ? 2U : 4U))) {
+        return 0;
+    }
+    if (layer == 0) {
+        return (uint32_t)GUI_MEMDEV_CreateFixed(0, 0, LCD_GetXSize(), LCD_GetYSize(), GUI_MEMDEV_NOTRANS,
+                                                GUI_MEMDEV_APILIST_16, GUICC_M565);
+    }
+    return (uint32_t)GUI_MEMDEV_CreateFixed(0, 0, LCD_GetXSize(), LCD_GetYSize(), GUI_MEMDEV_NOTRANS,
+                                            GUI_MEMDEV_APILIST_32, GUICC_M8888I);
+}
+
+/**
+ * @brief Briše memorijski uređaj statičkog sloja.
+ */
+static void StaticLayer_Destroy(uint32_t handle)
+{
+    GUI_MEMDEV_Delete((GUI_MEMDEV_Handle)handle);
+}
+
+/**
+ * @brief Vraća trenutnu vrijednost DWT brojača ciklusa.
+ */
+static uint32_t StaticLayer_Now(void)
+{
+    return DWT->CYCCNT;
+}
+
+/**
+ * @brief Vraća broj µs proteklih od `start` (vrijednost `StaticLayer_Now()`).
+ */
+static uint32_t StaticLayer_Us(uint32_t start)
+{
+    return (DWT->CYCCNT - start) / (SystemCoreClock / 1000000U);
+}
+
+/**
+ * @brief Broj vsync-ova LTDC-a (prekid linije u LCDConf.c).
+ */
+static uint32_t Pacer_Vsync(void)
+{
+    return LCD_GetVsyncCount();
+}
+
+static uint32_t Pacer_Ms(void)
+{
+    return HAL_GetTick();
+}
+
+/**
+ * @brief Završeni bafer još čeka prikaz; novi frejm bi čekao slobodan bafer.
+ */
+static bool Pacer_BufferPending(void)
+{
+    return (LCD_IsBufferPending() != 0);
+}
+
+/**
+ * @brief Vraća i briše oznaku novog dodira.
+ */
+static bool Pacer_Input(void)
+{
+    bool input = gui_input;
+    gui_input = false;
+    return input;
+}
+
+static bool Pacer_Invalid(void)
+{
+    return (WM_GetNumInvalidWindows() > 0);
+}
+
+/**
+ * @brief RS485 ima komandi za slanje ili je u toku ažuriranje firmvera.
+ */
+static bool Pacer_Busy(void)
+{
+    return (binaryQueue.count != 0U) || (dimmerQueue.count != 0U) || (rgbwQueue.count != 0U) ||
+           (curtainQueue.count != 0U) || (thermoQueue.count != 0U) || IsFwUpdateActiv();
+}
+
+/**
+ * @brief Ciklusi zauzeća DMA2D-a (LCDConf.c), za `GuiProf_t`.
+ */
+static uint32_t Prof_DmaBusy(void)
+{
+    return LCD_GetDma2dBusyCycles();
+}
+
+/**
+ * @brief Broj zamjena prikazanog bafera (prekid linije u LCDConf.c).
+ */
+static uint32_t Prof_Flips(void)
+{
+    return LCD_GetFlipCount();
+}
+
+static uint32_t Prof_FlipTime(void)
+{
+    return LCD_GetFlipTime();
+}
+
+/**
+ * @brief Slobodni bajti emWin hipa, za `MemBudget_t`.
+ */
+static uint32_t Mem_FreeBytes(void)
+{
+    return (uint32_t)GUI_ALLOC_GetNumFreeBytes();
+}
+
+/**
+ * @brief Najveći blok koji emWin hip može dati (prolazi kroz slobodne blokove).
+ */
+static uint32_t Mem_LargestFree(void)
+{
+    return (uint32_t)GUI_ALLOC_GetMaxSize();
+}
+
+static uint32_t Mem_UsedBlocks(void)
+{
+    return (uint32_t)GUI_ALLOC_GetNumUsedBlocks();
+}
+
+static uint32_t Mem_IconCacheUsed(void)
+{
+    return icon_cache.used;
+}
+
+/**
+ * @brief Oslobađa GUI hip kad `MemBudget_Sample()` javi nedostatak memorije.
+ * @note Na upozorenje se brišu memorijski uređaji statičkih slojeva drugih
+ * ekrana, a u kritičnom stanju i uređaj aktivnog ekrana; ekran tada crta
+ * statički dio direktno dok se hip ne oporavi. Keš znakova sata se briše
+ * uvijek (ponovo se puni kad `MemBudget_Reserve()` to dozvoli).
+ */
+static void Mem_Pressure(MemLevel_t level)
+{
+    GuiStatic_Release(&static_layers, (level == MEM_LEVEL_CRITICAL) ? GUI_STATIC_RELEASE_ALL : (uint8_t)screen);
+    ClockFace_Release(&clock_face);
+}
+
+/**
+ * @brief Bafer sloja 0 koji LTDC prikazuje, za `RemoteView_t`.
+ */
+static const uint16_t* View_Base(void)
+{
+    return (const uint16_t*)LCD_GetShownBuffer(0);
+}
+
+static const uint32_t* View_Overlay(void)
+{
+    return (const uint32_t*)LCD_GetShownBuffer(1);
+}
+
+/**
+ * @brief Ekrani koji prikazuju PIN ili šifru (i dok ih maska ne sakrije),
+ * pa se ne šalju daljinskim pregledom.
+ */
+static bool View_Private(void)
+{
+    return (screen == SCREEN_SECURITY) || (screen == SCREEN_SETTINGS_ALARM) ||
+           (screen == SCREEN_NUMPAD) || (screen == SCREEN_KEYBOARD_ALPHA);
+}
+
+/**
+ * @brief Širina znaka u fontu sata, za `ClockFace_t`.
+ */
+static int16_t Clock_CharWidth(char c)
+{
+    GUI_SetFont(GUI_FONT_D80);
+    return (int16_t)GUI_GetCharDistX((U16)c);
+}
+
+/**
+ * @brief Iscrtava znak sata u memorijski uređaj veličine ćelije.
+ * @note Uređaj ima format sloja 1 bez maske providnosti, pa kopija
+ * zamjenjuje cijelu ćeliju (i providnu pozadinu) i ide preko DMA2D.
+ * @retval uint32_t Handle uređaja ili 0 (nema mjesta ili ga
+ * `MemBudget_Reserve()` nije odobrio); sat tada crta znak direktno.
+ */
+static uint32_t Clock_Render(char c, int16_t width, int16_t height, uint32_t color)
+{
+    GUI_MEMDEV_Handle glyph;
+    GUI_MEMDEV_Handle prev;
+    char text[2] = { c, '\0' };
+
+    if (!MemBudget_Reserve(&mem_budget, (uint32_t)width * (uint32_t)height * 4U)) {
+        return 0;
+    }
+    glyph = GUI_MEMDEV_CreateFixed(0, 0, width, height, GUI_MEMDEV_NOTRANS, GUI_MEMDEV_APILIST_32, GUICC_M8888I);
+    if (glyph == 0) return 0;
+
+    prev = GUI_MEMDEV_Select(glyph);
+    GUI_SetBkColor(GUI_TRANSPARENT);
+    GUI_Clear();
+    GUI_SetColor(color);
+    GUI_SetFont(GUI_FONT_D80);
+    GUI_SetTextAlign(GUI_TA_HCENTER | GUI_TA_TOP);
+    GUI_DispStringAt(text, width / 2, 0);
+    GUI_MEMDEV_Select(prev);
+    return (uint32_t)glyph;
+}
+
+static void Clock_Release(uint32_t glyph)
+{
+    GUI_MEMDEV_Delete((GUI_MEMDEV_Handle)glyph);
+}
+
+static void Clock_Begin(void)
+{
+    GUI_MULTIBUF_BeginEx(1);
+    GUI_SelectLayer(1);
+    GUI_SetClipRect(NULL);
+}
+
+static void Clock_Blit(uint32_t glyph, int16_t x, int16_t y)
+{
+    GUI_MEMDEV_CopyToLCDAt((GUI_MEMDEV_Handle)glyph, x, y);
+}
+
+/**
+ * @brief Briše ćeliju sata i crta znak direktno (znak nije u kešu).
+ */
+static void Clock_Draw(char c, const GuiRect_t *cell, uint32_t color)
+{
+    char text[2] = { c, '\0' };
+
+    GUI_SetBkColor(GUI_TRANSPARENT);
+    GUI_ClearRect(cell->x0, cell->y0, cell->x1, cell->y1);
+    GUI_SetColor(color);
+    GUI_SetFont(GUI_FONT_D80);
+    GUI_SetTextAlign(GUI_TA_HCENTER | GUI_TA_TOP);
+    GUI_DispStringAt(text, (cell->x0 + cell->x1 + 1) / 2, cell->y0);
+}
+
+static int16_t Clock_TextWidth(const char *text)
+{
+    GUI_SetFont(&GUI_FontVerdana32_LAT);
+    return (int16_t)GUI_GetStringDistX(text);
+}
+
+/**
+ * @brief Briše `clear` (stari i novi okvir datuma) i crta datum.
+ */
+static void Clock_DrawDate(const char *text, const GuiRect_t *clear, uint32_t color)
+{
+    GUI_SetBkColor(GUI_TRANSPARENT);
+    GUI_ClearRect(clear->x0, clear->y0, clear->x1, clear->y1);
+    GUI_SetColor(color);
+    GUI_SetFont(&GUI_FontVerdana32_LAT);
+    GUI_SetTextAlign(GUI_TA_HCENTER | GUI_TA_VCENTER);
+    GUI_DispStringAt(text, main_screen_layout.date_pos_scrnsvr.x, main_screen_layout.date_pos_scrnsvr.y);
+}
+
+static void Clock_End(void)
+{
+    GUI_MULTIBUF_EndEx(1);
+}
+
+/**
+ * @brief Usklađuje stabla widgeta sa aktivnim ekranom (`GuiTree_Sync()`).
+ * @note Poziva se na početku `DISP_Service()` i iz `Init` funkcija trajnih
+ * ekrana, odmah nakon pravljenja widgeta.
+ */
+static void WidgetTree_Sync(void)
+{
+    GuiTree_Sync(&widget_trees, (uint8_t)screen);
+}
+
+/**
+ * @brief Pravi korijenski prozor ekrana preko cijelog sloja.
+ * @note Korijen je providan i ništa ne crta, pa sadržaj koji ekran crta
+ * direktno na sloj ostaje vidljiv; prepoznaje se po `WidgetTree_RootCallback`.
+ * Pravi se skriven, a vidljivost postavlja `GuiTree`.
+ * @retval uint32_t Handle prozora ili 0 ako u emWin hipu nema mjesta.
+ */
+static uint32_t WidgetTree_CreateRoot(uint8_t layer)
+{
+    return (uint32_t)WM_CreateWindowAsChild(0, 0, LCD_GetXSize(), LCD_GetYSize(), WM_GetDesktopWindowEx(layer),
+                                            WM_CF_HASTRANS, WidgetTree_RootCallback, 0);
+}
+
+/**
+ * @brief Briše korijen sa svim widgetima ispod njega.
+ * @retval uint16_t Broj widgeta koji su još postojali (propušteni u `Kill` funkciji).
+ */
+static uint16_t WidgetTree_Destroy(uint32_t root)
+{
+    uint16_t count = 0;
+
+    for (WM_HWIN hChild = WM_GetFirstChild((WM_HWIN)root); hChild; hChild = WM_GetNextSibling(hChild)) {
+        count++;
+    }
+    WM_DeleteWindow((WM_HWIN)root);
+    return count;
+}
+
+/**
+ * @brief Prikazuje ili sakriva korijen, a time i sve widgete ekrana.
+ */
+static void WidgetTree_Show(uint32_t root, bool visible)
+{
+    if (visible) {
+        WM_ShowWindow((WM_HWIN)root);
+    } else {
+        WM_HideWindow((WM_HWIN)root);
+    }
+}
+
+/**
+ * @brief Premješta widgete sa desktopa sloja pod korijen ekrana.
+ * @note Prozor zadržava apsolutnu poziciju, a korijen pokriva cijeli sloj.
+ * Sa `root` 0 widgeti se samo prebroje.
+ * @retval uint16_t Broj widgeta na desktopu koji nisu korijeni.
+ */
+static uint16_t WidgetTree_Adopt(uint8_t layer, uint32_t root)
+{
+    WM_HWIN hChild = WM_GetFirstChild(WM_GetDesktopWindowEx(layer));
+    WM_HWIN hNext;
+    uint16_t count = 0;
+
+    while (hChild) {
+        hNext = WM_GetNextSibling(hChild);
+        if (WM_GetCallback(hChild) != WidgetTree_RootCallback) {
+            if (root) WM_AttachWindow(hChild, (WM_HWIN)root);
+            count++;
+        }
+        hChild = hNext;
+    }
+    return count;
+}
+
+/**
+ * @brief Vraća trenutno zauzeće emWin hipa u bajtima.
+ */
+static uint32_t WidgetTree_HeapUsed(void)
+{
+    return (uint32_t)GUI_ALLOC_GetNumUsedBytes();
+}
+
+/**
+ * @brief Callback korijenskog prozora. Ne crta ništa; služi da se korijen
+ * razlikuje od widgeta na desktopu i prima notifikacije widgeta ekrana.
+ */
+static void WidgetTree_RootCallback(WM_MESSAGE* pMsg)
+{
+    if (pMsg->MsgId == WM_NOTIFY_PARENT) {
+        Settings_OnNotify(pMsg->hWinSrc, pMsg->Data.v);
+    }
+    WM_DefaultProc(pMsg);
+}
+
+/**
+ * @brief Traži widget po ID-ju samo u vidljivim stablima odabranog sloja.
+ * @note Zamjenjuje `WM_GetDialogItem(WM_GetDesktopWindow(), id)`: skriveno
+ * stablo trajnog ekrana (npr. tastatura sa `GUI_ID_USER + n`) ne smije
+ * zakloniti widget aktivnog ekrana sa istim ID-jem.
+ * @retval WM_HWIN Handle widgeta ili 0 ako ne postoji.
+ */
+static WM_HWIN Widget_Find(int id)
+{
+    WM_HWIN hItem;
+
+    for (WM_HWIN hChild = WM_GetFirstChild(WM_GetDesktopWindow()); hChild; hChild = WM_GetNextSibling(hChild)) {
+        if (!WM_IsVisible(hChild)) continue;
+        if (WM_GetId(hChild) == id) return hChild;
+        if ((hItem = WM_GetDialogItem(hChild, id))) return hItem;
+    }
+    return 0;
+}
+
+/**
+ * @brief Obrađuje notifikaciju widgeta ekrana podešavanja.
+ * @note Poziva se iz `GUI_Exec()` (glavna petlja) kad korisnik promijeni
+ * widget. Vrijednost se odmah upisuje u modul; ako je modul ispravi (npr.
+ * min/max zadane temperature), widget se vraća na ispravljenu vrijednost.
+ */
+static void Settings_OnNotify(WM_HWIN hWin, int code)
+{
+    int16_t index;
+    int32_t value;
+    int32_t applied;
+    uint8_t widget;
+
+    if ((code != WM_NOTIFICATION_VALUE_CHANGED) && (code != WM_NOTIFICATION_SEL_CHANGED)) return;
+    index = SettingsModel_Find(&settings_model, (uint8_t)screen, (uint16_t)WM_GetId(hWin));
+    if (index < 0) return;
+
+    widget = settings_model.fields[index].widget;
+    switch (widget) {
+    case SETTINGS_WIDGET_RADIO:
+        value = RADIO_GetValue(hWin);
+        break;
+    case SETTINGS_WIDGET_CHECKBOX:
+        value = CHECKBOX_GetState(hWin);
+        break;
+    case SETTINGS_WIDGET_DROPDOWN:
+        value = DROPDOWN_GetSel(hWin);
+        break;
+    default:
+        value = SPINBOX_GetValue(hWin);
+        break;
+    }
+
+    if (SettingsModel_Set(&settings_model, index, value, &applied) != SETTINGS_CORRECTED) return;
+    switch (widget) {
+    case SETTINGS_WIDGET_RADIO:
+        RADIO_SetValue(hWin, applied);
+        break;
+    case SETTINGS_WIDGET_CHECKBOX:
+        CHECKBOX_SetState(hWin, applied);
+        break;
+    case SETTINGS_WIDGET_DROPDOWN:
+        DROPDOWN_SetSel(hWin, applied);
+        break;
+    default:
+        SPINBOX_SetValue(hWin, applied);
+        break;
+    }
+}
+
+/**
+ * @brief Čita postavku iz modula (`SettingsModelOps_t::read`).
+ */
+static int32_t Settings_Read(uint8_t key)
+{
+    THERMOSTAT_TypeDef* pThst = Thermostat_GetInstance();
+    Defroster_Handle* defHandle = Defroster_GetInstance();
+    Ventilator_Handle* ventHandle = Ventilator_GetInstance();
+
+    switch (key) {
+    case SETTING_THST_CONTROL:          return Thermostat_GetControlMode(pThst);
+    case SETTING_THST_SP_MAX:           return Thermostat_Get_SP_Max(pThst);
+    case SETTING_THST_SP_MIN:           return Thermostat_Get_SP_Min(pThst);
+    case SETTING_FAN_CONTROL:           return Thermostat_GetFanControlMode(pThst);
+    case SETTING_FAN_DIFF:              return Thermostat_GetFanDifference(pThst);
+    case SETTING_FAN_LOW_BAND:          return Thermostat_GetFanLowBand(pThst);
+    case SETTING_FAN_HI_BAND:           return Thermostat_GetFanHighBand(pThst);
+    case SETTING_THST_GROUP:            return Thermostat_GetGroup(pThst);
+    case SETTING_THST_MASTER:           return Thermostat_IsMaster(pThst);
+    case SETTING_HIGH_BRIGHTNESS:       return g_display_settings.high_bcklght;
+    case SETTING_LOW_BRIGHTNESS:        return g_display_settings.low_bcklght;
+    case SETTING_SCRNSVR_TIMEOUT:       return g_display_settings.scrnsvr_tout;
+    case SETTING_SCRNSVR_ENA_HOUR:      return g_display_settings.scrnsvr_ena_hour;
+    case SETTING_SCRNSVR_DIS_HOUR:      return g_display_settings.scrnsvr_dis_hour;
+    case SETTING_SCRNSVR_CLK_COLOUR:    return g_display_settings.scrnsvr_clk_clr;
+    case SETTING_SCRNSVR_CLOCK:         return g_display_settings.scrnsvr_on_off;
+    case SETTING_HOUR:                  return Bcd2Dec(rtctm.Hours);
+    case SETTING_MINUTE:                return Bcd2Dec(rtctm.Minutes);
+    case SETTING_DAY:                   return Bcd2Dec(rtcdt.Date);
+    case SETTING_MONTH:                 return Bcd2Dec(rtcdt.Month);
+    case SETTING_YEAR:                  return Bcd2Dec(rtcdt.Year) + 2000;
+    case SETTING_WEEKDAY:               return rtcdt.WeekDay - 1;
+    case SETTING_DEFROSTER_CYCLE_TIME:  return Defroster_getCycleTime(defHandle);
+    case SETTING_DEFROSTER_ACTIVE_TIME: return Defroster_getActiveTime(defHandle);
+    case SETTING_DEFROSTER_PIN:         return Defroster_getPin(defHandle);
+    case SETTING_VENTILATOR_RELAY:      return Ventilator_getRelay(ventHandle);
+    case SETTING_VENTILATOR_DELAY_ON:   return Ventilator_getDelayOnTime(ventHandle);
+    case SETTING_VENTILATOR_DELAY_OFF:  return Ventilator_getDelayOffTime(ventHandle);
+    case SETTING_VENTILATOR_TRIGGER1:   return Ventilator_getTriggerSource1(ventHandle);
+    case SETTING_VENTILATOR_TRIGGER2:   return Ventilator_getTriggerSource2(ventHandle);
+    case SETTING_VENTILATOR_LOCAL_PIN:  return Ventilator_getLocalPin(ventHandle);
+    default:                            return 0;
+    }
+}
+
+/**
+ * @brief Upisuje postavku u modul (`SettingsModelOps_t::write`).
+ * @note Označava šta treba snimiti na isti način kao ranija provjera u
+ * `Service_SettingsScreen_*`: `thsta` za termostat, `settingsChanged` za
+ * ostale module, a vrijeme i datum se odmah upisuju u RTC.
+ */
+static void Settings_Write(uint8_t key, int32_t value)
+{
+    THERMOSTAT_TypeDef* pThst = Thermostat_GetInstance();
+    Defroster_Handle* defHandle = Defroster_GetInstance();
+    Ventilator_Handle* ventHandle = Ventilator_GetInstance();
+
+    switch (key) {
+    case SETTING_THST_CONTROL:
+        Thermostat_SetControlMode(pThst, value);
+        ++thsta;
+        break;
+    case SETTING_THST_SP_MAX:
+        Thermostat_Set_SP_Max(pThst, value);
+        ++thsta;
+        break;
+    case SETTING_THST_SP_MIN:
+        Thermostat_Set_SP_Min(pThst, value);
+        ++thsta;
+        break;
+    case SETTING_FAN_CONTROL:
+        Thermostat_SetFanControlMode(pThst, value);
+        ++thsta;
+        break;
+    case SETTING_FAN_DIFF:
+        Thermostat_SetFanDifference(pThst, value);
+        ++thsta;
+        break;
+    case SETTING_FAN_LOW_BAND:
+        Thermostat_SetFanLowBand(pThst, value);
+        ++thsta;
+        break;
+    case SETTING_FAN_HI_BAND:
+        Thermostat_SetFanHighBand(pThst, value);
+        ++thsta;
+        break;
+    case SETTING_THST_GROUP:
+        Thermostat_SetGroup(pThst, value);
+        thsta = 1;
+        break;
+    case SETTING_THST_MASTER:
+        Thermostat_SetMaster(pThst, value);
+        thsta = 1;
+        break;
+    case SETTING_HIGH_BRIGHTNESS:
+        g_display_settings.high_bcklght = value;
+        break;
+    case SETTING_LOW_BRIGHTNESS:
+        g_display_settings.low_bcklght = value;
+        break;
+    case SETTING_SCRNSVR_TIMEOUT:
+        g_display_settings.scrnsvr_tout = value;
+        break;
+    case SETTING_SCRNSVR_ENA_HOUR:
+        g_display_settings.scrnsvr_ena_hour = value;
+        break;
+    case SETTING_SCRNSVR_DIS_HOUR:
+        g_display_settings.scrnsvr_dis_hour = value;
+        break;
+    case SETTING_SCRNSVR_CLK_COLOUR:
+        g_display_settings.scrnsvr_clk_clr = value;
+        break;
+    case SETTING_SCRNSVR_CLOCK:
+        g_display_settings.scrnsvr_on_off = (value != 0);
+        settingsChanged = 1;
+        if (g_display_settings.scrnsvr_on_off) {
+            ScrnsvrClkSet();
+        } else {
+            ScrnsvrClkReset();
+        }
+        break;
+    case SETTING_HOUR:
+    case SETTING_MINUTE:
+        if (key == SETTING_HOUR) {
+            rtctm.Hours = Dec2Bcd(value);
+        } else {
+            rtctm.Minutes = Dec2Bcd(value);
+        }
+        HAL_RTC_SetTime(&hrtc, &rtctm, RTC_FORMAT_BCD);
+        RtcTimeValidSet();
+        break;
+    case SETTING_DAY:
+    case SETTING_MONTH:
+    case SETTING_YEAR:
+    case SETTING_WEEKDAY:
+        if (key == SETTING_DAY) {
+            rtcdt.Date = Dec2Bcd(value);
+        } else if (key == SETTING_MONTH) {
+            rtcdt.Month = Dec2Bcd(value);
+        } else if (key == SETTING_YEAR) {
+            rtcdt.Year = Dec2Bcd(value - 2000);
+        } else {
+            rtcdt.WeekDay = value + 1;
+        }
+        HAL_RTC_SetDate(&hrtc, &rtcdt, RTC_FORMAT_BCD);
+        RtcTimeValidSet();
+        break;
+    case SETTING_DEFROSTER_CYCLE_TIME:
+        Defroster_setCycleTime(defHandle, value);
+        settingsChanged = 1;
+        break;
+    case SETTING_DEFROSTER_ACTIVE_TIME:
+        Defroster_setActiveTime(defHandle, value);
+        settingsChanged = 1;
+        break;
+    case SETTING_DEFROSTER_PIN:
+        Defroster_setPin(defHandle, value);
+        settingsChanged = 1;
+        break;
+    case SETTING_VENTILATOR_RELAY:
+        Ventilator_setRelay(ventHandle, value);
+        settingsChanged = 1;
+        break;
+    case SETTING_VENTILATOR_DELAY_ON:
+        Ventilator_setDelayOnTime(ventHandle, value);
+        settingsChanged = 1;
+        break;
+    case SETTING_VENTILATOR_DELAY_OFF:
+        Ventilator_setDelayOffTime(ventHandle, value);
+        settingsChanged = 1;
+        break;
+    case SETTING_VENTILATOR_TRIGGER1:
+        Ventilator_setTriggerSource1(ventHandle, value);
+        settingsChanged = 1;
+        break;
+    case SETTING_VENTILATOR_TRIGGER2:
+        Ventilator_setTriggerSource2(ventHandle, value);
+        settingsChanged = 1;
+        break;
+    case SETTING_VENTILATOR_LOCAL_PIN:
+        Ventilator_setLocalPin(ventHandle, value);
+        settingsChanged = 1;
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief Vraća tekst ključa keša `text_layout` (prevod ili korisnička labela).
+ * @note Prevod se čita kao u `lng()`, ali za zadani jezik.
+ */
+static const char* Labels_GetText(uint16_t key, uint8_t language)
+{
+    if (key >= TEXT_LAYOUT_LABEL_BASE) {
+        uint8_t kind = (uint8_t)((key >> 8) & 0x7FU);
+        uint8_t index = (uint8_t)key;
+        if (kind == LABEL_KIND_LIGHT) {
+            LIGHT_Handle* handle = LIGHTS_GetInstance(index);
+            if (handle) return LIGHT_GetCustomLabel(handle);
+        } else if (kind == LABEL_KIND_GATE) {
+            Gate_Handle* handle = Gate_GetInstance(index);
+            if (handle) return Gate_GetCustomLabel(handle);
+        }
+        return language_strings[0][0];
+    }
+    if (lang_pack.valid && (lang_pack.language == language)) {
+        return LangPack_Get(&lang_pack, (key < TEXT_COUNT) ? key : 0);
+    }
+    if ((key > 0) && (key < TEXT_COUNT) && (language < LANGUAGE_COUNT)) {
+        return language_strings[key][language];
+    }
+    return language_strings[0][0];
+}
+
+/**
+ * @brief Mjeri širinu prvih `len` bajta teksta u fontu `label_fonts[font]`.
+ * @note Trenutni font se vraća, pa mjerenje ne mijenja stanje iscrtavanja.
+ */
+static int16_t Labels_Measure(uint8_t font, const char* text, uint16_t len)
+{
+    const GUI_FONT* old_font = GUI_SetFont(label_fonts[font]);
+    const char* end = text + len;
+    int width = 0;
+
+    // Isto kao GUI_GetStringDistX(), ali za dio stringa (UTF-8 znak po znak).
+    while ((text < end) && (*text != '\0')) {
+        width += GUI_GetCharDistX(GUI_UC_GetCharCode(text));
+        text += GUI_UC_GetCharSize(text);
+    }
+    GUI_SetFont(old_font);
+    return (int16_t)width;
+}
+
+/**
+ * @brief Vraća tekst labele na trenutnom jeziku iz keša (bez čitanja QSPI tabele).
+ */
+static const char* Labels_Text(uint16_t key, uint8_t font)
+{
+    return TextLayout_Get(&text_layout, key, g_display_settings.language, font)->text;
+}
+
+/**
+ * @brief Bira font labela ekrana svjetala: Verdana20 ako sve labele staju, inače Verdana16.
+ * @note Dozvoljena širina je ista za sva svjetla i zavisi samo od broja
+ * svjetala. Odluka i širine se pamte u `text_layout`, pa se labele mjere
+ * samo kad se promijeni jezik, konfiguracija ili labela.
+ */
+static uint8_t LightsScreen_ChooseFont(void)
+{
+    static const uint8_t fonts[] = { LABEL_FONT_VERDANA20, LABEL_FONT_VERDANA16 };
+    uint16_t keys[LABEL_GRID_MAX_TEXTS];
+    uint8_t count = 0;
+    uint8_t lights_total = LIGHTS_getCount();
+    uint8_t lights_in_this_row;
+
+    if (lights_total == 0) return LABEL_FONT_VERDANA20;
+    if (lights_total <= 3) lights_in_this_row = lights_total;
+    else if (lights_total == 4) lights_in_this_row = 2;
+    else lights_in_this_row = 3; // Za 5 svjetala pretpostavka za prvi red
+
+    for (uint8_t i = 0; (i < lights_total) && (count < (LABEL_GRID_MAX_TEXTS - 1U)); ++i) {
+        LIGHT_Handle* handle = LIGHTS_GetInstance(i);
+        if (handle) {
+            uint16_t selection_index = LIGHT_GetIconID(handle);
+            if (selection_index < (sizeof(icon_mapping_table) / sizeof(IconMapping_t))) {
+                keys[count++] = icon_mapping_table[selection_index].primary_text_id;
+                keys[count++] = icon_mapping_table[selection_index].secondary_text_id;
             }
-            uint8_t currentLightsMenuSpaceBetween = (400 - (80 * lightsInRow)) / (lightsInRow - 1 + 2);
+        }
+    }
+    return TextLayout_ChooseFont(&text_layout, SCREEN_LIGHTS, g_display_settings.language, keys, count,
+                                 (DRAWING_AREA_WIDTH / lights_in_this_row) - 10, fonts, sizeof(fonts));
+}
+
+/**
+ * @brief Bira font labela ekrana kapija, isto kao `LightsScreen_ChooseFont()`.
+ * @note Mjere se labele koje se zaista ispisuju: korisnička labela kapije
+ * zamjenjuje obje labele iz tabele izgleda.
+ */
+static uint8_t GateScreen_ChooseFont(uint8_t gate_count)
+{
+    static const uint8_t fonts[] = { LABEL_FONT_VERDANA20, LABEL_FONT_VERDANA16 };
+    uint16_t keys[LABEL_GRID_MAX_TEXTS];
+    uint8_t count = 0;
+    uint8_t gates_in_this_row;
+
+    if (gate_count == 0) return LABEL_FONT_VERDANA20;
+    if (gate_count <= 3) gates_in_this_row = gate_count;
+    else if (gate_count == 4) gates_in_this_row = 2;
+    else gates_in_this_row = 3;
+
+    for (uint8_t i = 0; (i < gate_count) && (count < (LABEL_GRID_MAX_TEXTS - 1U)); ++i) {
+        Gate_Handle* handle = Gate_GetInstance(i);
+        if (handle) {
+            uint8_t appearance_id = Gate_GetAppearanceId(handle);
+            if (appearance_id < (sizeof(gate_appearance_mapping_table) / sizeof(IconMapping_t))) {
+                if (Gate_GetCustomLabel(handle)[0] != '\0') {
+                    keys[count++] = TEXT_LAYOUT_LABEL_KEY(LABEL_KIND_GATE, i);
+                } else {
+                    keys[count++] = gate_appearance_mapping_table[appearance_id].primary_text_id;
+                    keys[count++] = gate_appearance_mapping_table[appearance_id].secondary_text_id;
+                }
+            }
+        }
+    }
+    return TextLayout_ChooseFont(&text_layout, SCREEN_GATE, g_display_settings.language, keys, count,
+                                 (DRAWING_AREA_WIDTH / gates_in_this_row) - 10, fonts, sizeof(fonts));
+}
+
+/**
+ * @brief Iscrtava ikonicu, iz keša u SDRAM-u kada je to moguće.
+ * @note Zamjena za `GUI_DrawBitmap()` na svim mjestima u modulu. Bitmape koje
+ * nisu ARGB8888 ili nisu u QSPI flešu crtaju se direktno.
+ */
+static void DrawIcon(const GUI_BITMAP* bitmap, int x, int y)
+{
+    if (Icon_IsCacheable(bitmap)) {
+        uint32_t size = (uint32_t)bitmap->BytesPerLine * bitmap->YSize;
+        const void* data = IconCache_Get(&icon_cache, bitmap, bitmap->pData, size);
+        if (data != bitmap->pData) {
+            icon_cache_bmp = *bitmap;
+            icon_cache_bmp.pData = (const U8*)data;
+            bitmap = &icon_cache_bmp;
+        }
+    }
+    GUI_DrawBitmap(bitmap, x, y);
+}
+
+/**
+ * @brief Pušta klip do kraja na (x, y).
+ * @note Frejmovi su vezani za vrijeme starta (`AnimPlayer_Step()` ne čeka),
+ * pa sporiji frejm ne produžava animaciju; ovdje se između frejmova samo
+ * čeka `HAL_Delay()`, jer se animacija pušta prije glavne petlje.
+ */
+static void Anim_Play(const AnimClip_t* clip, int x, int y, uint16_t repeats)
+{
+    static const AnimPlayerOps_t anim_ops = { Anim_DrawPatch, Anim_EndFrame };
+
+    AnimPlayer_Start(&anim_player, &anim_ops, clip, (int16_t)x, (int16_t)y, repeats, HAL_GetTick());
+    while (AnimPlayer_Step(&anim_player, HAL_GetTick()))
+    {
+        uint32_t wait = AnimPlayer_Wait(&anim_player, HAL_GetTick());
+        if (wait != 0U) HAL_Delay(wait);
+    }
+}
+
+/**
+ * @brief Briše pozadinu pravougaonika klipa i crta ga sa providnošću `alpha`.
+ */
+static void Anim_DrawPatch(const IconImage_t* image, int16_t x, int16_t y, uint8_t alpha)
+{
+    GUI_BITMAP bitmap = { image->width, image->height, (U16)(image->width * 4U), 32, (const U8*)image, NULL, GUI_DRAW_ICON };
+
+    if (!anim_multibuf) {
+        GUI_MULTIBUF_Begin();
+        anim_multibuf = true;
+    }
+    GUI_ClearRect(x, y, x + image->width - 1, y + image->height - 1);
+    LCD_SetIconAlpha(alpha);
+    GUI_DrawBitmap(&bitmap, x, y);
+    LCD_SetIconAlpha(0xFF);
+}
+
+/**
+ * @brief Završava frejm klipa (frejm bez promjena se ne prikazuje ponovo).
+ */
+static void Anim_EndFrame(void)
+{
+    if (anim_multibuf) {
+        GUI_MULTIBUF_End();
+        anim_multibuf = false;
+    }
+    GUI_Exec();
+}
+
+/**
+ * @brief Provjerava da li se bitmapa smije i isplati keširati.
+ */
+static bool Icon_IsCacheable(const GUI_BITMAP* bitmap)
+{
+    uint32_t addr = (uint32_t)bitmap->pData;
+    return (bitmap->pMethods == GUI_DRAW_BMP8888) &&
+           (addr >= ICON_CACHE_SRC_START) && (addr < ICON_CACHE_SRC_END);
+}
+
+/**
+ * @brief Kopira ikonicu u keš prije prvog iscrtavanja.
+ */
+static void Icon_Preload(const GUI_BITMAP* bitmap)
+{
+#if (ICON_CACHE_PRELOAD == 1)
+    if (Icon_IsCacheable(bitmap)) {
+        IconCache_Preload(&icon_cache, bitmap, bitmap->pData, (uint32_t)bitmap->BytesPerLine * bitmap->YSize);
+    }
+#else
+    (void)bitmap;
+#endif
+}
+
+/**
+ * @brief Manifest prvog menija: ikonice modula i dugme "NEXT".
+ * @note Dok se briše sektor QSPI-ja resursi nisu dostupni, pa manifesti
+ * vraćaju `false` i registar ih pokušava ponovo.
+ */
+static bool Screen_PrefetchSelect1(void)
+{
+    if (FwUpdateAgent_IsFlashBusy()) return false;
+    Icon_Preload(&bmSijalicaOff);
+    Icon_Preload(&bmTermometar);
+    Icon_Preload(&bmblindMedium);
+    Icon_Preload(&bmnext);
+    return true;
+}
 
-            for(uint8_t idx_in_row = 0; idx_in_row < lightsInRow; ++idx_in_row) {
-                uint8_t absolute_light_index = lightsInRowSum + idx_in_row;
-                LIGHT_Handle* handle = LIGHTS_GetInstance(absolute_light_index);
-                if (handle) {
-                    uint16_t selection_index = LIGHT_GetIconID(handle);
-                    if (selection_index < (sizeof(icon_mapping_table) / sizeof(IconMapping_t)))
-                    {
-                        const IconMapping_t* mapping = &icon_mapping_table[selection_index];
-                        GUI_CONST_STORAGE GUI_BITMAP* icon_to_draw = light_modbus_images[(mapping->visual_icon_id * 2) + LIGHT_isActive(handle)];
+/**
+ * @brief Manifest drugog menija: ikonice kapija, tajmera i alarma.
+ */
+static bool Screen_PrefetchSelect2(void)
+{
+    if (FwUpdateAgent_IsFlashBusy()) return false;
+    Icon_Preload(&bmicons_menu_gate);
+    Icon_Preload(&bmicons_menu_timers);
+    Icon_Preload(&bmicons_scene_security);
+    Icon_Preload(&bmnext);
+    return true;
+}
 
-                        // Postavljamo KONAČNO ODABRANI FONT za iscrtavanje
-                        GUI_SetFont(fontToUse);
-                        const int font_height = GUI_GetFontDistY();
-                        const int icon_height = icon_to_draw->YSize;
-                        const int icon_width = icon_to_draw->XSize;
-                        const int padding = lights_and_gates_grid_layout.text_icon_padding;
-                        const int total_block_height = font_height + padding + icon_height + padding + font_height;
-                        const int y_slot_center = y_row_start + (y_row_height / 2);
-                        const int y_block_start = y_slot_center - (total_block_height / 2);
-                        const int x_slot_start = (currentLightsMenuSpaceBetween * (idx_in_row + 1)) + (80 * idx_in_row);
-                        const int x_text_center = x_slot_start + 40;
+/**
+ * @brief Manifest ekrana svjetala: obje varijante ikonice (ON i OFF, jer se
+ * mijenjaju na dodir) svih svjetala i font labela.
+ */
+static bool Screen_PrefetchLights(void)
+{
+    if (FwUpdateAgent_IsFlashBusy()) return false;
+    for (uint8_t i = 0; i < LIGHTS_getCount(); ++i) {
+        LIGHT_Handle* handle = LIGHTS_GetInstance(i);
+        if (!handle) continue;
+        uint16_t selection_index = LIGHT_GetIconID(handle);
+        if (selection_index >= (sizeof(icon_mapping_table) / sizeof(IconMapping_t))) continue;
+        for (uint8_t state = 0; state < 2; ++state) {
+            Icon_Preload(light_modbus_images[(icon_mapping_table[selection_index].visual_icon_id * 2) + state]);
+        }
+    }
+    // Odluka o fontu i širine labela ostaju u `text_layout`.
+    (void)LightsScreen_ChooseFont();
+    return true;
+}
 
-                        const int y_primary_text_pos = y_block_start;
-                        const int y_icon_pos = y_primary_text_pos + font_height + padding;
-                        const int y_secondary_text_pos = y_icon_pos + icon_height + padding;
+/**
+ * @brief Manifest ekrana kapija: font labela (širine ostaju u `text_layout`).
+ */
+static bool Screen_PrefetchGate(void)
+{
+    (void)GateScreen_ChooseFont(Gate_GetCount());
+    return true;
+}
 
-                        GUI_SetTextMode(GUI_TM_TRANS);
-                        GUI_SetTextAlign(GUI_TA_HCENTER);
+/**
+ * @brief Manifest ekrana scena: ikonice konfigurisanih scena.
+ */
+static bool Screen_PrefetchScene(void)
+{
+    if (FwUpdateAgent_IsFlashBusy()) return false;
+    for (uint8_t i = 0; i < SCENE_MAX_COUNT; ++i) {
+        Scene_t* scene_handle = Scene_GetInstance(i);
+        if (!scene_handle || !scene_handle->is_configured) continue;
+        if (scene_handle->appearance_id >= (sizeof(scene_appearance_table) / sizeof(SceneAppearance_t))) continue;
+        int scene_icon_index = scene_appearance_table[scene_handle->appearance_id].icon_id - ICON_SCENE_WIZZARD;
+        if ((scene_icon_index < 0) || (scene_icon_index >= (int)(sizeof(scene_icon_images) / sizeof(scene_icon_images[0])))) continue;
+        Icon_Preload(scene_icon_images[scene_icon_index]);
+    }
+    return true;
+}
 
-                        GUI_SetColor(GUI_WHITE);
-                        GUI_DispStringAt(lng(mapping->primary_text_id), x_text_center, y_primary_text_pos);
+/**
+ * @brief Izlazak sa ekrana podešavanja 1-3: odvezuje model postavki.
+ * @note `DSP_KillSet*Scrn` to radi pri prelazu unutar menija; ovo pokriva
+ * izlaske bez njih (povratak na prvi ekran, screensaver). Registar poziva
+ * izlazak tek nakon što je `Init` novog ekrana već vezao svoja polja, pa se
+ * ona ne diraju.
+ */
+static void Screen_LeaveSettings(void)
+{
+    if (settings_model.owner != (uint8_t)screen) {
+        SettingsModel_Unbind(&settings_model);
+    }
+}
 
-                        GUI_DrawBitmap(icon_to_draw, x_text_center - (icon_width / 2), y_icon_pos);
+/**
+ * @brief Kopira podatke bitmape iz QSPI-ja u bazen keša.
+ * @note SDRAM je u MPU-u write-through, ali D-keš se ipak čisti da DMA2D
+ * sigurno čita upisane podatke i ako se atributi regije promijene.
+ */
+static void Icon_CopyToSdram(void* dst, const void* src, uint32_t size)
+{
+    memcpy(dst, src, size);
+    SCB_CleanDCache_by_Addr((uint32_t*)dst, (int32_t)size);
+}
 
-                        GUI_SetTextMode(GUI_TM_TRANS);
-                        GUI_SetTextAlign(GUI_TA_HCENTER);
-                        GUI_SetColor(GUI_ORANGE);
-                        GUI_DispStringAt(lng(mapping->secondary_text_id), x_text_center, y_secondary_text_pos);
-                    }
-                }
+/**
+ * @brief  `QrEncode_t` keša QR kodova: kodira tekst preko emWin-a.
+ * @note   Kod se kodira sa modulom od 1 piksela i iscrta u privremeni
+ * memorijski uređaj, iz kojeg se čitaju tamni moduli. Poziva se samo kad
+ * se tekst promijeni.
+ */
+static bool QR_Encode(const char* text, uint8_t* bits, uint16_t max_size, uint16_t* size)
+{
+    GUI_HMEM hqr;
+    GUI_MEMDEV_Handle hmem, hprev;
+    GUI_QR_INFO info;
+    GUI_COLOR color = GUI_GetColor();
+    GUI_COLOR bk_color = GUI_GetBkColor();
+
+    hqr = GUI_QR_Create(text, 1, GUI_QR_ECLEVEL_M, 0);
+    if (hqr == 0) return false;
+    GUI_QR_GetInfo(hqr, &info);
+    if ((info.Size <= 0) || (info.Size > max_size)) {
+        GUI_QR_Delete(hqr);
+        return false;
+    }
+    hmem = GUI_MEMDEV_Create(0, 0, info.Size, info.Size);
+    if (hmem == 0) {
+        GUI_QR_Delete(hqr);
+        return false;
+    }
+
+    hprev = GUI_MEMDEV_Select(hmem);
+    GUI_SetBkColor(GUI_WHITE);
+    GUI_Clear();
+    GUI_QR_Draw(hqr, 0, 0);
+    for (int y = 0; y < info.Size; y++) {
+        for (int x = 0; x < info.Size; x++) {
+            GUI_COLOR c = GUI_Index2Color(GUI_GetPixelIndex(x, y));
+            if ((c & 0xFF) < 0x80) {
+                bits[y * QR_CACHE_LINE_BYTES + (x >> 3)] |= (uint8_t)(0x80U >> (x & 7));
             }
-            lightsInRowSum += lightsInRow;
-            y_row_start += y_row_height;
         }
-        GUI_MULTIBUF_EndEx(1);
     }
+    GUI_MEMDEV_Select(hprev);
+    GUI_MEMDEV_Delete(hmem);
+    GUI_QR_Delete(hqr);
+    GUI_SetColor(color);
+    GUI_SetBkColor(bk_color);
+
+    *size = (uint16_t)info.Size;
+    return true;
+}
+
+/**
+ * @brief  Indeks u `qr_cache` za ID QR koda, isto pravilo kao `QR_Code_Get`.
+ */
+static uint8_t QR_Slot(uint8_t qrCodeID)
+{
+    return ((qrCodeID > 0) && (qrCodeID <= QR_CODE_COUNT)) ? (qrCodeID - 1) : 0;
 }
 
 /**
@@ -9849,21 +11350,70 @@ static void Service_QrCodeScreen(void)
         // Iscrtavanje hamburger meni ikonice.
         DrawHamburgerMenu(1);
 
-        // Generisanje i crtanje QR koda.
-        GUI_HMEM hqr = GUI_QR_Create((char*)QR_Code_Get(qr_code_draw_id), 8, GUI_QR_ECLEVEL_M, 0);
-        GUI_QR_INFO qrInfo;
-        GUI_QR_GetInfo(hqr, &qrInfo);
+        // Crtanje QR koda iz keša: bijela podloga i jedan DMA2D fill po nizu tamnih modula.
+        const QrCacheEntry_t* qr = QrCache_Get(&qr_cache, QR_Slot(qr_code_draw_id), (const char*)QR_Code_Get(qr_code_draw_id));
+        if (qr != NULL) {
+            int size = qr->size * QR_CODE_PIXEL_SIZE;
 
-        GUI_SetColor(GUI_WHITE);
-        GUI_FillRect(0, 0, qrInfo.Size + 20, qrInfo.Size + 20);
+            GUI_SetColor(GUI_WHITE);
+            GUI_FillRect(0, 0, size + 20, size + 20);
 
-        GUI_QR_Draw(hqr, 10, 10);
-        GUI_QR_Delete(hqr);
+            GUI_SetColor(GUI_BLACK);
+            for (uint16_t y = 0; y < qr->size; y++) {
+                uint16_t x = 0, run;
+                while (QrCache_NextRun(qr, y, &x, &run)) {
+                    GUI_FillRect(10 + x * QR_CODE_PIXEL_SIZE, 10 + y * QR_CODE_PIXEL_SIZE,
+                                 10 + (x + run) * QR_CODE_PIXEL_SIZE - 1, 10 + (y + 1) * QR_CODE_PIXEL_SIZE - 1);
+                    x += run;
+                }
+            }
+        }
 
         GUI_MULTIBUF_EndEx(1);
     }
 }
 
+/**
+ * @brief Servisira skriveni ekran sa izvještajem mjerenja iscrtavanja.
+ * @note Ulazi se držanjem hamburger zone još `SETTINGS_MENU_ENABLE_TIME`
+ * nakon ulaska u prvi ekran podešavanja, a izlazi dodirom. Tekst
+ * (`DISP_GetProfReport()` i stanje hipa iz `DISP_GetMemReport()`) se
+ * osvježava jednom u sekundi i ekran za to
+ * vrijeme ne prelazi u screensaver.
+ */
+static void Service_DiagnosticsScreen(void)
+{
+    static uint32_t diag_tmr = 0U;
+    GUI_RECT heap_rect;
+
+    if (!shouldDrawScreen && ((HAL_GetTick() - diag_tmr) < DIAG_REFRESH_TIME)) return;
+
+    if (shouldDrawScreen) {
+        shouldDrawScreen = 0;
+        GUI_SelectLayer(0);
+        GUI_Clear();
+        GUI_SelectLayer(1);
+    }
+    diag_tmr = HAL_GetTick();
+    DISPResetScrnsvr();
+
+    GUI_MULTIBUF_BeginEx(1);
+    GUI_SetBkColor(GUI_TRANSPARENT);
+    GUI_Clear();
+    GUI_SetColor(GUI_WHITE);
+    GUI_SetFont(GUI_FONT_13_1);
+    GUI_SetTextMode(GUI_TM_TRANS);
+    GUI_SetTextAlign(GUI_TA_LEFT | GUI_TA_TOP);
+    GUI_DispStringAt(DISP_GetProfReport(), 4, 4);
+    // Prva dva reda izvještaja o hipu (zauzeće, fragmentacija, nivo) na dnu; ostatak odsiječe pravougaonik.
+    heap_rect.x0 = 4;
+    heap_rect.y0 = LCD_GetYSize() - (2 * GUI_GetFontSizeY()) - 4;
+    heap_rect.x1 = LCD_GetXSize() - 1;
+    heap_rect.y1 = LCD_GetYSize() - 1;
+    GUI_DispStringInRect(DISP_GetMemReport(), &heap_rect, GUI_TA_LEFT | GUI_TA_TOP);
+    GUI_MULTIBUF_EndEx(1);
+}
+
 /**
  ******************************************************************************
  * @brief       Servisira ekran za čišćenje ekrana (privremeno onemogućava dodir).
@@ -9971,55 +11521,7 @@ static void Service_SettingsScreen_1(void)
     // Dobijamo handle za termostat na početku funkcije.
     THERMOSTAT_TypeDef* pThst = Thermostat_GetInstance();
 
-    // Detekcija promjena na widgetima.
-    if (Thermostat_GetControlMode(pThst) != RADIO_GetValue(hThstControl)) {
-        Thermostat_SetControlMode(pThst, RADIO_GetValue(hThstControl));
-        ++thsta;
-    }
-    if (Thermostat_GetFanControlMode(pThst) != RADIO_GetValue(hFanControl)) {
-        Thermostat_SetFanControlMode(pThst, RADIO_GetValue(hFanControl));
-        ++thsta;
-    }
-    // === NASTAVAK REFAKTORISANJA ===
-    if (Thermostat_Get_SP_Max(pThst) != SPINBOX_GetValue(hThstMaxSetPoint)) {
-        // Pozivamo setter sa handle-om.
-        Thermostat_Set_SP_Max(pThst, SPINBOX_GetValue(hThstMaxSetPoint));
-        // Očitavamo validiranu vrijednost nazad pomoću gettera.
-        SPINBOX_SetValue(hThstMaxSetPoint, Thermostat_Get_SP_Max(pThst));
-        ++thsta;
-    }
-    if (Thermostat_Get_SP_Min(pThst) != SPINBOX_GetValue(hThstMinSetPoint)) {
-        // Pozivamo setter sa handle-om.
-        Thermostat_Set_SP_Min(pThst, SPINBOX_GetValue(hThstMinSetPoint));
-        // Očitavamo validiranu vrijednost nazad pomoću gettera.
-        SPINBOX_SetValue(hThstMinSetPoint, Thermostat_Get_SP_Min(pThst));
-        ++thsta;
-    }
-    if (Thermostat_GetFanDifference(pThst) != SPINBOX_GetValue(hFanDiff)) {
-        // Postavljamo novu vrijednost preko settera.
-        Thermostat_SetFanDifference(pThst, SPINBOX_GetValue(hFanDiff));
-        ++thsta;
-    }
-    if (Thermostat_GetFanLowBand(pThst) != SPINBOX_GetValue(hFanLowBand)) {
-        // Postavljamo novu vrijednost preko settera.
-        Thermostat_SetFanLowBand(pThst, SPINBOX_GetValue(hFanLowBand));
-        ++thsta;
-    }
-    if (Thermostat_GetFanHighBand(pThst) != SPINBOX_GetValue(hFanHiBand)) {
-        // Postavljamo novu vrijednost preko settera.
-        Thermostat_SetFanHighBand(pThst, SPINBOX_GetValue(hFanHiBand));
-        ++thsta;
-    }
-    if (Thermostat_GetGroup(pThst) != SPINBOX_GetValue(hThstGroup)) {
-        // Postavljamo novu vrijednost preko settera.
-        Thermostat_SetGroup(pThst, SPINBOX_GetValue(hThstGroup));
-        thsta = 1;
-    }
-    if (Thermostat_IsMaster(pThst) != CHECKBOX_IsChecked(hThstMaster)) {
-        // Postavljamo novu vrijednost preko settera.
-        Thermostat_SetMaster(pThst, CHECKBOX_IsChecked(hThstMaster));
-        thsta = 1;
-    }
+    // Promjene widgeta upisuje `Settings_OnNotify()` čim se dese (`settings_model`).
 
     // Obrada pritiska na dugmad "SAVE" ili "NEXT"
     if (BUTTON_IsPressed(hBUTTON_Ok)) {
@@ -10054,75 +11556,21 @@ static void Service_SettingsScreen_2(void)
     /** @brief Dobijamo handle za termostat radi konzistentnosti sa ostalim funkcijama. */
     THERMOSTAT_TypeDef* pThst = Thermostat_GetInstance();
 
-    /** @brief Detekcija promjena u postavkama. */
-    if (rtctm.Hours != Dec2Bcd(SPINBOX_GetValue(hSPNBX_Hour))) {
-        rtctm.Hours = Dec2Bcd(SPINBOX_GetValue(hSPNBX_Hour));
-        HAL_RTC_SetTime(&hrtc, &rtctm, RTC_FORMAT_BCD);
-        RtcTimeValidSet();
-    }
-    if (rtctm.Minutes != Dec2Bcd(SPINBOX_GetValue(hSPNBX_Minute))) {
-        rtctm.Minutes = Dec2Bcd(SPINBOX_GetValue(hSPNBX_Minute));
-        HAL_RTC_SetTime(&hrtc, &rtctm, RTC_FORMAT_BCD);
-        RtcTimeValidSet();
-    }
-    if (rtcdt.Date != Dec2Bcd(SPINBOX_GetValue(hSPNBX_Day))) {
-        rtcdt.Date = Dec2Bcd(SPINBOX_GetValue(hSPNBX_Day));
-        HAL_RTC_SetDate(&hrtc, &rtcdt, RTC_FORMAT_BCD);
-        RtcTimeValidSet();
-    }
-    if (rtcdt.Month != Dec2Bcd(SPINBOX_GetValue(hSPNBX_Month))) {
-        rtcdt.Month = Dec2Bcd(SPINBOX_GetValue(hSPNBX_Month));
-        HAL_RTC_SetDate(&hrtc, &rtcdt, RTC_FORMAT_BCD);
-        RtcTimeValidSet();
-    }
-    if (rtcdt.Year != Dec2Bcd(SPINBOX_GetValue(hSPNBX_Year) - 2000)) {
-        rtcdt.Year = Dec2Bcd(SPINBOX_GetValue(hSPNBX_Year) - 2000);
-        HAL_RTC_SetDate(&hrtc, &rtcdt, RTC_FORMAT_BCD);
-        RtcTimeValidSet();
-    }
-    if (rtcdt.WeekDay != (DROPDOWN_GetSel(hDRPDN_WeekDay) + 1)) { // Poređenje sa Dec vrijednošću
-        rtcdt.WeekDay = (DROPDOWN_GetSel(hDRPDN_WeekDay) + 1);
-        HAL_RTC_SetDate(&hrtc, &rtcdt, RTC_FORMAT_BCD);
-        RtcTimeValidSet();
-    }
-
     /**
-     * @brief << ISPRAVKA: Ažuriranje prikaza boje screensaver sata. >>
-     * @note  Sada, kada se detektuje promjena vrijednosti u spinbox-u,
-     * prvo se postavlja nova boja sa `GUI_SetColor`, a tek onda se
-     * ponovo iscrtava pravougaonik za pregled.
+     * @brief Događaji promjene iz `settings_model`.
+     * @note  Vrijednosti su već upisane (`Settings_Write()`); ovdje se samo
+     * ponovo iscrtava pregled boje screensaver sata kad se boja promijeni.
      */
-    if (g_display_settings.scrnsvr_clk_clr != SPINBOX_GetValue(hSPNBX_ScrnsvrClockColour)) {
-        g_display_settings.scrnsvr_clk_clr = SPINBOX_GetValue(hSPNBX_ScrnsvrClockColour);
-
-        // Prvo postavimo novu boju
-        GUI_SetColor(clk_clrs[g_display_settings.scrnsvr_clk_clr]);
-        // Zatim iscrtamo pravougaonik tom bojom
-        GUI_FillRect(settings_screen_2_layout.scrnsvr_color_preview_rect.x0, settings_screen_2_layout.scrnsvr_color_preview_rect.y0,
-                     settings_screen_2_layout.scrnsvr_color_preview_rect.x1, settings_screen_2_layout.scrnsvr_color_preview_rect.y1);
-    }
-
-    // << ISPRAVKA 3: Ispravljena logika ažuriranja screensaver postavki >>
-    // Prvo ažuriramo konfiguracionu varijablu na osnovu stanja checkbox-a.
-    if (g_display_settings.scrnsvr_on_off != (bool)CHECKBOX_GetState(hCHKBX_ScrnsvrClock)) {
-        g_display_settings.scrnsvr_on_off = (bool)CHECKBOX_GetState(hCHKBX_ScrnsvrClock);
-        settingsChanged = 1; // Signaliziramo da je došlo do promjene za snimanje
-    }
-
-    // Zatim, na osnovu te konfiguracione varijable, ažuriramo runtime fleg.
-    if (g_display_settings.scrnsvr_on_off) {
-        ScrnsvrClkSet();
-    } else {
-        ScrnsvrClkReset();
+    uint8_t key;
+    int32_t value;
+    while (SettingsModel_Next(&settings_model, &key, &value)) {
+        if (key == SETTING_SCRNSVR_CLK_COLOUR) {
+            GUI_SetColor(clk_clrs[value]);
+            GUI_FillRect(settings_screen_2_layout.scrnsvr_color_preview_rect.x0, settings_screen_2_layout.scrnsvr_color_preview_rect.y0,
+                         settings_screen_2_layout.scrnsvr_color_preview_rect.x1, settings_screen_2_layout.scrnsvr_color_preview_rect.y1);
+        }
     }
 
-    /** @brief Ažuriranje ostalih konfiguracionih varijabli. */
-    g_display_settings.high_bcklght = SPINBOX_GetValue(hSPNBX_DisplayHighBrightness);
-    g_display_settings.low_bcklght = SPINBOX_GetValue(hSPNBX_DisplayLowBrightness);
-    g_display_settings.scrnsvr_tout = SPINBOX_GetValue(hSPNBX_ScrnsvrTimeout);
-    g_display_settings.scrnsvr_ena_hour = SPINBOX_GetValue(hSPNBX_ScrnsvrEnableHour);
-    g_display_settings.scrnsvr_dis_hour = SPINBOX_GetValue(hSPNBX_ScrnsvrDisableHour);
-
     /** @brief Obrada pritiska na dugmad "SAVE" i "NEXT". */
     if (BUTTON_IsPressed(hBUTTON_Ok)) {
         if (thsta) {
@@ -10166,45 +11614,7 @@ static void Service_SettingsScreen_3(void)
     Defroster_Handle* defHandle = Defroster_GetInstance();
     Ventilator_Handle* ventHandle = Ventilator_GetInstance();
 
-    // Provjera promjena na widgetima DEFROSTER
-    if(Defroster_getCycleTime(defHandle) != SPINBOX_GetValue(defroster_settingWidgets.cycleTime)) {
-        Defroster_setCycleTime(defHandle, SPINBOX_GetValue(defroster_settingWidgets.cycleTime));
-        settingsChanged = 1;
-    }
-    if(Defroster_getActiveTime(defHandle) != SPINBOX_GetValue(defroster_settingWidgets.activeTime)) {
-        Defroster_setActiveTime(defHandle, SPINBOX_GetValue(defroster_settingWidgets.activeTime));
-        settingsChanged = 1;
-    }
-    if(Defroster_getPin(defHandle) != SPINBOX_GetValue(defroster_settingWidgets.pin)) {
-        Defroster_setPin(defHandle, SPINBOX_GetValue(defroster_settingWidgets.pin));
-        settingsChanged = 1;
-    }
-
-    // Provjera promjena na widgetima VENTILATOR
-    if(Ventilator_getRelay(ventHandle) != SPINBOX_GetValue(hVentilatorRelay)) {
-        Ventilator_setRelay(ventHandle, SPINBOX_GetValue(hVentilatorRelay));
-        settingsChanged = 1;
-    }
-    if(Ventilator_getDelayOnTime(ventHandle) != SPINBOX_GetValue(hVentilatorDelayOn)) {
-        Ventilator_setDelayOnTime(ventHandle, SPINBOX_GetValue(hVentilatorDelayOn));
-        settingsChanged = 1;
-    }
-    if(Ventilator_getDelayOffTime(ventHandle) != SPINBOX_GetValue(hVentilatorDelayOff)) {
-        Ventilator_setDelayOffTime(ventHandle, SPINBOX_GetValue(hVentilatorDelayOff));
-        settingsChanged = 1;
-    }
-    if(Ventilator_getTriggerSource1(ventHandle) != SPINBOX_GetValue(hVentilatorTriggerSource1)) {
-        Ventilator_setTriggerSource1(ventHandle, SPINBOX_GetValue(hVentilatorTriggerSource1));
-        settingsChanged = 1;
-    }
-    if(Ventilator_getTriggerSource2(ventHandle) != SPINBOX_GetValue(hVentilatorTriggerSource2)) {
-        Ventilator_setTriggerSource2(ventHandle, SPINBOX_GetValue(hVentilatorTriggerSource2));
-        settingsChanged = 1;
-    }
-    if(Ventilator_getLocalPin(ventHandle) != SPINBOX_GetValue(hVentilatorLocalPin)) {
-        Ventilator_setLocalPin(ventHandle, SPINBOX_GetValue(hVentilatorLocalPin));
-        settingsChanged = 1;
-    }
+    // Promjene widgeta upisuje `Settings_OnNotify()` čim se dese (`settings_model`).
 
     if (BUTTON_IsPressed(hBUTTON_Ok)) {
         if(settingsChanged) {
@@ -10433,7 +11843,7 @@ static void Service_SettingsScreen_5(void)
         GUI_SetTextAlign(GUI_TA_HCENTER);
         GUI_DispStringAt(lng(primary_text_id), x_icon_pos + (icon_bitmap->XSize / 2), y_primary_text_pos);
 
-        GUI_DrawBitmap(icon_bitmap, x_icon_pos, y_icon_pos);
+        DrawIcon(icon_bitmap, x_icon_pos, y_icon_pos);
 
         // Vraćanje poziva za poravnanje
         GUI_SetTextAlign(GUI_TA_HCENTER);
@@ -10521,6 +11931,8 @@ static void Service_SettingsScreen_6(void)
     if (current_language_selection != old_language_selection) {
         old_language_selection = current_language_selection;
         g_display_settings.language = current_language_selection;
+        GuiStatic_InvalidateAll(&static_layers);
+        TextLayout_InvalidateAll(&text_layout);
         settingsChanged = 1;
         DSP_KillSet6Scrn();
         DSP_InitSet6Scrn();
@@ -10741,7 +12153,7 @@ static void Service_SettingsScreen_8(void)
             GUI_SetTextAlign(GUI_TA_HCENTER);
             GUI_DispStringAt(lng(mapping->primary_text_id), x_icon_pos + (icon_bitmap->XSize / 2), y_primary_text_pos);
 
-            GUI_DrawBitmap(icon_bitmap, x_icon_pos, y_icon_pos);
+            DrawIcon(icon_bitmap, x_icon_pos, y_icon_pos);
 
             GUI_SetTextAlign(GUI_TA_HCENTER);
             GUI_SetColor(GUI_ORANGE);
@@ -10792,29 +12204,29 @@ static void Service_SettingsScreen_9(void)
     // Provjera promjena na postavkama Particija
     for (int i = 0; i < SECURITY_PARTITION_COUNT; i++) {
         // Provjera releja za particiju 'i'
-        if (Security_GetPartitionRelayAddr(i) != SPINBOX_GetValue(WM_GetDialogItem(WM_GetDesktopWindow(), ID_ALARM_RELAY_P1 + i))) {
-            Security_SetPartitionRelayAddr(i, SPINBOX_GetValue(WM_GetDialogItem(WM_GetDesktopWindow(), ID_ALARM_RELAY_P1 + i)));
+        if (Security_GetPartitionRelayAddr(i) != SPINBOX_GetValue(Widget_Find(ID_ALARM_RELAY_P1 + i))) {
+            Security_SetPartitionRelayAddr(i, SPINBOX_GetValue(Widget_Find(ID_ALARM_RELAY_P1 + i)));
             settingsChanged = 1;
         }
         // Provjera feedback-a za particiju 'i'
-        if (Security_GetPartitionFeedbackAddr(i) != SPINBOX_GetValue(WM_GetDialogItem(WM_GetDesktopWindow(), ID_ALARM_FB_P1 + i))) {
-            Security_SetPartitionFeedbackAddr(i, SPINBOX_GetValue(WM_GetDialogItem(WM_GetDesktopWindow(), ID_ALARM_FB_P1 + i)));
+        if (Security_GetPartitionFeedbackAddr(i) != SPINBOX_GetValue(Widget_Find(ID_ALARM_FB_P1 + i))) {
+            Security_SetPartitionFeedbackAddr(i, SPINBOX_GetValue(Widget_Find(ID_ALARM_FB_P1 + i)));
             settingsChanged = 1;
         }
     }
     
     // Provjera promjena na zajedničkim postavkama
     // Za dužinu pulsa, vrijednost iz spinbox-a (0-50) se množi sa 100 da bi se dobile milisekunde (0-5000)
-    if (Security_GetPulseDuration() != (SPINBOX_GetValue(WM_GetDialogItem(WM_GetDesktopWindow(), ID_ALARM_PULSE_LENGTH)) * 100)) {
-        Security_SetPulseDuration(SPINBOX_GetValue(WM_GetDialogItem(WM_GetDesktopWindow(), ID_ALARM_PULSE_LENGTH)) * 100);
+    if (Security_GetPulseDuration() != (SPINBOX_GetValue(Widget_Find(ID_ALARM_PULSE_LENGTH)) * 100)) {
+        Security_SetPulseDuration(SPINBOX_GetValue(Widget_Find(ID_ALARM_PULSE_LENGTH)) * 100);
         settingsChanged = 1;
     }
-    if (Security_GetSystemStatusFeedbackAddr() != SPINBOX_GetValue(WM_GetDialogItem(WM_GetDesktopWindow(), ID_ALARM_FB_SYSTEM_STATUS))) {
-        Security_SetSystemStatusFeedbackAddr(SPINBOX_GetValue(WM_GetDialogItem(WM_GetDesktopWindow(), ID_ALARM_FB_SYSTEM_STATUS)));
+    if (Security_GetSystemStatusFeedbackAddr() != SPINBOX_GetValue(Widget_Find(ID_ALARM_FB_SYSTEM_STATUS))) {
+        Security_SetSystemStatusFeedbackAddr(SPINBOX_GetValue(Widget_Find(ID_ALARM_FB_SYSTEM_STATUS)));
         settingsChanged = 1;
     }
-    if (Security_GetSilentAlarmAddr() != SPINBOX_GetValue(WM_GetDialogItem(WM_GetDesktopWindow(), ID_ALARM_RELAY_SILENT))) {
-        Security_SetSilentAlarmAddr(SPINBOX_GetValue(WM_GetDialogItem(WM_GetDesktopWindow(), ID_ALARM_RELAY_SILENT)));
+    if (Security_GetSilentAlarmAddr() != SPINBOX_GetValue(Widget_Find(ID_ALARM_RELAY_SILENT))) {
+        Security_SetSilentAlarmAddr(SPINBOX_GetValue(Widget_Find(ID_ALARM_RELAY_SILENT)));
         settingsChanged = 1;
     }
     
@@ -10824,6 +12236,14 @@ static void Service_SettingsScreen_9(void)
         settingsChanged = 1; // Ova promjena se snima pomoću Display_Save()
     }
 
+    // Dozvola daljinskog pregleda važi odmah (isključenje gasi pregled u toku) i snima se odmah
+    if(remote_view_allowed != (bool)CHECKBOX_GetState(hCHKBX_RemoteView)) {
+        uint8_t consent;
+        remote_view_allowed = (bool)CHECKBOX_GetState(hCHKBX_RemoteView);
+        consent = remote_view_allowed ? REMOTE_VIEW_CONSENT : 0xFFU;
+        EE_WriteBuffer(&consent, EE_REMOTE_VIEW, 1);
+    }
+
     // Obrada navigacije i snimanja
     if (BUTTON_IsPressed(hBUTTON_Ok)) {
         if (settingsChanged) { 
@@ -10927,10 +12347,10 @@ static void Service_LightSettingsScreen(void)
         if (show_rgb_palette) {
             GUI_SetColor(GUI_WHITE);
             GUI_FillRect(WHITE_SQUARE_X0, WHITE_SQUARE_Y0, WHITE_SQUARE_X0 + WHITE_SQUARE_SIZE - 1, WHITE_SQUARE_Y0 + WHITE_SQUARE_SIZE - 1);
-            GUI_DrawBitmap(&bmblackWhiteGradient, sliderX0, sliderY0);
-            GUI_DrawBitmap(&bmcolorSpectrum, centerX - (paletteWidth / 2), sliderY0 + sliderHeight + 20);
+            DrawIcon(&bmblackWhiteGradient, sliderX0, sliderY0);
+            DrawIcon(&bmcolorSpectrum, centerX - (paletteWidth / 2), sliderY0 + sliderHeight + 20);
         } else if (show_dimmer_slider) {
-            GUI_DrawBitmap(&bmblackWhiteGradient, sliderX0, sliderY0);
+            DrawIcon(&bmblackWhiteGradient, sliderX0, sliderY0);
         }
 
         // === POČETAK NOVE LOGIKE ZA ISPIS NASLOVA/NAZIVA ===
@@ -11289,7 +12709,6 @@ static void Service_TimerScreen(void)
     // Crtamo samo ako je eksplicitno zatraženo
     if (shouldDrawScreen) {
         shouldDrawScreen = 0;
-        ForceKillAllSettingsWidgets();
         GUI_MULTIBUF_BeginEx(1);
         GUI_Clear();
         DrawHamburgerMenu(1); // Meni za povratak
@@ -11302,7 +12721,7 @@ static void Service_TimerScreen(void)
             const GUI_BITMAP* datetime_icon = &bmicons_date_time;
 
             // Jedina izmjena: pozicije se sada čitaju iz layout strukture
-            GUI_DrawBitmap(datetime_icon, timer_screen_layout.datetime_icon_pos.x, timer_screen_layout.datetime_icon_pos.y);
+            DrawIcon(datetime_icon, timer_screen_layout.datetime_icon_pos.x, timer_screen_layout.datetime_icon_pos.y);
 
             GUI_SetFont(&GUI_FontVerdana20_LAT);
             GUI_SetColor(GUI_WHITE);
@@ -11348,7 +12767,7 @@ static void Service_TimerScreen(void)
             // Prikaz ON/OFF toggle ikonice
             GUI_CONST_STORAGE GUI_BITMAP* icon_toggle = Timer_IsActive() ? &bmicons_toggle_on : &bmicons_toogle_off;
             int toggle_x = (DRAWING_AREA_WIDTH / 2) - (icon_toggle->XSize / 2);
-            GUI_DrawBitmap(icon_toggle, toggle_x, timer_screen_layout.toggle_icon_pos.y);
+            DrawIcon(icon_toggle, toggle_x, timer_screen_layout.toggle_icon_pos.y);
 
             // Prikaz novog statusnog teksta
             GUI_SetFont(&GUI_FontVerdana20_LAT);
@@ -11835,7 +13254,7 @@ static void Service_AlarmActiveScreen(void)
         GUI_Clear();
 
         // Dummy poziv za animaciju (kasnije možete implementirati pravu)
-        GUI_DrawBitmap(&bmicons_security_sos, 380, 20);
+        DrawIcon(&bmicons_security_sos, 380, 20);
 
         // Korištenje ispravnog fonta koji podržava slova
         GUI_SetFont(&GUI_FontVerdana32_LAT);
@@ -11862,171 +13281,222 @@ static void Service_AlarmActiveScreen(void)
  */
 static void Service_GateScreen(void)
 {
-    // Iscrtavanje se vrši samo ako je eksplicitno zatraženo.
-    if (shouldDrawScreen) {
+    // Iscrtavanje se vrši samo ako je eksplicitno zatraženo: `shouldDrawScreen`
+    // traži cijeli ekran, `DISP_InvalidateGate()` samo pločicu jedne kapije.
+    if (shouldDrawScreen || !GuiDirty_IsEmpty(&gui_dirty)) {
+        if (shouldDrawScreen) GuiDirty_InvalidateAll(&gui_dirty);
         shouldDrawScreen = 0;
 
         GUI_MULTIBUF_BeginEx(1);
-        GUI_Clear();
-        DrawHamburgerMenu(1);
+        for (uint8_t i = 0; i < GuiDirty_Count(&gui_dirty); ++i)
+        {
+            GuiRect_t dirty_rect;
+            GUI_RECT area;
+
+            GuiDirty_Get(&gui_dirty, i, &dirty_rect);
+            area.x0 = dirty_rect.x0;
+            area.y0 = dirty_rect.y0;
+            area.x1 = dirty_rect.x1;
+            area.y1 = dirty_rect.y1;
+
+            // Sve izvan `area` odsijeca emWin, pa ostatak ekrana ostaje netaknut.
+            GUI_SetClipRect(&area);
+            GUI_ClearRectEx(&area);
+            DrawHamburgerMenu(1);
+            DrawGateScreen(&area);
+        }
+        GUI_SetClipRect(NULL);
+        GuiDirty_Commit(&gui_dirty);
+        GUI_MULTIBUF_EndEx(1);
+    }
+}
 
-        uint8_t gate_count = Gate_GetCount();
+/**
+ ******************************************************************************
+ * @brief       Iscrtava ikonice i labele kapija koje se sijeku sa zadanim područjem.
+ * @author      Gemini & [Vaše Ime]
+ * @note        Font se bira za SVE kapije, tako da djelimično iscrtana pločica
+ * ima isti font kao i ostatak ekrana.
+ * @param       area Područje koje se ponovo crta (clip je već postavljen).
+ ******************************************************************************
+ */
+static void DrawGateScreen(const GUI_RECT* area)
+{
+    uint8_t gate_count = Gate_GetCount();
 
-        if (gate_count == 0) {
-            GUI_SetFont(&GUI_FontVerdana20_LAT);
-            GUI_SetColor(GUI_WHITE);
-            GUI_SetTextAlign(GUI_TA_HCENTER | GUI_TA_VCENTER);
-            GUI_DispStringAt(lng(TXT_CONFIGURE_DEVICE_MSG), DRAWING_AREA_WIDTH / 2, LCD_GetYSize() / 2);
-        } else {
-            // =======================================================================
-            // === FAZA 1: PRE-KALKULACIJA I ODABIR FONTA (identično kao kod svjetala) ===
-            // =======================================================================
-            const GUI_FONT* fontToUse = &GUI_FontVerdana20_LAT;
-            const int text_padding = 10;
-            bool downgrade_font = false;
+    if (gate_count == 0) {
+        GUI_SetFont(&GUI_FontVerdana20_LAT);
+        GUI_SetColor(GUI_WHITE);
+        GUI_SetTextAlign(GUI_TA_HCENTER | GUI_TA_VCENTER);
+        GUI_DispStringAt(lng(TXT_CONFIGURE_DEVICE_MSG), DRAWING_AREA_WIDTH / 2, LCD_GetYSize() / 2);
+    } else {
+        // =======================================================================
+        // === FAZA 1: ODABIR FONTA (identično kao kod svjetala, iz keša `text_layout`) ===
+        // =======================================================================
+        const uint8_t label_font = GateScreen_ChooseFont(gate_count);
+        const GUI_FONT* fontToUse = label_fonts[label_font];
+
+        // =======================================================================
+        // === FAZA 2: ISCRTAVANJE IKONICA SA NOVOM LAYOUT STRUKTUROM ===
+        // =======================================================================
+        uint8_t rows = (gate_count > 3) ? 2 : 1;
+        int y_row_start = (rows > 1)
+                          ? lights_and_gates_grid_layout.y_start_pos_multi_row
+                          : lights_and_gates_grid_layout.y_start_pos_single_row;
+
+        const int y_row_height = lights_and_gates_grid_layout.row_height;
+        uint8_t gatesInRowSum = 0;
+
+        for(uint8_t row = 0; row < rows; ++row) {
+            uint8_t gatesInRow = GateScreen_GetGatesInRow(gate_count, row);
+            uint8_t currentGatesMenuSpaceBetween = (400 - (80 * gatesInRow)) / (gatesInRow - 1 + 2);
 
-            for(uint8_t i = 0; i < gate_count; ++i) {
-                uint8_t gates_total = gate_count;
-                uint8_t gates_in_this_row = 0;
-                if (gates_total <= 3) gates_in_this_row = gates_total;
-                else if (gates_total == 4) gates_in_this_row = 2;
-                else if (gates_total == 5) gates_in_this_row = 3;
-                else gates_in_this_row = 3;
+            for(uint8_t idx_in_row = 0; idx_in_row < gatesInRow; ++idx_in_row) {
+                uint8_t absolute_gate_index = gatesInRowSum + idx_in_row;
+                if (absolute_gate_index >= gate_count) break;
 
-                int max_width_per_icon = (DRAWING_AREA_WIDTH / gates_in_this_row) - text_padding;
+                // Pločice izvan područja koje se crta se preskaču.
+                GUI_RECT tile;
+                if (GateScreen_GetTileRect(absolute_gate_index, &tile) && !GUI_RectsIntersect(&tile, area)) continue;
 
-                Gate_Handle* handle = Gate_GetInstance(i);
+                Gate_Handle* handle = Gate_GetInstance(absolute_gate_index);
                 if (handle) {
                     uint8_t appearance_id = Gate_GetAppearanceId(handle);
-                    // === SIGURNOSNA PROVJERA #1 (Dio rješenja) ===
+                    const char* custom_label = Gate_GetCustomLabel(handle);
+
+                    // === POČETAK GLAVNE ISPRAVKE: SIGURNOSNA PROVJERA PRIJE CRTANJA ===
+                    // Provjeravamo da li je appearance_id validan indeks za niz.
+                    // Ako nije, preskačemo crtanje ove ikonice i nastavljamo sa sljedećom,
+                    // čime se sprječava pad sistema.
                     if (appearance_id < (sizeof(gate_appearance_mapping_table) / sizeof(IconMapping_t))) {
                         const IconMapping_t* mapping = &gate_appearance_mapping_table[appearance_id];
-                        GUI_SetFont(&GUI_FontVerdana20_LAT);
-
-                        if (GUI_GetStringDistX(lng(mapping->primary_text_id)) > max_width_per_icon || GUI_GetStringDistX(lng(mapping->secondary_text_id)) > max_width_per_icon) {
-                            downgrade_font = true;
+                        GateState_e state = Gate_GetState(handle);
+                        IconID visual_icon_type = mapping->visual_icon_id;
+                        const GUI_BITMAP* icon_to_draw = NULL;
+
+                        uint8_t icon_state_index = 0;
+                        switch (state) {
+                        case GATE_STATE_CLOSED:
+                            icon_state_index = 0;
+                            break;
+                        case GATE_STATE_OPEN:
+                            icon_state_index = 1;
+                            break;
+                        case GATE_STATE_OPENING:
+                            icon_state_index = 2;
+                            break;
+                        case GATE_STATE_CLOSING:
+                            icon_state_index = 3;
+                            break;
+                        case GATE_STATE_PARTIALLY_OPEN:
+                            icon_state_index = 4;
+                            break;
+                        default:
+                            icon_state_index = 0;
                             break;
                         }
-                    }
-                }
-            }
 
-            if (downgrade_font) {
-                fontToUse = &GUI_FontVerdana16_LAT;
-            }
-
-            // =======================================================================
-            // === FAZA 2: ISCRTAVANJE IKONICA SA NOVOM LAYOUT STRUKTUROM ===
-            // =======================================================================
-            uint8_t rows = (gate_count > 3) ? 2 : 1;
-            int y_row_start = (rows > 1)
-                              ? lights_and_gates_grid_layout.y_start_pos_multi_row
-                              : lights_and_gates_grid_layout.y_start_pos_single_row;
-
-            const int y_row_height = lights_and_gates_grid_layout.row_height;
-            uint8_t gatesInRowSum = 0;
-
-            for(uint8_t row = 0; row < rows; ++row) {
-                uint8_t gatesInRow = gate_count;
-                if (gate_count > 3) {
-                    if (gate_count == 4) gatesInRow = 2;
-                    else if (gate_count == 5) gatesInRow = (row > 0) ? 2 : 3;
-                    else gatesInRow = 3;
-                }
-                uint8_t currentGatesMenuSpaceBetween = (400 - (80 * gatesInRow)) / (gatesInRow - 1 + 2);
-
-                for(uint8_t idx_in_row = 0; idx_in_row < gatesInRow; ++idx_in_row) {
-                    uint8_t absolute_gate_index = gatesInRowSum + idx_in_row;
-                    if (absolute_gate_index >= gate_count) break;
-
-                    Gate_Handle* handle = Gate_GetInstance(absolute_gate_index);
-                    if (handle) {
-                        uint8_t appearance_id = Gate_GetAppearanceId(handle);
-                        const char* custom_label = Gate_GetCustomLabel(handle);
-
-                        // === POČETAK GLAVNE ISPRAVKE: SIGURNOSNA PROVJERA PRIJE CRTANJA ===
-                        // Provjeravamo da li je appearance_id validan indeks za niz.
-                        // Ako nije, preskačemo crtanje ove ikonice i nastavljamo sa sljedećom,
-                        // čime se sprječava pad sistema.
-                        if (appearance_id < (sizeof(gate_appearance_mapping_table) / sizeof(IconMapping_t))) {
-                            const IconMapping_t* mapping = &gate_appearance_mapping_table[appearance_id];
-                            GateState_e state = Gate_GetState(handle);
-                            IconID visual_icon_type = mapping->visual_icon_id;
-                            const GUI_BITMAP* icon_to_draw = NULL;
-
-                            uint8_t icon_state_index = 0;
-                            switch (state) {
-                            case GATE_STATE_CLOSED:
-                                icon_state_index = 0;
-                                break;
-                            case GATE_STATE_OPEN:
-                                icon_state_index = 1;
-                                break;
-                            case GATE_STATE_OPENING:
-                                icon_state_index = 2;
-                                break;
-                            case GATE_STATE_CLOSING:
-                                icon_state_index = 3;
-                                break;
-                            case GATE_STATE_PARTIALLY_OPEN:
-                                icon_state_index = 4;
-                                break;
-                            default:
-                                icon_state_index = 0;
-                                break;
+                        // Druga sigurnosna provjera: da li je izračunati indeks za ikonicu validan.
+                        uint16_t base_icon_index = (visual_icon_type - ICON_GATE_SWING) * 5;
+                        uint16_t final_icon_index = base_icon_index + icon_state_index;
+
+                        if (final_icon_index < (sizeof(gate_icon_images) / sizeof(gate_icon_images[0]))) {
+                            icon_to_draw = gate_icon_images[final_icon_index];
+
+                            GUI_SetFont(fontToUse);
+                            const int font_height = GUI_GetFontDistY();
+                            const int icon_height = icon_to_draw->YSize;
+                            const int icon_width = icon_to_draw->XSize;
+                            const int padding = lights_and_gates_grid_layout.text_icon_padding;
+                            const int total_block_height = font_height + padding + icon_height + padding + font_height;
+                            const int y_slot_center = y_row_start + (y_row_height / 2);
+                            const int y_block_start = y_slot_center - (total_block_height / 2);
+                            const int x_slot_start = (currentGatesMenuSpaceBetween * (idx_in_row + 1)) + (80 * idx_in_row);
+                            const int x_text_center = x_slot_start + 40;
+
+                            const int y_primary_text_pos = y_block_start;
+                            const int y_icon_pos = y_primary_text_pos + font_height + padding;
+                            const int y_secondary_text_pos = y_icon_pos + icon_height + padding;
+
+                            GUI_SetTextMode(GUI_TM_TRANS);
+                            GUI_SetTextAlign(GUI_TA_HCENTER);
+                            GUI_SetColor(GUI_WHITE);
+                            if (custom_label[0] == '\0') {
+                                GUI_DispStringAt(Labels_Text(mapping->primary_text_id, label_font), x_text_center, y_primary_text_pos);
                             }
 
-                            // Druga sigurnosna provjera: da li je izračunati indeks za ikonicu validan.
-                            uint16_t base_icon_index = (visual_icon_type - ICON_GATE_SWING) * 5;
-                            uint16_t final_icon_index = base_icon_index + icon_state_index;
-
-                            if (final_icon_index < (sizeof(gate_icon_images) / sizeof(gate_icon_images[0]))) {
-                                icon_to_draw = gate_icon_images[final_icon_index];
-
-                                GUI_SetFont(fontToUse);
-                                const int font_height = GUI_GetFontDistY();
-                                const int icon_height = icon_to_draw->YSize;
-                                const int icon_width = icon_to_draw->XSize;
-                                const int padding = lights_and_gates_grid_layout.text_icon_padding;
-                                const int total_block_height = font_height + padding + icon_height + padding + font_height;
-                                const int y_slot_center = y_row_start + (y_row_height / 2);
-                                const int y_block_start = y_slot_center - (total_block_height / 2);
-                                const int x_slot_start = (currentGatesMenuSpaceBetween * (idx_in_row + 1)) + (80 * idx_in_row);
-                                const int x_text_center = x_slot_start + 40;
-
-                                const int y_primary_text_pos = y_block_start;
-                                const int y_icon_pos = y_primary_text_pos + font_height + padding;
-                                const int y_secondary_text_pos = y_icon_pos + icon_height + padding;
-
-                                GUI_SetTextMode(GUI_TM_TRANS);
-                                GUI_SetTextAlign(GUI_TA_HCENTER);
-                                GUI_SetColor(GUI_WHITE);
-                                if (custom_label[0] == '\0') {
-                                    GUI_DispStringAt(lng(mapping->primary_text_id), x_text_center, y_primary_text_pos);
-                                }
-
-                                GUI_DrawBitmap(icon_to_draw, x_text_center - (icon_width / 2), y_icon_pos);
+                            DrawIcon(icon_to_draw, x_text_center - (icon_width / 2), y_icon_pos);
 
-                                GUI_SetTextMode(GUI_TM_TRANS);
-                                GUI_SetTextAlign(GUI_TA_HCENTER);
-                                GUI_SetColor(GUI_ORANGE);
-                                if (custom_label[0] != '\0') {
-                                    GUI_DispStringAt(custom_label, x_text_center, y_secondary_text_pos);
-                                } else {
-                                    GUI_DispStringAt(lng(mapping->secondary_text_id), x_text_center, y_secondary_text_pos);
-                                }
+                            GUI_SetTextMode(GUI_TM_TRANS);
+                            GUI_SetTextAlign(GUI_TA_HCENTER);
+                            GUI_SetColor(GUI_ORANGE);
+                            if (custom_label[0] != '\0') {
+                                GUI_DispStringAt(custom_label, x_text_center, y_secondary_text_pos);
+                            } else {
+                                GUI_DispStringAt(Labels_Text(mapping->secondary_text_id, label_font), x_text_center, y_secondary_text_pos);
                             }
                         }
-                        // === KRAJ GLAVNE ISPRAVKE ===
                     }
+                    // === KRAJ GLAVNE ISPRAVKE ===
                 }
-                gatesInRowSum += gatesInRow;
-                y_row_start += y_row_height;
             }
+            gatesInRowSum += gatesInRow;
+            y_row_start += y_row_height;
         }
-        GUI_MULTIBUF_EndEx(1);
     }
 }
+
+/**
+ * @brief Vraća broj kapija u zadanom redu ekrana `SCREEN_GATE`.
+ */
+static uint8_t GateScreen_GetGatesInRow(uint8_t gate_count, uint8_t row)
+{
+    uint8_t gatesInRow = gate_count;
+    if (gate_count > 3) {
+        if (gate_count == 4) gatesInRow = 2;
+        else if (gate_count == 5) gatesInRow = (row > 0) ? 2 : 3;
+        else gatesInRow = 3;
+    }
+    return gatesInRow;
+}
+
+/**
+ * @brief Računa pločicu (ćeliju) jedne kapije: ikonicu sa obje labele.
+ * @note Isti raspored kao `LightsScreen_GetTileRect()`.
+ * @param index Indeks kapije.
+ * @param rect Izlaz: pravougaonik pločice (uključive koordinate).
+ * @retval bool `false` ako kapija nije na ekranu.
+ */
+static bool GateScreen_GetTileRect(uint8_t index, GUI_RECT* rect)
+{
+    uint8_t gate_count = Gate_GetCount();
+    uint8_t rows = (gate_count > 3) ? 2 : 1;
+    int y_row_start = (rows > 1)
+                      ? lights_and_gates_grid_layout.y_start_pos_multi_row
+                      : lights_and_gates_grid_layout.y_start_pos_single_row;
+    uint8_t gatesInRowSum = 0;
+
+    for(uint8_t row = 0; row < rows; ++row) {
+        uint8_t gatesInRow = GateScreen_GetGatesInRow(gate_count, row);
+
+        if (index < (gatesInRowSum + gatesInRow)) {
+            uint8_t idx_in_row = index - gatesInRowSum;
+            uint8_t currentGatesMenuSpaceBetween = (400 - (80 * gatesInRow)) / (gatesInRow - 1 + 2);
+            int x_text_center = (currentGatesMenuSpaceBetween * (idx_in_row + 1)) + (80 * idx_in_row) + 40;
+            int half_cell = (DRAWING_AREA_WIDTH / gatesInRow) / 2;
+
+            rect->x0 = x_text_center - half_cell;
+            rect->x1 = x_text_center + half_cell - 1;
+            rect->y0 = y_row_start;
+            rect->y1 = y_row_start + lights_and_gates_grid_layout.row_height - 1;
+            return true;
+        }
+        gatesInRowSum += gatesInRow;
+        y_row_start += lights_and_gates_grid_layout.row_height;
+    }
+    return false;
+}
+
 /**
  ******************************************************************************
  * @brief       Servisira ekran za detaljnu kontrolu kapije.
@@ -12190,7 +13660,7 @@ static void Service_GateSettingsScreen(void)
                 // Kalkulacija za centriranje velike ikonice
                 int x_pos = (DRAWING_AREA_WIDTH / 2) - (icon_to_draw->XSize / 2);
                 int y_pos = 110 - (icon_to_draw->YSize / 2); // Vertikalno centrirano u gornjem dijelu
-                GUI_DrawBitmap(icon_to_draw, x_pos, y_pos);
+                DrawIcon(icon_to_draw, x_pos, y_pos);
             }
         }
         // === KRAJ BLOKA ZA ZAMJENU ===
@@ -12303,7 +13773,7 @@ static void Service_SecurityScreen(void)
 
     // Obrada pritiska na dugmad (logika ostaje nepromijenjena)
     for (int i = 0; i <= SECURITY_PARTITION_COUNT; i++) {
-         WM_HWIN hBtn = WM_GetDialogItem(WM_GetDesktopWindow(), GUI_ID_USER + i);
+         WM_HWIN hBtn = Widget_Find(GUI_ID_USER + i);
          if (hBtn && BUTTON_IsPressed(hBtn)) {
              selected_action = i;
              DSP_KillSecurityScreen();
@@ -12326,7 +13796,7 @@ static void DSP_KillSecurityScreen(void)
     WM_HWIN hItem;
     // Petlja briše dugme "SYSTEM" (ID_USER + 0) i dugmad za particije (ID_USER + 1 do +3)
     for (int i = 0; i <= SECURITY_PARTITION_COUNT; i++) {
-        hItem = WM_GetDialogItem(WM_GetDesktopWindow(), GUI_ID_USER + i);
+        hItem = Widget_Find(GUI_ID_USER + i);
         if (WM_IsWindow(hItem)) {
             WM_DeleteWindow(hItem);
         }
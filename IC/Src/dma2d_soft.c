@@ -0,0 +1,248 @@
+/**
+ ******************************************************************************
+ * @file    dma2d_soft.c
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Implementacija softverskog DMA2D backend-a (samo za host).
+ *
+ * @note    Miješanje slijedi formulu iz referentnog priručnika za DMA2D:
+ * aMult = aFG * aBG / 255, aOUT = aFG + aBG - aMult,
+ * C = (C_FG * aFG + C_BG * aBG - C_BG * aMult) / aOUT.
+ * Zaokruživanje se može razlikovati od hardvera za najviše 1 LSB.
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* UKLJUCENI FAJLOVI (INCLUDES)                                               */
+/*============================================================================*/
+#include "dma2d_soft.h"
+#include <string.h>
+
+/*============================================================================*/
+/* PRIVATNE VARIJABLE                                                         */
+/*============================================================================*/
+static Dma2dQueue_t *soft_queue;
+static const uint32_t *soft_clut;
+static void (*soft_trace)(const Dma2dJob_t *job);
+static Dma2dJob_t soft_job;
+static bool soft_pending;
+static uint32_t soft_unsupported;
+static uint32_t soft_fgcolr;
+
+/*============================================================================*/
+/* PROTOTIPOVI PRIVATNIH FUNKCIJA                                             */
+/*============================================================================*/
+static void Soft_Start(const Dma2dJob_t *job);
+static void Soft_Idle(void);
+static void Soft_Lock(void);
+static void Soft_Unlock(void);
+static void Soft_Execute(const Dma2dJob_t *job);
+static uint32_t Soft_BytesPerPixel(uint32_t format);
+static uint32_t Soft_Read(const uint8_t *p, uint32_t format);
+static void Soft_Write(uint8_t *p, uint32_t format, uint32_t argb);
+static uint32_t Soft_Alpha(uint32_t argb, uint32_t pfccr);
+static uint32_t Soft_Blend(uint32_t fg, uint32_t bg);
+
+const Dma2dBackend_t Dma2dSoft_Backend = { Soft_Start, Soft_Idle, Soft_Lock, Soft_Unlock };
+
+/*============================================================================*/
+/* IMPLEMENTACIJA JAVNIH FUNKCIJA                                             */
+/*============================================================================*/
+
+void Dma2dSoft_Attach(Dma2dQueue_t *queue, const uint32_t *clut, void (*trace)(const Dma2dJob_t *job))
+{
+    soft_queue = queue;
+    soft_clut = clut;
+    soft_trace = trace;
+    soft_pending = false;
+    soft_unsupported = 0U;
+}
+
+bool Dma2dSoft_Step(void)
+{
+    if (!soft_pending) return false;
+
+    soft_pending = false;
+    Soft_Execute(&soft_job);
+    // Kraj posla javljamo kao prekid; red odmah pokreće sljedeći posao.
+    Dma2dQueue_Complete(soft_queue);
+    return true;
+}
+
+uint32_t Dma2dSoft_Unsupported(void)
+{
+    return soft_unsupported;
+}
+
+/*============================================================================*/
+/* IMPLEMENTACIJA PRIVATNIH FUNKCIJA                                          */
+/*============================================================================*/
+
+static void Soft_Start(const Dma2dJob_t *job)
+{
+    soft_job = *job;
+    soft_pending = true;
+}
+
+static void Soft_Idle(void)
+{
+    (void)Dma2dSoft_Step();
+}
+
+static void Soft_Lock(void)
+{
+}
+
+static void Soft_Unlock(void)
+{
+}
+
+static void Soft_Execute(const Dma2dJob_t *job)
+{
+    uint32_t mode = job->cr & DMA2D_JOB_MODE_MASK;
+    uint32_t width = (job->nlr >> 16) & 0x3FFFU;
+    uint32_t lines = job->nlr & 0xFFFFU;
+    uint32_t fg_fmt = job->fgpfccr & 0x0FU;
+    uint32_t bg_fmt = job->bgpfccr & 0x0FU;
+    uint32_t out_fmt = (mode == DMA2D_JOB_M2M) ? fg_fmt : (job->opfccr & 0x07U);
+    uint32_t fg_bpp = Soft_BytesPerPixel(fg_fmt);
+    uint32_t bg_bpp = Soft_BytesPerPixel(bg_fmt);
+    uint32_t out_bpp = Soft_BytesPerPixel(out_fmt);
+    uint8_t *fg = (uint8_t *)job->fgmar;
+    uint8_t *bg = (uint8_t *)job->bgmar;
+    uint8_t *out = (uint8_t *)job->omar;
+
+    if (soft_trace != NULL) soft_trace(job);
+    soft_fgcolr = job->fgcolr;
+
+    if ((out_bpp == 0U) || ((mode != DMA2D_JOB_R2M) && (fg_bpp == 0U)) ||
+        ((mode == DMA2D_JOB_M2M_BLEND) && (bg_bpp == 0U)) ||
+        ((fg_fmt == DMA2D_SOFT_L8) && (mode != DMA2D_JOB_M2M) && (soft_clut == NULL)))
+    {
+        soft_unsupported++;
+        return;
+    }
+
+    for (uint32_t y = 0U; y < lines; y++)
+    {
+        for (uint32_t x = 0U; x < width; x++)
+        {
+            switch (mode)
+            {
+            case DMA2D_JOB_R2M:
+                // OCOLR je već u izlaznom formatu.
+                memcpy(out, &job->ocolr, out_bpp);
+                break;
+            case DMA2D_JOB_M2M:
+                memcpy(out, fg, fg_bpp);
+                break;
+            case DMA2D_JOB_M2M_PFC:
+                Soft_Write(out, out_fmt, Soft_Alpha(Soft_Read(fg, fg_fmt), job->fgpfccr));
+                break;
+            default:
+                Soft_Write(out, out_fmt, Soft_Blend(Soft_Alpha(Soft_Read(fg, fg_fmt), job->fgpfccr),
+                                                    Soft_Alpha(Soft_Read(bg, bg_fmt), job->bgpfccr)));
+                bg += bg_bpp;
+                break;
+            }
+            fg += fg_bpp;
+            out += out_bpp;
+        }
+        fg += job->fgor * fg_bpp;
+        bg += job->bgor * bg_bpp;
+        out += job->oor * out_bpp;
+    }
+}
+
+static uint32_t Soft_BytesPerPixel(uint32_t format)
+{
+    switch (format)
+    {
+    case DMA2D_SOFT_ARGB8888: return 4U;
+    case DMA2D_SOFT_RGB888:   return 3U;
+    case DMA2D_SOFT_RGB565:   return 2U;
+    case DMA2D_SOFT_L8:       return 1U;
+    case DMA2D_SOFT_A8:       return 1U;
+    default:                  return 0U;
+    }
+}
+
+static uint32_t Soft_Read(const uint8_t *p, uint32_t format)
+{
+    uint32_t v;
+
+    switch (format)
+    {
+    case DMA2D_SOFT_ARGB8888:
+        memcpy(&v, p, 4U);
+        return v;
+    case DMA2D_SOFT_RGB888:
+        return 0xFF000000U | ((uint32_t)p[2] << 16) | ((uint32_t)p[1] << 8) | p[0];
+    case DMA2D_SOFT_RGB565:
+    {
+        uint32_t c = (uint32_t)p[0] | ((uint32_t)p[1] << 8);
+        uint32_t r = (c >> 11) & 0x1FU;
+        uint32_t g = (c >> 5) & 0x3FU;
+        uint32_t b = c & 0x1FU;
+        return 0xFF000000U | (((r << 3) | (r >> 2)) << 16) | (((g << 2) | (g >> 4)) << 8) | ((b << 3) | (b >> 2));
+    }
+    case DMA2D_SOFT_A8:
+        // Boja je u FGCOLR, iz memorije dolazi samo alfa.
+        return ((uint32_t)*p << 24) | (soft_fgcolr & 0x00FFFFFFU);
+    default:
+        return soft_clut[*p];
+    }
+}
+
+static void Soft_Write(uint8_t *p, uint32_t format, uint32_t argb)
+{
+    switch (format)
+    {
+    case DMA2D_SOFT_ARGB8888:
+        memcpy(p, &argb, 4U);
+        break;
+    case DMA2D_SOFT_RGB888:
+        p[0] = (uint8_t)argb;
+        p[1] = (uint8_t)(argb >> 8);
+        p[2] = (uint8_t)(argb >> 16);
+        break;
+    default:
+    {
+        uint32_t c = ((argb >> 8) & 0xF800U) | ((argb >> 5) & 0x07E0U) | ((argb >> 3) & 0x001FU);
+        p[0] = (uint8_t)c;
+        p[1] = (uint8_t)(c >> 8);
+        break;
+    }
+    }
+}
+
+static uint32_t Soft_Alpha(uint32_t argb, uint32_t pfccr)
+{
+    uint32_t alpha = pfccr >> 24;
+    uint32_t a = argb >> 24;
+
+    switch ((pfccr >> 16) & 0x03U)
+    {
+    case 1U: a = alpha; break;                  // Zamjena alfe
+    case 2U: a = (a * alpha) / 255U; break;     // Množenje alfe
+    default: break;
+    }
+    return (argb & 0x00FFFFFFU) | (a << 24);
+}
+
+static uint32_t Soft_Blend(uint32_t fg, uint32_t bg)
+{
+    uint32_t a_fg = fg >> 24;
+    uint32_t a_bg = bg >> 24;
+    uint32_t a_mult = (a_fg * a_bg) / 255U;
+    uint32_t a_out = a_fg + a_bg - a_mult;
+    uint32_t out = a_out << 24;
+
+    if (a_out == 0U) return 0U;
+    for (uint32_t shift = 0U; shift < 24U; shift += 8U)
+    {
+        uint32_t c_fg = (fg >> shift) & 0xFFU;
+        uint32_t c_bg = (bg >> shift) & 0xFFU;
+        out |= (((c_fg * a_fg) + (c_bg * a_bg) - (c_bg * a_mult)) / a_out) << shift;
+    }
+    return out;
+}
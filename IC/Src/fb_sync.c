@@ -0,0 +1,148 @@
+/**
+ ******************************************************************************
+ * @file    fb_sync.c
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Implementacija djelimične sinhronizacije bafera.
+ *
+ * @note    Bafer zaostaje tačno za crtanjem koje se desilo u drugim
+ * baferima otkad je on zadnji put bio ažuran. Zato se na početku svakog
+ * frejma crtanje prethodnog frejma doda regijama svih ostalih bafera, a
+ * bafer koji se upravo sinhronizuje preuzima regiju izvora. Ako ni izvor
+ * nije bio potpuno ažuran, `dst` time dobija nadskup stvarne razlike, što
+ * je uvijek ispravno.
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* UKLJUCENI FAJLOVI (INCLUDES)                                               */
+/*============================================================================*/
+#include "fb_sync.h"
+#include <stdio.h>
+
+/*============================================================================*/
+/* PROTOTIPOVI PRIVATNIH FUNKCIJA                                             */
+/*============================================================================*/
+static void Sync_Merge(GuiDirty_t *dst, const GuiDirty_t *src);
+static void Sync_Clear(GuiDirty_t *region);
+
+/*============================================================================*/
+/* IMPLEMENTACIJA JAVNIH FUNKCIJA                                             */
+/*============================================================================*/
+
+void FbSync_Init(FbSync_t *sync, int16_t width, int16_t height, uint8_t bytes_per_pixel, uint8_t buffers, uint8_t front)
+{
+    if (buffers > FB_SYNC_MAX_BUFFERS) buffers = FB_SYNC_MAX_BUFFERS;
+    if (front >= buffers) front = 0U;
+
+    for (uint8_t i = 0U; i < FB_SYNC_MAX_BUFFERS; i++)
+    {
+        GuiDirty_Init(&sync->stale[i], width, height);
+    }
+    GuiDirty_Init(&sync->frame, width, height);
+    GuiDirty_Init(&sync->copy, width, height);
+    sync->buffers = buffers;
+    sync->draw = front;
+    sync->bytes_per_pixel = bytes_per_pixel;
+    sync->frames = 0U;
+    sync->full_copies = 0U;
+    sync->last_bytes = 0U;
+    sync->total_bytes = 0U;
+    FbSync_InvalidateAll(sync);
+}
+
+void FbSync_InvalidateAll(FbSync_t *sync)
+{
+    for (uint8_t i = 0U; i < sync->buffers; i++)
+    {
+        if (i != sync->draw) GuiDirty_InvalidateAll(&sync->stale[i]);
+    }
+}
+
+void FbSync_Damage(FbSync_t *sync, int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+    GuiDirty_Invalidate(&sync->frame, x0, y0, x1, y1);
+}
+
+const GuiDirty_t *FbSync_Begin(FbSync_t *sync, uint8_t src, uint8_t dst)
+{
+    uint32_t bytes;
+
+    if ((src >= sync->buffers) || (dst >= sync->buffers) || (src == dst))
+    {
+        // Nepoznato stanje: sve osim novog bafera za crtanje je zastarjelo.
+        sync->draw = (dst < sync->buffers) ? dst : 0U;
+        Sync_Clear(&sync->frame);
+        Sync_Clear(&sync->stale[sync->draw]);
+        FbSync_InvalidateAll(sync);
+        return NULL;
+    }
+
+    // Crtanje prethodnog frejma nedostaje svim ostalim baferima.
+    for (uint8_t i = 0U; i < sync->buffers; i++)
+    {
+        if (i != sync->draw) Sync_Merge(&sync->stale[i], &sync->frame);
+    }
+    Sync_Clear(&sync->frame);
+
+    sync->copy = sync->stale[dst];
+    sync->stale[dst] = sync->stale[src];
+    sync->draw = dst;
+
+    bytes = GuiDirty_Pixels(&sync->copy) * sync->bytes_per_pixel;
+    sync->frames++;
+    sync->last_bytes = bytes;
+    sync->total_bytes += bytes;
+    if (sync->copy.full) sync->full_copies++;
+    return &sync->copy;
+}
+
+uint32_t FbSync_Report(const FbSync_t *sync, uint8_t layer, char *buf, uint32_t size)
+{
+    uint32_t full_size = (uint32_t)sync->copy.width * (uint32_t)sync->copy.height * sync->bytes_per_pixel;
+    uint32_t average = sync->frames ? (uint32_t)(sync->total_bytes / sync->frames) : 0U;
+    uint32_t saved = full_size ? (100U - (uint32_t)(((uint64_t)average * 100U) / full_size)) : 0U;
+    int n;
+
+    if (size == 0U) return 0U;
+    n = snprintf(buf, size, "layer %u: %lu B/frame, last %lu B, full %lu/%lu, saved %lu%%\n",
+                 layer, (unsigned long)average, (unsigned long)sync->last_bytes,
+                 (unsigned long)sync->full_copies, (unsigned long)sync->frames, (unsigned long)saved);
+    if ((n < 0) || ((uint32_t)n >= size))
+    {
+        buf[0] = '\0';
+        return 0U;
+    }
+    return (uint32_t)n;
+}
+
+/*============================================================================*/
+/* IMPLEMENTACIJA PRIVATNIH FUNKCIJA                                          */
+/*============================================================================*/
+
+/**
+ * @brief  Dodaje regiju `src` regiji `dst`.
+ */
+static void Sync_Merge(GuiDirty_t *dst, const GuiDirty_t *src)
+{
+    GuiRect_t rect;
+
+    if (dst->full) return;
+    if (src->full)
+    {
+        GuiDirty_InvalidateAll(dst);
+        return;
+    }
+    for (uint8_t i = 0U; GuiDirty_Get(src, i, &rect); i++)
+    {
+        GuiDirty_Invalidate(dst, rect.x0, rect.y0, rect.x1, rect.y1);
+    }
+}
+
+/**
+ * @brief  Prazni regiju bez diranja statistike `GuiDirty_t`.
+ */
+static void Sync_Clear(GuiDirty_t *region)
+{
+    region->count = 0U;
+    region->full = false;
+}
@@ -10,6 +10,16 @@
  * za detekciju grešaka i prekida u komunikaciji.
  * Verzija 2.0: Dodata robusna obrada grešaka sa automatskim čišćenjem QSPI
  * memorije i resetovanjem stanja agenta.
+ * Verzija 2.1: Dodat multicast mod (SUB_CMD_MCAST_*) u kojem jedan server
+ * istovremeno šalje sliku svim panelima. Paneli vode bitmapu primljenih
+ * blokova i nedostajuće blokove traže kroz NACK fazu sa slučajnim
+ * odlaganjem i potiskivanjem duplih zahtjeva.
+ * Verzija 2.2: Staging zona se više ne briše sinhrono na START poruci.
+ * Primljeni paketi se odmah potvrđuju i smještaju u red u RAM-u, a
+ * glavna petlja briše sektore neposredno ispred upisa i upisuje red
+ * u QSPI. Sav pristup QSPI memoriji se obavlja iz glavne petlje.
+ * Greška upisa se serveru javlja odgovorom SUB_CMD_DATA_NACK na
+ * sljedeći paket.
  ******************************************************************************
  */
 
@@ -19,6 +29,8 @@
 #include "rs485.h" // Potrebno za slanje ACK/NACK odgovora
 #include "stm32746g_qspi.h"
 #include "stm32746g_eeprom.h"
+#include "fw_block_map.h"
+#include "fw_erase_sched.h"
 
 //=============================================================================
 // Definicije Vremenskih Ograničenja (Timeouts) i Parametara
@@ -36,6 +48,59 @@
  */
 #define EE_BOOTLOADER_MARKER_ADDR 0x10 // Primjer, odabrati slobodnu adresu
 
+/**
+ * @brief Adresa na koju server šalje sve multicast poruke (svi paneli slušaju).
+ */
+#define FWU_MCAST_ADDRESS           0xFFU
+
+/**
+ * @brief Najveća veličina bloka u multicast modu (TF_MAX_PAYLOAD_RX minus zaglavlje).
+ */
+#define FWU_MCAST_MAX_BLOCK_SIZE    1000U
+
+/**
+ * @brief Najveći broj opsega nedostajućih blokova u jednoj NACK poruci.
+ * @note  5 bajtova zaglavlja + 16 * 6 bajtova opsega staje u TF_SENDBUF_LEN.
+ */
+#define FWU_MCAST_MAX_NACK_RANGES   16U
+
+/**
+ * @brief Podrazumijevani prozor (u ms) za slučajno odlaganje NACK-a ako ga
+ * server ne navede u POLL poruci.
+ */
+#define FWU_MCAST_NACK_WINDOW       500U
+
+/**
+ * @brief Bit u bajtu zastavica START poruke (data[22]) kojim server javlja da
+ * podržava nastavak prekinutog transfera i razumije prošireni START_ACK.
+ */
+#define FWU_START_FLAG_RESUME       0x01U
+
+/**
+ * @brief Količina novih podataka (u bajtovima) nakon koje se napredak
+ * transfera snima u EEPROM.
+ * @note  Nakon reseta se ponovo šalje najviše ovoliko podataka, a EEPROM se
+ * piše svega ~60 puta po kompletnoj slici od 960kB.
+ */
+#define FWU_RESUME_SAVE_INTERVAL    16384U
+
+/**
+ * @brief Broj paketa koji mogu čekati na upis u QSPI.
+ * @note  Pokriva prijem tokom jednog brisanja sektora (~0.7s tipično pri
+ * 115200 bps), pa server ne mora čekati na brisanje.
+ */
+#define FWU_WRITE_QUEUE_DEPTH       8U
+
+/**
+ * @brief Najveća dužina podataka u jednom paketu (unicast zaglavlje je 6 bajtova).
+ */
+#define FWU_WRITE_SLOT_SIZE         (TF_MAX_PAYLOAD_RX - 6U)
+
+/**
+ * @brief Broj sektora koji se drže obrisanim ispred pokazivača upisa.
+ */
+#define FWU_ERASE_AHEAD_SECTORS     1U
+
 //=============================================================================
 // Definicije za Mašinu Stanja (State Machine)
 //=============================================================================
@@ -49,9 +114,15 @@ typedef enum {
     SUB_CMD_START_NACK      = 0x03,
     SUB_CMD_DATA_PACKET     = 0x10,
     SUB_CMD_DATA_ACK        = 0x11,
+    SUB_CMD_DATA_NACK       = 0x12, /**< Panel -> server: upis u QSPI nije uspio, ponoviti od START-a. */
     SUB_CMD_FINISH_REQUEST  = 0x20,
     SUB_CMD_FINISH_ACK      = 0x21,
     SUB_CMD_FINISH_NACK     = 0x22,
+    SUB_CMD_MCAST_START     = 0x30, /**< Broadcast: početak multicast sesije (svi paneli). */
+    SUB_CMD_MCAST_DATA      = 0x31, /**< Broadcast: blok podataka sa indeksom bloka. */
+    SUB_CMD_MCAST_POLL      = 0x32, /**< Broadcast: kraj prolaza, otvara NACK fazu. */
+    SUB_CMD_MCAST_NACK      = 0x33, /**< Panel -> server: lista nedostajućih opsega. */
+    SUB_CMD_MCAST_FINISH    = 0x34, /**< Broadcast: kraj sesije, paneli validiraju sliku. */
 } FwUpdate_SubCommand_e;
 
 
@@ -76,9 +147,31 @@ typedef enum
 {
     FSM_IDLE,           /**< Agent je neaktivan i čeka komandu za početak. */
     FSM_RECEIVING,      /**< Agent je prihvatio update, obrisao memoriju i prima pakete. */
+    FSM_MCAST_RECEIVING,/**< Agent prima blokove multicast sesije bilo kojim redoslijedom. */
 } FSM_State_e;
 
 
+#pragma pack(push, 1)
+/**
+ * @brief Zaglavlje zapisa o napretku transfera koje se čuva u EEPROM-u.
+ * @note  Iza zaglavlja (na EE_FW_RESUME + sizeof) slijedi bitmapa primljenih
+ * blokova. CRC štiti samo zaglavlje: bitovi u bitmapi tokom jedne sesije
+ * idu isključivo iz 0 u 1 i upisuju se PRIJE zaglavlja, pa prekinut upis
+ * nikad ne označi blok koji nije stvarno upisan u QSPI.
+ */
+typedef struct
+{
+    uint16_t magic_number;      /**< "Potpis" za validaciju podataka. */
+    uint16_t block_size;        /**< Veličina bloka bitmape u bajtovima. */
+    uint32_t size;              /**< Očekivana veličina slike. */
+    uint32_t crc32;             /**< Očekivani CRC32 slike. */
+    uint32_t version;           /**< Očekivana verzija slike. */
+    uint32_t staging_addr;      /**< QSPI "staging" adresa sesije. */
+    uint32_t erased_to;         /**< Broj bajtova zone (od početka sektora) koji su obrisani. */
+    uint16_t crc;               /**< CRC zaglavlja. */
+} FwResume_EepromHeader_t;
+#pragma pack(pop)
+
 /**
  * @brief Struktura koja čuva sve runtime podatke potrebne za rad Agenta.
  */
@@ -87,9 +180,18 @@ typedef struct
     FSM_State_e     currentState;           /**< Trenutno stanje mašine. */
     FwInfoTypeDef   fwInfo;                 /**< Metapodaci o firmveru koji se prima. */
     uint32_t        expectedSequenceNum;    /**< Redni broj sljedećeg paketa koji očekujemo. */
-    uint32_t        currentWriteAddr;       /**< Trenutna adresa za upis u QSPI. */
-    uint32_t        bytesReceived;          /**< Ukupan broj primljenih bajtova. */
+    uint32_t        currentWriteAddr;       /**< Adresa iza posljednjeg primljenog paketa. */
+    uint32_t        bytesReceived;          /**< Ukupan broj primljenih (potvrđenih) bajtova. */
+    uint32_t        bytesWritten;           /**< Broj bajtova upisanih u QSPI (unicast). */
+    uint32_t        eraseStartTick;         /**< Trenutak početka brisanja sektora. */
+    bool            finishPending;          /**< FINISH je primljen, čeka se kraj upisa. */
     uint32_t        inactivityTimerStart;   /**< Vrijeme kada je primljen posljednji paket. */
+    uint16_t        mcastSessionId;         /**< ID aktivne multicast sesije. */
+    bool            nackPending;            /**< Tajmer za slučajno odloženi NACK je aktivan. */
+    uint32_t        nackDueTick;            /**< Trenutak (HAL_GetTick) slanja NACK-a. */
+    uint8_t         heardCount;             /**< Broj opsega "načutih" u tuđim NACK-ovima. */
+    FwBlockRange_t  heardRanges[FWU_MCAST_MAX_NACK_RANGES]; /**< Opsezi koje su već tražili drugi paneli. */
+    FwUpdate_NackReason_e failReason;       /**< Greška upisa/brisanja koju server još nije saznao. */
 } FwUpdateAgent_t;
 
 /**
@@ -102,13 +204,84 @@ static FwUpdateAgent_t agent;
  * trajanja jedne update sesije.
  */
 static uint32_t staging_qspi_addr;
+/**
+ * @brief Bitmapa primljenih blokova za multicast sesiju.
+ * @note  Čuva se odvojeno od `agent` strukture jer se ne resetuje memset-om
+ * pri svakom paketu, a zauzima ~480 bajtova.
+ */
+static FwBlockMap_t block_map;
+/**
+ * @brief Stanje generatora pseudo-slučajnih brojeva za NACK back-off.
+ */
+static uint32_t rng_state;
+/**
+ * @brief TinyFrame instanca preko koje je stigla posljednja poruka.
+ * @note  Potrebna za slanje odloženog NACK-a iz `FwUpdateAgent_Service()`.
+ */
+static TinyFrame *agent_tf;
+/**
+ * @brief Raspoređivač brisanja staging zone ispred pokazivača upisa.
+ */
+static FwEraseSched_t erase_sched;
+/**
+ * @brief Paket koji čeka na upis u QSPI.
+ */
+typedef struct
+{
+    uint32_t addr;                          /**< Apsolutna QSPI adresa upisa. */
+    uint32_t block;                         /**< Indeks bloka (samo multicast). */
+    uint16_t len;                           /**< Dužina podataka. */
+    uint8_t  data[FWU_WRITE_SLOT_SIZE];     /**< Podaci paketa. */
+} FwWriteSlot_t;
+/**
+ * @brief Red paketa za upis. Puni ga UART prekid, prazni glavna petlja.
+ */
+static FwWriteSlot_t write_queue[FWU_WRITE_QUEUE_DEPTH];
+static volatile uint8_t wq_head;    /**< Sljedeći paket za upis (glavna petlja). */
+static volatile uint8_t wq_tail;    /**< Sljedeće slobodno mjesto (UART prekid). */
+/**
+ * @brief Stanje zapisa o napretku transfera (kopija EEPROM zaglavlja u RAM-u).
+ * @note  Svi upisi u EEPROM se obavljaju iz `FwUpdateAgent_Service()`, jer se
+ * poruke obrađuju u kontekstu UART prekida gdje I2C upis nije siguran.
+ */
+static struct
+{
+    FwResume_EepromHeader_t hdr;    /**< Zaglavlje koje opisuje `block_map`. */
+    bool     loaded;                /**< Zapis je pročitan iz EEPROM-a pri startu. */
+    bool     valid;                 /**< `block_map` pripada zapisu iz `hdr`. */
+    bool     save_pending;          /**< Treba snimiti izmijenjene bajtove bitmape. */
+    bool     full_save;             /**< Nova sesija: snimiti kompletnu bitmapu. */
+    bool     clear_pending;         /**< Zapis treba poništiti u EEPROM-u. */
+    bool     header_pending;        /**< Pomjerena je granica brisanja, snimiti zaglavlje. */
+    uint32_t saved_blocks;          /**< Broj blokova u posljednjem snimku. */
+    uint16_t dirty_lo;              /**< Prvi izmijenjeni bajt bitmape od snimka. */
+    uint16_t dirty_hi;              /**< Zadnji izmijenjeni bajt bitmape od snimka. */
+} resume;
 
 //=============================================================================
 // Prototipovi Privatnih Funkcija (Handleri za Stanja)
 //=============================================================================
 static void HandleMessage_Idle(TinyFrame *tf, TF_Msg *msg);
 static void HandleMessage_Receiving(TinyFrame *tf, TF_Msg *msg);
-static void Agent_HandleFailure(void); // << NOVO
+static void HandleMessage_McastReceiving(TinyFrame *tf, TF_Msg *msg);
+static void Agent_HandleFailure(FwUpdate_NackReason_e reason);
+static void Agent_ReportFailure(TinyFrame *tf, TF_Msg *msg);
+static FwUpdate_NackReason_e Agent_PrepareStaging(const uint8_t *start_payload, uint16_t block_size, bool allow_resume);
+static uint8_t Agent_ValidateStagedImage(void);
+static void Agent_SendMcastNack(void);
+static uint32_t Agent_Random(void);
+static void Agent_LoadResume(void);
+static void Agent_SaveResume(void);
+static void Agent_WriteResumeHeader(void);
+static void Agent_StartResumeRecord(uint16_t block_size);
+static bool Agent_CanResume(uint16_t block_size);
+static void Agent_MarkBlock(uint32_t index);
+static void Agent_Suspend(void);
+static bool Agent_QueueWrite(uint32_t addr, uint32_t block, const uint8_t *data, uint16_t len);
+static void Agent_CommitWrite(const FwWriteSlot_t *slot);
+static void Agent_ServiceFlash(void);
+static void Agent_ReleaseQspi(void);
+static void Agent_CompleteFinish(void);
 
 //=============================================================================
 // Implementacija Javnih Funkcija (API)
@@ -126,12 +299,47 @@ static void Agent_HandleFailure(void); // << NOVO
  */
 void FwUpdateAgent_Init(void)
 {
+    uint32_t primask_state;
+
+    // Eventualno započeto brisanje mora završiti prije vraćanja QSPI-ja u
+    // memory-mapped mod.
+    Agent_ReleaseQspi();
+    memset(&erase_sched, 0, sizeof(FwEraseSched_t));
+
+    // Red puni UART prekid: indeksi i stanje se mijenjaju zajedno, bez
+    // prekida, kako paket ne bi završio u redu koji se upravo prazni.
+    primask_state = __get_PRIMASK();
+    __disable_irq();
+    wq_head = 0;
+    wq_tail = 0;
     agent.currentState = FSM_IDLE;
+    __set_PRIMASK(primask_state);
+
     agent.expectedSequenceNum = 0;
     agent.bytesReceived = 0;
+    agent.bytesWritten = 0;
+    agent.finishPending = false;
     agent.inactivityTimerStart = 0;
+    agent.mcastSessionId = 0;
+    agent.nackPending = false;
+    agent.heardCount = 0;
     staging_qspi_addr = 0;
     memset(&agent.fwInfo, 0, sizeof(FwInfoTypeDef));
+    // Pri prvom pozivu učitavamo eventualni zapis prekinutog transfera.
+    // Bitmapa se briše samo ako ne pripada validnom zapisu, kako bi nova
+    // START poruka za istu sliku mogla nastaviti tamo gdje je stalo.
+    if (!resume.loaded)
+    {
+        resume.loaded = true;
+        Agent_LoadResume();
+    }
+    if (!resume.valid) memset(&block_map, 0, sizeof(FwBlockMap_t));
+    // Seed za back-off: različit po panelu (UID + adresa) i po trenutku starta.
+    if (rng_state == 0)
+    {
+        rng_state = HAL_GetTick() ^ ((uint32_t)tfifa << 24) ^ *(__IO uint32_t*)UID_BASE;
+        if (rng_state == 0) rng_state = 0x2545F491U;
+    }
 }
 
 /**
@@ -140,18 +348,41 @@ void FwUpdateAgent_Init(void)
  * @author      Gemini & [Vaše Ime]
  * @note        Poziva se periodično iz `main()`. Ako je agent u stanju primanja
  * paketa (FSM_RECEIVING) i prođe više vremena od definisanog
- * T_INACTIVITY_TIMEOUT, automatski će se pokrenuti procedura
- * za obradu greške (`Agent_HandleFailure`).
+ * T_INACTIVITY_TIMEOUT, sesija se prekida (`Agent_Suspend`) uz
+ * zadržavanje primljenih blokova. Ovdje se obavlja i sav rad sa
+ * QSPI memorijom (brisanje ispred upisa, upis reda paketa, finalna
+ * validacija) te odloženi upisi zapisa o napretku u EEPROM.
  ******************************************************************************
  */
 void FwUpdateAgent_Service(void)
 {
-    if (agent.currentState == FSM_RECEIVING)
+    // Odloženi upisi zapisa o napretku u EEPROM. Obavljaju se prije rada sa
+    // QSPI memorijom, pa nova sesija poništi zapis prethodne prije nego što
+    // obriše prvi sektor zone.
+    if (resume.clear_pending || resume.save_pending || resume.header_pending)
+    {
+        Agent_SaveResume();
+    }
+
+    if ((agent.currentState == FSM_RECEIVING) || (agent.currentState == FSM_MCAST_RECEIVING))
+    {
+        if (!agent.finishPending && ((HAL_GetTick() - agent.inactivityTimerStart) > T_INACTIVITY_TIMEOUT))
+        {
+            // Server predugo nije poslao paket. Prekidamo proces, ali
+            // zadržavamo primljene podatke za nastavak transfera.
+            Agent_Suspend();
+            return;
+        }
+        Agent_ServiceFlash();
+    }
+
+    // Slučajno odloženi NACK u multicast modu se šalje iz glavne petlje.
+    if ((agent.currentState == FSM_MCAST_RECEIVING) && agent.nackPending && (agent_tf != NULL))
     {
-        if ((HAL_GetTick() - agent.inactivityTimerStart) > T_INACTIVITY_TIMEOUT)
+        if ((int32_t)(HAL_GetTick() - agent.nackDueTick) >= 0)
         {
-            // Server predugo nije poslao paket. Prekidamo proces.
-            Agent_HandleFailure();
+            agent.nackPending = false;
+            Agent_SendMcastNack();
         }
     }
 }
@@ -170,12 +401,19 @@ void FwUpdateAgent_Service(void)
  */
 void FwUpdateAgent_ProcessMessage(TinyFrame *tf, TF_Msg *msg)
 {
+    if (msg->len < 2) return;
+    agent_tf = tf;
+
+    uint8_t sub_command = msg->data[0];
     uint8_t target_address = msg->data[1];
+    bool is_multicast = (sub_command >= SUB_CMD_MCAST_START) && (sub_command <= SUB_CMD_MCAST_FINISH);
 
     // START_REQUEST je jedina poruka koja se obrađuje iako nije direktno
     // adresirana na nas (kako bi se prikazala poruka na ekranu).
+    // Multicast poruke su namijenjene svim panelima, a tuđe MCAST_NACK
+    // poruke slušamo zbog potiskivanja vlastitih NACK-ova.
     // Sve ostale poruke se ignorišu ako adresa nije naša.
-    if (msg->data[0] != SUB_CMD_START_REQUEST && target_address != tfifa)
+    if (!is_multicast && sub_command != SUB_CMD_START_REQUEST && target_address != tfifa)
     {
         return;
     }
@@ -188,6 +426,9 @@ void FwUpdateAgent_ProcessMessage(TinyFrame *tf, TF_Msg *msg)
     case FSM_RECEIVING:
         HandleMessage_Receiving(tf, msg);
         break;
+    case FSM_MCAST_RECEIVING:
+        HandleMessage_McastReceiving(tf, msg);
+        break;
     default:
         break;
     }
@@ -207,6 +448,20 @@ bool FwUpdateAgent_IsActive(void)
     return (agent.currentState != FSM_IDLE);
 }
 
+/**
+ ******************************************************************************
+ * @brief       Provjerava da li je QSPI memorija zauzeta brisanjem sektora.
+ * @author      Gemini & [Vaše Ime]
+ * @note        Dok traje brisanje, QSPI nije u memory-mapped modu i GUI ne
+ * smije čitati resurse (slike, fontove) iz nje.
+ * @retval      bool `true` ako je brisanje u toku.
+ ******************************************************************************
+ */
+bool FwUpdateAgent_IsFlashBusy(void)
+{
+    return erase_sched.busy;
+}
+
 
 //=============================================================================
 // Implementacija Privatnih Funkcija (Logika Mašine Stanja)
@@ -217,46 +472,68 @@ bool FwUpdateAgent_IsActive(void)
  * @brief       Centralizovana funkcija za obradu svih neuspjeha u transferu.
  * @author      Gemini & [Vaše Ime]
  * @note        Ovo je ključna funkcija za robusnost. Kada se pozove, ona
- * briše potencijalno neispravne podatke iz QSPI memorije na
- * "staging" adresi, a zatim resetuje kompletan agent u početno
- * stanje pozivom `FwUpdateAgent_Init()`.
+ * briše prvi sektor "staging" zone (zaglavlje slike), čime se
+ * djelimično upisana slika trajno poništava, a zatim resetuje
+ * kompletan agent u početno stanje pozivom `FwUpdateAgent_Init()`.
+ * Zapis o napretku u EEPROM-u se poništava prije brisanja. Ostatak
+ * zone se ne briše: svaka nova sesija ionako briše sektore ispred
+ * upisa. Poziva se isključivo iz glavne petlje.
+ * @param       reason Razlog koji server dobija kao odgovor na sljedeći
+ * DATA/FINISH paket (`NACK_REASON_NONE` ako mu je greška već javljena
+ * ili je veza prekinuta).
  ******************************************************************************
  */
-static void Agent_HandleFailure(void)
+static void Agent_HandleFailure(FwUpdate_NackReason_e reason)
 {
-    // Ako imamo validne informacije o firmveru (veličina i adresa), brišemo QSPI.
-    if (staging_qspi_addr != 0 && agent.fwInfo.size > 0)
+    // Podaci u staging zoni se brišu, pa zapis o napretku više ne važi.
+    // Poništava se odmah, PRIJE brisanja sektora: nestanak napajanja između
+    // brisanja i odloženog upisa bi ostavio zapis čija bitmapa obrisane
+    // blokove vodi kao upisane.
+    resume.valid = false;
+    resume.save_pending = false;
+    resume.clear_pending = true;
+    Agent_SaveResume();
+
+    Agent_ReleaseQspi();
+
+    // Ako je u zonu išta upisano, brišemo njen prvi sektor.
+    if ((staging_qspi_addr != 0) && (FwEraseSched_ErasedOffset(&erase_sched) != 0))
     {
         MX_QSPI_Init();
-        // Brišemo tačno onoliko koliko je trebalo biti upisano.
-        QSPI_Erase(staging_qspi_addr, staging_qspi_addr + agent.fwInfo.size);
+        QSPI_Erase(staging_qspi_addr, staging_qspi_addr);
         MX_QSPI_Init();
         QSPI_MemMapMode();
     }
 
     // Vraćamo agenta na početne postavke, spreman je za novi pokušaj.
     FwUpdateAgent_Init();
+    agent.failReason = reason;
 }
 
 /**
  ******************************************************************************
- * @brief       Handler za obradu poruka kada je Agent u IDLE stanju.
+ * @brief       Preuzima metapodatke iz START poruke i priprema "staging" zonu.
  * @author      Gemini & [Vaše Ime]
- * @note        U ovom stanju, jedina relevantna poruka je `SUB_CMD_START_REQUEST`.
- * Funkcija vrši sve pred-provjere (veličina, verzija), briše
- * potreban segment QSPI memorije i ako je sve u redu, šalje ACK
- * i prelazi u `FSM_RECEIVING` stanje. U slučaju greške, poziva
- * `Agent_HandleFailure()` i šalje NACK.
- * @param       tf    Pokazivač na TinyFrame instancu.
- * @param       msg   Pokazivač na primljenu TF_Msg poruku.
+ * @note        Zajednički korak za unicast (`SUB_CMD_START_REQUEST`) i
+ * multicast (`SUB_CMD_MCAST_START`) početak transfera. Vrši sve
+ * pred-provjere (veličina, verzija) i priprema raspoređivač brisanja;
+ * samo brisanje se obavlja postepeno iz `FwUpdateAgent_Service()`, pa
+ * se na START odgovara odmah.
+ * Ako u EEPROM-u postoji zapis o prekinutom transferu ISTE slike
+ * (veličina, CRC, verzija i staging adresa), brisanje se preskače i
+ * nastavlja se sa već primljenom bitmapom blokova.
+ * @param       start_payload Pokazivač na `msg->data[2]` START poruke
+ * (FwInfoTypeDef, čije polje `ld_addr` nosi staging adresu).
+ * @param       block_size    Veličina bloka bitmape (0 = bilo koja za nastavak,
+ * FWMAP_MIN_BLOCK_SIZE za novu sesiju).
+ * @param       allow_resume  Da li je dozvoljen nastavak prekinutog transfera.
+ * @retval      FwUpdate_NackReason_e `NACK_REASON_NONE` ako je zona spremna.
  ******************************************************************************
  */
-static void HandleMessage_Idle(TinyFrame *tf, TF_Msg *msg)
+static FwUpdate_NackReason_e Agent_PrepareStaging(const uint8_t *start_payload, uint16_t block_size, bool allow_resume)
 {
-    if (msg->data[0] != SUB_CMD_START_REQUEST || msg->data[1] != tfifa) return;
-
-    memcpy(&agent.fwInfo, &msg->data[2], sizeof(FwInfoTypeDef));
-    memcpy(&staging_qspi_addr, &msg->data[18], sizeof(uint32_t));
+    memcpy(&agent.fwInfo, start_payload, sizeof(FwInfoTypeDef));
+    memcpy(&staging_qspi_addr, &start_payload[16], sizeof(uint32_t));
 
     FwInfoTypeDef currentFwInfo;
     currentFwInfo.ld_addr = RT_APPL_ADDR;
@@ -264,32 +541,117 @@ static void HandleMessage_Idle(TinyFrame *tf, TF_Msg *msg)
 
     if ((agent.fwInfo.size > RT_APPL_SIZE) || (agent.fwInfo.size == 0) || (IsNewFwUpdate(&currentFwInfo, &agent.fwInfo) != 0))
     {
-        uint8_t nack_response[] = {SUB_CMD_START_NACK, tfifa, NACK_REASON_INVALID_VERSION};
-        TF_SendSimple(tf, FIRMWARE_UPDATE, nack_response, sizeof(nack_response));
         // Ne pozivamo Agent_HandleFailure() jer još ništa nismo ni počeli raditi (npr. brisati memoriju)
-        return;
+        return NACK_REASON_INVALID_VERSION;
     }
 
-    MX_QSPI_Init();
-    if (QSPI_Erase(staging_qspi_addr, staging_qspi_addr + agent.fwInfo.size) != QSPI_OK)
+    if (!FwEraseSched_Init(&erase_sched, staging_qspi_addr, agent.fwInfo.size, N25Q128A_SECTOR_SIZE, FWU_ERASE_AHEAD_SECTORS))
     {
-        MX_QSPI_Init();
-        QSPI_MemMapMode();
-        uint8_t nack_response[] = {SUB_CMD_START_NACK, tfifa, NACK_REASON_ERASE_FAILED};
-        TF_SendSimple(tf, FIRMWARE_UPDATE, nack_response, sizeof(nack_response));
-        Agent_HandleFailure(); // Greška, očisti i resetuj
-        return;
+        return NACK_REASON_FILE_TOO_LARGE;
     }
-    MX_QSPI_Init();
-    QSPI_MemMapMode();
 
     agent.expectedSequenceNum = 0;
+    agent.finishPending = false;
+    agent.inactivityTimerStart = HAL_GetTick();
+    wq_head = 0;
+    wq_tail = 0;
+
+    if (allow_resume && Agent_CanResume(block_size))
+    {
+        // Ista slika kao u prekinutom transferu: dio zone je već obrisan i
+        // djelimično upisan. Nastavljamo od prvog nedostajućeg bloka.
+        FwEraseSched_Restore(&erase_sched, resume.hdr.erased_to);
+        agent.bytesReceived = FwBlockMap_FirstMissing(&block_map, 0) * block_map.block_size;
+        if (agent.bytesReceived > agent.fwInfo.size) agent.bytesReceived = agent.fwInfo.size;
+        agent.bytesWritten = agent.bytesReceived;
+        agent.currentWriteAddr = staging_qspi_addr + agent.bytesReceived;
+        return NACK_REASON_NONE;
+    }
+
+    if (block_size == 0) block_size = FWMAP_MIN_BLOCK_SIZE;
+    if (!FwBlockMap_Init(&block_map, agent.fwInfo.size, block_size))
+    {
+        return NACK_REASON_FILE_TOO_LARGE;
+    }
+
+    // Novi zapis se pravi odmah; prvi sektor se briše tek iz glavne petlje.
+    Agent_StartResumeRecord(block_size);
     agent.bytesReceived = 0;
+    agent.bytesWritten = 0;
     agent.currentWriteAddr = staging_qspi_addr;
-    agent.inactivityTimerStart = HAL_GetTick();
+    return NACK_REASON_NONE;
+}
 
-    uint8_t ack_response[] = {SUB_CMD_START_ACK, tfifa};
-    TF_SendSimple(tf, FIRMWARE_UPDATE, ack_response, sizeof(ack_response));
+/**
+ ******************************************************************************
+ * @brief       Handler za obradu poruka kada je Agent u IDLE stanju.
+ * @author      Gemini & [Vaše Ime]
+ * @note        U ovom stanju relevantne su poruke `SUB_CMD_START_REQUEST`
+ * (unicast) i `SUB_CMD_MCAST_START` (multicast). Za unicast se šalje
+ * ACK/NACK i prelazi u `FSM_RECEIVING`. Multicast START se ne
+ * potvrđuje (izbjegavamo lavinu odgovora od svih panela); panel koji
+ * prihvati sesiju tiho prelazi u `FSM_MCAST_RECEIVING`, a panel koji je
+ * odbije (npr. već ima tu verziju) jednostavno ostaje u IDLE stanju.
+ * Ako je prethodna unicast sesija prekinuta greškom QSPI-ja, DATA i
+ * FINISH paketi dobijaju NACK dok server ne pošalje novi START.
+ * @param       tf    Pokazivač na TinyFrame instancu.
+ * @param       msg   Pokazivač na primljenu TF_Msg poruku.
+ ******************************************************************************
+ */
+static void HandleMessage_Idle(TinyFrame *tf, TF_Msg *msg)
+{
+    FwUpdate_NackReason_e reason;
+
+    if (msg->data[0] == SUB_CMD_MCAST_START)
+    {
+        uint16_t block_size;
+
+        // [0]=cmd [1]=0xFF [2..21]=FwInfo [22..23]=veličina bloka [24..25]=ID sesije
+        if ((msg->len < 26) || (msg->data[1] != FWU_MCAST_ADDRESS)) return;
+        memcpy(&block_size, &msg->data[22], sizeof(uint16_t));
+        if ((block_size < FWMAP_MIN_BLOCK_SIZE) || (block_size > FWU_MCAST_MAX_BLOCK_SIZE)) return;
+
+        if (Agent_PrepareStaging(&msg->data[2], block_size, true) != NACK_REASON_NONE) return;
+        memcpy(&agent.mcastSessionId, &msg->data[24], sizeof(uint16_t));
+        agent.nackPending = false;
+        agent.heardCount = 0;
+        agent.currentState = FSM_MCAST_RECEIVING;
+        return;
+    }
+
+    if ((agent.failReason != NACK_REASON_NONE) && (msg->data[1] == tfifa))
+    {
+        Agent_ReportFailure(tf, msg);
+    }
+
+    if (msg->data[0] != SUB_CMD_START_REQUEST || msg->data[1] != tfifa) return;
+    agent.failReason = NACK_REASON_NONE;
+
+    // Opcioni bajt zastavica iza FwInfo strukture. Stari serveri ga ne šalju,
+    // pa za njih nikad ne nastavljamo transfer i odgovaramo kratkim ACK-om.
+    bool resume_capable = (msg->len > 22) && ((msg->data[22] & FWU_START_FLAG_RESUME) != 0);
+
+    reason = Agent_PrepareStaging(&msg->data[2], 0, resume_capable);
+    if (reason != NACK_REASON_NONE)
+    {
+        uint8_t nack_response[] = {SUB_CMD_START_NACK, tfifa, (uint8_t)reason};
+        TF_SendSimple(tf, FIRMWARE_UPDATE, nack_response, sizeof(nack_response));
+        return;
+    }
+
+    if (resume_capable)
+    {
+        // Prošireni ACK: [2..5] = bajt-pomak od kojeg server nastavlja slanje.
+        // Redni brojevi paketa kreću od nule i za nastavljeni transfer.
+        uint8_t ack_response[6] = {SUB_CMD_START_ACK, tfifa};
+        memcpy(&ack_response[2], &agent.bytesReceived, sizeof(uint32_t));
+        TF_SendSimple(tf, FIRMWARE_UPDATE, ack_response, sizeof(ack_response));
+    }
+    else
+    {
+        uint8_t ack_response[] = {SUB_CMD_START_ACK, tfifa};
+        TF_SendSimple(tf, FIRMWARE_UPDATE, ack_response, sizeof(ack_response));
+    }
 
     agent.currentState = FSM_RECEIVING;
 }
@@ -299,10 +661,11 @@ static void HandleMessage_Idle(TinyFrame *tf, TF_Msg *msg)
  * @brief       Handler za obradu poruka kada je Agent u RECEIVING stanju.
  * @author      Gemini & [Vaše Ime]
  * @note        Ovdje se obrađuju `SUB_CMD_DATA_PACKET` i `SUB_CMD_FINISH_REQUEST`.
- * Funkcija upisuje podatke u QSPI i na kraju vrši finalnu
- * validaciju. Ako je sve uspješno, upisuje marker za bootloader
- * i restartuje uređaj. U slučaju bilo kakve greške, poziva
- * `Agent_HandleFailure()` i šalje odgovarajući NACK.
+ * Paket se potvrđuje čim se smjesti u red za upis, a `FINISH` samo
+ * zakazuje finalnu validaciju u glavnoj petlji. Ako kasniji upis u
+ * QSPI ne uspije, server to saznaje iz odgovora na sljedeći paket
+ * (vidi `Agent_ReportFailure()`). Funkcija se izvršava u kontekstu
+ * UART prekida i ne pristupa QSPI memoriji.
  * @param       tf    Pokazivač na TinyFrame instancu.
  * @param       msg   Pokazivač na primljenu TF_Msg poruku.
  ******************************************************************************
@@ -319,26 +682,20 @@ static void HandleMessage_Receiving(TinyFrame *tf, TF_Msg *msg)
         memcpy(&receivedSeqNum, &msg->data[2], sizeof(uint32_t));
 
         if (receivedSeqNum == agent.expectedSequenceNum) {
-            uint8_t* data_payload = (uint8_t*)&msg->data[6];
             uint16_t data_len = msg->len - 6;
 
-            MX_QSPI_Init();
-            if (QSPI_Write(data_payload, agent.currentWriteAddr, data_len) == QSPI_OK) {
-                agent.bytesReceived += data_len;
-                agent.currentWriteAddr += data_len;
-                agent.expectedSequenceNum++;
-
-                uint8_t ack_payload[6];
-                ack_payload[0] = SUB_CMD_DATA_ACK;
-                ack_payload[1] = tfifa;
-                memcpy(&ack_payload[2], &receivedSeqNum, sizeof(uint32_t));
-                TF_SendSimple(tf, FIRMWARE_UPDATE, ack_payload, sizeof(ack_payload));
-            } else {
-                // Greška pri upisu u QSPI!
-                Agent_HandleFailure();
-            }
-            MX_QSPI_Init();
-            QSPI_MemMapMode();
+            // Paket se samo smješta u red; upis u QSPI obavlja glavna petlja.
+            // Ako je red pun, ne šaljemo ACK i server ponavlja isti paket.
+            if (!Agent_QueueWrite(agent.currentWriteAddr, 0, &msg->data[6], data_len)) break;
+            agent.bytesReceived += data_len;
+            agent.currentWriteAddr += data_len;
+            agent.expectedSequenceNum++;
+
+            uint8_t ack_payload[6];
+            ack_payload[0] = SUB_CMD_DATA_ACK;
+            ack_payload[1] = tfifa;
+            memcpy(&ack_payload[2], &receivedSeqNum, sizeof(uint32_t));
+            TF_SendSimple(tf, FIRMWARE_UPDATE, ack_payload, sizeof(ack_payload));
         } else if (receivedSeqNum < agent.expectedSequenceNum) {
             // Server je ponovo poslao stari paket, samo šaljemo ACK ponovo.
             uint8_t ack_payload[6];
@@ -352,73 +709,677 @@ static void HandleMessage_Receiving(TinyFrame *tf, TF_Msg *msg)
 
     case SUB_CMD_FINISH_REQUEST:
     {
-        // Provjera da li se broj primljenih bajtova poklapa sa očekivanim.
-        if (agent.bytesReceived != agent.fwInfo.size) {
-            uint8_t nack_response[] = {SUB_CMD_FINISH_NACK, tfifa, NACK_REASON_SIZE_MISMATCH};
-            TF_SendSimple(tf, FIRMWARE_UPDATE, nack_response, sizeof(nack_response));
-            Agent_HandleFailure();
-            break;
+        // Validacija čita QSPI, pa se obavlja iz glavne petlje nakon što se
+        // upiše cijeli red (vidi `Agent_CompleteFinish()`).
+        agent.finishPending = true;
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+/**
+ ******************************************************************************
+ * @brief       Javlja serveru grešku upisa paketa koji su već potvrđeni.
+ * @author      Gemini & [Vaše Ime]
+ * @note        Paketi se potvrđuju čim uđu u red, pa greška upisa ili
+ * brisanja u glavnoj petlji stiže tek nakon ACK-a. Agent je tada već u
+ * IDLE stanju, a server to saznaje iz odgovora na sljedeći DATA paket
+ * (`SUB_CMD_DATA_NACK` sa rednim brojem i razlogom) ili na FINISH
+ * (`SUB_CMD_FINISH_NACK`). Odgovara se dok server ne pošalje novi START,
+ * jer se i sam NACK može izgubiti. Stari serveri ne poznaju DATA_NACK i,
+ * kao i ranije, ponovo počinju nakon isteka vremena.
+ * @param       tf    Pokazivač na TinyFrame instancu.
+ * @param       msg   Pokazivač na primljenu TF_Msg poruku.
+ ******************************************************************************
+ */
+static void Agent_ReportFailure(TinyFrame *tf, TF_Msg *msg)
+{
+    if ((msg->data[0] == SUB_CMD_DATA_PACKET) && (msg->len >= 6))
+    {
+        // [0]=cmd [1]=adresa [2..5]=redni broj paketa [6]=razlog
+        uint8_t nack_payload[7];
+        nack_payload[0] = SUB_CMD_DATA_NACK;
+        nack_payload[1] = tfifa;
+        memcpy(&nack_payload[2], &msg->data[2], sizeof(uint32_t));
+        nack_payload[6] = (uint8_t)agent.failReason;
+        TF_SendSimple(tf, FIRMWARE_UPDATE, nack_payload, sizeof(nack_payload));
+    }
+    else if (msg->data[0] == SUB_CMD_FINISH_REQUEST)
+    {
+        uint8_t nack_response[] = {SUB_CMD_FINISH_NACK, tfifa, (uint8_t)agent.failReason};
+        TF_SendSimple(tf, FIRMWARE_UPDATE, nack_response, sizeof(nack_response));
+    }
+}
+
+/**
+ ******************************************************************************
+ * @brief       Vrši finalnu CRC validaciju slike upisane u "staging" zonu.
+ * @author      Gemini & [Vaše Ime]
+ * @note        Izdvojeno iz obrade `SUB_CMD_FINISH_REQUEST` kako bi se isti
+ * postupak koristio i na kraju multicast sesije. CRC periferija se
+ * privremeno prebacuje u WORDS mod, kako bootloader očekuje.
+ * @retval      uint8_t 0 u slučaju uspjeha, inače kod greške.
+ ******************************************************************************
+ */
+static uint8_t Agent_ValidateStagedImage(void)
+{
+    uint32_t primask_state;
+    FwInfoTypeDef receivedFwInfo;
+    uint8_t validation_result;
+
+    // Započinjemo kritičnu sekciju da osiguramo stabilno okruženje.
+    primask_state = __get_PRIMASK();
+    __disable_irq();
+    SCB_DisableDCache();
+
+    // =======================================================================
+    // === KORAK 1: Privremena rekonfiguracija CRC periferije na WORDS mod ===
+    // Deinicijalizujemo drajver da bismo osigurali čisto stanje, zatim ga
+    // inicijalizujemo sa FORMAT_WORDS, kako bootloader očekuje.
+    // =======================================================================
+    HAL_CRC_DeInit(&hcrc);
+    hcrc.InputDataFormat = CRC_INPUTDATA_FORMAT_WORDS;
+    if (HAL_CRC_Init(&hcrc) != HAL_OK) {
+        // Ako rekonfiguracija ne uspije, izlazimo sigurno.
+        validation_result = 0xFF; // Postavljamo na kod greške
+    } else {
+        // === KORAK 2: Izvršavanje validacije sa ispravnom konfiguracijom ===
+        memset(&receivedFwInfo, 0, sizeof(FwInfoTypeDef));
+        receivedFwInfo.ld_addr = staging_qspi_addr;
+        validation_result = GetFwInfo(&receivedFwInfo);
+    }
+
+    // =======================================================================
+    // === KORAK 3: Vraćanje CRC periferije na originalni BYTES mod ===
+    // Odmah nakon provjere, vraćamo CRC konfiguraciju na onu koju
+    // ostatak aplikacije (npr. EEPROM) očekuje.
+    // =======================================================================
+    HAL_CRC_DeInit(&hcrc);
+    hcrc.InputDataFormat = CRC_INPUTDATA_FORMAT_BYTES;
+    HAL_CRC_Init(&hcrc); // Ovdje ne provjeravamo grešku jer je ovo originalna, ispravna konfiguracija
+
+    // Završavamo kritičnu sekciju.
+    SCB_EnableDCache();
+    __set_PRIMASK(primask_state);
+
+
+
+    return validation_result;
+}
+
+/**
+ ******************************************************************************
+ * @brief       Handler za obradu poruka kada je Agent u MCAST_RECEIVING stanju.
+ * @author      Gemini & [Vaše Ime]
+ * @note        Blokovi stižu bilo kojim redoslijedom i preko reda za upis
+ * završavaju na `staging + index * block_size`; duplikati se ignorišu. Panel ne
+ * potvrđuje pojedinačne blokove. Na `SUB_CMD_MCAST_POLL` panel kojem
+ * nešto nedostaje aktivira slučajno odloženi NACK unutar prozora koji
+ * je zadao server. Dok čeka, prisluškuje tuđe NACK-ove i iz svog
+ * izvještaja izbacuje opsege koje je neko drugi već tražio, čime se
+ * izbjegava "NACK implozija" kod velikog broja panela.
+ * @param       tf    Pokazivač na TinyFrame instancu.
+ * @param       msg   Pokazivač na primljenu TF_Msg poruku.
+ ******************************************************************************
+ */
+static void HandleMessage_McastReceiving(TinyFrame *tf, TF_Msg *msg)
+{
+    uint16_t session_id;
+
+    (void)tf; // Odloženi NACK se šalje preko `agent_tf`.
+    if (msg->len < 4) return;
+    memcpy(&session_id, &msg->data[2], sizeof(uint16_t));
+    if (session_id != agent.mcastSessionId) return;
+
+    switch (msg->data[0])
+    {
+    case SUB_CMD_MCAST_DATA:
+    {
+        // [0]=cmd [1]=0xFF [2..3]=ID sesije [4..7]=indeks bloka [8..]=podaci
+        uint32_t block_index;
+        uint32_t address;
+        uint16_t data_len;
+
+        if (msg->len < 8) return;
+        agent.inactivityTimerStart = HAL_GetTick();
+        memcpy(&block_index, &msg->data[4], sizeof(uint32_t));
+        data_len = msg->len - 8;
+
+        if (FwBlockMap_Test(&block_map, block_index)) break; // Već imamo ovaj blok.
+        if (data_len != FwBlockMap_BlockLength(&block_map, block_index)) break;
+
+        // Ako je red pun, blok se odbacuje i traži se kasnije u NACK fazi.
+        address = staging_qspi_addr + (block_index * block_map.block_size);
+        if (!Agent_QueueWrite(address, block_index, &msg->data[8], data_len)) break;
+        if ((address + data_len) > agent.currentWriteAddr) agent.currentWriteAddr = address + data_len;
+        break;
+    }
+
+    case SUB_CMD_MCAST_POLL:
+    {
+        // [0]=cmd [1]=0xFF [2..3]=ID sesije [4..5]=NACK prozor u ms
+        uint16_t window = FWU_MCAST_NACK_WINDOW;
+
+        agent.inactivityTimerStart = HAL_GetTick();
+        if (FwBlockMap_IsComplete(&block_map)) break; // Nemamo šta tražiti.
+        if (msg->len >= 6) memcpy(&window, &msg->data[4], sizeof(uint16_t));
+        if (window == 0) window = FWU_MCAST_NACK_WINDOW;
+
+        agent.heardCount = 0;
+        agent.nackDueTick = HAL_GetTick() + (Agent_Random() % window);
+        agent.nackPending = true;
+        break;
+    }
+
+    case SUB_CMD_MCAST_NACK:
+    {
+        // Tuđi NACK: [0]=cmd [1]=adresa panela [2..3]=ID sesije [4]=broj opsega [5..]=opsezi
+        uint8_t count;
+
+        if (!agent.nackPending || (msg->data[1] == tfifa) || (msg->len < 5)) break;
+        count = msg->data[4];
+        if (msg->len < (5U + (count * 6U))) break;
+
+        for (uint8_t i = 0; (i < count) && (agent.heardCount < FWU_MCAST_MAX_NACK_RANGES); i++)
+        {
+            FwBlockRange_t *range = &agent.heardRanges[agent.heardCount++];
+            memcpy(&range->first, &msg->data[5 + (i * 6)], sizeof(uint32_t));
+            memcpy(&range->count, &msg->data[9 + (i * 6)], sizeof(uint16_t));
+        }
+        break;
+    }
+
+    case SUB_CMD_MCAST_FINISH:
+    {
+        agent.nackPending = false;
+        agent.finishPending = true;
+        break;
+    }
+
+    default:
+        break;
+    }
+}
+
+/**
+ ******************************************************************************
+ * @brief       Šalje listu nedostajućih opsega blokova serveru.
+ * @author      Gemini & [Vaše Ime]
+ * @note        Poziva se iz `FwUpdateAgent_Service()` kada istekne slučajno
+ * odlaganje. Lista se računa svježe iz bitmape (blokovi primljeni za
+ * vrijeme čekanja se ne traže), a zatim se iz nje izbace blokovi koje
+ * su drugi paneli već zatražili. Ako ništa ne preostane, NACK se ne šalje.
+ ******************************************************************************
+ */
+static void Agent_SendMcastNack(void)
+{
+    FwBlockRange_t ranges[FWU_MCAST_MAX_NACK_RANGES];
+    uint8_t payload[5 + (FWU_MCAST_MAX_NACK_RANGES * 6)];
+    uint8_t count;
+
+    count = FwBlockMap_GetMissingRanges(&block_map, ranges, FWU_MCAST_MAX_NACK_RANGES);
+    count = FwBlockMap_SuppressRanges(ranges, count, FWU_MCAST_MAX_NACK_RANGES, agent.heardRanges, agent.heardCount);
+    agent.heardCount = 0;
+    if (count == 0) return;
+
+    payload[0] = SUB_CMD_MCAST_NACK;
+    payload[1] = tfifa;
+    memcpy(&payload[2], &agent.mcastSessionId, sizeof(uint16_t));
+    payload[4] = count;
+    for (uint8_t i = 0; i < count; i++)
+    {
+        memcpy(&payload[5 + (i * 6)], &ranges[i].first, sizeof(uint32_t));
+        memcpy(&payload[9 + (i * 6)], &ranges[i].count, sizeof(uint16_t));
+    }
+    TF_SendSimple(agent_tf, FIRMWARE_UPDATE, payload, (TF_LEN)(5U + (count * 6U)));
+}
+
+/**
+ * @brief  Jednostavan xorshift32 generator za raspršivanje NACK odgovora.
+ * @retval uint32_t Pseudo-slučajan broj.
+ */
+static uint32_t Agent_Random(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+/**
+ ******************************************************************************
+ * @brief       Učitava zapis o prekinutom transferu iz EEPROM-a.
+ * @author      Gemini & [Vaše Ime]
+ * @note        Poziva se jednom, iz prvog `FwUpdateAgent_Init()`. Ako su
+ * zaglavlje i njegov CRC ispravni, bitmapa se učitava u `block_map` i
+ * broj primljenih blokova se ponovo prebrojava.
+ ******************************************************************************
+ */
+static void Agent_LoadResume(void)
+{
+    uint16_t received_crc;
+
+    resume.valid = false;
+    resume.dirty_lo = 0xFFFFU;
+    resume.dirty_hi = 0;
+
+    EE_ReadBuffer((uint8_t*)&resume.hdr, EE_FW_RESUME, sizeof(FwResume_EepromHeader_t));
+    if (resume.hdr.magic_number != EEPROM_MAGIC_NUMBER) return;
+
+    received_crc = resume.hdr.crc;
+    resume.hdr.crc = 0;
+    if (received_crc != (uint16_t)HAL_CRC_Calculate(&hcrc, (uint32_t*)&resume.hdr, sizeof(FwResume_EepromHeader_t))) return;
+    resume.hdr.crc = received_crc;
+
+    if (!FwBlockMap_Init(&block_map, resume.hdr.size, resume.hdr.block_size)) return;
+    EE_ReadBuffer(block_map.bits, EE_FW_RESUME + sizeof(FwResume_EepromHeader_t), (uint16_t)((block_map.total_blocks + 7U) / 8U));
+    FwBlockMap_Recount(&block_map);
+
+    resume.saved_blocks = block_map.received_blocks;
+    resume.valid = true;
+}
+
+/**
+ ******************************************************************************
+ * @brief       Upisuje odložene izmjene zapisa o napretku u EEPROM.
+ * @author      Gemini & [Vaše Ime]
+ * @note        Za novu sesiju se prvo poništava staro zaglavlje, zatim upisuje
+ * cijela (prazna) bitmapa i tek na kraju novo zaglavlje. Tokom sesije se
+ * upisuju samo bajtovi bitmape izmijenjeni od posljednjeg snimka, a
+ * zaglavlje ponovo samo kad se pomjeri granica obrisanog dijela zone
+ * (i to prije bitmape).
+ * Bitmapu mijenja isključivo glavna petlja, pa nije potrebna zaštita
+ * od prekida.
+ ******************************************************************************
+ */
+static void Agent_SaveResume(void)
+{
+    uint16_t invalid_magic = 0;
+    bool write_header;
+
+    if (resume.clear_pending)
+    {
+        resume.clear_pending = false;
+        EE_WriteBuffer((uint8_t*)&invalid_magic, EE_FW_RESUME, sizeof(uint16_t));
+    }
+    if (!resume.valid || !(resume.save_pending || resume.header_pending)) return;
+
+    write_header = resume.header_pending;
+    resume.header_pending = false;
+
+    if (resume.full_save)
+    {
+        resume.full_save = false;
+        write_header = true;
+        EE_WriteBuffer((uint8_t*)&invalid_magic, EE_FW_RESUME, sizeof(uint16_t));
+        EE_WriteBuffer(block_map.bits, EE_FW_RESUME + sizeof(FwResume_EepromHeader_t), (uint16_t)((block_map.total_blocks + 7U) / 8U));
+    }
+    else
+    {
+        // Pomjerena granica brisanja je već stvarna, pa se zaglavlje upisuje
+        // PRIJE bitmape: snimljen bit nikad ne pada u sektor koji bi se nakon
+        // nastavka ponovo brisao.
+        if (write_header)
+        {
+            Agent_WriteResumeHeader();
+            write_header = false;
         }
+        if (resume.save_pending && (resume.dirty_lo <= resume.dirty_hi))
+        {
+            EE_WriteBuffer(&block_map.bits[resume.dirty_lo],
+                           (uint16_t)(EE_FW_RESUME + sizeof(FwResume_EepromHeader_t) + resume.dirty_lo),
+                           (uint16_t)((resume.dirty_hi - resume.dirty_lo) + 1U));
+        }
+    }
+    resume.save_pending = false;
+    resume.dirty_lo = 0xFFFFU;
+    resume.dirty_hi = 0;
+    resume.saved_blocks = block_map.received_blocks;
+
+    if (write_header) Agent_WriteResumeHeader();
+}
+
+/**
+ * @brief  Računa CRC zaglavlja zapisa o napretku i upisuje ga u EEPROM.
+ */
+static void Agent_WriteResumeHeader(void)
+{
+    resume.hdr.crc = 0;
+    resume.hdr.crc = (uint16_t)HAL_CRC_Calculate(&hcrc, (uint32_t*)&resume.hdr, sizeof(FwResume_EepromHeader_t));
+    EE_WriteBuffer((uint8_t*)&resume.hdr, EE_FW_RESUME, sizeof(FwResume_EepromHeader_t));
+}
 
-        uint32_t primask_state;
-        FwInfoTypeDef receivedFwInfo;
-        uint8_t validation_result;
-
-        // Započinjemo kritičnu sekciju da osiguramo stabilno okruženje.
-        primask_state = __get_PRIMASK();
-        __disable_irq();
-        SCB_DisableDCache();
-
-        // =======================================================================
-        // === KORAK 1: Privremena rekonfiguracija CRC periferije na WORDS mod ===
-        // Deinicijalizujemo drajver da bismo osigurali čisto stanje, zatim ga
-        // inicijalizujemo sa FORMAT_WORDS, kako bootloader očekuje.
-        // =======================================================================
-        HAL_CRC_DeInit(&hcrc);
-        hcrc.InputDataFormat = CRC_INPUTDATA_FORMAT_WORDS;
-        if (HAL_CRC_Init(&hcrc) != HAL_OK) {
-            // Ako rekonfiguracija ne uspije, izlazimo sigurno.
-            validation_result = 0xFF; // Postavljamo na kod greške
-        } else {
-            // === KORAK 2: Izvršavanje validacije sa ispravnom konfiguracijom ===
-            memset(&receivedFwInfo, 0, sizeof(FwInfoTypeDef));
-            receivedFwInfo.ld_addr = staging_qspi_addr;
-            validation_result = GetFwInfo(&receivedFwInfo);
+/**
+ ******************************************************************************
+ * @brief       Pravi novi zapis o napretku za upravo započetu sesiju.
+ * @author      Gemini & [Vaše Ime]
+ * @note        Poziva se na početku nove sesije, prije brisanja prvog sektora.
+ * Sam upis u EEPROM se obavlja kasnije iz `FwUpdateAgent_Service()`.
+ * @param       block_size Veličina bloka bitmape.
+ ******************************************************************************
+ */
+static void Agent_StartResumeRecord(uint16_t block_size)
+{
+    resume.hdr.magic_number = EEPROM_MAGIC_NUMBER;
+    resume.hdr.block_size = block_size;
+    resume.hdr.size = agent.fwInfo.size;
+    resume.hdr.crc32 = agent.fwInfo.crc32;
+    resume.hdr.version = agent.fwInfo.version;
+    resume.hdr.staging_addr = staging_qspi_addr;
+    resume.hdr.erased_to = 0;
+    resume.hdr.crc = 0;
+    resume.saved_blocks = 0;
+    resume.dirty_lo = 0xFFFFU;
+    resume.dirty_hi = 0;
+    resume.clear_pending = false;
+    resume.header_pending = false;
+    resume.full_save = true;
+    resume.save_pending = true;
+    resume.valid = true;
+}
+
+/**
+ ******************************************************************************
+ * @brief       Provjerava da li se nova sesija može nastaviti iz zapisa.
+ * @author      Gemini & [Vaše Ime]
+ * @param       block_size Tražena veličina bloka ili 0 ako nije bitna (unicast).
+ * @retval      bool `true` ako zapis opisuje istu sliku i istu staging zonu.
+ ******************************************************************************
+ */
+static bool Agent_CanResume(uint16_t block_size)
+{
+    if (!resume.valid) return false;
+    if ((block_size != 0) && (block_size != resume.hdr.block_size)) return false;
+    return ((resume.hdr.size == agent.fwInfo.size) &&
+            (resume.hdr.crc32 == agent.fwInfo.crc32) &&
+            (resume.hdr.version == agent.fwInfo.version) &&
+            (resume.hdr.staging_addr == staging_qspi_addr));
+}
+
+/**
+ ******************************************************************************
+ * @brief       Označava blok kao upisan i po potrebi zakazuje snimanje napretka.
+ * @author      Gemini & [Vaše Ime]
+ * @param       index Indeks bloka.
+ ******************************************************************************
+ */
+static void Agent_MarkBlock(uint32_t index)
+{
+    uint16_t byte_index = (uint16_t)(index >> 3);
+
+    if (!FwBlockMap_Set(&block_map, index)) return;
+
+    if (byte_index < resume.dirty_lo) resume.dirty_lo = byte_index;
+    if (byte_index > resume.dirty_hi) resume.dirty_hi = byte_index;
+    if (((block_map.received_blocks - resume.saved_blocks) * block_map.block_size) >= FWU_RESUME_SAVE_INTERVAL)
+    {
+        resume.save_pending = true;
+    }
+}
+
+/**
+ ******************************************************************************
+ * @brief       Prekida sesiju bez brisanja već primljenih podataka.
+ * @author      Gemini & [Vaše Ime]
+ * @note        Koristi se kod gubitka veze (T_INACTIVITY_TIMEOUT) i kod
+ * nepotpune multicast sesije. Napredak se odmah snima u EEPROM, a
+ * agent se vraća u IDLE; nova START poruka za istu sliku nastavlja
+ * transfer. Ako zapis nije validan, ponaša se kao `Agent_HandleFailure()`.
+ ******************************************************************************
+ */
+static void Agent_Suspend(void)
+{
+    if (!resume.valid)
+    {
+        Agent_HandleFailure(NACK_REASON_NONE);
+        return;
+    }
+    resume.save_pending = true;
+    FwUpdateAgent_Init();
+}
+
+/**
+ ******************************************************************************
+ * @brief       Smješta primljeni paket u red za upis u QSPI.
+ * @author      Gemini & [Vaše Ime]
+ * @note        Poziva se iz UART prekida. Red ima jednog proizvođača (prekid)
+ * i jednog potrošača (glavna petlja), pa su dovoljni `volatile` indeksi.
+ * @param       addr  Apsolutna QSPI adresa upisa.
+ * @param       block Indeks bloka (multicast) ili 0 (unicast).
+ * @param       data  Pokazivač na podatke.
+ * @param       len   Dužina podataka.
+ * @retval      bool `false` ako je red pun ili je paket neispravan.
+ ******************************************************************************
+ */
+static bool Agent_QueueWrite(uint32_t addr, uint32_t block, const uint8_t *data, uint16_t len)
+{
+    uint8_t next = (uint8_t)((wq_tail + 1U) % FWU_WRITE_QUEUE_DEPTH);
+    FwWriteSlot_t *slot;
+
+    if ((len == 0) || (len > FWU_WRITE_SLOT_SIZE)) return false;
+    if (next == wq_head) return false;
+
+    slot = &write_queue[wq_tail];
+    slot->addr = addr;
+    slot->block = block;
+    slot->len = len;
+    memcpy(slot->data, data, len);
+    __DMB();
+    wq_tail = next;
+    return true;
+}
+
+/**
+ ******************************************************************************
+ * @brief       Evidentira uspješno upisan paket u bitmapi blokova.
+ * @author      Gemini & [Vaše Ime]
+ * @note        Unicast paketi se upisuju redom, pa se označavaju svi blokovi
+ * koji su upisom ovog paketa postali kompletni.
+ * @param       slot  Upisani paket.
+ ******************************************************************************
+ */
+static void Agent_CommitWrite(const FwWriteSlot_t *slot)
+{
+    uint32_t block;
+
+    if (agent.currentState == FSM_MCAST_RECEIVING)
+    {
+        Agent_MarkBlock(slot->block);
+        return;
+    }
+
+    block = agent.bytesWritten / block_map.block_size;
+    agent.bytesWritten += slot->len;
+    while ((block < block_map.total_blocks) &&
+           ((((block + 1) * block_map.block_size) <= agent.bytesWritten) ||
+            (agent.bytesWritten >= agent.fwInfo.size)))
+    {
+        Agent_MarkBlock(block++);
+    }
+}
+
+/**
+ ******************************************************************************
+ * @brief       Jedan korak "erase-ahead" obrade QSPI memorije.
+ * @author      Gemini & [Vaše Ime]
+ * @note        Poziva se iz `FwUpdateAgent_Service()` i nikad ne čeka na kraj
+ * brisanja. Redoslijed: (1) ako brisanje traje, samo se provjeri status;
+ * (2) upišu se svi paketi iz reda koji padaju u već obrisan dio zone;
+ * (3) po potrebi se pokrene brisanje sljedećeg sektora; (4) kad je red
+ * prazan i nema brisanja, obradi se primljeni FINISH.
+ ******************************************************************************
+ */
+static void Agent_ServiceFlash(void)
+{
+    uint32_t sector_addr;
+    uint8_t status;
+    bool qspi_open = false;
+
+    if (erase_sched.busy)
+    {
+        status = QSPI_GetStatus();
+        if (status == QSPI_BUSY)
+        {
+            if ((HAL_GetTick() - agent.eraseStartTick) > N25Q128A_SECTOR_ERASE_MAX_TIME)
+            {
+                Agent_HandleFailure(NACK_REASON_ERASE_FAILED);
+            }
+            return;
+        }
+        FwEraseSched_Done(&erase_sched);
+        MX_QSPI_Init();
+        QSPI_MemMapMode();
+        if (status != QSPI_OK)
+        {
+            Agent_HandleFailure(NACK_REASON_ERASE_FAILED);
+            return;
         }
+        resume.hdr.erased_to = FwEraseSched_ErasedOffset(&erase_sched);
+        resume.header_pending = true;
+    }
 
-        // =======================================================================
-        // === KORAK 3: Vraćanje CRC periferije na originalni BYTES mod ===
-        // Odmah nakon provjere, vraćamo CRC konfiguraciju na onu koju
-        // ostatak aplikacije (npr. EEPROM) očekuje.
-        // =======================================================================
-        HAL_CRC_DeInit(&hcrc);
-        hcrc.InputDataFormat = CRC_INPUTDATA_FORMAT_BYTES;
-        HAL_CRC_Init(&hcrc); // Ovdje ne provjeravamo grešku jer je ovo originalna, ispravna konfiguracija
+    while (wq_head != wq_tail)
+    {
+        const FwWriteSlot_t *slot = &write_queue[wq_head];
 
-        // Završavamo kritičnu sekciju.
-        SCB_EnableDCache();
-        __set_PRIMASK(primask_state);
+        if (!FwEraseSched_IsErased(&erase_sched, slot->addr, slot->len)) break;
+        if (!qspi_open)
+        {
+            MX_QSPI_Init();
+            qspi_open = true;
+        }
+        if (QSPI_Write((uint8_t*)slot->data, slot->addr, slot->len) != QSPI_OK)
+        {
+            MX_QSPI_Init();
+            QSPI_MemMapMode();
+            Agent_HandleFailure(NACK_REASON_WRITE_FAILED);
+            return;
+        }
+        Agent_CommitWrite(slot);
+        wq_head = (uint8_t)((wq_head + 1U) % FWU_WRITE_QUEUE_DEPTH);
+    }
+    if (qspi_open)
+    {
+        MX_QSPI_Init();
+        QSPI_MemMapMode();
+    }
+
+    if (FwEraseSched_Next(&erase_sched, agent.currentWriteAddr, &sector_addr))
+    {
+        // QSPI ostaje u indirektnom modu dok brisanje ne završi.
+        MX_QSPI_Init();
+        if (QSPI_EraseSectorStart(sector_addr) != QSPI_OK)
+        {
+            erase_sched.busy = false;
+            MX_QSPI_Init();
+            QSPI_MemMapMode();
+            Agent_HandleFailure(NACK_REASON_ERASE_FAILED);
+            return;
+        }
+        agent.eraseStartTick = HAL_GetTick();
+        return;
+    }
+
+    if (agent.finishPending && (wq_head == wq_tail))
+    {
+        Agent_CompleteFinish();
+    }
+}
+
+/**
+ ******************************************************************************
+ * @brief       Sačeka kraj započetog brisanja i vraća QSPI u memory-mapped mod.
+ * @author      Gemini & [Vaše Ime]
+ * @note        Koristi se pri prekidu sesije. Ako je brisanje uspješno završilo,
+ * nova granica se upisuje u zapis o napretku.
+ ******************************************************************************
+ */
+static void Agent_ReleaseQspi(void)
+{
+    uint8_t status;
+
+    if (!erase_sched.busy) return;
+
+    do
+    {
+        status = QSPI_GetStatus();
+#ifdef	USE_WATCHDOG
+        HAL_IWDG_Refresh(&hiwdg);
+#endif
+    }
+    while ((status == QSPI_BUSY) && ((HAL_GetTick() - agent.eraseStartTick) <= N25Q128A_SECTOR_ERASE_MAX_TIME));
+
+    if (status == QSPI_OK)
+    {
+        FwEraseSched_Done(&erase_sched);
+        resume.hdr.erased_to = FwEraseSched_ErasedOffset(&erase_sched);
+        resume.header_pending = true;
+    }
+    erase_sched.busy = false;
+    MX_QSPI_Init();
+    QSPI_MemMapMode();
+}
 
+/**
+ ******************************************************************************
+ * @brief       Završava sesiju nakon primljenog FINISH zahtjeva.
+ * @author      Gemini & [Vaše Ime]
+ * @note        Poziva se iz glavne petlje tek kada su svi primljeni paketi
+ * upisani. Za unicast se serveru šalje FINISH_ACK/NACK, a multicast
+ * sesija se, kao i ranije, ne potvrđuje.
+ ******************************************************************************
+ */
+static void Agent_CompleteFinish(void)
+{
+    agent.finishPending = false;
 
-        if (validation_result == 0) // Vraća 0 u slučaju uspjeha
+    if (agent.currentState == FSM_MCAST_RECEIVING)
+    {
+        if (!FwBlockMap_IsComplete(&block_map))
+        {
+            // Panel nije dobio sve blokove ni nakon popravki. Primljeni blokovi
+            // se zadržavaju, pa server može unicast transferom (sa zastavicom
+            // za nastavak) poslati samo ostatak.
+            Agent_Suspend();
+            return;
+        }
+        if (Agent_ValidateStagedImage() == 0)
         {
-            // SVE JE U REDU! Fajl na QSPI je validan.
-//                EE_WriteBuffer((uint8_t*)&receivedFwInfo, EE_BOOTLOADER_MARKER_ADDR, sizeof(FwInfoTypeDef));
-            uint8_t ack_response[] = {SUB_CMD_FINISH_ACK, tfifa};
-            TF_SendSimple(tf, FIRMWARE_UPDATE, ack_response, sizeof(ack_response));
             HAL_Delay(100);
             SYSRestart();
         }
         else
         {
-            // Greška se desila ili tokom rekonfiguracije ili tokom same CRC provjere.
-            uint8_t nack_response[] = {SUB_CMD_FINISH_NACK, tfifa, NACK_REASON_CRC_MISMATCH};
-            TF_SendSimple(tf, FIRMWARE_UPDATE, nack_response, sizeof(nack_response));
-            Agent_HandleFailure();
+            Agent_HandleFailure(NACK_REASON_NONE);
         }
-        break;
+        return;
     }
-    default:
-        break;
+
+    // Provjera da li se broj primljenih bajtova poklapa sa očekivanim.
+    if ((agent.bytesReceived != agent.fwInfo.size) || (agent.bytesWritten != agent.fwInfo.size))
+    {
+        uint8_t nack_response[] = {SUB_CMD_FINISH_NACK, tfifa, NACK_REASON_SIZE_MISMATCH};
+        TF_SendSimple(agent_tf, FIRMWARE_UPDATE, nack_response, sizeof(nack_response));
+        Agent_HandleFailure(NACK_REASON_NONE);
+        return;
+    }
+
+    if (Agent_ValidateStagedImage() == 0) // Vraća 0 u slučaju uspjeha
+    {
+        // SVE JE U REDU! Fajl na QSPI je validan.
+//        EE_WriteBuffer((uint8_t*)&receivedFwInfo, EE_BOOTLOADER_MARKER_ADDR, sizeof(FwInfoTypeDef));
+        uint8_t ack_response[] = {SUB_CMD_FINISH_ACK, tfifa};
+        TF_SendSimple(agent_tf, FIRMWARE_UPDATE, ack_response, sizeof(ack_response));
+        HAL_Delay(100);
+        SYSRestart();
+    }
+    else
+    {
+        // Greška se desila ili tokom rekonfiguracije ili tokom same CRC provjere.
+        uint8_t nack_response[] = {SUB_CMD_FINISH_NACK, tfifa, NACK_REASON_CRC_MISMATCH};
+        TF_SendSimple(agent_tf, FIRMWARE_UPDATE, nack_response, sizeof(nack_response));
+        Agent_HandleFailure(NACK_REASON_NONE);
     }
 }
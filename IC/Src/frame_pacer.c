@@ -0,0 +1,118 @@
+/**
+ ******************************************************************************
+ * @file    frame_pacer.c
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Implementacija tempiranja `GUI_Exec()` po vsync-u.
+ *
+ * @note    Redoslijed provjera na novom vsync-u: budžet prethodnog frejma,
+ * ima li šta za iscrtati, slobodan bafer, odgađanje zbog rada na busu.
+ * Ulaz pročitan na vsync-u na kojem frejm nije mogao biti iscrtan (bafer,
+ * budžet) se pamti, pa frejm ostaje visokog prioriteta.
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* UKLJUCENI FAJLOVI (INCLUDES)                                               */
+/*============================================================================*/
+#include "frame_pacer.h"
+#include <stdio.h>
+#include <string.h>
+
+/*============================================================================*/
+/* IMPLEMENTACIJA JAVNIH FUNKCIJA                                             */
+/*============================================================================*/
+
+void FramePacer_Init(FramePacer_t *pacer, const FramePacerOps_t *ops, uint32_t budget_us, uint8_t max_defer)
+{
+    memset(pacer, 0, sizeof(FramePacer_t));
+    pacer->ops = ops;
+    pacer->budget_us = (budget_us != 0U) ? budget_us : 1U;
+    pacer->max_defer = max_defer;
+    pacer->vsync = ops->vsync();
+    pacer->vsync_ms = ops->ms();
+    pacer->next_vsync = pacer->vsync + 1U;
+}
+
+bool FramePacer_Poll(FramePacer_t *pacer)
+{
+    const FramePacerOps_t *ops = pacer->ops;
+    uint32_t v = ops->vsync();
+    uint32_t ms = ops->ms();
+    bool invalid;
+
+    if (v == pacer->vsync)
+    {
+        if ((ms - pacer->vsync_ms) < FRAME_PACER_STALL_MS) return false;
+        // Nema prekida LTDC-a: odluka po vremenu, da GUI ne stane.
+        pacer->stalls++;
+        pacer->next_vsync = v;
+    }
+    pacer->vsync = v;
+    pacer->vsync_ms = ms;
+
+    if (ops->input()) pacer->input = true;
+    if ((int32_t)(v - pacer->next_vsync) < 0)
+    {
+        pacer->budget_waits++;
+        return false;
+    }
+
+    invalid = ops->invalid();
+    if (!pacer->input && !invalid)
+    {
+        pacer->idle++;
+        pacer->deferred = 0U;
+        return false;
+    }
+    if (ops->buffer_pending())
+    {
+        pacer->buffer_waits++;
+        return false;
+    }
+    if (!pacer->input && ops->busy())
+    {
+        if (pacer->deferred < pacer->max_defer)
+        {
+            pacer->deferred++;
+            pacer->deferrals++;
+            return false;
+        }
+        pacer->forced++;
+    }
+
+    pacer->frames++;
+    if (pacer->input) pacer->input_frames++;
+    pacer->input = false;
+    pacer->deferred = 0U;
+    return true;
+}
+
+void FramePacer_Done(FramePacer_t *pacer, uint32_t exec_us)
+{
+    uint32_t periods = exec_us / pacer->budget_us;
+
+    pacer->last_us = exec_us;
+    if (exec_us > pacer->max_us) pacer->max_us = exec_us;
+    if (periods != 0U) pacer->over_budget++;
+    pacer->next_vsync = pacer->vsync + 1U + periods;
+}
+
+uint32_t FramePacer_Report(const FramePacer_t *pacer, char *buf, uint32_t size)
+{
+    int n;
+
+    if (size == 0U) return 0U;
+    n = snprintf(buf, size,
+                 "frames %lu (input %lu), idle %lu, buffer %lu, budget %lu, deferred %lu, forced %lu, stalls %lu\n"
+                 "exec %lu/%lu us, over budget %lu\n",
+                 (unsigned long)pacer->frames, (unsigned long)pacer->input_frames, (unsigned long)pacer->idle,
+                 (unsigned long)pacer->buffer_waits, (unsigned long)pacer->budget_waits, (unsigned long)pacer->deferrals,
+                 (unsigned long)pacer->forced, (unsigned long)pacer->stalls,
+                 (unsigned long)pacer->last_us, (unsigned long)pacer->max_us, (unsigned long)pacer->over_budget);
+    if ((n < 0) || ((uint32_t)n >= size))
+    {
+        buf[0] = '\0';
+        return 0U;
+    }
+    return (uint32_t)n;
+}
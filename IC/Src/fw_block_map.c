@@ -0,0 +1,184 @@
+/**
+ ******************************************************************************
+ * @file    fw_block_map.c
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Implementacija bitmape primljenih blokova firmvera.
+ *
+ * @note    Čista logika bez zavisnosti od HAL-a. Sve funkcije rade isključivo
+ * nad proslijeđenom strukturom, pa se modul može koristiti za više
+ * nezavisnih instanci (npr. simulacija više panela na hostu).
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* UKLJUCENI FAJLOVI (INCLUDES)                                               */
+/*============================================================================*/
+#include "fw_block_map.h"
+#include <string.h>
+
+/*============================================================================*/
+/* IMPLEMENTACIJA JAVNIH FUNKCIJA                                             */
+/*============================================================================*/
+
+bool FwBlockMap_Init(FwBlockMap_t *map, uint32_t image_size, uint16_t block_size)
+{
+    memset(map, 0, sizeof(FwBlockMap_t));
+
+    if ((image_size == 0U) || (image_size > FWMAP_MAX_IMAGE_SIZE)) return false;
+    if (block_size < FWMAP_MIN_BLOCK_SIZE) return false;
+
+    map->image_size = image_size;
+    map->block_size = block_size;
+    map->total_blocks = (image_size + block_size - 1U) / block_size;
+    return true;
+}
+
+bool FwBlockMap_Test(const FwBlockMap_t *map, uint32_t index)
+{
+    if (index >= map->total_blocks) return false;
+    return ((map->bits[index >> 3] & (uint8_t)(1U << (index & 7U))) != 0U);
+}
+
+bool FwBlockMap_Set(FwBlockMap_t *map, uint32_t index)
+{
+    if (index >= map->total_blocks) return false;
+    if (FwBlockMap_Test(map, index)) return false;
+
+    map->bits[index >> 3] |= (uint8_t)(1U << (index & 7U));
+    map->received_blocks++;
+    return true;
+}
+
+uint16_t FwBlockMap_BlockLength(const FwBlockMap_t *map, uint32_t index)
+{
+    uint32_t offset;
+
+    if (index >= map->total_blocks) return 0U;
+    offset = index * map->block_size;
+    if ((map->image_size - offset) < map->block_size) return (uint16_t)(map->image_size - offset);
+    return map->block_size;
+}
+
+void FwBlockMap_Recount(FwBlockMap_t *map)
+{
+    uint32_t bytes = (map->total_blocks + 7U) / 8U;
+
+    if ((map->total_blocks & 7U) != 0U)
+    {
+        map->bits[bytes - 1U] &= (uint8_t)((1U << (map->total_blocks & 7U)) - 1U);
+    }
+    if (bytes < FWMAP_BITMAP_BYTES)
+    {
+        memset(&map->bits[bytes], 0, FWMAP_BITMAP_BYTES - bytes);
+    }
+
+    map->received_blocks = 0U;
+    for (uint32_t i = 0U; i < bytes; i++)
+    {
+        uint8_t b = map->bits[i];
+        while (b != 0U)
+        {
+            b &= (uint8_t)(b - 1U);
+            map->received_blocks++;
+        }
+    }
+}
+
+bool FwBlockMap_IsComplete(const FwBlockMap_t *map)
+{
+    return ((map->total_blocks != 0U) && (map->received_blocks == map->total_blocks));
+}
+
+uint32_t FwBlockMap_FirstMissing(const FwBlockMap_t *map, uint32_t from)
+{
+    uint32_t i = from;
+
+    while (i < map->total_blocks)
+    {
+        // Cijeli bajt je popunjen - preskoči osam blokova odjednom.
+        if (((i & 7U) == 0U) && (map->bits[i >> 3] == 0xFFU))
+        {
+            i += 8U;
+            continue;
+        }
+        if (!FwBlockMap_Test(map, i)) return i;
+        i++;
+    }
+    return map->total_blocks;
+}
+
+uint8_t FwBlockMap_GetMissingRanges(const FwBlockMap_t *map, FwBlockRange_t *ranges, uint8_t max)
+{
+    uint8_t count = 0U;
+    uint32_t i = FwBlockMap_FirstMissing(map, 0U);
+
+    while ((i < map->total_blocks) && (count < max))
+    {
+        uint32_t first = i;
+
+        while ((i < map->total_blocks) && !FwBlockMap_Test(map, i) && ((i - first) < 0xFFFFU))
+        {
+            i++;
+        }
+        ranges[count].first = first;
+        ranges[count].count = (uint16_t)(i - first);
+        count++;
+        i = FwBlockMap_FirstMissing(map, i);
+    }
+    return count;
+}
+
+uint8_t FwBlockMap_SuppressRanges(FwBlockRange_t *mine, uint8_t mine_count, uint8_t max,
+                                  const FwBlockRange_t *heard, uint8_t heard_count)
+{
+    for (uint8_t h = 0U; h < heard_count; h++)
+    {
+        uint32_t h_first = heard[h].first;
+        uint32_t h_end = heard[h].first + heard[h].count;
+        uint8_t m = 0U;
+
+        while (m < mine_count)
+        {
+            uint32_t m_first = mine[m].first;
+            uint32_t m_end = mine[m].first + mine[m].count;
+
+            if ((h_end <= m_first) || (h_first >= m_end))
+            {
+                m++;
+                continue;
+            }
+            if ((h_first > m_first) && (h_end < m_end))
+            {
+                // Tuđi opseg je u sredini vlastitog: ostaje lijevi dio, a desni
+                // ide iza njega ako ima mjesta (lista ostaje sortirana).
+                mine[m].count = (uint16_t)(h_first - m_first);
+                if (mine_count < max)
+                {
+                    memmove(&mine[m + 2U], &mine[m + 1U], (uint32_t)(mine_count - m - 1U) * sizeof(FwBlockRange_t));
+                    mine_count++;
+                    mine[m + 1U].first = h_end;
+                    mine[m + 1U].count = (uint16_t)(m_end - h_end);
+                }
+                m++;
+            }
+            else if (h_first > m_first)
+            {
+                mine[m].count = (uint16_t)(h_first - m_first);
+                m++;
+            }
+            else if (h_end < m_end)
+            {
+                mine[m].first = h_end;
+                mine[m].count = (uint16_t)(m_end - h_end);
+                m++;
+            }
+            else
+            {
+                // Cijeli opseg je već zatražen.
+                memmove(&mine[m], &mine[m + 1U], (uint32_t)(mine_count - m - 1U) * sizeof(FwBlockRange_t));
+                mine_count--;
+            }
+        }
+    }
+    return mine_count;
+}
@@ -0,0 +1,84 @@
+/**
+ ******************************************************************************
+ * @file    fw_erase_sched.c
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Implementacija raspoređivača brisanja "staging" zone ispred upisa.
+ *
+ * @note    Čista logika bez zavisnosti od HAL-a. Zona se briše strogo
+ * redom, od početka prema kraju, tako da je uvijek dovoljno pamtiti
+ * samo jednu granicu (`erased_to`).
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* UKLJUCENI FAJLOVI (INCLUDES)                                               */
+/*============================================================================*/
+#include "fw_erase_sched.h"
+#include <string.h>
+
+/*============================================================================*/
+/* IMPLEMENTACIJA JAVNIH FUNKCIJA                                             */
+/*============================================================================*/
+
+bool FwEraseSched_Init(FwEraseSched_t *sched, uint32_t start, uint32_t size,
+                       uint32_t sector_size, uint8_t lookahead_sectors)
+{
+    memset(sched, 0, sizeof(FwEraseSched_t));
+
+    if ((size == 0U) || (sector_size == 0U) || ((sector_size & (sector_size - 1U)) != 0U)) return false;
+
+    sched->base = start & ~(sector_size - 1U);
+    sched->end = start + size;
+    sched->sector_size = sector_size;
+    sched->lookahead = (uint32_t)lookahead_sectors * sector_size;
+    sched->erased_to = sched->base;
+    return true;
+}
+
+void FwEraseSched_Restore(FwEraseSched_t *sched, uint32_t offset)
+{
+    offset &= ~(sched->sector_size - 1U);
+    sched->erased_to = sched->base + offset;
+    if (sched->erased_to > sched->end)
+    {
+        // Zadnji sektor može prelaziti kraj slike; granicu zaokružujemo na njega.
+        sched->erased_to = sched->base + (((sched->end - sched->base) + sched->sector_size - 1U) & ~(sched->sector_size - 1U));
+    }
+    sched->busy = false;
+}
+
+bool FwEraseSched_IsErased(const FwEraseSched_t *sched, uint32_t addr, uint32_t len)
+{
+    if (addr < sched->base) return false;
+    return ((addr + len) <= sched->erased_to);
+}
+
+bool FwEraseSched_Next(FwEraseSched_t *sched, uint32_t write_ptr, uint32_t *sector_addr)
+{
+    if (sched->busy || FwEraseSched_IsComplete(sched)) return false;
+
+    // Brišemo samo dok granica ne odmakne `lookahead` bajtova ispred upisa,
+    // jer svako brisanje blokira upis u čip za sve vrijeme svog trajanja.
+    if (sched->erased_to >= (write_ptr + sched->lookahead)) return false;
+
+    *sector_addr = sched->erased_to;
+    sched->busy = true;
+    return true;
+}
+
+void FwEraseSched_Done(FwEraseSched_t *sched)
+{
+    if (!sched->busy) return;
+    sched->busy = false;
+    sched->erased_to += sched->sector_size;
+}
+
+uint32_t FwEraseSched_ErasedOffset(const FwEraseSched_t *sched)
+{
+    return (sched->erased_to - sched->base);
+}
+
+bool FwEraseSched_IsComplete(const FwEraseSched_t *sched)
+{
+    return ((sched->sector_size != 0U) && (sched->erased_to >= sched->end));
+}
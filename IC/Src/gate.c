@@ -255,7 +255,7 @@ void Gate_Service(void)
                         handle->current_state = GATE_STATE_CLOSED;
                         handle->active_timer_type = GATE_TIMER_NONE;
                         handle->timer_start_tick = 0;
-                        shouldDrawScreen = 1;
+                        DISP_InvalidateGate(i);
                     }
                     // 3. LOGIKA ZA RAMPU/KAPIJE (nastavi sa CYCLE tajmerom)
                     else if (handle->current_state == GATE_STATE_OPENING || handle->current_state == GATE_STATE_CLOSING) 
@@ -290,7 +290,7 @@ void Gate_Service(void)
                         handle->current_state = GATE_STATE_FAULT;
                         handle->active_timer_type = GATE_TIMER_NONE;
                         handle->timer_start_tick = 0;
-                        shouldDrawScreen = 1; 
+                        DISP_InvalidateGate(i);
                         break;
                     }
 
@@ -303,7 +303,7 @@ void Gate_Service(void)
                     
                     handle->active_timer_type = GATE_TIMER_NONE;
                     handle->timer_start_tick = 0;
-                    shouldDrawScreen = 1;
+                    DISP_InvalidateGate(i);
                 }
                 break;
             }
@@ -517,6 +517,8 @@ void Gate_SetCustomLabel(Gate_Handle* handle, const char* label)
     if (handle && label) {
         strncpy(handle->config.custom_label, label, sizeof(handle->config.custom_label) - 1);
         handle->config.custom_label[sizeof(handle->config.custom_label) - 1] = '\0';
+        // Sirina labele se mijenja, mjerenje u display.c je zastarjelo.
+        DISP_InvalidateLabels();
     }
 }
 
@@ -671,7 +673,7 @@ static void Gate_SendAction(Gate_Handle* handle, UI_Command_e command)
             handle->current_state = GATE_STATE_OPEN;
             handle->active_timer_type = GATE_TIMER_PULSE; // Koristi samo puls tajmer
             handle->timer_start_tick = HAL_GetTick() ? HAL_GetTick() : 1;
-            shouldDrawScreen = 1;
+            DISP_InvalidateGate((uint8_t)(handle - gates));
 
             Gate_SendRawCommand(handle, akcija->target_relay_index, akcija->is_pulse);
             return; // Brava završava ovde, ne ide dalje u Smart Step ili Ciklus logiku!
@@ -722,13 +724,13 @@ static void Gate_SendAction(Gate_Handle* handle, UI_Command_e command)
             
         case UI_COMMAND_STOP:
             Gate_SetState(handle, GATE_STATE_PARTIALLY_OPEN);
-            shouldDrawScreen = 1;
+            DISP_InvalidateGate((uint8_t)(handle - gates));
             return; // Izlazimo odmah jer STOP samo gasi releje
 
          case UI_COMMAND_UNLOCK:
             // KLJUČNA ISPRAVKA: Brava se vizuelno otvara samo DOK traje puls
             handle->current_state = GATE_STATE_OPEN; // VIZUELNO: Otvoreno
-            shouldDrawScreen = 1;
+            DISP_InvalidateGate((uint8_t)(handle - gates));
             // Ne prekidamo ovde, jer treba da pošaljemo sirovu komandu u nastavku
             break;
 
@@ -847,8 +849,8 @@ static void HandleSensorEvent(Gate_Handle* handle, uint16_t sensor_addr, uint8_t
         Gate_StopAllRelays(handle);
     }
     
-    // Obavijesti GUI da je potrebno ponovno iscrtavanje.
-    shouldDrawScreen = 1;
+    // Obavijesti GUI da je potrebno ponovno iscrtavanje pločice ove kapije.
+    DISP_InvalidateGate((uint8_t)(handle - gates));
 }
 
 /**
@@ -0,0 +1,299 @@
+/**
+ ******************************************************************************
+ * @file    glyph_cache.c
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Implementacija keša rasterizovanih glifova.
+ *
+ * @note    Glifovi prstena se smještaju redom od `ring_head`. Kad glif ne
+ * stane do kraja bazena, izbacuju se glifovi iza `ring_head` i prsten
+ * kreće ispočetka (iza trajnog dijela). Najstariji glif je uvijek prvi
+ * iza `ring_head`, pa se mjesto oslobađa izbacivanjem sa početka `fifo`.
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* UKLJUCENI FAJLOVI (INCLUDES)                                               */
+/*============================================================================*/
+#include "glyph_cache.h"
+#include <string.h>
+#include <stdio.h>
+
+/*============================================================================*/
+/* PROTOTIPOVI PRIVATNIH FUNKCIJA                                             */
+/*============================================================================*/
+static uint16_t Glyph_Hash(const void *font, uint16_t code);
+static GlyphCacheEntry_t *Glyph_Find(GlyphCache_t *cache, const void *font, uint16_t code);
+static GlyphCacheEntry_t *Glyph_Insert(GlyphCache_t *cache, const void *font, uint16_t code, bool pinned);
+static bool Glyph_AllocRing(GlyphCache_t *cache, uint32_t size, uint32_t *offset);
+static void Glyph_EvictOldest(GlyphCache_t *cache);
+static void Glyph_Unlink(GlyphCache_t *cache, uint16_t index);
+static void Glyph_Rasterize(const GlyphSource_t *src, uint8_t *alpha);
+
+/*============================================================================*/
+/* IMPLEMENTACIJA JAVNIH FUNKCIJA                                             */
+/*============================================================================*/
+
+void GlyphCache_Init(GlyphCache_t *cache, uint8_t *pool, uint32_t budget, GlyphFetch_t fetch)
+{
+    memset(cache, 0, sizeof(GlyphCache_t));
+    cache->pool = pool;
+    cache->budget = budget & ~(GLYPH_CACHE_ALIGN - 1U);
+    cache->fetch = fetch;
+    GlyphCache_Flush(cache);
+}
+
+const GlyphCacheEntry_t *GlyphCache_Get(GlyphCache_t *cache, const void *font, uint16_t code)
+{
+    GlyphCacheEntry_t *entry;
+
+    cache->lookups++;
+    entry = Glyph_Find(cache, font, code);
+    if (entry != NULL)
+    {
+        cache->hits++;
+        return entry;
+    }
+    return Glyph_Insert(cache, font, code, false);
+}
+
+uint16_t GlyphCache_Preload(GlyphCache_t *cache, const void *font, const uint16_t *codes, uint16_t count)
+{
+    uint16_t loaded = 0U;
+
+    // Trajni dio raste preko početka prstena.
+    while (cache->fifo_count > 0U) Glyph_EvictOldest(cache);
+    cache->ring_head = cache->pinned_end;
+
+    for (uint16_t i = 0U; i < count; i++)
+    {
+        GlyphCacheEntry_t *entry = Glyph_Find(cache, font, codes[i]);
+        if (entry == NULL) entry = Glyph_Insert(cache, font, codes[i], true);
+        if (entry != NULL) loaded++;
+    }
+    cache->ring_head = cache->pinned_end;
+    return loaded;
+}
+
+void GlyphCache_Flush(GlyphCache_t *cache)
+{
+    memset(cache->entries, 0, sizeof(cache->entries));
+    for (uint16_t i = 0U; i < GLYPH_CACHE_MAX_ENTRIES; i++)
+    {
+        cache->entries[i].next = (uint16_t)(i + 1U);
+    }
+    cache->entries[GLYPH_CACHE_MAX_ENTRIES - 1U].next = GLYPH_CACHE_NONE;
+    for (uint16_t i = 0U; i < GLYPH_CACHE_BUCKETS; i++)
+    {
+        cache->buckets[i] = GLYPH_CACHE_NONE;
+    }
+    cache->free_first = 0U;
+    cache->fifo_first = 0U;
+    cache->fifo_count = 0U;
+    cache->pinned = 0U;
+    cache->pinned_end = 0U;
+    cache->ring_head = 0U;
+}
+
+uint16_t GlyphCache_HitRate(const GlyphCache_t *cache)
+{
+    if (cache->lookups == 0U) return 0U;
+    return (uint16_t)(((uint64_t)cache->hits * 1000U) / cache->lookups);
+}
+
+uint32_t GlyphCache_Report(const GlyphCache_t *cache, char *buf, uint32_t size)
+{
+    uint16_t rate = GlyphCache_HitRate(cache);
+    int n;
+
+    if (size == 0U) return 0U;
+    n = snprintf(buf, size, "glyphs: %lu lookups, %lu saved (%u.%u%%), %lu fetched %lu B, %lu evicted, %u pinned %lu/%lu B\n",
+                 (unsigned long)cache->lookups, (unsigned long)cache->hits, rate / 10U, rate % 10U,
+                 (unsigned long)cache->fetches, (unsigned long)cache->fetch_bytes, (unsigned long)cache->evictions,
+                 cache->pinned, (unsigned long)cache->pinned_end, (unsigned long)cache->budget);
+    if ((n < 0) || ((uint32_t)n >= size))
+    {
+        buf[0] = '\0';
+        return 0U;
+    }
+    return (uint32_t)n;
+}
+
+/*============================================================================*/
+/* IMPLEMENTACIJA PRIVATNIH FUNKCIJA                                          */
+/*============================================================================*/
+
+static uint16_t Glyph_Hash(const void *font, uint16_t code)
+{
+    uint32_t h = (uint32_t)(uintptr_t)font ^ ((uint32_t)code * 2654435761U);
+
+    h ^= h >> 15;
+    return (uint16_t)(h & (GLYPH_CACHE_BUCKETS - 1U));
+}
+
+static GlyphCacheEntry_t *Glyph_Find(GlyphCache_t *cache, const void *font, uint16_t code)
+{
+    uint16_t index = cache->buckets[Glyph_Hash(font, code)];
+
+    while (index != GLYPH_CACHE_NONE)
+    {
+        GlyphCacheEntry_t *entry = &cache->entries[index];
+        if ((entry->code == code) && (entry->font == font)) return entry;
+        index = entry->next;
+    }
+    return NULL;
+}
+
+/**
+ * @brief  Čita glif iz fonta, dekodira ga u bazen i dodaje zapis.
+ * @note   Trajni glifovi idu na `pinned_end`, ostali u prsten.
+ */
+static GlyphCacheEntry_t *Glyph_Insert(GlyphCache_t *cache, const void *font, uint16_t code, bool pinned)
+{
+    GlyphSource_t src;
+    GlyphCacheEntry_t *entry;
+    uint32_t size, offset;
+    uint16_t index, bucket;
+
+    if (!cache->fetch(font, code, &src) || (src.data == NULL) || ((src.bpp != 1U) && (src.bpp != 2U) && (src.bpp != 4U) && (src.bpp != 8U)))
+    {
+        cache->uncached++;
+        return NULL;
+    }
+    cache->fetches++;
+    cache->fetch_bytes += (uint32_t)src.bytes_per_line * src.height;
+
+    size = ((uint32_t)src.width * src.height + (GLYPH_CACHE_ALIGN - 1U)) & ~(GLYPH_CACHE_ALIGN - 1U);
+    if (size == 0U) size = GLYPH_CACHE_ALIGN;  // Razmak: prazan glif, ali sa pomakom.
+    if (size > 0xFFFFU)
+    {
+        cache->uncached++;
+        return NULL;
+    }
+
+    if (pinned)
+    {
+        if (((cache->pinned_end + size) > cache->budget) || (cache->free_first == GLYPH_CACHE_NONE))
+        {
+            cache->uncached++;
+            return NULL;
+        }
+        offset = cache->pinned_end;
+        cache->pinned_end += size;
+        cache->pinned++;
+    }
+    else
+    {
+        if (!Glyph_AllocRing(cache, size, &offset))
+        {
+            cache->uncached++;
+            return NULL;
+        }
+        while ((cache->free_first == GLYPH_CACHE_NONE) && (cache->fifo_count > 0U)) Glyph_EvictOldest(cache);
+        if (cache->free_first == GLYPH_CACHE_NONE)
+        {
+            cache->uncached++;
+            return NULL;
+        }
+    }
+
+    index = cache->free_first;
+    entry = &cache->entries[index];
+    cache->free_first = entry->next;
+
+    entry->font = font;
+    entry->code = code;
+    entry->offset = offset;
+    entry->size = (uint16_t)size;
+    entry->alpha = cache->pool + offset;
+    entry->width = src.width;
+    entry->height = src.height;
+    entry->xdist = src.xdist;
+    entry->pinned = pinned;
+    Glyph_Rasterize(&src, entry->alpha);
+
+    bucket = Glyph_Hash(font, code);
+    entry->next = cache->buckets[bucket];
+    cache->buckets[bucket] = index;
+    if (!pinned)
+    {
+        cache->fifo[(cache->fifo_first + cache->fifo_count) % GLYPH_CACHE_MAX_ENTRIES] = index;
+        cache->fifo_count++;
+    }
+    return entry;
+}
+
+/**
+ * @brief  Rezerviše `size` bajta u prstenu, izbacujući najstarije glifove.
+ */
+static bool Glyph_AllocRing(GlyphCache_t *cache, uint32_t size, uint32_t *offset)
+{
+    if ((cache->budget - cache->pinned_end) < size) return false;
+
+    if ((cache->ring_head + size) > cache->budget)
+    {
+        // Ne staje do kraja: glifovi iza ring_head su najstariji.
+        while ((cache->fifo_count > 0U) && (cache->entries[cache->fifo[cache->fifo_first]].offset >= cache->ring_head))
+        {
+            Glyph_EvictOldest(cache);
+        }
+        cache->ring_head = cache->pinned_end;
+    }
+    while (cache->fifo_count > 0U)
+    {
+        const GlyphCacheEntry_t *oldest = &cache->entries[cache->fifo[cache->fifo_first]];
+        if ((oldest->offset >= (cache->ring_head + size)) || ((oldest->offset + oldest->size) <= cache->ring_head)) break;
+        Glyph_EvictOldest(cache);
+    }
+    *offset = cache->ring_head;
+    cache->ring_head += size;
+    return true;
+}
+
+static void Glyph_EvictOldest(GlyphCache_t *cache)
+{
+    uint16_t index = cache->fifo[cache->fifo_first];
+
+    cache->fifo_first = (uint16_t)((cache->fifo_first + 1U) % GLYPH_CACHE_MAX_ENTRIES);
+    cache->fifo_count--;
+    Glyph_Unlink(cache, index);
+    cache->entries[index].next = cache->free_first;
+    cache->free_first = index;
+    cache->evictions++;
+}
+
+static void Glyph_Unlink(GlyphCache_t *cache, uint16_t index)
+{
+    const GlyphCacheEntry_t *entry = &cache->entries[index];
+    uint16_t *link = &cache->buckets[Glyph_Hash(entry->font, entry->code)];
+
+    while (*link != GLYPH_CACHE_NONE)
+    {
+        if (*link == index)
+        {
+            *link = entry->next;
+            return;
+        }
+        link = &cache->entries[*link].next;
+    }
+}
+
+/**
+ * @brief  Širi 1/2/4/8 bita alfe po pikselu u bajt (0..255).
+ */
+static void Glyph_Rasterize(const GlyphSource_t *src, uint8_t *alpha)
+{
+    static const uint8_t scale[9] = { 0U, 255U, 85U, 0U, 17U, 0U, 0U, 0U, 1U };
+    const uint8_t mask = (uint8_t)((1U << src->bpp) - 1U);
+    const uint8_t per_byte = (uint8_t)(8U / src->bpp);
+
+    for (uint8_t y = 0U; y < src->height; y++)
+    {
+        const uint8_t *line = src->data + (uint32_t)y * src->bytes_per_line;
+        for (uint8_t x = 0U; x < src->width; x++)
+        {
+            uint8_t shift = (uint8_t)(8U - src->bpp * ((x % per_byte) + 1U));
+            uint8_t value = (uint8_t)((line[x / per_byte] >> shift) & mask);
+            *alpha++ = (uint8_t)(value * scale[src->bpp]);
+        }
+    }
+}
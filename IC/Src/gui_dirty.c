@@ -0,0 +1,198 @@
+/**
+ ******************************************************************************
+ * @file    gui_dirty.c
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Implementacija liste prljavih pravougaonika ekrana.
+ *
+ * @note    Čista logika bez zavisnosti od emWin-a i HAL-a. Lista se drži
+ * bez preklapanja: svaki novi pravougaonik koji dodiruje postojeći
+ * se sa njim spaja i postupak se ponavlja dok ima preklapanja.
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* UKLJUCENI FAJLOVI (INCLUDES)                                               */
+/*============================================================================*/
+#include "gui_dirty.h"
+#include <string.h>
+
+/*============================================================================*/
+/* PROTOTIPOVI PRIVATNIH FUNKCIJA                                             */
+/*============================================================================*/
+static uint32_t Rect_Area(const GuiRect_t *r);
+static bool Rect_Overlaps(const GuiRect_t *a, const GuiRect_t *b);
+static void Rect_Union(const GuiRect_t *a, const GuiRect_t *b, GuiRect_t *out);
+static void Dirty_Remove(GuiDirty_t *dirty, uint8_t index);
+
+/*============================================================================*/
+/* IMPLEMENTACIJA JAVNIH FUNKCIJA                                             */
+/*============================================================================*/
+
+void GuiDirty_Init(GuiDirty_t *dirty, int16_t width, int16_t height)
+{
+    memset(dirty, 0, sizeof(GuiDirty_t));
+    dirty->width = width;
+    dirty->height = height;
+}
+
+void GuiDirty_Invalidate(GuiDirty_t *dirty, int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+    GuiRect_t r;
+    GuiRect_t u;
+    bool merged;
+
+    if (dirty->full) return;
+
+    // Odsijecanje na granice ekrana.
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 >= dirty->width) x1 = dirty->width - 1;
+    if (y1 >= dirty->height) y1 = dirty->height - 1;
+    if ((x1 < x0) || (y1 < y0)) return;
+
+    r.x0 = x0;
+    r.y0 = y0;
+    r.x1 = x1;
+    r.y1 = y1;
+
+    // Spajamo sa svim pravougaonicima koje novi dodiruje, ili kod kojih
+    // zajednički okvir nije veći od zbira površina (susjedne ikonice u redu).
+    do
+    {
+        merged = false;
+        for (uint8_t i = 0U; i < dirty->count; i++)
+        {
+            Rect_Union(&r, &dirty->rects[i], &u);
+            if (Rect_Overlaps(&r, &dirty->rects[i]) ||
+                (Rect_Area(&u) <= (Rect_Area(&r) + Rect_Area(&dirty->rects[i]))))
+            {
+                r = u;
+                Dirty_Remove(dirty, i);
+                merged = true;
+                break;
+            }
+        }
+    } while (merged);
+
+    if (dirty->count >= GUI_DIRTY_MAX_RECTS)
+    {
+        // Lista je puna - spajamo sa onim koji najmanje povećava površinu.
+        // Unija može prekriti i treće pravougaonike, pa se postupak ponavlja.
+        uint8_t best = 0U;
+        uint32_t best_growth = 0xFFFFFFFFU;
+
+        for (uint8_t i = 0U; i < dirty->count; i++)
+        {
+            Rect_Union(&r, &dirty->rects[i], &u);
+            uint32_t growth = Rect_Area(&u) - Rect_Area(&dirty->rects[i]);
+            if (growth < best_growth)
+            {
+                best_growth = growth;
+                best = i;
+            }
+        }
+        Rect_Union(&r, &dirty->rects[best], &u);
+        Dirty_Remove(dirty, best);
+        GuiDirty_Invalidate(dirty, u.x0, u.y0, u.x1, u.y1);
+        return;
+    }
+
+    dirty->rects[dirty->count++] = r;
+
+    if ((GuiDirty_Pixels(dirty) * 100U) >= ((uint32_t)dirty->width * (uint32_t)dirty->height * GUI_DIRTY_FULL_PERCENT))
+    {
+        GuiDirty_InvalidateAll(dirty);
+    }
+}
+
+void GuiDirty_InvalidateAll(GuiDirty_t *dirty)
+{
+    dirty->full = true;
+    dirty->count = 0U;
+}
+
+bool GuiDirty_IsEmpty(const GuiDirty_t *dirty)
+{
+    return (!dirty->full && (dirty->count == 0U));
+}
+
+uint8_t GuiDirty_Count(const GuiDirty_t *dirty)
+{
+    return dirty->full ? 1U : dirty->count;
+}
+
+bool GuiDirty_Get(const GuiDirty_t *dirty, uint8_t index, GuiRect_t *rect)
+{
+    if (dirty->full)
+    {
+        if (index != 0U) return false;
+        rect->x0 = 0;
+        rect->y0 = 0;
+        rect->x1 = dirty->width - 1;
+        rect->y1 = dirty->height - 1;
+        return true;
+    }
+    if (index >= dirty->count) return false;
+    *rect = dirty->rects[index];
+    return true;
+}
+
+bool GuiDirty_Intersects(const GuiDirty_t *dirty, const GuiRect_t *rect)
+{
+    if (dirty->full) return true;
+    for (uint8_t i = 0U; i < dirty->count; i++)
+    {
+        if (Rect_Overlaps(rect, &dirty->rects[i])) return true;
+    }
+    return false;
+}
+
+uint32_t GuiDirty_Pixels(const GuiDirty_t *dirty)
+{
+    uint32_t pixels = 0U;
+
+    if (dirty->full) return ((uint32_t)dirty->width * (uint32_t)dirty->height);
+    for (uint8_t i = 0U; i < dirty->count; i++)
+    {
+        pixels += Rect_Area(&dirty->rects[i]);
+    }
+    return pixels;
+}
+
+uint32_t GuiDirty_Commit(GuiDirty_t *dirty)
+{
+    dirty->last_pixels = GuiDirty_Pixels(dirty);
+    dirty->total_pixels += dirty->last_pixels;
+    dirty->redraws++;
+    dirty->full = false;
+    dirty->count = 0U;
+    return dirty->last_pixels;
+}
+
+/*============================================================================*/
+/* IMPLEMENTACIJA PRIVATNIH FUNKCIJA                                          */
+/*============================================================================*/
+
+static uint32_t Rect_Area(const GuiRect_t *r)
+{
+    return ((uint32_t)(r->x1 - r->x0 + 1) * (uint32_t)(r->y1 - r->y0 + 1));
+}
+
+static bool Rect_Overlaps(const GuiRect_t *a, const GuiRect_t *b)
+{
+    return ((a->x0 <= b->x1) && (b->x0 <= a->x1) && (a->y0 <= b->y1) && (b->y0 <= a->y1));
+}
+
+static void Rect_Union(const GuiRect_t *a, const GuiRect_t *b, GuiRect_t *out)
+{
+    out->x0 = (a->x0 < b->x0) ? a->x0 : b->x0;
+    out->y0 = (a->y0 < b->y0) ? a->y0 : b->y0;
+    out->x1 = (a->x1 > b->x1) ? a->x1 : b->x1;
+    out->y1 = (a->y1 > b->y1) ? a->y1 : b->y1;
+}
+
+static void Dirty_Remove(GuiDirty_t *dirty, uint8_t index)
+{
+    dirty->count--;
+    dirty->rects[index] = dirty->rects[dirty->count];
+}
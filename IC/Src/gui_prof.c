@@ -0,0 +1,308 @@
+/**
+ ******************************************************************************
+ * @file    gui_prof.c
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Implementacija mjerenja trajanja iscrtavanja.
+ *
+ * @note    Cijena mjerenja je vrijeme unutar `GuiProf_*` funkcija plus
+ * čitanje brojača pozivaoca (`probe_cycles`) za mjereni prolaz; preskočen
+ * prolaz se ne mjeri nego se dodaje njegova cijena izmjerena pri init-u
+ * (`skip_cycles`).
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* UKLJUCENI FAJLOVI (INCLUDES)                                               */
+/*============================================================================*/
+#include "gui_prof.h"
+#include <stdio.h>
+#include <string.h>
+
+/*============================================================================*/
+/* PROTOTIPOVI PRIVATNIH FUNKCIJA                                             */
+/*============================================================================*/
+static uint8_t Hist_Bin(uint32_t us);
+static void Prof_Flip(GuiProf_t *prof, uint32_t now);
+static void Prof_Window(GuiProf_t *prof, uint32_t now);
+static uint16_t Prof_Permille(uint32_t part, uint32_t whole);
+static int Prof_Line(char *buf, uint32_t size, const char *name, const GuiHist_t *hist);
+
+/*============================================================================*/
+/* IMPLEMENTACIJA JAVNIH FUNKCIJA                                             */
+/*============================================================================*/
+
+void GuiHist_Add(GuiHist_t *hist, uint32_t us)
+{
+    uint8_t bin = Hist_Bin(us);
+
+    if (hist->bins[bin] == UINT16_MAX)
+    {
+        // Zaokruživanje naviše: korpa sa uzorcima ne postaje prazna.
+        for (uint8_t i = 0U; i < GUI_PROF_BINS; i++)
+        {
+            hist->bins[i] = (uint16_t)((hist->bins[i] + 1U) / 2U);
+        }
+    }
+    hist->bins[bin]++;
+    hist->count++;
+    hist->sum_us += us;
+    hist->last_us = us;
+    if (us > hist->max_us) hist->max_us = us;
+}
+
+uint32_t GuiHist_Percentile(const GuiHist_t *hist, uint8_t pct)
+{
+    uint32_t total = 0U;
+    uint32_t target;
+    uint32_t sum = 0U;
+
+    for (uint8_t i = 0U; i < GUI_PROF_BINS; i++) total += hist->bins[i];
+    if (total == 0U) return 0U;
+
+    target = (total * pct + 99U) / 100U;
+    if (target == 0U) target = 1U;
+    for (uint8_t i = 0U; i < (GUI_PROF_BINS - 1U); i++)
+    {
+        sum += hist->bins[i];
+        if (sum >= target)
+        {
+            uint32_t bound = (2U << i) - 1U;
+            return (bound < hist->max_us) ? bound : hist->max_us;
+        }
+    }
+    return hist->max_us;
+}
+
+void GuiProf_Init(GuiProf_t *prof, const GuiProfOps_t *ops, uint32_t cycles_per_us, uint16_t budget_permille)
+{
+    uint32_t t0;
+
+    memset(prof, 0, sizeof(GuiProf_t));
+    prof->ops = ops;
+    prof->cycles_per_us = (cycles_per_us != 0U) ? cycles_per_us : 1U;
+    prof->budget_permille = budget_permille;
+
+    t0 = ops->now();
+    prof->probe_cycles = ops->now() - t0;
+    // Preskočen prolaz: čitanje brojača pozivaoca + brojanje.
+    prof->decimation = 2U;
+    t0 = ops->now();
+    GuiProf_Pass(prof, 0U, t0);
+    prof->skip_cycles = ops->now() - t0;
+
+    prof->decimation = 1U;
+    prof->skipped = 0U;
+    prof->window_cost = 0U;
+    prof->dma_last = ops->dma_busy();
+    prof->window_start = ops->now();
+}
+
+void GuiProf_Pass(GuiProf_t *prof, uint8_t screen, uint32_t start)
+{
+    uint32_t end;
+
+    if (++prof->skipped < prof->decimation)
+    {
+        prof->window_cost += prof->skip_cycles;
+        return;
+    }
+    prof->skipped = 0U;
+
+    end = prof->ops->now();
+    if (screen < GUI_PROF_MAX_SCREENS) GuiHist_Add(&prof->screen[screen], (end - start) / prof->cycles_per_us);
+    Prof_Flip(prof, end);
+    Prof_Window(prof, end);
+    prof->window_cost += (prof->ops->now() - end) + prof->probe_cycles;
+}
+
+void GuiProf_Exec(GuiProf_t *prof, uint32_t exec_us)
+{
+    uint32_t t0 = prof->ops->now();
+
+    GuiHist_Add(&prof->exec, exec_us);
+    prof->window_cost += prof->ops->now() - t0;
+}
+
+void GuiProf_Touch(GuiProf_t *prof)
+{
+    uint32_t t0 = prof->ops->now();
+
+    if (!prof->touch_pending)
+    {
+        // Bafer koji već čeka je iscrtan prije dodira; odziv je u sljedećem.
+        prof->touch_pending = true;
+        prof->touch_start = t0;
+        prof->touch_flip = prof->ops->flips() + (prof->ops->buffer_pending() ? 2U : 1U);
+    }
+    prof->window_cost += prof->ops->now() - t0;
+}
+
+void GuiProf_Reset(GuiProf_t *prof)
+{
+    memset(prof->screen, 0, sizeof(prof->screen));
+    memset(&prof->exec, 0, sizeof(prof->exec));
+    memset(&prof->touch, 0, sizeof(prof->touch));
+    prof->dma_total = 0U;
+    prof->dma_max_permille = 0U;
+    prof->cost_max_permille = 0U;
+    prof->touch_pending = false;
+    prof->touch_dropped = 0U;
+}
+
+uint32_t GuiProf_Report(const GuiProf_t *prof, char *buf, uint32_t size)
+{
+    uint32_t len;
+    int n;
+
+    if (size == 0U) return 0U;
+    buf[0] = '\0';
+    n = snprintf(buf, size,
+                 "dma2d %u.%u%% (max %u.%u%%), total %lu ms\n"
+                 "prof %u.%u%% (max %u.%u%%, budget %u.%u%%), screens 1/%u\n",
+                 prof->dma_permille / 10U, prof->dma_permille % 10U,
+                 prof->dma_max_permille / 10U, prof->dma_max_permille % 10U,
+                 (unsigned long)(prof->dma_total / ((uint64_t)prof->cycles_per_us * 1000U)),
+                 prof->cost_permille / 10U, prof->cost_permille % 10U,
+                 prof->cost_max_permille / 10U, prof->cost_max_permille % 10U,
+                 prof->budget_permille / 10U, prof->budget_permille % 10U, prof->decimation);
+    if ((n < 0) || ((uint32_t)n >= size))
+    {
+        buf[0] = '\0';
+        return 0U;
+    }
+    len = (uint32_t)n;
+
+    n = Prof_Line(&buf[len], size - len, "exec", &prof->exec);
+    if (n < 0) return len;
+    len += (uint32_t)n;
+    n = Prof_Line(&buf[len], size - len, "touch", &prof->touch);
+    if (n < 0) return len;
+    len += (uint32_t)n;
+    n = snprintf(&buf[len], size - len, "touch dropped %lu\n", (unsigned long)prof->touch_dropped);
+    if ((n < 0) || ((uint32_t)n >= (size - len)))
+    {
+        buf[len] = '\0';
+        return len;
+    }
+    len += (uint32_t)n;
+
+    for (uint8_t i = 0U; i < GUI_PROF_MAX_SCREENS; i++)
+    {
+        char name[8];
+
+        if (prof->screen[i].count == 0U) continue;
+        snprintf(name, sizeof(name), "scr %2u", i);
+        n = Prof_Line(&buf[len], size - len, name, &prof->screen[i]);
+        if (n < 0) return len;
+        len += (uint32_t)n;
+    }
+    return len;
+}
+
+/*============================================================================*/
+/* IMPLEMENTACIJA PRIVATNIH FUNKCIJA                                          */
+/*============================================================================*/
+
+/**
+ * @brief  Korpa za trajanje: 0 za < 2 µs, inače log2(us), najviše zadnja.
+ */
+static uint8_t Hist_Bin(uint32_t us)
+{
+    uint8_t bin = 0U;
+
+    while ((us > 1U) && (bin < (GUI_PROF_BINS - 1U)))
+    {
+        us >>= 1;
+        bin++;
+    }
+    return bin;
+}
+
+/**
+ * @brief  Završava mjerenje dodira kad je prikazan bafer iscrtan nakon njega;
+ *         dodir bez takvog bafera u `GUI_PROF_TOUCH_TIMEOUT_US` se odbacuje.
+ */
+static void Prof_Flip(GuiProf_t *prof, uint32_t now)
+{
+    if (!prof->touch_pending) return;
+
+    if ((int32_t)(prof->ops->flips() - prof->touch_flip) >= 0)
+    {
+        prof->touch_pending = false;
+        GuiHist_Add(&prof->touch, (prof->ops->flip_time() - prof->touch_start) / prof->cycles_per_us);
+    }
+    else if ((now - prof->touch_start) >= (GUI_PROF_TOUCH_TIMEOUT_US * prof->cycles_per_us))
+    {
+        // Dodir nije promijenio sliku (ili je iscrtavanje stalo).
+        prof->touch_pending = false;
+        prof->touch_dropped++;
+    }
+}
+
+/**
+ * @brief  Sabira zauzeće DMA2D-a; na kraju prozora računa procente i
+ *         prilagođava prorjeđivanje mjerenja budžetu.
+ */
+static void Prof_Window(GuiProf_t *prof, uint32_t now)
+{
+    uint32_t elapsed = now - prof->window_start;
+    uint32_t dma_busy = prof->ops->dma_busy();
+    uint32_t busy = dma_busy - prof->dma_last;
+
+    prof->dma_last = dma_busy;
+    prof->dma_window += busy;
+    prof->dma_total += busy;
+    if (elapsed < (GUI_PROF_WINDOW_US * prof->cycles_per_us)) return;
+
+    prof->dma_permille = Prof_Permille(prof->dma_window, elapsed);
+    if (prof->dma_permille > prof->dma_max_permille) prof->dma_max_permille = prof->dma_permille;
+    prof->cost_permille = Prof_Permille(prof->window_cost, elapsed);
+    if (prof->cost_permille > prof->cost_max_permille) prof->cost_max_permille = prof->cost_permille;
+
+    if ((prof->cost_permille > prof->budget_permille) && (prof->decimation < GUI_PROF_MAX_DECIMATION))
+    {
+        prof->decimation = (uint8_t)(prof->decimation * 2U);
+    }
+    else if ((prof->cost_permille < (prof->budget_permille / 2U)) && (prof->decimation > 1U))
+    {
+        prof->decimation = (uint8_t)(prof->decimation / 2U);
+    }
+    prof->window_start = now;
+    prof->window_cost = 0U;
+    prof->dma_window = 0U;
+}
+
+/**
+ * @brief  `part / whole` u promilima, najviše 1000.
+ */
+static uint16_t Prof_Permille(uint32_t part, uint32_t whole)
+{
+    uint64_t p;
+
+    if (whole == 0U) return 0U;
+    p = ((uint64_t)part * 1000U) / whole;
+    return (uint16_t)((p > 1000U) ? 1000U : p);
+}
+
+/**
+ * @brief  Upisuje red histograma: broj, prosjek, p50, p95, najduži.
+ * @retval int Broj upisanih znakova, -1 ako red ne stane (bafer ostaje
+ *         završen nulom na početku reda).
+ */
+static int Prof_Line(char *buf, uint32_t size, const char *name, const GuiHist_t *hist)
+{
+    int n;
+
+    if (size == 0U) return -1;
+    n = snprintf(buf, size, "%s: n %lu, avg %lu, p50 %lu, p95 %lu, max %lu us\n", name,
+                 (unsigned long)hist->count,
+                 (unsigned long)((hist->count != 0U) ? (hist->sum_us / hist->count) : 0U),
+                 (unsigned long)GuiHist_Percentile(hist, 50U), (unsigned long)GuiHist_Percentile(hist, 95U),
+                 (unsigned long)hist->max_us);
+    if ((n < 0) || ((uint32_t)n >= size))
+    {
+        buf[0] = '\0';
+        return -1;
+    }
+    return n;
+}
@@ -0,0 +1,196 @@
+/**
+ ******************************************************************************
+ * @file    gui_static.c
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Implementacija keša statičkih slojeva ekrana.
+ *
+ * @note    Svi uređaji su veličine ekrana, pa se uređaj drugog ekrana na
+ * istom LCD sloju ne briše nego samo preuzima i ponovo iscrtava. Tako se
+ * hip ne fragmentira, a alokacije se dešavaju samo kad ekran drugog sloja
+ * preuzima uređaj.
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* UKLJUCENI FAJLOVI (INCLUDES)                                               */
+/*============================================================================*/
+#include "gui_static.h"
+#include <stdio.h>
+#include <string.h>
+
+/*============================================================================*/
+/* PROTOTIPOVI PRIVATNIH FUNKCIJA                                             */
+/*============================================================================*/
+static GuiStaticSlot_t *Static_FindSlot(GuiStaticCache_t *cache, uint8_t screen);
+static GuiStaticStats_t *Static_FindStats(GuiStaticCache_t *cache, uint8_t screen);
+static uint32_t Static_Average(const GuiStaticStats_t *stats, GuiStaticTime_t kind);
+
+/*============================================================================*/
+/* IMPLEMENTACIJA JAVNIH FUNKCIJA                                             */
+/*============================================================================*/
+
+void GuiStatic_Init(GuiStaticCache_t *cache, const GuiStaticOps_t *ops)
+{
+    memset(cache, 0, sizeof(GuiStaticCache_t));
+    cache->ops = ops;
+    // Generacija 0 je rezervisana za "nikad iscrtano".
+    cache->generation = 1U;
+}
+
+void GuiStatic_InvalidateAll(GuiStaticCache_t *cache)
+{
+    cache->generation++;
+    if (cache->generation == 0U) cache->generation = 1U;
+}
+
+void GuiStatic_InvalidateScreen(GuiStaticCache_t *cache, uint8_t screen)
+{
+    GuiStaticSlot_t *slot = Static_FindSlot(cache, screen);
+
+    if (slot != NULL) slot->generation = 0U;
+}
+
+GuiStaticState_t GuiStatic_Acquire(GuiStaticCache_t *cache, uint8_t screen, uint8_t layer, uint32_t *handle)
+{
+    GuiStaticSlot_t *slot = Static_FindSlot(cache, screen);
+
+    cache->clock++;
+    if (slot == NULL)
+    {
+        // Prvo slobodan (nenapravljen) uređaj, inače najdavnije korišteni.
+        for (uint8_t i = 0U; i < GUI_STATIC_MAX_SLOTS; i++)
+        {
+            GuiStaticSlot_t *s = &cache->slots[i];
+            if (s->handle == 0U)
+            {
+                slot = s;
+                break;
+            }
+            if ((slot == NULL) || ((int32_t)(s->last_use - slot->last_use) < 0)) slot = s;
+        }
+        slot->screen = screen;
+        slot->generation = 0U;
+    }
+    if ((slot->handle != 0U) && (slot->layer != layer))
+    {
+        // Uređaj je u formatu drugog sloja i ne može se samo preuzeti.
+        cache->ops->destroy(slot->handle);
+        slot->handle = 0U;
+    }
+    if (slot->handle == 0U)
+    {
+        slot->handle = cache->ops->create(layer);
+        slot->layer = layer;
+        slot->generation = 0U;
+        if (slot->handle == 0U)
+        {
+            cache->create_failures++;
+            *handle = 0U;
+            return GUI_STATIC_DIRECT;
+        }
+    }
+
+    slot->last_use = cache->clock;
+    *handle = slot->handle;
+    return (slot->generation == cache->generation) ? GUI_STATIC_BLIT : GUI_STATIC_RENDER;
+}
+
+uint8_t GuiStatic_Release(GuiStaticCache_t *cache, uint8_t keep_screen)
+{
+    uint8_t released = 0U;
+
+    for (uint8_t i = 0U; i < GUI_STATIC_MAX_SLOTS; i++)
+    {
+        GuiStaticSlot_t *s = &cache->slots[i];
+
+        if ((s->handle == 0U) || (s->screen == keep_screen)) continue;
+        cache->ops->destroy(s->handle);
+        s->handle = 0U;
+        s->generation = 0U;
+        released++;
+    }
+    cache->releases += released;
+    return released;
+}
+
+void GuiStatic_Rendered(GuiStaticCache_t *cache, uint8_t screen)
+{
+    GuiStaticSlot_t *slot = Static_FindSlot(cache, screen);
+
+    if (slot != NULL) slot->generation = cache->generation;
+}
+
+void GuiStatic_Record(GuiStaticCache_t *cache, uint8_t screen, GuiStaticTime_t kind, uint32_t us)
+{
+    GuiStaticStats_t *stats = Static_FindStats(cache, screen);
+
+    if ((stats == NULL) || (kind >= GUI_STATIC_TIME_COUNT)) return;
+    stats->count[kind]++;
+    stats->total_us[kind] += us;
+    stats->last_us[kind] = us;
+}
+
+uint32_t GuiStatic_Report(const GuiStaticCache_t *cache, char *buf, uint32_t size)
+{
+    uint32_t len = 0U;
+
+    if (size == 0U) return 0U;
+    buf[0] = '\0';
+    for (uint8_t i = 0U; i < GUI_STATIC_MAX_SCREENS; i++)
+    {
+        const GuiStaticStats_t *s = &cache->stats[i];
+        uint32_t full, blit, dyn, cached, gain;
+        int n;
+
+        if (s->screen == 0U) continue;
+        // Bez keša se statički dio crtao direktno; ako tog mjerenja nema,
+        // uzima se iscrtavanje u uređaj, koje radi isti posao.
+        full = s->count[GUI_STATIC_TIME_DIRECT] ? Static_Average(s, GUI_STATIC_TIME_DIRECT) : Static_Average(s, GUI_STATIC_TIME_RENDER);
+        blit = Static_Average(s, GUI_STATIC_TIME_BLIT);
+        dyn = Static_Average(s, GUI_STATIC_TIME_DYNAMIC);
+        cached = blit + dyn;
+        gain = cached ? (((full + dyn) * 10U) / cached) : 0U;
+
+        n = snprintf(&buf[len], size - len, "scr %2u: static %6lu us, blit %5lu us (%lu), dyn %5lu us, gain x%lu.%lu\n",
+                     s->screen, (unsigned long)full, (unsigned long)blit, (unsigned long)s->count[GUI_STATIC_TIME_BLIT],
+                     (unsigned long)dyn, (unsigned long)(gain / 10U), (unsigned long)(gain % 10U));
+        if ((n < 0) || ((uint32_t)n >= (size - len)))
+        {
+            buf[len] = '\0';
+            break;
+        }
+        len += (uint32_t)n;
+    }
+    return len;
+}
+
+/*============================================================================*/
+/* IMPLEMENTACIJA PRIVATNIH FUNKCIJA                                          */
+/*============================================================================*/
+
+static GuiStaticSlot_t *Static_FindSlot(GuiStaticCache_t *cache, uint8_t screen)
+{
+    for (uint8_t i = 0U; i < GUI_STATIC_MAX_SLOTS; i++)
+    {
+        if ((cache->slots[i].handle != 0U) && (cache->slots[i].screen == screen)) return &cache->slots[i];
+    }
+    return NULL;
+}
+
+static GuiStaticStats_t *Static_FindStats(GuiStaticCache_t *cache, uint8_t screen)
+{
+    GuiStaticStats_t *free_stats = NULL;
+
+    for (uint8_t i = 0U; i < GUI_STATIC_MAX_SCREENS; i++)
+    {
+        if (cache->stats[i].screen == screen) return &cache->stats[i];
+        if ((free_stats == NULL) && (cache->stats[i].screen == 0U)) free_stats = &cache->stats[i];
+    }
+    if (free_stats != NULL) free_stats->screen = screen;
+    return free_stats;
+}
+
+static uint32_t Static_Average(const GuiStaticStats_t *stats, GuiStaticTime_t kind)
+{
+    return stats->count[kind] ? (stats->total_us[kind] / stats->count[kind]) : 0U;
+}
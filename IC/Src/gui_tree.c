@@ -0,0 +1,196 @@
+/**
+ ******************************************************************************
+ * @file    gui_tree.c
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Implementacija vlasništva nad widgetima po ekranu.
+ *
+ * @note    Widget pripada ekranu koji je aktivan kad ga `GuiTree_Sync()`
+ * nađe na desktopu. Zato `Init` funkcija ekrana koji se pravi u istom
+ * prolazu u kojem se mijenja `screen` poziva `GuiTree_Sync()` odmah nakon
+ * pravljenja widgeta.
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* UKLJUCENI FAJLOVI (INCLUDES)                                               */
+/*============================================================================*/
+#include "gui_tree.h"
+#include <stdio.h>
+#include <string.h>
+
+/*============================================================================*/
+/* PROTOTIPOVI PRIVATNIH FUNKCIJA                                             */
+/*============================================================================*/
+static void Tree_Show(GuiTree_t *tree, GuiTreeScreen_t *s, bool visible);
+static void Tree_Leave(GuiTree_t *tree, GuiTreeScreen_t *s);
+static uint16_t Tree_Adopt(GuiTree_t *tree, GuiTreeScreen_t *s);
+
+/*============================================================================*/
+/* IMPLEMENTACIJA JAVNIH FUNKCIJA                                             */
+/*============================================================================*/
+
+void GuiTree_Init(GuiTree_t *tree, const GuiTreeOps_t *ops)
+{
+    memset(tree, 0, sizeof(GuiTree_t));
+    tree->ops = ops;
+}
+
+void GuiTree_SetPersistent(GuiTree_t *tree, uint8_t screen)
+{
+    if (screen < GUI_TREE_MAX_SCREENS) tree->screens[screen].persistent = true;
+}
+
+void GuiTree_Sync(GuiTree_t *tree, uint8_t screen)
+{
+    const GuiTreeOps_t *ops = tree->ops;
+    uint32_t now = ops->now();
+    GuiTreeScreen_t *s;
+    bool changed = false;
+    uint16_t adopted;
+    uint32_t heap;
+
+    if (screen >= GUI_TREE_MAX_SCREENS) return;
+    s = &tree->screens[screen];
+
+    if (!tree->started || (screen != tree->current))
+    {
+        if (tree->started) Tree_Leave(tree, &tree->screens[tree->current]);
+        tree->transition_start = tree->started ? tree->last_sync : now;
+        tree->current = screen;
+        tree->started = true;
+        tree->measuring = true;
+        tree->built = false;
+        s->enters++;
+        if (s->widgets != 0U) s->reuses++;
+        changed = true;
+    }
+    if (!s->shown) Tree_Show(tree, s, true);
+
+    adopted = Tree_Adopt(tree, s);
+    if (adopted != 0U)
+    {
+        s->widgets += adopted;
+        tree->adopted += adopted;
+        if (tree->measuring && !tree->built)
+        {
+            tree->built = true;
+            s->builds++;
+        }
+    }
+
+    heap = ops->heap_used();
+    if (heap > s->heap_peak) s->heap_peak = heap;
+    if (heap > tree->heap_peak) tree->heap_peak = heap;
+
+    // Prelaz traje dok ekran pravi widgete; poziv koji je primijetio
+    // promjenu ga ne završava, jer se ekran tek nakon njega iscrtava.
+    if (tree->measuring && !changed && (adopted == 0U))
+    {
+        tree->measuring = false;
+        s->transition_last_us = ops->elapsed_us(tree->transition_start);
+        if (s->transition_last_us > s->transition_max_us) s->transition_max_us = s->transition_last_us;
+    }
+    tree->last_sync = now;
+}
+
+void GuiTree_Hide(GuiTree_t *tree, uint8_t screen)
+{
+    if (screen >= GUI_TREE_MAX_SCREENS) return;
+    if (tree->screens[screen].persistent && tree->screens[screen].shown)
+    {
+        Tree_Show(tree, &tree->screens[screen], false);
+    }
+}
+
+uint32_t GuiTree_Report(const GuiTree_t *tree, char *buf, uint32_t size)
+{
+    uint32_t len = 0U;
+    int n;
+
+    if (size == 0U) return 0U;
+    buf[0] = '\0';
+    n = snprintf(buf, size, "widgets %lu, leaked %lu, heap peak %lu KB\n",
+                 (unsigned long)tree->adopted, (unsigned long)tree->leaked, (unsigned long)(tree->heap_peak / 1024U));
+    if ((n < 0) || ((uint32_t)n >= size))
+    {
+        buf[0] = '\0';
+        return 0U;
+    }
+    len = (uint32_t)n;
+
+    for (uint8_t i = 0U; i < GUI_TREE_MAX_SCREENS; i++)
+    {
+        const GuiTreeScreen_t *s = &tree->screens[i];
+
+        if (s->enters == 0U) continue;
+        n = snprintf(&buf[len], size - len, "scr %2u: in %lu, built %lu, reused %lu, wdg %u, trans %lu/%lu us, heap %lu KB\n",
+                     i, (unsigned long)s->enters, (unsigned long)s->builds, (unsigned long)s->reuses, s->widgets,
+                     (unsigned long)s->transition_last_us, (unsigned long)s->transition_max_us,
+                     (unsigned long)(s->heap_peak / 1024U));
+        if ((n < 0) || ((uint32_t)n >= (size - len)))
+        {
+            buf[len] = '\0';
+            break;
+        }
+        len += (uint32_t)n;
+    }
+    return len;
+}
+
+/*============================================================================*/
+/* IMPLEMENTACIJA PRIVATNIH FUNKCIJA                                          */
+/*============================================================================*/
+
+static void Tree_Show(GuiTree_t *tree, GuiTreeScreen_t *s, bool visible)
+{
+    for (uint8_t layer = 0U; layer < GUI_TREE_LAYERS; layer++)
+    {
+        if (s->root[layer] != 0U) tree->ops->show(s->root[layer], visible);
+    }
+    s->shown = visible;
+}
+
+/**
+ * @brief  Napušta stablo ekrana: trajno skriva, ostala briše sa korijenom.
+ */
+static void Tree_Leave(GuiTree_t *tree, GuiTreeScreen_t *s)
+{
+    if (s->persistent)
+    {
+        if (s->shown) Tree_Show(tree, s, false);
+        return;
+    }
+    for (uint8_t layer = 0U; layer < GUI_TREE_LAYERS; layer++)
+    {
+        if (s->root[layer] == 0U) continue;
+        tree->leaked += tree->ops->destroy(s->root[layer]);
+        s->root[layer] = 0U;
+    }
+    s->widgets = 0U;
+    s->shown = false;
+}
+
+/**
+ * @brief  Premješta nove widgete sa desktopa pod korijene ekrana.
+ * @note   Korijen sloja se pravi tek kad na tom sloju ima widgeta. Ako za
+ *         korijen nema mjesta u hipu, widgeti ostaju na desktopu i
+ *         pokušava se ponovo pri sljedećem pozivu.
+ */
+static uint16_t Tree_Adopt(GuiTree_t *tree, GuiTreeScreen_t *s)
+{
+    const GuiTreeOps_t *ops = tree->ops;
+    uint16_t total = 0U;
+
+    for (uint8_t layer = 0U; layer < GUI_TREE_LAYERS; layer++)
+    {
+        if (s->root[layer] == 0U)
+        {
+            if (ops->adopt(layer, 0U) == 0U) continue;
+            s->root[layer] = ops->create_root(layer);
+            if (s->root[layer] == 0U) continue;
+            ops->show(s->root[layer], s->shown);
+        }
+        total += ops->adopt(layer, s->root[layer]);
+    }
+    return total;
+}
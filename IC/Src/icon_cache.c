@@ -0,0 +1,216 @@
+/**
+ ******************************************************************************
+ * @file    icon_cache.c
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Implementacija keša ikonica u SDRAM-u.
+ *
+ * @note    Kopije se smještaju first-fit u rupe između postojećih kopija.
+ * Ako rupa dovoljne veličine ne postoji, izbacuje se najdavnije
+ * korištena ikonica i traženje se ponavlja, dok se ne nađe mjesto ili
+ * keš ne isprazni. Svaki poziv vrijedi jedan "otkucaj" LRU sata.
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* UKLJUCENI FAJLOVI (INCLUDES)                                               */
+/*============================================================================*/
+#include "icon_cache.h"
+#include <string.h>
+
+/*============================================================================*/
+/* PROTOTIPOVI PRIVATNIH FUNKCIJA                                             */
+/*============================================================================*/
+static int16_t Cache_Find(const IconCache_t *cache, const void *key);
+static bool Cache_FindGap(const IconCache_t *cache, uint32_t size, uint32_t *offset, uint8_t *position);
+static void Cache_EvictLru(IconCache_t *cache);
+static const void *Cache_Insert(IconCache_t *cache, const void *key, const void *src, uint32_t size);
+static bool Cache_CountDraw(IconCache_t *cache, const void *key);
+static void Cache_DropCandidate(IconCache_t *cache, const void *key);
+
+/*============================================================================*/
+/* IMPLEMENTACIJA JAVNIH FUNKCIJA                                             */
+/*============================================================================*/
+
+void IconCache_Init(IconCache_t *cache, uint8_t *pool, uint32_t budget, IconCacheCopy_t copy)
+{
+    memset(cache, 0, sizeof(IconCache_t));
+    cache->pool = pool;
+    cache->budget = budget & ~(ICON_CACHE_ALIGN - 1U);
+    cache->copy = copy;
+}
+
+const void *IconCache_Get(IconCache_t *cache, const void *key, const void *src, uint32_t size)
+{
+    const void *data;
+    int16_t index;
+
+    cache->clock++;
+    index = Cache_Find(cache, key);
+    if (index >= 0)
+    {
+        cache->entries[index].last_use = cache->clock;
+        cache->hits++;
+        cache->cache_bytes += size;
+        return cache->pool + cache->entries[index].offset;
+    }
+
+    cache->misses++;
+    if (Cache_CountDraw(cache, key))
+    {
+        data = Cache_Insert(cache, key, src, size);
+        if (data != NULL)
+        {
+            // Izvor je pročitan jednom za kopiju, a crta se već iz keša.
+            Cache_DropCandidate(cache, key);
+            cache->source_bytes += size;
+            cache->cache_bytes += size;
+            return data;
+        }
+    }
+    cache->source_bytes += size;
+    return src;
+}
+
+bool IconCache_Preload(IconCache_t *cache, const void *key, const void *src, uint32_t size)
+{
+    int16_t index;
+
+    cache->clock++;
+    index = Cache_Find(cache, key);
+    if (index >= 0)
+    {
+        cache->entries[index].last_use = cache->clock;
+        return true;
+    }
+    if (Cache_Insert(cache, key, src, size) == NULL) return false;
+    Cache_DropCandidate(cache, key);
+    cache->source_bytes += size;
+    return true;
+}
+
+void IconCache_Flush(IconCache_t *cache)
+{
+    cache->count = 0U;
+    cache->used = 0U;
+    memset(cache->candidates, 0, sizeof(cache->candidates));
+}
+
+uint16_t IconCache_HitRate(const IconCache_t *cache)
+{
+    uint32_t total = cache->hits + cache->misses;
+
+    if (total == 0U) return 0U;
+    return (uint16_t)(((uint64_t)cache->hits * 1000U) / total);
+}
+
+/*============================================================================*/
+/* IMPLEMENTACIJA PRIVATNIH FUNKCIJA                                          */
+/*============================================================================*/
+
+static int16_t Cache_Find(const IconCache_t *cache, const void *key)
+{
+    for (uint8_t i = 0U; i < cache->count; i++)
+    {
+        if (cache->entries[i].key == key) return (int16_t)i;
+    }
+    return -1;
+}
+
+static bool Cache_FindGap(const IconCache_t *cache, uint32_t size, uint32_t *offset, uint8_t *position)
+{
+    uint32_t start = 0U;
+
+    for (uint8_t i = 0U; i < cache->count; i++)
+    {
+        if ((cache->entries[i].offset - start) >= size)
+        {
+            *offset = start;
+            *position = i;
+            return true;
+        }
+        start = cache->entries[i].offset + cache->entries[i].size;
+    }
+    if ((cache->budget - start) >= size)
+    {
+        *offset = start;
+        *position = cache->count;
+        return true;
+    }
+    return false;
+}
+
+static void Cache_EvictLru(IconCache_t *cache)
+{
+    uint8_t lru = 0U;
+
+    for (uint8_t i = 1U; i < cache->count; i++)
+    {
+        if ((int32_t)(cache->entries[i].last_use - cache->entries[lru].last_use) < 0) lru = i;
+    }
+    cache->used -= cache->entries[lru].size;
+    cache->count--;
+    memmove(&cache->entries[lru], &cache->entries[lru + 1U], (cache->count - lru) * sizeof(IconCacheEntry_t));
+    cache->evictions++;
+}
+
+static const void *Cache_Insert(IconCache_t *cache, const void *key, const void *src, uint32_t size)
+{
+    uint32_t aligned = (size + ICON_CACHE_ALIGN - 1U) & ~(ICON_CACHE_ALIGN - 1U);
+    uint32_t offset;
+    uint8_t position;
+    IconCacheEntry_t *entry;
+
+    if ((cache->pool == NULL) || (size == 0U) || (aligned > cache->budget)) return NULL;
+
+    if (cache->count >= ICON_CACHE_MAX_ENTRIES) Cache_EvictLru(cache);
+    while (!Cache_FindGap(cache, aligned, &offset, &position))
+    {
+        Cache_EvictLru(cache);
+    }
+
+    memmove(&cache->entries[position + 1U], &cache->entries[position], (cache->count - position) * sizeof(IconCacheEntry_t));
+    entry = &cache->entries[position];
+    entry->key = key;
+    entry->offset = offset;
+    entry->size = aligned;
+    entry->last_use = cache->clock;
+    cache->count++;
+    cache->used += aligned;
+    cache->promotions++;
+    cache->copy(cache->pool + offset, src, size);
+    return cache->pool + offset;
+}
+
+static bool Cache_CountDraw(IconCache_t *cache, const void *key)
+{
+    IconCacheCandidate_t *slot = &cache->candidates[0];
+
+    for (uint8_t i = 0U; i < ICON_CACHE_MAX_CANDIDATES; i++)
+    {
+        IconCacheCandidate_t *c = &cache->candidates[i];
+        if (c->key == key)
+        {
+            c->last_use = cache->clock;
+            if (c->draws < 0xFFU) c->draws++;
+            return (c->draws >= ICON_CACHE_PROMOTE_DRAWS);
+        }
+        // Slobodno mjesto ili najdavnije viđeni kandidat se zamjenjuje.
+        if ((slot->key != NULL) && ((c->key == NULL) || ((int32_t)(c->last_use - slot->last_use) < 0))) slot = c;
+    }
+    slot->key = key;
+    slot->last_use = cache->clock;
+    slot->draws = 1U;
+    return (ICON_CACHE_PROMOTE_DRAWS <= 1U);
+}
+
+static void Cache_DropCandidate(IconCache_t *cache, const void *key)
+{
+    for (uint8_t i = 0U; i < ICON_CACHE_MAX_CANDIDATES; i++)
+    {
+        if (cache->candidates[i].key == key)
+        {
+            memset(&cache->candidates[i], 0, sizeof(IconCacheCandidate_t));
+            return;
+        }
+    }
+}
@@ -0,0 +1,175 @@
+/**
+ ******************************************************************************
+ * @file    icon_codec.c
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Dekodiranje kompaktnih formata ikonica.
+ *
+ * @note    Čitanje je uvijek sekvencijalno po linijama, jer RLE linije nemaju
+ * tabelu pozicija. Ikonice su male (do ~100 linija), pa je preskakanje
+ * linija iznad odsječenog dijela jeftino. ARGB8888 pikseli se čitaju
+ * bajt po bajt (little-endian) da bi dekoder radio i na hostu.
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* UKLJUCENI FAJLOVI (INCLUDES)                                               */
+/*============================================================================*/
+#include "icon_codec.h"
+#include <string.h>
+
+/*============================================================================*/
+/* PROTOTIPOVI PRIVATNIH FUNKCIJA                                             */
+/*============================================================================*/
+static uint32_t Codec_Get32(const uint8_t *p);
+static void Codec_Put(void *out, uint16_t x, uint8_t bytes, uint32_t value);
+static uint32_t Codec_Expand(const IconImage_t *image, uint32_t value);
+static const uint8_t *Codec_ReadRle(const IconImage_t *image, const uint8_t *p, void *out, bool argb);
+
+/*============================================================================*/
+/* IMPLEMENTACIJA JAVNIH FUNKCIJA                                             */
+/*============================================================================*/
+
+uint8_t IconCodec_NativeBytes(const IconImage_t *image)
+{
+    return ((image->format == ICON_FMT_ARGB8888) || (image->format == ICON_FMT_RLE32)) ? 4U : 1U;
+}
+
+void IconCodec_Begin(IconCursor_t *cursor, const IconImage_t *image)
+{
+    cursor->image = image;
+    cursor->next = image->data;
+    cursor->line = 0U;
+}
+
+void IconCodec_SkipLines(IconCursor_t *cursor, uint16_t count)
+{
+    const IconImage_t *image = cursor->image;
+
+    if ((image->format == ICON_FMT_RLE8) || (image->format == ICON_FMT_RLE32))
+    {
+        while (count-- && (cursor->next != NULL) && (cursor->line < image->height))
+        {
+            cursor->next = Codec_ReadRle(image, cursor->next, NULL, false);
+            cursor->line++;
+        }
+        return;
+    }
+    if (count > (image->height - cursor->line)) count = image->height - cursor->line;
+    cursor->next += (uint32_t)count * image->width * IconCodec_NativeBytes(image);
+    cursor->line += count;
+}
+
+bool IconCodec_ReadLine(IconCursor_t *cursor, void *out, bool argb)
+{
+    const IconImage_t *image = cursor->image;
+    uint8_t bytes = IconCodec_NativeBytes(image);
+    uint8_t out_bytes = argb ? 4U : bytes;
+
+    if ((cursor->next == NULL) || (cursor->line >= image->height)) return false;
+
+    if ((image->format == ICON_FMT_RLE8) || (image->format == ICON_FMT_RLE32))
+    {
+        cursor->next = Codec_ReadRle(image, cursor->next, out, argb);
+    }
+    else
+    {
+        uint32_t line_size = (uint32_t)image->width * bytes;
+
+        if ((cursor->next + line_size) > (image->data + image->size))
+        {
+            cursor->next = NULL;
+        }
+        else
+        {
+            for (uint16_t x = 0U; x < image->width; x++)
+            {
+                uint32_t v = (bytes == 1U) ? cursor->next[x] : Codec_Get32(&cursor->next[x * 4U]);
+                // A8/L8 u ARGB8888 ide preko boje ili palete, ostalo je kopija.
+                if (out_bytes != bytes) v = Codec_Expand(image, v);
+                Codec_Put(out, x, out_bytes, v);
+            }
+            cursor->next += line_size;
+        }
+    }
+
+    if (cursor->next == NULL) return false;
+    cursor->line++;
+    return true;
+}
+
+bool IconCodec_Decode(const IconImage_t *image, uint32_t *out)
+{
+    IconCursor_t cursor;
+
+    IconCodec_Begin(&cursor, image);
+    for (uint16_t y = 0U; y < image->height; y++)
+    {
+        if (!IconCodec_ReadLine(&cursor, &out[(uint32_t)y * image->width], true)) return false;
+    }
+    return true;
+}
+
+/*============================================================================*/
+/* IMPLEMENTACIJA PRIVATNIH FUNKCIJA                                          */
+/*============================================================================*/
+
+static uint32_t Codec_Get32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void Codec_Put(void *out, uint16_t x, uint8_t bytes, uint32_t value)
+{
+    if (out == NULL) return;
+    if (bytes == 1U) ((uint8_t *)out)[x] = (uint8_t)value;
+    else ((uint32_t *)out)[x] = value;
+}
+
+/**
+ * @brief  Pretvara nativnu vrijednost (alfa ili indeks) u ARGB8888.
+ */
+static uint32_t Codec_Expand(const IconImage_t *image, uint32_t value)
+{
+    if (image->format == ICON_FMT_A8)
+    {
+        return (value == 0U) ? 0U : ((value << 24) | (image->color & 0x00FFFFFFU));
+    }
+    if ((image->clut == NULL) || (value >= image->colors)) return 0U;
+    return image->clut[value];
+}
+
+/**
+ * @brief  Čita jednu RLE liniju.
+ * @param  out Izlaz ili NULL (samo preskakanje).
+ * @retval Početak sljedeće linije ili NULL ako su podaci oštećeni.
+ */
+static const uint8_t *Codec_ReadRle(const IconImage_t *image, const uint8_t *p, void *out, bool argb)
+{
+    const uint8_t *end = image->data + image->size;
+    uint8_t bytes = IconCodec_NativeBytes(image);
+    uint8_t out_bytes = argb ? 4U : bytes;
+    uint16_t x = 0U;
+
+    while (x < image->width)
+    {
+        uint16_t run;
+        bool repeat;
+
+        if (p >= end) return NULL;
+        repeat = (*p >= 0x80U);
+        run = repeat ? (uint16_t)(*p - 0x7EU) : (uint16_t)(*p + 1U);
+        p++;
+        if (((uint32_t)x + run) > image->width) return NULL;
+        if ((p + (repeat ? bytes : (uint32_t)run * bytes)) > end) return NULL;
+
+        for (uint16_t i = 0U; i < run; i++)
+        {
+            uint32_t v = (bytes == 1U) ? *p : Codec_Get32(p);
+            if (argb && (bytes == 1U)) v = Codec_Expand(image, v);
+            Codec_Put(out, x++, out_bytes, v);
+            if (!repeat) p += bytes;
+        }
+        if (repeat) p += bytes;
+    }
+    return p;
+}
@@ -0,0 +1,150 @@
+/**
+ ******************************************************************************
+ * @file    lang_pack.c
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Pakovanje stringova aktivnog jezika u RAM bazen.
+ *
+ * @note    Pakovanje se radi samo pri promjeni jezika, pa je traženje
+ * duplikata linearno (oko 170 tekstova). Indeks je 16-bitni ofset, što
+ * ograničava bazen na 64 KB.
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* UKLJUCENI FAJLOVI (INCLUDES)                                               */
+/*============================================================================*/
+#include "lang_pack.h"
+#include <string.h>
+
+/*============================================================================*/
+/* PROTOTIPOVI PRIVATNIH FUNKCIJA                                             */
+/*============================================================================*/
+static LangPackStatus_t Pack_Fail(LangPack_t *pack, LangPackStatus_t status, uint16_t id);
+
+/*============================================================================*/
+/* IMPLEMENTACIJA JAVNIH FUNKCIJA                                             */
+/*============================================================================*/
+
+void LangPack_Init(LangPack_t *pack, char *pool, uint32_t pool_size, uint16_t *index, uint16_t count)
+{
+    memset(pack, 0, sizeof(LangPack_t));
+    pack->pool = pool;
+    pack->pool_size = pool_size;
+    pack->index = index;
+    pack->count = count;
+}
+
+LangPackStatus_t LangPack_Build(LangPack_t *pack, const char *const *table, uint8_t language_count, uint8_t language)
+{
+    pack->valid = false;
+    pack->used = 0U;
+    pack->duplicates = 0U;
+    pack->error_text = 0U;
+    pack->language = language;
+
+    if ((language >= language_count) || (pack->count == 0U) || (pack->pool_size == 0U))
+    {
+        return Pack_Fail(pack, LANG_PACK_ERR_ARG, 0U);
+    }
+
+    for (uint16_t id = 0U; id < pack->count; id++)
+    {
+        const char *text = table[(uint32_t)id * language_count + language];
+        uint32_t len;
+        uint16_t same = id;
+
+        if (text == NULL) return Pack_Fail(pack, LANG_PACK_ERR_NULL, id);
+        if (!LangPack_IsValidUtf8(text)) return Pack_Fail(pack, LANG_PACK_ERR_UTF8, id);
+
+        // Isti string (npr. "SOS", "WI-FI" ili prazan) se čuva jednom.
+        for (uint16_t prev = 0U; prev < id; prev++)
+        {
+            if (strcmp(&pack->pool[pack->index[prev]], text) == 0)
+            {
+                same = prev;
+                break;
+            }
+        }
+        if (same != id)
+        {
+            pack->index[id] = pack->index[same];
+            pack->duplicates++;
+            continue;
+        }
+
+        len = (uint32_t)strlen(text) + 1U;
+        if (((pack->used + len) > pack->pool_size) || (pack->used > 0xFFFFU))
+        {
+            return Pack_Fail(pack, LANG_PACK_ERR_SIZE, id);
+        }
+        memcpy(&pack->pool[pack->used], text, len);
+        pack->index[id] = (uint16_t)pack->used;
+        pack->used += len;
+    }
+
+    pack->valid = true;
+    return LANG_PACK_OK;
+}
+
+const char *LangPack_Get(const LangPack_t *pack, uint16_t id)
+{
+    return &pack->pool[pack->index[(id < pack->count) ? id : 0U]];
+}
+
+bool LangPack_IsValidUtf8(const char *text)
+{
+    const uint8_t *p = (const uint8_t *)text;
+
+    while (*p != 0U)
+    {
+        uint32_t code;
+        uint8_t extra;
+
+        if (*p < 0x80U)
+        {
+            p++;
+            continue;
+        }
+        if ((*p & 0xE0U) == 0xC0U)
+        {
+            code = *p & 0x1FU;
+            extra = 1U;
+        }
+        else if ((*p & 0xF0U) == 0xE0U)
+        {
+            code = *p & 0x0FU;
+            extra = 2U;
+        }
+        else if ((*p & 0xF8U) == 0xF0U)
+        {
+            code = *p & 0x07U;
+            extra = 3U;
+        }
+        else
+        {
+            return false;
+        }
+        p++;
+        for (uint8_t i = 0U; i < extra; i++, p++)
+        {
+            if ((*p & 0xC0U) != 0x80U) return false;
+            code = (code << 6) | (*p & 0x3FU);
+        }
+        // Najkraći zapis, bez surogata i iznad opsega Unicode-a.
+        if ((extra == 1U) && (code < 0x80U)) return false;
+        if ((extra == 2U) && ((code < 0x800U) || ((code >= 0xD800U) && (code <= 0xDFFFU)))) return false;
+        if ((extra == 3U) && ((code < 0x10000U) || (code > 0x10FFFFU))) return false;
+    }
+    return true;
+}
+
+/*============================================================================*/
+/* IMPLEMENTACIJA PRIVATNIH FUNKCIJA                                          */
+/*============================================================================*/
+
+static LangPackStatus_t Pack_Fail(LangPack_t *pack, LangPackStatus_t status, uint16_t id)
+{
+    pack->valid = false;
+    pack->error_text = id;
+    return status;
+}
@@ -290,6 +290,8 @@ void LIGHTS_Save(void)
         LIGHT_Save_Single(&lights_modbus[i], address);
     }
     LIGHT_Calculate();
+    // Labele na ekranu svjetala zavise od konfiguracije.
+    DISP_InvalidateStaticLayers();
 }
 
 /**
@@ -466,6 +468,8 @@ void LIGHT_SetCustomLabel(LIGHT_Handle* const handle, const char* label)
         // Sigurno kopiranje stringa, osigurava NULL terminator
         strncpy(handle->config.custom_label, label, sizeof(handle->config.custom_label) - 1);
         handle->config.custom_label[sizeof(handle->config.custom_label) - 1] = '\0';
+        // Sirina labele se mijenja, mjerenje u display.c je zastarjelo.
+        DISP_InvalidateLabels();
     }
 }
 
@@ -685,7 +689,7 @@ static void HandleOnDelayTimers(void)
         if(handle->on_delay_timer_start && (HAL_GetTick() - handle->on_delay_timer_start) >= (handle->config.controllerID_on_delay * 60000UL)) {
             handle->on_delay_timer_start = 0;
             LIGHT_SetState(handle, true);
-            if(screen == SCREEN_LIGHTS) shouldDrawScreen = 1;
+            DISP_InvalidateLight(i);
         }
     }
 }
@@ -701,7 +705,7 @@ static void HandleOffTimeTimers(void)
         if(handle->off_timer_start && (HAL_GetTick() - handle->off_timer_start) >= (handle->config.off_time * 60000UL)) {
             handle->off_timer_start = 0;
             LIGHT_SetState(handle, false);
-            if(screen == SCREEN_LIGHTS) shouldDrawScreen = 1;
+            DISP_InvalidateLight(i);
         }
     }
 }
@@ -774,8 +778,10 @@ static void HandleLightStatusChanges(void)
         if (brightnessChanged) handle->brightness_old = handle->config.brightness;
         if (colorChanged) handle->color_old = handle->color;
 
-        if ((statusChanged || brightnessChanged || colorChanged) && (screen == SCREEN_LIGHTS || screen == SCREEN_MAIN)) {
-            shouldDrawScreen = 1;
+        if (statusChanged || brightnessChanged || colorChanged) {
+            // Na ekranu svjetala se ponovo crta samo plocica ovog svjetla.
+            if (screen == SCREEN_LIGHTS) DISP_InvalidateLight(i);
+            else if (screen == SCREEN_MAIN) shouldDrawScreen = 1;
         }
     }
 }
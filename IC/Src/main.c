@@ -35,6 +35,7 @@
 #include "rs485.h"
 #include "scene.h"
 #include "gate.h"
+#include "touch_track.h"
 
 /* Constants -----------------------------------------------------------------*/
 /* Imported Type  ------------------------------------------------------------*/
@@ -58,7 +59,8 @@ UART_HandleTypeDef huart1;
 UART_HandleTypeDef huart2;
 DMA2D_HandleTypeDef hdma2d;
 /* Private Define ------------------------------------------------------------*/
-#define TS_UPDATE_TIME			            20U     // 50ms touch screen update period
+#define TS_UPDATE_TIME			            20U     // period citanja kontrolera bez INT linije (TS_INT_ENABLED == 0)
+#define TS_RELEASE_TIMEOUT                  100U    // citanje bez INT impulsa dok traje dodir (izgubljeno otpustanje)
 #define AMBIENT_NTC_RREF                    10000U  // 10k NTC value of at 25 degrees
 #define AMBIENT_NTC_B_VALUE                 3977U   // NTC beta parameter
 #define AMBIENT_NTC_PULLUP                  10000U	// 10k pullup resistor
@@ -94,6 +96,24 @@ uint8_t pca9685_register[PCA9685_REGISTER_SIZE] = {0};
 bool g_high_precision_mode = false;
 volatile uint32_t g_last_fw_packet_timestamp = 0; // Definicija globalne varijable
 char system_pin[8]; // << NOVO: Definicija globalne varijable
+/**
+ * @brief Stanje citanja kontrolera ekrana osjetljivog na dodir.
+ * @note  INT prekid postavlja `ts_int_pending`, TS_Service pokrece citanje u
+ * prekidnom modu, a I2C prekid javlja kraj u `ts_read_state`. Dok INT pin
+ * nije potvrden na ploci (TS_INT_ENABLED == 0), citanje se pokrece svakih
+ * TS_UPDATE_TIME.
+ */
+typedef enum {
+    TS_READ_IDLE = 0,
+    TS_READ_BUSY,
+    TS_READ_DONE,
+    TS_READ_ERROR
+} TS_ReadState_t;
+static volatile bool ts_int_pending = true; // prvo citanje odmah nakon starta
+static volatile TS_ReadState_t ts_read_state = TS_READ_IDLE;
+static uint8_t ts_regs[TOUCH_TRACK_REG_COUNT];
+static uint32_t ts_read_tmr = 0U;
+static TouchTrack_t ts_track;
 /* Private Macro -------------------------------------------------------------*/
 #define VREFIN_CAL_ADDRESS          ((uint16_t*) (0x1FF0F44A))
 #define TEMPSENSOR_CAL1_ADDR        ((uint16_t*) (0x1FF0F44C))
@@ -173,6 +193,7 @@ int main(void)
     Ventilator_Init(pVen);
     Timer_Init();
     Security_Init();
+    FwUpdateAgent_Init();
 #ifdef	USE_WATCHDOG
     HAL_IWDG_Refresh(&hiwdg);
 #endif
@@ -337,58 +358,61 @@ static void MX_IWDG_Init(void) {
   * @retval
   */
 void TS_Service(void) {
-// Definicije za dinamicki treshold osjetljivosti na dodir
-#define NORMAL_TOUCH_THRESHOLD      30U // Standardna osjetljivost (manje precizno)
-#define HIGH_PRECISION_THRESHOLD    2U  // Visoka osjetljivost (precizno za slajdere)
-
-    uint16_t xDiff, yDiff;
-    __IO TS_StateTypeDef  ts;
-    static GUI_PID_STATE TS_State = {0};
-    static uint32_t ts_update_tmr = 0U;
-
-    if (IsDISPCleaningActiv()) return;
-    else if ((HAL_GetTick() - ts_update_tmr)  >= TS_UPDATE_TIME) {
-        ts_update_tmr = HAL_GetTick();
-        BSP_TS_GetState((TS_StateTypeDef *)&ts);
-        if((ts.touchX[0] >= LCD_GetXSize()) ||
-                (ts.touchY[0] >= LCD_GetYSize())) {
-            ts.touchX[0] = 0U;
-            ts.touchY[0] = 0U;
-            ts.touchDetected = 0U;
-        }
-        xDiff = (TS_State.x > ts.touchX[0]) ? (TS_State.x - ts.touchX[0]) : (ts.touchX[0] - TS_State.x);
-        yDiff = (TS_State.y > ts.touchY[0]) ? (TS_State.y - ts.touchY[0]) : (ts.touchY[0] - TS_State.y);
-
-        // =======================================================================
-        // === ZAMIJENITE `IF` USLOV OVOM LOGIKOM ===
-
-        // 1. Definiemo lokalnu varijablu za treshold.
-        uint8_t threshold;
-
-        // 2. Provjeravamo globalni fleg i biramo vrijednost.
-        if (g_high_precision_mode) {
-            threshold = HIGH_PRECISION_THRESHOLD; // Koristi visoku preciznost
-        } else {
-            threshold = NORMAL_TOUCH_THRESHOLD;   // Koristi normalnu preciznost
-        }
+    TouchSample_t sample, report;
+    GUI_PID_STATE TS_State = {0};
 
-        // 3. Koristimo odabranu vrijednost u `if` uslovu.
-        if((TS_State.Pressed != ts.touchDetected) || (xDiff > threshold) || (yDiff > threshold)) {
-            // =======================================================================
-            TS_State.Pressed = ts.touchDetected;
+    if (IsDISPCleaningActiv()) {
+        ts_int_pending = false;
+        return;
+    }
+    if (ts_read_state == TS_READ_DONE) {
+        TouchTrack_Decode(ts_regs, LCD_GetXSize(), LCD_GetYSize(), &sample);
+        ts_read_state = TS_READ_IDLE;
+        if (TouchTrack_Update(&ts_track, &sample, TouchTrack_Threshold(g_high_precision_mode), &report)) {
+            TS_State.x = report.x;
+            TS_State.y = report.y;
+            TS_State.Pressed = report.pressed;
             TS_State.Layer = TS_LAYER;
-            if(ts.touchDetected) {
-                TS_State.x = ts.touchX[0];
-                TS_State.y = ts.touchY[0];
-                GUI_TOUCH_StoreStateEx(&TS_State);
-            }
-            else {
-                GUI_TOUCH_StoreStateEx(&TS_State);
-                TS_State.x = 0;
-                TS_State.y = 0;
-            }
+            GUI_TOUCH_StoreStateEx(&TS_State);
+            DISP_NotifyInput();
         }
     }
+    else if (ts_read_state == TS_READ_ERROR) {
+        TS_IO_Error();
+        ts_read_state = TS_READ_IDLE;
+        ts_int_pending = true;  // ponovi citanje nakon oporavka busa
+    }
+#if (TS_INT_ENABLED == 1)
+    // Bez dodira nema ni INT impulsa, pa ni I2C saobracaja.
+    if ((ts_read_state == TS_READ_IDLE) && (ts_int_pending ||
+            (ts_track.last.pressed && ((HAL_GetTick() - ts_read_tmr) >= TS_RELEASE_TIMEOUT)))) {
+#else
+    if ((ts_read_state == TS_READ_IDLE) && (ts_int_pending || ((HAL_GetTick() - ts_read_tmr) >= TS_UPDATE_TIME))) {
+#endif
+        ts_int_pending = false;
+        ts_read_tmr = HAL_GetTick();
+        ts_read_state = TS_READ_BUSY;
+        if (BSP_TS_ReadRegsIT(ts_regs, TOUCH_TRACK_REG_COUNT) != TS_OK) ts_read_state = TS_READ_ERROR;
+    }
+}
+/**
+  * @brief  INT linija kontrolera ekrana: novo ocitanje je spremno.
+  * @note   Citanje se samo zakazuje; pokrece ga TS_Service u glavnoj petlji.
+  */
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin) {
+    if (GPIO_Pin == TS_INT_PIN) ts_int_pending = true;
+}
+/**
+  * @brief  Kraj citanja registara kontrolera ekrana.
+  */
+void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c) {
+    if (hi2c->Instance == I2C3) ts_read_state = TS_READ_DONE;
+}
+/**
+  * @brief  Greska na I2C busu kontrolera ekrana; bus se oporavlja u TS_Service.
+  */
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c) {
+    if (hi2c->Instance == I2C3) ts_read_state = TS_READ_ERROR;
 }
 /**
   * @brief  Inicijalizuje globalne sistemske varijable iz EEPROM-a.
@@ -0,0 +1,239 @@
+/**
+ ******************************************************************************
+ * @file    mem_budget.c
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Implementacija praćenja GUI hipa i korisnika SDRAM-a.
+ *
+ * @note    Rast hipa se računa prema zauzeću pri ulasku na ekran, jer hip
+ * drži i memoriju drugih ekrana (trajna stabla widgeta, statički slojevi).
+ * Broj alokacija je zbir porasta broja zauzetih blokova između uzoraka;
+ * alokacija oslobođena prije sljedećeg uzorka se ne vidi.
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* UKLJUCENI FAJLOVI (INCLUDES)                                               */
+/*============================================================================*/
+#include "mem_budget.h"
+#include <stdio.h>
+#include <string.h>
+
+/*============================================================================*/
+/* PROTOTIPOVI PRIVATNIH FUNKCIJA                                             */
+/*============================================================================*/
+static void Mem_Read(MemBudget_t *mb, bool largest);
+static MemLevel_t Mem_Level(const MemBudget_t *mb);
+static int Mem_Append(char *buf, uint32_t size, uint32_t *len, int n);
+
+/*============================================================================*/
+/* IMPLEMENTACIJA JAVNIH FUNKCIJA                                             */
+/*============================================================================*/
+
+void MemBudget_Init(MemBudget_t *mb, const MemBudgetOps_t *ops, uint32_t heap_size, const MemBudgetLimits_t *limits,
+                    const MemRegion_t *regions, uint8_t region_count)
+{
+    memset(mb, 0, sizeof(MemBudget_t));
+    mb->ops = ops;
+    mb->limits = *limits;
+    mb->heap_size = heap_size;
+    mb->regions = regions;
+    mb->region_count = (regions == NULL) ? 0U :
+                       ((region_count > MEM_BUDGET_MAX_REGIONS) ? MEM_BUDGET_MAX_REGIONS : region_count);
+
+    for (uint8_t i = 0U; i < mb->region_count; i++)
+    {
+        for (uint8_t j = (uint8_t)(i + 1U); j < mb->region_count; j++)
+        {
+            const MemRegion_t *a = &regions[i];
+            const MemRegion_t *b = &regions[j];
+
+            if ((a->base < (b->base + b->size)) && (b->base < (a->base + a->size)))
+            {
+                mb->overlaps |= (uint8_t)((1U << i) | (1U << j));
+            }
+        }
+    }
+    mb->min_largest = UINT32_MAX;
+}
+
+void MemBudget_SetBudget(MemBudget_t *mb, uint8_t screen, uint32_t bytes)
+{
+    if (screen < MEM_BUDGET_MAX_SCREENS) mb->screens[screen].budget = bytes;
+}
+
+MemLevel_t MemBudget_Sample(MemBudget_t *mb, uint8_t screen)
+{
+    const MemBudgetOps_t *ops = mb->ops;
+    bool entered = !mb->started || (screen != mb->screen);
+    uint32_t blocks = mb->blocks;
+    MemLevel_t level;
+    MemScreen_t *s;
+
+    Mem_Read(mb, entered || ((ops->ms() - mb->largest_ms) >= MEM_BUDGET_LARGEST_MS));
+    if (mb->started && (mb->blocks > blocks) && (mb->screen < MEM_BUDGET_MAX_SCREENS))
+    {
+        // Blokovi alocirani od prethodnog uzorka pripadaju ekranu koji je tada radio.
+        mb->screens[mb->screen].allocs += mb->blocks - blocks;
+    }
+
+    if (entered)
+    {
+        mb->started = true;
+        mb->screen = screen;
+        mb->entry_used = mb->used;
+        mb->over = false;
+        if (screen < MEM_BUDGET_MAX_SCREENS) mb->screens[screen].entries++;
+    }
+
+    if (screen < MEM_BUDGET_MAX_SCREENS)
+    {
+        uint32_t growth = (mb->used > mb->entry_used) ? (mb->used - mb->entry_used) : 0U;
+
+        s = &mb->screens[screen];
+        if (growth > s->peak) s->peak = growth;
+        if (mb->used > s->peak_used) s->peak_used = mb->used;
+        if ((s->budget != 0U) && (growth > s->budget) && !mb->over)
+        {
+            mb->over = true;
+            s->over_budget++;
+        }
+    }
+
+    level = Mem_Level(mb);
+    if ((level > mb->level) || (mb->pending && (level != MEM_LEVEL_OK)))
+    {
+        if (level > mb->level)
+        {
+            if (level == MEM_LEVEL_WARN) mb->warnings++;
+            else mb->criticals++;
+        }
+        if (ops->pressure != NULL)
+        {
+            mb->pressures++;
+            ops->pressure(level);
+            Mem_Read(mb, true);
+            level = Mem_Level(mb);
+        }
+    }
+    mb->pending = false;
+    mb->level = level;
+    return level;
+}
+
+bool MemBudget_Reserve(MemBudget_t *mb, uint32_t size)
+{
+    MemScreen_t *s = (mb->screen < MEM_BUDGET_MAX_SCREENS) ? &mb->screens[mb->screen] : NULL;
+    uint32_t largest = mb->ops->largest_free();
+
+    if ((largest >= size) && ((largest - size) >= mb->limits.critical_block))
+    {
+        if (s != NULL) s->reserves++;
+        return true;
+    }
+    if (s != NULL) s->denied++;
+    mb->pending = true;
+    return false;
+}
+
+uint32_t MemBudget_Report(const MemBudget_t *mb, char *buf, uint32_t size)
+{
+    static const char *const levels[] = { "ok", "WARN", "CRITICAL" };
+    uint32_t len = 0U;
+
+    if (size == 0U) return 0U;
+    buf[0] = '\0';
+    if (Mem_Append(buf, size, &len,
+                   snprintf(buf, size,
+                            "heap %lu KB: used %lu KB (peak %lu KB), free %lu KB, largest %lu KB (min %lu KB), blocks %lu\n"
+                            "frag %u.%u%% (max %u.%u%%), level %s, warn %lu, critical %lu, pressure %lu\n",
+                            (unsigned long)(mb->heap_size / 1024U), (unsigned long)(mb->used / 1024U),
+                            (unsigned long)(mb->peak_used / 1024U), (unsigned long)(mb->free / 1024U),
+                            (unsigned long)(mb->largest / 1024U),
+                            (unsigned long)((mb->min_largest == UINT32_MAX) ? 0U : (mb->min_largest / 1024U)),
+                            (unsigned long)mb->blocks,
+                            mb->frag_permille / 10U, mb->frag_permille % 10U,
+                            mb->max_frag_permille / 10U, mb->max_frag_permille % 10U, levels[mb->level],
+                            (unsigned long)mb->warnings, (unsigned long)mb->criticals,
+                            (unsigned long)mb->pressures)) < 0) return 0U;
+
+    for (uint8_t i = 0U; i < mb->region_count; i++)
+    {
+        const MemRegion_t *r = &mb->regions[i];
+        uint32_t used = (r->used != NULL) ? r->used() : r->size;
+
+        if (Mem_Append(buf, size, &len,
+                       snprintf(&buf[len], size - len, "%-6s %08lX %5lu KB, used %5lu KB%s\n", r->name,
+                                (unsigned long)r->base, (unsigned long)(r->size / 1024U), (unsigned long)(used / 1024U),
+                                ((mb->overlaps & (1U << i)) != 0U) ? " OVERLAP" : "")) < 0) return len;
+    }
+
+    for (uint8_t i = 0U; i < MEM_BUDGET_MAX_SCREENS; i++)
+    {
+        const MemScreen_t *s = &mb->screens[i];
+
+        if (s->entries == 0U) continue;
+        if (Mem_Append(buf, size, &len,
+                       snprintf(&buf[len], size - len,
+                                "scr %2u: n %lu, peak +%lu/%lu KB (%lu KB), allocs %lu, big %lu/%lu, over %lu\n", i,
+                                (unsigned long)s->entries, (unsigned long)(s->peak / 1024U),
+                                (unsigned long)(s->budget / 1024U), (unsigned long)(s->peak_used / 1024U),
+                                (unsigned long)s->allocs, (unsigned long)s->reserves,
+                                (unsigned long)(s->reserves + s->denied), (unsigned long)s->over_budget)) < 0) return len;
+    }
+    return len;
+}
+
+/*============================================================================*/
+/* IMPLEMENTACIJA PRIVATNIH FUNKCIJA                                          */
+/*============================================================================*/
+
+/**
+ * @brief  Čita hip; najveći blok samo ako je `largest` postavljen.
+ */
+static void Mem_Read(MemBudget_t *mb, bool largest)
+{
+    const MemBudgetOps_t *ops = mb->ops;
+
+    mb->free = ops->free_bytes();
+    mb->used = (mb->heap_size > mb->free) ? (mb->heap_size - mb->free) : 0U;
+    mb->blocks = ops->used_blocks();
+    if (mb->used > mb->peak_used) mb->peak_used = mb->used;
+
+    if (largest)
+    {
+        mb->largest = ops->largest_free();
+        mb->largest_ms = ops->ms();
+        if (mb->largest < mb->min_largest) mb->min_largest = mb->largest;
+    }
+    // Najveći blok može biti star do MEM_BUDGET_LARGEST_MS, a ne može biti veći od slobodnog.
+    if (mb->largest > mb->free) mb->largest = mb->free;
+
+    mb->frag_permille = (uint16_t)((mb->free == 0U) ? 0U :
+                                   (1000U - (uint32_t)(((uint64_t)mb->largest * 1000U) / mb->free)));
+    if (mb->frag_permille > mb->max_frag_permille) mb->max_frag_permille = mb->frag_permille;
+}
+
+/**
+ * @brief  Nivo prema pragovima i zadnjem čitanju.
+ */
+static MemLevel_t Mem_Level(const MemBudget_t *mb)
+{
+    if (mb->largest < mb->limits.critical_block) return MEM_LEVEL_CRITICAL;
+    if ((mb->free < mb->limits.warn_free) || (mb->largest < mb->limits.warn_block)) return MEM_LEVEL_WARN;
+    return MEM_LEVEL_OK;
+}
+
+/**
+ * @brief  Dodaje rezultat `snprintf` na dužinu izvještaja.
+ * @retval int -1 ako tekst nije stao (bafer završen na dotadašnjoj dužini).
+ */
+static int Mem_Append(char *buf, uint32_t size, uint32_t *len, int n)
+{
+    if ((n < 0) || ((uint32_t)n >= (size - *len)))
+    {
+        buf[*len] = '\0';
+        return -1;
+    }
+    *len += (uint32_t)n;
+    return n;
+}
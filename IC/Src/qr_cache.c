@@ -0,0 +1,127 @@
+/**
+ ******************************************************************************
+ * @file    qr_cache.c
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Implementacija keša QR kodova.
+ *
+ * @note    Tekst se poredi cijeli (najviše 64 bajta), što je zanemarivo u
+ * odnosu na kodiranje, a ne ostavlja mogućnost kolizije kao hash.
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* UKLJUCENI FAJLOVI (INCLUDES)                                               */
+/*============================================================================*/
+#include "qr_cache.h"
+#include <string.h>
+
+/*============================================================================*/
+/* PROTOTIPOVI PRIVATNIH FUNKCIJA                                             */
+/*============================================================================*/
+static bool Qr_IsCurrent(const QrCacheEntry_t *entry, const char *text);
+static bool Qr_Encode(QrCache_t *cache, QrCacheEntry_t *entry, const char *text);
+
+/*============================================================================*/
+/* IMPLEMENTACIJA JAVNIH FUNKCIJA                                             */
+/*============================================================================*/
+
+void QrCache_Init(QrCache_t *cache, QrEncode_t encode)
+{
+    memset(cache, 0, sizeof(QrCache_t));
+    cache->encode = encode;
+}
+
+bool QrCache_Update(QrCache_t *cache, uint8_t slot, const char *text)
+{
+    QrCacheEntry_t *entry;
+
+    if ((slot >= QR_CACHE_SLOTS) || (text == NULL)) return false;
+    entry = &cache->entries[slot];
+    if (Qr_IsCurrent(entry, text)) return entry->valid;
+    return Qr_Encode(cache, entry, text);
+}
+
+const QrCacheEntry_t *QrCache_Get(QrCache_t *cache, uint8_t slot, const char *text)
+{
+    QrCacheEntry_t *entry;
+
+    if ((slot >= QR_CACHE_SLOTS) || (text == NULL)) return NULL;
+    entry = &cache->entries[slot];
+    if (Qr_IsCurrent(entry, text))
+    {
+        if (!entry->valid) return NULL;
+        cache->hits++;
+        return entry;
+    }
+    return Qr_Encode(cache, entry, text) ? entry : NULL;
+}
+
+void QrCache_Invalidate(QrCache_t *cache, uint8_t slot)
+{
+    if (slot < QR_CACHE_SLOTS)
+    {
+        cache->entries[slot].valid = false;
+        cache->entries[slot].failed = false;
+    }
+}
+
+bool QrCache_Module(const QrCacheEntry_t *entry, uint16_t x, uint16_t y)
+{
+    if ((x >= entry->size) || (y >= entry->size)) return false;
+    return (entry->bits[y * QR_CACHE_LINE_BYTES + (x >> 3)] & (0x80U >> (x & 7U))) != 0U;
+}
+
+bool QrCache_NextRun(const QrCacheEntry_t *entry, uint16_t y, uint16_t *x, uint16_t *len)
+{
+    uint16_t start = *x;
+
+    while ((start < entry->size) && !QrCache_Module(entry, start, y)) start++;
+    if (start >= entry->size) return false;
+
+    *x = start;
+    *len = 0U;
+    while (((start + *len) < entry->size) && QrCache_Module(entry, start + *len, y)) (*len)++;
+    return true;
+}
+
+/*============================================================================*/
+/* IMPLEMENTACIJA PRIVATNIH FUNKCIJA                                          */
+/*============================================================================*/
+
+/**
+ * @brief  Da li je zapis već napravljen (ili neuspješno pokušan) za `text`.
+ */
+static bool Qr_IsCurrent(const QrCacheEntry_t *entry, const char *text)
+{
+    return (entry->valid || entry->failed) && (strncmp(entry->text, text, QR_CACHE_TEXT_MAX) == 0);
+}
+
+/**
+ * @brief  Kodira `text` u zapis.
+ * @note   Pri grešci se tekst pamti kao neuspješan, da se isti tekst ne
+ *         kodira ponovo pri svakom pozivu.
+ */
+static bool Qr_Encode(QrCache_t *cache, QrCacheEntry_t *entry, const char *text)
+{
+    uint16_t size = 0U;
+
+    entry->valid = false;
+    entry->failed = false;
+    if ((strlen(text) >= QR_CACHE_TEXT_MAX) || (cache->encode == NULL))
+    {
+        cache->failures++;
+        return false;
+    }
+    strcpy(entry->text, text);
+    memset(entry->bits, 0, sizeof(entry->bits));
+    cache->encodes++;
+    if (!cache->encode(text, entry->bits, QR_CACHE_MAX_SIZE, &size) || (size == 0U) || (size > QR_CACHE_MAX_SIZE))
+    {
+        entry->failed = true;
+        cache->failures++;
+        return false;
+    }
+    entry->size = size;
+    entry->valid = true;
+    return true;
+}
@@ -0,0 +1,444 @@
+/**
+ ******************************************************************************
+ * @file    remote_view.c
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Implementacija daljinskog pregleda ekrana.
+ *
+ * @note    Hash pločice se računa nad sirovim pikselima oba sloja (riječ po
+ * riječ), a slaganje u RGB565 i RLE se rade samo za promijenjene pločice.
+ * Prikazani bafer se čita dok emWin crta u drugi; ako se bafer zamijeni
+ * dok se pločica čita, njen hash se ne pamti, pa se šalje ponovo u
+ * sljedećem frejmu.
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* UKLJUCENI FAJLOVI (INCLUDES)                                               */
+/*============================================================================*/
+#include "remote_view.h"
+#include <stdio.h>
+#include <string.h>
+
+/*============================================================================*/
+/* PROTOTIPOVI PRIVATNIH FUNKCIJA                                             */
+/*============================================================================*/
+static void View_Tile(RemoteView_t *rv, uint16_t index);
+static uint32_t View_Hash(const RemoteView_t *rv, const uint16_t *base, const uint32_t *over,
+                          uint16_t x0, uint16_t y0, uint16_t w, uint16_t h);
+static void View_Compose(RemoteView_t *rv, const uint16_t *base, const uint32_t *over,
+                         uint16_t x0, uint16_t y0, uint16_t w, uint16_t h);
+static inline uint32_t View_Mix(uint32_t hash, uint32_t word);
+static uint32_t Ring_Free(const RemoteView_t *rv);
+static void Ring_Put(RemoteView_t *rv, const uint8_t *data, uint32_t len);
+
+/*============================================================================*/
+/* IMPLEMENTACIJA JAVNIH FUNKCIJA                                             */
+/*============================================================================*/
+
+void RemoteView_Init(RemoteView_t *rv, const RemoteViewOps_t *ops, uint16_t width, uint16_t height,
+                     uint16_t interval_ms, uint32_t rate)
+{
+    memset(rv, 0, sizeof(RemoteView_t));
+    rv->ops = ops;
+    rv->tiles_x = (uint8_t)((width + REMOTE_VIEW_TILE - 1U) / REMOTE_VIEW_TILE);
+    rv->tiles_y = (uint8_t)((height + REMOTE_VIEW_TILE - 1U) / REMOTE_VIEW_TILE);
+    // Ekran veći od tabele hash-eva se prikazuje odsječen.
+    while (((uint32_t)rv->tiles_x * rv->tiles_y) > REMOTE_VIEW_MAX_TILES) rv->tiles_y--;
+    rv->width = width;
+    rv->height = height;
+    rv->tile_count = (uint16_t)(rv->tiles_x * rv->tiles_y);
+    rv->interval_ms = interval_ms;
+    rv->rate = rate;
+}
+
+void RemoteView_Start(RemoteView_t *rv)
+{
+    uint32_t ms = rv->ops->ms();
+
+    rv->read_ms = ms;
+    rv->token_ms = ms;
+    rv->tokens = 0U;
+    rv->restart = true;
+    rv->active = true;
+}
+
+void RemoteView_Stop(RemoteView_t *rv)
+{
+    rv->active = false;
+}
+
+void RemoteView_Keyframe(RemoteView_t *rv)
+{
+    rv->key_request = true;
+}
+
+uint16_t RemoteView_Service(RemoteView_t *rv, uint16_t max_tiles)
+{
+    uint32_t ms;
+    uint16_t done = 0U;
+
+    if (rv->restart)
+    {
+        // Čitanje vraća 0 dok je `restart` postavljen, pa se pozicije mogu vratiti na 0.
+        rv->head = 0U;
+        rv->tail = 0U;
+        rv->seq = 0U;
+        rv->in_frame = false;
+        rv->key_request = true;
+        rv->restart = false;
+    }
+    if (!rv->active) return 0U;
+
+    ms = rv->ops->ms();
+    if ((ms - rv->read_ms) >= REMOTE_VIEW_IDLE_MS)
+    {
+        // Preglednik je otišao.
+        rv->active = false;
+        return 0U;
+    }
+
+    if (!rv->in_frame)
+    {
+        if ((rv->frames != 0U) && ((ms - rv->frame_ms) < rv->interval_ms) && !rv->key_request) return 0U;
+        rv->key = rv->key_request;
+        if (rv->key) rv->key_request = false;
+        rv->in_frame = true;
+        rv->frame_open = false;
+        rv->next_tile = 0U;
+        rv->frame_ms = ms;
+        rv->frame_start = rv->head;
+    }
+
+    while ((done < max_tiles) && (rv->next_tile < rv->tile_count))
+    {
+        if (Ring_Free(rv) < (REMOTE_VIEW_FRAME_BYTES + REMOTE_VIEW_TILE_HEADER + REMOTE_VIEW_TILE_MAX_RLE))
+        {
+            // Preglednik nije pokupio prethodne pločice; frejm se nastavlja kasnije.
+            rv->stalls++;
+            return done;
+        }
+        View_Tile(rv, rv->next_tile);
+        rv->next_tile++;
+        done++;
+    }
+
+    if (rv->next_tile >= rv->tile_count)
+    {
+        if (rv->frame_open)
+        {
+            uint8_t rec[REMOTE_VIEW_END_BYTES];
+
+            if (Ring_Free(rv) < sizeof(rec))
+            {
+                rv->stalls++;
+                return done;
+            }
+            rec[0] = REMOTE_VIEW_REC_END;
+            rec[1] = (uint8_t)(rv->seq >> 8);
+            rec[2] = (uint8_t)rv->seq;
+            Ring_Put(rv, rec, sizeof(rec));
+            rv->seq++;
+            rv->frames++;
+            rv->last_frame_bytes = rv->head - rv->frame_start;
+            if (rv->last_frame_bytes > rv->max_frame_bytes) rv->max_frame_bytes = rv->last_frame_bytes;
+        }
+        rv->in_frame = false;
+    }
+    return done;
+}
+
+int32_t RemoteView_Read(RemoteView_t *rv, uint32_t pos, uint8_t *buf, uint16_t max)
+{
+    uint32_t head = rv->head;
+    uint32_t tail = rv->tail;
+    uint32_t ms = rv->ops->ms();
+    uint32_t cap = ((rv->rate / 2U) > max) ? (rv->rate / 2U) : max;
+    uint32_t elapsed = ms - rv->token_ms;
+    uint32_t n, off, first;
+
+    if (!rv->active) return -1;
+    rv->read_ms = ms;
+    if (rv->restart) return 0;
+    if ((pos - tail) > (head - tail)) return -1;
+    rv->tail = pos;
+
+    // Token bucket u hiljaditim dijelovima bajta, da spori upiti ne gube ostatke.
+    if (elapsed > 1000U) elapsed = 1000U;
+    rv->tokens += elapsed * rv->rate;
+    rv->token_ms = ms;
+    if (rv->tokens > (cap * 1000U)) rv->tokens = cap * 1000U;
+
+    n = head - pos;
+    if (n > max) n = max;
+    if ((n * 1000U) > rv->tokens)
+    {
+        n = rv->tokens / 1000U;
+        rv->throttled++;
+    }
+    rv->tokens -= n * 1000U;
+
+    off = pos & (REMOTE_VIEW_RING_SIZE - 1U);
+    first = REMOTE_VIEW_RING_SIZE - off;
+    if (first > n) first = n;
+    memcpy(buf, &rv->ring[off], first);
+    memcpy(&buf[first], rv->ring, n - first);
+    return (int32_t)n;
+}
+
+uint32_t RemoteView_EncodeTile(const uint16_t *px, uint16_t count, uint8_t *out)
+{
+    uint32_t n = 0U;
+    uint16_t i = 0U;
+
+    while (i < count)
+    {
+        uint16_t run = 1U;
+
+        while (((i + run) < count) && (run < 128U) && (px[i + run] == px[i])) run++;
+        if (run >= 2U)
+        {
+            out[n++] = (uint8_t)(0x80U | (run - 1U));
+            out[n++] = (uint8_t)(px[i] >> 8);
+            out[n++] = (uint8_t)px[i];
+            i = (uint16_t)(i + run);
+        }
+        else
+        {
+            // Doslovno do početka ponavljanja (2 ista piksela) ili 128 piksela.
+            uint16_t lit = 1U;
+
+            while (((i + lit) < count) && (lit < 128U) &&
+                   !(((i + lit + 1U) < count) && (px[i + lit] == px[i + lit + 1U]))) lit++;
+            out[n++] = (uint8_t)(lit - 1U);
+            for (uint16_t k = 0U; k < lit; k++)
+            {
+                out[n++] = (uint8_t)(px[i + k] >> 8);
+                out[n++] = (uint8_t)px[i + k];
+            }
+            i = (uint16_t)(i + lit);
+        }
+    }
+    return n;
+}
+
+uint32_t RemoteView_DecodeTile(const uint8_t *in, uint32_t len, uint16_t *px, uint16_t count)
+{
+    uint32_t n = 0U;
+    uint16_t i = 0U;
+
+    while (i < count)
+    {
+        uint8_t c;
+        uint16_t k;
+
+        if (n >= len) return 0U;
+        c = in[n++];
+        k = (uint16_t)((c & 0x7FU) + 1U);
+        if ((i + k) > count) return 0U;
+        if ((c & 0x80U) != 0U)
+        {
+            uint16_t v;
+
+            if ((n + 2U) > len) return 0U;
+            v = (uint16_t)((in[n] << 8) | in[n + 1U]);
+            n += 2U;
+            while (k--) px[i++] = v;
+        }
+        else
+        {
+            if ((n + (2U * k)) > len) return 0U;
+            while (k--)
+            {
+                px[i++] = (uint16_t)((in[n] << 8) | in[n + 1U]);
+                n += 2U;
+            }
+        }
+    }
+    return n;
+}
+
+uint32_t RemoteView_Report(const RemoteView_t *rv, char *buf, uint32_t size)
+{
+    int n;
+
+    if (size == 0U) return 0U;
+    n = snprintf(buf, size,
+                 "remote view %s, %ux%u tiles, frames %lu, tiles %lu (torn %lu), frame %lu/%lu B\n"
+                 "stream %lu (acked %lu), stalls %lu, throttled %lu, %lu B/s, %u ms\n",
+                 rv->active ? "on" : "off", rv->tiles_x, rv->tiles_y, (unsigned long)rv->frames,
+                 (unsigned long)rv->tiles, (unsigned long)rv->torn, (unsigned long)rv->last_frame_bytes,
+                 (unsigned long)rv->max_frame_bytes, (unsigned long)rv->head, (unsigned long)rv->tail,
+                 (unsigned long)rv->stalls, (unsigned long)rv->throttled, (unsigned long)rv->rate, rv->interval_ms);
+    if ((n < 0) || ((uint32_t)n >= size))
+    {
+        buf[0] = '\0';
+        return 0U;
+    }
+    return (uint32_t)n;
+}
+
+/*============================================================================*/
+/* IMPLEMENTACIJA PRIVATNIH FUNKCIJA                                          */
+/*============================================================================*/
+
+/**
+ * @brief  Upisuje pločicu u tok ako se promijenila (ili je frejm pun).
+ */
+static void View_Tile(RemoteView_t *rv, uint16_t index)
+{
+    const RemoteViewOps_t *ops = rv->ops;
+    uint16_t x0 = (uint16_t)((uint32_t)(index % rv->tiles_x) * REMOTE_VIEW_TILE);
+    uint16_t y0 = (uint16_t)((uint32_t)(index / rv->tiles_x) * REMOTE_VIEW_TILE);
+    uint16_t w = ((uint32_t)(rv->width - x0) < REMOTE_VIEW_TILE) ? (uint16_t)(rv->width - x0) : (uint16_t)REMOTE_VIEW_TILE;
+    uint16_t h = ((uint32_t)(rv->height - y0) < REMOTE_VIEW_TILE) ? (uint16_t)(rv->height - y0) : (uint16_t)REMOTE_VIEW_TILE;
+    uint32_t flips = ops->flips();
+    const uint16_t *base = ops->base();
+    const uint32_t *over = (ops->overlay != NULL) ? ops->overlay() : NULL;
+    uint32_t hash = View_Hash(rv, base, over, x0, y0, w, h);
+    uint32_t n;
+
+    if (!rv->key && (hash == rv->hash[index])) return;
+
+    View_Compose(rv, base, over, x0, y0, w, h);
+    if (ops->flips() != flips)
+    {
+        // Bafer je zamijenjen dok se čitao; pločica se šalje ponovo u sljedećem frejmu.
+        rv->torn++;
+        hash = ~hash;
+    }
+    rv->hash[index] = hash;
+
+    if (!rv->frame_open)
+    {
+        uint8_t rec[REMOTE_VIEW_FRAME_BYTES];
+
+        rec[0] = REMOTE_VIEW_REC_FRAME;
+        rec[1] = (uint8_t)(rv->seq >> 8);
+        rec[2] = (uint8_t)rv->seq;
+        rec[3] = rv->key ? REMOTE_VIEW_FLAG_KEY : 0U;
+        rec[4] = (uint8_t)(rv->width >> 8);
+        rec[5] = (uint8_t)rv->width;
+        rec[6] = (uint8_t)(rv->height >> 8);
+        rec[7] = (uint8_t)rv->height;
+        rec[8] = REMOTE_VIEW_TILE;
+        Ring_Put(rv, rec, sizeof(rec));
+        rv->frame_open = true;
+    }
+
+    n = RemoteView_EncodeTile(rv->pixels, (uint16_t)(w * h), &rv->rle[REMOTE_VIEW_TILE_HEADER]);
+    rv->rle[0] = REMOTE_VIEW_REC_TILE;
+    rv->rle[1] = (uint8_t)(index >> 8);
+    rv->rle[2] = (uint8_t)index;
+    rv->rle[3] = (uint8_t)(n >> 8);
+    rv->rle[4] = (uint8_t)n;
+    Ring_Put(rv, rv->rle, REMOTE_VIEW_TILE_HEADER + n);
+    rv->tiles++;
+}
+
+/**
+ * @brief  Hash sirovih piksela pločice oba sloja, riječ po riječ.
+ * @note   Množenje prenosi razliku samo prema višim bitima, pa se nakon
+ *         njega riječ rotira; bez toga se dvije promjene najvišeg bita
+ *         (alfa sloja 1) poništavaju. Red sloja 0 se čita po dva piksela,
+ *         osim neparnog ostatka.
+ */
+static uint32_t View_Hash(const RemoteView_t *rv, const uint16_t *base, const uint32_t *over,
+                          uint16_t x0, uint16_t y0, uint16_t w, uint16_t h)
+{
+    uint32_t hash = 0x811C9DC5U;
+
+    for (uint16_t y = 0U; y < h; y++)
+    {
+        const uint16_t *p0 = &base[(uint32_t)(y0 + y) * rv->width + x0];
+        uint16_t x = 0U;
+
+        if ((((uintptr_t)p0) & 3U) == 0U)
+        {
+            const uint32_t *p = (const uint32_t *)(const void *)p0;
+
+            for (; (x + 1U) < w; x += 2U) hash = View_Mix(hash, *p++);
+        }
+        for (; x < w; x++) hash = View_Mix(hash, p0[x]);
+
+        if (over != NULL)
+        {
+            const uint32_t *p1 = &over[(uint32_t)(y0 + y) * rv->width + x0];
+
+            for (x = 0U; x < w; x++) hash = View_Mix(hash, p1[x]);
+        }
+    }
+    return hash;
+}
+
+/**
+ * @brief  Korak hash-a: množenje pa rotacija (jedna ROR instrukcija na Cortex-M7).
+ */
+static inline uint32_t View_Mix(uint32_t hash, uint32_t word)
+{
+    hash = (hash ^ word) * 0x9E3779B1U;
+    return (hash << 13) | (hash >> 19);
+}
+
+/**
+ * @brief  Slaže pločicu kao na ekranu: sloj 1 (alfa piksela) preko sloja 0, u RGB565.
+ */
+static void View_Compose(RemoteView_t *rv, const uint16_t *base, const uint32_t *over,
+                         uint16_t x0, uint16_t y0, uint16_t w, uint16_t h)
+{
+    uint16_t *out = rv->pixels;
+
+    for (uint16_t y = 0U; y < h; y++)
+    {
+        const uint16_t *p0 = &base[(uint32_t)(y0 + y) * rv->width + x0];
+        const uint32_t *p1 = (over != NULL) ? &over[(uint32_t)(y0 + y) * rv->width + x0] : NULL;
+
+        for (uint16_t x = 0U; x < w; x++)
+        {
+            uint16_t c0 = p0[x];
+            uint32_t c1, a, r, g, b;
+
+            if ((p1 == NULL) || ((c1 = p1[x]) < 0x01000000U))
+            {
+                *out++ = c0;
+                continue;
+            }
+            a = c1 >> 24;
+            r = (c1 >> 16) & 0xFFU;
+            g = (c1 >> 8) & 0xFFU;
+            b = c1 & 0xFFU;
+            if (a != 0xFFU)
+            {
+                uint32_t r0 = ((c0 >> 8) & 0xF8U) | (c0 >> 13);
+                uint32_t g0 = ((c0 >> 3) & 0xFCU) | ((c0 >> 9) & 0x03U);
+                uint32_t b0 = (((uint32_t)c0 << 3) & 0xF8U) | ((c0 >> 2) & 0x07U);
+
+                r = ((r * a) + (r0 * (255U - a)) + 127U) / 255U;
+                g = ((g * a) + (g0 * (255U - a)) + 127U) / 255U;
+                b = ((b * a) + (b0 * (255U - a)) + 127U) / 255U;
+            }
+            *out++ = (uint16_t)(((r & 0xF8U) << 8) | ((g & 0xFCU) << 3) | (b >> 3));
+        }
+    }
+}
+
+/**
+ * @brief  Slobodno mjesto u prstenu (nepotvrđeni bajti se čuvaju).
+ */
+static uint32_t Ring_Free(const RemoteView_t *rv)
+{
+    return REMOTE_VIEW_RING_SIZE - (rv->head - rv->tail);
+}
+
+/**
+ * @brief  Dodaje bajte na kraj toka; mjesto je provjereno ranije.
+ */
+static void Ring_Put(RemoteView_t *rv, const uint8_t *data, uint32_t len)
+{
+    uint32_t off = rv->head & (REMOTE_VIEW_RING_SIZE - 1U);
+    uint32_t first = REMOTE_VIEW_RING_SIZE - off;
+
+    if (first > len) first = len;
+    memcpy(&rv->ring[off], data, first);
+    memcpy(rv->ring, &data[first], len - first);
+    rv->head += len;
+}
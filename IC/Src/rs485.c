@@ -44,6 +44,22 @@ static TinyFrame tfapp;
 #define TH_INFO_DELAY 100       // Kanjenje termostat info poruke maste->slave nakon to master dobije set paket
 #define RESPONSE_TIME   200  // ms
 #define MAX_GET_RETRY   3
+#define DIAG_TEXT_SIZE  1024    // snimak izvjestaja o mjerenju iscrtavanja za DIAG_GET
+#define DIAG_CHUNK_SIZE 96      // bajta teksta po odgovoru na DIAG_GET
+#define DIAG_CMD_RESET  1       // DIAG_GET komanda: nakon snimka obrisi statistiku
+#define DIAG_CMD_MEM    2       // DIAG_GET komanda: izvjestaj o GUI hipu i SDRAM-u
+#define DIAG_CMD_VIEW   3       // DIAG_GET komanda: izvjestaj daljinskog pregleda ekrana
+#define DIAG_CMD_CLOCK  4       // DIAG_GET komanda: izvjestaj sata na screensaver-u
+#define VIEW_CHUNK_SIZE 112     // bajta toka slike po odgovoru na REMOTE_VIEW, cijeli okvir stane u TF_SENDBUF_LEN
+#define VIEW_CMD_READ   0       // REMOTE_VIEW komanda: citaj tok od pozicije
+#define VIEW_CMD_START  1       // REMOTE_VIEW komanda: novi tok od pozicije 0 sa punim frejmom
+#define VIEW_CMD_STOP   2       // REMOTE_VIEW komanda: iskljuci pregled
+#define VIEW_CMD_KEY    3       // REMOTE_VIEW komanda: citaj, sljedeci frejm pun
+#define VIEW_OK         0       // REMOTE_VIEW status: podaci (moze 0 bajta) od pozicije
+#define VIEW_OFF        1       // REMOTE_VIEW status: pregled nije ukljucen, poslati START
+#define VIEW_BAD_POS    2       // REMOTE_VIEW status: pozicija nije u nepotvrdjenom toku, poslati START
+#define VIEW_BUSY       3       // REMOTE_VIEW status: bus zauzet komandama, ponoviti kasnije
+#define VIEW_DENIED     4       // REMOTE_VIEW status: pregled nije dozvoljen na panelu ili je ekran za PIN/sifru
 /* Private Variables  --------------------------------------------------------*/
 TF_Msg sendData;
 bool init_tf = false;               // true = tf inicijalizovan, sprjecava blokadu kada sys timer krene a tf jo nije inicijalizovan
@@ -491,6 +507,115 @@ TF_Result TIME_INFO_Listener(TinyFrame *tf, TF_Msg *msg)
     return TF_STAY;
 }
 /**
+* @brief :  izvjestaj o mjerenju iscrtavanja (DISP_GetProfReport) po dijelovima,
+*           samo na explicitno adresiran interfejs
+*           upit:    [0] komanda (0 = citaj, DIAG_CMD_RESET = citaj i obrisi,
+*                    DIAG_CMD_MEM = izvjestaj o hipu, DISP_GetMemReport,
+*                    DIAG_CMD_VIEW = pregled ekrana, DISP_GetRemoteViewReport,
+*                    DIAG_CMD_CLOCK = sat na screensaver-u, DISP_GetClockReport),
+*                    [1] adresa, [2..3] pomak u tekstu (MSB prvi)
+*           odgovor: [0] komanda, [1..2] ukupna duzina teksta, [3..] do
+*                    DIAG_CHUNK_SIZE bajta teksta od pomaka
+*           upit sa pomakom 0 pravi novi snimak, ostali dijelovi se citaju
+*           iz njega pa je tekst uvijek iz istog trenutka
+* @param :
+* @retval:  TF_STAY
+*/
+TF_Result DIAG_GET_Listener(TinyFrame *tf, TF_Msg *msg)
+{
+    static char diag_text[DIAG_TEXT_SIZE];
+    static uint16_t diag_len = 0;
+    uint8_t resp[3 + DIAG_CHUNK_SIZE];
+    uint16_t offset, n = 0;
+
+    if((msg->len < 4) || (msg->data[1] != tfifa)) return TF_STAY;
+
+    offset = ((uint16_t)msg->data[2] << 8) | msg->data[3];
+    if(offset == 0)
+    {
+        const char *text = (msg->data[0] == DIAG_CMD_MEM)   ? DISP_GetMemReport() :
+                           (msg->data[0] == DIAG_CMD_VIEW)  ? DISP_GetRemoteViewReport() :
+                           (msg->data[0] == DIAG_CMD_CLOCK) ? DISP_GetClockReport() : DISP_GetProfReport();
+        diag_len = (uint16_t)strlen(text);
+        if(diag_len > DIAG_TEXT_SIZE) diag_len = DIAG_TEXT_SIZE;
+        memcpy(diag_text, text, diag_len);
+        if(msg->data[0] == DIAG_CMD_RESET) DISP_ResetProf();
+    }
+    if(offset < diag_len)
+    {
+        n = diag_len - offset;
+        if(n > DIAG_CHUNK_SIZE) n = DIAG_CHUNK_SIZE;
+        memcpy(&resp[3], &diag_text[offset], n);
+    }
+    resp[0] = msg->data[0];
+    resp[1] = (diag_len >> 8) & 0xFF;
+    resp[2] = diag_len & 0xFF;
+    msg->data = resp;
+    msg->len = 3 + n;
+    TF_Respond(tf, msg);
+    return TF_STAY;
+}
+/**
+* @brief :  daljinski pregled ekrana za podrsku (remote_view.h), samo na
+*           explicitno adresiran interfejs; preglednik (Tools/rview) cita tok
+*           po poziciji, pa ponovljen upit nakon izgubljenog odgovora vraca
+*           iste bajte, a sve ispod trazene pozicije je potvrdjeno
+*           upit:    [0] komanda (VIEW_CMD_*), [1] adresa,
+*                    [2..5] pozicija u toku (MSB prvi)
+*           odgovor: [0] komanda, [1] status (VIEW_*), [2..5] pozicija,
+*                    [6..] do VIEW_CHUNK_SIZE bajta toka od pozicije
+*           dok neki red komandi nije prazan odgovor nema podataka, a brzinu
+*           toka ogranicava RemoteView_Read, pa pregled ne usporava komande;
+*           START se odbija (VIEW_DENIED) ako pregled nije dozvoljen u
+*           podesavanjima panela ili je na ekranu unos PIN-a ili sifre
+* @param :
+* @retval:  TF_STAY
+*/
+TF_Result REMOTE_VIEW_Listener(TinyFrame *tf, TF_Msg *msg)
+{
+    uint8_t resp[6 + VIEW_CHUNK_SIZE];
+    uint32_t pos;
+    int32_t n = 0;
+
+    if((msg->len < 6) || (msg->data[1] != tfifa)) return TF_STAY;
+
+    pos = ((uint32_t)msg->data[2] << 24) | ((uint32_t)msg->data[3] << 16) |
+          ((uint32_t)msg->data[4] << 8) | msg->data[5];
+    resp[1] = VIEW_OK;
+    if(msg->data[0] == VIEW_CMD_START)
+    {
+        if(!DISP_RemoteViewStart()) resp[1] = VIEW_DENIED;
+    }
+    else if(msg->data[0] == VIEW_CMD_STOP)
+    {
+        DISP_RemoteViewStop();
+        resp[1] = VIEW_OFF;
+    }
+    else
+    {
+        if(msg->data[0] == VIEW_CMD_KEY) DISP_RemoteViewKeyframe();
+        if(binaryQueue.count || dimmerQueue.count || rgbwQueue.count || curtainQueue.count || thermoQueue.count)
+        {
+            resp[1] = VIEW_BUSY;
+        }
+        else
+        {
+            n = DISP_RemoteViewRead(pos, &resp[6], VIEW_CHUNK_SIZE);
+            if(n < 0)
+            {
+                resp[1] = DISP_RemoteViewActive() ? VIEW_BAD_POS : VIEW_OFF;
+                n = 0;
+            }
+        }
+    }
+    resp[0] = msg->data[0];
+    memcpy(&resp[2], &msg->data[2], 4);
+    msg->data = resp;
+    msg->len = 6 + (uint16_t)n;
+    TF_Respond(tf, msg);
+    return TF_STAY;
+}
+/**
 * @brief :  ovo je ID listener registrovan za sve SET upite, takav nacin mogucava vie
 *           razlicitih simultanih upita sa po jedan FIFO bufer komandi sa push / pop
 *           mehanizmom, idealno treba dograditi provjeru poruke iz upita sa odgovorom
@@ -640,6 +765,8 @@ void RS485_Init(void)
         TF_AddTypeListener(&tfapp, DIMMER_SET, DIMMER_SET_Listener);
         TF_AddTypeListener(&tfapp, JALOUSIE_SET, JALOUSIE_SET_Listener);
         TF_AddTypeListener(&tfapp, QR_REQUEST, QR_REQUEST_Listener);
+        TF_AddTypeListener(&tfapp, DIAG_GET, DIAG_GET_Listener);
+        TF_AddTypeListener(&tfapp, REMOTE_VIEW, REMOTE_VIEW_Listener);
         TF_AddTypeListener(&tfapp, TIME_INFO, TIME_INFO_Listener);
         TF_AddTypeListener(&tfapp, THERMOSTAT_GET, THERMOSTAT_GET_Listener);
         TF_AddTypeListener(&tfapp, THERMOSTAT_SET, THERMOSTAT_SET_Listener);
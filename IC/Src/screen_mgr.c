@@ -0,0 +1,250 @@
+/**
+ ******************************************************************************
+ * @file    screen_mgr.c
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Implementacija registra ekrana.
+ *
+ * @note    Prelaz počinje prolazom petlje u kojem je promijenjen `screen`
+ * (stari ekran u njemu briše svoje i pravi nove widgete) i završava kad se
+ * završi prvi servis novog ekrana (koji ga iscrta). Naučeni prelazi su
+ * brojači po paru ekrana; kad se red popuni, novi prelaz zamjenjuje
+ * najrjeđi, a kad brojač dostigne maksimum, svi u redu se prepolove.
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* UKLJUCENI FAJLOVI (INCLUDES)                                               */
+/*============================================================================*/
+#include "screen_mgr.h"
+#include <stdio.h>
+#include <string.h>
+
+/*============================================================================*/
+/* PROTOTIPOVI PRIVATNIH FUNKCIJA                                             */
+/*============================================================================*/
+static void Mgr_Enter(ScreenMgr_t *mgr, uint8_t screen, uint32_t now);
+static void Mgr_Record(ScreenMgr_t *mgr, uint8_t from, uint8_t to, uint32_t us);
+static bool Mgr_Prefetch(ScreenMgr_t *mgr, uint8_t screen);
+static uint8_t Mgr_PrefetchCount(uint64_t mask);
+
+/*============================================================================*/
+/* IMPLEMENTACIJA JAVNIH FUNKCIJA                                             */
+/*============================================================================*/
+
+void ScreenMgr_Init(ScreenMgr_t *mgr, const ScreenMgrOps_t *ops, const ScreenDesc_t *table, uint8_t count, uint32_t idle_us)
+{
+    memset(mgr, 0, sizeof(ScreenMgr_t));
+    mgr->ops = ops;
+    mgr->idle_us = idle_us;
+    for (uint8_t i = 0U; i < count; i++)
+    {
+        if (table[i].id < SCREEN_MGR_MAX_SCREENS) mgr->desc[table[i].id] = &table[i];
+    }
+}
+
+bool ScreenMgr_Service(ScreenMgr_t *mgr, uint8_t screen)
+{
+    const ScreenDesc_t *desc = (screen < SCREEN_MGR_MAX_SCREENS) ? mgr->desc[screen] : NULL;
+    uint32_t now = mgr->ops->now();
+    bool changed = !mgr->started || (screen != mgr->current);
+
+    if (changed) Mgr_Enter(mgr, screen, now);
+    mgr->pass_start = now;
+
+    if ((desc != NULL) && (desc->service != NULL)) desc->service();
+
+    if (changed && mgr->measuring)
+    {
+        mgr->measuring = false;
+        Mgr_Record(mgr, mgr->from, screen, mgr->ops->elapsed_us(mgr->transition_start));
+    }
+    return (desc != NULL);
+}
+
+bool ScreenMgr_Idle(ScreenMgr_t *mgr)
+{
+    const ScreenMgrEdge_t *row;
+    const ScreenDesc_t *desc;
+    uint64_t pending;
+    int16_t best = -1;
+
+    if (!mgr->started || (mgr->current >= SCREEN_MGR_MAX_SCREENS)) return false;
+
+    // Manifest aktivnog ekrana koji pri ulasku nije mogao biti učitan.
+    if ((mgr->prefetched & SCREEN_MGR_BIT(mgr->current)) == 0U)
+    {
+        return Mgr_Prefetch(mgr, mgr->current);
+    }
+    if (Mgr_PrefetchCount(mgr->prefetched & ~SCREEN_MGR_BIT(mgr->current)) >= SCREEN_MGR_PREFETCH_DEPTH) return false;
+    if (mgr->ops->elapsed_us(mgr->entered) < mgr->idle_us) return false;
+
+    // Prvo najčešći naučeni prelaz sa aktivnog ekrana.
+    row = mgr->next[mgr->current];
+    for (uint8_t i = 0U; i < SCREEN_MGR_MAX_NEXT; i++)
+    {
+        if (row[i].count == 0U) continue;
+        desc = mgr->desc[row[i].to];
+        if ((desc == NULL) || (desc->prefetch == NULL)) continue;
+        if ((mgr->prefetched & SCREEN_MGR_BIT(row[i].to)) != 0U) continue;
+        if ((best < 0) || (row[i].count > row[best].count)) best = (int16_t)i;
+    }
+    if (best >= 0) return Mgr_Prefetch(mgr, row[best].to);
+
+    // Zatim ekrani navedeni u tabeli.
+    desc = mgr->desc[mgr->current];
+    pending = (desc != NULL) ? (desc->hints & ~mgr->prefetched) : 0U;
+    for (uint8_t i = 0U; i < SCREEN_MGR_MAX_SCREENS; i++)
+    {
+        if ((pending & SCREEN_MGR_BIT(i)) == 0U) continue;
+        if ((mgr->desc[i] == NULL) || (mgr->desc[i]->prefetch == NULL)) continue;
+        return Mgr_Prefetch(mgr, i);
+    }
+    return false;
+}
+
+uint32_t ScreenMgr_Report(const ScreenMgr_t *mgr, char *buf, uint32_t size)
+{
+    uint32_t len = 0U;
+    int n;
+
+    if (size == 0U) return 0U;
+    buf[0] = '\0';
+    n = snprintf(buf, size, "prefetch %lu, hits %lu, cold %lu\n",
+                 (unsigned long)mgr->prefetches, (unsigned long)mgr->prefetch_hits, (unsigned long)mgr->cold_enters);
+    if ((n < 0) || ((uint32_t)n >= size))
+    {
+        buf[0] = '\0';
+        return 0U;
+    }
+    len = (uint32_t)n;
+
+    for (uint8_t i = 0U; i < SCREEN_MGR_MAX_SCREENS; i++)
+    {
+        for (uint8_t j = 0U; j < SCREEN_MGR_MAX_NEXT; j++)
+        {
+            const ScreenMgrEdge_t *e = &mgr->next[i][j];
+
+            if (e->count == 0U) continue;
+            n = snprintf(&buf[len], size - len, "scr %2u -> %2u: n %u, trans %lu/%lu us\n",
+                         i, e->to, e->count, (unsigned long)e->last_us, (unsigned long)e->max_us);
+            if ((n < 0) || ((uint32_t)n >= (size - len)))
+            {
+                buf[len] = '\0';
+                return len;
+            }
+            len += (uint32_t)n;
+        }
+    }
+    return len;
+}
+
+/*============================================================================*/
+/* IMPLEMENTACIJA PRIVATNIH FUNKCIJA                                          */
+/*============================================================================*/
+
+/**
+ * @brief  Napušta aktivni ekran i ulazi na `screen`.
+ * @note   Manifest novog ekrana se učitava samo ako nije učitan unaprijed.
+ */
+static void Mgr_Enter(ScreenMgr_t *mgr, uint8_t screen, uint32_t now)
+{
+    const ScreenDesc_t *desc = (screen < SCREEN_MGR_MAX_SCREENS) ? mgr->desc[screen] : NULL;
+    bool ready = false;
+
+    if (mgr->started)
+    {
+        const ScreenDesc_t *old = (mgr->current < SCREEN_MGR_MAX_SCREENS) ? mgr->desc[mgr->current] : NULL;
+
+        if ((old != NULL) && (old->leave != NULL)) old->leave();
+        mgr->from = mgr->current;
+        mgr->transition_start = mgr->pass_start;
+        mgr->measuring = true;
+    }
+
+    if ((desc != NULL) && (desc->prefetch != NULL))
+    {
+        if ((screen < SCREEN_MGR_MAX_SCREENS) && ((mgr->prefetched & SCREEN_MGR_BIT(screen)) != 0U))
+        {
+            mgr->prefetch_hits++;
+            ready = true;
+        }
+        else
+        {
+            mgr->cold_enters++;
+            ready = desc->prefetch();
+        }
+    }
+    else
+    {
+        // Ekran bez manifesta se ne učitava.
+        ready = true;
+    }
+
+    mgr->prefetched = (ready && (screen < SCREEN_MGR_MAX_SCREENS)) ? SCREEN_MGR_BIT(screen) : 0U;
+    mgr->current = screen;
+    mgr->started = true;
+    mgr->entered = now;
+}
+
+/**
+ * @brief  Bilježi prelaz `from` -> `to` i njegovo trajanje.
+ */
+static void Mgr_Record(ScreenMgr_t *mgr, uint8_t from, uint8_t to, uint32_t us)
+{
+    ScreenMgrEdge_t *row;
+    ScreenMgrEdge_t *e = NULL;
+
+    if (from >= SCREEN_MGR_MAX_SCREENS) return;
+    row = mgr->next[from];
+
+    for (uint8_t i = 0U; i < SCREEN_MGR_MAX_NEXT; i++)
+    {
+        if ((row[i].count != 0U) && (row[i].to == to))
+        {
+            e = &row[i];
+            break;
+        }
+    }
+    if (e == NULL)
+    {
+        e = &row[0];
+        for (uint8_t i = 1U; i < SCREEN_MGR_MAX_NEXT; i++)
+        {
+            if (row[i].count < e->count) e = &row[i];
+        }
+        memset(e, 0, sizeof(ScreenMgrEdge_t));
+        e->to = to;
+    }
+
+    if (e->count == UINT16_MAX)
+    {
+        for (uint8_t i = 0U; i < SCREEN_MGR_MAX_NEXT; i++) row[i].count /= 2U;
+    }
+    e->count++;
+    e->last_us = us;
+    if (us > e->max_us) e->max_us = us;
+}
+
+/**
+ * @brief  Učitava manifest ekrana `screen`.
+ * @retval bool `false` ako manifest trenutno ne može biti učitan.
+ */
+static bool Mgr_Prefetch(ScreenMgr_t *mgr, uint8_t screen)
+{
+    if (!mgr->desc[screen]->prefetch()) return false;
+    mgr->prefetched |= SCREEN_MGR_BIT(screen);
+    if (screen != mgr->current) mgr->prefetches++;
+    return true;
+}
+
+static uint8_t Mgr_PrefetchCount(uint64_t mask)
+{
+    uint8_t count = 0U;
+
+    while (mask != 0U)
+    {
+        mask &= (mask - 1U);
+        count++;
+    }
+    return count;
+}
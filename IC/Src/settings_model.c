@@ -0,0 +1,108 @@
+/**
+ ******************************************************************************
+ * @file    settings_model.c
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Implementacija modela postavki za ekrane podešavanja.
+ *
+ * @note    Ponovni upis iste vrijednosti (npr. notifikacija koju izazove
+ * `SPINBOX_SetValue` pri ispravci) ne radi ništa, pa ispravka widgeta ne
+ * pravi petlju.
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* UKLJUCENI FAJLOVI (INCLUDES)                                               */
+/*============================================================================*/
+#include "settings_model.h"
+#include <string.h>
+
+/*============================================================================*/
+/* IMPLEMENTACIJA JAVNIH FUNKCIJA                                             */
+/*============================================================================*/
+
+void SettingsModel_Init(SettingsModel_t *model, const SettingsModelOps_t *ops)
+{
+    memset(model, 0, sizeof(SettingsModel_t));
+    model->ops = ops;
+}
+
+bool SettingsModel_Bind(SettingsModel_t *model, uint8_t owner, const SettingsField_t *fields, uint8_t count)
+{
+    SettingsModel_Unbind(model);
+    if ((fields == NULL) || (count > SETTINGS_MODEL_MAX_FIELDS)) return false;
+
+    for (uint8_t i = 0U; i < count; i++)
+    {
+        model->values[i] = model->ops->read(fields[i].key);
+    }
+    model->fields = fields;
+    model->count = count;
+    model->owner = owner;
+    return true;
+}
+
+void SettingsModel_Unbind(SettingsModel_t *model)
+{
+    model->fields = NULL;
+    model->count = 0U;
+    model->owner = 0U;
+    model->pending = 0U;
+}
+
+int16_t SettingsModel_Find(const SettingsModel_t *model, uint8_t owner, uint16_t id)
+{
+    if ((model->fields == NULL) || (owner != model->owner)) return -1;
+    for (uint8_t i = 0U; i < model->count; i++)
+    {
+        if (model->fields[i].id == id) return (int16_t)i;
+    }
+    return -1;
+}
+
+SettingsResult_t SettingsModel_Set(SettingsModel_t *model, int16_t index, int32_t value, int32_t *applied)
+{
+    const SettingsField_t *field;
+    int32_t requested = value;
+
+    if ((index < 0) || (index >= (int16_t)model->count)) return SETTINGS_UNCHANGED;
+    field = &model->fields[index];
+
+    if (value < field->min) value = field->min;
+    if (value > field->max) value = field->max;
+    *applied = model->values[index];
+    if (value == model->values[index])
+    {
+        return (value == requested) ? SETTINGS_UNCHANGED : SETTINGS_CORRECTED;
+    }
+
+    model->ops->write(field->key, value);
+    *applied = model->ops->read(field->key);
+    model->values[index] = *applied;
+    model->pending |= (1U << (uint32_t)index);
+    model->edits++;
+    if (*applied != requested)
+    {
+        model->corrections++;
+        return SETTINGS_CORRECTED;
+    }
+    return SETTINGS_APPLIED;
+}
+
+bool SettingsModel_Next(SettingsModel_t *model, uint8_t *key, int32_t *value)
+{
+    for (uint8_t i = 0U; i < model->count; i++)
+    {
+        if ((model->pending & (1U << i)) == 0U) continue;
+        model->pending &= ~(1U << i);
+        *key = model->fields[i].key;
+        *value = model->values[i];
+        return true;
+    }
+    return false;
+}
+
+int32_t SettingsModel_Value(const SettingsModel_t *model, int16_t index)
+{
+    if ((index < 0) || (index >= (int16_t)model->count)) return 0;
+    return model->values[index];
+}
@@ -14,6 +14,7 @@
 #include "GUI.h"
 #include "main.h"
 #include "rs485.h"
+#include "LCDConf.h"
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
 /* Private macro -------------------------------------------------------------*/
@@ -23,7 +24,6 @@ extern LTDC_HandleTypeDef hltdc;
 extern TIM_HandleTypeDef htim3;
 extern UART_HandleTypeDef huart2;
 extern QSPI_HandleTypeDef hqspi;
-extern DMA2D_HandleTypeDef hdma2d;
 /* Private function prototypes -----------------------------------------------*/
 /* Private functions ---------------------------------------------------------*/
 void NMI_Handler(void) {
@@ -55,8 +55,7 @@ void SysTick_Handler(void) {
 }
 
 void DMA2D_IRQHandler(void) {
-    HAL_DMA2D_IRQHandler(&hdma2d);
-    DMA2D->IFCR = (U32)DMA2D_IFSR_CTCIF;
+    LCD_DMA2D_IRQHandler();
 }
 
 void USART1_IRQHandler(void) {
@@ -74,4 +73,16 @@ void LTDC_IRQHandler(void) {
 void QUADSPI_IRQHandler(void) {
     HAL_QSPI_IRQHandler(&hqspi);
 }
+
+void EXTI15_10_IRQHandler(void) {
+    TS_IntIRQHandler();
+}
+
+void I2C3_EV_IRQHandler(void) {
+    HAL_I2C_EV_IRQHandler(&hi2c3);
+}
+
+void I2C3_ER_IRQHandler(void) {
+    HAL_I2C_ER_IRQHandler(&hi2c3);
+}
 /************************ (C) COPYRIGHT JUBERA D.O.O Sarajevo ************************/
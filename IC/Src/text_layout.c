@@ -0,0 +1,259 @@
+/**
+ ******************************************************************************
+ * @file    text_layout.c
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Implementacija keša širina i rasporeda prevedenih labela.
+ *
+ * @note    Zapisi se traže linearno; 48 poređenja ključa je zanemarivo u
+ * odnosu na jedno mjerenje stringa kroz emWin. Prelomi se računaju samo
+ * na razmacima i '\n' (ASCII), pa su ispravni i za UTF-8 tekstove.
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* UKLJUCENI FAJLOVI (INCLUDES)                                               */
+/*============================================================================*/
+#include "text_layout.h"
+#include <string.h>
+
+/*============================================================================*/
+/* PROTOTIPOVI PRIVATNIH FUNKCIJA                                             */
+/*============================================================================*/
+static TextLayoutEntry_t *Layout_Lookup(TextLayoutCache_t *cache, uint16_t key, uint8_t language, uint8_t font, int16_t wrap_width);
+static void Layout_Break(TextLayoutCache_t *cache, TextLayoutEntry_t *entry, int16_t max_width);
+static int16_t Layout_Measure(TextLayoutCache_t *cache, const TextLayoutEntry_t *entry, uint16_t start, uint16_t len);
+static uint32_t Layout_Hash(uint32_t hash, uint32_t value);
+
+/*============================================================================*/
+/* IMPLEMENTACIJA JAVNIH FUNKCIJA                                             */
+/*============================================================================*/
+
+void TextLayout_Init(TextLayoutCache_t *cache, const TextLayoutOps_t *ops)
+{
+    memset(cache, 0, sizeof(TextLayoutCache_t));
+    cache->ops = ops;
+}
+
+void TextLayout_InvalidateAll(TextLayoutCache_t *cache)
+{
+    memset(cache->entries, 0, sizeof(cache->entries));
+    memset(cache->choices, 0, sizeof(cache->choices));
+}
+
+void TextLayout_InvalidateLabels(TextLayoutCache_t *cache)
+{
+    for (uint8_t i = 0U; i < TEXT_LAYOUT_MAX_ENTRIES; i++)
+    {
+        if (cache->entries[i].key >= TEXT_LAYOUT_LABEL_BASE) cache->entries[i].last_use = 0U;
+    }
+    memset(cache->choices, 0, sizeof(cache->choices));
+}
+
+const TextLayoutEntry_t *TextLayout_Get(TextLayoutCache_t *cache, uint16_t key, uint8_t language, uint8_t font)
+{
+    return Layout_Lookup(cache, key, language, font, 0);
+}
+
+const TextLayoutEntry_t *TextLayout_Wrap(TextLayoutCache_t *cache, uint16_t key, uint8_t language, uint8_t font, int16_t max_width)
+{
+    return Layout_Lookup(cache, key, language, font, (max_width > 0) ? max_width : 0);
+}
+
+uint8_t TextLayout_ChooseFont(TextLayoutCache_t *cache, uint16_t id, uint8_t language, const uint16_t *keys, uint8_t count,
+                              int16_t max_width, const uint8_t *fonts, uint8_t font_count)
+{
+    TextLayoutChoice_t *choice = NULL;
+    uint32_t signature = 2166136261U;
+    uint8_t chosen;
+
+    if (font_count == 0U) return 0U;
+
+    signature = Layout_Hash(signature, language);
+    signature = Layout_Hash(signature, (uint16_t)max_width);
+    for (uint8_t i = 0U; i < count; i++) signature = Layout_Hash(signature, keys[i]);
+    for (uint8_t i = 0U; i < font_count; i++) signature = Layout_Hash(signature, fonts[i]);
+
+    for (uint8_t i = 0U; i < TEXT_LAYOUT_MAX_CHOICES; i++)
+    {
+        TextLayoutChoice_t *c = &cache->choices[i];
+        if (c->valid && (c->id == id))
+        {
+            choice = c;
+            break;
+        }
+        if ((choice == NULL) && !c->valid) choice = c;
+    }
+    if (choice == NULL) choice = &cache->choices[id % TEXT_LAYOUT_MAX_CHOICES];
+
+    cache->lookups++;
+    if (choice->valid && (choice->id == id) && (choice->signature == signature))
+    {
+        cache->hits++;
+        return choice->font;
+    }
+
+    chosen = fonts[font_count - 1U];
+    for (uint8_t f = 0U; f < font_count; f++)
+    {
+        bool fits = true;
+        for (uint8_t i = 0U; (i < count) && fits; i++)
+        {
+            const TextLayoutEntry_t *entry = TextLayout_Get(cache, keys[i], language, fonts[f]);
+            if (entry->width > max_width) fits = false;
+        }
+        if (fits)
+        {
+            chosen = fonts[f];
+            break;
+        }
+    }
+
+    choice->id = id;
+    choice->valid = true;
+    choice->font = chosen;
+    choice->signature = signature;
+    return chosen;
+}
+
+/*============================================================================*/
+/* IMPLEMENTACIJA PRIVATNIH FUNKCIJA                                          */
+/*============================================================================*/
+
+/**
+ * @brief  Nalazi ili pravi zapis i po potrebi ponovo računa prelome.
+ */
+static TextLayoutEntry_t *Layout_Lookup(TextLayoutCache_t *cache, uint16_t key, uint8_t language, uint8_t font, int16_t wrap_width)
+{
+    TextLayoutEntry_t *entry = NULL;
+    TextLayoutEntry_t *victim = &cache->entries[0];
+
+    cache->clock++;
+    cache->lookups++;
+    for (uint8_t i = 0U; i < TEXT_LAYOUT_MAX_ENTRIES; i++)
+    {
+        TextLayoutEntry_t *e = &cache->entries[i];
+        if ((e->last_use != 0U) && (e->key == key) && (e->language == language) && (e->font == font))
+        {
+            entry = e;
+            break;
+        }
+        if ((victim->last_use != 0U) && ((e->last_use == 0U) || ((int32_t)(e->last_use - victim->last_use) < 0))) victim = e;
+    }
+
+    if (entry == NULL)
+    {
+        entry = victim;
+        memset(entry, 0, sizeof(TextLayoutEntry_t));
+        entry->key = key;
+        entry->language = language;
+        entry->font = font;
+        entry->text = cache->ops->text(key, language);
+        entry->wrap_width = -1;
+        cache->text_fetches++;
+    }
+    if (entry->wrap_width != wrap_width)
+    {
+        Layout_Break(cache, entry, wrap_width);
+    }
+    else
+    {
+        cache->hits++;
+    }
+    entry->last_use = cache->clock;
+    return entry;
+}
+
+/**
+ * @brief  Lomi tekst na linije: uvijek na '\n', a za `max_width` > 0 i na
+ *         zadnjem razmaku prije kojeg linija još staje.
+ */
+static void Layout_Break(TextLayoutCache_t *cache, TextLayoutEntry_t *entry, int16_t max_width)
+{
+    const char *text = entry->text;
+    uint16_t pos = 0U;
+
+    entry->lines = 0U;
+    entry->width = 0;
+    entry->wrap_width = max_width;
+
+    do
+    {
+        uint16_t para_end = pos + (uint16_t)strcspn(&text[pos], "\n");
+        uint16_t line_end = para_end;
+        int16_t line_width;
+
+        bool last = (entry->lines == (TEXT_LAYOUT_MAX_LINES - 1U));
+
+        if (last)
+        {
+            // Zadnja linija dobija ostatak teksta.
+            line_end = pos + (uint16_t)strlen(&text[pos]);
+        }
+        line_width = Layout_Measure(cache, entry, pos, line_end - pos);
+
+        if ((max_width > 0) && (line_width > max_width) && !last)
+        {
+            uint16_t scan = pos;
+            uint16_t best = 0U;
+            int16_t best_width = 0;
+
+            // Produžava liniju riječ po riječ dok staje.
+            while (scan < para_end)
+            {
+                const char *space = memchr(&text[scan], ' ', para_end - scan);
+                uint16_t cut;
+                int16_t w;
+
+                if (space == NULL) break;
+                cut = (uint16_t)(space - text);
+                w = Layout_Measure(cache, entry, pos, cut - pos);
+                if ((w > max_width) && (best != 0U)) break;
+                best = cut;
+                best_width = w;
+                scan = cut + 1U;
+                if (w > max_width) break;
+            }
+            if (best != 0U)
+            {
+                line_end = best;
+                line_width = best_width;
+            }
+        }
+
+        entry->line_start[entry->lines] = pos;
+        entry->line_len[entry->lines] = line_end - pos;
+        entry->lines++;
+        if (line_width > entry->width) entry->width = line_width;
+
+        pos = line_end;
+        if (text[pos] == '\n')
+        {
+            pos++;
+        }
+        else
+        {
+            while (text[pos] == ' ') pos++;
+        }
+    }
+    while (text[pos] != '\0');
+}
+
+static int16_t Layout_Measure(TextLayoutCache_t *cache, const TextLayoutEntry_t *entry, uint16_t start, uint16_t len)
+{
+    if (len == 0U) return 0;
+    cache->measures++;
+    return cache->ops->width(entry->font, &entry->text[start], len);
+}
+
+/**
+ * @brief  Jedan korak FNV-1a nad 32-bitnom vrijednošću.
+ */
+static uint32_t Layout_Hash(uint32_t hash, uint32_t value)
+{
+    for (uint8_t i = 0U; i < 4U; i++)
+    {
+        hash ^= (value >> (i * 8U)) & 0xFFU;
+        hash *= 16777619U;
+    }
+    return hash;
+}
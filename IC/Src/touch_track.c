@@ -0,0 +1,88 @@
+/**
+ ******************************************************************************
+ * @file    touch_track.c
+ * @author  Gemini & [Vaše Ime]
+ * @brief   Implementacija praćenja kontakta na ekranu osjetljivom na dodir.
+ *
+ * @note    Logika je ista kao u ranijem `TS_Service`: stanje se prijavljuje
+ * pri promjeni pritiska ili kad pomak po X ili Y pređe prag, a nakon
+ * otpuštanja zapamćene koordinate se vraćaju na nulu.
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* UKLJUCENI FAJLOVI (INCLUDES)                                               */
+/*============================================================================*/
+#include "touch_track.h"
+#include <string.h>
+
+/*============================================================================*/
+/* PROTOTIPOVI PRIVATNIH FUNKCIJA                                             */
+/*============================================================================*/
+static uint16_t Touch_Diff(uint16_t a, uint16_t b);
+
+/*============================================================================*/
+/* IMPLEMENTACIJA JAVNIH FUNKCIJA                                             */
+/*============================================================================*/
+
+void TouchTrack_Init(TouchTrack_t *track)
+{
+    memset(track, 0, sizeof(TouchTrack_t));
+}
+
+uint16_t TouchTrack_Threshold(bool high_precision)
+{
+    return high_precision ? TOUCH_TRACK_THRESHOLD_PRECISE : TOUCH_TRACK_THRESHOLD_NORMAL;
+}
+
+void TouchTrack_Decode(const uint8_t *regs, uint16_t xsize, uint16_t ysize, TouchSample_t *sample)
+{
+    uint8_t touches = regs[0] & 0x0FU;
+
+    sample->x = (uint16_t)(((regs[1] & 0x0FU) << 8) | regs[2]);
+    sample->y = (uint16_t)(((regs[3] & 0x0FU) << 8) | regs[4]);
+    sample->pressed = (touches > 0U) && (touches <= TOUCH_TRACK_MAX_TOUCH);
+
+    if (!sample->pressed || (sample->x >= xsize) || (sample->y >= ysize))
+    {
+        sample->x = 0U;
+        sample->y = 0U;
+        sample->pressed = false;
+    }
+}
+
+bool TouchTrack_Update(TouchTrack_t *track, const TouchSample_t *sample, uint16_t threshold, TouchSample_t *report)
+{
+    track->samples++;
+    if ((track->last.pressed == sample->pressed) &&
+        (Touch_Diff(track->last.x, sample->x) <= threshold) &&
+        (Touch_Diff(track->last.y, sample->y) <= threshold))
+    {
+        return false;
+    }
+
+    track->reports++;
+    track->last.pressed = sample->pressed;
+    if (sample->pressed)
+    {
+        track->last.x = sample->x;
+        track->last.y = sample->y;
+        *report = track->last;
+    }
+    else
+    {
+        *report = track->last;
+        track->last.x = 0U;
+        track->last.y = 0U;
+    }
+    return true;
+}
+
+/*============================================================================*/
+/* IMPLEMENTACIJA PRIVATNIH FUNKCIJA                                          */
+/*============================================================================*/
+
+static uint16_t Touch_Diff(uint16_t a, uint16_t b)
+{
+    return (a > b) ? (uint16_t)(a - b) : (uint16_t)(b - a);
+}
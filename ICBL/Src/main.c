@@ -23,6 +23,7 @@
 /* Includes ------------------------------------------------------------------*/
 #include "main.h"
 #include "stm32746g_qspi.h"
+#include "fw_boot_cache.h"
 /* Imported Type  ------------------------------------------------------------*/
 /* Imported Variable  --------------------------------------------------------*/
 /* Imported Function  --------------------------------------------------------*/
@@ -35,11 +36,13 @@ IWDG_HandleTypeDef hiwdg;
 FwInfoTypeDef RunFwInfo;
 FwInfoTypeDef NewFwInfo;
 FwInfoTypeDef BkpFwInfo;
+FwBootRecTypeDef BootRec;
 /* Private Variable ----------------------------------------------------------*/
 uint8_t runfw = 0x0U;
 uint8_t newfw = 0x0U;
 uint8_t bkpfw = 0x0U;
 uint8_t updfw = 0x0U;
+uint8_t bootev = 0x0U;
 /* Private Function Prototype ------------------------------------------------*/
 void MX_IWDG_Init(void);
 void HAL_Deinit(void);
@@ -48,6 +51,8 @@ void MX_CRC_DeInit(void);
 void CPU_CACHE_Enable(void);
 void SystemClock_Config(void);
 void RunApplication(uint32_t addr);
+void FwBootLoad(FwBootRecTypeDef *rec);
+void FwBootSave(const FwBootRecTypeDef *rec);
 /* Program Code  -------------------------------------------------------------*/
 int main(void)
 {
@@ -65,6 +70,25 @@ int main(void)
     ResetFwInfo(&NewFwInfo);
     RunFwInfo.ld_addr = RT_APPL_ADDR;
     NewFwInfo.ld_addr = RT_NEW_FILE_ADDR;
+    /* headers only, image crc is calculated if something changed since last verified boot */
+    runfw = ValidateFwInfoQuick (&RunFwInfo);
+    newfw = ValidateFwInfoQuick (&NewFwInfo);
+    updfw = IsNewFwUpdate(&RunFwInfo, &NewFwInfo);
+    FwBootLoad(&BootRec);
+    if (runfw) bootev |= FWBOOT_EVT_HDR_INVALID;
+    if (!newfw && !updfw) bootev |= FWBOOT_EVT_NEW_IMAGE;
+    if (__HAL_RCC_GET_FLAG(RCC_FLAG_IWDGRST) || __HAL_RCC_GET_FLAG(RCC_FLAG_WWDGRST)) bootev |= FWBOOT_EVT_FAIL; // flags cleared by application
+    if (bootev & FWBOOT_EVT_FAIL)
+    {   /* reset flags do not survive power down, keep failure in record until full check completes */
+        FwBoot_Fail(&BootRec);
+        FwBootSave(&BootRec);
+    }
+    if (FwBoot_Decide(&BootRec, RunFwInfo.size, RunFwInfo.crc32, RunFwInfo.version, bootev) == FWBOOT_FAST)
+    {
+        FwBoot_CountFast(&BootRec);
+        FwBootSave(&BootRec);
+        RunApplication(RunFwInfo.wr_addr);
+    }
     runfw = GetFwInfo (&RunFwInfo); // working version info
     newfw = GetFwInfo (&NewFwInfo); // new file version info
     updfw = IsNewFwUpdate(&RunFwInfo, &NewFwInfo); // check is new firmware update
@@ -94,6 +118,10 @@ int main(void)
         else if (!newfw) QSPI2FLASH_Copy (NewFwInfo.ld_addr, NewFwInfo.wr_addr, NewFwInfo.size); 
         
     }
+    /* remember verified image, replaced image is checked again on next boot */
+    if (updfw && !runfw) FwBoot_Record(&BootRec, RunFwInfo.size, RunFwInfo.crc32, RunFwInfo.version);
+    else FwBoot_Invalidate(&BootRec);
+    FwBootSave(&BootRec);
         
     if (!runfw) RunApplication(RunFwInfo.wr_addr);
     RunApplication(RT_APPL_ADDR);
@@ -312,6 +340,36 @@ void RunApplication(uint32_t addr){
 		StartApplication();
     }
 }
+/**
+  * @brief  read verified boot record from rtc backup registers
+  * @param  rec: output record, cleared if backup registers are not valid
+  * @retval None
+  */
+void FwBootLoad(FwBootRecTypeDef *rec){
+    uint32_t words[FWBOOT_RECORD_WORDS];
+    uint32_t i;
+    __HAL_RCC_PWR_CLK_ENABLE();
+    for (i = 0U; i < FWBOOT_RECORD_WORDS; i++){
+        words[i] = (&RTC->BKP0R)[FWBOOT_BKP_REG + i];
+    }
+    FwBoot_Unpack(rec, words);
+}
+/**
+  * @brief  write verified boot record to rtc backup registers
+  * @param  rec: record
+  * @retval None
+  */
+void FwBootSave(const FwBootRecTypeDef *rec){
+    uint32_t words[FWBOOT_RECORD_WORDS];
+    uint32_t i;
+    FwBoot_Pack(rec, words);
+    __HAL_RCC_PWR_CLK_ENABLE();
+    HAL_PWR_EnableBkUpAccess();
+    for (i = 0U; i < FWBOOT_RECORD_WORDS; i++){
+        (&RTC->BKP0R)[FWBOOT_BKP_REG + i] = words[i];
+    }
+    HAL_PWR_DisableBkUpAccess();
+}
 #ifdef USE_FULL_ASSERT
 /**
   * @brief  Reports the name of the source file and the source line number
@@ -48,6 +48,8 @@ typedef enum {
     CONTEROLLER_GET     = 53,   // uzmi cijelu strukturu kontrolera sve pinove sve registre
     CONTROLLER_SET      = 54,   // upiši cijelu strukturu kontrolera i reinicijalizuj 
     SCENE_CONTROL       = 55,   // Poruka za sinhronizaciju aktivacije scena između displeja.
+    DIAG_GET            = 56,   // izvještaj o mjerenju iscrtavanja displeja (GUI_Exec, dodir -> prikaz, DMA2D), po dijelovima
+    REMOTE_VIEW         = 57,   // daljinski pregled ekrana za podršku: promijenjene pločice slike, čita se po poziciji u toku
     // ostavi prostora za dopune
     DIN_GET             = 60,   // expliicitan upit stanja digitalnog ulaza
     DIN_EVENT           = 61    // Poruka koju šalje modul sa ulazima kada detektuje promjenu stanja.
@@ -0,0 +1,675 @@
+/**
+ ******************************************************************************
+ * File Name          : animconv.c
+ * Description        : host tool, packs a sequence of emWin ARGB8888 frames
+ *                      into a keyframe + changed rectangles clip (anim_codec.h)
+ ******************************************************************************
+ *
+ * Reads the frames (C files written by emWin Bitmap Converter, one
+ * GUI_DRAW_BMP8888 bitmap each, all of the same size) in playback order.
+ * The first frame becomes the keyframe. For every frame the pixels that
+ * differ from the previous frame (for frame 0: from the last frame, so
+ * the clip loops) are collected on a grid of tiles; dirty tiles are
+ * merged into rectangles and every rectangle is shrunk to the changed
+ * pixels it holds. Keyframe and rectangles are stored in the smallest
+ * lossless icon format of icon_codec.h.
+ *
+ * A rectangle whose pixels all have the same alpha A (0 < A < 255) is
+ * stored opaque, with A as the rectangle alpha (sprite with opacity), and
+ * equal images are stored once. A fade of one picture therefore packs
+ * into a single image and one alpha per frame.
+ *
+ * The clip is then played with the firmware decoder (IC/Src/anim_codec.c):
+ * keyframe, frames 1..n-1 and the loop back to frame 0. Every frame must
+ * match the source pixel by pixel, otherwise no output is written.
+ *
+ * Build (Linux):
+ *   gcc -O2 -I../../IC/Inc -o animconv animconv.c ../../IC/Src/anim_codec.c ../../IC/Src/icon_codec.c
+ *
+ * Usage:
+ *   animconv -n name -t frame_ms [-g tile] [-o out.c] [-r report.txt] frame.c ...
+ *
+ * The output file defines `GUI_CONST_STORAGE AnimClip_t name`.
+ *
+ ******************************************************************************
+ */
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdint.h>
+#include "anim_codec.h"
+/* Private Define ------------------------------------------------------------*/
+#define MAX_FRAMES      64U
+#define MAX_PATCHES     4096U
+#define MAX_NAME        128U
+#define DEFAULT_TILE    16U
+/* Private Typedef -----------------------------------------------------------*/
+typedef struct
+{
+    uint8_t   format;               // IconFormat_t
+    uint16_t  width;
+    uint16_t  height;
+    uint16_t  colors;
+    uint32_t  color;
+    uint32_t  clut[ICON_CODEC_MAX_COLORS];
+    uint8_t  *data;
+    uint32_t  size;
+} Packed_t;
+
+typedef struct
+{
+    uint16_t  x, y, w, h;
+    uint8_t   alpha;                // rectangle alpha, 0xFF = pixel alpha
+    uint16_t  image;                // index in images[]
+    uint8_t   shared;               // image already stored by an earlier rectangle
+} Patch_t;
+
+typedef struct
+{
+    uint8_t  *data;
+    uint32_t  size;
+    uint32_t  cap;
+} Buffer_t;
+/* Private Variables ---------------------------------------------------------*/
+static const char *format_names[ICON_FMT_COUNT] = { "ARGB8888", "A8", "L8", "RLE8", "RLE32" };
+static uint32_t *frames[MAX_FRAMES];
+static uint32_t frame_count;
+static uint16_t width, height;
+static Packed_t images[MAX_PATCHES + 1U];
+static uint32_t image_count;
+static Patch_t keyframe;
+static Patch_t patches[MAX_PATCHES];
+static uint32_t patch_count;
+static AnimFrame_t frame_table[MAX_FRAMES];
+/* Private Function Prototype ------------------------------------------------*/
+static char *ReadFile(const char *path);
+static void StripComments(char *src);
+static uint32_t *ParseFrame(char *src, uint16_t *w, uint16_t *h);
+static void BufPut(Buffer_t *buf, const void *p, uint32_t n);
+static void EncodeRle(Buffer_t *buf, const uint8_t *line, uint16_t w, uint8_t bytes);
+static void Pack(Packed_t *out, const uint32_t *img, uint16_t stride, uint16_t x0, uint16_t y0, uint16_t w, uint16_t h);
+static void Place(Patch_t *p, const uint32_t *img);
+static uint32_t Diff(const uint32_t *prev, const uint32_t *cur, uint16_t tile);
+static IconImage_t ToImage(const Packed_t *p);
+static int Verify(void);
+static int WriteOutput(const char *path, const char *name, uint16_t frame_ms);
+static void WriteImage(FILE *f, const char *sym, const Packed_t *p);
+/* Program Code  -------------------------------------------------------------*/
+int main(int argc, char **argv)
+{
+    const char *name = NULL, *outpath = NULL;
+    FILE *report = stdout;
+    uint16_t frame_ms = 0U, tile = DEFAULT_TILE;
+    uint64_t orig, packed;
+    int argi = 1, ok;
+
+    while ((argi < argc) && (argv[argi][0] == '-'))
+    {
+        if (!strcmp(argv[argi], "-n") && ((argi + 1) < argc)) name = argv[++argi];
+        else if (!strcmp(argv[argi], "-t") && ((argi + 1) < argc)) frame_ms = (uint16_t)strtoul(argv[++argi], NULL, 0);
+        else if (!strcmp(argv[argi], "-g") && ((argi + 1) < argc)) tile = (uint16_t)strtoul(argv[++argi], NULL, 0);
+        else if (!strcmp(argv[argi], "-o") && ((argi + 1) < argc)) outpath = argv[++argi];
+        else if (!strcmp(argv[argi], "-r") && ((argi + 1) < argc))
+        {
+            report = fopen(argv[++argi], "w");
+            if (report == NULL) { perror(argv[argi]); return 2; }
+        }
+        else break;
+        argi++;
+    }
+    if ((name == NULL) || (frame_ms == 0U) || (tile == 0U) || (argi >= argc) || ((argc - argi) > (int)MAX_FRAMES))
+    {
+        fprintf(stderr, "usage: %s -n name -t frame_ms [-g tile] [-o out.c] [-r report.txt] frame.c ...\n", argv[0]);
+        return 2;
+    }
+
+    for (; argi < argc; argi++)
+    {
+        uint16_t w, h;
+        char *src = ReadFile(argv[argi]);
+
+        frames[frame_count] = (src != NULL) ? ParseFrame(src, &w, &h) : NULL;
+        free(src);
+        if (frames[frame_count] == NULL)
+        {
+            fprintf(stderr, "%s: no ARGB8888 bitmap\n", argv[argi]);
+            return 2;
+        }
+        if (frame_count == 0U) { width = w; height = h; }
+        else if ((w != width) || (h != height))
+        {
+            fprintf(stderr, "%s: %ux%u, expected %ux%u\n", argv[argi], w, h, width, height);
+            return 2;
+        }
+        frame_count++;
+    }
+
+    keyframe.w = width;
+    keyframe.h = height;
+    Place(&keyframe, frames[0]);
+    orig = (uint64_t)frame_count * width * height * 4U;
+    packed = images[0].size + images[0].colors * 4U;
+    fprintf(report, "clip %s: %u frames %ux%u, %u ms, tile %u\n", name, frame_count, width, height, frame_ms, tile);
+    fprintf(report, "%-6s %8s %8s %8s %-8s %s\n", "frame", "rects", "pixels", "bytes", "formats", "alpha");
+    fprintf(report, "%-6s %8u %8u %8u %-8s 0x%02X\n", "key", 1U, (uint32_t)width * height, (uint32_t)packed, format_names[images[0].format], keyframe.alpha);
+    for (uint32_t k = 0U; k < frame_count; k++)
+    {
+        const uint32_t *prev = frames[(k == 0U) ? (frame_count - 1U) : (k - 1U)];
+        uint32_t first = patch_count, pixels = 0U, bytes = 0U, n;
+        char formats[64] = "", alpha[8] = "";
+
+        n = Diff(prev, frames[k], tile);
+        if (n == UINT32_MAX)
+        {
+            fprintf(stderr, "too many rectangles\n");
+            return 2;
+        }
+        frame_table[k].first = (uint16_t)first;
+        frame_table[k].count = (uint16_t)n;
+        for (uint32_t i = first; i < patch_count; i++)
+        {
+            const Packed_t *img = &images[patches[i].image];
+
+            pixels += (uint32_t)patches[i].w * patches[i].h;
+            if (!patches[i].shared) bytes += img->size + img->colors * 4U;
+            if (!strstr(formats, format_names[img->format]) && ((strlen(formats) + 10U) < sizeof(formats)))
+            {
+                strcat(formats, formats[0] ? "," : "");
+                strcat(formats, format_names[img->format]);
+            }
+            if (patches[i].alpha != 0xFFU) snprintf(alpha, sizeof(alpha), "0x%02X", patches[i].alpha);
+        }
+        packed += bytes + n * 12U;      // + AnimPatch_t
+        fprintf(report, "%-6u %8u %8u %8u %-8s %s\n", k, n, pixels, bytes, formats, alpha);
+    }
+
+    ok = Verify();
+    fprintf(report, "\nsize: %llu -> %llu bytes (%.1f%%), %u rectangles, %u images, playback %s\n",
+            (unsigned long long)orig, (unsigned long long)packed, orig ? (100.0 * packed / orig) : 0.0, patch_count, image_count, ok ? "ok" : "FAIL");
+    if (ok && (outpath != NULL) && WriteOutput(outpath, name, frame_ms)) ok = 0;
+    if (report != stdout) fclose(report);
+
+    for (uint32_t i = 0U; i < image_count; i++) free(images[i].data);
+    for (uint32_t k = 0U; k < frame_count; k++) free(frames[k]);
+    return ok ? 0 : 1;
+}
+/**
+ * @brief  read whole file into zero terminated buffer
+ */
+static char *ReadFile(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    char *buf;
+    long len;
+
+    if (f == NULL) return NULL;
+    fseek(f, 0, SEEK_END);
+    len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    buf = malloc((size_t)len + 1U);
+    if ((buf != NULL) && (fread(buf, 1U, (size_t)len, f) == (size_t)len)) buf[len] = '\0';
+    else { free(buf); buf = NULL; }
+    fclose(f);
+    return buf;
+}
+/**
+ * @brief  replace C comments with spaces (converter output has no strings with comment markers)
+ */
+static void StripComments(char *src)
+{
+    char *p = src;
+
+    while (*p)
+    {
+        if ((p[0] == '/') && (p[1] == '/'))
+        {
+            while (*p && (*p != '\n')) *p++ = ' ';
+        }
+        else if ((p[0] == '/') && (p[1] == '*'))
+        {
+            while (*p && !((p[0] == '*') && (p[1] == '/'))) *p++ = ' ';
+            if (*p) { p[0] = ' '; p[1] = ' '; p += 2; }
+        }
+        else p++;
+    }
+}
+/**
+ * @brief  load the first ARGB8888 bitmap of a file as canonical DMA2D ARGB
+ *         (alpha 0xFF = opaque, transparent = 0), same as iconconv
+ * @retval pixels or NULL
+ */
+static uint32_t *ParseFrame(char *src, uint16_t *w, uint16_t *h)
+{
+    char name[MAX_NAME], array[MAX_NAME], methods[MAX_NAME];
+    unsigned x, y, bpl, bpp;
+    const char *p = src;
+    uint32_t *pixels;
+    uint32_t n, i = 0U;
+    size_t len;
+
+    StripComments(src);
+    for (;;)
+    {
+        p = strstr(p, "GUI_BITMAP");
+        if (p == NULL) return NULL;
+        p += strlen("GUI_BITMAP");
+        if (!isspace((unsigned char)*p)) continue;
+        if (sscanf(p, " %127[A-Za-z0-9_] = { %u , %u , %u , %u , ( unsigned char * ) %127[A-Za-z0-9_] , NULL , %127[A-Za-z0-9_]",
+                   name, &x, &y, &bpl, &bpp, array, methods) == 7) break;
+        if (sscanf(p, " %127[A-Za-z0-9_] = { %u , %u , %u , %u , ( unsigned char* ) %127[A-Za-z0-9_] , NULL , %127[A-Za-z0-9_]",
+                   name, &x, &y, &bpl, &bpp, array, methods) == 7) break;
+    }
+    if (strcmp(methods, "GUI_DRAW_BMP8888") || (bpp != 32U) || (bpl != x * 4U) || (x == 0U) || (y == 0U) || (x > 0xFFFFU) || (y > 0xFFFFU)) return NULL;
+
+    len = strlen(array);
+    p = src;
+    for (;;)
+    {
+        p = strstr(p, array);
+        if (p == NULL) return NULL;
+        if (((p == src) || !(isalnum((unsigned char)p[-1]) || (p[-1] == '_'))) && (p[len] == '['))
+        {
+            p = strchr(p, '{');
+            break;
+        }
+        p += len;
+    }
+    if (p == NULL) return NULL;
+
+    n = x * y;
+    pixels = malloc(n * sizeof(uint32_t));
+    p++;
+    while ((i < n) && *p && (*p != '}'))
+    {
+        char *end;
+        unsigned long v;
+
+        while (*p && (isspace((unsigned char)*p) || (*p == ','))) p++;
+        if (*p == '}') break;
+        v = strtoul(p, &end, 0);
+        if (end == p) break;
+        p = end;
+        uint32_t a = 0xFFU - (uint32_t)(v >> 24);
+        pixels[i++] = (a == 0U) ? 0U : ((a << 24) | ((uint32_t)v & 0x00FFFFFFU));
+    }
+    if (i != n) { free(pixels); return NULL; }
+    *w = (uint16_t)x;
+    *h = (uint16_t)y;
+    return pixels;
+}
+
+static void BufPut(Buffer_t *buf, const void *p, uint32_t n)
+{
+    if ((buf->size + n) > buf->cap)
+    {
+        buf->cap = (buf->size + n) * 2U + 64U;
+        buf->data = realloc(buf->data, buf->cap);
+    }
+    memcpy(buf->data + buf->size, p, n);
+    buf->size += n;
+}
+/**
+ * @brief  encode one line in the RLE format described in icon_codec.h
+ */
+static void EncodeRle(Buffer_t *buf, const uint8_t *line, uint16_t w, uint8_t bytes)
+{
+    const uint16_t min_run = (bytes == 4U) ? 2U : 3U;
+    uint16_t x = 0U;
+
+    while (x < w)
+    {
+        uint16_t run = 1U;
+        while (((x + run) < w) && (run < 129U) && !memcmp(&line[(x + run) * bytes], &line[x * bytes], bytes)) run++;
+        if (run >= min_run)
+        {
+            uint8_t c = (uint8_t)(0x7EU + run);
+            BufPut(buf, &c, 1U);
+            BufPut(buf, &line[x * bytes], bytes);
+            x += run;
+            continue;
+        }
+        uint16_t lit = 0U;
+        while (((x + lit) < w) && (lit < 128U))
+        {
+            uint16_t r = 1U;
+            while (((x + lit + r) < w) && (r < min_run) && !memcmp(&line[(x + lit + r) * bytes], &line[(x + lit) * bytes], bytes)) r++;
+            if (r >= min_run) break;
+            lit++;
+        }
+        uint8_t c = (uint8_t)(lit - 1U);
+        BufPut(buf, &c, 1U);
+        BufPut(buf, &line[x * bytes], (uint32_t)lit * bytes);
+        x += lit;
+    }
+}
+/**
+ * @brief  pack a rectangle of an image in the smallest icon format; on equal
+ *         size direct formats win because DMA2D reads them without decoding
+ */
+static void Pack(Packed_t *out, const uint32_t *img, uint16_t stride, uint16_t x0, uint16_t y0, uint16_t w, uint16_t h)
+{
+    static const uint8_t order[ICON_FMT_COUNT] = { ICON_FMT_A8, ICON_FMT_L8, ICON_FMT_ARGB8888, ICON_FMT_RLE8, ICON_FMT_RLE32 };
+    uint32_t n = (uint32_t)w * h;
+    uint8_t *argb = malloc(n * 4U);
+    uint8_t *index = malloc(n);
+
+    if ((argb == NULL) || (index == NULL)) { fprintf(stderr, "out of memory\n"); exit(2); }
+    Buffer_t cand[ICON_FMT_COUNT];
+    uint32_t cost[ICON_FMT_COUNT];
+    uint32_t rgb = 0U;
+    int single = 1, have_rgb = 0;
+
+    memset(out, 0, sizeof(Packed_t));
+    memset(cand, 0, sizeof(cand));
+    out->width = w;
+    out->height = h;
+    for (uint32_t f = 0U; f < ICON_FMT_COUNT; f++) cost[f] = UINT32_MAX;
+    for (uint32_t i = 0U; i < n; i++)
+    {
+        uint32_t v = img[(uint32_t)(y0 + i / w) * stride + x0 + i % w];
+        uint16_t c;
+
+        argb[i * 4U + 0U] = (uint8_t)v;
+        argb[i * 4U + 1U] = (uint8_t)(v >> 8);
+        argb[i * 4U + 2U] = (uint8_t)(v >> 16);
+        argb[i * 4U + 3U] = (uint8_t)(v >> 24);
+        if (v >> 24)
+        {
+            if (!have_rgb) { rgb = v & 0x00FFFFFFU; have_rgb = 1; }
+            else if ((v & 0x00FFFFFFU) != rgb) single = 0;
+        }
+        if (out->colors <= ICON_CODEC_MAX_COLORS)
+        {
+            for (c = 0U; (c < out->colors) && (out->clut[c] != v); c++) {}
+            if (c == out->colors)
+            {
+                if (out->colors < ICON_CODEC_MAX_COLORS) out->clut[c] = v;
+                out->colors++;
+            }
+            index[i] = (uint8_t)c;
+        }
+    }
+    BufPut(&cand[ICON_FMT_ARGB8888], argb, n * 4U);
+    cost[ICON_FMT_ARGB8888] = n * 4U;
+    if (single)
+    {
+        for (uint32_t i = 0U; i < n; i++) BufPut(&cand[ICON_FMT_A8], &argb[i * 4U + 3U], 1U);
+        cost[ICON_FMT_A8] = n;
+        out->color = rgb;
+    }
+    if (out->colors <= ICON_CODEC_MAX_COLORS)
+    {
+        BufPut(&cand[ICON_FMT_L8], index, n);
+        cost[ICON_FMT_L8] = n + out->colors * 4U;
+        for (uint16_t y = 0U; y < h; y++) EncodeRle(&cand[ICON_FMT_RLE8], &index[(uint32_t)y * w], w, 1U);
+        cost[ICON_FMT_RLE8] = cand[ICON_FMT_RLE8].size + out->colors * 4U;
+    }
+    for (uint16_t y = 0U; y < h; y++) EncodeRle(&cand[ICON_FMT_RLE32], &argb[(uint32_t)y * w * 4U], w, 4U);
+    cost[ICON_FMT_RLE32] = cand[ICON_FMT_RLE32].size;
+
+    out->format = ICON_FMT_ARGB8888;
+    for (uint32_t k = 0U; k < ICON_FMT_COUNT; k++)
+    {
+        if (cost[order[k]] < cost[out->format]) out->format = order[k];
+    }
+    if ((out->format != ICON_FMT_L8) && (out->format != ICON_FMT_RLE8)) out->colors = 0U;
+    out->data = cand[out->format].data;
+    out->size = cand[out->format].size;
+    for (uint32_t f = 0U; f < ICON_FMT_COUNT; f++)
+    {
+        if (f != out->format) free(cand[f].data);
+    }
+    free(index);
+    free(argb);
+}
+/**
+ * @brief  pack rectangle p of img into images[], as a sprite with opacity
+ *         if all its pixels have the same alpha, sharing an equal image
+ */
+static void Place(Patch_t *p, const uint32_t *img)
+{
+    uint32_t n = (uint32_t)p->w * p->h;
+    uint32_t *pix = malloc(n * sizeof(uint32_t));
+    uint32_t a = img[(uint32_t)p->y * width + p->x] >> 24;
+    Packed_t *out = &images[image_count];
+
+    if (pix == NULL) { fprintf(stderr, "out of memory\n"); exit(2); }
+    for (uint32_t i = 0U; i < n; i++)
+    {
+        pix[i] = img[(uint32_t)(p->y + i / p->w) * width + p->x + i % p->w];
+        if ((pix[i] >> 24) != a) a = 0U;
+    }
+    p->alpha = 0xFFU;
+    if ((a != 0U) && (a != 0xFFU))
+    {
+        for (uint32_t i = 0U; i < n; i++) pix[i] |= 0xFF000000U;
+        p->alpha = (uint8_t)a;
+    }
+    Pack(out, pix, p->w, 0U, 0U, p->w, p->h);
+    free(pix);
+
+    p->image = (uint16_t)image_count;
+    p->shared = 0U;
+    for (uint32_t k = 0U; k < image_count; k++)
+    {
+        const Packed_t *q = &images[k];
+
+        if ((q->format != out->format) || (q->width != out->width) || (q->height != out->height) ||
+            (q->colors != out->colors) || (q->color != out->color) || (q->size != out->size) ||
+            memcmp(q->clut, out->clut, q->colors * 4U) || memcmp(q->data, out->data, q->size)) continue;
+        free(out->data);
+        p->image = (uint16_t)k;
+        p->shared = 1U;
+        return;
+    }
+    image_count++;
+}
+/**
+ * @brief  collect the changed rectangles of one frame
+ * @note   dirty tiles of a tile row are merged into runs, a run continues a
+ *         rectangle of the previous tile row with the same columns; every
+ *         rectangle is then shrunk to the bounding box of its changed pixels
+ * @retval number of rectangles, UINT32_MAX if MAX_PATCHES is exceeded
+ */
+static uint32_t Diff(const uint32_t *prev, const uint32_t *cur, uint16_t tile)
+{
+    uint16_t tx = (uint16_t)((width + tile - 1U) / tile);
+    uint16_t ty = (uint16_t)((height + tile - 1U) / tile);
+    uint8_t *dirty = calloc((size_t)tx * ty, 1U);
+    uint32_t first = patch_count;
+    uint32_t open_first = patch_count;      // rectangles ending on the previous tile row
+
+    for (uint32_t i = 0U; i < (uint32_t)width * height; i++)
+    {
+        if (prev[i] != cur[i]) dirty[(i / width / tile) * tx + (i % width) / tile] = 1U;
+    }
+
+    for (uint16_t r = 0U; r < ty; r++)
+    {
+        uint32_t row_first = patch_count;
+
+        for (uint16_t c = 0U; c < tx; )
+        {
+            uint16_t c1 = c;
+            uint32_t k;
+
+            if (!dirty[r * tx + c]) { c++; continue; }
+            while ((c1 < tx) && dirty[r * tx + c1]) c1++;
+            // continue a rectangle of the previous tile row with the same columns
+            for (k = open_first; k < row_first; k++)
+            {
+                if ((patches[k].x == c * tile) && (patches[k].w == (c1 - c) * tile) && ((patches[k].y + patches[k].h) == r * tile)) break;
+            }
+            if (k < row_first)
+            {
+                Patch_t moved = patches[k];
+                moved.h += tile;
+                memmove(&patches[k], &patches[k + 1U], (patch_count - k - 1U) * sizeof(Patch_t));
+                patches[patch_count - 1U] = moved;
+                row_first--;
+            }
+            else
+            {
+                if (patch_count >= MAX_PATCHES) { free(dirty); return UINT32_MAX; }
+                memset(&patches[patch_count], 0, sizeof(Patch_t));
+                patches[patch_count].x = (uint16_t)(c * tile);
+                patches[patch_count].y = (uint16_t)(r * tile);
+                patches[patch_count].w = (uint16_t)((c1 - c) * tile);
+                patches[patch_count].h = tile;
+                patch_count++;
+            }
+            c = c1;
+        }
+        open_first = row_first;
+    }
+    free(dirty);
+
+    for (uint32_t k = first; k < patch_count; k++)
+    {
+        Patch_t *p = &patches[k];
+        uint16_t x0 = UINT16_MAX, y0 = UINT16_MAX, x1 = 0U, y1 = 0U;
+
+        if ((p->x + p->w) > width) p->w = (uint16_t)(width - p->x);
+        if ((p->y + p->h) > height) p->h = (uint16_t)(height - p->y);
+        for (uint16_t y = p->y; y < (p->y + p->h); y++)
+        {
+            for (uint16_t x = p->x; x < (p->x + p->w); x++)
+            {
+                uint32_t i = (uint32_t)y * width + x;
+                if (prev[i] == cur[i]) continue;
+                if (x < x0) x0 = x;
+                if (x > x1) x1 = x;
+                if (y < y0) y0 = y;
+                if (y > y1) y1 = y;
+            }
+        }
+        p->x = x0;
+        p->y = y0;
+        p->w = (uint16_t)(x1 - x0 + 1U);
+        p->h = (uint16_t)(y1 - y0 + 1U);
+        Place(p, cur);
+    }
+    return patch_count - first;
+}
+
+static IconImage_t ToImage(const Packed_t *p)
+{
+    IconImage_t img = { p->format, p->colors, p->width, p->height, p->color, p->clut, p->data, p->size };
+    return img;
+}
+/**
+ * @brief  play the clip with the firmware decoder and compare every frame
+ * @retval 1 if keyframe, frames 1..n-1 and the loop to frame 0 are exact
+ */
+static int Verify(void)
+{
+    uint32_t n = (uint32_t)width * height;
+    uint32_t *canvas = calloc(n, sizeof(uint32_t));
+    IconImage_t *image = calloc(image_count, sizeof(IconImage_t));
+    AnimPatch_t *table = calloc(patch_count + 1U, sizeof(AnimPatch_t));
+    AnimClip_t clip;
+    int ok;
+
+    for (uint32_t i = 0U; i < image_count; i++) image[i] = ToImage(&images[i]);
+    for (uint32_t i = 0U; i < patch_count; i++)
+    {
+        table[i].x = patches[i].x;
+        table[i].y = patches[i].y;
+        table[i].alpha = patches[i].alpha;
+        table[i].image = &image[patches[i].image];
+    }
+    clip.width = width;
+    clip.height = height;
+    clip.frame_count = (uint16_t)frame_count;
+    clip.frame_ms = 1U;
+    clip.keyframe.x = 0U;
+    clip.keyframe.y = 0U;
+    clip.keyframe.alpha = keyframe.alpha;
+    clip.keyframe.image = &image[keyframe.image];
+    clip.frames = frame_table;
+    clip.patches = table;
+    clip.patch_count = (uint16_t)patch_count;
+
+    ok = AnimCodec_DecodeKeyframe(&clip, canvas) && !memcmp(canvas, frames[0], n * sizeof(uint32_t));
+    for (uint32_t k = 1U; ok && (k <= frame_count); k++)
+    {
+        uint32_t f = k % frame_count;
+        ok = AnimCodec_ApplyFrame(&clip, (uint16_t)f, canvas) && !memcmp(canvas, frames[f], n * sizeof(uint32_t));
+        if (!ok) fprintf(stderr, "frame %u differs\n", f);
+    }
+    free(table);
+    free(image);
+    free(canvas);
+    return ok;
+}
+
+static void WriteImage(FILE *f, const char *sym, const Packed_t *p)
+{
+    fprintf(f, "\n/* %ux%u, %s, %u bytes */\n", p->width, p->height, format_names[p->format], p->size + p->colors * 4U);
+    fprintf(f, "__attribute__((section(\".flash_rom\"), aligned(4)))\n");
+    fprintf(f, "static GUI_CONST_STORAGE unsigned char %s[] = {", sym);
+    for (uint32_t k = 0U; k < p->size; k++) fprintf(f, "%s0x%02X,", (k % 24U) ? " " : "\n    ", p->data[k]);
+    fprintf(f, "\n};\n");
+    if (p->colors)
+    {
+        fprintf(f, "\n__attribute__((section(\".flash_rom\")))\n");
+        fprintf(f, "static GUI_CONST_STORAGE uint32_t %s_clut[] = {", sym);
+        for (uint16_t k = 0U; k < p->colors; k++) fprintf(f, "%s0x%08X,", (k % 8U) ? " " : "\n    ", p->clut[k]);
+        fprintf(f, "\n};\n");
+    }
+    fprintf(f, "\nstatic GUI_CONST_STORAGE IconImage_t %s_image = {\n", sym);
+    fprintf(f, "    ICON_FMT_%s, %u, %u, %u, 0x%06X,\n", format_names[p->format], p->colors, p->width, p->height, p->color);
+    if (p->colors) fprintf(f, "    %s_clut,\n", sym);
+    else fprintf(f, "    NULL,\n");
+    fprintf(f, "    %s, sizeof(%s)\n};\n", sym, sym);
+}
+/**
+ * @brief  write the clip as C source
+ * @retval 0 on success
+ */
+static int WriteOutput(const char *path, const char *name, uint16_t frame_ms)
+{
+    const char *base = strrchr(path, '/');
+    char sym[MAX_NAME + 16U];
+    FILE *f = fopen(path, "w");
+
+    if (f == NULL) { perror(path); return 1; }
+    base = base ? (base + 1) : path;
+    fprintf(f, "/*********************************************************************\n");
+    fprintf(f, "* Generated by Tools/animconv, do not edit.\n");
+    fprintf(f, "* %s: %u frames %ux%u, %u ms per frame\n", base, frame_count, width, height, frame_ms);
+    fprintf(f, "*********************************************************************/\n\n");
+    fprintf(f, "#include <stdlib.h>\n#include \"Resource.h\"\n#include \"anim_codec.h\"\n");
+
+    for (uint32_t i = 0U; i < image_count; i++)
+    {
+        snprintf(sym, sizeof(sym), "%s_i%u", name, i);
+        WriteImage(f, sym, &images[i]);
+    }
+
+    fprintf(f, "\nstatic GUI_CONST_STORAGE AnimPatch_t %s_patches[] = {\n", name);
+    for (uint32_t i = 0U; i < patch_count; i++)
+    {
+        fprintf(f, "    { %u, %u, 0x%02X, &%s_i%u_image },\n", patches[i].x, patches[i].y, patches[i].alpha, name, patches[i].image);
+    }
+    if (patch_count == 0U) fprintf(f, "    { 0, 0, 0xFF, NULL },\n");
+    fprintf(f, "};\n");
+
+    fprintf(f, "\nstatic GUI_CONST_STORAGE AnimFrame_t %s_frames[] = {\n", name);
+    for (uint32_t k = 0U; k < frame_count; k++)
+    {
+        fprintf(f, "    { %u, %u },\n", frame_table[k].first, frame_table[k].count);
+    }
+    fprintf(f, "};\n");
+
+    fprintf(f, "\nGUI_CONST_STORAGE AnimClip_t %s = {\n", name);
+    fprintf(f, "    %u, %u, %u, %u,\n", width, height, frame_count, frame_ms);
+    fprintf(f, "    { 0, 0, 0x%02X, &%s_i%u_image },\n", keyframe.alpha, name, keyframe.image);
+    fprintf(f, "    %s_frames,\n    %s_patches,\n    %u\n};\n", name, name, patch_count);
+    fprintf(f, "\n/*************************** End of file ****************************/\n");
+    fclose(f);
+    return 0;
+}
+/************************ (C) COPYRIGHT JUBERA D.O.O Sarajevo ************************/
@@ -0,0 +1,456 @@
+/**
+ ******************************************************************************
+ * File Name          : iconconv.c
+ * Description        : host tool, packs emWin ARGB8888 bitmaps into compact
+ *                      icon formats (A8, L8, RLE8, RLE32)
+ ******************************************************************************
+ *
+ * Reads C files written by emWin Bitmap Converter and, for every
+ * GUI_DRAW_BMP8888 bitmap, picks the smallest lossless format from
+ * icon_codec.h. Every packed image is decoded again with the firmware
+ * decoder (IC/Src/icon_codec.c) and compared pixel by pixel before the
+ * output file is written. Files holding other bitmap formats are left out.
+ *
+ * Build (Linux):
+ *   gcc -O2 -I../../IC/Inc -o iconconv iconconv.c ../../IC/Src/icon_codec.c
+ *
+ * Usage:
+ *   iconconv [-o outdir] [-r report.txt] file.c ...
+ *
+ * Without -o only the report is produced. Output files keep the file and
+ * bitmap names, so they replace the originals in the IC project 1:1.
+ *
+ ******************************************************************************
+ */
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdint.h>
+#include "icon_codec.h"
+/* Private Define ------------------------------------------------------------*/
+#define MAX_BITMAPS     8U
+#define MAX_NAME        128U
+/* Private Typedef -----------------------------------------------------------*/
+typedef struct
+{
+    char      name[MAX_NAME];       // bitmap symbol, e.g. bmHome
+    char      array[MAX_NAME];      // pixel array symbol, e.g. _acHome
+    uint16_t  width;
+    uint16_t  height;
+    uint32_t *pixels;               // canonical ARGB8888, DMA2D alpha
+    uint8_t   format;               // chosen IconFormat_t
+    uint8_t  *data;                 // packed data
+    uint32_t  size;                 // packed data size
+    uint32_t  clut[ICON_CODEC_MAX_COLORS];
+    uint16_t  colors;
+    uint32_t  color;
+    int       roundtrip_ok;
+} Bitmap_t;
+
+typedef struct
+{
+    uint8_t  *data;
+    uint32_t  size;
+    uint32_t  cap;
+} Buffer_t;
+/* Private Variables ---------------------------------------------------------*/
+static const char *format_names[ICON_FMT_COUNT] = { "ARGB8888", "A8", "L8", "RLE8", "RLE32" };
+static uint64_t total_orig, total_packed;
+static uint32_t total_bitmaps, total_failed, total_skipped_files;
+static uint32_t total_per_format[ICON_FMT_COUNT];
+/* Private Function Prototype ------------------------------------------------*/
+static char *ReadFile(const char *path);
+static void StripComments(char *src);
+static int ParseFile(char *src, Bitmap_t *bm, uint32_t *count);
+static int ParseArray(const char *src, Bitmap_t *b);
+static void BufPut(Buffer_t *buf, const void *p, uint32_t n);
+static uint16_t BuildPalette(const Bitmap_t *b, uint32_t *clut, uint8_t *index);
+static void EncodeRle(Buffer_t *buf, const uint8_t *line, uint16_t width, uint8_t bytes);
+static void Pack(Bitmap_t *b);
+static int RoundTrip(const Bitmap_t *b);
+static int WriteOutput(const char *outdir, const char *path, Bitmap_t *bm, uint32_t count);
+/* Program Code  -------------------------------------------------------------*/
+int main(int argc, char **argv)
+{
+    const char *outdir = NULL;
+    FILE *report = stdout;
+    int argi = 1;
+
+    while ((argi < argc) && (argv[argi][0] == '-'))
+    {
+        if (!strcmp(argv[argi], "-o") && ((argi + 1) < argc)) outdir = argv[++argi];
+        else if (!strcmp(argv[argi], "-r") && ((argi + 1) < argc))
+        {
+            report = fopen(argv[++argi], "w");
+            if (report == NULL) { perror(argv[argi]); return 2; }
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [-o outdir] [-r report.txt] file.c ...\n", argv[0]);
+            return 2;
+        }
+        argi++;
+    }
+
+    fprintf(report, "%-40s %-28s %9s %-8s %9s %6s %s\n", "file", "bitmap", "orig", "format", "packed", "ratio", "roundtrip");
+    for (; argi < argc; argi++)
+    {
+        Bitmap_t bm[MAX_BITMAPS];
+        uint32_t count = 0U;
+        const char *base = strrchr(argv[argi], '/');
+        char *src = ReadFile(argv[argi]);
+        int file_ok = 1;
+
+        base = base ? (base + 1) : argv[argi];
+        memset(bm, 0, sizeof(bm));
+        if ((src == NULL) || ParseFile(src, bm, &count) || (count == 0U))
+        {
+            fprintf(report, "%-40s skipped (no ARGB8888 bitmap or other bitmap formats)\n", base);
+            total_skipped_files++;
+            free(src);
+            continue;
+        }
+        for (uint32_t i = 0U; i < count; i++)
+        {
+            uint32_t orig = (uint32_t)bm[i].width * bm[i].height * 4U;
+            Pack(&bm[i]);
+            bm[i].roundtrip_ok = RoundTrip(&bm[i]);
+            file_ok &= bm[i].roundtrip_ok;
+            fprintf(report, "%-40s %-28s %9u %-8s %9u %5.1f%% %s\n", base, bm[i].name, orig, format_names[bm[i].format],
+                    bm[i].size + bm[i].colors * 4U, 100.0 * (bm[i].size + bm[i].colors * 4U) / orig, bm[i].roundtrip_ok ? "ok" : "FAIL");
+            total_bitmaps++;
+            total_orig += orig;
+            total_packed += bm[i].size + bm[i].colors * 4U;
+            total_per_format[bm[i].format]++;
+            if (!bm[i].roundtrip_ok) total_failed++;
+        }
+        if (outdir != NULL)
+        {
+            if (!file_ok) fprintf(report, "%-40s not written, round trip failed\n", base);
+            else if (WriteOutput(outdir, base, bm, count)) total_failed++;
+        }
+        for (uint32_t i = 0U; i < count; i++)
+        {
+            free(bm[i].pixels);
+            free(bm[i].data);
+        }
+        free(src);
+    }
+
+    fprintf(report, "\nbitmaps: %u, files skipped: %u, round trip failures: %u\n", total_bitmaps, total_skipped_files, total_failed);
+    fprintf(report, "formats:");
+    for (uint32_t f = 0U; f < ICON_FMT_COUNT; f++) fprintf(report, " %s=%u", format_names[f], total_per_format[f]);
+    fprintf(report, "\nsize: %llu -> %llu bytes (%.1f%%)\n", (unsigned long long)total_orig, (unsigned long long)total_packed,
+            total_orig ? ((100.0 * (double)total_packed) / (double)total_orig) : 0.0);
+    if (report != stdout) fclose(report);
+    return total_failed ? 1 : 0;
+}
+/**
+ * @brief  read whole file into zero terminated buffer
+ */
+static char *ReadFile(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    char *buf;
+    long len;
+
+    if (f == NULL) return NULL;
+    fseek(f, 0, SEEK_END);
+    len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    buf = malloc((size_t)len + 1U);
+    if ((buf != NULL) && (fread(buf, 1U, (size_t)len, f) == (size_t)len)) buf[len] = '\0';
+    else { free(buf); buf = NULL; }
+    fclose(f);
+    return buf;
+}
+/**
+ * @brief  replace C comments with spaces (converter output has no strings with comment markers)
+ */
+static void StripComments(char *src)
+{
+    char *p = src;
+
+    while (*p)
+    {
+        if ((p[0] == '/') && (p[1] == '/'))
+        {
+            while (*p && (*p != '\n')) *p++ = ' ';
+        }
+        else if ((p[0] == '/') && (p[1] == '*'))
+        {
+            while (*p && !((p[0] == '*') && (p[1] == '/'))) *p++ = ' ';
+            if (*p) { p[0] = ' '; p[1] = ' '; p += 2; }
+        }
+        else p++;
+    }
+}
+/**
+ * @brief  find all GUI_BITMAP definitions of a file and load ARGB8888 pixels
+ * @retval 0 if all bitmaps are GUI_DRAW_BMP8888 and arrays are valid
+ */
+static int ParseFile(char *src, Bitmap_t *bm, uint32_t *count)
+{
+    char *p = src;
+
+    StripComments(src);
+    while ((p = strstr(p, "GUI_BITMAP")) != NULL)
+    {
+        Bitmap_t *b = &bm[*count];
+        unsigned x, y, bpl, bpp;
+        char methods[MAX_NAME];
+
+        p += strlen("GUI_BITMAP");
+        if (!isspace((unsigned char)*p)) continue;
+        if (sscanf(p, " %127[A-Za-z0-9_] = { %u , %u , %u , %u , ( unsigned char * ) %127[A-Za-z0-9_] , NULL , %127[A-Za-z0-9_]",
+                   b->name, &x, &y, &bpl, &bpp, b->array, methods) != 7)
+        {
+            // Format "(unsigned char*)" without space before '*'
+            if (sscanf(p, " %127[A-Za-z0-9_] = { %u , %u , %u , %u , ( unsigned char* ) %127[A-Za-z0-9_] , NULL , %127[A-Za-z0-9_]",
+                       b->name, &x, &y, &bpl, &bpp, b->array, methods) != 7) continue;
+        }
+        if (strcmp(methods, "GUI_DRAW_BMP8888") || (bpp != 32U) || (bpl != x * 4U)) return 1;
+        if (*count >= MAX_BITMAPS) return 1;
+        b->width = (uint16_t)x;
+        b->height = (uint16_t)y;
+        if (ParseArray(src, b)) return 1;
+        (*count)++;
+    }
+    return 0;
+}
+/**
+ * @brief  parse pixel array of a bitmap, convert emWin ARGB (alpha 0 = opaque)
+ *         to canonical DMA2D ARGB (alpha 0xFF = opaque, transparent = 0)
+ */
+static int ParseArray(const char *src, Bitmap_t *b)
+{
+    const char *p = src;
+    size_t len = strlen(b->array);
+    uint32_t n = (uint32_t)b->width * b->height;
+    uint32_t i = 0U;
+
+    for (;;)
+    {
+        p = strstr(p, b->array);
+        if (p == NULL) return 1;
+        if (((p == src) || !(isalnum((unsigned char)p[-1]) || (p[-1] == '_'))) && (p[len] == '['))
+        {
+            p = strchr(p, '{');
+            break;
+        }
+        p += len;
+    }
+    if (p == NULL) return 1;
+    b->pixels = malloc(n * sizeof(uint32_t));
+    p++;
+    while ((i < n) && *p && (*p != '}'))
+    {
+        char *end;
+        unsigned long v;
+
+        while (*p && (isspace((unsigned char)*p) || (*p == ','))) p++;
+        if (*p == '}') break;
+        v = strtoul(p, &end, 0);
+        if (end == p) return 1;
+        p = end;
+        uint32_t a = 0xFFU - (uint32_t)(v >> 24);
+        b->pixels[i++] = (a == 0U) ? 0U : ((a << 24) | ((uint32_t)v & 0x00FFFFFFU));
+    }
+    return (i == n) ? 0 : 1;
+}
+
+static void BufPut(Buffer_t *buf, const void *p, uint32_t n)
+{
+    if ((buf->size + n) > buf->cap)
+    {
+        buf->cap = (buf->size + n) * 2U + 64U;
+        buf->data = realloc(buf->data, buf->cap);
+    }
+    memcpy(buf->data + buf->size, p, n);
+    buf->size += n;
+}
+/**
+ * @brief  build palette of unique colors
+ * @retval number of colors, 0 if more than ICON_CODEC_MAX_COLORS
+ */
+static uint16_t BuildPalette(const Bitmap_t *b, uint32_t *clut, uint8_t *index)
+{
+    uint32_t n = (uint32_t)b->width * b->height;
+    uint16_t colors = 0U;
+
+    for (uint32_t i = 0U; i < n; i++)
+    {
+        uint16_t c;
+        for (c = 0U; (c < colors) && (clut[c] != b->pixels[i]); c++) {}
+        if (c == colors)
+        {
+            if (colors >= ICON_CODEC_MAX_COLORS) return 0U;
+            clut[colors++] = b->pixels[i];
+        }
+        index[i] = (uint8_t)c;
+    }
+    return colors;
+}
+/**
+ * @brief  encode one line in format described in icon_codec.h
+ */
+static void EncodeRle(Buffer_t *buf, const uint8_t *line, uint16_t width, uint8_t bytes)
+{
+    // a repeat block pays off from 2 equal 32 bit pixels, or 3 equal indices
+    const uint16_t min_run = (bytes == 4U) ? 2U : 3U;
+    uint16_t x = 0U;
+
+    while (x < width)
+    {
+        uint16_t run = 1U;
+        while (((x + run) < width) && (run < 129U) && !memcmp(&line[(x + run) * bytes], &line[x * bytes], bytes)) run++;
+        if (run >= min_run)
+        {
+            uint8_t c = (uint8_t)(0x7EU + run);
+            BufPut(buf, &c, 1U);
+            BufPut(buf, &line[x * bytes], bytes);
+            x += run;
+            continue;
+        }
+        // literal block until next worthwhile run
+        uint16_t lit = 0U;
+        while (((x + lit) < width) && (lit < 128U))
+        {
+            uint16_t r = 1U;
+            while (((x + lit + r) < width) && (r < min_run) && !memcmp(&line[(x + lit + r) * bytes], &line[(x + lit) * bytes], bytes)) r++;
+            if (r >= min_run) break;
+            lit++;
+        }
+        uint8_t c = (uint8_t)(lit - 1U);
+        BufPut(buf, &c, 1U);
+        BufPut(buf, &line[x * bytes], (uint32_t)lit * bytes);
+        x += lit;
+    }
+}
+/**
+ * @brief  try all formats, keep the smallest; on equal size direct formats
+ *         (A8, L8, ARGB8888) win because DMA2D reads them without decoding
+ */
+static void Pack(Bitmap_t *b)
+{
+    uint32_t n = (uint32_t)b->width * b->height;
+    uint8_t *index = malloc(n);
+    uint8_t *argb = malloc(n * 4U);
+    uint32_t rgb = 0U;
+    int single = 1, have_rgb = 0;
+    Buffer_t cand[ICON_FMT_COUNT];
+    uint32_t cost[ICON_FMT_COUNT];
+    static const uint8_t order[ICON_FMT_COUNT] = { ICON_FMT_A8, ICON_FMT_L8, ICON_FMT_ARGB8888, ICON_FMT_RLE8, ICON_FMT_RLE32 };
+
+    memset(cand, 0, sizeof(cand));
+    for (uint32_t f = 0U; f < ICON_FMT_COUNT; f++) cost[f] = UINT32_MAX;
+    for (uint32_t i = 0U; i < n; i++)
+    {
+        uint32_t v = b->pixels[i];
+        argb[i * 4U + 0U] = (uint8_t)v;
+        argb[i * 4U + 1U] = (uint8_t)(v >> 8);
+        argb[i * 4U + 2U] = (uint8_t)(v >> 16);
+        argb[i * 4U + 3U] = (uint8_t)(v >> 24);
+        if (v >> 24)
+        {
+            if (!have_rgb) { rgb = v & 0x00FFFFFFU; have_rgb = 1; }
+            else if ((v & 0x00FFFFFFU) != rgb) single = 0;
+        }
+    }
+    BufPut(&cand[ICON_FMT_ARGB8888], argb, n * 4U);
+    cost[ICON_FMT_ARGB8888] = n * 4U;
+    if (single)
+    {
+        for (uint32_t i = 0U; i < n; i++) BufPut(&cand[ICON_FMT_A8], &argb[i * 4U + 3U], 1U);
+        cost[ICON_FMT_A8] = n;
+        b->color = rgb;
+    }
+    b->colors = BuildPalette(b, b->clut, index);
+    if (b->colors != 0U)
+    {
+        BufPut(&cand[ICON_FMT_L8], index, n);
+        cost[ICON_FMT_L8] = n + b->colors * 4U;
+        for (uint16_t y = 0U; y < b->height; y++) EncodeRle(&cand[ICON_FMT_RLE8], &index[y * b->width], b->width, 1U);
+        cost[ICON_FMT_RLE8] = cand[ICON_FMT_RLE8].size + b->colors * 4U;
+    }
+    for (uint16_t y = 0U; y < b->height; y++) EncodeRle(&cand[ICON_FMT_RLE32], &argb[(uint32_t)y * b->width * 4U], b->width, 4U);
+    cost[ICON_FMT_RLE32] = cand[ICON_FMT_RLE32].size;
+
+    b->format = ICON_FMT_ARGB8888;
+    for (uint32_t k = 0U; k < ICON_FMT_COUNT; k++)
+    {
+        if (cost[order[k]] < cost[b->format]) b->format = order[k];
+    }
+    if ((b->format != ICON_FMT_L8) && (b->format != ICON_FMT_RLE8)) b->colors = 0U;
+    b->data = cand[b->format].data;
+    b->size = cand[b->format].size;
+    for (uint32_t f = 0U; f < ICON_FMT_COUNT; f++)
+    {
+        if (f != b->format) free(cand[f].data);
+    }
+    free(index);
+    free(argb);
+}
+/**
+ * @brief  decode packed image with firmware decoder and compare with source
+ * @retval 1 if identical
+ */
+static int RoundTrip(const Bitmap_t *b)
+{
+    uint32_t n = (uint32_t)b->width * b->height;
+    uint32_t *out = calloc(n, sizeof(uint32_t));
+    IconImage_t img = { b->format, b->colors, b->width, b->height, b->color, b->clut, b->data, b->size };
+    int ok = IconCodec_Decode(&img, out) && !memcmp(out, b->pixels, n * sizeof(uint32_t));
+
+    free(out);
+    return ok;
+}
+/**
+ * @brief  write packed bitmaps of one source file
+ * @retval 0 on success
+ */
+static int WriteOutput(const char *outdir, const char *path, Bitmap_t *bm, uint32_t count)
+{
+    char name[1024];
+    FILE *f;
+
+    snprintf(name, sizeof(name), "%s/%s", outdir, path);
+    f = fopen(name, "w");
+    if (f == NULL) { perror(name); return 1; }
+    fprintf(f, "/*********************************************************************\n");
+    fprintf(f, "* Generated by Tools/iconconv from %s, do not edit.\n", path);
+    fprintf(f, "*********************************************************************/\n\n");
+    fprintf(f, "#include <stdlib.h>\n#include \"Resource.h\"\n#include \"LCDConf.h\"\n#include \"icon_codec.h\"\n");
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        Bitmap_t *b = &bm[i];
+        fprintf(f, "\n/* %ux%u, %s, %u bytes (ARGB8888: %u bytes) */\n", b->width, b->height, format_names[b->format],
+                b->size + b->colors * 4U, (uint32_t)b->width * b->height * 4U);
+        fprintf(f, "__attribute__((section(\".flash_rom\"), aligned(4)))\n");
+        fprintf(f, "static GUI_CONST_STORAGE unsigned char %s[] = {", b->array);
+        for (uint32_t k = 0U; k < b->size; k++) fprintf(f, "%s0x%02X,", (k % 24U) ? " " : "\n    ", b->data[k]);
+        fprintf(f, "\n};\n");
+        if (b->colors)
+        {
+            fprintf(f, "\n__attribute__((section(\".flash_rom\")))\n");
+            fprintf(f, "static GUI_CONST_STORAGE uint32_t %s_clut[] = {", b->array);
+            for (uint16_t k = 0U; k < b->colors; k++) fprintf(f, "%s0x%08X,", (k % 8U) ? " " : "\n    ", b->clut[k]);
+            fprintf(f, "\n};\n");
+        }
+        fprintf(f, "\nstatic GUI_CONST_STORAGE IconImage_t %s_image = {\n", b->array);
+        fprintf(f, "    ICON_FMT_%s, %u, %u, %u, 0x%06X,\n", format_names[b->format], b->colors, b->width, b->height, b->color);
+        if (b->colors) fprintf(f, "    %s_clut,\n", b->array);
+        else fprintf(f, "    NULL,\n");
+        fprintf(f, "    %s, sizeof(%s)\n};\n", b->array, b->array);
+        fprintf(f, "\nGUI_CONST_STORAGE GUI_BITMAP %s = {\n", b->name);
+        fprintf(f, "    %u, // xSize\n    %u, // ySize\n    %u, // BytesPerLine\n    32, // BitsPerPixel\n", b->width, b->height, b->width * 4U);
+        fprintf(f, "    (unsigned char *)&%s_image,  // Pointer to icon descriptor\n", b->array);
+        fprintf(f, "    NULL,  // Pointer to palette\n    GUI_DRAW_ICON\n};\n");
+    }
+    fprintf(f, "\n/*************************** End of file ****************************/\n");
+    fclose(f);
+    return 0;
+}
+/************************ (C) COPYRIGHT JUBERA D.O.O Sarajevo ************************/
@@ -0,0 +1,393 @@
+/**
+ ******************************************************************************
+ * File Name          : langpack.c
+ * Description        : host tool, validates the translation table and packs
+ *                      every language the way the firmware does (lang_pack.c)
+ ******************************************************************************
+ *
+ * Reads the TextID and Languages enums from display.h and the
+ * language_strings table from translations.h, then for every language:
+ *  - checks that the table has one row per TextID, in enum order (row
+ *    comments like  TXT_LIGHTS  must match the enum), with one string per
+ *    language and valid UTF-8 in each string,
+ *  - builds the RAM pack with the firmware packer (IC/Src/lang_pack.c)
+ *    and checks it fits LANG_PACK_POOL_SIZE,
+ *  - reports pool size, shared strings and the number of 32 byte cache
+ *    lines (Cortex-M7 D-cache) touched by reading every string of the
+ *    language from the interleaved table and from the pack,
+ *  - benchmarks lookups through the table and through the pack.
+ *
+ * Build (Linux):
+ *   gcc -O2 -I../../IC/Inc -o langpack langpack.c ../../IC/Src/lang_pack.c
+ *
+ * Usage:
+ *   langpack [-n lookups] display.h translations.h
+ *
+ * Exit code is 0 only if every row and every language is valid.
+ *
+ ******************************************************************************
+ */
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdint.h>
+#include <time.h>
+#include "lang_pack.h"
+/* Private Define ------------------------------------------------------------*/
+#define MAX_TEXTS       1024U
+#define MAX_LANGUAGES   32U
+#define MAX_NAME        64U
+#define CACHE_LINE      32U
+#define MAX_BLOB        (256U * 1024U)
+/* Private Typedef -----------------------------------------------------------*/
+typedef struct
+{
+    char     name[MAX_NAME];        // row comment, e.g. TXT_LIGHTS
+    uint32_t count;                 // strings in the row
+    char    *text[MAX_LANGUAGES];
+} Row_t;
+/* Private Variables ---------------------------------------------------------*/
+static char     text_ids[MAX_TEXTS][MAX_NAME];
+static uint32_t text_count;
+static char     languages[MAX_LANGUAGES][MAX_NAME];
+static uint32_t language_count;
+static Row_t    rows[MAX_TEXTS];
+static uint32_t row_count;
+static char     blob[MAX_BLOB];     // strings in row order, like the compiler emits them
+static uint32_t blob_used;
+static volatile uint32_t bench_sink;
+/* Private Function Prototype ------------------------------------------------*/
+static char *ReadFile(const char *path);
+static int ParseEnum(const char *src, const char *first, const char *last, char (*names)[MAX_NAME], uint32_t max, uint32_t *count);
+static int ParseTable(const char *src);
+static const char *SkipComment(const char *p, char *name);
+static const char *ParseString(const char *p, char *out, uint32_t *len);
+static uint32_t CountLines(const char *const *strings, uint32_t count);
+static double Bench(const char *const *table, const LangPack_t *pack, uint32_t language, uint32_t lookups);
+/* Program Code  -------------------------------------------------------------*/
+int main(int argc, char **argv)
+{
+    const char **table;
+    uint16_t *index;
+    char *display_src, *table_src, *pool;
+    uint32_t lookups = 1000000U, errors = 0U, max_used = 0U;
+    int argi = 1;
+
+    if ((argi + 1 < argc) && !strcmp(argv[argi], "-n"))
+    {
+        lookups = (uint32_t)strtoul(argv[argi + 1], NULL, 0);
+        argi += 2;
+    }
+    if ((argc - argi) != 2)
+    {
+        fprintf(stderr, "usage: %s [-n lookups] display.h translations.h\n", argv[0]);
+        return 2;
+    }
+    display_src = ReadFile(argv[argi]);
+    table_src = ReadFile(argv[argi + 1]);
+    if ((display_src == NULL) || (table_src == NULL))
+    {
+        fprintf(stderr, "can not read input files\n");
+        return 2;
+    }
+    if (ParseEnum(display_src, "TXT_DUMMY", "TEXT_COUNT", text_ids, MAX_TEXTS, &text_count) ||
+        ParseEnum(display_src, "BSHC", "LANGUAGE_COUNT", languages, MAX_LANGUAGES, &language_count))
+    {
+        fprintf(stderr, "TextID or Languages enum not found in %s\n", argv[argi]);
+        return 2;
+    }
+    if (ParseTable(table_src))
+    {
+        fprintf(stderr, "language_strings table not found in %s\n", argv[argi + 1]);
+        return 2;
+    }
+
+    //
+    // Table shape: one row per TextID, in enum order, one string per language
+    //
+    if (row_count != text_count)
+    {
+        printf("ERROR: table has %u rows, TextID has %u entries\n", row_count, text_count);
+        errors++;
+    }
+    for (uint32_t i = 0U; (i < row_count) && (i < text_count); i++)
+    {
+        if (rows[i].name[0] && strcmp(rows[i].name, text_ids[i]))
+        {
+            printf("ERROR: row %u is commented %s, enum has %s\n", i, rows[i].name, text_ids[i]);
+            errors++;
+        }
+        if (rows[i].count != language_count)
+        {
+            printf("ERROR: row %u (%s) has %u strings, %u languages\n", i, text_ids[i], rows[i].count, language_count);
+            errors++;
+        }
+    }
+    if (errors)
+    {
+        printf("%u error(s), languages not packed\n", errors);
+        return 1;
+    }
+
+    //
+    // Flat [text][language] table like the firmware array
+    //
+    table = calloc((size_t)text_count * language_count, sizeof(char *));
+    index = calloc(text_count, sizeof(uint16_t));
+    pool = malloc(LANG_PACK_POOL_SIZE);
+    if ((table == NULL) || (index == NULL) || (pool == NULL)) return 2;
+    for (uint32_t t = 0U; t < text_count; t++)
+    {
+        for (uint32_t l = 0U; l < language_count; l++) table[t * language_count + l] = rows[t].text[l];
+    }
+
+    printf("%u texts, %u languages, pool %u bytes\n\n", text_count, language_count, LANG_PACK_POOL_SIZE);
+    printf("%-6s %6s %6s %6s %11s %11s %9s %9s\n", "lang", "pool", "shared", "index", "lines/table", "lines/pack", "ns/table", "ns/pack");
+    for (uint32_t l = 0U; l < language_count; l++)
+    {
+        LangPack_t pack;
+        LangPackStatus_t status;
+        const char *column[MAX_TEXTS];
+        const char *packed[MAX_TEXTS];
+
+        LangPack_Init(&pack, pool, LANG_PACK_POOL_SIZE, index, (uint16_t)text_count);
+        status = LangPack_Build(&pack, table, (uint8_t)language_count, (uint8_t)l);
+        if (status != LANG_PACK_OK)
+        {
+            static const char *reason[] = { "ok", "argument", "NULL string", "invalid UTF-8", "pool overflow" };
+            printf("%-6s ERROR: %s at %s\n", languages[l], reason[status], text_ids[pack.error_text]);
+            errors++;
+            continue;
+        }
+        for (uint32_t t = 0U; t < text_count; t++)
+        {
+            column[t] = table[t * language_count + l];
+            packed[t] = LangPack_Get(&pack, (uint16_t)t);
+            if (strcmp(column[t], packed[t]))
+            {
+                printf("%-6s ERROR: %s differs after packing\n", languages[l], text_ids[t]);
+                errors++;
+            }
+        }
+        if (pack.used > max_used) max_used = pack.used;
+        printf("%-6s %6u %6u %6u %11u %11u %9.2f %9.2f\n", languages[l], pack.used, pack.duplicates, text_count * 2U,
+               CountLines(column, text_count), CountLines(packed, text_count),
+               Bench(table, NULL, l, lookups), Bench(table, &pack, l, lookups));
+    }
+    printf("\nlargest pack %u of %u bytes (%.1f%%), %u error(s)\n", max_used, LANG_PACK_POOL_SIZE,
+           100.0 * max_used / LANG_PACK_POOL_SIZE, errors);
+    return errors ? 1 : 0;
+}
+
+static char *ReadFile(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    char *buf;
+    long len;
+
+    if (f == NULL) return NULL;
+    fseek(f, 0, SEEK_END);
+    len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    buf = malloc((size_t)len + 1U);
+    if ((buf != NULL) && (fread(buf, 1U, (size_t)len, f) == (size_t)len)) buf[len] = '\0';
+    else { free(buf); buf = NULL; }
+    fclose(f);
+    return buf;
+}
+/**
+ * @brief  read enum member names from `first` up to (not including) `last`
+ * @note   members with an explicit value other than the first one are
+ *         rejected, because the table index would no longer be the position
+ */
+static int ParseEnum(const char *src, const char *first, const char *last, char (*names)[MAX_NAME], uint32_t max, uint32_t *count)
+{
+    const char *p = strstr(src, first);
+
+    *count = 0U;
+    if (p == NULL) return 1;
+    while (*p)
+    {
+        char name[MAX_NAME];
+        uint32_t n = 0U;
+
+        p = SkipComment(p, NULL);
+        if (isalpha((unsigned char)*p) || (*p == '_'))
+        {
+            while ((isalnum((unsigned char)*p) || (*p == '_')) && (n < (MAX_NAME - 1U))) name[n++] = *p++;
+            name[n] = '\0';
+            if (!strcmp(name, last)) return 0;
+            if (*count >= max) return 1;
+            strcpy(names[(*count)++], name);
+            p = SkipComment(p, NULL);
+            if ((*p == '=') && (*count > 1U)) return 1;
+            while (*p && (*p != ',') && (*p != '}')) p++;
+            if (*p == '}') return 1;
+        }
+        if (*p) p++;
+    }
+    return 1;
+}
+/**
+ * @brief  parse rows of  language_strings[TEXT_COUNT][LANGUAGE_COUNT] = { ... };
+ */
+static int ParseTable(const char *src)
+{
+    const char *p = strstr(src, "language_strings[TEXT_COUNT][LANGUAGE_COUNT]");
+    char name[MAX_NAME] = "";
+    int depth = 0;
+
+    if ((p == NULL) || ((p = strchr(p, '{')) == NULL)) return 1;
+    while (*p)
+    {
+        const char *next = SkipComment(p, name);
+        if (next != p) { p = next; continue; }
+
+        if (*p == '{')
+        {
+            if (++depth == 2)
+            {
+                if (row_count >= MAX_TEXTS) return 1;
+                strcpy(rows[row_count].name, name);
+                name[0] = '\0';
+            }
+            p++;
+        }
+        else if (*p == '}')
+        {
+            if (depth == 2) row_count++;
+            if (--depth == 0) return 0;
+            p++;
+        }
+        else if ((*p == '"') && (depth == 2))
+        {
+            Row_t *row = &rows[row_count];
+            char *out = &blob[blob_used];
+            uint32_t len = 0U;
+
+            if ((blob_used + strlen(p)) >= MAX_BLOB) return 1;
+            // adjacent literals form one string
+            do
+            {
+                p = ParseString(p, out, &len);
+                p = SkipComment(p, NULL);
+            }
+            while (*p == '"');
+            blob_used += len + 1U;
+            if (row->count < MAX_LANGUAGES) row->text[row->count] = out;
+            row->count++;
+        }
+        else p++;
+    }
+    return 1;
+}
+/**
+ * @brief  skip white space and comments; a comment holding only a TXT_
+ *         identifier is stored in `name` (row label)
+ */
+static const char *SkipComment(const char *p, char *name)
+{
+    for (;;)
+    {
+        while (isspace((unsigned char)*p)) p++;
+        if ((p[0] == '/') && (p[1] == '/'))
+        {
+            while (*p && (*p != '\n')) p++;
+        }
+        else if ((p[0] == '/') && (p[1] == '*'))
+        {
+            const char *end = strstr(p + 2, "*/");
+            char label[MAX_NAME];
+
+            if (end == NULL) return p + strlen(p);
+            if ((name != NULL) && (sscanf(p + 2, " %63[A-Za-z0-9_]", label) == 1) && !strncmp(label, "TXT_", 4U))
+            {
+                strcpy(name, label);
+            }
+            p = end + 2;
+        }
+        else return p;
+    }
+}
+/**
+ * @brief  parse one C string literal at `p` and append it to `out`
+ */
+static const char *ParseString(const char *p, char *out, uint32_t *len)
+{
+    p++;
+    while (*p && (*p != '"'))
+    {
+        if (*p != '\\') { out[(*len)++] = *p++; continue; }
+        p++;
+        switch (*p)
+        {
+        case 'n': out[(*len)++] = '\n'; p++; break;
+        case 't': out[(*len)++] = '\t'; p++; break;
+        case 'r': out[(*len)++] = '\r'; p++; break;
+        case 'x':
+        {
+            unsigned v = 0U;
+            p++;
+            while (isxdigit((unsigned char)*p)) { v = (v << 4) | (unsigned)(isdigit((unsigned char)*p) ? (*p - '0') : ((tolower((unsigned char)*p) - 'a') + 10)); p++; }
+            out[(*len)++] = (char)v;
+            break;
+        }
+        default:
+            if ((*p >= '0') && (*p <= '7'))
+            {
+                unsigned v = 0U;
+                for (int i = 0; (i < 3) && (*p >= '0') && (*p <= '7'); i++) v = (v << 3) | (unsigned)(*p++ - '0');
+                out[(*len)++] = (char)v;
+            }
+            else if (*p) out[(*len)++] = *p++;
+            break;
+        }
+    }
+    out[*len] = '\0';
+    return *p ? (p + 1) : p;
+}
+/**
+ * @brief  cache lines touched by reading every string of a language
+ * @note   table strings sit in `blob` in row order, all languages
+ *         interleaved, like the compiler emits them
+ */
+static uint32_t CountLines(const char *const *strings, uint32_t count)
+{
+    uintptr_t lines[MAX_TEXTS * 8U];
+    uint32_t used = 0U, unique = 0U;
+
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        uintptr_t first = (uintptr_t)strings[i] / CACHE_LINE;
+        uintptr_t last = ((uintptr_t)strings[i] + strlen(strings[i])) / CACHE_LINE;
+        for (uintptr_t l = first; (l <= last) && (used < (MAX_TEXTS * 8U)); l++) lines[used++] = l;
+    }
+    for (uint32_t i = 0U; i < used; i++)
+    {
+        uint32_t j;
+        for (j = 0U; (j < i) && (lines[j] != lines[i]); j++) {}
+        if (j == i) unique++;
+    }
+    return unique;
+}
+/**
+ * @brief  ns per lookup of a pseudo random text id (strlen touches the string)
+ */
+static double Bench(const char *const *table, const LangPack_t *pack, uint32_t language, uint32_t lookups)
+{
+    uint32_t seed = 12345U, sum = 0U;
+    clock_t start = clock();
+
+    for (uint32_t i = 0U; i < lookups; i++)
+    {
+        uint16_t id;
+        seed = seed * 1103515245U + 12345U;
+        id = (uint16_t)((seed >> 16) % text_count);
+        sum += (uint32_t)strlen(pack ? LangPack_Get(pack, id) : table[id * language_count + language]);
+    }
+    bench_sink = sum;
+    return lookups ? (1e9 * (double)(clock() - start) / CLOCKS_PER_SEC / lookups) : 0.0;
+}
+/************************ (C) COPYRIGHT JUBERA D.O.O Sarajevo ************************/
@@ -0,0 +1,806 @@
+/**
+ ******************************************************************************
+ * File Name          : rview.c
+ * Description        : host tool, remote view of a panel screen over RS485
+ *                      (remote_view.h) and bytes per frame benchmark
+ ******************************************************************************
+ *
+ * Viewer: polls the panel with REMOTE_VIEW queries (rs485.c) on a serial
+ * RS485 adapter, reassembles the tile stream and writes every completed
+ * frame to a PPM file (written to a temporary name and renamed, so an
+ * image viewer that reloads the file never sees half a frame). The
+ * stream is read by position: a query whose response was lost is sent
+ * again with the same position and returns the same bytes. Frames use
+ * the TinyFrame layout of Middlewares/TinyFrame/TF_Config.h (SOF 0x01,
+ * ID 1 byte, LEN 2, TYPE 1, CRC16 0xA001 of header and of data, numbers
+ * MSB first); the tool is the TF_SLAVE peer. The stream can be saved
+ * with -w and decoded again later with -r. The panel answers only if
+ * remote view is allowed in its alarm settings, and stops the stream
+ * while a PIN or password screen is shown; the viewer waits and retries.
+ *
+ * Benchmark (-b): drives the firmware module (IC/Src/remote_view.c) with
+ * synthetic 480x272 screens built from emWin ARGB8888 bitmaps (C files
+ * written by emWin Bitmap Converter, e.g. IC/Src/Display/icons_*.c or
+ * the animation frames): keyframe, an unchanged screen, an icon toggle,
+ * a clock update, the bitmaps played as an animation and a change of
+ * the whole page. For every scenario it reports bytes and tiles per
+ * frame, the time to send the frame at the firmware rate limit and the
+ * host time of RemoteView_Service(). Every frame is decoded back and
+ * compared with the composed screen.
+ *
+ * Build (Linux):
+ *   gcc -O2 -I../../IC/Inc -o rview rview.c ../../IC/Src/remote_view.c
+ *
+ * Usage:
+ *   rview -d /dev/ttyUSB0 -a addr [-o view.ppm] [-w capture.bin] [-k]
+ *   rview -r capture.bin [-o view.ppm]
+ *   rview -b [-R rate] bitmap.c ...
+ *
+ * -k asks for a full frame every 10 s (the viewer reconnects by itself
+ * if the panel restarts the stream).
+ *
+ ******************************************************************************
+ */
+/* Includes ------------------------------------------------------------------*/
+#define _DEFAULT_SOURCE                 /* usleep, cfmakeraw, CRTSCTS with -std=c11 */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdint.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <poll.h>
+#include <termios.h>
+#include "remote_view.h"
+/* Private Define ------------------------------------------------------------*/
+#define SCREEN_W        480U
+#define SCREEN_H        272U
+#define MAX_BITMAPS     64U
+#define MAX_NAME        128U
+#define MAX_STREAM      (64U * 1024U)
+
+#define TF_SOF          0x01U
+#define TF_HEAD_BYTES   7U          // SOF, ID, LEN (2), TYPE, header CRC (2)
+#define TF_TYPE_VIEW    57U         // REMOTE_VIEW in Middlewares/LuxNET/LuxNET.h
+#define TF_MAX_PAYLOAD  1024U
+
+#define VIEW_CMD_READ   0U          // commands and status of rs485.c
+#define VIEW_CMD_START  1U
+#define VIEW_CMD_STOP   2U
+#define VIEW_CMD_KEY    3U
+#define VIEW_OK         0U
+#define VIEW_OFF        1U
+#define VIEW_BAD_POS    2U
+#define VIEW_BUSY       3U
+#define VIEW_DENIED     4U
+
+#define POLL_TIMEOUT_MS 300
+#define KEY_PERIOD_MS   10000U
+#define PANEL_RATE      2048U       // REMOTE_VIEW_RATE in display.c
+#define PANEL_INTERVAL  250U        // REMOTE_VIEW_INTERVAL_MS in display.c
+/* Private Typedef -----------------------------------------------------------*/
+typedef struct
+{
+    uint32_t *pixels;               // canonical ARGB, alpha 0xFF = opaque
+    uint16_t  w;
+    uint16_t  h;
+} Bitmap_t;
+
+typedef struct
+{
+    uint8_t   data[MAX_STREAM];     // bytes not yet parsed
+    uint32_t  len;
+    uint16_t  width;
+    uint16_t  height;
+    uint16_t  image[SCREEN_W * SCREEN_H];
+    uint32_t  frames;
+    uint32_t  tiles;
+} Stream_t;
+
+typedef struct
+{
+    uint8_t   buf[TF_HEAD_BYTES + TF_MAX_PAYLOAD + 2U];
+    uint32_t  pos;
+    uint32_t  need;
+} Frame_t;
+/* Private Variables ---------------------------------------------------------*/
+static Bitmap_t bitmaps[MAX_BITMAPS];
+static uint32_t bitmap_count;
+static uint16_t layer0[SCREEN_W * SCREEN_H];
+static uint32_t layer1[SCREEN_W * SCREEN_H];
+static uint32_t bench_ms;
+static Stream_t stream;
+static const char *ppm_path;
+/* Private Function Prototype ------------------------------------------------*/
+static char *ReadFile(const char *path);
+static void StripComments(char *src);
+static uint32_t *ParseBitmap(char *src, uint16_t *w, uint16_t *h);
+static uint16_t Crc16(uint16_t crc, const uint8_t *p, uint32_t n);
+static uint32_t FrameCompose(uint8_t *out, uint8_t id, const uint8_t *data, uint16_t len);
+static int FrameAccept(Frame_t *f, uint8_t b);
+static uint32_t NowMs(void);
+static int SerialOpen(const char *dev);
+static int Query(int fd, Frame_t *f, uint8_t id, uint8_t cmd, uint8_t addr, uint32_t pos);
+static int Viewer(const char *dev, uint8_t addr, FILE *capture, int key_period);
+static int Replay(const char *path);
+static void StreamReset(Stream_t *s);
+static int StreamPut(Stream_t *s, const uint8_t *p, uint32_t n, void (*on_frame)(const Stream_t *s, uint16_t seq));
+static void WritePpm(const Stream_t *s, uint16_t seq);
+static uint16_t Blend(uint16_t c0, uint32_t c1);
+static void DrawBitmap(const Bitmap_t *b, int x0, int y0);
+static void FillLayer1(int x0, int y0, int w, int h, uint32_t c);
+static void DrawText(int x0, int y0, int w, int h, uint32_t seed);
+static const uint16_t *BenchBase(void);
+static const uint32_t *BenchOverlay(void);
+static uint32_t BenchFlips(void);
+static uint32_t BenchMs(void);
+static void BenchFrame(RemoteView_t *rv, const char *name, uint32_t rate, uint32_t *bytes_out);
+static int Bench(uint32_t rate);
+/* Program Code  -------------------------------------------------------------*/
+int main(int argc, char **argv)
+{
+    const char *dev = NULL, *capture_path = NULL, *replay_path = NULL;
+    uint32_t rate = PANEL_RATE;
+    int argi = 1, addr = -1, bench = 0, key_period = 0;
+
+    while ((argi < argc) && (argv[argi][0] == '-'))
+    {
+        if (!strcmp(argv[argi], "-d") && ((argi + 1) < argc)) dev = argv[++argi];
+        else if (!strcmp(argv[argi], "-a") && ((argi + 1) < argc)) addr = (int)strtol(argv[++argi], NULL, 0);
+        else if (!strcmp(argv[argi], "-o") && ((argi + 1) < argc)) ppm_path = argv[++argi];
+        else if (!strcmp(argv[argi], "-w") && ((argi + 1) < argc)) capture_path = argv[++argi];
+        else if (!strcmp(argv[argi], "-r") && ((argi + 1) < argc)) replay_path = argv[++argi];
+        else if (!strcmp(argv[argi], "-R") && ((argi + 1) < argc)) rate = (uint32_t)strtoul(argv[++argi], NULL, 0);
+        else if (!strcmp(argv[argi], "-k")) key_period = 1;
+        else if (!strcmp(argv[argi], "-b")) bench = 1;
+        else break;
+        argi++;
+    }
+
+    if (bench)
+    {
+        for (; argi < argc; argi++)
+        {
+            Bitmap_t *b;
+            char *src;
+
+            if (bitmap_count >= MAX_BITMAPS) break;
+            b = &bitmaps[bitmap_count];
+            src = ReadFile(argv[argi]);
+            b->pixels = (src != NULL) ? ParseBitmap(src, &b->w, &b->h) : NULL;
+            free(src);
+            if ((b->pixels == NULL) || (b->w > SCREEN_W) || (b->h > SCREEN_H))
+            {
+                fprintf(stderr, "%s: no ARGB8888 bitmap up to %ux%u\n", argv[argi], SCREEN_W, SCREEN_H);
+                return 2;
+            }
+            bitmap_count++;
+        }
+        if ((bitmap_count < 2U) || (rate == 0U))
+        {
+            fprintf(stderr, "usage: %s -b [-R rate] bitmap.c bitmap.c ...\n", argv[0]);
+            return 2;
+        }
+        return Bench(rate);
+    }
+    if (replay_path != NULL) return Replay(replay_path);
+    if ((dev == NULL) || (addr < 0) || (addr > 255) || (argi != argc))
+    {
+        fprintf(stderr, "usage: %s -d /dev/ttyUSB0 -a addr [-o view.ppm] [-w capture.bin] [-k]\n"
+                        "       %s -r capture.bin [-o view.ppm]\n"
+                        "       %s -b [-R rate] bitmap.c ...\n", argv[0], argv[0], argv[0]);
+        return 2;
+    }
+    if (capture_path != NULL)
+    {
+        FILE *capture = fopen(capture_path, "wb");
+        int ret;
+
+        if (capture == NULL) { perror(capture_path); return 2; }
+        ret = Viewer(dev, (uint8_t)addr, capture, key_period);
+        fclose(capture);
+        return ret;
+    }
+    return Viewer(dev, (uint8_t)addr, NULL, key_period);
+}
+/**
+ * @brief  read whole file into zero terminated buffer
+ */
+static char *ReadFile(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    char *buf;
+    long len;
+
+    if (f == NULL) return NULL;
+    fseek(f, 0, SEEK_END);
+    len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    buf = malloc((size_t)len + 1U);
+    if ((buf != NULL) && (fread(buf, 1U, (size_t)len, f) == (size_t)len)) buf[len] = '\0';
+    else { free(buf); buf = NULL; }
+    fclose(f);
+    return buf;
+}
+/**
+ * @brief  replace C comments with spaces (converter output has no strings with comment markers)
+ */
+static void StripComments(char *src)
+{
+    char *p = src;
+
+    while (*p)
+    {
+        if ((p[0] == '/') && (p[1] == '/'))
+        {
+            while (*p && (*p != '\n')) *p++ = ' ';
+        }
+        else if ((p[0] == '/') && (p[1] == '*'))
+        {
+            while (*p && !((p[0] == '*') && (p[1] == '/'))) *p++ = ' ';
+            if (*p) { p[0] = ' '; p[1] = ' '; p += 2; }
+        }
+        else p++;
+    }
+}
+/**
+ * @brief  load the first ARGB8888 bitmap of a file as canonical ARGB
+ *         (alpha 0xFF = opaque, transparent = 0), same as animconv
+ * @retval pixels or NULL
+ */
+static uint32_t *ParseBitmap(char *src, uint16_t *w, uint16_t *h)
+{
+    char name[MAX_NAME], array[MAX_NAME], methods[MAX_NAME];
+    unsigned x, y, bpl, bpp;
+    const char *p = src;
+    uint32_t *pixels;
+    uint32_t n, i = 0U;
+    size_t len;
+
+    StripComments(src);
+    for (;;)
+    {
+        p = strstr(p, "GUI_BITMAP");
+        if (p == NULL) return NULL;
+        p += strlen("GUI_BITMAP");
+        if (!isspace((unsigned char)*p)) continue;
+        if (sscanf(p, " %127[A-Za-z0-9_] = { %u , %u , %u , %u , ( unsigned char * ) %127[A-Za-z0-9_] , NULL , %127[A-Za-z0-9_]",
+                   name, &x, &y, &bpl, &bpp, array, methods) == 7) break;
+        if (sscanf(p, " %127[A-Za-z0-9_] = { %u , %u , %u , %u , ( unsigned char* ) %127[A-Za-z0-9_] , NULL , %127[A-Za-z0-9_]",
+                   name, &x, &y, &bpl, &bpp, array, methods) == 7) break;
+    }
+    if (strcmp(methods, "GUI_DRAW_BMP8888") || (bpp != 32U) || (bpl != x * 4U) || (x == 0U) || (y == 0U) || (x > 0xFFFFU) || (y > 0xFFFFU)) return NULL;
+
+    len = strlen(array);
+    p = src;
+    for (;;)
+    {
+        p = strstr(p, array);
+        if (p == NULL) return NULL;
+        if (((p == src) || !(isalnum((unsigned char)p[-1]) || (p[-1] == '_'))) && (p[len] == '['))
+        {
+            p = strchr(p, '{');
+            break;
+        }
+        p += len;
+    }
+    if (p == NULL) return NULL;
+
+    n = x * y;
+    pixels = malloc(n * sizeof(uint32_t));
+    p++;
+    while ((i < n) && *p && (*p != '}'))
+    {
+        char *end;
+        unsigned long v;
+
+        while (*p && (isspace((unsigned char)*p) || (*p == ','))) p++;
+        if (*p == '}') break;
+        v = strtoul(p, &end, 0);
+        if (end == p) break;
+        p = end;
+        uint32_t a = 0xFFU - (uint32_t)(v >> 24);
+        pixels[i++] = (a == 0U) ? 0U : ((a << 24) | ((uint32_t)v & 0x00FFFFFFU));
+    }
+    if (i != n) { free(pixels); return NULL; }
+    *w = (uint16_t)x;
+    *h = (uint16_t)y;
+    return pixels;
+}
+/**
+ * @brief  TinyFrame CRC16 (polynomial 0x8005 reflected, initial value 0)
+ */
+static uint16_t Crc16(uint16_t crc, const uint8_t *p, uint32_t n)
+{
+    while (n--)
+    {
+        crc ^= *p++;
+        for (uint8_t k = 0U; k < 8U; k++) crc = (crc & 1U) ? (uint16_t)((crc >> 1) ^ 0xA001U) : (uint16_t)(crc >> 1);
+    }
+    return crc;
+}
+/**
+ * @brief  build one TF_TYPE_VIEW frame
+ * @retval frame length
+ */
+static uint32_t FrameCompose(uint8_t *out, uint8_t id, const uint8_t *data, uint16_t len)
+{
+    uint16_t crc;
+    uint32_t n = 0U;
+
+    out[n++] = TF_SOF;
+    out[n++] = id;
+    out[n++] = (uint8_t)(len >> 8);
+    out[n++] = (uint8_t)len;
+    out[n++] = TF_TYPE_VIEW;
+    crc = Crc16(0U, out, n);
+    out[n++] = (uint8_t)(crc >> 8);
+    out[n++] = (uint8_t)crc;
+    if (len != 0U)
+    {
+        memcpy(&out[n], data, len);
+        n += len;
+        crc = Crc16(0U, data, len);
+        out[n++] = (uint8_t)(crc >> 8);
+        out[n++] = (uint8_t)crc;
+    }
+    return n;
+}
+/**
+ * @brief  feed one received byte to the frame parser
+ * @retval 1 when f->buf holds a complete frame with valid checksums
+ */
+static int FrameAccept(Frame_t *f, uint8_t b)
+{
+    uint16_t len;
+
+    if ((f->pos == 0U) && (b != TF_SOF)) return 0;
+    f->buf[f->pos++] = b;
+    if (f->pos == TF_HEAD_BYTES)
+    {
+        len = (uint16_t)((f->buf[2] << 8) | f->buf[3]);
+        if ((Crc16(0U, f->buf, 5U) != (uint16_t)((f->buf[5] << 8) | f->buf[6])) || (len > TF_MAX_PAYLOAD))
+        {
+            f->pos = 0U;
+            return 0;
+        }
+        f->need = TF_HEAD_BYTES + ((len != 0U) ? (len + 2U) : 0U);
+    }
+    if ((f->pos < TF_HEAD_BYTES) || (f->pos < f->need)) return 0;
+
+    f->pos = 0U;
+    len = (uint16_t)((f->buf[2] << 8) | f->buf[3]);
+    if ((len != 0U) && (Crc16(0U, &f->buf[TF_HEAD_BYTES], len) !=
+                        (uint16_t)((f->buf[TF_HEAD_BYTES + len] << 8) | f->buf[TF_HEAD_BYTES + len + 1U]))) return 0;
+    return 1;
+}
+
+static uint32_t NowMs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000U + (uint64_t)ts.tv_nsec / 1000000U);
+}
+/**
+ * @brief  open the RS485 adapter raw, 115200 8N1 (USART1 in the firmware)
+ */
+static int SerialOpen(const char *dev)
+{
+    struct termios tio;
+    int fd = open(dev, O_RDWR | O_NOCTTY);
+
+    if (fd < 0) return -1;
+    if (tcgetattr(fd, &tio) != 0) { close(fd); return -1; }
+    cfmakeraw(&tio);
+    cfsetispeed(&tio, B115200);
+    cfsetospeed(&tio, B115200);
+    tio.c_cflag |= CLOCAL | CREAD;
+    tio.c_cflag &= ~(CSTOPB | CRTSCTS);
+    tio.c_cc[VMIN] = 0;
+    tio.c_cc[VTIME] = 0;
+    if (tcsetattr(fd, TCSANOW, &tio) != 0) { close(fd); return -1; }
+    tcflush(fd, TCIOFLUSH);
+    return fd;
+}
+/**
+ * @brief  send a REMOTE_VIEW query and wait for the response with the same ID
+ * @retval payload length in f->buf + TF_HEAD_BYTES, -1 on timeout
+ */
+static int Query(int fd, Frame_t *f, uint8_t id, uint8_t cmd, uint8_t addr, uint32_t pos)
+{
+    uint8_t req[6], out[TF_HEAD_BYTES + sizeof(req) + 2U], rx[256];
+    uint32_t start = NowMs();
+
+    req[0] = cmd;
+    req[1] = addr;
+    req[2] = (uint8_t)(pos >> 24);
+    req[3] = (uint8_t)(pos >> 16);
+    req[4] = (uint8_t)(pos >> 8);
+    req[5] = (uint8_t)pos;
+    if (write(fd, out, FrameCompose(out, id, req, sizeof(req))) < 0) return -1;
+    f->pos = 0U;
+
+    while ((NowMs() - start) < (uint32_t)POLL_TIMEOUT_MS)
+    {
+        struct pollfd pfd = { fd, POLLIN, 0 };
+        ssize_t n;
+
+        if (poll(&pfd, 1, 20) <= 0) continue;
+        n = read(fd, rx, sizeof(rx));
+        for (ssize_t i = 0; i < n; i++)
+        {
+            if (!FrameAccept(f, rx[i])) continue;
+            // Other traffic on the bus has other IDs or types.
+            if ((f->buf[1] != id) || (f->buf[4] != TF_TYPE_VIEW)) continue;
+            return (int)((f->buf[2] << 8) | f->buf[3]);
+        }
+    }
+    return -1;
+}
+/**
+ * @brief  poll the panel, reassemble frames, write them to the PPM file
+ */
+static int Viewer(const char *dev, uint8_t addr, FILE *capture, int key_period)
+{
+    static Frame_t frame;
+    uint32_t pos = 0U, retries = 0U, key_ms = NowMs();
+    uint8_t id = 0U, cmd = VIEW_CMD_START;
+    bool denied = false;
+    int fd = SerialOpen(dev);
+
+    if (fd < 0) { perror(dev); return 2; }
+    StreamReset(&stream);
+    for (;;)
+    {
+        const uint8_t *resp;
+        int len = Query(fd, &frame, id, cmd, addr, pos);
+        uint32_t n;
+
+        if (len < 6)
+        {
+            // Lost query or response: the same position is asked again.
+            if (++retries == 10U) fprintf(stderr, "panel %u does not answer\n", addr);
+            continue;
+        }
+        retries = 0U;
+        id = (uint8_t)((id + 1U) & 0x7FU);
+        resp = &frame.buf[TF_HEAD_BYTES];
+        n = (uint32_t)len - 6U;
+
+        if ((resp[1] == VIEW_OFF) || (resp[1] == VIEW_BAD_POS))
+        {
+            fprintf(stderr, "stream %s, restarting\n", (resp[1] == VIEW_OFF) ? "off" : "lost");
+            cmd = VIEW_CMD_START;
+            continue;
+        }
+        if (resp[1] == VIEW_DENIED)
+        {
+            // Not allowed in the panel settings, or a PIN/password screen is shown.
+            if (!denied) fprintf(stderr, "view denied by panel, waiting\n");
+            denied = true;
+            cmd = VIEW_CMD_START;
+            sleep(1);
+            continue;
+        }
+        denied = false;
+        if (cmd == VIEW_CMD_START)
+        {
+            pos = 0U;
+            StreamReset(&stream);
+        }
+        cmd = VIEW_CMD_READ;
+        if (resp[1] == VIEW_BUSY)
+        {
+            usleep(50000);
+            continue;
+        }
+        if (n == 0U)
+        {
+            usleep(20000);
+            continue;
+        }
+        if (capture != NULL) fwrite(&resp[6], 1U, n, capture);
+        pos += n;
+        if (!StreamPut(&stream, &resp[6], n, WritePpm))
+        {
+            fprintf(stderr, "bad record, restarting\n");
+            cmd = VIEW_CMD_START;
+        }
+        if (key_period && ((NowMs() - key_ms) >= KEY_PERIOD_MS))
+        {
+            key_ms = NowMs();
+            cmd = VIEW_CMD_KEY;
+        }
+    }
+    return 0;
+}
+/**
+ * @brief  decode a stream saved with -w
+ */
+static int Replay(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    uint8_t buf[4096];
+    size_t n;
+    int ok = 1;
+
+    if (f == NULL) { perror(path); return 2; }
+    StreamReset(&stream);
+    while (ok && ((n = fread(buf, 1U, sizeof(buf), f)) > 0U)) ok = StreamPut(&stream, buf, (uint32_t)n, WritePpm);
+    fclose(f);
+    printf("%u frames, %u tiles, %u bytes left%s\n", stream.frames, stream.tiles, stream.len, ok ? "" : ", BAD RECORD");
+    return ok ? 0 : 1;
+}
+
+static void StreamReset(Stream_t *s)
+{
+    s->len = 0U;
+    s->width = 0U;
+    s->height = 0U;
+}
+/**
+ * @brief  append stream bytes and apply every complete record
+ * @retval 0 on an invalid record
+ */
+static int StreamPut(Stream_t *s, const uint8_t *p, uint32_t n, void (*on_frame)(const Stream_t *s, uint16_t seq))
+{
+    uint32_t used = 0U;
+
+    if ((s->len + n) > sizeof(s->data)) return 0;
+    memcpy(&s->data[s->len], p, n);
+    s->len += n;
+
+    for (;;)
+    {
+        const uint8_t *r = &s->data[used];
+        uint32_t left = s->len - used;
+
+        if (left == 0U) break;
+        if (r[0] == REMOTE_VIEW_REC_FRAME)
+        {
+            if (left < REMOTE_VIEW_FRAME_BYTES) break;
+            s->width = (uint16_t)((r[4] << 8) | r[5]);
+            s->height = (uint16_t)((r[6] << 8) | r[7]);
+            if ((r[8] != REMOTE_VIEW_TILE) || (s->width > SCREEN_W) || (s->height > SCREEN_H)) return 0;
+            used += REMOTE_VIEW_FRAME_BYTES;
+        }
+        else if (r[0] == REMOTE_VIEW_REC_TILE)
+        {
+            uint16_t px[REMOTE_VIEW_TILE * REMOTE_VIEW_TILE];
+            uint16_t tiles_x, index, len, x0, y0, w, h;
+
+            if (left < REMOTE_VIEW_TILE_HEADER) break;
+            index = (uint16_t)((r[1] << 8) | r[2]);
+            len = (uint16_t)((r[3] << 8) | r[4]);
+            if (left < (REMOTE_VIEW_TILE_HEADER + (uint32_t)len)) break;
+            if (s->width == 0U) return 0;
+            tiles_x = (uint16_t)((s->width + REMOTE_VIEW_TILE - 1U) / REMOTE_VIEW_TILE);
+            x0 = (uint16_t)((index % tiles_x) * REMOTE_VIEW_TILE);
+            y0 = (uint16_t)((index / tiles_x) * REMOTE_VIEW_TILE);
+            if (y0 >= s->height) return 0;
+            w = (uint16_t)(s->width - x0);
+            h = (uint16_t)(s->height - y0);
+            if (w > REMOTE_VIEW_TILE) w = REMOTE_VIEW_TILE;
+            if (h > REMOTE_VIEW_TILE) h = REMOTE_VIEW_TILE;
+            if (RemoteView_DecodeTile(&r[REMOTE_VIEW_TILE_HEADER], len, px, (uint16_t)(w * h)) != len) return 0;
+            for (uint16_t y = 0U; y < h; y++) memcpy(&s->image[(y0 + y) * s->width + x0], &px[y * w], w * 2U);
+            s->tiles++;
+            used += REMOTE_VIEW_TILE_HEADER + len;
+        }
+        else if (r[0] == REMOTE_VIEW_REC_END)
+        {
+            if (left < REMOTE_VIEW_END_BYTES) break;
+            s->frames++;
+            if (on_frame != NULL) on_frame(s, (uint16_t)((r[1] << 8) | r[2]));
+            used += REMOTE_VIEW_END_BYTES;
+        }
+        else return 0;
+    }
+    memmove(s->data, &s->data[used], s->len - used);
+    s->len -= used;
+    return 1;
+}
+/**
+ * @brief  write the reassembled screen as binary PPM (via a temporary file)
+ */
+static void WritePpm(const Stream_t *s, uint16_t seq)
+{
+    char tmp[MAX_NAME + 8];
+    FILE *f;
+
+    printf("frame %u: %ux%u, %u tiles total\n", seq, s->width, s->height, s->tiles);
+    fflush(stdout);
+    if (ppm_path == NULL) return;
+    snprintf(tmp, sizeof(tmp), "%.*s.tmp", (int)MAX_NAME, ppm_path);
+    f = fopen(tmp, "wb");
+    if (f == NULL) { perror(tmp); return; }
+    fprintf(f, "P6\n%u %u\n255\n", s->width, s->height);
+    for (uint32_t i = 0U; i < (uint32_t)s->width * s->height; i++)
+    {
+        uint16_t c = s->image[i];
+        uint8_t rgb[3] = { (uint8_t)(((c >> 8) & 0xF8U) | (c >> 13)), (uint8_t)(((c >> 3) & 0xFCU) | ((c >> 9) & 0x03U)),
+                           (uint8_t)((((uint32_t)c << 3) & 0xF8U) | ((c >> 2) & 0x07U)) };
+
+        fwrite(rgb, 1U, sizeof(rgb), f);
+    }
+    fclose(f);
+    rename(tmp, ppm_path);
+}
+/**
+ * @brief  layer 1 pixel over layer 0 pixel, as the LTDC blends them
+ */
+static uint16_t Blend(uint16_t c0, uint32_t c1)
+{
+    uint32_t a = c1 >> 24, r = (c1 >> 16) & 0xFFU, g = (c1 >> 8) & 0xFFU, b = c1 & 0xFFU;
+
+    if (a == 0U) return c0;
+    if (a != 0xFFU)
+    {
+        uint32_t r0 = ((c0 >> 8) & 0xF8U) | (c0 >> 13);
+        uint32_t g0 = ((c0 >> 3) & 0xFCU) | ((c0 >> 9) & 0x03U);
+        uint32_t b0 = (((uint32_t)c0 << 3) & 0xF8U) | ((c0 >> 2) & 0x07U);
+
+        r = ((r * a) + (r0 * (255U - a)) + 127U) / 255U;
+        g = ((g * a) + (g0 * (255U - a)) + 127U) / 255U;
+        b = ((b * a) + (b0 * (255U - a)) + 127U) / 255U;
+    }
+    return (uint16_t)(((r & 0xF8U) << 8) | ((g & 0xFCU) << 3) | (b >> 3));
+}
+
+static void DrawBitmap(const Bitmap_t *b, int x0, int y0)
+{
+    for (int y = 0; y < b->h; y++)
+    {
+        for (int x = 0; x < b->w; x++)
+        {
+            if (((x0 + x) < 0) || ((x0 + x) >= (int)SCREEN_W) || ((y0 + y) < 0) || ((y0 + y) >= (int)SCREEN_H)) continue;
+            layer1[((uint32_t)(y0 + y) * SCREEN_W) + (uint32_t)(x0 + x)] = b->pixels[y * b->w + x];
+        }
+    }
+}
+
+static void FillLayer1(int x0, int y0, int w, int h, uint32_t c)
+{
+    for (int y = (y0 < 0) ? 0 : y0; (y < (y0 + h)) && (y < (int)SCREEN_H); y++)
+    {
+        for (int x = (x0 < 0) ? 0 : x0; (x < (x0 + w)) && (x < (int)SCREEN_W); x++) layer1[((uint32_t)y * SCREEN_W) + (uint32_t)x] = c;
+    }
+}
+/**
+ * @brief  anti-aliased looking text stand-in: vertical and horizontal strokes
+ *         of 2 px with a grey edge, one glyph per 12 px cell
+ */
+static void DrawText(int x0, int y0, int w, int h, uint32_t seed)
+{
+    FillLayer1(x0, y0, w, h, 0U);
+    for (int gx = x0; (gx + 12) <= (x0 + w); gx += 12)
+    {
+        seed = seed * 1103515245U + 12345U;
+        for (int k = 0; k < 5; k++)
+        {
+            uint32_t bits = seed >> (k * 5);
+            int sx = gx + 1 + (int)(bits % 8U);
+            int sy = y0 + 2 + (int)((bits >> 3) % (uint32_t)(h - 6));
+
+            if (bits & 0x10U) { FillLayer1(sx, y0 + 3, 2, h - 6, 0xFFFFFFFFU); FillLayer1(sx + 2, y0 + 3, 1, h - 6, 0x80FFFFFFU); }
+            else { FillLayer1(gx + 1, sy, 9, 2, 0xFFFFFFFFU); FillLayer1(gx + 1, sy + 2, 9, 1, 0x80FFFFFFU); }
+        }
+    }
+}
+
+static const uint16_t *BenchBase(void) { return layer0; }
+static const uint32_t *BenchOverlay(void) { return layer1; }
+static uint32_t BenchFlips(void) { return 0U; }
+static uint32_t BenchMs(void) { return bench_ms; }
+/**
+ * @brief  run one frame of the firmware module on the current layers,
+ *         decode it and compare with the composed screen
+ */
+static void BenchFrame(RemoteView_t *rv, const char *name, uint32_t rate, uint32_t *bytes_out)
+{
+    static uint8_t buf[REMOTE_VIEW_RING_SIZE];
+    uint32_t frames = rv->frames, tiles = rv->tiles, head = rv->head, pos = rv->head;
+    uint32_t bad = 0U, passes = 0U;
+    clock_t t0, cpu = 0;
+    int32_t n;
+
+    bench_ms += PANEL_INTERVAL;
+    do
+    {
+        t0 = clock();
+        RemoteView_Service(rv, 32U);
+        cpu += clock() - t0;
+        passes++;
+        while ((n = RemoteView_Read(rv, pos, buf, sizeof(buf))) > 0)
+        {
+            if (!StreamPut(&stream, buf, (uint32_t)n, NULL)) bad++;
+            pos += (uint32_t)n;
+        }
+        bench_ms += 100U;
+    } while (rv->in_frame);
+    RemoteView_Read(rv, pos, buf, 0U);
+
+    for (uint32_t i = 0U; i < SCREEN_W * SCREEN_H; i++)
+    {
+        if (stream.image[i] != Blend(layer0[i], layer1[i])) bad++;
+    }
+    printf("%-10s %7u %6u %9.2f %7u %10.0f %s\n", name, rv->head - head, rv->tiles - tiles,
+           (double)(rv->head - head) / rate, passes, 1e6 * (double)cpu / CLOCKS_PER_SEC,
+           bad ? "FAIL" : ((rv->frames != frames) ? "ok" : "ok, no frame"));
+    if (bytes_out != NULL) *bytes_out = rv->head - head;
+    if (bad) exit(1);
+}
+/**
+ * @brief  bytes per frame for typical screens
+ */
+static int Bench(uint32_t rate)
+{
+    static const RemoteViewOps_t ops = { BenchBase, BenchOverlay, BenchFlips, BenchMs };
+    static RemoteView_t rv;
+    const uint32_t cols = 4U, cell_w = SCREEN_W / cols, cell_h = 112U;
+    uint32_t icons = (bitmap_count < 8U) ? bitmap_count : 8U;
+    uint32_t sum = 0U, max = 0U, bytes;
+    char name[16];
+
+    // Bench Read must never be throttled; the rate only scales the time column.
+    RemoteView_Init(&rv, &ops, SCREEN_W, SCREEN_H, PANEL_INTERVAL, 1000000U);
+    StreamReset(&stream);
+    RemoteView_Start(&rv);
+    printf("%u bitmaps, tile %u, %u B/s, frame interval %u ms\n", bitmap_count, REMOTE_VIEW_TILE, rate, PANEL_INTERVAL);
+    printf("%-10s %7s %6s %9s %7s %10s\n", "scenario", "bytes", "tiles", "send [s]", "passes", "host [us]");
+
+    // Home screen: black background, grid of icons with captions, clock bar.
+    for (uint32_t i = 0U; i < icons; i++)
+    {
+        const Bitmap_t *b = &bitmaps[i];
+        int x = (int)((i % cols) * cell_w) + ((int)cell_w - b->w) / 2;
+        int y = 40 + (int)((i / cols) * cell_h);
+
+        DrawBitmap(b, x, y);
+        DrawText(x, y + b->h + 2, (b->w < 96U) ? 96 : b->w, 16, i);
+    }
+    DrawText(8, 6, 120, 24, 1000U);
+    BenchFrame(&rv, "key", rate, NULL);
+    BenchFrame(&rv, "unchanged", rate, NULL);
+
+    // Light switched: the first icon replaced by the next bitmap.
+    FillLayer1(((int)cell_w - bitmaps[0].w) / 2, 40, bitmaps[0].w, bitmaps[0].h, 0U);
+    DrawBitmap(&bitmaps[icons % bitmap_count], ((int)cell_w - bitmaps[icons % bitmap_count].w) / 2, 40);
+    BenchFrame(&rv, "toggle", rate, NULL);
+
+    DrawText(8, 6, 120, 24, 1001U);
+    BenchFrame(&rv, "clock", rate, NULL);
+
+    // Animation: the bitmaps one after another in the middle of the screen.
+    FillLayer1(0, 0, SCREEN_W, SCREEN_H, 0U);
+    BenchFrame(&rv, "clear", rate, NULL);
+    for (uint32_t i = 0U; i < bitmap_count; i++)
+    {
+        const Bitmap_t *b = &bitmaps[i];
+
+        FillLayer1(0, 0, SCREEN_W, SCREEN_H, 0U);
+        DrawBitmap(b, (int)(SCREEN_W - b->w) / 2, (int)(SCREEN_H - b->h) / 2);
+        snprintf(name, sizeof(name), "anim %u", i);
+        BenchFrame(&rv, name, rate, &bytes);
+        if (i != 0U)
+        {
+            sum += bytes;
+            if (bytes > max) max = bytes;
+        }
+    }
+
+    // Page change: new background on layer 0 (gradient), new content.
+    for (uint32_t y = 0U; y < SCREEN_H; y++)
+    {
+        for (uint32_t x = 0U; x < SCREEN_W; x++) layer0[y * SCREEN_W + x] = (uint16_t)((((y * 32U) / SCREEN_H) << 11) | (((x * 64U) / SCREEN_W) << 5) | 8U);
+    }
+    BenchFrame(&rv, "page", rate, NULL);
+
+    printf("\nanimation delta: avg %u, max %u bytes/frame, %.1f frames/s at %u B/s\n",
+           (bitmap_count > 1U) ? sum / (bitmap_count - 1U) : 0U, max,
+           (sum != 0U) ? ((double)rate * (bitmap_count - 1U) / sum) : 0.0, rate);
+    return 0;
+}
@@ -0,0 +1,585 @@
+/**
+ ******************************************************************************
+ * File Name          : rview_test.c
+ * Description        : host test, remote view tile diff decoded back and
+ *                      compared with the displayed frame
+ ******************************************************************************
+ *
+ * Checks the RLE of IC/Src/remote_view.c (round trip, worst case length,
+ * truncated and overlong data rejected) and then streams a session of
+ * screen changes the way the panel and rview run it: RemoteView_Service()
+ * with REMOTE_VIEW_TILES_PER_PASS tiles in every 10 ms main loop pass,
+ * the viewer reading VIEW_CHUNK_SIZE bytes by position, with one response
+ * in eight lost and asked for again, at REMOTE_VIEW_RATE.
+ *
+ * The screen is two double buffered layers (RGB565, ARGB8888 with opaque,
+ * translucent and transparent pixels); every change is drawn into the
+ * back buffers and flipped, also while a frame is being sent and once in
+ * the middle of reading a tile. The stream is parsed here from the
+ * record layout of remote_view.h, independent of rview.c. When a tile is
+ * visited the test composes it from the shown buffers as the LTDC blends
+ * them; after every END record the decoded picture has to equal those
+ * tiles exactly, so a tile missed by the diff or a torn tile that is not
+ * sent again shows up as a pixel difference. The viewer may be frames
+ * behind, so the composed picture is kept for each END until it is
+ * parsed. Tiles sent must have changed since they were last sent, except
+ * raw changes hidden under an opaque layer 1 pixel and the torn tile.
+ * For every change the test reports stream bytes, tiles and send time
+ * against sending the full frame.
+ *
+ * Build (Linux):
+ *   make -C Tools/tests rview_test
+ *
+ ******************************************************************************
+ */
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "remote_view.h"
+#include "host_test.h"
+/* Private Define ------------------------------------------------------------*/
+#define SCREEN_W            480U
+#define SCREEN_H            272U
+#define PIXELS              (SCREEN_W * SCREEN_H)
+#define TILES_X             ((SCREEN_W + REMOTE_VIEW_TILE - 1U) / REMOTE_VIEW_TILE)
+#define TILES               (TILES_X * ((SCREEN_H + REMOTE_VIEW_TILE - 1U) / REMOTE_VIEW_TILE))
+#define INTERVAL_MS         250U            /* REMOTE_VIEW_INTERVAL_MS */
+#define RATE                2048U           /* REMOTE_VIEW_RATE */
+#define TILES_PER_PASS      32U             /* REMOTE_VIEW_TILES_PER_PASS */
+#define CHUNK               112U            /* VIEW_CHUNK_SIZE in rs485.c */
+#define PASS_MS             10U
+#define MIN_PASSES          ((2U * INTERVAL_MS) / PASS_MS)
+#define STREAM_MAX          (REMOTE_VIEW_TILE_HEADER + REMOTE_VIEW_TILE_MAX_RLE + CHUNK)
+#define SHOTS               8U              /* frames the viewer can lag behind */
+#define CHANGES             (sizeof(changes) / sizeof(changes[0]))
+/* Private Type --------------------------------------------------------------*/
+typedef enum
+{
+    CHANGE_NONE,
+    CHANGE_CLOCK,                           /* digits on layer 1 */
+    CHANGE_ICON,                            /* opaque icon with a translucent edge */
+    CHANGE_SLIDER,                          /* translucent bar moved */
+    CHANGE_HIDDEN,                          /* layer 0 under opaque layer 1 */
+    CHANGE_ANIMATION,                       /* flips during the frame */
+    CHANGE_TORN,                            /* flip while a tile is read */
+    CHANGE_PAGE,                            /* both layers */
+} ChangeKind_t;
+
+typedef struct
+{
+    const char  *name;
+    ChangeKind_t kind;
+} Change_t;
+
+typedef struct
+{
+    uint8_t  data[STREAM_MAX];              /* bytes not parsed yet */
+    uint32_t len;
+    uint32_t pos;                           /* next stream position to ask for */
+    bool     in_frame;
+    bool     key;
+    uint16_t seq;
+    uint32_t frames, tiles, same, bad;
+    uint16_t image[PIXELS];
+} Viewer_t;
+/* Private Variable ----------------------------------------------------------*/
+static const Change_t changes[] =
+{
+    { "key",        CHANGE_NONE },
+    { "unchanged",  CHANGE_NONE },
+    { "clock",      CHANGE_CLOCK },
+    { "icon",       CHANGE_ICON },
+    { "slider",     CHANGE_SLIDER },
+    { "hidden",     CHANGE_HIDDEN },
+    { "animation",  CHANGE_ANIMATION },
+    { "torn tile",  CHANGE_TORN },
+    { "page",       CHANGE_PAGE },
+    { "unchanged",  CHANGE_NONE },
+};
+static uint16_t layer0[2][PIXELS];
+static uint32_t layer1[2][PIXELS];
+static uint8_t shown;
+static uint32_t flip_count, now_ms;
+static uint16_t expected[PIXELS];           /* tiles as composed when visited */
+static uint16_t shots[SHOTS][PIXELS];       /* `expected` at the END of frame seq % SHOTS */
+static uint16_t last_sent[PIXELS];          /* composed tiles as last sent */
+static int32_t tear_at = -1;                /* tile whose read a flip interrupts */
+static RemoteView_t rv;
+static Viewer_t viewer;
+static uint32_t rng;
+/* Private Function Prototype ------------------------------------------------*/
+static const uint16_t *Base(void);
+static const uint32_t *Overlay(void);
+static uint32_t Flips(void);
+static uint32_t Ms(void);
+static uint16_t Blend(uint16_t c0, uint32_t c1);
+static void ComposeTile(uint16_t index, uint16_t *out);
+static void TileOf(const uint16_t *image, uint16_t index, uint16_t *out);
+static void Flip(void);
+static void Draw(ChangeKind_t kind, uint32_t step);
+static void Fill0(uint32_t x0, uint32_t y0, uint32_t w, uint32_t h, uint16_t c);
+static void Fill1(uint32_t x0, uint32_t y0, uint32_t w, uint32_t h, uint32_t c);
+static void Page(uint32_t seed);
+static uint32_t FullFrameBytes(void);
+static void Pass(void);
+static int Parse(Viewer_t *v);
+static uint32_t Random(void);
+/* Program Code --------------------------------------------------------------*/
+int main(void)
+{
+    static const RemoteViewOps_t ops = { Base, Overlay, Flips, Ms };
+    uint16_t px[REMOTE_VIEW_TILE * REMOTE_VIEW_TILE], back[REMOTE_VIEW_TILE * REMOTE_VIEW_TILE];
+    uint8_t rle[REMOTE_VIEW_TILE_MAX_RLE + 4U];
+    uint32_t n;
+    char buf[256];
+
+    rng = 0x3C6EF372U;
+
+    // RLE: runs, literals and mixes of both.
+    for (uint32_t round = 0U; round < 4000U; round++)
+    {
+        uint16_t count = (uint16_t)(1U + (Random() % (REMOTE_VIEW_TILE * REMOTE_VIEW_TILE)));
+        uint32_t colors = 1U + (round % 7U) * (round % 7U) * 40U;
+
+        for (uint16_t i = 0U; i < count; i++)
+        {
+            if ((i != 0U) && ((Random() % 4U) != 0U) && ((round % 3U) == 0U)) px[i] = px[i - 1U];
+            else px[i] = (uint16_t)(Random() % colors);
+        }
+        n = RemoteView_EncodeTile(px, count, rle);
+        CHECK(n <= REMOTE_VIEW_TILE_MAX_RLE);
+        memset(back, 0xA5, sizeof(back));
+        CHECK(RemoteView_DecodeTile(rle, n, back, count) == n);
+        CHECK(memcmp(back, px, count * sizeof(uint16_t)) == 0);
+        CHECK(RemoteView_DecodeTile(rle, n - 1U, back, count) == 0U);
+        if (count > 1U) CHECK(RemoteView_DecodeTile(rle, n, back, (uint16_t)(count - 1U)) != n);
+    }
+    for (uint16_t i = 0U; i < (REMOTE_VIEW_TILE * REMOTE_VIEW_TILE); i++) px[i] = (uint16_t)(i * 7919U);
+    CHECK(RemoteView_EncodeTile(px, REMOTE_VIEW_TILE * REMOTE_VIEW_TILE, rle) == REMOTE_VIEW_TILE_MAX_RLE);
+    for (uint16_t i = 0U; i < (REMOTE_VIEW_TILE * REMOTE_VIEW_TILE); i++) px[i] = 0x1234U;
+    CHECK(RemoteView_EncodeTile(px, REMOTE_VIEW_TILE * REMOTE_VIEW_TILE, rle) == 6U);
+
+    // Session.
+    Page(1U);
+    Flip();
+    RemoteView_Init(&rv, &ops, SCREEN_W, SCREEN_H, INTERVAL_MS, RATE);
+    RemoteView_Start(&rv);
+    printf("%-10s %7s %6s %7s %6s %5s %10s %6s\n", "change", "bytes", "tiles", "changed", "send s", "torn",
+           "full frame", "saved");
+    for (uint32_t c = 0U; c < CHANGES; c++)
+    {
+        uint32_t head = rv.head, tiles = rv.tiles, torn = rv.torn, same = viewer.same, frames = rv.frames;
+        uint32_t full, changed = 0U, step = 0U;
+
+        // The interval runs out, then the change is drawn and flipped.
+        now_ms += INTERVAL_MS;
+        Draw(changes[c].kind, step++);
+        for (uint16_t t = 0U; t < TILES; t++)
+        {
+            ComposeTile(t, px);
+            TileOf(last_sent, t, back);
+            if (memcmp(px, back, sizeof(px)) != 0) changed++;
+        }
+        full = FullFrameBytes();
+
+        // Until the viewer has everything and no frame is being scanned;
+        // the animation flips only while the first frame is scanned.
+        for (uint32_t pass = 0U; (pass < MIN_PASSES) || rv.in_frame || (viewer.pos != rv.head); pass++)
+        {
+            if ((changes[c].kind == CHANGE_ANIMATION) && rv.in_frame && (rv.frames == frames))
+                Draw(CHANGE_ANIMATION, step++);
+            Pass();
+        }
+
+        printf("%-10s %7u %6u %7u %6.1f %5u %10u %5u%%\n", changes[c].name, rv.head - head, rv.tiles - tiles, changed,
+               (double)(rv.head - head) / RATE, rv.torn - torn, full,
+               (full != 0U) ? (100U - ((100U * (rv.head - head)) / full)) : 0U);
+        switch (changes[c].kind)
+        {
+        case CHANGE_NONE:
+            if (c == 0U) CHECK((rv.tiles - tiles) == TILES);
+            else CHECK(rv.head == head);
+            break;
+        case CHANGE_HIDDEN:
+            // Raw pixels changed under the opaque panel: sent, but the same picture.
+            CHECK((changed == 0U) && ((rv.tiles - tiles) != 0U) && ((viewer.same - same) == (rv.tiles - tiles)));
+            break;
+        case CHANGE_ANIMATION:
+            CHECK((rv.tiles - tiles) >= changed);
+            break;
+        case CHANGE_TORN:
+            // The torn tile goes again in the next frame although it did not change.
+            CHECK(((rv.torn - torn) == 1U) && ((viewer.same - same) == 1U));
+            break;
+        case CHANGE_PAGE:
+            // Both layers are redrawn; raw changes under the opaque panel come along unchanged.
+            CHECK((rv.tiles - tiles) == (changed + (viewer.same - same)));
+            break;
+        default:
+            // Without flips during the frame exactly the changed tiles are sent.
+            CHECK((rv.tiles - tiles) == changed);
+            break;
+        }
+        if ((changes[c].kind != CHANGE_HIDDEN) && (changes[c].kind != CHANGE_TORN) && (changes[c].kind != CHANGE_PAGE))
+            CHECK(viewer.same == same);
+    }
+    CHECK((viewer.bad == 0U) && (viewer.frames == rv.frames) && (viewer.tiles == rv.tiles));
+    CHECK(memcmp(viewer.image, expected, sizeof(expected)) == 0);
+    CHECK((rv.stalls != 0U) && (rv.throttled != 0U) && (rv.torn == 1U));
+
+    n = RemoteView_Report(&rv, buf, sizeof(buf));
+    CHECK((n == strlen(buf)) && (strstr(buf, "remote view on, 30x17 tiles") != NULL));
+    fputs(buf, stdout);
+
+    return HOST_TEST_END("rview_test");
+}
+
+/**
+ * @brief  Shown layer 0; the tile being visited is composed here, before
+ *         the module reads it.
+ */
+static const uint16_t *Base(void)
+{
+    uint16_t index = rv.next_tile;
+    uint16_t px[REMOTE_VIEW_TILE * REMOTE_VIEW_TILE];
+    uint32_t x0 = (index % TILES_X) * REMOTE_VIEW_TILE, y0 = (index / TILES_X) * REMOTE_VIEW_TILE;
+
+    ComposeTile(index, px);
+    for (uint32_t y = 0U; (y < REMOTE_VIEW_TILE) && ((y0 + y) < SCREEN_H); y++)
+    {
+        memcpy(&expected[(y0 + y) * SCREEN_W + x0], &px[y * REMOTE_VIEW_TILE], REMOTE_VIEW_TILE * sizeof(uint16_t));
+    }
+    return layer0[shown];
+}
+
+static const uint32_t *Overlay(void)
+{
+    return layer1[shown];
+}
+
+/**
+ * @brief  Flip counter; the second read for `tear_at` flips, as if the
+ *         vsync came while the tile was composed. The flip leaves that
+ *         tile as it was read, so only the torn rule sends it again.
+ */
+static uint32_t Flips(void)
+{
+    static bool second;
+
+    if ((int32_t)rv.next_tile == tear_at)
+    {
+        if (second)
+        {
+            // The new buffer differs in a tile visited later in this frame.
+            tear_at = -1;
+            Fill1(440U, 240U, 16U, 16U, 0xFF00FF00U);
+            Flip();
+        }
+        second = !second;
+    }
+    return flip_count;
+}
+
+static uint32_t Ms(void)
+{
+    return now_ms;
+}
+
+/**
+ * @brief  Layer 1 pixel over layer 0 pixel, as the LTDC blends them.
+ */
+static uint16_t Blend(uint16_t c0, uint32_t c1)
+{
+    uint32_t a = c1 >> 24, r = (c1 >> 16) & 0xFFU, g = (c1 >> 8) & 0xFFU, b = c1 & 0xFFU;
+
+    if (a == 0U) return c0;
+    if (a != 0xFFU)
+    {
+        uint32_t r0 = ((c0 >> 8) & 0xF8U) | (c0 >> 13);
+        uint32_t g0 = ((c0 >> 3) & 0xFCU) | ((c0 >> 9) & 0x03U);
+        uint32_t b0 = (((uint32_t)c0 << 3) & 0xF8U) | ((c0 >> 2) & 0x07U);
+
+        r = ((r * a) + (r0 * (255U - a)) + 127U) / 255U;
+        g = ((g * a) + (g0 * (255U - a)) + 127U) / 255U;
+        b = ((b * a) + (b0 * (255U - a)) + 127U) / 255U;
+    }
+    return (uint16_t)(((r & 0xF8U) << 8) | ((g & 0xFCU) << 3) | (b >> 3));
+}
+
+/**
+ * @brief  Tile of the shown buffers, REMOTE_VIEW_TILE pixels per row.
+ */
+static void ComposeTile(uint16_t index, uint16_t *out)
+{
+    uint32_t x0 = (index % TILES_X) * REMOTE_VIEW_TILE, y0 = (index / TILES_X) * REMOTE_VIEW_TILE;
+
+    memset(out, 0, REMOTE_VIEW_TILE * REMOTE_VIEW_TILE * sizeof(uint16_t));
+    for (uint32_t y = 0U; (y < REMOTE_VIEW_TILE) && ((y0 + y) < SCREEN_H); y++)
+    {
+        for (uint32_t x = 0U; x < REMOTE_VIEW_TILE; x++)
+        {
+            uint32_t i = (y0 + y) * SCREEN_W + x0 + x;
+
+            out[y * REMOTE_VIEW_TILE + x] = Blend(layer0[shown][i], layer1[shown][i]);
+        }
+    }
+}
+
+/**
+ * @brief  Tile of a whole picture, REMOTE_VIEW_TILE pixels per row.
+ */
+static void TileOf(const uint16_t *image, uint16_t index, uint16_t *out)
+{
+    uint32_t x0 = (index % TILES_X) * REMOTE_VIEW_TILE, y0 = (index / TILES_X) * REMOTE_VIEW_TILE;
+
+    memset(out, 0, REMOTE_VIEW_TILE * REMOTE_VIEW_TILE * sizeof(uint16_t));
+    for (uint32_t y = 0U; (y < REMOTE_VIEW_TILE) && ((y0 + y) < SCREEN_H); y++)
+    {
+        memcpy(&out[y * REMOTE_VIEW_TILE], &image[(y0 + y) * SCREEN_W + x0], REMOTE_VIEW_TILE * sizeof(uint16_t));
+    }
+}
+
+/**
+ * @brief  Back buffers become the shown ones and are copied back, as the
+ *         multibuffering of LCDConf.c keeps the drawing buffer current.
+ */
+static void Flip(void)
+{
+    shown ^= 1U;
+    flip_count++;
+    memcpy(layer0[shown ^ 1U], layer0[shown], sizeof(layer0[0]));
+    memcpy(layer1[shown ^ 1U], layer1[shown], sizeof(layer1[0]));
+}
+
+/**
+ * @brief  Draws one change into the back buffers and flips.
+ */
+static void Draw(ChangeKind_t kind, uint32_t step)
+{
+    uint8_t b = shown ^ 1U;
+
+    switch (kind)
+    {
+    case CHANGE_NONE:
+        return;
+    case CHANGE_CLOCK:
+        // Two digits of the clock bar change, antialiased edges.
+        Fill1(40U, 6U, 24U, 24U, 0x00000000U);
+        Fill1(44U, 8U, 4U, 20U, 0xFFFFFFFFU);
+        Fill1(48U, 8U, 1U, 20U, 0x80FFFFFFU);
+        Fill1(52U, 8U, 10U, 3U, 0xFFFFFFFFU);
+        break;
+    case CHANGE_ICON:
+        Fill1(200U, 100U, 48U, 48U, 0xFFE0A020U);
+        Fill1(200U, 148U, 48U, 2U, 0x60E0A020U);
+        break;
+    case CHANGE_SLIDER:
+        Fill1(20U, 220U, 440U, 12U, 0x00000000U);
+        Fill1(20U, 220U, 120U + (step * 40U), 12U, 0xA0208040U);
+        break;
+    case CHANGE_HIDDEN:
+        // Icon background on layer 0, covered by the opaque panel on layer 1.
+        for (uint32_t y = 40U; y < 80U; y++)
+        {
+            for (uint32_t x = 300U; x < 400U; x++) layer0[b][y * SCREEN_W + x] ^= 0x0821U;
+        }
+        break;
+    case CHANGE_ANIMATION:
+        // One frame of a spinner every pass while the first frame is sent.
+        Fill1(360U, 180U, 64U, 64U, 0x00000000U);
+        Fill1(360U + ((step * 5U) % 48U), 180U + ((step * 3U) % 48U), 16U, 16U, 0xFF40C0FFU);
+        break;
+    case CHANGE_TORN:
+        tear_at = 190;                      /* x 160, y 96: the filled tile */
+        Fill1(160U, 100U, 16U, 16U, 0xFF102030U);
+        break;
+    case CHANGE_PAGE:
+        Page(step + 2U);
+        break;
+    }
+    Flip();
+}
+
+static void Fill0(uint32_t x0, uint32_t y0, uint32_t w, uint32_t h, uint16_t c)
+{
+    for (uint32_t y = y0; (y < (y0 + h)) && (y < SCREEN_H); y++)
+    {
+        for (uint32_t x = x0; (x < (x0 + w)) && (x < SCREEN_W); x++) layer0[shown ^ 1U][y * SCREEN_W + x] = c;
+    }
+}
+
+static void Fill1(uint32_t x0, uint32_t y0, uint32_t w, uint32_t h, uint32_t c)
+{
+    for (uint32_t y = y0; (y < (y0 + h)) && (y < SCREEN_H); y++)
+    {
+        for (uint32_t x = x0; (x < (x0 + w)) && (x < SCREEN_W); x++) layer1[shown ^ 1U][y * SCREEN_W + x] = c;
+    }
+}
+
+/**
+ * @brief  A page: gradient background, opaque panel, translucent bar and
+ *         noisy text lines on layer 1, the rest transparent. Drawn into
+ *         the back buffers; the caller flips.
+ */
+static void Page(uint32_t seed)
+{
+    uint8_t b = shown ^ 1U;
+
+    for (uint32_t y = 0U; y < SCREEN_H; y++)
+    {
+        for (uint32_t x = 0U; x < SCREEN_W; x++)
+        {
+            layer0[b][y * SCREEN_W + x] = (uint16_t)(((((y + seed) * 32U) / SCREEN_H) % 32U) << 11 |
+                                                     (((x * 64U) / SCREEN_W) << 5) | (seed & 0x1FU));
+        }
+    }
+    Fill0(0U, 0U, SCREEN_W, 36U, 0x0000U);
+    Fill1(0U, 0U, SCREEN_W, SCREEN_H, 0x00000000U);
+    Fill1(280U, 30U, 140U, 60U, 0xFF303030U);
+    Fill1(20U, 220U, 160U, 12U, 0xA0208040U);
+    for (uint32_t line = 0U; line < 6U; line++)
+    {
+        for (uint32_t x = 16U; x < 240U; x++)
+        {
+            uint32_t r = Random();
+
+            if ((r % 3U) == 0U) Fill1(x, 60U + (line * 24U) + (r >> 8) % 12U, 1U, 2U, ((r & 0x100U) != 0U) ? 0xFFFFFFFFU : 0x80FFFFFFU);
+        }
+    }
+}
+
+/**
+ * @brief  Stream bytes of the current screen sent as a full frame.
+ */
+static uint32_t FullFrameBytes(void)
+{
+    uint16_t px[REMOTE_VIEW_TILE * REMOTE_VIEW_TILE];
+    uint8_t rle[REMOTE_VIEW_TILE_MAX_RLE];
+    uint32_t bytes = REMOTE_VIEW_FRAME_BYTES + REMOTE_VIEW_END_BYTES;
+
+    for (uint16_t t = 0U; t < TILES; t++)
+    {
+        ComposeTile(t, px);
+        bytes += REMOTE_VIEW_TILE_HEADER + RemoteView_EncodeTile(px, REMOTE_VIEW_TILE * REMOTE_VIEW_TILE, rle);
+    }
+    return bytes;
+}
+
+/**
+ * @brief  One main loop pass: the module service, then one viewer query
+ *         (a lost response is asked for again at the same position).
+ */
+static void Pass(void)
+{
+    uint8_t chunk[CHUNK], again[CHUNK];
+    uint32_t frames = rv.frames;
+    int32_t n;
+
+    now_ms += PASS_MS;
+    RemoteView_Service(&rv, TILES_PER_PASS);
+    if (rv.frames != frames) memcpy(shots[frames % SHOTS], expected, sizeof(expected));
+
+    n = RemoteView_Read(&rv, viewer.pos, chunk, CHUNK);
+    CHECK(n >= 0);
+    if ((n > 0) && ((Random() % 8U) == 0U))
+    {
+        // Response lost: the same position again after the timeout.
+        now_ms += PASS_MS;
+        int32_t m = RemoteView_Read(&rv, viewer.pos, again, CHUNK);
+
+        CHECK((m >= 0) && (memcmp(again, chunk, (uint32_t)((m < n) ? m : n)) == 0));
+        n = m;
+        memcpy(chunk, again, (uint32_t)m);
+    }
+    if (n <= 0) return;
+    CHECK((viewer.len + (uint32_t)n) <= sizeof(viewer.data));
+    memcpy(&viewer.data[viewer.len], chunk, (uint32_t)n);
+    viewer.len += (uint32_t)n;
+    viewer.pos += (uint32_t)n;
+    if (!Parse(&viewer)) viewer.bad++;
+}
+
+/**
+ * @brief  Applies every complete record; at END the picture must be the
+ *         tiles as they were composed when visited.
+ * @retval 0 on an invalid record.
+ */
+static int Parse(Viewer_t *v)
+{
+    uint32_t used = 0U;
+    int ok = 1;
+
+    while (ok && (used < v->len))
+    {
+        const uint8_t *r = &v->data[used];
+        uint32_t left = v->len - used;
+
+        if (r[0] == REMOTE_VIEW_REC_FRAME)
+        {
+            if (left < REMOTE_VIEW_FRAME_BYTES) break;
+            ok = !v->in_frame && (((r[1] << 8) | r[2]) == v->seq) && (((r[4] << 8) | r[5]) == SCREEN_W) &&
+                 (((r[6] << 8) | r[7]) == SCREEN_H) && (r[8] == REMOTE_VIEW_TILE);
+            v->key = (r[3] & REMOTE_VIEW_FLAG_KEY) != 0U;
+            CHECK(v->key == (v->frames == 0U));
+            v->in_frame = true;
+            used += REMOTE_VIEW_FRAME_BYTES;
+        }
+        else if (r[0] == REMOTE_VIEW_REC_TILE)
+        {
+            uint16_t px[REMOTE_VIEW_TILE * REMOTE_VIEW_TILE];
+            uint16_t index, len;
+            uint32_t x0, y0;
+            bool differs = false;
+
+            if (left < REMOTE_VIEW_TILE_HEADER) break;
+            index = (uint16_t)((r[1] << 8) | r[2]);
+            len = (uint16_t)((r[3] << 8) | r[4]);
+            if (left < (REMOTE_VIEW_TILE_HEADER + (uint32_t)len)) break;
+            ok = v->in_frame && (index < TILES) &&
+                 (RemoteView_DecodeTile(&r[REMOTE_VIEW_TILE_HEADER], len, px, REMOTE_VIEW_TILE * REMOTE_VIEW_TILE) == len);
+            if (!ok) break;
+            x0 = (index % TILES_X) * REMOTE_VIEW_TILE;
+            y0 = (index / TILES_X) * REMOTE_VIEW_TILE;
+            for (uint32_t y = 0U; (y < REMOTE_VIEW_TILE) && ((y0 + y) < SCREEN_H); y++)
+            {
+                uint32_t i = (y0 + y) * SCREEN_W + x0;
+
+                if (memcmp(&v->image[i], &px[y * REMOTE_VIEW_TILE], REMOTE_VIEW_TILE * sizeof(uint16_t)) != 0) differs = true;
+                memcpy(&v->image[i], &px[y * REMOTE_VIEW_TILE], REMOTE_VIEW_TILE * sizeof(uint16_t));
+                memcpy(&last_sent[i], &px[y * REMOTE_VIEW_TILE], REMOTE_VIEW_TILE * sizeof(uint16_t));
+            }
+            // A tile sent again with the picture the viewer already has.
+            if (!v->key && !differs) v->same++;
+            v->tiles++;
+            used += REMOTE_VIEW_TILE_HEADER + len;
+        }
+        else if (r[0] == REMOTE_VIEW_REC_END)
+        {
+            if (left < REMOTE_VIEW_END_BYTES) break;
+            ok = v->in_frame && (((r[1] << 8) | r[2]) == v->seq);
+            v->in_frame = false;
+            v->seq++;
+            v->frames++;
+            CHECK((rv.frames - v->frames) < SHOTS);
+            CHECK(memcmp(v->image, shots[(v->frames - 1U) % SHOTS], sizeof(v->image)) == 0);
+            used += REMOTE_VIEW_END_BYTES;
+        }
+        else ok = 0;
+    }
+    memmove(v->data, &v->data[used], v->len - used);
+    v->len -= used;
+    return ok;
+}
+
+/**
+ * @brief  xorshift32, repeatable between runs.
+ */
+static uint32_t Random(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
@@ -0,0 +1,320 @@
+/**
+ ******************************************************************************
+ * File Name          : anim_codec_test.c
+ * Description        : host test, the generated animation clips decoded
+ *                      frame by frame against their source frames
+ ******************************************************************************
+ *
+ * Builds the clips as they are in the firmware (IC/Src/Display/
+ * anim_welcome.c and anim_candle.c, written by Tools/animconv) together
+ * with the emWin Bitmap Converter frames they were made from
+ * (animation_welcome_frame_05..100.c, animation_candle_frame_1..4.c).
+ * The source pixels are taken the way animconv reads them: emWin
+ * GUI_DRAW_BMP8888 keeps the alpha inverted, fully transparent pixels
+ * become 0x00000000.
+ *
+ * Every clip is decoded with IC/Src/anim_codec.c: the keyframe, then the
+ * difference of every frame, twice round the loop (frame 0 carries the
+ * last -> first difference). After every step the canvas has to equal
+ * the source frame pixel for pixel. The clip is then played with
+ * AnimPlayer_Step() at irregular times, as DISP_Animation() does it on a
+ * loaded GUI task: the patches are drawn onto a larger screen, which has
+ * to show the frame of `player.frame` after every step and stay
+ * untouched outside the clip. Out of range frames and patches that leave
+ * the clip are refused.
+ *
+ * The report lists for every clip the source size against the image data
+ * of the clip and the pixels drawn per loop against full frames.
+ *
+ * Build (Linux):
+ *   make -C Tools/tests anim_codec_test
+ *
+ ******************************************************************************
+ */
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "Resource.h"
+#include "anim_codec.h"
+#include "host_test.h"
+/* Private Define ------------------------------------------------------------*/
+#define MAX_FRAMES          20U
+#define MAX_PIXELS          (300U * 114U)
+#define SCREEN_W            480U
+#define SCREEN_H            272U
+#define CLIP_X              90                  /* position on the screen */
+#define CLIP_Y              79
+#define SENTINEL            0x5A5A5A5AU
+#define REPEATS             3U
+/* Private Type --------------------------------------------------------------*/
+typedef struct
+{
+    const char              *name;
+    const AnimClip_t        *clip;
+    const GUI_BITMAP *const *frames;        /* source frames in playback order */
+    uint16_t                 count;
+} Clip_t;
+/* Private Variable ----------------------------------------------------------*/
+extern GUI_CONST_STORAGE GUI_BITMAP bmanimation_welcome_frame_05, bmanimation_welcome_frame_10,
+    bmanimation_welcome_frame_15, bmanimation_welcome_frame_20, bmanimation_welcome_frame_25,
+    bmanimation_welcome_frame_30, bmanimation_welcome_frame_35, bmanimation_welcome_frame_40,
+    bmanimation_welcome_frame_45, bmanimation_welcome_frame_50, bmanimation_welcome_frame_55,
+    bmanimation_welcome_frame_60, bmanimation_welcome_frame_65, bmanimation_welcome_frame_70,
+    bmanimation_welcome_frame_75, bmanimation_welcome_frame_80, bmanimation_welcome_frame_85,
+    bmanimation_welcome_frame_90, bmanimation_welcome_frame_95, bmanimation_welcome_frame_100;
+extern GUI_CONST_STORAGE GUI_BITMAP bmanimation_candle_frame_1, bmanimation_candle_frame_2,
+    bmanimation_candle_frame_3, bmanimation_candle_frame_4;
+
+/* Only the address is used: GUI_DRAW_BMP8888 of the frames. */
+const GUI_BITMAP_METHODS GUI_BitmapMethods8888 = { 0 };
+
+static const GUI_BITMAP *const welcome_frames[] =
+{
+    &bmanimation_welcome_frame_05, &bmanimation_welcome_frame_10, &bmanimation_welcome_frame_15,
+    &bmanimation_welcome_frame_20, &bmanimation_welcome_frame_25, &bmanimation_welcome_frame_30,
+    &bmanimation_welcome_frame_35, &bmanimation_welcome_frame_40, &bmanimation_welcome_frame_45,
+    &bmanimation_welcome_frame_50, &bmanimation_welcome_frame_55, &bmanimation_welcome_frame_60,
+    &bmanimation_welcome_frame_65, &bmanimation_welcome_frame_70, &bmanimation_welcome_frame_75,
+    &bmanimation_welcome_frame_80, &bmanimation_welcome_frame_85, &bmanimation_welcome_frame_90,
+    &bmanimation_welcome_frame_95, &bmanimation_welcome_frame_100,
+};
+static const GUI_BITMAP *const candle_frames[] =
+{
+    &bmanimation_candle_frame_1, &bmanimation_candle_frame_2,
+    &bmanimation_candle_frame_3, &bmanimation_candle_frame_4,
+};
+static const Clip_t clips[] =
+{
+    { "anim_welcome", &anim_welcome, welcome_frames, (uint16_t)(sizeof(welcome_frames) / sizeof(welcome_frames[0])) },
+    { "anim_candle", &anim_candle, candle_frames, (uint16_t)(sizeof(candle_frames) / sizeof(candle_frames[0])) },
+};
+static uint32_t source[MAX_FRAMES][MAX_PIXELS];
+static uint32_t canvas[MAX_PIXELS];
+static uint32_t screen[SCREEN_W * SCREEN_H];
+static uint32_t patch[MAX_PIXELS];
+static uint32_t rng;
+/* Private Function Prototype ------------------------------------------------*/
+static bool LoadSource(const Clip_t *c);
+static void DecodeClip(const Clip_t *c);
+static void PlayClip(const Clip_t *c);
+static void Refuse(const Clip_t *c);
+static void Report(const Clip_t *c);
+static void Draw(const IconImage_t *image, int16_t x, int16_t y, uint8_t alpha);
+static bool ScreenShows(const Clip_t *c, uint16_t frame);
+static uint32_t Random(void);
+/* Program Code --------------------------------------------------------------*/
+int main(void)
+{
+    printf("clip          frames    size  source KB  clip KB      %%  patches/loop  pixels/loop  full frames\n");
+    for (uint8_t i = 0U; i < (sizeof(clips) / sizeof(clips[0])); i++)
+    {
+        const Clip_t *c = &clips[i];
+
+        CHECK(LoadSource(c));
+        if (host_test_failures != 0U) break;
+        DecodeClip(c);
+        PlayClip(c);
+        Refuse(c);
+        Report(c);
+    }
+    return HOST_TEST_END("anim_codec_test");
+}
+
+/**
+ * @brief  Source frames as animconv reads them.
+ */
+static bool LoadSource(const Clip_t *c)
+{
+    const AnimClip_t *clip = c->clip;
+    const uint32_t n = (uint32_t)clip->width * clip->height;
+
+    if ((c->count != clip->frame_count) || (c->count > MAX_FRAMES) || (n > MAX_PIXELS)) return false;
+    for (uint16_t f = 0U; f < c->count; f++)
+    {
+        const GUI_BITMAP *bm = c->frames[f];
+        const unsigned long *argb = (const unsigned long *)(const void *)bm->pData;
+
+        if ((bm->XSize != clip->width) || (bm->YSize != clip->height) || (bm->BitsPerPixel != 32U) ||
+            (bm->BytesPerLine != (clip->width * 4U)) || (bm->pMethods != GUI_DRAW_BMP8888)) return false;
+        for (uint32_t i = 0U; i < n; i++)
+        {
+            uint32_t a = 0xFFU - (uint32_t)((argb[i] >> 24) & 0xFFU);
+
+            source[f][i] = (a == 0U) ? 0U : ((a << 24) | ((uint32_t)argb[i] & 0x00FFFFFFU));
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief  Keyframe, then every difference twice round the loop.
+ */
+static void DecodeClip(const Clip_t *c)
+{
+    const AnimClip_t *clip = c->clip;
+    const uint32_t bytes = (uint32_t)clip->width * clip->height * sizeof(uint32_t);
+    uint32_t bad = 0U;
+
+    memset(canvas, 0xA5, sizeof(canvas));
+    CHECK(AnimCodec_DecodeKeyframe(clip, canvas));
+    CHECK(memcmp(canvas, source[0], bytes) == 0);
+    for (uint32_t k = 1U; k <= (2U * clip->frame_count); k++)
+    {
+        uint16_t f = (uint16_t)(k % clip->frame_count);
+
+        if (!AnimCodec_ApplyFrame(clip, f, canvas) || (memcmp(canvas, source[f], bytes) != 0))
+        {
+            printf("%s: frame %u differs\n", c->name, f);
+            bad++;
+        }
+    }
+    CHECK(bad == 0U);
+}
+
+/**
+ * @brief  Plays the clip at irregular times onto the screen.
+ */
+static void PlayClip(const Clip_t *c)
+{
+    static const AnimPlayerOps_t ops = { Draw, NULL };
+    const AnimClip_t *clip = c->clip;
+    AnimPlayer_t player;
+    uint32_t now = 1000U, steps = 0U, bad = 0U;
+    bool outside = true;
+
+    for (uint32_t i = 0U; i < (SCREEN_W * SCREEN_H); i++) screen[i] = SENTINEL;
+    rng = 0x2545F491U;
+    AnimPlayer_Start(&player, &ops, clip, CLIP_X, CLIP_Y, REPEATS, now);
+    CHECK(player.running && (player.frame == 0U));
+    CHECK(ScreenShows(c, 0U));
+
+    while (AnimPlayer_Step(&player, now))
+    {
+        if (!ScreenShows(c, player.frame)) bad++;
+        // Mostly on time, sometimes one to three frames late.
+        now += ((Random() % 4U) == 0U) ? (1U + (Random() % (3U * clip->frame_ms))) : clip->frame_ms;
+        steps++;
+        CHECK(steps < (4U * REPEATS * clip->frame_count));
+    }
+    CHECK(bad == 0U);
+    CHECK(!player.running && (player.shown == player.total));
+    CHECK(player.total == ((REPEATS * clip->frame_count) - 1U));
+    CHECK(player.frame == (clip->frame_count - 1U));
+    CHECK(ScreenShows(c, (uint16_t)(clip->frame_count - 1U)));
+    CHECK(player.late > 0U);
+
+    for (uint32_t y = 0U; y < SCREEN_H; y++)
+    {
+        for (uint32_t x = 0U; x < SCREEN_W; x++)
+        {
+            bool in_clip = (x >= (uint32_t)CLIP_X) && (x < ((uint32_t)CLIP_X + clip->width)) &&
+                           (y >= (uint32_t)CLIP_Y) && (y < ((uint32_t)CLIP_Y + clip->height));
+
+            if (!in_clip && (screen[y * SCREEN_W + x] != SENTINEL)) outside = false;
+        }
+    }
+    CHECK(outside);
+}
+
+/**
+ * @brief  Damaged tables are refused instead of drawn out of the canvas.
+ */
+static void Refuse(const Clip_t *c)
+{
+    AnimClip_t clip = *c->clip;
+    AnimPatch_t moved[1];
+
+    CHECK(!AnimCodec_ApplyFrame(&clip, clip.frame_count, canvas));
+
+    moved[0] = clip.keyframe;
+    moved[0].x = 1U;
+    clip.keyframe = moved[0];
+    CHECK(!AnimCodec_DecodeKeyframe(&clip, canvas));
+
+    clip = *c->clip;
+    moved[0] = clip.patches[clip.frames[0].first];
+    moved[0].y = (uint16_t)(clip.height - moved[0].image->height + 1U);
+    clip.patches = moved;
+    clip.patch_count = 1U;
+    {
+        AnimFrame_t frame = { 0U, 1U };
+
+        clip.frames = &frame;
+        CHECK(!AnimCodec_ApplyFrame(&clip, 0U, canvas));
+        frame.count = 2U;
+        CHECK(!AnimCodec_ApplyFrame(&clip, 0U, canvas));
+    }
+}
+
+/**
+ * @brief  One report line: sizes and pixels drawn per loop.
+ */
+static void Report(const Clip_t *c)
+{
+    const AnimClip_t *clip = c->clip;
+    const IconImage_t *seen[1024];
+    uint32_t images = 0U, data = 0U, pixels = 0U;
+    uint32_t full = (uint32_t)clip->width * clip->height;
+    uint32_t src_bytes = full * 4U * clip->frame_count;
+
+    for (int32_t i = -1; i < (int32_t)clip->patch_count; i++)
+    {
+        const IconImage_t *image = (i < 0) ? clip->keyframe.image : clip->patches[i].image;
+        bool shared = false;
+
+        if (i >= 0) pixels += (uint32_t)image->width * image->height;
+        for (uint32_t k = 0U; k < images; k++) shared = shared || (seen[k] == image);
+        if (shared || (images >= (sizeof(seen) / sizeof(seen[0])))) continue;
+        seen[images++] = image;
+        data += image->size + (uint32_t)image->colors * 4U;
+    }
+    CHECK(data < src_bytes);
+    CHECK(pixels <= (full * clip->frame_count));
+    printf("%-12s  %6u  %3ux%-3u  %9.1f  %7.1f  %5.1f  %12u  %11u  %11u\n", c->name, clip->frame_count,
+           clip->width, clip->height, src_bytes / 1024.0, data / 1024.0, (100.0 * data) / src_bytes,
+           clip->patch_count, pixels, full * clip->frame_count);
+}
+
+/**
+ * @brief  AnimPlayerOps_t::draw: clears the rectangle and draws the image
+ *         with its opacity, as the GUI_DRAW_ICON method does.
+ */
+static void Draw(const IconImage_t *image, int16_t x, int16_t y, uint8_t alpha)
+{
+    const uint32_t n = (uint32_t)image->width * image->height;
+
+    CHECK((x >= 0) && (y >= 0) && (((uint32_t)x + image->width) <= SCREEN_W) && (((uint32_t)y + image->height) <= SCREEN_H));
+    CHECK(n <= MAX_PIXELS);
+    if ((x < 0) || (y < 0) || (((uint32_t)x + image->width) > SCREEN_W) || (((uint32_t)y + image->height) > SCREEN_H) ||
+        (n > MAX_PIXELS)) return;
+    CHECK(IconCodec_Decode(image, patch));
+    AnimCodec_ScaleAlpha(patch, n, alpha);
+    for (uint16_t row = 0U; row < image->height; row++)
+    {
+        memcpy(&screen[((uint32_t)y + row) * SCREEN_W + (uint32_t)x], &patch[(uint32_t)row * image->width],
+               image->width * sizeof(uint32_t));
+    }
+}
+
+static bool ScreenShows(const Clip_t *c, uint16_t frame)
+{
+    const AnimClip_t *clip = c->clip;
+
+    for (uint16_t row = 0U; row < clip->height; row++)
+    {
+        if (memcmp(&screen[((uint32_t)CLIP_Y + row) * SCREEN_W + (uint32_t)CLIP_X],
+                   &source[frame][(uint32_t)row * clip->width], clip->width * sizeof(uint32_t)) != 0) return false;
+    }
+    return true;
+}
+
+static uint32_t Random(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
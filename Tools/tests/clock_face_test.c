@@ -0,0 +1,401 @@
+/**
+ ******************************************************************************
+ * File Name          : clock_face_test.c
+ * Description        : host test, screensaver clock drawn by changed cells
+ *                      against the old full redraw every second
+ ******************************************************************************
+ *
+ * Runs IC/Src/clock_face.c the way DISPDateTime() drives it: one
+ * ClockFace_Update() per RTC second with the "HH:MM" text (the colon
+ * blinking or not, SCRNSVR_CLK_BLINK) and the date, on a 480x272 screen
+ * with the D80 digit cells and the Verdana 32 date of display.c.
+ *
+ * The ops draw into a pixel model of the screen: every pixel holds the
+ * character and colour drawn there, glyph devices keep what they were
+ * rendered with, and the date fills its text extent. After an update the
+ * model has to equal the same layout drawn from scratch, so a cell the
+ * diff missed, a stale glyph after a colour change or a date remainder
+ * shows up as a pixel difference. GUI calls have to come inside one
+ * begin/end pair, and an update without change makes none at all.
+ *
+ * The runs are a night from 22:00 to 07:00 with and without the blinking
+ * colon, a colour change, low memory (renders refused, the cache released
+ * as Mem_Pressure() does) and a wake every minute that clears the screen.
+ * For every run the test reports buffer swaps and drawn pixels against
+ * the old redraw: the 480x113 time band, the 101x51 date corner and the
+ * date text, with a swap every second.
+ *
+ * Build (Linux):
+ *   make -C Tools/tests clock_face_test
+ *
+ ******************************************************************************
+ */
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "clock_face.h"
+#include "host_test.h"
+/* Private Define ------------------------------------------------------------*/
+#define SCREEN_W            480
+#define SCREEN_H            272
+#define TIME_X              240             /* time_pos_scrnsvr */
+#define TIME_Y              136
+#define TIME_H              80              /* GUI_FONT_D80 */
+#define DATE_X              240             /* date_pos_scrnsvr */
+#define DATE_Y              245
+#define DATE_H              32              /* GUI_FontVerdana32_LAT */
+#define DATE_CHAR_W         16
+#define DIGIT_W             48
+#define COLON_W             24
+#define DEVICES             64U
+#define OLD_PIXELS          ((480U * 113U) + (101U * 51U))  /* band and date corner cleared */
+#define COLOR_WHITE         0xFFFFFFFFU
+#define COLOR_GREEN         0xFF00FF00U
+#define RUNS                (sizeof(runs) / sizeof(runs[0]))
+/* Private Type --------------------------------------------------------------*/
+typedef enum
+{
+    RUN_NIGHT,
+    RUN_COLOUR,                             /* colour changed half way */
+    RUN_LOW_MEMORY,                         /* renders refused, cache released */
+    RUN_WAKE,                               /* screen cleared every minute */
+} RunKind_t;
+
+typedef struct
+{
+    const char *name;
+    RunKind_t   kind;
+    bool        blink;
+    uint32_t    start_s;                    /* time of day */
+    uint32_t    length_s;
+} Run_t;
+
+typedef struct
+{
+    bool     live;
+    char     c;
+    uint32_t color;
+    int16_t  w, h;
+} Device_t;
+/* Private Variable ----------------------------------------------------------*/
+static const Run_t runs[] =
+{
+    { "night blink",  RUN_NIGHT,      true,  22U * 3600U, 9U * 3600U },
+    { "night steady", RUN_NIGHT,      false, 22U * 3600U, 9U * 3600U },
+    { "colour",       RUN_COLOUR,     true,  23U * 3600U + 3300U, 1200U },
+    { "low memory",   RUN_LOW_MEMORY, true,  9U * 3600U + 1790U, 1800U },
+    { "wake",         RUN_WAKE,       true,  12U * 3600U + 1500U, 600U },
+};
+static uint16_t screen[SCREEN_H][SCREEN_W];
+static uint16_t expected[SCREEN_H][SCREEN_W];
+static Device_t devices[DEVICES];
+static ClockFace_t cf;
+static uint32_t begins, ends, calls, renders, releases, refused, devices_live;
+static bool refuse;                         /* MemBudget_Reserve() says no */
+/* Private Function Prototype ------------------------------------------------*/
+static int16_t CharWidth(char c);
+static uint32_t Render(char c, int16_t width, int16_t height, uint32_t color);
+static void Release(uint32_t glyph);
+static void Begin(void);
+static void Blit(uint32_t glyph, int16_t x, int16_t y);
+static void Draw(char c, const GuiRect_t *cell, uint32_t color);
+static int16_t TextWidth(const char *text);
+static void DrawDate(const char *text, const GuiRect_t *clear, uint32_t color);
+static void End(void);
+static uint16_t Ink(char c, uint32_t color);
+static uint16_t DateInk(const char *text, uint32_t color);
+static void Fill(uint16_t (*image)[SCREEN_W], int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint16_t ink);
+static void Expected(const char *time, const char *date, uint32_t color);
+static void Format(uint32_t s, uint32_t day, bool blink, char *time, char *date);
+/* Program Code --------------------------------------------------------------*/
+int main(void)
+{
+    static const ClockFaceOps_t ops = { CharWidth, Render, Release, Begin, Blit, Draw, TextWidth, DrawDate, End };
+    char time[8], date[CLOCK_FACE_DATE_SIZE], buf[400];
+    uint32_t n;
+
+    // Layout: fixed digit cells, centred.
+    ClockFace_Init(&cf, &ops, "00:00", TIME_X, TIME_Y, TIME_H, DATE_X, DATE_Y, DATE_H, COLOR_WHITE);
+    CHECK(cf.cell_count == 5U);
+    CHECK((cf.cells[0].x1 - cf.cells[0].x0 + 1) == DIGIT_W);
+    CHECK((cf.cells[2].x1 - cf.cells[2].x0 + 1) == COLON_W);
+    CHECK(cf.cells[0].x0 == (TIME_X - ((4 * DIGIT_W) + COLON_W) / 2));
+    CHECK(cf.cells[4].x1 == (cf.cells[0].x0 + (4 * DIGIT_W) + COLON_W - 1));
+    CHECK((cf.cells[0].y0 == (TIME_Y - TIME_H / 2)) && (cf.cells[0].y1 == (TIME_Y + TIME_H / 2 - 1)));
+    for (uint8_t i = 1U; i < cf.cell_count; i++) CHECK(cf.cells[i].x0 == (cf.cells[i - 1U].x1 + 1));
+
+    printf("%-12s %7s %7s %7s %12s %12s %6s %7s %7s\n", "run", "updates", "swaps", "old", "pixels", "old pixels",
+           "share", "renders", "direct");
+    for (uint32_t r = 0U; r < RUNS; r++)
+    {
+        const Run_t *run = &runs[r];
+        uint32_t color = COLOR_WHITE, day = 17U, swaps = 0U, renders_at = renders;
+        uint64_t pixels = 0U, old_pixels = 0U;
+
+        memset(screen, 0, sizeof(screen));
+        ClockFace_Init(&cf, &ops, "00:00", TIME_X, TIME_Y, TIME_H, DATE_X, DATE_Y, DATE_H, color);
+        for (uint32_t k = 0U; k < run->length_s; k++)
+        {
+            uint32_t s = (run->start_s + k) % 86400U;
+            uint32_t b, p;
+            bool minute;
+
+            if ((s == 0U) && (k != 0U)) day++;
+            Format(s, day, run->blink, time, date);
+            minute = (s % 60U) == 0U;
+            switch (run->kind)
+            {
+            case RUN_NIGHT:
+                break;
+            case RUN_COLOUR:
+                if (k == (run->length_s / 2U))
+                {
+                    color = COLOR_GREEN;
+                    ClockFace_SetColor(&cf, color);
+                    CHECK((cf.glyph_bytes == 0U) && (devices_live == 0U));
+                }
+                break;
+            case RUN_LOW_MEMORY:
+                // Every third second the budget is short; Mem_Pressure() every two minutes.
+                refuse = (k % 3U) == 0U;
+                if ((k % 120U) == 0U)
+                {
+                    ClockFace_Release(&cf);
+                    CHECK((cf.glyph_bytes == 0U) && (devices_live == 0U));
+                }
+                break;
+            case RUN_WAKE:
+                if (minute)
+                {
+                    // Screensaver entered again: the screen was cleared.
+                    memset(screen, 0, sizeof(screen));
+                    ClockFace_Invalidate(&cf);
+                }
+                break;
+            }
+
+            calls = 0U;
+            p = ClockFace_Update(&cf, time, date);
+            CHECK(begins == ends);
+            CHECK((p == 0U) == (calls == 0U));
+            if (p != 0U) swaps++;
+            pixels += p;
+            old_pixels += OLD_PIXELS + ((uint32_t)TextWidth(date) * DATE_H);
+            if ((run->kind == RUN_WAKE) && minute) CHECK(p == cf.full_pixels);
+
+            // The same text again: no GUI call, no swap.
+            b = begins;
+            calls = 0U;
+            CHECK((ClockFace_Update(&cf, time, date) == 0U) && (calls == 0U) && (begins == b));
+
+            if (minute || ((k % 97U) == 0U) || (k == (run->length_s - 1U)) || (run->kind != RUN_NIGHT))
+            {
+                Expected(time, date, color);
+                CHECK(memcmp(screen, expected, sizeof(screen)) == 0);
+            }
+        }
+        refuse = false;
+
+        switch (run->kind)
+        {
+        case RUN_NIGHT:
+            // Every digit is seen once in the night, plus ':' and ' ' when blinking.
+            CHECK((renders - renders_at) == (run->blink ? 12U : 11U));
+            CHECK((cf.misses == (renders - renders_at)) && (cf.direct == 0U) && (cf.dates == 2U));
+            if (!run->blink) CHECK(swaps == (run->length_s / 60U));
+            break;
+        case RUN_COLOUR:
+            CHECK(cf.direct == 0U);
+            break;
+        case RUN_LOW_MEMORY:
+            CHECK((cf.direct != 0U) && (cf.direct == refused) && (cf.misses > CLOCK_FACE_GLYPHS));
+            break;
+        case RUN_WAKE:
+            CHECK(cf.misses <= CLOCK_FACE_GLYPHS);
+            break;
+        }
+        printf("%-12s %7u %7u %7u %12llu %12llu %5.2f%% %7u %7u\n", run->name, run->length_s, swaps, run->length_s,
+               (unsigned long long)pixels, (unsigned long long)old_pixels,
+               100.0 * (double)pixels / (double)old_pixels, renders - renders_at, cf.direct);
+        refused = 0U;
+        ClockFace_Release(&cf);
+        CHECK(devices_live == 0U);
+    }
+
+    // A shorter date clears the rest of the longer one.
+    {
+        GuiRect_t old = cf.date_rect;
+
+        CHECK(ClockFace_Update(&cf, time, "Pon, 1. Maj 2026") != 0U);
+        CHECK((cf.date_rect.x0 > old.x0) && (cf.date_rect.x1 < old.x1));
+        Expected(time, "Pon, 1. Maj 2026", cf.color);
+        CHECK(memcmp(screen, expected, sizeof(screen)) == 0);
+    }
+
+    n = ClockFace_Report(&cf, buf, sizeof(buf));
+    CHECK((n == strlen(buf)) && (strstr(buf, "clock: full ") != NULL));
+    fputs(buf, stdout);
+    CHECK((ClockFace_Report(&cf, buf, 20U) == 0U) && (buf[0] == '\0'));
+    CHECK(releases == renders);
+
+    return HOST_TEST_END("clock_face_test");
+}
+
+/**
+ * @brief  D80 digits: '1' is narrower than the others, the colon narrower
+ *         still, so fixed cells are needed to keep the layout in place.
+ */
+static int16_t CharWidth(char c)
+{
+    if (c == ':') return COLON_W;
+    if (c == ' ') return 20;
+    if (c == '1') return 30;
+    return DIGIT_W;
+}
+
+/**
+ * @brief  Memory device of one cell; refused like MemBudget_Reserve().
+ */
+static uint32_t Render(char c, int16_t width, int16_t height, uint32_t color)
+{
+    CHECK(height == TIME_H);
+    CHECK(width == (((c >= '0') && (c <= '9')) ? DIGIT_W : COLON_W));
+    if (refuse)
+    {
+        refused++;
+        return 0U;
+    }
+    for (uint32_t i = 0U; i < DEVICES; i++)
+    {
+        if (devices[i].live) continue;
+        devices[i].live = true;
+        devices[i].c = c;
+        devices[i].color = color;
+        devices[i].w = width;
+        devices[i].h = height;
+        renders++;
+        devices_live++;
+        return i + 1U;
+    }
+    CHECK(false);
+    return 0U;
+}
+
+static void Release(uint32_t glyph)
+{
+    CHECK((glyph != 0U) && (glyph <= DEVICES) && devices[glyph - 1U].live);
+    devices[glyph - 1U].live = false;
+    devices_live--;
+    releases++;
+}
+
+static void Begin(void)
+{
+    CHECK(begins == ends);
+    begins++;
+    calls++;
+}
+
+static void Blit(uint32_t glyph, int16_t x, int16_t y)
+{
+    const Device_t *d = &devices[glyph - 1U];
+
+    CHECK((begins == (ends + 1U)) && (glyph != 0U) && (glyph <= DEVICES) && d->live);
+    Fill(screen, x, y, x + d->w - 1, y + d->h - 1, Ink(d->c, d->color));
+    calls++;
+}
+
+static void Draw(char c, const GuiRect_t *cell, uint32_t color)
+{
+    CHECK(begins == (ends + 1U));
+    Fill(screen, cell->x0, cell->y0, cell->x1, cell->y1, Ink(c, color));
+    calls++;
+}
+
+static int16_t TextWidth(const char *text)
+{
+    return (int16_t)(strlen(text) * DATE_CHAR_W);
+}
+
+/**
+ * @brief  Clears `clear` and fills the centred text extent of the date.
+ */
+static void DrawDate(const char *text, const GuiRect_t *clear, uint32_t color)
+{
+    int32_t x0 = DATE_X - (TextWidth(text) / 2);
+
+    CHECK(begins == (ends + 1U));
+    CHECK((clear->x0 <= x0) && (clear->x1 >= (x0 + TextWidth(text) - 1)));
+    Fill(screen, clear->x0, clear->y0, clear->x1, clear->y1, 0U);
+    Fill(screen, x0, DATE_Y - (DATE_H / 2), x0 + TextWidth(text) - 1, DATE_Y - (DATE_H / 2) + DATE_H - 1,
+         DateInk(text, color));
+    calls++;
+}
+
+static void End(void)
+{
+    CHECK(begins == (ends + 1U));
+    ends++;
+    calls++;
+}
+
+/**
+ * @brief  Pixel of a cell: the character and the colour it was drawn in.
+ */
+static uint16_t Ink(char c, uint32_t color)
+{
+    return (uint16_t)(((uint32_t)(uint8_t)c << 8) | (color & 0xFFU) | 0x01U);
+}
+
+/**
+ * @brief  Pixel of the date: a hash of the text and the colour.
+ */
+static uint16_t DateInk(const char *text, uint32_t color)
+{
+    uint32_t h = 2166136261U;
+
+    while (*text != '\0') h = (h ^ (uint8_t)*text++) * 16777619U;
+    return (uint16_t)(0x8000U | (h & 0x7F00U) | (color & 0xFFU) | 0x02U);
+}
+
+static void Fill(uint16_t (*image)[SCREEN_W], int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint16_t ink)
+{
+    CHECK((x0 >= 0) && (y0 >= 0) && (x1 < SCREEN_W) && (y1 < SCREEN_H));
+    for (int32_t y = y0; y <= y1; y++)
+    {
+        for (int32_t x = x0; x <= x1; x++) image[y][x] = ink;
+    }
+}
+
+/**
+ * @brief  The same layout drawn from scratch, as a full redraw would.
+ */
+static void Expected(const char *time, const char *date, uint32_t color)
+{
+    int32_t x0 = DATE_X - (TextWidth(date) / 2);
+
+    memset(expected, 0, sizeof(expected));
+    for (uint8_t i = 0U; i < cf.cell_count; i++)
+    {
+        char c = (time[0] != '\0') ? *time++ : ' ';
+
+        Fill(expected, cf.cells[i].x0, cf.cells[i].y0, cf.cells[i].x1, cf.cells[i].y1, Ink(c, color));
+    }
+    Fill(expected, x0, DATE_Y - (DATE_H / 2), x0 + TextWidth(date) - 1, DATE_Y - (DATE_H / 2) + DATE_H - 1,
+         DateInk(date, color));
+}
+
+/**
+ * @brief  Time and date text as DISPDateTime() formats them.
+ */
+static void Format(uint32_t s, uint32_t day, bool blink, char *time, char *date)
+{
+    static const char *const days[] = { "Subota", "Nedjelja" };
+    char colon = ':';
+
+    if (blink && ((s & 1U) == 0U)) colon = ' ';
+    snprintf(time, 8U, "%02u%c%02u", (unsigned)(s / 3600U), colon, (unsigned)((s / 60U) % 60U));
+    snprintf(date, CLOCK_FACE_DATE_SIZE, "%s, %02u. Oktobar 2026", days[day & 1U], (unsigned)day);
+}
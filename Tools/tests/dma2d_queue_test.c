@@ -0,0 +1,348 @@
+/**
+ ******************************************************************************
+ * File Name          : dma2d_queue_test.c
+ * Description        : host test, DMA2D job queue: fences, ordering and
+ *                      jobs that end in an error
+ ******************************************************************************
+ *
+ * Part one runs IC/Src/dma2d_queue.c with the software backend of
+ * dma2d_soft.c: jobs run in submit order, fences complete in order and
+ * across counter wrap, a full queue waits for a free slot, and fills,
+ * copies, format conversions and blends give the expected pixels.
+ *
+ * Part two runs the queue with a model of the DMA2D registers that
+ * follows _DMA_Start(), _DMA_Idle() and LCD_DMA2D_IRQHandler() in
+ * LCDConf.c: a job ends with transfer complete, transfer error,
+ * configuration error or not at all, and only raises its interrupt when
+ * the matching enable bit was set in CR. Every fence has to be reached
+ * with the enables of _DMA_Start() and the DMA2D_TIMEOUT_MS abort, and
+ * the test shows that with TCIE alone (before the fix) the first failed
+ * job leaves Dma2dQueue_Wait() sleeping forever.
+ *
+ * Build (Linux):
+ *   make -C Tools/tests dma2d_queue_test
+ *
+ ******************************************************************************
+ */
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "dma2d_queue.h"
+#include "dma2d_soft.h"
+#include "host_test.h"
+/* Private Define ------------------------------------------------------------*/
+/* DMA2D register bits (RM0385) */
+#define CR_TEIE             (1UL << 8)
+#define CR_TCIE             (1UL << 9)
+#define CR_CEIE             (1UL << 13)
+#define ISR_TEIF            (1UL << 0)
+#define ISR_TCIF            (1UL << 1)
+#define ISR_CEIF            (1UL << 5)
+#define CR_ENABLES          (CR_TCIE | CR_TEIE | CR_CEIE)   /* _DMA_Start() */
+#define JOB_US              200U            /* one job */
+#define TICK_US             1000U           /* SysTick wakes __WFI */
+#define TIMEOUT_US          100000U         /* DMA2D_TIMEOUT_MS */
+#define MAX_IDLE            100000U         /* idle calls before the wait counts as hung */
+#define JOBS                400U
+/* Private Type --------------------------------------------------------------*/
+typedef enum
+{
+    END_TC,                                 /* transfer complete */
+    END_TE,                                 /* transfer error, e.g. bus fault */
+    END_CE,                                 /* configuration error */
+    END_NONE                                /* no flag at all */
+} End_t;
+
+typedef struct
+{
+    uint32_t enables;                       /* CR interrupt enables written by start */
+    bool     timeout;                       /* idle aborts after TIMEOUT_US */
+    uint64_t now_us;
+    uint64_t start_us;
+    uint32_t cr;
+    uint32_t isr;
+    End_t    end;
+    bool     running;
+    uint32_t idles;
+    uint32_t errors;
+    uint32_t aborts;
+    bool     hung;
+    uint32_t hung_fence;
+} Hw_t;
+/* Private Variable ----------------------------------------------------------*/
+static Dma2dQueue_t queue;
+static Hw_t hw;
+static End_t plan[JOBS];
+static uint32_t plan_next;
+static uint32_t order[64];
+static uint32_t order_len;
+/* Private Function Prototype ------------------------------------------------*/
+static void SoftPart(void);
+static uint32_t HwRun(uint32_t enables, bool timeout, uint32_t *failed_fence);
+static void HwStart(const Dma2dJob_t *job);
+static void HwIdle(void);
+static void HwLock(void);
+static void HwUnlock(void);
+static void HwIrq(void);
+static void Trace(const Dma2dJob_t *job);
+/* Program Code --------------------------------------------------------------*/
+static const Dma2dBackend_t hw_backend = { HwStart, HwIdle, HwLock, HwUnlock };
+
+int main(void)
+{
+    uint32_t fence, us;
+
+    SoftPart();
+
+    // Every fifth job fails in one of three ways.
+    for (uint32_t i = 0U; i < JOBS; i++)
+    {
+        plan[i] = ((i % 5U) != 4U) ? END_TC : (End_t)(1U + ((i / 5U) % 3U));
+    }
+
+    us = HwRun(CR_ENABLES, true, &fence);
+    CHECK(!hw.hung);
+    CHECK(fence == 0U);
+    CHECK(queue.count == 0U);
+    CHECK(hw.errors == ((JOBS / 5U) * 2U / 3U) + 1U);
+    CHECK(hw.aborts == (JOBS / 5U) / 3U);
+    printf("TCIE|TEIE|CEIE + timeout: %u jobs, %u error interrupts, %u aborted after %u ms, %u ms total\n",
+           JOBS, hw.errors, hw.aborts, TIMEOUT_US / 1000U, us / 1000U);
+
+    // Without the timeout the error interrupts alone end every failed job.
+    for (uint32_t i = 0U; i < JOBS; i++) if (plan[i] == END_NONE) plan[i] = END_TE;
+    us = HwRun(CR_ENABLES, false, &fence);
+    CHECK(!hw.hung);
+    CHECK(hw.errors == (JOBS / 5U));
+    printf("TCIE|TEIE|CEIE:           %u jobs, %u error interrupts, %u ms total\n", JOBS, hw.errors, us / 1000U);
+
+    // Before the fix: TCIE only, the first failed job is never completed.
+    (void)HwRun(CR_TCIE, false, &fence);
+    CHECK(hw.hung);
+    CHECK(fence == 5U);
+    printf("TCIE only (old):          Dma2dQueue_Wait() hangs on fence %u\n", fence);
+
+    return HOST_TEST_END("dma2d_queue_test");
+}
+
+/**
+ * @brief  Queue semantics and pixels with the software backend.
+ */
+static void SoftPart(void)
+{
+    static uint32_t buf[64], src[64], dst[64];
+    static uint16_t px565[64];
+    Dma2dJob_t job;
+    uint32_t f[12];
+    bool ok;
+
+    Dma2dQueue_Init(&queue, &Dma2dSoft_Backend);
+    Dma2dSoft_Attach(&queue, NULL, Trace);
+
+    // Order and fences; twelve jobs through an eight entry queue.
+    memset(&job, 0, sizeof(job));
+    order_len = 0U;
+    for (uint32_t i = 0U; i < 12U; i++)
+    {
+        job.cr = DMA2D_JOB_R2M;
+        job.ocolr = i;
+        job.omar = (uintptr_t)&buf[i % 4U];
+        job.opfccr = DMA2D_SOFT_ARGB8888;
+        job.nlr = (1UL << 16) | 1U;
+        f[i] = Dma2dQueue_Submit(&queue, &job);
+    }
+    CHECK(queue.full_waits == 4U);
+    CHECK(queue.max_depth == DMA2D_QUEUE_SIZE);
+    CHECK(!Dma2dQueue_IsDone(&queue, f[11]));
+    Dma2dQueue_Wait(&queue, f[9]);
+    CHECK(Dma2dQueue_IsDone(&queue, f[9]));
+    CHECK(!Dma2dQueue_IsDone(&queue, f[10]));
+    Dma2dQueue_Sync(&queue);
+    CHECK((buf[0] == 8U) && (buf[1] == 9U) && (buf[2] == 10U) && (buf[3] == 11U));
+    CHECK(queue.count == 0U);
+    ok = (order_len == 12U);
+    for (uint32_t i = 0U; ok && (i < 12U); i++) ok = (order[i] == i);
+    CHECK(ok);
+
+    // Fence counters wrap.
+    queue.submitted = 0xFFFFFFFEU;
+    queue.completed = 0xFFFFFFFEU;
+    for (uint32_t i = 0U; i < 4U; i++) f[i] = Dma2dQueue_Submit(&queue, &job);
+    CHECK(!Dma2dQueue_IsDone(&queue, f[3]));
+    Dma2dQueue_Wait(&queue, f[3]);
+    CHECK(Dma2dQueue_IsDone(&queue, f[2]) && Dma2dQueue_IsDone(&queue, f[3]));
+
+    // Rectangle copy with line offsets: 5x3 out of an 8 pixel wide source.
+    for (uint32_t i = 0U; i < 64U; i++) src[i] = 0xFF000000U | (i * 0x010203U);
+    memset(dst, 0, sizeof(dst));
+    memset(&job, 0, sizeof(job));
+    job.cr = DMA2D_JOB_M2M;
+    job.fgmar = (uintptr_t)&src[9];
+    job.fgor = 3U;
+    job.fgpfccr = DMA2D_SOFT_ARGB8888;
+    job.omar = (uintptr_t)&dst[2];
+    job.oor = 3U;
+    job.nlr = (5UL << 16) | 3U;
+    Dma2dQueue_Wait(&queue, Dma2dQueue_Submit(&queue, &job));
+    ok = true;
+    for (uint32_t y = 0U; y < 3U; y++)
+    {
+        for (uint32_t x = 0U; x < 8U; x++)
+        {
+            uint32_t want = (x < 5U) ? src[9U + (y * 8U) + x] : 0U;
+            if (dst[2U + (y * 8U) + x] != want) ok = false;
+        }
+    }
+    CHECK(ok);
+
+    // ARGB8888 -> RGB565 -> ARGB8888 keeps colors that fit into 565.
+    for (uint32_t i = 0U; i < 64U; i++) src[i] = 0xFF000000U | ((i * 8U) << 16) | (((63U - i) * 4U) << 8) | ((i % 32U) * 8U);
+    job.cr = DMA2D_JOB_M2M_PFC;
+    job.fgmar = (uintptr_t)src;
+    job.fgor = 0U;
+    job.omar = (uintptr_t)px565;
+    job.oor = 0U;
+    job.opfccr = DMA2D_SOFT_RGB565;
+    job.nlr = (64UL << 16) | 1U;
+    Dma2dQueue_Submit(&queue, &job);
+    job.fgmar = (uintptr_t)px565;
+    job.fgpfccr = DMA2D_SOFT_RGB565;
+    job.omar = (uintptr_t)dst;
+    job.opfccr = DMA2D_SOFT_ARGB8888;
+    Dma2dQueue_Sync(&queue);
+    Dma2dQueue_Wait(&queue, Dma2dQueue_Submit(&queue, &job));
+    ok = true;
+    for (uint32_t i = 0U; i < 64U; i++) if ((dst[i] & 0xFFF8FCF8U) != (src[i] & 0xFFF8FCF8U)) ok = false;
+    CHECK(ok);
+
+    // Blend: opaque foreground covers, transparent foreground shows background.
+    for (uint32_t i = 0U; i < 64U; i++)
+    {
+        src[i] = ((i & 1U) ? 0xFF000000U : 0x00000000U) | 0x00123456U;
+        buf[i] = 0xFF000000U | (i * 0x00010101U);
+    }
+    memset(&job, 0, sizeof(job));
+    job.cr = DMA2D_JOB_M2M_BLEND;
+    job.fgmar = (uintptr_t)src;
+    job.fgpfccr = DMA2D_SOFT_ARGB8888;
+    job.bgmar = (uintptr_t)buf;
+    job.bgpfccr = DMA2D_SOFT_ARGB8888;
+    job.omar = (uintptr_t)dst;
+    job.opfccr = DMA2D_SOFT_ARGB8888;
+    job.nlr = (64UL << 16) | 1U;
+    Dma2dQueue_Wait(&queue, Dma2dQueue_Submit(&queue, &job));
+    ok = true;
+    for (uint32_t i = 0U; i < 64U; i++) if (dst[i] != ((i & 1U) ? src[i] : buf[i])) ok = false;
+    CHECK(ok);
+    CHECK(Dma2dSoft_Unsupported() == 0U);
+}
+
+/**
+ * @brief  Submits JOBS jobs (fence after each 8) with the register model.
+ * @param  failed_fence: first fence that was never reached, 0 if none
+ * @retval modelled time in us
+ */
+static uint32_t HwRun(uint32_t enables, bool timeout, uint32_t *failed_fence)
+{
+    Dma2dJob_t job;
+
+    memset(&hw, 0, sizeof(hw));
+    memset(&job, 0, sizeof(job));
+    hw.enables = enables;
+    hw.timeout = timeout;
+    plan_next = 0U;
+    *failed_fence = 0U;
+    Dma2dQueue_Init(&queue, &hw_backend);
+    job.cr = DMA2D_JOB_R2M;
+    for (uint32_t i = 0U; (i < JOBS) && !hw.hung; i++)
+    {
+        uint32_t fence = Dma2dQueue_Submit(&queue, &job);
+
+        if (((i % 8U) == 7U) || (i == (JOBS - 1U)))
+        {
+            Dma2dQueue_Wait(&queue, fence);
+            if (hw.hung) *failed_fence = hw.hung_fence;
+        }
+    }
+    return (uint32_t)hw.now_us;
+}
+
+/**
+ * @brief  _DMA_Start(): registers, CR with interrupt enables and START.
+ */
+static void HwStart(const Dma2dJob_t *job)
+{
+    hw.cr = job->cr | hw.enables;
+    hw.start_us = hw.now_us;
+    hw.end = plan[plan_next++ % JOBS];
+    hw.running = true;
+}
+
+/**
+ * @brief  _DMA_Idle(): timeout check, else __WFI until the next interrupt.
+ */
+static void HwIdle(void)
+{
+    if (++hw.idles > MAX_IDLE)
+    {
+        // Nothing will ever wake the wait: complete it so the test goes on.
+        hw.hung = true;
+        hw.hung_fence = queue.completed + 1U;
+        queue.completed = queue.submitted;
+        queue.count = 0U;
+        return;
+    }
+    if (hw.timeout && ((hw.now_us - hw.start_us) > TIMEOUT_US) && (queue.count != 0U) &&
+        !(hw.isr & (ISR_TCIF | ISR_TEIF | ISR_CEIF)))
+    {
+        hw.running = false;
+        hw.isr = 0U;
+        hw.aborts++;
+        Dma2dQueue_Complete(&queue);
+        return;
+    }
+    // The job ends after JOB_US, SysTick wakes the core every TICK_US.
+    hw.now_us += (hw.running && ((hw.now_us - hw.start_us) < JOB_US)) ? (JOB_US - (hw.now_us - hw.start_us)) : TICK_US;
+    if (hw.running && ((hw.now_us - hw.start_us) >= JOB_US))
+    {
+        hw.running = false;
+        if (hw.end == END_TC) hw.isr |= ISR_TCIF;
+        if (hw.end == END_TE) hw.isr |= ISR_TEIF;
+        if (hw.end == END_CE) hw.isr |= ISR_CEIF;
+    }
+    if (((hw.isr & ISR_TCIF) && (hw.cr & CR_TCIE)) || ((hw.isr & ISR_TEIF) && (hw.cr & CR_TEIE)) ||
+        ((hw.isr & ISR_CEIF) && (hw.cr & CR_CEIE)))
+    {
+        HwIrq();
+    }
+}
+
+static void HwLock(void)
+{
+}
+
+static void HwUnlock(void)
+{
+}
+
+/**
+ * @brief  LCD_DMA2D_IRQHandler(): clear flags, error or not the job ends.
+ */
+static void HwIrq(void)
+{
+    uint32_t flags = hw.isr;
+
+    hw.isr = 0U;
+    if (flags & (ISR_TCIF | ISR_TEIF | ISR_CEIF))
+    {
+        if (flags & (ISR_TEIF | ISR_CEIF)) hw.errors++;
+        Dma2dQueue_Complete(&queue);
+    }
+}
+
+static void Trace(const Dma2dJob_t *job)
+{
+    if ((order_len < 64U) && ((job->cr & DMA2D_JOB_MODE_MASK) == DMA2D_JOB_R2M)) order[order_len++] = job->ocolr;
+}
@@ -0,0 +1,215 @@
+/**
+ ******************************************************************************
+ * File Name          : fb_sync_test.c
+ * Description        : host test, partial copy of emWin multibuffers
+ ******************************************************************************
+ *
+ * Runs IC/Src/fb_sync.c the way _LCD_CopyBuffer() in LCDConf.c does it:
+ * at the start of every frame the new back buffer is brought up to date
+ * by copying only the region FbSync_Begin() returns from the front
+ * buffer, then the frame is drawn into it and reported with
+ * FbSync_Damage(), then it becomes the front buffer. Some frames also
+ * draw into the front buffer after it was shown, as drawing outside
+ * GUI_MULTIBUF_Begin()/End() does. Pixels are one byte here; the layer is
+ * reported as ARGB8888.
+ *
+ * After every copy the back buffer has to match the reference image, and
+ * the bytes the module reports have to match the copied area. For two
+ * and three buffers and four kinds of frames the test reports bytes
+ * copied per frame next to the whole buffer the copy used to move.
+ *
+ * Build (Linux):
+ *   make -C Tools/tests fb_sync_test
+ *
+ ******************************************************************************
+ */
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "fb_sync.h"
+#include "host_test.h"
+/* Private Define ------------------------------------------------------------*/
+#define LCD_W               480
+#define LCD_H               272
+#define BPP                 4U              /* layer 0, GUICC_M8888I */
+#define FULL_BYTES          ((uint32_t)LCD_W * LCD_H * BPP)
+#define FRAMES              2000U
+/* Private Type --------------------------------------------------------------*/
+typedef enum
+{
+    FRAME_IDLE,                             /* nothing changes */
+    FRAME_ICONS,                            /* 1..4 icon sized rectangles */
+    FRAME_TILE,                             /* one lights/gate tile */
+    FRAME_FULL,                             /* whole screen cleared */
+    FRAME_KINDS
+} Frame_t;
+/* Private Variable ----------------------------------------------------------*/
+static uint8_t buf[FB_SYNC_MAX_BUFFERS][LCD_H][LCD_W];
+static uint8_t truth[LCD_H][LCD_W];
+static uint32_t rng;
+/* Private Function Prototype ------------------------------------------------*/
+static uint32_t Run(uint8_t buffers, Frame_t kind, uint32_t *full_copies);
+static uint32_t Copy(const GuiDirty_t *region, uint8_t src, uint8_t dst);
+static void Fill(FbSync_t *sync, uint8_t b, int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+static uint32_t Random(void);
+/* Program Code --------------------------------------------------------------*/
+int main(void)
+{
+    static const char *names[] = { "idle", "icons", "tile", "full" };
+    char report[128];
+    FbSync_t sync;
+
+    printf("480x272 ARGB8888, %u frames, whole buffer %u B\n", FRAMES, (unsigned)FULL_BYTES);
+    printf("frame    buffers  B/frame  full copies  saved %%\n");
+    for (uint8_t kind = 0U; kind < FRAME_KINDS; kind++)
+    {
+        for (uint8_t buffers = 2U; buffers <= FB_SYNC_MAX_BUFFERS; buffers++)
+        {
+            uint32_t full_copies;
+            uint32_t average = Run(buffers, (Frame_t)kind, &full_copies);
+
+            printf("%-7s  %7u  %7u  %11u  %7u\n", names[kind], buffers, (unsigned)average, (unsigned)full_copies,
+                   (unsigned)(100U - (uint32_t)(((uint64_t)average * 100U) / FULL_BYTES)));
+            if (kind == FRAME_IDLE) CHECK(full_copies == (buffers - 1U));
+            if (kind == FRAME_FULL) CHECK(full_copies == FRAMES);
+            if (kind == FRAME_ICONS) CHECK(average < (FULL_BYTES / 10U));
+        }
+    }
+
+    // Invalid buffer index: copy everything, the next frame is partial again.
+    FbSync_Init(&sync, LCD_W, LCD_H, BPP, 3U, 0U);
+    CHECK(FbSync_Begin(&sync, 0U, 0U) == NULL);
+    CHECK(FbSync_Begin(&sync, 0U, 3U) == NULL);
+    CHECK(sync.draw == 0U);
+    CHECK(FbSync_Begin(&sync, 0U, 1U) != NULL);
+    CHECK(sync.last_bytes == FULL_BYTES);
+    FbSync_Damage(&sync, 0, 0, 9, 9);
+    CHECK(FbSync_Begin(&sync, 1U, 0U) != NULL);
+    CHECK(sync.last_bytes == (100U * BPP)); /* 0 only missed the 10x10 */
+    CHECK(FbSync_Begin(&sync, 0U, 1U) != NULL);
+    CHECK(sync.last_bytes == 0U);           /* 1 already has the 10x10 drawn into it */
+
+    // Memory changed behind the driver: every other buffer is copied whole.
+    FbSync_InvalidateAll(&sync);
+    CHECK(FbSync_Begin(&sync, 1U, 2U) != NULL);
+    CHECK(sync.copy.full);
+
+    // Report: one line, nothing on a short buffer.
+    CHECK(FbSync_Report(&sync, 0U, report, sizeof(report)) == strlen(report));
+    CHECK(strncmp(report, "layer 0: ", 9U) == 0);
+    CHECK(FbSync_Report(&sync, 0U, report, 10U) == 0U);
+    CHECK(report[0] == '\0');
+
+    return HOST_TEST_END("fb_sync_test");
+}
+
+/**
+ * @brief  Runs FRAMES frames of one kind.
+ * @retval average bytes copied per frame, as the module reports them
+ */
+static uint32_t Run(uint8_t buffers, Frame_t kind, uint32_t *full_copies)
+{
+    FbSync_t sync;
+    uint8_t front = 0U;
+    uint32_t mismatches = 0U, wrong_bytes = 0U;
+
+    // Only the front buffer is valid at start (LCD_X_Config).
+    memset(buf, 0xAA, sizeof(buf));
+    memset(buf[0], 0, sizeof(buf[0]));
+    memset(truth, 0, sizeof(truth));
+    rng = 0x1234567U + kind;
+    FbSync_Init(&sync, LCD_W, LCD_H, BPP, buffers, 0U);
+
+    for (uint32_t f = 0U; f < FRAMES; f++)
+    {
+        uint8_t back = (uint8_t)((front + 1U) % buffers);
+        const GuiDirty_t *region = FbSync_Begin(&sync, front, back);
+        uint32_t n;
+
+        CHECK(region != NULL);
+        if (region == NULL) return 0U;
+        if ((Copy(region, front, back) * BPP) != sync.last_bytes) wrong_bytes++;
+        if (memcmp(buf[back], truth, sizeof(truth)) != 0) mismatches++;
+
+        switch (kind)
+        {
+        case FRAME_ICONS:
+            n = 1U + (Random() % 4U);
+            for (uint32_t k = 0U; k < n; k++)
+            {
+                int16_t x0 = (int16_t)(Random() % LCD_W), y0 = (int16_t)(Random() % LCD_H);
+                Fill(&sync, back, x0, y0, (int16_t)(x0 + (int16_t)(Random() % 60U)), (int16_t)(y0 + (int16_t)(Random() % 50U)));
+            }
+            break;
+        case FRAME_TILE:
+            n = Random() % 3U;
+            Fill(&sync, back, (int16_t)(n * 126U), 86, (int16_t)((n * 126U) + 125U), 215);
+            break;
+        case FRAME_FULL:
+            Fill(&sync, back, 0, 0, LCD_W - 1, LCD_H - 1);
+            break;
+        default:
+            break;
+        }
+        front = back;
+
+        // Drawn into the visible buffer outside Begin/End.
+        if ((kind == FRAME_ICONS) && ((Random() % 5U) == 0U))
+        {
+            int16_t x0 = (int16_t)(Random() % 400U), y0 = (int16_t)(Random() % 200U);
+            Fill(&sync, front, x0, y0, (int16_t)(x0 + 20), (int16_t)(y0 + 20));
+        }
+    }
+    CHECK(mismatches == 0U);
+    CHECK(wrong_bytes == 0U);
+    CHECK(sync.frames == FRAMES);
+    *full_copies = sync.full_copies;
+    return (uint32_t)(sync.total_bytes / sync.frames);
+}
+
+/**
+ * @brief  Copies the region between buffers like the DMA2D copy loop.
+ * @retval pixels copied
+ */
+static uint32_t Copy(const GuiDirty_t *region, uint8_t src, uint8_t dst)
+{
+    uint32_t pixels = 0U;
+    GuiRect_t r;
+
+    for (uint8_t i = 0U; GuiDirty_Get(region, i, &r); i++)
+    {
+        for (int16_t y = r.y0; y <= r.y1; y++)
+        {
+            memcpy(&buf[dst][y][r.x0], &buf[src][y][r.x0], (size_t)(r.x1 - r.x0 + 1));
+        }
+        pixels += (uint32_t)((r.x1 - r.x0 + 1) * (r.y1 - r.y0 + 1));
+    }
+    return pixels;
+}
+
+/**
+ * @brief  Draws one rectangle into buffer `b` and reports it.
+ */
+static void Fill(FbSync_t *sync, uint8_t b, int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+    uint8_t v = (uint8_t)Random();
+
+    if (x1 >= LCD_W) x1 = LCD_W - 1;
+    if (y1 >= LCD_H) y1 = LCD_H - 1;
+    for (int16_t y = y0; y <= y1; y++)
+    {
+        memset(&buf[b][y][x0], v, (size_t)(x1 - x0 + 1));
+        memset(&truth[y][x0], v, (size_t)(x1 - x0 + 1));
+    }
+    FbSync_Damage(sync, x0, y0, x1, y1);
+}
+
+static uint32_t Random(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
@@ -0,0 +1,317 @@
+/**
+ ******************************************************************************
+ * File Name          : frame_pacer_test.c
+ * Description        : host test, GUI_Exec paced by the LTDC vsync against the
+ *                      old 50 ms tick
+ ******************************************************************************
+ *
+ * Runs IC/Src/frame_pacer.c the way DISP_Service() drives it: a main loop
+ * pass every millisecond, GUI_Exec() when FramePacer_Poll() says so, then
+ * FramePacer_Done() with its time. The LTDC model counts a vsync every
+ * 16.667 ms (60 Hz); a finished frame waits for scanout until the next
+ * vsync, as the multibuffer flip in LCDConf.c does.
+ *
+ * The trace is a row of segments: idle, a finger dragged over a slider
+ * (a report every 20 ms), an animation with RS485 queues busy half of the
+ * time, a screen whose GUI_Exec takes 25..45 ms, the LTDC switched off
+ * and RS485 traffic with the clock ticking. The same trace is also run
+ * with GUI_Exec() every GUI_REFRESH_TIME (50 ms), as before.
+ *
+ * Paced frames must never start while a buffer waits for scanout or more
+ * than once per vsync, must leave the vsyncs an over-budget frame used,
+ * must draw every touch and must not defer a redraw longer than
+ * GUI_FRAME_MAX_DEFER vsyncs. With the LTDC off the GUI has to keep
+ * running. Per segment the test reports GUI_Exec calls and frames, touch
+ * latency and redraw latency for both schemes.
+ *
+ * Build (Linux):
+ *   make -C Tools/tests frame_pacer_test
+ *
+ ******************************************************************************
+ */
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "frame_pacer.h"
+#include "host_test.h"
+/* Private Define ------------------------------------------------------------*/
+#define PASS_US             1000U           /* main loop pass */
+#define VSYNC_NUM           50U             /* 60 Hz: 50 vsyncs per 833333 us */
+#define VSYNC_DEN           833333U
+#define BUDGET_US           16600U          /* GUI_FRAME_BUDGET_US */
+#define MAX_DEFER           3U              /* GUI_FRAME_MAX_DEFER */
+#define TICK_US             50000U          /* GUI_REFRESH_TIME */
+#define EMPTY_EXEC_US       150U            /* GUI_Exec() with nothing to draw */
+#define SEGMENTS            (sizeof(segments) / sizeof(segments[0]))
+/* Private Type --------------------------------------------------------------*/
+typedef struct
+{
+    const char *name;
+    uint32_t    length_ms;
+    uint32_t    touch_ms;                   /* period of touch reports, 0: none */
+    uint32_t    redraw_ms;                  /* period of invalidations, 0: none */
+    uint32_t    exec_min_us, exec_max_us;   /* GUI_Exec() with something to draw */
+    uint8_t     busy;                       /* 0 never, 1 half of the time, 2 always */
+    bool        ltdc_off;
+} Segment_t;
+
+typedef struct
+{
+    uint32_t calls;                         /* GUI_Exec() calls */
+    uint32_t frames;                        /* calls with something to draw */
+    uint32_t touches, touch_sum_us, touch_max_us;
+    uint32_t redraws, redraw_sum_us, redraw_max_us;
+} Stats_t;
+/* Private Variable ----------------------------------------------------------*/
+static const Segment_t segments[] =
+{
+    { "idle",           2000U,  0U,  0U,     0U,     0U, 0U, false },
+    { "slider drag",    2000U, 20U, 20U,  6000U,  9000U, 0U, false },
+    { "animation+bus",  2000U,  0U, 20U,  3000U,  5000U, 1U, false },
+    { "heavy screen",   1000U,  0U, 20U, 25000U, 45000U, 0U, false },
+    { "ltdc off",       1000U,  0U, 10U,  3000U,  3000U, 0U, true  },
+    { "bus + clock",    2000U,  0U, 1000U, 3000U, 3000U, 2U, false },
+};
+static uint32_t now_us, vsync_count;
+static uint64_t vsync_phase;                /* vsyncs * VSYNC_DEN */
+static bool ltdc_on, buffer_pending, input_flag, invalid_flag, busy_flag;
+static uint32_t rng;
+/* Private Function Prototype ------------------------------------------------*/
+static uint32_t Vsync(void);
+static uint32_t Ms(void);
+static bool BufferPending(void);
+static bool Input(void);
+static bool Invalid(void);
+static bool Busy(void);
+static void Run(bool paced, uint32_t first_vsync, Stats_t *stats, FramePacer_t *pacer);
+static void Advance(uint32_t us);
+static uint32_t Random(void);
+/* Program Code --------------------------------------------------------------*/
+int main(void)
+{
+    static Stats_t paced[SEGMENTS], tick[SEGMENTS], wrapped[SEGMENTS];
+    FramePacer_t pacer, pacer_wrapped;
+    char report[256];
+
+    Run(true, 0U, paced, &pacer);
+    Run(false, 0U, tick, NULL);
+    printf("%-14s %-6s %6s %6s %8s %8s %8s %8s\n", "segment", "scheme", "calls", "frames",
+           "touch ms", "max", "redraw", "max");
+    for (uint8_t s = 0U; s < SEGMENTS; s++)
+    {
+        const Stats_t *st[2] = { &tick[s], &paced[s] };
+
+        for (uint8_t k = 0U; k < 2U; k++)
+        {
+            printf("%-14s %-6s %6u %6u %8.1f %8.1f %8.1f %8.1f\n", (k == 0U) ? segments[s].name : "",
+                   (k == 0U) ? "50 ms" : "vsync", st[k]->calls, st[k]->frames,
+                   (st[k]->touches != 0U) ? ((double)st[k]->touch_sum_us / st[k]->touches / 1000.0) : 0.0,
+                   st[k]->touch_max_us / 1000.0,
+                   (st[k]->redraws != 0U) ? ((double)st[k]->redraw_sum_us / st[k]->redraws / 1000.0) : 0.0,
+                   st[k]->redraw_max_us / 1000.0);
+        }
+    }
+    FramePacer_Report(&pacer, report, sizeof(report));
+    printf("%s", report);
+
+    // Nothing to draw: no GUI_Exec() at all.
+    CHECK(paced[0].calls == 0U);
+    CHECK(pacer.idle != 0U);
+    // A touch is on screen within two vsyncs and a frame.
+    CHECK(paced[1].touch_max_us <= ((2U * BUDGET_US) + 9000U + PASS_US));
+    CHECK((paced[1].touch_sum_us / paced[1].touches) < (tick[1].touch_sum_us / tick[1].touches));
+    // Bus work defers a redraw by at most GUI_FRAME_MAX_DEFER vsyncs.
+    CHECK(paced[2].redraw_max_us <= (((MAX_DEFER + 2U) * 16667U) + PASS_US));
+    CHECK((pacer.deferrals != 0U) && (pacer.forced != 0U));
+    // Frames over budget leave vsyncs out.
+    CHECK((pacer.over_budget != 0U) && (pacer.budget_waits != 0U));
+    // No vsync: a decision every FRAME_PACER_STALL_MS.
+    CHECK(pacer.stalls != 0U);
+    CHECK(paced[4].frames >= ((segments[4].length_ms / FRAME_PACER_STALL_MS) - 1U));
+    CHECK(paced[4].redraw_max_us <= ((FRAME_PACER_STALL_MS * 1000U) + (2U * PASS_US)));
+    // Same trace across the wrap of the vsync counter.
+    Run(true, UINT32_MAX - 200U, wrapped, &pacer_wrapped);
+    CHECK(memcmp(wrapped, paced, sizeof(paced)) == 0);
+    CHECK(pacer_wrapped.frames == pacer.frames);
+
+    // Report: complete or nothing.
+    CHECK(FramePacer_Report(&pacer, report, sizeof(report)) == strlen(report));
+    CHECK(FramePacer_Report(&pacer, report, 20U) == 0U);
+    CHECK(report[0] == '\0');
+
+    return HOST_TEST_END("frame_pacer_test");
+}
+
+static uint32_t Vsync(void)
+{
+    return vsync_count;
+}
+
+static uint32_t Ms(void)
+{
+    return now_us / 1000U;
+}
+
+static bool BufferPending(void)
+{
+    return buffer_pending;
+}
+
+/**
+ * @brief  Pacer_Input(): the flag of DISP_NotifyInput(), cleared on read.
+ */
+static bool Input(void)
+{
+    bool input = input_flag;
+
+    input_flag = false;
+    return input;
+}
+
+static bool Invalid(void)
+{
+    return invalid_flag;
+}
+
+static bool Busy(void)
+{
+    return busy_flag;
+}
+
+/**
+ * @brief  Runs the whole trace, paced by the vsync or every TICK_US.
+ */
+static void Run(bool paced, uint32_t first_vsync, Stats_t *stats, FramePacer_t *pacer)
+{
+    static const FramePacerOps_t ops = { Vsync, Ms, BufferPending, Input, Invalid, Busy };
+    uint32_t touch_at = 0U, redraw_at = 0U, next_tick = TICK_US, last_frame_vsync = 0U, skip_until = 0U;
+    bool touch_waiting = false, redraw_waiting = false, drawn = false;
+    uint32_t started_pending = 0U, twice = 0U, early = 0U, undrawn = 0U;
+
+    now_us = 0U;
+    vsync_count = first_vsync;
+    vsync_phase = 0U;
+    ltdc_on = true;
+    buffer_pending = input_flag = invalid_flag = busy_flag = false;
+    rng = 0x1234567U;
+    memset(stats, 0, SEGMENTS * sizeof(Stats_t));
+    if (paced) FramePacer_Init(pacer, &ops, BUDGET_US, MAX_DEFER);
+
+    for (uint8_t s = 0U; s < SEGMENTS; s++)
+    {
+        const Segment_t *seg = &segments[s];
+        Stats_t *st = &stats[s];
+        uint32_t start = now_us;
+
+        // The LTDC stops after showing the last frame; its line events, and
+        // with them the flips, stop with it.
+        if (seg->ltdc_off) buffer_pending = false;
+        ltdc_on = !seg->ltdc_off;
+        while ((now_us - start) < (seg->length_ms * 1000U))
+        {
+            uint32_t t_ms = (now_us - start) / 1000U;
+            bool frame;
+
+            // TS_Service(), screen timers, RS485 queues.
+            if ((seg->touch_ms != 0U) && ((t_ms % seg->touch_ms) == 0U))
+            {
+                input_flag = true;               /* the slider moves */
+                invalid_flag = true;
+                if (!redraw_waiting) redraw_at = now_us;
+                redraw_waiting = true;
+                if (!touch_waiting) touch_at = now_us;
+                touch_waiting = true;
+            }
+            if ((seg->redraw_ms != 0U) && ((t_ms % seg->redraw_ms) == 0U))
+            {
+                invalid_flag = true;
+                if (!redraw_waiting) redraw_at = now_us;
+                redraw_waiting = true;
+            }
+            busy_flag = (seg->busy == 2U) || ((seg->busy == 1U) && (((t_ms / 100U) % 2U) == 0U));
+
+            // DISP_Service().
+            if (paced)
+            {
+                frame = FramePacer_Poll(pacer);
+            }
+            else
+            {
+                frame = ((int32_t)(now_us - next_tick) >= 0);
+                if (frame) next_tick += TICK_US;
+            }
+            if (frame)
+            {
+                bool work = invalid_flag;
+                uint32_t exec = work ? (seg->exec_min_us + (Random() % (seg->exec_max_us - seg->exec_min_us + 1U))) : EMPTY_EXEC_US;
+
+                st->calls++;
+                if (paced)
+                {
+                    if (buffer_pending) started_pending++;
+                    if (ltdc_on && drawn && (vsync_count == last_frame_vsync)) twice++;
+                    if (ltdc_on && drawn && ((int32_t)(vsync_count - skip_until) < 0)) early++;
+                    last_frame_vsync = vsync_count;
+                    drawn = true;
+                }
+                if (work)
+                {
+                    st->frames++;
+                    if (touch_waiting)
+                    {
+                        st->touches++;
+                        st->touch_sum_us += now_us - touch_at;
+                        if ((now_us - touch_at) > st->touch_max_us) st->touch_max_us = now_us - touch_at;
+                    }
+                    if (redraw_waiting)
+                    {
+                        st->redraws++;
+                        st->redraw_sum_us += now_us - redraw_at;
+                        if ((now_us - redraw_at) > st->redraw_max_us) st->redraw_max_us = now_us - redraw_at;
+                    }
+                    touch_waiting = redraw_waiting = false;
+                    invalid_flag = input_flag = false;
+                }
+                Advance(exec);
+                if (work) buffer_pending = ltdc_on;
+                if (paced)
+                {
+                    FramePacer_Done(pacer, exec);
+                    skip_until = last_frame_vsync + 1U + (exec / BUDGET_US);
+                }
+            }
+            Advance(PASS_US);
+        }
+    }
+    if (touch_waiting || redraw_waiting) undrawn++;
+    CHECK(started_pending == 0U);
+    CHECK(twice == 0U);
+    CHECK(early == 0U);
+    CHECK(undrawn == 0U);
+}
+
+/**
+ * @brief  Time passes; the LTDC counts vsyncs and shows a waiting buffer.
+ */
+static void Advance(uint32_t us)
+{
+    now_us += us;
+    if (!ltdc_on) return;
+    vsync_phase += (uint64_t)us * VSYNC_NUM;
+    while (vsync_phase >= VSYNC_DEN)
+    {
+        vsync_phase -= VSYNC_DEN;
+        vsync_count++;
+        buffer_pending = false;
+    }
+}
+
+static uint32_t Random(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
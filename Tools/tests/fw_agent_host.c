@@ -0,0 +1,316 @@
+/**
+ ******************************************************************************
+ * File Name          : fw_agent_host.c
+ * Description        : host fakes of HAL, QSPI NOR, I2C EEPROM and TinyFrame
+ *                      for the firmware update agent tests
+ ******************************************************************************
+ *
+ * See fw_agent_host.h for the model.
+ *
+ ******************************************************************************
+ */
+/* Includes ------------------------------------------------------------------*/
+#define _DEFAULT_SOURCE                 /* fork, mmap MAP_ANONYMOUS */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "main.h"
+#include "rs485.h"
+#include "stm32746g_qspi.h"
+#include "stm32746g_eeprom.h"
+#include "fw_agent_host.h"
+/* Private Define ------------------------------------------------------------*/
+#define NOR_SECTOR_SIZE         N25Q128A_SECTOR_SIZE
+#define NOR_PAGE_SIZE           256U
+#define EE_PAGE_SIZE            32U
+/* Private Variable ----------------------------------------------------------*/
+HostFlash_t *host_flash;
+uint64_t host_time_us;
+uint32_t host_steps;
+uint32_t host_kill_step;
+uint32_t host_fail_step;
+uint32_t host_rng = 0x2545F491U;
+const uint8_t *host_image;
+uint32_t host_image_size;
+bool     host_restarted;
+uint32_t host_irq_masked;
+uint32_t host_irq_disables;
+uint64_t host_program_us;
+uint64_t host_ee_us;
+uint64_t host_erase_wait_us;
+uint32_t host_erases;
+uint8_t  host_tx[TF_SENDBUF_LEN];
+uint16_t host_tx_len;
+uint32_t host_tx_count;
+
+CRC_HandleTypeDef hcrc = { CRC_INPUTDATA_FORMAT_BYTES };
+uint32_t host_uid = 0x12345678U;
+uint8_t tfifa = HOST_TF_ADDRESS;
+
+static bool erase_busy;
+static uint32_t erase_addr;
+static uint64_t erase_done_us;
+/* Private Function Prototype ------------------------------------------------*/
+static uint8_t *NorAt(uint32_t addr, uint32_t len);
+static bool Step(void);
+static void PowerOff(void);
+static void Busy(uint64_t *counter, uint32_t us);
+static void PartialErase(uint32_t addr);
+/* Program Code --------------------------------------------------------------*/
+void HostFlash_Create(void)
+{
+    void *p = mmap(NULL, sizeof(HostFlash_t), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+
+    if (p == MAP_FAILED)
+    {
+        perror("mmap");
+        exit(2);
+    }
+    host_flash = p;
+}
+
+void HostFlash_Reset(uint32_t seed)
+{
+    host_rng = (seed != 0U) ? seed : 0x2545F491U;
+    // The staging zone holds whatever an earlier update left there.
+    for (uint32_t i = 0U; i < HOST_NOR_SIZE; i++) host_flash->nor[i] = (uint8_t)HostRandom();
+    memset(host_flash->ee, 0xFF, sizeof(host_flash->ee));
+}
+
+uint32_t HostRandom(void)
+{
+    host_rng ^= host_rng << 13;
+    host_rng ^= host_rng >> 17;
+    host_rng ^= host_rng << 5;
+    return host_rng;
+}
+
+uint32_t HostCrc32(const uint8_t *buf, uint32_t len)
+{
+    uint32_t crc = 0xFFFFFFFFU;
+
+    for (uint32_t i = 0U; i < len; i++)
+    {
+        crc ^= buf[i];
+        for (uint8_t b = 0U; b < 8U; b++) crc = (crc >> 1) ^ (0xEDB88320U & (0U - (crc & 1U)));
+    }
+    return ~crc;
+}
+
+/* HAL -----------------------------------------------------------------------*/
+uint32_t HAL_GetTick(void)
+{
+    return (uint32_t)(host_time_us / 1000U);
+}
+
+void HAL_Delay(uint32_t ms)
+{
+    host_time_us += (uint64_t)ms * 1000U;
+}
+
+HAL_StatusTypeDef HAL_CRC_Init(CRC_HandleTypeDef *h)
+{
+    (void)h;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_CRC_DeInit(CRC_HandleTypeDef *h)
+{
+    (void)h;
+    return HAL_OK;
+}
+
+uint32_t HAL_CRC_Calculate(CRC_HandleTypeDef *h, uint32_t *buf, uint32_t len)
+{
+    // The agent only hashes byte buffers (EEPROM header) in BYTES mode.
+    (void)h;
+    return HostCrc32((const uint8_t *)buf, len);
+}
+
+void HostIrq_Disable(void)
+{
+    host_irq_masked = 1U;
+    host_irq_disables++;
+}
+
+void HostIrq_Enable(void)
+{
+    host_irq_masked = 0U;
+}
+
+uint32_t HostIrq_GetMask(void)
+{
+    return host_irq_masked;
+}
+
+void HostIrq_SetMask(uint32_t mask)
+{
+    host_irq_masked = mask;
+}
+
+void SYSRestart(void)
+{
+    host_restarted = true;
+}
+
+uint8_t GetFwInfo(FwInfoTypeDef *fw_info)
+{
+    const uint8_t *staged;
+
+    if (fw_info->ld_addr == RT_APPL_ADDR) return 0U;
+    if (host_image == NULL) return 1U;
+    staged = NorAt(fw_info->ld_addr, host_image_size);
+    return (uint8_t)((memcmp(staged, host_image, host_image_size) == 0) ? 0U : 1U);
+}
+
+uint8_t IsNewFwUpdate(FwInfoTypeDef *old_fw, FwInfoTypeDef *new_fw)
+{
+    (void)old_fw;
+    (void)new_fw;
+    return 0U;
+}
+
+/* TinyFrame -----------------------------------------------------------------*/
+bool TF_SendSimple(TinyFrame *tf, TF_TYPE type, const uint8_t *data, TF_LEN len)
+{
+    (void)tf;
+    (void)type;
+    if (len > sizeof(host_tx)) len = sizeof(host_tx);
+    memcpy(host_tx, data, len);
+    host_tx_len = len;
+    host_tx_count++;
+    return true;
+}
+
+/* EEPROM --------------------------------------------------------------------*/
+uint32_t EE_ReadBuffer(uint8_t *pBuffer, uint16_t ReadAddr, uint16_t NumByteToRead)
+{
+    if (((uint32_t)ReadAddr + NumByteToRead) > HOST_EE_SIZE) abort();
+    memcpy(pBuffer, &host_flash->ee[ReadAddr], NumByteToRead);
+    return 0U;
+}
+
+uint32_t EE_WriteBuffer(uint8_t *pBuffer, uint16_t WriteAddr, uint16_t NumByteToWrite)
+{
+    if (((uint32_t)WriteAddr + NumByteToWrite) > HOST_EE_SIZE) abort();
+    if (Step())
+    {
+        memcpy(&host_flash->ee[WriteAddr], pBuffer, HostRandom() % ((uint32_t)NumByteToWrite + 1U));
+        PowerOff();
+    }
+    memcpy(&host_flash->ee[WriteAddr], pBuffer, NumByteToWrite);
+    Busy(&host_ee_us, (((uint32_t)NumByteToWrite + EE_PAGE_SIZE - 1U) / EE_PAGE_SIZE) * HOST_EE_WRITE_MS * 1000U);
+    return 0U;
+}
+
+/* QSPI NOR ------------------------------------------------------------------*/
+void MX_QSPI_Init(void)
+{
+}
+
+uint8_t QSPI_MemMapMode(void)
+{
+    return QSPI_OK;
+}
+
+uint8_t QSPI_GetStatus(void)
+{
+    if (!erase_busy) return QSPI_OK;
+    if (host_time_us < erase_done_us)
+    {
+        // Polling the status register takes time, too.
+        Busy(&host_erase_wait_us, 100U);
+        return QSPI_BUSY;
+    }
+    memset(NorAt(erase_addr, NOR_SECTOR_SIZE), 0xFF, NOR_SECTOR_SIZE);
+    erase_busy = false;
+    host_erases++;
+    return QSPI_OK;
+}
+
+uint8_t QSPI_EraseSectorStart(uint32_t staddr)
+{
+    if (erase_busy || ((staddr % NOR_SECTOR_SIZE) != 0U)) return QSPI_ERROR;
+    // Until the erase ends the sector holds neither old nor erased data.
+    PartialErase(staddr);
+    if (Step()) PowerOff();
+    erase_busy = true;
+    erase_addr = staddr;
+    erase_done_us = host_time_us + (HOST_ERASE_MS * 1000U);
+    return QSPI_OK;
+}
+
+uint8_t QSPI_Erase(uint32_t staddr, uint32_t enaddr)
+{
+    for (uint32_t addr = staddr - (staddr % NOR_SECTOR_SIZE); addr <= enaddr; addr += NOR_SECTOR_SIZE)
+    {
+        PartialErase(addr);
+        if (Step()) PowerOff();
+        memset(NorAt(addr, NOR_SECTOR_SIZE), 0xFF, NOR_SECTOR_SIZE);
+        Busy(&host_erase_wait_us, HOST_ERASE_MS * 1000U);
+        host_erases++;
+    }
+    return QSPI_OK;
+}
+
+uint8_t QSPI_Write(uint8_t *pbuf, uint32_t wraddr, uint32_t size)
+{
+    uint8_t *dst = NorAt(wraddr, size);
+    uint32_t len = size;
+    bool kill;
+
+    if (erase_busy) return QSPI_ERROR;
+    kill = Step();
+    if (kill || (host_steps == host_fail_step)) len = HostRandom() % (size + 1U);
+    // NOR programming can only clear bits.
+    for (uint32_t i = 0U; i < len; i++) dst[i] &= pbuf[i];
+    if (kill) PowerOff();
+    Busy(&host_program_us, ((size + NOR_PAGE_SIZE - 1U) / NOR_PAGE_SIZE) * HOST_PAGE_PROGRAM_US);
+    return (host_steps == host_fail_step) ? QSPI_ERROR : QSPI_OK;
+}
+
+/**
+ * @brief  Pointer into the NOR model; a range outside of it is a test bug.
+ */
+static uint8_t *NorAt(uint32_t addr, uint32_t len)
+{
+    if ((addr < HOST_NOR_BASE) || ((addr - HOST_NOR_BASE + len) > HOST_NOR_SIZE))
+    {
+        fprintf(stderr, "NOR access 0x%08x+%u outside the model\n", (unsigned)addr, (unsigned)len);
+        abort();
+    }
+    return &host_flash->nor[addr - HOST_NOR_BASE];
+}
+
+/**
+ * @brief  Counts one persistent operation.
+ * @retval true when power is lost during it.
+ */
+static bool Step(void)
+{
+    host_steps++;
+    return (host_kill_step != 0U) && (host_steps == host_kill_step);
+}
+
+static void PowerOff(void)
+{
+    _exit(HOST_EXIT_POWER_LOSS);
+}
+
+static void Busy(uint64_t *counter, uint32_t us)
+{
+    host_time_us += us;
+    *counter += us;
+}
+
+/**
+ * @brief  Erase in progress: bits are set to 1 in no particular order.
+ */
+static void PartialErase(uint32_t addr)
+{
+    uint8_t *sector = NorAt(addr, NOR_SECTOR_SIZE);
+
+    for (uint32_t i = 0U; i < NOR_SECTOR_SIZE; i++) sector[i] |= (uint8_t)HostRandom();
+}
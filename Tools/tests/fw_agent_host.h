@@ -0,0 +1,77 @@
+/**
+ ******************************************************************************
+ * File Name          : fw_agent_host.h
+ * Description        : host fakes behind the stub headers in stubs/, used to
+ *                      run the real firmware_update_agent.c on a PC
+ ******************************************************************************
+ *
+ * The fakes model what the agent relies on across a power loss:
+ *  - N25Q128A NOR: erase sets a 64 KB sector to 0xFF and takes
+ *    HOST_ERASE_MS, programming can only clear bits (old AND new) and
+ *    takes HOST_PAGE_PROGRAM_US per started 256-byte page,
+ *  - I2C EEPROM: byte array, HOST_EE_WRITE_MS per started 32-byte page,
+ *  - HAL tick: advanced by the test, by status polls and by the time the
+ *    NOR and EEPROM operations block the caller (counted per kind).
+ * NOR and EEPROM live in HostFlash_t, which HostFlash_Create() maps shared,
+ * so a forked "panel" can lose power (_exit) in the middle of a write and
+ * the parent sees exactly what survived.
+ *
+ * Every NOR program, NOR erase and EEPROM write is one step. When the step
+ * counter reaches host_kill_step the operation is left half done (random
+ * prefix programmed, sector partly erased) and the process exits with
+ * HOST_EXIT_POWER_LOSS. When it reaches host_fail_step a NOR program
+ * returns QSPI_ERROR instead.
+ *
+ ******************************************************************************
+ */
+#ifndef __FW_AGENT_HOST_H__
+#define __FW_AGENT_HOST_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "TinyFrame.h"
+
+/* Exported Define -----------------------------------------------------------*/
+#define HOST_NOR_BASE           0x00100000U     /* staging zone in the QSPI map */
+#define HOST_NOR_SIZE           0x00100000U     /* 16 sectors of 64 KB */
+#define HOST_EE_SIZE            0x00001000U
+#define HOST_ERASE_MS           700U            /* N25Q128A sector erase, typ. */
+#define HOST_PAGE_PROGRAM_US    500U            /* N25Q128A page program, typ. */
+#define HOST_EE_WRITE_MS        5U              /* 24C page write */
+#define HOST_EXIT_POWER_LOSS    3
+#define HOST_TF_ADDRESS         5U              /* tfifa of the panel */
+
+/* Exported Type -------------------------------------------------------------*/
+typedef struct
+{
+    uint8_t nor[HOST_NOR_SIZE];
+    uint8_t ee[HOST_EE_SIZE];
+} HostFlash_t;
+
+/* Exported Variable ---------------------------------------------------------*/
+extern HostFlash_t *host_flash;
+extern uint64_t host_time_us;          /* HAL_GetTick() is this / 1000 */
+extern uint32_t host_steps;             /* persistent operations so far */
+extern uint32_t host_kill_step;         /* 0 = never lose power */
+extern uint32_t host_fail_step;         /* 0 = never fail a NOR program */
+extern uint32_t host_rng;
+extern const uint8_t *host_image;       /* what GetFwInfo() validates against */
+extern uint32_t host_image_size;
+extern bool     host_restarted;         /* SYSRestart() was called */
+extern uint32_t host_irq_masked;        /* > 0 while interrupts are masked */
+extern uint32_t host_irq_disables;
+extern uint64_t host_program_us;        /* caller blocked in NOR page programs */
+extern uint64_t host_ee_us;             /* caller blocked in EEPROM writes */
+extern uint64_t host_erase_wait_us;     /* caller blocked polling or erasing NOR */
+extern uint32_t host_erases;            /* sectors erased */
+extern uint8_t  host_tx[TF_SENDBUF_LEN];
+extern uint16_t host_tx_len;
+extern uint32_t host_tx_count;
+
+/* Exported Function ---------------------------------------------------------*/
+void     HostFlash_Create(void);
+void     HostFlash_Reset(uint32_t seed);
+uint32_t HostCrc32(const uint8_t *buf, uint32_t len);
+uint32_t HostRandom(void);
+
+#endif /* __FW_AGENT_HOST_H__ */
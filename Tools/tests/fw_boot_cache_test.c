@@ -0,0 +1,260 @@
+/**
+ ******************************************************************************
+ * File Name          : fw_boot_cache_test.c
+ * Description        : host test, verified boot record decision table
+ ******************************************************************************
+ *
+ * Runs Common/fw_boot_cache.c through every combination of record state,
+ * running image header and boot events and compares FwBoot_Decide() with
+ * the expected decision. The record is stored in a model of the RTC
+ * backup registers the way ICBL/Src/main.c does it, so the test also
+ * checks that it stays out of the registers the application and the
+ * bootloader control use, and that erased or partly written registers
+ * always lead to a full check.
+ *
+ * The boot sequence of the bootloader is replayed, too: a watchdog reset
+ * has to force full checks until one completes, even when power is lost
+ * during the full check and the reset flags are gone on the next boot.
+ *
+ * Build (Linux):
+ *   make -C Tools/tests fw_boot_cache_test
+ *
+ ******************************************************************************
+ */
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "fw_boot_cache.h"
+#include "host_test.h"
+/* Private Define ------------------------------------------------------------*/
+#define BKP_REGS            32U             /* RTC_BKP_DR0..DR31 */
+#define APP_REG_FIRST       1U              /* IC/Src/main.c: RTC_BKP_DR1..DR5 */
+#define APP_REG_LAST        5U
+#define BLDR_REG_FIRST      10U             /* common.h: BLDR_CTRL/STAT/CNT_REG */
+#define BLDR_REG_LAST       12U
+#define FWBOOT_BKP_REG      13U             /* common.h: RTC_BKP_DR13 */
+#define IMG_SIZE            0x00051234U
+#define IMG_CRC             0xC0FFEE01U
+#define IMG_VERSION         0x00000304U
+/* Private Type --------------------------------------------------------------*/
+typedef enum
+{
+    REC_NONE,                               /* registers erased */
+    REC_CORRUPT,                            /* check word does not match */
+    REC_VALID,
+    REC_FAIL_FLAG,
+    REC_PERIOD,                             /* FWBOOT_FULL_CHECK_PERIOD fast boots done */
+    REC_STATES
+} RecState_t;
+
+typedef enum
+{
+    HDR_SAME,
+    HDR_SIZE,
+    HDR_CRC,
+    HDR_VERSION,
+    HDR_STATES
+} HdrState_t;
+
+typedef struct
+{
+    bool hdr_valid;
+    bool new_image;
+    bool watchdog;
+    bool power_loss;                        /* before the full check completes */
+} Boot_t;
+/* Private Variable ----------------------------------------------------------*/
+static uint32_t bkp[BKP_REGS];
+static uint32_t full_checks;
+/* Private Function Prototype ------------------------------------------------*/
+static void Load(FwBootRecTypeDef *rec);
+static void Save(const FwBootRecTypeDef *rec);
+static void MakeRecord(RecState_t state);
+static uint8_t Expected(RecState_t rec, HdrState_t hdr, uint8_t events);
+static bool Boot(const Boot_t *b);
+/* Program Code --------------------------------------------------------------*/
+int main(void)
+{
+    static const char *names[] = { "fast", "no record", "hdr invalid", "hdr changed", "new image", "fail", "periodic" };
+    static const Boot_t normal = { true, false, false, false };
+    static const Boot_t watchdog = { true, false, true, false };
+    static const Boot_t wdg_lost = { true, false, true, true };
+    unsigned hist[7] = { 0U };
+    FwBootRecTypeDef rec;
+    Boot_t b;
+
+    // Record layout in the backup registers.
+    CHECK((FWBOOT_BKP_REG + FWBOOT_RECORD_WORDS) <= BKP_REGS);
+    CHECK(FWBOOT_BKP_REG > APP_REG_LAST);
+    CHECK((FWBOOT_BKP_REG > BLDR_REG_LAST) || ((FWBOOT_BKP_REG + FWBOOT_RECORD_WORDS) <= BLDR_REG_FIRST));
+    CHECK(sizeof(FwBootRecTypeDef) <= (FWBOOT_RECORD_WORDS * sizeof(uint32_t)));
+
+    // Decision table.
+    for (uint8_t r = 0U; r < REC_STATES; r++)
+    {
+        for (uint8_t h = 0U; h < HDR_STATES; h++)
+        {
+            for (uint8_t ev = 0U; ev < 8U; ev++)
+            {
+                uint32_t size = (h == HDR_SIZE) ? (IMG_SIZE + 4U) : IMG_SIZE;
+                uint32_t crc = (h == HDR_CRC) ? ~IMG_CRC : IMG_CRC;
+                uint32_t version = (h == HDR_VERSION) ? (IMG_VERSION + 1U) : IMG_VERSION;
+                uint8_t got, want;
+
+                MakeRecord((RecState_t)r);
+                Load(&rec);
+                got = FwBoot_Decide(&rec, size, crc, version, ev);
+                want = Expected((RecState_t)r, (HdrState_t)h, ev);
+                CHECK(got == want);
+                if (got != want) printf("  rec %u hdr %u events 0x%02x: got %u, want %u\n", r, h, ev, got, want);
+                if (got < 7U) hist[got]++;
+            }
+        }
+    }
+    printf("%u cases:", (unsigned)(REC_STATES * HDR_STATES * 8U));
+    for (uint8_t i = 0U; i < 7U; i++) printf(" %s %u%s", names[i], hist[i], (i < 6U) ? "," : "\n");
+
+    // Registers the record does not own are left alone.
+    memset(bkp, 0xA5, sizeof(bkp));
+    FwBoot_Record(&rec, IMG_SIZE, IMG_CRC, IMG_VERSION);
+    Save(&rec);
+    for (uint32_t i = 0U; i < BKP_REGS; i++)
+    {
+        if ((i < FWBOOT_BKP_REG) || (i >= (FWBOOT_BKP_REG + FWBOOT_RECORD_WORDS))) CHECK(bkp[i] == 0xA5A5A5A5U);
+    }
+
+    // Every single bit flip is rejected, a partly written record never
+    // turns a failed one into a fast boot.
+    FwBoot_Record(&rec, IMG_SIZE, IMG_CRC, IMG_VERSION);
+    Save(&rec);
+    for (uint32_t w = 0U; w < FWBOOT_RECORD_WORDS; w++)
+    {
+        for (uint32_t bit = 0U; bit < 32U; bit++)
+        {
+            bkp[FWBOOT_BKP_REG + w] ^= (1U << bit);
+            Load(&rec);
+            CHECK(FwBoot_Decide(&rec, IMG_SIZE, IMG_CRC, IMG_VERSION, 0U) == FWBOOT_FULL_NO_RECORD);
+            bkp[FWBOOT_BKP_REG + w] ^= (1U << bit);
+        }
+    }
+    for (uint32_t w = 0U; w < (FWBOOT_RECORD_WORDS - 1U); w++)
+    {
+        FwBoot_Record(&rec, IMG_SIZE, IMG_CRC, IMG_VERSION);
+        FwBoot_Fail(&rec);
+        Save(&rec);
+        FwBoot_Record(&rec, IMG_SIZE, IMG_CRC, IMG_VERSION);
+        for (uint32_t i = 0U; i <= w; i++)
+        {
+            uint32_t words[FWBOOT_RECORD_WORDS];
+            FwBoot_Pack(&rec, words);
+            bkp[FWBOOT_BKP_REG + i] = words[i];
+        }
+        Load(&rec);
+        CHECK(FwBoot_Decide(&rec, IMG_SIZE, IMG_CRC, IMG_VERSION, 0U) != FWBOOT_FAST);
+    }
+
+    // Boot sequence: periodic full check.
+    memset(bkp, 0, sizeof(bkp));
+    full_checks = 0U;
+    for (uint32_t i = 0U; i < ((FWBOOT_FULL_CHECK_PERIOD + 1U) * 3U); i++) Boot(&normal);
+    CHECK(full_checks == 3U);
+
+    // Watchdog reset: full check, then fast again.
+    full_checks = 0U;
+    CHECK(!Boot(&watchdog));
+    CHECK(Boot(&normal));
+    CHECK(full_checks == 1U);
+
+    // Watchdog reset and power lost during the full check: the next boots
+    // have no reset flag, the record still forces the full check.
+    full_checks = 0U;
+    CHECK(!Boot(&wdg_lost));
+    CHECK(full_checks == 0U);
+    b = normal;
+    b.power_loss = true;
+    CHECK(!Boot(&b));
+    CHECK(!Boot(&normal));
+    CHECK(full_checks == 1U);
+    CHECK(Boot(&normal));
+
+    // Invalid header and pending update never start fast.
+    b = normal;
+    b.hdr_valid = false;
+    CHECK(!Boot(&b));
+    b = normal;
+    b.new_image = true;
+    CHECK(!Boot(&b));
+
+    return HOST_TEST_END("fw_boot_cache_test");
+}
+
+static void Load(FwBootRecTypeDef *rec)
+{
+    FwBoot_Unpack(rec, &bkp[FWBOOT_BKP_REG]);
+}
+
+static void Save(const FwBootRecTypeDef *rec)
+{
+    FwBoot_Pack(rec, &bkp[FWBOOT_BKP_REG]);
+}
+
+static void MakeRecord(RecState_t state)
+{
+    FwBootRecTypeDef rec;
+
+    memset(bkp, 0, sizeof(bkp));
+    if (state == REC_NONE) return;
+    FwBoot_Record(&rec, IMG_SIZE, IMG_CRC, IMG_VERSION);
+    if (state == REC_FAIL_FLAG) FwBoot_Fail(&rec);
+    if (state == REC_PERIOD) rec.fast_cnt = FWBOOT_FULL_CHECK_PERIOD;
+    Save(&rec);
+    if (state == REC_CORRUPT) bkp[FWBOOT_BKP_REG + 2U] ^= 0x00010000U;
+}
+
+/**
+ * @brief  The table as specified: first matching row wins.
+ */
+static uint8_t Expected(RecState_t rec, HdrState_t hdr, uint8_t events)
+{
+    if ((rec == REC_NONE) || (rec == REC_CORRUPT)) return FWBOOT_FULL_NO_RECORD;
+    if (events & FWBOOT_EVT_HDR_INVALID) return FWBOOT_FULL_HDR_INVALID;
+    if ((events & FWBOOT_EVT_FAIL) || (rec == REC_FAIL_FLAG)) return FWBOOT_FULL_FAIL;
+    if (events & FWBOOT_EVT_NEW_IMAGE) return FWBOOT_FULL_NEW_IMAGE;
+    if (hdr != HDR_SAME) return FWBOOT_FULL_HDR_CHANGED;
+    if (rec == REC_PERIOD) return FWBOOT_FULL_PERIODIC;
+    return FWBOOT_FAST;
+}
+
+/**
+ * @brief  One boot, in the order of ICBL/Src/main.c.
+ * @retval true when the image was started without the full check.
+ */
+static bool Boot(const Boot_t *b)
+{
+    FwBootRecTypeDef rec;
+    uint8_t events = 0U;
+
+    Load(&rec);
+    if (!b->hdr_valid) events |= FWBOOT_EVT_HDR_INVALID;
+    if (b->new_image) events |= FWBOOT_EVT_NEW_IMAGE;
+    if (b->watchdog) events |= FWBOOT_EVT_FAIL;
+    if (events & FWBOOT_EVT_FAIL)
+    {
+        FwBoot_Fail(&rec);
+        Save(&rec);
+    }
+    if (FwBoot_Decide(&rec, IMG_SIZE, IMG_CRC, IMG_VERSION, events) == FWBOOT_FAST)
+    {
+        FwBoot_CountFast(&rec);
+        Save(&rec);
+        return true;
+    }
+    if (b->power_loss) return false;
+    full_checks++;
+    if (b->hdr_valid && !b->new_image) FwBoot_Record(&rec, IMG_SIZE, IMG_CRC, IMG_VERSION);
+    else FwBoot_Invalidate(&rec);
+    Save(&rec);
+    return false;
+}
@@ -0,0 +1,259 @@
+/**
+ ******************************************************************************
+ * File Name          : fw_flash_timing_test.c
+ * Description        : host test, NOR timing model and critical path of a
+ *                      unicast firmware transfer with erase-ahead staging
+ ******************************************************************************
+ *
+ * Runs the real IC/Src/firmware_update_agent.c against the timed NOR and
+ * EEPROM models of fw_agent_host.c (sector erase 700 ms, page program
+ * 0.5 ms, EEPROM page 5 ms) and a stop-and-wait server at 115200 baud:
+ * each DATA packet waits for its ACK, a packet that is not acknowledged
+ * (write queue full) is resent after ACK_TIMEOUT_MS. The main loop
+ * (FwUpdateAgent_Service) runs once per millisecond of bus time.
+ *
+ * For a full 960 KB image and both packet sizes the test reports bus
+ * time, stalls, NOR program, EEPROM and erase time, the total, the delay
+ * from START to its ACK, and the total the old scheme (whole zone erased
+ * synchronously on START) would take. The resource with the larger busy
+ * time is the critical path.
+ *
+ * Each session uses a new image version, so it never resumes the previous
+ * one. It also checks the failure report: a NOR program that fails after its
+ * packet was acknowledged has to reach the server as SUB_CMD_DATA_NACK
+ * on the next packet, and the retried session has to start from zero.
+ *
+ * Build (Linux):
+ *   make -C Tools/tests fw_flash_timing_test
+ *
+ ******************************************************************************
+ */
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "firmware_update_agent.h"
+#include "fw_agent_host.h"
+#include "host_test.h"
+/* Private Define ------------------------------------------------------------*/
+#define IMAGE_SIZE          0x000F0000U     /* RT_APPL_SIZE */
+#define SECTOR_SIZE         0x00010000U
+#define TF_OVERHEAD         9U              /* SOF, ID, LEN, TYPE, two CRC16 */
+#define BYTE_US             87U             /* 10 bits at 115200 baud */
+#define ACK_TIMEOUT_MS      100U
+#define MAX_MISSES          100U
+#define SLOT_SIZE           1018U           /* FWU_WRITE_SLOT_SIZE */
+/* Private Type --------------------------------------------------------------*/
+typedef struct
+{
+    uint32_t packets;
+    uint32_t stalls;                        /* packets resent after ACK_TIMEOUT_MS */
+    uint64_t bus_us;                        /* DATA and ACK frames on the wire */
+    uint64_t stall_us;
+    uint64_t start_ack_us;                  /* START to START_ACK */
+    uint64_t total_us;                      /* START to FINISH_ACK */
+    bool     nacked;                        /* got SUB_CMD_DATA_NACK */
+    uint8_t  nack_reason;
+    uint32_t offset;                        /* START_ACK resume offset */
+    bool     validated;
+} Run_t;
+/* Private Variable ----------------------------------------------------------*/
+static uint8_t image[IMAGE_SIZE];
+static uint8_t tf_dummy;
+/* Private Function Prototype ------------------------------------------------*/
+static void ResetCounters(void);
+static void RunSession(uint16_t packet, uint32_t version, Run_t *run);
+static void Send(const uint8_t *data, uint16_t len);
+static void Pump(uint64_t us);
+static uint64_t Wire(uint32_t bytes);
+static double Sec(uint64_t us);
+/* Program Code --------------------------------------------------------------*/
+int main(void)
+{
+    static const uint16_t packets[] = { 256U, SLOT_SIZE };
+    uint32_t sectors = (IMAGE_SIZE + SECTOR_SIZE - 1U) / SECTOR_SIZE;
+    Run_t run;
+    uint8_t reason;
+
+    HostFlash_Create();
+    HostFlash_Reset(0x1234567U);
+    for (uint32_t i = 0U; i < IMAGE_SIZE; i++) image[i] = (uint8_t)HostRandom();
+    host_image = image;
+    host_image_size = IMAGE_SIZE;
+
+    host_irq_disables = 0U;
+    FwUpdateAgent_Init();
+    CHECK(host_irq_disables > 0U);          /* write queue reset with IRQs masked */
+    CHECK(host_irq_masked == 0U);
+
+    printf("960 KB image, %u sectors, erase %u ms, page program %u us, EEPROM page %u ms, 115200 baud\n",
+           sectors, HOST_ERASE_MS, HOST_PAGE_PROGRAM_US, HOST_EE_WRITE_MS);
+    printf("packet  frames  stalls   bus s  stall s  program s  eeprom s  erases  erase s  total s"
+           "  START->ACK ms  erase@START s  critical path\n");
+    for (uint8_t p = 0U; p < (sizeof(packets) / sizeof(packets[0])); p++)
+    {
+        uint64_t erase_us, nor_us, old_us;
+
+        HostFlash_Reset(0x1234567U + p);
+        ResetCounters();
+        RunSession(packets[p], 0x0300U + p, &run);
+        CHECK(run.validated);
+        CHECK(host_erases == sectors);
+        CHECK(run.start_ack_us < 10000U);
+
+        erase_us = (uint64_t)host_erases * HOST_ERASE_MS * 1000U;
+        nor_us = erase_us + host_program_us;
+        // Before erase-ahead the whole zone was erased before START_ACK and
+        // nothing overlapped it.
+        old_us = erase_us + (run.total_us - run.stall_us);
+        printf("%6u  %6u  %6u  %6.1f  %7.2f  %9.2f  %8.2f  %6u  %7.1f  %7.1f  %13.1f  %13.1f  %s\n",
+               packets[p], run.packets, run.stalls, Sec(run.bus_us), Sec(run.stall_us), Sec(host_program_us),
+               Sec(host_ee_us), host_erases, Sec(erase_us), Sec(run.total_us), (double)run.start_ack_us / 1000.0,
+               Sec(old_us), (run.bus_us >= nor_us) ? "bus" : "NOR");
+        CHECK(run.total_us < old_us);
+        // NOR cannot program while it erases, so the write queue has to hold
+        // one erase time of packets. Eight full slots do; eight small
+        // packets do not, and every erase then stalls the server.
+        if (packets[p] == SLOT_SIZE) CHECK(run.stall_us <= (ACK_TIMEOUT_MS * 1000U));
+    }
+
+    // A NOR program fails after its packet was acknowledged.
+    HostFlash_Reset(0x7654321U);
+    ResetCounters();
+    host_fail_step = 40U;
+    RunSession(256U, 0x0310U, &run);
+    CHECK(run.nacked);
+    CHECK(run.nack_reason == 4U);           /* NACK_REASON_WRITE_FAILED */
+    CHECK(!run.validated);
+    reason = run.nack_reason;
+    host_fail_step = 0U;
+    RunSession(256U, 0x0310U, &run);
+    CHECK(run.offset == 0U);                /* record was invalidated */
+    CHECK(run.validated);
+    printf("write failure at step 40: DATA_NACK reason %u, retry from offset %u validated: %s\n",
+           reason, (unsigned)run.offset, run.validated ? "yes" : "no");
+
+    return HOST_TEST_END("fw_flash_timing_test");
+}
+
+static void ResetCounters(void)
+{
+    host_program_us = 0U;
+    host_ee_us = 0U;
+    host_erase_wait_us = 0U;
+    host_erases = 0U;
+    host_steps = 0U;
+    host_restarted = false;
+}
+
+/**
+ * @brief  Stop-and-wait unicast session: START, DATA, FINISH.
+ */
+static void RunSession(uint16_t packet, uint32_t version, Run_t *run)
+{
+    static uint8_t msg[6U + SLOT_SIZE];
+    FwInfoTypeDef info = { IMAGE_SIZE, HostCrc32(image, IMAGE_SIZE), version, 0U, HOST_NOR_BASE };
+    uint64_t start = host_time_us;
+    uint32_t seq = 0U, misses = 0U, count;
+    uint32_t offset;
+
+    memset(run, 0, sizeof(Run_t));
+    // After SYSRestart() the host keeps running: power the agent up again.
+    FwUpdateAgent_Init();
+    msg[0] = 0x01;                          /* SUB_CMD_START_REQUEST */
+    msg[1] = HOST_TF_ADDRESS;
+    memcpy(&msg[2], &info, sizeof(info));
+    msg[22] = 0x01;                         /* FWU_START_FLAG_RESUME */
+    Pump(Wire(23U));
+    count = host_tx_count;
+    Send(msg, 23U);
+    if ((host_tx_count == count) || (host_tx[0] != 0x02)) return;
+    run->start_ack_us = (host_time_us - start) + Wire(6U);
+    Pump(Wire(6U));
+    memcpy(&run->offset, &host_tx[2], sizeof(uint32_t));
+    offset = run->offset;
+
+    while (offset < IMAGE_SIZE)
+    {
+        uint32_t len = IMAGE_SIZE - offset;
+        uint32_t acked;
+
+        if (len > packet) len = packet;
+        msg[0] = 0x10;                      /* SUB_CMD_DATA_PACKET */
+        memcpy(&msg[2], &seq, sizeof(uint32_t));
+        memcpy(&msg[6], &image[offset], len);
+        Pump(Wire(6U + len));
+        run->bus_us += Wire(6U + len);
+        run->packets++;
+        count = host_tx_count;
+        Send(msg, (uint16_t)(6U + len));
+        memcpy(&acked, &host_tx[2], sizeof(uint32_t));
+        if ((host_tx_count != count) && (host_tx[0] == 0x11) && (acked == seq))
+        {
+            Pump(Wire(6U));
+            run->bus_us += Wire(6U);
+            offset += len;
+            seq++;
+            misses = 0U;
+        }
+        else if ((host_tx_count != count) && (host_tx[0] == 0x12))
+        {
+            run->nacked = true;
+            run->nack_reason = host_tx[6];
+            return;
+        }
+        else
+        {
+            if (++misses > MAX_MISSES) return;
+            run->stalls++;
+            run->stall_us += ACK_TIMEOUT_MS * 1000U;
+            Pump(ACK_TIMEOUT_MS * 1000U);
+        }
+    }
+
+    msg[0] = 0x20;                          /* SUB_CMD_FINISH_REQUEST */
+    count = host_tx_count;
+    Pump(Wire(2U));
+    Send(msg, 2U);
+    for (uint32_t i = 0U; (i < 10000U) && !host_restarted; i++) Pump(1000U);
+    run->validated = host_restarted && (host_tx[0] == 0x21);
+    run->total_us = host_time_us - start;
+}
+
+static void Send(const uint8_t *data, uint16_t len)
+{
+    TF_Msg msg;
+
+    memset(&msg, 0, sizeof(msg));
+    msg.data = data;
+    msg.len = len;
+    FwUpdateAgent_ProcessMessage((TinyFrame *)(void *)&tf_dummy, &msg);
+}
+
+/**
+ * @brief  Lets `us` pass with the main loop running once per millisecond.
+ * @note   Time the loop spends blocked in NOR/EEPROM calls counts against
+ *         the same clock, so a slow main loop delays the server, too.
+ */
+static void Pump(uint64_t us)
+{
+    uint64_t end = host_time_us + us;
+
+    while (host_time_us < end)
+    {
+        host_time_us += ((end - host_time_us) < 1000U) ? (end - host_time_us) : 1000U;
+        FwUpdateAgent_Service();
+    }
+}
+
+static uint64_t Wire(uint32_t bytes)
+{
+    return (uint64_t)(bytes + TF_OVERHEAD) * BYTE_US;
+}
+
+static double Sec(uint64_t us)
+{
+    return (double)us / 1e6;
+}
@@ -0,0 +1,717 @@
+/**
+ ******************************************************************************
+ * File Name          : fw_mcast_test.c
+ * Description        : host test, multicast firmware distribution to N panels
+ *                      running the real agent, with packet loss, NACK
+ *                      suppression and repair rounds
+ ******************************************************************************
+ *
+ * Every panel is a forked process running IC/Src/firmware_update_agent.c
+ * on its own NOR and EEPROM model (fw_agent_host.c), with its own tfifa
+ * and UID, so each draws its own NACK back-off. The parent is the server
+ * and the RS485 bus: it sends the SUB_CMD_MCAST_* frames in their wire
+ * format over a pipe to each panel, together with the bus time at which
+ * the frame ends, and the panel runs its main loop (FwUpdateAgent_Service
+ * every millisecond) up to that time before the frame is handed to
+ * FwUpdateAgent_ProcessMessage(). Blocks are written through the agent's
+ * write queue while the staging zone is erased ahead of them, so a full
+ * queue drops blocks exactly as on the panel.
+ *
+ * The server waits START_SETTLE_MS after MCAST_START, sends the image,
+ * then MCAST_POLL and listens for the NACK window. A NACK a panel sends
+ * is parsed from its wire format, reaches the server and is overheard by
+ * the other panels, each of which can lose it (data, polls, NACKs and
+ * FINISH are lost independently with the given probability). The server
+ * resends the union of the requested blocks and sends MCAST_FINISH after
+ * QUIET_POLLS polls in a row without a NACK. Every panel has to validate
+ * the image (SYSRestart) with the image in its NOR.
+ *
+ * Each session also runs with NACKs not overheard, which is the agent
+ * without suppression. The test reports data blocks sent, repair rounds,
+ * NACKs, blocks requested and NACK bytes for both, and checks that
+ * suppression saves most of the NACK traffic when the panels miss the
+ * same blocks (those dropped while a sector is erased) and a real share
+ * of it under low independent loss. A single panel checks the wire parsing first: a bad START,
+ * a foreign session, a block of the wrong length, a burst that overflows
+ * the write queue, malformed and own NACKs, and the exact ranges it asks
+ * for before and after overhearing a NACK.
+ *
+ * Build (Linux):
+ *   make -C Tools/tests fw_mcast_test
+ *
+ ******************************************************************************
+ */
+/* Includes ------------------------------------------------------------------*/
+#define _DEFAULT_SOURCE                 /* fork, pipe */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "firmware_update_agent.h"
+#include "fw_block_map.h"
+#include "rs485.h"
+#include "fw_agent_host.h"
+#include "host_test.h"
+/* Private Define ------------------------------------------------------------*/
+#define MAX_PANELS          64U
+#define MAX_RANGES          16U             /* FWU_MCAST_MAX_NACK_RANGES */
+#define NACK_WINDOW_MS      500U            /* FWU_MCAST_NACK_WINDOW */
+#define QUEUE_SLOTS         7U              /* FWU_WRITE_QUEUE_DEPTH - 1 */
+#define QUIET_POLLS         3U              /* polls without a NACK before FINISH */
+#define MAX_POLLS           60U
+#define REPEATS             5U              /* START and FINISH are sent this often */
+#define START_SETTLE_MS     1000U           /* first sector erased before data */
+#define TICK_MS             5U              /* NACK window resolution */
+#define IMAGE_SIZE          300000U
+#define BLOCK_SIZE          512U
+#define BLOCKS              ((IMAGE_SIZE + BLOCK_SIZE - 1U) / BLOCK_SIZE)
+#define SESSION_ID          0x5A17U
+#define TF_OVERHEAD         9U              /* SOF, ID, LEN, TYPE, two CRC16 */
+#define BYTE_US             87U             /* 115200 baud, 10 bits per byte */
+#define OP_FRAME            1U
+#define OP_TICK             2U              /* run to the time, then reply */
+#define OP_QUIT             3U
+#define SUB_MCAST_START     0x30U
+#define SUB_MCAST_DATA      0x31U
+#define SUB_MCAST_POLL      0x32U
+#define SUB_MCAST_NACK      0x33U
+#define SUB_MCAST_FINISH    0x34U
+/* Private Type --------------------------------------------------------------*/
+typedef struct
+{
+    uint8_t  op;
+    uint8_t  pad;
+    uint16_t len;
+    uint32_t pad2;
+    uint64_t time_us;                       /* bus time at the end of the frame */
+} Command_t;
+
+typedef struct
+{
+    uint8_t  restarted;                     /* SYSRestart() was called */
+    uint8_t  sent;                          /* frames sent since the last reply */
+    uint16_t len;
+    uint8_t  data[TF_SENDBUF_LEN];          /* the last frame sent */
+} Reply_t;
+
+typedef struct
+{
+    pid_t pid;
+    int   to;
+    int   from;
+    bool  restarted;
+} Panel_t;
+
+typedef struct
+{
+    uint32_t data_sent;
+    uint32_t polls;
+    uint32_t rounds;                        /* polls that led to a resend */
+    uint32_t nacks;
+    uint32_t nack_blocks;                   /* blocks listed in NACKs */
+    uint32_t nack_bytes;
+    uint64_t bus_us;
+    uint32_t validated;
+} Stats_t;
+/* Private Variable ----------------------------------------------------------*/
+static uint8_t image[IMAGE_SIZE];
+static Panel_t panels[MAX_PANELS];
+static uint8_t panel_count;
+static uint64_t bus_us;
+static uint32_t loss_rng;
+/* Private Function Prototype ------------------------------------------------*/
+static uint32_t Xorshift(uint32_t *state);
+static bool Lost(uint32_t loss_permille);
+static void WriteAll(int fd, const void *buf, size_t len);
+static bool ReadAll(int fd, void *buf, size_t len);
+static void Spawn(uint8_t count);
+static int Panel(uint8_t index, int from, int to);
+static void Send(Panel_t *p, uint8_t op, const uint8_t *frame, uint16_t len);
+static void Broadcast(const uint8_t *frame, uint16_t len, uint32_t loss_permille, const Panel_t *except);
+static uint32_t Tick(Reply_t *replies);
+static uint32_t Quit(void);
+static uint16_t StartFrame(uint8_t *f, uint16_t block_size, uint16_t session);
+static uint16_t DataFrame(uint8_t *f, uint16_t session, uint32_t block);
+static uint16_t PollFrame(uint8_t *f, uint16_t window_ms);
+static uint8_t ParseNack(const Reply_t *r, FwBlockRange_t *ranges);
+static void RunSession(uint8_t count, uint32_t loss_permille, bool overhear, Stats_t *st);
+static void WireChecks(void);
+static void UnitChecks(void);
+/* Program Code --------------------------------------------------------------*/
+int main(void)
+{
+    static const uint8_t counts[] = { 1U, 8U, 32U, 64U };
+    static const uint32_t losses[] = { 0U, 10U, 50U, 100U };
+    uint32_t rng = 0x9E3779B9U;
+
+    for (uint32_t i = 0U; i < IMAGE_SIZE; i++) image[i] = (uint8_t)Xorshift(&rng);
+    UnitChecks();
+    WireChecks();
+
+    printf("image %u B, block %u B, NACK window %u ms, %u quiet polls\n",
+           IMAGE_SIZE, BLOCK_SIZE, NACK_WINDOW_MS, QUIET_POLLS);
+    printf("panels  loss   sent overhead rounds nacks blocks nack B | no-suppr: nacks blocks nack B  saved  bus s  ok\n");
+    for (size_t c = 0; c < sizeof(counts); c++)
+    {
+        for (size_t l = 0; l < sizeof(losses) / sizeof(losses[0]); l++)
+        {
+            Stats_t with;
+            Stats_t without;
+            uint32_t saved;
+
+            loss_rng = 0x2545F491U;
+            RunSession(counts[c], losses[l], true, &with);
+            loss_rng = 0x2545F491U;
+            RunSession(counts[c], losses[l], false, &without);
+            saved = (without.nack_bytes != 0U) ? (100U - ((100U * with.nack_bytes) / without.nack_bytes)) : 0U;
+            printf("%6u %3u.%u%% %6u %7.1f%% %6u %5u %6u %6u | %15u %6u %6u %5u%% %6.1f  %s\n",
+                   counts[c], losses[l] / 10U, losses[l] % 10U, with.data_sent,
+                   100.0 * (double)(with.data_sent - BLOCKS) / (double)BLOCKS, with.rounds,
+                   with.nacks, with.nack_blocks, with.nack_bytes,
+                   without.nacks, without.nack_blocks, without.nack_bytes, saved,
+                   (double)with.bus_us / 1e6, (with.validated == counts[c]) ? "yes" : "NO");
+            CHECK(with.validated == counts[c]);
+            CHECK(without.validated == counts[c]);
+            // A single panel never hears a foreign NACK.
+            if (counts[c] == 1U) CHECK((with.nacks == without.nacks) && (with.nack_bytes == without.nack_bytes));
+            if (counts[c] < 8U) continue;
+            // Blocks dropped during a sector erase are the same on every panel:
+            // one NACK asks for them, the others stay quiet.
+            if (losses[l] == 0U) CHECK(saved >= 85U);
+            // Independent loss still overlaps between many panels.
+            if (losses[l] <= 10U) CHECK(saved >= 25U);
+            CHECK(with.nack_bytes < without.nack_bytes);
+        }
+    }
+    return HOST_TEST_END("fw_mcast_test");
+}
+
+/**
+ * @brief  xorshift32, the generator of the agent's NACK back-off.
+ */
+static uint32_t Xorshift(uint32_t *state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+static bool Lost(uint32_t loss_permille)
+{
+    return (Xorshift(&loss_rng) % 1000U) < loss_permille;
+}
+
+static void WriteAll(int fd, const void *buf, size_t len)
+{
+    const uint8_t *p = buf;
+
+    while (len > 0U)
+    {
+        ssize_t n = write(fd, p, len);
+
+        if (n <= 0) _exit(2);
+        p += n;
+        len -= (size_t)n;
+    }
+}
+
+static bool ReadAll(int fd, void *buf, size_t len)
+{
+    uint8_t *p = buf;
+
+    while (len > 0U)
+    {
+        ssize_t n = read(fd, p, len);
+
+        if (n <= 0) return false;
+        p += n;
+        len -= (size_t)n;
+    }
+    return true;
+}
+
+/**
+ * @brief  Forks `count` panels, each with a pipe in and a pipe out.
+ */
+static void Spawn(uint8_t count)
+{
+    fflush(stdout);
+    bus_us = 0U;
+    panel_count = count;
+    for (uint8_t i = 0U; i < count; i++)
+    {
+        int down[2], up[2];
+
+        if ((pipe(down) != 0) || (pipe(up) != 0)) exit(2);
+        panels[i].pid = fork();
+        if (panels[i].pid < 0) exit(2);
+        if (panels[i].pid == 0)
+        {
+            for (uint8_t j = 0U; j < i; j++)
+            {
+                close(panels[j].to);
+                close(panels[j].from);
+            }
+            close(down[1]);
+            close(up[0]);
+            _exit(Panel(i, down[0], up[1]));
+        }
+        close(down[0]);
+        close(up[1]);
+        panels[i].to = down[1];
+        panels[i].from = up[0];
+        panels[i].restarted = false;
+    }
+}
+
+/**
+ * @brief  One panel (forked child): the agent's main loop every millisecond
+ *         and the frames of the bus.
+ * @retval 0 when the image validated and is in NOR.
+ */
+static int Panel(uint8_t index, int from, int to)
+{
+    static uint8_t frame[TF_MAX_PAYLOAD_RX];
+    uint32_t reported = 0U;
+    Command_t cmd;
+    Reply_t reply;
+
+    host_flash = malloc(sizeof(HostFlash_t));
+    if (host_flash == NULL) return 2;
+    HostFlash_Reset(0x1234567U + ((uint32_t)index * 7919U));
+    host_uid = 0x12345678U ^ ((uint32_t)index * 0x9E3779B9U);
+    tfifa = (uint8_t)(index + 1U);
+    host_image = image;
+    host_image_size = IMAGE_SIZE;
+    host_time_us = 0U;
+    FwUpdateAgent_Init();
+    memset(&reply, 0, sizeof(reply));
+
+    while (ReadAll(from, &cmd, sizeof(cmd)))
+    {
+        if ((cmd.len > sizeof(frame)) || !ReadAll(from, frame, cmd.len)) return 2;
+        if (cmd.op == OP_QUIT) break;
+        while (!host_restarted && ((host_time_us + 1000U) <= cmd.time_us))
+        {
+            host_time_us += 1000U;
+            FwUpdateAgent_Service();
+        }
+        if (host_time_us < cmd.time_us) host_time_us = cmd.time_us;
+        if ((cmd.op == OP_FRAME) && !host_restarted)
+        {
+            TF_Msg msg;
+
+            memset(&msg, 0, sizeof(msg));
+            msg.data = frame;
+            msg.len = cmd.len;
+            FwUpdateAgent_ProcessMessage((TinyFrame *)(void *)&reply, &msg);
+        }
+        if (host_tx_count != reported)
+        {
+            reply.sent = (uint8_t)(reply.sent + (host_tx_count - reported));
+            reply.len = host_tx_len;
+            memcpy(reply.data, host_tx, host_tx_len);
+            reported = host_tx_count;
+        }
+        if (cmd.op == OP_TICK)
+        {
+            reply.restarted = host_restarted ? 1U : 0U;
+            WriteAll(to, &reply, sizeof(reply));
+            reply.sent = 0U;
+        }
+    }
+    return (host_restarted && (memcmp(host_flash->nor, image, IMAGE_SIZE) == 0)) ? 0 : 1;
+}
+
+static void Send(Panel_t *p, uint8_t op, const uint8_t *frame, uint16_t len)
+{
+    Command_t cmd;
+
+    memset(&cmd, 0, sizeof(cmd));
+    cmd.op = op;
+    cmd.len = len;
+    cmd.time_us = bus_us;
+    WriteAll(p->to, &cmd, sizeof(cmd));
+    if (len != 0U) WriteAll(p->to, frame, len);
+}
+
+/**
+ * @brief  Puts a frame on the bus; each panel but `except` may lose it.
+ */
+static void Broadcast(const uint8_t *frame, uint16_t len, uint32_t loss_permille, const Panel_t *except)
+{
+    bus_us += ((uint64_t)len + TF_OVERHEAD) * BYTE_US;
+    for (uint8_t i = 0U; i < panel_count; i++)
+    {
+        if ((&panels[i] == except) || Lost(loss_permille)) continue;
+        Send(&panels[i], OP_FRAME, frame, len);
+    }
+}
+
+/**
+ * @brief  Runs every panel up to the bus time and collects what it sent.
+ * @retval Number of panels that have restarted.
+ */
+static uint32_t Tick(Reply_t *replies)
+{
+    uint32_t restarted = 0U;
+
+    for (uint8_t i = 0U; i < panel_count; i++) Send(&panels[i], OP_TICK, NULL, 0U);
+    for (uint8_t i = 0U; i < panel_count; i++)
+    {
+        if (!ReadAll(panels[i].from, &replies[i], sizeof(Reply_t))) exit(2);
+        panels[i].restarted = (replies[i].restarted != 0U);
+        if (panels[i].restarted) restarted++;
+    }
+    return restarted;
+}
+
+/**
+ * @brief  Ends every panel.
+ * @retval Number of panels with the validated image in NOR.
+ */
+static uint32_t Quit(void)
+{
+    uint32_t ok = 0U;
+
+    for (uint8_t i = 0U; i < panel_count; i++)
+    {
+        int status;
+
+        Send(&panels[i], OP_QUIT, NULL, 0U);
+        close(panels[i].to);
+        if (waitpid(panels[i].pid, &status, 0) != panels[i].pid) exit(2);
+        close(panels[i].from);
+        if (WIFEXITED(status) && (WEXITSTATUS(status) == 0)) ok++;
+    }
+    return ok;
+}
+
+/**
+ * @brief  [0]=cmd [1]=0xFF [2..21]=FwInfo [22..23]=block size [24..25]=session
+ */
+static uint16_t StartFrame(uint8_t *f, uint16_t block_size, uint16_t session)
+{
+    FwInfoTypeDef info = { IMAGE_SIZE, HostCrc32(image, IMAGE_SIZE), 0x0300U, 0U, HOST_NOR_BASE };
+
+    f[0] = SUB_MCAST_START;
+    f[1] = 0xFFU;
+    memcpy(&f[2], &info, sizeof(info));
+    memcpy(&f[22], &block_size, sizeof(uint16_t));
+    memcpy(&f[24], &session, sizeof(uint16_t));
+    return 26U;
+}
+
+/**
+ * @brief  [0]=cmd [1]=0xFF [2..3]=session [4..7]=block [8..]=data
+ */
+static uint16_t DataFrame(uint8_t *f, uint16_t session, uint32_t block)
+{
+    uint32_t len = IMAGE_SIZE - (block * BLOCK_SIZE);
+
+    if (len > BLOCK_SIZE) len = BLOCK_SIZE;
+    f[0] = SUB_MCAST_DATA;
+    f[1] = 0xFFU;
+    memcpy(&f[2], &session, sizeof(uint16_t));
+    memcpy(&f[4], &block, sizeof(uint32_t));
+    memcpy(&f[8], &image[block * BLOCK_SIZE], len);
+    return (uint16_t)(8U + len);
+}
+
+/**
+ * @brief  [0]=cmd [1]=0xFF [2..3]=session [4..5]=NACK window in ms
+ */
+static uint16_t PollFrame(uint8_t *f, uint16_t window_ms)
+{
+    uint16_t session = SESSION_ID;
+
+    f[0] = SUB_MCAST_POLL;
+    f[1] = 0xFFU;
+    memcpy(&f[2], &session, sizeof(uint16_t));
+    memcpy(&f[4], &window_ms, sizeof(uint16_t));
+    return 6U;
+}
+
+/**
+ * @brief  Decodes a NACK the panel sent; every field has to be valid.
+ * @retval Number of ranges.
+ */
+static uint8_t ParseNack(const Reply_t *r, FwBlockRange_t *ranges)
+{
+    uint16_t session;
+    uint8_t count;
+
+    CHECK((r->len >= 5U) && (r->data[0] == SUB_MCAST_NACK));
+    if ((r->len < 5U) || (r->data[0] != SUB_MCAST_NACK)) return 0U;
+    memcpy(&session, &r->data[2], sizeof(uint16_t));
+    count = r->data[4];
+    CHECK((session == SESSION_ID) && (count >= 1U) && (count <= MAX_RANGES) && (r->len == (5U + (count * 6U))));
+    if ((count > MAX_RANGES) || (r->len != (5U + (count * 6U)))) return 0U;
+    for (uint8_t i = 0U; i < count; i++)
+    {
+        memcpy(&ranges[i].first, &r->data[5U + (i * 6U)], sizeof(uint32_t));
+        memcpy(&ranges[i].count, &r->data[9U + (i * 6U)], sizeof(uint16_t));
+        CHECK((ranges[i].count != 0U) && ((ranges[i].first + ranges[i].count) <= BLOCKS));
+        if (i != 0U) CHECK(ranges[i].first >= (ranges[i - 1U].first + ranges[i - 1U].count));
+    }
+    return count;
+}
+
+/**
+ * @brief  One multicast session from MCAST_START to MCAST_FINISH.
+ * @param  overhear  Foreign NACKs reach the panels (suppression on).
+ */
+static void RunSession(uint8_t count, uint32_t loss_permille, bool overhear, Stats_t *st)
+{
+    static uint8_t resend[BLOCKS];
+    static Reply_t replies[MAX_PANELS];
+    uint8_t frame[8U + BLOCK_SIZE];
+    uint32_t quiet = 0U;
+    bool first = true;
+
+    memset(st, 0, sizeof(Stats_t));
+    memset(resend, 1, sizeof(resend));
+    Spawn(count);
+    for (uint32_t i = 0U; i < REPEATS; i++) Broadcast(frame, StartFrame(frame, BLOCK_SIZE, SESSION_ID), loss_permille, NULL);
+    bus_us += START_SETTLE_MS * 1000U;
+
+    while ((quiet < QUIET_POLLS) && (st->polls < MAX_POLLS))
+    {
+        uint32_t sent = st->data_sent;
+        uint64_t window_end;
+        bool any = false;
+
+        // Data pass: the whole image first, then the requested blocks.
+        for (uint32_t b = 0U; b < BLOCKS; b++)
+        {
+            if (resend[b] == 0U) continue;
+            resend[b] = 0U;
+            st->data_sent++;
+            Broadcast(frame, DataFrame(frame, SESSION_ID, b), loss_permille, NULL);
+        }
+        if (!first && (st->data_sent != sent)) st->rounds++;
+        first = false;
+
+        // MCAST_POLL, then the NACK window; NACKs go out in the order their timers expire.
+        st->polls++;
+        Broadcast(frame, PollFrame(frame, NACK_WINDOW_MS), loss_permille, NULL);
+        window_end = bus_us + ((NACK_WINDOW_MS + (4U * TICK_MS)) * 1000U);
+        while (bus_us < window_end)
+        {
+            bus_us += TICK_MS * 1000U;
+            Tick(replies);
+            for (uint8_t i = 0U; i < count; i++)
+            {
+                FwBlockRange_t ranges[MAX_RANGES];
+                uint8_t n;
+
+                if (replies[i].sent == 0U) continue;
+                CHECK(replies[i].sent == 1U);
+                n = ParseNack(&replies[i], ranges);
+                st->nacks++;
+                st->nack_bytes += replies[i].len + TF_OVERHEAD;
+                for (uint8_t r = 0U; r < n; r++) st->nack_blocks += ranges[r].count;
+                if (!Lost(loss_permille))
+                {
+                    any = true;
+                    for (uint8_t r = 0U; r < n; r++) memset(&resend[ranges[r].first], 1, ranges[r].count);
+                }
+                if (overhear) Broadcast(replies[i].data, replies[i].len, loss_permille, &panels[i]);
+                else bus_us += ((uint64_t)replies[i].len + TF_OVERHEAD) * BYTE_US;
+            }
+        }
+        quiet = any ? 0U : quiet + 1U;
+    }
+
+    frame[0] = SUB_MCAST_FINISH;
+    frame[1] = 0xFFU;
+    frame[2] = (uint8_t)SESSION_ID;
+    frame[3] = (uint8_t)(SESSION_ID >> 8);
+    for (uint32_t i = 0U; i < REPEATS; i++) Broadcast(frame, 4U, loss_permille, NULL);
+    for (uint32_t ms = 0U; ms < 2000U; ms += 100U)
+    {
+        bus_us += 100000U;
+        if (Tick(replies) == count) break;
+    }
+    st->bus_us = bus_us;
+    st->validated = Quit();
+}
+
+/**
+ * @brief  Wire parsing, queue-full drop and suppression on a single panel.
+ */
+static void WireChecks(void)
+{
+    static uint8_t resend[BLOCKS];
+    static Reply_t reply[1];
+    uint32_t round;
+    uint8_t frame[8U + BLOCK_SIZE];
+    FwBlockRange_t r[MAX_RANGES];
+    uint16_t len;
+    uint8_t n;
+
+    loss_rng = 1U;
+    Spawn(1U);
+
+    // Block size below FWMAP_MIN_BLOCK_SIZE: START ignored, the panel stays idle.
+    Broadcast(frame, StartFrame(frame, 128U, SESSION_ID), 0U, NULL);
+    Broadcast(frame, PollFrame(frame, 10U), 0U, NULL);
+    bus_us += 100000U;
+    Tick(reply);
+    CHECK(reply[0].sent == 0U);
+
+    Broadcast(frame, StartFrame(frame, BLOCK_SIZE, SESSION_ID), 0U, NULL);
+    bus_us += START_SETTLE_MS * 1000U;
+    Tick(reply);
+    // Foreign session and a block of the wrong length are ignored.
+    Broadcast(frame, DataFrame(frame, SESSION_ID + 1U, 0U), 0U, NULL);
+    len = DataFrame(frame, SESSION_ID, 1U);
+    Broadcast(frame, (uint16_t)(len - 1U), 0U, NULL);
+    // Blocks 2..20 arrive back to back: the write queue takes QUEUE_SLOTS of them.
+    for (uint32_t b = 2U; b <= 20U; b++)
+    {
+        len = DataFrame(frame, SESSION_ID, b);
+        Send(&panels[0], OP_FRAME, frame, len);
+    }
+    bus_us += 2000000U;
+    Tick(reply);
+
+    Broadcast(frame, PollFrame(frame, 10U), 0U, NULL);
+    bus_us += 100000U;
+    Tick(reply);
+    CHECK(reply[0].sent == 1U);
+    n = ParseNack(&reply[0], r);
+    CHECK((n == 2U) && (r[0].first == 0U) && (r[0].count == 2U));
+    CHECK((r[1].first == (2U + QUEUE_SLOTS)) && (r[1].count == (BLOCKS - 2U - QUEUE_SLOTS)));
+    CHECK(reply[0].data[1] == 1U);
+
+    // Overheard: a malformed NACK and the panel's own address are ignored,
+    // a valid foreign NACK takes its blocks out of the panel's ranges.
+    Broadcast(frame, PollFrame(frame, 400U), 0U, NULL);
+    memcpy(frame, reply[0].data, reply[0].len);
+    frame[1] = 99U;
+    frame[4] = 3U;                      /* three ranges announced, two sent */
+    Broadcast(frame, reply[0].len, 0U, NULL);
+    frame[1] = 1U;                      /* the panel's own tfifa */
+    frame[4] = 1U;
+    Broadcast(frame, 11U, 0U, NULL);
+    frame[1] = 99U;
+    frame[4] = 2U;
+    r[0].first = 1U;                    /* block 0 stays, 1 was asked for */
+    r[0].count = 1U;
+    r[1].first = 20U;                   /* splits the second range */
+    r[1].count = 30U;
+    for (uint8_t i = 0U; i < 2U; i++)
+    {
+        memcpy(&frame[5U + (i * 6U)], &r[i].first, sizeof(uint32_t));
+        memcpy(&frame[9U + (i * 6U)], &r[i].count, sizeof(uint16_t));
+    }
+    Broadcast(frame, 17U, 0U, NULL);
+    bus_us += 600000U;
+    Tick(reply);
+    CHECK(reply[0].sent == 1U);
+    n = ParseNack(&reply[0], r);
+    CHECK((n == 3U) && (r[0].first == 0U) && (r[0].count == 1U));
+    CHECK((r[1].first == (2U + QUEUE_SLOTS)) && (r[1].count == (20U - 2U - QUEUE_SLOTS)));
+    CHECK((r[2].first == 50U) && (r[2].count == (BLOCKS - 50U)));
+
+    // The rest at bus speed: blocks arriving during a sector erase overflow
+    // the queue again and are asked for, the second round completes.
+    memset(resend, 1, sizeof(resend));
+    memset(&resend[2], 0, QUEUE_SLOTS);
+    for (round = 0U; round < 3U; round++)
+    {
+        for (uint32_t b = 0U; b < BLOCKS; b++)
+        {
+            if (resend[b] == 0U) continue;
+            resend[b] = 0U;
+            Broadcast(frame, DataFrame(frame, SESSION_ID, b), 0U, NULL);
+        }
+        Broadcast(frame, PollFrame(frame, 10U), 0U, NULL);
+        bus_us += 100000U;
+        Tick(reply);
+        if (reply[0].sent == 0U) break;
+        n = ParseNack(&reply[0], r);
+        for (uint8_t i = 0U; i < n; i++) memset(&resend[r[i].first], 1, r[i].count);
+    }
+    CHECK(round == 1U);
+    frame[0] = SUB_MCAST_FINISH;
+    frame[1] = 0xFFU;
+    frame[2] = (uint8_t)SESSION_ID;
+    frame[3] = (uint8_t)(SESSION_ID >> 8);
+    Broadcast(frame, 4U, 0U, NULL);
+    bus_us += 1000000U;
+    CHECK(Tick(reply) == 1U);
+    CHECK(Quit() == 1U);
+}
+
+/**
+ * @brief  Missing ranges and NACK suppression on hand-made bitmaps.
+ */
+static void UnitChecks(void)
+{
+    static FwBlockMap_t map;
+    FwBlockRange_t r[MAX_RANGES];
+    FwBlockRange_t heard[3];
+    uint8_t n;
+
+    CHECK(!FwBlockMap_Init(&map, IMAGE_SIZE, 128U));
+    CHECK(!FwBlockMap_Init(&map, FWMAP_MAX_IMAGE_SIZE + 1U, BLOCK_SIZE));
+    CHECK(FwBlockMap_Init(&map, 10U * 512U + 100U, 512U));
+    CHECK(map.total_blocks == 11U);
+    CHECK(FwBlockMap_BlockLength(&map, 10U) == 100U);
+    CHECK(FwBlockMap_BlockLength(&map, 11U) == 0U);
+
+    // Missing: 0, 3..5, 9..10
+    for (uint32_t b = 0U; b < 11U; b++)
+    {
+        if ((b != 0U) && ((b < 3U) || (b > 5U)) && (b < 9U)) CHECK(FwBlockMap_Set(&map, b));
+    }
+    CHECK(!FwBlockMap_Set(&map, 1U));
+    CHECK(map.received_blocks == 5U);
+    n = FwBlockMap_GetMissingRanges(&map, r, MAX_RANGES);
+    CHECK(n == 3U);
+    CHECK((r[0].first == 0U) && (r[0].count == 1U));
+    CHECK((r[1].first == 3U) && (r[1].count == 3U));
+    CHECK((r[2].first == 9U) && (r[2].count == 2U));
+    CHECK(FwBlockMap_GetMissingRanges(&map, r, 2U) == 2U);
+    CHECK(FwBlockMap_FirstMissing(&map, 1U) == 3U);
+
+    // Covered ranges go, a partly covered one is cut to what nobody asked for.
+    n = FwBlockMap_GetMissingRanges(&map, r, MAX_RANGES);
+    heard[0].first = 2U;
+    heard[0].count = 5U;    // covers 3..5
+    heard[1].first = 10U;
+    heard[1].count = 1U;    // covers only half of 9..10
+    n = FwBlockMap_SuppressRanges(r, n, MAX_RANGES, heard, 2U);
+    CHECK(n == 2U);
+    CHECK((r[0].first == 0U) && (r[0].count == 1U) && (r[1].first == 9U) && (r[1].count == 1U));
+
+    // A heard range inside one of ours splits it; without room the right part waits.
+    r[0].first = 0U;
+    r[0].count = 10U;
+    r[1].first = 20U;
+    r[1].count = 10U;
+    heard[0].first = 3U;
+    heard[0].count = 2U;
+    heard[1].first = 25U;
+    heard[1].count = 20U;
+    heard[2].first = 7U;
+    heard[2].count = 1U;
+    n = FwBlockMap_SuppressRanges(r, 2U, MAX_RANGES, heard, 3U);
+    CHECK(n == 4U);
+    CHECK((r[0].first == 0U) && (r[0].count == 3U) && (r[1].first == 5U) && (r[1].count == 2U));
+    CHECK((r[2].first == 8U) && (r[2].count == 2U) && (r[3].first == 20U) && (r[3].count == 5U));
+    r[0].first = 0U;
+    r[0].count = 10U;
+    n = FwBlockMap_SuppressRanges(r, 1U, 1U, heard, 1U);
+    CHECK((n == 1U) && (r[0].first == 0U) && (r[0].count == 3U));
+
+    for (uint32_t b = 0U; b < 11U; b++) FwBlockMap_Set(&map, b);
+    CHECK(FwBlockMap_IsComplete(&map));
+    CHECK(FwBlockMap_GetMissingRanges(&map, r, MAX_RANGES) == 0U);
+}
@@ -0,0 +1,354 @@
+/**
+ ******************************************************************************
+ * File Name          : fw_resume_test.c
+ * Description        : host test, power loss at random points of a unicast
+ *                      firmware transfer and resume from the EEPROM record
+ ******************************************************************************
+ *
+ * Runs the real IC/Src/firmware_update_agent.c against the NOR and EEPROM
+ * models of fw_agent_host.c. Every boot of the panel is a forked process
+ * that powers up (FwUpdateAgent_Init), is sent the image by a unicast
+ * server (START with the resume flag, DATA packets, FINISH) and either
+ * validates the image or loses power at a random NOR/EEPROM operation,
+ * leaving that operation half done. Some boots also get a failed NOR
+ * program, which takes the agent through Agent_HandleFailure(), and some
+ * are sent a different image, which has to replace the record of the
+ * first one.
+ *
+ * After every boot the parent decodes the record at EE_FW_RESUME exactly
+ * as Agent_LoadResume() would and checks that a record which would be
+ * trusted never lies:
+ *  - every block marked in its bitmap holds the image data in NOR,
+ *  - every other byte below erased_to can still be programmed to the
+ *    image (NOR programming only clears bits).
+ * Each trial keeps booting until the image validates and reports how
+ * many bytes the server had to send in total.
+ *
+ * Build (Linux):
+ *   make -C Tools/tests fw_resume_test
+ *
+ ******************************************************************************
+ */
+/* Includes ------------------------------------------------------------------*/
+#define _DEFAULT_SOURCE                 /* fork, mmap MAP_ANONYMOUS */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include "firmware_update_agent.h"
+#include "stm32746g_eeprom.h"
+#include "fw_agent_host.h"
+#include "host_test.h"
+/* Private Define ------------------------------------------------------------*/
+#define TRIALS              150U
+#define MAX_BOOTS           24U
+#define KILLED_BOOTS        6U          /* later boots run without power loss */
+#define IMAGE_A_SIZE        200003U
+#define IMAGE_B_SIZE        150001U
+#define PACKET_SIZE         256U
+#define PACKET_US           ((PACKET_SIZE + 15U) * 87U)     /* 115200 baud */
+#define MAX_MISSES          400U        /* unacknowledged resends before START again */
+#define MAX_SESSIONS        3U          /* START attempts per boot */
+#define EXIT_DONE           0
+#define EXIT_GAVE_UP        1
+/* Private Type --------------------------------------------------------------*/
+#pragma pack(push, 1)
+typedef struct                          /* FwResume_EepromHeader_t */
+{
+    uint16_t magic_number;
+    uint16_t block_size;
+    uint32_t size;
+    uint32_t crc32;
+    uint32_t version;
+    uint32_t staging_addr;
+    uint32_t erased_to;
+    uint16_t crc;
+} Header_t;
+#pragma pack(pop)
+
+typedef struct
+{
+    uint8_t  *data;
+    uint32_t size;
+    uint32_t crc32;
+    uint32_t version;
+} Image_t;
+
+typedef struct                          /* shared with the forked boots */
+{
+    uint64_t sent;                      /* DATA bytes acknowledged */
+    uint64_t resumed;                   /* START_ACK offsets */
+    uint32_t resumes;                   /* START_ACK with an offset > 0 */
+    uint32_t sessions;
+} Shared_t;
+/* Private Variable ----------------------------------------------------------*/
+static Image_t images[2];
+static Shared_t *shared;
+static uint8_t tf_dummy;
+static uint32_t trial_rng = 0x9E3779B9U;
+static uint32_t records_checked;
+static uint32_t marked_blocks_checked;
+/* Private Function Prototype ------------------------------------------------*/
+static uint32_t Random(void);
+static void MakeImage(Image_t *img, uint32_t size, uint32_t version);
+static int Boot(const Image_t *img);
+static bool Session(const Image_t *img);
+static void Send(const uint8_t *data, uint16_t len);
+static void Pump(uint32_t us);
+static void CheckRecord(void);
+/* Program Code --------------------------------------------------------------*/
+int main(void)
+{
+    uint32_t boots = 0U, losses = 0U, failures = 0U, swaps = 0U, done = 0U;
+    uint64_t image_bytes = 0U;
+
+    HostFlash_Create();
+    shared = mmap(NULL, sizeof(Shared_t), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (shared == MAP_FAILED) return 2;
+    MakeImage(&images[0], IMAGE_A_SIZE, 0x0200U);
+    MakeImage(&images[1], IMAGE_B_SIZE, 0x0201U);
+    memset(shared, 0, sizeof(Shared_t));
+
+    for (uint32_t trial = 0U; trial < TRIALS; trial++)
+    {
+        bool validated = false;
+        const Image_t *img = &images[0];
+
+        HostFlash_Reset(Random());
+        for (uint32_t boot = 0U; (boot < MAX_BOOTS) && !validated; boot++)
+        {
+            int status;
+            pid_t pid;
+
+            // A quarter of the early boots are offered the other image.
+            if ((boot < KILLED_BOOTS) && ((Random() % 4U) == 0U))
+            {
+                img = &images[(img == &images[0]) ? 1 : 0];
+                swaps++;
+            }
+            host_kill_step = ((boot < KILLED_BOOTS) && ((Random() % 4U) != 0U)) ? (1U + (Random() % 1000U)) : 0U;
+            host_fail_step = ((boot < KILLED_BOOTS) && ((Random() % 4U) == 0U)) ? (1U + (Random() % 900U)) : 0U;
+            // Half of the failures lose power inside Agent_HandleFailure().
+            if ((host_fail_step != 0U) && ((Random() % 2U) == 0U)) host_kill_step = host_fail_step + 1U + (Random() % 3U);
+            if ((host_fail_step != 0U) && ((host_kill_step == 0U) || (host_fail_step < host_kill_step))) failures++;
+            host_rng = Random() | 1U;
+            boots++;
+
+            fflush(stdout);
+            pid = fork();
+            if (pid < 0) return 2;
+            if (pid == 0) _exit(Boot(img));
+            if (waitpid(pid, &status, 0) != pid) return 2;
+
+            CHECK(WIFEXITED(status));
+            if (!WIFEXITED(status)) break;
+            if (WEXITSTATUS(status) == HOST_EXIT_POWER_LOSS) losses++;
+            CheckRecord();
+            if (WEXITSTATUS(status) == EXIT_DONE)
+            {
+                validated = true;
+                CHECK(memcmp(&host_flash->nor[0], img->data, img->size) == 0);
+                image_bytes += img->size;
+                done++;
+            }
+        }
+        CHECK(validated);
+    }
+
+    printf("%u trials, %u boots: %u power losses, %u NOR program failures, %u image swaps\n",
+           TRIALS, boots, losses, failures, swaps);
+    printf("records checked %u (%u marked blocks), all consistent with NOR: %s\n",
+           records_checked, marked_blocks_checked, (host_test_failures == 0U) ? "yes" : "no");
+    printf("sessions %u, resumed %u (%.1f KB avg), sent %.2f x the image size until validated\n",
+           shared->sessions, shared->resumes,
+           (shared->resumes != 0U) ? ((double)shared->resumed / shared->resumes / 1024.0) : 0.0,
+           (image_bytes != 0U) ? ((double)shared->sent / (double)image_bytes) : 0.0);
+    CHECK(done == TRIALS);
+    CHECK(shared->resumes > 0U);
+    CHECK(records_checked > 0U);
+    return HOST_TEST_END("fw_resume_test");
+}
+
+static uint32_t Random(void)
+{
+    trial_rng ^= trial_rng << 13;
+    trial_rng ^= trial_rng >> 17;
+    trial_rng ^= trial_rng << 5;
+    return trial_rng;
+}
+
+static void MakeImage(Image_t *img, uint32_t size, uint32_t version)
+{
+    img->data = malloc(size);
+    if (img->data == NULL) exit(2);
+    for (uint32_t i = 0U; i < size; i++)
+    {
+        // Runs of 0xFF like the padding of a real image.
+        img->data[i] = ((i / 4096U) % 5U == 4U) ? 0xFFU : (uint8_t)Random();
+    }
+    img->size = size;
+    img->crc32 = HostCrc32(img->data, size);
+    img->version = version;
+}
+
+/**
+ * @brief  One power-up of the panel (runs in the forked child).
+ */
+static int Boot(const Image_t *img)
+{
+    host_image = img->data;
+    host_image_size = img->size;
+    FwUpdateAgent_Init();
+    for (uint32_t i = 0U; i < MAX_SESSIONS; i++)
+    {
+        if (Session(img)) return EXIT_DONE;
+        Pump(1000000U);
+    }
+    return EXIT_GAVE_UP;
+}
+
+/**
+ * @brief  Unicast server: START, DATA from the acknowledged offset, FINISH.
+ * @retval true when the panel validated the image and restarted.
+ */
+static bool Session(const Image_t *img)
+{
+    uint8_t msg[6U + PACKET_SIZE];
+    FwInfoTypeDef info = { img->size, img->crc32, img->version, 0U, HOST_NOR_BASE };
+    uint32_t offset = 0U;
+    uint32_t seq = 0U;
+    uint32_t misses = 0U;
+    uint32_t count;
+
+    shared->sessions++;
+    msg[0] = 0x01;                      /* SUB_CMD_START_REQUEST */
+    msg[1] = HOST_TF_ADDRESS;
+    memcpy(&msg[2], &info, sizeof(info));
+    msg[22] = 0x01;                     /* FWU_START_FLAG_RESUME */
+    count = host_tx_count;
+    Send(msg, 23U);
+    if ((host_tx_count == count) || (host_tx[0] != 0x02) || (host_tx_len < 6U)) return false;
+    memcpy(&offset, &host_tx[2], sizeof(uint32_t));
+    if (offset > 0U)
+    {
+        shared->resumes++;
+        shared->resumed += offset;
+    }
+
+    while (offset < img->size)
+    {
+        uint32_t len = img->size - offset;
+        uint32_t acked;
+
+        if (len > PACKET_SIZE) len = PACKET_SIZE;
+        msg[0] = 0x10;                  /* SUB_CMD_DATA_PACKET */
+        memcpy(&msg[2], &seq, sizeof(uint32_t));
+        memcpy(&msg[6], &img->data[offset], len);
+        count = host_tx_count;
+        Send(msg, (uint16_t)(6U + len));
+        memcpy(&acked, &host_tx[2], sizeof(uint32_t));
+        if ((host_tx_count != count) && (host_tx[0] == 0x11) && (acked == seq))
+        {
+            offset += len;
+            shared->sent += len;
+            seq++;
+            misses = 0U;
+        }
+        else if ((host_tx_count != count) && (host_tx[0] == 0x12))
+        {
+            return false;               /* SUB_CMD_DATA_NACK: start again */
+        }
+        else if (++misses > MAX_MISSES)
+        {
+            return false;
+        }
+        Pump(PACKET_US);
+    }
+
+    msg[0] = 0x20;                      /* SUB_CMD_FINISH_REQUEST */
+    count = host_tx_count;
+    Send(msg, 2U);
+    for (uint32_t i = 0U; i < 5000U; i++)
+    {
+        Pump(1000U);
+        if (host_restarted) return true;
+        if ((host_tx_count != count) && (host_tx[0] == 0x22)) return false;
+    }
+    return false;
+}
+
+static void Send(const uint8_t *data, uint16_t len)
+{
+    TF_Msg msg;
+
+    memset(&msg, 0, sizeof(msg));
+    msg.data = data;
+    msg.len = len;
+    FwUpdateAgent_ProcessMessage((TinyFrame *)(void *)&tf_dummy, &msg);
+}
+
+/**
+ * @brief  Lets `us` of bus time pass and runs the main loop once.
+ */
+static void Pump(uint32_t us)
+{
+    host_time_us += us;
+    FwUpdateAgent_Service();
+}
+
+/**
+ * @brief  Decodes the record like Agent_LoadResume() and checks it is true.
+ */
+static void CheckRecord(void)
+{
+    const uint8_t *bits = &host_flash->ee[EE_FW_RESUME + sizeof(Header_t)];
+    const Image_t *img = NULL;
+    uint32_t erased_to, bad_blocks = 0U, bad_bytes = 0U;
+    uint16_t crc;
+    Header_t h;
+
+    memcpy(&h, &host_flash->ee[EE_FW_RESUME], sizeof(h));
+    if (h.magic_number != EEPROM_MAGIC_NUMBER) return;
+    crc = h.crc;
+    h.crc = 0U;
+    if (crc != (uint16_t)HostCrc32((const uint8_t *)&h, sizeof(h))) return;
+
+    records_checked++;
+    for (uint8_t i = 0U; i < 2U; i++)
+    {
+        if ((h.size == images[i].size) && (h.crc32 == images[i].crc32)) img = &images[i];
+    }
+    CHECK(img != NULL);
+    CHECK(h.staging_addr == HOST_NOR_BASE);
+    CHECK(h.block_size != 0U);
+    if ((img == NULL) || (h.block_size == 0U)) return;
+
+    erased_to = (h.erased_to < img->size) ? h.erased_to : img->size;
+    for (uint32_t block = 0U; (block * h.block_size) < img->size; block++)
+    {
+        uint32_t start = block * h.block_size;
+        uint32_t len = ((img->size - start) < h.block_size) ? (img->size - start) : h.block_size;
+
+        if ((bits[block >> 3] & (1U << (block & 7U))) != 0U)
+        {
+            marked_blocks_checked++;
+            if (memcmp(&host_flash->nor[start], &img->data[start], len) != 0) bad_blocks++;
+            continue;
+        }
+        for (uint32_t i = start; (i < (start + len)) && (i < erased_to); i++)
+        {
+            if ((host_flash->nor[i] & img->data[i]) != img->data[i]) bad_bytes++;
+        }
+    }
+    CHECK(bad_blocks == 0U);
+    CHECK(bad_bytes == 0U);
+    if ((bad_blocks != 0U) || (bad_bytes != 0U))
+    {
+        printf("  record v%x erased_to %u: %u marked blocks differ, %u bytes not programmable\n",
+               (unsigned)h.version, (unsigned)h.erased_to, bad_blocks, bad_bytes);
+    }
+}
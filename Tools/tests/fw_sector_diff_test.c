@@ -0,0 +1,271 @@
+/**
+ ******************************************************************************
+ * File Name          : fw_sector_diff_test.c
+ * Description        : host test, per sector copy plan over real old/new
+ *                      firmware image pairs
+ ******************************************************************************
+ *
+ * Loads pairs of real firmware builds (Intel HEX or raw binary) and plans
+ * the copy of the new image over the old one with Common/fw_sector_diff.c,
+ * for both destinations the bootloader uses:
+ *  - internal flash at RT_APPL_ADDR (STM32F746 sector map, 4-byte units),
+ *  - QSPI NOR (uniform 64 KB sectors, 256-byte pages).
+ * The plan is then applied to a model of the destination the same way
+ * QSPI2FLASH_Copy()/FLASH2QSPI_Copy() do it (erase dirty sectors, program
+ * the non-erased units) and the result is compared with a full erase and
+ * program of the image region.
+ *
+ * For every pair the test reports sectors and bytes erased and bytes
+ * programmed, next to a full copy (every touched sector erased and every
+ * byte of the image programmed).
+ *
+ * Without arguments it runs the bootloader builds committed under
+ * ICBL/MDK-ARM (the only firmware images in the tree), plus one pair
+ * derived from them in which 64 bytes are inserted in the middle, the
+ * case of a code change that moves everything behind it.
+ *
+ * Build (Linux):
+ *   make -C Tools/tests fw_sector_diff_test
+ *   ./fw_sector_diff_test [old.hex|old.bin new.hex|new.bin]
+ *
+ ******************************************************************************
+ */
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "fw_sector_diff.h"
+#include "host_test.h"
+/* Private Define ------------------------------------------------------------*/
+#define MAX_IMAGE           0x000F0000U     /* RT_APPL_SIZE */
+#define FLASH_APPL_ADDR     0x08010000U     /* RT_APPL_ADDR */
+#define QSPI_APPL_ADDR      0x00100000U
+#define QSPI_SECTOR         0x00010000U     /* N25Q128A_SECTOR_SIZE */
+#define QSPI_PAGE           256U
+#define FLASH_UNIT          4U
+#define IMAGES              "../../ICBL/MDK-ARM/"
+/* Private Type --------------------------------------------------------------*/
+typedef struct
+{
+    uint8_t  *data;
+    uint32_t size;
+} Image_t;
+
+typedef struct
+{
+    const char *name;
+    const FwSectorTypeDef *map;
+    uint8_t  cnt;
+    uint32_t addr;
+    uint32_t unit;
+} Dest_t;
+/* Private Variable ----------------------------------------------------------*/
+static const FwSectorTypeDef flash_map[] =
+{
+    { 0x08000000U, 0x8000U }, { 0x08008000U, 0x8000U }, { 0x08010000U, 0x8000U }, { 0x08018000U, 0x8000U },
+    { 0x08020000U, 0x20000U }, { 0x08040000U, 0x40000U }, { 0x08080000U, 0x40000U }, { 0x080C0000U, 0x40000U },
+};
+static FwSectorTypeDef qspi_map[FWDIFF_MAX_SECTORS];
+static uint8_t mem[0x00100000U];            /* destination model, covers every map */
+static uint8_t ref[0x00100000U];            /* full erase and program */
+/* Private Function Prototype ------------------------------------------------*/
+static bool Load(const char *path, Image_t *img);
+static bool LoadHex(FILE *f, Image_t *img);
+static void RunPair(const char *name, const Image_t *old_img, const Image_t *new_img);
+static void RunDest(const Dest_t *d, const char *name, const Image_t *old_img, const Image_t *new_img);
+/* Program Code --------------------------------------------------------------*/
+int main(int argc, char *argv[])
+{
+    static const char *pairs[][2] =
+    {
+        { IMAGES "Exe/tmp3.hex", IMAGES "Exe/tmp4.hex" },
+        { IMAGES "Exe/tmp4.hex", IMAGES "Exe/tmp6.hex" },
+        { IMAGES "Exe/tmp6.hex", IMAGES "Exe/icbl.hex" },
+        { IMAGES "Exe/icbl.hex", IMAGES "Out/ICBL.HEX" },
+        { IMAGES "Exe/tmp1.hex", IMAGES "Exe/tmp2.hex" },
+        { IMAGES "Exe/tmp1.hex", IMAGES "Exe/icbl.hex" },
+    };
+    Image_t a, b, shifted;
+
+    printf("%-28s %-6s %8s %7s %11s %11s %11s %11s\n", "pair", "dest", "size", "sectors",
+           "erase diff", "erase full", "prog diff", "prog full");
+    if (argc == 3)
+    {
+        CHECK(Load(argv[1], &a) && Load(argv[2], &b));
+        if (host_test_failures == 0U) RunPair("argv", &a, &b);
+        return HOST_TEST_END("fw_sector_diff_test");
+    }
+
+    for (uint8_t i = 0U; i < (sizeof(pairs) / sizeof(pairs[0])); i++)
+    {
+        char name[64];
+
+        CHECK(Load(pairs[i][0], &a));
+        CHECK(Load(pairs[i][1], &b));
+        if ((a.data == NULL) || (b.data == NULL)) continue;
+        snprintf(name, sizeof(name), "%s>%s", strrchr(pairs[i][0], '/') + 1, strrchr(pairs[i][1], '/') + 1);
+        RunPair(name, &a, &b);
+        free(a.data);
+        free(b.data);
+    }
+
+    // Derived: 64 bytes inserted at half of the newest build.
+    if (Load(IMAGES "Exe/icbl.hex", &a))
+    {
+        shifted.size = a.size + 64U;
+        shifted.data = malloc(shifted.size);
+        if (shifted.data == NULL) return 2;
+        memcpy(shifted.data, a.data, a.size / 2U);
+        memset(&shifted.data[a.size / 2U], 0x5A, 64U);
+        memcpy(&shifted.data[(a.size / 2U) + 64U], &a.data[a.size / 2U], a.size - (a.size / 2U));
+        RunPair("icbl.hex>+64 B at half", &a, &shifted);
+        free(a.data);
+        free(shifted.data);
+    }
+    return HOST_TEST_END("fw_sector_diff_test");
+}
+
+/**
+ * @brief  Loads Intel HEX (by extension) or raw binary; gaps are 0xFF.
+ */
+static bool Load(const char *path, Image_t *img)
+{
+    const char *ext = strrchr(path, '.');
+    FILE *f = fopen(path, "rb");
+    bool ok;
+
+    img->data = NULL;
+    img->size = 0U;
+    if (f == NULL)
+    {
+        printf("%s: cannot open\n", path);
+        return false;
+    }
+    if ((ext != NULL) && ((strcmp(ext, ".hex") == 0) || (strcmp(ext, ".HEX") == 0)))
+    {
+        ok = LoadHex(f, img);
+    }
+    else
+    {
+        img->data = malloc(MAX_IMAGE);
+        img->size = (img->data != NULL) ? (uint32_t)fread(img->data, 1U, MAX_IMAGE, f) : 0U;
+        ok = (img->size != 0U);
+    }
+    fclose(f);
+    if (!ok) printf("%s: no image\n", path);
+    return ok;
+}
+
+static bool LoadHex(FILE *f, Image_t *img)
+{
+    char line[600];
+    uint32_t base = 0U, lo = 0xFFFFFFFFU, hi = 0U;
+    uint8_t *buf = malloc(MAX_IMAGE);
+
+    if (buf == NULL) return false;
+    memset(buf, 0xFF, MAX_IMAGE);
+    while (fgets(line, sizeof(line), f) != NULL)
+    {
+        uint8_t rec[256];
+        uint32_t n = 0U;
+
+        if (line[0] != ':') continue;
+        for (char *p = &line[1]; (p[0] > ' ') && (p[1] > ' ') && (n < sizeof(rec)); p += 2)
+        {
+            unsigned v;
+            if (sscanf(p, "%2x", &v) != 1) break;
+            rec[n++] = (uint8_t)v;
+        }
+        if ((n < 5U) || (n < (5U + rec[0]))) continue;
+        if (rec[3] == 0x04U) base = ((uint32_t)rec[4] << 24) | ((uint32_t)rec[5] << 16);
+        if (rec[3] == 0x02U) base = (((uint32_t)rec[4] << 8) | rec[5]) << 4;
+        if (rec[3] != 0x00U) continue;
+        for (uint32_t i = 0U; i < rec[0]; i++)
+        {
+            uint32_t addr = base + (((uint32_t)rec[1] << 8) | rec[2]) + i;
+            if (lo == 0xFFFFFFFFU) lo = addr & ~0xFFU;
+            if ((addr < lo) || ((addr - lo) >= MAX_IMAGE)) continue;
+            buf[addr - lo] = rec[4U + i];
+            if ((addr - lo + 1U) > hi) hi = addr - lo + 1U;
+        }
+    }
+    img->data = buf;
+    img->size = hi;
+    return (hi != 0U);
+}
+
+static void RunPair(const char *name, const Image_t *old_img, const Image_t *new_img)
+{
+    Dest_t flash = { "flash", flash_map, (uint8_t)(sizeof(flash_map) / sizeof(flash_map[0])), FLASH_APPL_ADDR, FLASH_UNIT };
+    Dest_t qspi = { "qspi", qspi_map, 0U, QSPI_APPL_ADDR, QSPI_PAGE };
+
+    qspi.cnt = FwDiff_UniformMap(qspi_map, FWDIFF_MAX_SECTORS, QSPI_APPL_ADDR, MAX_IMAGE, QSPI_SECTOR);
+    CHECK(qspi.cnt != 0U);
+    RunDest(&flash, name, old_img, new_img);
+    RunDest(&qspi, name, old_img, new_img);
+}
+
+/**
+ * @brief  Plans, applies and checks one copy; prints one report line.
+ */
+static void RunDest(const Dest_t *d, const char *name, const Image_t *old_img, const Image_t *new_img)
+{
+    uint32_t base = d->map[0].addr;
+    uint32_t erase_full = 0U, prog = 0U, erase = 0U;
+    FwDiffPlanTypeDef plan;
+    uint8_t touched;
+
+    // Old image in place, the rest of the destination erased.
+    memset(mem, 0xFF, sizeof(mem));
+    memcpy(&mem[d->addr - base], old_img->data, old_img->size);
+    CHECK(FwDiff_Plan(d->map, d->cnt, d->addr, &mem[d->addr - base], new_img->data, new_img->size, d->unit, &plan) == 0U);
+    touched = (uint8_t)(plan.last - plan.first + 1U);
+
+    // Reference: every touched sector erased, the whole image programmed.
+    memcpy(ref, mem, sizeof(ref));
+    for (uint8_t s = plan.first; s <= plan.last; s++)
+    {
+        memset(&ref[d->map[s].addr - base], 0xFF, d->map[s].size);
+        erase_full += d->map[s].size;
+    }
+    memcpy(&ref[d->addr - base], new_img->data, new_img->size);
+
+    // Apply the plan like the bootloader copy loop.
+    for (uint8_t s = plan.first; s <= plan.last; s++)
+    {
+        uint32_t pos, end;
+
+        if ((plan.dirty & (1U << (s - plan.first))) == 0U) continue;
+        memset(&mem[d->map[s].addr - base], 0xFF, d->map[s].size);
+        erase += d->map[s].size;
+        pos = (d->map[s].addr > d->addr) ? d->map[s].addr : d->addr;
+        end = ((d->map[s].addr + d->map[s].size) < (d->addr + new_img->size)) ? (d->map[s].addr + d->map[s].size)
+                                                                              : (d->addr + new_img->size);
+        while (pos < end)
+        {
+            uint32_t len = ((end - pos) >= d->unit) ? d->unit : (end - pos);
+            if (!FwDiff_IsErased(&new_img->data[pos - d->addr], len))
+            {
+                memcpy(&mem[pos - base], &new_img->data[pos - d->addr], len);
+                prog += len;
+            }
+            pos += len;
+        }
+    }
+
+    CHECK(memcmp(mem, ref, sizeof(mem)) == 0);
+    CHECK(erase == plan.erase_bytes);
+    CHECK(prog == plan.prog_bytes);
+    CHECK(plan.erase_bytes <= erase_full);
+    CHECK(plan.prog_bytes <= new_img->size);
+    if ((old_img->size == new_img->size) && (memcmp(old_img->data, new_img->data, new_img->size) == 0))
+    {
+        CHECK(plan.dirty_cnt == 0U);
+    }
+    printf("%-28s %-6s %8u %3u/%-3u %11u %11u %11u %11u\n", name, d->name, (unsigned)new_img->size,
+           plan.dirty_cnt, touched, (unsigned)plan.erase_bytes, (unsigned)erase_full,
+           (unsigned)plan.prog_bytes, (unsigned)new_img->size);
+}
+
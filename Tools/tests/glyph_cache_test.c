@@ -0,0 +1,520 @@
+/**
+ ******************************************************************************
+ * File Name          : glyph_cache_test.c
+ * Description        : host test, A8 glyph cache over replayed screen renders
+ ******************************************************************************
+ *
+ * Drives IC/Src/glyph_cache.c through its GlyphFetch_t, the way
+ * _GlyphFetch() in LCDConf.c feeds it from the emWin fonts. The fonts are
+ * synthetic stand-ins of Verdana16_LAT (AA4), Verdana20_LAT (AA2) and
+ * Verdana32_LAT (AA4): the same heights and bits per pixel, a chain of two
+ * GUI_FONT_PROP ranges (ASCII and Latin-1 up to Latin Extended-A), glyphs
+ * of varying width packed MSB first with BytesPerLine per line.
+ *
+ * A trace of screen visits renders the labels of eight screens, with the
+ * clock, temperature and timer strings changing between renders. Every
+ * glyph drawn from the cache is compared with its own expansion of the
+ * font bits, and after every render the pool is checked: glyphs inside
+ * the budget, aligned, not overlapping, pinned glyphs in front of the
+ * ring. The digits and number signs are preloaded like display.c does it
+ * with GLYPH_PRELOAD_CHARS.
+ *
+ * Without the cache emWin reads and decodes every character from QSPI on
+ * every render. For the pool size and two smaller budgets the test
+ * reports font reads against that, and the reads saved per rendered
+ * screen, in total and per screen.
+ *
+ * Build (Linux):
+ *   make -C Tools/tests glyph_cache_test
+ *
+ ******************************************************************************
+ */
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "glyph_cache.h"
+#include "host_test.h"
+/* Private Define ------------------------------------------------------------*/
+#define POOL_SIZE           0x00020000U     /* GLYPH_POOL_SIZE */
+#define DATA_SIZE           0x00100000U
+#define CODES               0x180U          /* codes 0x00..0x17F */
+#define SCREENS             8U
+#define VISITS              400U
+#define MAX_RENDERS         20U
+#define MAX_STRINGS         12U
+#define PRELOAD_CHARS       "0123456789:.,-%\xC2\xB0 "   /* GLYPH_PRELOAD_CHARS */
+/* Private Type --------------------------------------------------------------*/
+typedef struct FontProp_s
+{
+    uint16_t                 first;
+    uint16_t                 last;
+    const struct FontProp_s *next;
+} FontProp_t;
+
+typedef struct
+{
+    const char       *name;
+    uint8_t           height;
+    uint8_t           bpp;
+    const FontProp_t *prop;
+    uint32_t          offset[CODES];        /* glyph bits in font_data */
+    uint8_t           width[CODES];
+    uint8_t           xdist[CODES];
+    uint8_t           bytes_per_line[CODES];
+} Font_t;
+
+typedef struct
+{
+    Font_t     *font;
+    const char *text;                       /* UTF-8, may hold one %u pair */
+} Label_t;
+
+typedef struct
+{
+    const char *name;
+    Label_t     labels[MAX_STRINGS];
+} Screen_t;
+
+typedef struct
+{
+    uint32_t renders;
+    uint32_t glyphs;                        /* font reads without the cache */
+    uint32_t fetches;                       /* font reads with the cache */
+} Tally_t;
+/* Private Variable ----------------------------------------------------------*/
+static const FontProp_t prop_latin = { 0x00A0U, 0x017FU, NULL };
+static const FontProp_t prop_ascii = { 0x0020U, 0x007EU, &prop_latin };
+static Font_t font16 = { "Verdana16", 16U, 4U, &prop_ascii, { 0U }, { 0U }, { 0U }, { 0U } };
+static Font_t font20 = { "Verdana20", 20U, 2U, &prop_ascii, { 0U }, { 0U }, { 0U }, { 0U } };
+static Font_t font32 = { "Verdana32", 32U, 4U, &prop_ascii, { 0U }, { 0U }, { 0U }, { 0U } };
+static Font_t font12 = { "mono12", 12U, 1U, &prop_ascii, { 0U }, { 0U }, { 0U }, { 0U } };
+static Font_t font8  = { "gray8", 8U, 8U, &prop_ascii, { 0U }, { 0U }, { 0U }, { 0U } };
+static const Screen_t screens[SCREENS] =
+{
+    { "home", { { &font32, "%02u:%02u" }, { &font16, "Subota, 18.10.2026" }, { &font20, "%u.%u\xC2\xB0" "C" },
+                { &font16, "Vanjska temperatura" }, { &font16, "Vla\xC5\xBEnost 54%%" } } },
+    { "lights", { { &font20, "Dnevna soba" }, { &font20, "Kuhinja" }, { &font20, "Spava\xC4\x87" "a soba" },
+                  { &font20, "Hodnik" }, { &font20, "Kupatilo" }, { &font20, "Terasa" },
+                  { &font16, "Uklju\xC4\x8D" "eno" }, { &font16, "Isklju\xC4\x8D" "eno" }, { &font16, "%u%%" } } },
+    { "thermostat", { { &font32, "%u.%u\xC2\xB0" }, { &font20, "Grijanje" }, { &font20, "Hla\xC4\x91" "enje" },
+                      { &font16, "Zadana 22.0\xC2\xB0" "C" }, { &font16, "Ventilator: auto" } } },
+    { "scenes", { { &font20, "Dolazak" }, { &font20, "Odlazak" }, { &font20, "Ve\xC4\x8D" "era" },
+                  { &font20, "Film" }, { &font20, "\xC4\x8C" "itanje" }, { &font20, "Spavanje" },
+                  { &font20, "Jutro" }, { &font20, "Dru\xC5\xBE" "enje" }, { &font20, "Opu\xC5\xA1" "tanje" } } },
+    { "timers", { { &font20, "Tajmer 1" }, { &font20, "Tajmer 2" }, { &font20, "Tajmer 3" }, { &font20, "Tajmer 4" },
+                  { &font16, "%02u:%02u" }, { &font16, "Pon Uto Sri \xC4\x8C" "et Pet" }, { &font16, "Sub Ned" } } },
+    { "settings", { { &font20, "Pode\xC5\xA1" "avanja" }, { &font16, "Jezik" }, { &font16, "Osvjetljenje ekrana" },
+                    { &font16, "\xC4\x8C" "uvar ekrana" }, { &font16, "Adresa ure\xC4\x91" "aja" },
+                    { &font16, "Vrijeme i datum" }, { &font16, "Zvuk" }, { &font16, "A\xC5\xBE" "uriranje firmvera" },
+                    { &font16, "Vra\xC4\x87" "anje na tvorni\xC4\x8D" "ke postavke" } } },
+    { "gate", { { &font20, "Kapija" }, { &font20, "Otvori" }, { &font20, "Zatvori" }, { &font20, "Stop" },
+                { &font16, "Otvorena %u%%" } } },
+    { "alarm", { { &font32, "1 2 3 4 5 6 7 8 9 0" }, { &font20, "Unesite PIN" }, { &font16, "Sistem nao\xC5\xBE" "uran" },
+                 { &font16, "Particija %u" } } },
+};
+static uint8_t font_data[DATA_SIZE];        /* QSPI .flash_rom */
+static uint8_t pool[POOL_SIZE];             /* SDRAM .glyph_cache */
+static uint32_t data_used;
+static uint32_t font_reads;
+static uint32_t rng;
+static uint32_t clock_minutes;
+/* Private Function Prototype ------------------------------------------------*/
+static bool Fetch(const void *font, uint16_t code, GlyphSource_t *out);
+static void BuildFont(Font_t *font);
+static bool InFont(const Font_t *font, uint16_t code);
+static void Replay(uint32_t budget, bool preload, Tally_t *total, Tally_t *per_screen);
+static void Preload(GlyphCache_t *cache, Font_t *font, const char *text);
+static uint32_t Render(GlyphCache_t *cache, uint8_t screen);
+static uint32_t DrawText(GlyphCache_t *cache, Font_t *font, const char *text);
+static bool SameGlyph(const GlyphCacheEntry_t *entry, const Font_t *font, uint16_t code);
+static void CheckPool(const GlyphCache_t *cache);
+static int CompareOffset(const void *a, const void *b);
+static uint16_t NextCode(const char **text);
+static uint8_t NextScreen(void);
+static uint32_t Random(void);
+/* Program Code --------------------------------------------------------------*/
+int main(void)
+{
+    static const uint32_t budgets[] = { POOL_SIZE, 48U * 1024U, 24U * 1024U };
+    static GlyphCache_t cache;
+    Tally_t total, per_screen[SCREENS], device[SCREENS];
+    const GlyphCacheEntry_t *entry;
+    uint32_t reads;
+    char line[160];
+
+    rng = 0x9E3779B9U;
+    BuildFont(&font16);
+    BuildFont(&font20);
+    BuildFont(&font32);
+    BuildFont(&font12);
+    BuildFont(&font8);
+
+    printf("%u screens, %u visits, 1..%u renders per visit\n", SCREENS, VISITS, MAX_RENDERS);
+    printf("budget KB  preload  renders  no cache  font reads  hits %%  evictions  saved/screen\n");
+    for (uint8_t b = 0U; b < (sizeof(budgets) / sizeof(budgets[0])); b++)
+    {
+        for (uint8_t preload = 0U; preload < 2U; preload++)
+        {
+            Replay(budgets[b], preload != 0U, &total, per_screen);
+            CHECK(total.fetches < total.glyphs);
+            if (b == 0U)
+            {
+                // The pool holds every glyph of the trace: each is read once.
+                CHECK(total.fetches < 1024U);
+                if (preload != 0U) memcpy(device, per_screen, sizeof(device));
+            }
+        }
+    }
+
+    // Per screen, pool size with preloading, as on the device.
+    printf("\nscreen      renders  glyphs/screen  reads/screen  saved/screen\n");
+    for (uint8_t s = 0U; s < SCREENS; s++)
+    {
+        const Tally_t *t = &device[s];
+        double n = (t->renders != 0U) ? (double)t->renders : 1.0;
+
+        printf("%-10s  %7u  %13.1f  %12.2f  %12.2f\n", screens[s].name, t->renders, (double)t->glyphs / n,
+               (double)t->fetches / n, (double)(t->glyphs - t->fetches) / n);
+    }
+
+    // 1 and 8 bit fonts expand to 0/255 and to the value itself.
+    GlyphCache_Init(&cache, pool, 4096U, Fetch);
+    for (uint16_t code = 0x20U; code < 0x7FU; code++)
+    {
+        entry = GlyphCache_Get(&cache, &font12, code);
+        CHECK((entry != NULL) && SameGlyph(entry, &font12, code));
+        entry = GlyphCache_Get(&cache, &font8, code);
+        CHECK((entry != NULL) && SameGlyph(entry, &font8, code));
+        CheckPool(&cache);
+    }
+    CHECK(cache.evictions > 0U);
+
+    // Not in the font: NULL, counted, nothing stored.
+    reads = cache.fetches;
+    CHECK(GlyphCache_Get(&cache, &font16, 0x0400U) == NULL);
+    CHECK(GlyphCache_Get(&cache, &font16, 0x007FU) == NULL);
+    CHECK((cache.uncached == 2U) && (cache.fetches == reads));
+
+    // Same code in two fonts: two glyphs.
+    GlyphCache_Flush(&cache);
+    entry = GlyphCache_Get(&cache, &font16, 'A');
+    CHECK((entry != NULL) && (entry->height == 16U));
+    entry = GlyphCache_Get(&cache, &font20, 'A');
+    CHECK((entry != NULL) && (entry->height == 20U) && SameGlyph(entry, &font20, 'A'));
+    CHECK(SameGlyph(GlyphCache_Get(&cache, &font16, 'A'), &font16, 'A'));
+    CHECK(cache.fetches == (reads + 2U));
+
+    // Preloaded digits survive a ring that turns over many times.
+    GlyphCache_Init(&cache, pool, 8U * 1024U, Fetch);
+    Preload(&cache, &font32, "0123456789");
+    CHECK(cache.pinned == 10U);
+    reads = cache.fetches;
+    for (uint32_t i = 0U; i < 2000U; i++)
+    {
+        uint16_t code = (uint16_t)('A' + (Random() % 26U));
+        entry = GlyphCache_Get(&cache, &font32, code);
+        CHECK((entry != NULL) && !entry->pinned && SameGlyph(entry, &font32, code));
+    }
+    CHECK(cache.evictions > 0U);
+    CheckPool(&cache);
+    reads = cache.fetches;
+    CHECK(DrawText(&cache, &font32, "0123456789") == 10U);
+    CHECK(cache.fetches == reads);
+
+    // Preloading more than the budget keeps what fits, the ring stays usable.
+    GlyphCache_Init(&cache, pool, 2048U, Fetch);
+    Preload(&cache, &font32, "0123456789ABCDEFGHIJ");
+    CHECK((cache.pinned > 0U) && (cache.pinned < 20U) && (cache.uncached > 0U));
+    CheckPool(&cache);
+    CHECK(GlyphCache_Get(&cache, &font32, '0') != NULL);
+
+    // Report line.
+    CHECK(GlyphCache_Report(&cache, line, sizeof(line)) > 0U);
+    CHECK(strncmp(line, "glyphs: ", 8U) == 0);
+    CHECK(GlyphCache_Report(&cache, line, 8U) == 0U);
+
+    // Flush empties the pool.
+    GlyphCache_Flush(&cache);
+    CHECK((cache.pinned == 0U) && (cache.pinned_end == 0U) && (cache.fifo_count == 0U));
+    reads = cache.fetches;
+    CHECK(DrawText(&cache, &font32, "0") == 1U);
+    CHECK(cache.fetches == (reads + 1U));
+    CheckPool(&cache);
+
+    return HOST_TEST_END("glyph_cache_test");
+}
+
+/**
+ * @brief  GlyphFetch_t: walks the range chain, like _GlyphFetch().
+ */
+static bool Fetch(const void *font, uint16_t code, GlyphSource_t *out)
+{
+    const Font_t *f = (const Font_t *)font;
+
+    if (!InFont(f, code)) return false;
+    font_reads++;
+    out->data = &font_data[f->offset[code]];
+    out->width = f->width[code];
+    out->height = f->height;
+    out->xdist = f->xdist[code];
+    out->bpp = f->bpp;
+    out->bytes_per_line = f->bytes_per_line[code];
+    return true;
+}
+
+/**
+ * @brief  Glyph widths from about half to five sixths of the height, the
+ *         space is empty, pixels are random.
+ */
+static void BuildFont(Font_t *font)
+{
+    for (uint16_t code = 0U; code < CODES; code++)
+    {
+        uint8_t width = 0U;
+        uint32_t size;
+
+        if (!InFont(font, code)) continue;
+        if ((code != 0x20U) && (code != 0xA0U))
+        {
+            width = (uint8_t)((font->height / 2U) + ((code * 7U) % (font->height / 3U)));
+        }
+        font->width[code] = width;
+        font->xdist[code] = (uint8_t)(width + 1U + ((width == 0U) ? (font->height / 4U) : 0U));
+        font->bytes_per_line[code] = (uint8_t)(((uint32_t)width * font->bpp + 7U) / 8U);
+        font->offset[code] = data_used;
+        size = (uint32_t)font->bytes_per_line[code] * font->height;
+        CHECK((data_used + size) <= DATA_SIZE);
+        for (uint32_t k = 0U; k < size; k++) font_data[data_used + k] = (uint8_t)Random();
+        data_used += size;
+    }
+}
+
+static bool InFont(const Font_t *font, uint16_t code)
+{
+    for (const FontProp_t *prop = font->prop; prop != NULL; prop = prop->next)
+    {
+        if ((code >= prop->first) && (code <= prop->last)) return true;
+    }
+    return false;
+}
+
+/**
+ * @brief  One trace replay; prints one report line and fills the tallies.
+ */
+static void Replay(uint32_t budget, bool preload, Tally_t *total, Tally_t *per_screen)
+{
+    static GlyphCache_t cache;
+
+    memset(total, 0, sizeof(Tally_t));
+    memset(per_screen, 0, SCREENS * sizeof(Tally_t));
+    memset(pool, 0, sizeof(pool));
+    GlyphCache_Init(&cache, pool, budget, Fetch);
+    rng = 0x1234567U;
+    clock_minutes = 7U * 60U;
+    if (preload)
+    {
+        Preload(&cache, &font16, PRELOAD_CHARS);
+        Preload(&cache, &font20, PRELOAD_CHARS);
+        Preload(&cache, &font32, PRELOAD_CHARS);
+    }
+    font_reads = 0U;
+    for (uint32_t v = 0U; v < VISITS; v++)
+    {
+        uint8_t screen = NextScreen();
+        uint32_t renders = 1U + (Random() % MAX_RENDERS);
+
+        for (uint32_t r = 0U; r < renders; r++)
+        {
+            uint32_t fetches = cache.fetches;
+            uint32_t glyphs = Render(&cache, screen);
+
+            per_screen[screen].renders++;
+            per_screen[screen].glyphs += glyphs;
+            per_screen[screen].fetches += cache.fetches - fetches;
+            total->renders++;
+            total->glyphs += glyphs;
+            total->fetches += cache.fetches - fetches;
+            CheckPool(&cache);
+            clock_minutes++;
+        }
+    }
+    CHECK(font_reads == total->fetches);
+    CHECK(cache.uncached == 0U);
+    printf("%9u  %7s  %7u  %8u  %10u  %6.1f  %9u  %12.2f\n", (unsigned)(budget / 1024U), preload ? "yes" : "no",
+           total->renders, total->glyphs, total->fetches, GlyphCache_HitRate(&cache) / 10.0, cache.evictions,
+           (double)(total->glyphs - total->fetches) / (double)total->renders);
+}
+
+static void Preload(GlyphCache_t *cache, Font_t *font, const char *text)
+{
+    uint16_t codes[64];
+    uint16_t count = 0U;
+
+    while ((*text != '\0') && (count < 64U)) codes[count++] = NextCode(&text);
+    GlyphCache_Preload(cache, font, codes, count);
+    CheckPool(cache);
+}
+
+/**
+ * @brief  Draws every label of a screen; returns the characters drawn.
+ */
+static uint32_t Render(GlyphCache_t *cache, uint8_t screen)
+{
+    uint32_t glyphs = 0U;
+    char text[64];
+
+    for (uint8_t i = 0U; i < MAX_STRINGS; i++)
+    {
+        const Label_t *label = &screens[screen].labels[i];
+        uint32_t hour = (clock_minutes / 60U) % 24U, minute = clock_minutes % 60U;
+
+        if (label->font == NULL) break;
+        if (strstr(label->text, "%u.%u") != NULL)
+        {
+            // Temperature drifts by a tenth now and then.
+            snprintf(text, sizeof(text), label->text, 20U + ((clock_minutes / 7U) % 4U), (clock_minutes / 3U) % 10U);
+        }
+        else if (strchr(label->text, ':') != NULL)
+        {
+            snprintf(text, sizeof(text), label->text, hour, minute);
+        }
+        else
+        {
+            snprintf(text, sizeof(text), label->text, (clock_minutes * 13U) % 101U);
+        }
+        glyphs += DrawText(cache, label->font, text);
+    }
+    return glyphs;
+}
+
+/**
+ * @brief  Draws one string through the cache, the way LCD_GlyphDispChar()
+ *         does, and checks every glyph against the font.
+ */
+static uint32_t DrawText(GlyphCache_t *cache, Font_t *font, const char *text)
+{
+    uint32_t glyphs = 0U;
+
+    while (*text != '\0')
+    {
+        uint16_t code = NextCode(&text);
+        const GlyphCacheEntry_t *entry = GlyphCache_Get(cache, font, code);
+        uint32_t size = ((uint32_t)font->width[code] * font->height + 3U) & ~3U;
+
+        // Only a glyph which cannot fit next to the pinned part is drawn by emWin.
+        CHECK((entry != NULL) || (size > (cache->budget - cache->pinned_end)));
+        if (entry != NULL) CHECK(SameGlyph(entry, font, code));
+        glyphs++;
+    }
+    return glyphs;
+}
+
+/**
+ * @brief  Compares a cached glyph with the font bits, expanded here.
+ */
+static bool SameGlyph(const GlyphCacheEntry_t *entry, const Font_t *font, uint16_t code)
+{
+    const uint8_t *bits = &font_data[font->offset[code]];
+    const uint32_t max = (1U << font->bpp) - 1U;
+
+    if (entry == NULL) return false;
+    if ((entry->width != font->width[code]) || (entry->height != font->height) || (entry->xdist != font->xdist[code])) return false;
+    if (((uintptr_t)entry->alpha % GLYPH_CACHE_ALIGN) != 0U) return false;
+    for (uint32_t y = 0U; y < font->height; y++)
+    {
+        for (uint32_t x = 0U; x < font->width[code]; x++)
+        {
+            uint32_t bit = x * font->bpp;
+            uint32_t value = ((uint32_t)bits[y * font->bytes_per_line[code] + bit / 8U] >> (8U - font->bpp - (bit % 8U))) & max;
+
+            if (entry->alpha[y * font->width[code] + x] != (uint8_t)((value * 255U) / max)) return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief  Glyphs reachable from the hash table lie in the budget, do not
+ *         overlap, and the pinned ones are in front of the ring.
+ */
+static void CheckPool(const GlyphCache_t *cache)
+{
+    static const GlyphCacheEntry_t *list[GLYPH_CACHE_MAX_ENTRIES];
+    uint32_t count = 0U, pinned = 0U;
+    bool ok = true;
+
+    for (uint16_t b = 0U; b < GLYPH_CACHE_BUCKETS; b++)
+    {
+        for (uint16_t i = cache->buckets[b]; (i != GLYPH_CACHE_NONE) && (count < GLYPH_CACHE_MAX_ENTRIES); i = cache->entries[i].next)
+        {
+            const GlyphCacheEntry_t *e = &cache->entries[i];
+
+            if ((e->offset % GLYPH_CACHE_ALIGN) != 0U) ok = false;
+            if (((e->offset + e->size) > cache->budget) || (e->alpha != (cache->pool + e->offset))) ok = false;
+            if (e->pinned != (e->offset < cache->pinned_end)) ok = false;
+            if (e->pinned) pinned++;
+            list[count++] = e;
+        }
+    }
+    if ((count != ((uint32_t)cache->pinned + cache->fifo_count)) || (pinned != cache->pinned)) ok = false;
+    qsort(list, count, sizeof(list[0]), CompareOffset);
+    for (uint32_t i = 1U; i < count; i++)
+    {
+        if ((list[i - 1U]->offset + list[i - 1U]->size) > list[i]->offset) ok = false;
+    }
+    CHECK(ok);
+}
+
+static int CompareOffset(const void *a, const void *b)
+{
+    const GlyphCacheEntry_t *ea = *(const GlyphCacheEntry_t * const *)a;
+    const GlyphCacheEntry_t *eb = *(const GlyphCacheEntry_t * const *)b;
+
+    return (ea->offset > eb->offset) - (ea->offset < eb->offset);
+}
+
+/**
+ * @brief  Next character of a UTF-8 string (up to U+07FF).
+ */
+static uint16_t NextCode(const char **text)
+{
+    const uint8_t *s = (const uint8_t *)*text;
+
+    if ((s[0] >= 0xC0U) && (s[1] != 0U))
+    {
+        *text += 2;
+        return (uint16_t)(((s[0] & 0x1FU) << 6) | (s[1] & 0x3FU));
+    }
+    *text += 1;
+    return s[0];
+}
+
+/**
+ * @brief  Screen of the next visit: the home screen most of the time,
+ *         screen n about half as often as screen n - 1, with a floor.
+ */
+static uint8_t NextScreen(void)
+{
+    uint32_t r = Random() % 1000U;
+    uint8_t screen = 0U;
+    uint32_t share = 400U;
+
+    while ((screen < (SCREENS - 1U)) && (r >= share))
+    {
+        r -= share;
+        share = (share > 60U) ? (share / 2U) : 60U;
+        screen++;
+    }
+    return screen;
+}
+
+static uint32_t Random(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
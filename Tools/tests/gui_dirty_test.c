@@ -0,0 +1,236 @@
+/**
+ ******************************************************************************
+ * File Name          : gui_dirty_test.c
+ * Description        : host test, dirty rectangle list and pixels redrawn per
+ *                      state change
+ ******************************************************************************
+ *
+ * Checks IC/Src/gui_dirty.c against a per-pixel reference: after any
+ * sequence of invalidations the listed rectangles do not overlap, cover
+ * every invalidated pixel, stay within GUI_DIRTY_MAX_RECTS and the pixel
+ * count matches their area; a union over GUI_DIRTY_FULL_PERCENT of the
+ * screen becomes one full redraw.
+ *
+ * It then reports the pixels redrawn per state change on the screens that
+ * draw partially (lights and gates share one tile grid) for 1..6 devices:
+ * one device changing, two neighbours, two devices in different rows and
+ * every device at once, next to the full screen every change used to
+ * repaint. The tile geometry is the one of LightsScreen_GetTileRect() and
+ * GateScreen_GetTileRect() in display.c.
+ *
+ * Build (Linux):
+ *   make -C Tools/tests gui_dirty_test
+ *
+ ******************************************************************************
+ */
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "gui_dirty.h"
+#include "host_test.h"
+/* Private Define ------------------------------------------------------------*/
+#define LCD_W               480
+#define LCD_H               272
+#define FULL_PIXELS         ((uint32_t)LCD_W * LCD_H)
+#define DRAWING_AREA_WIDTH  380             /* display.c */
+#define Y_SINGLE_ROW        86              /* lights_and_gates_grid_layout */
+#define Y_MULTI_ROW         0
+#define ROW_HEIGHT          130
+#define RANDOM_RUNS         2000U
+/* Private Variable ----------------------------------------------------------*/
+static uint8_t ref[LCD_H][LCD_W];           /* pixels invalidated since commit */
+static uint32_t rng = 0x1234567U;
+/* Private Function Prototype ------------------------------------------------*/
+static uint8_t InRow(uint8_t count, uint8_t row);
+static bool TileRect(uint8_t count, uint8_t index, GuiRect_t *rect);
+static uint32_t Change(GuiDirty_t *dirty, uint8_t count, const uint8_t *index, uint8_t n);
+static void CheckList(const GuiDirty_t *dirty);
+static uint32_t Random(void);
+/* Program Code --------------------------------------------------------------*/
+int main(void)
+{
+    GuiDirty_t dirty;
+    uint32_t fulls = 0U, max_rects = 0U;
+
+    // Random invalidations against the per-pixel reference.
+    for (uint32_t run = 0U; run < RANDOM_RUNS; run++)
+    {
+        uint32_t n = 1U + (Random() % 12U);
+
+        GuiDirty_Init(&dirty, LCD_W, LCD_H);
+        memset(ref, 0, sizeof(ref));
+        for (uint32_t k = 0U; k < n; k++)
+        {
+            // Icon sized, every fourth run panel sized; sometimes partly off screen.
+            uint32_t w = ((run % 4U) == 3U) ? 360U : 120U;
+            int16_t x0 = (int16_t)((int32_t)(Random() % (LCD_W + 40U)) - 20);
+            int16_t y0 = (int16_t)((int32_t)(Random() % (LCD_H + 40U)) - 20);
+            int16_t x1 = (int16_t)(x0 + (int16_t)(Random() % w));
+            int16_t y1 = (int16_t)(y0 + (int16_t)(Random() % (w * 3U / 4U)));
+
+            GuiDirty_Invalidate(&dirty, x0, y0, x1, y1);
+            for (int y = (y0 < 0) ? 0 : y0; (y <= y1) && (y < LCD_H); y++)
+            {
+                for (int x = (x0 < 0) ? 0 : x0; (x <= x1) && (x < LCD_W); x++) ref[y][x] = 1U;
+            }
+            CheckList(&dirty);
+        }
+        if (dirty.full) fulls++;
+        if (GuiDirty_Count(&dirty) > max_rects) max_rects = GuiDirty_Count(&dirty);
+        CHECK(GuiDirty_Commit(&dirty) == dirty.last_pixels);
+        CHECK(GuiDirty_IsEmpty(&dirty));
+    }
+    printf("%u random runs: %u fell back to full screen, at most %u rectangles\n", RANDOM_RUNS, fulls, max_rects);
+
+    // Nothing on screen is nothing to draw.
+    GuiDirty_Init(&dirty, LCD_W, LCD_H);
+    GuiDirty_Invalidate(&dirty, -50, -50, -1, -1);
+    GuiDirty_Invalidate(&dirty, LCD_W, 0, LCD_W + 10, 10);
+    CHECK(GuiDirty_IsEmpty(&dirty));
+    GuiDirty_InvalidateAll(&dirty);
+    CHECK(GuiDirty_Commit(&dirty) == FULL_PIXELS);
+
+    // Pixels redrawn per state change on the lights and gate screens.
+    printf("devices   one  neighbours  two rows   all   (full screen %u px)\n", (unsigned)FULL_PIXELS);
+    for (uint8_t count = 1U; count <= 6U; count++)
+    {
+        static const uint8_t all[] = { 0U, 1U, 2U, 3U, 4U, 5U };
+        const uint8_t pair[] = { 0U, 1U };
+        const uint8_t rows[] = { 0U, (uint8_t)(count - 1U) };
+        uint32_t one = 0U, two, cross, every;
+
+        GuiDirty_Init(&dirty, LCD_W, LCD_H);
+        for (uint8_t i = 0U; i < count; i++)
+        {
+            uint32_t px = Change(&dirty, count, &i, 1U);
+            GuiRect_t tile;
+
+            CHECK(TileRect(count, i, &tile));
+            CHECK(px == (uint32_t)((tile.x1 - tile.x0 + 1) * (tile.y1 - tile.y0 + 1)));
+            CHECK(px < FULL_PIXELS);
+            if (px > one) one = px;
+        }
+        two = (count > 1U) ? Change(&dirty, count, pair, 2U) : one;
+        cross = (count > 3U) ? Change(&dirty, count, rows, 2U) : two;
+        every = Change(&dirty, count, all, count);
+        CHECK(two <= (2U * one));
+        CHECK(cross <= (2U * one));
+        CHECK(every <= FULL_PIXELS);
+        printf("%7u %6u %11u %9u %6u\n", count, (unsigned)one, (unsigned)two, (unsigned)cross, (unsigned)every);
+    }
+
+    return HOST_TEST_END("gui_dirty_test");
+}
+
+static uint8_t InRow(uint8_t count, uint8_t row)
+{
+    if (count <= 3U) return count;
+    if (count == 4U) return 2U;
+    if (count == 5U) return (row > 0U) ? 2U : 3U;
+    return 3U;
+}
+
+/**
+ * @brief  Tile of one light or gate, as on the target.
+ */
+static bool TileRect(uint8_t count, uint8_t index, GuiRect_t *rect)
+{
+    uint8_t rows = (count > 3U) ? 2U : 1U;
+    int y = (rows > 1U) ? Y_MULTI_ROW : Y_SINGLE_ROW;
+    uint8_t sum = 0U;
+
+    for (uint8_t row = 0U; row < rows; row++)
+    {
+        uint8_t in_row = InRow(count, row);
+
+        if (index < (sum + in_row))
+        {
+            int idx = index - sum;
+            int space = (400 - (80 * in_row)) / (in_row - 1 + 2);
+            int center = (space * (idx + 1)) + (80 * idx) + 40;
+            int half = (DRAWING_AREA_WIDTH / in_row) / 2;
+
+            rect->x0 = (int16_t)(center - half);
+            rect->x1 = (int16_t)(center + half - 1);
+            rect->y0 = (int16_t)y;
+            rect->y1 = (int16_t)(y + ROW_HEIGHT - 1);
+            return true;
+        }
+        sum = (uint8_t)(sum + in_row);
+        y += ROW_HEIGHT;
+    }
+    return false;
+}
+
+/**
+ * @brief  State of `n` devices changed: invalidate their tiles, redraw.
+ * @retval pixels redrawn
+ */
+static uint32_t Change(GuiDirty_t *dirty, uint8_t count, const uint8_t *index, uint8_t n)
+{
+    memset(ref, 0, sizeof(ref));
+    for (uint8_t i = 0U; i < n; i++)
+    {
+        GuiRect_t t;
+
+        if (!TileRect(count, index[i], &t)) continue;
+        GuiDirty_Invalidate(dirty, t.x0, t.y0, t.x1, t.y1);
+        for (int y = t.y0; y <= t.y1; y++)
+        {
+            for (int x = (t.x0 < 0) ? 0 : t.x0; (x <= t.x1) && (x < LCD_W); x++) ref[y][x] = 1U;
+        }
+    }
+    CheckList(dirty);
+    return GuiDirty_Commit(dirty);
+}
+
+/**
+ * @brief  List invariants against the reference bitmap.
+ */
+static void CheckList(const GuiDirty_t *dirty)
+{
+    static uint8_t cover[LCD_H][LCD_W];
+    uint32_t area = 0U;
+    bool overlap = false, missing = false;
+
+    CHECK(GuiDirty_Count(dirty) <= GUI_DIRTY_MAX_RECTS);
+    memset(cover, 0, sizeof(cover));
+    for (uint8_t i = 0U; i < GuiDirty_Count(dirty); i++)
+    {
+        GuiRect_t r;
+
+        CHECK(GuiDirty_Get(dirty, i, &r));
+        CHECK((r.x0 >= 0) && (r.y0 >= 0) && (r.x1 < LCD_W) && (r.y1 < LCD_H) && (r.x0 <= r.x1) && (r.y0 <= r.y1));
+        area += (uint32_t)((r.x1 - r.x0 + 1) * (r.y1 - r.y0 + 1));
+        for (int y = r.y0; y <= r.y1; y++)
+        {
+            for (int x = r.x0; x <= r.x1; x++)
+            {
+                if (cover[y][x]) overlap = true;
+                cover[y][x] = 1U;
+            }
+        }
+    }
+    for (int y = 0; y < LCD_H; y++)
+    {
+        for (int x = 0; x < LCD_W; x++)
+        {
+            if (ref[y][x] && !cover[y][x]) missing = true;
+        }
+    }
+    CHECK(!overlap);
+    CHECK(!missing);
+    CHECK(GuiDirty_Pixels(dirty) == area);
+    // A union this large is drawn as one full screen pass.
+    if (!dirty->full) CHECK((area * 100U) < (FULL_PIXELS * GUI_DIRTY_FULL_PERCENT));
+}
+
+static uint32_t Random(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
@@ -0,0 +1,450 @@
+/**
+ ******************************************************************************
+ * File Name          : gui_prof_test.c
+ * Description        : host test, GUI profiler accuracy and overhead against
+ *                      measuring every pass
+ ******************************************************************************
+ *
+ * Checks the histograms of IC/Src/gui_prof.c against exact percentiles of
+ * the same samples: the reported p50 and p95 are the upper edge of the
+ * log2 bin the exact value falls into (capped at the maximum), also after
+ * the bins were halved on saturation.
+ *
+ * It then runs DISP_Service() of IC/Src/display.c on a model of the
+ * board: a 216 MHz DWT counter where every read costs READ_CYCLES and
+ * every measured pass RECORD_CYCLES more, GUI_Exec() drawing into a
+ * buffer that waits for the next 60 Hz vsync, DMA2D busy for part of
+ * every frame and touches at random times. The counter starts just
+ * before it wraps. The test keeps the true cost of the profiler, the
+ * true DMA2D busy cycles and the true touch to display latency (flip of
+ * the first buffer rendered after the touch) and requires:
+ *  - every measured touch latency exactly as the model saw it,
+ *  - the DMA2D total exactly as counted, the window share within 0.1 %,
+ *  - the cost within the budget once decimation settled (unless already
+ *    at GUI_PROF_MAX_DECIMATION), screen percentiles within their bin.
+ * Every screen load runs with the budget of display.c (1 %) and with
+ * every pass measured (budget 100 %); the report compares the two.
+ *
+ * Build (Linux):
+ *   make -C Tools/tests gui_prof_test
+ *
+ ******************************************************************************
+ */
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "gui_prof.h"
+#include "host_test.h"
+/* Private Define ------------------------------------------------------------*/
+#define CPU_MHZ             216U            /* SystemCoreClock / 1000000 */
+#define READ_CYCLES         6U              /* DWT->CYCCNT read */
+#define RECORD_CYCLES       400U            /* histogram, flip and window work */
+#define VSYNC_CYCLES        (CPU_MHZ * 16667U)
+#define RUN_MS              16000U
+#define SETTLE_MS           7000U           /* 1 s windows to double up to 1/64 */
+#define BUDGET_PERMILLE     10U             /* GUI_PROF_BUDGET_PERMILLE */
+#define MAX_SAMPLES         40000U
+#define LOADS               (sizeof(loads) / sizeof(loads[0]))
+/* Private Type --------------------------------------------------------------*/
+typedef struct
+{
+    const char *name;
+    uint32_t    service_min_us, service_max_us;
+    uint32_t    exec_min_us, exec_max_us;   /* GUI_Exec() with something to draw */
+    uint32_t    redraw_ms;                  /* animation period, 0: none */
+    uint32_t    touch_ms;                   /* mean touch period, 0: none */
+    uint32_t    loop_us;                    /* rest of the main loop pass */
+} Load_t;
+
+typedef struct
+{
+    uint32_t cost_permille;                 /* true profiler cost after SETTLE_MS */
+    uint32_t cost_max_permille;             /* worst true window after SETTLE_MS */
+    uint8_t  decimation;
+    uint32_t p50, p95;                      /* screen histogram */
+    uint32_t exact_p50, exact_p95;          /* measured passes */
+    uint32_t max;
+    uint32_t touches, measured, dropped;
+    uint32_t touch_p95, touch_exact_p95;
+} Result_t;
+/* Private Variable ----------------------------------------------------------*/
+static const Load_t loads[] =
+{
+    { "main clock",        2U,     6U,  900U,  1500U, 1000U,   0U,   8U },
+    { "thermostat",       20U,    60U, 2500U,  6000U,    0U, 400U,  40U },
+    { "slider drag",     120U,   400U, 4000U,  9000U,   20U,  30U, 300U },
+    { "settings list",   800U,  3000U, 6000U, 14000U,    0U, 250U, 300U },
+    { "qr code",        5000U, 20000U, 9000U, 30000U,    0U, 900U, 300U },
+};
+static uint64_t t;                          /* cycles since start */
+static uint64_t next_vsync;
+static uint64_t prof_cycles;                /* true profiler cost */
+static uint32_t dma, flips, flip_time;
+static bool pending;
+static uint64_t pending_start;              /* render start of the pending buffer */
+static uint64_t touch_wait;                 /* touch the profiler measures, 0: none */
+static uint32_t touch_true_us;              /* its latency, once displayed */
+static uint32_t rng;
+static uint32_t samples[MAX_SAMPLES], touch_samples[MAX_SAMPLES];
+/* Private Function Prototype ------------------------------------------------*/
+static uint32_t Now(void);
+static uint32_t DmaBusy(void);
+static uint32_t Flips(void);
+static uint32_t FlipTime(void);
+static bool BufferPending(void);
+static void Advance(uint64_t cycles);
+static void Run(const Load_t *load, uint16_t budget, Result_t *res);
+static uint32_t Exact(uint32_t *v, uint32_t n, uint8_t pct);
+static bool InBin(uint32_t hist, uint32_t exact, uint32_t max);
+static int Compare(const void *a, const void *b);
+static uint32_t Random(void);
+static uint32_t Between(uint32_t lo, uint32_t hi);
+/* Program Code --------------------------------------------------------------*/
+int main(void)
+{
+    static const GuiProfOps_t ops = { Now, DmaBusy, Flips, FlipTime, BufferPending };
+    GuiProf_t prof;
+    GuiHist_t hist;
+    char buf[600];
+    uint32_t n;
+
+    rng = 0x2545F491U;
+
+    // Bins and exact percentiles.
+    memset(&hist, 0, sizeof(hist));
+    CHECK(GuiHist_Percentile(&hist, 50U) == 0U);
+    GuiHist_Add(&hist, 0U);
+    GuiHist_Add(&hist, 1U);
+    CHECK(hist.bins[0] == 2U);
+    GuiHist_Add(&hist, 2U);
+    CHECK(hist.bins[1] == 1U);
+    GuiHist_Add(&hist, UINT32_MAX);
+    CHECK((hist.bins[GUI_PROF_BINS - 1U] == 1U) && (hist.max_us == UINT32_MAX));
+    CHECK(GuiHist_Percentile(&hist, 100U) == UINT32_MAX);
+    CHECK(GuiHist_Percentile(&hist, 75U) == 3U);
+    for (uint8_t round = 0U; round < 2U; round++)
+    {
+        // The second round saturates bins and halves them.
+        uint32_t count = (round == 0U) ? 5000U : MAX_SAMPLES;
+
+        memset(&hist, 0, sizeof(hist));
+        for (uint32_t i = 0U; i < count; i++)
+        {
+            samples[i] = (Random() % 8U == 0U) ? Between(2000U, 60000U) : Between(40U, 900U);
+            GuiHist_Add(&hist, samples[i]);
+        }
+        CHECK(hist.count == count);
+        if (round == 1U) CHECK(hist.bins[9] < UINT16_MAX);
+        CHECK(InBin(GuiHist_Percentile(&hist, 50U), Exact(samples, count, 50U), hist.max_us));
+        CHECK(InBin(GuiHist_Percentile(&hist, 95U), Exact(samples, count, 95U), hist.max_us));
+        CHECK(GuiHist_Percentile(&hist, 100U) == hist.max_us);
+    }
+
+    // Touch flip targeting and timeout.
+    t = 0xF0000000ULL;
+    next_vsync = t + VSYNC_CYCLES;
+    GuiProf_Init(&prof, &ops, CPU_MHZ, BUDGET_PERMILLE);
+    CHECK((prof.probe_cycles == READ_CYCLES) && (prof.skip_cycles == READ_CYCLES) && (prof.decimation == 1U));
+    pending = true;
+    GuiProf_Touch(&prof);
+    CHECK(prof.touch_flip == (flips + 2U));
+    GuiProf_Touch(&prof);                   /* second touch before display: not measured */
+    CHECK(prof.touch_flip == (flips + 2U));
+    pending = false;
+    flips++;
+    flip_time = Now();
+    GuiProf_Pass(&prof, 1U, Now());
+    CHECK(prof.touch_pending);
+    flips++;
+    flip_time = (uint32_t)(prof.touch_start + (8000U * CPU_MHZ));
+    GuiProf_Pass(&prof, 1U, Now());
+    CHECK(!prof.touch_pending && (prof.touch.last_us == 8000U));
+    GuiProf_Touch(&prof);
+    Advance((uint64_t)GUI_PROF_TOUCH_TIMEOUT_US * CPU_MHZ);
+    GuiProf_Pass(&prof, 1U, Now());
+    CHECK(!prof.touch_pending && (prof.touch_dropped == 1U) && (prof.touch.count == 1U));
+    GuiProf_Pass(&prof, GUI_PROF_MAX_SCREENS, Now());
+    CHECK(prof.screen[1].count == 3U);
+
+    // Screen loads, with the budget and with every pass measured.
+    printf("%-14s %-6s %7s %7s %4s %11s %11s %15s\n", "screen", "budget", "cost %", "worst %", "1/n",
+           "p50 hist/ex", "p95 hist/ex", "touch p95 h/ex");
+    for (uint8_t l = 0U; l < LOADS; l++)
+    {
+        for (uint8_t b = 0U; b < 2U; b++)
+        {
+            uint16_t budget = (b == 0U) ? 1000U : BUDGET_PERMILLE;
+            Result_t res;
+
+            Run(&loads[l], budget, &res);
+            printf("%-14s %5u%% %5u.%u %5u.%u %4u %5u/%5u %5u/%5u %7u/%7u\n", loads[l].name, budget / 10U,
+                   res.cost_permille / 10U, res.cost_permille % 10U,
+                   res.cost_max_permille / 10U, res.cost_max_permille % 10U, res.decimation,
+                   res.p50, res.exact_p50, res.p95, res.exact_p95, res.touch_p95, res.touch_exact_p95);
+            CHECK(InBin(res.p50, res.exact_p50, res.max));
+            CHECK(InBin(res.p95, res.exact_p95, res.max));
+            if (loads[l].touch_ms != 0U) CHECK((res.measured > 0U) && (res.dropped == 0U));
+            if (budget == 1000U) CHECK(res.decimation == 1U);
+            if ((budget == BUDGET_PERMILLE) && (res.decimation < GUI_PROF_MAX_DECIMATION))
+            {
+                CHECK(res.cost_max_permille <= BUDGET_PERMILLE);
+            }
+        }
+    }
+
+    // Report and reset.
+    GuiProf_Exec(&prof, 12000U);
+    n = GuiProf_Report(&prof, buf, sizeof(buf));
+    CHECK((n == strlen(buf)) && (strstr(buf, "scr  1: n 3") != NULL) && (strstr(buf, "touch dropped 1") != NULL));
+    for (uint32_t size = 1U; size < (n + 2U); size++)
+    {
+        char small[sizeof(buf)];
+        uint32_t m;
+
+        memset(small, 'x', sizeof(small));
+        m = GuiProf_Report(&prof, small, size);
+        CHECK((m < size) && (strlen(small) == m) && (strncmp(small, buf, m) == 0));
+    }
+    GuiProf_Reset(&prof);
+    CHECK((prof.screen[1].count == 0U) && (prof.exec.count == 0U) && (prof.touch_dropped == 0U));
+
+    return HOST_TEST_END("gui_prof_test");
+}
+
+/**
+ * @brief  DWT->CYCCNT; every read costs the profiler READ_CYCLES.
+ */
+static uint32_t Now(void)
+{
+    uint32_t now = (uint32_t)t;
+
+    prof_cycles += READ_CYCLES;
+    Advance(READ_CYCLES);
+    return now;
+}
+
+/**
+ * @brief  DMA2D busy counter, read once per measured pass; stands for the
+ *         whole work of a measured pass.
+ */
+static uint32_t DmaBusy(void)
+{
+    prof_cycles += RECORD_CYCLES;
+    Advance(RECORD_CYCLES);
+    return dma;
+}
+
+static uint32_t Flips(void)
+{
+    return flips;
+}
+
+static uint32_t FlipTime(void)
+{
+    return flip_time;
+}
+
+static bool BufferPending(void)
+{
+    return pending;
+}
+
+/**
+ * @brief  Lets time pass; a pending buffer is shown at the next vsync.
+ */
+static void Advance(uint64_t cycles)
+{
+    uint64_t end = t + cycles;
+
+    while (next_vsync <= end)
+    {
+        t = next_vsync;
+        next_vsync += VSYNC_CYCLES;
+        if (!pending) continue;
+        pending = false;
+        flips++;
+        flip_time = (uint32_t)t;
+        if ((touch_wait != 0U) && (pending_start >= touch_wait))
+        {
+            touch_true_us = (uint32_t)((t - touch_wait) / CPU_MHZ);
+            touch_wait = 0U;
+        }
+    }
+    t = end;
+}
+
+/**
+ * @brief  RUN_MS of one screen with the main loop of main.c: touch, then
+ *         DISP_Service() (GUI_Exec() when something is to be drawn and no
+ *         buffer waits, the screen service measured by GuiProf_Pass()).
+ */
+static void Run(const Load_t *load, uint16_t budget, Result_t *res)
+{
+    static const GuiProfOps_t ops = { Now, DmaBusy, Flips, FlipTime, BufferPending };
+    GuiProf_t prof;
+    uint64_t start, settle, window_t, window_prof, settle_prof = 0U, measured_dma = 0U;
+    uint64_t next_touch, next_redraw;
+    uint32_t dma_start, window_dma, window_start, passes = 0U, touches_seen = 0U;
+    bool dirty = false;
+
+    memset(res, 0, sizeof(Result_t));
+    t = 0xFFFFFFFFULL - (3ULL * CPU_MHZ * 1000000U);
+    next_vsync = t + VSYNC_CYCLES;
+    dma = 0xFFFF0000U;
+    flips = 0U;
+    pending = false;
+    touch_wait = 0U;
+    prof_cycles = 0U;
+    GuiProf_Init(&prof, &ops, CPU_MHZ, budget);
+    start = t;
+    settle = start + ((uint64_t)SETTLE_MS * CPU_MHZ * 1000U);
+    dma_start = dma;
+    window_start = prof.window_start;
+    window_t = t;
+    window_prof = prof_cycles;
+    window_dma = dma;
+    next_touch = (load->touch_ms != 0U) ? (t + ((uint64_t)Between(1U, load->touch_ms) * CPU_MHZ * 1000U)) : UINT64_MAX;
+    next_redraw = (load->redraw_ms != 0U) ? t : UINT64_MAX;
+
+    while ((t - start) < ((uint64_t)RUN_MS * CPU_MHZ * 1000U))
+    {
+        uint32_t service_start, cycles;
+
+        if (t >= next_touch)
+        {
+            bool was_pending = prof.touch_pending;
+
+            next_touch = t + ((uint64_t)Between(load->touch_ms / 2U, load->touch_ms * 3U / 2U) * CPU_MHZ * 1000U);
+            dirty = true;
+            res->touches++;
+            GuiProf_Touch(&prof);
+            if (!was_pending && prof.touch_pending)
+            {
+                touch_wait = t - (READ_CYCLES * 2U);
+                touch_true_us = 0U;
+            }
+        }
+        if (t >= next_redraw)
+        {
+            next_redraw += (uint64_t)load->redraw_ms * CPU_MHZ * 1000U;
+            dirty = true;
+        }
+        if (dirty && !pending)
+        {
+            uint32_t exec_us = Between(load->exec_min_us, load->exec_max_us);
+
+            dirty = false;
+            pending_start = t;
+            dma += (exec_us / 3U) * CPU_MHZ;
+            Advance((uint64_t)exec_us * CPU_MHZ);
+            pending = true;
+            GuiProf_Exec(&prof, exec_us);
+        }
+
+        service_start = Now();
+        cycles = Between(load->service_min_us, load->service_max_us) * CPU_MHZ;
+        Advance(cycles);
+        GuiProf_Pass(&prof, 2U, service_start);
+        if (prof.skipped == 0U)
+        {
+            measured_dma = (uint32_t)(dma - dma_start);
+            if (passes < MAX_SAMPLES) samples[passes++] = (cycles + READ_CYCLES) / CPU_MHZ;
+        }
+
+        if (prof.touch.count != res->measured)
+        {
+            // The latency the profiler took has to be the one the model saw.
+            CHECK(touch_true_us != 0U);
+            CHECK(prof.touch.last_us == touch_true_us);
+            res->measured = prof.touch.count;
+            if (touches_seen < MAX_SAMPLES) touch_samples[touches_seen++] = touch_true_us;
+            touch_true_us = 0U;
+        }
+        if (prof.window_start != window_start)
+        {
+            // Window just closed: true cost of the profiler and DMA2D share in it.
+            uint64_t len = t - window_t;
+            uint32_t permille = (uint32_t)(((prof_cycles - window_prof) * 1000U) / len);
+            uint32_t dma_permille = (uint32_t)(((uint64_t)(uint32_t)(dma - window_dma) * 1000U) / len);
+
+            if ((t > settle) && (permille > res->cost_max_permille)) res->cost_max_permille = permille;
+            CHECK((prof.dma_permille + 1U >= dma_permille) && (prof.dma_permille <= dma_permille + 1U));
+            window_start = prof.window_start;
+            window_t = t;
+            window_prof = prof_cycles;
+            window_dma = dma;
+            if ((t > settle) && (settle_prof == 0U))
+            {
+                settle_prof = prof_cycles;
+                settle = t;
+            }
+        }
+        Advance((uint64_t)load->loop_us * CPU_MHZ);
+    }
+
+    CHECK(prof.dma_total == measured_dma);
+    res->cost_permille = (uint32_t)(((prof_cycles - settle_prof) * 1000U) / (t - settle));
+    res->decimation = prof.decimation;
+    res->p50 = GuiHist_Percentile(&prof.screen[2], 50U);
+    res->p95 = GuiHist_Percentile(&prof.screen[2], 95U);
+    res->max = prof.screen[2].max_us;
+    res->exact_p50 = Exact(samples, passes, 50U);
+    res->exact_p95 = Exact(samples, passes, 95U);
+    res->dropped = prof.touch_dropped;
+    res->touch_p95 = GuiHist_Percentile(&prof.touch, 95U);
+    res->touch_exact_p95 = Exact(touch_samples, touches_seen, 95U);
+}
+
+/**
+ * @brief  Exact percentile, rounded up to a whole sample like the
+ *         histogram; sorts `v`.
+ */
+static uint32_t Exact(uint32_t *v, uint32_t n, uint8_t pct)
+{
+    uint32_t k;
+
+    if (n == 0U) return 0U;
+    qsort(v, n, sizeof(uint32_t), Compare);
+    k = ((n * pct) + 99U) / 100U;
+    return v[(k != 0U) ? (k - 1U) : 0U];
+}
+
+/**
+ * @brief  Histogram percentile is the upper edge of the bin the exact one
+ *         falls into, or the maximum.
+ */
+static bool InBin(uint32_t hist, uint32_t exact, uint32_t max)
+{
+    uint8_t bin = 0U;
+
+    for (uint32_t us = exact; (us > 1U) && (bin < (GUI_PROF_BINS - 1U)); us >>= 1) bin++;
+    if (bin == (GUI_PROF_BINS - 1U)) return hist == max;
+    return hist == ((((2U << bin) - 1U) < max) ? ((2U << bin) - 1U) : max);
+}
+
+static int Compare(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief  xorshift32, repeatable between runs.
+ */
+static uint32_t Random(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+static uint32_t Between(uint32_t lo, uint32_t hi)
+{
+    return lo + (Random() % (hi - lo + 1U));
+}
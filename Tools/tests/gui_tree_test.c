@@ -0,0 +1,376 @@
+/**
+ ******************************************************************************
+ * File Name          : gui_tree_test.c
+ * Description        : host test, widget trees per screen over a replayed
+ *                      navigation trace
+ ******************************************************************************
+ *
+ * Runs IC/Src/gui_tree.c against a model of the emWin window tree: every
+ * widget is created on the desktop of its layer, a root is a window like
+ * any other and deleting it deletes its children. Screens are entered
+ * the way display.c does it: Init creates the widgets and calls
+ * GuiTree_Sync(), the main loop calls it before every GUI_Exec(), Kill
+ * deletes the widgets. Kill functions sometimes miss a widget, as the
+ * ones ForceKillAllSettingsWidgets() used to sweep up. The numpad and the
+ * alphanumeric keyboard are persistent: Kill hides them and Init only
+ * creates their buttons when the tree has none.
+ *
+ * After every main loop pass no widget may be left on a desktop, only
+ * the widgets of the active screen may be visible, every widget has to
+ * belong to the active screen or a persistent one and every missed
+ * widget has to be counted as leaked. The GUI heap has to be the same on
+ * every return to the main screen. The test reports enters, builds and
+ * reuses per screen and widgets created next to a rebuild on every
+ * enter.
+ *
+ * Build (Linux):
+ *   make -C Tools/tests gui_tree_test
+ *
+ ******************************************************************************
+ */
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "gui_tree.h"
+#include "host_test.h"
+/* Private Define ------------------------------------------------------------*/
+#define WINDOWS             512U            /* handle 0 is "no window" */
+#define WINDOW_BYTES        120U            /* GUI heap per window */
+#define CREATE_US           40U             /* time to create one widget */
+#define VISITS              3000U
+#define PASSES              3U              /* main loop passes per visit */
+#define LEAK_ONE_IN         8U              /* Kill misses a widget */
+#define SCREENS             (sizeof(screens) / sizeof(screens[0]))
+/* Private Type --------------------------------------------------------------*/
+typedef struct
+{
+    const char *name;
+    uint8_t     id;                         /* `screen` */
+    uint8_t     widgets[GUI_TREE_LAYERS];   /* created by Init per layer */
+    bool        persistent;
+} Screen_t;
+
+typedef struct
+{
+    bool     used;
+    bool     root;
+    bool     visible;
+    uint8_t  layer;
+    uint32_t parent;                        /* 0: desktop */
+} Window_t;
+/* Private Variable ----------------------------------------------------------*/
+static const Screen_t screens[] =
+{
+    { "main",          1U, {  0U, 0U }, false },
+    { "lights",        2U, {  0U, 8U }, false },
+    { "settings 1",   21U, {  1U, 12U }, false },
+    { "settings 2",   22U, {  0U, 9U }, false },
+    { "qr code",      18U, {  0U, 3U }, false },
+    { "keyboard",     19U, {  0U, 40U }, true },
+    { "numpad",       20U, {  0U, 12U }, true },
+};
+static Window_t win[WINDOWS];
+static uint32_t heap, t_us, created;
+static uint32_t rng = 0x1234567U;
+/* Private Function Prototype ------------------------------------------------*/
+static uint32_t CreateRoot(uint8_t layer);
+static uint16_t Destroy(uint32_t root);
+static void Show(uint32_t root, bool visible);
+static uint16_t Adopt(uint8_t layer, uint32_t root);
+static uint32_t HeapUsed(void);
+static uint32_t Now(void);
+static uint32_t ElapsedUs(uint32_t start);
+static uint32_t NewWindow(uint8_t layer);
+static void DeleteWindow(uint32_t h);
+static uint32_t Enter(GuiTree_t *tree, uint8_t s);
+static uint32_t Kill(GuiTree_t *tree, uint8_t s);
+static void CheckTree(const GuiTree_t *tree, uint8_t s);
+static bool Owned(const GuiTree_t *tree, uint32_t root, uint8_t *owner);
+static uint32_t Random(void);
+/* Program Code --------------------------------------------------------------*/
+int main(void)
+{
+    static const GuiTreeOps_t ops = { CreateRoot, Destroy, Show, Adopt, HeapUsed, Now, ElapsedUs };
+    static GuiTree_t tree;
+    static char report[2048];
+    uint32_t rebuild = 0U, leaks = 0U, main_heap = 0U;
+    uint8_t s = 0U;
+
+    GuiTree_Init(&tree, &ops);
+    for (uint8_t i = 0U; i < SCREENS; i++)
+    {
+        if (screens[i].persistent) GuiTree_SetPersistent(&tree, screens[i].id);
+    }
+
+    // Navigation: from the main screen into a screen and sometimes on to
+    // the keyboard or numpad, back again.
+    rebuild += Enter(&tree, s);
+    for (uint32_t v = 0U; v < VISITS; v++)
+    {
+        uint8_t next = (s == 0U) ? (uint8_t)(1U + (Random() % (SCREENS - 1U))) : 0U;
+
+        if ((s == 2U) || (s == 3U)) next = ((Random() % 3U) == 0U) ? (uint8_t)(5U + (Random() % 2U)) : 0U;
+        leaks += Kill(&tree, s);
+        s = next;
+        rebuild += Enter(&tree, s);
+        if (s == 0U)
+        {
+            // Only the persistent trees stay allocated.
+            main_heap = 0U;
+            for (uint8_t i = 0U; i < SCREENS; i++)
+            {
+                const GuiTreeScreen_t *ts = &tree.screens[screens[i].id];
+
+                if (!screens[i].persistent) continue;
+                main_heap += ts->widgets * WINDOW_BYTES;
+                for (uint8_t layer = 0U; layer < GUI_TREE_LAYERS; layer++)
+                {
+                    if (ts->root[layer] != 0U) main_heap += WINDOW_BYTES;
+                }
+            }
+            CHECK(heap == main_heap);
+        }
+    }
+    CHECK(tree.leaked == leaks);
+    CHECK(leaks != 0U);
+
+    printf("%-12s %6s %6s %6s %7s %10s %10s\n", "screen", "enters", "builds", "reuses", "widgets", "last us", "max us");
+    for (uint8_t i = 0U; i < SCREENS; i++)
+    {
+        const GuiTreeScreen_t *ts = &tree.screens[screens[i].id];
+
+        printf("%-12s %6u %6u %6u %7u %10u %10u\n", screens[i].name, ts->enters, ts->builds, ts->reuses,
+               ts->widgets, ts->transition_last_us, ts->transition_max_us);
+        if (screens[i].persistent)
+        {
+            // Built once, every later enter only shows the tree again.
+            CHECK(ts->builds == 1U);
+            CHECK(ts->reuses == (ts->enters - 1U));
+            CHECK(ts->transition_last_us < ts->transition_max_us);
+        }
+        else if ((screens[i].widgets[0] + screens[i].widgets[1]) != 0U)
+        {
+            // From the pass that switched `screen` to the first pass without
+            // new widgets: Init and one main loop pass.
+            CHECK((ts->builds == ts->enters) && (ts->reuses == 0U));
+            CHECK(ts->transition_max_us == (500U + ((screens[i].widgets[0] + screens[i].widgets[1]) * CREATE_US) + 1000U));
+        }
+    }
+    printf("widgets created: %u (rebuilt on every enter: %u), leaked %u, heap peak %u B\n",
+           created, rebuild, tree.leaked, tree.heap_peak);
+    CHECK(created < rebuild);
+
+    // A screen outside the table is ignored.
+    GuiTree_Sync(&tree, GUI_TREE_MAX_SCREENS);
+    GuiTree_Hide(&tree, GUI_TREE_MAX_SCREENS);
+    CHECK(tree.current == screens[s].id);
+
+    // Report: one line per visited screen, nothing cut in the middle.
+    CHECK(GuiTree_Report(&tree, report, sizeof(report)) == strlen(report));
+    CHECK(strncmp(report, "widgets ", 8U) == 0);
+    CHECK(GuiTree_Report(&tree, report, 100U) == strlen(report));
+    CHECK((strlen(report) < 100U) && (report[strlen(report) - 1U] == '\n'));
+    CHECK(GuiTree_Report(&tree, report, 10U) == 0U);
+    CHECK(report[0] == '\0');
+
+    return HOST_TEST_END("gui_tree_test");
+}
+
+static uint32_t CreateRoot(uint8_t layer)
+{
+    uint32_t h = NewWindow(layer);
+
+    if (h != 0U) win[h].root = true;
+    return h;
+}
+
+static uint16_t Destroy(uint32_t root)
+{
+    uint16_t children = 0U;
+
+    for (uint32_t h = 1U; h < WINDOWS; h++)
+    {
+        if (win[h].used && (win[h].parent == root))
+        {
+            DeleteWindow(h);
+            children++;
+        }
+    }
+    DeleteWindow(root);
+    return children;
+}
+
+static void Show(uint32_t root, bool visible)
+{
+    win[root].visible = visible;
+}
+
+static uint16_t Adopt(uint8_t layer, uint32_t root)
+{
+    uint16_t n = 0U;
+
+    for (uint32_t h = 1U; h < WINDOWS; h++)
+    {
+        if (!win[h].used || win[h].root || (win[h].parent != 0U) || (win[h].layer != layer)) continue;
+        if (root != 0U) win[h].parent = root;
+        n++;
+    }
+    return n;
+}
+
+static uint32_t HeapUsed(void)
+{
+    return heap;
+}
+
+static uint32_t Now(void)
+{
+    return t_us;
+}
+
+static uint32_t ElapsedUs(uint32_t start)
+{
+    return t_us - start;
+}
+
+static uint32_t NewWindow(uint8_t layer)
+{
+    for (uint32_t h = 1U; h < WINDOWS; h++)
+    {
+        if (win[h].used) continue;
+        win[h] = (Window_t){ true, false, true, layer, 0U };
+        heap += WINDOW_BYTES;
+        return h;
+    }
+    CHECK(false);                           /* WINDOWS too small */
+    return 0U;
+}
+
+static void DeleteWindow(uint32_t h)
+{
+    if (!win[h].used) return;
+    win[h].used = false;
+    heap -= WINDOW_BYTES;
+}
+
+/**
+ * @brief  Enters screen `s`: Init, then PASSES main loop passes.
+ * @retval widgets a rebuild on every enter would have created
+ */
+static uint32_t Enter(GuiTree_t *tree, uint8_t s)
+{
+    const Screen_t *scr = &screens[s];
+
+    t_us += 500U;                           /* the pass that switches `screen` */
+    if (!scr->persistent || (tree->screens[scr->id].widgets == 0U))
+    {
+        for (uint8_t layer = 0U; layer < GUI_TREE_LAYERS; layer++)
+        {
+            for (uint8_t k = 0U; k < scr->widgets[layer]; k++)
+            {
+                if (NewWindow(layer) != 0U) created++;
+                t_us += CREATE_US;
+            }
+        }
+    }
+    GuiTree_Sync(tree, scr->id);            /* from Init */
+    for (uint32_t p = 0U; p < PASSES; p++)
+    {
+        t_us += 1000U;
+        GuiTree_Sync(tree, scr->id);
+        CheckTree(tree, s);
+    }
+    CHECK(!tree->measuring);
+    return (uint32_t)scr->widgets[0] + scr->widgets[1];
+}
+
+/**
+ * @brief  Leaves screen `s`: DSP_Kill* deletes its widgets, sometimes
+ *         all but one; persistent screens are hidden.
+ * @retval widgets Kill missed
+ */
+static uint32_t Kill(GuiTree_t *tree, uint8_t s)
+{
+    const GuiTreeScreen_t *ts = &tree->screens[screens[s].id];
+    bool miss = ((Random() % LEAK_ONE_IN) == 0U);
+    uint32_t missed = 0U;
+
+    if (screens[s].persistent)
+    {
+        GuiTree_Hide(tree, screens[s].id);
+        return 0U;
+    }
+    for (uint32_t h = 1U; h < WINDOWS; h++)
+    {
+        bool child = false;
+
+        for (uint8_t layer = 0U; layer < GUI_TREE_LAYERS; layer++)
+        {
+            if ((ts->root[layer] != 0U) && (win[h].parent == ts->root[layer])) child = true;
+        }
+        if (!win[h].used || !child) continue;
+        if (miss && (missed == 0U))
+        {
+            missed++;
+            continue;
+        }
+        DeleteWindow(h);
+    }
+    return missed;
+}
+
+/**
+ * @brief  Nothing on a desktop, every widget owned, only screen `s` shown.
+ */
+static void CheckTree(const GuiTree_t *tree, uint8_t s)
+{
+    uint32_t on_desktop = 0U, orphans = 0U, shown_elsewhere = 0U, own = 0U;
+
+    for (uint32_t h = 1U; h < WINDOWS; h++)
+    {
+        uint8_t owner;
+
+        if (!win[h].used || win[h].root) continue;
+        if (win[h].parent == 0U)
+        {
+            on_desktop++;
+            continue;
+        }
+        if (!Owned(tree, win[h].parent, &owner))
+        {
+            orphans++;
+            continue;
+        }
+        if (owner == s) own++;
+        else if (win[h].visible && win[win[h].parent].visible) shown_elsewhere++;
+        else if (!screens[owner].persistent) orphans++;
+    }
+    CHECK(on_desktop == 0U);
+    CHECK(orphans == 0U);
+    CHECK(shown_elsewhere == 0U);
+    CHECK(own == tree->screens[screens[s].id].widgets);
+}
+
+static bool Owned(const GuiTree_t *tree, uint32_t root, uint8_t *owner)
+{
+    for (uint8_t i = 0U; i < SCREENS; i++)
+    {
+        for (uint8_t layer = 0U; layer < GUI_TREE_LAYERS; layer++)
+        {
+            if (tree->screens[screens[i].id].root[layer] != root) continue;
+            *owner = i;
+            return win[root].used;
+        }
+    }
+    return false;
+}
+
+static uint32_t Random(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
@@ -0,0 +1,35 @@
+/**
+ ******************************************************************************
+ * File Name          : host_test.h
+ * Description        : minimal check macros shared by the host tests of the
+ *                      portable firmware modules
+ ******************************************************************************
+ *
+ * CHECK() records a failure with file and line and keeps going, so one
+ * run reports every broken case. HOST_TEST_END() prints the summary and
+ * is the exit code of main().
+ *
+ ******************************************************************************
+ */
+#ifndef __HOST_TEST_H__
+#define __HOST_TEST_H__
+
+#include <stdio.h>
+
+static unsigned host_test_checks;
+static unsigned host_test_failures;
+
+#define CHECK(cond)                                                             \
+    do {                                                                        \
+        host_test_checks++;                                                     \
+        if (!(cond)) {                                                          \
+            host_test_failures++;                                               \
+            printf("%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond);     \
+        }                                                                       \
+    } while (0)
+
+#define HOST_TEST_END(name)                                                     \
+    (printf("%s: %u checks, %u failed\n", (name), host_test_checks,             \
+            host_test_failures), (host_test_failures != 0U) ? 1 : 0)
+
+#endif /* __HOST_TEST_H__ */
@@ -0,0 +1,262 @@
+/**
+ ******************************************************************************
+ * File Name          : icon_cache_test.c
+ * Description        : host test, SDRAM icon cache over a replayed screen
+ *                      trace
+ ******************************************************************************
+ *
+ * Replays a trace of screen visits through IC/Src/icon_cache.c. The icon
+ * set is the one of IC/Src/Display (50 ARGB8888 bitmaps, names and sizes
+ * as bitmap->BytesPerLine * YSize), split over 12 screens. Screens are
+ * entered with a skewed frequency, as the lights and scene screens are on
+ * the device, and every visit redraws the icons of the screen 1..30
+ * times. On entering a screen its icons are preloaded, as Icon_Preload()
+ * in display.c does it, when preloading is on.
+ *
+ * Every draw is compared byte for byte with its source, and after every
+ * call the copies have to stay inside the budget without overlapping. For
+ * the pool size and two smaller budgets the test reports hit rate,
+ * promotions, evictions and bytes read from QSPI next to the bytes every
+ * draw read without the cache.
+ *
+ * Build (Linux):
+ *   make -C Tools/tests icon_cache_test
+ *
+ ******************************************************************************
+ */
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "icon_cache.h"
+#include "host_test.h"
+/* Private Define ------------------------------------------------------------*/
+#define POOL_SIZE           0x00200000U     /* ICON_CACHE_POOL_SIZE */
+#define SRC_SIZE            0x00200000U
+#define SCREENS             12U
+#define VISITS              600U
+#define MAX_REDRAWS         30U
+#define ICONS               (sizeof(icons) / sizeof(icons[0]))
+/* Private Type --------------------------------------------------------------*/
+typedef struct
+{
+    const char *name;
+    uint32_t    size;
+} Icon_t;
+
+typedef struct
+{
+    uint32_t draws;
+    uint64_t bytes;                         /* read by the draws without the cache */
+    uint64_t source_bytes;                  /* read from QSPI with the cache */
+    uint32_t bad;                           /* draws that differ from the source */
+} Run_t;
+/* Private Variable ----------------------------------------------------------*/
+static const Icon_t icons[] =
+{
+    { "bmHome", 19600U }, { "bmSijalica", 30504U }, { "bmSijalicica", 20636U },
+    { "bmSijalicicaOff", 9800U }, { "bmSijalicicaOn", 9800U },
+    { "bmclear_sky_icon", 10000U }, { "bmclear_sky_img", 90000U },
+    { "bmfew_clouds_icon", 10000U }, { "bmfew_clouds_img", 90000U },
+    { "bmicons_lights_ceiling_led_fixture_off", 25600U }, { "bmicons_lights_ceiling_led_fixture_on", 25600U },
+    { "bmicons_lights_chandelier_off", 25600U }, { "bmicons_lights_chandelier_on", 25600U },
+    { "bmicons_lights_hanging_off", 25600U }, { "bmicons_lights_hanging_on", 25600U },
+    { "bmicons_lights_led_off", 25600U }, { "bmicons_lights_led_on", 25600U },
+    { "bmicons_lights_spot_console_off", 25600U }, { "bmicons_lights_spot_console_on", 25600U },
+    { "bmicons_lights_spot_single_off", 25600U }, { "bmicons_lights_spot_single_on", 25600U },
+    { "bmicons_lights_stairs_off", 25600U }, { "bmicons_lights_stairs_on", 25600U },
+    { "bmicons_lights_wall_off", 25600U }, { "bmicons_lights_wall_on", 25600U },
+    { "bmicons_menu_gate", 25600U }, { "bmicons_menu_timers", 25600U },
+    { "bmicons_scene_dinner", 25600U }, { "bmicons_scene_gathering", 25600U },
+    { "bmicons_scene_homecoming", 25600U }, { "bmicons_scene_leaving", 25600U },
+    { "bmicons_scene_morning", 25600U }, { "bmicons_scene_movie", 25600U },
+    { "bmicons_scene_reading", 25600U }, { "bmicons_scene_relaxing", 25600U },
+    { "bmicons_scene_security", 25600U }, { "bmicons_scene_sleep", 25600U },
+    { "bmicons_scene_wizzard", 25600U },
+    { "bmmist_icon", 10000U }, { "bmmist_img", 90000U }, { "bmrain_icon", 10000U }, { "bmrain_img", 90000U },
+    { "bmscattered_clouds_icon", 10000U }, { "bmscattered_clouds_img", 90000U },
+    { "bmshower_rain_icon", 10000U }, { "bmshower_rain_img", 90000U },
+    { "bmsnow_icon", 10000U }, { "bmsnow_img", 90000U },
+    { "bmthunderstorm_icon", 10000U }, { "bmthunderstorm_img", 90000U },
+};
+static uint32_t offset[ICONS];              /* position of each bitmap in src */
+static uint8_t src[SRC_SIZE];               /* QSPI .flash_rom */
+static uint8_t pool[POOL_SIZE];             /* SDRAM .icon_cache */
+static uint32_t rng;
+/* Private Function Prototype ------------------------------------------------*/
+static void Copy(void *dst, const void *from, uint32_t size);
+static void Replay(uint32_t budget, bool preload, Run_t *run);
+static void Draw(IconCache_t *cache, uint32_t icon, Run_t *run);
+static void CheckPool(const IconCache_t *cache);
+static uint8_t NextScreen(void);
+static uint32_t Random(void);
+/* Program Code --------------------------------------------------------------*/
+int main(void)
+{
+    static const uint32_t budgets[] = { POOL_SIZE, 512U * 1024U, 256U * 1024U };
+    uint32_t pos = 0U, total = 0U;
+    IconCache_t cache;
+    Run_t run;
+
+    for (uint32_t i = 0U; i < ICONS; i++)
+    {
+        offset[i] = pos;
+        for (uint32_t k = 0U; k < icons[i].size; k++) src[pos + k] = (uint8_t)((k * 7U) + i);
+        pos += (icons[i].size + 3U) & ~3U;
+        total += icons[i].size;
+    }
+    CHECK(pos <= SRC_SIZE);
+
+    printf("%u icons, %u bytes, %u screens, %u visits\n", (unsigned)ICONS, (unsigned)total, SCREENS, VISITS);
+    printf("budget KB  preload   draws   hits %%  promotions  evictions   QSPI MB   no cache MB\n");
+    for (uint8_t b = 0U; b < (sizeof(budgets) / sizeof(budgets[0])); b++)
+    {
+        for (uint8_t preload = 0U; preload < 2U; preload++)
+        {
+            Replay(budgets[b], preload != 0U, &run);
+            CHECK(run.bad == 0U);
+            CHECK(run.source_bytes <= run.bytes);
+            if (budgets[b] >= total)
+            {
+                // Everything fits: each icon is read from QSPI at most twice.
+                CHECK(run.source_bytes <= (2U * (uint64_t)total));
+            }
+        }
+    }
+
+    // A bitmap drawn once is not copied and evicts nothing.
+    IconCache_Init(&cache, pool, 64U * 1024U, Copy);
+    memset(&run, 0, sizeof(run));
+    Draw(&cache, 0U, &run);
+    Draw(&cache, 0U, &run);
+    CHECK(cache.count == 1U);
+    Draw(&cache, 1U, &run);
+    CHECK((cache.count == 1U) && (cache.evictions == 0U));
+    Draw(&cache, 1U, &run);
+    CHECK(cache.promotions == 2U);
+    CHECK(run.bad == 0U);
+
+    // Larger than the budget: never cached, always drawn from the source.
+    CHECK(!IconCache_Preload(&cache, &icons[6], &src[offset[6]], 2U * 64U * 1024U));
+    CHECK(IconCache_Get(&cache, &icons[6], &src[offset[6]], 2U * 64U * 1024U) == &src[offset[6]]);
+    CHECK(IconCache_Get(&cache, &icons[6], &src[offset[6]], 2U * 64U * 1024U) == &src[offset[6]]);
+    CheckPool(&cache);
+
+    // Flush empties the pool, the next draws fill it again.
+    IconCache_Flush(&cache);
+    CHECK((cache.count == 0U) && (cache.used == 0U));
+    CHECK(IconCache_Preload(&cache, &icons[0], &src[offset[0]], icons[0].size));
+    Draw(&cache, 0U, &run);
+    CHECK(run.bad == 0U);
+    CheckPool(&cache);
+
+    return HOST_TEST_END("icon_cache_test");
+}
+
+static void Copy(void *dst, const void *from, uint32_t size)
+{
+    memcpy(dst, from, size);
+}
+
+/**
+ * @brief  One trace replay; prints one report line.
+ */
+static void Replay(uint32_t budget, bool preload, Run_t *run)
+{
+    IconCache_t cache;
+
+    memset(run, 0, sizeof(Run_t));
+    memset(pool, 0, sizeof(pool));
+    IconCache_Init(&cache, pool, budget, Copy);
+    rng = 0x1234567U;
+    for (uint32_t v = 0U; v < VISITS; v++)
+    {
+        uint8_t screen = NextScreen();
+        uint32_t redraws = 1U + (Random() % MAX_REDRAWS);
+
+        if (preload)
+        {
+            for (uint32_t i = screen; i < ICONS; i += SCREENS)
+            {
+                IconCache_Preload(&cache, &icons[i], &src[offset[i]], icons[i].size);
+                CheckPool(&cache);
+            }
+        }
+        for (uint32_t r = 0U; r < redraws; r++)
+        {
+            for (uint32_t i = screen; i < ICONS; i += SCREENS) Draw(&cache, i, run);
+        }
+    }
+    CHECK((cache.hits + cache.misses) == run->draws);
+    run->source_bytes += cache.source_bytes;
+    printf("%9u  %7s  %6u  %6.1f  %10u  %9u  %8.1f  %12.1f\n", (unsigned)(budget / 1024U), preload ? "yes" : "no",
+           run->draws, IconCache_HitRate(&cache) / 10.0, cache.promotions, cache.evictions,
+           (double)run->source_bytes / 1048576.0, (double)run->bytes / 1048576.0);
+}
+
+/**
+ * @brief  Draws one icon through the cache and checks the pixels.
+ */
+static void Draw(IconCache_t *cache, uint32_t icon, Run_t *run)
+{
+    const uint8_t *data = IconCache_Get(cache, &icons[icon], &src[offset[icon]], icons[icon].size);
+
+    run->draws++;
+    run->bytes += icons[icon].size;
+    if (data != &src[offset[icon]])
+    {
+        // A copy lies wholly inside the budget.
+        CHECK((data >= pool) && ((data + icons[icon].size) <= (pool + cache->budget)));
+        CHECK((((uintptr_t)data) % ICON_CACHE_ALIGN) == 0U);
+    }
+    if (memcmp(data, &src[offset[icon]], icons[icon].size) != 0) run->bad++;
+    CheckPool(cache);
+}
+
+/**
+ * @brief  Copies are sorted, do not overlap and add up to `used`.
+ */
+static void CheckPool(const IconCache_t *cache)
+{
+    uint32_t used = 0U, end = 0U;
+    bool ok = true;
+
+    for (uint8_t i = 0U; i < cache->count; i++)
+    {
+        const IconCacheEntry_t *e = &cache->entries[i];
+
+        if ((e->offset < end) || ((e->offset + e->size) > cache->budget)) ok = false;
+        end = e->offset + e->size;
+        used += e->size;
+    }
+    if (used != cache->used) ok = false;
+    CHECK(ok);
+}
+
+/**
+ * @brief  Screen of the next visit: screen n is entered about half as often
+ *         as screen n - 1, with a floor so every screen is seen.
+ */
+static uint8_t NextScreen(void)
+{
+    uint32_t r = Random() % 1000U;
+    uint8_t screen = 0U;
+    uint32_t share = 400U;
+
+    while ((screen < (SCREENS - 1U)) && (r >= share))
+    {
+        r -= share;
+        share = (share > 40U) ? (share / 2U) : 40U;
+        screen++;
+    }
+    return screen;
+}
+
+static uint32_t Random(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
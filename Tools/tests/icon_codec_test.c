@@ -0,0 +1,521 @@
+/**
+ ******************************************************************************
+ * File Name          : icon_codec_test.c
+ * Description        : host test, compact icon formats: decoding and DMA2D
+ *                      blending of every ICON_FMT_* against ARGB8888
+ ******************************************************************************
+ *
+ * Three kinds of icons are built in ARGB8888, the way emWin Bitmap
+ * Converter writes them: a one colour anti-aliased ring, a flat icon with
+ * a few opaque colours and a gradient with its own alpha. Each is packed
+ * in every format of icon_codec.h it fits (A8 needs one colour, L8 and
+ * RLE8 at most 256), following the layout documented in the header, and
+ * decoded with IC/Src/icon_codec.c: IconCodec_Decode() has to give the
+ * source pixels back exactly.
+ *
+ * Every packed icon is then drawn like _LCD_DrawIcon() in LCDConf.c
+ * does on the panel: clipped to the frame buffer, A8, L8 and ARGB8888
+ * blended by DMA2D straight from the data, RLE lines decoded to a line
+ * slot first (after IconCodec_SkipLines() for the clipped top), with and
+ * without the opacity of LCD_SetIconAlpha(). The jobs run through
+ * IC/Src/dma2d_queue.c on the software backend (IC/Src/dma2d_soft.c),
+ * into ARGB8888 and RGB565 frame buffers. Every pixel is compared with a
+ * reference blend of the ARGB8888 source computed in floating point;
+ * the DMA2D truncates, so one LSB (two with opacity) is allowed.
+ * Damaged data (short data, a run past the end of a line) has to be
+ * refused.
+ *
+ * The report lists the packed size of every icon and format against
+ * ARGB8888 and the largest difference from the reference.
+ *
+ * Build (Linux):
+ *   make -C Tools/tests icon_codec_test
+ *
+ ******************************************************************************
+ */
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+#include "icon_codec.h"
+#include "dma2d_queue.h"
+#include "dma2d_soft.h"
+#include "host_test.h"
+/* Private Define ------------------------------------------------------------*/
+#define ICON_W              37U
+#define ICON_H              29U
+#define ICON_PIXELS         (ICON_W * ICON_H)
+#define MAX_PACKED          ((ICON_PIXELS * 5U) + ICON_H)  /* RLE32 worst case */
+#define FB_W                64U
+#define FB_H                48U
+#define ALPHA_MODE_MULTIPLY (2UL << 16)     /* fgpfccr alpha mode of _LCD_DrawIcon() */
+#define ICON_KINDS          3U
+#define POSITIONS           4U
+/* Private Type --------------------------------------------------------------*/
+typedef struct
+{
+    const char *name;
+    uint32_t    argb[ICON_PIXELS];          /* DMA2D ARGB8888, transparent = 0 */
+} Source_t;
+
+typedef struct
+{
+    IconImage_t image;
+    uint32_t    clut[ICON_CODEC_MAX_COLORS];
+    uint8_t     data[MAX_PACKED];
+} Packed_t;
+
+typedef struct
+{
+    uint32_t format;                        /* DMA2D_SOFT_ARGB8888 or DMA2D_SOFT_RGB565 */
+    uint8_t  bytes;
+    uint8_t  pixels[FB_W * FB_H * 4U];
+} Surface_t;
+/* Private Variable ----------------------------------------------------------*/
+static const char *format_names[ICON_FMT_COUNT] = { "ARGB8888", "A8", "L8", "RLE8", "RLE32" };
+static const int positions[POSITIONS][2] = { { 13, 9 }, { -11, -7 }, { 40, 30 }, { -20, 25 } };
+static Source_t sources[ICON_KINDS];
+static Dma2dQueue_t queue;
+static uint32_t lut[ICON_CODEC_MAX_COLORS];         /* DMA2D FG CLUT, _DMA_LoadLUT() */
+static uint8_t line_slots[2][ICON_W * 4U];          /* _pBuffer_FG line slots */
+static uint32_t rng = 0x2545F491U;
+/* Private Function Prototype ------------------------------------------------*/
+static uint32_t Xorshift(void);
+static void BuildSources(void);
+static bool Pack(const Source_t *src, IconFormat_t format, Packed_t *p);
+static uint16_t Palette(const Source_t *src, uint32_t *clut, uint8_t *index);
+static uint32_t EncodeRle(uint8_t *out, const uint8_t *line, uint16_t width, uint8_t bytes);
+static void Put32(uint8_t *p, uint32_t v);
+static void FillSurface(Surface_t *s, uint32_t format);
+static uint32_t ReadSurface(const Surface_t *s, uint32_t x, uint32_t y);
+static void DrawIcon(Surface_t *s, const IconImage_t *image, int x0, int y0, uint8_t alpha);
+static uint32_t Reference(uint32_t fg, uint32_t bg, uint8_t alpha, uint32_t format);
+static uint32_t MaxDiff(uint32_t a, uint32_t b, uint32_t format);
+static uint32_t CheckBlend(const Source_t *src, const IconImage_t *image);
+static void DamagedData(void);
+/* Program Code --------------------------------------------------------------*/
+int main(void)
+{
+    static Packed_t packed;
+    static uint32_t decoded[ICON_PIXELS];
+    uint32_t per_format[ICON_FMT_COUNT] = { 0U };
+
+    Dma2dQueue_Init(&queue, &Dma2dSoft_Backend);
+    Dma2dSoft_Attach(&queue, lut, NULL);
+    BuildSources();
+
+    printf("icon %ux%u, ARGB8888 %u bytes, frame buffers ARGB8888 and RGB565 %ux%u\n",
+           ICON_W, ICON_H, ICON_PIXELS * 4U, FB_W, FB_H);
+    printf("icon      format    colors  bytes   size  max diff\n");
+    for (uint32_t k = 0U; k < ICON_KINDS; k++)
+    {
+        for (uint32_t f = 0U; f < ICON_FMT_COUNT; f++)
+        {
+            uint32_t diff;
+
+            if (!Pack(&sources[k], (IconFormat_t)f, &packed)) continue;
+            per_format[f]++;
+            memset(decoded, 0xA5, sizeof(decoded));
+            CHECK(IconCodec_Decode(&packed.image, decoded));
+            CHECK(memcmp(decoded, sources[k].argb, sizeof(decoded)) == 0);
+            diff = CheckBlend(&sources[k], &packed.image);
+            printf("%-9s %-9s %6u %6u %5.1f%% %9u\n", sources[k].name, format_names[f], packed.image.colors,
+                   packed.image.size, (100.0 * (double)packed.image.size) / (double)(ICON_PIXELS * 4U), diff);
+        }
+    }
+    // Every format is exercised, A8 only by the one colour icon.
+    for (uint32_t f = 0U; f < ICON_FMT_COUNT; f++) CHECK(per_format[f] != 0U);
+    CHECK(per_format[ICON_FMT_A8] == 1U);
+    CHECK(Dma2dSoft_Unsupported() == 0U);
+
+    DamagedData();
+    return HOST_TEST_END("icon_codec_test");
+}
+
+static uint32_t Xorshift(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+/**
+ * @brief  Ring in one colour, flat icon with four colours, alpha gradient.
+ */
+static void BuildSources(void)
+{
+    static const uint32_t flat[4] = { 0xFF1E88E5U, 0xFFFFFFFFU, 0xFFFDD835U, 0xFF43A047U };
+
+    sources[0].name = "ring";
+    sources[1].name = "flat";
+    sources[2].name = "gradient";
+    for (uint32_t y = 0U; y < ICON_H; y++)
+    {
+        for (uint32_t x = 0U; x < ICON_W; x++)
+        {
+            uint32_t i = (y * ICON_W) + x;
+            double dx = (double)x - (ICON_W / 2.0);
+            double dy = (double)y - (ICON_H / 2.0);
+            double edge = fabs(sqrt((dx * dx) + (dy * dy)) - 10.0);
+            uint32_t a = (edge >= 3.0) ? 0U : (uint32_t)(255.0 * (3.0 - edge) / 3.0);
+
+            sources[0].argb[i] = (a == 0U) ? 0U : ((a << 24) | 0x00F0F0F0U);
+            sources[1].argb[i] = ((x < 3U) || (x >= (ICON_W - 3U))) ? 0U : flat[((x / 6U) + (y / 5U)) % 4U];
+            a = ((x * 255U) / (ICON_W - 1U)) & 0xFEU;
+            sources[2].argb[i] = (a == 0U) ? 0U : ((a << 24) | ((y * 8U) << 16) | ((x * 6U) << 8) | (Xorshift() & 0x3FU));
+        }
+    }
+}
+
+/**
+ * @brief  Packs the source in `format` as iconconv does.
+ * @retval false if the icon does not fit the format.
+ */
+static bool Pack(const Source_t *src, IconFormat_t format, Packed_t *p)
+{
+    static uint8_t index[ICON_PIXELS];
+    static uint8_t line[ICON_W * 4U];
+    uint16_t colors = Palette(src, p->clut, index);
+    uint32_t size = 0U;
+
+    memset(&p->image, 0, sizeof(p->image));
+    p->image.format = (uint16_t)format;
+    p->image.width = ICON_W;
+    p->image.height = ICON_H;
+    p->image.data = p->data;
+
+    switch (format)
+    {
+    case ICON_FMT_A8:
+        for (uint32_t i = 0U; i < ICON_PIXELS; i++)
+        {
+            if (src->argb[i] == 0U) continue;
+            if ((p->image.color != 0U) && (p->image.color != (src->argb[i] & 0x00FFFFFFU))) return false;
+            p->image.color = src->argb[i] & 0x00FFFFFFU;
+        }
+        for (uint32_t i = 0U; i < ICON_PIXELS; i++) p->data[size++] = (uint8_t)(src->argb[i] >> 24);
+        break;
+    case ICON_FMT_L8:
+    case ICON_FMT_RLE8:
+        if (colors == 0U) return false;
+        p->image.colors = colors;
+        p->image.clut = p->clut;
+        if (format == ICON_FMT_L8)
+        {
+            memcpy(p->data, index, ICON_PIXELS);
+            size = ICON_PIXELS;
+        }
+        else
+        {
+            for (uint32_t y = 0U; y < ICON_H; y++) size += EncodeRle(&p->data[size], &index[y * ICON_W], ICON_W, 1U);
+        }
+        break;
+    case ICON_FMT_RLE32:
+        for (uint32_t y = 0U; y < ICON_H; y++)
+        {
+            for (uint32_t x = 0U; x < ICON_W; x++) Put32(&line[x * 4U], src->argb[(y * ICON_W) + x]);
+            size += EncodeRle(&p->data[size], line, ICON_W, 4U);
+        }
+        break;
+    default:
+        for (uint32_t i = 0U; i < ICON_PIXELS; i++) Put32(&p->data[i * 4U], src->argb[i]);
+        size = ICON_PIXELS * 4U;
+        break;
+    }
+    p->image.size = size;
+    return true;
+}
+
+/**
+ * @brief  Palette of the source and index of every pixel.
+ * @retval Number of colours, 0 above ICON_CODEC_MAX_COLORS.
+ */
+static uint16_t Palette(const Source_t *src, uint32_t *clut, uint8_t *index)
+{
+    uint16_t colors = 0U;
+
+    for (uint32_t i = 0U; i < ICON_PIXELS; i++)
+    {
+        uint16_t c = 0U;
+
+        while ((c < colors) && (clut[c] != src->argb[i])) c++;
+        if (c == colors)
+        {
+            if (colors == ICON_CODEC_MAX_COLORS) return 0U;
+            clut[colors++] = src->argb[i];
+        }
+        index[i] = (uint8_t)c;
+    }
+    return colors;
+}
+
+/**
+ * @brief  One RLE line: runs of 2..129 equal pixels, literals of 1..128.
+ * @retval Bytes written.
+ */
+static uint32_t EncodeRle(uint8_t *out, const uint8_t *line, uint16_t width, uint8_t bytes)
+{
+    uint32_t n = 0U;
+    uint16_t x = 0U;
+
+    while (x < width)
+    {
+        uint16_t run = 1U;
+
+        while (((x + run) < width) && (run < 129U) && (memcmp(&line[(x + run) * bytes], &line[x * bytes], bytes) == 0)) run++;
+        if (run >= 2U)
+        {
+            out[n++] = (uint8_t)(0x7EU + run);
+            memcpy(&out[n], &line[x * bytes], bytes);
+            n += bytes;
+            x = (uint16_t)(x + run);
+            continue;
+        }
+        // Literal up to the next pair of equal pixels.
+        run = 1U;
+        while (((x + run) < width) && (run < 128U) &&
+               (((x + run + 1U) >= width) || (memcmp(&line[(x + run) * bytes], &line[(x + run + 1U) * bytes], bytes) != 0))) run++;
+        out[n++] = (uint8_t)(run - 1U);
+        memcpy(&out[n], &line[x * bytes], (uint32_t)run * bytes);
+        n += (uint32_t)run * bytes;
+        x = (uint16_t)(x + run);
+    }
+    return n;
+}
+
+static void Put32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+/**
+ * @brief  Opaque noise background, as a frame buffer holds it.
+ */
+static void FillSurface(Surface_t *s, uint32_t format)
+{
+    s->format = format;
+    s->bytes = (format == DMA2D_SOFT_RGB565) ? 2U : 4U;
+    for (uint32_t i = 0U; i < (FB_W * FB_H); i++)
+    {
+        uint32_t v = Xorshift();
+
+        if (s->bytes == 4U) Put32(&s->pixels[i * 4U], v | 0xFF000000U);
+        else memcpy(&s->pixels[i * 2U], &v, 2U);
+    }
+}
+
+/**
+ * @brief  Pixel of the surface in ARGB8888 (RGB565 expanded as DMA2D does).
+ */
+static uint32_t ReadSurface(const Surface_t *s, uint32_t x, uint32_t y)
+{
+    const uint8_t *p = &s->pixels[((y * FB_W) + x) * s->bytes];
+    uint32_t c, r, g, b;
+
+    if (s->bytes == 4U) return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+    c = (uint32_t)p[0] | ((uint32_t)p[1] << 8);
+    r = (c >> 11) & 0x1FU;
+    g = (c >> 5) & 0x3FU;
+    b = c & 0x1FU;
+    return 0xFF000000U | (((r << 3) | (r >> 2)) << 16) | (((g << 2) | (g >> 4)) << 8) | ((b << 3) | (b >> 2));
+}
+
+/**
+ * @brief  The DMA2D jobs of _LCD_DrawIcon() (LCDConf.c), clipped to the surface.
+ */
+static void DrawIcon(Surface_t *s, const IconImage_t *image, int x0, int y0, uint8_t alpha)
+{
+    IconCursor_t cursor;
+    Dma2dJob_t job;
+    uint32_t bytes = IconCodec_NativeBytes(image);
+    uint32_t fence = 0U, slot = 0U, x_clip, y_clip;
+    int cx0 = (x0 < 0) ? 0 : x0;
+    int cy0 = (y0 < 0) ? 0 : y0;
+    int cx1 = ((x0 + (int)image->width) > (int)FB_W) ? (int)FB_W - 1 : x0 + (int)image->width - 1;
+    int cy1 = ((y0 + (int)image->height) > (int)FB_H) ? (int)FB_H - 1 : y0 + (int)image->height - 1;
+
+    if ((cx1 < cx0) || (cy1 < cy0)) return;
+    x_clip = (uint32_t)(cx1 - cx0 + 1);
+    y_clip = (uint32_t)(cy1 - cy0 + 1);
+
+    memset(&job, 0, sizeof(job));
+    if ((image->format == ICON_FMT_L8) || (image->format == ICON_FMT_RLE8))
+    {
+        memset(lut, 0, sizeof(lut));
+        memcpy(lut, image->clut, (uint32_t)image->colors * sizeof(uint32_t));
+        job.fgpfccr = DMA2D_SOFT_L8;
+    }
+    else if (image->format == ICON_FMT_A8)
+    {
+        job.fgpfccr = DMA2D_SOFT_A8;
+        job.fgcolr = image->color;
+    }
+    else
+    {
+        job.fgpfccr = DMA2D_SOFT_ARGB8888;
+    }
+    if (alpha != 0xFFU) job.fgpfccr |= ALPHA_MODE_MULTIPLY | ((uint32_t)alpha << 24);
+    job.cr = DMA2D_JOB_M2M_BLEND;
+    job.bgmar = (uintptr_t)&s->pixels[(((uint32_t)cy0 * FB_W) + (uint32_t)cx0) * s->bytes];
+    job.bgor = FB_W - x_clip;
+    job.bgpfccr = s->format;
+    job.omar = job.bgmar;
+    job.oor = FB_W - x_clip;
+    job.opfccr = s->format;
+
+    if ((image->format != ICON_FMT_RLE8) && (image->format != ICON_FMT_RLE32))
+    {
+        job.fgmar = (uintptr_t)(image->data + (((uint32_t)(cy0 - y0) * image->width) + (uint32_t)(cx0 - x0)) * bytes);
+        job.fgor = image->width - x_clip;
+        job.nlr = (x_clip << 16) | y_clip;
+        Dma2dQueue_Wait(&queue, Dma2dQueue_Submit(&queue, &job));
+        return;
+    }
+    // RLE: one job per line, alternating between two line slots.
+    IconCodec_Begin(&cursor, image);
+    IconCodec_SkipLines(&cursor, (uint16_t)(cy0 - y0));
+    job.nlr = (x_clip << 16) | 1U;
+    for (uint32_t y = 0U; y < y_clip; y++)
+    {
+        if (y > 1U) Dma2dQueue_Wait(&queue, fence - 1U);
+        CHECK(IconCodec_ReadLine(&cursor, line_slots[slot], false));
+        job.fgmar = (uintptr_t)&line_slots[slot][(uint32_t)(cx0 - x0) * bytes];
+        fence = Dma2dQueue_Submit(&queue, &job);
+        job.bgmar += FB_W * s->bytes;
+        job.omar = job.bgmar;
+        slot ^= 1U;
+    }
+    Dma2dQueue_Wait(&queue, fence);
+}
+
+/**
+ * @brief  Source pixel with opacity over an opaque background, exact
+ *         arithmetic rounded, stored like the frame buffer format.
+ */
+static uint32_t Reference(uint32_t fg, uint32_t bg, uint8_t alpha, uint32_t format)
+{
+    double a = ((double)(fg >> 24) * (double)alpha) / (255.0 * 255.0);
+    uint32_t out = 0xFF000000U;
+
+    for (uint32_t shift = 0U; shift < 24U; shift += 8U)
+    {
+        double c = ((double)((fg >> shift) & 0xFFU) * a) + ((double)((bg >> shift) & 0xFFU) * (1.0 - a));
+
+        out |= (uint32_t)(c + 0.5) << shift;
+    }
+    if (format == DMA2D_SOFT_RGB565) out &= 0xFFF8FCF8U;
+    return out;
+}
+
+/**
+ * @brief  Largest channel difference in units of the frame buffer format.
+ */
+static uint32_t MaxDiff(uint32_t a, uint32_t b, uint32_t format)
+{
+    uint32_t max = 0U;
+
+    for (uint32_t shift = 0U; shift < 32U; shift += 8U)
+    {
+        uint32_t ca = (a >> shift) & 0xFFU;
+        uint32_t cb = (b >> shift) & 0xFFU;
+        uint32_t d = (ca > cb) ? (ca - cb) : (cb - ca);
+
+        if (format == DMA2D_SOFT_RGB565) d = (shift == 8U) ? (d >> 2) : (d >> 3);
+        if (d > max) max = d;
+    }
+    return max;
+}
+
+/**
+ * @brief  Draws the icon at every position, with and without opacity, on
+ *         both frame buffer formats and compares every pixel.
+ * @retval Largest difference seen.
+ */
+static uint32_t CheckBlend(const Source_t *src, const IconImage_t *image)
+{
+    static const uint8_t alphas[2] = { 0xFFU, 0x80U };
+    static const uint32_t formats[2] = { DMA2D_SOFT_ARGB8888, DMA2D_SOFT_RGB565 };
+    static Surface_t before, after;
+    uint32_t worst = 0U;
+
+    for (uint32_t f = 0U; f < 2U; f++)
+    {
+        for (uint32_t a = 0U; a < 2U; a++)
+        {
+            for (uint32_t p = 0U; p < POSITIONS; p++)
+            {
+                int x0 = positions[p][0];
+                int y0 = positions[p][1];
+                uint32_t limit = (alphas[a] == 0xFFU) ? 1U : 2U;
+                uint32_t bad = 0U;
+
+                FillSurface(&before, formats[f]);
+                after = before;
+                DrawIcon(&after, image, x0, y0, alphas[a]);
+                for (uint32_t y = 0U; y < FB_H; y++)
+                {
+                    for (uint32_t x = 0U; x < FB_W; x++)
+                    {
+                        int ix = (int)x - x0;
+                        int iy = (int)y - y0;
+                        uint32_t bg = ReadSurface(&before, x, y);
+                        uint32_t expect = bg;
+                        uint32_t d;
+
+                        if ((ix >= 0) && (ix < (int)ICON_W) && (iy >= 0) && (iy < (int)ICON_H))
+                        {
+                            expect = Reference(src->argb[((uint32_t)iy * ICON_W) + (uint32_t)ix], bg, alphas[a], formats[f]);
+                        }
+                        else if (formats[f] == DMA2D_SOFT_RGB565)
+                        {
+                            expect &= 0xFFF8FCF8U;
+                        }
+                        d = MaxDiff(ReadSurface(&after, x, y) & ((formats[f] == DMA2D_SOFT_RGB565) ? 0xFFF8FCF8U : 0xFFFFFFFFU),
+                                    expect, formats[f]);
+                        if (d > worst) worst = d;
+                        if (d > limit) bad++;
+                    }
+                }
+                CHECK(bad == 0U);
+            }
+        }
+    }
+    return worst;
+}
+
+/**
+ * @brief  Short data and a run past the end of a line are refused.
+ */
+static void DamagedData(void)
+{
+    static Packed_t packed;
+    static uint32_t out[ICON_PIXELS];
+    IconCursor_t cursor;
+    uint8_t slot[ICON_W * 4U];
+
+    for (uint32_t f = 0U; f < ICON_FMT_COUNT; f++)
+    {
+        if (!Pack(&sources[1], (IconFormat_t)f, &packed)) continue;
+        packed.image.size--;
+        CHECK(!IconCodec_Decode(&packed.image, out));
+    }
+
+    CHECK(Pack(&sources[1], ICON_FMT_RLE8, &packed));
+    packed.data[0] = 0xFFU;                 /* 129 pixels on a line of ICON_W */
+    CHECK(!IconCodec_Decode(&packed.image, out));
+    IconCodec_Begin(&cursor, &packed.image);
+    CHECK(!IconCodec_ReadLine(&cursor, slot, false));
+    CHECK(!IconCodec_ReadLine(&cursor, slot, false));
+
+    // Skipping past the last line leaves nothing to read.
+    CHECK(Pack(&sources[1], ICON_FMT_L8, &packed));
+    IconCodec_Begin(&cursor, &packed.image);
+    IconCodec_SkipLines(&cursor, ICON_H + 5U);
+    CHECK(!IconCodec_ReadLine(&cursor, slot, false));
+}
@@ -0,0 +1,547 @@
+/**
+ ******************************************************************************
+ * File Name          : mem_budget_test.c
+ * Description        : host test, GUI heap budgets and pressure levels against
+ *                      a heap without them
+ ******************************************************************************
+ *
+ * Runs IC/Src/mem_budget.c and IC/Src/gui_static.c on a first-fit
+ * allocator with the 2 MB of the emWin heap (GUIConf.c) and the limits
+ * and budgets of display.c. Fixed cases: overlapping SDRAM regions,
+ * growth over budget counted once per entry, WARN releasing the device of
+ * another screen, CRITICAL under fragmentation, a denied reservation
+ * falling back to direct drawing with pressure on the next sample,
+ * recovery, and report truncation at every buffer size.
+ *
+ * The test then replays a session of screen changes: widgets created one
+ * per pass and deleted on leave, static layers (ARGB8888 memory device
+ * of the screen size) on the thermostat and lights screens, the clock
+ * glyph devices, the QR code memory device and the numpad tree that is
+ * built once and kept. DISP_Service() samples the heap in every pass.
+ * The same session runs without the module, as before: big devices are
+ * created whenever they fit and nothing is released. Widgets must never
+ * fail to allocate with the module; free bytes, block count and entries
+ * must match the allocator exactly and sampled allocations must stay a
+ * lower bound. The report compares both runs.
+ *
+ * Build (Linux):
+ *   make -C Tools/tests mem_budget_test
+ *
+ ******************************************************************************
+ */
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "mem_budget.h"
+#include "gui_static.h"
+#include "host_test.h"
+/* Private Define ------------------------------------------------------------*/
+#define HEAP_SIZE           (2048U * 1024U) /* GUIConf.c */
+#define HEAP_ALIGN          16U
+#define HEAP_HEADER         16U             /* emWin block header */
+#define MAX_BLOCKS          1024U
+#define WARN_FREE           (768U * 1024U)  /* GUI_HEAP_WARN_FREE */
+#define WARN_BLOCK          (544U * 1024U)  /* GUI_HEAP_WARN_BLOCK */
+#define CRITICAL_BLOCK      (64U * 1024U)   /* GUI_HEAP_CRITICAL_BLOCK */
+#define SCREEN_BUDGET       (64U * 1024U)   /* SCREEN_HEAP_KB */
+#define STATIC_BUDGET       ((64U + 544U) * 1024U)  /* SCREEN_HEAP_STATIC_KB */
+#define DEVICE_SIZE         (480U * 272U * 4U)      /* static layer on layer 1 */
+#define GLYPHS              11U             /* clock digits and colon */
+#define GLYPH_SIZE          (120U * 96U * 4U)
+#define PASS_MS             5U
+#define CHANGES             3000U
+#define MAX_WIDGETS         40U
+#define SCREENS             (sizeof(screens) / sizeof(screens[0]))
+/* Private Type --------------------------------------------------------------*/
+typedef struct
+{
+    uint32_t offset;
+    uint32_t size;
+    bool     used;
+} Block_t;
+
+typedef struct
+{
+    const char *name;
+    uint8_t     id;                         /* eScreen */
+    uint8_t     widgets;
+    uint32_t    widget_min, widget_max;     /* bytes */
+    bool        static_layer;
+    uint32_t    device;                     /* other memory device (QR code), 0: none */
+    bool        glyphs;                     /* clock face */
+    uint32_t    persistent;                 /* tree built once and kept, 0: none */
+} Screen_t;
+
+typedef struct
+{
+    uint32_t entries;
+    uint32_t widget_failures;               /* GUI_ALLOC out of memory */
+    uint32_t direct;                        /* static layer drawn without device */
+    uint32_t device_failures;               /* QR code and glyph devices not made */
+    uint32_t released;                      /* devices freed by pressure */
+    uint32_t min_free, min_largest;
+    uint32_t warnings, criticals;
+} Result_t;
+/* Private Variable ----------------------------------------------------------*/
+static const Screen_t screens[] =
+{
+    { "main clock",    1U,  6U, 1024U, 4096U, false,           0U, true,            0U },
+    { "select 1",      2U, 12U, 2048U, 6144U, false,           0U, false,           0U },
+    { "thermostat",    6U, 10U, 1024U, 4096U, true,            0U, false,           0U },
+    { "lights",        7U, 16U, 1024U, 4096U, true,            0U, false,           0U },
+    { "scene devices", 17U, 40U, 4096U, 8192U, false,          0U, false,           0U },
+    { "qr code",      24U,  4U, 1024U, 2048U, false, 300U * 1024U, false,           0U },
+    { "keyboard",     26U,  2U,  512U, 1024U, false,           0U, false, 160U * 1024U },
+    { "numpad",       27U,  2U,  512U, 1024U, false,           0U, false, 120U * 1024U },
+    { "settings 1",   31U, 30U,  512U, 2048U, false,           0U, false,           0U },
+};
+static Block_t heap[MAX_BLOCKS];
+static uint32_t heap_blocks, now_ms, allocs;
+static MemBudget_t mb;
+static GuiStaticCache_t layers;
+static uint8_t active;
+static bool budgeted;                       /* module in use */
+static uint32_t glyph[GLYPHS], device;
+static uint32_t released;
+static uint32_t rng;
+/* Private Function Prototype ------------------------------------------------*/
+static void Heap_Init(void);
+static uint32_t Heap_Alloc(uint32_t size);
+static void Heap_Free(uint32_t handle);
+static uint32_t Heap_Free_Bytes(void);
+static uint32_t Heap_Largest(void);
+static uint32_t Heap_Used_Blocks(void);
+static uint32_t Ms(void);
+static void Pressure(MemLevel_t level);
+static uint32_t Layer_Create(uint8_t layer);
+static void Layer_Destroy(uint32_t handle);
+static uint32_t Device_Create(uint32_t size);
+static void Glyphs_Release(void);
+static uint32_t RegionUsed(void);
+static void Session(bool with_budget, Result_t *res);
+static void Sample(Result_t *res);
+static uint32_t Random(void);
+static uint32_t Between(uint32_t lo, uint32_t hi);
+/* Program Code --------------------------------------------------------------*/
+int main(void)
+{
+    static const MemBudgetOps_t ops = { Heap_Free_Bytes, Heap_Largest, Heap_Used_Blocks, Ms, Pressure };
+    static const MemBudgetLimits_t limits = { WARN_FREE, WARN_BLOCK, CRITICAL_BLOCK };
+    static const GuiStaticOps_t layer_ops = { Layer_Create, Layer_Destroy };
+    static const MemRegion_t map[] =
+    {
+        { "vram",  0xC0000000U, 3133440U, NULL },
+        { "glyph", 0xC0300000U, 131072U, NULL },
+        { "icons", 0xC0400000U, 2U << 20, RegionUsed },
+        { "gui",   0xC0600000U, HEAP_SIZE, NULL },
+    };
+    static const MemRegion_t bad[] =
+    {
+        { "a", 0U, 100U, NULL }, { "b", 50U, 100U, NULL }, { "c", 200U, 10U, NULL }
+    };
+    static const char *names[] = { "without", "budget" };
+    Result_t res[2];
+    MemBudget_t other;
+    uint32_t handle, widgets[64], fill[200];
+    uint32_t count = 0U, filled = 0U;
+    char buf[2048];
+    uint32_t n;
+
+    rng = 0x7F4A7C15U;
+    budgeted = true;
+
+    // SDRAM map.
+    MemBudget_Init(&other, &ops, HEAP_SIZE, &limits, bad, 3U);
+    CHECK(other.overlaps == 0x03U);
+    Heap_Init();
+    MemBudget_Init(&mb, &ops, HEAP_SIZE, &limits, map, 4U);
+    CHECK(mb.overlaps == 0U);
+    GuiStatic_Init(&layers, &layer_ops);
+    for (uint8_t i = 0U; i < MEM_BUDGET_MAX_SCREENS; i++) MemBudget_SetBudget(&mb, i, SCREEN_BUDGET);
+    MemBudget_SetBudget(&mb, 6U, STATIC_BUDGET);
+    MemBudget_SetBudget(&mb, 7U, STATIC_BUDGET);
+
+    // Widgets over budget: once per entry, measured from the entry level.
+    active = 2U;
+    CHECK(MemBudget_Sample(&mb, active) == MEM_LEVEL_OK);
+    for (uint8_t i = 0U; i < 10U; i++)
+    {
+        widgets[count++] = Heap_Alloc(30000U);
+        now_ms += PASS_MS;
+        MemBudget_Sample(&mb, active);
+    }
+    CHECK((mb.screens[2].allocs == 10U) && (mb.screens[2].peak >= 300000U) && (mb.screens[2].over_budget == 1U));
+    active = 3U;
+    MemBudget_Sample(&mb, active);
+    widgets[count++] = Heap_Alloc(60000U);
+    MemBudget_Sample(&mb, active);
+    CHECK(mb.screens[3].over_budget == 0U);
+
+    // Two static layers: the second one drops free bytes under WARN and
+    // the device of the other screen goes.
+    active = 6U;
+    MemBudget_Sample(&mb, active);
+    CHECK(GuiStatic_Acquire(&layers, active, 1U, &handle) == GUI_STATIC_RENDER);
+    now_ms += 200U;
+    CHECK(MemBudget_Sample(&mb, active) == MEM_LEVEL_OK);
+    CHECK((mb.screens[6].reserves == 1U) && (mb.screens[6].over_budget == 0U));
+    active = 7U;
+    MemBudget_Sample(&mb, active);
+    CHECK(GuiStatic_Acquire(&layers, active, 1U, &handle) == GUI_STATIC_RENDER);
+    now_ms += 200U;
+    CHECK(MemBudget_Sample(&mb, active) == MEM_LEVEL_OK);
+    CHECK((mb.warnings == 1U) && (mb.pressures == 1U) && (layers.releases == 1U));
+    CHECK((layers.slots[0].handle == 0U) != (layers.slots[1].handle == 0U));
+
+    // Fragmentation: every other 16 KB block free is CRITICAL and takes
+    // every device; the freed device leaves the heap at WARN.
+    while (filled < (sizeof(fill) / sizeof(fill[0])))
+    {
+        uint32_t h = Heap_Alloc(16U * 1024U);
+
+        if (h == 0U) break;
+        fill[filled++] = h;
+    }
+    for (uint32_t i = 0U; i < filled; i += 2U) Heap_Free(fill[i]);
+    now_ms += 200U;
+    CHECK(MemBudget_Sample(&mb, active) == MEM_LEVEL_WARN);
+    CHECK((mb.max_frag_permille > 900U) && (mb.criticals == 1U) && (mb.pressures == 2U));
+    CHECK((layers.slots[0].handle == 0U) && (layers.slots[1].handle == 0U));
+
+    // Denied reservation: direct drawing now, pressure on the next sample.
+    n = mb.pressures;
+    CHECK(GuiStatic_Acquire(&layers, active, 1U, &handle) == GUI_STATIC_DIRECT);
+    CHECK(mb.screens[7].denied == 1U);
+    CHECK(mb.pressures == n);
+    MemBudget_Sample(&mb, active);
+    CHECK(mb.pressures == (n + 1U));
+
+    // Recovery.
+    for (uint32_t i = 1U; i < filled; i += 2U) Heap_Free(fill[i]);
+    for (uint32_t i = 0U; i < count; i++) Heap_Free(widgets[i]);
+    now_ms += 200U;
+    CHECK(MemBudget_Sample(&mb, active) == MEM_LEVEL_OK);
+    CHECK(GuiStatic_Acquire(&layers, active, 1U, &handle) == GUI_STATIC_RENDER);
+    CHECK((mb.min_largest < CRITICAL_BLOCK) && (mb.max_frag_permille > 900U));
+
+    // Report.
+    n = MemBudget_Report(&mb, buf, sizeof(buf));
+    CHECK(n == strlen(buf));
+    CHECK((strstr(buf, "level ok") != NULL) && (strstr(buf, "icons  C0400000") != NULL));
+    CHECK(strstr(buf, "scr  2: n 1, peak +293/64 KB (293 KB), allocs 10") != NULL);
+    for (uint32_t size = 1U; size < (n + 2U); size++)
+    {
+        char small[sizeof(buf)];
+        uint32_t m;
+
+        memset(small, 'x', sizeof(small));
+        m = MemBudget_Report(&mb, small, size);
+        CHECK((m < size) && (strlen(small) == m) && (strncmp(small, buf, m) == 0));
+        CHECK((m == 0U) || (small[m - 1U] == '\n'));
+    }
+
+    // Session with and without the module.
+    printf("%-8s %7s %8s %7s %8s %8s %9s %11s %5s %5s\n", "heap", "entries", "widget!", "direct",
+           "device!", "released", "min free", "min largest", "warn", "crit");
+    for (uint8_t b = 0U; b < 2U; b++)
+    {
+        rng = 0x7F4A7C15U;
+        Session(b != 0U, &res[b]);
+        printf("%-8s %7u %8u %7u %8u %8u %6u KB %8u KB %5u %5u\n", names[b], res[b].entries,
+               res[b].widget_failures, res[b].direct, res[b].device_failures, res[b].released,
+               res[b].min_free / 1024U, res[b].min_largest / 1024U, res[b].warnings, res[b].criticals);
+    }
+    CHECK(res[0].widget_failures > 0U);     /* the session does run out of heap without the module */
+    CHECK(res[1].widget_failures == 0U);
+    CHECK(res[1].min_largest >= CRITICAL_BLOCK);
+    CHECK(res[0].entries == res[1].entries);
+    CHECK(mb.screens[17].over_budget == mb.screens[17].entries);   /* scene devices list: 40 widgets */
+
+    return HOST_TEST_END("mem_budget_test");
+}
+
+static void Heap_Init(void)
+{
+    heap[0] = (Block_t){ 0U, HEAP_SIZE, false };
+    heap_blocks = 1U;
+}
+
+/**
+ * @brief  First fit, like the emWin allocator; handle is offset + 1,
+ *         0 when no free block is large enough.
+ */
+static uint32_t Heap_Alloc(uint32_t size)
+{
+    size = (size + HEAP_HEADER + HEAP_ALIGN - 1U) & ~(HEAP_ALIGN - 1U);
+    for (uint32_t i = 0U; i < heap_blocks; i++)
+    {
+        if (heap[i].used || (heap[i].size < size)) continue;
+        if ((heap[i].size > size) && (heap_blocks < MAX_BLOCKS))
+        {
+            memmove(&heap[i + 2U], &heap[i + 1U], (heap_blocks - i - 1U) * sizeof(Block_t));
+            heap_blocks++;
+            heap[i + 1U] = (Block_t){ heap[i].offset + size, heap[i].size - size, false };
+            heap[i].size = size;
+        }
+        heap[i].used = true;
+        allocs++;
+        return heap[i].offset + 1U;
+    }
+    return 0U;
+}
+
+static void Heap_Free(uint32_t handle)
+{
+    for (uint32_t i = 0U; i < heap_blocks; i++)
+    {
+        if (heap[i].offset != (handle - 1U)) continue;
+        CHECK(heap[i].used);
+        heap[i].used = false;
+        if (((i + 1U) < heap_blocks) && !heap[i + 1U].used)
+        {
+            heap[i].size += heap[i + 1U].size;
+            memmove(&heap[i + 1U], &heap[i + 2U], (heap_blocks - i - 2U) * sizeof(Block_t));
+            heap_blocks--;
+        }
+        if ((i > 0U) && !heap[i - 1U].used)
+        {
+            heap[i - 1U].size += heap[i].size;
+            memmove(&heap[i], &heap[i + 1U], (heap_blocks - i - 1U) * sizeof(Block_t));
+            heap_blocks--;
+        }
+        return;
+    }
+    CHECK(false);
+}
+
+static uint32_t Heap_Free_Bytes(void)
+{
+    uint32_t free = 0U;
+
+    for (uint32_t i = 0U; i < heap_blocks; i++)
+    {
+        if (!heap[i].used) free += heap[i].size;
+    }
+    return free;
+}
+
+static uint32_t Heap_Largest(void)
+{
+    uint32_t largest = 0U;
+
+    for (uint32_t i = 0U; i < heap_blocks; i++)
+    {
+        if (!heap[i].used && (heap[i].size > largest)) largest = heap[i].size;
+    }
+    return (largest > HEAP_HEADER) ? (largest - HEAP_HEADER) : 0U;
+}
+
+static uint32_t Heap_Used_Blocks(void)
+{
+    uint32_t used = 0U;
+
+    for (uint32_t i = 0U; i < heap_blocks; i++) used += heap[i].used ? 1U : 0U;
+    return used;
+}
+
+static uint32_t Ms(void)
+{
+    return now_ms;
+}
+
+/**
+ * @brief  Mem_Pressure() of display.c.
+ */
+static void Pressure(MemLevel_t level)
+{
+    released += GuiStatic_Release(&layers, (level == MEM_LEVEL_CRITICAL) ? GUI_STATIC_RELEASE_ALL : active);
+    Glyphs_Release();
+}
+
+/**
+ * @brief  StaticLayer_Create() of display.c.
+ */
+static uint32_t Layer_Create(uint8_t layer)
+{
+    return Device_Create((layer == 0U) ? (DEVICE_SIZE / 2U) : DEVICE_SIZE);
+}
+
+static void Layer_Destroy(uint32_t handle)
+{
+    Heap_Free(handle);
+}
+
+/**
+ * @brief  Memory device announced to the module first, when it is in use.
+ */
+static uint32_t Device_Create(uint32_t size)
+{
+    if (budgeted && !MemBudget_Reserve(&mb, size)) return 0U;
+    return Heap_Alloc(size);
+}
+
+/**
+ * @brief  ClockFace_Release(): the glyph devices are made again on demand.
+ */
+static void Glyphs_Release(void)
+{
+    for (uint8_t i = 0U; i < GLYPHS; i++)
+    {
+        if (glyph[i] == 0U) continue;
+        Heap_Free(glyph[i]);
+        glyph[i] = 0U;
+        released++;
+    }
+}
+
+static uint32_t RegionUsed(void)
+{
+    return 1234U * 1024U;
+}
+
+/**
+ * @brief  CHANGES screen changes of 20..200 passes each. Entering a screen
+ *         deletes the widgets of the previous one and creates its own, one
+ *         per pass.
+ */
+static void Session(bool with_budget, Result_t *res)
+{
+    static const MemBudgetOps_t ops = { Heap_Free_Bytes, Heap_Largest, Heap_Used_Blocks, Ms, Pressure };
+    static const MemBudgetLimits_t limits = { WARN_FREE, WARN_BLOCK, CRITICAL_BLOCK };
+    static const GuiStaticOps_t layer_ops = { Layer_Create, Layer_Destroy };
+    uint32_t widgets[MAX_WIDGETS], entries[SCREENS] = { 0U }, screen_allocs[MEM_BUDGET_MAX_SCREENS] = { 0U };
+    uint32_t count = 0U, persistent[SCREENS] = { 0U };
+    uint8_t last = SCREENS;
+
+    memset(res, 0, sizeof(Result_t));
+    res->min_free = UINT32_MAX;
+    res->min_largest = UINT32_MAX;
+    budgeted = with_budget;
+    released = 0U;
+    now_ms = 0U;
+    device = 0U;
+    memset(glyph, 0, sizeof(glyph));
+    Heap_Init();
+    MemBudget_Init(&mb, &ops, HEAP_SIZE, &limits, NULL, 0U);
+    GuiStatic_Init(&layers, &layer_ops);
+    for (uint8_t i = 0U; i < MEM_BUDGET_MAX_SCREENS; i++) MemBudget_SetBudget(&mb, i, SCREEN_BUDGET);
+    MemBudget_SetBudget(&mb, 6U, STATIC_BUDGET);
+    MemBudget_SetBudget(&mb, 7U, STATIC_BUDGET);
+
+    for (uint32_t change = 0U; change < CHANGES; change++)
+    {
+        uint8_t s = (uint8_t)(Random() % SCREENS);
+        const Screen_t *scr = &screens[s];
+        uint32_t stay = Between(20U, 200U);
+        uint32_t before;
+
+        // Leave the previous screen.
+        for (uint32_t i = 0U; i < count; i++) Heap_Free(widgets[i]);
+        count = 0U;
+        if (device != 0U)
+        {
+            Heap_Free(device);
+            device = 0U;
+        }
+        active = scr->id;
+        if (s != last)
+        {
+            entries[s]++;
+            res->entries++;
+            last = s;
+        }
+
+        for (uint32_t pass = 0U; pass < stay; pass++)
+        {
+            // Drawn in every pass, so both runs see the same session.
+            uint32_t size = Between(scr->widget_min, scr->widget_max);
+
+            before = allocs;
+            if (count < scr->widgets)
+            {
+                uint32_t h = Heap_Alloc(size);
+
+                if (h == 0U) res->widget_failures++;
+                else widgets[count++] = h;
+            }
+            if ((pass == 0U) && (scr->persistent != 0U) && (persistent[s] == 0U))
+            {
+                persistent[s] = Heap_Alloc(scr->persistent);
+                if (persistent[s] == 0U) res->widget_failures++;
+            }
+            if ((pass == 1U) && scr->static_layer)
+            {
+                uint32_t handle;
+
+                if (GuiStatic_Acquire(&layers, active, 1U, &handle) == GUI_STATIC_DIRECT) res->direct++;
+                else GuiStatic_Rendered(&layers, active);
+            }
+            if ((pass == 1U) && (scr->device != 0U))
+            {
+                device = Device_Create(scr->device);
+                if (device == 0U) res->device_failures++;
+            }
+            if ((pass == 1U) && scr->glyphs)
+            {
+                for (uint8_t i = 0U; i < GLYPHS; i++)
+                {
+                    if (glyph[i] != 0U) continue;
+                    glyph[i] = Device_Create(GLYPH_SIZE);
+                    if (glyph[i] == 0U) res->device_failures++;
+                }
+            }
+            screen_allocs[active] += allocs - before;
+            now_ms += PASS_MS;
+            if (with_budget) Sample(res);
+            else if (Heap_Free_Bytes() < res->min_free) res->min_free = Heap_Free_Bytes();
+            if (Heap_Largest() < res->min_largest) res->min_largest = Heap_Largest();
+        }
+    }
+
+    if (with_budget)
+    {
+        for (uint8_t s = 0U; s < SCREENS; s++)
+        {
+            const MemScreen_t *ms = &mb.screens[screens[s].id];
+
+            CHECK(ms->entries == entries[s]);
+            CHECK(ms->allocs <= screen_allocs[screens[s].id]);
+        }
+        res->warnings = mb.warnings;
+        res->criticals = mb.criticals;
+    }
+    res->released = released;
+}
+
+/**
+ * @brief  MemBudget_Sample() after the screen service, checked against
+ *         the allocator.
+ */
+static void Sample(Result_t *res)
+{
+    MemLevel_t level = MemBudget_Sample(&mb, active);
+    uint32_t free = Heap_Free_Bytes();
+
+    CHECK((mb.free == free) && (mb.used == (HEAP_SIZE - free)) && (mb.blocks == Heap_Used_Blocks()));
+    CHECK(mb.largest <= free);
+    if (free < WARN_FREE) CHECK(level != MEM_LEVEL_OK);
+    if (free < res->min_free) res->min_free = free;
+}
+
+/**
+ * @brief  xorshift32, repeatable between runs.
+ */
+static uint32_t Random(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+static uint32_t Between(uint32_t lo, uint32_t hi)
+{
+    return lo + (Random() % (hi - lo + 1U));
+}
@@ -0,0 +1,267 @@
+/**
+ ******************************************************************************
+ * File Name          : qr_cache_test.c
+ * Description        : host test, QR module matrix cache and run drawing
+ ******************************************************************************
+ *
+ * Runs IC/Src/qr_cache.c with a stand-in encoder in place of QR_Encode()
+ * (emWin GUI_QR_Create). The stand-in builds a matrix of the size of a
+ * QR version for the text length, with the three finder patterns and
+ * data modules from a hash of the text, so every text has its own
+ * matrix.
+ *
+ * A session of the QR screen is replayed the way display.c drives the
+ * cache: both codes encoded at boot, redraws through QrCache_Get(), a
+ * QR_REQUEST that invalidates a slot from the RS485 interrupt and is
+ * encoded again from the main loop. The test reports encodes next to one
+ * per redraw, as GUI_QR_Create used to do. Failed and oversized texts
+ * must not be encoded again on every loop.
+ *
+ * Drawing with one fill per run of dark modules is compared pixel by
+ * pixel with drawing every module, at QR_CODE_PIXEL_SIZE, for every
+ * matrix size up to QR_CACHE_MAX_SIZE; the test reports fills per code.
+ *
+ * Build (Linux):
+ *   make -C Tools/tests qr_cache_test
+ *
+ ******************************************************************************
+ */
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "qr_cache.h"
+#include "host_test.h"
+/* Private Define ------------------------------------------------------------*/
+#define PIXEL_SIZE          8               /* QR_CODE_PIXEL_SIZE */
+#define MARGIN              10              /* Service_QrCodeScreen() */
+#define CANVAS              (MARGIN + (QR_CACHE_MAX_SIZE * PIXEL_SIZE) + MARGIN)
+#define REDRAWS             500U
+/* Private Variable ----------------------------------------------------------*/
+static uint8_t by_run[CANVAS][CANVAS];
+static uint8_t by_module[CANVAS][CANVAS];
+static uint32_t encoder_calls;
+static bool encoder_fails;
+static uint16_t forced_size;                /* 0: size from the text length */
+/* Private Function Prototype ------------------------------------------------*/
+static bool Encode(const char *text, uint8_t *bits, uint16_t max_size, uint16_t *size);
+static bool Dark(const char *text, uint16_t size, uint16_t x, uint16_t y);
+static bool Finder(uint16_t size, uint16_t x, uint16_t y, bool *dark);
+static uint32_t Hash(const char *text, uint32_t value);
+static uint32_t Draw(const QrCacheEntry_t *qr, bool runs);
+static void Fill(uint8_t canvas[CANVAS][CANVAS], int x0, int y0, int x1, int y1);
+/* Program Code --------------------------------------------------------------*/
+int main(void)
+{
+    static const char *wifi = "WIFI:T:WPA;S:Kuca;P:lozinka123;;";
+    static const char *app = "https://example.com/app";
+    static QrCache_t cache;
+    const QrCacheEntry_t *qr;
+    char big[QR_CACHE_TEXT_MAX + 8U];
+    uint32_t redraws = 0U, wrong = 0U, encodes;
+
+    // Session: boot, redraws of both codes, one QR_REQUEST.
+    QrCache_Init(&cache, Encode);
+    CHECK(QrCache_Update(&cache, 0U, wifi));
+    CHECK(QrCache_Update(&cache, 1U, app));
+    for (uint32_t i = 0U; i < REDRAWS; i++)
+    {
+        uint8_t slot = (uint8_t)(i % QR_CACHE_SLOTS);
+        const char *text;
+
+        if (i == (REDRAWS / 2U))
+        {
+            QrCache_Invalidate(&cache, 0U);          /* RS485 RX interrupt */
+            wifi = "WIFI:T:WPA;S:Kuca2;P:nova;;";
+            CHECK(QrCache_Update(&cache, 0U, wifi)); /* Handle_PeriodicEvents */
+            CHECK(QrCache_Update(&cache, 1U, app));
+        }
+        text = (slot == 0U) ? wifi : app;
+        qr = QrCache_Get(&cache, slot, text);
+        redraws++;
+        CHECK(qr != NULL);
+        if (qr == NULL) continue;
+        CHECK(strcmp(qr->text, text) == 0);
+        for (uint16_t y = 0U; y < qr->size; y++)
+        {
+            for (uint16_t x = 0U; x < qr->size; x++)
+            {
+                if (QrCache_Module(qr, x, y) != Dark(text, qr->size, x, y)) wrong++;
+            }
+        }
+    }
+    CHECK(wrong == 0U);                     /* every matrix is the one of its text */
+    CHECK(encoder_calls == 3U);
+    printf("%u redraws of 2 codes, one QR_REQUEST: %u encodes (was %u), %u cache hits\n",
+           redraws, cache.encodes, redraws, cache.hits);
+
+    // Text changed without Invalidate: encoded on the next Get.
+    encodes = encoder_calls;
+    CHECK(QrCache_Get(&cache, 1U, "https://example.com/v2") != NULL);
+    CHECK(encoder_calls == (encodes + 1U));
+
+    // A failed text is encoded once, not on every main loop pass.
+    encodes = encoder_calls;
+    CHECK(!QrCache_Update(&cache, 1U, ""));
+    for (uint32_t i = 0U; i < 50U; i++)
+    {
+        CHECK(!QrCache_Update(&cache, 1U, ""));
+        CHECK(QrCache_Get(&cache, 1U, "") == NULL);
+    }
+    CHECK(encoder_calls == (encodes + 1U));
+    // Invalidate retries it, a new text is tried at once.
+    encoder_fails = true;
+    CHECK(!QrCache_Update(&cache, 1U, app));
+    encoder_fails = false;
+    CHECK(!QrCache_Update(&cache, 1U, app));
+    QrCache_Invalidate(&cache, 1U);
+    CHECK(QrCache_Update(&cache, 1U, app));
+    CHECK(encoder_calls == (encodes + 3U));
+
+    // Too long for the slot, or a matrix larger than QR_CACHE_MAX_SIZE.
+    memset(big, 'a', sizeof(big) - 1U);
+    big[sizeof(big) - 1U] = '\0';
+    encodes = encoder_calls;
+    CHECK(!QrCache_Update(&cache, 1U, big));
+    CHECK(encoder_calls == encodes);
+    forced_size = QR_CACHE_MAX_SIZE + 4U;
+    CHECK(QrCache_Get(&cache, 1U, "too large") == NULL);
+    forced_size = 0U;
+    CHECK(QrCache_Get(&cache, QR_CACHE_SLOTS, app) == NULL);
+    CHECK(!QrCache_Update(&cache, QR_CACHE_SLOTS, app));
+    CHECK(QrCache_Get(&cache, 0U, NULL) == NULL);
+
+    // One fill per run draws the same pixels as one fill per module.
+    printf("modules  dark modules  run fills\n");
+    for (uint16_t size = 21U; size <= QR_CACHE_MAX_SIZE; size = (uint16_t)(size + ((size < 57U) ? 4U : 15U)))
+    {
+        uint32_t modules, runs;
+
+        forced_size = size;
+        QrCache_Invalidate(&cache, 0U);
+        qr = QrCache_Get(&cache, 0U, wifi);
+        CHECK((qr != NULL) && (qr->size == size));
+        if (qr == NULL) continue;
+        memset(by_run, 0, sizeof(by_run));
+        memset(by_module, 0, sizeof(by_module));
+        runs = Draw(qr, true);
+        modules = Draw(qr, false);
+        CHECK(memcmp(by_run, by_module, sizeof(by_run)) == 0);
+        CHECK(runs < modules);
+        printf("%4ux%-3u %12u  %9u\n", size, size, modules, runs);
+    }
+    forced_size = 0U;
+
+    return HOST_TEST_END("qr_cache_test");
+}
+
+/**
+ * @brief  Stand-in for QR_Encode(): version by text length, finder
+ *         patterns, data modules from a hash of the text.
+ */
+static bool Encode(const char *text, uint8_t *bits, uint16_t max_size, uint16_t *size)
+{
+    uint16_t n = (forced_size != 0U) ? forced_size : (uint16_t)(21U + (4U * (strlen(text) / 8U)));
+
+    encoder_calls++;
+    if (encoder_fails || (text[0] == '\0') || (n > max_size)) return false;
+    for (uint16_t y = 0U; y < n; y++)
+    {
+        for (uint16_t x = 0U; x < n; x++)
+        {
+            if (Dark(text, n, x, y)) bits[(y * QR_CACHE_LINE_BYTES) + (x >> 3)] |= (uint8_t)(0x80U >> (x & 7U));
+        }
+    }
+    *size = n;
+    return true;
+}
+
+static bool Dark(const char *text, uint16_t size, uint16_t x, uint16_t y)
+{
+    bool dark;
+
+    if (Finder(size, x, y, &dark)) return dark;
+    return (Hash(text, ((uint32_t)y << 8) | x) & 1U) != 0U;
+}
+
+/**
+ * @brief  7x7 finder patterns in three corners, with a light separator.
+ */
+static bool Finder(uint16_t size, uint16_t x, uint16_t y, bool *dark)
+{
+    static const uint16_t corner[3][2] = { { 0U, 0U }, { 1U, 0U }, { 0U, 1U } };
+
+    for (uint8_t c = 0U; c < 3U; c++)
+    {
+        int fx = corner[c][0] ? (int)(size - 7U) : 0;
+        int fy = corner[c][1] ? (int)(size - 7U) : 0;
+        int dx = (int)x - fx, dy = (int)y - fy;
+
+        if ((dx >= -1) && (dx <= 7) && (dy >= -1) && (dy <= 7))
+        {
+            // Separator light; then dark, light and a dark 3x3 centre.
+            int ring = dx;
+
+            if ((6 - dx) < ring) ring = 6 - dx;
+            if (dy < ring) ring = dy;
+            if ((6 - dy) < ring) ring = 6 - dy;
+            *dark = (ring >= 0) && (ring != 1);
+            return true;
+        }
+    }
+    return false;
+}
+
+static uint32_t Hash(const char *text, uint32_t value)
+{
+    uint32_t h = 2166136261U;
+
+    while (*text != '\0') h = (h ^ (uint8_t)*text++) * 16777619U;
+    h = (h ^ value) * 16777619U;
+    h ^= h >> 15;
+    return h * 2246822519U >> 13;
+}
+
+/**
+ * @brief  Draws the code like Service_QrCodeScreen(), by runs or by module.
+ * @retval fills issued
+ */
+static uint32_t Draw(const QrCacheEntry_t *qr, bool runs)
+{
+    uint8_t (*canvas)[CANVAS] = runs ? by_run : by_module;
+    uint32_t fills = 0U;
+
+    for (uint16_t y = 0U; y < qr->size; y++)
+    {
+        uint16_t x = 0U, run;
+
+        if (runs)
+        {
+            while (QrCache_NextRun(qr, y, &x, &run))
+            {
+                Fill(canvas, MARGIN + (x * PIXEL_SIZE), MARGIN + (y * PIXEL_SIZE),
+                     MARGIN + ((x + run) * PIXEL_SIZE) - 1, MARGIN + ((y + 1) * PIXEL_SIZE) - 1);
+                fills++;
+                x = (uint16_t)(x + run);
+            }
+            continue;
+        }
+        for (x = 0U; x < qr->size; x++)
+        {
+            if (!QrCache_Module(qr, x, y)) continue;
+            Fill(canvas, MARGIN + (x * PIXEL_SIZE), MARGIN + (y * PIXEL_SIZE),
+                 MARGIN + ((x + 1) * PIXEL_SIZE) - 1, MARGIN + ((y + 1) * PIXEL_SIZE) - 1);
+            fills++;
+        }
+    }
+    return fills;
+}
+
+static void Fill(uint8_t canvas[CANVAS][CANVAS], int x0, int y0, int x1, int y1)
+{
+    for (int y = y0; y <= y1; y++)
+    {
+        for (int x = x0; x <= x1; x++) canvas[y][x]++;
+    }
+}
@@ -0,0 +1,314 @@
+/**
+ ******************************************************************************
+ * File Name          : screen_mgr_test.c
+ * Description        : host test, screen registry and idle prefetch over a
+ *                      replayed navigation trace
+ ******************************************************************************
+ *
+ * Runs IC/Src/screen_mgr.c with a part of the screen_registry of display.c
+ * (main, select 1 and 2, lights, gate, scene, curtains, thermostat and
+ * settings 1 with its leave hook) and replays 4000 screen changes of a
+ * user, drawn from a fixed table of how often each screen follows
+ * another. Between changes the user stays 0.1..8 s on a screen; the main
+ * loop calls ScreenMgr_Service() and then ScreenMgr_Idle() every 10 ms.
+ *
+ * A manifest stands for the icon copy of the screen: it takes 30 ms and
+ * its icons stay in a cache of CACHE_SCREENS manifests, the oldest going
+ * first. Now and then the QSPI is busy for a while (firmware update) and
+ * manifests fail.
+ *
+ * Every screen that counts as prefetched on entering has to find its
+ * icons in the cache, services run only for the active screen, leave
+ * runs once per exit and a manifest that failed on entering is loaded
+ * by ScreenMgr_Idle() once the QSPI is free. The test reports cold
+ * enters, prefetch hits and transition time with prefetch and without it
+ * (no idle time is ever long enough).
+ *
+ * Build (Linux):
+ *   make -C Tools/tests screen_mgr_test
+ *
+ ******************************************************************************
+ */
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "screen_mgr.h"
+#include "host_test.h"
+/* Private Define ------------------------------------------------------------*/
+#define PASS_US             10000U          /* main loop pass */
+#define SERVICE_US          2000U           /* a service pass */
+#define MANIFEST_US         30000U          /* icon copy of one screen */
+#define IDLE_US             300000U         /* SCREEN_PREFETCH_IDLE_US */
+#define CACHE_SCREENS       4U              /* manifests the icon cache holds */
+#define CHANGES             4000U
+/* Private Type --------------------------------------------------------------*/
+enum                                        /* eScreen values */
+{
+    S_MAIN = 1, S_SELECT_1 = 2, S_SELECT_2 = 3, S_LIGHTS = 4, S_GATE = 5,
+    S_SCENE = 6, S_CURTAINS = 7, S_THERMOSTAT = 8, S_SETTINGS_1 = 9, S_UNKNOWN = 40
+};
+
+typedef struct
+{
+    uint32_t cold, hits, prefetches, failed;
+    uint64_t transition_us;
+    uint32_t transition_max_us;
+} Run_t;
+/* Private Variable ----------------------------------------------------------*/
+static uint32_t clk;                        /* µs */
+static uint8_t active;                      /* screen the main loop is on */
+static uint8_t cache[CACHE_SCREENS];        /* manifests in the icon cache, newest first */
+static uint32_t wrong_service, leaves, settings_exits;
+static bool flash_busy;
+static uint32_t rng;
+/* Private Function Prototype ------------------------------------------------*/
+static uint32_t Now(void);
+static uint32_t ElapsedUs(uint32_t start);
+static void Service(uint8_t screen);
+static bool Manifest(uint8_t screen);
+static bool Cached(uint8_t screen);
+static void ServiceMain(void);
+static void ServiceSelect1(void);
+static void ServiceSelect2(void);
+static void ServiceLights(void);
+static void ServiceGate(void);
+static void ServiceScene(void);
+static void ServiceCurtains(void);
+static void ServiceThermostat(void);
+static void ServiceSettings1(void);
+static bool PrefetchSelect1(void);
+static bool PrefetchSelect2(void);
+static bool PrefetchLights(void);
+static bool PrefetchGate(void);
+static bool PrefetchScene(void);
+static void LeaveSettings(void);
+static void Replay(const ScreenDesc_t *registry, uint8_t count, uint32_t idle_us, Run_t *run);
+static uint8_t Next(uint8_t screen);
+static uint32_t Random(void);
+/* Program Code --------------------------------------------------------------*/
+int main(void)
+{
+    static const ScreenDesc_t registry[] =
+    {
+        { S_MAIN,       ServiceMain,       NULL,            NULL,          SCREEN_MGR_BIT(S_SELECT_1), 64U },
+        { S_SELECT_1,   ServiceSelect1,    PrefetchSelect1, NULL,          SCREEN_MGR_BIT(S_LIGHTS) | SCREEN_MGR_BIT(S_SELECT_2), 64U },
+        { S_SELECT_2,   ServiceSelect2,    PrefetchSelect2, NULL,          SCREEN_MGR_BIT(S_GATE), 64U },
+        { S_LIGHTS,     ServiceLights,     PrefetchLights,  NULL,          SCREEN_MGR_BIT(S_SELECT_1), 608U },
+        { S_GATE,       ServiceGate,       PrefetchGate,    NULL,          SCREEN_MGR_BIT(S_SELECT_2), 64U },
+        { S_SCENE,      ServiceScene,      PrefetchScene,   NULL,          0U, 64U },
+        { S_CURTAINS,   ServiceCurtains,   NULL,            NULL,          SCREEN_MGR_BIT(S_SELECT_1), 64U },
+        { S_THERMOSTAT, ServiceThermostat, NULL,            NULL,          SCREEN_MGR_BIT(S_SELECT_1), 608U },
+        { S_SETTINGS_1, ServiceSettings1,  NULL,            LeaveSettings, 0U, 64U },
+    };
+    static const ScreenMgrOps_t ops = { Now, ElapsedUs };
+    static ScreenMgr_t mgr;
+    static char report[4096];
+    Run_t with, without;
+
+    Replay(registry, (uint8_t)(sizeof(registry) / sizeof(registry[0])), IDLE_US, &with);
+    Replay(registry, (uint8_t)(sizeof(registry) / sizeof(registry[0])), UINT32_MAX, &without);
+    printf("%u screen changes, icon cache of %u screens, manifest %u ms\n", CHANGES, CACHE_SCREENS, MANIFEST_US / 1000U);
+    printf("prefetch  cold enters  prefetch hits  manifests  failed  trans avg ms  trans max ms\n");
+    printf("%-8s  %11u  %13u  %9u  %6u  %12.1f  %12.1f\n", "yes", with.cold, with.hits, with.prefetches, with.failed,
+           (double)with.transition_us / CHANGES / 1000.0, with.transition_max_us / 1000.0);
+    printf("%-8s  %11u  %13u  %9u  %6u  %12.1f  %12.1f\n", "no", without.cold, without.hits, without.prefetches,
+           without.failed, (double)without.transition_us / CHANGES / 1000.0, without.transition_max_us / 1000.0);
+    CHECK((without.hits == 0U) && (without.prefetches == 0U));
+    CHECK(with.cold < (without.cold / 2U));
+    CHECK(with.transition_us < without.transition_us);
+
+    // Hints first, after the idle time, one manifest per call.
+    ScreenMgr_Init(&mgr, &ops, registry, (uint8_t)(sizeof(registry) / sizeof(registry[0])), IDLE_US);
+    memset(cache, 0, sizeof(cache));
+    flash_busy = false;
+    active = S_MAIN;
+    CHECK(ScreenMgr_Service(&mgr, S_MAIN));
+    clk = mgr.entered + IDLE_US - 1U;
+    CHECK(!ScreenMgr_Idle(&mgr));
+    clk++;
+    CHECK(ScreenMgr_Idle(&mgr) && Cached(S_SELECT_1));
+    CHECK(!ScreenMgr_Idle(&mgr));           /* main has one hint */
+
+    // A learned successor goes before the hints.
+    active = S_SELECT_1;
+    CHECK(ScreenMgr_Service(&mgr, S_SELECT_1));
+    CHECK(mgr.prefetch_hits == 1U);
+    active = S_SCENE;
+    CHECK(ScreenMgr_Service(&mgr, S_SCENE));
+    active = S_SELECT_1;
+    CHECK(ScreenMgr_Service(&mgr, S_SELECT_1));
+    memset(cache, 0, sizeof(cache));
+    clk += IDLE_US;
+    CHECK(ScreenMgr_Idle(&mgr) && Cached(S_SCENE) && !Cached(S_SELECT_2));
+    CHECK(ScreenMgr_Idle(&mgr) && Cached(S_SELECT_2) && !Cached(S_LIGHTS));
+    CHECK(ScreenMgr_Idle(&mgr) && Cached(S_LIGHTS));
+
+    // No more than SCREEN_MGR_PREFETCH_DEPTH screens ahead.
+    CHECK(!ScreenMgr_Idle(&mgr));
+    CHECK(mgr.prefetches == 4U);
+
+    // Screens outside the registry run the caller's default.
+    active = S_UNKNOWN;
+    CHECK(!ScreenMgr_Service(&mgr, S_UNKNOWN));
+    CHECK(!ScreenMgr_Service(&mgr, 200U));
+    CHECK(!ScreenMgr_Idle(&mgr));
+
+    // Report: a line per learned transition, nothing cut in the middle.
+    CHECK(ScreenMgr_Report(&mgr, report, sizeof(report)) == strlen(report));
+    CHECK(strncmp(report, "prefetch ", 9U) == 0);
+    CHECK(ScreenMgr_Report(&mgr, report, 60U) == strlen(report));
+    CHECK((strlen(report) < 60U) && (report[strlen(report) - 1U] == '\n'));
+    CHECK(ScreenMgr_Report(&mgr, report, 8U) == 0U);
+
+    return HOST_TEST_END("screen_mgr_test");
+}
+
+static uint32_t Now(void)
+{
+    return clk;
+}
+
+static uint32_t ElapsedUs(uint32_t start)
+{
+    return clk - start;
+}
+
+static void Service(uint8_t screen)
+{
+    if (screen != active) wrong_service++;
+    clk += SERVICE_US;
+}
+
+/**
+ * @brief  Copies the icons of `screen` into the cache, unless the QSPI is
+ *         busy.
+ */
+static bool Manifest(uint8_t screen)
+{
+    uint8_t i;
+
+    if (flash_busy) return false;
+    clk += MANIFEST_US;
+    for (i = 0U; (i < (CACHE_SCREENS - 1U)) && (cache[i] != screen); i++) { }
+    memmove(&cache[1], &cache[0], i);
+    cache[0] = screen;
+    return true;
+}
+
+static bool Cached(uint8_t screen)
+{
+    return memchr(cache, screen, sizeof(cache)) != NULL;
+}
+
+static void ServiceMain(void)       { Service(S_MAIN); }
+static void ServiceSelect1(void)    { Service(S_SELECT_1); }
+static void ServiceSelect2(void)    { Service(S_SELECT_2); }
+static void ServiceLights(void)     { Service(S_LIGHTS); }
+static void ServiceGate(void)       { Service(S_GATE); }
+static void ServiceScene(void)      { Service(S_SCENE); }
+static void ServiceCurtains(void)   { Service(S_CURTAINS); }
+static void ServiceThermostat(void) { Service(S_THERMOSTAT); }
+static void ServiceSettings1(void)  { Service(S_SETTINGS_1); }
+static bool PrefetchSelect1(void)   { return Manifest(S_SELECT_1); }
+static bool PrefetchSelect2(void)   { return Manifest(S_SELECT_2); }
+static bool PrefetchLights(void)    { return Manifest(S_LIGHTS); }
+static bool PrefetchGate(void)      { return Manifest(S_GATE); }
+static bool PrefetchScene(void)     { return Manifest(S_SCENE); }
+
+static void LeaveSettings(void)
+{
+    leaves++;
+}
+
+/**
+ * @brief  CHANGES screen changes with the main loop in between.
+ */
+static void Replay(const ScreenDesc_t *registry, uint8_t count, uint32_t idle_us, Run_t *run)
+{
+    static const uint8_t with_manifest[] = { S_SELECT_1, S_SELECT_2, S_LIGHTS, S_GATE, S_SCENE };
+    static ScreenMgr_t mgr;
+    static const ScreenMgrOps_t ops = { Now, ElapsedUs };
+    uint32_t missing = 0U, not_retried = 0U, hits;
+
+    memset(run, 0, sizeof(Run_t));
+    memset(cache, 0, sizeof(cache));
+    wrong_service = leaves = settings_exits = 0U;
+    flash_busy = false;
+    rng = 0x1234567U;
+    clk = 0U;
+    ScreenMgr_Init(&mgr, &ops, registry, count, idle_us);
+    active = S_MAIN;
+
+    for (uint32_t c = 0U; c < CHANGES; c++)
+    {
+        uint32_t stay = 100000U + (Random() % 7900000U);
+        uint32_t start = clk, t0;
+        uint8_t next = Next(active);
+
+        // The screen changes in a pass of its service (touch handler).
+        if ((Random() % (flash_busy ? 3U : 100U)) == 0U) flash_busy = !flash_busy;
+        if (active == S_SETTINGS_1) settings_exits++;
+        active = next;
+        hits = mgr.prefetch_hits;
+        t0 = clk;
+        ScreenMgr_Service(&mgr, next);
+        run->transition_us += clk - t0;
+        if ((clk - t0) > run->transition_max_us) run->transition_max_us = clk - t0;
+        for (uint8_t i = 0U; i < sizeof(with_manifest); i++)
+        {
+            if ((next == with_manifest[i]) && (mgr.prefetch_hits != hits) && !Cached(next)) missing++;
+        }
+        ScreenMgr_Idle(&mgr);
+        clk = t0 + PASS_US;
+
+        while ((clk - start) < stay)
+        {
+            t0 = clk;
+            ScreenMgr_Service(&mgr, active);
+            ScreenMgr_Idle(&mgr);
+            clk = t0 + PASS_US;
+        }
+        // A failed manifest is loaded once the QSPI is free.
+        if (!flash_busy && ((mgr.prefetched & SCREEN_MGR_BIT(active)) == 0U)) not_retried++;
+        if ((mgr.prefetched & SCREEN_MGR_BIT(active)) == 0U) run->failed++;
+    }
+    CHECK(missing == 0U);
+    CHECK(wrong_service == 0U);
+    CHECK(not_retried == 0U);
+    CHECK(leaves == settings_exits);
+    CHECK((mgr.cold_enters + mgr.prefetch_hits) <= CHANGES);
+    run->cold = mgr.cold_enters;
+    run->hits = mgr.prefetch_hits;
+    run->prefetches = mgr.prefetches;
+}
+
+/**
+ * @brief  Next screen from a table of how often users go where.
+ */
+static uint8_t Next(uint8_t screen)
+{
+    static const uint8_t next[][10] =
+    {
+        /* from main */       { S_SELECT_1, S_SELECT_1, S_SELECT_1, S_SELECT_1, S_SELECT_1, S_SELECT_1, S_THERMOSTAT, S_THERMOSTAT, S_THERMOSTAT, S_SETTINGS_1 },
+        /* from select 1 */   { S_LIGHTS, S_LIGHTS, S_LIGHTS, S_LIGHTS, S_LIGHTS, S_SELECT_2, S_SELECT_2, S_SCENE, S_CURTAINS, S_MAIN },
+        /* from select 2 */   { S_GATE, S_GATE, S_GATE, S_GATE, S_GATE, S_GATE, S_SELECT_1, S_SELECT_1, S_MAIN, S_MAIN },
+        /* from lights */     { S_SELECT_1, S_SELECT_1, S_SELECT_1, S_SELECT_1, S_SELECT_1, S_SELECT_1, S_SELECT_1, S_MAIN, S_MAIN, S_MAIN },
+        /* from gate */       { S_SELECT_2, S_SELECT_2, S_SELECT_2, S_SELECT_2, S_SELECT_2, S_SELECT_2, S_MAIN, S_MAIN, S_MAIN, S_MAIN },
+        /* from scene */      { S_MAIN, S_MAIN, S_MAIN, S_MAIN, S_MAIN, S_MAIN, S_SELECT_1, S_SELECT_1, S_SELECT_1, S_SELECT_1 },
+        /* from curtains */   { S_SELECT_1, S_SELECT_1, S_SELECT_1, S_SELECT_1, S_SELECT_1, S_MAIN, S_MAIN, S_MAIN, S_MAIN, S_MAIN },
+        /* from thermostat */ { S_MAIN, S_MAIN, S_MAIN, S_MAIN, S_MAIN, S_MAIN, S_MAIN, S_SELECT_1, S_SELECT_1, S_SELECT_1 },
+        /* from settings 1 */ { S_MAIN, S_MAIN, S_MAIN, S_MAIN, S_MAIN, S_MAIN, S_MAIN, S_MAIN, S_MAIN, S_MAIN },
+    };
+
+    return next[screen - S_MAIN][Random() % 10U];
+}
+
+static uint32_t Random(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
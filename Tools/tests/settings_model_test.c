@@ -0,0 +1,263 @@
+/**
+ ******************************************************************************
+ * File Name          : settings_model_test.c
+ * Description        : host test, settings model driven by widget
+ *                      notifications
+ ******************************************************************************
+ *
+ * Runs IC/Src/settings_model.c with the field table of settings screen 1
+ * (thermostat and fan) and a stand-in for the thermostat module. The
+ * stand-in corrects the setpoint limits like Thermostat_Set_SP_Min() and
+ * Thermostat_Set_SP_Max() do: the minimum stays below the maximum.
+ *
+ * Widgets are modelled the way emWin behaves: every change of a value,
+ * by touch or by SPINBOX_SetValue() from the firmware, sends
+ * WM_NOTIFICATION_VALUE_CHANGED, handled like Settings_OnNotify() in
+ * display.c. Random touches (steps, jumps, values outside the field range)
+ * are replayed over the screen, with idle main loop passes in between.
+ *
+ * After every touch each widget, the model and the module have to hold
+ * the same value, a correction must not start a loop of notifications
+ * and every write must leave a change event. Idle passes must not write
+ * anything. The test reports module reads and writes next to the old
+ * Service_SettingsScreen_1(), which read every widget on every pass.
+ *
+ * Build (Linux):
+ *   make -C Tools/tests settings_model_test
+ *
+ ******************************************************************************
+ */
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "settings_model.h"
+#include "host_test.h"
+/* Private Define ------------------------------------------------------------*/
+#define SCREEN_SETTINGS_1   30U
+#define SCREEN_SETTINGS_2   31U
+#define THST_SP_MIN         5               /* thermostat.h */
+#define THST_SP_MAX         40
+#define FIELDS              (sizeof(fields) / sizeof(fields[0]))
+#define TOUCHES             5000U
+#define PASSES              20000U          /* main loop passes on the screen */
+/* Private Type --------------------------------------------------------------*/
+typedef enum
+{
+    KEY_THST_CONTROL = 0,
+    KEY_SP_MAX,
+    KEY_SP_MIN,
+    KEY_FAN_CONTROL,
+    KEY_FAN_DIFF,
+    KEY_FAN_LOW_BAND,
+    KEY_FAN_HI_BAND,
+    KEY_GROUP,
+    KEY_MASTER,
+    KEYS
+} Key_t;
+/* Private Variable ----------------------------------------------------------*/
+static const SettingsField_t fields[] =     /* settings_screen_1_fields */
+{
+    { 100U, KEY_THST_CONTROL, SETTINGS_WIDGET_RADIO,    0,           2           },
+    { 101U, KEY_SP_MAX,       SETTINGS_WIDGET_SPINBOX,  THST_SP_MIN, THST_SP_MAX },
+    { 102U, KEY_SP_MIN,       SETTINGS_WIDGET_SPINBOX,  THST_SP_MIN, THST_SP_MAX },
+    { 103U, KEY_FAN_CONTROL,  SETTINGS_WIDGET_RADIO,    0,           1           },
+    { 104U, KEY_FAN_DIFF,     SETTINGS_WIDGET_SPINBOX,  0,           10          },
+    { 105U, KEY_FAN_LOW_BAND, SETTINGS_WIDGET_SPINBOX,  0,           50          },
+    { 106U, KEY_FAN_HI_BAND,  SETTINGS_WIDGET_SPINBOX,  0,           100         },
+    { 107U, KEY_GROUP,        SETTINGS_WIDGET_SPINBOX,  0,           254         },
+    { 108U, KEY_MASTER,       SETTINGS_WIDGET_CHECKBOX, 0,           1           },
+};
+static SettingsModel_t model;
+static int32_t module[KEYS];                /* thermostat config */
+static int32_t widget[FIELDS];              /* values the widgets show */
+static uint32_t reads, writes, notifies, depth, max_depth;
+static uint32_t rng = 0x1234567U;
+/* Private Function Prototype ------------------------------------------------*/
+static int32_t Read(uint8_t key);
+static void Write(uint8_t key, int32_t value);
+static void SetWidget(uint8_t i, int32_t value);
+static void OnNotify(uint8_t i);
+static bool Consistent(void);
+static uint32_t Random(void);
+/* Program Code --------------------------------------------------------------*/
+int main(void)
+{
+    static const SettingsModelOps_t ops = { Read, Write };
+    static SettingsField_t too_many[SETTINGS_MODEL_MAX_FIELDS + 1U];
+    uint32_t events = 0U, inconsistent = 0U, idle_writes = 0U;
+    int32_t applied;
+    uint8_t key;
+    int32_t value;
+
+    module[KEY_SP_MAX] = 28;
+    module[KEY_SP_MIN] = 18;
+    module[KEY_GROUP] = 3;
+    module[KEY_FAN_LOW_BAND] = 10;
+    module[KEY_FAN_HI_BAND] = 20;
+
+    // DSP_InitSet1Scrn: widgets show the module values, then Bind.
+    SettingsModel_Init(&model, &ops);
+    for (uint8_t i = 0U; i < FIELDS; i++) widget[i] = module[fields[i].key];
+    CHECK(SettingsModel_Bind(&model, SCREEN_SETTINGS_1, fields, FIELDS));
+    CHECK(Consistent());
+    reads = 0U;
+
+    // Touches between idle passes.
+    for (uint32_t pass = 0U; pass < PASSES; pass++)
+    {
+        uint32_t before = writes;
+
+        if ((pass % (PASSES / TOUCHES)) == 0U)
+        {
+            uint8_t i = (uint8_t)(Random() % FIELDS);
+            const SettingsField_t *f = &fields[i];
+            int32_t span = f->max - f->min + 1;
+
+            switch (Random() % 4U)
+            {
+            case 0U:                        /* arrow up or down */
+                SetWidget(i, widget[i] + (((Random() % 2U) == 0U) ? 1 : -1));
+                break;
+            case 1U:                        /* anywhere in range */
+                SetWidget(i, f->min + (int32_t)(Random() % (uint32_t)span));
+                break;
+            case 2U:                        /* typed past the range */
+                SetWidget(i, ((Random() % 2U) == 0U) ? (f->min - 3) : (f->max + 3));
+                break;
+            default:                        /* the setpoint limits against each other */
+                SetWidget(1U, widget[2] - (int32_t)(Random() % 3U));
+                SetWidget(2U, widget[1] + (int32_t)(Random() % 3U));
+                break;
+            }
+            if (!Consistent()) inconsistent++;
+            continue;
+        }
+        // Service_SettingsScreen_1(): only change events.
+        while (SettingsModel_Next(&model, &key, &value))
+        {
+            events++;
+            CHECK(value == module[key]);
+        }
+        if (writes != before) idle_writes++;
+    }
+    while (SettingsModel_Next(&model, &key, &value)) events++;
+    CHECK(inconsistent == 0U);
+    CHECK(idle_writes == 0U);
+    CHECK(max_depth <= 2U);                 /* touch, one correction echo */
+    CHECK(module[KEY_SP_MIN] < module[KEY_SP_MAX]);
+    CHECK(model.edits == writes);
+    CHECK((events <= writes) && (events != 0U));
+    CHECK(model.corrections != 0U);
+    printf("%u passes, %u touches on %u fields\n", PASSES, TOUCHES, (unsigned)FIELDS);
+    printf("        widget reads  module reads  module writes  corrections  events\n");
+    printf("before  %12u  %12u  %13s  %11s  %6s\n", PASSES * (unsigned)FIELDS, PASSES * (unsigned)FIELDS, "-", "-", "-");
+    printf("after   %12u  %12u  %13u  %11u  %6u\n", notifies, reads, writes, model.corrections, events);
+
+    // Fixed cases: unchanged, applied, clamped to the range, corrected by
+    // the module.
+    CHECK(SettingsModel_Set(&model, 7, module[KEY_GROUP], &applied) == SETTINGS_UNCHANGED);
+    CHECK(SettingsModel_Set(&model, 7, 200, &applied) == SETTINGS_APPLIED);
+    CHECK((applied == 200) && (module[KEY_GROUP] == 200));
+    CHECK(SettingsModel_Set(&model, 7, 300, &applied) == SETTINGS_CORRECTED);
+    CHECK((applied == 254) && (module[KEY_GROUP] == 254));
+    CHECK(SettingsModel_Set(&model, 7, 300, &applied) == SETTINGS_CORRECTED);
+    CHECK(applied == 254);
+    CHECK(SettingsModel_Set(&model, 2, module[KEY_SP_MAX] + 1, &applied) == SETTINGS_CORRECTED);
+    CHECK(applied == (module[KEY_SP_MAX] - 1));
+    CHECK(SettingsModel_Value(&model, 2) == module[KEY_SP_MIN]);
+    CHECK(SettingsModel_Set(&model, -1, 1, &applied) == SETTINGS_UNCHANGED);
+    CHECK(SettingsModel_Set(&model, (int16_t)FIELDS, 1, &applied) == SETTINGS_UNCHANGED);
+    CHECK(SettingsModel_Value(&model, (int16_t)FIELDS) == 0);
+
+    // Lookup only for the screen that bound the fields.
+    CHECK(SettingsModel_Find(&model, SCREEN_SETTINGS_1, 105U) == 5);
+    CHECK(SettingsModel_Find(&model, SCREEN_SETTINGS_2, 105U) == -1);
+    CHECK(SettingsModel_Find(&model, SCREEN_SETTINGS_1, 999U) == -1);
+
+    // Unbind drops the events that were not taken.
+    CHECK(SettingsModel_Set(&model, 4, (module[KEY_FAN_DIFF] + 1) % 10, &applied) == SETTINGS_APPLIED);
+    SettingsModel_Unbind(&model);
+    CHECK(!SettingsModel_Next(&model, &key, &value));
+    CHECK(SettingsModel_Find(&model, SCREEN_SETTINGS_1, 105U) == -1);
+    CHECK(SettingsModel_Set(&model, 0, 1, &applied) == SETTINGS_UNCHANGED);
+
+    // More fields than the event mask holds.
+    CHECK(!SettingsModel_Bind(&model, SCREEN_SETTINGS_2, too_many, SETTINGS_MODEL_MAX_FIELDS + 1U));
+    CHECK(SettingsModel_Find(&model, SCREEN_SETTINGS_2, 0U) == -1);
+    CHECK(SettingsModel_Bind(&model, SCREEN_SETTINGS_2, too_many, SETTINGS_MODEL_MAX_FIELDS));
+    for (uint8_t i = 0U; i < SETTINGS_MODEL_MAX_FIELDS; i++) too_many[i].max = 100;
+    CHECK(SettingsModel_Set(&model, SETTINGS_MODEL_MAX_FIELDS - 1U, 77, &applied) == SETTINGS_APPLIED);
+    CHECK(SettingsModel_Next(&model, &key, &value) && (value == 77));
+    CHECK(!SettingsModel_Next(&model, &key, &value));
+
+    return HOST_TEST_END("settings_model_test");
+}
+
+static int32_t Read(uint8_t key)
+{
+    reads++;
+    return module[key];
+}
+
+/**
+ * @brief  Thermostat setters, with the correction of the setpoint limits.
+ */
+static void Write(uint8_t key, int32_t value)
+{
+    writes++;
+    if ((key == KEY_SP_MAX) && (value <= module[KEY_SP_MIN])) value = module[KEY_SP_MIN] + 1;
+    if ((key == KEY_SP_MIN) && (value >= module[KEY_SP_MAX])) value = module[KEY_SP_MAX] - 1;
+    module[key] = value;
+}
+
+/**
+ * @brief  SPINBOX_SetValue() and friends: a new value notifies the parent.
+ */
+static void SetWidget(uint8_t i, int32_t value)
+{
+    if (value == widget[i]) return;
+    widget[i] = value;
+    OnNotify(i);
+}
+
+/**
+ * @brief  Settings_OnNotify(): write the value, show what the module took.
+ */
+static void OnNotify(uint8_t i)
+{
+    int16_t index = SettingsModel_Find(&model, SCREEN_SETTINGS_1, fields[i].id);
+    int32_t applied;
+
+    if (index < 0) return;
+    notifies++;
+    if (++depth > max_depth) max_depth = depth;
+    if (depth <= 8U)
+    {
+        if (SettingsModel_Set(&model, index, widget[i], &applied) == SETTINGS_CORRECTED) SetWidget(i, applied);
+    }
+    depth--;
+}
+
+/**
+ * @brief  Widgets, model and module hold the same values.
+ */
+static bool Consistent(void)
+{
+    for (uint8_t i = 0U; i < FIELDS; i++)
+    {
+        int32_t v = module[fields[i].key];
+
+        if ((widget[i] != v) || (SettingsModel_Value(&model, (int16_t)i) != v)) return false;
+    }
+    return true;
+}
+
+static uint32_t Random(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
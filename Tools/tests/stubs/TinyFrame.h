@@ -0,0 +1,39 @@
+/**
+ ******************************************************************************
+ * File Name          : TinyFrame.h
+ * Description        : host stand-in for the TinyFrame types used by the
+ *                      firmware update agent (TF_Config.h sizes)
+ ******************************************************************************
+ */
+#ifndef __TINYFRAME_H__
+#define __TINYFRAME_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include "main.h"
+
+#define TF_MAX_PAYLOAD_RX   1024
+#define TF_SENDBUF_LEN      128
+
+typedef uint8_t  TF_ID;
+typedef uint16_t TF_LEN;
+typedef uint8_t  TF_TYPE;
+
+typedef struct TinyFrame_ TinyFrame;
+
+typedef struct TF_Msg_
+{
+    TF_ID frame_id;
+    bool is_response;
+    TF_TYPE type;
+    const uint8_t *data;
+    TF_LEN len;
+    void *userdata;
+    void *userdata2;
+} TF_Msg;
+
+bool TF_SendSimple(TinyFrame *tf, TF_TYPE type, const uint8_t *data, TF_LEN len);
+
+#endif /* __TINYFRAME_H__ */
@@ -0,0 +1,12 @@
+/**
+ ******************************************************************************
+ * File Name          : common.h
+ * Description        : host stand-in for Common/common.h (see main.h)
+ ******************************************************************************
+ */
+#ifndef __COMMON_H__
+#define __COMMON_H__
+
+#include "main.h"
+
+#endif /* __COMMON_H__ */
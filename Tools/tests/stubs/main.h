@@ -0,0 +1,76 @@
+/**
+ ******************************************************************************
+ * File Name          : main.h
+ * Description        : host stand-in for IC/Inc/main.h, HAL, CMSIS and the
+ *                      common.h firmware info API used by the firmware
+ *                      update agent
+ ******************************************************************************
+ *
+ * Only what firmware_update_agent.c touches is declared here. The fakes
+ * behind these declarations live in fw_agent_host.c.
+ *
+ ******************************************************************************
+ */
+#ifndef __MAIN_H__
+#define __MAIN_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+/* Private Define ------------------------------------------------------------*/
+#define __IO                            volatile
+#define __DMB()                         __sync_synchronize()
+#define __disable_irq()                 HostIrq_Disable()
+#define __enable_irq()                  HostIrq_Enable()
+#define __get_PRIMASK()                 HostIrq_GetMask()
+#define __set_PRIMASK(mask)             HostIrq_SetMask(mask)
+#define SCB_DisableDCache()             ((void)0)
+#define SCB_EnableDCache()              ((void)0)
+#define HAL_NVIC_DisableIRQ(irq)        HostIrq_Disable()
+#define HAL_NVIC_EnableIRQ(irq)         HostIrq_Enable()
+#define UID_BASE                        ((uintptr_t)&host_uid)
+
+#define CRC_INPUTDATA_FORMAT_BYTES      0x00000001U
+#define CRC_INPUTDATA_FORMAT_WORDS      0x00000003U
+
+#define RT_APPL_ADDR                    0x08010000U
+#define RT_APPL_SIZE                    0x000F0000U
+
+/* Private Type --------------------------------------------------------------*/
+typedef enum { HAL_OK = 0, HAL_ERROR = 1 } HAL_StatusTypeDef;
+
+typedef struct
+{
+    uint32_t InputDataFormat;
+} CRC_HandleTypeDef;
+
+typedef struct
+{
+    uint32_t size;
+    uint32_t crc32;
+    uint32_t version;
+    uint32_t wr_addr;
+    uint32_t ld_addr;
+} FwInfoTypeDef;
+
+/* Exported Variable ---------------------------------------------------------*/
+extern CRC_HandleTypeDef hcrc;
+extern uint32_t host_uid;
+
+/* Exported Function ---------------------------------------------------------*/
+uint32_t HAL_GetTick(void);
+void HAL_Delay(uint32_t ms);
+HAL_StatusTypeDef HAL_CRC_Init(CRC_HandleTypeDef *h);
+HAL_StatusTypeDef HAL_CRC_DeInit(CRC_HandleTypeDef *h);
+uint32_t HAL_CRC_Calculate(CRC_HandleTypeDef *h, uint32_t *buf, uint32_t len);
+void HostIrq_Disable(void);
+void HostIrq_Enable(void);
+uint32_t HostIrq_GetMask(void);
+void HostIrq_SetMask(uint32_t mask);
+void SYSRestart(void);
+uint8_t GetFwInfo(FwInfoTypeDef *fw_info);
+uint8_t IsNewFwUpdate(FwInfoTypeDef *old_fw, FwInfoTypeDef *new_fw);
+
+#endif /* __MAIN_H__ */
@@ -0,0 +1,16 @@
+/**
+ ******************************************************************************
+ * File Name          : rs485.h
+ * Description        : host stand-in for IC/Inc/rs485.h
+ ******************************************************************************
+ */
+#ifndef __RS485_H__
+#define __RS485_H__
+
+#include <stdint.h>
+
+#define FIRMWARE_UPDATE                 51U
+
+extern uint8_t tfifa;
+
+#endif /* __RS485_H__ */
@@ -0,0 +1,19 @@
+/**
+ ******************************************************************************
+ * File Name          : stm32746g_eeprom.h
+ * Description        : host stand-in for the I2C EEPROM BSP driver, backed by
+ *                      the byte array in fw_agent_host.c
+ ******************************************************************************
+ */
+#ifndef __STM32746G_EEPROM_H__
+#define __STM32746G_EEPROM_H__
+
+#include <stdint.h>
+
+#define EEPROM_MAGIC_NUMBER                 0xABCD
+#define EE_FW_RESUME                        0x500
+
+uint32_t EE_ReadBuffer(uint8_t *pBuffer, uint16_t ReadAddr, uint16_t NumByteToRead);
+uint32_t EE_WriteBuffer(uint8_t *pBuffer, uint16_t WriteAddr, uint16_t NumByteToWrite);
+
+#endif /* __STM32746G_EEPROM_H__ */
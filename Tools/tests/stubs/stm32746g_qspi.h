@@ -0,0 +1,26 @@
+/**
+ ******************************************************************************
+ * File Name          : stm32746g_qspi.h
+ * Description        : host stand-in for the QSPI BSP driver, backed by the
+ *                      NOR model in fw_agent_host.c
+ ******************************************************************************
+ */
+#ifndef __STM32746G_QSPI_H__
+#define __STM32746G_QSPI_H__
+
+#include <stdint.h>
+
+#define QSPI_OK                             ((uint8_t)0x00)
+#define QSPI_ERROR                          ((uint8_t)0x01)
+#define QSPI_BUSY                           ((uint8_t)0x02)
+#define N25Q128A_SECTOR_SIZE                0x10000U
+#define N25Q128A_SECTOR_ERASE_MAX_TIME      3000U
+
+void    MX_QSPI_Init(void);
+uint8_t QSPI_MemMapMode(void);
+uint8_t QSPI_GetStatus(void);
+uint8_t QSPI_Erase(uint32_t staddr, uint32_t enaddr);
+uint8_t QSPI_EraseSectorStart(uint32_t staddr);
+uint8_t QSPI_Write(uint8_t *pbuf, uint32_t wraddr, uint32_t size);
+
+#endif /* __STM32746G_QSPI_H__ */
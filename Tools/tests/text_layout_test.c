@@ -0,0 +1,255 @@
+/**
+ ******************************************************************************
+ * File Name          : text_layout_test.c
+ * Description        : host test, label width, line break and font choice
+ *                      cache
+ ******************************************************************************
+ *
+ * Runs IC/Src/text_layout.c with fixed-width stand-in metrics (11 px per
+ * byte in font 0, 9 px in font 1, as Verdana20 and Verdana16 roughly are
+ * for the labels) over a table of texts in two languages and custom
+ * labels.
+ *
+ * Random texts are wrapped at random widths and every layout is checked
+ * against the rules: lines cover the text in order and split only at
+ * '\n' or spaces, a wrapped line fits unless it is a single word, the
+ * next word would not have fitted, the last line takes the rest and the
+ * width is the one of the widest line. A cached layout has to be the
+ * same as a fresh one.
+ *
+ * It then replays 100 frames of the lights screen with 6 lights (12
+ * labels: font choice, then drawing) and reports text lookups and width
+ * measurements per frame next to what the old code did (each label
+ * fetched and measured for the font choice, then fetched again to draw).
+ *
+ * Build (Linux):
+ *   make -C Tools/tests text_layout_test
+ *
+ ******************************************************************************
+ */
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "text_layout.h"
+#include "host_test.h"
+/* Private Define ------------------------------------------------------------*/
+#define RANDOM_TEXTS        32U
+#define RANDOM_RUNS         3000U
+#define TEXT_MAX            96U
+#define FRAMES              100U
+#define LABELS              12U             /* 6 lights, name and room */
+/* Private Variable ----------------------------------------------------------*/
+static const char *table[][2] =
+{
+    { "", "" },
+    { "Svjetlo", "Light" },
+    { "Dnevni boravak", "Living room" },
+    { "Kuhinja", "Kitchen" },
+    { "Spavaca soba roditelja", "Parents bedroom" },
+    { "Prva linija\nDruga", "a b c d e f g h i j" },
+};
+static char label[40] = "Moja labela";
+static char random_text[RANDOM_TEXTS][TEXT_MAX];
+static uint32_t fetches, measures;
+static uint32_t rng = 0x1234567U;
+/* Private Function Prototype ------------------------------------------------*/
+static const char *Text(uint16_t key, uint8_t language);
+static int16_t Width(uint8_t font, const char *text, uint16_t len);
+static void MakeText(char *text);
+static void CheckLayout(const TextLayoutEntry_t *e, int16_t max_width);
+static uint16_t WordEnd(const char *text, uint16_t pos);
+static uint32_t Random(void);
+/* Program Code --------------------------------------------------------------*/
+int main(void)
+{
+    static const uint16_t keys[LABELS] = { 1U, 2U, 3U, 4U, 1U, 3U, 2U, 2U, 3U, 1U, 4U, TEXT_LAYOUT_LABEL_KEY(1, 0) };
+    static const uint8_t fonts[] = { 0U, 1U };
+    static const TextLayoutOps_t ops = { Text, Width };
+    static TextLayoutCache_t cache;
+    const TextLayoutEntry_t *e;
+    TextLayoutEntry_t copy;
+
+    TextLayout_Init(&cache, &ops);
+
+    // Fixed cases.
+    e = TextLayout_Get(&cache, 2U, 0U, 0U);
+    CHECK((e->width == (14 * 11)) && (e->lines == 1U));
+    e = TextLayout_Get(&cache, 5U, 0U, 0U);
+    CHECK((e->lines == 2U) && (e->line_len[0] == 11U) && (e->line_start[1] == 12U) && (e->width == (11 * 11)));
+    e = TextLayout_Wrap(&cache, 4U, 0U, 0U, 100);
+    CHECK(e->lines == 3U);                  /* "Spavaca" / "soba" / "roditelja" */
+    CheckLayout(e, 100);
+    e = TextLayout_Wrap(&cache, 4U, 0U, 0U, 20);
+    CHECK((e->lines == 3U) && (e->width == (9 * 11)));
+    e = TextLayout_Wrap(&cache, 5U, 1U, 0U, 30);
+    CHECK(e->lines == TEXT_LAYOUT_MAX_LINES);
+    CHECK(strcmp(&e->text[e->line_start[e->lines - 1U]], "d e f g h i j") == 0);
+    e = TextLayout_Get(&cache, 0U, 0U, 0U);
+    CHECK((e->lines == 1U) && (e->width == 0));
+
+    // Random texts wrapped at random widths.
+    for (uint32_t i = 0U; i < RANDOM_TEXTS; i++) MakeText(random_text[i]);
+    for (uint32_t run = 0U; run < RANDOM_RUNS; run++)
+    {
+        uint16_t key = (uint16_t)(100U + (Random() % RANDOM_TEXTS));
+        uint8_t font = (uint8_t)(Random() % 2U);
+        int16_t max_width = (int16_t)(Random() % 400U);
+        uint32_t before;
+
+        e = TextLayout_Wrap(&cache, key, 0U, font, max_width);
+        CheckLayout(e, max_width);
+        copy = *e;
+        before = measures;
+        e = TextLayout_Wrap(&cache, key, 0U, font, max_width);
+        CHECK(measures == before);
+        CHECK(memcmp(e->line_start, copy.line_start, sizeof(copy.line_start)) == 0);
+        CHECK(memcmp(e->line_len, copy.line_len, sizeof(copy.line_len)) == 0);
+        CHECK((e->lines == copy.lines) && (e->width == copy.width));
+    }
+
+    // Lights screen, 6 lights, 100 frames.
+    TextLayout_InvalidateAll(&cache);
+    fetches = 0U;
+    measures = 0U;
+    cache.hits = 0U;
+    cache.lookups = 0U;
+    for (uint32_t f = 0U; f < FRAMES; f++)
+    {
+        uint8_t font = TextLayout_ChooseFont(&cache, 1U, 0U, keys, LABELS, 140, fonts, 2U);
+
+        CHECK(font == 1U);
+        for (uint8_t i = 0U; i < LABELS; i++)
+        {
+            e = TextLayout_Get(&cache, keys[i], 0U, font);
+            CHECK((e->key == keys[i]) && (e->font == font));
+        }
+    }
+    printf("lights screen, %u labels, %u frames\n", LABELS, FRAMES);
+    printf("           text lookups/frame  measurements/frame\n");
+    printf("before     %18.2f  %18.2f\n", (double)(2U * LABELS), (double)LABELS);
+    printf("after      %18.2f  %18.2f   (%u/%u cache hits)\n", (double)fetches / FRAMES, (double)measures / FRAMES,
+           cache.hits, cache.lookups);
+    CHECK(fetches < LABELS);
+    CHECK(measures < (2U * LABELS));
+
+    // Wider area: the first font fits.
+    CHECK(TextLayout_ChooseFont(&cache, 1U, 0U, keys, LABELS, 300, fonts, 2U) == 0U);
+    // Nothing fits: the last font.
+    CHECK(TextLayout_ChooseFont(&cache, 1U, 0U, keys, LABELS, 10, fonts, 2U) == 1U);
+
+    // A custom label changes: only the label is fetched again.
+    strcpy(label, "Promijenjena labela duza");
+    TextLayout_InvalidateLabels(&cache);
+    fetches = 0U;
+    e = TextLayout_Get(&cache, TEXT_LAYOUT_LABEL_KEY(1, 0), 0U, 1U);
+    CHECK((strcmp(e->text, label) == 0) && (e->width == (24 * 9)));
+    CHECK(TextLayout_ChooseFont(&cache, 1U, 0U, keys, LABELS, 220, fonts, 2U) == 1U);
+    CHECK(fetches == 1U);
+
+    // More entries than the cache holds.
+    for (uint32_t i = 0U; i < (4U * TEXT_LAYOUT_MAX_ENTRIES); i++)
+    {
+        e = TextLayout_Get(&cache, (uint16_t)((i % 5U) + 1U), (uint8_t)(i % 2U), (uint8_t)(i % 7U));
+        CHECK((e->key == ((i % 5U) + 1U)) && (e->language == (i % 2U)) && (e->font == (i % 7U)));
+        CHECK(strcmp(e->text, table[(i % 5U) + 1U][i % 2U]) == 0);
+    }
+
+    return HOST_TEST_END("text_layout_test");
+}
+
+static const char *Text(uint16_t key, uint8_t language)
+{
+    fetches++;
+    if (key >= TEXT_LAYOUT_LABEL_BASE) return label;
+    if (key >= 100U) return random_text[key - 100U];
+    return table[key][language];
+}
+
+static int16_t Width(uint8_t font, const char *text, uint16_t len)
+{
+    (void)text;
+    measures++;
+    return (int16_t)(len * ((font != 0U) ? 9U : 11U));
+}
+
+/**
+ * @brief  1..12 words of 1..12 letters, single spaces, sometimes a '\n'.
+ */
+static void MakeText(char *text)
+{
+    uint32_t words = 1U + (Random() % 12U);
+    uint32_t n = 0U;
+
+    for (uint32_t w = 0U; w < words; w++)
+    {
+        uint32_t len = 1U + (Random() % 12U);
+
+        if ((n + len + 1U) >= TEXT_MAX) break;
+        if (w != 0U) text[n++] = ((Random() % 6U) == 0U) ? '\n' : ' ';
+        for (uint32_t k = 0U; k < len; k++) text[n++] = (char)('a' + (Random() % 26U));
+    }
+    text[n] = '\0';
+}
+
+/**
+ * @brief  Layout rules, measured independently of the cache.
+ */
+static void CheckLayout(const TextLayoutEntry_t *e, int16_t max_width)
+{
+    const char *t = e->text;
+    int16_t widest = 0;
+    bool ok = (e->lines >= 1U) && (e->lines <= TEXT_LAYOUT_MAX_LINES) && (e->line_start[0] == 0U);
+
+    for (uint8_t i = 0U; ok && (i < e->lines); i++)
+    {
+        uint16_t start = e->line_start[i];
+        uint16_t end = (uint16_t)(start + e->line_len[i]);
+        int16_t w = (int16_t)(e->line_len[i] * ((e->font != 0U) ? 9U : 11U));
+        bool single_word = (memchr(&t[start], ' ', e->line_len[i]) == NULL);
+
+        if (w > widest) widest = w;
+        if (i == (e->lines - 1U))
+        {
+            // The last line ends the text.
+            if (end != strlen(t)) ok = false;
+            continue;
+        }
+        // Split at one '\n' or at spaces, nothing else skipped.
+        if (t[end] == '\n')
+        {
+            if (e->line_start[i + 1U] != (end + 1U)) ok = false;
+            if (memchr(&t[start], '\n', e->line_len[i]) != NULL) ok = false;
+            continue;
+        }
+        if ((t[end] != ' ') || (max_width <= 0)) ok = false;
+        for (uint16_t k = end; k < e->line_start[i + 1U]; k++)
+        {
+            if (t[k] != ' ') ok = false;
+        }
+        // Fits unless a single word; the next word would not fit.
+        if ((w > max_width) && !single_word) ok = false;
+        if ((int16_t)((WordEnd(t, e->line_start[i + 1U]) - start) * ((e->font != 0U) ? 9U : 11U)) <= max_width)
+        {
+            ok = false;
+        }
+    }
+    if (widest != e->width) ok = false;
+    CHECK(ok);
+    if (!ok) printf("  layout of \"%s\" at %d px: %u lines, width %d\n", t, max_width, e->lines, e->width);
+}
+
+static uint16_t WordEnd(const char *text, uint16_t pos)
+{
+    while ((text[pos] != '\0') && (text[pos] != ' ') && (text[pos] != '\n')) pos++;
+    return pos;
+}
+
+static uint32_t Random(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
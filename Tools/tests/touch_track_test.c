@@ -0,0 +1,248 @@
+/**
+ ******************************************************************************
+ * File Name          : touch_track_test.c
+ * Description        : host test, touch decoding and replay of the polled and
+ *                      INT driven read schedules
+ ******************************************************************************
+ *
+ * Checks IC/Src/touch_track.c on FT5336 register blocks (touch count,
+ * event bits in the coordinate registers, touches off the screen) and on
+ * the report rules: a change of pressed state is always reported, a move
+ * only above the threshold, a release carries the last coordinates.
+ *
+ * It then replays gestures against a model of the controller (a new
+ * sample every 8 ms while touched, one INT pulse per sample including
+ * the lift-off one) and runs TS_Service() of IC/Src/main.c once per
+ * millisecond with both read schedules:
+ *  - poll: a read every TS_UPDATE_TIME, the default while the INT pin
+ *    (PG13, TS_INT_ENABLED) is not confirmed on the board,
+ *  - INT:  a read per INT pulse, plus one every TS_RELEASE_TIMEOUT while
+ *    pressed in case the release pulse is lost.
+ * Every gesture starts at 20 phases of the sample clock. For each
+ * schedule the test reports touch-down and release latency, register
+ * reads and reports to emWin per gesture, and reads in 10 s of idle.
+ * Both schedules have to report every press and release exactly once.
+ *
+ * Build (Linux):
+ *   make -C Tools/tests touch_track_test
+ *
+ ******************************************************************************
+ */
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "touch_track.h"
+#include "host_test.h"
+/* Private Define ------------------------------------------------------------*/
+#define LCD_W               480U
+#define LCD_H               272U
+#define TS_UPDATE_TIME      20U             /* main.c */
+#define TS_RELEASE_TIMEOUT  100U            /* main.c */
+#define SAMPLE_MS           8U              /* FT5336 report period while touched */
+#define PHASES              20U
+#define IDLE_MS             10000U
+/* Private Type --------------------------------------------------------------*/
+typedef enum
+{
+    SCHED_POLL,
+    SCHED_INT,
+    SCHEDS
+} Sched_t;
+
+typedef struct
+{
+    const char *name;
+    uint32_t    length;                     /* ms touched */
+    uint16_t    x0, y0;
+    int16_t     dx;                         /* px per 10 ms */
+    bool        precise;                    /* g_high_precision_mode (sliders) */
+    bool        lose_release;               /* release INT pulse lost */
+} Gesture_t;
+
+typedef struct
+{
+    uint32_t down;                          /* ms from touch to the press report */
+    uint32_t up;                            /* ms from lift-off to the release report */
+    uint32_t reads;
+    uint32_t reports;
+    uint32_t presses, releases;
+    bool     release_at_last;               /* release carried the last coordinates */
+} Result_t;
+/* Private Variable ----------------------------------------------------------*/
+static const Gesture_t gestures[] =
+{
+    { "tap",               120U, 200U, 100U,  0, false, false },
+    { "swipe",             400U,  40U, 136U, 10, false, false },
+    { "slider drag",       600U, 100U, 200U,  4, true,  false },
+    { "long press",       1500U, 300U,  60U,  0, false, false },
+    { "lost release INT",  200U, 240U, 136U,  0, false, true  },
+};
+/* Private Function Prototype ------------------------------------------------*/
+static void Regs(uint8_t *regs, uint8_t touches, uint16_t x, uint16_t y);
+static void Replay(const Gesture_t *g, Sched_t sched, uint32_t phase, Result_t *res);
+/* Program Code --------------------------------------------------------------*/
+int main(void)
+{
+    static const char *sched_names[] = { "poll", "INT" };
+    TouchTrack_t track;
+    TouchSample_t s, report;
+    Result_t idle_poll, idle_int;
+    uint8_t regs[TOUCH_TRACK_REG_COUNT];
+
+    // Decoding.
+    Regs(regs, 1U, 0x123U, 0x0ABU);
+    regs[1] |= 0x40U;                       /* event flag: contact */
+    TouchTrack_Decode(regs, LCD_W, LCD_H, &s);
+    CHECK(s.pressed && (s.x == 0x123U) && (s.y == 0x0ABU));
+    Regs(regs, 1U, 500U, 10U);
+    TouchTrack_Decode(regs, LCD_W, LCD_H, &s);
+    CHECK(!s.pressed && (s.x == 0U) && (s.y == 0U));
+    Regs(regs, 7U, 10U, 10U);               /* invalid touch count */
+    TouchTrack_Decode(regs, LCD_W, LCD_H, &s);
+    CHECK(!s.pressed);
+    Regs(regs, 0U, 10U, 10U);
+    TouchTrack_Decode(regs, LCD_W, LCD_H, &s);
+    CHECK(!s.pressed && (s.x == 0U));
+
+    // Report rules.
+    CHECK(TouchTrack_Threshold(true) == TOUCH_TRACK_THRESHOLD_PRECISE);
+    CHECK(TouchTrack_Threshold(false) == TOUCH_TRACK_THRESHOLD_NORMAL);
+    TouchTrack_Init(&track);
+    s = (TouchSample_t){ 100U, 100U, true };
+    CHECK(TouchTrack_Update(&track, &s, 30U, &report) && report.pressed && (report.x == 100U));
+    s.x = 120U;
+    CHECK(!TouchTrack_Update(&track, &s, 30U, &report));
+    CHECK(TouchTrack_Update(&track, &s, 2U, &report) && (report.x == 120U));
+    s = (TouchSample_t){ 0U, 0U, false };
+    CHECK(TouchTrack_Update(&track, &s, 30U, &report) && !report.pressed && (report.x == 120U));
+    CHECK(!TouchTrack_Update(&track, &s, 30U, &report));
+    CHECK((track.samples == 5U) && (track.reports == 3U));
+
+    // Replay.
+    printf("%-17s %-5s %8s %8s %7s %8s\n", "gesture", "sched", "down ms", "up ms", "reads", "reports");
+    for (uint8_t g = 0U; g < (sizeof(gestures) / sizeof(gestures[0])); g++)
+    {
+        for (uint8_t sched = 0U; sched < SCHEDS; sched++)
+        {
+            uint32_t down = 0U, up = 0U, reads = 0U, reports = 0U, up_max = 0U;
+
+            for (uint32_t phase = 0U; phase < PHASES; phase++)
+            {
+                Result_t res;
+
+                Replay(&gestures[g], (Sched_t)sched, phase, &res);
+                CHECK((res.presses == 1U) && (res.releases == 1U));
+                CHECK(res.release_at_last);
+                down += res.down;
+                up += res.up;
+                reads += res.reads;
+                reports += res.reports;
+                if (res.up > up_max) up_max = res.up;
+            }
+            printf("%-17s %-5s %8.1f %8.1f %7.1f %8.1f\n", gestures[g].name, sched_names[sched],
+                   (double)down / PHASES, (double)up / PHASES, (double)reads / PHASES, (double)reports / PHASES);
+            if (sched == SCHED_POLL) CHECK(up_max <= (TS_UPDATE_TIME + SAMPLE_MS + 1U));
+            if ((sched == SCHED_INT) && !gestures[g].lose_release) CHECK(up_max <= (SAMPLE_MS + 1U));
+            if ((sched == SCHED_INT) && gestures[g].lose_release) CHECK(up_max <= (TS_RELEASE_TIMEOUT + SAMPLE_MS + 1U));
+        }
+    }
+    // Nobody touches the screen.
+    Replay(NULL, SCHED_POLL, 0U, &idle_poll);
+    Replay(NULL, SCHED_INT, 0U, &idle_int);
+    printf("reads in %u s idle: poll %u, INT %u\n", IDLE_MS / 1000U, idle_poll.reads, idle_int.reads);
+    CHECK(idle_int.reads == 0U);
+    CHECK(idle_poll.reads == (IDLE_MS / TS_UPDATE_TIME));
+    CHECK((idle_poll.reports == 0U) && (idle_int.reports == 0U));
+
+    return HOST_TEST_END("touch_track_test");
+}
+
+/**
+ * @brief  TD_STAT and the first touch, as BSP_TS_ReadRegsIT() reads them.
+ */
+static void Regs(uint8_t *regs, uint8_t touches, uint16_t x, uint16_t y)
+{
+    regs[0] = touches;
+    regs[1] = (uint8_t)(x >> 8);
+    regs[2] = (uint8_t)x;
+    regs[3] = (uint8_t)(y >> 8);
+    regs[4] = (uint8_t)y;
+}
+
+/**
+ * @brief  One gesture with the main loop running once per millisecond.
+ * @note   A read started in one pass completes in the I2C interrupt and
+ *         is decoded in the next pass, with the registers it sampled.
+ *         Without a gesture (`g` NULL) the screen stays untouched for
+ *         IDLE_MS.
+ */
+static void Replay(const Gesture_t *g, Sched_t sched, uint32_t phase, Result_t *res)
+{
+    uint32_t t0 = 1000U + (phase * 3U);
+    uint32_t t1 = (g != NULL) ? (t0 + g->length) : t0;
+    uint32_t end = (g != NULL) ? (t1 + 500U) : IDLE_MS;
+    uint8_t regs[TOUCH_TRACK_REG_COUNT] = { 0U }, snap[TOUCH_TRACK_REG_COUNT];
+    uint16_t threshold = TouchTrack_Threshold((g != NULL) && g->precise);
+    bool int_pending = false, busy = false, was_pressed = false, down = false;
+    uint32_t read_tmr = 0U;
+    uint16_t last_x = 0U, last_y = 0U;
+    TouchTrack_t track;
+
+    memset(res, 0, sizeof(Result_t));
+    TouchTrack_Init(&track);
+    for (uint32_t ms = 1U; ms <= end; ms++)
+    {
+        bool due;
+
+        // Controller: samples on its own clock, pulses INT per report.
+        if ((ms % SAMPLE_MS) == 0U)
+        {
+            bool pressed = (ms >= t0) && (ms < t1);
+            if (pressed) Regs(regs, 1U, (uint16_t)((int32_t)g->x0 + ((g->dx * (int32_t)(ms - t0)) / 10)), g->y0);
+            else Regs(regs, 0U, 0U, 0U);
+            // EXTI is only enabled with TS_INT_ENABLED.
+            if ((sched == SCHED_INT) && (pressed || (was_pressed && !g->lose_release))) int_pending = true;
+            was_pressed = pressed;
+        }
+
+        // TS_Service().
+        if (busy)
+        {
+            TouchSample_t sample, report;
+
+            busy = false;
+            TouchTrack_Decode(snap, LCD_W, LCD_H, &sample);
+            if (TouchTrack_Update(&track, &sample, threshold, &report))
+            {
+                res->reports++;
+                if (report.pressed)
+                {
+                    // A move while pressed is not a new press.
+                    if (!down && (res->presses++ == 0U)) res->down = ms - t0;
+                    down = true;
+                    last_x = report.x;
+                    last_y = report.y;
+                }
+                else
+                {
+                    down = false;
+                    res->releases++;
+                    res->up = ms - t1;
+                    res->release_at_last = (report.x == last_x) && (report.y == last_y);
+                }
+            }
+        }
+        if (sched == SCHED_POLL) due = ((ms - read_tmr) >= TS_UPDATE_TIME);
+        else due = track.last.pressed && ((ms - read_tmr) >= TS_RELEASE_TIMEOUT);
+        if (!busy && (int_pending || due))
+        {
+            int_pending = false;
+            read_tmr = ms;
+            busy = true;
+            res->reads++;
+            memcpy(snap, regs, sizeof(snap));
+        }
+    }
+}